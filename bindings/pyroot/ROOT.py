@@ -425,8 +425,8 @@ def _RDataFrameAsNumpy(df, columns=None, exclude=None):
     for column in columns:
         cpp_reference = result_ptrs[column].GetValue()
         if hasattr(cpp_reference, "__array_interface__"):
-            tmp = numpy.array(cpp_reference) # This adopts the memory of the C++ object.
-            py_arrays[column] = ndarray(tmp, result_ptrs[column])
+            # This creates a view of the memory of the C++ object, which is kept alive by the result pointer.
+            py_arrays[column] = ndarray(cpp_reference, result_ptrs[column])
         else:
             tmp = numpy.empty(len(cpp_reference), dtype=numpy.object)
             for i, x in enumerate(cpp_reference):
@@ -27,6 +27,7 @@
 #include <map>
 #include <set>
 #include <sstream>
+#include <unordered_map>
 
 // temp
 #include <iostream>
@@ -54,6 +55,9 @@ static Name2ClassRefIndex_t g_name2classrefidx;
 typedef std::map< Cppyy::TCppMethod_t, CallFunc_t* > Method2CallFunc_t;
 static Method2CallFunc_t g_method2callfunc;
 
+typedef std::unordered_map< Cppyy::TCppMethod_t, TInterpreter::CallFuncIFacePtr_t > Method2IFacePtr_t;
+static Method2IFacePtr_t g_method2ifaceptr;
+
 typedef std::vector< TFunction > GlobalFuncs_t;
 static GlobalFuncs_t g_globalfuncs;
 
@@ -411,16 +415,31 @@ static inline void copy_args( void* args_, void** vargs ) {
    }
 }
 
+// the wrapper of a method is cached on first use, such that subsequent calls go
+// directly to it rather than through the CallFunc
+static inline const TInterpreter::CallFuncIFacePtr_t* GetCallFuncIFacePtr( Cppyy::TCppMethod_t method )
+{
+   auto iface = g_method2ifaceptr.find( method );
+   if ( iface != g_method2ifaceptr.end() )
+      return &iface->second;
+
+   CallFunc_t* callf = GetCallFunc( method );
+   if ( ! callf )
+      return nullptr;
+
+   return &g_method2ifaceptr.emplace( method, gCling->CallFunc_IFacePtr( callf ) ).first->second;
+}
+
 Bool_t FastCall(
       Cppyy::TCppMethod_t method, void* args_, void* self, void* result )
 {
    const std::vector<TParameter>& args = *(std::vector<TParameter>*)args_;
 
-   CallFunc_t* callf = GetCallFunc( method );
-   if ( ! callf )
+   const TInterpreter::CallFuncIFacePtr_t* pfaceptr = GetCallFuncIFacePtr( method );
+   if ( ! pfaceptr )
       return kFALSE;
 
-   TInterpreter::CallFuncIFacePtr_t faceptr = gCling->CallFunc_IFacePtr( callf );
+   const TInterpreter::CallFuncIFacePtr_t& faceptr = *pfaceptr;
    if ( faceptr.fKind == TInterpreter::CallFuncIFacePtr_t::kGeneric ) {
       if ( args.size() <= SMALL_ARGS_N ) {
          void* smallbuf[SMALL_ARGS_N];
@@ -607,15 +607,25 @@ namespace {
    // otherwise, handle overloading
       Long_t sighash = HashSignature( args );
 
-   // look for known signatures ...
-      MethodProxy::DispatchMap_t::iterator m = dispatchMap.find( sighash );
-      if ( m != dispatchMap.end() ) {
-         Int_t index = m->second;
-         PyObject* result = methods[ index ]->Call( pymeth->fSelf, args, kwds, &ctxt );
+   // look for known signatures, starting with the last one used ...
+      PyCallable* known = nullptr;
+      if ( pymeth->fMethodInfo->fLastMethod && pymeth->fMethodInfo->fLastSignature == sighash )
+         known = pymeth->fMethodInfo->fLastMethod;
+      else {
+         MethodProxy::DispatchMap_t::iterator m = dispatchMap.find( sighash );
+         if ( m != dispatchMap.end() )
+            known = m->second;
+      }
+
+      if ( known ) {
+         PyObject* result = known->Call( pymeth->fSelf, args, kwds, &ctxt );
          result = HandleReturn( pymeth, oldSelf, result );
 
-         if ( result != 0 )
+         if ( result != 0 ) {
+            pymeth->fMethodInfo->fLastSignature = sighash;
+            pymeth->fMethodInfo->fLastMethod = known;
             return result;
+         }
 
       // fall through: python is dynamic, and so, the hashing isn't infallible
          ResetCallState( pymeth->fSelf, oldSelf, kTRUE );
@@ -633,7 +643,9 @@ namespace {
 
          if ( result != 0 ) {
          // success: update the dispatch map for subsequent calls
-            dispatchMap[ sighash ] = i;
+            dispatchMap[ sighash ] = methods[i];
+            pymeth->fMethodInfo->fLastSignature = sighash;
+            pymeth->fMethodInfo->fLastMethod = methods[i];
             std::for_each( errors.begin(), errors.end(), PyError_t::Clear );
             return HandleReturn( pymeth, oldSelf, result );
          }
@@ -932,6 +944,7 @@ void PyROOT::MethodProxy::AddMethod( PyCallable* pc )
 {
    fMethodInfo->fMethods.push_back( pc );
    fMethodInfo->fFlags &= ~TCallContext::kIsSorted;
+   ResetDispatch();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -941,6 +954,18 @@ void PyROOT::MethodProxy::AddMethod( MethodProxy* meth )
    fMethodInfo->fMethods.insert( fMethodInfo->fMethods.end(),
       meth->fMethodInfo->fMethods.begin(), meth->fMethodInfo->fMethods.end() );
    fMethodInfo->fFlags &= ~TCallContext::kIsSorted;
+   ResetDispatch();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Forget the overloads selected for the known signatures, since an added
+/// overload may be a better match.
+
+void PyROOT::MethodProxy::ResetDispatch()
+{
+   fMethodInfo->fDispatchMap.clear();
+   fMethodInfo->fLastSignature = 0;
+   fMethodInfo->fLastMethod = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
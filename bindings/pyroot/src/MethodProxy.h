@@ -20,11 +20,12 @@ namespace PyROOT {
 
    class MethodProxy {
    public:
-      typedef std::map< Long_t, Int_t >  DispatchMap_t;
+      typedef std::map< Long_t, PyCallable* >  DispatchMap_t;
       typedef std::vector< PyCallable* > Methods_t;
 
       struct MethodInfo_t {
-         MethodInfo_t() : fFlags( TCallContext::kNone ) { fRefCount = new int(1); }
+         MethodInfo_t() : fFlags( TCallContext::kNone ), fLastSignature( 0 ), fLastMethod( nullptr )
+            { fRefCount = new int(1); }
          ~MethodInfo_t();
 
          std::string                 fName;
@@ -32,6 +33,11 @@ namespace PyROOT {
          MethodProxy::Methods_t      fMethods;
          UInt_t                      fFlags;
 
+      // last successful dispatch, which is checked before the map since
+      // loops tend to call a method with the same argument types
+         Long_t                      fLastSignature;
+         PyCallable*                 fLastMethod;
+
          int* fRefCount;
 
       private:
@@ -45,6 +51,7 @@ namespace PyROOT {
       const std::string& GetName() const { return fMethodInfo->fName; }
       void AddMethod( PyCallable* pc );
       void AddMethod( MethodProxy* meth );
+      void ResetDispatch();
 
    public:               // public, as the python C-API works with C structs
       PyObject_HEAD
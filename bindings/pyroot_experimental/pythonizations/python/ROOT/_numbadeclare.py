@@ -17,7 +17,9 @@ def _NumbaDeclareDecorator(input_types, return_type, name=None):
     which converts the Python signature to a C-friendly signature. The wrapper code is accessible by
     the attribute __py_wrapper__. Next, the Python wrapper is given to cling to jit a C++ wrapper function,
     making the original Python callable accessible in C++. The wrapper code in C++ is accessible by
-    the attribute __cpp_wrapper__.
+    the attribute __cpp_wrapper__ and the qualified name of the C++ function by the attribute __cpp_name__.
+    The decorated callable can be passed directly to RDataFrame.Define and RDataFrame.Filter, see
+    the RDataFrame pythonizations.
 
     Note that the callable is fully compiled without side-effects. The numba jitting uses the nopython
     option which does not allow interaction with the Python interpreter. This means that you can use
@@ -303,6 +305,7 @@ namespace Numba {{
         if not err:
             raise Exception('Failed to jit C++ wrapper code with cling:\n{}'.format(cppwrappercode))
         func.__cpp_wrapper__ = cppwrappercode
+        func.__cpp_name__ = 'Numba::' + name
 
         return func
 
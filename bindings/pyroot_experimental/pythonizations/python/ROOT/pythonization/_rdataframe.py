@@ -10,6 +10,8 @@
 
 from ROOT import pythonization
 
+import types
+
 # functools.partial does not add the self argument
 # this is done by functools.partialmethod which is
 # introduced only in Python 3.4
@@ -76,8 +78,8 @@ def RDataFrameAsNumpy(df, columns=None, exclude=None):
     for column in columns:
         cpp_reference = result_ptrs[column].GetValue()
         if hasattr(cpp_reference, "__array_interface__"):
-            tmp = numpy.array(cpp_reference) # This adopts the memory of the C++ object.
-            py_arrays[column] = ndarray(tmp, result_ptrs[column])
+            # This creates a view of the memory of the C++ object, which is kept alive by the result pointer.
+            py_arrays[column] = ndarray(cpp_reference, result_ptrs[column])
         else:
             tmp = numpy.empty(len(cpp_reference), dtype=numpy.object)
             for i, x in enumerate(cpp_reference):
@@ -124,6 +126,54 @@ def _histo_profile(self, fixed_args, *args):
     return res
 
 
+def _numba_call_expression(func, columns):
+    # Build the expression calling in C++ the wrapper of a Python callable
+    # jitted with ROOT.Numba.Declare. The columns passed as arguments default
+    # to the names of the arguments of the callable.
+    if not hasattr(func, '__cpp_name__'):
+        raise TypeError('Python callable {} passed to RDataFrame is not declared to C++. '
+                        'Decorate it with ROOT.Numba.Declare.'.format(func.__name__))
+    if columns is None:
+        code = func.__code__
+        columns = code.co_varnames[:code.co_argcount]
+    return '{}({})'.format(func.__cpp_name__, ', '.join(str(c) for c in columns))
+
+
+def _RDataFrameDefine(self, name, expression, *args):
+    """Define a new column, see ROOT::RDF::RInterface::Define.
+
+    Besides the C++ overloads, the expression can be a Python callable jitted with
+    ROOT.Numba.Declare. It is called through its C++ wrapper, without acquiring the
+    GIL, so that it can run in the multi-threaded event loop:
+    ~~~{.py}
+    @ROOT.Numba.Declare(['float', 'float'], 'float')
+    def pt(px, py):
+        return (px**2 + py**2)**0.5
+    df.Define('pt', pt) # columns px and py, from the names of the arguments
+    df.Define('pt', pt, ['x', 'y'])
+    ~~~
+    """
+    if isinstance(expression, types.FunctionType):
+        columns = args[0] if args else None
+        return self._OriginalDefine(name, _numba_call_expression(expression, columns))
+    return self._OriginalDefine(name, expression, *args)
+
+
+def _RDataFrameFilter(self, expression, *args):
+    """Filter the entries, see ROOT::RDF::RInterface::Filter.
+
+    Besides the C++ overloads, the expression can be a Python callable jitted with
+    ROOT.Numba.Declare, followed by the optional list of columns passed as arguments
+    (by default the names of the arguments of the callable) and name of the filter,
+    see RDataFrame.Define for an example.
+    """
+    if isinstance(expression, types.FunctionType):
+        columns = args[0] if len(args) > 0 else None
+        filter_name = args[1] if len(args) > 1 else ""
+        return self._OriginalFilter(_numba_call_expression(expression, columns), filter_name)
+    return self._OriginalFilter(expression, *args)
+
+
 @pythonization()
 def pythonize_rdataframe(klass, name):
     # Parameters:
@@ -136,6 +186,14 @@ def pythonize_rdataframe(klass, name):
         # Add asNumpy feature
         klass.AsNumpy = RDataFrameAsNumpy
 
+        # Accept Python callables jitted with ROOT.Numba.Declare in Define and Filter.
+        # The check avoids wrapping twice the methods inherited from a pythonized base.
+        if not hasattr(klass, '_OriginalDefine'):
+            klass._OriginalDefine = klass.Define
+            klass.Define = _RDataFrameDefine
+            klass._OriginalFilter = klass.Filter
+            klass.Filter = _RDataFrameFilter
+
         # Replace the implementation of the following RDF methods
         # to convert a tuple argument into a model object
         methods_with_TModel = {
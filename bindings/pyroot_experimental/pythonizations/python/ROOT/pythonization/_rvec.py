@@ -15,35 +15,45 @@ from libROOTPythonizations import GetEndianess, GetDataPointer, GetSizeOfType
 _array_interface_dtype_map = {
     "float": "f",
     "double": "f",
+    "char": "i",
+    "short": "i",
     "int": "i",
     "long": "i",
+    "long long": "i",
     "Long64_t": "i",
+    "unsigned char": "u",
+    "unsigned short": "u",
     "unsigned int": "u",
     "unsigned long": "u",
+    "unsigned long long": "u",
     "ULong64_t": "u",
 }
 
 
+def make_array_interface(pointer, size, dtype, endianess=None):
+    # Array interface of `size` contiguous values of the C++ type `dtype` at `pointer`.
+    # The memory is shared with numpy, which keeps alive the object providing the interface.
+    if endianess is None:
+        endianess = GetEndianess()
+    # Numpy breaks for data pointer of 0 even though the array is empty.
+    # We set the pointer to 1 but the value itself is arbitrary and never accessed.
+    if size == 0:
+        pointer = 1
+    return {
+        "shape": (size, ),
+        "typestr": "{}{}{}".format(endianess, _array_interface_dtype_map[dtype], GetSizeOfType(dtype)),
+        "version": 3,
+        "data": (pointer, False)
+    }
+
+
 def get_array_interface(self):
     cppname = type(self).__cpp_name__
     for dtype in _array_interface_dtype_map:
         if cppname.endswith("<{}>".format(dtype)):
-            dtype_numpy = _array_interface_dtype_map[dtype]
-            dtype_size = GetSizeOfType(dtype)
-            endianess = GetEndianess()
             size = self.size()
-            # Numpy breaks for data pointer of 0 even though the array is empty.
-            # We set the pointer to 1 but the value itself is arbitrary and never accessed.
-            if self.empty():
-                pointer = 1
-            else:
-                pointer = GetDataPointer(self, cppname, "data")
-            return {
-                "shape": (size, ),
-                "typestr": "{}{}{}".format(endianess, dtype_numpy, dtype_size),
-                "version": 3,
-                "data": (pointer, False)
-            }
+            pointer = 0 if size == 0 else GetDataPointer(self, cppname, "data")
+            return make_array_interface(pointer, size, dtype)
 
 
 def add_array_interface_property(klass, name):
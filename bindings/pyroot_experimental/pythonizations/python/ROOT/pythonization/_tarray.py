@@ -9,8 +9,30 @@
 ################################################################################
 
 from ROOT import pythonization
+from libROOTPythonizations import GetDataPointer
 
 from ._generic import _add_getitem_checked
+from ._rvec import make_array_interface
+
+
+# C++ type of the values of the TArray subclasses
+_tarray_dtype_map = {
+    "TArrayC": "char",
+    "TArrayS": "short",
+    "TArrayI": "int",
+    "TArrayL": "long",
+    "TArrayL64": "Long64_t",
+    "TArrayF": "float",
+    "TArrayD": "double",
+}
+
+
+def _TArray__array_interface__(self):
+    # Numpy array interface sharing the memory of the TArray
+    cppname = type(self).__cpp_name__
+    size = self.GetSize()
+    pointer = 0 if size == 0 else GetDataPointer(self, cppname, "GetArray")
+    return make_array_interface(pointer, size, _tarray_dtype_map[cppname])
 
 
 @pythonization()
@@ -30,4 +52,8 @@ def pythonize_tarray(klass, name):
         # is out of range and to iterate over the array.
         _add_getitem_checked(klass)
 
+        # Add numpy array interface
+        if name in _tarray_dtype_map:
+            klass.__array_interface__ = property(_TArray__array_interface__)
+
     return True
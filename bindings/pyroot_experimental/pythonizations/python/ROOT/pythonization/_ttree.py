@@ -8,10 +8,11 @@
 # For the list of contributors see $ROOTSYS/README/CREDITS.                    #
 ################################################################################
 
-from libROOTPythonizations import AddBranchAttrSyntax, SetBranchAddressPyz, BranchPyz
+from libROOTPythonizations import AddBranchAttrSyntax, SetBranchAddressPyz, BranchPyz, GetDataPointer
 
 import cppyy
 from ROOT import pythonization
+from ._rvec import make_array_interface
 
 # TTree iterator
 def _TTree__iter__(self):
@@ -168,6 +169,74 @@ def _TTreeAsMatrix(self, columns=None, exclude=None, dtype="double", return_labe
     else:
         return reshaped_matrix_np
 
+# C++ type of the values of the leaves that can be read in bulk
+_bulk_leaf_dtype_map = {
+    "Char_t": "char",
+    "UChar_t": "unsigned char",
+    "Short_t": "short",
+    "UShort_t": "unsigned short",
+    "Int_t": "int",
+    "UInt_t": "unsigned int",
+    "Long64_t": "Long64_t",
+    "ULong64_t": "ULong64_t",
+    "Float_t": "float",
+    "Double_t": "double",
+}
+
+class _BulkBuffer(object):
+    # Provider of the array interface of a bulk read, keeping the buffer alive
+    def __init__(self, buf, interface):
+        self.buffer = buf
+        self.__array_interface__ = interface
+
+def _TBranchGetBulkArray(self, entry, buf):
+    """Read in bulk the entries of the branch from `entry` to the end of its basket.
+
+    The entries are read into the TBufferFile `buf` and returned as a numpy array
+    sharing the memory of `buf`, without copy nor byte swapping: the array has
+    the big-endian data-type of the serialized values, which numpy handles
+    transparently. The array is overwritten when `buf` is reused.
+
+    Args:
+        entry: First entry to read.
+        buf: TBufferFile in write mode, the entries are read into.
+
+    Returns:
+        numpy.array: Entries read, the size of the array is the number of entries.
+    """
+    # Import numpy lazily
+    try:
+        import numpy as np
+    except:
+        raise ImportError("Failed to import numpy during call of TBranch.GetBulkArray.")
+
+    if not self.SupportsBulkRead():
+        raise RuntimeError("Branch {} does not support bulk reading.".format(self.GetName()))
+    leaftype = self.GetListOfLeaves().At(0).GetTypeName()
+    if not leaftype in _bulk_leaf_dtype_map:
+        raise TypeError("Data-type {} of branch {} is not supported by GetBulkArray.".format(
+            leaftype, self.GetName()))
+
+    count = self.GetBulkRead().GetEntriesSerialized(entry, buf)
+    if count < 0:
+        raise RuntimeError("Failed to read branch {} in bulk from entry {}.".format(self.GetName(), entry))
+
+    pointer = 0 if count == 0 else GetDataPointer(buf, type(buf).__cpp_name__, "GetCurrent")
+    interface = make_array_interface(pointer, count, _bulk_leaf_dtype_map[leaftype], endianess=">")
+    return np.asarray(_BulkBuffer(buf, interface))
+
+@pythonization()
+def pythonize_tbranch(klass, name):
+    # Parameters:
+    # klass: class to be pythonized
+    # name: string containing the name of the class
+
+    if name == 'TBranch':
+        # Bulk read into a numpy array
+        klass.GetBulkArray = _TBranchGetBulkArray
+
+    return True
+
 @pythonization()
 def pythonize_ttree(klass, name):
     # Parameters:
@@ -27,7 +27,10 @@ PyROOT extension module.
 #include "RConfig.h"
 #include "TInterpreter.h"
 
+#include <map>
 #include <sstream>
+#include <string>
+#include <utility>
 
 ////////////////////////////////////////////////////////////////////////////
 /// \brief Get size of C++ data-type
@@ -35,18 +38,25 @@ PyROOT extension module.
 /// \param[in] args C++ data-type as Python string
 ///
 /// This function returns the length of a C++ data-type in bytes
-/// as a Python integer.
+/// as a Python integer. The sizes are cached, the interpreter is invoked
+/// only once per data-type.
 PyObject *PyROOT::GetSizeOfType(PyObject * /*self*/, PyObject *args)
 {
    // Get name of data-type
    PyObject *pydtype = PyTuple_GetItem(args, 0);
    std::string dtype = CPyCppyy_PyText_AsString(pydtype);
 
-   // Call interpreter to get size of data-type using `sizeof`
-   long size = 0;
-   std::stringstream code;
-   code << "*((long*)" << &size << ") = (long)sizeof(" << dtype << ")";
-   gInterpreter->Calc(code.str().c_str());
+   static std::map<std::string, long> sizes;
+   auto it = sizes.find(dtype);
+   if (it == sizes.end()) {
+      // Call interpreter to get size of data-type using `sizeof`
+      long size = 0;
+      std::stringstream code;
+      code << "*((long*)" << &size << ") = (long)sizeof(" << dtype << ")";
+      gInterpreter->Calc(code.str().c_str());
+      it = sizes.emplace(dtype, size).first;
+   }
+   const long size = it->second;
 
    // Return size of data-type as integer
    PyObject *pysize = PyInt_FromLong(size);
@@ -61,7 +71,10 @@ PyObject *PyROOT::GetSizeOfType(PyObject * /*self*/, PyObject *args)
 /// \param[in] args[2] Method to be called on the C++ object to get the data pointer as Python string
 ///
 /// This function returns the pointer to the data of an object as an Python
-/// integer retrieved by the given method.
+/// integer retrieved by the given method. A function calling the method is
+/// jitted once per pair of class and method, such that the array interfaces
+/// relying on this helper stay cheap when they are requested many times,
+/// e.g. once per entry of a tree.
 PyObject *PyROOT::GetDataPointer(PyObject * /*self*/, PyObject *args)
 {
    // Get pointer of C++ object
@@ -77,15 +90,29 @@ PyObject *PyROOT::GetDataPointer(PyObject * /*self*/, PyObject *args)
    PyObject *pymethodname = PyTuple_GetItem(args, 2);
    std::string methodname = CPyCppyy_PyText_AsString(pymethodname);
 
-   // Call interpreter to get pointer to data
-   unsigned long long pointer = 0;
-   std::stringstream code;
-   code << "*((long*)" << &pointer << ") = reinterpret_cast<long>(reinterpret_cast<"
-        << cppname << "*>(" << cppobj << ")->" << methodname << "())";
-   gInterpreter->Calc(code.str().c_str());
+   // Get the function returning the pointer to the data, jit it if needed
+   using DataPointerFunc_t = void *(*)(void *);
+   static std::map<std::pair<std::string, std::string>, DataPointerFunc_t> funcs;
+   auto key = std::make_pair(cppname, methodname);
+   auto it = funcs.find(key);
+   if (it == funcs.end()) {
+      const std::string funcname = "__PyROOT_GetDataPointer" + std::to_string(funcs.size());
+      std::stringstream decl;
+      decl << "namespace PyROOT { void *" << funcname << "(void *obj) { return (void*)(reinterpret_cast<" << cppname
+           << "*>(obj)->" << methodname << "()); } }";
+      DataPointerFunc_t func = nullptr;
+      if (gInterpreter->Declare(decl.str().c_str()))
+         func = (DataPointerFunc_t)gInterpreter->Calc(("(long)&PyROOT::" + funcname).c_str());
+      if (!func) {
+         PyErr_Format(PyExc_RuntimeError, "Failed to get the data pointer of %s with method %s.", cppname.c_str(),
+                      methodname.c_str());
+         return NULL;
+      }
+      it = funcs.emplace(key, func).first;
+   }
 
    // Return pointer as integer
-   PyObject *pypointer = PyLong_FromUnsignedLongLong(pointer);
+   PyObject *pypointer = PyLong_FromUnsignedLongLong((unsigned long long)it->second(cppobj));
    return pypointer;
 }
 
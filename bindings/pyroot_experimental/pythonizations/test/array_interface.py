@@ -1,3 +1,4 @@
+import os
 import unittest
 import ROOT
 import numpy as np
@@ -5,8 +6,8 @@ import numpy as np
 
 class ArrayInterface(unittest.TestCase):
     """
-    Test memory adoption of std::vector and ROOT::RVec with the numpy
-    array interface.
+    Test memory adoption of std::vector, ROOT::RVec, TArray and bulk reads
+    of TTree branches with the numpy array interface.
     """
 
     # Helpers
@@ -75,6 +76,53 @@ class ArrayInterface(unittest.TestCase):
         self.assertEqual(np_obj.shape, (0,))
         self.assertEqual(np_obj.__array_interface__["data"][0], 1)
 
+    def test_TArray(self):
+        """
+        Test correct adoption of the TArray subclasses
+        """
+        for klass in ["TArrayS", "TArrayI", "TArrayL", "TArrayL64", "TArrayF", "TArrayD"]:
+            root_obj = getattr(ROOT, klass)(2)
+            np_obj = np.asarray(root_obj)
+            self.check_memory_adoption(root_obj, np_obj)
+            self.check_shape((2, ), np_obj)
+
+    def test_TArray_empty(self):
+        """
+        Test adoption of empty TArray
+        """
+        np_obj = np.asarray(ROOT.TArrayD())
+        self.assertEqual(np_obj.shape, (0,))
+
+    def test_TBranch_GetBulkArray(self):
+        """
+        Test bulk read of a branch into a numpy array
+        """
+        filename = "array_interface_bulk.root"
+        f = ROOT.TFile(filename, "RECREATE")
+        tree = ROOT.TTree("tree", "tree")
+        x = np.empty(1, dtype=np.float32)
+        tree.Branch("x", x, "x/F")
+        for i in range(100):
+            x[0] = i
+            tree.Fill()
+        f.Write()
+        f.Close()
+
+        f = ROOT.TFile(filename)
+        tree = f.Get("tree")
+        branch = tree.GetBranch("x")
+        buf = ROOT.TBufferFile(ROOT.TBuffer.kWrite, 10000)
+        entries = []
+        entry = 0
+        while entry < tree.GetEntries():
+            np_obj = branch.GetBulkArray(entry, buf)
+            self.assertGreater(np_obj.size, 0)
+            entries.extend(np_obj.tolist())
+            entry += np_obj.size
+        self.assertEqual(entries, list(range(100)))
+        f.Close()
+        os.remove(filename)
+
 
 if __name__ == '__main__':
     unittest.main()
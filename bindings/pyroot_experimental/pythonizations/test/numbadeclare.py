@@ -123,6 +123,26 @@ class NumbaDeclareSimple(unittest.TestCase):
         self.assertEqual(mean_x.GetValue(), 1.5)
         self.assertEqual(mean_y.GetValue(), 3.0)
 
+    @unittest.skipIf(skip, skip_reason)
+    def test_rdataframe_callable(self):
+        """
+        Test passing the decorated callable to RDataFrame Define and Filter
+        """
+        @ROOT.Numba.Declare(["unsigned int"], "float")
+        def fn13b(x):
+            return 2.0 * x
+        @ROOT.Numba.Declare(["float"], "bool")
+        def fn13c(y):
+            return y > 1.0
+        df = ROOT.RDataFrame(4).Define("x", "rdfentry_").Define("y", fn13b).Define("z", fn13b, ["x"])
+        df = df.Filter(fn13c).Filter(fn13c, ["z"], "z above one")
+        self.assertEqual(df.Count().GetValue(), 3)
+        self.assertEqual(df.Mean("y").GetValue(), 4.0)
+
+        def fn13d(x):
+            return x
+        self.assertRaises(TypeError, df.Define, "w", fn13d)
+
     # Test wrappings
     @unittest.skipIf(skip, skip_reason)
     def test_wrapper_in_void(self):
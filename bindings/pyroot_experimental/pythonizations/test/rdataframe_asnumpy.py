@@ -226,6 +226,18 @@ class RDataFrameAsNumpy(unittest.TestCase):
         x = npy["x"]
         self.assertTrue(hasattr(x, "result_ptr"))
 
+    def test_numpy_no_copy(self):
+        """
+        Testing that the numpy array is a view of the values taken by the result pointer
+        """
+        df = ROOT.ROOT.RDataFrame(4).Define("x", "(double)rdfentry_")
+        npy = df.AsNumpy()
+        x = npy["x"]
+        cpp_data = x.result_ptr.GetValue().__array_interface__["data"][0]
+        self.assertEqual(x.__array_interface__["data"][0], cpp_data)
+        self.assertEqual(x.flags["OWNDATA"], False)
+        self.assertTrue(all(x == np.array([0, 1, 2, 3])))
+
     def test_numpy_slice(self):
         """
         Testing ownership of numpy array as owner of the data
@@ -11,6 +11,8 @@
 # FFTW_LIBRARIES, the libraries to link against to use fftw3
 # FFTW_FOUND.  If false, you cannot build anything that requires fftw3.
 # FFTW_LIBRARY, where to find the libfftw3 library.
+# FFTW_THREADS_LIBRARY, where to find the libfftw3_threads library, optional.
+# FFTW_THREADS_FOUND, whether FFTW_LIBRARIES include the threads library.
 
 set(FFTW_FOUND 0)
 if(FFTW_LIBRARY AND FFTW_INCLUDE_DIR)
@@ -35,6 +37,13 @@ find_library(FFTW_LIBRARY NAMES fftw3 fftw3-3 PATHS
   DOC "Specify the fttw3 library here."
 )
 
+get_filename_component(_fftw_library_dir "${FFTW_LIBRARY}" DIRECTORY)
+find_library(FFTW_THREADS_LIBRARY NAMES fftw3_threads fftw3-3_threads PATHS
+  ${_fftw_library_dir}
+  NO_DEFAULT_PATH
+  DOC "Specify the fttw3 threads library here."
+)
+
 if(FFTW_INCLUDE_DIR AND FFTW_LIBRARY)
   set(FFTW_FOUND 1 )
   if(NOT FFTW_FIND_QUIETLY)
@@ -44,5 +53,10 @@ if(FFTW_INCLUDE_DIR AND FFTW_LIBRARY)
 endif()
 
 set(FFTW_LIBRARIES ${FFTW_LIBRARY})
+set(FFTW_THREADS_FOUND FALSE)
+if(FFTW_THREADS_LIBRARY)
+  set(FFTW_LIBRARIES ${FFTW_THREADS_LIBRARY} ${FFTW_LIBRARY})
+  set(FFTW_THREADS_FOUND TRUE)
+endif()
 
-mark_as_advanced(FFTW_FOUND FFTW_LIBRARY FFTW_INCLUDE_DIR)
+mark_as_advanced(FFTW_FOUND FFTW_LIBRARY FFTW_THREADS_LIBRARY FFTW_INCLUDE_DIR)
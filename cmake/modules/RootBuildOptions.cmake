@@ -181,6 +181,7 @@ ROOT_BUILD_OPTION(xrootd ON "Enable support for XRootD file server and client")
 ROOT_BUILD_OPTION(xproofd OFF "Enable LEGACY support for XProofD file server and client (requires XRootD v4 with private-devel)")
 
 option(all "Enable all optional components by default" OFF)
+option(benchmarks "Build the microbenchmarks of the components (downloads Google Benchmark, implies testing)" OFF)
 option(clingtest "Enable cling tests (Note: that this makes llvm/clang symbols visible in libCling)" OFF)
 option(fail-on-missing "Fail at configure time if a required package cannot be found" OFF)
 option(gminimal "Enable only required options by default, but include X11" OFF)
@@ -361,7 +362,7 @@ set(webgui_defvalue ${root7_defvalue})
 ROOT_APPLY_OPTIONS()
 
 #---roottest option implies testing
-if(roottest OR rootbench)
+if(roottest OR rootbench OR benchmarks)
   set(testing ON CACHE BOOL "" FORCE)
 endif()
 
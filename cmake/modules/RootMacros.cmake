@@ -1689,6 +1689,32 @@ function(ROOT_ADD_GTEST test_suite)
 endfunction()
 
 
+#----------------------------------------------------------------------------
+# function ROOT_ADD_GBENCHMARK(<benchmark> source1 source2... LIBRARIES)
+#
+# Build a Google Benchmark executable, run by ctest with the label "benchmark"
+# (ctest -L benchmark). Each run writes its results in JSON format to
+# <builddir>/benchmarks/<benchmark>.json, to be compared between revisions.
+#
+function(ROOT_ADD_GBENCHMARK benchmark)
+  CMAKE_PARSE_ARGUMENTS(ARG "" "" "LIBRARIES" ${ARGN})
+
+  ROOT_GET_SOURCES(source_files . ${ARG_UNPARSED_ARGUMENTS})
+  ROOT_EXECUTABLE(${benchmark} ${source_files} LIBRARIES ${ARG_LIBRARIES})
+  target_link_libraries(${benchmark} gbenchmark gbenchmark_main)
+  target_include_directories(${benchmark} PRIVATE ${CMAKE_CURRENT_BINARY_DIR})
+
+  file(MAKE_DIRECTORY ${CMAKE_BINARY_DIR}/benchmarks)
+  ROOT_PATH_TO_STRING(mangled_name ${benchmark} PATH_SEPARATOR_REPLACEMENT "-")
+  ROOT_ADD_TEST(
+    gbench${mangled_name}
+    COMMAND ${benchmark} --benchmark_out=${CMAKE_BINARY_DIR}/benchmarks/${benchmark}.json --benchmark_out_format=json
+    WORKING_DIR ${CMAKE_CURRENT_BINARY_DIR}
+    LABELS benchmark
+    RUN_SERIAL
+  )
+endfunction()
+
 #----------------------------------------------------------------------------
 # ROOT_ADD_TEST_SUBDIRECTORY( <name> )
 #----------------------------------------------------------------------------
@@ -743,13 +743,14 @@ endif()
 if(builtin_fftw3)
   set(FFTW_VERSION 3.3.8)
   message(STATUS "Downloading and building FFTW version ${FFTW_VERSION}")
-  set(FFTW_LIBRARIES ${CMAKE_BINARY_DIR}/lib/libfftw3.a)
+  set(FFTW_LIBRARIES ${CMAKE_BINARY_DIR}/lib/libfftw3_threads.a ${CMAKE_BINARY_DIR}/lib/libfftw3.a)
+  set(FFTW_THREADS_FOUND TRUE)
   ExternalProject_Add(
     FFTW3
     URL ${lcgpackages}/fftw-${FFTW_VERSION}.tar.gz
     URL_HASH SHA256=6113262f6e92c5bd474f2875fa1b01054c4ad5040f6b0da7c03c98821d9ae303
     INSTALL_DIR ${CMAKE_BINARY_DIR}
-    CONFIGURE_COMMAND ./configure --prefix=<INSTALL_DIR>
+    CONFIGURE_COMMAND ./configure --prefix=<INSTALL_DIR> --enable-threads
     BUILD_COMMAND make CFLAGS=-fPIC
     LOG_DOWNLOAD 1 LOG_CONFIGURE 1 LOG_BUILD 1 LOG_INSTALL 1
     BUILD_IN_SOURCE 1
@@ -955,6 +956,15 @@ if(arrow)
       message(STATUS "For the time being switching OFF 'arrow' option")
       set(arrow OFF CACHE BOOL "Disabled because Apache Arrow API not found (${arrow_description})" FORCE)
     endif()
+  else()
+    # Parquet support (RParquetDS) is built if the Parquet library of the Arrow installation is available
+    find_library(PARQUET_SHARED_LIB NAMES parquet HINTS ${ARROW_LIB_DIR})
+    if(PARQUET_SHARED_LIB AND EXISTS ${ARROW_INCLUDE_DIR}/parquet/arrow/reader.h)
+      message(STATUS "Found Apache Parquet: ${PARQUET_SHARED_LIB}")
+    else()
+      message(STATUS "Apache Parquet not found in the Arrow installation, RParquetDS will not be built")
+      set(PARQUET_SHARED_LIB "")
+    endif()
   endif()
 
 endif()
@@ -1679,6 +1689,54 @@ if (testing)
 
 endif()
 
+#---Download googlebenchmark---------------------------------------------------------
+if (benchmarks)
+  set(_gbench_byproduct_binary_dir
+    ${CMAKE_CURRENT_BINARY_DIR}/googlebenchmark-prefix/src/googlebenchmark-build)
+  set(_gbench_byproducts
+    ${_gbench_byproduct_binary_dir}/src/${CMAKE_STATIC_LIBRARY_PREFIX}benchmark${CMAKE_STATIC_LIBRARY_SUFFIX}
+    ${_gbench_byproduct_binary_dir}/src/${CMAKE_STATIC_LIBRARY_PREFIX}benchmark_main${CMAKE_STATIC_LIBRARY_SUFFIX}
+    )
+
+  ExternalProject_Add(
+    googlebenchmark
+    GIT_REPOSITORY https://github.com/google/benchmark.git
+    GIT_SHALLOW 1
+    GIT_TAG v1.5.1
+    UPDATE_COMMAND ""
+    CMAKE_ARGS -G ${CMAKE_GENERATOR}
+                  -DCMAKE_BUILD_TYPE=Release
+                  -DCMAKE_C_COMPILER=${CMAKE_C_COMPILER}
+                  -DCMAKE_C_FLAGS=${CMAKE_C_FLAGS}
+                  -DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER}
+                  -DCMAKE_CXX_FLAGS=${ROOT_EXTERNAL_CXX_FLAGS}
+                  -DCMAKE_AR=${CMAKE_AR}
+                  -DBENCHMARK_ENABLE_TESTING=OFF
+                  -DBENCHMARK_ENABLE_GTEST_TESTS=OFF
+    # Disable install step
+    INSTALL_COMMAND ""
+    BUILD_BYPRODUCTS ${_gbench_byproducts}
+    # Wrap download, configure and build steps in a script to log output
+    LOG_DOWNLOAD ON
+    LOG_CONFIGURE ON
+    LOG_BUILD ON)
+
+  ExternalProject_Get_Property(googlebenchmark source_dir)
+  set(GBENCHMARK_INCLUDE_DIR ${source_dir}/include)
+  # Create the directory. Prevents bug https://gitlab.kitware.com/cmake/cmake/issues/15052
+  file(MAKE_DIRECTORY ${GBENCHMARK_INCLUDE_DIR})
+
+  # The targets are named gbenchmark to not clash with the ones of rootbench
+  foreach(lib benchmark benchmark_main)
+    add_library(g${lib} IMPORTED STATIC GLOBAL)
+    set_target_properties(g${lib} PROPERTIES
+      IMPORTED_LOCATION ${_gbench_byproduct_binary_dir}/src/${CMAKE_STATIC_LIBRARY_PREFIX}${lib}${CMAKE_STATIC_LIBRARY_SUFFIX})
+    add_dependencies(g${lib} googlebenchmark)
+  endforeach()
+  SET_PROPERTY(TARGET gbenchmark APPEND PROPERTY INTERFACE_INCLUDE_DIRECTORIES ${GBENCHMARK_INCLUDE_DIR})
+  SET_PROPERTY(TARGET gbenchmark APPEND PROPERTY INTERFACE_LINK_LIBRARIES Threads::Threads)
+endif()
+
 #------------------------------------------------------------------------------------
 if(webgui)
   ExternalProject_Add(
@@ -95,6 +95,7 @@
 #pragma link C++ class TMacro+;
 #pragma link C++ class TMD5+;
 #pragma link C++ class TMemberInspector;
+#pragma link C++ class TMemoryAccounting-;
 #pragma link C++ class TMessageHandler+;
 #pragma link C++ class TNamed+;
 #pragma link C++ class TNotifyLinkBase+;
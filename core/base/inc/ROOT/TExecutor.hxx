@@ -14,6 +14,9 @@
 
 #include "ROOT/TSeq.hxx"
 #include "TList.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <vector>
 
 //////////////////////////////////////////////////////////////////////////
@@ -189,6 +192,206 @@ T* TExecutor<subc>::Reduce(const std::vector<T*> &mergeObjs)
   return retHist;
 }
 
+namespace Internal {
+/// \brief The parallel algorithms of ROOT::TThreadExecutor and ROOT::TSequentialExecutor.
+///
+/// Each algorithm splits its input in contiguous chunks and processes them with a ChunkRunner_t, which calls a
+/// function for each chunk index, concurrently or not. The sequential executor runs a single chunk, so that both
+/// executors give the same results, as long as the operations passed to the reductions and scans are associative.
+namespace ExecutorAlgorithms {
+
+using ChunkRunner_t = std::function<void(unsigned nChunks, const std::function<void(unsigned chunk)> &func)>;
+
+/// Below this number of elements per chunk, sorts, scans and partitions are not worth splitting.
+constexpr std::size_t kMinChunkSize = 1024;
+
+/// The ChunkRunner_t of the sequential executors.
+inline void RunChunksSequentially(unsigned nChunks, const std::function<void(unsigned chunk)> &func)
+{
+   for (unsigned c = 0; c < nChunks; ++c)
+      func(c);
+}
+
+/// Returns the nChunks + 1 boundaries of nChunks contiguous ranges of almost equal size covering [0, n).
+inline std::vector<std::size_t> SplitRange(std::size_t n, std::size_t nChunks)
+{
+   std::vector<std::size_t> bounds(nChunks + 1);
+   for (std::size_t c = 0; c <= nChunks; ++c)
+      bounds[c] = n * c / nChunks;
+   return bounds;
+}
+
+/// Returns the number of chunks to split n elements in, at most maxChunks, with at least minChunkSize elements each.
+inline unsigned GetNChunks(std::size_t n, unsigned maxChunks, std::size_t minChunkSize)
+{
+   const std::size_t nChunks = std::min<std::size_t>(maxChunks, n / minChunkSize);
+   return static_cast<unsigned>(std::max<std::size_t>(nChunks, 1));
+}
+
+template <class F>
+void ForeachRange(const ChunkRunner_t &run, unsigned maxChunks, F &func, std::size_t begin, std::size_t end,
+                  std::size_t grainSize)
+{
+   if (end <= begin)
+      return;
+   const auto n = end - begin;
+   if (grainSize == 0)
+      grainSize = (n + maxChunks - 1) / maxChunks;
+   const auto nChunks = static_cast<unsigned>((n + grainSize - 1) / grainSize);
+   run(nChunks, [&](unsigned c) {
+      const auto first = begin + c * grainSize;
+      func(first, std::min(end, first + grainSize));
+   });
+}
+
+/// Sort each chunk, then merge the sorted chunks two by two: the merges keep the order of equal elements, so the
+/// sort is stable if the chunks are sorted with std::stable_sort.
+template <class ITER, class COMP>
+void Sort(const ChunkRunner_t &run, unsigned maxChunks, ITER first, ITER last, COMP comp, bool stable)
+{
+   const std::size_t n = std::distance(first, last);
+   const auto nChunks = GetNChunks(n, maxChunks, kMinChunkSize);
+   const auto bounds = SplitRange(n, nChunks);
+   run(nChunks, [&](unsigned c) {
+      if (stable)
+         std::stable_sort(first + bounds[c], first + bounds[c + 1], comp);
+      else
+         std::sort(first + bounds[c], first + bounds[c + 1], comp);
+   });
+   for (std::size_t width = 1; width < nChunks; width *= 2) {
+      const auto nMerges = static_cast<unsigned>((nChunks - width + 2 * width - 1) / (2 * width));
+      run(nMerges, [&](unsigned m) {
+         const std::size_t lo = 2 * width * m;
+         const std::size_t mid = std::min<std::size_t>(lo + width, nChunks);
+         const std::size_t hi = std::min<std::size_t>(lo + 2 * width, nChunks);
+         std::inplace_merge(first + bounds[lo], first + bounds[mid], first + bounds[hi], comp);
+      });
+   }
+}
+
+template <class ITER, class OUTITER, class BINARYOP>
+OUTITER InclusiveScan(const ChunkRunner_t &run, unsigned maxChunks, ITER first, ITER last, OUTITER out, BINARYOP op)
+{
+   using Value_t = typename std::iterator_traits<ITER>::value_type;
+   const std::size_t n = std::distance(first, last);
+   if (n == 0)
+      return out;
+   const auto nChunks = GetNChunks(n, maxChunks, kMinChunkSize);
+   const auto bounds = SplitRange(n, nChunks);
+   // the total of each chunk, then the total of all the chunks up to each one
+   std::vector<Value_t> totals;
+   if (nChunks > 1) {
+      totals.resize(nChunks);
+      run(nChunks, [&](unsigned c) {
+         Value_t acc = first[bounds[c]];
+         for (auto i = bounds[c] + 1; i < bounds[c + 1]; ++i)
+            acc = op(acc, first[i]);
+         totals[c] = acc;
+      });
+      for (unsigned c = 1; c < nChunks; ++c)
+         totals[c] = op(totals[c - 1], totals[c]);
+   }
+   run(nChunks, [&](unsigned c) {
+      Value_t acc = c == 0 ? Value_t(first[0]) : op(totals[c - 1], first[bounds[c]]);
+      out[bounds[c]] = acc;
+      for (auto i = bounds[c] + 1; i < bounds[c + 1]; ++i) {
+         acc = op(acc, first[i]);
+         out[i] = acc;
+      }
+   });
+   return out + n;
+}
+
+template <class ITER, class OUTITER, class T, class BINARYOP>
+OUTITER ExclusiveScan(const ChunkRunner_t &run, unsigned maxChunks, ITER first, ITER last, OUTITER out, T init,
+                      BINARYOP op)
+{
+   const std::size_t n = std::distance(first, last);
+   if (n == 0)
+      return out;
+   const auto nChunks = GetNChunks(n, maxChunks, kMinChunkSize);
+   const auto bounds = SplitRange(n, nChunks);
+   // the value that each chunk starts from: init combined with all the elements of the previous chunks
+   std::vector<T> starts(nChunks, init);
+   if (nChunks > 1) {
+      std::vector<T> totals(nChunks, init);
+      run(nChunks - 1, [&](unsigned c) {
+         T acc = first[bounds[c]];
+         for (auto i = bounds[c] + 1; i < bounds[c + 1]; ++i)
+            acc = op(acc, first[i]);
+         totals[c] = acc;
+      });
+      for (unsigned c = 1; c < nChunks; ++c)
+         starts[c] = op(starts[c - 1], totals[c - 1]);
+   }
+   run(nChunks, [&](unsigned c) {
+      T acc = starts[c];
+      for (auto i = bounds[c]; i < bounds[c + 1]; ++i) {
+         // the input element is read before it is overwritten, for in-place scans
+         T next = op(acc, first[i]);
+         out[i] = acc;
+         acc = std::move(next);
+      }
+   });
+   return out + n;
+}
+
+/// A stable partition: the elements for which pred is true come first, both groups keep their order.
+template <class ITER, class PRED>
+ITER Partition(const ChunkRunner_t &run, unsigned maxChunks, ITER first, ITER last, PRED pred)
+{
+   using Value_t = typename std::iterator_traits<ITER>::value_type;
+   const std::size_t n = std::distance(first, last);
+   const auto nChunks = GetNChunks(n, maxChunks, kMinChunkSize);
+   if (nChunks == 1)
+      return std::stable_partition(first, last, pred);
+
+   const auto bounds = SplitRange(n, nChunks);
+   std::vector<char> selected(n);
+   std::vector<std::size_t> nSelected(nChunks + 1, 0);
+   run(nChunks, [&](unsigned c) {
+      std::size_t count = 0;
+      for (auto i = bounds[c]; i < bounds[c + 1]; ++i) {
+         selected[i] = pred(first[i]) ? 1 : 0;
+         count += selected[i];
+      }
+      nSelected[c + 1] = count;
+   });
+   for (unsigned c = 1; c <= nChunks; ++c)
+      nSelected[c] += nSelected[c - 1];
+
+   std::vector<Value_t> moved(std::make_move_iterator(first), std::make_move_iterator(last));
+   const auto nTrue = nSelected[nChunks];
+   run(nChunks, [&](unsigned c) {
+      auto trueIdx = nSelected[c];
+      auto falseIdx = nTrue + bounds[c] - nSelected[c];
+      for (auto i = bounds[c]; i < bounds[c + 1]; ++i)
+         first[selected[i] ? trueIdx++ : falseIdx++] = std::move(moved[i]);
+   });
+   return first + nTrue;
+}
+
+template <class T, class BINARYOP>
+T Reduce(const ChunkRunner_t &run, unsigned maxChunks, const std::vector<T> &objs, const T &identity, BINARYOP op)
+{
+   // the operation can be expensive, e.g. a merge: one element per chunk is worth it
+   const auto nChunks = GetNChunks(objs.size(), maxChunks, 1);
+   const auto bounds = SplitRange(objs.size(), nChunks);
+   std::vector<T> partials(nChunks, identity);
+   run(nChunks, [&](unsigned c) {
+      for (auto i = bounds[c]; i < bounds[c + 1]; ++i)
+         partials[c] = op(partials[c], objs[i]);
+   });
+   // combined in order, for non-commutative operations
+   T result = identity;
+   for (auto &partial : partials)
+      result = op(result, partial);
+   return result;
+}
+
+} // namespace ExecutorAlgorithms
+} // namespace Internal
+
 } // end namespace ROOT
 
 #endif
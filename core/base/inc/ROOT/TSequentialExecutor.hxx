@@ -14,6 +14,8 @@
 #include "RConfigure.h"
 
 #include "ROOT/TExecutor.hxx"
+#include <functional>
+#include <iterator>
 #include <numeric>
 #include <vector>
 
@@ -57,6 +59,29 @@ namespace ROOT {
       
       using TExecutor<TSequentialExecutor>::Reduce;
       template<class T, class R> auto Reduce(const std::vector<T> &objs, R redfunc) -> decltype(redfunc(objs));
+      template<class T, class BINARYOP> T Reduce(const std::vector<T> &objs, const T &identity, BINARYOP redfunc);
+
+      // // Parallel algorithms, with the same semantics in ROOT::TThreadExecutor and ROOT::TSequentialExecutor
+      template<class F>
+      void ForeachRange(F func, std::size_t begin, std::size_t end, std::size_t grainSize = 0);
+      template<class ITER>
+      void Sort(ITER first, ITER last);
+      template<class ITER, class COMP>
+      void Sort(ITER first, ITER last, COMP comp);
+      template<class ITER>
+      void StableSort(ITER first, ITER last);
+      template<class ITER, class COMP>
+      void StableSort(ITER first, ITER last, COMP comp);
+      template<class ITER, class OUTITER>
+      OUTITER InclusiveScan(ITER first, ITER last, OUTITER out);
+      template<class ITER, class OUTITER, class BINARYOP>
+      OUTITER InclusiveScan(ITER first, ITER last, OUTITER out, BINARYOP op);
+      template<class ITER, class OUTITER, class T>
+      OUTITER ExclusiveScan(ITER first, ITER last, OUTITER out, T init);
+      template<class ITER, class OUTITER, class T, class BINARYOP>
+      OUTITER ExclusiveScan(ITER first, ITER last, OUTITER out, T init, BINARYOP op);
+      template<class ITER, class PRED>
+      ITER Partition(ITER first, ITER last, PRED pred);
    };
 
    /************ TEMPLATE METHODS IMPLEMENTATION ******************/
@@ -160,5 +185,102 @@ namespace ROOT {
       return redfunc(objs);
    }
 
+   //////////////////////////////////////////////////////////////////////////
+   /// "Reduce" an std::vector into a single object by applying the binary
+   /// operator redfunc, starting from identity.
+   template<class T, class BINARYOP>
+   T TSequentialExecutor::Reduce(const std::vector<T> &objs, const T &identity, BINARYOP redfunc)
+   {
+      return Internal::ExecutorAlgorithms::Reduce(Internal::ExecutorAlgorithms::RunChunksSequentially, 1, objs,
+                                                  identity, redfunc);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Execute func(first, last) on consecutive subranges of [begin, end) of
+   /// at most grainSize indices. With the default grainSize, 0, the range is
+   /// split in a single subrange.
+   template<class F>
+   void TSequentialExecutor::ForeachRange(F func, std::size_t begin, std::size_t end, std::size_t grainSize) {
+      Internal::ExecutorAlgorithms::ForeachRange(Internal::ExecutorAlgorithms::RunChunksSequentially, 1, func, begin, end, grainSize);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Sort the elements of [first, last), which must be random access iterators,
+   /// in ascending order. The order of equal elements is not preserved.
+   template<class ITER>
+   void TSequentialExecutor::Sort(ITER first, ITER last) {
+      Sort(first, last, std::less<typename std::iterator_traits<ITER>::value_type>());
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Sort the elements of [first, last), which must be random access iterators,
+   /// according to comp. The order of equal elements is not preserved.
+   template<class ITER, class COMP>
+   void TSequentialExecutor::Sort(ITER first, ITER last, COMP comp) {
+      Internal::ExecutorAlgorithms::Sort(Internal::ExecutorAlgorithms::RunChunksSequentially, 1, first, last, comp, false);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Sort the elements of [first, last), which must be random access iterators,
+   /// in ascending order, preserving the order of equal elements.
+   template<class ITER>
+   void TSequentialExecutor::StableSort(ITER first, ITER last) {
+      StableSort(first, last, std::less<typename std::iterator_traits<ITER>::value_type>());
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Sort the elements of [first, last), which must be random access iterators,
+   /// according to comp, preserving the order of equal elements.
+   template<class ITER, class COMP>
+   void TSequentialExecutor::StableSort(ITER first, ITER last, COMP comp) {
+      Internal::ExecutorAlgorithms::Sort(Internal::ExecutorAlgorithms::RunChunksSequentially, 1, first, last, comp, true);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Write to out the partial sums of [first, last), the i-th output including
+   /// the i-th input. The iterators must be random access iterators, out can be first.
+   /// Returns the end of the output.
+   template<class ITER, class OUTITER>
+   OUTITER TSequentialExecutor::InclusiveScan(ITER first, ITER last, OUTITER out) {
+      return InclusiveScan(first, last, out, std::plus<typename std::iterator_traits<ITER>::value_type>());
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Write to out the partial reductions with op, which must be associative,
+   /// of [first, last), the i-th output including the i-th input.
+   /// Returns the end of the output.
+   template<class ITER, class OUTITER, class BINARYOP>
+   OUTITER TSequentialExecutor::InclusiveScan(ITER first, ITER last, OUTITER out, BINARYOP op) {
+      return Internal::ExecutorAlgorithms::InclusiveScan(Internal::ExecutorAlgorithms::RunChunksSequentially, 1, first, last, out, op);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Write to out init plus the partial sums of [first, last), the i-th output
+   /// excluding the i-th input. The iterators must be random access iterators,
+   /// out can be first. Returns the end of the output.
+   template<class ITER, class OUTITER, class T>
+   OUTITER TSequentialExecutor::ExclusiveScan(ITER first, ITER last, OUTITER out, T init) {
+      return ExclusiveScan(first, last, out, init, std::plus<T>());
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Write to out the partial reductions with op, which must be associative,
+   /// of init and [first, last), the i-th output excluding the i-th input.
+   /// Returns the end of the output.
+   template<class ITER, class OUTITER, class T, class BINARYOP>
+   OUTITER TSequentialExecutor::ExclusiveScan(ITER first, ITER last, OUTITER out, T init, BINARYOP op) {
+      return Internal::ExecutorAlgorithms::ExclusiveScan(Internal::ExecutorAlgorithms::RunChunksSequentially, 1, first, last, out, init, op);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Reorder [first, last), which must be random access iterators, so that the
+   /// elements for which pred is true precede the others, preserving the relative
+   /// order in both groups, as std::stable_partition does.
+   /// Returns the iterator to the first element for which pred is false.
+   template<class ITER, class PRED>
+   ITER TSequentialExecutor::Partition(ITER first, ITER last, PRED pred) {
+      return Internal::ExecutorAlgorithms::Partition(Internal::ExecutorAlgorithms::RunChunksSequentially, 1, first, last, pred);
+   }
+
 } // namespace ROOT
 #endif
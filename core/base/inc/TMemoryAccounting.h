@@ -0,0 +1,91 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 2020, Rene Brun and Fons Rademakers.                    *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TMemoryAccounting
+#define ROOT_TMemoryAccounting
+
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TMemoryAccounting                                                    //
+//                                                                      //
+// Accounting of the memory held by the ROOT subsystems, by category,   //
+// and sampling of the allocation stacks of the custom new operator.    //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "TNamed.h"
+
+#include <atomic>
+#include <cstddef>
+
+class TMemoryAccounting : public TNamed {
+
+public:
+   enum ECategory {
+      kTree,                 // basket buffers of the TTrees
+      kFile,                 // TFile read and write caches, TBufferMerger queues
+      kNTuple,               // RNTuple pages
+      kDataFrame,            // RDataFrame results
+      kInterpreter,          // interpreter and TClass
+      kOther,                // anything else
+      kNCategories
+   };
+
+private:
+   Long64_t  fUsage[kNCategories];      // bytes in use in each category, at the last Update()
+   Long64_t  fPeak[kNCategories];       // peak bytes in use in each category, at the last Update()
+   Long64_t  fTotal;                    // bytes in use in all the categories, at the last Update()
+   Long64_t  fSamplingInterval;         // bytes allocated between two samples, 0 if sampling is off
+   Long64_t  fNSamples;                 // number of allocation samples, at the last Update()
+
+   static std::atomic<Long64_t> fgUsage[kNCategories];   // bytes in use in each category
+   static std::atomic<Long64_t> fgPeak[kNCategories];    // peak bytes in use in each category
+   static std::atomic<Long64_t> fgSamplingInterval;      // bytes allocated between two samples
+
+   static void RecordAllocation(size_t size);
+
+   TMemoryAccounting(const TMemoryAccounting &) = delete;
+   TMemoryAccounting &operator=(const TMemoryAccounting &) = delete;
+
+public:
+   TMemoryAccounting();
+   virtual ~TMemoryAccounting() { }
+
+   static TMemoryAccounting *Instance();
+
+   static void        Add(ECategory category, Long64_t nbytes);
+   static void        Remove(ECategory category, Long64_t nbytes) { Add(category, -nbytes); }
+   static Long64_t    GetUsage(ECategory category) { return fgUsage[category].load(std::memory_order_relaxed); }
+   static Long64_t    GetPeak(ECategory category) { return fgPeak[category].load(std::memory_order_relaxed); }
+   static Long64_t    GetTotalUsage();
+   static const char *GetCategoryName(ECategory category);
+   static void        ResetPeaks();
+
+   static void        EnableSampling(Long64_t interval = 1048576);
+   static void        DisableSampling() { EnableSampling(0); }
+   static Long64_t    GetSamplingInterval() { return fgSamplingInterval.load(std::memory_order_relaxed); }
+   static Long64_t    GetNSamples();
+   static void        PrintSamples(Int_t nstacks = 10);
+   static void        ResetSamples();
+
+   /// Sample the allocation of size bytes, called by the custom new operator.
+   static void        SampleAllocation(size_t size) { if (fgSamplingInterval.load(std::memory_order_relaxed)) RecordAllocation(size); }
+
+   Long64_t           GetLastUsage(ECategory category) const { return fUsage[category]; }
+   Long64_t           GetLastPeak(ECategory category) const { return fPeak[category]; }
+   Long64_t           GetLastTotal() const { return fTotal; }
+   void               Print(Option_t *option = "") const;
+   void               Update();
+
+   ClassDef(TMemoryAccounting,1)  //Memory held by the ROOT subsystems
+};
+
+#endif
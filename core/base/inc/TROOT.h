@@ -30,6 +30,7 @@
 #include "RConfigure.h"
 
 #include <atomic>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -57,6 +58,7 @@ class TListOfFunctions;
 class TListOfFunctionTemplates;
 class TFunctionTemplate;
 class TGlobalMappedFunction;
+class TMemoryAccounting;
 
 R__EXTERN TVirtualMutex *gROOTMutex;
 
@@ -75,6 +77,9 @@ namespace Internal {
       TParBranchProcessingRAII()  { EnableParBranchProcessing();  }
       ~TParBranchProcessingRAII() { DisableParBranchProcessing(); }
    };
+
+   // Run a loop on ROOT's thread pool, if implicit multi-threading is enabled
+   void ParallelFor(UInt_t n, const std::function<void(UInt_t)> &func);
 } } // End ROOT::Internal
 
 namespace ROOT {
@@ -266,6 +271,7 @@ public:
    TFunction        *GetGlobalFunction(const char *name, const char *params = 0, Bool_t load = kFALSE);
    TFunction        *GetGlobalFunctionWithPrototype(const char *name, const char *proto = 0, Bool_t load = kFALSE);
    TObject          *GetGeometry(const char *name) const;
+   TMemoryAccounting*GetMemoryAccounting() const;
    const TObject    *GetSelectedPrimitive() const { return fPrimitive; }
    TVirtualPad      *GetSelectedPad() const { return fSelectPad; }
    Int_t             GetNclasses() const { return fClasses->GetSize(); }
@@ -0,0 +1,73 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TStorageArena
+#define ROOT_TStorageArena
+
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TStorageArena                                                        //
+//                                                                      //
+// Bump allocator for the TObjects created with new, freed all at once. //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "RtypesCore.h"
+
+#include <cstddef>
+#include <vector>
+
+class TStorageArena {
+
+private:
+   size_t             fChunkSize;  // Size of the chunks of memory the objects are allocated in
+   std::vector<char*> fChunks;     // Chunks obtained so far, in use or kept for reuse after Reset()
+   size_t             fNUsedChunks;// Number of chunks holding allocated objects
+   char              *fCurrent;    // Next free byte of the last used chunk
+   char              *fEnd;        // End of the last used chunk
+   size_t             fUsed;       // Number of bytes allocated in the chunks
+
+   Bool_t NextChunk();
+
+   TStorageArena(const TStorageArena&) = delete;
+   TStorageArena &operator=(const TStorageArena&) = delete;
+
+public:
+   /// Makes the current thread create its TObjects in an arena, from
+   /// construction to destruction of the scope.
+   class TScope {
+   private:
+      TStorageArena *fPrevious; // Arena replaced by this scope
+
+      TScope(const TScope&) = delete;
+      TScope &operator=(const TScope&) = delete;
+
+   public:
+      explicit TScope(TStorageArena *arena);
+      explicit TScope(TStorageArena &arena) : TScope(&arena) {}
+      ~TScope();
+   };
+
+   explicit TStorageArena(size_t chunkSize = 1 << 20);
+   ~TStorageArena();
+
+   void          *Allocate(size_t size);
+   void          *Allocate(size_t size, size_t alignment);
+   size_t         GetCapacity() const { return fChunks.size() * fChunkSize; }
+   size_t         GetChunkSize() const { return fChunkSize; }
+   size_t         GetUsed() const { return fUsed; }
+   void           Reset();
+
+   static TStorageArena *GetCurrent();
+   static Bool_t  Owns(const void *ptr);
+};
+
+#endif
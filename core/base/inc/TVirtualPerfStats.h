@@ -82,6 +82,15 @@ public:
    virtual void SetUsed(size_t bi, size_t basketNumber) = 0;
    virtual void UpdateBranchIndices(TObjArray *branches) = 0;
 
+   // I/O steps, attributed to a branch or a file; no-ops unless overridden
+   virtual void BasketReadEvent(TBranch *branch, Int_t len, Double_t start);
+   virtual void BasketUnzipEvent(TBranch *branch, Int_t complen, Int_t objlen, Double_t start);
+   virtual void BranchReadEvent(TBranch *branch, Int_t nbytes, Double_t start);
+   virtual void CacheFillEvent(TFile *file, Int_t nblocks, Long64_t len, Double_t start);
+
+   static TVirtualPerfStats *GetGlobalPerfStats();  // Return the perfStats receiving the events of all threads.
+   static void SetGlobalPerfStats(TVirtualPerfStats *perfStats);
+
    static const char *EventType(EEventType type);
 
    ClassDef(TVirtualPerfStats,0)  // ABC for collecting PROOF statistics
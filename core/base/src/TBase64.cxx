@@ -22,6 +22,9 @@ protocols and to pack binary data in HTTP messages.
 
 #include <ROOT/RConfig.hxx>
 
+#include <cstring>
+#include <memory>
+
 ClassImp(TBase64);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -61,10 +64,10 @@ static void ToB64low(const char *in, char *out, int mod)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Base64 decoding of 4 bytes from in.
-/// Output (3 bytes) appended to out.
+/// Output (up to 3 bytes) written to out, returns number of decoded bytes.
 /// No check for base64-ness of input characters.
 
-static void FromB64low(const char *in, TString &out)
+static int FromB64low(const char *in, char *out)
 {
    static int b64inv[256] = {
       -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -89,16 +92,14 @@ static void FromB64low(const char *in, TString &out)
    const UInt_t i1 = (UInt_t)(in[1]);
    const UInt_t i2 = (UInt_t)(in[2]);
    const UInt_t i3 = (UInt_t)(in[3]);
-   if (R__likely(in[3] != '=')) {
-      out.Append((char)(0xFC & (b64inv[i0] << 2)) | (0x03 & (b64inv[i1] >> 4)));
-      out.Append((char)(0xF0 & (b64inv[i1] << 4)) | (0x0F & (b64inv[i2] >> 2)));
-      out.Append((char)(0xC0 & (b64inv[i2] << 6)) | (0x3F &  b64inv[i3]));
-   } else if (in[2] == '=') {
-      out.Append((char)(0xFC & (b64inv[i0] << 2)) | (0x03 & (b64inv[i1] >> 4)));
-   } else {
-      out.Append((char)(0xFC & (b64inv[i0] << 2)) | (0x03 & (b64inv[i1] >> 4)));
-      out.Append((char)(0xF0 & (b64inv[i1] << 4)) | (0x0F & (b64inv[i2] >> 2)));
-   }
+   out[0] = (char)((0xFC & (b64inv[i0] << 2)) | (0x03 & (b64inv[i1] >> 4)));
+   if (R__unlikely(in[2] == '='))
+      return 1;
+   out[1] = (char)((0xF0 & (b64inv[i1] << 4)) | (0x0F & (b64inv[i2] >> 2)));
+   if (R__unlikely(in[3] == '='))
+      return 2;
+   out[2] = (char)((0xC0 & (b64inv[i2] << 6)) | (0x3F & b64inv[i3]));
+   return 3;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -131,10 +132,30 @@ TString TBase64::Encode(const char *data, Int_t len)
 TString TBase64::Decode(const char *data)
 {
    int len = strlen(data);
-   TString ret(len);
+   std::unique_ptr<char[]> buf(new char[len / 4 * 3 + 3]);
 
-   for (int i = 0; i < len; i += 4)
-      FromB64low(data+i, ret);
+   return TString(buf.get(), Decode(data, len, buf.get(), len / 4 * 3 + 3));
+}
 
-   return ret;
+////////////////////////////////////////////////////////////////////////////////
+/// Decode len characters of base64 data directly into the out buffer of outlen bytes.
+/// Returns number of decoded bytes or -1 if out buffer is too small.
+/// No check for base64-ness of input characters.
+
+Int_t TBase64::Decode(const char *data, Int_t len, char *out, Int_t outlen)
+{
+   char oo[3];
+   Int_t res = 0;
+   for (Int_t i = 0; i + 3 < len; i += 4) {
+      if (R__likely(res + 3 <= outlen)) {
+         res += FromB64low(data + i, out + res);
+      } else {
+         int n = FromB64low(data + i, oo);
+         if (res + n > outlen)
+            return -1;
+         memcpy(out + res, oo, n);
+         res += n;
+      }
+   }
+   return res;
 }
@@ -0,0 +1,347 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 2020, Rene Brun and Fons Rademakers.                    *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TMemoryAccounting
+\ingroup Base
+
+Accounting of the memory held by the ROOT subsystems.
+
+The subsystems holding large buffers add the bytes they allocate to, and
+remove the bytes they free from, the counter of their category with Add()
+and Remove(), e.g. the basket buffers of the TTrees, the TFile caches, the
+TBufferMerger queues or the pages of the RNTuple page pools. The counters
+are atomic and can be updated from any thread. The current and peak usage of
+each category is returned by GetUsage() and GetPeak(), and printed with
+~~~{.cpp}
+   gROOT->GetMemoryAccounting()->Print();
+~~~
+TROOT::GetMemoryAccounting() returns the unique instance of this class,
+updated with the current usage. It is a TNamed which is updated each time it
+is streamed, so that it can be registered in a THttpServer, e.g.
+~~~{.cpp}
+   serv->Register("/Memory", gROOT->GetMemoryAccounting());
+~~~
+It is also shown in the "Memory" folder of the THttpServer scanning the
+global directory.
+
+When ROOT is used with its custom new and delete operators (libNew.so), the
+allocations can also be sampled: with EnableSampling(interval), or the
+resource Root.MemSampling, one allocation is sampled every interval bytes
+allocated by each thread and its stack is recorded. PrintSamples() prints the
+stacks with the most samples, i.e. the code allocating the most memory. The
+stacks are only recorded on the platforms with backtrace().
+*/
+
+#include "TMemoryAccounting.h"
+#include "TBuffer.h"
+#include "TError.h"
+#include "TString.h"
+#include "ThreadLocalStorage.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if (defined(R__LINUX) || defined(R__HURD)) && !defined(R__WINGCC)
+#   if __GLIBC__ == 2 && __GLIBC_MINOR__ >= 1
+#      define HAVE_BACKTRACE_SYMBOLS_FD
+#   endif
+#endif
+#if defined(R__MACOSX)
+#   define HAVE_BACKTRACE_SYMBOLS_FD
+#endif
+
+#ifdef HAVE_BACKTRACE_SYMBOLS_FD
+#   include <execinfo.h>
+#endif
+
+std::atomic<Long64_t> TMemoryAccounting::fgUsage[TMemoryAccounting::kNCategories];
+std::atomic<Long64_t> TMemoryAccounting::fgPeak[TMemoryAccounting::kNCategories];
+std::atomic<Long64_t> TMemoryAccounting::fgSamplingInterval{0};
+
+namespace {
+
+// The sampled stacks are kept in a static table, since nothing can be
+// allocated while sampling an allocation.
+const Int_t kMaxDepth = 32;     // maximum number of frames of a stack
+const Int_t kSkipFrames = 2;    // frames of RecordAllocation() and of the new operator
+const Int_t kMaxStacks = 1024;  // maximum number of different stacks
+
+struct AllocationStack {
+   ULong64_t fHash;             // hash of the frames
+   Int_t     fDepth;            // number of frames
+   Long64_t  fNSamples;         // number of samples of this stack, 0 if the slot is free
+   Long64_t  fBytes;            // bytes of the sampled allocations
+   void     *fFrames[kMaxDepth];
+};
+
+AllocationStack gStacks[kMaxStacks];
+std::atomic_flag gStacksLock = ATOMIC_FLAG_INIT;
+std::atomic<Long64_t> gNSamples{0};
+std::atomic<Long64_t> gNDropped{0};
+
+TTHREAD_TLS(Long64_t) gCountdown = 0;       // bytes to allocate before the next sample of the thread
+TTHREAD_TLS(Bool_t) gInSampling = kFALSE;   // the thread is sampling an allocation
+
+const char *gCategoryNames[TMemoryAccounting::kNCategories] = {"TTree", "TFile caches",
+                                                               "RNTuple", "RDataFrame",
+                                                               "Interpreter", "Other"};
+
+class TStacksLockGuard {
+public:
+   TStacksLockGuard() { while (gStacksLock.test_and_set(std::memory_order_acquire)) { } }
+   ~TStacksLockGuard() { gStacksLock.clear(std::memory_order_release); }
+};
+
+} // anonymous namespace
+
+ClassImp(TMemoryAccounting);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Default constructor, use Instance() to get the instance used by ROOT.
+
+TMemoryAccounting::TMemoryAccounting()
+   : TNamed("MemoryAccounting", "Memory held by the ROOT subsystems"), fTotal(0), fSamplingInterval(0), fNSamples(0)
+{
+   for (Int_t i = 0; i < kNCategories; i++) {
+      fUsage[i] = 0;
+      fPeak[i] = 0;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the instance used by ROOT, see also TROOT::GetMemoryAccounting().
+
+TMemoryAccounting *TMemoryAccounting::Instance()
+{
+   static TMemoryAccounting instance;
+   return &instance;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add nbytes to the usage of the category, nbytes being negative when
+/// memory is released.
+
+void TMemoryAccounting::Add(ECategory category, Long64_t nbytes)
+{
+   Long64_t usage = fgUsage[category].fetch_add(nbytes, std::memory_order_relaxed) + nbytes;
+   Long64_t peak = fgPeak[category].load(std::memory_order_relaxed);
+   while (usage > peak && !fgPeak[category].compare_exchange_weak(peak, usage, std::memory_order_relaxed)) { }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the bytes in use in all the categories.
+
+Long64_t TMemoryAccounting::GetTotalUsage()
+{
+   Long64_t total = 0;
+   for (Int_t i = 0; i < kNCategories; i++)
+      total += GetUsage((ECategory)i);
+   return total;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of the category.
+
+const char *TMemoryAccounting::GetCategoryName(ECategory category)
+{
+   if (category < 0 || category >= kNCategories)
+      return "Unknown";
+   return gCategoryNames[category];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the peak usage of each category to its current usage.
+
+void TMemoryAccounting::ResetPeaks()
+{
+   for (Int_t i = 0; i < kNCategories; i++)
+      fgPeak[i].store(fgUsage[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sample one allocation every interval bytes allocated by each thread with
+/// the custom new operator, 0 to stop the sampling. The sampling is only
+/// active when ROOT is used with libNew.so.
+
+void TMemoryAccounting::EnableSampling(Long64_t interval)
+{
+#ifndef HAVE_BACKTRACE_SYMBOLS_FD
+   if (interval > 0)
+      ::Warning("TMemoryAccounting::EnableSampling", "the allocation stacks are not recorded on this platform");
+#endif
+   fgSamplingInterval.store(interval > 0 ? interval : 0, std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Record the stack of the allocation of size bytes if it is sampled.
+
+void TMemoryAccounting::RecordAllocation(size_t size)
+{
+   if (gInSampling)
+      return;
+   gCountdown -= (Long64_t)size;
+   if (gCountdown > 0)
+      return;
+   const Long64_t interval = fgSamplingInterval.load(std::memory_order_relaxed);
+   if (interval <= 0)
+      return;
+   gCountdown = interval;
+   gInSampling = kTRUE;
+
+   gNSamples.fetch_add(1, std::memory_order_relaxed);
+
+#ifdef HAVE_BACKTRACE_SYMBOLS_FD
+   void *frames[kMaxDepth + kSkipFrames];
+   Int_t depth = backtrace(frames, kMaxDepth + kSkipFrames) - kSkipFrames;
+   if (depth < 0)
+      depth = 0;
+   ULong64_t hash = 14695981039346656037ull;
+   for (Int_t i = 0; i < depth; i++)
+      hash = (hash ^ (ULong64_t)frames[i + kSkipFrames]) * 1099511628211ull;
+
+   Bool_t recorded = kFALSE;
+   {
+      TStacksLockGuard lock;
+      for (Int_t n = 0, slot = hash % kMaxStacks; n < kMaxStacks; n++, slot = (slot + 1) % kMaxStacks) {
+         AllocationStack &stack = gStacks[slot];
+         if (stack.fNSamples == 0) {
+            stack.fHash = hash;
+            stack.fDepth = depth;
+            memcpy(stack.fFrames, frames + kSkipFrames, depth * sizeof(void *));
+         } else if (stack.fHash != hash || stack.fDepth != depth ||
+                    memcmp(stack.fFrames, frames + kSkipFrames, depth * sizeof(void *))) {
+            continue;
+         }
+         stack.fNSamples++;
+         stack.fBytes += size;
+         recorded = kTRUE;
+         break;
+      }
+   }
+   if (!recorded)
+      gNDropped.fetch_add(1, std::memory_order_relaxed);
+#endif
+
+   gInSampling = kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of sampled allocations.
+
+Long64_t TMemoryAccounting::GetNSamples()
+{
+   return gNSamples.load(std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the nstacks allocation stacks with the most samples.
+
+void TMemoryAccounting::PrintSamples(Int_t nstacks)
+{
+   const Long64_t nsamples = GetNSamples();
+   Printf("Allocation sampling every %lld bytes: %lld samples, %lld not recorded",
+          GetSamplingInterval(), nsamples, gNDropped.load(std::memory_order_relaxed));
+
+#ifdef HAVE_BACKTRACE_SYMBOLS_FD
+   // reserve first, nothing may be allocated while the table is locked
+   std::vector<AllocationStack> stacks;
+   stacks.reserve(kMaxStacks);
+   {
+      TStacksLockGuard lock;
+      for (Int_t i = 0; i < kMaxStacks; i++) {
+         if (gStacks[i].fNSamples > 0)
+            stacks.push_back(gStacks[i]);
+      }
+   }
+   std::sort(stacks.begin(), stacks.end(),
+             [](const AllocationStack &a, const AllocationStack &b) { return a.fNSamples > b.fNSamples; });
+
+   for (Int_t i = 0; i < nstacks && i < (Int_t)stacks.size(); i++) {
+      const AllocationStack &stack = stacks[i];
+      Printf("#%d: %lld samples (%.1f%%), %lld bytes sampled", i, stack.fNSamples,
+             nsamples ? 100. * stack.fNSamples / nsamples : 0., stack.fBytes);
+      char **symbols = backtrace_symbols(stack.fFrames, stack.fDepth);
+      for (Int_t j = 0; j < stack.fDepth; j++)
+         Printf("   %s", symbols ? symbols[j] : "?");
+      free(symbols);
+   }
+#else
+   (void)nstacks;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Forget the sampled allocations.
+
+void TMemoryAccounting::ResetSamples()
+{
+   TStacksLockGuard lock;
+   for (Int_t i = 0; i < kMaxStacks; i++)
+      gStacks[i].fNSamples = 0;
+   gNSamples.store(0, std::memory_order_relaxed);
+   gNDropped.store(0, std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the current and peak usage of each category. With option "stacks",
+/// print also the sampled allocation stacks.
+
+void TMemoryAccounting::Print(Option_t *option) const
+{
+   const Double_t mb = 1024. * 1024.;
+   Printf("Memory held by the ROOT subsystems:");
+   for (Int_t i = 0; i < kNCategories; i++) {
+      Printf("   %-14s %12.3f MB (peak %12.3f MB)", GetCategoryName((ECategory)i), GetUsage((ECategory)i) / mb,
+             GetPeak((ECategory)i) / mb);
+   }
+   Printf("   %-14s %12.3f MB", "Total", GetTotalUsage() / mb);
+
+   if (GetSamplingInterval() > 0 || GetNSamples() > 0) {
+      TString opt = option;
+      opt.ToLower();
+      if (opt.Contains("stacks"))
+         PrintSamples();
+      else
+         Printf("Allocation sampling every %lld bytes: %lld samples", GetSamplingInterval(), GetNSamples());
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the current usage into the data members, which is done each time the
+/// instance is streamed.
+
+void TMemoryAccounting::Update()
+{
+   fTotal = 0;
+   for (Int_t i = 0; i < kNCategories; i++) {
+      fUsage[i] = GetUsage((ECategory)i);
+      fPeak[i] = GetPeak((ECategory)i);
+      fTotal += fUsage[i];
+   }
+   fSamplingInterval = GetSamplingInterval();
+   fNSamples = GetNSamples();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stream an object of class TMemoryAccounting, updating the instance used
+/// by ROOT before it is written.
+
+void TMemoryAccounting::Streamer(TBuffer &R__b)
+{
+   if (R__b.IsReading()) {
+      R__b.ReadClassBuffer(TMemoryAccounting::Class(), this);
+   } else {
+      if (this == Instance())
+         Update();
+      R__b.WriteClassBuffer(TMemoryAccounting::Class(), this);
+   }
+}
@@ -152,9 +152,15 @@ TProcessID *TProcessID::AddProcessID()
 
 UInt_t TProcessID::AssignID(TObject *obj)
 {
+   UInt_t uid = obj->GetUniqueID() & 0xffffff;
+   if (obj->TestBit(kIsReferenced)) {
+      // Already registered: threads referencing the same objects only share the lock.
+      R__READ_LOCKGUARD(ROOT::gCoreMutex);
+      if (obj == fgPID->GetObjectWithID(uid)) return uid;
+   }
+
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
-   UInt_t uid = obj->GetUniqueID() & 0xffffff;
    if (obj == fgPID->GetObjectWithID(uid)) return uid;
    if (obj->TestBit(kIsReferenced)) {
       fgPID->PutObjectWithID(obj,uid);
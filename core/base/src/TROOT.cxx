@@ -45,6 +45,7 @@ The following lists are accessible from gROOT object:
 The TROOT class provides also many useful services:
   - Get pointer to an object in any of the lists above
   - Time utilities TROOT::Time
+  - Memory held by the ROOT subsystems TROOT::GetMemoryAccounting
 
 The ROOT object must be created as a static object. An example
 of a main program creating an interactive version is shown below:
@@ -137,6 +138,7 @@ FARPROC dlsym(void *library, const char *function_name)
 #include "TApplication.h"
 #include "TInterpreter.h"
 #include "TGuiFactory.h"
+#include "TMemoryAccounting.h"
 #include "TMessageHandler.h"
 #include "TFolder.h"
 #include "TQObject.h"
@@ -166,6 +168,7 @@ FARPROC dlsym(void *library, const char *function_name)
 #endif
 
 extern "C" void R__SetZipMode(int);
+extern "C" void R__SetZipAdaptive(double, double);
 
 static DestroyInterpreter_t *gDestroyInterpreter = 0;
 static void *gInterpreterLib = 0;
@@ -449,6 +452,27 @@ namespace Internal {
 #endif
    }
 
+   //////////////////////////////////////////////////////////////////////////////
+   /// Calls func(i) for each i in [0, n). The calls are concurrent, on the
+   /// threads of ROOT's pool, if implicit multi-threading is enabled, and
+   /// sequential otherwise. This lets the libraries that libImt depends on
+   /// use the pool, e.g. ROOT::TThreadedObject::Merge.
+   void ParallelFor(UInt_t n, const std::function<void(UInt_t)> &func)
+   {
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled()) {
+         using ParallelFor_t = void (*)(UInt_t, const std::function<void(UInt_t)> &);
+         static ParallelFor_t sym = (ParallelFor_t)Internal::GetSymInLibImt("ROOT_TImplicitMT_ParallelFor");
+         if (sym) {
+            sym(n, func);
+            return;
+         }
+      }
+#endif
+      for (UInt_t i = 0; i < n; ++i)
+         func(i);
+   }
+
    ////////////////////////////////////////////////////////////////////////////////
    /// Keeps track of the status of ImplicitMT w/o resorting to the load of
    /// libImt
@@ -1680,6 +1704,17 @@ TObject *TROOT::GetGeometry(const char *name) const
    return GetListOfGeometries()->FindObject(name);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the memory accounting of the ROOT subsystems, updated with the
+/// current usage of each category.
+
+TMemoryAccounting *TROOT::GetMemoryAccounting() const
+{
+   TMemoryAccounting *accounting = TMemoryAccounting::Instance();
+   accounting->Update();
+   return accounting;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 TCollection *TROOT::GetListOfEnums(Bool_t load /* = kTRUE */)
@@ -1942,6 +1977,10 @@ void TROOT::InitSystem()
       Int_t zipmode = gEnv->GetValue("Root.CompressionAlgorithm", oldzipmode);
       if (zipmode != 0) R__SetZipMode(zipmode);
 
+      Double_t minratio = gEnv->GetValue("Root.CompressionMinRatio", 0.);
+      Double_t lz4ratio = gEnv->GetValue("Root.CompressionLZ4Ratio", 0.);
+      if (minratio > 0 || lz4ratio > 0) R__SetZipAdaptive(minratio, lz4ratio);
+
       const char *sdeb;
       if ((sdeb = gSystem->Getenv("ROOTDEBUG")))
          gDebug = atoi(sdeb);
@@ -1956,6 +1995,9 @@ void TROOT::InitSystem()
       if (msize != -1 || mcnt != -1)
          TStorage::EnableStatistics(msize, mcnt);
 
+      if (Int_t interval = gEnv->GetValue("Root.MemSampling", 0))
+         TMemoryAccounting::EnableSampling(interval);
+
       fgMemCheck = gEnv->GetValue("Root.MemCheck", 0);
 
 #if defined(R__HAS_COCOA)
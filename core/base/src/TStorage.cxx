@@ -36,6 +36,7 @@ and statistics gathering in the system.
 #include "TObjectTable.h"
 #include "TError.h"
 #include "TString.h"
+#include "TStorageArena.h"
 #include "TVirtualMutex.h"
 #include "TInterpreter.h"
 
@@ -324,10 +325,14 @@ Int_t *TStorage::ReAllocInt(Int_t *ovp, size_t size, size_t oldsize)
 /// TStorage::FilledByObjectAlloc() to find out if the just created object is on
 /// the heap.  This technique is necessary as there is one stack per thread
 /// and we can not rely on comparison with the current stack memory position.
+/// The object is allocated in the TStorageArena of the current thread, if any.
 
 void *TStorage::ObjectAlloc(size_t sz)
 {
-   void* space =  ::operator new(sz);
+   TStorageArena *arena = TStorageArena::GetCurrent();
+   void* space = arena ? arena->Allocate(sz) : nullptr;
+   if (!space)
+      space = ::operator new(sz);
    memset(space, kObjectAllocMemValue, sz);
    return space;
 }
@@ -355,10 +360,12 @@ void *TStorage::ObjectAlloc(size_t , void *vp)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Used to deallocate a TObject on the heap (via TObject::operator delete()).
+/// The memory of the objects allocated in a TStorageArena is released with the arena.
 
 void TStorage::ObjectDealloc(void *vp)
 {
-
+   if (TStorageArena::Owns(vp))
+      return;
    ::operator delete(vp);
 }
 
@@ -377,6 +384,8 @@ void TStorage::ObjectDealloc(void *vp, void *ptr)
 
 void TStorage::ObjectDealloc(void *vp, size_t size)
 {
+   if (TStorageArena::Owns(vp))
+      return;
    ::operator delete(vp, size);
 }
 #endif
@@ -0,0 +1,312 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TStorageArena
+\ingroup Base
+
+Bump allocator for the TObjects created with new, whose memory is released
+all at once.
+
+While a TStorageArena::TScope exists, the TObjects created with new by its
+thread (TStorage::ObjectAlloc()) are allocated sequentially in the chunks of
+its arena instead of with one malloc each. Deleting them runs their
+destructor as usual but does not free their memory: Reset() makes all the
+memory of the arena available again, and the destructor of the arena
+releases it. This pays off when many small objects are created and deleted
+together, e.g. the clones of a TClonesArray read for each entry of a TTree,
+see TClonesArray::SetArena():
+~~~{.cpp}
+TStorageArena arena;
+TClonesArray *tracks = new TClonesArray("Track");
+tracks->SetArena(&arena);
+tree->SetBranchAddress("tracks", &tracks);
+for (Long64_t entry = 0; entry < tree->GetEntries(); ++entry)
+   tree->GetEntry(entry);
+delete tracks;
+arena.Reset();
+~~~
+
+The objects of an arena must be deleted before it is Reset() or destroyed.
+A TScope must thus only enclose the allocation of such objects: all the
+TObjects created with new by its thread go into the arena, including the
+ones created on the way by ROOT itself (TBasket, TStreamerInfo, ...), which
+outlive the arena. Only the TObjects are allocated in the arena; arrays of
+TObjects, objects larger than a quarter of the chunk size, and the memory
+allocated by the objects themselves (e.g. the characters of their long
+TStrings) are not. An arena must not be used by several threads at the same
+time.
+
+Deleting a TObject checks without any lock whether it belongs to an arena:
+the chunks are aligned on pages, which are flagged in a bitmap of the pages
+of the address space.
+*/
+
+#include "TStorageArena.h"
+#include "ThreadLocalStorage.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+#ifdef R__WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+
+constexpr size_t kAlignment = alignof(std::max_align_t);
+
+/// Number of pages of the chunks of all the arenas, to skip the lookup if none.
+std::atomic<size_t> gNChunkPages{0};
+
+/// The pages of the chunks of all the arenas, to find out without lock
+/// whether a pointer belongs to one. The address space is split in regions of
+/// 4 GB, each with a bitmap of its 4 kB pages created when a chunk is first
+/// allocated in the region. The bitmaps are never deleted, so that they can be
+/// read while another thread adds or removes a chunk.
+class TChunkPages {
+public:
+   static constexpr int kPageBits = 12;
+   static constexpr size_t kPageSize = size_t(1) << kPageBits;
+
+private:
+   static constexpr int kRegionBits = 32;
+   static constexpr size_t kNRegions = size_t(1) << 16;  ///< Covers 48 bit addresses
+   static constexpr size_t kNWords = (size_t(1) << (kRegionBits - kPageBits)) / 64;
+
+   struct TRegion {
+      std::atomic<ULong64_t> fWords[kNWords];
+      TRegion() { for (auto &word : fWords) word.store(0, std::memory_order_relaxed); }
+   };
+
+   std::mutex fMutex;                         ///< Serializes the changes
+   std::atomic<TRegion *> fRegions[kNRegions];
+
+   static ULong64_t Address(const void *ptr) { return (ULong64_t)reinterpret_cast<uintptr_t>(ptr); }
+
+   /// Flag (or unflag) the pages of [begin, begin + size), which must be in a single region.
+   void Set(const char *begin, size_t size, bool on)
+   {
+      TRegion *region = fRegions[Address(begin) >> kRegionBits].load(std::memory_order_relaxed);
+      const size_t first = (Address(begin) & ((ULong64_t(1) << kRegionBits) - 1)) >> kPageBits;
+      for (size_t page = first; page < first + (size >> kPageBits); ++page) {
+         if (on)
+            region->fWords[page / 64].fetch_or(ULong64_t(1) << (page % 64), std::memory_order_release);
+         else
+            region->fWords[page / 64].fetch_and(~(ULong64_t(1) << (page % 64)), std::memory_order_release);
+      }
+      if (on)
+         gNChunkPages += size >> kPageBits;
+      else
+         gNChunkPages -= size >> kPageBits;
+   }
+
+public:
+   TChunkPages() { for (auto &region : fRegions) region.store(nullptr, std::memory_order_relaxed); }
+
+   /// Flag the pages of a chunk, page aligned and of a multiple of kPageSize
+   /// bytes. Return false if the chunk cannot be flagged, i.e. cannot be used.
+   bool Add(const char *chunk, size_t size)
+   {
+      const ULong64_t first = Address(chunk) >> kRegionBits;
+      const ULong64_t last = (Address(chunk) + size - 1) >> kRegionBits;
+      if (last >= kNRegions || first != last)
+         return false;
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (!fRegions[first].load(std::memory_order_relaxed))
+         fRegions[first].store(new TRegion, std::memory_order_release);
+      Set(chunk, size, true);
+      return true;
+   }
+
+   /// Unflag the pages of a chunk flagged by Add().
+   void Remove(const char *chunk, size_t size)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      Set(chunk, size, false);
+   }
+
+   /// Return true if ptr is in the pages of a chunk.
+   bool Contains(const void *ptr) const
+   {
+      const ULong64_t address = Address(ptr);
+      if ((address >> kRegionBits) >= kNRegions)
+         return false;
+      const TRegion *region = fRegions[address >> kRegionBits].load(std::memory_order_acquire);
+      if (!region)
+         return false;
+      const size_t page = (address & ((ULong64_t(1) << kRegionBits) - 1)) >> kPageBits;
+      return (region->fWords[page / 64].load(std::memory_order_acquire) >> (page % 64)) & 1;
+   }
+};
+
+TChunkPages &GetChunkPages()
+{
+   // Never deleted, as arenas could be destroyed during the static destruction.
+   static TChunkPages *pages = new TChunkPages;
+   return *pages;
+}
+
+/// Allocate a page aligned chunk.
+char *AllocateChunk(size_t size)
+{
+#ifdef R__WIN32
+   return static_cast<char *>(_aligned_malloc(size, TChunkPages::kPageSize));
+#else
+   void *chunk = nullptr;
+   if (posix_memalign(&chunk, TChunkPages::kPageSize, size))
+      return nullptr;
+   return static_cast<char *>(chunk);
+#endif
+}
+
+/// Free a chunk allocated by AllocateChunk().
+void FreeChunk(char *chunk)
+{
+#ifdef R__WIN32
+   _aligned_free(chunk);
+#else
+   free(chunk);
+#endif
+}
+
+/// The arena in which the current thread allocates its TObjects, see TStorageArena::TScope.
+TStorageArena *&GetCurrentArenaRef()
+{
+   TTHREAD_TLS(TStorageArena *) current(nullptr);
+   return *TTHREAD_TLS_PTR(current);
+}
+
+} // unnamed namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make the TObjects created with new by the current thread go into arena, if
+/// not null, until the destruction of the scope.
+
+TStorageArena::TScope::TScope(TStorageArena *arena) : fPrevious(GetCurrentArenaRef())
+{
+   if (arena)
+      GetCurrentArenaRef() = arena;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Restore the arena in use before the scope.
+
+TStorageArena::TScope::~TScope()
+{
+   GetCurrentArenaRef() = fPrevious;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create an arena allocating chunks of chunkSize bytes, rounded up to a
+/// multiple of 4 kB.
+
+TStorageArena::TStorageArena(size_t chunkSize)
+   : fChunkSize((chunkSize + TChunkPages::kPageSize - 1) & ~(TChunkPages::kPageSize - 1)), fNUsedChunks(0),
+     fCurrent(nullptr), fEnd(nullptr), fUsed(0)
+{
+   if (fChunkSize == 0)
+      fChunkSize = TChunkPages::kPageSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the memory of the arena. All its objects must have been deleted.
+
+TStorageArena::~TStorageArena()
+{
+   auto &pages = GetChunkPages();
+   for (auto chunk : fChunks) {
+      pages.Remove(chunk, fChunkSize);
+      FreeChunk(chunk);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Continue the allocations in the next chunk, reused or newly registered.
+/// Return false if no chunk could be registered.
+
+Bool_t TStorageArena::NextChunk()
+{
+   if (fNUsedChunks == fChunks.size()) {
+      char *chunk = AllocateChunk(fChunkSize);
+      if (!chunk)
+         throw std::bad_alloc();
+      if (!GetChunkPages().Add(chunk, fChunkSize)) {
+         FreeChunk(chunk);
+         return kFALSE;
+      }
+      fChunks.push_back(chunk);
+   }
+   fCurrent = fChunks[fNUsedChunks++];
+   fEnd = fCurrent + fChunkSize;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return size bytes of the arena, suitably aligned for any object, or nullptr
+/// if the object is too large for the arena and must be allocated on the heap.
+
+void *TStorageArena::Allocate(size_t size)
+{
+   return Allocate((size + kAlignment - 1) & ~(kAlignment - 1), kAlignment);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return size bytes of the arena aligned on alignment, a power of two not
+/// larger than alignof(std::max_align_t), or nullptr if the object is too
+/// large for the arena. Consecutive allocations of a size multiple of
+/// alignment are contiguous unless a new chunk is started, which makes the
+/// arena usable for arrays of objects allocated one by one.
+
+void *TStorageArena::Allocate(size_t size, size_t alignment)
+{
+   if (size > fChunkSize / 4 || alignment > kAlignment)
+      return nullptr;
+   char *space = fCurrent ? fCurrent + (-reinterpret_cast<uintptr_t>(fCurrent) & (alignment - 1)) : nullptr;
+   if (!space || space > fEnd || size > size_t(fEnd - space)) {
+      if (!NextChunk())
+         return nullptr;
+      space = fCurrent;
+   }
+   fUsed += size + (space - fCurrent);
+   fCurrent = space + size;
+   return space;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make all the memory of the arena available for new objects again. All the
+/// objects allocated so far must have been deleted. The chunks are kept.
+
+void TStorageArena::Reset()
+{
+   fNUsedChunks = 0;
+   fCurrent = fEnd = nullptr;
+   fUsed = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the arena in which the current thread allocates its TObjects, or nullptr.
+
+TStorageArena *TStorageArena::GetCurrent()
+{
+   return GetCurrentArenaRef();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if ptr was allocated in an arena, i.e. must not be freed.
+
+Bool_t TStorageArena::Owns(const void *ptr)
+{
+   if (!ptr || gNChunkPages.load(std::memory_order_relaxed) == 0)
+      return kFALSE;
+   return GetChunkPages().Contains(ptr);
+}
@@ -20,6 +20,8 @@ and event tracing.
 #include "TVirtualPerfStats.h"
 #include "TThreadSlots.h"
 
+#include <atomic>
+
 
 ClassImp(TVirtualPerfStats);
 
@@ -48,6 +50,65 @@ TVirtualPerfStats *&TVirtualPerfStats::CurrentPerfStats()
    }
 }
 
+namespace {
+std::atomic<TVirtualPerfStats *> gGlobalPerfStats{nullptr};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the perf stats receiving the I/O events of all threads, if any.
+///
+/// Unlike gPerfStats, which is per thread, it also sees the reads done by the
+/// tasks of the implicit multi-threading, TTreeProcessorMT or RDataFrame.
+
+TVirtualPerfStats *TVirtualPerfStats::GetGlobalPerfStats()
+{
+   return gGlobalPerfStats.load(std::memory_order_acquire);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the perf stats receiving the I/O events of all threads; nullptr stops
+/// the monitoring. The perf stats must accept events from several threads
+/// concurrently.
+
+void TVirtualPerfStats::SetGlobalPerfStats(TVirtualPerfStats *perfStats)
+{
+   gGlobalPerfStats.store(perfStats, std::memory_order_release);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// A basket of branch was read, from the file or from the cache, starting at
+/// time start; len is the number of bytes read.
+
+void TVirtualPerfStats::BasketReadEvent(TBranch * /* branch */, Int_t /* len */, Double_t /* start */)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// A basket of branch was uncompressed from complen to objlen bytes, starting
+/// at time start.
+
+void TVirtualPerfStats::BasketUnzipEvent(TBranch * /* branch */, Int_t /* complen */, Int_t /* objlen */,
+                                         Double_t /* start */)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// An entry of branch was deserialized from nbytes bytes of its basket,
+/// starting at time start.
+
+void TVirtualPerfStats::BranchReadEvent(TBranch * /* branch */, Int_t /* nbytes */, Double_t /* start */)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The read cache of file was filled with nblocks blocks of len bytes in
+/// total, starting at time start.
+
+void TVirtualPerfStats::CacheFillEvent(TFile * /* file */, Int_t /* nblocks */, Long64_t /* len */,
+                                       Double_t /* start */)
+{
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the name of the event type.
 
@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+
+#include "TBufferJSON.h"
+#include "TMemoryAccounting.h"
+#include "TROOT.h"
+
+#include <thread>
+#include <vector>
+
+TEST(TMemoryAccounting, AddRemove)
+{
+   const auto category = TMemoryAccounting::kOther;
+   const Long64_t before = TMemoryAccounting::GetUsage(category);
+   TMemoryAccounting::ResetPeaks();
+
+   TMemoryAccounting::Add(category, 1000);
+   TMemoryAccounting::Add(category, 500);
+   EXPECT_EQ(TMemoryAccounting::GetUsage(category), before + 1500);
+   TMemoryAccounting::Remove(category, 1200);
+   EXPECT_EQ(TMemoryAccounting::GetUsage(category), before + 300);
+   EXPECT_EQ(TMemoryAccounting::GetPeak(category), before + 1500);
+
+   TMemoryAccounting::ResetPeaks();
+   EXPECT_EQ(TMemoryAccounting::GetPeak(category), before + 300);
+   TMemoryAccounting::Remove(category, 300);
+   EXPECT_EQ(TMemoryAccounting::GetUsage(category), before);
+
+   EXPECT_STREQ(TMemoryAccounting::GetCategoryName(TMemoryAccounting::kTree), "TTree");
+   EXPECT_STREQ(TMemoryAccounting::GetCategoryName(TMemoryAccounting::kNCategories), "Unknown");
+}
+
+TEST(TMemoryAccounting, Threads)
+{
+   const auto category = TMemoryAccounting::kDataFrame;
+   const Long64_t before = TMemoryAccounting::GetUsage(category);
+
+   std::vector<std::thread> threads;
+   for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([category] {
+         for (int i = 0; i < 10000; ++i) {
+            TMemoryAccounting::Add(category, 16);
+            TMemoryAccounting::Remove(category, 8);
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+
+   EXPECT_EQ(TMemoryAccounting::GetUsage(category), before + 4 * 10000 * 8);
+   EXPECT_GE(TMemoryAccounting::GetPeak(category), TMemoryAccounting::GetUsage(category));
+   TMemoryAccounting::Remove(category, 4 * 10000 * 8);
+}
+
+TEST(TMemoryAccounting, Snapshot)
+{
+   const auto category = TMemoryAccounting::kInterpreter;
+   TMemoryAccounting::Add(category, 4096);
+
+   TMemoryAccounting *accounting = gROOT->GetMemoryAccounting();
+   ASSERT_EQ(accounting, TMemoryAccounting::Instance());
+   EXPECT_EQ(accounting->GetLastUsage(category), TMemoryAccounting::GetUsage(category));
+   EXPECT_EQ(accounting->GetLastTotal(), TMemoryAccounting::GetTotalUsage());
+
+   // the instance is updated when it is streamed, e.g. by THttpServer
+   TMemoryAccounting::Add(category, 4096);
+   EXPECT_NE(accounting->GetLastUsage(category), TMemoryAccounting::GetUsage(category));
+   TString json = TBufferJSON::ToJSON(accounting);
+   EXPECT_TRUE(json.Contains("fUsage"));
+   EXPECT_EQ(accounting->GetLastUsage(category), TMemoryAccounting::GetUsage(category));
+
+   TMemoryAccounting::Remove(category, 2 * 4096);
+}
+
+TEST(TMemoryAccounting, Sampling)
+{
+   TMemoryAccounting::ResetSamples();
+   TMemoryAccounting::EnableSampling(1024);
+   EXPECT_EQ(TMemoryAccounting::GetSamplingInterval(), 1024);
+   for (int i = 0; i < 100; ++i)
+      TMemoryAccounting::SampleAllocation(512);
+   TMemoryAccounting::DisableSampling();
+   EXPECT_EQ(TMemoryAccounting::GetSamplingInterval(), 0);
+   // one sample every two allocations of 512 bytes, the first allocation of the thread being sampled
+   EXPECT_EQ(TMemoryAccounting::GetNSamples(), 50);
+
+   TMemoryAccounting::SampleAllocation(1 << 20);
+   EXPECT_EQ(TMemoryAccounting::GetNSamples(), 50);
+   TMemoryAccounting::ResetSamples();
+   EXPECT_EQ(TMemoryAccounting::GetNSamples(), 0);
+}
@@ -0,0 +1,101 @@
+#include "gtest/gtest.h"
+
+#include "TClonesArray.h"
+#include "TNamed.h"
+#include "TStorageArena.h"
+
+#include <vector>
+
+TEST(TStorageArena, ObjectsInScope)
+{
+   TStorageArena arena(4096);
+   TNamed *outside = new TNamed("outside", "");
+   std::vector<TNamed *> inside;
+   {
+      TStorageArena::TScope scope(arena);
+      EXPECT_EQ(TStorageArena::GetCurrent(), &arena);
+      for (int i = 0; i < 100; ++i)
+         inside.push_back(new TNamed("inside", ""));
+   }
+   EXPECT_EQ(TStorageArena::GetCurrent(), nullptr);
+   EXPECT_FALSE(TStorageArena::Owns(outside));
+   for (auto obj : inside) {
+      EXPECT_TRUE(TStorageArena::Owns(obj));
+      EXPECT_STREQ(obj->GetName(), "inside");
+   }
+   EXPECT_GE(arena.GetUsed(), 100 * sizeof(TNamed));
+   EXPECT_GE(arena.GetCapacity(), arena.GetUsed());
+
+   for (auto obj : inside)
+      delete obj;
+   delete outside;
+
+   const auto capacity = arena.GetCapacity();
+   arena.Reset();
+   EXPECT_EQ(arena.GetUsed(), 0u);
+   {
+      TStorageArena::TScope scope(arena);
+      for (int i = 0; i < 100; ++i)
+         delete new TNamed("again", "");
+   }
+   // the chunks are reused after Reset()
+   EXPECT_EQ(arena.GetCapacity(), capacity);
+}
+
+TEST(TStorageArena, NestedScopes)
+{
+   TStorageArena outer, inner;
+   TStorageArena::TScope outerScope(outer);
+   {
+      TStorageArena::TScope innerScope(inner);
+      EXPECT_EQ(TStorageArena::GetCurrent(), &inner);
+      TStorageArena::TScope nullScope(nullptr);
+      EXPECT_EQ(TStorageArena::GetCurrent(), &inner);
+   }
+   EXPECT_EQ(TStorageArena::GetCurrent(), &outer);
+}
+
+TEST(TStorageArena, LargeObjects)
+{
+   TStorageArena arena(4096);
+   EXPECT_EQ(arena.Allocate(4096), nullptr);
+   void *small = arena.Allocate(24);
+   ASSERT_NE(small, nullptr);
+   EXPECT_EQ(reinterpret_cast<std::size_t>(small) % alignof(std::max_align_t), 0u);
+   EXPECT_TRUE(TStorageArena::Owns(small));
+}
+
+TEST(TStorageArena, Stride)
+{
+   TStorageArena arena(4096);
+   char *previous = static_cast<char *>(arena.Allocate(24, 8));
+   for (int i = 0; i < 100; ++i) {
+      char *next = static_cast<char *>(arena.Allocate(24, 8));
+      if (next != previous + 24) {
+         // only when a new chunk is started
+         EXPECT_EQ(i, 4096 / 24 - 1);
+         EXPECT_EQ(reinterpret_cast<std::size_t>(next) % alignof(std::max_align_t), 0u);
+      }
+      previous = next;
+   }
+   EXPECT_EQ(arena.Allocate(24, 2 * alignof(std::max_align_t)), nullptr);
+}
+
+TEST(TStorageArena, ClonesArray)
+{
+   TStorageArena arena;
+   {
+      TClonesArray clones("TNamed", 10);
+      clones.SetArena(&arena);
+      EXPECT_EQ(clones.GetArena(), &arena);
+      for (int i = 0; i < 50; ++i)
+         new (clones[i]) TNamed("clone", "");
+      for (int i = 0; i < 50; ++i)
+         EXPECT_TRUE(TStorageArena::Owns(clones[i]));
+      clones.Clear();
+      for (int i = 0; i < 50; ++i)
+         static_cast<TNamed *>(clones.ConstructedAt(i))->SetName("reused");
+      EXPECT_STREQ(clones[49]->GetName(), "reused");
+   }
+   arena.Reset();
+}
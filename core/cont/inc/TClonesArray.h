@@ -27,6 +27,7 @@
 #include "TObjArray.h"
 
 class TClass;
+class TStorageArena;
 
 
 class TClonesArray : public TObjArray {
@@ -34,6 +35,12 @@ class TClonesArray : public TObjArray {
 protected:
    TClass       *fClass;       //!Pointer to the class of the elements
    TObjArray    *fKeep;        //!Saved copies of pointers to objects
+   TStorageArena *fArena;      //!Arena in which the clones are created, if any
+   TStorageArena *fBlocks;     //!Blocks owned by the array holding its contiguous clones, if any
+
+private:
+   void            *AllocateClone();
+   TObject         *NewClone();
 
 public:
    enum EStatusBits {
@@ -53,6 +60,7 @@ public:
    virtual void     Expand(Int_t newSize);
    virtual void     ExpandCreate(Int_t n);
    virtual void     ExpandCreateFast(Int_t n);
+   TStorageArena   *GetArena() const { return fArena; }
    TClass          *GetClass() const { return fClass; }
    virtual void     SetOwner(Bool_t enable = kTRUE);
 
@@ -65,8 +73,11 @@ public:
    void             AddBefore(const TObject *, TObject *) { MayNotUse("AddBefore"); }
    void             BypassStreamer(Bool_t bypass=kTRUE);
    Bool_t           CanBypassStreamer() const { return TestBit(kBypassStreamer); }
+   Bool_t           IsContiguous() const { return fBlocks != 0; }
    TObject         *ConstructedAt(Int_t idx);
    TObject         *ConstructedAt(Int_t idx, Option_t *clear_options);
+   void             SetArena(TStorageArena *arena);
+   void             SetContiguous(Int_t capacity = 0);
    void             SetClass(const char *classname,Int_t size=1000);
    void             SetClass(const TClass *cl,Int_t size=1000);
 
@@ -20,7 +20,8 @@
 // THashTable implements a hash table to store TObject's. The hash      //
 // value is calculated using the value returned by the TObject's        //
 // Hash() function. Each class inheriting from TObject can override     //
-// Hash() as it sees fit.                                               //
+// Hash() as it sees fit. The objects are stored in a flat array of     //
+// slots (open addressing with linear probing).                         //
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
@@ -37,17 +38,31 @@ class THashTable : public TCollection {
 friend class  THashTableIter;
 
 private:
-   TList     **fCont;          //Hash table (table of lists)
+   // A slot of the table holds an object and its hash value. It is empty
+   // if fObject and fHash are 0, and was freed by a removal if only fObject
+   // is 0: the lookups then continue probing past it.
+   struct TSlot {
+      ULong_t  fHash;          //Hash() of the object
+      TObject *fObject;        //Object stored in the slot
+   };
+   struct TListCache;          //Lists returned by GetListForObject(), see THashTable.cxx
+
+   TSlot      *fCont;          //Hash table (array of fSize slots, allocated by the first Add)
    Int_t       fEntries;       //Number of objects in table
-   Int_t       fUsedSlots;     //Number of used slots
+   Int_t       fRemovedSlots;  //Number of slots freed by a removal, still probed
    Int_t       fRehashLevel;   //Average collision rate which triggers rehash
+   ULong64_t   fProbes;        //Sum over the objects of the number of slots probed to find them
+   mutable TListCache *fListCache; //Lists returned by GetListForObject(), if any
 
-   Int_t       GetCheckedHashValue(TObject *obj) const;
-   Int_t       GetHashValue(const TObject *obj) const;
-   Int_t       GetHashValue(TString &s) const { return s.Hash() % fSize; }
-   Int_t       GetHashValue(const char *str) const { return ::Hash(str) % fSize; }
+   Int_t       GetHashValue(ULong_t hash) const { return Int_t(hash & (fSize - 1)); }
+   Int_t       NextProbe(Int_t slot) const { return (slot + 1) & (fSize - 1); }
+   static Bool_t IsEmpty(const TSlot &slot) { return !slot.fObject && !slot.fHash; }
 
-   void        AddImpl(Int_t slot, TObject *object);
+   void        AddImpl(ULong_t hash, TObject *object);
+   const TList *GetListForHash(ULong_t hash) const;
+   void        MoveObjectsTo(TList *objects);
+   void        RehashIfNeeded();
+   TObject    *RemoveSlot(Int_t slot);
 
    THashTable(const THashTable&);             // not implemented
    THashTable& operator=(const THashTable&);  // not implemented
@@ -83,24 +98,12 @@ public:
 
 inline Float_t THashTable::AverageCollisions() const
 {
-   if (fUsedSlots)
-      return ((Float_t)fEntries)/((Float_t)fUsedSlots);
+   if (fEntries)
+      return ((Float_t)fProbes)/((Float_t)fEntries);
    else
       return 0.0;
 }
 
-inline Int_t THashTable::GetCheckedHashValue(TObject *obj) const
-{
-   Int_t i = Int_t(obj->CheckedHash() % fSize); // need intermediary i for Linux g++
-   return i;
-}
-
-inline Int_t THashTable::GetHashValue(const TObject *obj) const
-{
-   Int_t i = Int_t(obj->Hash() % fSize);  // need intermediary i for Linux g++
-   return i;
-}
-
 
 //////////////////////////////////////////////////////////////////////////
 //                                                                      //
@@ -114,11 +117,11 @@ class THashTableIter : public TIterator {
 
 private:
    const THashTable *fTable;       //hash table being iterated
-   Int_t             fCursor;      //current position in table
-   TListIter        *fListCursor;  //current position in collision list
+   Int_t             fCursor;      //next slot to look at
+   Int_t             fCurrent;     //slot of the current object, -1 if none
    Bool_t            fDirection;   //iteration direction
 
-   THashTableIter() : fTable(0), fCursor(0), fListCursor(0), fDirection(kIterForward) { }
+   THashTableIter() : fTable(0), fCursor(0), fCurrent(-1), fDirection(kIterForward) { }
    Int_t             NextSlot();
 
 public:
@@ -26,6 +26,7 @@
 #include "TProcessID.h"
 
 #include <iterator>
+#include <vector>
 
 #if (__GNUC__ >= 3) && !defined(__INTEL_COMPILER)
 // Prevent -Weffc++ from complaining about the inheritance
@@ -72,6 +73,7 @@ public:
    }
    Int_t            GetLast() const;
    TObject        **GetObjectRef(const TObject *obj) const;
+   Int_t            GetObjects(std::vector<TObject *> &objects) const;
    TProcessID      *GetPID() const {return fPID;}
    UInt_t           GetUID(Int_t at) const;
    Bool_t           IsEmpty() const { return GetAbsLast() == -1; }
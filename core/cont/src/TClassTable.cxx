@@ -634,7 +634,12 @@ TProtoClass *TClassTable::GetProto(const char *cname)
    }
 
    TClassRec *r = FindElement(cname);
-   if (r) return r->fProto;
+   if (r && r->fProto) return r->fProto;
+   // The rootpcm holding the proto might not have been read yet.
+   if (gCling && gCling->LoadDeferredPCM(r ? r->fName : cname)) {
+      r = FindElement(cname);
+      if (r) return r->fProto;
+   }
    return 0;
 }
 
@@ -655,7 +660,12 @@ TProtoClass *TClassTable::GetProtoNorm(const char *cname)
    }
 
    TClassRec *r = FindElementImpl(cname,kFALSE);
-   if (r) return r->fProto;
+   if (r && r->fProto) return r->fProto;
+   // The rootpcm holding the proto might not have been read yet.
+   if (gCling && gCling->LoadDeferredPCM(cname)) {
+      r = FindElementImpl(cname,kFALSE);
+      if (r) return r->fProto;
+   }
    return 0;
 }
 
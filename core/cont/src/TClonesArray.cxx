@@ -131,7 +131,9 @@ When investigating misuse of TClonesArray, please make sure of the following:
 #include "TClass.h"
 #include "TObject.h"
 #include "TObjectTable.h"
+#include "TStorageArena.h"
 
+#include <cstddef>
 #include <stdlib.h>
 
 ClassImp(TClonesArray);
@@ -152,12 +154,22 @@ bool R__SetClonesArrayTFormulaUpdater(Updater_t func) {
    return true;
 }
 
+/// Internal Utility routine returning the alignment of the clones of a contiguous
+/// TClonesArray: the largest power of two dividing their size, so that
+/// consecutive clones are exactly size bytes apart.
+static inline size_t R__CloneAlignment(size_t size)
+{
+   size_t alignment = size & (~size + 1);
+   return alignment < alignof(std::max_align_t) ? alignment : alignof(std::max_align_t);
+}
+
 /// Internal Utility routine to correctly release the memory for an object
 static inline void R__ReleaseMemory(TClass *cl, TObject *obj)
 {
    if (obj && obj->TestBit(TObject::kNotDeleted)) {
       // -- The TObject destructor has not been called.
-      cl->Destructor(obj);
+      // The memory of the objects in an arena is not freed one by one.
+      cl->Destructor(obj, TStorageArena::Owns(obj));
    } else {
       // -- The TObject destructor was called, just free memory.
       //
@@ -165,7 +177,7 @@ static inline void R__ReleaseMemory(TClass *cl, TObject *obj)
       if (TObject::GetObjectStat() && gObjectTable) {
          gObjectTable->RemoveQuietly(obj);
       }
-      ::operator delete(obj);
+      TStorage::ObjectDealloc(obj);
    }
 }
 
@@ -177,6 +189,8 @@ TClonesArray::TClonesArray() : TObjArray()
 {
    fClass      = 0;
    fKeep       = 0;
+   fArena      = nullptr;
+   fBlocks     = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -192,6 +206,8 @@ TClonesArray::TClonesArray() : TObjArray()
 TClonesArray::TClonesArray(const char *classname, Int_t s, Bool_t) : TObjArray(s)
 {
    fKeep = 0;
+   fArena = nullptr;
+   fBlocks = nullptr;
    SetClass(classname,s);
 }
 
@@ -208,6 +224,8 @@ TClonesArray::TClonesArray(const char *classname, Int_t s, Bool_t) : TObjArray(s
 TClonesArray::TClonesArray(const TClass *cl, Int_t s, Bool_t) : TObjArray(s)
 {
    fKeep = 0;
+   fArena = nullptr;
+   fBlocks = nullptr;
    SetClass(cl,s);
 }
 
@@ -218,6 +236,8 @@ TClonesArray::TClonesArray(const TClonesArray& tc): TObjArray(tc)
 {
    fKeep = new TObjArray(tc.fSize);
    fClass = tc.fClass;
+   fArena = nullptr;
+   fBlocks = nullptr;
 
    BypassStreamer(kTRUE);
 
@@ -275,6 +295,7 @@ TClonesArray::~TClonesArray()
       }
    }
    SafeDelete(fKeep);
+   SafeDelete(fBlocks);
 
    // Protect against erroneously setting of owner bit
    SetOwner(kFALSE);
@@ -461,6 +482,83 @@ void TClonesArray::Delete(Option_t *)
    TObjArray::Clear();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Create the clones allocated from now on (by ExpandCreate(), ConstructedAt(),
+/// operator[] or when reading the array) in arena instead of one by one on
+/// the heap, or again on the heap if arena is nullptr. The clones already
+/// allocated are kept where they are.
+///
+/// The memory of the clones is then only released by arena->Reset() or the
+/// destruction of arena, which must thus happen after the destruction of the
+/// TClonesArray: the array keeps its clones for reuse until then.
+
+void TClonesArray::SetArena(TStorageArena *arena)
+{
+   fArena = arena;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the clones allocated from now on contiguously, one after the other
+/// at a distance of fClass->Size() bytes, in blocks of capacity clones (by
+/// default the current size of the array) owned by the TClonesArray. The
+/// clones already allocated are kept where they are.
+///
+/// The clones created by ExpandCreate() and ExpandCreateFast(), and thus the
+/// ones read from a split branch, are then constructed in place in the
+/// blocks, and their destructors do not free any memory. Iterating over them
+/// touches contiguous memory, like an array of structs. This is meant for the
+/// event models which cannot be migrated away from TClonesArray.
+///
+/// The memory of the clones is released with the TClonesArray: they cannot
+/// be given to another array with AbsorbObjects().
+
+void TClonesArray::SetContiguous(Int_t capacity)
+{
+   if (!fClass) {
+      Error("SetContiguous", "invalid class specified in TClonesArray ctor");
+      return;
+   }
+   if (fBlocks) {
+      Error("SetContiguous", "the clones of %s are already contiguous", GetName());
+      return;
+   }
+   if (capacity <= 0)
+      capacity = fSize;
+   // Objects larger than a quarter of a chunk would not be allocated in the arena.
+   fBlocks = new TStorageArena(size_t(TMath::Max(capacity, 4)) * fClass->Size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the memory for a new clone: in the blocks of the array if it is
+/// contiguous, else in its arena if any, else on the heap.
+
+void *TClonesArray::AllocateClone()
+{
+   if (fBlocks) {
+      size_t size = fClass->Size();
+      if (void *space = fBlocks->Allocate(size, R__CloneAlignment(size)))
+         return space;
+   }
+   // Only the clone itself goes into the arena, not the objects it creates.
+   TStorageArena::TScope scope(fArena);
+   return TStorage::ObjectAlloc(fClass->Size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a new default constructed clone, allocated as by AllocateClone().
+
+TObject *TClonesArray::NewClone()
+{
+   if (fBlocks) {
+      size_t size = fClass->Size();
+      if (void *space = fBlocks->Allocate(size, R__CloneAlignment(size)))
+         return (TObject*)fClass->New(space);
+   }
+   if (fArena)
+      return (TObject*)fClass->New(AllocateClone());
+   return (TObject*)fClass->New();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Expand or shrink the array to newSize elements.
 
@@ -514,7 +612,7 @@ void TClonesArray::ExpandCreate(Int_t n)
    Int_t i;
    for (i = 0; i < n; i++) {
       if (!fKeep->fCont[i]) {
-         fKeep->fCont[i] = (TObject*)fClass->New();
+         fKeep->fCont[i] = NewClone();
       } else if (!fKeep->fCont[i]->TestBit(kNotDeleted)) {
          // The object has been deleted (or never initialized)
          fClass->New(fKeep->fCont[i]);
@@ -551,7 +649,7 @@ void TClonesArray::ExpandCreateFast(Int_t n)
    Int_t i;
    for (i = 0; i < n; i++) {
       if (i >= oldSize || !fKeep->fCont[i]) {
-         fKeep->fCont[i] = (TObject*)fClass->New();
+         fKeep->fCont[i] = NewClone();
       } else if (!fKeep->fCont[i]->TestBit(kNotDeleted)) {
          // The object has been deleted (or never initialized)
          fClass->New(fKeep->fCont[i]);
@@ -799,7 +897,7 @@ void TClonesArray::Streamer(TBuffer &b)
       if (CanBypassStreamer() && !b.TestBit(TBuffer::kCannotHandleMemberWiseStreaming)) {
          for (Int_t i = 0; i < nobjects; i++) {
             if (!fKeep->fCont[i]) {
-               fKeep->fCont[i] = (TObject*)fClass->New();
+               fKeep->fCont[i] = NewClone();
             } else if (!fKeep->fCont[i]->TestBit(kNotDeleted)) {
                // The object has been deleted (or never initialized)
                fClass->New(fKeep->fCont[i]);
@@ -834,7 +932,7 @@ void TClonesArray::Streamer(TBuffer &b)
             b >> nch;
             if (nch) {
                if (!fKeep->fCont[i])
-                  fKeep->fCont[i] = (TObject*)fClass->New();
+                  fKeep->fCont[i] = NewClone();
                else if (!fKeep->fCont[i]->TestBit(kNotDeleted)) {
                   // The object has been deleted (or never initialized)
                   fClass->New(fKeep->fCont[i]);
@@ -918,7 +1016,7 @@ TObject *&TClonesArray::operator[](Int_t idx)
       Expand(TMath::Max(idx+1, GrowBy(fSize)));
 
    if (!fKeep->fCont[idx]) {
-      fKeep->fCont[idx] = (TObject*) TStorage::ObjectAlloc(fClass->Size());
+      fKeep->fCont[idx] = (TObject*) AllocateClone();
       // Reset the bit so that:
       //    obj = myClonesArray[i];
       //    obj->TestBit(TObject::kNotDeleted)
@@ -997,6 +1095,10 @@ void TClonesArray::AbsorbObjects(TClonesArray *tc, Int_t idx1, Int_t idx2)
       Error("AbsorbObjects", "cannot absorb objects when classes are different");
       return;
    }
+   if (tc->IsContiguous()) {
+      Error("AbsorbObjects", "cannot absorb the objects of a contiguous TClonesArray");
+      return;
+   }
 
    if (idx1 > idx2) {
       Error("AbsorbObjects", "range is not valid: idx1>idx2");
@@ -29,12 +29,10 @@ ClassImp(THashList);
 ////////////////////////////////////////////////////////////////////////////////
 /// Create a THashList object. Capacity is the initial hashtable capacity
 /// (i.e. number of slots), by default kInitHashTableCapacity = 17, and
-/// rehash is the value at which a rehash will be triggered. I.e. when the
-/// average size of the linked lists at a slot becomes longer than rehash
-/// then the hashtable will be resized and refilled to reduce the collision
-/// rate to about 1. The higher the collision rate, i.e. the longer the
-/// linked lists, the longer lookup will take. If rehash=0 the table will
-/// NOT automatically be rehashed. Use Rehash() for manual rehashing.
+/// rehash is the average number of slots probed per lookup above which the
+/// hashtable is resized and refilled, in addition to the automatic growth
+/// of the table when it is half full; see THashTable::THashTable().
+/// Use Rehash() for manual rehashing.
 ///
 /// WARNING !!!
 /// If the name of an object in the HashList is modified, The hashlist
@@ -277,8 +275,8 @@ TObject *THashList::FindObject(const TObject *obj) const
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Return the THashTable's list (bucket) in which obj can be found based on
-/// its hash; see THashTable::GetListForObject().
+/// Return the list of the objects having the same hash value as name;
+/// see THashTable::GetListForObject().
 
 const TList *THashList::GetListForObject(const char *name) const
 {
@@ -288,8 +286,8 @@ const TList *THashList::GetListForObject(const char *name) const
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Return the THashTable's list (bucket) in which obj can be found based on
-/// its hash; see THashTable::GetListForObject().
+/// Return the list of the objects having the same hash value as obj;
+/// see THashTable::GetListForObject().
 
 const TList *THashList::GetListForObject(const TObject *obj) const
 {
@@ -358,12 +356,10 @@ void THashList::RecursiveRemove(TObject *obj)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Rehash the hashlist. If the collision rate becomes too high (i.e.
-/// the average size of the linked lists become too long) then lookup
-/// efficiency decreases since relatively long lists have to be searched
-/// every time. To improve performance rehash the hashtable. This resizes
-/// the table to newCapacity slots and refills the table. Use
-/// AverageCollisions() to check if you need to rehash.
+/// Rehash the hashlist. This resizes the hashtable to newCapacity slots
+/// and refills it; see THashTable::Rehash(). The table grows automatically
+/// when it is half full, use AverageCollisions() to check if you need to
+/// rehash for other reasons.
 
 void THashList::Rehash(Int_t newCapacity)
 {
@@ -16,9 +16,18 @@ value is calculated using the value returned by the TObject's
 Hash() function. Each class inheriting from TObject can override
 Hash() as it sees fit.
 
+The objects and their hash values are stored in a single array of
+slots (open addressing): an object is put in the first free slot
+following the one given by its hash value (linear probing), and a
+lookup compares the stored hash values before looking at the objects
+themselves. The table is resized whenever it becomes half full, which
+keeps the sequences of slots to probe short.
+
 THashTable does not preserve the insertion order of the objects.
 If the insertion order is important AND fast retrieval is needed
-use THashList instead.
+use THashList instead. The objects with the same hash value are
+however found in the order in which they were added, except for
+AddBefore().
 */
 
 #include "THashTable.h"
@@ -27,18 +36,52 @@ use THashList instead.
 #include "TError.h"
 #include "TROOT.h"
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 ClassImp(THashTable);
 
+/// The lists returned by GetListForObject(), by hash value. They are created
+/// when first requested and then kept up to date by the table, so that the
+/// callers can hold on to them as they could to the buckets of the former
+/// implementation.
+struct THashTable::TListCache {
+   std::unordered_map<ULong_t, std::unique_ptr<TList>> fLists;
+};
+
+namespace {
+
+/// Protects the creation of the lists of all the TListCache: unlike other
+/// modifications, GetListForObject() can be called concurrently by readers.
+std::mutex &GetListCacheMutex()
+{
+   static std::mutex mutex;
+   return mutex;
+}
+
+/// Smallest power of two greater or equal to n.
+Int_t NextPowerOfTwo(Int_t n)
+{
+   Int_t size = 1;
+   while (size < n)
+      size <<= 1;
+   return size;
+}
+
+/// Value of TSlot::fHash marking a slot freed by a removal.
+constexpr ULong_t kRemovedSlot = 1;
+
+} // unnamed namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create a THashTable object. Capacity is the initial hashtable capacity
-/// (i.e. number of slots), by default kInitHashTableCapacity = 17, and
-/// rehashlevel is the value at which a rehash will be triggered. I.e. when
-/// the average size of the linked lists at a slot becomes longer than
-/// rehashlevel then the hashtable will be resized and refilled to reduce
-/// the collision rate to about 1. The higher the collision rate, i.e. the
-/// longer the linked lists, the longer lookup will take. If rehashlevel=0
-/// the table will NOT automatically be rehashed. Use Rehash() for manual
-/// rehashing.
+/// (i.e. number of slots), by default kInitHashTableCapacity = 17 rounded up
+/// to the next power of two. The table grows automatically whenever it
+/// becomes half full. In addition, if rehashlevel is not 0, the table is
+/// resized when the average number of slots probed to find an object becomes
+/// larger than rehashlevel (see AverageCollisions()): this only happens with
+/// poor hash functions. Use Rehash() for manual rehashing.
 
 THashTable::THashTable(Int_t capacity, Int_t rehashlevel)
 {
@@ -48,12 +91,13 @@ THashTable::THashTable(Int_t capacity, Int_t rehashlevel)
    } else if (capacity == 0)
       capacity = TCollection::kInitHashTableCapacity;
 
-   fSize = (Int_t)TMath::NextPrime(TMath::Max(capacity,(int)TCollection::kInitHashTableCapacity));
-   fCont = new TList* [fSize];
-   memset(fCont, 0, fSize*sizeof(TList*));
+   fSize = NextPowerOfTwo(TMath::Max(capacity,(int)TCollection::kInitHashTableCapacity));
+   fCont = nullptr;
 
-   fEntries   = 0;
-   fUsedSlots = 0;
+   fEntries      = 0;
+   fRemovedSlots = 0;
+   fProbes       = 0;
+   fListCache    = nullptr;
    if (rehashlevel < 2) rehashlevel = 0;
    fRehashLevel = rehashlevel;
 }
@@ -68,21 +112,51 @@ THashTable::~THashTable()
    delete [] fCont;
    fCont = 0;
    fSize = 0;
+   delete fListCache;
+   fListCache = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Helper function doing the actual add to the table give a slot and object.
-/// This does not take any lock.
+/// Helper function doing the actual add to the table given the hash value of
+/// the object. The object goes after all the ones with the same hash value.
+/// This does not take any lock and does not rehash.
 
 inline
-void THashTable::AddImpl(Int_t slot, TObject *obj)
+void THashTable::AddImpl(ULong_t hash, TObject *obj)
 {
-   if (!fCont[slot]) {
-      fCont[slot] = new TList;
-      ++fUsedSlots;
+   if (!fCont) {
+      fCont = new TSlot[fSize];
+      memset(fCont, 0, fSize*sizeof(TSlot));
    }
-   fCont[slot]->Add(obj);
+
+   const Int_t home = GetHashValue(hash);
+   Int_t slot = home;
+   while (!IsEmpty(fCont[slot]))
+      slot = NextProbe(slot);
+   fCont[slot].fHash   = hash;
+   fCont[slot].fObject = obj;
    ++fEntries;
+   fProbes += ((slot - home) & (fSize - 1)) + 1;
+
+   if (fListCache) {
+      std::lock_guard<std::mutex> lock(GetListCacheMutex());
+      auto list = fListCache->fLists.find(hash);
+      if (list != fListCache->fLists.end())
+         list->second->Add(obj);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Grow the table when it is half full (counting the slots freed by removals,
+/// which are still probed), or when the collision rate is above the rehash
+/// level. This does not take any lock.
+
+void THashTable::RehashIfNeeded()
+{
+   if (2 * (fEntries + fRemovedSlots) > fSize)
+      Rehash(2 * fEntries);
+   else if (fRehashLevel && AverageCollisions() > fRehashLevel)
+      Rehash(2 * fSize);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -93,42 +167,71 @@ void THashTable::Add(TObject *obj)
 {
    if (IsArgNull("Add", obj)) return;
 
-   Int_t slot = GetCheckedHashValue(obj);
+   ULong_t hash = obj->CheckedHash();
 
    R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
-   AddImpl(slot,obj);
-
-   if (fRehashLevel && AverageCollisions() > fRehashLevel)
-      Rehash(fEntries);
+   AddImpl(hash,obj);
+   RehashIfNeeded();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Add object to the hash table. Its position in the table will be
 /// determined by the value returned by its Hash() function.
-/// If and only if 'before' is in the same bucket as obj, obj is added
-/// in front of 'before' within the bucket's list.
+/// If and only if 'before' is in the sequence of slots probed for obj
+/// (in particular when they have the same hash value), obj is added in
+/// front of 'before', i.e. found before it by FindObject().
 
 void THashTable::AddBefore(const TObject *before, TObject *obj)
 {
    if (IsArgNull("Add", obj)) return;
 
-   Int_t slot = GetCheckedHashValue(obj);
+   ULong_t hash = obj->CheckedHash();
 
    R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
-   if (!fCont[slot]) {
-      fCont[slot] = new TList;
-      fUsedSlots++;
+
+   const Int_t home = GetHashValue(hash);
+   Int_t slot = home;
+   if (before && fCont) {
+      while (!IsEmpty(fCont[slot]) && fCont[slot].fObject != before)
+         slot = NextProbe(slot);
    }
-   if (before && GetHashValue(before) == slot) {
-      fCont[slot]->AddBefore(before,obj);
-   } else {
-      fCont[slot]->Add(obj);
+   if (!before || !fCont || IsEmpty(fCont[slot])) {
+      AddImpl(hash,obj);
+      RehashIfNeeded();
+      return;
    }
-   fEntries++;
 
-   if (fRehashLevel && AverageCollisions() > fRehashLevel)
-      Rehash(fEntries);
+   // Shift to the next slot everything from 'before' to the end of the
+   // sequence of used slots, which keeps all of them on the path probed
+   // for their hash value, and put obj in the place of 'before'.
+   const Int_t mask = fSize - 1;
+   Int_t end = slot;
+   while (!IsEmpty(fCont[end]))
+      end = NextProbe(end);
+   for (Int_t i = end; i != slot; i = (i + mask) & mask) {
+      fCont[i] = fCont[(i + mask) & mask];
+      if (fCont[i].fObject)
+         ++fProbes;
+   }
+   fCont[slot].fHash   = hash;
+   fCont[slot].fObject = obj;
+   ++fEntries;
+   fProbes += ((slot - home) & mask) + 1;
+
+   if (fListCache) {
+      // Refill the list in place, in the new probing order.
+      std::lock_guard<std::mutex> lock(GetListCacheMutex());
+      auto list = fListCache->fLists.find(hash);
+      if (list != fListCache->fLists.end()) {
+         list->second->Clear("nodelete");
+         for (Int_t i = home; !IsEmpty(fCont[i]); i = NextProbe(i))
+            if (fCont[i].fObject && fCont[i].fHash == hash)
+               list->second->Add(fCont[i].fObject);
+      }
+   }
+
+   RehashIfNeeded();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -139,25 +242,38 @@ void THashTable::AddAll(const TCollection *col)
 {
    R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
-   // Hashing after AddAll can be much more expensive than
-   // hashing before, as we need to add more elements.
-   // We assume an ideal hash, i.e. fUsedSlots==fSize.
+   // Grow the table once for all the new elements instead of
+   // several times while adding them.
    Int_t sumEntries=fEntries+col->GetEntries();
-   Bool_t rehashBefore=fRehashLevel && (sumEntries > fSize*fRehashLevel);
-   if (rehashBefore)
-      Rehash(sumEntries);
-
-   // prevent Add from Rehashing
-   Int_t saveRehashLevel=fRehashLevel;
-   fRehashLevel=0;
+   if (2 * (sumEntries + fRemovedSlots) > fSize)
+      Rehash(2 * sumEntries);
 
    TCollection::AddAll(col);
+}
 
-   fRehashLevel=saveRehashLevel;
-   // If we didn't Rehash before, we might have to do it
-   // now, due to a non-perfect hash function.
-   if (!rehashBefore && fRehashLevel && AverageCollisions() > fRehashLevel)
-      Rehash(fEntries);
+////////////////////////////////////////////////////////////////////////////////
+/// Move all the objects of the table to objects (if not null), in the order
+/// of the slots, and empty the table. This does not take any lock.
+
+void THashTable::MoveObjectsTo(TList *objects)
+{
+   if (fCont && objects) {
+      for (Int_t i = 0; i < fSize; i++)
+         if (fCont[i].fObject)
+            objects->Add(fCont[i].fObject);
+   }
+
+   delete [] fCont;
+   fCont = nullptr;
+   fEntries      = 0;
+   fRemovedSlots = 0;
+   fProbes       = 0;
+
+   if (fListCache) {
+      std::lock_guard<std::mutex> lock(GetListCacheMutex());
+      delete fListCache;
+      fListCache = nullptr;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -168,50 +284,67 @@ void THashTable::Clear(Option_t *option)
 {
    R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
-   for (int i = 0; i < fSize; i++) {
-      // option "nodelete" is passed when Clear is called from
-      // THashList::Clear() or THashList::Delete() or Rehash().
-      if (fCont[i]) {
-         if (IsOwner())
-            fCont[i]->SetOwner();
-         fCont[i]->Clear(option);
-      }
-      SafeDelete(fCont[i]);
+   // option "nodelete" is passed when Clear is called from
+   // THashList::Clear() or THashList::Delete() or Rehash().
+   Bool_t nodel = option ? (!strcmp(option, "nodelete") ? kTRUE : kFALSE) : kFALSE;
+
+   if (nodel) {
+      MoveObjectsTo(nullptr);
+      return;
    }
 
-   fEntries   = 0;
-   fUsedSlots = 0;
+   // The objects are first detached from the table, so that their
+   // destructors find a consistent (empty) table, and then cleared
+   // with the semantics of TList::Clear().
+   TList objects;
+   MoveObjectsTo(&objects);
+   if (IsOwner())
+      objects.SetOwner();
+   objects.Clear(option);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the number of collisions for an object with a certain name
-/// (i.e. number of objects in same slot in the hash table, i.e. length
-/// of linked list).
+/// (i.e. number of objects which would be in the same slot of the hash
+/// table if it was a table of linked lists).
 
 Int_t THashTable::Collisions(const char *name) const
 {
-   Int_t slot = GetHashValue(name);
+   if (!name) return 0;
+
+   Int_t slot = GetHashValue(::Hash(name));
 
    R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   if (fCont[slot]) return fCont[slot]->GetSize();
-   return 0;
+   Int_t n = 0;
+   if (fCont) {
+      for (Int_t i = slot; !IsEmpty(fCont[i]); i = NextProbe(i))
+         if (fCont[i].fObject && GetHashValue(fCont[i].fHash) == slot)
+            ++n;
+   }
+   return n;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the number of collisions for an object (i.e. number of objects
-/// in same slot in the hash table, i.e. length of linked list).
+/// which would be in the same slot of the hash table if it was a table of
+/// linked lists).
 
 Int_t THashTable::Collisions(TObject *obj) const
 {
    if (IsArgNull("Collisions", obj)) return 0;
 
-   Int_t slot = GetHashValue(obj);
+   Int_t slot = GetHashValue(obj->Hash());
 
    R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   if (fCont[slot]) return fCont[slot]->GetSize();
-   return 0;
+   Int_t n = 0;
+   if (fCont) {
+      for (Int_t i = slot; !IsEmpty(fCont[i]); i = NextProbe(i))
+         if (fCont[i].fObject && GetHashValue(fCont[i].fHash) == slot)
+            ++n;
+   }
+   return n;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -221,14 +354,9 @@ void THashTable::Delete(Option_t *)
 {
    R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
-   for (int i = 0; i < fSize; i++)
-      if (fCont[i]) {
-         fCont[i]->Delete();
-         SafeDelete(fCont[i]);
-      }
-
-   fEntries   = 0;
-   fUsedSlots = 0;
+   TList objects;
+   MoveObjectsTo(&objects);
+   objects.Delete();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -237,11 +365,21 @@ void THashTable::Delete(Option_t *)
 
 TObject *THashTable::FindObject(const char *name) const
 {
-   Int_t slot = GetHashValue(name);
+   if (!name) return 0;
+
+   ULong_t hash = ::Hash(name);
 
    R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   if (fCont[slot]) return fCont[slot]->FindObject(name);
+   if (!fCont) return 0;
+   for (Int_t slot = GetHashValue(hash); !IsEmpty(fCont[slot]); slot = NextProbe(slot)) {
+      const TSlot &s = fCont[slot];
+      if (s.fObject && s.fHash == hash) {
+         const char *objname = s.fObject->GetName();
+         if (objname && strcmp(name, objname) == 0)
+            return s.fObject;
+      }
+   }
    return 0;
 }
 
@@ -252,53 +390,100 @@ TObject *THashTable::FindObject(const TObject *obj) const
 {
    if (IsArgNull("FindObject", obj)) return 0;
 
-   Int_t slot = GetHashValue(obj);
-   if (fCont[slot]) return fCont[slot]->FindObject(obj);
+   ULong_t hash = obj->Hash();
+
+   R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
+
+   if (!fCont) return 0;
+   for (Int_t slot = GetHashValue(hash); !IsEmpty(fCont[slot]); slot = NextProbe(slot)) {
+      const TSlot &s = fCont[slot];
+      if (s.fObject && s.fHash == hash && s.fObject->IsEqual(obj))
+         return s.fObject;
+   }
    return 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Return the TList corresponding to object's name based hash value.
-/// One can iterate this list "manually" to find, e.g. objects with
-/// the same name.
+/// Return the list of the objects with the given hash value, created on the
+/// first request and then kept up to date by the table, or nullptr if there
+/// is no such object.
 
-const TList *THashTable::GetListForObject(const char *name) const
+const TList *THashTable::GetListForHash(ULong_t hash) const
 {
-   Int_t slot = GetHashValue(name);
-
    R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   return fCont[slot];
+   if (!fCont) return nullptr;
+
+   std::lock_guard<std::mutex> lock(GetListCacheMutex());
+   if (fListCache) {
+      auto list = fListCache->fLists.find(hash);
+      if (list != fListCache->fLists.end())
+         return list->second.get();
+   }
+
+   TList *list = nullptr;
+   for (Int_t slot = GetHashValue(hash); !IsEmpty(fCont[slot]); slot = NextProbe(slot)) {
+      if (fCont[slot].fObject && fCont[slot].fHash == hash) {
+         if (!list) {
+            if (!fListCache)
+               fListCache = new TListCache;
+            list = new TList;
+            fListCache->fLists[hash].reset(list);
+         }
+         list->Add(fCont[slot].fObject);
+      }
+   }
+   return list;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Return the TList corresponding to object's hash value.
-/// One can iterate this list "manually" to find, e.g. identical
-/// objects.
+/// Return the TList of the objects having the same hash value as name, in
+/// the order in which FindObject() considers them. One can iterate this list
+/// "manually" to find, e.g. objects with the same name.
+///
+/// The list is owned by the table: it is kept up to date by the table until
+/// the last of its objects is removed or the table is cleared.
 
-const TList *THashTable::GetListForObject(const TObject *obj) const
+const TList *THashTable::GetListForObject(const char *name) const
 {
-   if (IsArgNull("GetListForObject", obj)) return 0;
+   if (!name) return 0;
 
-   Int_t slot = GetHashValue(obj);
+   return GetListForHash(::Hash(name));
+}
 
-   R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
+////////////////////////////////////////////////////////////////////////////////
+/// Return the TList of the objects having the same hash value as obj, in
+/// the order in which FindObject() considers them. One can iterate this list
+/// "manually" to find, e.g. identical objects.
+///
+/// The list is owned by the table: it is kept up to date by the table until
+/// the last of its objects is removed or the table is cleared.
 
-   return fCont[slot];
+const TList *THashTable::GetListForObject(const TObject *obj) const
+{
+   if (IsArgNull("GetListForObject", obj)) return 0;
+
+   return GetListForHash(obj->Hash());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Return address of pointer to obj
+/// Return address of pointer to obj. It is only valid until the next
+/// modification of the table.
 
 TObject **THashTable::GetObjectRef(const TObject *obj) const
 {
    if (IsArgNull("GetObjectRef", obj)) return 0;
 
-   Int_t slot = GetHashValue(obj);
+   ULong_t hash = obj->Hash();
 
    R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   if (fCont[slot]) return fCont[slot]->GetObjectRef(obj);
+   if (!fCont) return 0;
+   for (Int_t slot = GetHashValue(hash); !IsEmpty(fCont[slot]); slot = NextProbe(slot)) {
+      TSlot &s = fCont[slot];
+      if (s.fObject && s.fHash == hash && s.fObject->IsEqual(obj))
+         return &s.fObject;
+   }
    return 0;
 }
 
@@ -337,11 +522,11 @@ void THashTable::Print(Option_t *option, Int_t recurse) const
       for (Int_t cursor = 0; cursor < Capacity();
            cursor++) {
          printf("Slot #%d:\n",cursor);
-         if (fCont[cursor])
-            fCont[cursor]->Print();
+         if (fCont && fCont[cursor].fObject)
+            PrintCollectionEntry(fCont[cursor].fObject, option, recurse - 1);
          else {
             TROOT::IndentLevel();
-            printf("empty\n");
+            printf("%s\n", (fCont && fCont[cursor].fHash) ? "removed" : "empty");
          }
 
       }
@@ -350,62 +535,115 @@ void THashTable::Print(Option_t *option, Int_t recurse) const
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Rehash the hashtable. If the collision rate becomes too high (i.e.
-/// the average size of the linked lists become too long) then lookup
-/// efficiency decreases since relatively long lists have to be searched
-/// every time. To improve performance rehash the hashtable. This resizes
-/// the table to newCapacity slots and refills the table. Use
-/// AverageCollisions() to check if you need to rehash. Set checkObjValidity
-/// to kFALSE if you know that all objects in the table are still valid
-/// (i.e. have not been deleted from the system in the meanwhile).
+/// Rehash the hashtable. This resizes the table to newCapacity slots,
+/// rounded up to the next power of two and at least twice the number of
+/// objects, and refills the table with the current hash values of the
+/// objects (e.g. after their renaming), which also reclaims the slots freed
+/// by the removals. The table is automatically rehashed when it becomes half
+/// full; use AverageCollisions() to check if you need to rehash for other
+/// reasons. Set checkObjValidity to kFALSE if you know that all objects in
+/// the table are still valid (i.e. have not been deleted from the system in
+/// the meanwhile).
 
 void THashTable::Rehash(Int_t newCapacity, Bool_t checkObjValidity)
 {
-   THashTable *ht = new THashTable(newCapacity);
-
    R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
-   TIter next(this);
-   TObject *obj;
-
-   auto initialSize = GetEntries();
-
-   if (checkObjValidity && TObject::GetObjectStat() && gObjectTable) {
-      while ((obj = next()))
-         if (gObjectTable->PtrIsValid(obj))
-            ht->AddImpl(ht->GetHashValue(obj),obj);
-   } else {
-      while ((obj = next()))
-         ht->AddImpl(ht->GetHashValue(obj),obj);
+   TSlot *oldCont = fCont;
+   Int_t  oldSize = fSize;
+   Int_t  initialSize = fEntries;
+
+   fSize         = NextPowerOfTwo(TMath::Max(newCapacity, 2 * fEntries + 1));
+   fCont         = nullptr;
+   fEntries      = 0;
+   fRemovedSlots = 0;
+   fProbes       = 0;
+
+   // The lists of GetListForObject() stay valid unless an object was dropped
+   // or its hash value changed; AddImpl() must not add the objects to them a
+   // second time.
+   TListCache *listCache = fListCache;
+   fListCache = nullptr;
+   Bool_t sameHashes = kTRUE;
+
+   // Start after an empty slot (there is always one), so that each sequence
+   // of used slots is visited in probing order: the objects with the same
+   // hash value are then found in the same order in the new table.
+   Bool_t checkValidity = checkObjValidity && TObject::GetObjectStat() && gObjectTable;
+   if (oldCont) {
+      Int_t start = 0;
+      while (!IsEmpty(oldCont[start]))
+         ++start;
+      for (Int_t n = 1; n <= oldSize; n++) {
+         const TSlot &s = oldCont[(start + n) & (oldSize - 1)];
+         if (s.fObject && (!checkValidity || gObjectTable->PtrIsValid(s.fObject))) {
+            // The hash value is computed again, as the rehash is the way to
+            // take into account, e.g., the renaming of an object.
+            ULong_t hash = s.fObject->Hash();
+            if (hash != s.fHash)
+               sameHashes = kFALSE;
+            AddImpl(hash, s.fObject);
+         }
+      }
    }
+   delete [] oldCont;
 
-   if (initialSize != GetEntries()) {
-      // Somehow in the process of copy the pointer from one hash to
-      // other we ended up inducing the addition of more element to
-      // the table.  Most likely those elements have not been copied ....
-      // i.e. Adding *during* the Rehashing is illegal and fatal.
-
-      Fatal("Rehash",
-            "During the rehash of %p one or more element was added or removed. The initalize size was %d and now it is %d",
-            this, initialSize, GetEntries());
-
+   if (fEntries == initialSize && sameHashes) {
+      fListCache = listCache;
+   } else {
+      std::lock_guard<std::mutex> lock(GetListCacheMutex());
+      delete listCache;
    }
 
-   Clear("nodelete");
-   delete [] fCont;
-   fCont = ht->fCont;
-   ht->fCont = 0;
-
-   fSize      = ht->fSize;     // idem
-   fEntries   = ht->fEntries;
-   fUsedSlots = ht->fUsedSlots;
-
    // this should not happen, but it will prevent an endless loop
    // in case of a very bad hash function
    if (fRehashLevel && AverageCollisions() > fRehashLevel)
       fRehashLevel = (int)AverageCollisions() + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the object of slot from the table and return it.
+/// This does not take any lock.
 
-   delete ht;
+TObject *THashTable::RemoveSlot(Int_t slot)
+{
+   TSlot &s = fCont[slot];
+   TObject *ob = s.fObject;
+   ULong_t hash = s.fHash;
+
+   fProbes -= ((slot - GetHashValue(hash)) & (fSize - 1)) + 1;
+   --fEntries;
+
+   s.fObject = nullptr;
+   if (IsEmpty(fCont[NextProbe(slot)])) {
+      // Nothing is probed past this slot: it and the removed slots
+      // before it can become empty again.
+      s.fHash = 0;
+      for (Int_t i = (slot + fSize - 1) & (fSize - 1); !fCont[i].fObject && fCont[i].fHash;
+           i = (i + fSize - 1) & (fSize - 1)) {
+         fCont[i].fHash = 0;
+         --fRemovedSlots;
+      }
+   } else {
+      s.fHash = kRemovedSlot;
+      ++fRemovedSlots;
+   }
+
+   if (fListCache) {
+      std::lock_guard<std::mutex> lock(GetListCacheMutex());
+      auto list = fListCache->fLists.find(hash);
+      if (list != fListCache->fLists.end()) {
+         for (TObjLink *lnk = list->second->FirstLink(); lnk; lnk = lnk->Next()) {
+            if (lnk->GetObject() == ob) {
+               list->second->Remove(lnk);
+               break;
+            }
+         }
+         if (list->second->IsEmpty())
+            fListCache->fLists.erase(list);
+      }
+   }
+   return ob;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -413,21 +651,19 @@ void THashTable::Rehash(Int_t newCapacity, Bool_t checkObjValidity)
 
 TObject *THashTable::Remove(TObject *obj)
 {
-   Int_t slot = GetHashValue(obj);
+   if (!obj) return 0;
+
+   ULong_t hash = obj->Hash();
 
    R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   if (fCont[slot]) {
-      R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+   if (!fCont) return 0;
+   for (Int_t slot = GetHashValue(hash); !IsEmpty(fCont[slot]); slot = NextProbe(slot)) {
+      TObject *ob = fCont[slot].fObject;
+      if (ob && fCont[slot].fHash == hash && ob->TestBit(kNotDeleted) && ob->IsEqual(obj)) {
+         R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
-      TObject *ob = fCont[slot]->Remove(obj);
-      if (ob) {
-         fEntries--;
-         if (fCont[slot]->GetSize() == 0) {
-            SafeDelete(fCont[slot]);
-            fUsedSlots--;
-         }
-         return ob;
+         return RemoveSlot(slot);
       }
    }
    return 0;
@@ -441,18 +677,11 @@ TObject *THashTable::RemoveSlow(TObject *obj)
 
    R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
+   if (!obj || !fCont) return 0;
    for (int i = 0; i < fSize; i++) {
-      if (fCont[i]) {
-         TObject *ob = fCont[i]->Remove(obj);
-         if (ob) {
-            fEntries--;
-            if (fCont[i]->GetSize() == 0) {
-               SafeDelete(fCont[i]);
-               fUsedSlots--;
-            }
-            return ob;
-         }
-      }
+      TObject *ob = fCont[i].fObject;
+      if (ob && ob->TestBit(kNotDeleted) && ob->IsEqual(obj))
+         return RemoveSlot(i);
    }
    return 0;
 }
@@ -471,7 +700,6 @@ THashTableIter::THashTableIter(const THashTable *ht, Bool_t dir)
 {
    fTable      = ht;
    fDirection  = dir;
-   fListCursor = 0;
    Reset();
 }
 
@@ -483,12 +711,7 @@ THashTableIter::THashTableIter(const THashTableIter &iter) : TIterator(iter)
    fTable      = iter.fTable;
    fDirection  = iter.fDirection;
    fCursor     = iter.fCursor;
-   fListCursor = 0;
-   if (iter.fListCursor) {
-      fListCursor = (TListIter *)iter.fListCursor->GetCollection()->MakeIterator();
-      if (fListCursor)
-         fListCursor->operator=(*iter.fListCursor);
-   }
+   fCurrent    = iter.fCurrent;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -501,13 +724,7 @@ TIterator &THashTableIter::operator=(const TIterator &rhs)
       fTable     = rhs1.fTable;
       fDirection = rhs1.fDirection;
       fCursor    = rhs1.fCursor;
-      if (rhs1.fListCursor) {
-         // R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
-
-         fListCursor = (TListIter *)rhs1.fListCursor->GetCollection()->MakeIterator();
-         if (fListCursor)
-            fListCursor->operator=(*rhs1.fListCursor);
-      }
+      fCurrent   = rhs1.fCurrent;
    }
    return *this;
 }
@@ -521,13 +738,7 @@ THashTableIter &THashTableIter::operator=(const THashTableIter &rhs)
       fTable     = rhs.fTable;
       fDirection = rhs.fDirection;
       fCursor    = rhs.fCursor;
-      if (rhs.fListCursor) {
-         // R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
-
-         fListCursor = (TListIter *)rhs.fListCursor->GetCollection()->MakeIterator();
-         if (fListCursor)
-            fListCursor->operator=(*rhs.fListCursor);
-      }
+      fCurrent   = rhs.fCurrent;
    }
    return *this;
 }
@@ -537,46 +748,42 @@ THashTableIter &THashTableIter::operator=(const THashTableIter &rhs)
 
 THashTableIter::~THashTableIter()
 {
-   delete fListCursor;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Return next object in hashtable. Returns 0 when no more objects in table.
+/// The object returned last can be removed from the table without
+/// disturbing the iteration.
 
 TObject *THashTableIter::Next()
 {
    // R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   while (kTRUE) {
-      if (!fListCursor) {
-         int slot = NextSlot();
-         if (slot == -1) return 0;
-         fListCursor = new TListIter(fTable->fCont[slot], fDirection);
-      }
-
-      TObject *obj = fListCursor->Next();
-      if (obj) return obj;
-
-      SafeDelete(fListCursor);
-   }
+   fCurrent = NextSlot();
+   if (fCurrent == -1) return 0;
+   return fTable->fCont[fCurrent].fObject;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Returns index of next slot in table containing list to be iterated.
+/// Returns index of next slot in table containing an object.
 
 Int_t THashTableIter::NextSlot()
 {
    // R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
 
+   if (!fTable->fCont) return -1;
+
    if (fDirection == kIterForward) {
-      for ( ; fCursor < fTable->Capacity() && fTable->fCont[fCursor] == 0;
+      for ( ; fCursor < fTable->Capacity() && fTable->fCont[fCursor].fObject == 0;
               fCursor++) { }
 
       if (fCursor < fTable->Capacity())
          return fCursor++;
 
    } else {
-      for ( ; fCursor >= 0 && fTable->fCont[fCursor] == 0;
+      if (fCursor >= fTable->Capacity())
+         fCursor = fTable->Capacity() - 1;
+      for ( ; fCursor >= 0 && fTable->fCont[fCursor].fObject == 0;
               fCursor--) { }
 
       if (fCursor >= 0)
@@ -595,7 +802,7 @@ void THashTableIter::Reset()
       fCursor = 0;
    else
       fCursor = fTable->Capacity() - 1;
-   SafeDelete(fListCursor);
+   fCurrent = -1;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -605,7 +812,7 @@ Bool_t THashTableIter::operator!=(const TIterator &aIter) const
 {
    if (aIter.IsA() == THashTableIter::Class()) {
       const THashTableIter &iter(dynamic_cast<const THashTableIter &>(aIter));
-      return (fListCursor != iter.fListCursor);
+      return (fCurrent != iter.fCurrent);
    }
    return false; // for base class we don't implement a comparison
 }
@@ -615,7 +822,7 @@ Bool_t THashTableIter::operator!=(const TIterator &aIter) const
 
 Bool_t THashTableIter::operator!=(const THashTableIter &aIter) const
 {
-   return (fListCursor != aIter.fListCursor);
+   return (fCurrent != aIter.fCurrent);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -623,5 +830,6 @@ Bool_t THashTableIter::operator!=(const THashTableIter &aIter) const
 
 TObject *THashTableIter::operator*() const
 {
-   return (fListCursor ? fListCursor->operator*() : nullptr);
+   return (fCurrent != -1 && fTable->fCont && fCurrent < fTable->Capacity()) ? fTable->fCont[fCurrent].fObject
+                                                                          : nullptr;
 }
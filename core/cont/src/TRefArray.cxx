@@ -626,6 +626,35 @@ Int_t TRefArray::GetLast() const
    return fLowerBound+GetAbsLast();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill objects with the objects of the array, from the lower bound to the
+/// last element: objects[i] is the object at LowerBound()+i, or nullptr for
+/// an empty slot or an object that cannot be found.
+///
+/// The validity of the TProcessID is checked once for the whole array, and
+/// the TRefTable of the current thread is only asked to load the objects not
+/// already in memory (loading one of them usually brings in the others of
+/// the same branch). Return the number of objects found.
+
+Int_t TRefArray::GetObjects(std::vector<TObject *> &objects) const
+{
+   const Int_t n = GetAbsLast() + 1;
+   objects.assign(n, nullptr);
+   if (!fPID || !TProcessID::IsValid(fPID)) return 0;
+
+   Int_t nfound = 0;
+   for (Int_t i = 0; i < n; i++) {
+      if (!fUIDs[i]) continue;
+      TObject *obj = fPID->GetObjectWithID(fUIDs[i]);
+      if (!obj) obj = GetFromTable(i);
+      if (obj) {
+         objects[i] = obj;
+         nfound++;
+      }
+   }
+   return nfound;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return address of pointer obj.
 
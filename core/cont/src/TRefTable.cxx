@@ -35,6 +35,9 @@ all known TProcessIDs in fProcessGUIDs; the index of a TProcessID in
 this vector defines the index of the auto-loading info in fParentIDs
 for that TProcessID. The mapping of TProcessID* to index is cached
 for quick non-persistent lookup.
+
+The current TRefTable (see GetRefTable()) is kept per thread: trees read
+or filled by different threads do not share it.
 */
 
 #include "TRefTable.h"
@@ -42,8 +45,75 @@ for quick non-persistent lookup.
 #include "TObjArray.h"
 #include "TProcessID.h"
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+
+namespace {
+
+/// The current TRefTable of a thread. The slots of all threads are known, so
+/// that a table deleted by one thread is not left current in another one.
+/// The registry is never deleted: tables may be deleted at exit, after the
+/// static objects.
+struct RRefTableSlot {
+   std::atomic<TRefTable *> fTable{nullptr};
+
+   static std::mutex &GetMutex()
+   {
+      static auto mutex = new std::mutex;
+      return *mutex;
+   }
+   static std::set<RRefTableSlot *> &GetSlots()
+   {
+      static auto slots = new std::set<RRefTableSlot *>;
+      return *slots;
+   }
+
+   RRefTableSlot();
+   ~RRefTableSlot();
+
+   /// Make table current in no thread.
+   static void Forget(TRefTable *table)
+   {
+      std::lock_guard<std::mutex> lock(GetMutex());
+      for (auto slot : GetSlots()) {
+         TRefTable *expected = table;
+         slot->fTable.compare_exchange_strong(expected, nullptr);
+      }
+   }
+};
+
+thread_local bool gRefTableSlotDestroyed = false;
+
+RRefTableSlot::RRefTableSlot()
+{
+   std::lock_guard<std::mutex> lock(GetMutex());
+   GetSlots().insert(this);
+}
+
+RRefTableSlot::~RRefTableSlot()
+{
+   std::lock_guard<std::mutex> lock(GetMutex());
+   GetSlots().erase(this);
+   gRefTableSlotDestroyed = true;
+}
+
+/// Return the slot of this thread, or nullptr if the thread is exiting.
+RRefTableSlot *GetRefTableSlot()
+{
+   if (gRefTableSlotDestroyed)
+      return nullptr;
+   thread_local RRefTableSlot slot;
+   return &slot;
+}
+
+void SetCurrentRefTable(TRefTable *table)
+{
+   if (auto slot = GetRefTableSlot())
+      slot->fTable = table;
+}
 
-TRefTable *TRefTable::fgRefTable = 0;
+} // namespace
 
 ClassImp(TRefTable);
 ////////////////////////////////////////////////////////////////////////////////
@@ -52,7 +122,7 @@ ClassImp(TRefTable);
 TRefTable::TRefTable() : fNumPIDs(0), fAllocSize(0), fN(0), fParentIDs(0), fParentID(-1),
                          fDefaultSize(10), fUID(0), fUIDContext(0), fSize(0), fParents(0), fOwner(0)
 {
-   fgRefTable   = this;
+   SetCurrentRefTable(this);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -62,7 +132,7 @@ TRefTable::TRefTable(TObject *owner, Int_t size) :
      fNumPIDs(0), fAllocSize(0), fN(0), fParentIDs(0), fParentID(-1),
      fDefaultSize(size<10 ? 10 : size), fUID(0), fUIDContext(0), fSize(0), fParents(new TObjArray(1)), fOwner(owner)
 {
-   fgRefTable   = this;
+   SetCurrentRefTable(this);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -77,7 +147,7 @@ TRefTable::~TRefTable()
    }
    delete [] fParentIDs;
    delete fParents;
-   if (fgRefTable == this) fgRefTable = 0;
+   RRefTableSlot::Forget(this);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -282,11 +352,12 @@ Int_t TRefTable::GetInternalIdxForPID(Int_t pid) const
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Static function returning the current TRefTable.
+/// Static function returning the current TRefTable of this thread.
 
 TRefTable *TRefTable::GetRefTable()
 {
-   return fgRefTable;
+   auto slot = GetRefTableSlot();
+   return slot ? slot->fTable.load() : nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -378,11 +449,11 @@ Int_t TRefTable::SetParent(const TObject* parent, Int_t branchID)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Static function setting the current TRefTable.
+/// Static function setting the current TRefTable of this thread.
 
 void TRefTable::SetRefTable(TRefTable *table)
 {
-   fgRefTable = table;
+   SetCurrentRefTable(table);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,39 @@
+#include "gtest/gtest.h"
+
+#include "TClass.h"
+#include "TClonesArray.h"
+#include "TNamed.h"
+
+TEST(TClonesArray, Contiguous)
+{
+   TClonesArray clones("TNamed", 100);
+   clones.SetContiguous();
+   EXPECT_TRUE(clones.IsContiguous());
+
+   clones.ExpandCreate(100);
+   const auto stride = TNamed::Class()->Size();
+   for (int i = 1; i < 100; ++i)
+      EXPECT_EQ((char *)clones[i] - (char *)clones[i - 1], stride);
+
+   // The clones are reused, in place, after a Clear() or a Delete()
+   TObject *first = clones[0];
+   clones.Clear("C");
+   clones.ExpandCreateFast(100);
+   EXPECT_EQ(clones[0], first);
+   clones.Delete();
+   static_cast<TNamed *>(clones.ConstructedAt(0))->SetName("again");
+   EXPECT_EQ(clones[0], first);
+   EXPECT_STREQ(clones[0]->GetName(), "again");
+
+   // More clones than the capacity of a block go into another block
+   clones.ExpandCreate(1000);
+   EXPECT_EQ(clones.GetEntriesFast(), 1000);
+   clones.ExpandCreate(10);
+   EXPECT_EQ(clones.GetEntriesFast(), 10);
+
+   // Contiguous clones cannot be moved to another array
+   TClonesArray other("TNamed");
+   other.AbsorbObjects(&clones);
+   EXPECT_EQ(other.GetEntriesFast(), 0);
+   EXPECT_EQ(clones.GetEntriesFast(), 10);
+}
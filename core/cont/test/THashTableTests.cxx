@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+
+#include "THashList.h"
+#include "THashTable.h"
+#include "TNamed.h"
+#include "TObjString.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+TEST(THashTable, AddFindRemove)
+{
+   THashTable table;
+   std::vector<TObjString *> objs;
+   for (int i = 0; i < 1000; ++i) {
+      objs.push_back(new TObjString(("obj" + std::to_string(i)).c_str()));
+      table.Add(objs.back());
+   }
+   EXPECT_EQ(table.GetSize(), 1000);
+   // The table grows to stay at most half full
+   EXPECT_GE(table.Capacity(), 2000);
+   EXPECT_GE(table.AverageCollisions(), 1.f);
+
+   for (int i = 0; i < 1000; ++i) {
+      EXPECT_EQ(table.FindObject(("obj" + std::to_string(i)).c_str()), objs[i]);
+      TObjString key(("obj" + std::to_string(i)).c_str());
+      EXPECT_EQ(table.FindObject(&key), objs[i]);
+   }
+   EXPECT_EQ(table.FindObject("obj1000"), nullptr);
+
+   for (int i = 0; i < 1000; i += 2)
+      EXPECT_EQ(table.Remove(objs[i]), objs[i]);
+   EXPECT_EQ(table.GetSize(), 500);
+   for (int i = 0; i < 1000; ++i)
+      EXPECT_EQ(table.FindObject(objs[i]->GetName()), i % 2 ? objs[i] : nullptr);
+
+   table.SetOwner();
+   table.Delete();
+   for (int i = 0; i < 1000; i += 2)
+      delete objs[i];
+   EXPECT_EQ(table.GetSize(), 0);
+   EXPECT_EQ(table.FindObject("obj1"), nullptr);
+}
+
+TEST(THashTable, Iteration)
+{
+   THashTable table(5);
+   std::set<TObject *> objs;
+   for (int i = 0; i < 100; ++i) {
+      auto obj = new TNamed(("n" + std::to_string(i)).c_str(), "");
+      objs.insert(obj);
+      table.Add(obj);
+   }
+
+   std::set<TObject *> seen;
+   for (auto obj : table)
+      EXPECT_TRUE(seen.insert(obj).second);
+   EXPECT_EQ(seen, objs);
+
+   // The object returned last can be removed while iterating
+   TIter next(&table, kIterBackward);
+   int n = 0;
+   while (TObject *obj = next()) {
+      if (n++ % 3 == 0)
+         table.Remove(obj);
+   }
+   EXPECT_EQ(n, 100);
+   EXPECT_EQ(table.GetSize(), 66);
+
+   table.Clear();
+   for (auto obj : objs)
+      delete obj;
+}
+
+TEST(THashTable, SameName)
+{
+   THashTable table;
+   TNamed first("dup", "first"), second("dup", "second"), last("dup", "last");
+   table.Add(&first);
+   table.Add(&second);
+   EXPECT_EQ(table.FindObject("dup"), &first);
+   table.AddBefore(&first, &last);
+   EXPECT_EQ(table.FindObject("dup"), &last);
+
+   const TList *list = table.GetListForObject("dup");
+   ASSERT_NE(list, nullptr);
+   ASSERT_EQ(list->GetSize(), 3);
+   EXPECT_EQ(list->At(0), &last);
+   EXPECT_EQ(list->At(2), &second);
+   EXPECT_EQ(table.GetListForObject("other"), nullptr);
+
+   // The list is kept up to date, also when the table grows
+   std::vector<TNamed> others(100);
+   for (auto &other : others) {
+      other.SetName(("other" + std::to_string(&other - others.data())).c_str());
+      table.Add(&other);
+   }
+   table.Remove(&last);
+   EXPECT_EQ(list, table.GetListForObject("dup"));
+   EXPECT_EQ(list->GetSize(), 2);
+   EXPECT_EQ(list->First(), &first);
+   EXPECT_EQ(table.FindObject("dup"), &first);
+   table.Clear("nodelete");
+}
+
+TEST(THashList, RenameAndRehash)
+{
+   THashList list;
+   TNamed a("a", ""), b("b", "");
+   list.Add(&a);
+   list.AddFirst(&b);
+   EXPECT_EQ(list.First(), &b);
+   a.SetName("c");
+   list.Rehash(list.GetSize());
+   EXPECT_EQ(list.FindObject("c"), &a);
+   EXPECT_EQ(list.FindObject("a"), nullptr);
+   list.Clear();
+}
@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+
+#include "TNamed.h"
+#include "TRefArray.h"
+#include "TRefTable.h"
+
+#include <thread>
+#include <vector>
+
+TEST(TRefTable, CurrentTablePerThread)
+{
+   TRefTable table(nullptr, 10);
+   EXPECT_EQ(TRefTable::GetRefTable(), &table);
+
+   TRefTable *otherThreadTable = &table;
+   std::thread t([&otherThreadTable]() { otherThreadTable = TRefTable::GetRefTable(); });
+   t.join();
+   EXPECT_EQ(otherThreadTable, nullptr);
+
+   // a table deleted in another thread is no longer current here
+   TRefTable *deleted = nullptr;
+   std::thread owner([&deleted]() { deleted = new TRefTable(nullptr, 10); });
+   owner.join();
+   TRefTable::SetRefTable(deleted);
+   std::thread deleter([deleted]() { delete deleted; });
+   deleter.join();
+   EXPECT_EQ(TRefTable::GetRefTable(), nullptr);
+
+   TRefTable::SetRefTable(nullptr);
+}
+
+TEST(TRefArray, GetObjects)
+{
+   TNamed a("a", ""), b("b", "");
+   TRefArray refs;
+   refs.AddAtAndExpand(&a, 0);
+   refs.AddAtAndExpand(&b, 2);
+
+   std::vector<TObject *> objects;
+   EXPECT_EQ(refs.GetObjects(objects), 2);
+   ASSERT_EQ(objects.size(), 3u);
+   EXPECT_EQ(objects[0], &a);
+   EXPECT_EQ(objects[1], nullptr);
+   EXPECT_EQ(objects[2], &b);
+
+   TRefArray empty;
+   EXPECT_EQ(empty.GetObjects(objects), 0);
+   EXPECT_TRUE(objects.empty());
+}
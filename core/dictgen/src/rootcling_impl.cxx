@@ -121,6 +121,7 @@ const std::string gPathSeparator(ROOT::TMetaUtils::GetPathSeparator());
 #define strncasecmp _strnicmp
 #else
 #include <unistd.h>
+#include <sys/wait.h>
 #endif
 
 bool gBuildingROOT = false;
@@ -5351,7 +5352,9 @@ namespace genreflex {
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Get the right ofilenames and invoke several times rootcling
-/// One invokation per header
+/// One invokation per header. With nJobs > 1, up to nJobs invocations run
+/// concurrently, each in a child process (not on Windows, where they stay
+/// sequential).
 
    int invokeManyRootCling(const std::string &verbosity,
                            const std::string &selectionFileName,
@@ -5373,7 +5376,8 @@ namespace genreflex {
                            bool noGlobalUsingStd,
                            const std::vector<std::string> &headersNames,
                            bool failOnWarnings,
-                           const std::string &outputDirName_const = "")
+                           const std::string &outputDirName_const = "",
+                           unsigned int nJobs = 1)
    {
       std::string outputDirName(outputDirName_const);
 
@@ -5384,12 +5388,51 @@ namespace genreflex {
          outputDirName += gPathSeparator;
       }
 
+#ifndef R__WIN32
+      int jobsReturnCode = 0;
+      unsigned int runningJobs = 0;
+      // Wait for one of the children, remember the first failure
+      auto waitJob = [&]() {
+         int status = 0;
+         if (wait(&status) < 0) {
+            jobsReturnCode = jobsReturnCode ? jobsReturnCode : 1;
+            runningJobs = 0;
+            return;
+         }
+         --runningJobs;
+         int returnCode = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+         if (returnCode != 0 && jobsReturnCode == 0)
+            jobsReturnCode = returnCode;
+      };
+#endif
+
       std::vector<std::string> namesSingleton(1);
       for (unsigned int i = 0; i < headersNames.size(); ++i) {
          namesSingleton[0] = headersNames[i];
          std::string ofilenameFullPath(ofilesNames[i]);
          if (llvm::sys::path::parent_path(ofilenameFullPath) == "")
             ofilenameFullPath = outputDirName + ofilenameFullPath;
+#ifndef R__WIN32
+         pid_t pid = -1;
+         if (nJobs > 1) {
+            while (runningJobs >= nJobs)
+               waitJob();
+            if (jobsReturnCode != 0)
+               break;
+            // Do not let the children inherit and flush again the buffered output
+            std::cout.flush();
+            std::cerr.flush();
+            fflush(nullptr);
+            pid = fork();
+            if (pid > 0) {
+               ++runningJobs;
+               continue;
+            }
+            if (pid < 0)
+               ROOT::TMetaUtils::Warning(0, "*** genreflex: Cannot fork, generating %s in this process.\n",
+                                         ofilenameFullPath.c_str());
+         }
+#endif
          int returnCode = invokeRootCling(verbosity,
                                           selectionFileName,
                                           targetLibName,
@@ -5411,11 +5454,30 @@ namespace genreflex {
                                           namesSingleton,
                                           failOnWarnings,
                                           ofilenameFullPath);
-         if (returnCode != 0)
+#ifndef R__WIN32
+         if (pid == 0) {
+            std::cout.flush();
+            std::cerr.flush();
+            fflush(nullptr);
+            _exit(returnCode);
+         }
+#endif
+         if (returnCode != 0) {
+#ifndef R__WIN32
+            while (runningJobs > 0)
+               waitJob();
+#endif
             return returnCode;
+         }
       }
 
+#ifndef R__WIN32
+      while (runningJobs > 0)
+         waitJob();
+      return jobsReturnCode;
+#else
       return 0;
+#endif
    }
 
 
@@ -5534,6 +5596,7 @@ int GenReflexMain(int argc, char **argv)
                        NOMEMBERTYPEDEFS,
                        NOTEMPLATETYPEDEFS,
                        NOINCLUDEPATHS,
+                       JOBS,
                        // Don't show up in the help
                        PREPROCDEFINE,
                        PREPROCUNDEFINE,
@@ -5736,6 +5799,17 @@ int GenReflexMain(int argc, char **argv)
          "-m \tPcm file loaded before any header (option can be repeated).\n"
       },
 
+      {
+         JOBS,
+         STRING ,
+         "j" , "jobs" ,
+         ROOT::option::FullArg::Required,
+         "-j, --jobs\tNumber of dictionaries generated concurrently.\n"
+         "      If no output file is specified (or a directory is), one dictionary is\n"
+         "      generated per header. With -j N, up to N of them are generated at the\n"
+         "      same time, in separate processes. The default is 1.\n"
+      },
+
       {
          VERBOSE,
          NOTYPE ,
@@ -5966,6 +6040,17 @@ int GenReflexMain(int argc, char **argv)
    bool noGlobalUsingStd = false;
    if (options[NOGLOBALUSINGSTD]) noGlobalUsingStd = true;
 
+   unsigned int nJobs = 1;
+   if (options[JOBS]) {
+      int jobs = atoi(options[JOBS].arg);
+      if (jobs < 1) {
+         ROOT::TMetaUtils::Error("", "The number of jobs must be a positive integer, got '%s'.\n",
+                                 options[JOBS].arg);
+         return 1;
+      }
+      nJobs = jobs;
+   }
+
    if (multidict && targetLibName.empty()) {
       ROOT::TMetaUtils::Error("",
                               "Multilib support is requested but no target lib is specified. A sane pcm name cannot be formed.\n");
@@ -6081,7 +6166,8 @@ int GenReflexMain(int argc, char **argv)
                                         noGlobalUsingStd,
                                         headersNames,
                                         failOnWarnings,
-                                        ofileName);
+                                        ofileName,
+                                        nJobs);
    }
 
    return returnValue;
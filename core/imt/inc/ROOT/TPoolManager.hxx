@@ -30,7 +30,11 @@
 # endif
 #else
 
-#include<memory>
+#include "ROOT/TTaskGroup.hxx"
+
+#include <functional>
+#include <memory>
+#include <string>
 
 namespace tbb {
    class task_scheduler_init;
@@ -38,6 +42,7 @@ namespace tbb {
 
 namespace ROOT {
    namespace Internal {
+      struct TPoolManagerArenas;
       /**
       \class ROOT::TPoolManager
       \ingroup TPoolManager
@@ -45,6 +50,13 @@ namespace ROOT {
 
       A manager for the multithreading scheduler that solves undefined behaviours and interferences between
       classes and functions that made direct use of the scheduler, such as EnableImplicitMT() ot TThreadExecutor.
+
+      Besides the default task arena, which is shared by all the users of the pool, the manager can create named
+      task arenas with a limited concurrency: the work executed in a named arena never occupies more threads of the
+      pool than the arena allows, e.g. to reserve threads to the I/O while an analysis runs its own parallel work.
+
+      If the `IMT.NUMAPinning` resource is set (see config/rootrc.in), the manager also creates one arena per NUMA
+      domain of the machine, whose threads are pinned to the cores of the domain while they work in it (Linux only).
       */
 
       class TPoolManager {
@@ -54,14 +66,23 @@ namespace ROOT {
          static UInt_t GetPoolSize();
          /// Terminates the scheduler instantiated within ROOT.
          ~TPoolManager();
+
+         bool CreateArena(const std::string &name, UInt_t maxConcurrency, UInt_t reservedForMasters = 1);
+         bool HasArena(const std::string &name) const;
+         void Execute(const std::string &arenaName, ROOT::Experimental::ETaskPriority priority,
+                      const std::function<void(void)> &operation);
+         UInt_t GetNUMADomains() const;
+         std::string GetNUMAArena(UInt_t index) const;
       private:
          ///Initializes the scheduler within ROOT. If the scheduler has already been initialized by the
          /// user before invoking the constructor it won't change its behaviour and it won't terminate it,
          /// but it will still keep record of the number of threads passed as a parameter.
          TPoolManager(UInt_t nThreads = 0);
+         void CreateNUMAArenas(UInt_t nThreads);
          static UInt_t fgPoolSize;
          bool mustDelete = true;
          tbb::task_scheduler_init *fSched = nullptr;
+         std::unique_ptr<TPoolManagerArenas> fArenas; ///< The named task arenas
       };
       /// Get a shared pointer to the manager. Initialize the manager with nThreads if not active. If active,
       /// the number of threads, even if specified otherwise, will remain the same.
@@ -14,10 +14,15 @@
 
 #include <atomic>
 #include <functional>
+#include <string>
 
 namespace ROOT {
 namespace Experimental {
 
+/// Priority of the work items submitted to ROOT's thread pool. Idle threads take the work items of higher priority
+/// first, e.g. the decompression of the baskets that are about to be read before the tasks of an analysis.
+enum class ETaskPriority { kLow, kNormal, kHigh };
+
 class TTaskGroup {
    /**
    \class ROOT::Experimental::TTaskGroup
@@ -30,10 +35,13 @@ class TTaskGroup {
 private:
    void *fTaskContainer{nullptr};
    std::atomic<bool> fCanRun{true};
+   ETaskPriority fPriority{ETaskPriority::kNormal};
+   std::string fArenaName; ///< The task arena the work items run in, the default one if empty
    void ExecuteInIsolation(const std::function<void(void)> &operation);
 
 public:
    TTaskGroup();
+   explicit TTaskGroup(ETaskPriority priority, const std::string &arenaName = "");
    TTaskGroup(TTaskGroup &&other);
    TTaskGroup(const TTaskGroup &) = delete;
    TTaskGroup &operator=(TTaskGroup &&other);
@@ -24,11 +24,13 @@
 
 #include "ROOT/TExecutor.hxx"
 #include "ROOT/TPoolManager.hxx"
+#include "ROOT/TTaskGroup.hxx"
 #include "TROOT.h"
 #include "TError.h"
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <string>
 
 namespace ROOT {
 
@@ -84,9 +86,37 @@ namespace ROOT {
       using TExecutor<TThreadExecutor>::Reduce;
       template<class T, class BINARYOP> auto Reduce(const std::vector<T> &objs, BINARYOP redfunc) -> decltype(redfunc(objs.front(), objs.front()));
       template<class T, class R> auto Reduce(const std::vector<T> &objs, R redfunc) -> decltype(redfunc(objs));
+      template<class T, class BINARYOP> T Reduce(const std::vector<T> &objs, const T &identity, BINARYOP redfunc);
+
+      // // Parallel algorithms, with the same semantics in ROOT::TThreadExecutor and ROOT::TSequentialExecutor
+      template<class F>
+      void ForeachRange(F func, std::size_t begin, std::size_t end, std::size_t grainSize = 0);
+      template<class ITER>
+      void Sort(ITER first, ITER last);
+      template<class ITER, class COMP>
+      void Sort(ITER first, ITER last, COMP comp);
+      template<class ITER>
+      void StableSort(ITER first, ITER last);
+      template<class ITER, class COMP>
+      void StableSort(ITER first, ITER last, COMP comp);
+      template<class ITER, class OUTITER>
+      OUTITER InclusiveScan(ITER first, ITER last, OUTITER out);
+      template<class ITER, class OUTITER, class BINARYOP>
+      OUTITER InclusiveScan(ITER first, ITER last, OUTITER out, BINARYOP op);
+      template<class ITER, class OUTITER, class T>
+      OUTITER ExclusiveScan(ITER first, ITER last, OUTITER out, T init);
+      template<class ITER, class OUTITER, class T, class BINARYOP>
+      OUTITER ExclusiveScan(ITER first, ITER last, OUTITER out, T init, BINARYOP op);
+      template<class ITER, class PRED>
+      ITER Partition(ITER first, ITER last, PRED pred);
 
       unsigned GetPoolSize();
 
+      bool SetTaskArena(const std::string &name, UInt_t maxConcurrency = 0);
+      const std::string &GetTaskArena() const { return fArenaName; }
+      void SetTaskPriority(ROOT::Experimental::ETaskPriority priority) { fPriority = priority; }
+      ROOT::Experimental::ETaskPriority GetTaskPriority() const { return fPriority; }
+
    protected:
       template<class F, class R, class Cond = noReferenceCond<F>>
       auto Map(F func, unsigned nTimes, R redfunc, unsigned nChunks) -> std::vector<typename std::result_of<F()>::type>;
@@ -103,8 +133,11 @@ namespace ROOT {
       float  ParallelReduce(const std::vector<float> &objs, const std::function<float(float a, float b)> &redfunc);
       template<class T, class R>
       auto SeqReduce(const std::vector<T> &objs, R redfunc) -> decltype(redfunc(objs));
+      Internal::ExecutorAlgorithms::ChunkRunner_t GetChunkRunner();
 
       std::shared_ptr<ROOT::Internal::TPoolManager> fSched = nullptr;
+      std::string fArenaName; ///< The task arena the work runs in, the default one if empty
+      ROOT::Experimental::ETaskPriority fPriority = ROOT::Experimental::ETaskPriority::kNormal;
    };
 
    /************ TEMPLATE METHODS IMPLEMENTATION ******************/
@@ -445,6 +478,103 @@ namespace ROOT {
       return redfunc(objs);
    }
 
+   //////////////////////////////////////////////////////////////////////////
+   /// "Reduce" an std::vector into a single object in parallel by applying the
+   /// binary operator redfunc, which must be associative, to the elements of
+   /// chunks of the vector starting from identity, then to the chunk results, in order.
+   template<class T, class BINARYOP>
+   T TThreadExecutor::Reduce(const std::vector<T> &objs, const T &identity, BINARYOP redfunc)
+   {
+      return Internal::ExecutorAlgorithms::Reduce(GetChunkRunner(), GetPoolSize(), objs, identity, redfunc);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Execute func(first, last) on consecutive subranges of [begin, end) of
+   /// at most grainSize indices. With the default grainSize, 0, the range is
+   /// split in four subranges per thread of the pool.
+   template<class F>
+   void TThreadExecutor::ForeachRange(F func, std::size_t begin, std::size_t end, std::size_t grainSize) {
+      Internal::ExecutorAlgorithms::ForeachRange(GetChunkRunner(), 4 * GetPoolSize(), func, begin, end, grainSize);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Sort the elements of [first, last), which must be random access iterators,
+   /// in ascending order. The order of equal elements is not preserved.
+   template<class ITER>
+   void TThreadExecutor::Sort(ITER first, ITER last) {
+      Sort(first, last, std::less<typename std::iterator_traits<ITER>::value_type>());
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Sort the elements of [first, last), which must be random access iterators,
+   /// according to comp. The order of equal elements is not preserved.
+   template<class ITER, class COMP>
+   void TThreadExecutor::Sort(ITER first, ITER last, COMP comp) {
+      Internal::ExecutorAlgorithms::Sort(GetChunkRunner(), GetPoolSize(), first, last, comp, false);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Sort the elements of [first, last), which must be random access iterators,
+   /// in ascending order, preserving the order of equal elements.
+   template<class ITER>
+   void TThreadExecutor::StableSort(ITER first, ITER last) {
+      StableSort(first, last, std::less<typename std::iterator_traits<ITER>::value_type>());
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Sort the elements of [first, last), which must be random access iterators,
+   /// according to comp, preserving the order of equal elements.
+   template<class ITER, class COMP>
+   void TThreadExecutor::StableSort(ITER first, ITER last, COMP comp) {
+      Internal::ExecutorAlgorithms::Sort(GetChunkRunner(), GetPoolSize(), first, last, comp, true);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Write to out the partial sums of [first, last), the i-th output including
+   /// the i-th input. The iterators must be random access iterators, out can be first.
+   /// Returns the end of the output.
+   template<class ITER, class OUTITER>
+   OUTITER TThreadExecutor::InclusiveScan(ITER first, ITER last, OUTITER out) {
+      return InclusiveScan(first, last, out, std::plus<typename std::iterator_traits<ITER>::value_type>());
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Write to out the partial reductions with op, which must be associative,
+   /// of [first, last), the i-th output including the i-th input.
+   /// Returns the end of the output.
+   template<class ITER, class OUTITER, class BINARYOP>
+   OUTITER TThreadExecutor::InclusiveScan(ITER first, ITER last, OUTITER out, BINARYOP op) {
+      return Internal::ExecutorAlgorithms::InclusiveScan(GetChunkRunner(), GetPoolSize(), first, last, out, op);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Write to out init plus the partial sums of [first, last), the i-th output
+   /// excluding the i-th input. The iterators must be random access iterators,
+   /// out can be first. Returns the end of the output.
+   template<class ITER, class OUTITER, class T>
+   OUTITER TThreadExecutor::ExclusiveScan(ITER first, ITER last, OUTITER out, T init) {
+      return ExclusiveScan(first, last, out, init, std::plus<T>());
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Write to out the partial reductions with op, which must be associative,
+   /// of init and [first, last), the i-th output excluding the i-th input.
+   /// Returns the end of the output.
+   template<class ITER, class OUTITER, class T, class BINARYOP>
+   OUTITER TThreadExecutor::ExclusiveScan(ITER first, ITER last, OUTITER out, T init, BINARYOP op) {
+      return Internal::ExecutorAlgorithms::ExclusiveScan(GetChunkRunner(), GetPoolSize(), first, last, out, init, op);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Reorder [first, last), which must be random access iterators, so that the
+   /// elements for which pred is true precede the others, preserving the relative
+   /// order in both groups, as std::stable_partition does.
+   /// Returns the iterator to the first element for which pred is false.
+   template<class ITER, class PRED>
+   ITER TThreadExecutor::Partition(ITER first, ITER last, PRED pred) {
+      return Internal::ExecutorAlgorithms::Partition(GetChunkRunner(), GetPoolSize(), first, last, pred);
+   }
+
 } // namespace ROOT
 
 #endif   // R__USE_IMT
@@ -21,7 +21,10 @@
 #include "TError.h"
 #include "TThread.h"
 #include "ROOT/TPoolManager.hxx"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
 #include <atomic>
+#include <functional>
 
 static std::shared_ptr<ROOT::Internal::TPoolManager> &R__GetPoolManagerMT()
 {
@@ -69,6 +72,12 @@ extern "C" void ROOT_TImplicitMT_DisableImplicitMT()
    }
 };
 
+extern "C" void ROOT_TImplicitMT_ParallelFor(UInt_t n, const std::function<void(UInt_t)> &func)
+{
+   // Isolated for the same reasons as the loops of ROOT::TThreadExecutor
+   tbb::this_task_arena::isolate([&] { tbb::parallel_for(0u, n, func); });
+};
+
 extern "C" void ROOT_TImplicitMT_EnableParBranchProcessing()
 {
    ++GetParBranchProcessingCount();
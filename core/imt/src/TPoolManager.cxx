@@ -1,13 +1,25 @@
 #include "ROOT/TPoolManager.hxx"
+#include "TEnv.h"
 #include "TError.h"
 #include "TROOT.h"
 #include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
 #ifdef R__LINUX
 #include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
 #include <sys/stat.h>
 #endif
 #include "tbb/task_scheduler_init.h"
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
+#include "tbb/task_scheduler_observer.h"
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -63,9 +75,118 @@ namespace ROOT {
          return weak_sched;
       }
 
+#ifdef R__LINUX
+      // Returns the logical cores of each NUMA domain of the machine that this process may run on, for the
+      // domains that have any.
+      static std::vector<std::vector<int>> GetNUMADomainCores()
+      {
+         std::vector<std::vector<int>> domains;
+         cpu_set_t allowed;
+         CPU_ZERO(&allowed);
+         if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+            return domains;
+
+         const std::string nodesDir("/sys/devices/system/node/");
+         auto dir = opendir(nodesDir.c_str());
+         if (!dir)
+            return domains;
+         std::vector<std::string> nodes;
+         while (auto entry = readdir(dir)) {
+            const std::string name(entry->d_name);
+            if (name.compare(0, 4, "node") == 0 && name.size() > 4 && isdigit(name[4]))
+               nodes.push_back(name);
+         }
+         closedir(dir);
+         std::sort(nodes.begin(), nodes.end());
+
+         for (const auto &node : nodes) {
+            // The format of the list is e.g. "0-15,32-47"
+            std::ifstream f(nodesDir + node + "/cpulist");
+            std::string list;
+            if (!std::getline(f, list))
+               continue;
+            std::vector<int> cores;
+            std::istringstream ranges(list);
+            std::string range;
+            while (std::getline(ranges, range, ',')) {
+               const auto dash = range.find('-');
+               const int first = std::atoi(range.c_str());
+               const int last = dash == std::string::npos ? first : std::atoi(range.c_str() + dash + 1);
+               for (int core = first; core <= last && core < CPU_SETSIZE; ++core) {
+                  if (CPU_ISSET(core, &allowed))
+                     cores.push_back(core);
+               }
+            }
+            if (!cores.empty())
+               domains.emplace_back(std::move(cores));
+         }
+         return domains;
+      }
+
+      /// Pins the threads that work in a task arena to the cores of one NUMA domain, so that the memory they allocate
+      /// and first touch is local to them. The previous affinity of a thread is restored when it leaves the arena.
+      class TNUMAPinningObserver : public tbb::task_scheduler_observer {
+         cpu_set_t fCores;
+
+         static std::vector<cpu_set_t> &GetSavedAffinities()
+         {
+            thread_local std::vector<cpu_set_t> saved;
+            return saved;
+         }
+
+      public:
+         TNUMAPinningObserver(tbb::task_arena &arena, const std::vector<int> &cores) : tbb::task_scheduler_observer(arena)
+         {
+            CPU_ZERO(&fCores);
+            for (auto core : cores)
+               CPU_SET(core, &fCores);
+            observe(true);
+         }
+
+         ~TNUMAPinningObserver() { observe(false); }
+
+         void on_scheduler_entry(bool) override
+         {
+            cpu_set_t previous;
+            CPU_ZERO(&previous);
+            pthread_getaffinity_np(pthread_self(), sizeof(previous), &previous);
+            GetSavedAffinities().push_back(previous);
+            pthread_setaffinity_np(pthread_self(), sizeof(fCores), &fCores);
+         }
+
+         void on_scheduler_exit(bool) override
+         {
+            auto &saved = GetSavedAffinities();
+            if (saved.empty())
+               return;
+            pthread_setaffinity_np(pthread_self(), sizeof(saved.back()), &saved.back());
+            saved.pop_back();
+         }
+      };
+#endif
+
+      /// The named task arenas of the pool manager, created on demand and kept until the manager is destroyed.
+      struct TPoolManagerArenas {
+         mutable std::mutex fMutex;
+         std::map<std::string, std::unique_ptr<tbb::task_arena>> fArenas;
+         std::vector<std::string> fNUMAArenas; ///< The names of the arenas of the NUMA domains, if any
+#ifdef R__LINUX
+         // Destroyed before the arenas they observe
+         std::vector<std::unique_ptr<TNUMAPinningObserver>> fObservers;
+#endif
+
+         tbb::task_arena *Find(const std::string &name) const
+         {
+            std::lock_guard<std::mutex> lock(fMutex);
+            auto it = fArenas.find(name);
+            return it == fArenas.end() ? nullptr : it->second.get();
+         }
+      };
+
       UInt_t TPoolManager::fgPoolSize = 0;
 
-      TPoolManager::TPoolManager(UInt_t nThreads): fSched(new tbb::task_scheduler_init(tbb::task_scheduler_init::deferred))
+      TPoolManager::TPoolManager(UInt_t nThreads): fSched(new tbb::task_scheduler_init(tbb::task_scheduler_init::deferred)),
+                                                   fArenas(new TPoolManagerArenas())
       {
          //Is it there another instance of the tbb scheduler running?
          if (fSched->is_active()) {
@@ -75,10 +196,14 @@ namespace ROOT {
          nThreads = nThreads != 0 ? nThreads : NLogicalCores();
          fSched ->initialize(nThreads);
          fgPoolSize = nThreads;
+         if (gEnv->GetValue("IMT.NUMAPinning", 0))
+            CreateNUMAArenas(nThreads);
       };
 
       TPoolManager::~TPoolManager()
       {
+         // The arenas must not outlive the scheduler they take their threads from.
+         fArenas.reset();
          //Only terminate the tbb scheduler if there was not another instance already
          // running when the constructor was called.
          if (mustDelete) {
@@ -87,6 +212,128 @@ namespace ROOT {
          }
       }
 
+      ////////////////////////////////////////////////////////////////////////////////
+      /// Create the task arena `name`, in which at most maxConcurrency threads execute work at the same time, out of
+      /// which reservedForMasters are left to the threads that submit the work (see Execute()).
+      /// If maxConcurrency is 0, the arena can use the whole pool.
+      /// Returns false, and leaves the arena unchanged, if an arena with this name but another concurrency exists.
+      bool TPoolManager::CreateArena(const std::string &name, UInt_t maxConcurrency, UInt_t reservedForMasters)
+      {
+         if (name.empty()) {
+            ::Error("TPoolManager::CreateArena", "The default task arena cannot be created by name");
+            return false;
+         }
+         if (maxConcurrency == 0 || maxConcurrency > fgPoolSize)
+            maxConcurrency = fgPoolSize;
+         if (reservedForMasters > maxConcurrency)
+            reservedForMasters = maxConcurrency;
+
+         std::lock_guard<std::mutex> lock(fArenas->fMutex);
+         auto &arena = fArenas->fArenas[name];
+         if (arena) {
+            if (arena->max_concurrency() != static_cast<int>(maxConcurrency)) {
+               ::Warning("TPoolManager::CreateArena", "The task arena %s already exists with a concurrency of %d",
+                         name.c_str(), arena->max_concurrency());
+               return false;
+            }
+            return true;
+         }
+         arena.reset(new tbb::task_arena(maxConcurrency, reservedForMasters));
+         arena->initialize();
+         return true;
+      }
+
+      ////////////////////////////////////////////////////////////////////////////////
+      /// Create one task arena per NUMA domain, named NUMA0, NUMA1, ..., with a share of the nThreads threads of the
+      /// pool proportional to the number of cores of the domain. Nothing is done on machines with a single domain.
+      void TPoolManager::CreateNUMAArenas(UInt_t nThreads)
+      {
+#ifdef R__LINUX
+         const auto domains = GetNUMADomainCores();
+         if (domains.size() < 2)
+            return;
+         std::size_t nCores = 0;
+         for (const auto &cores : domains)
+            nCores += cores.size();
+
+         for (std::size_t i = 0; i < domains.size(); ++i) {
+            const auto name = "NUMA" + std::to_string(i);
+            const auto share = std::max<UInt_t>(1u, std::lround(double(nThreads) * domains[i].size() / nCores));
+            if (!CreateArena(name, share))
+               continue;
+            std::lock_guard<std::mutex> lock(fArenas->fMutex);
+            fArenas->fObservers.emplace_back(new TNUMAPinningObserver(*fArenas->fArenas[name], domains[i]));
+            fArenas->fNUMAArenas.push_back(name);
+         }
+#else
+         (void)nThreads;
+         ::Warning("TPoolManager::CreateNUMAArenas", "NUMA pinning of the threads is only supported on Linux");
+#endif
+      }
+
+      ////////////////////////////////////////////////////////////////////////////////
+      /// Returns the number of NUMA domains that have their own task arena, 0 if the threads are not pinned.
+      UInt_t TPoolManager::GetNUMADomains() const
+      {
+         std::lock_guard<std::mutex> lock(fArenas->fMutex);
+         return fArenas->fNUMAArenas.size();
+      }
+
+      ////////////////////////////////////////////////////////////////////////////////
+      /// Returns the name of the task arena of the NUMA domain index modulo the number of domains, e.g. to spread the
+      /// input files of a job over the domains, or an empty string (the default arena) if the threads are not pinned.
+      std::string TPoolManager::GetNUMAArena(UInt_t index) const
+      {
+         std::lock_guard<std::mutex> lock(fArenas->fMutex);
+         if (fArenas->fNUMAArenas.empty())
+            return "";
+         return fArenas->fNUMAArenas[index % fArenas->fNUMAArenas.size()];
+      }
+
+      ////////////////////////////////////////////////////////////////////////////////
+      /// Returns whether the task arena `name` has been created.
+      bool TPoolManager::HasArena(const std::string &name) const
+      {
+         return fArenas->Find(name) != nullptr;
+      }
+
+      ////////////////////////////////////////////////////////////////////////////////
+      /// Execute the operation in the task arena arenaName, or in the current one if arenaName is empty, and wait
+      /// for its completion. The parallel work spawned by the operation, e.g. by a tbb::parallel_for, is scheduled
+      /// with the given priority with respect to the other work of the arena.
+      void TPoolManager::Execute(const std::string &arenaName, ROOT::Experimental::ETaskPriority priority,
+                                 const std::function<void(void)> &operation)
+      {
+         auto run = [&]() {
+#if __TBB_TASK_PRIORITY
+            if (priority != ROOT::Experimental::ETaskPriority::kNormal) {
+               // The work of the operation inherits the priority of the task group context it runs in
+               const auto tbbPriority =
+                  priority == ROOT::Experimental::ETaskPriority::kHigh ? tbb::priority_high : tbb::priority_low;
+               tbb::task_group group;
+               group.run_and_wait([&]() {
+                  tbb::task::self().set_group_priority(tbbPriority);
+                  operation();
+               });
+               return;
+            }
+#endif
+            operation();
+         };
+
+         if (arenaName.empty()) {
+            run();
+            return;
+         }
+         auto arena = fArenas->Find(arenaName);
+         if (!arena) {
+            ::Warning("TPoolManager::Execute", "No task arena %s: running in the current arena", arenaName.c_str());
+            run();
+            return;
+         }
+         arena->execute(run);
+      }
+
       //Number of threads the PoolManager has been initialized with.
       UInt_t TPoolManager::GetPoolSize()
       {
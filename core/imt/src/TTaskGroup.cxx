@@ -15,10 +15,13 @@
 
 #ifdef R__USE_IMT
 #include "TROOT.h"
+#include "ROOT/TPoolManager.hxx"
 #include "tbb/task_group.h"
 #include "tbb/task_arena.h"
 #endif
 
+#include <stdexcept>
+
 #include <type_traits>
 
 /**
@@ -29,6 +32,9 @@
 A TTaskGroup represents concurrent execution of a group of tasks.
 Tasks may be dynamically added to the group as it is executing.
 Nesting TTaskGroup instances may result in a runtime overhead.
+
+The tasks of a group can be given a priority, so that idle threads take them before (or after) the other work of the
+pool, and can run in one of the named task arenas of the pool (see ROOT::Internal::TPoolManager::CreateArena()).
 */
 
 namespace ROOT {
@@ -62,6 +68,22 @@ TTaskGroup::TTaskGroup()
 #endif
 }
 
+/////////////////////////////////////////////////////////////////////////////
+/// Create a group whose tasks are scheduled with the given priority, in the task
+/// arena arenaName, which must have been created beforehand, or in the default
+/// arena if arenaName is empty.
+TTaskGroup::TTaskGroup(ETaskPriority priority, const std::string &arenaName)
+   : TTaskGroup()
+{
+   fPriority = priority;
+   fArenaName = arenaName;
+#ifdef R__USE_IMT
+   if (!fArenaName.empty() && !ROOT::Internal::GetPoolManager()->HasArena(fArenaName)) {
+      throw std::runtime_error("There is no task arena " + fArenaName + ". Cannot instantiate a TTaskGroup.");
+   }
+#endif
+}
+
 TTaskGroup::TTaskGroup(TTaskGroup &&other)
 {
    *this = std::move(other);
@@ -72,6 +94,8 @@ TTaskGroup &TTaskGroup::operator=(TTaskGroup &&other)
    fTaskContainer = other.fTaskContainer;
    other.fTaskContainer = nullptr;
    fCanRun.store(other.fCanRun);
+   fPriority = other.fPriority;
+   fArenaName = std::move(other.fArenaName);
    return *this;
 }
 
@@ -110,7 +134,15 @@ void TTaskGroup::Run(const std::function<void(void)> &closure)
    while (!fCanRun)
       /* empty */;
 
-   CastToTG(fTaskContainer)->run(closure);
+   if (fArenaName.empty() && fPriority == ETaskPriority::kNormal) {
+      CastToTG(fTaskContainer)->run(closure);
+      return;
+   }
+   auto poolManager = ROOT::Internal::GetPoolManager();
+   auto priority = fPriority;
+   auto task = [poolManager, priority, closure]() { poolManager->Execute("", priority, closure); };
+   // The tasks of a group must be spawned from within the arena they should run in
+   poolManager->Execute(fArenaName, ETaskPriority::kNormal, [&]() { CastToTG(fTaskContainer)->run(task); });
 #else
    closure();
 #endif
@@ -123,7 +155,12 @@ void TTaskGroup::Wait()
 {
 #ifdef R__USE_IMT
    fCanRun = false;
-   CastToTG(fTaskContainer)->wait();
+   if (fArenaName.empty()) {
+      CastToTG(fTaskContainer)->wait();
+   } else {
+      ROOT::Internal::GetPoolManager()->Execute(fArenaName, ETaskPriority::kNormal,
+                                                [&]() { CastToTG(fTaskContainer)->wait(); });
+   }
    fCanRun = true;
 #endif
 }
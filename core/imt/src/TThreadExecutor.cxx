@@ -78,6 +78,17 @@
 /// root[] ROOT::TThreadExecutor pool; auto hist = pool.MapReduce(CreateAndFillHists, 10, PoolUtils::ReduceObjects);
 /// ~~~
 ///
+/// ### Task arenas and priorities
+/// By default the work of all the executors, of the implicit multi-threading of ROOT and of the TTaskGroup
+/// instances shares the whole pool of threads. SetTaskArena() makes an executor run its work in a named task arena of
+/// the pool, which limits the number of threads that work at the same time, and SetTaskPriority() makes idle threads
+/// take its work before (ETaskPriority::kHigh) or after (ETaskPriority::kLow) the work of normal priority.
+///
+/// ~~~{.cpp}
+/// root[] ROOT::TThreadExecutor pool; pool.SetTaskArena("analysis", 4);
+/// root[] pool.SetTaskPriority(ROOT::Experimental::ETaskPriority::kLow); auto hists = pool.Map(CreateHisto, 100);
+/// ~~~
+///
 //////////////////////////////////////////////////////////////////////////
 
 /*
@@ -151,21 +162,53 @@ namespace ROOT {
       fSched = ROOT::Internal::GetPoolManager(nThreads);
    }
 
+   //////////////////////////////////////////////////////////////////////////
+   /// Run the work of this executor in the task arena `name` of the pool, creating it with at most maxConcurrency
+   /// working threads if it does not exist yet (0 stands for the size of the pool). An empty name selects the
+   /// default arena, shared with the rest of ROOT. If maxConcurrency is 0, an existing arena is used as it is,
+   /// e.g. the arena of a NUMA domain (see ROOT::Internal::TPoolManager::GetNUMAArena()).
+   /// Returns false, and leaves the arena of the executor unchanged, if the arena exists with another concurrency.
+   bool TThreadExecutor::SetTaskArena(const std::string &name, UInt_t maxConcurrency)
+   {
+      const bool useExisting = maxConcurrency == 0 && fSched->HasArena(name);
+      if (!name.empty() && !useExisting && !fSched->CreateArena(name, maxConcurrency))
+         return false;
+      fArenaName = name;
+      return true;
+   }
+
    void TThreadExecutor::ParallelFor(unsigned int start, unsigned int end, unsigned step, const std::function<void(unsigned int i)> &f)
    {
-      tbb::this_task_arena::isolate([&]{
-         tbb::parallel_for(start, end, step, f);
+      fSched->Execute(fArenaName, fPriority, [&]{
+         tbb::this_task_arena::isolate([&]{
+            tbb::parallel_for(start, end, step, f);
+         });
       });
    }
 
    double TThreadExecutor::ParallelReduce(const std::vector<double> &objs, const std::function<double(double a, double b)> &redfunc)
    {
-      return ROOT::Internal::ParallelReduceHelper<double>(objs, redfunc);
+      double result{};
+      fSched->Execute(fArenaName, fPriority,
+                      [&] { result = ROOT::Internal::ParallelReduceHelper<double>(objs, redfunc); });
+      return result;
    }
 
    float TThreadExecutor::ParallelReduce(const std::vector<float> &objs, const std::function<float(float a, float b)> &redfunc)
    {
-      return ROOT::Internal::ParallelReduceHelper<float>(objs, redfunc);
+      float result{};
+      fSched->Execute(fArenaName, fPriority,
+                      [&] { result = ROOT::Internal::ParallelReduceHelper<float>(objs, redfunc); });
+      return result;
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// Returns the function the parallel algorithms run their chunks with.
+   Internal::ExecutorAlgorithms::ChunkRunner_t TThreadExecutor::GetChunkRunner()
+   {
+      return [this](unsigned nChunks, const std::function<void(unsigned)> &func) {
+         ParallelFor(0U, nChunks, 1, func);
+      };
    }
 
    unsigned TThreadExecutor::GetPoolSize(){
@@ -0,0 +1,113 @@
+#include "ROOT/TSequentialExecutor.hxx"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+std::vector<int> MakeValues(std::size_t n)
+{
+   std::mt19937 rng(42);
+   std::vector<int> values(n);
+   for (auto &v : values)
+      v = rng() % 1000;
+   return values;
+}
+
+bool IsMultipleOf3(int v)
+{
+   return v % 3 == 0;
+}
+
+/// Check that the executor gives the results of the standard algorithms
+template <class EXECUTOR>
+void CheckAlgorithms(EXECUTOR &executor)
+{
+   for (std::size_t n : {0u, 1u, 1000u, 100000u}) {
+      const auto values = MakeValues(n);
+
+      auto sorted = values;
+      executor.Sort(sorted.begin(), sorted.end());
+      auto expected = values;
+      std::sort(expected.begin(), expected.end());
+      EXPECT_EQ(sorted, expected);
+
+      std::vector<std::pair<int, std::size_t>> pairs;
+      for (std::size_t i = 0; i < n; ++i)
+         pairs.emplace_back(values[i] % 10, i);
+      auto byFirst = [](const std::pair<int, std::size_t> &a, const std::pair<int, std::size_t> &b) {
+         return a.first < b.first;
+      };
+      auto stableSorted = pairs;
+      executor.StableSort(stableSorted.begin(), stableSorted.end(), byFirst);
+      std::stable_sort(pairs.begin(), pairs.end(), byFirst);
+      EXPECT_EQ(stableSorted, pairs);
+
+      std::vector<long> scan(n), expectedScan(n);
+      executor.InclusiveScan(values.begin(), values.end(), scan.begin(), std::plus<long>());
+      long sum = 0;
+      for (std::size_t i = 0; i < n; ++i)
+         expectedScan[i] = sum += values[i];
+      EXPECT_EQ(scan, expectedScan);
+
+      executor.ExclusiveScan(values.begin(), values.end(), scan.begin(), 7l);
+      sum = 7;
+      for (std::size_t i = 0; i < n; ++i) {
+         expectedScan[i] = sum;
+         sum += values[i];
+      }
+      EXPECT_EQ(scan, expectedScan);
+
+      auto partitioned = values;
+      auto mid = executor.Partition(partitioned.begin(), partitioned.end(), IsMultipleOf3);
+      expected = values;
+      auto expectedMid = std::stable_partition(expected.begin(), expected.end(), IsMultipleOf3);
+      EXPECT_EQ(partitioned, expected);
+      EXPECT_EQ(mid - partitioned.begin(), expectedMid - expected.begin());
+
+      const std::vector<long> longs(values.begin(), values.end());
+      EXPECT_EQ(executor.Reduce(longs, 0l, std::plus<long>()), std::accumulate(longs.begin(), longs.end(), 0l));
+
+      // the subranges cover the range exactly once
+      std::mutex mutex;
+      std::vector<std::pair<std::size_t, std::size_t>> ranges;
+      executor.ForeachRange(
+         [&](std::size_t first, std::size_t last) {
+            std::lock_guard<std::mutex> lock(mutex);
+            ranges.emplace_back(first, last);
+         },
+         5, 5 + n, 300);
+      std::sort(ranges.begin(), ranges.end());
+      std::size_t next = 5;
+      for (const auto &range : ranges) {
+         EXPECT_EQ(range.first, next);
+         EXPECT_LE(range.second - range.first, 300u);
+         next = range.second;
+      }
+      EXPECT_EQ(next, 5 + n);
+   }
+}
+} // anonymous namespace
+
+TEST(TExecutorAlgorithms, Sequential)
+{
+   ROOT::TSequentialExecutor executor;
+   CheckAlgorithms(executor);
+}
+
+TEST(TExecutorAlgorithms, Threaded)
+{
+   ROOT::TThreadExecutor executor(4);
+   CheckAlgorithms(executor);
+}
+
+#endif
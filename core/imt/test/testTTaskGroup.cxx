@@ -4,6 +4,12 @@
 
 #ifdef R__USE_IMT
 #include "ROOT/TTaskGroup.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 using namespace ROOT::Experimental;
 
@@ -27,4 +33,40 @@ TEST(TTaskGroup, NestedExecution)
    EXPECT_EQ(Fibonacci(7), 13);
 }
 
+TEST(TTaskGroup, PriorityAndArena)
+{
+   ROOT::EnableImplicitMT(4);
+   ROOT::TThreadExecutor pool;
+   EXPECT_TRUE(pool.SetTaskArena("testArena", 2));
+   // an arena cannot be redefined with another concurrency
+   EXPECT_FALSE(pool.SetTaskArena("testArena", 3));
+   EXPECT_EQ(pool.GetTaskArena(), "testArena");
+
+   // the work of the arena never runs on more than its two threads
+   std::atomic<int> running(0), maxRunning(0);
+   auto work = [&](int i) {
+      auto now = ++running;
+      auto prev = maxRunning.load();
+      while (now > prev && !maxRunning.compare_exchange_weak(prev, now))
+         /* empty */;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      --running;
+      return i;
+   };
+   pool.SetTaskPriority(ETaskPriority::kLow);
+   auto res = pool.Map(work, ROOT::TSeq<int>(100));
+   EXPECT_EQ(std::accumulate(res.begin(), res.end(), 0), 4950);
+   EXPECT_LE(maxRunning.load(), 2);
+   EXPECT_EQ(pool.Reduce(std::vector<double>{1., 2., 3.}, std::plus<double>{}), 6.);
+
+   std::atomic<int> sum(0);
+   TTaskGroup tg(ETaskPriority::kHigh, "testArena");
+   for (int i = 0; i < 10; ++i)
+      tg.Run([&sum, i] { sum += i; });
+   tg.Wait();
+   EXPECT_EQ(sum.load(), 45);
+
+   EXPECT_THROW(TTaskGroup(ETaskPriority::kNormal, "noSuchArena"), std::runtime_error);
+}
+
 #endif
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <memory>
 #include <lz4.h>
 #include <lz4hc.h>
 #include <xxhash.h>
@@ -30,6 +31,20 @@ static const int kChecksumOffset = 2 + 1 + 3 + 3;
 static const int kChecksumSize = sizeof(XXH64_canonical_t);
 static const int kHeaderSize = kChecksumOffset + kChecksumSize;
 
+// The compression state is re-initialized by each compression, but it is large (several hundreds of kB for the
+// high compression mode, which otherwise allocates it on each call): each thread reuses its own.
+static void *GetLZ4State()
+{
+   thread_local std::unique_ptr<char[]> state{new char[LZ4_sizeofState()]};
+   return state.get();
+}
+
+static void *GetLZ4HCState()
+{
+   thread_local std::unique_ptr<char[]> state{new char[LZ4_sizeofStateHC()]};
+   return state.get();
+}
+
 void R__zipLZ4(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
 {
    int LZ4_version = LZ4_versionNumber();
@@ -52,9 +67,11 @@ void R__zipLZ4(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, in
       cxlevel = 9;
    }
    if (cxlevel >= 4) {
-      returnStatus = LZ4_compress_HC(src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize, cxlevel);
+      returnStatus =
+         LZ4_compress_HC_extStateHC(GetLZ4HCState(), src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize, cxlevel);
    } else {
-      returnStatus = LZ4_compress_default(src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize);
+      returnStatus =
+         LZ4_compress_fast_extState(GetLZ4State(), src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize, 1);
    }
 
    if (R__unlikely(returnStatus == 0)) { /* LZ4 compression failed */
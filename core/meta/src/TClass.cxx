@@ -68,6 +68,7 @@ In order to access the name of a class within the ROOT type system, the method T
 #include "TROOT.h"
 #include "TRealData.h"
 #include "TCheckHashRecursiveRemoveConsistency.h" // Private header
+#include "TClassLookupCache.h" // Private header
 #include "TStreamer.h"
 #include "TStreamerElement.h"
 #include "TVirtualStreamerInfo.h"
@@ -471,6 +472,35 @@ DeclIdMap_t *TClass::GetDeclIdMap() {
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// The loaded classes returned by TClass::GetClass(const char*), by name.
+
+static ROOT::Internal::TClassLookupCache<ROOT::Internal::TClassNameKey> &GetClassByNameCache()
+{
+   // Never deleted: GetClass may still be called during the tear down.
+   static auto *gCache = new ROOT::Internal::TClassLookupCache<ROOT::Internal::TClassNameKey>;
+   return *gCache;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The loaded classes returned by TClass::GetClass(const std::type_info&),
+/// by address of the std::type_info.
+
+static ROOT::Internal::TClassLookupCache<ROOT::Internal::TClassTypeInfoKey> &GetClassByTypeInfoCache()
+{
+   static auto *gCache = new ROOT::Internal::TClassLookupCache<ROOT::Internal::TClassTypeInfoKey>;
+   return *gCache;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Forget the classes returned by GetClass, when one of them goes away.
+
+static void ClearGetClassCaches()
+{
+   GetClassByNameCache().Clear();
+   GetClassByTypeInfoCache().Clear();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// static: Add a class to the list and map of classes.
 
@@ -505,6 +535,7 @@ void TClass::RemoveClass(TClass *oldcl)
    if (!oldcl) return;
 
    R__LOCKGUARD(gInterpreterMutex);
+   ClearGetClassCaches();
    gROOT->GetListOfClasses()->Remove(oldcl);
    if (oldcl->GetTypeInfo()) {
       GetIdMap()->Remove(oldcl->GetTypeInfo()->name());
@@ -2928,12 +2959,25 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent)
    if (strncmp(name,"class ",6)==0) name += 6;
    if (strncmp(name,"struct ",7)==0) name += 7;
 
+   // Lock-free path for the classes already returned by a previous call.
+   TClass *cl = GetClassByNameCache().Find(name);
+   if (cl)
+      return cl;
+
    if (!gROOT->GetListOfClasses())  return 0;
 
-   // FindObject will take the read lock before actually getting the
-   // TClass pointer so we will need not get a partially initialized
-   // object.
-   TClass *cl = (TClass*)gROOT->GetListOfClasses()->FindObject(name);
+   {
+      // FindObject will take the read lock before actually getting the
+      // TClass pointer so we will need not get a partially initialized
+      // object. Keep holding it while caching the class, so that it
+      // cannot be removed (and the cache cleared) in between.
+      R__READ_LOCKGUARD(ROOT::gCoreMutex);
+      cl = (TClass*)gROOT->GetListOfClasses()->FindObject(name);
+      if (cl && cl->IsLoaded() && !cl->TestBit(kUnloading)) {
+         GetClassByNameCache().Insert(name, cl);
+         return cl;
+      }
+   }
 
    // Early return to release the lock without having to execute the
    // long-ish normalization.
@@ -2941,12 +2985,20 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent)
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
+   // Cache the loaded class the name resolves to, so that the next lookups
+   // take the lock-free path. The write lock is held until we return.
+   auto cacheLoaded = [name](TClass *loaded) {
+      if (loaded && loaded->IsLoaded() && !loaded->TestBit(kUnloading))
+         GetClassByNameCache().Insert(name, loaded);
+      return loaded;
+   };
+
    // Now that we got the write lock, another thread may have constructed the
    // TClass while we were waiting, so we need to do the checks again.
 
    cl = (TClass*)gROOT->GetListOfClasses()->FindObject(name);
    if (cl) {
-      if (cl->IsLoaded() || cl->TestBit(kUnloading)) return cl;
+      if (cl->IsLoaded() || cl->TestBit(kUnloading)) return cacheLoaded(cl);
 
       // We could speed-up some of the search by adding (the equivalent of)
       //
@@ -2979,7 +3031,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent)
       TClass *loadedcl = (dict)();
       if (loadedcl) {
          loadedcl->PostLoadCheck();
-         return loadedcl;
+         return cacheLoaded(loadedcl);
       }
 
       // We should really not fall through to here, but if we do, let's just
@@ -2999,7 +3051,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent)
          cl = (TClass*)gROOT->GetListOfClasses()->FindObject(normalizedName.c_str());
 
          if (cl) {
-            if (cl->IsLoaded() || cl->TestBit(kUnloading)) return cl;
+            if (cl->IsLoaded() || cl->TestBit(kUnloading)) return cacheLoaded(cl);
 
             //we may pass here in case of a dummy class created by TVirtualStreamerInfo
             load = kTRUE;
@@ -3049,11 +3101,11 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent)
          }
       }
    }
-   if (loadedcl) return loadedcl;
+   if (loadedcl) return cacheLoaded(loadedcl);
 
    // See if the TClassGenerator can produce the TClass we need.
    loadedcl = LoadClassCustom(normalizedName.c_str(),silent);
-   if (loadedcl) return loadedcl;
+   if (loadedcl) return cacheLoaded(loadedcl);
 
    // We have not been able to find a loaded TClass, return the Emulated
    // TClass if we have one.
@@ -3102,7 +3154,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent)
          gInterpreter->MethodInfo_Delete(method);
          gInterpreter->ClassInfo_Delete(ci);
 
-         return res;
+         return cacheLoaded(res);
       } else if (cci) {
          // Get the normalized name based on the decl (currently the only way
          // to get the part to add or drop the default arguments as requested by the user)
@@ -3123,7 +3175,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent)
             // two different space layout.  To avoid an infinite recursion, we also
             // add the test on (altname != name)
 
-            return GetClass(altname, load);
+            return cacheLoaded(GetClass(altname, load));
          }
 
          TClass *ncl = gInterpreter->GenerateTClass(normalizedName.c_str(), /* emulation = */ kFALSE, silent);
@@ -3141,25 +3193,42 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent)
 
 TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /* silent */)
 {
+   // Lock-free path for the classes already returned by a previous call.
+   TClass *cl = GetClassByTypeInfoCache().Find(&typeinfo);
+   if (cl)
+      return cl;
+
    if (!gROOT->GetListOfClasses())
       return 0;
 
    //protect access to TROOT::GetIdMap
    R__READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   TClass* cl = GetIdMap()->Find(typeinfo.name());
+   cl = GetIdMap()->Find(typeinfo.name());
 
-   if (cl && cl->IsLoaded()) return cl;
+   if (cl && cl->IsLoaded()) {
+      if (!cl->TestBit(kUnloading))
+         GetClassByTypeInfoCache().Insert(&typeinfo, cl);
+      return cl;
+   }
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
+   // Cache the loaded class the type resolves to, so that the next lookups
+   // take the lock-free path. The write lock is held until we return.
+   auto cacheLoaded = [&typeinfo](TClass *loaded) {
+      if (loaded && loaded->IsLoaded() && !loaded->TestBit(kUnloading))
+         GetClassByTypeInfoCache().Insert(&typeinfo, loaded);
+      return loaded;
+   };
+
    // Now that we got the write lock, another thread may have constructed the
    // TClass while we were waiting, so we need to do the checks again.
 
    cl = GetIdMap()->Find(typeinfo.name());
 
    if (cl) {
-      if (cl->IsLoaded()) return cl;
+      if (cl->IsLoaded()) return cacheLoaded(cl);
       //we may pass here in case of a dummy class created by TVirtualStreamerInfo
       load = kTRUE;
    } else {
@@ -3181,7 +3250,7 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    if (dict) {
       cl = (dict)();
       if (cl) cl->PostLoadCheck();
-      return cl;
+      return cacheLoaded(cl);
    }
    if (cl) return cl;
 
@@ -3191,7 +3260,7 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
       cl = gen->GetClass(typeinfo,load);
       if (cl) {
          cl->PostLoadCheck();
-         return cl;
+         return cacheLoaded(cl);
       }
    }
 
@@ -3214,7 +3283,7 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    // classes
    cl = gInterpreter->GetClass(typeinfo, load);
 
-   return cl; // Can be zero.
+   return cacheLoaded(cl); // Can be zero.
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -6077,6 +6146,7 @@ void TClass::SetUnloaded()
       return;
    }
    SetBit(kUnloading);
+   ClearGetClassCaches();
 
    //R__ASSERT(fState == kLoaded);
    if (fState != kLoaded) {
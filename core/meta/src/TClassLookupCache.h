@@ -0,0 +1,173 @@
+// @(#)root/meta:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TClassLookupCache
+#define ROOT_TClassLookupCache
+
+#include "TString.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+class TClass;
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TClassLookupCache                                                    //
+//                                                                      //
+// Read-mostly hash table caching the loaded TClass found for a key,    //
+// so that TClass::GetClass can return it without taking any lock.      //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+namespace ROOT {
+namespace Internal {
+
+/// Keys of a TClassLookupCache looking up classes by exact spelling of their name
+struct TClassNameKey {
+   using Stored_t = std::string;
+   using Lookup_t = const char *;
+   static UInt_t Hash(Lookup_t key) { return TString::Hash(key, strlen(key)); }
+   static bool Equal(const Stored_t &stored, Lookup_t key) { return stored == key; }
+};
+
+/// Keys of a TClassLookupCache looking up classes by std::type_info. The
+/// address of the object is used: the same type seen from two libraries may
+/// have two std::type_info objects, which then simply get an entry each.
+struct TClassTypeInfoKey {
+   using Stored_t = const std::type_info *;
+   using Lookup_t = const std::type_info *;
+   static UInt_t Hash(Lookup_t key) { return TString::Hash(&key, sizeof(key)); }
+   static bool Equal(Stored_t stored, Lookup_t key) { return stored == key; }
+};
+
+template <class KEY>
+class TClassLookupCache {
+   using Lookup_t = typename KEY::Lookup_t;
+
+   /// A key and the TClass it resolves to. Entries are never deleted before
+   /// the cache, only their class is reset, so readers can always dereference them.
+   struct TEntry {
+      const typename KEY::Stored_t fKey;
+      const UInt_t fHash;
+      std::atomic<TClass *> fClass;
+
+      TEntry(Lookup_t key, UInt_t hash, TClass *cl) : fKey(key), fHash(hash), fClass(cl) {}
+   };
+
+   /// Open addressing table of entries, with linear probing. A table is
+   /// never modified except to fill an empty slot: when it is half full the
+   /// entries are inserted in a new table twice as large, which replaces it.
+   struct TTable {
+      const std::size_t fMask;
+      std::unique_ptr<std::atomic<TEntry *>[]> fSlots;
+
+      explicit TTable(std::size_t size) : fMask(size - 1), fSlots(new std::atomic<TEntry *>[size])
+      {
+         for (std::size_t i = 0; i < size; ++i)
+            fSlots[i].store(nullptr, std::memory_order_relaxed);
+      }
+
+      std::size_t GetSize() const { return fMask + 1; }
+
+      /// Put an entry in the first empty slot of its probe sequence. Only called by the writer.
+      void Insert(TEntry *entry)
+      {
+         std::size_t i = entry->fHash & fMask;
+         while (fSlots[i].load(std::memory_order_relaxed))
+            i = (i + 1) & fMask;
+         fSlots[i].store(entry, std::memory_order_release);
+      }
+   };
+
+   /// Beyond this number of keys, GetClass is called with too many different
+   /// spellings for a cache to pay off: further keys are not cached.
+   static constexpr std::size_t kMaxEntries = 1 << 16;
+
+   std::atomic<TTable *> fTable;                 ///< The table used by the readers
+   std::atomic<std::size_t> fNEntries;           ///< Number of entries in the table
+   std::mutex fWriteMutex;                       ///< Serializes the writers, never taken by the readers
+   std::vector<std::unique_ptr<TEntry>> fEntries; ///< Owns the entries
+   std::vector<std::unique_ptr<TTable>> fTables; ///< Owns the current table and the replaced ones, still read by late readers
+
+public:
+   TClassLookupCache() : fNEntries(0)
+   {
+      fTables.emplace_back(new TTable(256));
+      fTable.store(fTables.back().get(), std::memory_order_release);
+   }
+
+   TClassLookupCache(const TClassLookupCache &) = delete;
+   TClassLookupCache &operator=(const TClassLookupCache &) = delete;
+
+   /// Return the class cached for key, or nullptr. This never blocks.
+   TClass *Find(Lookup_t key) const
+   {
+      const UInt_t hash = KEY::Hash(key);
+      const TTable *table = fTable.load(std::memory_order_acquire);
+      for (std::size_t i = hash & table->fMask;; i = (i + 1) & table->fMask) {
+         const TEntry *entry = table->fSlots[i].load(std::memory_order_acquire);
+         if (!entry)
+            return nullptr;
+         if (entry->fHash == hash && KEY::Equal(entry->fKey, key))
+            return entry->fClass.load(std::memory_order_acquire);
+      }
+   }
+
+   /// Cache cl for key. cl must be a loaded class.
+   void Insert(Lookup_t key, TClass *cl)
+   {
+      if (fNEntries.load(std::memory_order_relaxed) >= kMaxEntries)
+         return;
+      const UInt_t hash = KEY::Hash(key);
+      std::lock_guard<std::mutex> lock(fWriteMutex);
+      TTable *table = fTable.load(std::memory_order_relaxed);
+      for (std::size_t i = hash & table->fMask;; i = (i + 1) & table->fMask) {
+         TEntry *entry = table->fSlots[i].load(std::memory_order_relaxed);
+         if (!entry)
+            break;
+         if (entry->fHash == hash && KEY::Equal(entry->fKey, key)) {
+            entry->fClass.store(cl, std::memory_order_release);
+            return;
+         }
+      }
+      if (2 * (fEntries.size() + 1) > table->GetSize()) {
+         // The entries are shared by the two tables: a reader of the old
+         // table still finds the classes stored from now on.
+         fTables.emplace_back(new TTable(2 * table->GetSize()));
+         table = fTables.back().get();
+         for (auto &entry : fEntries)
+            table->Insert(entry.get());
+         fTable.store(table, std::memory_order_release);
+      }
+      fEntries.emplace_back(new TEntry(key, hash, cl));
+      table->Insert(fEntries.back().get());
+      fNEntries.store(fEntries.size(), std::memory_order_relaxed);
+   }
+
+   /// Forget all the cached classes, e.g. because one of them is deleted or unloaded.
+   /// The keys stay in the table to be reused by later insertions.
+   void Clear()
+   {
+      std::lock_guard<std::mutex> lock(fWriteMutex);
+      for (auto &entry : fEntries)
+         entry->fClass.store(nullptr, std::memory_order_release);
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -1,9 +1,14 @@
 #include "TClass.h"
 #include "THashTable.h"
 #include "TInterpreter.h"
+#include "TNamed.h"
 
 #include "gtest/gtest.h"
 
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
 TEST(TClass, DictCheck)
 {
    gInterpreter->ProcessLine(".L stlDictCheck.h+");
@@ -22,3 +27,70 @@ TEST(TClass, DictCheck)
 
    EXPECT_STREQ(errMsg.c_str(), "Missing dictionary for C, ") << errMsg;
 }
+
+TEST(TClass, GetClassCached)
+{
+   // the first calls go through the lists of classes, the next ones through the cache
+   for (int i = 0; i < 2; ++i) {
+      EXPECT_EQ(TClass::GetClass("TNamed"), TNamed::Class());
+      EXPECT_EQ(TClass::GetClass("class TNamed"), TNamed::Class());
+      EXPECT_EQ(TClass::GetClass(typeid(TNamed)), TNamed::Class());
+      EXPECT_EQ(TClass::GetClass("NotAClassName"), nullptr);
+   }
+
+   std::vector<std::thread> threads;
+   std::vector<int> nMismatches(8, 0);
+   for (auto t = 0u; t < nMismatches.size(); ++t) {
+      threads.emplace_back([t, &nMismatches]() {
+         for (int i = 0; i < 1000; ++i) {
+            if (TClass::GetClass("TNamed") != TNamed::Class() ||
+                TClass::GetClass(typeid(TNamed)) != TNamed::Class())
+               ++nMismatches[t];
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   for (auto n : nMismatches)
+      EXPECT_EQ(n, 0);
+}
+
+struct TestGetClassCacheStale {
+   int fValue;
+};
+
+TEST(TClass, GetClassCacheRemoveClass)
+{
+   ASSERT_TRUE(gInterpreter->Declare("struct TestGetClassCacheStale { int fValue; };"));
+   // A TClass in the state of the ones created by a dictionary, such that GetClass caches it
+   auto cl = new TClass("TestGetClassCacheStale", 1, typeid(TestGetClassCacheStale), nullptr, "", "", 0, 0, kTRUE);
+   ASSERT_TRUE(cl->IsLoaded());
+
+   for (int i = 0; i < 2; ++i) {
+      EXPECT_EQ(TClass::GetClass("TestGetClassCacheStale"), cl);
+      EXPECT_EQ(TClass::GetClass("struct TestGetClassCacheStale"), cl);
+      EXPECT_EQ(TClass::GetClass(typeid(TestGetClassCacheStale)), cl);
+   }
+
+   // The removed class is not returned from the caches, by any spelling of its name nor by type
+   TClass::RemoveClass(cl);
+   EXPECT_NE(TClass::GetClass("TestGetClassCacheStale"), cl);
+   EXPECT_NE(TClass::GetClass("struct TestGetClassCacheStale"), cl);
+   EXPECT_NE(TClass::GetClass(typeid(TestGetClassCacheStale)), cl);
+}
+
+TEST(TClass, GetClassCacheNormalizedName)
+{
+   auto cl = TClass::GetClass("vector<int>");
+   ASSERT_NE(cl, nullptr);
+   // The spellings that need normalization resolve to the same class, on the slow path and then from the cache,
+   // without the entry of one spelling shadowing another
+   for (int i = 0; i < 2; ++i) {
+      EXPECT_EQ(TClass::GetClass("vector<int,allocator<int> >"), cl);
+      EXPECT_EQ(TClass::GetClass("std::vector<int, std::allocator<int> >"), cl);
+      EXPECT_EQ(TClass::GetClass("vector<int>"), cl);
+      EXPECT_EQ(TClass::GetClass(typeid(std::vector<int>)), cl);
+   }
+   EXPECT_EQ(TClass::GetClass("vector<float,allocator<float> >"), TClass::GetClass("vector<float>"));
+   EXPECT_NE(TClass::GetClass("vector<float,allocator<float> >"), cl);
+}
@@ -127,6 +127,7 @@ clang/LLVM technology.
 #include <algorithm>
 #include <iostream>
 #include <cassert>
+#include <chrono>
 #include <map>
 #include <set>
 #include <stdexcept>
@@ -1282,6 +1283,43 @@ static void RegisterPreIncludedHeaders(cling::Interpreter &clingInterp)
    clingInterp.declare(PreIncludes);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the resident memory of the process in kB, or -1 if unknown.
+
+static Long_t GetResidentMemory()
+{
+   ProcInfo_t info;
+   if (!gSystem || gSystem->GetProcInfo(&info) < 0)
+      return -1;
+   return info.fMemResident;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Adds to the startup timeline of the interpreter the time and resident
+/// memory taken by a step, from construction to destruction.
+
+class TCling::StartupTimerRAII {
+   TCling &fInterp;
+   const char *fPhase;
+   std::string fLibrary;
+   std::chrono::steady_clock::time_point fStart;
+   Long_t fMemStart;
+
+public:
+   StartupTimerRAII(TCling &interp, const char *phase, const std::string &library = "")
+      : fInterp(interp), fPhase(phase), fLibrary(library), fStart(std::chrono::steady_clock::now()),
+        fMemStart(GetResidentMemory())
+   {
+   }
+
+   ~StartupTimerRAII()
+   {
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - fStart;
+      Long_t memEnd = fMemStart < 0 ? -1 : GetResidentMemory();
+      fInterp.fStartupTimeline.push_back({fPhase, fLibrary, elapsed.count(), memEnd < 0 ? -1 : memEnd - fMemStart});
+   }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize the cling interpreter interface.
 /// \param argv - array of arguments passed to the cling::Interpreter constructor
@@ -1295,6 +1333,7 @@ TCling::TCling(const char *name, const char *title, const char* const argv[])
 {
    fPrompt[0] = 0;
    const bool fromRootCling = IsFromRootCling();
+   fStartupTimer.reset(new StartupTimerRAII(*this, "Startup"));
 
    fCxxModulesEnabled = false;
 #ifdef R__USE_CXXMODULES
@@ -1479,9 +1518,17 @@ TCling::TCling(const char *name, const char *title, const char* const argv[])
    if (!EnvOpt.hasValue())
       extensions.push_back(std::make_shared<TClingRdictModuleFileExtension>());
 
-   fInterpreter = llvm::make_unique<cling::Interpreter>(interpArgs.size(),
-                                                        &(interpArgs[0]),
-                                                        llvmResourceDir, extensions);
+   // Read the rootpcms of the dictionaries only when one of their classes is
+   // needed instead of when their library is loaded.
+   EnvOpt = llvm::sys::Process::GetEnv("ROOT_LAZY_PCM");
+   fDeferPCMs = !fromRootCling && EnvOpt.hasValue() && EnvOpt.getValue() != "0";
+
+   {
+      StartupTimerRAII timer(*this, "Interpreter creation");
+      fInterpreter = llvm::make_unique<cling::Interpreter>(interpArgs.size(),
+                                                           &(interpArgs[0]),
+                                                           llvmResourceDir, extensions);
+   }
 
    if (!fromRootCling) {
       fInterpreter->installLazyFunctionCreator(llvmLazyFunctionCreator);
@@ -1500,8 +1547,11 @@ TCling::TCling(const char *name, const char *title, const char* const argv[])
    static llvm::raw_fd_ostream fMPOuts (STDOUT_FILENO, /*ShouldClose*/false);
    fMetaProcessor = llvm::make_unique<cling::MetaProcessor>(*fInterpreter, fMPOuts);
 
-   RegisterCxxModules(*fInterpreter);
-   RegisterPreIncludedHeaders(*fInterpreter);
+   {
+      StartupTimerRAII timer(*this, "C++ modules registration");
+      RegisterCxxModules(*fInterpreter);
+      RegisterPreIncludedHeaders(*fInterpreter);
+   }
 
    // We are now ready (enough is loaded) to init the list of opaque typedefs.
    fNormalizedCtxt = new ROOT::TMetaUtils::TNormalizedCtxt(fInterpreter->getLookupHelper());
@@ -1558,6 +1608,7 @@ TCling::~TCling()
    if (!IsFromRootCling())
       GetInterpreterImpl()->runAtExitFuncs();
    fIsShuttingDown = true;
+   fStartupTimer.reset();
    delete fMapfile;
    delete fRootmapFiles;
    delete fTemporaries;
@@ -1584,8 +1635,16 @@ void TCling::Initialize()
    assert(GetRootMapFiles() == 0 && "Must be called before LoadLibraryMap!");
    TClass::ReadRules(); // Read the default customization rules ...
 
-   LoadLibraryMap();
+   {
+      StartupTimerRAII timer(*this, "Rootmap loading");
+      LoadLibraryMap();
+   }
    SetClassAutoLoading(true);
+
+   // The interpreter is now usable: close the startup entry of the timeline.
+   fStartupTimer.reset();
+   if (llvm::sys::Process::GetEnv("ROOT_STARTUP_TIMELINE").hasValue())
+      PrintStartupTimeline();
 }
 
 void TCling::ShutDown()
@@ -1746,6 +1805,7 @@ void TCling::LoadPCMImpl(TFile &pcmFile)
 
 void TCling::LoadPCM(std::string pcmFileNameFullPath)
 {
+   StartupTimerRAII timer(*this, "LoadPCM", llvm::sys::path::filename(pcmFileNameFullPath).str());
    SuspendAutoLoadingRAII autoloadOff(this);
    SuspendAutoParsing autoparseOff(this);
    assert(!pcmFileNameFullPath.empty());
@@ -1802,6 +1862,97 @@ void TCling::LoadPCM(std::string pcmFileNameFullPath)
    LoadPCMImpl(pcmFile);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Record that the rootpcm of the dictionary library dyLibName is to be read
+/// only when one of its classes is needed, see LoadDeferredPCM(). Returns
+/// false if it must be read now, because one of its classes already has a
+/// TClass that reading it would update.
+
+bool TCling::DeferPCM(const std::string &dyLibName, const std::string &pcmFileNameFullPath,
+                      const char **classesHeaders)
+{
+   if (!classesHeaders || !*classesHeaders)
+      return false;
+
+   // classesHeaders holds each class name followed by its headers and "@".
+   std::vector<std::string> classes;
+   for (const char **classesHeader = classesHeaders; *classesHeader; ++classesHeader) {
+      if (gROOT->GetListOfClasses()->FindObject(*classesHeader))
+         return false;
+      classes.emplace_back(*classesHeader);
+      while (*classesHeader && strcmp(*classesHeader, "@"))
+         ++classesHeader;
+      if (!*classesHeader)
+         break;
+   }
+
+   for (const auto &cl : classes)
+      fDeferredPCMClasses[cl] = dyLibName;
+   fDeferredPCMs[dyLibName] = pcmFileNameFullPath;
+   fHasDeferredPCMs = true;
+   if (gDebug > 1)
+      ::Info("TCling::RegisterModule", "Deferring the reading of ROOT PCM %s", pcmFileNameFullPath.c_str());
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the deferred rootpcm providing the TProtoClass of classname, if any.
+/// The library of the class is the one of its dictionary function in the
+/// TClassTable or, e.g. for namespaces, the one registering it in
+/// RegisterModule(). Returns true if a rootpcm was read.
+///
+/// Rootpcms are deferred if the environment variable ROOT_LAZY_PCM is set
+/// (and not "0"). The typedefs and enums they hold are then only known from
+/// the interpreter until one of their classes is needed.
+
+Bool_t TCling::LoadDeferredPCM(const char *classname)
+{
+   if (!fHasDeferredPCMs || !classname)
+      return kFALSE;
+
+   R__LOCKGUARD(gInterpreterMutex);
+   auto iPCM = fDeferredPCMs.end();
+   if (DictFuncPtr_t dict = TClassTable::GetDictNorm(classname))
+      iPCM = fDeferredPCMs.find(cling::DynamicLibraryManager::getSymbolLocation(dict));
+   if (iPCM == fDeferredPCMs.end()) {
+      auto iClass = fDeferredPCMClasses.find(classname);
+      if (iClass != fDeferredPCMClasses.end())
+         iPCM = fDeferredPCMs.find(iClass->second);
+   }
+   if (iPCM == fDeferredPCMs.end())
+      return kFALSE;
+
+   // Forget it before reading it: reading it creates TClasses, which look up their proto.
+   std::string pcmFileNameFullPath = iPCM->second;
+   fDeferredPCMs.erase(iPCM);
+   if (fDeferredPCMs.empty()) {
+      fDeferredPCMClasses.clear();
+      fHasDeferredPCMs = false;
+   }
+   LoadPCM(pcmFileNameFullPath);
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read all the deferred rootpcms, e.g. before forking workers that should
+/// share them. Returns the number of rootpcms read.
+
+Int_t TCling::LoadDeferredPCMs()
+{
+   R__LOCKGUARD(gInterpreterMutex);
+   Int_t nLoaded = 0;
+   while (!fDeferredPCMs.empty()) {
+      // Reading one can read others, through LoadDeferredPCM().
+      std::string pcmFileNameFullPath = fDeferredPCMs.begin()->second;
+      fDeferredPCMs.erase(fDeferredPCMs.begin());
+      LoadPCM(pcmFileNameFullPath);
+      ++nLoaded;
+   }
+   fDeferredPCMClasses.clear();
+   fHasDeferredPCMs = false;
+   return nLoaded;
+}
+
 //______________________________________________________________________________
 
 namespace {
@@ -1957,6 +2108,8 @@ void TCling::RegisterModule(const char* modulename,
    // I/O; see rootcling.cxx after the call to TCling__GetInterpreter().
    if (fromRootCling) return;
 
+   StartupTimerRAII timer(*this, "RegisterModule", modulename);
+
    // When we cannot provide a module for the library we should enable header
    // parsing. This 'mixed' mode ensures gradual migration to modules.
    llvm::SaveAndRestore<bool> SaveHeaderParsing(fHeaderParsingOnDemand);
@@ -2227,7 +2380,8 @@ void TCling::RegisterModule(const char* modulename,
       llvm::sys::path::remove_filename(pcmFileNameFullPath);
       llvm::sys::path::append(pcmFileNameFullPath,
                               ROOT::TMetaUtils::GetModuleFileName(modulename));
-      LoadPCM(pcmFileNameFullPath.str().str());
+      if (!fDeferPCMs || isACLiC || !DeferPCM(dyLibName, pcmFileNameFullPath.str().str(), classesHeaders))
+         LoadPCM(pcmFileNameFullPath.str().str());
    }
 
    { // scope within which diagnostics are de-activated
@@ -2527,6 +2681,38 @@ void TCling::PrintIntro()
 {
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Print the wall clock time and the change of resident memory of each step
+/// of the interpreter startup, followed by the totals per kind of step.
+/// "Startup" spans from the construction of the interpreter to the end of
+/// Initialize(); the libraries registered later are listed as well. Nested
+/// steps, e.g. the LoadPCM of a RegisterModule, are included in the outer one.
+///
+/// The timeline is printed at the end of the startup if the environment
+/// variable ROOT_STARTUP_TIMELINE is set.
+
+void TCling::PrintStartupTimeline() const
+{
+   R__LOCKGUARD(gInterpreterMutex);
+   std::map<std::string, std::tuple<int, double, Long_t>> totals;
+   printf("%-26s %-40s %10s %10s\n", "Phase", "Library", "Time [ms]", "RSS [kB]");
+   for (const auto &record : fStartupTimeline) {
+      printf("%-26s %-40s %10.2f %10ld\n", record.fPhase.c_str(), record.fLibrary.c_str(), 1000 * record.fRealTime,
+             record.fMemResident);
+      auto &total = totals[record.fPhase];
+      ++std::get<0>(total);
+      std::get<1>(total) += record.fRealTime;
+      if (record.fMemResident > 0)
+         std::get<2>(total) += record.fMemResident;
+   }
+   printf("\n%-26s %10s %10s %10s\n", "Phase", "Count", "Time [ms]", "RSS [kB]");
+   for (const auto &total : totals)
+      printf("%-26s %10d %10.2f %10ld\n", total.first.c_str(), std::get<0>(total.second),
+             1000 * std::get<1>(total.second), std::get<2>(total.second));
+   if (!fDeferredPCMs.empty())
+      printf("\n%zu ROOT PCM(s) not read yet\n", fDeferredPCMs.size());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Add the given path to the list of directories in which the interpreter
 /// looks for include files. Only one path item can be specified at a
@@ -6671,6 +6857,9 @@ void TCling::InvalidateCachedDecl(const std::tuple<TListOfDataMembers*,
    if (D->isFromASTFile())  // `D' came from the PCH; ignore
       return;
 
+   if (isa<FunctionDecl>(D) || isa<RecordDecl>(D))
+      TClingCallFunc::InvalidateWrappers(D);
+
    TListOfDataMembers &LODM = *(std::get<0>(Lists));
    TListOfFunctions &LOF = *(std::get<1>(Lists));
    TListOfFunctionTemplates &LOFT = *(std::get<2>(Lists));
@@ -6756,6 +6945,11 @@ void TCling::LibraryLoaded(const void* dyLibHandle, const char* canonicalName) {
 void TCling::LibraryUnloaded(const void* dyLibHandle, const char* canonicalName) {
    fPrevLoadedDynLibInfo = 0;
    fSharedLibs = "";
+   // The rootpcm of an unloaded library must not be read anymore.
+   if (fHasDeferredPCMs && canonicalName && fDeferredPCMs.erase(canonicalName) && fDeferredPCMs.empty()) {
+      fDeferredPCMClasses.clear();
+      fHasDeferredPCMs = false;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -26,9 +26,11 @@
 
 #include "TInterpreter.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -177,6 +179,22 @@ private: // Data Members
 
    bool fIsShuttingDown = false;
 
+   /// One step of the interpreter startup, or of a later library registration.
+   struct StartupRecord_t {
+      std::string fPhase;   // What was done, e.g. "LoadPCM"
+      std::string fLibrary; // The library it was done for, if any
+      double fRealTime;     // Elapsed wall clock time in seconds, including nested steps
+      Long_t fMemResident;  // Change of the resident memory in kB, or -1 if unknown
+   };
+   class StartupTimerRAII;
+   std::vector<StartupRecord_t> fStartupTimeline; // Time spent in each startup step, see PrintStartupTimeline()
+   std::unique_ptr<StartupTimerRAII> fStartupTimer; // Measures the startup until the end of Initialize()
+
+   Bool_t fDeferPCMs = kFALSE; // True if the rootpcms are read only when one of their classes is needed
+   std::atomic<bool> fHasDeferredPCMs{false}; // True if fDeferredPCMs is not empty
+   std::map<std::string, std::string> fDeferredPCMs; // Rootpcm not read yet for each library with a dictionary
+   std::unordered_map<std::string, std::string> fDeferredPCMClasses; // Library of each class of fDeferredPCMs
+
 protected:
    Bool_t SetSuspendAutoParsing(Bool_t value);
 
@@ -223,6 +241,8 @@ public: // Public Interface
    Int_t   Load(const char* filenam, Bool_t system = kFALSE);
    void    LoadMacro(const char* filename, EErrorCode* error = 0);
    Int_t   LoadLibraryMap(const char* rootmapfile = 0);
+   Bool_t  LoadDeferredPCM(const char *classname);
+   Int_t   LoadDeferredPCMs();
    Int_t   RescanLibraryMap();
    Int_t   ReloadAllSharedLibraryMaps();
    Int_t   UnloadAllSharedLibraryMaps();
@@ -231,6 +251,7 @@ public: // Public Interface
    Long_t  ProcessLineAsynch(const char* line, EErrorCode* error = 0);
    Long_t  ProcessLineSynch(const char* line, EErrorCode* error = 0);
    void    PrintIntro();
+   void    PrintStartupTimeline() const;
    bool    RegisterPrebuiltModulePath(const std::string& FullPath,
                                       const std::string& ModuleMapName = "module.modulemap") const;
    void    RegisterModule(const char* modulename,
@@ -613,6 +634,7 @@ private: // Private Utility Functions and Classes
    void RegisterRdictForLoadPCM(const std::string &pcmFileNameFullPath, llvm::StringRef *pcmContent);
    void LoadPCM(std::string pcmFileNameFullPath);
    void LoadPCMImpl(TFile &pcmFile);
+   bool DeferPCM(const std::string &dyLibName, const std::string &pcmFileNameFullPath, const char **classesHeaders);
 
    void InitRootmapFile(const char *name);
    int  ReadRootmapFile(const char *rootmapfile, TUniqueString* uniqueString = nullptr);
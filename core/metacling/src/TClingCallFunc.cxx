@@ -70,6 +70,8 @@ C++ interpreter and the Clang C++ compiler, not CINT.
 #include <map>
 #include <string>
 #include <sstream>
+#include <unordered_map>
+#include <vector>
 
 using namespace ROOT;
 using namespace llvm;
@@ -79,9 +81,47 @@ using namespace std;
 static unsigned long long gWrapperSerial = 0LL;
 static const string kIndentString("   ");
 
-static map<const FunctionDecl *, void *> gWrapperStore;
-static map<const Decl *, void *> gCtorWrapperStore;
-static map<const Decl *, void *> gDtorWrapperStore;
+namespace {
+
+/// Kinds of compiled wrappers; the constructor wrappers also depend on their EIOCtorCategory.
+enum EWrapperKind { kFunctionWrapper, kDtorWrapper, kCtorWrapper };
+
+/// A compiled wrapper of the declaration it is stored for.
+struct WrapperStoreEntry_t {
+   EWrapperKind fKind;
+   ROOT::TMetaUtils::EIOCtorCategory fCtorKind; ///< Kind of constructor called by a kCtorWrapper
+   string fTypeName;                            ///< Argument type of the constructor called by a kCtorWrapper
+   void *fWrapper;
+};
+
+} // unnamed namespace
+
+/// The compiled wrappers, shared by all the TClingCallFunc objects (and thus by all
+/// the TMethodCall) and keyed by the canonical declaration of the function, or class
+/// for constructors and destructors, so that all its redeclarations share them.
+/// Accessed with gInterpreterMutex held.
+static unordered_map<const Decl *, vector<WrapperStoreEntry_t>> gWrapperStore;
+
+static void *FindWrapper(const Decl *D, EWrapperKind kind,
+                         ROOT::TMetaUtils::EIOCtorCategory ctorKind = ROOT::TMetaUtils::EIOCtorCategory::kAbsent,
+                         const string &typeName = "")
+{
+   auto I = gWrapperStore.find(D->getCanonicalDecl());
+   if (I == gWrapperStore.end())
+      return nullptr;
+   for (const auto &entry : I->second) {
+      if (entry.fKind == kind && entry.fCtorKind == ctorKind && entry.fTypeName == typeName)
+         return entry.fWrapper;
+   }
+   return nullptr;
+}
+
+static void AddWrapper(const Decl *D, void *wrapper, EWrapperKind kind,
+                       ROOT::TMetaUtils::EIOCtorCategory ctorKind = ROOT::TMetaUtils::EIOCtorCategory::kAbsent,
+                       const string &typeName = "")
+{
+   gWrapperStore[D->getCanonicalDecl()].push_back({kind, ctorKind, typeName, wrapper});
+}
 
 static
 inline
@@ -1095,7 +1135,7 @@ tcling_callfunc_Wrapper_t TClingCallFunc::make_wrapper()
    //
    void *F = compile_wrapper(wrapper_name, wrapper);
    if (F) {
-      gWrapperStore.insert(make_pair(FD, F));
+      AddWrapper(FD, F, kFunctionWrapper);
    } else {
       ::Error("TClingCallFunc::make_wrapper",
             "Failed to compile\n  ==== SOURCE BEGIN ====\n%s\n  ==== SOURCE END ====",
@@ -1305,7 +1345,7 @@ tcling_callfunc_ctor_Wrapper_t TClingCallFunc::make_ctor_wrapper(const TClingCla
    void *F = compile_wrapper(wrapper_name, wrapper,
                              /*withAccessControl=*/false);
    if (F) {
-      gCtorWrapperStore.insert(make_pair(info->GetDecl(), F));
+      AddWrapper(info->GetDecl(), F, kCtorWrapper, kind, type_name);
    } else {
       ::Error("TClingCallFunc::make_ctor_wrapper",
             "Failed to compile\n  ==== SOURCE BEGIN ====\n%s\n  ==== SOURCE END ====",
@@ -1469,7 +1509,7 @@ TClingCallFunc::make_dtor_wrapper(const TClingClassInfo *info)
    void *F = compile_wrapper(wrapper_name, wrapper,
                              /*withAccessControl=*/false);
    if (F) {
-      gDtorWrapperStore.insert(make_pair(info->GetDecl(), F));
+      AddWrapper(info->GetDecl(), F, kDtorWrapper);
    } else {
       ::Error("TClingCallFunc::make_dtor_wrapper",
             "Failed to compile\n  ==== SOURCE BEGIN ====\n%s\n  ==== SOURCE END ====",
@@ -2164,12 +2204,9 @@ void *TClingCallFunc::ExecDefaultConstructor(const TClingClassInfo *info,
       //         info->Name());
       //   return 0;
       //}
-      auto I = gCtorWrapperStore.find(D);
-      if (I != gCtorWrapperStore.end()) {
-         wrapper = (tcling_callfunc_ctor_Wrapper_t) I->second;
-      } else {
+      wrapper = (tcling_callfunc_ctor_Wrapper_t) FindWrapper(D, kCtorWrapper, kind, type_name);
+      if (!wrapper)
          wrapper = make_ctor_wrapper(info, kind, type_name);
-      }
    }
    if (!wrapper) {
       ::Error("TClingCallFunc::ExecDefaultConstructor",
@@ -2193,12 +2230,9 @@ void TClingCallFunc::ExecDestructor(const TClingClassInfo *info, void *address /
    {
       R__LOCKGUARD_CLING(gInterpreterMutex);
       const Decl *D = info->GetDecl();
-      map<const Decl *, void *>::iterator I = gDtorWrapperStore.find(D);
-      if (I != gDtorWrapperStore.end()) {
-         wrapper = (tcling_callfunc_dtor_Wrapper_t) I->second;
-      } else {
+      wrapper = (tcling_callfunc_dtor_Wrapper_t) FindWrapper(D, kDtorWrapper);
+      if (!wrapper)
          wrapper = make_dtor_wrapper(info);
-      }
    }
    if (!wrapper) {
       ::Error("TClingCallFunc::ExecDestructor",
@@ -2214,6 +2248,14 @@ TClingCallFunc::FactoryMethod() const
    return new TClingMethodInfo(*fMethod);
 }
 
+void TClingCallFunc::InvalidateWrappers(const Decl *D)
+{
+   // Forget the wrappers calling the function, or the constructors and
+   // destructor of the class, D: they are unloaded with it.
+   R__LOCKGUARD_CLING(gInterpreterMutex);
+   gWrapperStore.erase(D->getCanonicalDecl());
+}
+
 void TClingCallFunc::Init()
 {
    fMethod.reset();
@@ -2244,12 +2286,9 @@ void *TClingCallFunc::InterfaceMethod()
       const FunctionDecl *decl = GetDecl();
 
       R__LOCKGUARD_CLING(gInterpreterMutex);
-      map<const FunctionDecl *, void *>::iterator I = gWrapperStore.find(decl);
-      if (I != gWrapperStore.end()) {
-         fWrapper = (tcling_callfunc_Wrapper_t) I->second;
-      } else {
+      fWrapper = (tcling_callfunc_Wrapper_t) FindWrapper(decl, kFunctionWrapper);
+      if (!fWrapper)
          fWrapper = make_wrapper();
-      }
    }
    return (void *)fWrapper;
 }
@@ -2273,12 +2312,9 @@ TInterpreter::CallFuncIFacePtr_t TClingCallFunc::IFacePtr()
       const FunctionDecl *decl = GetDecl();
 
       R__LOCKGUARD_CLING(gInterpreterMutex);
-      map<const FunctionDecl *, void *>::iterator I = gWrapperStore.find(decl);
-      if (I != gWrapperStore.end()) {
-         fWrapper = (tcling_callfunc_Wrapper_t) I->second;
-      } else {
+      fWrapper = (tcling_callfunc_Wrapper_t) FindWrapper(decl, kFunctionWrapper);
+      if (!fWrapper)
          fWrapper = make_wrapper();
-      }
 
       fReturnIsRecordType = decl->getReturnType().getCanonicalType()->isRecordType();
    }
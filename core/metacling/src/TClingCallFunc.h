@@ -198,6 +198,7 @@ public:
    void Init(std::unique_ptr<TClingMethodInfo>);
    void Invoke(cling::Value* result = 0) const;
    void* InterfaceMethod();
+   static void InvalidateWrappers(const clang::Decl *D);
    bool IsValid() const;
    TInterpreter::CallFuncIFacePtr_t IFacePtr();
    const clang::FunctionDecl *GetDecl() {
@@ -31,6 +31,7 @@ namespace MPCode {
       kExecFunc = 0,    ///< Execute function without arguments
       kExecFuncWithArg, ///< Execute function with the argument contained in the message
       kFuncResult,      ///< The message contains the result of a function execution
+      kExecFuncWithValue, ///< Execute function with the value of the argument contained in the message (persistent workers)
       /* TProcessExecutor::MapReduce */
       kIdling = 100,    ///< We are ready for the next task
       kSendResult,      ///< Ask for a kFuncResult/kProcResult
@@ -37,6 +37,8 @@ using MPCodeBufPair = std::pair<unsigned, std::unique_ptr<TBufferFile>>;
 // message with a code and no object. The templated versions are used
 // to send a code and an object of any non-pointer type.
 int MPSend(TSocket *s, unsigned code);
+int MPSendBuffer(TSocket *s, unsigned code, const char *buf, ULong_t len);
+ULong_t MPGetSharedMemoryThreshold();
 
 template<class T, typename std::enable_if<std::is_class<T>::value>::type * = nullptr>
 int MPSend(TSocket *s, unsigned code, T obj);
@@ -83,6 +85,8 @@ T ReadBuffer(TBufferFile *buf);
 /// cling can be sent using MPSend(). User-defined types can be made available to
 /// cling via a call like `gSystem->ProcessLine("#include \"header.h\"")`.
 /// Pointer types cannot be sent via MPSend() (with the exception of const char*).
+/// Objects whose serialized size is above MPGetSharedMemoryThreshold() are
+/// passed through a shared memory segment instead of the socket, see MPSendBuffer().
 /// \param s a pointer to a valid TSocket. No validity checks are performed\n
 /// \param code the code to be sent
 /// \param obj the object to be sent
@@ -97,11 +101,7 @@ int MPSend(TSocket *s, unsigned code, T obj)
    }
    TBufferFile objBuf(TBuffer::kWrite);
    objBuf.WriteObjectAny(&obj, c);
-   TBufferFile wBuf(TBuffer::kWrite);
-   wBuf.WriteUInt(code);
-   wBuf.WriteULong(objBuf.Length());
-   wBuf.WriteBuf(objBuf.Buffer(), objBuf.Length());
-   return s->SendRaw(wBuf.Buffer(), wBuf.Length());
+   return MPSendBuffer(s, code, objBuf.Buffer(), objBuf.Length());
 }
 
 /// \cond
@@ -137,13 +137,7 @@ int MPSend(TSocket *s, unsigned code, T obj)
    if(obj != nullptr)
       objBuf.WriteObjectAny(obj, obj->IsA());
 
-   //write everything together in a buffer
-   TBufferFile wBuf(TBuffer::kWrite);
-   wBuf.WriteUInt(code);
-   wBuf.WriteULong(objBuf.Length());
-   if(objBuf.Length())
-      wBuf.WriteBuf(objBuf.Buffer(), objBuf.Length());
-   return s->SendRaw(wBuf.Buffer(), wBuf.Length());
+   return MPSendBuffer(s, code, objBuf.Buffer(), objBuf.Length());
 }
 
 /// \endcond
@@ -27,7 +27,8 @@
 #include <numeric> //std::iota
 #include <string>
 #include <type_traits> //std::result_of, std::enable_if
-#include <functional> //std::reference_wrapper
+#include <typeinfo> //typeid
+#include <functional> //std::reference_wrapper, std::function
 #include <vector>
 
 namespace ROOT {
@@ -52,6 +53,10 @@ public:
    void SetNWorkers(unsigned n) { TMPClient::SetNWorkers(n); }
    unsigned GetNWorkers() const { return TMPClient::GetNWorkers(); }
 
+   void SetReuseWorkers(bool reuse);
+   /// Whether the workers are kept alive across calls, see SetReuseWorkers()
+   bool GetReuseWorkers() const { return fReuseWorkers; }
+
    using TExecutor<TProcessExecutor>::MapReduce;
    template<class F, class R, class Cond = noReferenceCond<F>>
    auto MapReduce(F func, unsigned nTimes, R redfunc) -> typename std::result_of<F()>::type;
@@ -65,12 +70,25 @@ private:
    template<class T> void Collect(std::vector<T> &reslist);
    template<class T> void HandlePoolCode(MPCodeBufPair &msg, TSocket *sender, std::vector<T> &reslist);
 
+   template <class W, class F> static std::string GetWorkersKey(const F &func);
+   template <class W, class F, class R> static std::string GetWorkersKey(const F &func, const R &redfunc);
+   template <class C> static bool AppendToKey(std::string &key, const C &c, std::true_type /*isTriviallyCopyable*/);
+   template <class C> static bool AppendToKey(std::string &, const C &, std::false_type) { return false; }
+
    void Reset();
+   bool StartWorkers(TMPWorker &worker, unsigned nTasks, const std::string &key);
+   unsigned BroadcastArgs(unsigned nArgs);
+   void SendArg(TSocket *s, unsigned n);
+   void FinishTask();
    void ReplyToFuncResult(TSocket *s);
    void ReplyToIdle(TSocket *s);
 
    unsigned fNProcessed; ///< number of arguments already passed to the workers
    unsigned fNToProcess; ///< total number of arguments to pass to the workers
+   bool fReuseWorkers = false; ///< keep the workers alive after a call, to run the next calls with the same task
+   std::string fWorkersKey; ///< identifies the task of the workers kept alive, empty if the workers are forked per call
+   /// Sends the value of an argument to a worker kept alive, set during the calls with arguments
+   std::function<int(TSocket *, unsigned)> fSendArg;
 
    /// A collection of the types of tasks that TProcessExecutor can execute.
    /// It is used to interpret in the right way and properly reply to the
@@ -102,13 +120,9 @@ auto TProcessExecutor::Map(F func, unsigned nTimes) -> std::vector<typename std:
    Reset();
    fTaskType = ETask::kMap;
 
-   //fork max(nTimes, fNWorkers) times
-   unsigned oldNWorkers = GetNWorkers();
-   if (nTimes < oldNWorkers)
-      SetNWorkers(nTimes);
+   //fork max(nTimes, fNWorkers) times, unless the workers of the previous call can be reused
    TMPWorkerExecutor<F> worker(func);
-   bool ok = Fork(worker);
-   SetNWorkers(oldNWorkers);
+   bool ok = StartWorkers(worker, nTimes, GetWorkersKey<decltype(worker)>(func));
    if (!ok)
    {
       Error("TProcessExecutor::Map", "[E][C] Could not fork. Aborting operation.");
@@ -125,8 +139,7 @@ auto TProcessExecutor::Map(F func, unsigned nTimes) -> std::vector<typename std:
    Collect(reslist);
 
    //clean-up and return
-   ReapWorkers();
-   fTaskType = ETask::kNoTask;
+   FinishTask();
    return reslist;
 }
 
@@ -145,14 +158,12 @@ auto TProcessExecutor::Map(F func, std::vector<T> &args) -> std::vector<typename
    Reset();
    fTaskType = ETask::kMapWithArg;
 
-   //fork max(args.size(), fNWorkers) times
+   //fork max(args.size(), fNWorkers) times, unless the workers of the previous call can be reused
    //N.B. from this point onwards, args is filled with undefined (but valid) values, since TMPWorkerExecutor moved its content away
-   unsigned oldNWorkers = GetNWorkers();
-   if (args.size() < oldNWorkers)
-      SetNWorkers(args.size());
+   //workers kept alive receive the values of the arguments instead of their index, so these must be sendable
    TMPWorkerExecutor<F, T> worker(func, args);
-   bool ok = Fork(worker);
-   SetNWorkers(oldNWorkers);
+   const bool canSendArgs = fReuseWorkers && ROOT::Internal::MPCanSendArgs<T>();
+   bool ok = StartWorkers(worker, args.size(), canSendArgs ? GetWorkersKey<decltype(worker)>(func) : "");
    if (!ok)
    {
       Error("TProcessExecutor::Map", "[E][C] Could not fork. Aborting operation.");
@@ -163,16 +174,20 @@ auto TProcessExecutor::Map(F func, std::vector<T> &args) -> std::vector<typename
    fNToProcess = args.size();
    std::vector<retType> reslist;
    reslist.reserve(fNToProcess);
-   std::vector<unsigned> range(fNToProcess);
-   std::iota(range.begin(), range.end(), 0);
-   fNProcessed = Broadcast(MPCode::kExecFuncWithArg, range);
+   if (!fWorkersKey.empty()) {
+      fSendArg = [&args](TSocket *s, unsigned n) { return ROOT::Internal::MPSendArg(s, args[n]); };
+      fNProcessed = BroadcastArgs(fNToProcess);
+   } else {
+      std::vector<unsigned> range(fNToProcess);
+      std::iota(range.begin(), range.end(), 0);
+      fNProcessed = Broadcast(MPCode::kExecFuncWithArg, range);
+   }
 
    //collect results, give out other tasks if needed
    Collect(reslist);
 
    //clean-up and return
-   ReapWorkers();
-   fTaskType = ETask::kNoTask;
+   FinishTask();
    return reslist;
 }
 
@@ -203,13 +218,9 @@ auto TProcessExecutor::MapReduce(F func, unsigned nTimes, R redfunc) -> typename
    Reset();
    fTaskType= ETask::kMapRed;
 
-   //fork max(nTimes, fNWorkers) times
-   unsigned oldNWorkers = GetNWorkers();
-   if (nTimes < oldNWorkers)
-      SetNWorkers(nTimes);
+   //fork max(nTimes, fNWorkers) times, unless the workers of the previous call can be reused
    TMPWorkerExecutor<F, void, R> worker(func, redfunc);
-   bool ok = Fork(worker);
-   SetNWorkers(oldNWorkers);
+   bool ok = StartWorkers(worker, nTimes, GetWorkersKey<decltype(worker)>(func, redfunc));
    if (!ok) {
       std::cerr << "[E][C] Could not fork. Aborting operation\n";
       return retType();
@@ -225,8 +236,7 @@ auto TProcessExecutor::MapReduce(F func, unsigned nTimes, R redfunc) -> typename
    Collect(reslist);
 
    //clean-up and return
-   ReapWorkers();
-   fTaskType= ETask::kNoTask;
+   FinishTask();
    return redfunc(reslist);
 }
 
@@ -245,13 +255,10 @@ auto TProcessExecutor::MapReduce(F func, std::vector<T> &args, R redfunc) -> typ
    Reset();
    fTaskType= ETask::kMapRedWithArg;
 
-   //fork max(args.size(), fNWorkers) times
-   unsigned oldNWorkers = GetNWorkers();
-   if (args.size() < oldNWorkers)
-      SetNWorkers(args.size());
+   //fork max(args.size(), fNWorkers) times, unless the workers of the previous call can be reused
    TMPWorkerExecutor<F, T, R> worker(func, args, redfunc);
-   bool ok = Fork(worker);
-   SetNWorkers(oldNWorkers);
+   const bool canSendArgs = fReuseWorkers && ROOT::Internal::MPCanSendArgs<T>();
+   bool ok = StartWorkers(worker, args.size(), canSendArgs ? GetWorkersKey<decltype(worker)>(func, redfunc) : "");
    if (!ok) {
       std::cerr << "[E][C] Could not fork. Aborting operation\n";
       return decltype(func(args.front()))();
@@ -261,18 +268,53 @@ auto TProcessExecutor::MapReduce(F func, std::vector<T> &args, R redfunc) -> typ
    fNToProcess = args.size();
    std::vector<retType> reslist;
    reslist.reserve(fNToProcess);
-   std::vector<unsigned> range(fNToProcess);
-   std::iota(range.begin(), range.end(), 0);
-   fNProcessed = Broadcast(MPCode::kExecFuncWithArg, range);
+   if (!fWorkersKey.empty()) {
+      fSendArg = [&args](TSocket *s, unsigned n) { return ROOT::Internal::MPSendArg(s, args[n]); };
+      fNProcessed = BroadcastArgs(fNToProcess);
+   } else {
+      std::vector<unsigned> range(fNToProcess);
+      std::iota(range.begin(), range.end(), 0);
+      fNProcessed = Broadcast(MPCode::kExecFuncWithArg, range);
+   }
 
    //collect results/give workers their next task
    Collect(reslist);
 
-   ReapWorkers();
-   fTaskType= ETask::kNoTask;
+   FinishTask();
    return Reduce(reslist, redfunc);
 }
 
+//////////////////////////////////////////////////////////////////////////
+/// Build the key identifying the task of workers of type W executing func.
+/// The key is empty, i.e. the workers cannot be reused, if the state of func
+/// cannot be compared bytewise.
+template <class W, class F>
+std::string TProcessExecutor::GetWorkersKey(const F &func)
+{
+   std::string key = typeid(W).name();
+   key += '\0';
+   return AppendToKey(key, func, std::is_trivially_copyable<F>()) ? key : std::string();
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Build the key identifying the task of workers of type W executing func
+/// and reducing the results with redfunc.
+template <class W, class F, class R>
+std::string TProcessExecutor::GetWorkersKey(const F &func, const R &redfunc)
+{
+   std::string key = GetWorkersKey<W>(func);
+   return !key.empty() && AppendToKey(key, redfunc, std::is_trivially_copyable<R>()) ? key : std::string();
+}
+
+/// \cond
+template <class C>
+bool TProcessExecutor::AppendToKey(std::string &key, const C &c, std::true_type)
+{
+   key.append(reinterpret_cast<const char *>(&c), sizeof(C));
+   return true;
+}
+/// \endcond
+
 //////////////////////////////////////////////////////////////////////////
 /// "Reduce" an std::vector into a single object by passing a
 /// function as the second argument defining the reduction operation.
@@ -319,7 +361,16 @@ template<class T>
 void TProcessExecutor::Collect(std::vector<T> &reslist)
 {
    TMonitor &mon = GetMonitor();
-   mon.ActivateAll();
+   if (fWorkersKey.empty()) {
+      mon.ActivateAll();
+   } else {
+      //workers kept alive may outnumber the tasks: only listen to the ones that were given one,
+      //i.e. the ones deactivated by the broadcast of the first tasks
+      std::unique_ptr<TList> idle(mon.GetListOfActives());
+      mon.ActivateAll();
+      for (auto s : *idle)
+         mon.DeActivate((TSocket *)s);
+   }
    while (mon.GetActive() > 0) {
       TSocket *s = mon.Select();
       MPCodeBufPair msg = MPRecv(s);
@@ -41,6 +41,9 @@ public:
    void DeActivate(TSocket *s);
    void Remove(TSocket *s);
    void ReapWorkers();
+   void ShutdownWorkers();
+   /// The number of workers currently forked and connected to this client
+   unsigned GetNConnectedWorkers() const { return fMon.GetActive() + fMon.GetDeActive(); }
    void HandleMPCode(MPCodeBufPair &msg, TSocket *sender);
 
 private:
@@ -17,8 +17,78 @@
 #include "PoolUtils.h"
 #include "TMPWorker.h"
 #include <string>
+#include <type_traits> //std::integral_constant
 #include <vector>
 
+namespace ROOT {
+namespace Internal {
+
+/// Whether the arguments of type T of a task can be sent by value to
+/// persistent workers: built-in arithmetic types and classes known to cling.
+template <class T>
+using MPIsSendableArg = std::integral_constant<bool, std::is_arithmetic<T>::value || std::is_class<T>::value>;
+
+/// \cond
+inline bool MPCanSendArgs(std::true_type /*isClass*/, const std::type_info &type)
+{
+   return TClass::GetClass(type) != nullptr;
+}
+inline bool MPCanSendArgs(std::false_type /*isClass*/, const std::type_info &)
+{
+   return true;
+}
+
+template <class T>
+int MPSendArg(TSocket *s, const T &arg, std::true_type /*isSendable*/)
+{
+   return MPSend(s, MPCode::kExecFuncWithValue, arg);
+}
+template <class T>
+int MPSendArg(TSocket *, const T &, std::false_type /*isSendable*/)
+{
+   return -1;
+}
+
+template <class T>
+T MPReadArg(TBufferFile *buf, std::true_type /*isSendable*/)
+{
+   return ReadBuffer<T>(buf);
+}
+template <class T>
+T MPReadArg(TBufferFile *, std::false_type /*isSendable*/)
+{
+   return T();
+}
+/// \endcond
+
+//////////////////////////////////////////////////////////////////////////
+/// Whether the arguments of type T can be sent to persistent workers
+/// with MPSendArg(): T must be an arithmetic type or a class with a dictionary.
+template <class T>
+bool MPCanSendArgs()
+{
+   return MPIsSendableArg<T>::value && MPCanSendArgs(std::is_class<T>(), typeid(T));
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Send the value of an argument to a persistent worker, see MPCanSendArgs().
+template <class T>
+int MPSendArg(TSocket *s, const T &arg)
+{
+   return MPSendArg(s, arg, MPIsSendableArg<T>());
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Read the value of an argument sent with MPSendArg().
+template <class T>
+T MPReadArg(TBufferFile *buf)
+{
+   return MPReadArg<T>(buf, MPIsSendableArg<T>());
+}
+
+} // namespace Internal
+} // namespace ROOT
+
 //////////////////////////////////////////////////////////////////////////
 ///
 /// \class TMPWorkerExecutor
@@ -52,7 +122,9 @@
 ///
 /// Since all the important data are passed to TMPWorkerExecutor at construction
 /// time, the kind of messages that client and workers have to exchange
-/// are usually very simple.
+/// are usually very simple. Workers kept alive across several calls by
+/// TProcessExecutor::SetReuseWorkers() receive the value of each argument
+/// in a MPCode::kExecFuncWithValue message instead of its index.
 ///
 //////////////////////////////////////////////////////////////////////////
 
@@ -94,20 +166,14 @@ public:
          unsigned n;
          msg.second->ReadUInt(n);
          // execute function on argument n
-         const auto &res = fFunc(fArgs[n]);
-         // tell client we're done
-         MPSend(s, MPCode::kIdling);
-         // reduce arguments if possible
-         if (fCanReduce) {
-            using FINAL = decltype(fReducedResult);
-            using ORIGINAL = decltype(fRedFunc({res, fReducedResult}));
-            fReducedResult = ROOT::Internal::PoolUtils::ResultCaster<ORIGINAL, FINAL>::CastIfNeeded(fRedFunc({res, fReducedResult})); //TODO try not to copy these into a vector, do everything by ref. std::vector<T&>?
-         } else {
-            fCanReduce = true;
-            fReducedResult = res;
-         }
+         Process(fArgs[n]);
+      } else if (code == MPCode::kExecFuncWithValue) {
+         auto arg = ROOT::Internal::MPReadArg<T>(msg.second.get());
+         Process(arg);
       } else if (code == MPCode::kSendResult) {
          MPSend(s, MPCode::kFuncResult, fReducedResult);
+         // the next result belongs to a new task
+         fCanReduce = false;
       } else {
          reply += ": unknown code received: " + std::to_string(code);
          MPSend(s, MPCode::kError, reply.c_str());
@@ -115,6 +181,22 @@ public:
    }
 
 private:
+   void Process(T &arg)
+   {
+      const auto &res = fFunc(arg);
+      // tell client we're done
+      MPSend(GetSocket(), MPCode::kIdling);
+      // reduce arguments if possible
+      if (fCanReduce) {
+         using FINAL = decltype(fReducedResult);
+         using ORIGINAL = decltype(fRedFunc({res, fReducedResult}));
+         fReducedResult = ROOT::Internal::PoolUtils::ResultCaster<ORIGINAL, FINAL>::CastIfNeeded(fRedFunc({res, fReducedResult})); //TODO try not to copy these into a vector, do everything by ref. std::vector<T&>?
+      } else {
+         fCanReduce = true;
+         fReducedResult = res;
+      }
+   }
+
    F fFunc; ///< the function to be executed
    std::vector<T> fArgs; ///< a vector containing the arguments that must be passed to fFunc
    R fRedFunc; ///< the reduce function
@@ -151,6 +233,8 @@ public:
          }
       } else if (code == MPCode::kSendResult) {
          MPSend(s, MPCode::kFuncResult, fReducedResult);
+         // the next result belongs to a new task
+         fCanReduce = false;
       } else {
          reply += ": unknown code received: " + std::to_string(code);
          MPSend(s, MPCode::kError, reply.c_str());
@@ -178,6 +262,9 @@ public:
          unsigned n;
          msg.second->ReadUInt(n);
          MPSend(s, MPCode::kFuncResult, fFunc(fArgs[n]));
+      } else if (code == MPCode::kExecFuncWithValue) {
+         auto arg = ROOT::Internal::MPReadArg<T>(msg.second.get());
+         MPSend(s, MPCode::kFuncResult, fFunc(arg));
       } else {
          reply += ": unknown code received: " + std::to_string(code);
          MPSend(s, MPCode::kError, reply.c_str());
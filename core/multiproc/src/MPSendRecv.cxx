@@ -11,8 +11,142 @@
  
 #include "MPSendRecv.h"
 #include "TBufferFile.h"
+#include "TEnv.h"
+#include "TSystem.h"
 #include "MPCode.h"
+#include <atomic>
+#include <cerrno>
+#include <cstdlib> //mkstemp
+#include <cstring> //memcpy
 #include <memory> //unique_ptr
+#include <string>
+#include <vector>
+#include <sys/mman.h> //mmap
+#include <sys/socket.h> //sendmsg, recvmsg
+#include <unistd.h> //ftruncate, unlink
+
+namespace {
+
+/// Set in the size of a message when its object is in a shared memory segment,
+/// which file descriptor follows the header of the message as ancillary data
+constexpr ULong_t kSharedMemoryFlag = 1ull << 63;
+
+//////////////////////////////////////////////////////////////////////////
+/// The buffer of an object received through a shared memory segment.
+/// The object is read directly from the mapping of the segment, which is
+/// released with the buffer.
+class MPSharedMemoryBuffer : public TBufferFile {
+   void *fAddress;
+   ULong_t fSize;
+
+public:
+   MPSharedMemoryBuffer(void *address, ULong_t size)
+      : TBufferFile(TBuffer::kRead, size, address, false), fAddress(address), fSize(size)
+   {
+   }
+   ~MPSharedMemoryBuffer() { munmap(fAddress, fSize); }
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Create an unlinked file of the given size in the shared memory file
+/// system (or in the temporary directory if there is none) and copy buf into it.
+/// \return the file descriptor of the segment, or -1 on failure
+int CreateSharedMemorySegment(const char *buf, ULong_t len)
+{
+   static std::atomic<unsigned> nSegments(0);
+   std::string path = access("/dev/shm", W_OK) == 0 ? "/dev/shm" : gSystem->TempDirectory();
+   path += "/ROOTMP-" + std::to_string(getpid()) + "-" + std::to_string(nSegments++) + "-XXXXXX";
+   std::vector<char> name(path.begin(), path.end());
+   name.push_back('\0');
+   int fd = mkstemp(name.data());
+   if (fd < 0)
+      return -1;
+   unlink(name.data());
+   if (ftruncate(fd, len) != 0) {
+      close(fd);
+      return -1;
+   }
+   void *address = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   if (address == MAP_FAILED) {
+      close(fd);
+      return -1;
+   }
+   memcpy(address, buf, len);
+   munmap(address, len);
+   return fd;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Pass the file descriptor fd through the unix socket sock.
+/// A single byte of data carries it, as required by sendmsg.
+bool SendDescriptor(int sock, int fd)
+{
+   char byte = 0;
+   iovec iov;
+   iov.iov_base = &byte;
+   iov.iov_len = 1;
+   char control[CMSG_SPACE(sizeof(int))];
+   memset(control, 0, sizeof(control));
+   msghdr hdr;
+   memset(&hdr, 0, sizeof(hdr));
+   hdr.msg_iov = &iov;
+   hdr.msg_iovlen = 1;
+   hdr.msg_control = control;
+   hdr.msg_controllen = sizeof(control);
+   cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr);
+   cmsg->cmsg_level = SOL_SOCKET;
+   cmsg->cmsg_type = SCM_RIGHTS;
+   cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+   memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+   ssize_t ret;
+   do {
+      ret = sendmsg(sock, &hdr, 0);
+   } while (ret < 0 && errno == EINTR);
+   return ret == 1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Receive a file descriptor sent with SendDescriptor() through the unix socket sock.
+/// \return the received file descriptor, or -1 on failure
+int RecvDescriptor(int sock)
+{
+   char byte = 0;
+   iovec iov;
+   iov.iov_base = &byte;
+   iov.iov_len = 1;
+   char control[CMSG_SPACE(sizeof(int))];
+   msghdr hdr;
+   memset(&hdr, 0, sizeof(hdr));
+   hdr.msg_iov = &iov;
+   hdr.msg_iovlen = 1;
+   hdr.msg_control = control;
+   hdr.msg_controllen = sizeof(control);
+   ssize_t ret;
+   do {
+      ret = recvmsg(sock, &hdr, 0);
+   } while (ret < 0 && errno == EINTR);
+   if (ret != 1)
+      return -1;
+   cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr);
+   if (!cmsg || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+      return -1;
+   int fd;
+   memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+   return fd;
+}
+
+} // anonymous namespace
+
+//////////////////////////////////////////////////////////////////////////
+/// The size in bytes above which the objects sent by MPSend() are passed
+/// through a shared memory segment rather than written to the socket.
+/// It is read once from the `MP.SharedMemoryThreshold` rootrc key (default 1 MB).
+/// \return the threshold, or 0 if objects are always written to the socket
+ULong_t MPGetSharedMemoryThreshold()
+{
+   static const Int_t threshold = gEnv->GetValue("MP.SharedMemoryThreshold", 1024 * 1024);
+   return threshold > 0 ? threshold : 0;
+}
 
 //////////////////////////////////////////////////////////////////////////
 /// Send a message with the specified code on the specified socket.
@@ -37,6 +171,46 @@ int MPSend(TSocket *s, unsigned code)
    return s->SendRaw(wBuf.Buffer(), wBuf.Length());
 }
 
+//////////////////////////////////////////////////////////////////////////
+/// Send a message with the specified code and the serialized object
+/// contained in buf on the specified socket.
+/// This is the function used by the MPSend() versions sending classes and
+/// TObject pointers. If len is above MPGetSharedMemoryThreshold(), buf is
+/// copied into a shared memory segment and only the message header and the
+/// file descriptor of the segment go through the socket: the receiving
+/// MPRecv() reads the object directly from the mapping of the segment,
+/// without copying it into its own buffer. If the segment cannot be created,
+/// the object is written to the socket as usual.
+/// \param s a pointer to a valid TSocket. No validity checks are performed\n
+/// \param code the code to be sent
+/// \param buf the buffer containing the serialized object to be sent
+/// \param len the length of buf
+/// \return the number of bytes sent through the socket, as per TSocket::SendRaw
+int MPSendBuffer(TSocket *s, unsigned code, const char *buf, ULong_t len)
+{
+   const ULong_t threshold = MPGetSharedMemoryThreshold();
+   const int fd = threshold && len >= threshold ? CreateSharedMemorySegment(buf, len) : -1;
+
+   TBufferFile wBuf(TBuffer::kWrite);
+   wBuf.WriteUInt(code);
+   if (fd >= 0) {
+      wBuf.WriteULong(len | kSharedMemoryFlag);
+      int nBytes = s->SendRaw(wBuf.Buffer(), wBuf.Length());
+      const bool sent = nBytes > 0 && SendDescriptor(s->GetDescriptor(), fd);
+      close(fd); // the receiver owns its own copy of the descriptor
+      if (!sent) {
+         Error("MPSendBuffer", "[E] Could not pass shared memory segment to the receiver\n");
+         return -1;
+      }
+      return nBytes + 1;
+   }
+
+   wBuf.WriteULong(len);
+   if (len)
+      wBuf.WriteBuf(buf, len);
+   return s->SendRaw(wBuf.Buffer(), wBuf.Length());
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 /// Receive message from a socket.
@@ -76,7 +250,19 @@ MPCodeBufPair MPRecv(TSocket *s)
 
    //receive object if needed
    std::unique_ptr<TBufferFile> objBuf; //defaults to nullptr
-   if (classBufSize != 0) {
+   if (classBufSize & kSharedMemoryFlag) {
+      //the object is in a shared memory segment, map it and read it from there
+      classBufSize &= ~kSharedMemoryFlag;
+      int fd = RecvDescriptor(s->GetDescriptor());
+      if (fd < 0)
+         return std::make_pair(MPCode::kRecvError, nullptr);
+      //private mapping: the readers of the buffer never modify the segment
+      void *address = mmap(nullptr, classBufSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if (address == MAP_FAILED)
+         return std::make_pair(MPCode::kRecvError, nullptr);
+      objBuf.reset(new MPSharedMemoryBuffer(address, classBufSize));
+   } else if (classBufSize != 0) {
       char *classBuf = new char[classBufSize];
       s->RecvRaw(classBuf, classBufSize);
       objBuf.reset(new TBufferFile(TBuffer::kRead, classBufSize, classBuf, true)); //the buffer is deleted by TBuffer's dtor
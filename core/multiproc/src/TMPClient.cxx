@@ -68,6 +68,15 @@ TMPClient::TMPClient(unsigned nWorkers) : fIsParent(true), fWorkerPids(), fMon()
 /// This method is in charge of shutting down any remaining worker,
 /// closing off connections and reap the terminated children processes.
 TMPClient::~TMPClient()
+{
+   ShutdownWorkers();
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Shut down all the workers, close the connections to them and reap
+/// the terminated children processes.
+/// A new set of workers can be spawned by a following call to Fork().
+void TMPClient::ShutdownWorkers()
 {
    Broadcast(MPCode::kShutdownOrder);
    TList *l = fMon.GetListOfActives();
@@ -79,6 +79,26 @@
 /// root[] ROOT::TProcessExecutor pool; auto hist = pool.MapReduce(CreateAndFillHists, 10, PoolUtils::ReduceObjects);
 /// ~~~
 ///
+/// ###Reusing the workers
+/// By default the workers are forked at the beginning of each call and
+/// terminated at its end. After SetReuseWorkers(true), the workers are
+/// kept alive at the end of a call and run the following calls which execute
+/// the same task, i.e. the same function (and reduce function) in the same
+/// state, saving the cost of forking. The state of a function, e.g. the
+/// values it captures, is compared bytewise, so only functions which are
+/// trivially copyable (function pointers, lambdas capturing built-in values
+/// or nothing) can be reused. The arguments of the calls are sent to the
+/// workers kept alive, so they must be of arithmetic type or of a class
+/// with a dictionary. Any other call forks a new set of workers.\n
+/// **Note:** the workers kept alive see the memory of the ROOT session as it
+/// was when they were forked: changes made later to global variables or to
+/// objects referenced by the function are not visible to them.
+///
+/// ###Result transport
+/// The results whose serialized size is above the `MP.SharedMemoryThreshold`
+/// rootrc value (1 MB by default) are passed from the workers to the client
+/// through shared memory segments instead of the sockets which connect them.
+///
 //////////////////////////////////////////////////////////////////////////
 
 namespace ROOT {
@@ -98,12 +118,100 @@ void TProcessExecutor::Reset()
    fNProcessed = 0;
    fNToProcess = 0;
    fTaskType = ETask::kNoTask;
+   fSendArg = nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Keep the workers alive across calls, to run the following calls which
+/// execute the same task without forking new workers. Disabling it shuts
+/// down the workers kept alive, if any.
+/// See the class documentation for the requirements on the tasks.
+void TProcessExecutor::SetReuseWorkers(bool reuse)
+{
+   fReuseWorkers = reuse;
+   if (!reuse && !fWorkersKey.empty()) {
+      ShutdownWorkers();
+      fWorkersKey.clear();
+   }
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Make sure workers are available to execute nTasks tasks.
+/// The workers kept alive by the previous call are used if they execute the
+/// task identified by key and are enough, otherwise they are shut down and
+/// max(nTasks, fNWorkers) new workers are forked. These are kept alive at
+/// the end of the call if SetReuseWorkers() was enabled and key is not empty.
+/// \return true if the workers are ready, false if forking failed
+bool TProcessExecutor::StartWorkers(TMPWorker &worker, unsigned nTasks, const std::string &key)
+{
+   if (!fWorkersKey.empty()) {
+      if (fReuseWorkers && nTasks > 0 && key == fWorkersKey &&
+          GetNConnectedWorkers() >= std::min(nTasks, GetNWorkers()))
+         return true;
+      ShutdownWorkers();
+      fWorkersKey.clear();
+   }
+
+   unsigned oldNWorkers = GetNWorkers();
+   if (nTasks < oldNWorkers)
+      SetNWorkers(nTasks);
+   bool ok = Fork(worker);
+   SetNWorkers(oldNWorkers);
+   if (ok && fReuseWorkers)
+      fWorkersKey = key;
+   return ok;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Send the values of the first arguments to the workers kept alive, one per
+/// worker, through fSendArg. This is the counterpart of
+/// TMPClient::Broadcast(unsigned code, const std::vector<T> &args), which
+/// sends the indexes of the arguments to workers forked for the call.
+/// \return the number of messages successfully sent
+unsigned TProcessExecutor::BroadcastArgs(unsigned nArgs)
+{
+   TMonitor &mon = GetMonitor();
+   mon.ActivateAll();
+   std::unique_ptr<TList> lp(mon.GetListOfActives());
+   unsigned count = 0;
+   for (auto s : *lp) {
+      if (count == nArgs)
+         break;
+      if (fSendArg((TSocket *)s, count) > 0) {
+         mon.DeActivate((TSocket *)s);
+         ++count;
+      } else {
+         Error("TProcessExecutor::BroadcastArgs", "[E] Could not send message to server\n");
+      }
+   }
+   return count;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Tell a worker to execute the function on argument n: workers kept alive
+/// receive its value, the others its index.
+void TProcessExecutor::SendArg(TSocket *s, unsigned n)
+{
+   if (fSendArg)
+      fSendArg(s, n);
+   else
+      MPSend(s, MPCode::kExecFuncWithArg, n);
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Clean-up at the end of a call: reap the workers, unless they are kept alive.
+void TProcessExecutor::FinishTask()
+{
+   if (fWorkersKey.empty())
+      ReapWorkers();
+   fSendArg = nullptr;
+   fTaskType = ETask::kNoTask;
 }
 
 //////////////////////////////////////////////////////////////////////////
 /// Reply to a worker who just sent a result.
 /// If another argument to process exists, tell the worker. Otherwise
-/// send a shutdown order.
+/// send a shutdown order, or stop listening to the worker if it is kept alive.
 void TProcessExecutor::ReplyToFuncResult(TSocket *s)
 {
    if (fNProcessed < fNToProcess) {
@@ -111,9 +219,11 @@ void TProcessExecutor::ReplyToFuncResult(TSocket *s)
       if (fTaskType == ETask::kMap)
          MPSend(s, MPCode::kExecFunc);
       else if (fTaskType == ETask::kMapWithArg)
-         MPSend(s, MPCode::kExecFuncWithArg, fNProcessed);
+         SendArg(s, fNProcessed);
       ++fNProcessed;
-   } else //whatever the task is, we are done
+   } else if (!fWorkersKey.empty()) //we are done, the worker waits for the next call
+      DeActivate(s);
+   else //whatever the task is, we are done
       MPSend(s, MPCode::kShutdownOrder);
 }
 
@@ -127,7 +237,7 @@ void TProcessExecutor::ReplyToIdle(TSocket *s)
    if (fNProcessed < fNToProcess) {
       //we are executing a "greedy worker" task
       if (fTaskType == ETask::kMapRedWithArg)
-         MPSend(s, MPCode::kExecFuncWithArg, fNProcessed);
+         SendArg(s, fNProcessed);
       else if (fTaskType == ETask::kMapRed)
          MPSend(s, MPCode::kExecFunc);
       ++fNProcessed;
@@ -64,6 +64,7 @@
 #include "TObjectTable.h"
 #include "TError.h"
 #include "TStorage.h" // for ROOT::Internal::gFreeIfTMapFile
+#include "TMemoryAccounting.h"
 #include "TSystem.h"
 #include "mmalloc.h"
 
@@ -201,6 +202,7 @@ void *operator new(size_t size)
    if (vp == 0)
       Fatal(where, gSpaceErr, RealSize(size));
    StoreSizeMagic(vp, size, where);
+   TMemoryAccounting::SampleAllocation(size);
    return ExtStart(vp);
 }
 
@@ -251,6 +253,7 @@ void *operator new(size_t size, void *vp)
       if (vp == 0)
          Fatal(where, gSpaceErr, RealSize(size));
       StoreSizeMagic(vp, size, where);
+      TMemoryAccounting::SampleAllocation(size);
       return ExtStart(vp);
    }
    return vp;
@@ -20,6 +20,7 @@
 
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
 #include <deque>
 #include <functional>
@@ -110,6 +111,44 @@ namespace ROOT {
             static TDirectory *Create() { return nullptr; }
          };
 
+         /// The slot that a thread has in one TThreadedObject, identified by its unique id
+         struct SlotCacheEntry {
+            unsigned long long fObjectId = 0;
+            unsigned fSlot = 0;
+         };
+
+         /// Return the entry of the calling thread's cache of slots for the TThreadedObject objectId.
+         /// The few TThreadedObject instances used by a thread at a time rarely share an entry.
+         inline SlotCacheEntry &GetSlotCacheEntry(unsigned long long objectId)
+         {
+            thread_local SlotCacheEntry cache[8];
+            return cache[objectId % 8];
+         }
+
+         /// Return a new id for a TThreadedObject. Ids are never reused, unlike addresses.
+         inline unsigned long long GetNewObjectId()
+         {
+            static std::atomic<unsigned long long> lastId{0};
+            return ++lastId;
+         }
+
+         /// Merge, pairwise and in parallel if implicit multi-threading is enabled, the objects into objs[0].
+         /// At each step, the object at i + stride is merged into the object at i, so each object
+         /// takes part in at most log2(objs.size()) merges, and the last step merges two objects.
+         template <class T, class MERGEFUNC>
+         void MergePairwise(std::vector<std::shared_ptr<T>> &objs, MERGEFUNC &mergeFunction)
+         {
+            const auto n = objs.size();
+            for (std::size_t stride = 1; stride < n; stride *= 2) {
+               const auto nPairs = static_cast<UInt_t>((n - stride + 2 * stride - 1) / (2 * stride));
+               ROOT::Internal::ParallelFor(nPairs, [&](UInt_t pair) {
+                  const auto i = 2 * stride * pair;
+                  std::vector<std::shared_ptr<T>> two{objs[i], objs[i + stride]};
+                  mergeFunction(objs[i], two);
+               });
+            }
+         }
+
       } // End of namespace TThreadedObjectUtils
    } // End of namespace Internal
 
@@ -261,9 +300,10 @@ namespace ROOT {
          return fObjPointers[i].get();
       }
 
-      /// Access the pointer corresponding to the current slot. This method is
-      /// not adequate for being called inside tight loops as it implies a
-      /// lookup in a mapping between the threadIDs and the slot indices.
+      /// Access the pointer corresponding to the current slot. The slot of the
+      /// thread is cached in thread local storage after its first lookup,
+      /// however copying the pointer onto the stack still saves the cache
+      /// lookup and the reference counting of the shared pointer in tight loops.
       /// A good practice consists in copying the pointer onto the stack and
       /// proceed with the loop as shown in this work item (psudo-code) which
       /// will be sent to different threads:
@@ -278,7 +318,12 @@ namespace ROOT {
       /// ~~~
       std::shared_ptr<T> Get()
       {
-         return GetAtSlot(GetThisSlotNumber());
+         // the slot of this thread exists, no need to check the number of slots
+         const auto slot = GetThisSlotNumber();
+         auto &objPointer = fObjPointers[slot];
+         if (!objPointer)
+            objPointer = CloneModel(slot);
+         return objPointer;
       }
 
       /// Access the wrapped object and allow to call its methods.
@@ -290,6 +335,10 @@ namespace ROOT {
       /// Merge all the thread private objects. Can be called once: it does not
       /// create any new object but destroys the present bookkeping collapsing
       /// all objects into the one at slot 0.
+      /// If implicit multi-threading is enabled, the objects are merged pairwise
+      /// on the thread pool, calling mergeFunction with a target and a vector
+      /// of two objects, the first one being the target: mergeFunction must be
+      /// thread safe when called for different targets.
       std::shared_ptr<T> Merge(TThreadedObjectUtils::MergeFunctionType<T> mergeFunction = TThreadedObjectUtils::MergeTObjects<T>)
       {
          // We do not return if we already merged.
@@ -297,9 +346,14 @@ namespace ROOT {
             Warning("TThreadedObject::Merge", "This object was already merged. Returning the previous result.");
             return fObjPointers[0];
          }
-         // need to convert to std::vector because historically mergeFunction requires a vector
-         auto vecOfObjPtrs = std::vector<std::shared_ptr<T>>(fObjPointers.begin(), fObjPointers.end());
-         mergeFunction(fObjPointers[0], vecOfObjPtrs);
+         auto used = GetUsedSlotObjects();
+         if (ROOT::IsImplicitMTEnabled() && fObjPointers[0] && used.size() > 2) {
+            Internal::TThreadedObjectUtils::MergePairwise(used, mergeFunction);
+         } else {
+            // need to convert to std::vector because historically mergeFunction requires a vector
+            auto vecOfObjPtrs = std::vector<std::shared_ptr<T>>(fObjPointers.begin(), fObjPointers.end());
+            mergeFunction(fObjPointers[0], vecOfObjPtrs);
+         }
          fIsMerged = true;
          return fObjPointers[0];
       }
@@ -314,6 +368,27 @@ namespace ROOT {
             Warning("TThreadedObject::SnapshotMerge", "This object was already merged. Returning the previous result.");
             return std::unique_ptr<T>(Internal::TThreadedObjectUtils::Cloner<T>::Clone(fObjPointers[0].get()));
          }
+         auto used = GetUsedSlotObjects();
+         if (ROOT::IsImplicitMTEnabled() && used.size() > 2) {
+            // The objects of the slots must not change: each pair of them is first merged into a new object
+            std::vector<std::shared_ptr<T>> partialSums((used.size() + 1) / 2);
+            T *targetPtr = nullptr; // the first partial sum, which ends up holding the total
+            ROOT::Internal::ParallelFor(partialSums.size(), [&](UInt_t i) {
+               auto partialSum = Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get());
+               if (i == 0) {
+                  targetPtr = partialSum;
+                  partialSums[0] = std::shared_ptr<T>(partialSum, [](T *) {});
+               } else {
+                  partialSums[i].reset(partialSum);
+               }
+               std::vector<std::shared_ptr<T>> objs{partialSums[i], used[2 * i]};
+               if (2 * i + 1 < used.size())
+                  objs.emplace_back(used[2 * i + 1]);
+               mergeFunction(partialSums[i], objs);
+            });
+            Internal::TThreadedObjectUtils::MergePairwise(partialSums, mergeFunction);
+            return std::unique_ptr<T>(targetPtr);
+         }
          auto targetPtr = Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get());
          std::shared_ptr<T> targetPtrShared(targetPtr, [](T *) {});
          // need to convert to std::vector because historically mergeFunction requires a vector
@@ -331,24 +406,52 @@ namespace ROOT {
       std::deque<TDirectory*> fDirectories;              ///< A TDirectory per slot
       std::map<std::thread::id, unsigned> fThrIDSlotMap; ///< A mapping between the thread IDs and the slots
       mutable ROOT::TSpinMutex fSpinMutex;               ///< Protects concurrent access to fThrIDSlotMap, fObjPointers
+      const unsigned long long fId{Internal::TThreadedObjectUtils::GetNewObjectId()}; ///< Key of the slot caches
       bool fIsMerged : 1;                                ///< Remember if the objects have been merged already
 
-      /// Get the slot number for this threadID, make a slot if needed
+      /// Create the object of slot i from the model
+      std::shared_ptr<T> CloneModel(unsigned i)
+      {
+         return std::shared_ptr<T>(Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get(), fDirectories[i]));
+      }
+
+      /// Return the objects of the slots that are in use, slot 0 first if it is.
+      std::vector<std::shared_ptr<T>> GetUsedSlotObjects() const
+      {
+         std::vector<std::shared_ptr<T>> used;
+         for (auto &objPointer : fObjPointers) {
+            if (objPointer)
+               used.emplace_back(objPointer);
+         }
+         return used;
+      }
+
+      /// Get the slot number for this threadID, make a slot if needed.
+      /// The slot is looked up in the cache of the thread, without locking, and in the map otherwise.
       unsigned GetThisSlotNumber()
       {
+         auto &cached = Internal::TThreadedObjectUtils::GetSlotCacheEntry(fId);
+         if (cached.fObjectId == fId)
+            return cached.fSlot;
+
          const auto thisThreadID = std::this_thread::get_id();
          std::lock_guard<ROOT::TSpinMutex> lg(fSpinMutex);
+         unsigned slot;
          const auto thisSlotNumIt = fThrIDSlotMap.find(thisThreadID);
-         if (thisSlotNumIt != fThrIDSlotMap.end())
-            return thisSlotNumIt->second;
-         const auto newIndex = fThrIDSlotMap.size();
-         fThrIDSlotMap[thisThreadID] = newIndex;
-         R__ASSERT(newIndex <= fObjPointers.size() && "This should never happen, we should create new slots as needed");
-         if (newIndex == fObjPointers.size()) {
-            fDirectories.emplace_back(Internal::TThreadedObjectUtils::DirCreator<T>::Create());
-            fObjPointers.emplace_back(nullptr);
+         if (thisSlotNumIt != fThrIDSlotMap.end()) {
+            slot = thisSlotNumIt->second;
+         } else {
+            slot = fThrIDSlotMap.size();
+            fThrIDSlotMap[thisThreadID] = slot;
+            R__ASSERT(slot <= fObjPointers.size() && "This should never happen, we should create new slots as needed");
+            if (slot == fObjPointers.size()) {
+               fDirectories.emplace_back(Internal::TThreadedObjectUtils::DirCreator<T>::Create());
+               fObjPointers.emplace_back(nullptr);
+            }
          }
-         return newIndex;
+         cached.fObjectId = fId;
+         cached.fSlot = slot;
+         return slot;
       }
    };
 
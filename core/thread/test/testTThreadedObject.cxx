@@ -180,3 +180,26 @@ TEST(TThreadedObject, GetNSlots)
 
    EXPECT_EQ(tto.GetNSlots(), 4u);
 }
+
+#ifdef R__USE_IMT
+TEST(TThreadedObject, ParallelMerge)
+{
+   ROOT::EnableImplicitMT(4);
+   ROOT::TThreadedObject<int> tto(ROOT::TNumSlots{7}, 0);
+   for (auto i = 0u; i < 7u; ++i)
+      tto.SetAtSlot(i, std::make_shared<int>(i + 1));
+
+   // sum_ints is called on pairs of slots, for different targets concurrently
+   auto sum_ints = [](std::shared_ptr<int> first, std::vector<std::shared_ptr<int>> &all) {
+      for (auto &e : all)
+         if (e != first)
+            *first += *e;
+   };
+   EXPECT_EQ(*tto.SnapshotMerge(sum_ints), 28);
+   // the slots are left untouched by SnapshotMerge
+   EXPECT_EQ(*tto.GetAtSlot(6), 7);
+   EXPECT_EQ(*tto.SnapshotMerge(sum_ints), 28);
+   EXPECT_EQ(*tto.Merge(sum_ints), 28);
+   ROOT::DisableImplicitMT();
+}
+#endif
@@ -10,6 +10,8 @@
  *************************************************************************/
 #include "Compression.h"
 
+#include <stddef.h>
+
 /**
  * These are definitions of various free functions for the C-style compression routines in ROOT.
  */
@@ -33,6 +35,34 @@ extern "C" void R__unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigne
 
 extern "C" int R__unzip_header(int *srcsize, unsigned char *src, int *tgtsize);
 
+/**
+ * Variants of R__zipMultipleAlgorithm and R__unzip using a dictionary shared by several buffers (for instance
+ * all the baskets of a branch), which improves the compression of small buffers of similar content.
+ * Only ZSTD supports dictionaries: the other algorithms ignore them.
+ */
+extern "C" void R__zipMultipleAlgorithmDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                                            ROOT::RCompressionSetting::EAlgorithm::EValues, const char *dict,
+                                            int dictsize);
+
+extern "C" void R__unzipDict(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep,
+                             const char *dict, int dictsize);
+
+/**
+ * Enables the adaptive compression of the buffers: R__zipMultipleAlgorithm estimates the compression ratio of each
+ * buffer from a fast sample, does not compress it (irep is 0) if the ratio is below minRatio, and compresses it with
+ * LZ4 instead of the requested algorithm if it is below lz4Ratio. The choice is recorded in the header of the
+ * compressed block as usual, so that reading needs no change. Pass 0 for both to disable it (the default).
+ */
+extern "C" void R__SetZipAdaptive(double minRatio, double lz4Ratio);
+
+/// Returns 1 if the compressed buffer can only be decompressed with the dictionary it was compressed with.
+extern "C" int R__unzip_needs_dict(unsigned char *src);
+
+/// Trains a ZSTD dictionary of at most dictsize bytes from nsamples samples, concatenated in samples. Returns the
+/// size of the dictionary, or 0 if none could be trained from these samples.
+extern "C" int R__trainZSTDDictionary(const char *samples, const size_t *sampleSizes, unsigned int nsamples,
+                                      char *dict, int dictsize);
+
 enum { kMAXZIPBUF = 0xffffff };
 
 #endif
@@ -18,8 +18,10 @@
 
 #include <stdio.h>
 #include <assert.h>
+#include <math.h>
 
 #include <iostream>
+#include <vector>
 
 // The size of the ROOT block framing headers for compression:
 // - 3 bytes to identify the compression algorithm and version.
@@ -33,6 +35,47 @@
 static void R__zipOld(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgrt, int *irep);
 static void R__zipZLIB(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgrt, int *irep);
 static void R__unzipZLIB(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+static int R__unzipOldZLIB(unsigned char *src, long srcsize, unsigned char *tgt, long tgtsize, long isize);
+
+namespace {
+/// The zlib deflate and inflate states allocate several hundreds of kB; each thread keeps its own stream, which is
+/// only reset between buffers.
+struct R__ZlibDeflateStream {
+   z_stream fStream;
+   int fLevel = -1; ///< The compression level fStream was initialized for, -1 if it was not
+   ~R__ZlibDeflateStream()
+   {
+      if (fLevel >= 0)
+         deflateEnd(&fStream);
+   }
+};
+
+struct R__ZlibInflateStream {
+   z_stream fStream;
+   bool fInitialized = false;
+
+   /// Prepare the stream for a new buffer of the deflate format selected by windowBits (see inflateInit2).
+   int Reset(int windowBits)
+   {
+      if (fInitialized)
+         return inflateReset(&fStream);
+      fStream.next_in = Z_NULL;
+      fStream.avail_in = 0;
+      fStream.zalloc = (alloc_func)0;
+      fStream.zfree = (free_func)0;
+      fStream.opaque = (voidpf)0;
+      int err = inflateInit2(&fStream, windowBits);
+      fInitialized = err == Z_OK;
+      return err;
+   }
+
+   ~R__ZlibInflateStream()
+   {
+      if (fInitialized)
+         inflateEnd(&fStream);
+   }
+};
+} // anonymous namespace
 
 /* ===========================================================================
    R__ZipMode is used to select the compression algorithm when R__zip is called
@@ -66,6 +109,60 @@ extern "C" void R__SetZipMode(ROOT::RCompressionSetting::EAlgorithm::EValues mod
    R__ZipMode = mode;
 }
 
+/* ===========================================================================
+   Adaptive compression: buffers whose estimated compression ratio is below
+   R__ZipMinRatio are not compressed (the caller stores them as they are), and
+   those below R__ZipLZ4Ratio, that LZ4 compresses as well, are compressed with
+   the fast LZ4 algorithm instead of the requested one. Disabled when both are 0
+   (the default).
+ */
+static double R__ZipMinRatio = 0;
+static double R__ZipLZ4Ratio = 0;
+
+extern "C" void R__SetZipAdaptive(double minRatio, double lz4Ratio)
+{
+   R__ZipMinRatio = minRatio;
+   R__ZipLZ4Ratio = lz4Ratio;
+}
+
+/* Estimate the compression ratio of a buffer from at most three slices of it, taken at its beginning, middle and
+   end: this costs a small fraction of the compression of the buffer itself. The estimate is the best of the ratio
+   of their LZ4 compression (repeated sequences) and of their byte entropy (skewed byte distribution, that the
+   entropy coding stage of zlib, LZMA or ZSTD exploits but LZ4 does not). The ratio of LZ4 alone is returned in
+   lz4Ratio. */
+static double R__EstimateZipRatio(int srcsize, char *src, double &lz4Ratio)
+{
+   const int kSliceSize = 4096;
+   thread_local std::vector<char> scratch;
+
+   const int nslices = srcsize < 3 * kSliceSize ? 1 : 3;
+   const int slice = nslices == 1 ? srcsize : kSliceSize;
+   scratch.resize(slice + HDRSIZE + 64);
+
+   long in = 0, out = 0;
+   long counts[256] = {0};
+   for (int i = 0; i < nslices; ++i) {
+      char *begin = src + (nslices == 1 ? 0 : i * (long)(srcsize - slice) / (nslices - 1));
+      int insize = slice, outsize = slice, irep = 0;
+      R__zipLZ4(1, &insize, begin, &outsize, scratch.data(), &irep);
+      in += slice;
+      out += irep > 0 ? irep : slice; // LZ4 gave up: not compressible
+      for (int j = 0; j < slice; ++j)
+         ++counts[(unsigned char)begin[j]];
+   }
+
+   double entropy = 0;
+   for (long count : counts) {
+      if (count) {
+         const double p = (double)count / in;
+         entropy -= p * log2(p);
+      }
+   }
+   lz4Ratio = (double)in / out;
+   const double entropyRatio = entropy > 0 ? 8. / entropy : lz4Ratio;
+   return lz4Ratio > entropyRatio ? lz4Ratio : entropyRatio;
+}
+
 unsigned long R__crc32(unsigned long crc, const unsigned char* buf, unsigned int len)
 {
    return crc32(crc, buf, len);
@@ -79,6 +176,15 @@ unsigned long R__crc32(unsigned long crc, const unsigned char* buf, unsigned int
 /*                      2 = lzma */
 /*                      3 = old */
 void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm)
+{
+   R__zipMultipleAlgorithmDict(cxlevel, srcsize, src, tgtsize, tgt, irep, compressionAlgorithm, nullptr, 0);
+}
+
+/* Same as R__zipMultipleAlgorithm, compressing with the dictionary dict of dictsize bytes (if any) when the */
+/* algorithm supports it (ZSTD only). The other algorithms ignore the dictionary. */
+void R__zipMultipleAlgorithmDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                                 ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm, const char *dict,
+                                 int dictsize)
 {
 
   if (*srcsize < 1 + HDRSIZE + 1) {
@@ -95,13 +201,29 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
     compressionAlgorithm = R__ZipMode;
   }
 
+  // A dictionary makes the buffer compress better than the estimate: it is its whole point.
+  if ((R__ZipMinRatio > 0 || R__ZipLZ4Ratio > 0) && !(dict && dictsize > 0) &&
+      compressionAlgorithm != ROOT::RCompressionSetting::EAlgorithm::kLZ4) {
+     double lz4Ratio = 0;
+     const double ratio = R__EstimateZipRatio(*srcsize, src, lz4Ratio);
+     if (ratio < R__ZipMinRatio) {
+        *irep = 0;
+        return;
+     }
+     // Only if LZ4 itself compresses the buffer: if the ratio comes from entropy coding, LZ4 would not get it.
+     if (ratio < R__ZipLZ4Ratio && lz4Ratio >= R__ZipMinRatio && lz4Ratio > 1) {
+        compressionAlgorithm = ROOT::RCompressionSetting::EAlgorithm::kLZ4;
+        cxlevel = 1;
+     }
+  }
+
   // The LZMA compression algorithm from the XZ package
   if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kLZMA) {
      R__zipLZMA(cxlevel, srcsize, src, tgtsize, tgt, irep);
   } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kLZ4) {
      R__zipLZ4(cxlevel, srcsize, src, tgtsize, tgt, irep);
   } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTD) {
-     R__zipZSTD(cxlevel, srcsize, src, tgtsize, tgt, irep);
+     R__zipZSTDDict(cxlevel, srcsize, src, tgtsize, tgt, irep, dict, dictsize);
   } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kOldCompressionAlgo || compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kUseGlobal) {
      R__zipOld(cxlevel, srcsize, src, tgtsize, tgt, irep);
   } else {
@@ -181,7 +303,8 @@ static void R__zipZLIB(int cxlevel, int *srcsize, char *src, int *tgtsize, char
   int err;
   int method   = Z_DEFLATED;
 
-    z_stream stream;
+    thread_local R__ZlibDeflateStream deflateStream;
+    z_stream &stream = deflateStream.fStream;
     //Don't use the globals but want name similar to help see similarities in code
     unsigned l_in_size, l_out_size;
     *irep = 0;
@@ -195,32 +318,37 @@ static void R__zipZLIB(int cxlevel, int *srcsize, char *src, int *tgtsize, char
        return;
     }
 
+    if (cxlevel > 9) cxlevel = 9;
+    if (deflateStream.fLevel == cxlevel) {
+       deflateReset(&stream);
+    } else {
+       if (deflateStream.fLevel >= 0)
+          deflateEnd(&stream);
+       deflateStream.fLevel = -1;
+       stream.zalloc    = (alloc_func)0;
+       stream.zfree     = (free_func)0;
+       stream.opaque    = (voidpf)0;
+       err = deflateInit(&stream, cxlevel);
+       if (err != Z_OK) {
+          printf("error %d in deflateInit (zlib)\n",err);
+          return;
+       }
+       deflateStream.fLevel = cxlevel;
+    }
+
     stream.next_in   = (Bytef*)src;
     stream.avail_in  = (uInt)(*srcsize);
 
     stream.next_out  = (Bytef*)(&tgt[HDRSIZE]);
     stream.avail_out = (uInt)(*tgtsize);
 
-    stream.zalloc    = (alloc_func)0;
-    stream.zfree     = (free_func)0;
-    stream.opaque    = (voidpf)0;
-
-    if (cxlevel > 9) cxlevel = 9;
-    err = deflateInit(&stream, cxlevel);
-    if (err != Z_OK) {
-       printf("error %d in deflateInit (zlib)\n",err);
-       return;
-    }
-
     while ((err = deflate(&stream, Z_FINISH)) != Z_STREAM_END) {
        if (err != Z_OK) {
-          deflateEnd(&stream);
+          // The stream is reset before the next buffer.
           return;
        }
     }
 
-    err = deflateEnd(&stream);
-
     tgt[0] = 'Z';               /* Signature ZLib */
     tgt[1] = 'L';
     tgt[2] = (char) method;
@@ -271,7 +399,19 @@ static int is_valid_header_lz4(unsigned char *src)
 
 static int is_valid_header_zstd(unsigned char *src)
 {
-   return src[0] == 'Z' && src[1] == 'S' && src[2] == '\1';
+   return src[0] == 'Z' && (src[1] == 'S' || src[1] == 'D') && src[2] == '\1';
+}
+
+int R__unzip_needs_dict(unsigned char *src)
+{
+   // Buffers compressed by ZSTD with a dictionary.
+   return src[0] == 'Z' && src[1] == 'D' && src[2] == '\1';
+}
+
+int R__trainZSTDDictionary(const char *samples, const size_t *sampleSizes, unsigned int nsamples, char *dict,
+                           int dictsize)
+{
+   return R__trainZSTDDict(samples, sampleSizes, nsamples, dict, dictsize);
 }
 
 static int is_valid_header(unsigned char *src)
@@ -321,6 +461,12 @@ int R__unzip_header(int *srcsize, uch *src, int *tgtsize)
 // N.B. (Brian) - I have kept the original note out of complete awe of the
 // age of the original code...
 void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
+{
+   R__unzipDict(srcsize, src, tgtsize, tgt, irep, nullptr, 0);
+}
+
+// Same as R__unzip, for buffers that might have been compressed with the dictionary dict of dictsize bytes.
+void R__unzipDict(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep, const char *dict, int dictsize)
 {
    long isize;
    uch *ibufptr, *obufptr;
@@ -368,11 +514,15 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
       R__unzipLZ4(srcsize, src, tgtsize, tgt, irep);
       return;
    } else if (is_valid_header_zstd(src)) {
-      R__unzipZSTD(srcsize, src, tgtsize, tgt, irep);
+      R__unzipZSTDDict(srcsize, src, tgtsize, tgt, irep, dict, dictsize);
       return;
    }
 
    /* Old zlib format */
+   if (R__unzipOldZLIB(ibufptr, ibufcnt, tgt, obufcnt, isize)) {
+      *irep = isize;
+      return;
+   }
    if (R__Inflate(&ibufptr, &ibufcnt, &obufptr, &obufcnt)) {
       fprintf(stderr, "R__unzip: error during decompression\n");
       return;
@@ -392,33 +542,52 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
 
 void R__unzipZLIB(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-     z_stream stream; /* decompression stream */
+     thread_local R__ZlibInflateStream inflateStream;
+     z_stream &stream = inflateStream.fStream; /* decompression stream */
      int err = 0;
 
-     stream.next_in = (Bytef *)(&src[HDRSIZE]);
-     stream.avail_in = (uInt)(*srcsize) - HDRSIZE;
-     stream.next_out = (Bytef *)tgt;
-     stream.avail_out = (uInt)(*tgtsize);
-     stream.zalloc = (alloc_func)0;
-     stream.zfree = (free_func)0;
-     stream.opaque = (voidpf)0;
-
-     err = inflateInit(&stream);
+     err = inflateStream.Reset(MAX_WBITS);
      if (err != Z_OK) {
         fprintf(stderr, "R__unzip: error %d in inflateInit (zlib)\n", err);
         return;
      }
 
+     stream.next_in = (Bytef *)(&src[HDRSIZE]);
+     stream.avail_in = (uInt)(*srcsize) - HDRSIZE;
+     stream.next_out = (Bytef *)tgt;
+     stream.avail_out = (uInt)(*tgtsize);
+
      while ((err = inflate(&stream, Z_FINISH)) != Z_STREAM_END) {
         if (err != Z_OK) {
-           inflateEnd(&stream);
+           // The stream is reset before the next buffer.
            fprintf(stderr, "R__unzip: error %d in inflate (zlib)\n", err);
            return;
         }
      }
 
-     inflateEnd(&stream);
-
      *irep = stream.total_out;
      return;
 }
+
+/**
+ * The old ROOT format is a raw deflate stream: decode it with zlib, whose inflate (and the SIMD-optimized builtin
+ * zlib in particular) is much faster than R__Inflate. Returns 1 if the buffer was decoded to its isize bytes, 0
+ * otherwise, in which case the caller falls back to R__Inflate.
+ */
+static int R__unzipOldZLIB(unsigned char *src, long srcsize, unsigned char *tgt, long tgtsize, long isize)
+{
+   thread_local R__ZlibInflateStream rawInflateStream;
+   z_stream &stream = rawInflateStream.fStream;
+
+   if (rawInflateStream.Reset(-MAX_WBITS) != Z_OK)
+      return 0;
+
+   stream.next_in = (Bytef *)src;
+   stream.avail_in = (uInt)srcsize;
+   stream.next_out = (Bytef *)tgt;
+   stream.avail_out = (uInt)tgtsize;
+
+   if (inflate(&stream, Z_FINISH) != Z_STREAM_END)
+      return 0;
+   return (long)stream.total_out == isize;
+}
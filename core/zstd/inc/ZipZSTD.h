@@ -9,11 +9,18 @@
 
 // NOTE: the ROOT compression libraries aren't consistently written in C++; hence the
 // #ifdef's to avoid problems with C code.
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+void R__zipZSTDDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, const char *dict,
+                    int dictsize);
+void R__unzipZSTDDict(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep, const char *dict,
+                      int dictsize);
+int R__trainZSTDDict(const char *samples, const size_t *sampleSizes, unsigned int nsamples, char *dict, int dictsize);
 #ifdef __cplusplus
 }
 #endif
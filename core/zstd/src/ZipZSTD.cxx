@@ -22,17 +22,45 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
+namespace {
+// Creating a context allocates several hundreds of kB: each thread reuses its own for all its buffers.
+ZSTD_CCtx *GetCompressionContext()
+{
+    thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> ctx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    return ctx.get();
+}
+
+ZSTD_DCtx *GetDecompressionContext()
+{
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> ctx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    return ctx.get();
+}
+} // anonymous namespace
+
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
-    Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    R__zipZSTDDict(cxlevel, srcsize, src, tgtsize, tgt, irep, nullptr, 0);
+}
+
+/// Compress with a dictionary shared by several buffers; the buffer is then tagged 'ZD' instead of 'ZS', so that it
+/// is never decompressed without its dictionary. Without a dictionary, this is R__zipZSTD.
+void R__zipZSTDDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, const char *dict,
+                    int dictsize)
+{
+    ZSTD_CCtx *ctx = GetCompressionContext();
 
     *irep = 0;
+    if (R__unlikely(!ctx)) {
+        std::cerr << "Error in zip ZSTD: cannot allocate the compression context." << std::endl;
+        return;
+    }
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    const bool useDict = dict && dictsize > 0;
+    size_t retval = ZSTD_compress_usingDict(ctx,
+                                            &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                            src, static_cast<size_t>(*srcsize),
+                                            useDict ? dict : nullptr, useDict ? static_cast<size_t>(dictsize) : 0,
+                                            2*cxlevel);
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -48,7 +76,7 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
     size_t deflate_size = retval;
     size_t inflate_size = static_cast<size_t>(*srcsize);
     tgt[0] = 'Z';
-    tgt[1] = 'S';
+    tgt[1] = useDict ? 'D' : 'S';
     tgt[2] = '\1';
     tgt[3] = deflate_size & 0xff;
     tgt[4] = (deflate_size >> 8) & 0xff;
@@ -60,13 +88,28 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
 
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
-    Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    R__unzipZSTDDict(srcsize, src, tgtsize, tgt, irep, nullptr, 0);
+}
+
+void R__unzipZSTDDict(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep, const char *dict,
+                      int dictsize)
+{
+    ZSTD_DCtx *ctx = GetDecompressionContext();
     *irep = 0;
+    if (R__unlikely(!ctx)) {
+        std::cerr << "Error in unzip ZSTD: cannot allocate the decompression context." << std::endl;
+        return;
+    }
 
-    if (R__unlikely(src[0] != 'Z' || src[1] != 'S')) {
+    if (R__unlikely(src[0] != 'Z' || (src[1] != 'S' && src[1] != 'D'))) {
       std::cerr << "R__unzipZSTD: algorithm run against buffer with incorrect header (got " <<
-      src[0] << src[1] << "; expected ZS)." << std::endl;
+      src[0] << src[1] << "; expected ZS or ZD)." << std::endl;
+      return;
+    }
+
+    const bool useDict = src[1] == 'D';
+    if (R__unlikely(useDict && (!dict || dictsize <= 0))) {
+      std::cerr << "R__unzipZSTD: buffer was compressed with a dictionary, which was not provided." << std::endl;
       return;
     }
 
@@ -77,9 +120,10 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    size_t retval = ZSTD_decompress_usingDict(ctx,
+                                              (char *)tgt, static_cast<size_t>(*tgtsize),
+                                              (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize),
+                                              useDict ? dict : nullptr, useDict ? static_cast<size_t>(dictsize) : 0);
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
@@ -95,3 +139,15 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
         *irep = retval;
     }
 }
+
+/// Train a dictionary from the concatenated samples; return its size, or 0 if the samples were not sufficient
+/// (typically, too few or too small) to train one.
+int R__trainZSTDDict(const char *samples, const size_t *sampleSizes, unsigned int nsamples, char *dict, int dictsize)
+{
+    if (!samples || !nsamples || dictsize <= 0)
+        return 0;
+    size_t retval = ZDICT_trainFromBuffer(dict, static_cast<size_t>(dictsize), samples, sampleSizes, nsamples);
+    if (ZDICT_isError(retval))
+        return 0;
+    return static_cast<int>(retval);
+}
@@ -0,0 +1,48 @@
+// @(#)root/geom:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TGeoBVHFinder
+#define ROOT_TGeoBVHFinder
+
+#include "TGeoVoxelFinder.h"
+
+#include <vector>
+
+class TGeoBVHFinder : public TGeoVoxelFinder
+{
+private:
+   TGeoBVHFinder(const TGeoBVHFinder&) = delete;
+   TGeoBVHFinder& operator=(const TGeoBVHFinder&) = delete;
+
+protected:
+   std::vector<Double_t> fBVHBounds;  // 6 limits per node: xmin, ymin, zmin, xmax, ymax, zmax
+   std::vector<Int_t>    fBVHNodes;   // 2 values per node: first item and number of items for leaves, right child and 0 otherwise
+   std::vector<Int_t>    fBVHItems;   // daughter indices, contiguous for each leaf
+
+   Int_t               BuildNode(Int_t first, Int_t nitems, Int_t depth);
+   void                ComputeBounds(Int_t first, Int_t nitems, Double_t *bounds) const;
+
+public :
+   TGeoBVHFinder();
+   TGeoBVHFinder(TGeoVolume *vol);
+   virtual ~TGeoBVHFinder();
+   virtual Double_t    Efficiency();
+   virtual Int_t      *GetCheckList(const Double_t *point, Int_t &nelem, TGeoStateInfo &td);
+   virtual Int_t      *GetNextCandidates(const Double_t *point, Int_t &ncheck, TGeoStateInfo &td);
+   Int_t               GetNnodes() const {return (Int_t)fBVHNodes.size()/2;}
+   virtual Int_t      *GetNextVoxel(const Double_t *point, const Double_t *dir, Int_t &ncheck, TGeoStateInfo &td);
+   virtual void        Print(Option_t *option="") const;
+   virtual void        SortCrossedVoxels(const Double_t *point, const Double_t *dir, TGeoStateInfo &td);
+   virtual void        Voxelize(Option_t *option="");
+
+   ClassDef(TGeoBVHFinder, 1)                // bounding volume hierarchy finder class
+};
+
+#endif
@@ -12,6 +12,7 @@
 #ifndef ROOT_TGeoManager
 #define ROOT_TGeoManager
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 
@@ -49,6 +50,7 @@ public:
 
 protected:
    static std::mutex     fgMutex;           //! mutex for navigator booking in MT mode
+   static std::atomic<UInt_t> fgNavigatorsVersion; //! changed with the navigators, invalidates the thread caches of current navigators
    static Bool_t         fgLock;            //! Lock preventing a second geometry to be loaded
    static Int_t          fgVerboseLevel;    //! Verbosity level for Info messages (no IO).
    static Int_t          fgMaxLevel;        //! Maximum level in geometry
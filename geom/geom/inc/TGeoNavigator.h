@@ -16,6 +16,8 @@
 
 #include "TGeoCache.h"
 
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////////////
 //                                                                        //
 // TGeoNavigator - Class containing the implementation of all navigation  //
@@ -83,6 +85,7 @@ private :
    TGeoHMatrix          *fGlobalMatrix;     //! current pointer to cached global matrix
    TGeoHMatrix          *fDivMatrix;        //! current local matrix of the selected division cell
    TString               fPath;             //! path to current node
+   std::vector<Double_t> fBasket;           //! local points, directions and distances of FindNextBoundary_v
 
 public :
    TGeoNavigator();
@@ -107,6 +110,7 @@ public :
    TGeoNode              *FindNextBoundary(Double_t stepmax=TGeoShape::Big(),const char *path="", Bool_t frombdr=kFALSE);
    TGeoNode              *FindNextDaughterBoundary(Double_t *point, Double_t *dir, Int_t &idaughter, Bool_t compmatrix=kFALSE);
    TGeoNode              *FindNextBoundaryAndStep(Double_t stepmax=TGeoShape::Big(), Bool_t compsafe=kFALSE);
+   void                   FindNextBoundary_v(Int_t ntracks, const Double_t *points, const Double_t *dirs, Double_t *steps, Int_t *idaughters);
    TGeoNode              *FindNode(Bool_t safe_start=kTRUE);
    TGeoNode              *FindNode(Double_t x, Double_t y, Double_t z);
    Double_t              *FindNormal(Bool_t forward=kTRUE);
@@ -146,6 +146,7 @@ public:
    Bool_t          IsSelected() const  {return TObject::TestBit(kVolumeSelected);}
    Bool_t          IsCylVoxels() const {return TObject::TestBit(kVoxelsCyl);}
    Bool_t          IsXYZVoxels() const {return TObject::TestBit(kVoxelsXYZ);}
+   Bool_t          IsUsingBVH() const {return TGeoAtt::TestAttBit(kUseBVH);}
    Bool_t          IsTopVolume() const;
    Bool_t          IsValid() const {return fShape->IsValid();}
    virtual Bool_t  IsVisible() const {return TGeoAtt::IsVisible();}
@@ -209,6 +210,7 @@ public:
    void            SetReplicated() {TObject::SetBit(kVolumeReplicated);}
    void            SetCurrentPoint(Double_t x, Double_t y, Double_t z);
    void            SetCylVoxels(Bool_t flag=kTRUE) {TObject::SetBit(kVoxelsCyl, flag); TObject::SetBit(kVoxelsXYZ, !flag);}
+   void            SetUseBVH(Bool_t flag=kTRUE) {TGeoAtt::SetAttBit(kUseBVH, flag);}
    void            SetNodes(TObjArray *nodes) {fNodes = nodes; TObject::SetBit(kVolumeImportNodes);}
    void            SetOverlappingCandidate(Bool_t flag) {TObject::SetBit(kVolumeOC,flag);}
    void            SetShape(const TGeoShape *shape);
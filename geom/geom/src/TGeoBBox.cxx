@@ -1052,7 +1052,12 @@ void TGeoBBox::FillBuffer3D(TBuffer3D & buffer, Int_t reqSections, Bool_t localF
 
 void TGeoBBox::Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const
 {
-   for (Int_t i=0; i<vecsize; i++) inside[i] = Contains(&points[3*i]);
+   const Double_t ox = fOrigin[0], oy = fOrigin[1], oz = fOrigin[2];
+   const Double_t dx = fDX, dy = fDY, dz = fDZ;
+   for (Int_t i=0; i<vecsize; i++) {
+      const Double_t *point = &points[3*i];
+      inside[i] = (TMath::Abs(point[0]-ox) <= dx) & (TMath::Abs(point[1]-oy) <= dy) & (TMath::Abs(point[2]-oz) <= dz);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1067,18 +1072,60 @@ void TGeoBBox::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute distance from array of input points having directions specified by dirs. Store output in dists
+/// Same result as DistFromInside(point, dir, 3), computed without branches for all
+/// the points so that the loop can be vectorized.
 
-void TGeoBBox::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
+void TGeoBBox::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* /*step*/) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+   const Double_t par[3] = {fDX, fDY, fDZ};
+   const Double_t big = TGeoShape::Big();
+   for (Int_t i=0; i<vecsize; i++) {
+      Double_t smin = big;
+      for (Int_t j=0; j<3; j++) {
+         const Double_t newpt = points[3*i+j] - fOrigin[j];
+         const Double_t dir = dirs[3*i+j];
+         // distance to the plane in front, no crossing for a null direction
+         const Double_t s = ((dir > 0) ? (par[j] - newpt) : (-par[j] - newpt)) / ((dir != 0) ? dir : 1.);
+         smin = (dir != 0 && s < smin) ? s : smin;
+      }
+      dists[i] = (smin < 0) ? 0. : smin;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute distance from array of input points having directions specified by dirs. Store output in dists
+/// Same result as DistFromOutside(point, dir, 3, step), computed without branches for all
+/// the points so that the loop can be vectorized.
 
 void TGeoBBox::DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+   const Double_t par[3] = {fDX, fDY, fDZ};
+   const Double_t big = TGeoShape::Big();
+   for (Int_t i=0; i<vecsize; i++) {
+      Double_t newpt[3], saf[3];
+      Bool_t toofar = kFALSE, in = kTRUE;
+      for (Int_t j=0; j<3; j++) {
+         newpt[j] = points[3*i+j] - fOrigin[j];
+         saf[j] = TMath::Abs(newpt[j]) - par[j];
+         toofar |= (saf[j] >= step[i]);
+         in &= (saf[j] <= 0);
+      }
+      // point inside: 0, unless it is exiting through the closest face
+      const Int_t jmax = (saf[1] > saf[0]) ? ((saf[2] > saf[1]) ? 2 : 1) : ((saf[2] > saf[0]) ? 2 : 0);
+      const Double_t sinside = (newpt[jmax]*dirs[3*i+jmax] > 0) ? big : 0.;
+      // point outside: smallest distance to one of the faces seen from the point, landing on the face
+      Double_t snxt = big;
+      for (Int_t j=0; j<3; j++) {
+         const Double_t dir = dirs[3*i+j];
+         const Bool_t facing = (saf[j] >= 0) & (newpt[j]*dir < 0);
+         const Double_t s = saf[j] / (facing ? TMath::Abs(dir) : 1.);
+         const Int_t j1 = (j+1) % 3, j2 = (j+2) % 3;
+         const Bool_t hit = facing & (TMath::Abs(newpt[j1] + s*dirs[3*i+j1]) <= par[j1]) &
+                            (TMath::Abs(newpt[j2] + s*dirs[3*i+j2]) <= par[j2]);
+         snxt = (hit && s < snxt) ? s : snxt;
+      }
+      dists[i] = toofar ? big : (in ? sinside : snxt);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1088,5 +1135,12 @@ void TGeoBBox::DistFromOutside_v(const Double_t *points, const Double_t *dirs, D
 
 void TGeoBBox::Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const
 {
-   for (Int_t i=0; i<vecsize; i++) safe[i] = Safety(&points[3*i], inside[i]);
+   const Double_t par[3] = {fDX, fDY, fDZ};
+   for (Int_t i=0; i<vecsize; i++) {
+      // distances to the planes, positive inside the box
+      Double_t d[3];
+      for (Int_t j=0; j<3; j++) d[j] = par[j] - TMath::Abs(points[3*i+j] - fOrigin[j]);
+      const Double_t dmin = TMath::Min(d[0], TMath::Min(d[1], d[2]));
+      safe[i] = inside[i] ? dmin : -dmin;
+   }
 }
@@ -0,0 +1,366 @@
+// @(#)root/geom:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TGeoBVHFinder
+\ingroup Geometry_classes
+
+Finder class handling the daughters of a volume with a bounding volume hierarchy.
+
+The bounding boxes of the daughters (the same as used by TGeoVoxelFinder) are
+grouped in a binary tree of boxes, built with the surface area heuristic. The
+candidates containing a point, or crossed by a ray, are found by visiting only
+the branches of the tree containing the point or crossed by the ray. Contrary to
+the slices of TGeoVoxelFinder, the number of candidates does not depend on the
+alignment of the daughters with the axes, which is much better for volumes with
+many daughters placed irregularly or rotated, like the cells of a calorimeter.
+The tree is also faster to build for thousands of daughters.
+
+The finder is used instead of the voxels for the volumes flagged with
+TGeoVolume::SetUseBVH():
+
+~~~ {.cpp}
+calorimeter->SetUseBVH();
+gGeoManager->CloseGeometry();
+~~~
+*/
+
+#include "TGeoBVHFinder.h"
+
+#include "TGeoShape.h"
+#include "TGeoNode.h"
+#include "TGeoVolume.h"
+#include "TGeoStateInfo.h"
+#include "TMath.h"
+
+#include <algorithm>
+#include <numeric>
+
+ClassImp(TGeoBVHFinder);
+
+namespace {
+
+const Int_t kMaxLeafItems = 4;   // leaves are not split below this number of daughters
+const Int_t kMaxDepth = 48;      // maximum depth of the tree, also limiting the traversal stacks
+
+/// Half of the surface of the box with limits (xmin, ymin, zmin, xmax, ymax, zmax)
+Double_t HalfArea(const Double_t *b)
+{
+   Double_t dx = b[3]-b[0], dy = b[4]-b[1], dz = b[5]-b[2];
+   return dx*dy + dy*dz + dz*dx;
+}
+
+/// Extend the limits b to contain the daughter box (dx, dy, dz, ox, oy, oz)
+void Extend(Double_t *b, const Double_t *box)
+{
+   for (Int_t j=0; j<3; j++) {
+      b[j] = TMath::Min(b[j], box[j+3]-box[j]);
+      b[j+3] = TMath::Max(b[j+3], box[j+3]+box[j]);
+   }
+}
+
+void ResetBounds(Double_t *b)
+{
+   b[0] = b[1] = b[2] = TGeoShape::Big();
+   b[3] = b[4] = b[5] = -TGeoShape::Big();
+}
+
+Bool_t ContainsPoint(const Double_t *point, const Double_t *lo, const Double_t *hi)
+{
+   return (point[0]>=lo[0]) && (point[0]<=hi[0]) && (point[1]>=lo[1]) && (point[1]<=hi[1]) &&
+          (point[2]>=lo[2]) && (point[2]<=hi[2]);
+}
+
+/// Check if the ray from point along dir crosses the box with limits lo and hi
+Bool_t CrossesBox(const Double_t *point, const Double_t *dir, const Double_t *lo, const Double_t *hi)
+{
+   Double_t tmin = 0., tmax = TGeoShape::Big();
+   for (Int_t j=0; j<3; j++) {
+      if (dir[j] == 0) {
+         if (point[j]<lo[j] || point[j]>hi[j]) return kFALSE;
+         continue;
+      }
+      Double_t invdir = 1./dir[j];
+      Double_t t1 = (lo[j]-point[j])*invdir;
+      Double_t t2 = (hi[j]-point[j])*invdir;
+      if (t1 > t2) std::swap(t1, t2);
+      if (t1 > tmin) tmin = t1;
+      if (t2 < tmax) tmax = t2;
+      if (tmin > tmax + TGeoShape::Tolerance()) return kFALSE;
+   }
+   return kTRUE;
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Default constructor
+
+TGeoBVHFinder::TGeoBVHFinder() : TGeoVoxelFinder()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor for the daughters of the volume vol
+
+TGeoBVHFinder::TGeoBVHFinder(TGeoVolume *vol) : TGeoVoxelFinder(vol)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor
+
+TGeoBVHFinder::~TGeoBVHFinder()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the limits of the boxes of nitems daughters starting at first in the items list
+
+void TGeoBVHFinder::ComputeBounds(Int_t first, Int_t nitems, Double_t *bounds) const
+{
+   ResetBounds(bounds);
+   for (Int_t i=first; i<first+nitems; i++) Extend(bounds, &fBoxes[6*fBVHItems[i]]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the node for nitems daughters starting at first in the items list, and its children.
+/// The items are split along the axis and at the position minimizing the surface area
+/// heuristic cost, the left child being stored right after its parent. Returns the node index.
+
+Int_t TGeoBVHFinder::BuildNode(Int_t first, Int_t nitems, Int_t depth)
+{
+   Int_t inode = GetNnodes();
+   fBVHNodes.push_back(first);
+   fBVHNodes.push_back(nitems);
+   Double_t bounds[6];
+   ComputeBounds(first, nitems, bounds);
+   fBVHBounds.insert(fBVHBounds.end(), bounds, bounds+6);
+   if (nitems <= kMaxLeafItems || depth >= kMaxDepth) return inode;
+
+   Int_t *items = &fBVHItems[first];
+   auto sortAlong = [this, items, nitems](Int_t axis) {
+      std::sort(items, items+nitems, [this, axis](Int_t a, Int_t b) {
+         return fBoxes[6*a+3+axis] < fBoxes[6*b+3+axis];
+      });
+   };
+   // cost of a leaf compared with the one of the best split, the traversal cost being one box
+   Double_t area = HalfArea(bounds);
+   Double_t bestcost = nitems;
+   Int_t bestaxis = -1, bestsplit = nitems/2;
+   std::vector<Double_t> rightarea(nitems);
+   Double_t b[6];
+   for (Int_t axis=0; axis<3; axis++) {
+      sortAlong(axis);
+      ResetBounds(b);
+      for (Int_t i=nitems-1; i>0; i--) {
+         Extend(b, &fBoxes[6*items[i]]);
+         rightarea[i] = HalfArea(b);
+      }
+      ResetBounds(b);
+      for (Int_t i=1; i<nitems; i++) {
+         Extend(b, &fBoxes[6*items[i-1]]);
+         Double_t cost = (area > 0) ? 1. + (HalfArea(b)*i + rightarea[i]*(nitems-i))/area : nitems;
+         if (cost < bestcost) {
+            bestcost = cost;
+            bestaxis = axis;
+            bestsplit = i;
+         }
+      }
+   }
+   // no split is better than a leaf, unless the leaf is large: split in the middle of the largest extent
+   if (bestaxis < 0) {
+      if (nitems <= 4*kMaxLeafItems) return inode;
+      bestaxis = 0;
+      for (Int_t axis=1; axis<3; axis++)
+         if (bounds[axis+3]-bounds[axis] > bounds[bestaxis+3]-bounds[bestaxis]) bestaxis = axis;
+      bestsplit = nitems/2;
+   }
+   sortAlong(bestaxis);
+
+   BuildNode(first, bestsplit, depth+1);
+   Int_t right = BuildNode(first+bestsplit, nitems-bestsplit, depth+1);
+   fBVHNodes[2*inode] = right;
+   fBVHNodes[2*inode+1] = 0;
+   return inode;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the characteristics of the tree and return the inverse of the mean
+/// number of daughters per leaf.
+
+Double_t TGeoBVHFinder::Efficiency()
+{
+   printf("BVH efficiency for %s\n", fVolume->GetName());
+   if (NeedRebuild()) {
+      Voxelize();
+      fVolume->FindOverlaps();
+   }
+   Int_t nnodes = GetNnodes();
+   Int_t nleaves = 0;
+   for (Int_t inode=0; inode<nnodes; inode++)
+      if (fBVHNodes[2*inode+1]) nleaves++;
+   if (!nleaves) return 0.;
+   Double_t meanitems = Double_t(fBVHItems.size())/nleaves;
+   printf("Nodes : %d, leaves : %d, daughters per leaf : %g\n", nnodes, nleaves, meanitems);
+   return 1./meanitems;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the list of daughters whose bounding box contains the point
+
+Int_t *TGeoBVHFinder::GetCheckList(const Double_t *point, Int_t &nelem, TGeoStateInfo &td)
+{
+   if (NeedRebuild()) {
+      Voxelize();
+      fVolume->FindOverlaps();
+   }
+   nelem = 0;
+   td.fVoxNcandidates = 0;
+   if (fBVHNodes.empty()) return 0;
+   Int_t stack[kMaxDepth+1];
+   Int_t nstack = 0;
+   Int_t inode = 0;
+   while (kTRUE) {
+      const Double_t *b = &fBVHBounds[6*inode];
+      if (ContainsPoint(point, b, b+3)) {
+         Int_t n = fBVHNodes[2*inode+1];
+         if (!n) {
+            stack[nstack++] = fBVHNodes[2*inode];
+            inode++;
+            continue;
+         }
+         for (Int_t i=fBVHNodes[2*inode]; i<fBVHNodes[2*inode]+n; i++) {
+            const Double_t *box = &fBoxes[6*fBVHItems[i]];
+            const Double_t lo[3] = {box[3]-box[0], box[4]-box[1], box[5]-box[2]};
+            const Double_t hi[3] = {box[3]+box[0], box[4]+box[1], box[5]+box[2]};
+            if (ContainsPoint(point, lo, hi)) td.fVoxCheckList[nelem++] = fBVHItems[i];
+         }
+      }
+      if (!nstack) break;
+      inode = stack[--nstack];
+   }
+   if (!nelem) return 0;
+   // same order as for the voxels
+   std::sort(td.fVoxCheckList, td.fVoxCheckList+nelem);
+   td.fVoxNcandidates = nelem;
+   return td.fVoxCheckList;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Not used with the tree: all the crossed candidates are returned by GetNextVoxel()
+
+Int_t *TGeoBVHFinder::GetNextCandidates(const Double_t * /*point*/, Int_t &ncheck, TGeoStateInfo & /*td*/)
+{
+   ncheck = 0;
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the list of daughters crossed by the ray computed by SortCrossedVoxels()
+/// on the first call, then 0.
+
+Int_t *TGeoBVHFinder::GetNextVoxel(const Double_t * /*point*/, const Double_t * /*dir*/, Int_t &ncheck, TGeoStateInfo &td)
+{
+   ncheck = 0;
+   if (td.fVoxCurrent > 0 || !td.fVoxNcandidates) return 0;
+   td.fVoxCurrent = 1;
+   ncheck = td.fVoxNcandidates;
+   return td.fVoxCheckList;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the tree
+
+void TGeoBVHFinder::Print(Option_t *) const
+{
+   if (NeedRebuild()) {
+      TGeoBVHFinder *vox = (TGeoBVHFinder*)this;
+      vox->Voxelize();
+      fVolume->FindOverlaps();
+   }
+   printf("BVH for volume %s (nd=%i)\n", fVolume->GetName(), fVolume->GetNdaughters());
+   for (Int_t inode=0; inode<GetNnodes(); inode++) {
+      const Double_t *b = &fBVHBounds[6*inode];
+      printf("node %i : x=[%g, %g] y=[%g, %g] z=[%g, %g]", inode, b[0], b[3], b[1], b[4], b[2], b[5]);
+      Int_t n = fBVHNodes[2*inode+1];
+      if (!n) {
+         printf(" children %i %i\n", inode+1, fBVHNodes[2*inode]);
+         continue;
+      }
+      printf(" daughters");
+      for (Int_t i=fBVHNodes[2*inode]; i<fBVHNodes[2*inode]+n; i++) printf(" %i", fBVHItems[i]);
+      printf("\n");
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the list of daughters whose bounding box is crossed by the ray
+/// starting at point along dir, returned by the next call to GetNextVoxel()
+
+void TGeoBVHFinder::SortCrossedVoxels(const Double_t *point, const Double_t *dir, TGeoStateInfo &td)
+{
+   if (NeedRebuild()) {
+      Voxelize();
+      fVolume->FindOverlaps();
+   }
+   td.fVoxCurrent = 0;
+   td.fVoxNcandidates = 0;
+   if (fBVHNodes.empty()) return;
+   Int_t nelem = 0;
+   Int_t stack[kMaxDepth+1];
+   Int_t nstack = 0;
+   Int_t inode = 0;
+   while (kTRUE) {
+      const Double_t *b = &fBVHBounds[6*inode];
+      if (CrossesBox(point, dir, b, b+3)) {
+         Int_t n = fBVHNodes[2*inode+1];
+         if (!n) {
+            stack[nstack++] = fBVHNodes[2*inode];
+            inode++;
+            continue;
+         }
+         for (Int_t i=fBVHNodes[2*inode]; i<fBVHNodes[2*inode]+n; i++) {
+            const Double_t *box = &fBoxes[6*fBVHItems[i]];
+            const Double_t lo[3] = {box[3]-box[0], box[4]-box[1], box[5]-box[2]};
+            const Double_t hi[3] = {box[3]+box[0], box[4]+box[1], box[5]+box[2]};
+            if (CrossesBox(point, dir, lo, hi)) td.fVoxCheckList[nelem++] = fBVHItems[i];
+         }
+      }
+      if (!nstack) break;
+      inode = stack[--nstack];
+   }
+   std::sort(td.fVoxCheckList, td.fVoxCheckList+nelem);
+   td.fVoxNcandidates = nelem;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the tree for the daughters of the attached volume
+
+void TGeoBVHFinder::Voxelize(Option_t * /*option*/)
+{
+   if (fVolume->IsAssembly()) fVolume->GetShape()->ComputeBBox();
+   Int_t nd = fVolume->GetNdaughters();
+   TGeoVolume *vd;
+   for (Int_t i=0; i<nd; i++) {
+      vd = fVolume->GetNode(i)->GetVolume();
+      if (vd->IsAssembly()) vd->GetShape()->ComputeBBox();
+   }
+   BuildVoxelLimits();
+   fBVHItems.resize(nd);
+   std::iota(fBVHItems.begin(), fBVHItems.end(), 0);
+   fBVHNodes.clear();
+   fBVHBounds.clear();
+   if (nd) {
+      fBVHNodes.reserve(4*nd);
+      fBVHBounds.reserve(12*nd);
+      BuildNode(0, nd, 0);
+   }
+   SetNeedRebuild(kFALSE);
+}
@@ -292,6 +292,7 @@ TGeoManager *gGeoManager = 0;
 ClassImp(TGeoManager);
 
 std::mutex TGeoManager::fgMutex;
+std::atomic<UInt_t> TGeoManager::fgNavigatorsVersion{0};
 Bool_t TGeoManager::fgLock            = kFALSE;
 Bool_t TGeoManager::fgLockNavigators  = kFALSE;
 Int_t  TGeoManager::fgVerboseLevel    = 1;
@@ -728,25 +729,33 @@ TGeoNavigator *TGeoManager::AddNavigator()
    }
    TGeoNavigator *nav = array->AddNavigator();
    if (fClosed) nav->GetCache()->BuildInfoBranch();
+   fgNavigatorsVersion++;
    if (fMultiThread) fgMutex.unlock();
    return nav;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns current navigator for the calling thread.
+/// In multi-threaded mode, the navigator is kept in thread-local storage and
+/// returned without locking as long as no navigator of this or another thread
+/// was added, removed or switched, e.g. all along the transport of the tracks.
 
 TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 {
-   TTHREAD_TLS(TGeoNavigator*) tnav = 0;
    if (!fMultiThread) return fCurrentNavigator;
-   TGeoNavigator *nav = tnav; // TTHREAD_TLS_GET(TGeoNavigator*,tnav);
-   if (nav) return nav;
+   TTHREAD_TLS(const TGeoManager*) tmanager = 0;
+   TTHREAD_TLS(UInt_t) tversion = 0;
+   TTHREAD_TLS(TGeoNavigator*) tnav = 0;
+   UInt_t version = fgNavigatorsVersion.load(std::memory_order_acquire);
+   if (tmanager == this && tversion == version) return tnav;
+   // navigators were changed: find the current one, the map may be modified by other threads
+   std::lock_guard<std::mutex> guard(fgMutex);
    std::thread::id threadId = std::this_thread::get_id();
    NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) return 0;
-   TGeoNavigatorArray *array = it->second;
-   nav = array->GetCurrentNavigator();
-   tnav = nav; // TTHREAD_TLS_SET(TGeoNavigator*,tnav,nav);
+   TGeoNavigator *nav = (it == fNavigators.end()) ? 0 : it->second->GetCurrentNavigator();
+   tmanager = this;
+   tversion = version;
+   tnav = nav;
    return nav;
 }
 
@@ -782,6 +791,7 @@ Bool_t TGeoManager::SetCurrentNavigator(Int_t index)
       return kFALSE;
    }
    if (!fMultiThread) fCurrentNavigator = nav;
+   fgNavigatorsVersion++;
    return kTRUE;
 }
 
@@ -806,6 +816,7 @@ void TGeoManager::ClearNavigators()
       if (arr) delete arr;
    }
    fNavigators.clear();
+   fgNavigatorsVersion++;
    if (fMultiThread) fgMutex.unlock();
 }
 
@@ -821,6 +832,7 @@ void TGeoManager::RemoveNavigator(const TGeoNavigator *nav)
          if ((TGeoNavigator*)arr->Remove((TObject*)nav)) {
             delete nav;
             if (!arr->GetEntries()) fNavigators.erase(it);
+            fgNavigatorsVersion++;
             if (fMultiThread) fgMutex.unlock();
             return;
          }
@@ -909,14 +921,17 @@ Int_t TGeoManager::ThreadId()
    if (ttid > -1) return ttid;
    if (gGeoManager && !gGeoManager->IsMultiThread()) return 0;
    std::thread::id threadId = std::this_thread::get_id();
+   // the map may be updated by other threads, the calling one uses its thread-local number afterwards
+   std::lock_guard<std::mutex> guard(fgMutex);
    TGeoManager::ThreadsMapIt_t it = fgThreadId->find(threadId);
-   if (it != fgThreadId->end()) return it->second;
+   if (it != fgThreadId->end()) {
+      tid = it->second;
+      return tid;
+   }
    // Map needs to be updated.
-   fgMutex.lock();
    (*fgThreadId)[threadId] = fgNumThreads;
    tid = fgNumThreads; // TTHREAD_TLS_SET(Int_t,tid,fgNumThreads);
    ttid = fgNumThreads++;
-   fgMutex.unlock();
    return ttid;
 }
 
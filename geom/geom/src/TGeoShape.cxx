@@ -399,6 +399,24 @@ Bool_t TGeoShape::IsSegCrossing(Double_t x1, Double_t y1, Double_t x2, Double_t
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from array of input points having directions specified by dirs. Store output in dists
+/// Default implementation calling DistFromInside() for each point, shapes may provide vectorized ones.
+
+void TGeoShape::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t *step) const
+{
+   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from array of input points having directions specified by dirs. Store output in dists
+/// Default implementation calling DistFromOutside() for each point, shapes may provide vectorized ones.
+
+void TGeoShape::DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t *step) const
+{
+   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// compute distance from point (inside phi) to both phi planes. Return minimum.
 
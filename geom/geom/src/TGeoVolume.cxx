@@ -399,6 +399,7 @@ volumes (or volume assemblies) as content.
 #include "TGeoScaledShape.h"
 #include "TGeoCompositeShape.h"
 #include "TGeoVoxelFinder.h"
+#include "TGeoBVHFinder.h"
 #include "TGeoExtension.h"
 
 ClassImp(TGeoVolume);
@@ -1741,7 +1742,8 @@ TGeoVolume *TGeoVolume::CloneVolume() const
    // copy voxels
    TGeoVoxelFinder *voxels = 0;
    if (fVoxels) {
-      voxels = new TGeoVoxelFinder(vol);
+      if (fVoxels->IsA() == TGeoBVHFinder::Class()) voxels = new TGeoBVHFinder(vol);
+      else                                          voxels = new TGeoVoxelFinder(vol);
       vol->SetVoxelFinder(voxels);
    }
    // copy option, uid
@@ -2315,8 +2317,9 @@ void TGeoVolume::Voxelize(Option_t *option)
       if (!TObject::TestBit(kVolumeClone)) delete fVoxels;
       fVoxels = 0;
    }
-   // Create the voxels structure
-   fVoxels = new TGeoVoxelFinder(this);
+   // Create the voxels structure, or the bounding volume hierarchy if requested
+   if (IsUsingBVH()) fVoxels = new TGeoBVHFinder(this);
+   else              fVoxels = new TGeoVoxelFinder(this);
    fVoxels->Voxelize(option);
    if (fVoxels) {
       if (fVoxels->IsInvalid()) {
@@ -2844,7 +2847,8 @@ TGeoVolume *TGeoVolumeAssembly::CloneVolume() const
    // copy voxels
    TGeoVoxelFinder *voxels = 0;
    if (fVoxels) {
-      voxels = new TGeoVoxelFinder(vol);
+      if (fVoxels->IsA() == TGeoBVHFinder::Class()) voxels = new TGeoBVHFinder(vol);
+      else                                          voxels = new TGeoVoxelFinder(vol);
       vol->SetVoxelFinder(voxels);
    }
    // copy option, uid
@@ -2928,7 +2932,8 @@ TGeoVolumeAssembly *TGeoVolumeAssembly::MakeAssemblyFromVolume(TGeoVolume *volor
    // copy voxels
    TGeoVoxelFinder *voxels = 0;
    if (volorig->GetVoxels()) {
-      voxels = new TGeoVoxelFinder(vol);
+      if (volorig->GetVoxels()->IsA() == TGeoBVHFinder::Class()) voxels = new TGeoBVHFinder(vol);
+      else                                                       voxels = new TGeoVoxelFinder(vol);
       vol->SetVoxelFinder(voxels);
    }
    // copy option, uid
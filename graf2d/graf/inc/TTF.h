@@ -78,6 +78,7 @@ protected:
    static Int_t          fgCurFontIdx;            ///< current font index
    static Int_t          fgSymbItaFontIdx;        ///< Symbol italic font index
    static Int_t          fgFontCount;             ///< number of fonts loaded
+   static Int_t          fgFontSize[kTTMaxFonts]; ///< character size set for each font, in 1/64 points
    static char          *fgFontName[kTTMaxFonts]; ///< font name
    static FT_Face        fgFace[kTTMaxFonts];     ///< font face
    static TTF::TTGlyph   fgGlyphs[kMaxGlyphs];    ///< glyphs
@@ -97,6 +98,7 @@ public:
    static void    PrepareString(const char *string);
    static void    PrepareString(const wchar_t *string);
    static void    SetRotationMatrix(Float_t angle);
+   static void    ClearGlyphCache();
 
 public:
    TTF() { }
@@ -13,6 +13,11 @@
 \ingroup BasicGraphics
 
 Interface to the freetype 2 library.
+
+The outlines of the glyphs are loaded once for each font, size and
+hinting mode, and kept in a cache shared by all the pads and images,
+so that the same characters painted on many canvases (axis labels,
+titles, statistics boxes) are not decoded from the font file each time.
 */
 
 #  include <ft2build.h>
@@ -25,11 +30,32 @@ Interface to the freetype 2 library.
 #include "TMath.h"
 #include "TError.h"
 
+#include <unordered_map>
+
 // to scale fonts to the same size as the old TT version
 const Float_t kScale = 0.93376068;
 
 TTF gCleanupTTF; // Allows to call "Cleanup" at the end of the session
 
+namespace {
+
+/// Glyph as loaded from the font, before its transformation
+struct TTFCachedGlyph {
+   FT_Glyph fImage;         ///< untransformed glyph image
+   FT_Pos   fAdvance;       ///< horizontal advance
+   FT_Pos   fBearingY;      ///< vertical bearing, used for the ascent
+};
+
+const size_t kMaxCachedGlyphs = 8192;
+
+std::unordered_map<ULong64_t, TTFCachedGlyph> &GlyphCache()
+{
+   static std::unordered_map<ULong64_t, TTFCachedGlyph> cache;
+   return cache;
+}
+
+}
+
 Bool_t         TTF::fgInit           = kFALSE;
 Bool_t         TTF::fgSmoothing      = kTRUE;
 Bool_t         TTF::fgKerning        = kTRUE;
@@ -40,6 +66,7 @@ Int_t          TTF::fgAscent         = 0;
 Int_t          TTF::fgCurFontIdx     = -1;
 Int_t          TTF::fgSymbItaFontIdx = -1;
 Int_t          TTF::fgFontCount      = 0;
+Int_t          TTF::fgFontSize[kTTMaxFonts];
 Int_t          TTF::fgNumGlyphs      = 0;
 char          *TTF::fgFontName[kTTMaxFonts];
 FT_Matrix     *TTF::fgRotMatrix;
@@ -83,6 +110,7 @@ void TTF::Cleanup()
 {
    if (!fgInit) return;
 
+   ClearGlyphCache();
    for (int i = 0; i < fgFontCount; i++) {
       delete [] fgFontName[i];
       FT_Done_Face(fgFace[i]);
@@ -93,6 +121,40 @@ void TTF::Cleanup()
    fgInit = kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the cached glyph outlines.
+
+void TTF::ClearGlyphCache()
+{
+   for (auto &entry : GlyphCache())
+      FT_Done_Glyph(entry.second.fImage);
+   GlyphCache().clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the glyph with the given index in the current font, loading it
+/// in the cache if needed. Returns 0 if the glyph cannot be loaded.
+
+static const TTFCachedGlyph *LoadCachedGlyph(FT_Face face, Int_t fontidx, Int_t fontsize, Bool_t hinting, UInt_t index)
+{
+   ULong64_t key = ((ULong64_t)fontidx << 58) | ((ULong64_t)hinting << 57) |
+                   ((ULong64_t)(fontsize & 0xffffff) << 32) | index;
+   auto &cache = GlyphCache();
+   auto iter = cache.find(key);
+   if (iter != cache.end()) return &iter->second;
+
+   FT_UInt load_flags = FT_LOAD_DEFAULT;
+   if (!hinting) load_flags |= FT_LOAD_NO_HINTING;
+   if (FT_Load_Glyph(face, index, load_flags)) return 0;
+   TTFCachedGlyph glyph;
+   if (FT_Get_Glyph(face->glyph, &glyph.fImage)) return 0;
+   glyph.fAdvance  = face->glyph->advance.x;
+   glyph.fBearingY = face->glyph->metrics.horiBearingY;
+
+   if (cache.size() >= kMaxCachedGlyphs) TTF::ClearGlyphCache();
+   return &cache.emplace(key, glyph).first->second;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Map char to unicode. Returns 0 in case no mapping exists.
 
@@ -182,15 +244,11 @@ void TTF::LayoutGlyphs()
 {
    TTGlyph*  glyph = fgGlyphs;
    FT_Vector origin;
-   FT_UInt   load_flags;
    FT_UInt   prev_index = 0;
 
    fgAscent = 0;
    fgWidth  = 0;
 
-   load_flags = FT_LOAD_DEFAULT;
-   if (!fgHinting) load_flags |= FT_LOAD_NO_HINTING;
-
    fgCBox.xMin = fgCBox.yMin =  32000;
    fgCBox.xMax = fgCBox.yMax = -32000;
 
@@ -214,17 +272,21 @@ void TTF::LayoutGlyphs()
       // clear existing image if there is one
       if (glyph->fImage) FT_Done_Glyph(glyph->fImage);
 
-      // load the glyph image (in its native format)
-      if (FT_Load_Glyph(fgFace[fgCurFontIdx], glyph->fIndex, load_flags))
+      glyph->fImage = 0;
+
+      // get the glyph image (in its native format) from the cache
+      const TTFCachedGlyph *cached = LoadCachedGlyph(fgFace[fgCurFontIdx], fgCurFontIdx,
+                                                     fgFontSize[fgCurFontIdx], fgHinting, glyph->fIndex);
+      if (!cached)
          continue;
 
-      // extract the glyph image
-      if (FT_Get_Glyph (fgFace[fgCurFontIdx]->glyph, &glyph->fImage))
+      // copy the glyph image, which is transformed below
+      if (FT_Glyph_Copy(cached->fImage, &glyph->fImage))
          continue;
 
       glyph->fPos = origin;
-      fgWidth    += fgFace[fgCurFontIdx]->glyph->advance.x;
-      fgAscent    = TMath::Max((Int_t)(fgFace[fgCurFontIdx]->glyph->metrics.horiBearingY), fgAscent);
+      fgWidth    += cached->fAdvance;
+      fgAscent    = TMath::Max((Int_t)cached->fBearingY, fgAscent);
 
       // transform the glyphs
       FT_Vector_Transform(&glyph->fPos, fgRotMatrix);
@@ -272,10 +334,10 @@ void TTF::PrepareString(const char *string)
    // compute the trailing blanks width. It is use to compute the text
    // width in GetTextExtent
    if (NbTBlank) {
-      FT_UInt load_flags = FT_LOAD_DEFAULT;
-      if (!fgHinting) load_flags |= FT_LOAD_NO_HINTING;
-      if (FT_Load_Glyph(fgFace[fgCurFontIdx], 3, load_flags)) return;
-      fgTBlankW = (Int_t)((fgFace[fgCurFontIdx]->glyph->advance.x)>>6)*NbTBlank;
+      const TTFCachedGlyph *blank = LoadCachedGlyph(fgFace[fgCurFontIdx], fgCurFontIdx,
+                                                    fgFontSize[fgCurFontIdx], fgHinting, 3);
+      if (!blank) return;
+      fgTBlankW = (Int_t)((blank->fAdvance)>>6)*NbTBlank;
    }
 }
 
@@ -310,10 +372,10 @@ void TTF::PrepareString(const wchar_t *string)
    // compute the trailing blanks width. It is use to compute the text
    // width in GetTextExtent
    if (NbTBlank) {
-      FT_UInt load_flags = FT_LOAD_DEFAULT;
-      if (!fgHinting) load_flags |= FT_LOAD_NO_HINTING;
-      if (FT_Load_Glyph(fgFace[fgCurFontIdx], 3, load_flags)) return;
-      fgTBlankW = (Int_t)((fgFace[fgCurFontIdx]->glyph->advance.x)>>6)*NbTBlank;
+      const TTFCachedGlyph *blank = LoadCachedGlyph(fgFace[fgCurFontIdx], fgCurFontIdx,
+                                                    fgFontSize[fgCurFontIdx], fgHinting, 3);
+      if (!blank) return;
+      fgTBlankW = (Int_t)((blank->fAdvance)>>6)*NbTBlank;
    }
 }
 
@@ -448,6 +510,7 @@ Int_t TTF::SetTextFont(const char *fontname, Int_t italic)
    fgCurFontIdx            = fgFontCount;
    fgFace[fgCurFontIdx]    = tface;
    fgCharMap[fgCurFontIdx] = 0;
+   fgFontSize[fgCurFontIdx] = 0;
    fgFontCount++;
 
    if (italic) {
@@ -568,8 +631,11 @@ void TTF::SetTextSize(Float_t textsize)
    }
 
    Int_t tsize = (Int_t)(textsize*kScale+0.5) << 6;
+   if (tsize == fgFontSize[fgCurFontIdx]) return;
    if (FT_Set_Char_Size(fgFace[fgCurFontIdx], tsize, tsize, 72, 72))
       Error("TTF::SetTextSize", "error in FT_Set_Char_Size");
+   else
+      fgFontSize[fgCurFontIdx] = tsize;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -45,6 +45,7 @@ protected:
    std::vector<REveVector> fPoints;
    int                     fCapacity{0};
    int                     fSize{0};
+   int                     fMaxRenderPoints{0};   ///< maximum number of points sent to the clients, 0 for no limit
 
 public:
    REvePointSet(const std::string& name="", const std::string& title="", Int_t n_points = 0);
@@ -67,6 +68,9 @@ public:
          REveVector& RefPoint(int n)       { assert (n < fSize); return fPoints[n]; }
    const REveVector& RefPoint(int n) const { assert (n < fSize); return fPoints[n]; }
 
+   int   GetMaxRenderPoints() const { return fMaxRenderPoints; }
+   void  SetMaxRenderPoints(int n)  { fMaxRenderPoints = n; StampObjProps(); }
+
    void SetMarkerColor(Color_t col) override { SetMainColor(col); }
    void SetMarkerStyle(Style_t mstyle = 1) override;
    void SetMarkerSize(Size_t msize = 1) override;
@@ -186,6 +186,7 @@ void REvePointSet::CopyVizParams(const REveElement* el)
    if (m)
    {
       TAttMarker::operator=(*m);
+      fMaxRenderPoints = m->fMaxRenderPoints;
    }
 
    REveElement::CopyVizParams(el);
@@ -222,13 +223,27 @@ Int_t REvePointSet::WriteCoreJson(nlohmann::json& j, Int_t rnr_offset)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Crates 3D point array for rendering.
+/// If the set has more points than GetMaxRenderPoints(), only a regular sample
+/// of them is sent to the clients, which keeps the scene updates of events with
+/// very many hits small and the clients interactive.
 
 void REvePointSet::BuildRenderData()
 {
    if (fSize > 0)
    {
-      fRenderData = std::make_unique<REveRenderData>("makeHit", 3*fSize);
-      fRenderData->PushV(&fPoints[0].fX, 3*fSize);
+      int stride = (fMaxRenderPoints > 0 && fSize > fMaxRenderPoints) ? (fSize + fMaxRenderPoints - 1) / fMaxRenderPoints : 1;
+      if (stride == 1)
+      {
+         fRenderData = std::make_unique<REveRenderData>("makeHit", 3*fSize);
+         fRenderData->PushV(&fPoints[0].fX, 3*fSize);
+      }
+      else
+      {
+         int n = (fSize + stride - 1) / stride;
+         fRenderData = std::make_unique<REveRenderData>("makeHit", 3*n);
+         for (int i = 0; i < fSize; i += stride)
+            fRenderData->PushV(fPoints[i]);
+      }
    }
 }
 
@@ -14,6 +14,7 @@
 #include <ROOT/RBrowserRequest.hxx>
 #include <ROOT/RBrowserReply.hxx>
 
+#include <list>
 #include <memory>
 #include <string>
 #include <vector>
@@ -44,9 +45,20 @@ class RBrowserData {
    std::vector<const Browsable::RItem *> fLastSortedItems;   ///<! sorted child items, used in requests
    std::string fLastSortMethod;                          ///<! last sort method
 
+   /** Childs of an element listed by a previous request */
+   struct RCachedItems {
+      Browsable::RElementPath_t fPath;                     ///<! path to the element
+      std::shared_ptr<Browsable::RElement> fElement;       ///<! the element
+      std::vector<std::unique_ptr<Browsable::RItem>> fItems; ///<! created browser items
+      bool fAllChilds{false};                              ///<! if all chlds were extracted
+   };
+
+   std::list<RCachedItems> fCachedItems;                 ///<! items of recently used elements, most recent first
+
    Browsable::RElementPath_t DecomposePath(const std::string &path);
 
    void ResetLastRequest();
+   void CacheLastRequest();
 
    bool ProcessBrowserRequest(const RBrowserRequest &request, RBrowserReply &reply);
 
@@ -50,6 +50,7 @@ void RBrowserData::SetWorkingPath(const Browsable::RElementPath_t &path)
    fWorkElement = Browsable::RElement::GetSubElement(fTopElement, path);
 
    ResetLastRequest();
+   fCachedItems.clear();
 }
 
 /////////////////////////////////////////////////////////////////////
@@ -65,6 +66,29 @@ void RBrowserData::ResetLastRequest()
    fLastElement.reset();
 }
 
+/////////////////////////////////////////////////////////////////////
+/// Keep the childs listed for the last request, so that going back to
+/// this element (or requesting other pages of its childs) does not list
+/// them again, which can be slow for remote files with many keys.
+
+void RBrowserData::CacheLastRequest()
+{
+   if (!fLastElement || fLastItems.empty())
+      return;
+
+   const std::size_t kMaxCachedElements = 10;
+
+   fCachedItems.emplace_front();
+   auto &entry = fCachedItems.front();
+   entry.fPath = fLastPath;
+   entry.fElement = fLastElement;
+   entry.fItems = std::move(fLastItems);
+   entry.fAllChilds = fLastAllChilds;
+
+   if (fCachedItems.size() > kMaxCachedElements)
+      fCachedItems.pop_back();
+}
+
 /////////////////////////////////////////////////////////////////////////
 /// Decompose path to elements
 /// Returns array of names for each element in the path, first element either "/" or "."
@@ -108,13 +132,25 @@ bool RBrowserData::ProcessBrowserRequest(const RBrowserRequest &request, RBrowse
 
    if ((path != fLastPath) || !fLastElement) {
 
-      auto elem = Browsable::RElement::GetSubElement(fWorkElement, path);
-      if (!elem) return false;
+      auto cached = std::find_if(fCachedItems.begin(), fCachedItems.end(),
+                                 [&path](const RCachedItems &entry) { return entry.fPath == path; });
+
+      RCachedItems entry;
+      if (cached != fCachedItems.end()) {
+         entry = std::move(*cached);
+         fCachedItems.erase(cached);
+      } else {
+         entry.fElement = Browsable::RElement::GetSubElement(fWorkElement, path);
+      }
+      if (!entry.fElement) return false;
 
+      CacheLastRequest();
       ResetLastRequest();
 
       fLastPath = path;
-      fLastElement = elem;
+      fLastElement = entry.fElement;
+      fLastItems = std::move(entry.fItems);
+      fLastAllChilds = entry.fAllChilds;
    }
 
    // when request childs, always try to make elements
@@ -111,7 +111,7 @@ private:
    uint64_t fSnapshotDelivered{0};   ///<! minimal version delivered to all connections
    std::list<WebUpdate> fUpdatesLst; ///<! list of callbacks for canvas update
 
-   int fJsonComp{23};             ///<! json compression for data send to client
+   int fJsonComp{33};             ///<! json compression for data send to client, arrays coded with base64
 
    /// Disable copy construction.
    RCanvasPainter(const RCanvasPainter &) = delete;
@@ -365,7 +365,8 @@ std::string ROOT::Experimental::RWebWindowsManager::GetUrl(const ROOT::Experimen
 ///   WebGui.LaunchTmout: time required to start process in seconds (default 30 s)
 ///   WebGui.OperationTmout: time required to perform WebWindow operation like execute command or update drawings
 ///   WebGui.RecordData: if specified enables data recording for each web window 0 - off, 1 - on
-///   WebGui.JsonComp: compression factor for JSON conversion, if not specified - each widget uses own default values
+///   WebGui.JsonComp: compression factor for JSON conversion, if not specified - each widget uses own default values,
+///                    canvases use 33 - no spaces and base64 coding of arrays (see TBufferJSON::SetCompact())
 ///   WebGui.ForceHttp: 0 - off (default), 1 - always create real http server to run web window
 ///   WebGui.Console: -1 - output only console.error(), 0 - add console.warn(), 1  - add console.log() output
 ///   WebGui.openui5src:   alternative location for openui5 like https://openui5.hana.ondemand.com/
@@ -43,6 +43,8 @@
 #include <string.h>
 #include <sstream>
 #include <iostream>
+#include <vector>
+#include <cmath>
 
 using namespace std::string_literals;
 
@@ -55,7 +57,9 @@ TWebCanvas::TWebCanvas(TCanvas *c, const char *name, Int_t x, Int_t y, UInt_t wi
    fStyleDelivery = gEnv->GetValue("WebGui.StyleDelivery", 0);
    fPaletteDelivery = gEnv->GetValue("WebGui.PaletteDelivery", 1);
    fPrimitivesMerge = gEnv->GetValue("WebGui.PrimitivesMerge", 100);
-   fJsonComp = gEnv->GetValue("WebGui.JsonComp", TBufferJSON::kSameSuppression + TBufferJSON::kNoSpaces);
+   // arrays like histogram bins and graph points are sent as base64-coded binary data,
+   // which JSROOT decodes directly into typed arrays
+   fJsonComp = gEnv->GetValue("WebGui.JsonComp", TBufferJSON::kBase64 + TBufferJSON::kNoSpaces);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -256,6 +260,61 @@ void TWebCanvas::AddColorsPalette(TPadWebSnapshot &master)
    master.NewSpecials().SetSnapshot(TWebSnapshot::kColors, listofcols, kTRUE);
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Returns a copy of the graph with its line decimated to the resolution of the pad, to be sent
+/// instead of the graph when it has more points than TGraph::GetDecimationThreshold() and is
+/// drawn with a line only. Returns nullptr if the graph must be sent as is.
+
+static TGraph *CreateDecimatedGraph(TPad *pad, TGraph *gr, const char *opt, bool with_histogram)
+{
+   Int_t threshold = TGraph::GetDecimationThreshold();
+   if ((threshold <= 0) || (gr->GetN() <= threshold) || (gr->IsA() != TGraph::Class()))
+      return nullptr;
+
+   TString drawopt = opt;
+   drawopt.ToUpper();
+   drawopt.ReplaceAll("SAME", "");
+   if (!drawopt.Contains("L") || drawopt.Contains("P") || drawopt.Contains("*") || drawopt.Contains("C") ||
+       drawopt.Contains("F") || drawopt.Contains("B") || drawopt.Contains("R"))
+      return nullptr;
+
+   Int_t ncolumns = (Int_t) (pad->GetWw() * pad->GetAbsWNDC());
+   Double_t xmin, xmax, ymin, ymax;
+   TH1F *hist = with_histogram ? gr->GetHistogram() : nullptr;
+   if (hist) {
+      TAxis *xaxis = hist->GetXaxis();
+      xmin = xaxis->GetBinLowEdge(xaxis->GetFirst());
+      xmax = xaxis->GetBinUpEdge(xaxis->GetLast());
+   } else {
+      gr->ComputeRange(xmin, ymin, xmax, ymax);
+   }
+   Bool_t logx = pad->GetLogx();
+   if (logx) {
+      if (xmin <= 0 || xmax <= 0)
+         return nullptr;
+      xmin = std::log10(xmin);
+      xmax = std::log10(xmax);
+   }
+   if ((ncolumns <= 0) || !(xmax > xmin))
+      return nullptr;
+
+   std::vector<Double_t> x(gr->GetN()), y(gr->GetN());
+   Int_t npoints = TGraph::DecimateLine(gr->GetN(), gr->GetX(), gr->GetY(), xmin, xmax, ncolumns, logx, x.data(), y.data());
+
+   TGraph *res = new TGraph(npoints, x.data(), y.data());
+   res->SetNameTitle(gr->GetName(), gr->GetTitle());
+   gr->TAttLine::Copy(*res);
+   gr->TAttFill::Copy(*res);
+   gr->TAttMarker::Copy(*res);
+   res->SetMinimum(gr->GetMinimum());
+   res->SetMaximum(gr->GetMaximum());
+   res->SetBit(TGraph::kClipFrame, gr->TestBit(TGraph::kClipFrame));
+   res->SetBit(TGraph::kNotEditable, gr->TestBit(TGraph::kNotEditable));
+   if (hist)
+      res->SetHistogram((TH1F *) hist->Clone());
+   return res;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 /// Create snapshot for pad and all primitives
 /// Callback function is used to create JSON in the middle of data processing -
@@ -429,7 +488,12 @@ void TWebCanvas::CreatePadSnapshot(TPadWebSnapshot &paddata, TPad *pad, Long64_t
          if (title && first_obj) gropt.Append(";;use_pad_title");
          if (stats) gropt.Append(";;use_pad_stats");
 
-         paddata.NewPrimitive(obj, gropt.Data()).SetSnapshot(TWebSnapshot::kObject, obj);
+         // graphs with many points are sent decimated to the resolution of the pad
+         TGraph *decimated = CreateDecimatedGraph(pad, gr, iter.GetOption(), !IsReadOnly() && first_obj);
+         if (decimated)
+            paddata.NewPrimitive(obj, gropt.Data()).SetSnapshot(TWebSnapshot::kObject, decimated, kTRUE);
+         else
+            paddata.NewPrimitive(obj, gropt.Data()).SetSnapshot(TWebSnapshot::kObject, obj);
 
          fiter.Reset();
          while ((fobj = fiter()) != nullptr)
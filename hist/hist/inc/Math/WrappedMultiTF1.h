@@ -146,6 +146,26 @@ namespace ROOT {
             return fFunc->EvalPar(x, p);
          }
 
+         /// evaluate function at the n points x passing the vector of parameters
+         void DoEvalParN(unsigned int n, const T *x, const double *p, T *result) const
+         {
+            EvalTF1ParN(fFunc, n, x, p, result);
+         }
+
+         /// TF1 evaluates the scalar points all at once
+         static void EvalTF1ParN(TF1 *func, unsigned int n, const double *x, const double *p, double *result)
+         {
+            func->EvalParN(n, x, result, p);
+         }
+
+         template <class U>
+         static void EvalTF1ParN(TF1 *func, unsigned int n, const U *x, const double *p, U *result)
+         {
+            const unsigned int ndim = func->GetNdim();
+            for (unsigned int i = 0; i < n; ++i)
+               result[i] = func->EvalPar(x + i * ndim, p);
+         }
+
          /// evaluate function using the cached parameter values (of TF1)
          /// re-implement for better efficiency
          T DoEvalVec(const T *x) const
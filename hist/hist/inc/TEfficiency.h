@@ -99,6 +99,8 @@ public:
       void          Draw(Option_t* opt = "");
       virtual void  ExecuteEvent(Int_t event, Int_t px, Int_t py);
       void          Fill(Bool_t bPassed,Double_t x,Double_t y=0,Double_t z=0);
+      void          FillN(Int_t n,const Bool_t* passed,const Double_t* x,const Double_t* y=nullptr,
+                          const Double_t* z=nullptr,const Double_t* w=nullptr);
       void          FillWeighted(Bool_t bPassed,Double_t weight,Double_t x,Double_t y=0,Double_t z=0);
       Int_t         FindFixBin(Double_t x,Double_t y=0,Double_t z=0) const;
       TFitResultPtr Fit(TF1* f1,Option_t* opt="");
@@ -17,6 +17,7 @@
 #include "TBits.h"
 #include "TMethodCall.h"
 #include "TInterpreter.h"
+#include <atomic>
 #include <cassert>
 #include <vector>
 #include <list>
@@ -93,6 +94,7 @@ private:
    Bool_t            fClingInitialized;  //!  transient to force re-initialization
    Bool_t            fAllParametersSetted;    // flag to control if all parameters are setted
    Bool_t            fLazyInitialization = kFALSE;  //! transient flag to control lazy initialization (needed for reading from files)
+   Bool_t            fUsesOtherFormulas = kFALSE;  //! transient flag set if the formula uses other TFormula or TF1 objects (not cached)
    TMethodCall *fMethod; //! pointer to methodcall
    std::unique_ptr<TMethodCall> fGradMethod; //! pointer to a methodcall
    TString           fClingName;     //! unique name passed to Cling to define the function ( double clingName(double*x, double*p) )
@@ -102,6 +104,8 @@ private:
    std::string       fGradGenerationInput; //! input query to clad to generate a gradient
    CallFuncSignature fFuncPtr = nullptr; //!  function pointer, owned by the JIT.
    CallFuncSignature fGradFuncPtr = nullptr; //!  function pointer, owned by the JIT.
+   struct BatchKernel;
+   std::atomic<const BatchKernel *> fBatchKernel{nullptr}; //! function evaluating the formula on arrays of points, shared by identical formulas
    void *   fLambdaPtr = nullptr;            //!  pointer to the lambda function
    static bool       fIsCladRuntimeIncluded;
 
@@ -120,6 +124,9 @@ private:
    void FillParametrizedFunctions(std::map<std::pair<TString, Int_t>, std::pair<TString, TString>> &functions);
    void FillVecFunctionsShurtCuts();
    void ReInitializeEvalMethod();
+   Bool_t CopyFromCache(const TString &key);
+   void AddToCache(const TString &key) const;
+   CallFuncSignature GenerateBatchEvalPar();
    std::string GetGradientFuncName() const {
       assert(fClingName.Length() && "TFormula is not initialized yet!");
       return std::string(fClingName.Data()) + "_grad";
@@ -192,6 +199,7 @@ public:
    Double_t       Eval(Double_t x, Double_t y , Double_t z) const;
    Double_t       Eval(Double_t x, Double_t y , Double_t z , Double_t t ) const;
    Double_t       EvalPar(const Double_t *x, const Double_t *params=0) const;
+   void           EvalParN(Int_t n, const Double_t *x, Double_t *result, const Double_t *params=0) const;
 
    /// Generate gradient computation routine with respect to the parameters.
    /// \returns true if a gradient was generated and GradientPar can be called.
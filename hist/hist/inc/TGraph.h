@@ -38,6 +38,8 @@ class TSpline;
 
 #include "TFitResultPtr.h"
 
+#include <atomic>
+
 class TGraph : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
 protected:
@@ -50,6 +52,9 @@ protected:
    TH1F              *fHistogram; ///< Pointer to histogram used for drawing axis
    Double_t           fMinimum;   ///< Minimum value for plotting along y
    Double_t           fMaximum;   ///< Maximum value for plotting along y
+   mutable std::atomic<Int_t> fSortedXStatus{0}; ///<! 1 if the points are known to be sorted in X, -1 if known not to be, 0 if unknown
+
+   static Int_t       fgDecimationThreshold; ///< Number of points above which the painting is decimated
 
    static void        SwapValues(Double_t* arr, Int_t pos1, Int_t pos2);
    virtual void       SwapPoints(Int_t pos1, Int_t pos2);
@@ -102,6 +107,8 @@ public:
    virtual void          DrawGraph(Int_t n, const Float_t *x, const Float_t *y, Option_t *option="");
    virtual void          DrawGraph(Int_t n, const Double_t *x=0, const Double_t *y=0, Option_t *option="");
    virtual void          DrawPanel(); // *MENU*
+   static Int_t          DecimateLine(Int_t n, const Double_t *x, const Double_t *y, Double_t xmin, Double_t xmax,
+                                      Int_t ncolumns, Bool_t logx, Double_t *xout, Double_t *yout);
    virtual Double_t      Eval(Double_t x, TSpline *spline=0, Option_t *option="") const;
    virtual void          ExecuteEvent(Int_t event, Int_t px, Int_t py);
    virtual void          Expand(Int_t newsize);
@@ -116,6 +123,7 @@ public:
    TH1F                 *GetHistogram() const;
    TList                *GetListOfFunctions() const { return fFunctions; }
    virtual Double_t      GetCorrelationFactor() const;
+   static Int_t          GetDecimationThreshold();
    virtual Double_t      GetCovariance() const;
    virtual Double_t      GetMean(Int_t axis=1) const;
    virtual Double_t      GetRMS(Int_t axis=1) const;
@@ -127,7 +135,7 @@ public:
    virtual Double_t      GetErrorXlow(Int_t bin)  const;
    virtual Double_t      GetErrorYhigh(Int_t bin) const;
    virtual Double_t      GetErrorYlow(Int_t bin)  const;
-   Double_t             *GetX()  const {return fX;}
+   Double_t             *GetX()  const {fSortedXStatus = 0; return fX;} // the points may be modified
    Double_t             *GetY()  const {return fY;}
    virtual Double_t     *GetEX() const {return 0;}
    virtual Double_t     *GetEY() const {return 0;}
@@ -157,6 +165,7 @@ public:
    virtual Bool_t        IsEditable() const {return !TestBit(kNotEditable);}
    virtual Bool_t        IsHighlight() const { return TestBit(kIsHighlight); }
    virtual Int_t         IsInside(Double_t x, Double_t y) const;
+   Bool_t                IsSortedX() const;
    virtual void          LeastSquareFit(Int_t m, Double_t *a, Double_t xmin=0, Double_t xmax=0);
    virtual void          LeastSquareLinearFit(Int_t n, Double_t &a0, Double_t &a1, Int_t &ifail, Double_t xmin=0, Double_t xmax=0);
    virtual Int_t         Merge(TCollection* list);
@@ -170,6 +179,7 @@ public:
    virtual Int_t         RemovePoint(); // *MENU*
    virtual Int_t         RemovePoint(Int_t ipoint);
    virtual void          SavePrimitive(std::ostream &out, Option_t *option = "");
+   static void           SetDecimationThreshold(Int_t npoints = 100000);
    virtual void          SetEditable(Bool_t editable=kTRUE); // *TOGGLE* *GETTER=GetEditable
    virtual void          SetHighlight(Bool_t set = kTRUE); // *TOGGLE* *GETTER=IsHighlight
    virtual void          SetHistogram(TH1F *h) {fHistogram = h;}
@@ -63,6 +63,12 @@ class TGraph;
 class TMultiGraph;
 class TPad;
 
+namespace ROOT {
+namespace Internal {
+class TH2PolyIndex;
+}
+}
+
 class TH2Poly : public TH2 {
 
 public:
@@ -165,8 +171,12 @@ protected:
    Bool_t   fNewBinAdded;          ///<!For the 3D Painter
    Bool_t   fBinContentChanged;    ///<!For the 3D Painter
    TList   *fBins;                 ///< List of bins. The list owns the contained objects
+   ROOT::Internal::TH2PolyIndex *fIndex; ///<!Spatial index of the bins, built on the first search
 
    void   AddBinToPartition(TH2PolyBin *bin);  // Adds the input bin into the partition matrix
+   Int_t  FillPolyBin(TH2PolyBin *bin, Int_t overflow, Double_t x, Double_t y, Double_t w); // Fills the bin found for (x,y)
+   Int_t  FindOverflow(Double_t x, Double_t y) const; // Returns the overflow bin of (x,y), -5 if inside the axis limits
+   TH2PolyBin *FindPolyBin(Double_t x, Double_t y);   // Returns the bin containing (x,y), from the spatial index
    void   Initialize(Double_t xlow, Double_t xup, Double_t ylow, Double_t yup, Int_t n, Int_t m);
    Bool_t IsIntersecting(TH2PolyBin *bin, Double_t xclipl, Double_t xclipr, Double_t yclipb, Double_t yclipt);
    Bool_t IsIntersectingPolygon(Int_t bn, Double_t *x, Double_t *y, Double_t xclipl, Double_t xclipr, Double_t yclipb, Double_t yclipt);
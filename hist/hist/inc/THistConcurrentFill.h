@@ -0,0 +1,112 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_THistConcurrentFill
+#define ROOT_THistConcurrentFill
+
+#include "RtypesCore.h"
+
+#include <mutex>
+#include <vector>
+
+class TH1;
+class THnBase;
+class THistConcurrentFiller;
+
+/** \class THistConcurrentFillManager
+Lets several threads fill the same histogram, without one clone per thread.
+
+Each thread fills the histogram through its own THistConcurrentFiller,
+obtained with MakeFiller(). A filler buffers the values and periodically
+flushes them into the histogram with a single FillN() call, serialized by the
+manager, so that the only additional memory per thread is the buffer. The
+histogram is filled exactly as by the same Fill() calls made sequentially, in
+the order of the flushes, statistics included.
+
+\code{.cpp}
+TH2D h("h", "h", 1000, 0., 1., 1000, 0., 1.);
+THistConcurrentFillManager manager(h);
+auto work = [&]() {
+   auto filler = manager.MakeFiller();
+   for (int i = 0; i < 1000000; ++i)
+      filler.Fill(gRandom->Rndm(), gRandom->Rndm());
+}; // the filler flushes its values when destroyed
+std::thread t1(work), t2(work);
+t1.join();
+t2.join();
+h.Draw();
+\endcode
+
+The histogram must not be used otherwise while it is being filled, and its
+content is complete only once all the fillers are flushed or destroyed.
+Supported are the TH1, TH2, TH3, the TProfile, TProfile2D, TProfile3D and
+the THnBase (THn and THnSparse).
+*/
+
+class THistConcurrentFillManager {
+   friend class THistConcurrentFiller;
+
+private:
+   TH1        *fHist;     ///< Filled histogram, if a TH1
+   THnBase    *fHistN;    ///< Filled histogram, if a THnBase
+   Int_t       fNCoord;   ///< Number of coordinates of the values, excluding the weight
+   Int_t       fBufferSize; ///< Number of entries buffered by the fillers
+   std::mutex  fFillMutex; ///< Serializes the flushes of the fillers
+
+   void FillN(Int_t n, const Double_t *entries);
+
+   THistConcurrentFillManager(const THistConcurrentFillManager&) = delete;
+   THistConcurrentFillManager &operator=(const THistConcurrentFillManager&) = delete;
+
+public:
+   explicit THistConcurrentFillManager(TH1 &hist, Int_t bufferSize = 1024);
+   explicit THistConcurrentFillManager(THnBase &hist, Int_t bufferSize = 1024);
+
+   Int_t                 GetBufferSize() const { return fBufferSize; }
+   Int_t                 GetNCoordinates() const { return fNCoord; }
+   THistConcurrentFiller MakeFiller();
+};
+
+/** \class THistConcurrentFiller
+Buffers the Fill() calls of one thread for a THistConcurrentFillManager.
+
+The arguments of Fill() are those of the Fill() of the histogram taking
+numbers: the coordinates, followed by an optional weight. A filler must only
+be used by one thread at a time.
+*/
+
+class THistConcurrentFiller {
+   friend class THistConcurrentFillManager;
+
+private:
+   THistConcurrentFillManager *fManager; ///< Manager of the filled histogram
+   std::vector<Double_t>       fEntries; ///< Buffered entries: the coordinates then the weight of each
+
+   explicit THistConcurrentFiller(THistConcurrentFillManager &manager);
+
+   void FillEntry(const Double_t *args, Int_t nargs);
+
+   THistConcurrentFiller(const THistConcurrentFiller&) = delete;
+   THistConcurrentFiller &operator=(const THistConcurrentFiller&) = delete;
+
+public:
+   THistConcurrentFiller(THistConcurrentFiller &&other);
+   ~THistConcurrentFiller() { Flush(); }
+
+   void Fill(Double_t x) { FillEntry(&x, 1); }
+   void Fill(Double_t x, Double_t y) { const Double_t a[] = {x, y}; FillEntry(a, 2); }
+   void Fill(Double_t x, Double_t y, Double_t z) { const Double_t a[] = {x, y, z}; FillEntry(a, 3); }
+   void Fill(Double_t x, Double_t y, Double_t z, Double_t t) { const Double_t a[] = {x, y, z, t}; FillEntry(a, 4); }
+   void Fill(Double_t x, Double_t y, Double_t z, Double_t t, Double_t u) { const Double_t a[] = {x, y, z, t, u}; FillEntry(a, 5); }
+   void Fill(const Double_t *x, Double_t w = 1.);
+   void Flush();
+};
+
+#endif
@@ -152,6 +152,7 @@ private:
       FillBin(bin, w);
       return bin;
    }
+   void FillN(Int_t n, const Double_t *x, const Double_t *w = 0);
 
    virtual void FillBin(Long64_t bin, Double_t w) = 0;
 
@@ -21,7 +21,6 @@
 
 
 #include "THnBase.h"
-#include "TExMap.h"
 #include "THnSparse_Internal.h"
 
 // needed only for template instantiations of THnSparseT:
@@ -35,11 +34,19 @@ class THnSparseCompactBinCoord;
 
 class THnSparse: public THnBase {
  private:
+   /// Slot of the index of the filled bins: the hash of the compact
+   /// coordinate of a bin and its index + 1, or 0 if the slot is empty.
+   struct TBinSlot {
+      ULong64_t fHash;
+      Long64_t  fBin;
+   };
+
    Int_t      fChunkSize;    // number of entries for each chunk
    Long64_t   fFilledBins;   // number of filled bins
    TObjArray  fBinContent;   // array of THnSparseArrayChunk
-   TExMap     fBins;         //! filled bins
-   TExMap     fBinsContinued;//! filled bins for non-unique hashes, containing pairs of (bin index 0, bin index 1)
+   TBinSlot  *fBinSlots;     //! open addressing hash table of the filled bins, built on demand
+   Long64_t   fNBinSlots;    //! size of fBinSlots, a power of 2
+   Long64_t   fNIndexedBins; //! number of bins in fBinSlots
    THnSparseCompactBinCoord *fCompactCoord; //! compact coordinate
 
    THnSparse(const THnSparse&); // Not implemented
@@ -57,7 +64,9 @@ class THnSparse: public THnBase {
 
    THnSparseArrayChunk* AddChunk();
    void Reserve(Long64_t nbins);
-   void FillExMap();
+   void FillBinIndex();
+   void IndexBin(ULong64_t hash, Long64_t bin);
+   void ResizeBinIndex(Long64_t nbins);
    virtual TArray* GenerateArray() const = 0;
    Long64_t GetBinIndexForCurrentBin(Bool_t allocate);
 
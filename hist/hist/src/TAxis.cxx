@@ -431,6 +431,54 @@ Int_t TAxis::FindFixBin(Double_t x) const
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find the bin numbers of the n abscissas x[0], x[stride], ..., x[(n-1)*stride]
+/// and store them in bins[0], ..., bins[n-1].
+///
+/// The bins are exactly those returned by FindFixBin(Double_t) for each value,
+/// but they are computed without branches: the loop over fixed bins can be
+/// vectorized by the compiler and, for variable bin sizes, the binary searches
+/// of the values are interleaved, which hides the latency of their memory
+/// accesses. This is used by TH1::FillN and the FillN of TH2 and TH3.
+
+void TAxis::FindFixBins(Int_t n, const Double_t *x, Int_t *bins, Int_t stride) const
+{
+   const Double_t xmin = fXmin;
+   const Double_t xmax = fXmax;
+   if (!fXbins.fN) {        //*-* fix bins
+      const Int_t nbins = fNbins;
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t xi = x[i*stride];
+         Double_t t = nbins*(xi-xmin)/(xmax-xmin);
+         // The out of range values (and NaN) never reach the conversion to int
+         t = xi < xmin ? -1. : t;
+         t = xi < xmax ? t : Double_t(nbins);
+         bins[i] = 1 + int(t);
+      }
+      return;
+   }
+
+   //*-* variable bin sizes: same result as TMath::BinarySearch, i.e.
+   // std::lower_bound, all the values taking the same number of steps
+   const Double_t *edges = fXbins.fArray;
+   const Int_t nedges = fXbins.fN;
+   for (Int_t i = 0; i < n; ++i)
+      bins[i] = 0;
+   for (Int_t len = nedges; len > 1; ) {
+      const Int_t half = len/2;
+      for (Int_t i = 0; i < n; ++i)
+         bins[i] += edges[bins[i]+half] < x[i*stride] ? half : 0;
+      len -= half;
+   }
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t xi = x[i*stride];
+      Int_t pos = bins[i] + (edges[bins[i]] < xi);   // first edge >= xi
+      Int_t bin = 1 + ((pos != nedges && edges[pos] == xi) ? pos : pos - 1);
+      bin = xi < xmin ? 0 : bin;
+      bins[i] = xi < xmax ? bin : fNbins+1;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return label for bin
 
@@ -2280,6 +2280,69 @@ void TEfficiency::Fill(Bool_t bPassed,Double_t x,Double_t y,Double_t z)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// This function is used for filling the two histograms with n events at once.
+///
+/// \param[in] n number of events
+/// \param[in] passed flags whether the events passed the selection
+/// \param[in] x x-values
+/// \param[in] y y-values (only used, and required, for 2-D and 3-D efficiencies)
+/// \param[in] z z-values (only used, and required, for 3-D efficiencies)
+/// \param[in] w weights of the events, or nullptr to give all of them weight 1
+///
+/// The result is identical to calling Fill() (or FillWeighted() if w is given)
+/// for each event, but each histogram is filled with a single FillN() call per
+/// chunk of events, which finds the bins of the whole chunk at once.
+///
+/// Note: - if w is given, this function will call SetUseWeightedEvents if it was not called by the user before
+
+void TEfficiency::FillN(Int_t n,const Bool_t* passed,const Double_t* x,const Double_t* y,const Double_t* z,const Double_t* w)
+{
+   const Int_t dim = GetDimension();
+   if ((dim > 1 && !y) || (dim > 2 && !z)) {
+      Error("FillN","the %s-values are required to fill a %d-dimensional efficiency",(dim > 1 && !y) ? "y" : "z",dim);
+      return;
+   }
+   if(w && !TestBit(kUseWeights))
+      SetUseWeightedEvents();
+
+   // the passed events of each chunk are gathered to fill the passed histogram
+   const Int_t kChunk = 256;
+   Double_t px[kChunk], py[kChunk], pz[kChunk], pw[kChunk];
+   for (Int_t first = 0; first < n; first += kChunk) {
+      const Int_t nc = (n - first < kChunk) ? n - first : kChunk;
+      Int_t np = 0;
+      for (Int_t i = first; i < first + nc; ++i) {
+         if (!passed[i])
+            continue;
+         px[np] = x[i];
+         if (dim > 1) py[np] = y[i];
+         if (dim > 2) pz[np] = z[i];
+         if (w) pw[np] = w[i];
+         ++np;
+      }
+      const Double_t* wc = w ? w + first : nullptr;
+      const Double_t* pwc = w ? pw : nullptr;
+      switch(dim) {
+         case 1:
+            fTotalHistogram->FillN(nc,x + first,wc);
+            if(np)
+               fPassedHistogram->FillN(np,px,pwc);
+            break;
+         case 2:
+            ((TH2*)(fTotalHistogram))->FillN(nc,x + first,y + first,wc);
+            if(np)
+               ((TH2*)(fPassedHistogram))->FillN(np,px,py,pwc);
+            break;
+         case 3:
+            ((TH3*)(fTotalHistogram))->FillN(nc,x + first,y + first,z + first,wc);
+            if(np)
+               ((TH3*)(fPassedHistogram))->FillN(np,px,py,pz,pwc);
+            break;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///This function is used for filling the two histograms with a weight.
 ///
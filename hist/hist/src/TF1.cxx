@@ -1537,6 +1537,34 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function at n points and store the values in result.
+///
+/// The point i is made of the GetNdim() coordinates starting at x[i * GetNdim()].
+/// If argument params is omitted or equal 0, the internal values of parameters
+/// are used, as in EvalPar(). The functions defined by a formula are evaluated
+/// by a loop compiled once for all the points, see TFormula::EvalParN(); the
+/// other functions are evaluated point by point with EvalPar().
+
+void TF1::EvalParN(Int_t n, const Double_t *x, Double_t *result, const Double_t *params)
+{
+   if (fType == EFType::kFormula) {
+      assert(fFormula);
+      fFormula->EvalParN(n, x, result, params);
+      if (fNormalized && fNormIntegral != 0) {
+         for (Int_t i = 0; i < n; ++i)
+            result[i] /= fNormIntegral;
+      }
+      return;
+   }
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t *xi = x + i * fNdim;
+      if (fMethodCall)
+         InitArgs(xi, params); // needed for interpreted functions
+      result[i] = EvalPar(xi, params);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
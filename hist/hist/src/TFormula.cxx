@@ -26,6 +26,7 @@
 #include <iostream>
 #include <unordered_map>
 #include <functional>
+#include <memory>
 #include <set>
 
 using namespace std;
@@ -212,6 +213,17 @@ static const TString gNamePrefix = "TFormula__";
 //static std::unordered_map<std::string,  TInterpreter::CallFuncIFacePtr_t::Generic_t> gClingFunctions = std::unordered_map<TString,  TInterpreter::CallFuncIFacePtr_t::Generic_t>();
 static std::unordered_map<std::string,  void *> gClingFunctions = std::unordered_map<std::string,  void * >();
 
+// maximum number of formulas kept in the cache of processed formulas
+static const size_t gMaxFormulaCacheSize = 10000;
+
+// static map of the processed formulas, by preprocessed expression (see TFormula::CopyFromCache).
+// Never deleted, as the formulas cannot be destroyed after the interpreter at the end of the process.
+static std::unordered_map<std::string, std::unique_ptr<TFormula>> &GetFormulaCache()
+{
+   static auto formulaCache = new std::unordered_map<std::string, std::unique_ptr<TFormula>>();
+   return *formulaCache;
+}
+
 static void R__v5TFormulaUpdater(Int_t nobjects, TObject **from, TObject **to)
 {
    auto **fromv5 = (ROOT::v5::TFormula **)from;
@@ -470,11 +482,65 @@ TFormula::TFormula(const char *name, const char *formula, bool addToGlobList, bo
    if (!fFormula.IsNull() ) {
       PreProcessFormula(fFormula);
 
-      PrepareFormula(fFormula);
+      // the preprocessed expression is normalized, e.g. without spaces
+      const TString cacheKey = fVectorized ? fFormula + " (vectorized)" : fFormula;
+      if (!CopyFromCache(cacheKey)) {
+         if (PrepareFormula(fFormula) && !fUsesOtherFormulas)
+            AddToCache(cacheKey);
+      }
    }
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the processed formula of the cache built for the preprocessed
+/// expression key, if any, keeping the name, title and ownership of this
+/// formula. Creating many times the same formula only processes it once.
+/// Returns false if the formula is not in the cache.
+
+Bool_t TFormula::CopyFromCache(const TString &key)
+{
+   R__LOCKGUARD(gROOTMutex);
+   auto &formulaCache = GetFormulaCache();
+   auto cached = formulaCache.find(key.Data());
+   if (cached == formulaCache.end())
+      return kFALSE;
+
+   // TObject::Copy overwrites the status bits
+   const TString name = GetName();
+   const TString title = GetTitle();
+   const Bool_t notGlobal = TestBit(kNotGlobal);
+   const Bool_t mustCleanup = TestBit(kMustCleanup);
+   const Bool_t canDelete = TestBit(kCanDelete);
+   cached->second->Copy(*this);
+   SetNameTitle(name, title);
+   SetBit(kNotGlobal, notGlobal);
+   SetBit(kMustCleanup, mustCleanup);
+   SetBit(kCanDelete, canDelete);
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Keep a copy of this just processed formula in the cache, for the
+/// preprocessed expression key. The formulas using other TFormula or TF1
+/// objects are not cached, as these could be redefined.
+
+void TFormula::AddToCache(const TString &key) const
+{
+   R__LOCKGUARD(gROOTMutex);
+   auto &formulaCache = GetFormulaCache();
+   if (formulaCache.size() >= gMaxFormulaCacheSize || formulaCache.count(key.Data()))
+      return;
+
+   std::unique_ptr<TFormula> cached(new TFormula());
+   Copy(*cached);
+   cached->SetNameTitle("", "");
+   cached->SetBit(kNotGlobal);
+   cached->ResetBit(kMustCleanup);
+   cached->ResetBit(kCanDelete);
+   formulaCache.emplace(key.Data(), std::move(cached));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor from a full compile-able C++ expression
 
@@ -718,6 +784,8 @@ void TFormula::Copy(TObject &obj) const
    fnew.fGradGenerationInput = fGradGenerationInput;
    fnew.fGradFuncPtr = fGradFuncPtr;
 
+   fnew.fBatchKernel.store(fBatchKernel.load(std::memory_order_acquire), std::memory_order_release);
+
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1389,6 +1457,8 @@ void TFormula::HandleFunctionArguments(TString &formula)
          // parametrized function (else case below)
 
          bool nameRecognized = (f != nullptr);
+         if (f)
+            fUsesOtherFormulas = true;
 
          // Get ndim, npar, and replacementFormula of function
          int ndim = 0;
@@ -1951,6 +2021,7 @@ void TFormula::ExtractFunctors(TString &formula)
                   f = f1->GetFormula();
             }
             if (f) {
+               fUsesOtherFormulas = true;
                // Replacing user formula the old way (as opposed to 'HandleFunctionArguments')
                // Note this is only for replacing functions that do
                // not specify variables and/or parameters in brackets
@@ -3143,6 +3214,47 @@ Double_t TFormula::EvalPar(const Double_t *x,const Double_t *params) const
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula at the n points x for the parameters params, or the
+/// current parameter values if params is null, and store the values in result.
+/// The point i is made of the GetNdim() values starting at x[i * GetNdim()].
+///
+/// The points are evaluated by a loop compiled by Cling once per formula,
+/// which calls the formula expression directly instead of going through the
+/// interpreter function pointer for each point. Lambda and vectorized formulas
+/// are evaluated point by point with EvalPar().
+
+void TFormula::EvalParN(Int_t n, const Double_t *x, Double_t *result, const Double_t *params) const
+{
+   if (n <= 0)
+      return;
+
+   if (fReadyToExecute && !fVectorized && !TestBit(TFormula::kLambda)) {
+      auto thisFormula = const_cast<TFormula*>(this);
+      if (!fClingInitialized && fLazyInitialization) {
+         // try recompiling the formula. We need to lock because this is not anymore thread safe
+         R__LOCKGUARD(gROOTMutex);
+         thisFormula->ReInitializeEvalMethod();
+      }
+      CallFuncSignature batchFuncPtr = fClingInitialized ? thisFormula->GenerateBatchEvalPar() : nullptr;
+      if (batchFuncPtr) {
+         // the jitted function is void name(Int_t n, Double_t *x, Double_t *p, Double_t *result)
+         void *args[4];
+         double *vars = const_cast<double *>(x);
+         double *pars = (params) ? const_cast<double *>(params) : const_cast<double *>(fClingParameters.data());
+         args[0] = &n;
+         args[1] = &vars;
+         args[2] = &pars;
+         args[3] = &result;
+         (*batchFuncPtr)(0, 4, args, /*ret*/nullptr); // We do not use ret in a return-void func.
+         return;
+      }
+   }
+
+   for (Int_t i = 0; i < n; ++i)
+      result[i] = EvalPar(x + i * fNdim, params);
+}
+
 bool TFormula::fIsCladRuntimeIncluded = false;
 
 static bool functionExists(const string &Name) {
@@ -3192,6 +3304,70 @@ bool TFormula::GenerateGradientPar()
    return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Function evaluating a formula on arrays of points, see EvalParN().
+
+struct TFormula::BatchKernel {
+   TString fClingName;                    // name of the formula function called for each point
+   Int_t fNdim = 0;                       // number of coordinates of each point
+   std::unique_ptr<TMethodCall> fMethod;  // methodcall of the kernel
+   CallFuncSignature fFuncPtr = nullptr;  // function pointer, owned by the JIT; null if the kernel failed to compile
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the function evaluating the formula on arrays of points, see
+/// EvalParN(). Identical formulas share the same function.
+/// Returns the function pointer, or nullptr if the function can't be compiled.
+///
+/// This is called concurrently by the threads of a multithreaded fit: the
+/// kernel is published in fBatchKernel only once filled, and is never modified
+/// nor deleted afterwards, so that it can be used without taking the lock.
+
+TFormula::CallFuncSignature TFormula::GenerateBatchEvalPar()
+{
+   const BatchKernel *kernel = fBatchKernel.load(std::memory_order_acquire);
+   if (kernel && kernel->fNdim == fNdim && kernel->fClingName == fClingName)
+      return kernel->fFuncPtr;
+
+   R__LOCKGUARD(gROOTMutex);
+   // Kernels live as long as the jitted functions they call. A failed kernel
+   // stays in the map, so that its compilation is not retried at each call.
+   static std::map<TString, std::unique_ptr<BatchKernel>> kernels;
+   // The points of the batch are fNdim coordinates apart
+   const TString batchFuncName = TString::Format("%s_batch%d", fClingName.Data(), fNdim);
+   std::unique_ptr<BatchKernel> &newKernel = kernels[batchFuncName];
+   if (!newKernel) {
+      newKernel.reset(new BatchKernel);
+      newKernel->fClingName = fClingName;
+      newKernel->fNdim = fNdim;
+
+      // same arguments as in the prototype of the formula function, see TFormula::ProcessFormula
+      TString pointArgs;
+      if (fNpar > 0)
+         pointArgs = TString::Format("x + i * %d, p", fNdim);
+      else if (fNdim > 0)
+         pointArgs = TString::Format("x + i * %d", fNdim);
+      TString batchInput = TString::Format("#pragma cling optimize(2)\n"
+                                           "void %s(Int_t n, Double_t *x, Double_t *p, Double_t *result) {\n"
+                                           "   for (Int_t i = 0; i < n; ++i)\n"
+                                           "      result[i] = %s(%s);\n"
+                                           "}",
+                                           batchFuncName.Data(), fClingName.Data(), pointArgs.Data());
+      if (!functionExists(batchFuncName.Data()) && !gInterpreter->Declare(batchInput)) {
+         Error("GenerateBatchEvalPar", "Error compiling the batch evaluation of formula %s", fFormula.Data());
+      } else {
+         newKernel->fMethod.reset(new TMethodCall());
+         newKernel->fMethod->InitWithPrototype(batchFuncName, "Int_t,Double_t*,Double_t*,Double_t*");
+         if (newKernel->fMethod->IsValid())
+            newKernel->fFuncPtr = prepareFuncPtr(newKernel->fMethod.get());
+         else
+            Error("GenerateBatchEvalPar", "Can't compile function %s", batchFuncName.Data());
+      }
+   }
+   fBatchKernel.store(newKernel.get(), std::memory_order_release);
+   return newKernel->fFuncPtr;
+}
+
 void TFormula::GradientPar(const Double_t *x, TFormula::GradientStorage& result)
 {
    if (DoEval(x) == TMath::QuietNaN())
@@ -33,6 +33,9 @@
 #include <stdlib.h>
 #include <string>
 #include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include "HFitInterface.h"
 #include "Fit/DataRange.h"
@@ -42,6 +45,8 @@ extern void H1LeastSquareSeqnd(Int_t n, Double_t *a, Int_t idim, Int_t &ifail, I
 
 ClassImp(TGraph);
 
+Int_t TGraph::fgDecimationThreshold = 100000;
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /** \class TGraph
@@ -60,6 +65,11 @@ class. All details about the various painting options are given in this class.
     and name `SetTitle` and `SetName` should be called on the TGraph after its creation.
     TGraph was a light weight object to start with, like TPolyline or TPolyMarker.
     That’s why it did not have any title and name parameters in the constructors.
+  - Large graphs, e.g. waveforms with millions of points, are painted at the
+    resolution of the screen: above TGraph::GetDecimationThreshold() points,
+    lines are painted through the first, smallest, largest and last points of
+    each pixel column and markers once per pixel (see TGraph::DecimateLine()).
+    TGraph::Eval() uses a binary search as soon as the points are sorted in X.
 
 The picture below gives an example:
 
@@ -218,6 +228,7 @@ TGraph& TGraph::operator=(const TGraph &gr)
 
       fMinimum = gr.fMinimum;
       fMaximum = gr.fMaximum;
+      fSortedXStatus = 0;
       if (fX) delete [] fX;
       if (fY) delete [] fY;
       if (!fMaxSize) {
@@ -852,6 +863,54 @@ void TGraph::DrawPanel()
    if (painter) painter->DrawPanelHelper(this);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce the polyline of the n points (x,y) to the points painted differently at
+/// the resolution of ncolumns pixel columns spanning [xmin,xmax] along X: of each
+/// run of consecutive points falling in the same column, only the first, the
+/// smallest, the largest and the last are stored in (xout,yout), in their
+/// original order, which paints the same line. With logx the columns, as well as
+/// xmin and xmax, are in log10(x). xout and yout must have room for n points.
+/// Return the number of stored points, at most 4 per crossed column.
+
+Int_t TGraph::DecimateLine(Int_t n, const Double_t *x, const Double_t *y, Double_t xmin, Double_t xmax,
+                           Int_t ncolumns, Bool_t logx, Double_t *xout, Double_t *yout)
+{
+   if (n <= 0) return 0;
+   if (ncolumns <= 0 || !(xmax > xmin)) {
+      std::copy(x, x + n, xout);
+      std::copy(y, y + n, yout);
+      return n;
+   }
+   const Double_t scale = ncolumns / (xmax - xmin);
+   auto column = [&](Double_t xi) {
+      Double_t u = logx ? (xi > 0 ? std::log10(xi) : -std::numeric_limits<Double_t>::infinity()) : xi;
+      return std::floor((u - xmin) * scale);
+   };
+   Int_t nout = 0;
+   Int_t first = 0;
+   Double_t firstColumn = column(x[0]);
+   for (Int_t i = 1; i <= n; ++i) {
+      Double_t c = (i < n) ? column(x[i]) : 0.;
+      if (i < n && c == firstColumn) continue;
+      // points first to i-1 are in the same column
+      Int_t imin = first, imax = first;
+      for (Int_t j = first + 1; j < i; ++j) {
+         if (y[j] < y[imin]) imin = j;
+         if (y[j] > y[imax]) imax = j;
+      }
+      const Int_t keep[4] = {first, std::min(imin, imax), std::max(imin, imax), i - 1};
+      for (Int_t k = 0; k < 4; ++k) {
+         if (k > 0 && keep[k] == keep[k - 1]) continue;
+         xout[nout] = x[keep[k]];
+         yout[nout] = y[keep[k]];
+         ++nout;
+      }
+      first = i;
+      firstColumn = c;
+   }
+   return nout;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interpolate points in this graph at x using a TSpline.
 ///
@@ -863,9 +922,10 @@ void TGraph::DrawPanel()
 ///    the internally created spline is deleted on return.
 ///  - if spline is specified, it is used to return the interpolated value.
 ///
-///   If the points are sorted in X a binary search is used (significantly faster)
-///   One needs to set the bit  TGraph::SetBit(TGraph::kIsSortedX) before calling
-///   TGraph::Eval to indicate that the graph is sorted in X.
+///   If the points are sorted in X a binary search is used (significantly faster).
+///   The order of the points is checked once and remembered until they are
+///   modified (see TGraph::IsSortedX()); setting the bit TGraph::kIsSortedX
+///   declares the graph sorted in X without checking.
 
 Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
 {
@@ -884,6 +944,11 @@ Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
       // create a TSpline every time when using option "s" and no spline pointer is given
       if (opt.Contains("s")) {
 
+         if (IsSortedX()) {
+            TSpline3 s("", fX, fY, fNpoints);
+            return s.Eval(x);
+         }
+
          // points must be sorted before using a TSpline
          std::vector<Double_t> xsort(fNpoints);
          std::vector<Double_t> ysort(fNpoints);
@@ -907,7 +972,7 @@ Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
    // (if point are sorted use a binary search)
    Int_t low  = -1;
    Int_t up  = -1;
-   if (TestBit(TGraph::kIsSortedX) ) {
+   if (IsSortedX()) {
       low = TMath::BinarySearch(fNpoints, fX, x);
       if (low == -1)  {
          // use first two points for doing an extrapolation
@@ -1342,6 +1407,15 @@ Double_t TGraph::GetCorrelationFactor() const
    return GetCovariance() / rms1 / rms2;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of points above which graphs are painted decimated to
+/// the resolution of the screen, 0 if they are never decimated.
+
+Int_t TGraph::GetDecimationThreshold()
+{
+   return fgDecimationThreshold;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return covariance of vectors x,y
 
@@ -1816,6 +1890,7 @@ void TGraph::InsertPointBefore(Int_t ipoint, Double_t x, Double_t y)
 
    fX[ipoint] = x;
    fY[ipoint] = y;
+   fSortedXStatus = 0;
 }
 
 
@@ -1888,6 +1963,23 @@ Int_t TGraph::IsInside(Double_t x, Double_t y) const
    return (Int_t)TMath::IsInside(x, y, fNpoints, fX, fY);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the points are sorted in increasing X, i.e. if the bit
+/// kIsSortedX is set or if a check of the points finds them sorted.
+/// The result of the check is kept until the points are modified by the
+/// TGraph setters, or may have been through the array returned by GetX().
+
+Bool_t TGraph::IsSortedX() const
+{
+   if (TestBit(kIsSortedX)) return kTRUE;
+   Int_t status = fSortedXStatus;
+   if (status == 0) {
+      status = std::is_sorted(fX, fX + fNpoints) ? 1 : -1;
+      fSortedXStatus = status;
+   }
+   return status == 1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Least squares polynomial fitting without weights.
 ///
@@ -2201,10 +2293,21 @@ void TGraph::Set(Int_t n)
    CopyAndRelease(ps, 0, TMath::Min(fNpoints, n), 0);
    if (n > fNpoints) {
       FillZero(fNpoints, n, kFALSE);
+      fSortedXStatus = 0;
    }
    fNpoints = n;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the number of points above which graphs are painted decimated to the
+/// resolution of the screen, by TGraphPainter as well as in the web canvas.
+/// 0 disables the decimation.
+
+void TGraph::SetDecimationThreshold(Int_t npoints)
+{
+   fgDecimationThreshold = npoints > 0 ? npoints : 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return kTRUE if kNotEditable bit is not set, kFALSE otherwise.
 
@@ -2262,6 +2365,7 @@ void TGraph::SetPoint(Int_t i, Double_t x, Double_t y)
 {
    if (i < 0) return;
    if (fHistogram) SetBit(kResetHisto);
+   Int_t npoints = fNpoints;
 
    if (i >= fMaxSize) {
       Double_t **ps = ExpandAndCopy(i + 1, fNpoints);
@@ -2276,6 +2380,9 @@ void TGraph::SetPoint(Int_t i, Double_t x, Double_t y)
    }
    fX[i] = x;
    fY[i] = y;
+   // the points stay sorted if x keeps its place, e.g. when appending in increasing X
+   if (fSortedXStatus != 1 || i > npoints || (i > 0 && fX[i-1] > x) || (i < fNpoints - 1 && x > fX[i+1]))
+      fSortedXStatus = 0;
    if (gPad) gPad->Modified();
 }
 
@@ -2385,6 +2492,8 @@ void TGraph::Sort(Bool_t (*greaterfunc)(const TGraph*, Int_t, Int_t) /*=TGraph::
    // set the bit in case of an ascending =sort in X
    if (greaterfunc == TGraph::CompareX && ascending  && low == 0 && high == -1111)
       SetBit(TGraph::kIsSortedX);
+   else if (low == 0 && high == -1111)
+      ResetBit(TGraph::kIsSortedX);
 
    if (high == -1111) high = GetN() - 1;
    //  Termination condition
@@ -2430,6 +2539,7 @@ void TGraph::Streamer(TBuffer &b)
             }
          }
          fMaxSize = fNpoints;
+         fSortedXStatus = 0;
          return;
       }
       //====process old versions before automatic schema evolution
@@ -2470,6 +2580,7 @@ void TGraph::Streamer(TBuffer &b)
          b >> fMaximum;
       }
       b.CheckByteCount(R__s, R__c, TGraph::IsA());
+      fSortedXStatus = 0;
       //====end of old versions
 
    } else {
@@ -2484,6 +2595,7 @@ void TGraph::SwapPoints(Int_t pos1, Int_t pos2)
 {
    SwapValues(fX, pos1, pos2);
    SwapValues(fY, pos1, pos2);
+   fSortedXStatus = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
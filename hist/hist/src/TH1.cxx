@@ -3402,6 +3402,11 @@ void TH1::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride
 ////////////////////////////////////////////////////////////////////////////////
 /// Internal method to fill histogram content from a vector
 /// called directly by TH1::BufferEmpty
+///
+/// Unless the axis can be extended, which may change the bins while filling,
+/// the values are processed by chunks: the bins of a chunk are found at once
+/// with TAxis::FindFixBins and the statistics are accumulated in local
+/// variables. The result is identical to filling the values one by one.
 
 void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
 {
@@ -3410,6 +3415,35 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
    fEntries += ntimes;
    Double_t ww = 1;
    Int_t nbins   = fXaxis.GetNbins();
+
+   if (!fXaxis.CanExtend()) {
+      const Bool_t statOverflows = GetStatOverflowsBehaviour();
+      Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+      const Int_t kChunk = 256;
+      Int_t bins[kChunk];
+      for (Int_t first = 0; first < ntimes; first += kChunk) {
+         const Int_t n = ntimes - first < kChunk ? ntimes - first : kChunk;
+         const Double_t *xc = x + Long64_t(first)*stride;
+         const Double_t *wc = w ? w + Long64_t(first)*stride : nullptr;
+         fXaxis.FindFixBins(n, xc, bins, stride);
+         for (i = 0; i < n; ++i) {
+            bin = bins[i];
+            if (wc) ww = wc[i*stride];
+            if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+            if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+            AddBinContent(bin, ww);
+            if ((bin == 0 || bin > nbins) && !statOverflows) continue;
+            const Double_t xx = xc[i*stride];
+            tsumw   += ww;
+            tsumw2  += ww*ww;
+            tsumwx  += ww*xx;
+            tsumwx2 += ww*xx*xx;
+         }
+      }
+      fTsumw = tsumw; fTsumw2 = tsumw2; fTsumwx = tsumwx; fTsumwx2 = tsumwx2;
+      return;
+   }
+
    ntimes *= stride;
    for (i=0;i<ntimes;i+=stride) {
       bin =fXaxis.FindBin(x[i]);
@@ -530,6 +530,9 @@ Int_t TH2::Fill(Double_t x, const char *namey, Double_t w)
 ///     by w[i]^2 in the bin corresponding to x[i],y[i].
 ///   - If w is NULL each entry is assumed a weight=1
 ///
+/// Unless an axis can be extended, the bins are found by chunks of values with
+/// TAxis::FindFixBins, as in TH1::DoFillN.
+///
 /// NB: function only valid for a TH2x object
 
 void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride)
@@ -554,6 +557,43 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
    }
 
    Double_t ww = 1;
+   if (!fXaxis.CanExtend() && !fYaxis.CanExtend()) {
+      const Int_t nbinsx = fXaxis.GetNbins();
+      const Int_t nbinsy = fYaxis.GetNbins();
+      const Bool_t statOverflows = GetStatOverflowsBehaviour();
+      Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+      Double_t tsumwy = fTsumwy, tsumwy2 = fTsumwy2, tsumwxy = fTsumwxy;
+      const Int_t kChunk = 256;
+      Int_t binsx[kChunk], binsy[kChunk];
+      for (Int_t first = ifirst; first < ntimes; first += kChunk*stride) {
+         const Int_t n = (ntimes - first + stride - 1)/stride < kChunk ? (ntimes - first + stride - 1)/stride : kChunk;
+         fXaxis.FindFixBins(n, x + first, binsx, stride);
+         fYaxis.FindFixBins(n, y + first, binsy, stride);
+         fEntries += n;
+         for (Int_t k = 0; k < n; ++k) {
+            i = first + k*stride;
+            binx = binsx[k];
+            biny = binsy[k];
+            bin  = biny*(nbinsx+2) + binx;
+            if (w) ww = w[i];
+            if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+            if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+            AddBinContent(bin,ww);
+            if ((binx == 0 || binx > nbinsx || biny == 0 || biny > nbinsy) && !statOverflows) continue;
+            tsumw   += ww;
+            tsumw2  += ww*ww;
+            tsumwx  += ww*x[i];
+            tsumwx2 += ww*x[i]*x[i];
+            tsumwy  += ww*y[i];
+            tsumwy2 += ww*y[i]*y[i];
+            tsumwxy += ww*x[i]*y[i];
+         }
+      }
+      fTsumw = tsumw; fTsumw2 = tsumw2; fTsumwx = tsumwx; fTsumwx2 = tsumwx2;
+      fTsumwy = tsumwy; fTsumwy2 = tsumwy2; fTsumwxy = tsumwxy;
+      return;
+   }
+
    for (i=ifirst;i<ntimes;i+=stride) {
       fEntries++;
       binx = fXaxis.FindBin(x[i]);
@@ -11,12 +11,19 @@
  *************************************************************************/
 
 #include "TH2Poly.h"
+#include "TH2PolyIndex.h"
 #include "TMultiGraph.h"
 #include "TGraph.h"
 #include "Riostream.h"
 #include "TList.h"
 #include "TMath.h"
 #include <cassert>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
 
 ClassImp(TH2Poly);
 
@@ -139,6 +146,19 @@ filling, it also adds a constant time delay into the code. When `Fill()`
 is to be called many times, it is more efficient to divide the histogram into
 a large number cells. However, if the histogram is to be filled only a few
 times, it is better to divide into a small number of cells.
+
+## Spatial index
+`FindBin()` and `Fill()` do not use the partition cells: on their first call
+after bins were added, an R-tree of the bounding boxes of the bins is built
+(ROOT::Internal::TH2PolyIndex). It adapts to the local density of the bins,
+so that histograms with many small bins in some regions and few large ones
+elsewhere are searched as fast as uniform ones, and the polygons made of
+`TGraph` are tested on a compact copy of their vertices. The partition cells
+are still maintained for the compatibility of the stored histograms.
+
+`FillN()` looks up the bins of all the points before filling them, in
+parallel if the implicit multi-threading is enabled, then fills them in the
+order of the points, so that the result is identical to a loop on `Fill()`.
 */
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -186,6 +206,7 @@ TH2Poly::~TH2Poly()
    delete[] fCells;
    delete[] fIsEmpty;
    delete[] fCompletelyInside;
+   delete fIndex;
    // delete at the end the bin List since it owns the objects
    delete fBins;
 }
@@ -253,6 +274,10 @@ Int_t TH2Poly::AddBin(TObject *poly)
    fBins->Add((TObject*) bin);
    SetNewBinAdded(kTRUE);
 
+   // The spatial index is rebuilt on the next search
+   delete fIndex;
+   fIndex = nullptr;
+
    // Adds the bin to the partition matrix
    AddBinToPartition(bin);
 
@@ -545,41 +570,39 @@ void TH2Poly::Reset(Option_t *opt)
 
 Int_t TH2Poly::FindBin(Double_t x, Double_t y, Double_t)
 {
+   Int_t overflow = FindOverflow(x, y);
+   if (overflow != -5) return overflow;
+
+   TH2PolyBin *bin = FindPolyBin(x, y);
+
+   // If the search has not returned a bin, the point must be on "the sea"
+   return bin ? bin->GetBinNumber() : -5;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the overflow bin of (x,y) as FindBin(), or -5 if the point is within
+/// the limits of the axes.
 
-   // Checks for overflow/underflow
+Int_t TH2Poly::FindOverflow(Double_t x, Double_t y) const
+{
    Int_t overflow = 0;
    if      (y > fYaxis.GetXmax()) overflow += -1;
    else if (y > fYaxis.GetXmin()) overflow += -4;
    else                           overflow += -7;
    if      (x > fXaxis.GetXmax()) overflow += -2;
    else if (x > fXaxis.GetXmin()) overflow += -1;
-   if (overflow != -5) return overflow;
-
-   // Finds the cell (x,y) coordinates belong to
-   Int_t n = (Int_t)(floor((x-fXaxis.GetXmin())/fStepX));
-   Int_t m = (Int_t)(floor((y-fYaxis.GetXmin())/fStepY));
-
-   // Make sure the array indices are correct.
-   if (n>=fCellX) n = fCellX-1;
-   if (m>=fCellY) m = fCellY-1;
-   if (n<0)       n = 0;
-   if (m<0)       m = 0;
-
-   if (fIsEmpty[n+fCellX*m]) return -5;
-
-   TH2PolyBin *bin;
-
-   TIter next(&fCells[n+fCellX*m]);
-   TObject *obj;
+   return overflow;
+}
 
-   // Search for the bin in the cell
-   while ((obj=next())) {
-      bin  = (TH2PolyBin*)obj;
-      if (bin->IsInside(x,y)) return bin->GetBinNumber();
-   }
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the first bin containing (x,y), or 0 if there is none.
+/// The spatial index is built on the first call after bins were added.
 
-   // If the search has not returned a bin, the point must be on "the sea"
-   return -5;
+TH2PolyBin *TH2Poly::FindPolyBin(Double_t x, Double_t y)
+{
+   if (!fBins) return 0;
+   if (!fIndex) fIndex = new ROOT::Internal::TH2PolyIndex(fBins);
+   return fIndex->FindBin(x, y);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -609,69 +632,48 @@ Int_t TH2Poly::Fill(Double_t x, Double_t y, Double_t w)
    // create sum of weight square array if weights are different than 1
    if (!fSumw2.fN && w != 1.0 && !TestBit(TH1::kIsNotW) )  Sumw2();
 
-   Int_t overflow = 0;
-   if      (y > fYaxis.GetXmax()) overflow += -1;
-   else if (y > fYaxis.GetXmin()) overflow += -4;
-   else                           overflow += -7;
-   if      (x > fXaxis.GetXmax()) overflow += -2;
-   else if(x > fXaxis.GetXmin())  overflow += -1;
+   Int_t overflow = FindOverflow(x, y);
+   return FillPolyBin(overflow == -5 ? FindPolyBin(x, y) : 0, overflow, x, y, w);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Increment by w the bin found for (x,y): the overflow bin if overflow is not
+/// -5, else the given bin, or the "sea" bin if it is null.
+
+Int_t TH2Poly::FillPolyBin(TH2PolyBin *bin, Int_t overflow, Double_t x, Double_t y, Double_t w)
+{
    if (overflow != -5) {
       fOverflow[-overflow - 1]+= w;
       if (fSumw2.fN) fSumw2.fArray[-overflow - 1] += w*w;
       return overflow;
    }
 
-   // Finds the cell (x,y) coordinates belong to
-   Int_t n = (Int_t)(floor((x-fXaxis.GetXmin())/fStepX));
-   Int_t m = (Int_t)(floor((y-fYaxis.GetXmin())/fStepY));
-
-   // Make sure the array indices are correct.
-   if (n>=fCellX) n = fCellX-1;
-   if (m>=fCellY) m = fCellY-1;
-   if (n<0)       n = 0;
-   if (m<0)       m = 0;
-
-   if (fIsEmpty[n+fCellX*m]) {
+   if (!bin) {
       fOverflow[4]+= w;
       if (fSumw2.fN) fSumw2.fArray[4] += w*w;
       return -5;
    }
 
-   TH2PolyBin *bin;
-   Int_t bi;
-
-   TIter next(&fCells[n+fCellX*m]);
-   TObject *obj;
-
-   while ((obj=next())) {
-      bin  = (TH2PolyBin*)obj;
-      // needs to account offset in array for overflow bins
-      bi = bin->GetBinNumber()-1+kNOverflow;
-      if (bin->IsInside(x,y)) {
-         bin->Fill(w);
-
-         // Statistics
-         fTsumw   = fTsumw + w;
-         fTsumw2  = fTsumw2 + w*w;
-         fTsumwx  = fTsumwx + w*x;
-         fTsumwx2 = fTsumwx2 + w*x*x;
-         fTsumwy  = fTsumwy + w*y;
-         fTsumwy2 = fTsumwy2 + w*y*y;
-         if (fSumw2.fN) {
-            assert(bi < fSumw2.fN);
-            fSumw2.fArray[bi] += w*w;
-         }
-         fEntries++;
+   // needs to account offset in array for overflow bins
+   Int_t bi = bin->GetBinNumber()-1+kNOverflow;
+   bin->Fill(w);
 
-         SetBinContentChanged(kTRUE);
-
-         return bin->GetBinNumber();
-      }
+   // Statistics
+   fTsumw   = fTsumw + w;
+   fTsumw2  = fTsumw2 + w*w;
+   fTsumwx  = fTsumwx + w*x;
+   fTsumwx2 = fTsumwx2 + w*x*x;
+   fTsumwy  = fTsumwy + w*y;
+   fTsumwy2 = fTsumwy2 + w*y*y;
+   if (fSumw2.fN) {
+      assert(bi < fSumw2.fN);
+      fSumw2.fArray[bi] += w*w;
    }
+   fEntries++;
 
-   fOverflow[4]+= w;
-   if (fSumw2.fN) fSumw2.fArray[4] += w*w;
-   return -5;
+   SetBinContentChanged(kTRUE);
+
+   return bin->GetBinNumber();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -705,14 +707,62 @@ Int_t TH2Poly::Fill(const char* name, Double_t w)
 ///                      (array size must be ntimes*stride)
 /// \param [in] x:       array of x values to be histogrammed
 /// \param [in] y:       array of y values to be histogrammed
-/// \param [in] w:       array of weights
+/// \param [in] w:       array of weights, or 0 for weights 1
 /// \param [in] stride:  step size through arrays x, y and w
+///
+/// The bins of all the points are looked up first, in parallel if the
+/// implicit multi-threading is enabled, then filled in the order of the points.
+/// Classes deriving from TH2Poly are filled with their own Fill().
 
 void TH2Poly::FillN(Int_t ntimes, const Double_t* x, const Double_t* y,
                                const Double_t* w, Int_t stride)
 {
-   for (int i = 0; i < ntimes; i += stride) {
-      Fill(x[i], y[i], w[i]);
+   if (IsA() != TH2Poly::Class()) {
+      for (int i = 0; i < ntimes; i += stride) {
+         Fill(x[i], y[i], w ? w[i] : 1.);
+      }
+      return;
+   }
+
+   if (fNcells <= kNOverflow || ntimes <= 0) return;
+   if (stride < 1) stride = 1;
+   Int_t npoints = (ntimes - 1) / stride + 1;
+
+   if (!fSumw2.fN && !TestBit(TH1::kIsNotW) && w) {
+      for (Int_t k = 0; k < npoints; ++k) {
+         if (w[k * stride] != 1.) {
+            Sumw2();
+            break;
+         }
+      }
+   }
+
+   // Builds the index before the parallel search
+   if (!fIndex) fIndex = new ROOT::Internal::TH2PolyIndex(fBins);
+
+   std::vector<Int_t> overflows(npoints);
+   std::vector<TH2PolyBin *> bins(npoints);
+   auto findBins = [&](std::size_t first, std::size_t last) {
+      for (std::size_t k = first; k < last; ++k) {
+         Double_t xk = x[k * stride], yk = y[k * stride];
+         overflows[k] = FindOverflow(xk, yk);
+         bins[k] = overflows[k] == -5 ? fIndex->FindBin(xk, yk) : 0;
+      }
+   };
+
+   Bool_t done = kFALSE;
+#ifdef R__USE_IMT
+   // Below 10000 points the tasks would cost more than they gain
+   if (npoints >= 10000 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.ForeachRange(findBins, 0, npoints);
+      done = kTRUE;
+   }
+#endif
+   if (!done) findBins(0, npoints);
+
+   for (Int_t k = 0; k < npoints; ++k) {
+      FillPolyBin(bins[k], overflows[k], x[k * stride], y[k * stride], w ? w[k * stride] : 1.);
    }
 }
 
@@ -986,6 +1036,7 @@ void TH2Poly::Initialize(Double_t xlow, Double_t xup,
    fDimension = 2;  //The dimension of the histogram
 
    fBins   = 0;
+   fIndex  = nullptr;
    fNcells = kNOverflow;
 
    // Sets the boundaries of the histogram
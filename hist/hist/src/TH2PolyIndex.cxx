@@ -0,0 +1,200 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class ROOT::Internal::TH2PolyIndex
+Spatial index of the bins of a TH2Poly.
+
+The bounding boxes of the bins are packed in an R-tree with the
+Sort-Tile-Recursive algorithm: the entries of a level are sorted by the x
+of their centre, cut in about sqrt(n) vertical slices, each slice is
+sorted by the y of the centres and cut in nodes of kNodeSize entries. The
+tree adapts to the density of the bins, contrary to the fixed grid of
+TH2Poly::ChangePartition(), and a point only visits the nodes whose box
+contains it.
+
+The polygons of the bins made of TGraph (or of a TMultiGraph of TGraph)
+are copied in flat arrays, on which the point-in-polygon test of
+TMath::IsInside is done without going through the TGraph objects. The
+other bins are tested with TH2PolyBin::IsInside.
+*/
+
+#include "TH2PolyIndex.h"
+
+#include "TGraph.h"
+#include "TH2Poly.h"
+#include "TList.h"
+#include "TMath.h"
+#include "TMultiGraph.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace ROOT {
+namespace Internal {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the index of the bins of the list, which must not change while the
+/// index is in use.
+
+TH2PolyIndex::TH2PolyIndex(TList *bins)
+{
+   fBinRings.push_back(0);
+   fRings.push_back(0);
+   TIter next(bins);
+   while (auto bin = (TH2PolyBin *)next()) {
+      fBins.push_back(bin);
+      fBinBoxes.push_back(Box{bin->GetXMin(), bin->GetXMax(), bin->GetYMin(), bin->GetYMax()});
+
+      // the rings of the polygon, only if they are all plain TGraph
+      std::vector<TGraph *> rings;
+      Bool_t generic = kFALSE;
+      TObject *poly = bin->GetPolygon();
+      if (poly->IsA() == TGraph::Class()) {
+         rings.push_back((TGraph *)poly);
+      } else if (poly->IsA() == TMultiGraph::Class()) {
+         if (TList *graphs = ((TMultiGraph *)poly)->GetListOfGraphs()) {
+            TIter nextGraph(graphs);
+            while (auto g = (TGraph *)nextGraph()) {
+               if (g->IsA() != TGraph::Class())
+                  generic = kTRUE;
+               rings.push_back(g);
+            }
+         }
+      } else {
+         generic = kTRUE;
+      }
+      fGeneric.push_back(generic);
+      if (!generic) {
+         for (TGraph *g : rings) {
+            fX.insert(fX.end(), g->GetX(), g->GetX() + g->GetN());
+            fY.insert(fY.end(), g->GetY(), g->GetY() + g->GetN());
+            fRings.push_back(fX.size());
+         }
+      }
+      fBinRings.push_back(fRings.size() - 1);
+   }
+
+   const Int_t n = fBins.size();
+   if (!n)
+      return;
+
+   // Sort the boxes with the Sort-Tile-Recursive algorithm, the indices of
+   // the sorted boxes are returned in order.
+   std::vector<Int_t> order;
+   auto sortTileRecursive = [&order](const std::vector<Box> &boxes) {
+      const Int_t nEntries = boxes.size();
+      order.resize(nEntries);
+      std::iota(order.begin(), order.end(), 0);
+      auto byX = [&boxes](Int_t a, Int_t b) {
+         return boxes[a].fXmin + boxes[a].fXmax < boxes[b].fXmin + boxes[b].fXmax;
+      };
+      auto byY = [&boxes](Int_t a, Int_t b) {
+         return boxes[a].fYmin + boxes[a].fYmax < boxes[b].fYmin + boxes[b].fYmax;
+      };
+      std::sort(order.begin(), order.end(), byX);
+      const Int_t nNodes = (nEntries + kNodeSize - 1) / kNodeSize;
+      const Int_t sliceSize = kNodeSize * (Int_t)std::ceil(std::sqrt((Double_t)nNodes));
+      for (Int_t first = 0; first < nEntries; first += sliceSize)
+         std::sort(order.begin() + first, order.begin() + std::min(first + sliceSize, nEntries), byY);
+   };
+
+   // Create the nodes grouping the sorted boxes by kNodeSize; the children
+   // of a node are at offset plus their position in the sort.
+   auto addNodes = [this, &order](const std::vector<Box> &boxes, Int_t offset, Bool_t leaf) {
+      const Int_t nEntries = boxes.size();
+      for (Int_t first = 0; first < nEntries; first += kNodeSize) {
+         const Int_t last = std::min(first + kNodeSize, nEntries);
+         Box box = boxes[order[first]];
+         for (Int_t k = first + 1; k < last; ++k) {
+            const Box &b = boxes[order[k]];
+            box.fXmin = std::min(box.fXmin, b.fXmin);
+            box.fXmax = std::max(box.fXmax, b.fXmax);
+            box.fYmin = std::min(box.fYmin, b.fYmin);
+            box.fYmax = std::max(box.fYmax, b.fYmax);
+         }
+         fNodes.push_back(Node{box, offset + first, offset + last, leaf});
+      }
+   };
+
+   // the leaves
+   sortTileRecursive(fBinBoxes);
+   fLeafBins = order;
+   Int_t levelFirst = fNodes.size();
+   addNodes(fBinBoxes, 0, kTRUE);
+   Int_t levelLast = fNodes.size();
+
+   // the upper levels, the nodes of the level below being reordered to be
+   // contiguous in their parent
+   while (levelLast - levelFirst > 1) {
+      std::vector<Node> level(fNodes.begin() + levelFirst, fNodes.begin() + levelLast);
+      std::vector<Box> boxes;
+      for (const Node &node : level)
+         boxes.push_back(node.fBox);
+      sortTileRecursive(boxes);
+      for (Int_t k = 0; k < (Int_t)level.size(); ++k)
+         fNodes[levelFirst + k] = level[order[k]];
+      addNodes(boxes, levelFirst, kFALSE);
+      levelFirst = levelLast;
+      levelLast = fNodes.size();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Whether (x,y) is inside the polygon of the bin of index bin, with the
+/// same test as TH2PolyBin::IsInside.
+
+Bool_t TH2PolyIndex::IsInside(Int_t bin, Double_t x, Double_t y) const
+{
+   if (fGeneric[bin])
+      return fBins[bin]->IsInside(x, y);
+   for (Int_t r = fBinRings[bin]; r < fBinRings[bin + 1]; ++r) {
+      const Int_t first = fRings[r];
+      if (TMath::IsInside(x, y, fRings[r + 1] - first, const_cast<Double_t *>(fX.data() + first),
+                          const_cast<Double_t *>(fY.data() + first)))
+         return kTRUE;
+   }
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the bin containing (x,y), the first one added if several do, or
+/// nullptr if none does.
+
+TH2PolyBin *TH2PolyIndex::FindBin(Double_t x, Double_t y) const
+{
+   if (fNodes.empty())
+      return nullptr;
+
+   // at most kNodeSize-1 pending siblings per level of the tree
+   Int_t stack[256];
+   Int_t size = 0;
+   stack[size++] = fNodes.size() - 1;
+   Int_t best = -1;
+   while (size) {
+      const Node &node = fNodes[stack[--size]];
+      if (!node.fBox.Contains(x, y))
+         continue;
+      if (node.fLeaf) {
+         for (Int_t k = node.fFirst; k < node.fLast; ++k) {
+            const Int_t bin = fLeafBins[k];
+            if ((best < 0 || bin < best) && fBinBoxes[bin].Contains(x, y) && IsInside(bin, x, y))
+               best = bin;
+         }
+      } else {
+         for (Int_t c = node.fFirst; c < node.fLast; ++c)
+            stack[size++] = c;
+      }
+   }
+   return best < 0 ? nullptr : fBins[best];
+}
+
+} // namespace Internal
+} // namespace ROOT
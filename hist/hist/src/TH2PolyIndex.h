@@ -0,0 +1,73 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TH2PolyIndex
+#define ROOT_TH2PolyIndex
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TH2PolyIndex                                                         //
+//                                                                      //
+// R-tree on the bounding boxes of the bins of a TH2Poly, with the      //
+// polygons copied in flat arrays for the point-in-polygon tests.       //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "RtypesCore.h"
+
+#include <vector>
+
+class TList;
+class TH2PolyBin;
+
+namespace ROOT {
+namespace Internal {
+
+class TH2PolyIndex {
+   /// Bounding box of a bin or of a node of the tree.
+   struct Box {
+      Double_t fXmin, fXmax, fYmin, fYmax;
+      Bool_t Contains(Double_t x, Double_t y) const { return fXmin <= x && x <= fXmax && fYmin <= y && y <= fYmax; }
+   };
+
+   /// Node of the tree; its children are the nodes, or the bins for the
+   /// leaves, of indices [fFirst, fLast).
+   struct Node {
+      Box   fBox;
+      Int_t fFirst;
+      Int_t fLast;
+      Bool_t fLeaf;
+   };
+
+   std::vector<TH2PolyBin *> fBins;     ///< Bins, in order of bin number
+   std::vector<Box>          fBinBoxes; ///< Bounding box of each bin
+   std::vector<Int_t>        fBinRings; ///< Rings of bin i are [fBinRings[i], fBinRings[i+1])
+   std::vector<Bool_t>       fGeneric;  ///< Whether bin i is not made of TGraph and is tested with TH2PolyBin::IsInside
+   std::vector<Int_t>        fRings;    ///< Points of ring r are [fRings[r], fRings[r+1])
+   std::vector<Double_t>     fX;        ///< X coordinates of the points of all rings
+   std::vector<Double_t>     fY;        ///< Y coordinates of the points of all rings
+   std::vector<Int_t>        fLeafBins; ///< Bin indices in the order of the leaves
+   std::vector<Node>         fNodes;    ///< Nodes of the tree, the root is the last one
+
+   Bool_t IsInside(Int_t bin, Double_t x, Double_t y) const;
+
+public:
+   /// Number of children of a node.
+   static constexpr Int_t kNodeSize = 16;
+
+   explicit TH2PolyIndex(TList *bins);
+
+   TH2PolyBin *FindBin(Double_t x, Double_t y) const;
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -383,6 +383,96 @@ Int_t TH3::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a 3-D histogram with an array of values and weights.
+///
+///  - ntimes:  number of entries in arrays x, y, z and w (array size must be ntimes*stride)
+///  - x:       array of x values to be histogrammed
+///  - y:       array of y values to be histogrammed
+///  - z:       array of z values to be histogrammed
+///  - w:       array of weights
+///  - stride:  step size through arrays x, y, z and w
+///
+/// The result is the same as calling Fill(x[i],y[i],z[i],w[i]) for each entry;
+/// if w is NULL each entry is assumed a weight=1.
+/// Unless an axis can be extended, the bins are found by chunks of values with
+/// TAxis::FindFixBins, as in TH1::DoFillN.
+
+void TH3::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w, Int_t stride)
+{
+   Int_t binx, biny, binz, bin, i;
+   ntimes *= stride;
+   Int_t ifirst = 0;
+
+   //If a buffer is activated, fill buffer
+   if (fBuffer) {
+      for (i=0;i<ntimes;i+=stride) {
+         if (!fBuffer) break; // buffer can be deleted in BufferFill when is empty
+         if (w) BufferFill(x[i],y[i],z[i],w[i]);
+         else BufferFill(x[i], y[i], z[i], 1.);
+      }
+      // fill the remaining entries if the buffer has been deleted
+      if (i < ntimes && fBuffer==0)
+         ifirst = i;
+      else
+         return;
+   }
+
+   Double_t ww = 1;
+   if (fXaxis.CanExtend() || fYaxis.CanExtend() || fZaxis.CanExtend()) {
+      for (i=ifirst;i<ntimes;i+=stride) {
+         if (w) ww = w[i];
+         Fill(x[i], y[i], z[i], ww);
+      }
+      return;
+   }
+
+   const Int_t nbinsx = fXaxis.GetNbins();
+   const Int_t nbinsy = fYaxis.GetNbins();
+   const Int_t nbinsz = fZaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+   Double_t tsumwy = fTsumwy, tsumwy2 = fTsumwy2, tsumwxy = fTsumwxy;
+   Double_t tsumwz = fTsumwz, tsumwz2 = fTsumwz2, tsumwxz = fTsumwxz, tsumwyz = fTsumwyz;
+   const Int_t kChunk = 256;
+   Int_t binsx[kChunk], binsy[kChunk], binsz[kChunk];
+   for (Int_t first = ifirst; first < ntimes; first += kChunk*stride) {
+      const Int_t n = (ntimes - first + stride - 1)/stride < kChunk ? (ntimes - first + stride - 1)/stride : kChunk;
+      fXaxis.FindFixBins(n, x + first, binsx, stride);
+      fYaxis.FindFixBins(n, y + first, binsy, stride);
+      fZaxis.FindFixBins(n, z + first, binsz, stride);
+      fEntries += n;
+      for (Int_t k = 0; k < n; ++k) {
+         i = first + k*stride;
+         binx = binsx[k];
+         biny = binsy[k];
+         binz = binsz[k];
+         bin  =  binx + (nbinsx+2)*(biny + (nbinsy+2)*binz);
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin,ww);
+         if ((binx == 0 || binx > nbinsx || biny == 0 || biny > nbinsy || binz == 0 || binz > nbinsz) && !statOverflows)
+            continue;
+         tsumw   += ww;
+         tsumw2  += ww*ww;
+         tsumwx  += ww*x[i];
+         tsumwx2 += ww*x[i]*x[i];
+         tsumwy  += ww*y[i];
+         tsumwy2 += ww*y[i]*y[i];
+         tsumwxy += ww*x[i]*y[i];
+         tsumwz  += ww*z[i];
+         tsumwz2 += ww*z[i]*z[i];
+         tsumwxz += ww*x[i]*z[i];
+         tsumwyz += ww*y[i]*z[i];
+      }
+   }
+   fTsumw = tsumw; fTsumw2 = tsumw2; fTsumwx = tsumwx; fTsumwx2 = tsumwx2;
+   fTsumwy = tsumwy; fTsumwy2 = tsumwy2; fTsumwxy = tsumwxy;
+   fTsumwz = tsumwz; fTsumwz2 = tsumwz2; fTsumwxz = tsumwxz; fTsumwyz = tsumwyz;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment cell defined by namex,namey,namez by a weight w
 ///
@@ -0,0 +1,145 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "THistConcurrentFill.h"
+
+#include "TError.h"
+#include "TH1.h"
+#include "TH3.h"
+#include "THnBase.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include "TProfile3D.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare the concurrent filling of hist by fillers buffering bufferSize
+/// entries each.
+
+THistConcurrentFillManager::THistConcurrentFillManager(TH1 &hist, Int_t bufferSize)
+   : fHist(&hist), fHistN(nullptr), fNCoord(hist.GetDimension()), fBufferSize(bufferSize > 0 ? bufferSize : 1)
+{
+   // The profiles take the value to average as an additional coordinate
+   if (hist.InheritsFrom(TProfile::Class()) || hist.InheritsFrom(TProfile2D::Class()) ||
+       hist.InheritsFrom(TProfile3D::Class()))
+      ++fNCoord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare the concurrent filling of hist by fillers buffering bufferSize
+/// entries each.
+
+THistConcurrentFillManager::THistConcurrentFillManager(THnBase &hist, Int_t bufferSize)
+   : fHist(nullptr), fHistN(&hist), fNCoord(hist.GetNdimensions()), fBufferSize(bufferSize > 0 ? bufferSize : 1)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a new filler of the histogram, to be used by one thread.
+
+THistConcurrentFiller THistConcurrentFillManager::MakeFiller()
+{
+   return THistConcurrentFiller(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the histogram with the n entries of a filler, each made of fNCoord
+/// coordinates followed by a weight. Called by the fillers, from any thread.
+
+void THistConcurrentFillManager::FillN(Int_t n, const Double_t *entries)
+{
+   const Int_t stride = fNCoord + 1;
+   std::lock_guard<std::mutex> lock(fFillMutex);
+   if (fHistN) {
+      for (Int_t i = 0; i < n; ++i)
+         fHistN->Fill(entries + i*stride, entries[i*stride + fNCoord]);
+      return;
+   }
+   switch (fNCoord) {
+   case 1:
+      fHist->FillN(n, entries, entries + 1, stride);
+      break;
+   case 2:
+      // TH2 or TProfile
+      fHist->FillN(n, entries, entries + 1, entries + 2, stride);
+      break;
+   case 3:
+      if (TH3 *h3 = dynamic_cast<TH3*>(fHist)) {
+         h3->FillN(n, entries, entries + 1, entries + 2, entries + 3, stride);
+      } else {
+         static_cast<TProfile2D*>(fHist)->FillN(n, entries, entries + 1, entries + 2, entries + 3, stride);
+      }
+      break;
+   case 4: {
+      TProfile3D *p3 = static_cast<TProfile3D*>(fHist);
+      for (const Double_t *e = entries; e != entries + n*stride; e += stride)
+         p3->Fill(e[0], e[1], e[2], e[3], e[4]);
+      break;
+   }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a filler buffering the entries for manager.
+
+THistConcurrentFiller::THistConcurrentFiller(THistConcurrentFillManager &manager) : fManager(&manager)
+{
+   fEntries.reserve(manager.fBufferSize * (manager.fNCoord + 1));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Take over the buffered entries of other.
+
+THistConcurrentFiller::THistConcurrentFiller(THistConcurrentFiller &&other)
+   : fManager(other.fManager), fEntries(std::move(other.fEntries))
+{
+   other.fEntries.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Buffer the entry made of the nargs arguments of Fill(): the coordinates,
+/// optionally followed by the weight.
+
+void THistConcurrentFiller::FillEntry(const Double_t *args, Int_t nargs)
+{
+   const Int_t ncoord = fManager->fNCoord;
+   if (nargs != ncoord && nargs != ncoord + 1) {
+      ::Error("THistConcurrentFiller::Fill", "Called with %d values for a histogram of %d coordinates", nargs, ncoord);
+      return;
+   }
+   fEntries.insert(fEntries.end(), args, args + nargs);
+   if (nargs == ncoord)
+      fEntries.push_back(1.);
+   if (fEntries.size() >= size_t(fManager->fBufferSize * (ncoord + 1)))
+      Flush();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Buffer the entry of coordinates x[0], ..., x[n-1] and weight w, where n is
+/// the number of coordinates of the histogram.
+
+void THistConcurrentFiller::Fill(const Double_t *x, Double_t w)
+{
+   const Int_t ncoord = fManager->fNCoord;
+   fEntries.insert(fEntries.end(), x, x + ncoord);
+   fEntries.push_back(w);
+   if (fEntries.size() >= size_t(fManager->fBufferSize * (ncoord + 1)))
+      Flush();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the histogram with the buffered entries.
+
+void THistConcurrentFiller::Flush()
+{
+   if (fEntries.empty())
+      return;
+   fManager->FillN(fEntries.size() / (fManager->fNCoord + 1), fEntries.data());
+   fEntries.clear();
+}
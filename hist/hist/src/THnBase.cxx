@@ -31,6 +31,90 @@
 #include "Fit/SparseData.h"
 #include "Math/MinimizerOptions.h"
 #include "Math/WrappedMultiTF1.h"
+#include "TROOT.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+namespace {
+   /// Return the number of tasks processing in parallel the nbins bins of a
+   /// histogram in Projection() or Rebin(): 1 unless IMT is enabled and the
+   /// histogram is large enough for the partial results to pay off.
+   UInt_t R__GetNParallelTasks(Long64_t nbins)
+   {
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && nbins >= (1 << 16))
+         return ROOT::GetThreadPoolSize();
+#endif
+      (void)nbins;
+      return 1;
+   }
+
+#ifdef R__USE_IMT
+   /// Call visit(task, bin, coord, buffer) for the bins of h, in the axis
+   /// ranges if respectAxisRange, where coord holds the coordinates of bin and
+   /// buffer can hold as many. The bins are split into nTasks ranges processed
+   /// in parallel by tasks numbered from 0. The empty bins of a THn are not
+   /// visited. Return whether bins out of range were skipped, like
+   /// THnIter::HaveSkippedBin().
+   template <class VISIT>
+   Bool_t R__VisitBinsParallel(const THnBase& h, Bool_t respectAxisRange, UInt_t nTasks, VISIT&& visit)
+   {
+      const Int_t ndim = h.GetNdimensions();
+      const Bool_t sparse = h.InheritsFrom(THnSparse::Class());
+      const Bool_t haveErrors = h.GetCalculateErrors();
+
+      // The bin ranges, as selected by the iterators of THn and THnSparse
+      std::vector<Int_t> first(ndim, 0), last(ndim, INT_MAX);
+      Bool_t haveRange = kFALSE;
+      for (Int_t d = 0; d < ndim; ++d) {
+         TAxis* axis = h.GetAxis(d);
+         if (!respectAxisRange || !axis->TestBit(TAxis::kAxisRange)) continue;
+         haveRange = kTRUE;
+         first[d] = axis->GetFirst();
+         last[d] = axis->GetLast();
+         if (!sparse && first[d] == 0 && last[d] == 0) {
+            first[d] = 1;
+            last[d] = axis->GetNbins();
+         }
+      }
+
+      // THn's iterator reports skipped bins as soon as an axis has a range
+      std::vector<char> skipped(nTasks, !sparse && haveRange);
+      const Long64_t nbins = h.GetNbins();
+      if (sparse && nbins) {
+         // creates the transient coordinate decoder of a THnSparse before the tasks use it
+         std::vector<Int_t> coord(ndim);
+         h.GetBinContent(0, coord.data());
+      }
+      auto task = [&](UInt_t t) {
+         std::vector<Int_t> coord(ndim), buffer(ndim);
+         const Long64_t begin = nbins / nTasks * t + std::min<Long64_t>(t, nbins % nTasks);
+         const Long64_t end = begin + nbins / nTasks + (t < nbins % nTasks);
+         for (Long64_t i = begin; i < end; ++i) {
+            if (!sparse && h.GetBinContent(i) == 0. && (!haveErrors || h.GetBinError2(i) == 0.))
+               continue;
+            h.GetBinContent(i, coord.data());
+            Bool_t inRange = kTRUE;
+            for (Int_t d = 0; inRange && d < ndim; ++d)
+               inRange = coord[d] >= first[d] && coord[d] <= last[d];
+            if (!inRange) {
+               skipped[t] = 1;
+               continue;
+            }
+            visit(t, i, coord.data(), buffer.data());
+         }
+      };
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(task, ROOT::TSeq<UInt_t>(nTasks));
+      return std::find(skipped.begin(), skipped.end(), 1) != skipped.end();
+   }
+#endif
+}
 
 
 /** \class THnBase
@@ -71,6 +155,42 @@ THnBase::~THnBase() {
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the n entries of coordinates x[i * GetNdimensions() + d] and weight
+/// w[i], or 1 if w is null; this is equivalent to calling Fill() for each.
+/// Unless an axis can be extended, the bins of each axis are found for
+/// chunks of entries at once with TAxis::FindFixBins().
+
+void THnBase::FillN(Int_t n, const Double_t *x, const Double_t *w /*= 0*/)
+{
+   Bool_t canExtend = kFALSE;
+   for (Int_t d = 0; d < fNdimensions; ++d)
+      canExtend |= GetAxis(d)->CanExtend();
+   if (canExtend) {
+      for (Int_t i = 0; i < n; ++i)
+         Fill(x + (Long64_t)i * fNdimensions, w ? w[i] : 1.);
+      return;
+   }
+
+   const Int_t kChunk = 256;
+   std::vector<Int_t> bins(kChunk * fNdimensions);
+   std::vector<Int_t> coord(fNdimensions);
+   for (Int_t first = 0; first < n; first += kChunk) {
+      const Int_t nchunk = n - first < kChunk ? n - first : kChunk;
+      const Double_t *xchunk = x + (Long64_t)first * fNdimensions;
+      for (Int_t d = 0; d < fNdimensions; ++d)
+         GetAxis(d)->FindFixBins(nchunk, xchunk + d, &bins[d * kChunk], fNdimensions);
+      for (Int_t i = 0; i < nchunk; ++i) {
+         for (Int_t d = 0; d < fNdimensions; ++d)
+            coord[d] = bins[d * kChunk + i];
+         const Double_t wi = w ? w[first + i] : 1.;
+         UpdateXStat(xchunk + i * fNdimensions, wi);
+         FillBin(GetBin(coord.data(), kTRUE /*alloc*/), wi);
+      }
+   }
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create a new THnBase object that is of the same type as *this,
 /// but with dimensions and bins given by axes.
@@ -521,61 +641,124 @@ TObject* THnBase::ProjectionAny(Int_t ndim, const Int_t* dim,
    Bool_t haveErrors = GetCalculateErrors();
    Bool_t wantErrors = haveErrors || (option && (strchr(option, 'E') || strchr(option, 'e')));
 
-   Int_t* bins  = new Int_t[ndim];
-   Long64_t myLinBin = 0;
-
-   THnIter iter(this, kTRUE /*use axis range*/);
-
-   while ((myLinBin = iter.Next()) >= 0) {
-      Double_t v = GetBinContent(myLinBin);
-
+   // Offsets of the target bins, computed once for all the bins
+   std::vector<Int_t> binOffsets(ndim, 0);
+   if (!keepTargetAxis) {
       for (Int_t d = 0; d < ndim; ++d) {
-         bins[d] = iter.GetCoord(dim[d]);
-         if (!keepTargetAxis && GetAxis(dim[d])->TestBit(TAxis::kAxisRange)) {
-            Int_t binOffset = GetAxis(dim[d])->GetFirst();
+         TAxis* axis = GetAxis(dim[d]);
+         if (axis->TestBit(TAxis::kAxisRange)) {
+            Int_t binOffset = axis->GetFirst();
             // Don't subtract even more if underflow is alreday included:
             if (binOffset > 0) --binOffset;
-            bins[d] -= binOffset;
+            binOffsets[d] = binOffset;
          }
       }
+   }
 
-      Long64_t targetLinBin = -1;
-      if (!wantNDim) {
-         if (ndim == 1) targetLinBin = bins[0];
-         else if (ndim == 2) targetLinBin = hist->GetBin(bins[0], bins[1]);
-         else if (ndim == 3) targetLinBin = hist->GetBin(bins[0], bins[1], bins[2]);
-      } else {
-         targetLinBin = hn->GetBin(bins, kTRUE /*allocate*/);
-      }
-
-      if (wantErrors) {
-         Double_t err2 = 0.;
-         if (haveErrors) {
-            err2 = GetBinError2(myLinBin);
-         } else {
-            err2 = v;
+   // Return the target bin of the bin of coordinates coord in targetN, or
+   // in hist if targetN is null
+   auto getTargetBin = [&](const Int_t* coord, Int_t* bins, THnBase* targetN) -> Long64_t {
+      for (Int_t d = 0; d < ndim; ++d)
+         bins[d] = coord[dim[d]] - binOffsets[d];
+      if (targetN) return targetN->GetBin(bins, kTRUE /*allocate*/);
+      if (ndim == 1) return bins[0];
+      if (ndim == 2) return hist->GetBin(bins[0], bins[1]);
+      if (ndim == 3) return hist->GetBin(bins[0], bins[1], bins[2]);
+      return -1;
+   };
+
+   Bool_t haveSkippedBin = kFALSE;
+   const UInt_t nTasks = R__GetNParallelTasks(GetNbins());
+   if (nTasks == 1) {
+      std::vector<Int_t> coord(fNdimensions);
+      std::vector<Int_t> bins(ndim);
+      Long64_t myLinBin = 0;
+
+      THnIter iter(this, kTRUE /*use axis range*/);
+
+      while ((myLinBin = iter.Next()) >= 0) {
+         Double_t v = GetBinContent(myLinBin);
+
+         for (Int_t d = 0; d < ndim; ++d)
+            coord[dim[d]] = iter.GetCoord(dim[d]);
+         Long64_t targetLinBin = getTargetBin(coord.data(), bins.data(), hn);
+
+         if (wantErrors) {
+            Double_t err2 = 0.;
+            if (haveErrors) {
+               err2 = GetBinError2(myLinBin);
+            } else {
+               err2 = v;
+            }
+            if (wantNDim) {
+               hn->AddBinError2(targetLinBin, err2);
+            } else {
+               Double_t preverr = hist->GetBinError(targetLinBin);
+               hist->SetBinError(targetLinBin, TMath::Sqrt(preverr * preverr + err2));
+            }
          }
-         if (wantNDim) {
-            hn->AddBinError2(targetLinBin, err2);
-         } else {
-            Double_t preverr = hist->GetBinError(targetLinBin);
-            hist->SetBinError(targetLinBin, TMath::Sqrt(preverr * preverr + err2));
+
+         // only _after_ error calculation, or sqrt(v) is taken into account!
+         if (wantNDim)
+            hn->AddBinContent(targetLinBin, v);
+         else
+            hist->AddBinContent(targetLinBin, v);
+      }
+      haveSkippedBin = iter.HaveSkippedBin();
+#ifdef R__USE_IMT
+   } else if (wantNDim) {
+      // Each task fills its own partial projection, added to hn at the end
+      std::vector<THnBase*> partials(nTasks);
+      for (auto& partial : partials)
+         partial = hn->CloneEmpty(hn->GetName(), hn->GetTitle(), hn->GetListOfAxes(), kTRUE);
+      haveSkippedBin = R__VisitBinsParallel(*this, kTRUE /*use axis range*/, nTasks,
+         [&](UInt_t task, Long64_t myLinBin, const Int_t* coord, Int_t* bins) {
+            THnBase* partial = partials[task];
+            Double_t v = GetBinContent(myLinBin);
+            Long64_t targetLinBin = getTargetBin(coord, bins, partial);
+            if (wantErrors)
+               partial->AddBinError2(targetLinBin, haveErrors ? GetBinError2(myLinBin) : v);
+            partial->AddBinContent(targetLinBin, v);
+         });
+      for (auto partial : partials) {
+         hn->Add(partial);
+         delete partial;
+      }
+   } else {
+      // Each task fills its own copy of the contents and squared errors of hist
+      const Int_t ncells = hist->GetNcells();
+      std::vector<std::vector<Double_t>> contents(nTasks), errors2(nTasks);
+      haveSkippedBin = R__VisitBinsParallel(*this, kTRUE /*use axis range*/, nTasks,
+         [&](UInt_t task, Long64_t myLinBin, const Int_t* coord, Int_t* bins) {
+            std::vector<Double_t>& content = contents[task];
+            if (content.empty()) {
+               content.resize(ncells);
+               if (wantErrors) errors2[task].resize(ncells);
+            }
+            Double_t v = GetBinContent(myLinBin);
+            Long64_t targetLinBin = getTargetBin(coord, bins, 0);
+            if (wantErrors)
+               errors2[task][targetLinBin] += haveErrors ? GetBinError2(myLinBin) : v;
+            content[targetLinBin] += v;
+         });
+      if (wantErrors && !hist->GetSumw2N())
+         hist->Sumw2();
+      for (UInt_t task = 0; task < nTasks; ++task) {
+         if (contents[task].empty()) continue;
+         for (Int_t bin = 0; bin < ncells; ++bin) {
+            if (wantErrors)
+               hist->GetSumw2()->fArray[bin] += errors2[task][bin];
+            if (contents[task][bin] != 0.)
+               hist->AddBinContent(bin, contents[task][bin]);
          }
       }
-
-      // only _after_ error calculation, or sqrt(v) is taken into account!
-      if (wantNDim)
-         hn->AddBinContent(targetLinBin, v);
-      else
-         hist->AddBinContent(targetLinBin, v);
+#endif
    }
 
-   delete [] bins;
-
    if (wantNDim) {
       hn->SetEntries(fEntries);
    } else {
-      if (!iter.HaveSkippedBin()) {
+      if (!haveSkippedBin) {
          hist->SetEntries(fEntries);
       } else {
          // re-compute the entries
@@ -1116,30 +1299,56 @@ THnBase* THnBase::RebinBase(const Int_t* group) const
    Bool_t haveErrors = GetCalculateErrors();
    Bool_t wantErrors = haveErrors;
 
-   Int_t* bins  = new Int_t[ndim];
-   Int_t* coord = new Int_t[fNdimensions];
+   // The new bin of each bin of each axis, computed once for all the bins
+   std::vector<std::vector<Int_t>> binMap(ndim);
+   for (Int_t d = 0; d < ndim; ++d) {
+      binMap[d].resize(GetAxis(d)->GetNbins() + 2);
+      for (Int_t bin = 0; bin < (Int_t)binMap[d].size(); ++bin)
+         binMap[d][bin] = TMath::CeilNint( (double) bin/group[d] );
+   }
 
-   Long64_t i = 0;
-   THnIter iter(this);
-   while ((i = iter.Next(coord)) >= 0) {
+   // Add the bin i of coordinates coord to target
+   auto rebinBin = [&](THnBase* target, Long64_t i, const Int_t* coord, Int_t* bins) {
       Double_t v = GetBinContent(i);
-      for (Int_t d = 0; d < ndim; ++d) {
-         bins[d] = TMath::CeilNint( (double) coord[d]/group[d] );
-      }
-      Long64_t idxh = h->GetBin(bins, kTRUE /*allocate*/);
+      for (Int_t d = 0; d < ndim; ++d)
+         bins[d] = binMap[d][coord[d]];
+      Long64_t idxh = target->GetBin(bins, kTRUE /*allocate*/);
 
       if (wantErrors) {
          // wantErrors == haveErrors, thus:
-         h->AddBinError2(idxh, GetBinError2(i));
+         target->AddBinError2(idxh, GetBinError2(i));
       }
 
       // only _after_ error calculation, or sqrt(v) is taken into account!
-      h->AddBinContent(idxh, v);
+      target->AddBinContent(idxh, v);
+   };
+
+   const UInt_t nTasks = R__GetNParallelTasks(GetNbins());
+   if (nTasks == 1) {
+      std::vector<Int_t> bins(ndim);
+      std::vector<Int_t> coord(fNdimensions);
+
+      Long64_t i = 0;
+      THnIter iter(this);
+      while ((i = iter.Next(coord.data())) >= 0)
+         rebinBin(h, i, coord.data(), bins.data());
+#ifdef R__USE_IMT
+   } else {
+      // Each task fills its own partial histogram, added to h at the end
+      std::vector<THnBase*> partials(nTasks);
+      for (auto& partial : partials)
+         partial = h->CloneEmpty(h->GetName(), h->GetTitle(), h->GetListOfAxes(), kTRUE);
+      R__VisitBinsParallel(*this, kFALSE /*all bins*/, nTasks,
+         [&](UInt_t task, Long64_t i, const Int_t* coord, Int_t* bins) {
+            rebinBin(partials[task], i, coord, bins);
+         });
+      for (auto partial : partials) {
+         h->Add(partial);
+         delete partial;
+      }
+#endif
    }
 
-   delete [] bins;
-   delete [] coord;
-
    h->SetEntries(fEntries);
 
    return h;
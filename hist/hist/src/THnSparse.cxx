@@ -18,6 +18,17 @@
 #include "TDataType.h"
 
 namespace {
+   /// Return the first slot to probe for hash in the index of the filled
+   /// bins of a THnSparse. The hash is mixed, as it is often the compact
+   /// coordinate itself, whose low bits only depend on the first axis.
+   inline Long64_t R__BinSlot(ULong64_t hash, Long64_t mask)
+   {
+      hash ^= hash >> 31;
+      hash *= 0x9e3779b97f4a7c15ULL;
+      hash ^= hash >> 29;
+      return (Long64_t)(hash & mask);
+   }
+
 //______________________________________________________________________________
 //
 // THnSparseBinIter iterates over all filled bins of a THnSparse.
@@ -271,9 +282,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromCoords(const Int_t* coord) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the index of bins.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the index's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -319,9 +330,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the index of bins.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the index's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -571,14 +582,13 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in fBinSlots, an open addressing
+hash table with linear probing storing the hash and the linear index of each
+filled bin. For the slots with the same hash, the coordinates of the bin are
+compared to the coordinates passed to GetBin(): two different coordinates
+having the same hash is extremely unlikely but (for the case where the compact
+bin coordinates are larger than 8 bytes) possible. The table is transient: it
+is rebuilt from the chunks when needed after reading a THnSparse.
 */
 
 
@@ -588,7 +598,7 @@ ClassImp(THnSparse);
 /// Construct an empty THnSparse.
 
 THnSparse::THnSparse():
-   fChunkSize(1024), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(1024), fFilledBins(0), fBinSlots(0), fNBinSlots(0), fNIndexedBins(0), fCompactCoord(0)
 {
    fBinContent.SetOwner();
 }
@@ -605,7 +615,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
                      const Int_t* nbins, const Double_t* xmin, const Double_t* xmax,
                      Int_t chunksize):
    THnBase(name, title, dim, nbins, xmin, xmax),
-   fChunkSize(chunksize), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(chunksize), fFilledBins(0), fBinSlots(0), fNBinSlots(0), fNIndexedBins(0), fCompactCoord(0)
 {
    fCompactCoord = new THnSparseCompactBinCoord(dim, nbins);
    fBinContent.SetOwner();
@@ -616,6 +626,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
 
 THnSparse::~THnSparse() {
    delete fCompactCoord;
+   delete [] fBinSlots;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -651,49 +662,83 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+/// We have been streamed; index the filled bins stored in the chunks
 
-void THnSparse::FillExMap()
+void THnSparse::FillBinIndex()
 {
+   fNIndexedBins = 0;
+   if (fBinSlots)
+      memset(fBinSlots, 0, sizeof(TBinSlot) * fNBinSlots);
+   ResizeBinIndex(GetNbins());
+
    TIter iChunk(&fBinContent);
    THnSparseArrayChunk* chunk = 0;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         IndexBin(compactCoord.GetHashFromBuffer(buf), idx);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the bin of index "bin" and hash "hash" to the index of the filled bins,
+/// which must not contain it yet.
+
+void THnSparse::IndexBin(ULong64_t hash, Long64_t bin)
+{
+   if (2 * (fNIndexedBins + 1) > fNBinSlots)
+      ResizeBinIndex(fNIndexedBins + 1 > fNBinSlots ? fNIndexedBins + 1 : fNBinSlots);
+   const Long64_t mask = fNBinSlots - 1;
+   Long64_t slot = R__BinSlot(hash, mask);
+   while (fBinSlots[slot].fBin)
+      slot = (slot + 1) & mask;
+   fBinSlots[slot].fHash = hash;
+   fBinSlots[slot].fBin = bin + 1;
+   ++fNIndexedBins;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make the index of the filled bins large enough for nbins bins, keeping
+/// it at most half full.
+
+void THnSparse::ResizeBinIndex(Long64_t nbins)
+{
+   Long64_t size = 16;
+   while (size < 2 * nbins)
+      size *= 2;
+   if (size <= fNBinSlots)
+      return;
+
+   TBinSlot *oldSlots = fBinSlots;
+   const Long64_t oldSize = fNBinSlots;
+   fBinSlots = new TBinSlot[size];
+   memset(fBinSlots, 0, sizeof(TBinSlot) * size);
+   fNBinSlots = size;
+   const Long64_t mask = size - 1;
+   for (Long64_t i = 0; i < oldSize; ++i) {
+      if (!oldSlots[i].fBin)
+         continue;
+      Long64_t slot = R__BinSlot(oldSlots[i].fHash, mask);
+      while (fBinSlots[slot].fBin)
+         slot = (slot + 1) & mask;
+      fBinSlots[slot] = oldSlots[i];
    }
+   delete [] oldSlots;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
-      FillExMap();
-   }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
+   if (!fBinSlots && fBinContent.GetEntriesFast()) {
+      FillBinIndex();
    }
+   ResizeBinIndex(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -791,19 +836,19 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
    ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
-      FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
+   if (!fBinSlots && fBinContent.GetEntriesFast())
+      FillBinIndex();
+   if (fNBinSlots) {
+      // Linear probing; the bins whose compact coordinate fits in the hash
+      // match as soon as their hash does.
+      const Long64_t mask = fNBinSlots - 1;
+      for (Long64_t slot = R__BinSlot(hash, mask); fBinSlots[slot].fBin; slot = (slot + 1) & mask) {
+         if (fBinSlots[slot].fHash != hash)
+            continue;
+         const Long64_t bin = fBinSlots[slot].fBin - 1; // we store idx+1, 0 is "empty slot"
+         if (GetChunk(bin / fChunkSize)->Matches(bin % fChunkSize, cc->GetBuffer()))
+            return bin;
+      }
    }
    if (!allocate) return -1;
 
@@ -820,16 +865,7 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   IndexBin(hash, newidx);
    return newidx;
 }
 
@@ -881,7 +917,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += sizeof(TBinSlot) * fNBinSlots /* index of the filled bins */;
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -963,8 +999,10 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   delete [] fBinSlots;
+   fBinSlots = 0;
+   fNBinSlots = 0;
+   fNIndexedBins = 0;
    fBinContent.Delete();
    ResetBase(option);
 }
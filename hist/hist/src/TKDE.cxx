@@ -50,9 +50,18 @@ class TKDE::TKernel {
    TKDE* fKDE;
    UInt_t fNWeights; // Number of kernel weights (bandwidth as vectorized for binning)
    std::vector<Double_t> fWeights; // Kernel weights (bandwidth)
+   std::vector<Double_t> fSortedData; // Data in increasing order, for the fast evaluation
+   std::vector<UInt_t> fSortedIndex;  // Index in the data of the points of fSortedData
+   Double_t fMaxWeight;               // Largest kernel weight
+   std::vector<Double_t> fGrid;       // Estimate on a regular grid, for the fast evaluation with a fixed weight
+   Double_t fGridMin;                 // First point of fGrid
+   Double_t fGridStep;                // Distance between the points of fGrid
+   Double_t GetSupport() const;
+   Double_t ComputeTruncatedSum(Double_t x) const;
 public:
    TKernel(Double_t weight, TKDE* kde);
    void ComputeAdaptiveWeights();
+   void InitFastEvaluation(UInt_t nGridPoints);
    Double_t operator()(Double_t x) const;
    Double_t GetWeight(Double_t x) const;
    Double_t GetFixedWeight() const;
@@ -79,7 +88,7 @@ TKDE::TKDE() :
    fGraph(nullptr),
    fUseMirroring(false), fMirrorLeft(false), fMirrorRight(false), fAsymLeft(false), fAsymRight(false),
    fUseBins(false), fNewData(false), fUseMinMaxFromData(false),
-   fNBins(0), fNEvents(0), fSumOfCounts(0), fUseBinsNEvents(0),
+   fNBins(0), fNEvents(0), fSumOfCounts(0), fUseBinsNEvents(0), fNGridPoints(0),
    fMean(0.),fSigma(0.), fSigmaRob(0.), fXMin(0.), fXMax(0.),
    fRho(0.), fAdaptiveBandwidthFactor(0.), fWeightSize(0)
 {
@@ -114,6 +123,7 @@ void TKDE::Instantiate(KernelFunction_Ptr kernfunc, UInt_t events, const Double_
    fNBins = events < 10000 ? 100 : events / 10;
    fNEvents = events;
    fUseBinsNEvents = 10000;
+   fNGridPoints = 0;
    fMean = 0.0;
    fSigma = 0.0;
    fXMin = xMin;
@@ -396,6 +406,24 @@ void TKDE::SetRange(Double_t xMin, Double_t xMax) {
    SetKernel();
 }
 
+void TKDE::SetFastEvaluation(UInt_t nGridPoints) {
+   // Sets User option for the fast evaluation of the estimate, costing O(nGridPoints) once and
+   // O(1) per evaluation instead of O(N) per evaluation for N data points (or bins).
+   // With a fixed bandwidth the data are linearly binned on a regular grid of nGridPoints
+   // points covering the data and the kernel support, convolved with the kernel, and the estimate
+   // is linearly interpolated between the grid points: the approximation error decreases as
+   // 1/nGridPoints**2. With an adaptive bandwidth (or nGridPoints = 1) the kernel sums only run
+   // over the data points within the kernel support, found in the sorted data, which gives the
+   // exact estimate. nGridPoints = 0 restores the direct evaluation.
+   // The fast evaluation is not available for user defined kernels, whose support is unknown.
+   if (nGridPoints && fKernelType == kUserDefined) {
+      Warning("SetFastEvaluation", "Fast evaluation is not supported for user defined kernels - use the exact evaluation");
+      nGridPoints = 0;
+   }
+   fNGridPoints = nGridPoints;
+   SetKernel();
+}
+
 // private methods
 
 void TKDE::SetUseBins() {
@@ -570,8 +598,12 @@ void TKDE::SetKernel() {
    weight *= fRho * fCanonicalBandwidths[fKernelType] / fCanonicalBandwidths[kGaussian];
    if (fKernel) delete fKernel;
    fKernel = new TKernel(weight, this);
+   Bool_t useFastEvaluation = fNGridPoints > 0 && fKernelType != kUserDefined;
+   if (useFastEvaluation) fKernel->InitFastEvaluation(fNGridPoints);
    if (fIteration == kAdaptive) {
       fKernel->ComputeAdaptiveWeights();
+      // sort again for the adaptive weights, no grid being used for them
+      if (useFastEvaluation) fKernel->InitFastEvaluation(fNGridPoints);
    }
    //std::cout << "setting the kernel - n = " << n << " weight is " << weight << "  " << fRho << "  " << fSigmaRob << "   " << fSigma << "   " << fMean << "  " << fCanonicalBandwidths[kGaussian] <<  std::endl;
 }
@@ -721,7 +753,10 @@ TKDE::TKernel::TKernel(Double_t weight, TKDE* kde) :
 // Internal class constructor
 fKDE(kde),
 fNWeights(kde->fData.size()),
-fWeights(fNWeights, weight)
+fWeights(fNWeights, weight),
+fMaxWeight(weight),
+fGridMin(0.),
+fGridStep(0.)
 {}
 
 void TKDE::TKernel::ComputeAdaptiveWeights() {
@@ -930,10 +965,122 @@ const std::vector<Double_t> & TKDE::TKernel::GetAdaptiveWeights() const {
    return fWeights;
 }
 
+Double_t TKDE::TKernel::GetSupport() const {
+   // Returns the half width of the support of the (built-in) kernel function
+   return (fKDE->fKernelType == kGaussian) ? 9. : 1.;
+}
+
+void TKDE::TKernel::InitFastEvaluation(UInt_t nGridPoints) {
+   // Prepares the fast evaluation: sorts the data for the sums truncated to the kernel support and,
+   // for a fixed weight and nGridPoints > 1, computes the estimate on a regular grid by linear
+   // binning of the data and discrete convolution with the kernel
+   UInt_t n = fKDE->fData.size();
+   const std::vector<Double_t> & data = fKDE->fData;
+   fSortedIndex.resize(n);
+   std::iota(fSortedIndex.begin(), fSortedIndex.end(), 0);
+   std::sort(fSortedIndex.begin(), fSortedIndex.end(), [&data](UInt_t i, UInt_t j) { return data[i] < data[j]; });
+   fSortedData.resize(n);
+   for (UInt_t i = 0; i < n; ++i) fSortedData[i] = data[fSortedIndex[i]];
+   fGrid.clear();
+   if (n == 0) return;
+   fMaxWeight = *std::max_element(fWeights.begin(), fWeights.end());
+   Double_t weight = fWeights[0];
+   if (nGridPoints < 2 || !(weight > 0) || *std::min_element(fWeights.begin(), fWeights.end()) != fMaxWeight) return;
+
+   Bool_t useBins = (fKDE->fBinCount.size() == n);
+   Double_t nSum = (useBins) ? fKDE->fSumOfCounts : fKDE->fNEvents;
+   if (nSum == 0) return;
+   // range of the data and of their reflections subtracted by the asymmetric mirroring
+   Double_t xmin = fSortedData.front();
+   Double_t xmax = fSortedData.back();
+   Double_t lo = xmin, hi = xmax;
+   if (fKDE->fAsymLeft) {
+      lo = std::min(lo, 2. * fKDE->fXMin - xmax);
+      hi = std::max(hi, 2. * fKDE->fXMin - xmin);
+   }
+   if (fKDE->fAsymRight) {
+      lo = std::min(lo, 2. * fKDE->fXMax - xmax);
+      hi = std::max(hi, 2. * fKDE->fXMax - xmin);
+   }
+   Double_t reach = GetSupport() * weight;
+   fGridMin = lo - reach;
+   fGridStep = (hi - lo + 2. * reach) / (nGridPoints - 1);
+
+   std::vector<Double_t> counts(nGridPoints, 0.0);
+   auto addPoint = [&](Double_t x, Double_t count) {
+      Double_t t = (x - fGridMin) / fGridStep;
+      UInt_t j = std::min(UInt_t(t), nGridPoints - 2);
+      Double_t frac = t - j;
+      counts[j] += count * (1. - frac);
+      counts[j + 1] += count * frac;
+   };
+   for (UInt_t i = 0; i < n; ++i) {
+      Double_t binCount = (useBins) ? fKDE->fBinCount[i] : 1.0;
+      addPoint(data[i], binCount);
+      if (fKDE->fAsymLeft) addPoint(2. * fKDE->fXMin - data[i], -binCount);
+      if (fKDE->fAsymRight) addPoint(2. * fKDE->fXMax - data[i], -binCount);
+   }
+
+   // kernel at the grid offsets, normalized
+   UInt_t nOffsets = std::min(UInt_t(reach / fGridStep) + 1, nGridPoints);
+   std::vector<Double_t> kernel(nOffsets);
+   for (UInt_t k = 0; k < nOffsets; ++k)
+      kernel[k] = (*fKDE->fKernelFunction)(k * fGridStep / weight) / (weight * nSum);
+
+   fGrid.assign(nGridPoints, 0.0);
+   for (UInt_t j = 0; j < nGridPoints; ++j) {
+      if (counts[j] == 0) continue;
+      UInt_t first = (j >= nOffsets - 1) ? j - (nOffsets - 1) : 0;
+      UInt_t last = std::min(j + nOffsets - 1, nGridPoints - 1);
+      for (UInt_t l = first; l <= last; ++l)
+         fGrid[l] += counts[j] * kernel[(l > j) ? l - j : j - l];
+   }
+}
+
+Double_t TKDE::TKernel::ComputeTruncatedSum(Double_t x) const {
+   // Returns the kernel density estimate summing only over the data within the kernel support of x
+   UInt_t n = fSortedData.size();
+   Bool_t useBins = (fKDE->fBinCount.size() == n);
+   Double_t nSum = (useBins) ? fKDE->fSumOfCounts : fKDE->fNEvents;
+   Double_t reach = GetSupport() * fMaxWeight;
+   // sum of the kernels at x of the points (or of their reflections about edge) within reach of centre
+   auto sumAround = [&](Double_t centre, Bool_t reflect, Double_t edge) {
+      Double_t sum = 0.0;
+      auto first = std::lower_bound(fSortedData.begin(), fSortedData.end(), centre - reach);
+      auto last = std::upper_bound(first, fSortedData.end(), centre + reach);
+      for (auto it = first; it != last; ++it) {
+         UInt_t i = fSortedIndex[it - fSortedData.begin()];
+         Double_t binCount = (useBins) ? fKDE->fBinCount[i] : 1.0;
+         Double_t point = (reflect) ? 2. * edge - *it : *it;
+         sum += binCount / fWeights[i] * (*fKDE->fKernelFunction)((x - point) / fWeights[i]);
+      }
+      return sum;
+   };
+   Double_t result = sumAround(x, kFALSE, 0.);
+   if (fKDE->fAsymLeft) {
+      result -= sumAround(2. * fKDE->fXMin - x, kTRUE, fKDE->fXMin);
+   }
+   if (fKDE->fAsymRight) {
+      result -= sumAround(2. * fKDE->fXMax - x, kTRUE, fKDE->fXMax);
+   }
+   return result / nSum;
+}
+
 Double_t TKDE::TKernel::operator()(Double_t x) const {
    // The internal class's unary function: returns the kernel density estimate
    Double_t result(0.0);
    UInt_t n = fKDE->fData.size();
+   // fast evaluation, unless data were added since its initialization
+   if (!fGrid.empty() && fSortedData.size() == n) {
+      Double_t t = (x - fGridMin) / fGridStep;
+      if (!(t >= 0) || t > fGrid.size() - 1) return 0.0;
+      UInt_t j = std::min(UInt_t(t), UInt_t(fGrid.size() - 2));
+      Double_t frac = t - j;
+      return (1. - frac) * fGrid[j] + frac * fGrid[j + 1];
+   }
+   if (!fSortedData.empty() && fSortedData.size() == n) {
+      return ComputeTruncatedSum(x);
+   }
    // case of bins or weighted data 
    Bool_t useBins = (fKDE->fBinCount.size() == n);
    Double_t nSum = (useBins) ? fKDE->fSumOfCounts : fKDE->fNEvents;
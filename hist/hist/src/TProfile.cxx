@@ -766,6 +766,10 @@ Int_t TProfile::Fill(const char *namex, Double_t y, Double_t w)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill a Profile histogram with weights.
+///
+/// Unless the axis can be extended, the bins are found by chunks of values with
+/// TAxis::FindFixBins and the statistics are accumulated in local variables, as
+/// in TH1::DoFillN. The result is identical to filling the values one by one.
 
 void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride)
 {
@@ -787,6 +791,43 @@ void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const D
          return;
    }
 
+   if (!fXaxis.CanExtend()) {
+      const Int_t nbins = fXaxis.GetNbins();
+      const Bool_t statOverflows = GetStatOverflowsBehaviour();
+      Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+      Double_t tsumwy = fTsumwy, tsumwy2 = fTsumwy2;
+      const Int_t kChunk = 256;
+      Int_t bins[kChunk];
+      for (Int_t first = ifirst; first < ntimes; first += kChunk*stride) {
+         const Int_t n = (ntimes - first + stride - 1)/stride < kChunk ? (ntimes - first + stride - 1)/stride : kChunk;
+         fXaxis.FindFixBins(n, x + first, bins, stride);
+         for (Int_t k = 0; k < n; ++k) {
+            i = first + k*stride;
+            if (fYmin != fYmax) {
+               if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
+            }
+            Double_t u = (w) ? w[i] : 1;
+            fEntries++;
+            bin = bins[k];
+            AddBinContent(bin, u*y[i]);
+            fSumw2.fArray[bin] += u*y[i]*y[i];
+            if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();  // must be called before accumulating the entries
+            if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
+            fBinEntries.fArray[bin] += u;
+            if ((bin == 0 || bin > nbins) && !statOverflows) continue;
+            tsumw   += u;
+            tsumw2  += u*u;
+            tsumwx  += u*x[i];
+            tsumwx2 += u*x[i]*x[i];
+            tsumwy  += u*y[i];
+            tsumwy2 += u*y[i]*y[i];
+         }
+      }
+      fTsumw = tsumw; fTsumw2 = tsumw2; fTsumwx = tsumwx; fTsumwx2 = tsumwx2;
+      fTsumwy = tsumwy; fTsumwy2 = tsumwy2;
+      return;
+   }
+
    for (i=ifirst;i<ntimes;i+=stride) {
       if (fYmin != fYmax) {
          if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
@@ -795,6 +795,80 @@ Int_t TProfile2D::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a Profile2D histogram with the ntimes entries (x[i], y[i], z[i]) of
+/// weights w[i], or 1 if w is null, reading the arrays with step stride.
+///
+/// Unless an axis can be extended, the bins are found by chunks of values with
+/// TAxis::FindFixBins and the statistics are accumulated in local variables, as
+/// in TH2::FillN. The result is identical to filling the values one by one.
+
+void TProfile2D::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w, Int_t stride)
+{
+   Int_t bin,binx,biny,i;
+   ntimes *= stride;
+   Int_t ifirst = 0;
+   //If a buffer is activated, fill buffer
+   if (fBuffer) {
+      for (i=0;i<ntimes;i+=stride) {
+         if (!fBuffer) break; // buffer can be deleted in BufferFill when is empty
+         BufferFill(x[i], y[i], z[i], w ? w[i] : 1.);
+      }
+      // fill the remaining entries if the buffer has been deleted
+      if (i < ntimes && fBuffer==0)
+         ifirst = i;  // start from i
+      else
+         return;
+   }
+
+   if (fXaxis.CanExtend() || fYaxis.CanExtend()) {
+      for (i=ifirst;i<ntimes;i+=stride)
+         Fill(x[i], y[i], z[i], w ? w[i] : 1.);
+      return;
+   }
+
+   const Int_t nbinsx = fXaxis.GetNbins();
+   const Int_t nbinsy = fYaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+   Double_t tsumwy = fTsumwy, tsumwy2 = fTsumwy2, tsumwxy = fTsumwxy, tsumwz = fTsumwz, tsumwz2 = fTsumwz2;
+   const Int_t kChunk = 256;
+   Int_t binsx[kChunk], binsy[kChunk];
+   for (Int_t first = ifirst; first < ntimes; first += kChunk*stride) {
+      const Int_t n = (ntimes - first + stride - 1)/stride < kChunk ? (ntimes - first + stride - 1)/stride : kChunk;
+      fXaxis.FindFixBins(n, x + first, binsx, stride);
+      fYaxis.FindFixBins(n, y + first, binsy, stride);
+      for (Int_t k = 0; k < n; ++k) {
+         i = first + k*stride;
+         if (fZmin != fZmax) {
+            if (z[i] <fZmin || z[i]> fZmax || TMath::IsNaN(z[i])) continue;
+         }
+         Double_t u = (w) ? w[i] : 1;
+         fEntries++;
+         binx = binsx[k];
+         biny = binsy[k];
+         bin  = biny*(nbinsx+2) + binx;
+         AddBinContent(bin, u*z[i]);
+         fSumw2.fArray[bin] += u*z[i]*z[i];
+         if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();  // must be called before accumulating the entries
+         if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
+         fBinEntries.fArray[bin] += u;
+         if ((binx == 0 || binx > nbinsx || biny == 0 || biny > nbinsy) && !statOverflows) continue;
+         tsumw   += u;
+         tsumw2  += u*u;
+         tsumwx  += u*x[i];
+         tsumwx2 += u*x[i]*x[i];
+         tsumwy  += u*y[i];
+         tsumwy2 += u*y[i]*y[i];
+         tsumwxy += u*x[i]*y[i];
+         tsumwz  += u*z[i];
+         tsumwz2 += u*z[i]*z[i];
+      }
+   }
+   fTsumw = tsumw; fTsumw2 = tsumw2; fTsumwx = tsumwx; fTsumwx2 = tsumwx2;
+   fTsumwy = tsumwy; fTsumwy2 = tsumwy2; fTsumwxy = tsumwxy; fTsumwz = tsumwz; fTsumwz2 = tsumwz2;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return bin content of a Profile2D histogram.
 
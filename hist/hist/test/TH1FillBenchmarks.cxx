@@ -0,0 +1,83 @@
+#include "TH1D.h"
+#include "TH2D.h"
+#include "TRandom3.h"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+static std::vector<Double_t> RandomValues(std::size_t n)
+{
+   TRandom3 rng(1);
+   std::vector<Double_t> values(n);
+   for (auto &v : values)
+      v = rng.Gaus(0, 1);
+   return values;
+}
+
+static void BM_TH1D_Fill(benchmark::State &state)
+{
+   auto values = RandomValues(1 << 16);
+   TH1D h("h", "h", state.range(0), -5, 5);
+   h.SetDirectory(nullptr);
+   for (auto _ : state) {
+      for (auto v : values)
+         h.Fill(v);
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_TH1D_Fill)->Arg(100)->Arg(10000);
+
+static void BM_TH1D_FillWeighted(benchmark::State &state)
+{
+   auto values = RandomValues(1 << 16);
+   TH1D h("h", "h", state.range(0), -5, 5);
+   h.SetDirectory(nullptr);
+   h.Sumw2();
+   for (auto _ : state) {
+      for (auto v : values)
+         h.Fill(v, 0.5);
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_TH1D_FillWeighted)->Arg(100)->Arg(10000);
+
+static void BM_TH1D_FillN(benchmark::State &state)
+{
+   auto values = RandomValues(1 << 16);
+   TH1D h("h", "h", state.range(0), -5, 5);
+   h.SetDirectory(nullptr);
+   for (auto _ : state)
+      h.FillN(values.size(), values.data(), nullptr);
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_TH1D_FillN)->Arg(100)->Arg(10000);
+
+static void BM_TH1D_FillVariableBins(benchmark::State &state)
+{
+   auto values = RandomValues(1 << 16);
+   std::vector<Double_t> edges(state.range(0) + 1);
+   for (std::size_t i = 0; i < edges.size(); ++i)
+      edges[i] = -5 + 10. * (i * i) / ((edges.size() - 1) * (edges.size() - 1));
+   TH1D h("h", "h", state.range(0), edges.data());
+   h.SetDirectory(nullptr);
+   for (auto _ : state) {
+      for (auto v : values)
+         h.Fill(v);
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_TH1D_FillVariableBins)->Arg(100)->Arg(10000);
+
+static void BM_TH2D_Fill(benchmark::State &state)
+{
+   auto values = RandomValues(1 << 16);
+   TH2D h("h", "h", state.range(0), -5, 5, state.range(0), -5, 5);
+   h.SetDirectory(nullptr);
+   for (auto _ : state) {
+      for (std::size_t i = 1; i < values.size(); ++i)
+         h.Fill(values[i - 1], values[i]);
+   }
+   state.SetItemsProcessed(state.iterations() * (values.size() - 1));
+}
+BENCHMARK(BM_TH2D_Fill)->Arg(100)->Arg(1000);
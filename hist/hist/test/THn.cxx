@@ -1,8 +1,14 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
+#include "TBufferFile.h"
+#include "TROOT.h"
+
+#include <map>
+#include <vector>
 
 // Filling THn
 TEST(THn, Fill) {
@@ -111,3 +117,133 @@ TEST(THn, Projection) {
    }
 
 }
+
+// Coordinates of 12 dimensions, whose compact form does not fit in 8 bytes
+static std::vector<Double_t> SparseValues(Int_t n, Int_t ndim)
+{
+   std::vector<Double_t> x;
+   UInt_t seed = 12345;
+   for (Int_t i = 0; i < n * ndim; ++i) {
+      seed = seed * 1103515245 + 12345;
+      x.push_back(((seed >> 8) % 1100) / 1000. - 0.05);
+   }
+   return x;
+}
+
+// Finding the filled bins of a THnSparse, also after streaming
+TEST(THnSparse, GetBin) {
+   const Int_t ndim = 12;
+   std::vector<Int_t> bins(ndim, 1000);
+   std::vector<Double_t> xmin(ndim, 0.), xmax(ndim, 1.);
+   THnSparseD hs("hs", "hs", ndim, bins.data(), xmin.data(), xmax.data(), 256);
+
+   const Int_t n = 5000;
+   auto x = SparseValues(n, ndim);
+   std::map<std::vector<Int_t>, Double_t> expected;
+   std::vector<Int_t> coord(ndim);
+   for (Int_t i = 0; i < n; ++i) {
+      // fill each bin twice
+      const Double_t *xi = &x[(i / 2) * ndim];
+      for (Int_t d = 0; d < ndim; ++d)
+         coord[d] = hs.GetAxis(d)->FindFixBin(xi[d]);
+      expected[coord] += i;
+      hs.Fill(xi, i);
+   }
+   EXPECT_EQ((Long64_t)expected.size(), hs.GetNbins());
+
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteObjectAny(&hs, THnSparseD::Class());
+   buf.SetReadMode();
+   buf.SetBufferOffset(0);
+   THnSparseD *hr = (THnSparseD *)buf.ReadObjectAny(THnSparseD::Class());
+   ASSERT_NE(nullptr, hr);
+
+   for (THnSparse *h : {(THnSparse *)&hs, (THnSparse *)hr}) {
+      for (auto &bin : expected) {
+         Long64_t idx = h->GetBin(bin.first.data(), kFALSE);
+         ASSERT_GE(idx, 0);
+         EXPECT_DOUBLE_EQ(bin.second, h->GetBinContent(idx));
+      }
+      std::vector<Int_t> empty(ndim, 0);
+      EXPECT_EQ(-1, h->GetBin(empty.data(), kFALSE));
+   }
+   delete hr;
+}
+
+// FillN is equivalent to Fill for each entry
+TEST(THnSparse, FillN) {
+   const Int_t ndim = 12;
+   std::vector<Int_t> bins(ndim, 1000);
+   std::vector<Double_t> xmin(ndim, 0.), xmax(ndim, 1.);
+   THnSparseD h1("h1", "h1", ndim, bins.data(), xmin.data(), xmax.data());
+   THnSparseD h2("h2", "h2", ndim, bins.data(), xmin.data(), xmax.data());
+   h1.Sumw2();
+   h2.Sumw2();
+
+   const Int_t n = 1000;
+   auto x = SparseValues(n, ndim);
+   std::vector<Double_t> w(n);
+   for (Int_t i = 0; i < n; ++i) {
+      w[i] = 0.5 + i % 3;
+      h1.Fill(&x[i * ndim], w[i]);
+   }
+   h2.FillN(n, x.data(), w.data());
+
+   ASSERT_EQ(h1.GetNbins(), h2.GetNbins());
+   std::vector<Int_t> coord(ndim);
+   for (Long64_t i = 0; i < h1.GetNbins(); ++i) {
+      Double_t v = h1.GetBinContent(i, coord.data());
+      EXPECT_EQ(v, h2.GetBinContent(h2.GetBin(coord.data(), kFALSE)));
+   }
+   EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+   EXPECT_EQ(h1.GetSumw(), h2.GetSumw());
+   EXPECT_EQ(h1.GetSumw2(), h2.GetSumw2());
+}
+
+#ifdef R__USE_IMT
+// Projection and Rebin give the same result in parallel
+TEST(THn, ParallelProjectionAndRebin) {
+   Int_t bins[4] = {20, 20, 20, 20};
+   Double_t xmin[4] = {0., 0., 0., 0.};
+   Double_t xmax[4] = {1., 1., 1., 1.};
+   THnD hn("hn", "hn", 4, bins, xmin, xmax);
+   hn.Sumw2();
+   auto x = SparseValues(20000, 4);
+   for (size_t i = 0; i < x.size(); i += 4)
+      hn.Fill(&x[i], 1. + i % 3);
+   hn.GetAxis(3)->SetRange(3, 12);
+
+   auto compute = [&hn](std::vector<Double_t> &result, Double_t &entries) {
+      TH2D *h2 = hn.Projection(1, 0, "E");
+      THnBase *h3 = hn.ProjectionND(3, std::vector<Int_t>{0, 1, 3}.data(), "E");
+      THnBase *hr = hn.Rebin(3);
+      result.clear();
+      for (Int_t bin = 0; bin < h2->GetNcells(); ++bin) {
+         result.push_back(h2->GetBinContent(bin));
+         result.push_back(h2->GetBinError(bin));
+      }
+      for (THnBase *h : {h3, hr}) {
+         for (Long64_t bin = 0; bin < h->GetNbins(); ++bin) {
+            result.push_back(h->GetBinContent(bin));
+            result.push_back(h->GetBinError2(bin));
+         }
+      }
+      entries = h2->GetEntries();
+      delete h2;
+      delete h3;
+      delete hr;
+   };
+
+   std::vector<Double_t> serial, parallel;
+   Double_t serialEntries = 0., parallelEntries = 0.;
+   compute(serial, serialEntries);
+   ROOT::EnableImplicitMT(4);
+   compute(parallel, parallelEntries);
+   ROOT::DisableImplicitMT();
+
+   ASSERT_EQ(serial.size(), parallel.size());
+   for (size_t i = 0; i < serial.size(); ++i)
+      EXPECT_DOUBLE_EQ(serial[i], parallel[i]) << "value " << i;
+   EXPECT_DOUBLE_EQ(serialEntries, parallelEntries);
+}
+#endif
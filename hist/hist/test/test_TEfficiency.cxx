@@ -4,7 +4,10 @@
 #include "TH1.h"
 #include "Math/QuantFuncMathCore.h"
 
+#include <cmath>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -399,4 +402,44 @@ TEST(TFEfficiency, ConfIntervals)
 TEST(TFEfficiency, ConsistencyWithTGraph)
 {
    testConsistencyWithTGraph();
-}
\ No newline at end of file
+}
+// FillN gives the same result as Fill and FillWeighted
+TEST(TFEfficiency, FillN)
+{
+   const int n = 1000;
+   std::vector<double> x(n), y(n), w(n);
+   std::unique_ptr<Bool_t[]> passed(new Bool_t[n]);
+   for (int i = 0; i < n; ++i) {
+      x[i] = -0.1 + 0.0012 * i;
+      y[i] = std::sin(double(i));
+      w[i] = 0.5 + 0.001 * i;
+      passed[i] = (i % 3) != 0;
+   }
+
+   TEfficiency e1("e1", "e1", 7, 0., 1.);
+   TEfficiency e2("e2", "e2", 7, 0., 1.);
+   e1.SetDirectory(nullptr);
+   e2.SetDirectory(nullptr);
+   for (int i = 0; i < n; ++i)
+      e1.Fill(passed[i], x[i]);
+   e2.FillN(n, passed.get(), x.data());
+   for (int bin = 0; bin <= 8; ++bin) {
+      EXPECT_EQ(e1.GetTotalHistogram()->GetBinContent(bin), e2.GetTotalHistogram()->GetBinContent(bin));
+      EXPECT_EQ(e1.GetPassedHistogram()->GetBinContent(bin), e2.GetPassedHistogram()->GetBinContent(bin));
+   }
+
+   TEfficiency e3("e3", "e3", 4, 0., 1., 3, -1., 1.);
+   TEfficiency e4("e4", "e4", 4, 0., 1., 3, -1., 1.);
+   e3.SetDirectory(nullptr);
+   e4.SetDirectory(nullptr);
+   for (int i = 0; i < n; ++i)
+      e3.FillWeighted(passed[i], w[i], x[i], y[i]);
+   e4.FillN(n, passed.get(), x.data(), y.data(), nullptr, w.data());
+   EXPECT_TRUE(e4.UsesWeights());
+   for (int bin = 0; bin < e3.GetTotalHistogram()->GetNcells(); ++bin) {
+      EXPECT_EQ(e3.GetTotalHistogram()->GetBinContent(bin), e4.GetTotalHistogram()->GetBinContent(bin));
+      EXPECT_EQ(e3.GetTotalHistogram()->GetBinError(bin), e4.GetTotalHistogram()->GetBinError(bin));
+      EXPECT_EQ(e3.GetPassedHistogram()->GetBinContent(bin), e4.GetPassedHistogram()->GetBinContent(bin));
+      EXPECT_EQ(e3.GetPassedHistogram()->GetBinError(bin), e4.GetPassedHistogram()->GetBinError(bin));
+   }
+}
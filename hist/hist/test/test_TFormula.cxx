@@ -1,9 +1,96 @@
 #include "gtest/gtest.h"
 
 #include "TFormula.h"
+#include "TF1.h"
+#include "TH1.h"
+#include "TROOT.h"
+#include "TFitResult.h"
+
+#include <cmath>
+#include <vector>
 
 // Test that autoloading works (ROOT-9840)
 TEST(TFormula, Interp)
 {
   TFormula f("func", "TGeoBBox::DeclFileLine()");
 }
+
+// Test that EvalParN() evaluates the points as EvalPar()
+TEST(TFormula, EvalParN)
+{
+  TFormula f("fEvalParN", "[0] + [1] * x + y * y");
+  f.SetParameters(1., 2.);
+  const int n = 1000;
+  std::vector<double> x(2 * n);
+  for (int i = 0; i < n; ++i) {
+    x[2 * i] = 0.01 * i;
+    x[2 * i + 1] = -0.5 * i;
+  }
+  std::vector<double> result(n);
+  f.EvalParN(n, x.data(), result.data());
+  for (int i = 0; i < n; ++i)
+    EXPECT_DOUBLE_EQ(f.EvalPar(&x[2 * i]), result[i]);
+
+  const double params[] = {3., -1.};
+  f.EvalParN(n, x.data(), result.data(), params);
+  for (int i = 0; i < n; ++i)
+    EXPECT_DOUBLE_EQ(f.EvalPar(&x[2 * i], params), result[i]);
+}
+
+#ifdef R__USE_IMT
+// Test that a multithreaded chi2 fit, which evaluates the formula on batches of
+// points from several threads before its batch function is generated, finds
+// the same parameters as a serial fit
+TEST(TFormula, EvalParNMultithreadFit)
+{
+  ROOT::EnableImplicitMT(4);
+  TH1D h("hEvalParNFit", "hEvalParNFit", 2000, 0., 10.);
+  for (int i = 1; i <= h.GetNbinsX(); ++i) {
+    const double x = h.GetBinCenter(i);
+    h.SetBinContent(i, 100. * std::exp(-0.3 * x) + 5. + std::sin(37. * x));
+    h.SetBinError(i, 1.);
+  }
+
+  for (int attempt = 0; attempt < 5; ++attempt) {
+    // New formulas each time, so that the batch function is generated during the fit
+    TF1 fSerial("fSerial", TString::Format("[0] * exp(-[1] * x) + [2] + %d * 0.", attempt), 0., 10.);
+    TF1 fParallel("fParallel", TString::Format("[0] * exp(-[1] * x) + [2] + %d * 0. + 0.", attempt), 0., 10.);
+    fSerial.SetParameters(50., 0.5, 1.);
+    fParallel.SetParameters(50., 0.5, 1.);
+
+    auto rSerial = h.Fit(&fSerial, "Q N S SERIAL");
+    auto rParallel = h.Fit(&fParallel, "Q N S MULTITHREAD");
+    ASSERT_EQ(rSerial->Status(), 0);
+    ASSERT_EQ(rParallel->Status(), 0);
+    for (int ipar = 0; ipar < 3; ++ipar)
+      EXPECT_NEAR(rSerial->Parameter(ipar), rParallel->Parameter(ipar), 1.e-6 * std::abs(rSerial->Parameter(ipar)));
+    EXPECT_NEAR(rSerial->Chi2(), rParallel->Chi2(), 1.e-6 * rSerial->Chi2());
+  }
+  ROOT::DisableImplicitMT();
+}
+#endif
+
+// Test that identical formulas created from the cache of processed formulas
+// keep their own name and parameters
+TEST(TFormula, CachedFormula)
+{
+  TFormula f1("fCached1", "[0] * exp(-x * [1])");
+  TFormula f2("fCached2", "[0]*exp(-x*[1])");
+  EXPECT_STREQ("fCached2", f2.GetName());
+  EXPECT_STREQ("[0]*exp(-x*[1])", f2.GetTitle());
+  EXPECT_EQ(f1.GetNpar(), f2.GetNpar());
+  EXPECT_EQ(f1.GetNdim(), f2.GetNdim());
+  f1.SetParameters(1., 2.);
+  f2.SetParameters(3., 0.5);
+  const double x = 0.7;
+  EXPECT_DOUBLE_EQ(1. * std::exp(-x * 2.), f1.Eval(x));
+  EXPECT_DOUBLE_EQ(3. * std::exp(-x * 0.5), f2.Eval(x));
+
+  // formulas using other formulas follow their redefinition
+  TFormula g1("gCachedBase", "x * x");
+  TFormula h1("hCached", "gCachedBase + 1");
+  TFormula g2("gCachedBase", "x * x * x");
+  TFormula h2("hCached", "gCachedBase + 1");
+  EXPECT_DOUBLE_EQ(5., h1.Eval(2.));
+  EXPECT_DOUBLE_EQ(9., h2.Eval(2.));
+}
@@ -0,0 +1,81 @@
+#include "gtest/gtest.h"
+
+#include "TGraph.h"
+
+#include <cmath>
+#include <vector>
+
+// Linear interpolation of the points (i, i*i)
+static double Interpolation(double x)
+{
+   int i = std::floor(x);
+   return i * i + (x - i) * (2 * i + 1);
+}
+
+TEST(TGraph, EvalSortedAndUnsorted)
+{
+   const int n = 1000;
+   TGraph sorted;
+   TGraph unsorted(n);
+   for (int i = 0; i < n; ++i) {
+      sorted.SetPoint(i, i, i * i);
+      // same points, in another order
+      int j = (i * 7) % n;
+      unsorted.SetPoint(i, j, j * j);
+   }
+   EXPECT_TRUE(sorted.IsSortedX());
+   EXPECT_FALSE(unsorted.IsSortedX());
+   for (double x = 0.25; x < n - 1; x += 10.5) {
+      EXPECT_DOUBLE_EQ(Interpolation(x), sorted.Eval(x));
+      EXPECT_DOUBLE_EQ(Interpolation(x), unsorted.Eval(x));
+   }
+
+   // breaking and restoring the order
+   sorted.SetPoint(10, 500.5, 0.);
+   EXPECT_FALSE(sorted.IsSortedX());
+   sorted.SetPoint(10, 10, 100);
+   EXPECT_TRUE(sorted.IsSortedX());
+   sorted.GetX()[10] = 2000.;
+   EXPECT_FALSE(sorted.IsSortedX());
+   sorted.GetX()[10] = 10.;
+   unsorted.Sort();
+   EXPECT_TRUE(unsorted.IsSortedX());
+   unsorted.Sort(&TGraph::CompareY, kFALSE);
+   EXPECT_FALSE(unsorted.IsSortedX());
+}
+
+TEST(TGraph, DecimateLine)
+{
+   // about 100 points per column of width 1 along [0, 10]
+   const int n = 1000;
+   std::vector<double> x(n), y(n), xout(n), yout(n);
+   for (int i = 0; i < n; ++i) {
+      x[i] = i * 0.01;
+      y[i] = std::sin(i);
+   }
+   int nout = TGraph::DecimateLine(n, x.data(), y.data(), 0., 10., 10, kFALSE, xout.data(), yout.data());
+   EXPECT_LE(nout, 40);
+   EXPECT_GE(nout, 20);
+   EXPECT_EQ(x[0], xout[0]);
+   EXPECT_EQ(x[n - 1], xout[nout - 1]);
+   for (int c = 0; c < 10; ++c) {
+      double ymin = 2, ymax = -2, yminout = 2, ymaxout = -2;
+      for (int i = 0; i < n; ++i) {
+         if (std::floor(x[i]) != c) continue;
+         ymin = std::min(ymin, y[i]);
+         ymax = std::max(ymax, y[i]);
+      }
+      for (int i = 0; i < nout; ++i) {
+         if (std::floor(xout[i]) != c) continue;
+         yminout = std::min(yminout, yout[i]);
+         ymaxout = std::max(ymaxout, yout[i]);
+      }
+      EXPECT_EQ(ymin, yminout);
+      EXPECT_EQ(ymax, ymaxout);
+   }
+   for (int i = 1; i < nout; ++i)
+      EXPECT_LT(xout[i - 1], xout[i]);
+
+   // no decimation with as many columns as points
+   EXPECT_EQ(n, TGraph::DecimateLine(n, x.data(), y.data(), 0., 10., 10 * n, kFALSE, xout.data(), yout.data()));
+}
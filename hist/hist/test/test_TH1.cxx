@@ -2,6 +2,15 @@
 
 #include "TH1.h"
 #include "TH1F.h"
+#include "TH1D.h"
+#include "TH2D.h"
+#include "TH3D.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
 
 // StatOverflows TH1
 TEST(TH1, StatOverflows)
@@ -30,3 +39,156 @@ TEST(TH1, StatOverflows)
    EXPECT_EQ(TH1::EStatOverflows::kConsider, h1.GetStatOverflows());
    EXPECT_EQ(TH1::EStatOverflows::kNeutral,  h2.GetStatOverflows());
 }
+
+// Values covering the bins, their edges, the under/overflows and NaN
+static std::vector<double> FillNValues(int n)
+{
+   std::vector<double> v;
+   for (int i = 0; i < n; ++i)
+      v.push_back(-1.5 + 0.0137 * i);
+   v.push_back(0.);
+   v.push_back(1.);
+   v.push_back(0.25);
+   v.push_back(0.5);
+   v.push_back(-1.);
+   v.push_back(2.);
+   v.push_back(std::numeric_limits<double>::quiet_NaN());
+   v.push_back(std::numeric_limits<double>::infinity());
+   v.push_back(-std::numeric_limits<double>::infinity());
+   return v;
+}
+
+static void ExpectSameHistograms(const TH1 &h1, const TH1 &h2)
+{
+   ASSERT_EQ(h1.GetNcells(), h2.GetNcells());
+   for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin)) << "bin " << bin;
+      EXPECT_EQ(h1.GetBinError(bin), h2.GetBinError(bin)) << "bin " << bin;
+   }
+   double s1[TH1::kNstat] = {}, s2[TH1::kNstat] = {};
+   h1.GetStats(s1);
+   h2.GetStats(s2);
+   for (int i = 0; i < TH1::kNstat; ++i)
+      EXPECT_EQ(s1[i], s2[i]) << "stat " << i;
+   EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+}
+
+// FillN gives the same result as Fill
+TEST(TH1, FillN)
+{
+   const double edges[] = {0., 0.1, 0.25, 0.3, 0.7, 1.};
+   auto x = FillNValues(1000);
+   std::vector<double> w(x.size());
+   for (size_t i = 0; i < w.size(); ++i)
+      w[i] = i < 600 ? 1. : 0.5 + 0.001 * i;
+
+   for (bool variable : {false, true}) {
+      TH1D h1("h1", "h1", 5, 0., 1.);
+      TH1D h2("h2", "h2", 5, 0., 1.);
+      if (variable) {
+         h1.SetBins(5, edges);
+         h2.SetBins(5, edges);
+      }
+      for (size_t i = 0; i < x.size(); ++i)
+         h1.Fill(x[i], w[i]);
+      h2.FillN(x.size(), x.data(), w.data());
+      ExpectSameHistograms(h1, h2);
+
+      // strided, without weights
+      TH1D h3("h3", "h3", 5, 0., 1.);
+      TH1D h4("h4", "h4", 5, 0., 1.);
+      if (variable) {
+         h3.SetBins(5, edges);
+         h4.SetBins(5, edges);
+      }
+      for (size_t i = 0; i < x.size(); i += 3)
+         h3.Fill(x[i]);
+      h4.FillN(x.size() / 3, x.data(), nullptr, 3);
+      ExpectSameHistograms(h3, h4);
+   }
+}
+
+TEST(TH1, FillNBins)
+{
+   const double edges[] = {-1., -0.5, 0., 0.5, 0.5, 2.};
+   auto x = FillNValues(300);
+   for (bool variable : {false, true}) {
+      TAxis axis(5, -1., 2.);
+      if (variable)
+         axis.Set(5, edges);
+      std::vector<int> bins(x.size());
+      axis.FindFixBins(x.size(), x.data(), bins.data());
+      for (size_t i = 0; i < x.size(); ++i)
+         EXPECT_EQ(axis.FindFixBin(x[i]), bins[i]) << "x = " << x[i];
+   }
+}
+
+TEST(TH2, FillN)
+{
+   auto x = FillNValues(700);
+   std::vector<double> y(x.rbegin(), x.rend());
+   std::vector<double> w(x.size(), 2.);
+   TH2D h1("h1", "h1", 7, 0., 1., 3, -1., 0.5);
+   TH2D h2("h2", "h2", 7, 0., 1., 3, -1., 0.5);
+   for (size_t i = 0; i < x.size(); ++i)
+      h1.Fill(x[i], y[i], w[i]);
+   h2.FillN(x.size(), x.data(), y.data(), w.data());
+   ExpectSameHistograms(h1, h2);
+}
+
+TEST(TH3, FillN)
+{
+   auto x = FillNValues(700);
+   std::vector<double> y(x.rbegin(), x.rend());
+   std::vector<double> z(x.size());
+   for (size_t i = 0; i < z.size(); ++i)
+      z[i] = std::sin(double(i));
+   TH3D h1("h1", "h1", 4, 0., 1., 3, -1., 0.5, 5, -1., 1.);
+   TH3D h2("h2", "h2", 4, 0., 1., 3, -1., 0.5, 5, -1., 1.);
+   for (size_t i = 0; i < x.size(); ++i)
+      h1.Fill(x[i], y[i], z[i]);
+   h2.FillN(x.size(), x.data(), y.data(), z.data(), nullptr);
+   ExpectSameHistograms(h1, h2);
+}
+
+TEST(TProfile, FillN)
+{
+   auto x = FillNValues(700);
+   std::vector<double> y(x.rbegin(), x.rend());
+   std::vector<double> w(x.size());
+   for (size_t i = 0; i < w.size(); ++i)
+      w[i] = i < 300 ? 1. : 0.5 + 0.001 * i;
+   // without and with a range of accepted y values
+   for (double ymax : {-1., 0.5}) {
+      TProfile p1("p1", "p1", 7, 0., 1., -1., ymax);
+      TProfile p2("p2", "p2", 7, 0., 1., -1., ymax);
+      for (size_t i = 0; i < x.size(); ++i)
+         p1.Fill(x[i], y[i], w[i]);
+      p2.FillN(x.size(), x.data(), y.data(), w.data());
+      ExpectSameHistograms(p1, p2);
+      for (int bin = 0; bin < p1.GetNcells(); ++bin)
+         EXPECT_EQ(p1.GetBinEntries(bin), p2.GetBinEntries(bin)) << "bin " << bin;
+   }
+}
+
+TEST(TProfile2D, FillN)
+{
+   auto x = FillNValues(700);
+   std::vector<double> y(x.rbegin(), x.rend());
+   std::vector<double> z(x.size());
+   for (size_t i = 0; i < z.size(); ++i)
+      z[i] = std::sin(double(i));
+   for (int stride : {1, 2}) {
+      TProfile2D p1("p1", "p1", 4, 0., 1., 3, -1., 0.5, -0.5, 0.8);
+      TProfile2D p2("p2", "p2", 4, 0., 1., 3, -1., 0.5, -0.5, 0.8);
+      for (size_t i = 0; i < x.size(); i += stride)
+         p1.Fill(x[i], y[i], z[i], 1. + i % 3);
+      std::vector<double> w(x.size());
+      for (size_t i = 0; i < w.size(); ++i)
+         w[i] = 1. + i % 3;
+      p2.FillN(x.size() / stride + x.size() % stride, x.data(), y.data(), z.data(), w.data(), stride);
+      ExpectSameHistograms(p1, p2);
+      for (int bin = 0; bin < p1.GetNcells(); ++bin)
+         EXPECT_EQ(p1.GetBinEntries(bin), p2.GetBinEntries(bin)) << "bin " << bin;
+   }
+}
@@ -0,0 +1,80 @@
+// test TH2Poly bin search and FillN against a brute-force search
+
+#include "gtest/gtest.h"
+
+#include "TH2Poly.h"
+#include "TRandom3.h"
+
+#include <vector>
+
+// first bin containing (x,y), as the search done on all the bins
+static Int_t BruteForceBin(TH2Poly &h2p, Double_t x, Double_t y)
+{
+   Int_t overflow = h2p.FindBin(x, y);
+   if (overflow < 0 && overflow != -5)
+      return overflow;
+   for (Int_t bin = 1; bin <= h2p.GetNumberOfBins(); ++bin)
+      if (h2p.IsInsideBin(bin - 1, x, y))
+         return bin;
+   return -5;
+}
+
+TEST(TH2Poly, FindBinHoneycomb)
+{
+   TH2Poly h2p("h2p", "honeycomb", -1, 11, -1, 11);
+   h2p.Honeycomb(0, 0, 0.1, 50, 50);
+   // an overlapping bin, added last, only gets the points outside the cells
+   h2p.AddBin(-0.5, -0.5, 3, 3);
+
+   TRandom3 r(1);
+   for (int i = 0; i < 20000; ++i) {
+      Double_t x = r.Uniform(-2, 12);
+      Double_t y = r.Uniform(-2, 12);
+      EXPECT_EQ(BruteForceBin(h2p, x, y), h2p.FindBin(x, y)) << "at " << x << " " << y;
+   }
+}
+
+TEST(TH2Poly, FindBinAfterAddBin)
+{
+   TH2Poly h2p("h2p", "h2p", 0, 10, 0, 10);
+   h2p.AddBin(1, 1, 2, 2);
+   EXPECT_EQ(1, h2p.FindBin(1.5, 1.5));
+   EXPECT_EQ(-5, h2p.FindBin(5.5, 5.5));
+   h2p.AddBin(5, 5, 6, 6);
+   EXPECT_EQ(2, h2p.FindBin(5.5, 5.5));
+   EXPECT_EQ(-3, h2p.FindBin(11, 11));
+}
+
+TEST(TH2Poly, FillNEqualsFill)
+{
+   TH2Poly h1("h1", "h1", -1, 11, -1, 11);
+   TH2Poly h2("h2", "h2", -1, 11, -1, 11);
+   h1.Honeycomb(0, 0, 0.2, 25, 25);
+   h2.Honeycomb(0, 0, 0.2, 25, 25);
+
+   const int n = 30000;
+   std::vector<Double_t> x(n), y(n), w(n);
+   TRandom3 r(2);
+   for (int i = 0; i < n; ++i) {
+      x[i] = r.Uniform(-2, 12);
+      y[i] = r.Uniform(-2, 12);
+      w[i] = r.Uniform(0.5, 1.5);
+   }
+
+   for (int i = 0; i < n; i += 3)
+      h1.Fill(x[i], y[i], w[i]);
+   h2.FillN(n, x.data(), y.data(), w.data(), 3);
+
+   EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+   for (int bin = -9; bin <= h1.GetNumberOfBins(); ++bin) {
+      if (bin == 0)
+         continue;
+      EXPECT_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin));
+      EXPECT_EQ(h1.GetBinError(bin), h2.GetBinError(bin));
+   }
+   Double_t s1[7], s2[7];
+   h1.GetStats(s1);
+   h2.GetStats(s2);
+   for (int i = 0; i < 7; ++i)
+      EXPECT_EQ(s1[i], s2[i]);
+}
@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+
+#include "THistConcurrentFill.h"
+#include "TH1D.h"
+#include "TH2D.h"
+#include "THn.h"
+#include "TProfile.h"
+#include "TROOT.h"
+
+#include <thread>
+#include <vector>
+
+// Values whose sums are exact whatever the order of the fills
+static double Value(int i, int k)
+{
+   return ((i * 7 + k * 13) % 80) / 64.;
+}
+
+static void ExpectSameHistograms(const TH1 &h1, const TH1 &h2)
+{
+   ASSERT_EQ(h1.GetNcells(), h2.GetNcells());
+   for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin)) << "bin " << bin;
+      EXPECT_EQ(h1.GetBinError(bin), h2.GetBinError(bin)) << "bin " << bin;
+   }
+   double s1[TH1::kNstat], s2[TH1::kNstat];
+   h1.GetStats(s1);
+   h2.GetStats(s2);
+   for (int i = 0; i < TH1::kNstat; ++i)
+      EXPECT_EQ(s1[i], s2[i]) << "stat " << i;
+   EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+}
+
+// Fill from nThreads threads, each calling fill(filler, i, thread) nEntries times
+template <class HIST, class FILL>
+static void FillConcurrently(HIST &hist, int nThreads, int nEntries, FILL fill)
+{
+   THistConcurrentFillManager manager(hist, 100);
+   std::vector<std::thread> threads;
+   for (int t = 0; t < nThreads; ++t)
+      threads.emplace_back([&manager, nEntries, t, fill]() {
+         auto filler = manager.MakeFiller();
+         for (int i = 0; i < nEntries; ++i)
+            fill(filler, i, t);
+      });
+   for (auto &thread : threads)
+      thread.join();
+}
+
+TEST(THistConcurrentFill, TH1)
+{
+   ROOT::EnableThreadSafety();
+   TH1D hs("hs", "hs", 10, 0., 1.);
+   TH1D hc("hc", "hc", 10, 0., 1.);
+   const int nThreads = 4, nEntries = 1234;
+   for (int t = 0; t < nThreads; ++t)
+      for (int i = 0; i < nEntries; ++i)
+         hs.Fill(Value(i, t), 1 + t % 2);
+   FillConcurrently(hc, nThreads, nEntries,
+                    [](THistConcurrentFiller &f, int i, int t) { f.Fill(Value(i, t), 1 + t % 2); });
+   ExpectSameHistograms(hs, hc);
+}
+
+TEST(THistConcurrentFill, TH2AndProfile)
+{
+   ROOT::EnableThreadSafety();
+   const int nThreads = 3, nEntries = 777;
+   auto fill = [](THistConcurrentFiller &f, int i, int t) { f.Fill(Value(i, t), Value(i, t + 1)); };
+
+   TH2D h2s("h2s", "h2s", 5, 0., 1., 4, 0., 1.);
+   TH2D h2c("h2c", "h2c", 5, 0., 1., 4, 0., 1.);
+   TProfile ps("ps", "ps", 5, 0., 1.);
+   TProfile pc("pc", "pc", 5, 0., 1.);
+   for (int t = 0; t < nThreads; ++t)
+      for (int i = 0; i < nEntries; ++i) {
+         h2s.Fill(Value(i, t), Value(i, t + 1));
+         ps.Fill(Value(i, t), Value(i, t + 1));
+      }
+   FillConcurrently(h2c, nThreads, nEntries, fill);
+   FillConcurrently(pc, nThreads, nEntries, fill);
+   ExpectSameHistograms(h2s, h2c);
+   ExpectSameHistograms(ps, pc);
+}
+
+TEST(THistConcurrentFill, THn)
+{
+   ROOT::EnableThreadSafety();
+   const int nbins[] = {4, 3, 5};
+   const double xmin[] = {0., 0., 0.};
+   const double xmax[] = {1., 1., 1.};
+   THnD hs("hs", "hs", 3, nbins, xmin, xmax);
+   THnD hc("hc", "hc", 3, nbins, xmin, xmax);
+   const int nThreads = 4, nEntries = 500;
+   for (int t = 0; t < nThreads; ++t)
+      for (int i = 0; i < nEntries; ++i) {
+         const double x[] = {Value(i, t), Value(i, t + 1), Value(i, t + 2)};
+         hs.Fill(x);
+      }
+   FillConcurrently(hc, nThreads, nEntries, [](THistConcurrentFiller &f, int i, int t) {
+      const double x[] = {Value(i, t), Value(i, t + 1), Value(i, t + 2)};
+      f.Fill(x);
+   });
+   EXPECT_EQ(hs.GetEntries(), hc.GetEntries());
+   for (Long64_t bin = 0; bin < hs.GetNbins(); ++bin)
+      EXPECT_EQ(hs.GetBinContent(bin), hc.GetBinContent(bin)) << "bin " << bin;
+}
@@ -209,3 +209,27 @@ TEST(TKDE, tkde_io_binned)
    }
 }
 
+
+/// Fast evaluation tests
+/// In this test we compare the fast evaluation with the exact one
+TEST(TKDE, tkde_fast_evaluation)
+{
+   std::vector<double> v;
+   for (int i = 0; i < 2000; ++i) v.push_back( (i < 400) ? gRandom->Gaus(10,1) : gRandom->Gaus(10,4) );
+
+   TKDE kde(v.size(), &v[0], 0., 20., "KernelType:Gaussian;Iteration:Fixed;Mirror:MirrorAsymBoth;Binning:Unbinned", 1);
+   std::vector<double> exact;
+   for (int i = 0; i <= 40; ++i) exact.push_back(kde(0.5 * i));
+   kde.SetFastEvaluation(4096);
+   for (int i = 0; i <= 40; ++i) EXPECT_NEAR(exact[i], kde(0.5 * i), 1.E-4 * exact[20]);
+
+   TKDE kdeAdaptive(v.size(), &v[0], 0., 20., "KernelType:Epanechnikov;Iteration:Adaptive;Mirror:NoMirror;Binning:Unbinned", 1);
+   const double *weights = kdeAdaptive.GetAdaptiveWeights();
+   std::vector<double> exactWeights(weights, weights + v.size());
+   exact.clear();
+   for (int i = 0; i <= 40; ++i) exact.push_back(kdeAdaptive(0.5 * i));
+   kdeAdaptive.SetFastEvaluation(1);
+   weights = kdeAdaptive.GetAdaptiveWeights();
+   for (size_t i = 0; i < v.size(); ++i) EXPECT_NEAR(exactWeights[i], weights[i], 1.E-10 * exactWeights[i]);
+   for (int i = 0; i <= 40; ++i) EXPECT_NEAR(exact[i], kdeAdaptive(0.5 * i), 1.E-10 * exact[20]);
+}
@@ -36,6 +36,8 @@
 #include "TVirtualX.h"
 #include "TRegexp.h"
 
+#include <vector>
+
 Double_t *gxwork, *gywork, *gxworkl, *gyworkl;
 Int_t TGraphPainter::fgMaxPointsPerLine = 50;
 
@@ -43,6 +45,36 @@ static Int_t    gHighlightPoint  = -1;   // highlight point of graph
 static TGraph  *gHighlightGraph  = 0;    // pointer to graph with highlight point
 static TMarker *gHighlightMarker = 0;    // highlight marker
 
+////////////////////////////////////////////////////////////////////////////////
+/// Store in (xout,yout) the first of the n points (x,y) falling in each pixel
+/// of the frame of gPad, made of ncolumns x nrows pixels: the markers of the
+/// other points would be painted at the same place. The points outside the
+/// frame, which are not painted, are dropped. Return the number of stored points.
+
+static Int_t DecimateMarkers(Int_t n, const Double_t *x, const Double_t *y, Int_t ncolumns, Int_t nrows,
+                             Double_t *xout, Double_t *yout)
+{
+   Double_t uxmin = gPad->GetUxmin(), uxmax = gPad->GetUxmax();
+   Double_t uymin = gPad->GetUymin(), uymax = gPad->GetUymax();
+   Double_t xscale = ncolumns / (uxmax - uxmin);
+   Double_t yscale = nrows / (uymax - uymin);
+   std::vector<bool> painted(ncolumns * nrows, false);
+   Int_t nout = 0;
+   for (Int_t i = 0; i < n; ++i) {
+      Double_t u = gPad->XtoPad(x[i]);
+      Double_t v = gPad->YtoPad(y[i]);
+      if (!(u >= uxmin && u <= uxmax && v >= uymin && v <= uymax)) continue;
+      Int_t column = TMath::Min(Int_t((u - uxmin) * xscale), ncolumns - 1);
+      Int_t row = TMath::Min(Int_t((v - uymin) * yscale), nrows - 1);
+      if (painted[row * ncolumns + column]) continue;
+      painted[row * ncolumns + column] = true;
+      xout[nout] = x[i];
+      yout[nout] = y[i];
+      ++nout;
+   }
+   return nout;
+}
+
 ClassImp(TGraphPainter);
 
 
@@ -65,6 +97,7 @@ ClassImp(TGraphPainter);
 - [Reverse graphs' axis](#GP06)
 - [Graphs in logarithmic scale](#GP07)
 - [Highlight mode for graph](#GP08)
+- [Graphs with many points](#GP09)
 
 
 ### <a name="GP00"></a> Introduction
@@ -629,6 +662,16 @@ NOTE all parameters of user function are taken from
 
 For more complex demo please see for example `$ROOTSYS/tutorials/math/hlquantiles.C` file.
 
+### <a name="GP09"></a> Graphs with many points
+
+Graphs with more points than `TGraph::GetDecimationThreshold()` (100000 by
+default) are painted at the resolution of the pad: with the options `L` and
+`P` (or `*`), a line is painted through the first, smallest, largest and last
+points of each pixel column only, and a marker only once per pixel. This keeps
+the same picture while painting waveforms or time series of millions of points
+interactively. The web canvas sends the decimated line of such graphs to the
+browser. `TGraph::SetDecimationThreshold(0)` disables the decimation.
+
 */
 
 
@@ -1425,6 +1468,32 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
    theGraph->TAttFill::Modify();
    theGraph->TAttMarker::Modify();
 
+   // Level of detail: above the decimation threshold, a line is painted through the
+   // first, smallest, largest and last points of each pixel column and a marker
+   // once per pixel, which paints the same picture
+   const Double_t *xline = x, *yline = y, *xmark = x, *ymark = y;
+   Int_t nline = npoints, nmark = npoints;
+   std::vector<Double_t> xlod, ylod, xlodmark, ylodmark;
+   Int_t threshold = TGraph::GetDecimationThreshold();
+   if (threshold > 0 && npoints > threshold && !optionR) {
+      Int_t ncolumns = TMath::Abs(gPad->XtoAbsPixel(rwxmax) - gPad->XtoAbsPixel(rwxmin));
+      Int_t nrows = TMath::Abs(gPad->YtoAbsPixel(rwymax) - gPad->YtoAbsPixel(rwymin));
+      if (optionLine && !optionFill && TMath::Abs(theGraph->GetLineWidth()) <= 99 && ncolumns > 0) {
+         xlod.resize(npoints);
+         ylod.resize(npoints);
+         nline = TGraph::DecimateLine(npoints, x, y, rwxmin, rwxmax, ncolumns, gPad->GetLogx(), xlod.data(), ylod.data());
+         xline = xlod.data();
+         yline = ylod.data();
+      }
+      if ((optionMark || optionStar) && ncolumns > 0 && nrows > 0) {
+         xlodmark.resize(npoints);
+         ylodmark.resize(npoints);
+         nmark = DecimateMarkers(npoints, x, y, ncolumns, nrows, xlodmark.data(), ylodmark.data());
+         xmark = xlodmark.data();
+         ymark = ylodmark.data();
+      }
+   }
+
    // Draw the graph with a polyline or a fill area
    gxwork  = new Double_t[2*npoints+10];
    gywork  = new Double_t[2*npoints+10];
@@ -1432,18 +1501,18 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
    gyworkl = new Double_t[2*npoints+10];
 
    if (optionLine || optionFill) {
-      x1    = x[0];
-      xn    = x[npoints-1];
-      y1    = y[0];
-      yn    = y[npoints-1];
-      nloop = npoints;
+      x1    = xline[0];
+      xn    = xline[nline-1];
+      y1    = yline[0];
+      yn    = yline[nline-1];
+      nloop = nline;
       if (optionFill && (xn != x1 || yn != y1)) nloop++;
       npt = 0;
       for (i=1;i<=nloop;i++) {
-         if (i > npoints) {
+         if (i > nline) {
             gxwork[npt] = gxwork[0];  gywork[npt] = gywork[0];
          } else {
-            gxwork[npt] = x[i-1];      gywork[npt] = y[i-1];
+            gxwork[npt] = xline[i-1];      gywork[npt] = yline[i-1];
             npt++;
          }
          if (i == nloop) {
@@ -1541,13 +1610,13 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
    }
 
    // Draw the graph with a '*' on every points
-   if (optionStar) {
+   if (optionStar && nmark > 0) {
       theGraph->SetMarkerStyle(3);
       npt = 0;
-      for (i=1;i<=npoints;i++) {
-         gxwork[npt] = x[i-1];      gywork[npt] = y[i-1];
+      for (i=1;i<=nmark;i++) {
+         gxwork[npt] = xmark[i-1];      gywork[npt] = ymark[i-1];
          npt++;
-         if (i == npoints) {
+         if (i == nmark) {
             ComputeLogs(npt, optionZ);
             if (optionR)  gPad->PaintPolyMarker(npt,gyworkl,gxworkl);
             else          gPad->PaintPolyMarker(npt,gxworkl,gyworkl);
@@ -1557,12 +1626,12 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
    }
 
    // Draw the graph with the current polymarker on every points
-   if (optionMark) {
+   if (optionMark && nmark > 0) {
       npt = 0;
-      for (i=1;i<=npoints;i++) {
-         gxwork[npt] = x[i-1];      gywork[npt] = y[i-1];
+      for (i=1;i<=nmark;i++) {
+         gxwork[npt] = xmark[i-1];      gywork[npt] = ymark[i-1];
          npt++;
-         if (i == npoints) {
+         if (i == nmark) {
             ComputeLogs(npt, optionZ);
             if (optionR) gPad->PaintPolyMarker(npt,gyworkl,gxworkl);
             else         gPad->PaintPolyMarker(npt,gxworkl,gyworkl);
@@ -1021,6 +1021,10 @@ histograms, it is possible to know if an empty bin has been filled or not. So ev
 if all the bins' contents are positive some empty bins might be painted. And vice versa,
 if some bins have a negative content some empty bins might be not painted.
 
+In cartesian coordinates, adjacent cells of a row having the same color are
+painted as one box. The picture is the same, but large histograms are painted
+faster and produce much smaller PostScript, PDF and SVG files.
+
 Combined with the option `COL`, the option `Z` allows to
 display the color palette defined by `gStyle->SetPalette()`.
 
@@ -5733,7 +5737,22 @@ void THistPainter::PaintColorLevels(Option_t*)
 
    Int_t color;
    TProfile2D* prof2d = dynamic_cast<TProfile2D*>(fH);
+
+   // In cartesian coordinates, consecutive bins of a row with the same color
+   // are painted as a single box, which keeps the number of primitives (and
+   // the size of the PDF, PostScript or SVG files) small for large histograms.
+   Int_t runColor = -1, runLastBin = -1;
+   Double_t runXlow = 0, runXup = 0, runYlow = 0, runYup = 0;
+   auto paintRun = [&]() {
+      if (runColor < 0) return;
+      fH->SetFillColor(gStyle->GetColorPalette(runColor));
+      fH->TAttFill::Modify();
+      gPad->PaintBox(runXlow, runYlow, runXup, runYup);
+      runColor = -1;
+   };
+
    for (Int_t j=Hparam.yfirst; j<=Hparam.ylast;j++) {
+      paintRun();
       yk    = fYaxis->GetBinLowEdge(j);
       ystep = fYaxis->GetBinWidth(j);
       for (Int_t i=Hparam.xfirst; i<=Hparam.xlast;i++) {
@@ -5807,17 +5826,28 @@ void THistPainter::PaintColorLevels(Option_t*)
 
          Int_t theColor = Int_t((color+0.99)*Float_t(ncolors)/Float_t(ndivz));
          if (theColor > ncolors-1) theColor = ncolors-1;
-         fH->SetFillColor(gStyle->GetColorPalette(theColor));
-         fH->TAttFill::Modify();
          if (Hoption.System != kPOLAR) {
-            gPad->PaintBox(xlow, ylow, xup, yup);
+            if (theColor == runColor && i == runLastBin+1) {
+               runXup = xup;
+            } else {
+               paintRun();
+               runColor = theColor;
+               runXlow  = xlow;
+               runXup   = xup;
+               runYlow  = ylow;
+               runYup   = yup;
+            }
+            runLastBin = i;
          } else  {
+            fH->SetFillColor(gStyle->GetColorPalette(theColor));
+            fH->TAttFill::Modify();
             TCrown crown(0,0,ylow,yup,xlow*TMath::RadToDeg(),xup*TMath::RadToDeg());
             crown.SetFillColor(gStyle->GetColorPalette(theColor));
             crown.Paint();
          }
       }
    }
+   paintRun();
 
    if (Hoption.Zscale) PaintPalette();
 
@@ -58,6 +58,8 @@ public:
    using CoordArray_t = typename ImplBase_t::CoordArray_t;
    /// The type of weights
    using Weight_t = PRECISION;
+   /// The coordinates type given axis by axis: a `DIMENSIONS`-dimensional `std::array` of spans of `double`.
+   using CoordSpans_t = typename ImplBase_t::CoordSpans_t;
    /// Pointer type to `HistImpl_t::Fill`, for faster access.
    using FillFunc_t = typename ImplBase_t::FillFunc_t;
    /// Range.
@@ -149,6 +151,14 @@ public:
    /// Convenience overload: `FillN()` with weight 1.
    void FillN(const std::span<const CoordArray_t> xN) noexcept { fImpl->FillN(xN); }
 
+   /// For each `i`, add `weightN[i]` to the bin at the coordinates `xN[0][i]`,
+   /// `xN[1][i]` etc., i.e. with one span of coordinates per axis, as e.g. the
+   /// columns of a dataset. All spans must have the same size.
+   void FillN(const CoordSpans_t &xN, const std::span<const Weight_t> weightN) noexcept { fImpl->FillN(xN, weightN); }
+
+   /// Convenience overload: `FillN()` of coordinates given axis by axis, with weight 1.
+   void FillN(const CoordSpans_t &xN) noexcept { fImpl->FillN(xN); }
+
    /// Get the number of entries this histogram was filled with.
    int64_t GetEntries() const noexcept { return fImpl->GetStat().GetEntries(); }
 
@@ -40,6 +40,7 @@ class RHistConcurrentFiller: public Internal::RHistBufferedFillBase<RHistConcurr
 public:
    using CoordArray_t = typename HIST::CoordArray_t;
    using Weight_t = typename HIST::Weight_t;
+   using CoordSpans_t = typename HIST::CoordSpans_t;
 
    RHistConcurrentFiller(RHistConcurrentFillManager<HIST, SIZE> &manager): fManager(manager) {}
 
@@ -55,6 +56,12 @@ public:
    /// Thread-specific HIST::FillN().
    void FillN(const std::span<const CoordArray_t> xN) { fManager.FillN(xN); }
 
+   /// Thread-specific HIST::FillN(), for coordinates given axis by axis.
+   void FillN(const CoordSpans_t &xN, const std::span<const Weight_t> weightN) { fManager.FillN(xN, weightN); }
+
+   /// Thread-specific HIST::FillN(), for coordinates given axis by axis.
+   void FillN(const CoordSpans_t &xN) { fManager.FillN(xN); }
+
    static constexpr int GetNDim() { return HIST::GetNDim(); }
 
 private:
@@ -81,6 +88,7 @@ public:
    using Hist_t = HIST;
    using CoordArray_t = typename HIST::CoordArray_t;
    using Weight_t = typename HIST::Weight_t;
+   using CoordSpans_t = typename HIST::CoordSpans_t;
 
 private:
    HIST &fHist;
@@ -104,6 +112,20 @@ public:
       std::lock_guard<std::mutex> lockGuard(fFillMutex);
       fHist.FillN(xN);
    }
+
+   /// Thread-specific HIST::FillN(), for coordinates given axis by axis.
+   void FillN(const CoordSpans_t &xN, const std::span<const Weight_t> weightN)
+   {
+      std::lock_guard<std::mutex> lockGuard(fFillMutex);
+      fHist.FillN(xN, weightN);
+   }
+
+   /// Thread-specific HIST::FillN(), for coordinates given axis by axis.
+   void FillN(const CoordSpans_t &xN)
+   {
+      std::lock_guard<std::mutex> lockGuard(fFillMutex);
+      fHist.FillN(xN);
+   }
 };
 
 } // namespace Experimental
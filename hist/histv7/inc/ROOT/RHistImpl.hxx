@@ -16,6 +16,7 @@
 #ifndef ROOT7_RHistImpl
 #define ROOT7_RHistImpl
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <functional>
@@ -158,6 +159,8 @@ public:
    using BinArray_t = std::array<int, DATA::GetNDim()>;
    /// Type of the bin content (and thus weights).
    using Weight_t = typename DATA::Weight_t;
+   /// Type of the coordinates given axis by axis: one span of coordinates per axis.
+   using CoordSpans_t = std::array<std::span<const double>, DATA::GetNDim()>;
 
    /// Type of the `Fill(x, w)` function
    using FillFunc_t = void (RHistImplBase::*)(const CoordArray_t &x, Weight_t w);
@@ -185,6 +188,14 @@ public:
    /// Interface function to fill a vector or array of coordinates.
    virtual void FillN(const std::span<const CoordArray_t> xN) = 0;
 
+   /// Interface function to fill the coordinates given as one span per axis,
+   /// with corresponding weights.
+   /// \note the size of all spans of `xN` and of `weightN` must be the same!
+   virtual void FillN(const CoordSpans_t &xN, const std::span<const Weight_t> weightN) = 0;
+
+   /// Interface function to fill the coordinates given as one span per axis.
+   virtual void FillN(const CoordSpans_t &xN) = 0;
+
    /// Retrieve the pointer to the overridden `Fill(x, w)` function.
    virtual FillFunc_t GetFillFunc() const = 0;
 
@@ -679,6 +690,86 @@ struct RFindLocalBins {
    }
 };
 
+/// Find the local bin indices `bins[i]` on an axis of type `AXIS` of the `n` coordinates
+/// `coords[i]`, as `AXIS::FindBin()` would. The generic version calls
+/// `FindBin()`; the specializations for the fixed axes are written as branch-free
+/// loops over all coordinates, so that the compiler can vectorize them.
+template <class AXIS>
+struct RFindLocalBinsN {
+   void operator()(int *bins, const AXIS &axis, const double *coords, size_t n) const
+   {
+      for (size_t i = 0; i < n; ++i)
+         bins[i] = axis.FindBin(coords[i]);
+   }
+};
+
+template <>
+struct RFindLocalBinsN<RAxisEquidistant> {
+   void operator()(int *bins, const RAxisEquidistant &axis, const double *coords, size_t n) const
+   {
+      const double low = axis.GetMinimum();
+      const double invBinWidth = axis.GetInverseBinWidth();
+      const double endBin = axis.GetLastBin() + 1;
+      for (size_t i = 0; i < n; ++i) {
+         // Same as AdjustOverflowBinNumber(FindBinRaw(x)) for an axis that cannot grow.
+         double rawbin = (coords[i] - low) * invBinWidth + 1.;
+         const bool underflow = rawbin < 1.;
+         const bool overflow = rawbin >= endBin;
+         rawbin = (underflow || overflow) ? 1. : rawbin;
+         const int bin = (int)rawbin;
+         bins[i] = underflow ? RAxisBase::kUnderflowBin : (overflow ? RAxisBase::kOverflowBin : bin);
+      }
+   }
+};
+
+template <>
+struct RFindLocalBinsN<RAxisIrregular> {
+   void operator()(int *bins, const RAxisIrregular &axis, const double *coords, size_t n) const
+   {
+      const double *borders = axis.GetBinBorders().data();
+      const int nBorders = axis.GetBinBorders().size();
+      // std::lower_bound() with the same number of steps for all coordinates:
+      // bins[i] becomes the number of borders smaller than coords[i].
+      for (size_t i = 0; i < n; ++i)
+         bins[i] = 0;
+      for (int len = nBorders; len > 1;) {
+         const int half = len / 2;
+         for (size_t i = 0; i < n; ++i)
+            bins[i] += borders[bins[i] + half] < coords[i] ? half : 0;
+         len -= half;
+      }
+      for (size_t i = 0; i < n; ++i) {
+         const int rawbin = bins[i] + (borders[bins[i]] < coords[i]);
+         const int bin = rawbin < 1 ? RAxisBase::kUnderflowBin : rawbin;
+         bins[i] = rawbin >= nBorders ? RAxisBase::kOverflowBin : bin;
+      }
+   }
+};
+
+/// Find the per-axis local bin indices `localBins[axis][i]` of `n` coordinates
+/// `coords[axis][i]`, one axis after the other.
+template <int I, int NDIMS, int CHUNKSIZE, class AXES>
+struct RFindLocalBinsChunk;
+
+template <int NDIMS, int CHUNKSIZE, class AXES>
+struct RFindLocalBinsChunk<-1, NDIMS, CHUNKSIZE, AXES> {
+   void operator()(std::array<std::array<int, CHUNKSIZE>, NDIMS> & /*localBins*/, const AXES & /*axes*/,
+                   const std::array<std::array<double, CHUNKSIZE>, NDIMS> & /*coords*/, size_t /*n*/) const
+   {}
+};
+
+template <int I, int NDIMS, int CHUNKSIZE, class AXES>
+struct RFindLocalBinsChunk {
+   void operator()(std::array<std::array<int, CHUNKSIZE>, NDIMS> &localBins, const AXES &axes,
+                   const std::array<std::array<double, CHUNKSIZE>, NDIMS> &coords, size_t n) const
+   {
+      constexpr const int thisAxis = NDIMS - I - 1;
+      using Axis_t = typename std::tuple_element<thisAxis, AXES>::type;
+      RFindLocalBinsN<Axis_t>()(localBins[thisAxis].data(), std::get<thisAxis>(axes), coords[thisAxis].data(), n);
+      RFindLocalBinsChunk<I - 1, NDIMS, CHUNKSIZE, AXES>()(localBins, axes, coords, n);
+   }
+};
+
 /// Recursively converts local axis bins from the standard `kUnderflowBin`/`kOverflowBin` for
 /// under/overflow bin indexing convention, to the corresponding bin coordinates.
 template <int I, int NDIMS, typename BINS, typename COORD, class AXES>
@@ -728,6 +819,7 @@ public:
    using CoordArray_t = typename ImplBase_t::CoordArray_t;
    using BinArray_t = typename ImplBase_t::BinArray_t;
    using Weight_t = typename ImplBase_t::Weight_t;
+   using CoordSpans_t = typename ImplBase_t::CoordSpans_t;
    using typename ImplBase_t::FillFunc_t;
    template <int NDIMS = DATA::GetNDim()>
    using AxisIterRange_t = typename Hist::AxisIterRange_t<NDIMS>;
@@ -735,6 +827,64 @@ public:
 private:
    std::tuple<AXISCONFIG...> fAxes; ///< The histogram's axes
 
+   /// Number of points whose bins are found together by `FillNImpl()`.
+   static constexpr int kFillNChunkSize = 256;
+
+   /// Add `weightN[i]`, or 1 if `weightN` is null, to the bin at the coordinates
+   /// `getCoord(i, iAxis)` of the `n` points `i`. The points are processed by
+   /// chunks: their local bins are found axis by axis with the kernels of
+   /// `Internal::RFindLocalBinsN`, specialized for each axis type, then the
+   /// global bins of the regular bins are computed with precomputed strides.
+   template <class GETCOORD>
+   void FillNImpl(size_t n, GETCOORD getCoord, const Weight_t *weightN)
+   {
+      constexpr int NDIMS = DATA::GetNDim();
+      std::array<int, NDIMS> regularBinSizes;
+      int binSize = 1;
+      for (int d = 0; d < NDIMS; ++d) {
+         regularBinSizes[d] = binSize;
+         binSize *= GetAxis(d).GetNBinsNoOver();
+      }
+
+      std::array<std::array<double, kFillNChunkSize>, NDIMS> coords;
+      std::array<std::array<int, kFillNChunkSize>, NDIMS> localBins;
+      for (size_t begin = 0; begin < n; begin += kFillNChunkSize) {
+         const size_t chunkSize = std::min<size_t>(kFillNChunkSize, n - begin);
+         for (int d = 0; d < NDIMS; ++d) {
+            for (size_t i = 0; i < chunkSize; ++i)
+               coords[d][i] = getCoord(begin + i, d);
+         }
+         Internal::RFindLocalBinsChunk<NDIMS - 1, NDIMS, kFillNChunkSize, decltype(fAxes)>()(localBins, fAxes, coords,
+                                                                                            chunkSize);
+         for (size_t i = 0; i < chunkSize; ++i) {
+            CoordArray_t x;
+            BinArray_t bins;
+            bool regular = true;
+            int bin = 1;
+            for (int d = 0; d < NDIMS; ++d) {
+               x[d] = coords[d][i];
+               bins[d] = localBins[d][i];
+               regular &= bins[d] >= 1;
+               bin += (bins[d] - 1) * regularBinSizes[d];
+            }
+            if (!regular)
+               bin = ComputeGlobalBin<NDIMS>(bins);
+            this->GetStat().Fill(x, bin, weightN ? weightN[begin + i] : (Weight_t)1);
+         }
+      }
+   }
+
+   /// Check that all spans of `xN` have the same size, and return it.
+   static bool GetCommonSize(const CoordSpans_t &xN, size_t &size)
+   {
+      size = xN[0].size();
+      for (auto &&x: xN) {
+         if (x.size() != size)
+            return false;
+      }
+      return true;
+   }
+
 public:
    RHistImpl(TRootIOCtor *);
    RHistImpl(AXISCONFIG... axisArgs);
@@ -1057,9 +1207,7 @@ public:
       }
 #endif
 
-      for (size_t i = 0; i < xN.size(); ++i) {
-         Fill(xN[i], weightN[i]);
-      }
+      FillNImpl(xN.size(), [&xN](size_t i, int d) { return xN[i][d]; }, weightN.data());
    }
 
    /// Fill an array of `weightN` to the bins specified by coordinates `xN`.
@@ -1067,9 +1215,37 @@ public:
    /// at the coordinate `xN[i]`
    void FillN(const std::span<const CoordArray_t> xN) final
    {
-      for (auto &&x: xN) {
-         Fill(x);
+      FillNImpl(xN.size(), [&xN](size_t i, int d) { return xN[i][d]; }, nullptr);
+   }
+
+   /// Fill an array of `weightN` to the bins specified by the coordinates `xN`,
+   /// given axis by axis. For each element `i`, the weight `weightN[i]` will be
+   /// added to the bin at the coordinates `xN[0][i]`, `xN[1][i]` etc.
+   /// \note all spans of `xN` and `weightN` must have the same size!
+   void FillN(const CoordSpans_t &xN, const std::span<const Weight_t> weightN) final
+   {
+      size_t size = 0;
+      if (!GetCommonSize(xN, size) || size != weightN.size()) {
+         R__ERROR_HERE("HIST") << "Not the same number of coordinates on all axes and weights!";
+         return;
       }
+
+      FillNImpl(size, [&xN](size_t i, int d) { return xN[d][i]; }, weightN.data());
+   }
+
+   /// Fill the bins specified by the coordinates `xN`, given axis by axis. For
+   /// each element `i`, the bin at the coordinates `xN[0][i]`, `xN[1][i]` etc.
+   /// will be filled with weight 1.
+   /// \note all spans of `xN` must have the same size!
+   void FillN(const CoordSpans_t &xN) final
+   {
+      size_t size = 0;
+      if (!GetCommonSize(xN, size)) {
+         R__ERROR_HERE("HIST") << "Not the same number of coordinates on all axes!";
+         return;
+      }
+
+      FillNImpl(size, [&xN](size_t i, int d) { return xN[d][i]; }, nullptr);
    }
 
    /// Add a single weight `w` to the bin at coordinate `x`.
@@ -629,3 +629,51 @@ TEST(HistFillTest, FillN3DCoordsWeightsUncertainty)
    EXPECT_FLOAT_EQ(std::sqrt(weight2 * weight2), hist.GetBinUncertainty({0.2222, 4.33, 7.11}));
    EXPECT_FLOAT_EQ(std::sqrt((weight3 * weight3) + (weight2 * weight2)), hist.GetBinUncertainty({0.3333, 4.11, 7.22}));
 }
+
+// Test that FillN() of many points, with coordinates given point by point or
+// axis by axis, fills the same bins as Fill(), including under- and overflow
+TEST(HistFillTest, FillNManyCoordsMatchesFill)
+{
+   using namespace ROOT::Experimental;
+   const RAxisConfig xAxis(20, 0., 1.);
+   const RAxisConfig yAxis(std::vector<double>{0., 0.1, 0.5, 1.});
+   RH2D histFill(xAxis, yAxis);
+   RH2D histFillN(xAxis, yAxis);
+   RH2D histFillNAxes(xAxis, yAxis);
+
+   std::vector<RH2D::CoordArray_t> coords;
+   std::vector<double> xs, ys, weights;
+   for (int i = 0; i < 1000; ++i) {
+      // Covers the underflow, the overflow and the bin borders of both axes.
+      const double x = -0.5 + (i % 40) * 0.05;
+      const double y = -0.2 + (i % 27) * 0.05;
+      coords.push_back({x, y});
+      xs.push_back(x);
+      ys.push_back(y);
+      weights.push_back(0.5 + i % 3);
+      histFill.Fill({x, y}, weights.back());
+   }
+   histFillN.FillN(coords, weights);
+   histFillNAxes.FillN(RH2D::CoordSpans_t{{xs, ys}}, weights);
+
+   EXPECT_EQ(histFill.GetEntries(), histFillN.GetEntries());
+   EXPECT_EQ(histFill.GetEntries(), histFillNAxes.GetEntries());
+   for (auto &&x: coords) {
+      EXPECT_DOUBLE_EQ(histFill.GetBinContent(x), histFillN.GetBinContent(x));
+      EXPECT_DOUBLE_EQ(histFill.GetBinContent(x), histFillNAxes.GetBinContent(x));
+      EXPECT_DOUBLE_EQ(histFill.GetBinUncertainty(x), histFillN.GetBinUncertainty(x));
+   }
+}
+
+// Test FillN() with coordinates given axis by axis, without weights
+TEST(HistFillTest, FillNAxisCoordsContent)
+{
+   ROOT::Experimental::RH3F hist({100, 0., 1}, {10, 3., 5.}, {5, 7., 9.});
+   const std::vector<double> xs{0.1111, 0.2222, 0.1111};
+   const std::vector<double> ys{4.22, 4.33, 4.22};
+   const std::vector<double> zs{7.33, 7.11, 7.33};
+   hist.FillN(ROOT::Experimental::RH3F::CoordSpans_t{{xs, ys, zs}});
+   EXPECT_EQ(3, hist.GetEntries());
+   EXPECT_FLOAT_EQ(2.f, hist.GetBinContent({0.1111, 4.22, 7.33}));
+   EXPECT_FLOAT_EQ(1.f, hist.GetBinContent({0.2222, 4.33, 7.11}));
+}
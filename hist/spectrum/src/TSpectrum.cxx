@@ -7,6 +7,9 @@
 #include "TList.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TSpectrumParallel.h"
+
+#include <vector>
 
 /** \class TSpectrum
     \ingroup Spectrum
@@ -1469,8 +1472,8 @@ const char *TSpectrum::Deconvolution(Double_t *source, const Double_t *response,
        //   working_space-pointer to the working vector
        //   (its size must be 4*ssize of source spectrum)
    Double_t *working_space = new Double_t[4 * ssize];
-   int i, j, k, lindex, posit, lh_gold, l, repet;
-   Double_t lda, ldb, ldc, area, maximum;
+   int i, j, lindex, posit, lh_gold, repet;
+   Double_t lda, area, maximum;
    area = 0;
    lh_gold = -1;
    posit = 0;
@@ -1498,28 +1501,18 @@ const char *TSpectrum::Deconvolution(Double_t *source, const Double_t *response,
       working_space[2 * ssize + i] = source[i];
 
 // create matrix at*a and vector at*y
-   for (i = 0; i < ssize; i++){
-      lda = 0;
-      for (j = 0; j < ssize; j++){
-         ldb = working_space[j];
-         k = i + j;
-         if (k < ssize){
-            ldc = working_space[k];
-            lda = lda + ldb * ldc;
-         }
-      }
-      working_space[ssize + i] = lda;
-      lda = 0;
-      for (k = 0; k < ssize; k++){
-         l = k - i;
-         if (l >= 0){
-            ldb = working_space[l];
-            ldc = working_space[2 * ssize + k];
-            lda = lda + ldb * ldc;
-         }
+   ROOT::Internal::ForEachSpectrumRange(ssize, Double_t(ssize) * ssize, [&](Int_t first, Int_t last) {
+      for (Int_t ii = first; ii < last; ii++) {
+         Double_t sum = 0;
+         for (Int_t jj = 0; jj < ssize - ii; jj++)
+            sum = sum + working_space[jj] * working_space[ii + jj];
+         working_space[ssize + ii] = sum;
+         sum = 0;
+         for (Int_t kk = ii; kk < ssize; kk++)
+            sum = sum + working_space[kk - ii] * working_space[2 * ssize + kk];
+         working_space[3 * ssize + ii] = sum;
       }
-      working_space[3 * ssize + i]=lda;
-   }
+   });
 
 // move vector at*y
    for (i = 0; i < ssize; i++){
@@ -1537,37 +1530,33 @@ const char *TSpectrum::Deconvolution(Double_t *source, const Double_t *response,
             working_space[i] = TMath::Power(working_space[i], boost);
       }
       for (lindex = 0; lindex < numberIterations; lindex++) {
-         for (i = 0; i < ssize; i++) {
-            if (working_space[2 * ssize + i] > 0.000001
-                 && working_space[i] > 0.000001) {
-               lda = 0;
-               for (j = 0; j < lh_gold; j++) {
-                  ldb = working_space[j + ssize];
-                  if (j != 0){
-                     k = i + j;
-                     ldc = 0;
-                     if (k < ssize)
-                        ldc = working_space[k];
-                     k = i - j;
-                     if (k >= 0)
-                        ldc += working_space[k];
+         // The channels only read the current solution: they are computed in parallel.
+         ROOT::Internal::ForEachSpectrumRange(ssize, Double_t(ssize) * lh_gold, [&](Int_t first, Int_t last) {
+            const Double_t *x = working_space;
+            const Double_t *ata = working_space + ssize;
+            for (Int_t ii = first; ii < last; ii++) {
+               if (working_space[2 * ssize + ii] > 0.000001 && x[ii] > 0.000001) {
+                  Double_t sum = ata[0] * x[ii];
+                  // the terms with both neighbours in the spectrum, without branches
+                  const Int_t jboth = TMath::Min(lh_gold, TMath::Min(ssize - ii, ii + 1));
+                  Int_t jj = 1;
+                  for (; jj < jboth; jj++)
+                     sum = sum + ata[jj] * (x[ii + jj] + x[ii - jj]);
+                  for (; jj < lh_gold; jj++) {
+                     Double_t neighbours = 0;
+                     if (ii + jj < ssize)
+                        neighbours = x[ii + jj];
+                     if (ii - jj >= 0)
+                        neighbours += x[ii - jj];
+                     sum = sum + ata[jj] * neighbours;
                   }
-
-                  else
-                     ldc = working_space[i];
-                  lda = lda + ldb * ldc;
+                  Double_t ratio = 0;
+                  if (sum != 0)
+                     ratio = working_space[2 * ssize + ii] / sum;
+                  working_space[3 * ssize + ii] = ratio * x[ii];
                }
-               ldb = working_space[2 * ssize + i];
-               if (lda != 0)
-                  lda = ldb / lda;
-
-               else
-                  lda = 0;
-               ldb = working_space[i];
-               lda = lda * ldb;
-               working_space[3 * ssize + i] = lda;
             }
-         }
+         });
          for (i = 0; i < ssize; i++)
             working_space[i] = working_space[3 * ssize + i];
       }
@@ -1675,8 +1664,8 @@ const char *TSpectrum::DeconvolutionRL(Double_t *source, const Double_t *respons
        //   working_space-pointer to the working vector
        //   (its size must be 4*ssize of source spectrum)
    Double_t *working_space = new Double_t[4 * ssize];
-   int i, j, k, lindex, posit, lh_gold, repet, kmin, kmax;
-   Double_t lda, ldb, ldc, maximum;
+   int i, j, lindex, posit, lh_gold, repet;
+   Double_t lda, maximum;
    lh_gold = -1;
    posit = 0;
    maximum = 0;
@@ -1710,6 +1699,7 @@ const char *TSpectrum::DeconvolutionRL(Double_t *source, const Double_t *respons
          working_space[i] = 0;
 
    }
+   std::vector<Double_t> ratio(ssize);
        //**START OF ITERATIONS**
    for (repet = 0; repet < numberRepetitions; repet++) {
       if (repet != 0) {
@@ -1717,37 +1707,36 @@ const char *TSpectrum::DeconvolutionRL(Double_t *source, const Double_t *respons
             working_space[i] = TMath::Power(working_space[i], boost);
       }
       for (lindex = 0; lindex < numberIterations; lindex++) {
-         for (i = 0; i <= ssize - lh_gold; i++){
-            lda = 0;
-            if (working_space[i] > 0){//x[i]
-               for (j = i; j < i + lh_gold; j++){
-                  ldb = working_space[2 * ssize + j];//y[j]
-                  if (j < ssize){
-                     if (ldb > 0){//y[j]
-                        kmax = j;
-                        if (kmax > lh_gold - 1)
-                           kmax = lh_gold - 1;
-                        kmin = j + lh_gold - ssize;
-                        if (kmin < 0)
-                           kmin = 0;
-                        ldc = 0;
-                        for (k = kmax; k >= kmin; k--){
-                           ldc += working_space[ssize + k] * working_space[j - k];//h[k]*x[j-k]
-                        }
-                        if (ldc > 0)
-                           ldb = ldb / ldc;
-
-                        else
-                           ldb = 0;
-                     }
-                     ldb = ldb * working_space[ssize + j - i];//y[j]*h[j-i]/suma(h[j][k]x[k])
-                  }
-                  lda += ldb;
+         // y[j]/suma(h[k]x[j-k]) does not depend on i: it is computed once per
+         // iteration instead of once per channel using it
+         ROOT::Internal::ForEachSpectrumRange(ssize, Double_t(ssize) * lh_gold, [&](Int_t first, Int_t last) {
+            for (Int_t jj = first; jj < last; jj++) {
+               Double_t y = working_space[2 * ssize + jj];//y[j]
+               if (y > 0) {
+                  const Int_t kmx = TMath::Min(jj, lh_gold - 1);
+                  const Int_t kmn = TMath::Max(jj + lh_gold - ssize, 0);
+                  Double_t conv = 0;
+                  for (Int_t kk = kmx; kk >= kmn; kk--)
+                     conv += working_space[ssize + kk] * working_space[jj - kk];//h[k]*x[j-k]
+                  if (conv > 0)
+                     y = y / conv;
+                  else
+                     y = 0;
                }
-               lda = lda * working_space[i];
+               ratio[jj] = y;
             }
-            working_space[3 * ssize + i] = lda;
-         }
+         });
+         ROOT::Internal::ForEachSpectrumRange(ssize - lh_gold + 1, Double_t(ssize) * lh_gold, [&](Int_t first, Int_t last) {
+            for (Int_t ii = first; ii < last; ii++) {
+               Double_t sum = 0;
+               if (working_space[ii] > 0) {//x[i]
+                  for (Int_t jj = ii; jj < ii + lh_gold; jj++)
+                     sum += ratio[jj] * working_space[ssize + jj - ii];//y[j]*h[j-i]/suma(h[j][k]x[k])
+                  sum = sum * working_space[ii];
+               }
+               working_space[3 * ssize + ii] = sum;
+            }
+         });
          for (i = 0; i < ssize; i++)
             working_space[i] = working_space[3 * ssize + i];
       }
@@ -1768,6 +1757,53 @@ const char *TSpectrum::DeconvolutionRL(Double_t *source, const Double_t *respons
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Estimate the background of nspectra spectra of ssize channels each, with
+/// the same parameters as Background(Double_t *, ...): spectra[i] is replaced
+/// by its background. If the implicit multi-threading is enabled, the spectra
+/// are processed in parallel.
+///
+/// Returns the error message of the first spectrum that could not be
+/// processed, or 0.
+
+const char *TSpectrum::BackgroundBatch(Double_t **spectra, Int_t nspectra, Int_t ssize,
+                                       Int_t numberIterations, Int_t direction, Int_t filterOrder,
+                                       bool smoothing, Int_t smoothWindow, bool compton)
+{
+   std::vector<const char *> errors(nspectra > 0 ? nspectra : 0, nullptr);
+   ROOT::Internal::ForEachSpectrum(nspectra, [&](Int_t i) {
+      errors[i] = Background(spectra[i], ssize, numberIterations, direction, filterOrder, smoothing, smoothWindow,
+                             compton);
+   });
+   for (auto error : errors)
+      if (error)
+         return error;
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Deconvolve nspectra spectra of ssize channels each with the same response,
+/// with the Gold algorithm and the parameters of Deconvolution(): sources[i]
+/// is replaced by its deconvolved spectrum. If the implicit multi-threading
+/// is enabled, the spectra are processed in parallel.
+///
+/// Returns the error message of the first spectrum that could not be
+/// processed, or 0.
+
+const char *TSpectrum::DeconvolutionBatch(Double_t **sources, Int_t nspectra, const Double_t *response,
+                                          Int_t ssize, Int_t numberIterations, Int_t numberRepetitions,
+                                          Double_t boost)
+{
+   std::vector<const char *> errors(nspectra > 0 ? nspectra : 0, nullptr);
+   ROOT::Internal::ForEachSpectrum(nspectra, [&](Int_t i) {
+      errors[i] = Deconvolution(sources[i], response, ssize, numberIterations, numberRepetitions, boost);
+   });
+   for (auto error : errors)
+      if (error)
+         return error;
+   return 0;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// One-dimensional unfolding function
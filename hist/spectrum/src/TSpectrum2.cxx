@@ -44,6 +44,7 @@
 #include "TList.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TSpectrumParallel.h"
 #define PEAK_WINDOW 1024
 
 Int_t TSpectrum2::fgIterations    = 3;
@@ -836,7 +837,7 @@ const char *TSpectrum2::Deconvolution(Double_t **source, Double_t **resp,
                                        Int_t numberRepetitions,
                                        Double_t boost)
 {
-   Int_t i, j, lhx, lhy, i1, i2, j1, j2, k1, k2, lindex, i1min, i1max,
+   Int_t i, j, lhx, lhy, i1, i2, j1, j2, lindex, i1min, i1max,
        i2min, i2max, j1min, j1max, j2min, j2max, positx = 0, posity = 0, repet;
    Double_t lda, ldb, ldc, area, maximum = 0;
    if (ssizex <= 0 || ssizey <= 0)
@@ -875,22 +876,22 @@ const char *TSpectrum2::Deconvolution(Double_t **source, Double_t **resp,
    }
 
 //calculate ht*y and write into p
-   for (i2 = 0; i2 < ssizey; i2++) {
-      for (i1 = 0; i1 < ssizex; i1++) {
-         ldc = 0;
-         for (j2 = 0; j2 <= (lhy - 1); j2++) {
-            for (j1 = 0; j1 <= (lhx - 1); j1++) {
-               k2 = i2 + j2, k1 = i1 + j1;
-               if (k2 >= 0 && k2 < ssizey && k1 >= 0 && k1 < ssizex) {
-                  lda = working_space[j1][j2];
-                  ldb = source[k1][k2];
-                  ldc = ldc + lda * ldb;
+   const Double_t work = Double_t(ssizex) * ssizey * lhx * lhy;
+   ROOT::Internal::ForEachSpectrumRange(ssizey, work, [&](Int_t first, Int_t last) {
+      for (Int_t c2 = first; c2 < last; c2++) {
+         for (Int_t c1 = 0; c1 < ssizex; c1++) {
+            Double_t sum = 0;
+            for (Int_t l2 = 0; l2 <= (lhy - 1); l2++) {
+               for (Int_t l1 = 0; l1 <= (lhx - 1); l1++) {
+                  Int_t m2 = c2 + l2, m1 = c1 + l1;
+                  if (m2 >= 0 && m2 < ssizey && m1 >= 0 && m1 < ssizex)
+                     sum = sum + working_space[l1][l2] * source[m1][m2];
                }
             }
+            working_space[c1][c2 + ssizey] = sum;
          }
-         working_space[i1][i2 + ssizey] = ldc;
       }
-   }
+   });
 
 //calculate matrix b=ht*h
    i1min = -(lhx - 1), i1max = lhx - 1;
@@ -943,41 +944,30 @@ const char *TSpectrum2::Deconvolution(Double_t **source, Double_t **resp,
          }
       }
       for (lindex = 0; lindex < numberIterations; lindex++) {
-         for (i2 = 0; i2 < ssizey; i2++) {
-            for (i1 = 0; i1 < ssizex; i1++) {
-               ldb = 0;
-               j2min = i2;
-               if (j2min > lhy - 1)
-                  j2min = lhy - 1;
-               j2min = -j2min;
-               j2max = ssizey - i2 - 1;
-               if (j2max > lhy - 1)
-                  j2max = lhy - 1;
-               j1min = i1;
-               if (j1min > lhx - 1)
-                  j1min = lhx - 1;
-               j1min = -j1min;
-               j1max = ssizex - i1 - 1;
-               if (j1max > lhx - 1)
-                  j1max = lhx - 1;
-               for (j2 = j2min; j2 <= j2max; j2++) {
-                  for (j1 = j1min; j1 <= j1max; j1++) {
-                     ldc =  working_space[j1 - i1min][j2 - i2min + 2 * ssizey];
-                     lda = working_space[i1 + j1][i2 + j2 + 3 * ssizey];
-                     ldb = ldb + lda * ldc;
+         // The columns only read the current solution: they are computed in parallel.
+         ROOT::Internal::ForEachSpectrumRange(ssizey, 4 * work, [&](Int_t first, Int_t last) {
+            for (Int_t c2 = first; c2 < last; c2++) {
+               for (Int_t c1 = 0; c1 < ssizex; c1++) {
+                  Double_t sum = 0;
+                  const Int_t l2min = -TMath::Min(c2, lhy - 1);
+                  const Int_t l2max = TMath::Min(ssizey - c2 - 1, lhy - 1);
+                  const Int_t l1min = -TMath::Min(c1, lhx - 1);
+                  const Int_t l1max = TMath::Min(ssizex - c1 - 1, lhx - 1);
+                  for (Int_t l2 = l2min; l2 <= l2max; l2++) {
+                     for (Int_t l1 = l1min; l1 <= l1max; l1++)
+                        sum = sum + working_space[c1 + l1][c2 + l2 + 3 * ssizey] *
+                                       working_space[l1 - i1min][l2 - i2min + 2 * ssizey];
                   }
+                  Double_t x = working_space[c1][c2 + 3 * ssizey];
+                  const Double_t p = working_space[c1][c2 + 1 * ssizey];
+                  if (p * x != 0 && sum != 0)
+                     x = x * p / sum;
+                  else
+                     x = 0;
+                  working_space[c1][c2 + 4 * ssizey] = x;
                }
-               lda = working_space[i1][i2 + 3 * ssizey];
-               ldc = working_space[i1][i2 + 1 * ssizey];
-               if (ldc * lda != 0 && ldb != 0) {
-                  lda = lda * ldc / ldb;
-               }
-
-               else
-                  lda = 0;
-               working_space[i1][i2 + 4 * ssizey] = lda;
             }
-         }
+         });
          for (i2 = 0; i2 < ssizey; i2++) {
             for (i1 = 0; i1 < ssizex; i1++)
                working_space[i1][i2 + 3 * ssizey] =
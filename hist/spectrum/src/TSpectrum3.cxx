@@ -48,6 +48,7 @@
 #include "TSpectrum3.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TSpectrumParallel.h"
 #define PEAK_WINDOW 1024
 
 ClassImp(TSpectrum3);
@@ -1600,7 +1601,7 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
                                        Int_t numberRepetitions,
                                        Double_t boost)
 {
-   Int_t i, j, k, lhx, lhy, lhz, i1, i2, i3, j1, j2, j3, k1, k2, k3, lindex, i1min, i1max, i2min, i2max, i3min, i3max, j1min, j1max, j2min, j2max, j3min, j3max, positx = 0, posity = 0, positz = 0, repet;
+   Int_t i, j, k, lhx, lhy, lhz, i1, i2, i3, j1, j2, j3, lindex, i1min, i1max, i2min, i2max, i3min, i3max, j1min, j1max, j2min, j2max, j3min, j3max, positx = 0, posity = 0, positz = 0, repet;
    Double_t lda, ldb, ldc, area, maximum = 0;
    if (ssizex <= 0 || ssizey <= 0 || ssizez <= 0)
       return "Wrong parameters";
@@ -1648,26 +1649,26 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
    }
 
 //calculate ht*y and write into p
-   for (i3 = 0; i3 < ssizez; i3++) {
-      for (i2 = 0; i2 < ssizey; i2++) {
-         for (i1 = 0; i1 < ssizex; i1++) {
-            ldc = 0;
-            for (j3 = 0; j3 <= (lhz - 1); j3++) {
-               for (j2 = 0; j2 <= (lhy - 1); j2++) {
-                  for (j1 = 0; j1 <= (lhx - 1); j1++) {
-                     k3 = i3 + j3, k2 = i2 + j2, k1 = i1 + j1;
-                     if (k3 >= 0 && k3 < ssizez && k2 >= 0 && k2 < ssizey && k1 >= 0 && k1 < ssizex) {
-                        lda = working_space[j1][j2][j3];
-                        ldb = source[k1][k2][k3];
-                        ldc = ldc + lda * ldb;
+   const Double_t work = Double_t(ssizex) * ssizey * ssizez * lhx * lhy * lhz;
+   ROOT::Internal::ForEachSpectrumRange(ssizez, work, [&](Int_t first, Int_t last) {
+      for (Int_t c3 = first; c3 < last; c3++) {
+         for (Int_t c2 = 0; c2 < ssizey; c2++) {
+            for (Int_t c1 = 0; c1 < ssizex; c1++) {
+               Double_t sum = 0;
+               for (Int_t l3 = 0; l3 <= (lhz - 1); l3++) {
+                  for (Int_t l2 = 0; l2 <= (lhy - 1); l2++) {
+                     for (Int_t l1 = 0; l1 <= (lhx - 1); l1++) {
+                        Int_t m3 = c3 + l3, m2 = c2 + l2, m1 = c1 + l1;
+                        if (m3 >= 0 && m3 < ssizez && m2 >= 0 && m2 < ssizey && m1 >= 0 && m1 < ssizex)
+                           sum = sum + working_space[l1][l2][l3] * source[m1][m2][m3];
                      }
                   }
                }
+               working_space[c1][c2][c3 + ssizez] = sum;
             }
-            working_space[i1][i2][i3 + ssizez] = ldc;
          }
       }
-   }
+   });
 
 //calculate matrix b=ht*h
    i1min = -(lhx - 1), i1max = lhx - 1;
@@ -1734,52 +1735,36 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
          }
       }
       for (lindex = 0; lindex < numberIterations; lindex++) {
-         for (i3 = 0; i3 < ssizez; i3++) {
-            for (i2 = 0; i2 < ssizey; i2++) {
-               for (i1 = 0; i1 < ssizex; i1++) {
-                  ldb = 0;
-                  j3min = i3;
-                  if (j3min > lhz - 1)
-                     j3min = lhz - 1;
-                  j3min = -j3min;
-                  j3max = ssizez - i3 - 1;
-                  if (j3max > lhz - 1)
-                     j3max = lhz - 1;
-                  j2min = i2;
-                  if (j2min > lhy - 1)
-                     j2min = lhy - 1;
-                  j2min = -j2min;
-                  j2max = ssizey - i2 - 1;
-                  if (j2max > lhy - 1)
-                     j2max = lhy - 1;
-                  j1min = i1;
-                  if (j1min > lhx - 1)
-                     j1min = lhx - 1;
-                  j1min = -j1min;
-                  j1max = ssizex - i1 - 1;
-                  if (j1max > lhx - 1)
-                     j1max = lhx - 1;
-                  for (j3 = j3min; j3 <= j3max; j3++) {
-                     for (j2 = j2min; j2 <= j2max; j2++) {
-                        for (j1 = j1min; j1 <= j1max; j1++) {
-                           ldc =  working_space[j1 - i1min][j2 - i2min][j3 - i3min + 2 * ssizez];
-                           lda = working_space[i1 + j1][i2 + j2][i3 + j3 + 3 * ssizez];
-                           ldb = ldb + lda * ldc;
+         // The planes only read the current solution: they are computed in parallel.
+         ROOT::Internal::ForEachSpectrumRange(ssizez, 8 * work, [&](Int_t first, Int_t last) {
+            for (Int_t c3 = first; c3 < last; c3++) {
+               for (Int_t c2 = 0; c2 < ssizey; c2++) {
+                  for (Int_t c1 = 0; c1 < ssizex; c1++) {
+                     Double_t sum = 0;
+                     const Int_t l3min = -TMath::Min(c3, lhz - 1);
+                     const Int_t l3max = TMath::Min(ssizez - c3 - 1, lhz - 1);
+                     const Int_t l2min = -TMath::Min(c2, lhy - 1);
+                     const Int_t l2max = TMath::Min(ssizey - c2 - 1, lhy - 1);
+                     const Int_t l1min = -TMath::Min(c1, lhx - 1);
+                     const Int_t l1max = TMath::Min(ssizex - c1 - 1, lhx - 1);
+                     for (Int_t l3 = l3min; l3 <= l3max; l3++) {
+                        for (Int_t l2 = l2min; l2 <= l2max; l2++) {
+                           for (Int_t l1 = l1min; l1 <= l1max; l1++)
+                              sum = sum + working_space[c1 + l1][c2 + l2][c3 + l3 + 3 * ssizez] *
+                                             working_space[l1 - i1min][l2 - i2min][l3 - i3min + 2 * ssizez];
                         }
                      }
+                     Double_t x = working_space[c1][c2][c3 + 3 * ssizez];
+                     const Double_t p = working_space[c1][c2][c3 + 1 * ssizez];
+                     if (p * x != 0 && sum != 0)
+                        x = x * p / sum;
+                     else
+                        x = 0;
+                     working_space[c1][c2][c3 + 4 * ssizez] = x;
                   }
-                  lda = working_space[i1][i2][i3 + 3 * ssizez];
-                  ldc = working_space[i1][i2][i3 + 1 * ssizez];
-                  if (ldc * lda != 0 && ldb != 0) {
-                     lda = lda * ldc / ldb;
-                  }
-
-                  else
-                     lda = 0;
-                  working_space[i1][i2][i3 + 4 * ssizez] = lda;
                }
             }
-         }
+         });
          for (i3 = 0; i3 < ssizez; i3++) {
             for (i2 = 0; i2 < ssizey; i2++) {
                for (i1 = 0; i1 < ssizex; i1++)
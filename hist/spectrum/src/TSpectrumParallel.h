@@ -0,0 +1,79 @@
+// @(#)root/spectrum:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TSpectrumParallel
+#define ROOT_TSpectrumParallel
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// Distribution of the channels of the iterative spectrum algorithms,   //
+// and of batches of spectra, among the threads of the implicit         //
+// multi-threading, private to the spectrum package.                    //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "RConfigure.h"
+#include "RtypesCore.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+namespace ROOT {
+namespace Internal {
+
+/// Minimal number of multiply-adds of one pass over the channels for them to
+/// be processed in parallel, below which the tasks would cost more than they gain.
+const Double_t kSpectrumMinParallelWork = 2.e5;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(first, last) on consecutive ranges of channels covering [0, n),
+/// in parallel if the implicit multi-threading is enabled and the pass needs
+/// at least kSpectrumMinParallelWork multiply-adds. The ranges must be
+/// computable independently, i.e. func must only write their channels.
+
+template <class F>
+void ForEachSpectrumRange(Int_t n, Double_t work, F func)
+{
+#ifdef R__USE_IMT
+   if (n > 1 && work >= kSpectrumMinParallelWork && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.ForeachRange([&](std::size_t first, std::size_t last) { func(Int_t(first), Int_t(last)); }, 0, n);
+      return;
+   }
+#else
+   (void)work;
+#endif
+   func(0, n);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(i) for the n spectra of a batch, in parallel if the implicit
+/// multi-threading is enabled.
+
+template <class F>
+void ForEachSpectrum(Int_t n, F func)
+{
+#ifdef R__USE_IMT
+   if (n > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](unsigned i) { func(Int_t(i)); }, ROOT::TSeqU(n));
+      return;
+   }
+#endif
+   for (Int_t i = 0; i < n; ++i)
+      func(i);
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
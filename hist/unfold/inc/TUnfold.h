@@ -207,6 +207,12 @@ class TUnfold : public TObject {
    TMatrixDSparse *fEinv;
    /// matrix E
    TMatrixDSparse *fE;
+   /// A<sup>T</sup>Vyy<sup>-1</sup>, kept for the unfoldings with other values of tau
+   TMatrixDSparse *fAtVyyInv; //!
+   /// A<sup>T</sup>Vyy<sup>-1</sup>A, kept for the unfoldings with other values of tau
+   TMatrixDSparse *fAtVyyInvA; //!
+   /// L<sup>T</sup>L, kept for the unfoldings with other values of tau
+   TMatrixDSparse *fLSquared; //!
  protected:
    // Int_t IsNotSymmetric(TMatrixDSparse const &m) const;
    virtual Double_t DoUnfold(void);     // the unfolding algorithm
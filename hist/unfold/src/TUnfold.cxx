@@ -119,6 +119,7 @@ along with TUnfold.  If not, see <http://www.gnu.org/licenses/>.
 #include <TMatrixDSymEigen.h>
 #include <TMath.h>
 #include "TUnfold.h"
+#include "TUnfoldParallel.h"
 
 #include <map>
 #include <vector>
@@ -139,6 +140,9 @@ TUnfold::~TUnfold(void)
    DeleteMatrix(&fY);
    DeleteMatrix(&fX0);
    DeleteMatrix(&fVyyInv);
+   DeleteMatrix(&fAtVyyInv);
+   DeleteMatrix(&fAtVyyInvA);
+   DeleteMatrix(&fLSquared);
 
    ClearResults();
 }
@@ -180,6 +184,9 @@ void TUnfold::InitTUnfold(void)
    fDXDY = 0;
    fEinv = 0;
    fE = 0;
+   fAtVyyInv = 0;
+   fAtVyyInvA = 0;
+   fLSquared = 0;
    fEpsMatrix=1.E-13;
    fIgnoredBins=0;
 }
@@ -299,18 +306,31 @@ Double_t TUnfold::DoUnfold(void)
       }
    }
    //
-   // get matrix
+   // get matrices
    //              T
    //            fA fV  = mAt_V
    //
-   TMatrixDSparse *AtVyyinv=MultiplyMSparseTranspMSparse(fA,fVyyInv);
+   //              T
+   //           (fA fV)fA
+   //
+   // these do not depend on tau, they are kept for the next unfolding
+   // with the same input, e.g. when scanning tau
+   if(!fAtVyyInv) {
+      fAtVyyInv=MultiplyMSparseTranspMSparse(fA,fVyyInv);
+      DeleteMatrix(&fAtVyyInvA);
+      fAtVyyInvA=MultiplyMSparseMSparse(fAtVyyInv,fA);
+   }
+   const TMatrixDSparse *AtVyyinv=fAtVyyInv;
    //
    // get
    //       T
    //     fA fVyyinv fY + fTauSquared fBiasScale Lsquared fX0 = rhs
    //
    TMatrixDSparse *rhs=MultiplyMSparseM(AtVyyinv,fY);
-   TMatrixDSparse *lSquared=MultiplyMSparseTranspMSparse(fL,fL);
+   if(!fLSquared) {
+      fLSquared=MultiplyMSparseTranspMSparse(fL,fL);
+   }
+   const TMatrixDSparse *lSquared=fLSquared;
    if (fBiasScale != 0.0) {
      TMatrixDSparse *rhs2=MultiplyMSparseM(lSquared,fX0);
       AddMSparse(rhs, fTauSquared * fBiasScale ,rhs2);
@@ -321,7 +341,7 @@ Double_t TUnfold::DoUnfold(void)
    // get matrix
    //              T
    //           (fA fV)fA + fTauSquared*fLsquared  = fEinv
-   fEinv=MultiplyMSparseMSparse(AtVyyinv,fA);
+   fEinv=new TMatrixDSparse(*fAtVyyInvA);
    AddMSparse(fEinv,fTauSquared,lSquared);
 
    //
@@ -427,7 +447,6 @@ Double_t TUnfold::DoUnfold(void)
       DeleteMatrix(&corr);
    }
 
-   DeleteMatrix(&AtVyyinv);
 
    //
    // get error matrix on x
@@ -491,7 +510,6 @@ Double_t TUnfold::DoUnfold(void)
    DeleteMatrix(&epsilon);
 
    DeleteMatrix(&LsquaredDx);
-   DeleteMatrix(&lSquared);
 
    // calculate/store matrices defining the derivatives dx/dA
    fDXDAM[0]=new TMatrixDSparse(*fE);
@@ -1342,32 +1360,54 @@ TMatrixDSparse *TUnfold::InvertMSparseSymmPos
          const Int_t *f_cols=F->GetColIndexArray();
          const Double_t *f_data=F->GetMatrixArray();
          // cholesky-type decomposition of F
+         //
+         // the elements left of the first non-zero element of a row of F
+         // (its envelope) stay zero in the decomposition, so the sums
+         // start at the first column of the envelope of both rows.
+         // For a given i, the elements c(j,i) of the rows j>i are
+         // independent and are calculated in parallel
          TMatrixD c(nF,nF);
+         Double_t *c_data=c.GetMatrixArray();
+         std::vector<Int_t> first(nF);
+         for(Int_t j=0;j<nF;j++) first[j]=j;
+         for(Int_t i=0;i<nF;i++) {
+            for(Int_t indexF=f_rows[i];indexF<f_rows[i+1];indexF++) {
+               Int_t j=f_cols[indexF];
+               if((j>i)&&(i<first[j])) first[j]=i;
+            }
+         }
          Int_t nErrorF=0;
          for(Int_t i=0;i<nF;i++) {
+            Double_t *c_i=c_data+i*nF;
             for(Int_t indexF=f_rows[i];indexF<f_rows[i+1];indexF++) {
-               if(f_cols[indexF]>=i) c(f_cols[indexF],i)=f_data[indexF];
+               if(f_cols[indexF]>=i) c_data[f_cols[indexF]*nF+i]=f_data[indexF];
             }
             // calculate diagonal element
-       Double_t c_ii=c(i,i);
-            for(Int_t j=0;j<i;j++) {
-               Double_t c_ij=c(i,j);
+            Double_t c_ii=c_i[i];
+            for(Int_t j=first[i];j<i;j++) {
+               Double_t c_ij=c_i[j];
                c_ii -= c_ij*c_ij;
             }
             if(c_ii<=0.0) {
                nErrorF++;
                break;
             }
-       c_ii=TMath::Sqrt(c_ii);
-       c(i,i)=c_ii;
+            c_ii=TMath::Sqrt(c_ii);
+            c_i[i]=c_ii;
             // off-diagonal elements
-            for(Int_t j=i+1;j<nF;j++) {
-               Double_t c_ji=c(j,i);
-               for(Int_t k=0;k<i;k++) {
-                  c_ji -= c(i,k)*c(j,k);
-               }
-               c(j,i) = c_ji/c_ii;
-            }
+            ROOT::Internal::ForEachUnfoldRange
+               (i+1,nF,Double_t(nF-i-1)*(i-first[i]),
+                [&](Int_t jFirst,Int_t jLast) {
+                  for(Int_t j=jFirst;j<jLast;j++) {
+                     if(first[j]>i) continue;
+                     Double_t *c_j=c_data+j*nF;
+                     Double_t c_ji=c_j[i];
+                     for(Int_t k=TMath::Max(first[i],first[j]);k<i;k++) {
+                        c_ji -= c_i[k]*c_j[k];
+                     }
+                     c_j[i] = c_ji/c_ii;
+                  }
+               });
          }
          // check condition of dInv
          if(!nErrorF) {
@@ -1385,19 +1425,30 @@ TMatrixDSparse *TUnfold::InvertMSparseSymmPos
          if(!nErrorF) {
             // here: F = c c#
             // construct inverse of c
+            // the columns of the inverse are independent
+            // and are calculated in parallel
             TMatrixD cinv(nF,nF);
+            Double_t *cinv_data=cinv.GetMatrixArray();
             for(Int_t i=0;i<nF;i++) {
-               cinv(i,i)=1./c(i,i);
+               cinv_data[i*nF+i]=1./c_data[i*nF+i];
             }
-            for(Int_t i=0;i<nF;i++) {
-               for(Int_t j=i+1;j<nF;j++) {
-                  Double_t tmp=-c(j,i)*cinv(i,i);
-                  for(Int_t k=i+1;k<j;k++) {
-                     tmp -= cinv(k,i)*c(j,k);
+            ROOT::Internal::ForEachUnfoldRange
+               (0,nF,Double_t(nF)*nF*nF/6.,
+                [&](Int_t iFirst,Int_t iLast) {
+                  std::vector<Double_t> cinv_i(nF);
+                  for(Int_t i=iFirst;i<iLast;i++) {
+                     cinv_i[i]=cinv_data[i*nF+i];
+                     for(Int_t j=i+1;j<nF;j++) {
+                        const Double_t *c_j=c_data+j*nF;
+                        Double_t tmp=-c_j[i]*cinv_i[i];
+                        for(Int_t k=TMath::Max(i+1,first[j]);k<j;k++) {
+                           tmp -= cinv_i[k]*c_j[k];
+                        }
+                        cinv_i[j]=tmp*cinv_data[j*nF+j];
+                        cinv_data[j*nF+i]=cinv_i[j];
+                     }
                   }
-                  cinv(j,i)=tmp*cinv(j,j);
-               }
-            }
+               });
             TMatrixDSparse cInvSparse(cinv);
             Finv=MultiplyMSparseTranspMSparse
                (&cInvSparse,&cInvSparse);
@@ -2015,6 +2066,7 @@ Bool_t TUnfold::AddRegularisationCondition
    // replace the old matrix fL
    if(r) {
       DeleteMatrix(&fL);
+      DeleteMatrix(&fLSquared);
       fL=CreateSparseMatrix(rowMax+1,GetNx(),nF,l_row,l_col,l_data);
    }
    delete [] l_row;
@@ -2302,6 +2354,8 @@ Int_t TUnfold::SetInput(const TH1 *input, Double_t scaleBias,
                         const TH2 *hist_vyy_inv)
 {
   DeleteMatrix(&fVyyInv);
+  DeleteMatrix(&fAtVyyInv);
+  DeleteMatrix(&fAtVyyInvA);
   fNdf=0;
 
   fBiasScale = scaleBias;
@@ -0,0 +1,81 @@
+// @(#)root/unfold:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TUnfoldParallel
+#define ROOT_TUnfoldParallel
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// Distribution of the rows of the matrix decompositions and of the     //
+// systematic sources among the threads of the implicit                 //
+// multi-threading, private to the unfold package.                      //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "RConfigure.h"
+#include "RtypesCore.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+namespace ROOT {
+namespace Internal {
+
+/// Minimal number of multiply-adds of one step of a matrix decomposition for
+/// its rows to be processed in parallel, below which the tasks would cost more
+/// than they gain.
+const Double_t kUnfoldMinParallelWork = 2.e5;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(first, last) on consecutive ranges of rows covering [begin, end),
+/// in parallel if the implicit multi-threading is enabled and the step needs
+/// at least kUnfoldMinParallelWork multiply-adds. The ranges must be
+/// computable independently, i.e. func must only write their rows.
+
+template <class F>
+void ForEachUnfoldRange(Int_t begin, Int_t end, Double_t work, F func)
+{
+#ifdef R__USE_IMT
+   if (end - begin > 1 && work >= kUnfoldMinParallelWork && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.ForeachRange([&](std::size_t first, std::size_t last) { func(Int_t(first), Int_t(last)); }, begin, end);
+      return;
+   }
+#else
+   (void)work;
+#endif
+   if (begin < end)
+      func(begin, end);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(i) for the n systematic sources, in parallel if the implicit
+/// multi-threading is enabled.
+
+template <class F>
+void ForEachUnfoldSource(Int_t n, F func)
+{
+#ifdef R__USE_IMT
+   if (n > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](unsigned i) { func(Int_t(i)); }, ROOT::TSeqU(n));
+      return;
+   }
+#endif
+   for (Int_t i = 0; i < n; ++i)
+      func(i);
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
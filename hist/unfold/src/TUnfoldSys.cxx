@@ -111,8 +111,10 @@ INCLUDED in the methods provided by the base class TUnfold.
 #include <TObjString.h>
 #include <TSortedList.h>
 #include <cmath>
+#include <vector>
 
 #include "TUnfoldSys.h"
+#include "TUnfoldParallel.h"
 
 ClassImp(TUnfoldSys);
 
@@ -667,38 +669,58 @@ void TUnfoldSys::PrepareSysError(void)
    TMapIter sysErrIn(fSysIn);
    const TObjString *key;
 
-   // calculate individual systematic errors
+   // find the systematic sources which are not calculated yet
+   std::vector<const TObjString *> keyX,keyAx;
+   std::vector<const TMatrixDSparse *> dsysX,dsysAx;
    for(key=(const TObjString *)sysErrIn.Next();key;
        key=(const TObjString *)sysErrIn.Next()) {
       const TMatrixDSparse *dsys=
          (const TMatrixDSparse *)((const TPair *)*sysErrIn)->Value();
-      const TPair *named_emat=(const TPair *)
-         fDeltaCorrX->FindObject(key->GetString());
-      if(!named_emat) {
-         TMatrixDSparse *emat=PrepareCorrEmat(GetDXDAM(0),GetDXDAM(1),dsys);
-         fDeltaCorrX->Add(new TObjString(*key),emat);
+      if(!fDeltaCorrX->FindObject(key->GetString())) {
+         keyX.push_back(key);
+         dsysX.push_back(dsys);
       }
-      named_emat=(const TPair *)fDeltaCorrAx->FindObject(key->GetString());
-      if(!named_emat) {
-         if(!AM0) AM0=MultiplyMSparseMSparse(fA,GetDXDAM(0));
-         if(!AM1) {
-            AM1=MultiplyMSparseMSparse(fA,GetDXDAM(1));
-            Int_t *rows_cols=new Int_t[GetNy()];
-            Double_t *data=new Double_t[GetNy()];
-            for(Int_t i=0;i<GetNy();i++) {
-               rows_cols[i]=i;
-               data[i]=1.0;
-            }
-            TMatrixDSparse *one=CreateSparseMatrix
-               (GetNy(),GetNy(),GetNy(),rows_cols, rows_cols,data);
-            delete[] data;
-            delete[] rows_cols;
-            AddMSparse(AM1,-1.,one);
-            DeleteMatrix(&one);
-            fEmatUncorrAx=PrepareUncorrEmat(AM0,AM1);
+      if(!fDeltaCorrAx->FindObject(key->GetString())) {
+         keyAx.push_back(key);
+         dsysAx.push_back(dsys);
+      }
+   }
+   if(!keyAx.empty()) {
+      if(!AM0) AM0=MultiplyMSparseMSparse(fA,GetDXDAM(0));
+      if(!AM1) {
+         AM1=MultiplyMSparseMSparse(fA,GetDXDAM(1));
+         Int_t *rows_cols=new Int_t[GetNy()];
+         Double_t *data=new Double_t[GetNy()];
+         for(Int_t i=0;i<GetNy();i++) {
+            rows_cols[i]=i;
+            data[i]=1.0;
          }
-         TMatrixDSparse *emat=PrepareCorrEmat(AM0,AM1,dsys);
-         fDeltaCorrAx->Add(new TObjString(*key),emat);
+         TMatrixDSparse *one=CreateSparseMatrix
+            (GetNy(),GetNy(),GetNy(),rows_cols, rows_cols,data);
+         delete[] data;
+         delete[] rows_cols;
+         AddMSparse(AM1,-1.,one);
+         DeleteMatrix(&one);
+      }
+   }
+
+   // calculate individual systematic errors
+   // the sources are independent and are propagated in parallel
+   Int_t nX=keyX.size();
+   Int_t nSys=nX+keyAx.size();
+   std::vector<TMatrixDSparse *> emat(nSys);
+   ROOT::Internal::ForEachUnfoldSource(nSys,[&](Int_t i) {
+      if(i<nX) {
+         emat[i]=PrepareCorrEmat(GetDXDAM(0),GetDXDAM(1),dsysX[i]);
+      } else {
+         emat[i]=PrepareCorrEmat(AM0,AM1,dsysAx[i-nX]);
+      }
+   });
+   for(Int_t i=0;i<nSys;i++) {
+      if(i<nX) {
+         fDeltaCorrX->Add(new TObjString(*keyX[i]),emat[i]);
+      } else {
+         fDeltaCorrAx->Add(new TObjString(*keyAx[i-nX]),emat[i]);
       }
    }
    DeleteMatrix(&AM0);
@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -58,6 +59,12 @@ public:
        * that the protocol-dependent default block size should be used.
        */
       int fBlockSize;
+      /**
+       * If not empty, remote files created by Create() keep the blocks they read in this directory, which can be
+       * shared by the processes of a node (see RRawFileDiskCache). If empty, the RRawFile.CacheDir rootrc value
+       * is used.
+       */
+      std::string fCacheDir;
       ROptions() : fLineBreak(ELineBreaks::kAuto), fBlockSize(-1) {}
    };
 
@@ -132,6 +139,9 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// By default, runs ReadV on a clone of the file in a separate thread, so that the buffers of this file are not
+   /// touched concurrently. Derived classes whose ReadVImpl is safe to run alongside other calls can do without the clone.
+   virtual std::future<void> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq);
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -160,9 +170,15 @@ public:
    void Seek(std::uint64_t offset);
    /// Returns the size of the file
    std::uint64_t GetSize();
+   /// Returns the url the file was created with
+   const std::string &GetUrl() const { return fUrl; }
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Opens the file if necessary and starts reading the requests in the background. The returned future becomes
+   /// ready once all the fOutBytes are set and rethrows the read errors. The file and the ioVec array must be kept
+   /// alive until then.
+   std::future<void> ReadVAsync(RIOVec *ioVec, unsigned int nReq);
 
    /// Memory mapping according to POSIX standard; in particular, new mappings of the same range replace older ones.
    /// Mappings need to be aligned at page boundaries, therefore the real offset can be smaller than the desired value.
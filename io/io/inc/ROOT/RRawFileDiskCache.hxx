@@ -0,0 +1,70 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RRawFileDiskCache
+#define ROOT_RRawFileDiskCache
+
+#include <ROOT/RRawFile.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RRawFileDiskCache RRawFileDiskCache.hxx
+ * \ingroup IO
+ *
+ * The RRawFileDiskCache reads a (typically remote) file through a directory on local disk that keeps the blocks
+ * of kCacheBlockSize bytes already read, so that repeated passes over the same data are served locally. A block is
+ * identified by the URL and the size of the file and by its offset. Blocks are written to a temporary file that is
+ * then renamed, so that several processes can share the same cache directory. The missing blocks of a vector read
+ * are fetched with a single vector read of the underlying file. The cache directory is never cleaned up.
+ *
+ * Blocks that cannot be stored or read back, e.g. because the disk is full, are read from the underlying file.
+ * Files of unknown size are not cached.
+ */
+class RRawFileDiskCache : public RRawFile {
+public:
+   /// The cache granularity: requests are rounded to blocks of this size, but for the last block of the file
+   static constexpr std::size_t kCacheBlockSize = 1024 * 1024;
+
+private:
+   std::unique_ptr<RRawFile> fRemote;
+   std::string fCacheDir;
+   /// The subdirectory of fCacheDir for the blocks of this file, set on opening
+   std::string fBlockDir;
+
+   std::string GetBlockPath(std::uint64_t block) const;
+   /// Copies nbytes from offsetInBlock in the cached block into buffer. Returns false if the block is not available.
+   bool ReadCachedBlock(std::uint64_t block, std::size_t offsetInBlock, void *buffer, std::size_t nbytes) const;
+   void StoreBlock(std::uint64_t block, const unsigned char *buffer, std::size_t nbytes) const;
+
+protected:
+   void OpenImpl() final;
+   size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
+   void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::uint64_t GetSizeImpl() final;
+
+public:
+   RRawFileDiskCache(std::unique_ptr<RRawFile> remote, std::string_view cacheDir, ROptions options);
+   ~RRawFileDiskCache();
+   std::unique_ptr<RRawFile> Clone() const final;
+   int GetFeatures() const final { return fRemote->GetFeatures() & kFeatureHasSize; }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -27,6 +27,9 @@ namespace Internal {
  *
  * The RRawFileUnix class uses POSIX calls to read from a mounted file system. Thus the path name can refer,
  * for instance, to a named pipe instead of a regular file.
+ *
+ * On Linux, vector reads are submitted at once through io_uring, if the kernel supports it, so that the scattered
+ * requests of a batch are served in parallel by the device.
  */
 class RRawFileUnix : public RRawFile {
 private:
@@ -38,6 +41,8 @@ protected:
    std::uint64_t GetSizeImpl() final;
    void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset) final;
    void UnmapImpl(void *region, size_t nbytes) final;
+   void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::future<void> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq) final;
 
 public:
    RRawFileUnix(std::string_view url, RRawFile::ROptions options);
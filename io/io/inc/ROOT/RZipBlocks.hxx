@@ -0,0 +1,36 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RZipBlocks
+#define ROOT_RZipBlocks
+
+#include "Compression.h"
+#include "RtypesCore.h"
+
+namespace ROOT {
+namespace Internal {
+
+/// Compress the `srcsize` bytes of `src` into `tgt` as a sequence of blocks of at most kMAXZIPBUF bytes, as TKey and
+/// TBasket store the objects they hold. With implicit multi-threading enabled, the blocks are compressed concurrently.
+/// `tgt` must hold at least `srcsize + 9 * nblocks` bytes. Returns the compressed size, or 0 if one of the blocks
+/// could not be compressed (the buffer is then stored uncompressed).
+Int_t ZipBlocks(Int_t cxlevel, ROOT::RCompressionSetting::EAlgorithm::EValues algorithm, char *src, Int_t srcsize,
+                char *tgt, const char *dict = nullptr, Int_t dictsize = 0);
+
+/// Decompress the blocks of `src`, holding `tgtsize` bytes once decompressed, into `tgt`. With implicit
+/// multi-threading enabled, the blocks are decompressed concurrently. Returns the number of bytes decompressed, or 0
+/// if one of the blocks could not be decompressed.
+Int_t UnzipBlocks(UChar_t *src, Int_t srcsize, char *tgt, Int_t tgtsize, const char *dict = nullptr,
+                  Int_t dictsize = 0);
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
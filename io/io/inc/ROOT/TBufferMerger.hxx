@@ -15,10 +15,13 @@
 #include "TFileMerger.h"
 #include "TMemFile.h"
 
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <thread>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -35,11 +38,27 @@ class TBufferMergerFile;
  * but instead of using processes that connect to a network
  * socket, TBufferMerger uses threads that each write to a
  * TBufferMergerFile, which in turn push data into a queue
- * managed by the TBufferMerger.
+ * managed by the TBufferMerger. The buffers waiting in the
+ * queues are accounted in TMemoryAccounting::kFile.
  */
 
 class TBufferMerger {
 public:
+   /** Statistics about the merging, to tune the back-pressure settings.
+    *  Times are in seconds.
+    */
+   struct MergeStats {
+      size_t fPushedBuffers{0};   //< Number of buffers pushed by the TBufferMergerFiles
+      size_t fPeakQueueSize{0};   //< Largest number of buffers waiting to be merged
+      double fPushWaitTime{0};    //< Time spent by the pushing threads waiting for room in the queue
+      size_t fPreMerges{0};       //< Number of merges done by the pre-merging threads
+      double fPreMergeTime{0};    //< Time spent by the pre-merging threads merging
+      size_t fMerges{0};          //< Number of merges into the output file
+      size_t fMergedBuffers{0};   //< Number of buffers, pre-merged or not, merged into the output file
+      double fMergeTime{0};       //< Time spent merging into the output file
+      double fMaxMergeTime{0};    //< Longest merge into the output file
+   };
+
    /** Constructor
     * @param name Output file name
     * @param option Output file creation options
@@ -76,6 +95,9 @@ public:
    /** Returns the current merge options. */
    const char* GetMergeOptions();
 
+   /** Returns the statistics about the merging done so far. */
+   MergeStats GetMergeStats() const;
+
    /** By default, TBufferMerger will call TFileMerger::PartialMerge() for each
     *  buffer pushed onto its merge queue. This function lets the user change
     *  this behaviour by telling TBufferMerger to accumulate at least size
@@ -93,6 +115,25 @@ public:
     */
    void SetMergeOptions(const TString& options);
 
+   /** By default, buffers are merged into the output file by whichever
+    *  thread pushes them, while holding the merge lock. This function starts
+    *  a dedicated thread that merges and writes the queued buffers
+    *  sequentially instead, so that the threads that fill TBufferMergerFiles
+    *  do not wait for the output. If maxQueueSize is not zero, threads that
+    *  push buffers wait while that many buffers are queued, which bounds the
+    *  memory held by the queue. It must be called before any data is pushed.
+    *
+    *  If nPreMergingThreads is not zero, that many threads take the queued
+    *  buffers in batches and merge each batch into a single in-memory buffer,
+    *  concurrently. The merging thread then only merges these larger,
+    *  pre-merged buffers into the output file: fewer TTree headers get
+    *  compressed and written, which helps when many threads fill
+    *  TBufferMergerFiles and the merging thread cannot keep up.
+    *  @param maxQueueSize Maximum number of queued buffers, or 0 for no limit
+    *  @param nPreMergingThreads Number of threads pre-merging the queued buffers
+    */
+   void StartMergingThread(size_t maxQueueSize = 0, size_t nPreMergingThreads = 0);
+
    friend class TBufferMergerFile;
 
 private:
@@ -108,6 +149,10 @@ private:
    void Init(std::unique_ptr<TFile>);
 
    void Merge();
+   void MergeBuffers(std::queue<TBufferFile *> &queue);
+   void MergingThreadLoop();
+   TBufferFile *PreMergeBuffers(TFileMerger &merger, std::queue<TBufferFile *> &queue, Int_t compress);
+   void PreMergingThreadLoop(Int_t compress);
    void Push(TBufferFile *buffer);
 
    size_t fAutoSave{0};                                          //< AutoSave only every fAutoSave bytes
@@ -117,6 +162,18 @@ private:
    std::mutex fQueueMutex;                                       //< Mutex used to lock fQueue
    std::queue<TBufferFile *> fQueue;                             //< Queue to which data is pushed and merged
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
+   std::thread fMergingThread;                                   //< Dedicated merging thread, if started
+   std::condition_variable fDataAvailable;                       //< Signals buffers to the merging thread
+   std::condition_variable fSpaceAvailable;                      //< Signals room in fQueue to pushing threads
+   size_t fMaxQueueSize{0};                                      //< Maximum size of fQueue, if non-zero
+   bool fAsync{false};                                           //< Merge in fMergingThread
+   bool fTerminate{false};                                       //< Stop fMergingThread once fQueue is empty
+   std::vector<std::thread> fPreMergingThreads;                  //< Threads pre-merging the buffers of fQueue, if started
+   size_t fActivePreMergers{0};                                  //< Number of pre-merging threads still running
+   std::queue<TBufferFile *> fPreMergedQueue;                    //< Pre-merged buffers, merged by fMergingThread
+   std::condition_variable fPreMergedAvailable;                  //< Signals pre-merged buffers to the merging thread
+   mutable std::mutex fStatsMutex;                               //< Mutex used to lock fStats
+   MergeStats fStats;                                            //< Statistics about the merging
 };
 
 /**
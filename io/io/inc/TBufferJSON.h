@@ -16,6 +16,7 @@
 #include "TString.h"
 
 #include <deque>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -48,6 +49,9 @@ public:
      kSkipTypeInfo  = 100            // do not store typenames in JSON
    };
 
+   /// Receives consecutive pieces of the JSON code produced by StoreObject()
+   using OutputSink_t = std::function<void(const char *data, Int_t len)>;
+
    TBufferJSON(TBuffer::EMode mode = TBuffer::kWrite);
    virtual ~TBufferJSON();
 
@@ -58,12 +62,15 @@ public:
    Bool_t IsSkipClassInfo(const TClass *cl) const;
 
    TString StoreObject(const void *obj, const TClass *cl);
+   Long64_t StoreObject(const void *obj, const TClass *cl, const OutputSink_t &sink, Int_t chunksize = 65536);
    void *RestoreObject(const char *str, TClass **cl);
 
    static TString ConvertToJSON(const TObject *obj, Int_t compact = 0, const char *member_name = nullptr);
    static TString
    ConvertToJSON(const void *obj, const TClass *cl, Int_t compact = 0, const char *member_name = nullptr);
    static TString ConvertToJSON(const void *obj, TDataMember *member, Int_t compact = 0, Int_t arraylen = -1);
+   static Bool_t ConvertToJSON(std::string &json, const void *obj, const TClass *cl, Int_t compact = 0,
+                               const char *member_name = nullptr);
 
    static Int_t ExportToFile(const char *filename, const TObject *obj, const char *option = nullptr);
    static Int_t ExportToFile(const char *filename, const void *obj, const TClass *cl, const char *option = nullptr);
@@ -296,6 +303,8 @@ protected:
 
    void AppendOutput(const char *line0, const char *line1 = nullptr);
 
+   void FlushOutput();
+
    void JsonPushValue();
 
    template <typename T>
@@ -316,6 +325,9 @@ protected:
 
    TString fOutBuffer;                 ///<!  main output buffer for json code
    TString *fOutput{nullptr};          ///<!  current output buffer for json code
+   OutputSink_t fSink;                 ///<!  when set, receives the content of fOutBuffer every fSinkChunk bytes
+   Int_t fSinkChunk{0};                ///<!  size of fOutBuffer above which it is passed to fSink
+   Long64_t fSinkBytes{0};             ///<!  number of bytes passed to fSink
    TString fValue;                     ///<!  buffer for current value
    unsigned fJsonrCnt{0};              ///<!  counter for all objects, used for referencing
    std::deque<std::unique_ptr<TJSONStackObj>> fStack; ///<!  hierarchy of currently streamed element
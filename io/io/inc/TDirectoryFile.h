@@ -30,6 +30,7 @@ class TList;
 class TBrowser;
 class TKey;
 class TFile;
+namespace ROOT { namespace Internal { class RKeyIndex; } }
 
 class TDirectoryFile : public TDirectory {
 
@@ -46,12 +47,19 @@ protected:
    Long64_t    fSeekKeys{0};             ///< Location of Keys record on file
    TFile      *fFile{nullptr};           ///< Pointer to current file in memory
    TList      *fKeys{nullptr};           ///< Pointer to keys list in memory
+   ROOT::Internal::RKeyIndex *fKeyIndex{nullptr}; ///<!Index of the keys not all in fKeys yet, if they are read on demand
 
    void        CleanTargets();
    void        InitDirectoryFile(TClass *cl = nullptr);
    void        BuildDirectoryFile(TFile* motherFile, TDirectory* motherDir);
+   TKey       *GetIndexedKey(Int_t i) const;
+   void        LoadAllKeys() const;
 
 private:
+   friend class TKey;
+
+   void        ForgetKey(TKey *key);
+
    TDirectoryFile(const TDirectoryFile &directory) = delete;  //Directories cannot be copied
    void operator=(const TDirectoryFile &) = delete; //Directories cannot be copied
 
@@ -92,10 +100,10 @@ public:
    const TDatime      &GetCreationDate() const { return fDatimeC; }
            TFile      *GetFile() const override { return fFile; }
            TKey       *GetKey(const char *name, Short_t cycle=9999) const override;
-           TList      *GetListOfKeys() const override { return fKeys; }
+           TList      *GetListOfKeys() const override;
    const TDatime      &GetModificationDate() const { return fDatimeM; }
            Int_t       GetNbytesKeys() const override { return fNbytesKeys; }
-           Int_t       GetNkeys() const override { return fKeys->GetSize(); }
+           Int_t       GetNkeys() const override;
            Long64_t    GetSeekDir() const override { return fSeekDir; }
            Long64_t    GetSeekParent() const override { return fSeekParent; }
            Long64_t    GetSeekKeys() const override { return fSeekKeys; }
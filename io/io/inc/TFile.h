@@ -49,6 +49,7 @@ class TFileCacheWrite;
 class TProcessID;
 class TStopwatch;
 class TFilePrefetch;
+namespace ROOT { namespace Internal { class RFileWriteBehind; } }
 
 class TFile : public TDirectoryFile {
   friend class TDirectoryFile;
@@ -69,6 +70,16 @@ public:
    /// TTreeCache flushing semantics
    enum ECacheAction { kDisconnect = 0, kDoNotDisconnect = 1 };
 
+   /// Time spent opening the file, in seconds, and the reads it took
+   struct OpenStats {
+      Double_t fInitTime{0};            ///< Time spent in Init(), reading the header, the keys and the StreamerInfo
+      Double_t fKeysTime{0};            ///< Time spent in Init() reading the keys of the top directory
+      Double_t fStreamerInfoTime{0};    ///< Time spent reading the StreamerInfo record, at open or later
+      Int_t    fInitReadCalls{0};       ///< Number of read calls done by Init()
+      Long64_t fInitBytesRead{0};       ///< Number of bytes read by Init()
+      Bool_t   fStreamerInfoRead{kFALSE}; ///< True if the StreamerInfo record has been read
+   };
+
 protected:
    Double_t         fSumBuffer{0};            ///<Sum of buffer sizes of objects written so far
    Double_t         fSum2Buffer{0};           ///<Sum of squares of buffer sizes of objects written so far
@@ -98,6 +109,7 @@ protected:
    TFileCacheRead  *fCacheRead{nullptr};      ///<!Pointer to the read cache (if any)
    TMap            *fCacheReadMap{nullptr};   ///<!Pointer to the read cache (if any)
    TFileCacheWrite *fCacheWrite{nullptr};     ///<!Pointer to the write cache (if any)
+   ROOT::Internal::RFileWriteBehind *fWriteBehind{nullptr}; ///<!Queue of the buffers written by the I/O thread (if any)
    Long64_t         fArchiveOffset{0};        ///<!Offset at which file starts in archive
    Bool_t           fIsArchive{kFALSE};       ///<!True if this is a pure archive file
    Bool_t           fNoAnchorInName{kFALSE};  ///<!True if we don't want to force the anchor to be appended to the file name
@@ -105,12 +117,14 @@ protected:
    Bool_t           fInitDone{kFALSE};        ///<!True if the file has been initialized
    Bool_t           fMustFlush{kTRUE};        ///<!True if the file buffers must be flushed
    Bool_t           fIsPcmFile{kFALSE};       ///<!True if the file is a ROOT pcm file.
+   Bool_t           fStreamerInfoPending{kFALSE}; ///<!True if the StreamerInfo record is read only before the first object
    TFileOpenHandle *fAsyncHandle{nullptr};    ///<!For proper automatic cleanup
    EAsyncOpenStatus fAsyncOpenStatus{kAOSNotAsync}; ///<!Status of an asynchronous open request
    TUrl             fUrl;                     ///<!URL of file
 
    TList           *fInfoCache{nullptr};      ///<!Cached list of the streamer infos in this file
    TList           *fOpenPhases{nullptr};     ///<!Time info about open phases
+   OpenStats        fOpenStats;               ///<!Time spent opening the file
 
 #ifdef R__USE_IMT
    std::mutex                                 fWriteMutex;  ///<!Lock for writing baskets / keys into the file.
@@ -172,6 +186,8 @@ private:
    void operator=(const TFile &) = delete;
 
    static  void        CpProgress(Long64_t bytesread, Long64_t size, TStopwatch &watch);
+           Bool_t      StopWriteBehind();
+           Bool_t      WaitWriteBehind();
    static  TFile      *OpenFromCache(const char *name, Option_t * = "",
                                      const char *ftitle = "", Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault,
                                      Int_t netopt = 0);
@@ -234,6 +250,7 @@ public:
    virtual Long64_t    GetBytesWritten() const;
    virtual Int_t       GetReadCalls() const { return fReadCalls; }
            Int_t       GetVersion() const { return fVersion; }
+     const OpenStats  &GetOpenStats() const { return fOpenStats; }
            Int_t       GetRecordHeader(char *buf, Long64_t first, Int_t maxbytes,
                                        Int_t &nbytes, Int_t &objlen, Int_t &keylen);
    virtual Int_t       GetNbytesInfo() const {return fNbytesInfo;}
@@ -267,11 +284,13 @@ public:
    virtual void        ReadFree();
    virtual TProcessID *ReadProcessID(UShort_t pidf);
    virtual void        ReadStreamerInfo();
+           Bool_t      ReadPendingStreamerInfo();
    virtual Int_t       Recover();
    virtual Int_t       ReOpen(Option_t *mode);
    virtual void        Seek(Long64_t offset, ERelativeTo pos = kBeg);
    virtual void        SetCacheRead(TFileCacheRead *cache, TObject* tree = 0, ECacheAction action = kDisconnect);
    virtual void        SetCacheWrite(TFileCacheWrite *cache);
+           void        SetWriteBehind(Long64_t maxqueued);
    virtual void        SetCompressionAlgorithm(Int_t algorithm = ROOT::RCompressionSetting::EAlgorithm::kUseGlobal);
    virtual void        SetCompressionLevel(Int_t level = ROOT::RCompressionSetting::ELevel::kUseMin);
    virtual void        SetCompressionSettings(Int_t settings = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault);
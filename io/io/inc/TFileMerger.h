@@ -54,8 +54,12 @@ protected:
    TString        fObjectNames;               ///< List of object names to be either merged exclusively or skipped
    TList          fMergeList;                 ///< list of TObjString containing the name of the files need to be merged
    TList          fExcessFiles;               ///<! List of TObjString containing the name of the files not yet added to fFileList due to user or system limitiation on the max number of files opened.
+   Long64_t       fMemoryBudget{0};           ///< Memory, in bytes, the merge aims to stay within (0 for no limit)
+   Long64_t       fOpenedKeysSize{0};         ///<! Estimated memory used by the lists of keys of the files in fFileList
 
+   Bool_t         CanOpenAnotherFile() const;
    Bool_t         OpenExcessFiles();
+   void           AddToFileList(TFile *file);
    virtual Bool_t AddFile(TFile *source, Bool_t own, Bool_t cpProgress);
    virtual Bool_t MergeRecursive(TDirectory *target, TList *sourcelist, Int_t type = kRegular | kAll);
 
@@ -86,6 +90,8 @@ public:
    TFile      *GetOutputFile() const { return fOutputFile; }
    Int_t       GetMaxOpenedFiles() const { return fMaxOpenedFiles; }
    void        SetMaxOpenedFiles(Int_t newmax);
+   Long64_t    GetMemoryBudget() const { return fMemoryBudget; }
+   void        SetMemoryBudget(Long64_t bytes) { fMemoryBudget = bytes; }
    const char *GetMsgPrefix() const { return fMsgPrefix; }
    void        SetMsgPrefix(const char *prefix);
    const char *GetMergeOptions() { return fMergeOptions; }
@@ -117,7 +123,7 @@ public:
    virtual void   SetNotrees(Bool_t notrees=kFALSE) {fNoTrees = notrees;}
    virtual void        RecursiveRemove(TObject *obj);
 
-   ClassDef(TFileMerger, 6)  // File copying and merging services
+   ClassDef(TFileMerger, 7)  // File copying and merging services
 };
 
 #endif
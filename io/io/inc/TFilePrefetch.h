@@ -41,6 +41,7 @@ private:
    TStopwatch  fWaitTime;          // time wating to prefetch a buffer (in usec)
    Bool_t      fThreadJoined;      // mark if async thread was joined
    std::atomic<Bool_t> fPrefetchFinished;  // true if prefetching is over
+   Bool_t      fReadLocal;         // true if the blocks are read with positional reads from the local file
 
    static TThread::VoidRtnFunc_t ThreadProc(void*);  //create a joinable worker thread
 
@@ -48,7 +49,10 @@ public:
    TFilePrefetch(TFile*);
    virtual ~TFilePrefetch();
 
+   static Bool_t CanReadLocal(TFile*);
+
    void      ReadAsync(TFPBlock*, Bool_t&);
+   Bool_t    ReadLocal(TFPBlock*);
    void      ReadListOfBlocks();
 
    void      AddPendingBlock(TFPBlock*);
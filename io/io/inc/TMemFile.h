@@ -83,6 +83,7 @@ protected:
    bool NeedsExistingFile(EMode mode) const { return mode == EMode::kUpdate || mode == EMode::kRead; }
 
    EMode ParseOption(Option_t *option);
+   void  InitMemFile(const char *path, Option_t *option, Long64_t defBlockSize, const char *content);
 
    TMemFile &operator=(const TMemFile&) = delete; // Not implemented.
 
@@ -91,6 +92,9 @@ public:
             Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault, Long64_t defBlockSize = 0LL);
    TMemFile(const char *name, char *buffer, Long64_t size, Option_t *option = "", const char *ftitle = "",
             Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault, Long64_t defBlockSize = 0LL);
+   TMemFile(const char *name, std::unique_ptr<char[]> buffer, Long64_t size, Option_t *option = "",
+            const char *ftitle = "", Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault,
+            Long64_t defBlockSize = 0LL);
    TMemFile(const char *name, ExternalDataPtr_t data);
    TMemFile(const char *name, const ZeroCopyView_t &datarange);
    TMemFile(const char *name, std::unique_ptr<TBufferFile> buffer);
@@ -99,6 +103,7 @@ public:
 
    virtual Long64_t CopyTo(void *to, Long64_t maxsize) const;
    virtual void     CopyTo(TBuffer &tobuf) const;
+   std::unique_ptr<TBufferFile> ReleaseBuffer();
            Long64_t GetSize() const override;
 
            void ResetAfterMerge(TFileMergeInfo *) override;
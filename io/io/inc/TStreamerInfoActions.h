@@ -174,8 +174,10 @@ namespace TStreamerInfoActions {
    public:
       struct SequencePtr;
       using SequenceGetter_t = SequencePtr(*)(TStreamerInfo *info, TVirtualCollectionProxy *collectionProxy, TClass *originalClass);
+      /// Signature of the function generated by JitCompile, streaming the object with all the actions of the sequence.
+      using JitAction_t = Int_t (*)(TBuffer &buf, void *obj, const TConfiguredAction *actions);
 
-      TActionSequence(TVirtualStreamerInfo *info, UInt_t maxdata) : fStreamerInfo(info), fLoopConfig(0) { fActions.reserve(maxdata); };
+      TActionSequence(TVirtualStreamerInfo *info, UInt_t maxdata) : fStreamerInfo(info), fLoopConfig(0), fJitAction(0) { fActions.reserve(maxdata); };
       ~TActionSequence() {
          delete fLoopConfig;
       }
@@ -191,8 +193,11 @@ namespace TStreamerInfoActions {
       TVirtualStreamerInfo *fStreamerInfo; ///< StreamerInfo used to derive these actions.
       TLoopConfiguration   *fLoopConfig;   ///< If this is a bundle of memberwise streaming action, this configures the looping
       ActionContainer_t     fActions;
+      JitAction_t           fJitAction;    ///< If not null, fused and type-specialized version of the object wise actions, used for TBufferFile.
 
       void AddToOffset(Int_t delta);
+      void ClearActions() { fActions.clear(); fJitAction = nullptr; }
+      Bool_t JitCompile(Bool_t read);
       void SetMissing();
 
       TActionSequence *CreateCopy();
@@ -0,0 +1,136 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RByteSwap.hxx"
+
+#include <type_traits>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define R__BYTESWAP_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define R__BYTESWAP_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+using Kernel_t = void (*)(char *to, const char *from, std::size_t n);
+
+/// Reverse the bytes of each of the n values of S bytes; the compilers recognize the pattern as bswap.
+template <std::size_t S>
+void SwapScalar(char *to, const char *from, std::size_t n)
+{
+   for (std::size_t i = 0; i < n; ++i, to += S, from += S) {
+      for (std::size_t k = 0; k < S; ++k)
+         to[k] = from[S - 1 - k];
+   }
+}
+
+#ifdef R__BYTESWAP_X86
+
+/// Fill the 16 bytes of the shuffle mask reversing each group of S bytes.
+template <std::size_t S>
+void FillMask(char *mask)
+{
+   for (std::size_t i = 0; i < 16; ++i)
+      mask[i] = static_cast<char>((i / S) * S + S - 1 - i % S);
+}
+
+template <std::size_t S>
+__attribute__((target("ssse3"))) void SwapSSSE3(char *to, const char *from, std::size_t n)
+{
+   alignas(16) char m[16];
+   FillMask<S>(m);
+   const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i *>(m));
+   const std::size_t nvec = n * S / 16;
+   for (std::size_t i = 0; i < nvec; ++i, to += 16, from += 16) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(to), _mm_shuffle_epi8(v, mask));
+   }
+   SwapScalar<S>(to, from, n - nvec * 16 / S);
+}
+
+template <std::size_t S>
+__attribute__((target("avx2"))) void SwapAVX2(char *to, const char *from, std::size_t n)
+{
+   // _mm256_shuffle_epi8 shuffles within each 128 bit lane: the same mask is used for both.
+   alignas(32) char m[32];
+   FillMask<S>(m);
+   FillMask<S>(m + 16);
+   const __m256i mask = _mm256_load_si256(reinterpret_cast<const __m256i *>(m));
+   const std::size_t nvec = n * S / 32;
+   for (std::size_t i = 0; i < nvec; ++i, to += 32, from += 32) {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to), _mm256_shuffle_epi8(v, mask));
+   }
+   SwapSSSE3<S>(to, from, n - nvec * 32 / S);
+}
+
+#endif // R__BYTESWAP_X86
+
+#ifdef R__BYTESWAP_NEON
+
+inline uint8x16_t Reverse(uint8x16_t v, std::integral_constant<std::size_t, 2>) { return vrev16q_u8(v); }
+inline uint8x16_t Reverse(uint8x16_t v, std::integral_constant<std::size_t, 4>) { return vrev32q_u8(v); }
+inline uint8x16_t Reverse(uint8x16_t v, std::integral_constant<std::size_t, 8>) { return vrev64q_u8(v); }
+
+template <std::size_t S>
+void SwapNEON(char *to, const char *from, std::size_t n)
+{
+   const std::size_t nvec = n * S / 16;
+   for (std::size_t i = 0; i < nvec; ++i, to += 16, from += 16) {
+      const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(from));
+      vst1q_u8(reinterpret_cast<uint8_t *>(to), Reverse(v, std::integral_constant<std::size_t, S>()));
+   }
+   SwapScalar<S>(to, from, n - nvec * 16 / S);
+}
+
+#endif // R__BYTESWAP_NEON
+
+/// Return the fastest implementation supported by the processor.
+template <std::size_t S>
+Kernel_t SelectKernel()
+{
+#if defined(R__BYTESWAP_X86)
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2"))
+      return &SwapAVX2<S>;
+   if (__builtin_cpu_supports("ssse3"))
+      return &SwapSSSE3<S>;
+#elif defined(R__BYTESWAP_NEON)
+   return &SwapNEON<S>;
+#endif
+   return &SwapScalar<S>;
+}
+
+template <std::size_t S>
+void Swap(void *to, const void *from, std::size_t n)
+{
+   static const Kernel_t kernel = SelectKernel<S>();
+   kernel(static_cast<char *>(to), static_cast<const char *>(from), n);
+}
+
+} // anonymous namespace
+
+void ROOT::Internal::ByteSwapCopy16(void *to, const void *from, std::size_t n)
+{
+   Swap<2>(to, from, n);
+}
+
+void ROOT::Internal::ByteSwapCopy32(void *to, const void *from, std::size_t n)
+{
+   Swap<4>(to, from, n);
+}
+
+void ROOT::Internal::ByteSwapCopy64(void *to, const void *from, std::size_t n)
+{
+   Swap<8>(to, from, n);
+}
@@ -0,0 +1,35 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Byte swapping copies of arrays of 2, 4 and 8 byte values, used by TBufferFile to convert arrays of basic types
+// from and to the network byte order of the ROOT files. They use SIMD instructions when available: SSSE3 or AVX2,
+// selected at run time, on x86_64 and NEON on aarch64.
+// This header is private: it is not installed.
+
+#ifndef ROOT_RByteSwap
+#define ROOT_RByteSwap
+
+#include <cstddef>
+
+namespace ROOT {
+namespace Internal {
+
+/// Copy n values of 2 bytes from `from` to `to`, reversing the bytes of each. The buffers do not need to be aligned
+/// but must not overlap.
+void ByteSwapCopy16(void *to, const void *from, std::size_t n);
+/// Copy n values of 4 bytes from `from` to `to`, reversing the bytes of each.
+void ByteSwapCopy32(void *to, const void *from, std::size_t n);
+/// Copy n values of 8 bytes from `from` to `to`, reversing the bytes of each.
+void ByteSwapCopy64(void *to, const void *from, std::size_t n);
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,127 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RFileWriteBehind.hxx"
+
+#include <cerrno>
+
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
+namespace {
+
+/// Contiguous writes are merged into chunks up to this size, so that the disk sees few large writes.
+const std::size_t kMaxChunkSize = 4 * 1024 * 1024;
+
+/// Write all the bytes at the offset, without moving the file position used by the reads of the TFile.
+/// Return 0 or the errno of the failure.
+int WriteAt(int fd, const char *buf, std::size_t len, Long64_t offset)
+{
+#ifndef WIN32
+   while (len > 0) {
+      const ssize_t siz = ::pwrite(fd, buf, len, offset);
+      if (siz < 0) {
+         if (errno == EINTR)
+            continue;
+         return errno;
+      }
+      if (siz == 0)
+         return EIO;
+      buf += siz;
+      len -= siz;
+      offset += siz;
+   }
+   return 0;
+#else
+   (void)fd;
+   (void)buf;
+   (void)len;
+   (void)offset;
+   return ENOSYS;
+#endif
+}
+
+} // anonymous namespace
+
+ROOT::Internal::RFileWriteBehind::RFileWriteBehind(int fd, std::size_t maxQueued)
+   : fFd(fd), fMaxQueued(maxQueued), fThread(&RFileWriteBehind::Run, this)
+{
+}
+
+ROOT::Internal::RFileWriteBehind::~RFileWriteBehind()
+{
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStop = kTRUE;
+   }
+   fHasWork.notify_one();
+   fThread.join();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Body of the I/O thread: write the chunks in the order they were queued.
+
+void ROOT::Internal::RFileWriteBehind::Run()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   while (true) {
+      fHasWork.wait(lock, [this] { return fStop || !fChunks.empty(); });
+      if (fChunks.empty())
+         return; // fStop is set and everything is written
+      RChunk chunk = std::move(fChunks.front());
+      fChunks.pop_front();
+      lock.unlock();
+      const int error = WriteAt(fFd, chunk.fData.data(), chunk.fData.size(), chunk.fOffset);
+      lock.lock();
+      if (error && !fError)
+         fError = error;
+      fQueued -= chunk.fData.size();
+      fProgress.notify_all();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Queue a copy of the buffer to be written at the offset, waiting first if
+/// the queue is full. The write is merged with the previous one if they are
+/// contiguous and the latter is not yet being written.
+/// Return 0 or the errno of a previous write that failed.
+
+int ROOT::Internal::RFileWriteBehind::Write(const char *buf, std::size_t len, Long64_t offset)
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   // A buffer larger than the queue is accepted once the queue is empty.
+   fProgress.wait(lock, [this, len] { return fError || fQueued == 0 || fQueued + len <= fMaxQueued; });
+   if (fError)
+      return fError;
+   fQueued += len;
+   if (!fChunks.empty()) {
+      auto &last = fChunks.back();
+      if (last.fOffset + (Long64_t)last.fData.size() == offset && last.fData.size() + len <= kMaxChunkSize) {
+         last.fData.insert(last.fData.end(), buf, buf + len);
+         return 0;
+      }
+   }
+   fChunks.push_back(RChunk{offset, std::vector<char>(buf, buf + len)});
+   lock.unlock();
+   fHasWork.notify_one();
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until all the queued buffers are written.
+/// Return 0 or the errno of a write that failed.
+
+int ROOT::Internal::RFileWriteBehind::Wait()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   fProgress.wait(lock, [this] { return fQueued == 0; });
+   return fError;
+}
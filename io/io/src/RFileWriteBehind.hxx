@@ -0,0 +1,64 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Write-behind queue of a TFile: the buffers written to the file are copied into a bounded queue and written by a
+// dedicated thread, so that the writer does not wait for the disk.
+// This header is private: it is not installed.
+
+#ifndef ROOT_RFileWriteBehind
+#define ROOT_RFileWriteBehind
+
+#include "RtypesCore.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+class RFileWriteBehind {
+   /// Data to write at a given offset of the file
+   struct RChunk {
+      Long64_t fOffset;
+      std::vector<char> fData;
+   };
+
+   const int fFd;                  ///< File descriptor, not owned
+   const std::size_t fMaxQueued;   ///< Number of bytes that can be queued before Write() blocks
+   std::size_t fQueued = 0;        ///< Number of bytes queued or being written
+   std::deque<RChunk> fChunks;     ///< Chunks not yet taken by the I/O thread
+   Bool_t fStop = kFALSE;          ///< Set by the destructor to end the I/O thread
+   int fError = 0;                 ///< errno of the first failed write, if any
+   std::mutex fMutex;
+   std::condition_variable fHasWork;  ///< Notified when a chunk is queued or fStop is set
+   std::condition_variable fProgress; ///< Notified when a chunk has been written
+   std::thread fThread;
+
+   void Run();
+
+public:
+   RFileWriteBehind(int fd, std::size_t maxQueued);
+   RFileWriteBehind(const RFileWriteBehind &) = delete;
+   RFileWriteBehind &operator=(const RFileWriteBehind &) = delete;
+   /// Write what is queued and end the I/O thread.
+   ~RFileWriteBehind();
+
+   int Write(const char *buf, std::size_t len, Long64_t offset);
+   int Wait();
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,188 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RKeyIndex.hxx"
+
+#include "Bytes.h"
+#include "TError.h"
+#include "TKey.h"
+#include "TString.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+/// Same as in TKey.cxx: the highest 16 bits of the directory location hold the TProcessID offset of the key.
+const ULong64_t kPidOffsetMask = 0xffffffffffffULL;
+
+/// The fields of a key header needed to find the key, pointing into the keys record
+struct RKeyHeader {
+   Short_t fCycle;
+   Long64_t fSeekKey;
+   Long64_t fSeekPdir;
+   const char *fClassName;
+   Int_t fClassNameLen;
+   const char *fName;
+   Int_t fNameLen;
+};
+
+/// Read a string written by TString::FillBuffer. Return false if it does not fit before end.
+bool ReadString(char *&buffer, const char *end, const char *&str, Int_t &len)
+{
+   if (buffer >= end)
+      return false;
+   UChar_t nwh;
+   frombuf(buffer, &nwh);
+   if (nwh == 255) {
+      if (end - buffer < (Long64_t)sizeof(Int_t))
+         return false;
+      frombuf(buffer, &len);
+   } else {
+      len = nwh;
+   }
+   if (len < 0 || end - buffer < len)
+      return false;
+   str = buffer;
+   buffer += len;
+   return true;
+}
+
+/// Decode the key header at buffer, like TKey::ReadKeyBuffer, and move buffer after it.
+/// Return false if the header does not fit before end.
+bool ReadKeyHeader(char *&buffer, const char *end, RKeyHeader &header)
+{
+   // Nbytes, Version, ObjLen, Datime, KeyLen, Cycle
+   const Long64_t fixed = sizeof(Int_t) + sizeof(Version_t) + sizeof(Int_t) + sizeof(UInt_t) + 2 * sizeof(Short_t);
+   if (end - buffer < fixed + 2 * (Long64_t)sizeof(UInt_t))
+      return false;
+   Int_t nbytes;
+   Version_t version;
+   frombuf(buffer, &nbytes);
+   frombuf(buffer, &version);
+   buffer += sizeof(Int_t) + sizeof(UInt_t) + sizeof(Short_t); // ObjLen, Datime, KeyLen
+   frombuf(buffer, &header.fCycle);
+   if (version > 1000) {
+      if (end - buffer < 2 * (Long64_t)sizeof(Long64_t))
+         return false;
+      Long64_t pdir;
+      frombuf(buffer, &header.fSeekKey);
+      frombuf(buffer, &pdir);
+      header.fSeekPdir = pdir & kPidOffsetMask;
+   } else {
+      UInt_t seekkey, seekdir;
+      frombuf(buffer, &seekkey);
+      frombuf(buffer, &seekdir);
+      header.fSeekKey = seekkey;
+      header.fSeekPdir = seekdir;
+   }
+   const char *title;
+   Int_t titleLen;
+   return ReadString(buffer, end, header.fClassName, header.fClassNameLen) &&
+          ReadString(buffer, end, header.fName, header.fNameLen) && ReadString(buffer, end, title, titleLen);
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Index the nkeys key headers of the keys record of a directory, as read by
+/// TDirectoryFile::ReadKeys after the number of keys.
+/// Like TDirectoryFile::ReadKeys, stop at the first key that does not point
+/// into the file.
+
+ROOT::Internal::RKeyIndex::RKeyIndex(std::vector<char> &&buffer, Int_t nkeys, Long64_t fileSize)
+   : fBuffer(std::move(buffer))
+{
+   fOffset.reserve(nkeys);
+   fSorted.reserve(nkeys);
+   char *cursor = fBuffer.data();
+   const char *end = fBuffer.data() + fBuffer.size();
+   for (Int_t i = 0; i < nkeys; i++) {
+      const UInt_t offset = cursor - fBuffer.data();
+      RKeyHeader header;
+      if (!ReadKeyHeader(cursor, end, header) || header.fSeekKey < 64 || header.fSeekKey > fileSize ||
+          header.fSeekPdir < 64 || header.fSeekPdir > fileSize) {
+         ::Error("TDirectoryFile::ReadKeys", "reading illegal key, exiting after %d keys", i);
+         break;
+      }
+      fSorted.push_back({TString::Hash(header.fName, header.fNameLen), (UInt_t)fOffset.size()});
+      fOffset.push_back(offset);
+   }
+   fKeys.assign(fOffset.size(), nullptr);
+   std::stable_sort(fSorted.begin(), fSorted.end(),
+                    [](const REntry &a, const REntry &b) { return a.fHash < b.fHash; });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the TKey of the i-th key of the record, and keep track of it.
+
+void ROOT::Internal::RKeyIndex::ReadKey(TKey *key, Int_t i)
+{
+   char *buffer = fBuffer.data() + fOffset[i];
+   key->ReadKeyBuffer(buffer);
+   fKeys[i] = key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the position in the record of the first key with this name whose
+/// cycle is cycle (exactCycle) or not larger than cycle, or -1 if there is none.
+/// A cycle of 9999 selects the first key with this name, which has the
+/// highest cycle.
+
+Int_t ROOT::Internal::RKeyIndex::FindKey(const char *name, Short_t cycle, Bool_t exactCycle) const
+{
+   const Int_t len = strlen(name);
+   const UInt_t hash = TString::Hash(name, len);
+   auto range = std::equal_range(fSorted.begin(), fSorted.end(), REntry{hash, 0},
+                                 [](const REntry &a, const REntry &b) { return a.fHash < b.fHash; });
+   for (auto it = range.first; it != range.second; ++it) {
+      char *buffer = const_cast<char *>(GetHeader(it->fKey));
+      RKeyHeader header;
+      ReadKeyHeader(buffer, fBuffer.data() + fBuffer.size(), header);
+      if (header.fNameLen != len || strncmp(header.fName, name, len))
+         continue;
+      if (cycle == 9999 || (exactCycle ? cycle == header.fCycle : cycle >= header.fCycle))
+         return it->fKey;
+   }
+   return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop tracking a TKey that is being deleted.
+
+void ROOT::Internal::RKeyIndex::ForgetKey(const TKey *key)
+{
+   const UInt_t hash = TString::Hash(key->GetName(), strlen(key->GetName()));
+   auto range = std::equal_range(fSorted.begin(), fSorted.end(), REntry{hash, 0},
+                                 [](const REntry &a, const REntry &b) { return a.fHash < b.fHash; });
+   for (auto it = range.first; it != range.second; ++it) {
+      if (fKeys[it->fKey] == key) {
+         fKeys[it->fKey] = nullptr;
+         return;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of keys of objects of this class, without creating their TKey.
+
+Int_t ROOT::Internal::RKeyIndex::CountKeys(const char *classname) const
+{
+   const Int_t len = strlen(classname);
+   Int_t n = 0;
+   for (UInt_t i = 0; i < fOffset.size(); i++) {
+      char *buffer = const_cast<char *>(GetHeader(i));
+      RKeyHeader header;
+      ReadKeyHeader(buffer, fBuffer.data() + fBuffer.size(), header);
+      if (header.fClassNameLen == len && !strncmp(header.fClassName, classname, len))
+         n++;
+   }
+   return n;
+}
@@ -0,0 +1,56 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Index of the keys record of a directory, used by TDirectoryFile to create the TKeys on demand.
+// This header is private: it is not installed.
+
+#ifndef ROOT_RKeyIndex
+#define ROOT_RKeyIndex
+
+#include "RtypesCore.h"
+
+#include <vector>
+
+class TKey;
+
+namespace ROOT {
+namespace Internal {
+
+class RKeyIndex {
+   /// Position of a key header in the keys record, sorted by the hash of the key name
+   struct REntry {
+      UInt_t fHash;
+      UInt_t fKey; ///< Index of the key in the keys record
+   };
+
+   std::vector<char> fBuffer;   ///< The keys record, after the number of keys
+   std::vector<UInt_t> fOffset; ///< Offset in fBuffer of the header of each key
+   std::vector<TKey *> fKeys;   ///< The TKey of each key, if already created
+   std::vector<REntry> fSorted; ///< The keys sorted by hash, then by position in the record
+
+   const char *GetHeader(UInt_t i) const { return fBuffer.data() + fOffset[i]; }
+
+public:
+   RKeyIndex(std::vector<char> &&buffer, Int_t nkeys, Long64_t fileSize);
+
+   /// Return the number of keys, which might be fewer than the number in the record if one of them is invalid.
+   Int_t GetN() const { return fOffset.size(); }
+   /// Return the TKey of the i-th key of the record, or nullptr if it was not created yet.
+   TKey *GetKey(Int_t i) const { return fKeys[i]; }
+   void ReadKey(TKey *key, Int_t i);
+   Int_t FindKey(const char *name, Short_t cycle, Bool_t exactCycle) const;
+   void ForgetKey(const TKey *key);
+   Int_t CountKeys(const char *classname) const;
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
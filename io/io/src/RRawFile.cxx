@@ -11,12 +11,14 @@
 
 #include <ROOT/RConfig.h>
 #include <ROOT/RRawFile.hxx>
+#include <ROOT/RRawFileDiskCache.hxx>
 #ifdef _WIN32
 #include <ROOT/RRawFileWin.hxx>
 #else
 #include <ROOT/RRawFileUnix.hxx>
 #endif
 
+#include "TEnv.h"
 #include "TError.h"
 #include "TPluginManager.h"
 #include "TROOT.h"
@@ -27,8 +29,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <future>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace {
 const char *kTransportSeparator = "://";
@@ -80,14 +85,22 @@ ROOT::Internal::RRawFile::Create(std::string_view url, ROptions options)
       return std::unique_ptr<RRawFile>(new RRawFileUnix(url, options));
 #endif
    }
-   if (transport == "http" || transport == "https") {
-      if (TPluginHandler *h = gROOT->GetPluginManager()->FindHandler("ROOT::Internal::RRawFile")) {
-         if (h->LoadPlugin() == 0) {
-            return std::unique_ptr<RRawFile>(reinterpret_cast<RRawFile *>(h->ExecPlugin(2, &url, &options)));
-         }
-         throw std::runtime_error("Cannot load plugin handler for RRawFileDavix");
-      }
-      throw std::runtime_error("Cannot find plugin handler for RRawFileDavix");
+   if (transport == "http" || transport == "https" || transport == "root" || transport == "roots" ||
+       transport == "xroot") {
+      const std::string pluginName = (transport[0] == 'h') ? "RRawFileDavix" : "RRawFileNetXNG";
+      TPluginHandler *h = gROOT->GetPluginManager()->FindHandler("ROOT::Internal::RRawFile", std::string(url).c_str());
+      if (!h)
+         throw std::runtime_error("Cannot find plugin handler for " + pluginName);
+      if (h->LoadPlugin() != 0)
+         throw std::runtime_error("Cannot load plugin handler for " + pluginName);
+      std::unique_ptr<RRawFile> remote(reinterpret_cast<RRawFile *>(h->ExecPlugin(2, &url, &options)));
+
+      std::string cacheDir = options.fCacheDir;
+      if (cacheDir.empty())
+         cacheDir = gEnv->GetValue("RRawFile.CacheDir", "");
+      if (cacheDir.empty())
+         return remote;
+      return std::unique_ptr<RRawFile>(new RRawFileDiskCache(std::move(remote), cacheDir, options));
    }
    throw std::runtime_error("Unsupported transport protocol: " + transport);
 }
@@ -105,6 +118,12 @@ void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    }
 }
 
+std::future<void> ROOT::Internal::RRawFile::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   std::shared_ptr<RRawFile> clone = Clone();
+   return std::async(std::launch::async, [clone, ioVec, nReq]() { clone->ReadV(ioVec, nReq); });
+}
+
 void ROOT::Internal::RRawFile::UnmapImpl(void * /* region */, size_t /* nbytes */)
 {
    throw std::runtime_error("Memory mapping unsupported");
@@ -208,6 +227,14 @@ void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
    ReadVImpl(ioVec, nReq);
 }
 
+std::future<void> ROOT::Internal::RRawFile::ReadVAsync(RIOVec *ioVec, unsigned int nReq)
+{
+   if (!fIsOpen)
+      OpenImpl();
+   fIsOpen = true;
+   return ReadVAsyncImpl(ioVec, nReq);
+}
+
 bool ROOT::Internal::RRawFile::Readln(std::string &line)
 {
    if (fOptions.fLineBreak == ELineBreaks::kAuto) {
@@ -0,0 +1,189 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RRawFileDiskCache.hxx"
+#include "ROOT/RMakeUnique.hxx"
+
+#include "TSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+constexpr int kDefaultBlockSize = 128 * 1024; // Buffer small reads in the same 128k blocks as for remote files
+
+/// The name of the cache subdirectory of a file: a 64 bit FNV-1a hash of the url, which is stable across processes
+std::string HashUrl(const std::string &url)
+{
+   std::uint64_t hash = 14695981039346656037ULL;
+   for (unsigned char c : url) {
+      hash ^= c;
+      hash *= 1099511628211ULL;
+   }
+   char hex[17];
+   snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+   return hex;
+}
+} // anonymous namespace
+
+constexpr std::size_t ROOT::Internal::RRawFileDiskCache::kCacheBlockSize;
+
+ROOT::Internal::RRawFileDiskCache::RRawFileDiskCache(std::unique_ptr<RRawFile> remote, std::string_view cacheDir,
+                                                     ROptions options)
+   : RRawFile(remote->GetUrl(), options), fRemote(std::move(remote)), fCacheDir(cacheDir)
+{
+}
+
+ROOT::Internal::RRawFileDiskCache::~RRawFileDiskCache()
+{
+}
+
+std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileDiskCache::Clone() const
+{
+   return std::make_unique<RRawFileDiskCache>(fRemote->Clone(), fCacheDir, fOptions);
+}
+
+std::string ROOT::Internal::RRawFileDiskCache::GetBlockPath(std::uint64_t block) const
+{
+   return fBlockDir + "/" + std::to_string(block);
+}
+
+std::uint64_t ROOT::Internal::RRawFileDiskCache::GetSizeImpl()
+{
+   return fRemote->GetSize();
+}
+
+void ROOT::Internal::RRawFileDiskCache::OpenImpl()
+{
+   const auto size = fRemote->GetSize();
+   if (size != kUnknownFileSize && !fCacheDir.empty()) {
+      // The size is part of the key, so that the blocks of a file that was rewritten are not used
+      fBlockDir = fCacheDir + "/" + HashUrl(fUrl) + "-" + std::to_string(size);
+      // Fails if the directory exists already, possibly created by another process
+      gSystem->mkdir(fBlockDir.c_str(), kTRUE);
+   }
+   if (fOptions.fBlockSize < 0)
+      fOptions.fBlockSize = kDefaultBlockSize;
+}
+
+bool ROOT::Internal::RRawFileDiskCache::ReadCachedBlock(std::uint64_t block, std::size_t offsetInBlock, void *buffer,
+                                                        std::size_t nbytes) const
+{
+   std::ifstream istrm(GetBlockPath(block), std::ios::binary | std::ios::in);
+   if (!istrm)
+      return false;
+   istrm.seekg(offsetInBlock);
+   istrm.read(reinterpret_cast<char *>(buffer), nbytes);
+   return static_cast<std::size_t>(istrm.gcount()) == nbytes;
+}
+
+void ROOT::Internal::RRawFileDiskCache::StoreBlock(std::uint64_t block, const unsigned char *buffer,
+                                                   std::size_t nbytes) const
+{
+   // Readers only ever see complete blocks: the block is renamed into place once written. The temporary name is
+   // unique across the processes and the threads that fill the same cache directory.
+   static std::atomic<unsigned int> gNTmpFiles{0};
+   const auto path = GetBlockPath(block);
+   const auto tmpPath = path + ".tmp" + std::to_string(gSystem->GetPid()) + "." + std::to_string(gNTmpFiles++);
+   {
+      std::ofstream ostrm(tmpPath, std::ios::binary | std::ios::out | std::ios::trunc);
+      ostrm.write(reinterpret_cast<const char *>(buffer), nbytes);
+      ostrm.close();
+      if (!ostrm) {
+         gSystem->Unlink(tmpPath.c_str());
+         return;
+      }
+   }
+   if (gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0)
+      gSystem->Unlink(tmpPath.c_str());
+}
+
+size_t ROOT::Internal::RRawFileDiskCache::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
+{
+   RIOVec ioVec;
+   ioVec.fBuffer = buffer;
+   ioVec.fOffset = offset;
+   ioVec.fSize = nbytes;
+   ReadVImpl(&ioVec, 1);
+   return ioVec.fOutBytes;
+}
+
+void ROOT::Internal::RRawFileDiskCache::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   if (fBlockDir.empty()) {
+      fRemote->ReadV(ioVec, nReq);
+      return;
+   }
+
+   const auto size = GetSize();
+   std::vector<std::uint64_t> missing;
+   for (unsigned int i = 0; i < nReq; ++i) {
+      if (ioVec[i].fOffset >= size)
+         continue;
+      const auto end = std::min<std::uint64_t>(size, ioVec[i].fOffset + ioVec[i].fSize);
+      for (auto block = ioVec[i].fOffset / kCacheBlockSize; block * kCacheBlockSize < end; ++block) {
+         if (gSystem->AccessPathName(GetBlockPath(block).c_str()))
+            missing.emplace_back(block);
+      }
+   }
+   std::sort(missing.begin(), missing.end());
+   missing.erase(std::unique(missing.begin(), missing.end()), missing.end());
+
+   // All the missing blocks come with a single vector read of the remote file
+   std::unique_ptr<unsigned char[]> fetched(new unsigned char[missing.size() * kCacheBlockSize]);
+   std::vector<RIOVec> fetchVec(missing.size());
+   for (std::size_t j = 0; j < missing.size(); ++j) {
+      fetchVec[j].fBuffer = fetched.get() + j * kCacheBlockSize;
+      fetchVec[j].fOffset = missing[j] * kCacheBlockSize;
+      fetchVec[j].fSize = std::min<std::uint64_t>(kCacheBlockSize, size - fetchVec[j].fOffset);
+   }
+   if (!fetchVec.empty())
+      fRemote->ReadV(fetchVec.data(), fetchVec.size());
+   for (std::size_t j = 0; j < missing.size(); ++j) {
+      // A short block means that the file changed since it was opened: it is not stored
+      if (fetchVec[j].fOutBytes == fetchVec[j].fSize)
+         StoreBlock(missing[j], fetched.get() + j * kCacheBlockSize, fetchVec[j].fOutBytes);
+   }
+
+   for (unsigned int i = 0; i < nReq; ++i) {
+      ioVec[i].fOutBytes = 0;
+      if (ioVec[i].fOffset >= size)
+         continue;
+      const auto end = std::min<std::uint64_t>(size, ioVec[i].fOffset + ioVec[i].fSize);
+      auto buffer = reinterpret_cast<unsigned char *>(ioVec[i].fBuffer);
+      std::uint64_t pos = ioVec[i].fOffset;
+      while (pos < end) {
+         const auto block = pos / kCacheBlockSize;
+         const std::size_t offsetInBlock = pos - block * kCacheBlockSize;
+         const std::size_t nbytes = std::min<std::uint64_t>(end, (block + 1) * kCacheBlockSize) - pos;
+         std::size_t nread = nbytes;
+         const auto itrMissing = std::lower_bound(missing.begin(), missing.end(), block);
+         if (itrMissing != missing.end() && *itrMissing == block) {
+            const auto &fetchedBlock = fetchVec[itrMissing - missing.begin()];
+            nread = std::min(nbytes, fetchedBlock.fOutBytes - std::min(fetchedBlock.fOutBytes, offsetInBlock));
+            memcpy(buffer, reinterpret_cast<unsigned char *>(fetchedBlock.fBuffer) + offsetInBlock, nread);
+         } else if (!ReadCachedBlock(block, offsetInBlock, buffer, nbytes)) {
+            // The block was removed from the cache in the meantime
+            nread = fRemote->ReadAt(buffer, nbytes, pos);
+         }
+         ioVec[i].fOutBytes += nread;
+         if (nread < nbytes)
+            break;
+         buffer += nread;
+         pos += nread;
+      }
+   }
+}
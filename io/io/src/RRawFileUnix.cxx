@@ -14,19 +14,158 @@
 
 #include "TError.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
+#include <future>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#ifdef R__HAS_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
 namespace {
 constexpr int kDefaultBlockSize = 4096; // If fstat() does not provide a block size hint, use this value instead
+
+#ifdef R__HAS_IO_URING
+constexpr unsigned int kMaxRingEntries = 128; // Larger vector reads are submitted in batches of this size
+
+/**
+ * A minimal io_uring instance, set up for the duration of a single vector read. It uses the raw system calls, so that
+ * no additional library is required. If the kernel does not provide io_uring (or it is forbidden, e.g. by seccomp
+ * in containers), IsValid() returns false and the caller falls back to pread.
+ */
+class RIoUring {
+private:
+   int fRingFd = -1;
+   unsigned int fNEntries = 0;
+   void *fSqRing = MAP_FAILED;
+   size_t fSqRingSize = 0;
+   void *fCqRing = MAP_FAILED;
+   size_t fCqRingSize = 0;
+   void *fSqes = MAP_FAILED;
+   size_t fSqesSize = 0;
+
+   unsigned *fSqTail = nullptr;
+   unsigned *fSqMask = nullptr;
+   unsigned *fSqArray = nullptr;
+   unsigned *fCqHead = nullptr;
+   unsigned *fCqTail = nullptr;
+   unsigned *fCqMask = nullptr;
+   io_uring_cqe *fCqes = nullptr;
+
+   void Release()
+   {
+      if (fSqes != MAP_FAILED)
+         munmap(fSqes, fSqesSize);
+      if (fCqRing != MAP_FAILED)
+         munmap(fCqRing, fCqRingSize);
+      if (fSqRing != MAP_FAILED)
+         munmap(fSqRing, fSqRingSize);
+      if (fRingFd >= 0)
+         close(fRingFd);
+      fSqes = fCqRing = fSqRing = MAP_FAILED;
+      fRingFd = -1;
+   }
+
+public:
+   explicit RIoUring(unsigned int nEntries)
+   {
+      io_uring_params params;
+      memset(&params, 0, sizeof(params));
+      fRingFd = syscall(__NR_io_uring_setup, nEntries, &params);
+      if (fRingFd < 0)
+         return;
+      fNEntries = params.sq_entries;
+
+      fSqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+      fCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+      fSqesSize = params.sq_entries * sizeof(io_uring_sqe);
+      fSqRing = mmap(nullptr, fSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fRingFd,
+                     IORING_OFF_SQ_RING);
+      fCqRing = mmap(nullptr, fCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fRingFd,
+                     IORING_OFF_CQ_RING);
+      fSqes = mmap(nullptr, fSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fRingFd, IORING_OFF_SQES);
+      if (fSqRing == MAP_FAILED || fCqRing == MAP_FAILED || fSqes == MAP_FAILED) {
+         Release();
+         return;
+      }
+
+      auto sqRing = reinterpret_cast<unsigned char *>(fSqRing);
+      fSqTail = reinterpret_cast<unsigned *>(sqRing + params.sq_off.tail);
+      fSqMask = reinterpret_cast<unsigned *>(sqRing + params.sq_off.ring_mask);
+      fSqArray = reinterpret_cast<unsigned *>(sqRing + params.sq_off.array);
+      auto cqRing = reinterpret_cast<unsigned char *>(fCqRing);
+      fCqHead = reinterpret_cast<unsigned *>(cqRing + params.cq_off.head);
+      fCqTail = reinterpret_cast<unsigned *>(cqRing + params.cq_off.tail);
+      fCqMask = reinterpret_cast<unsigned *>(cqRing + params.cq_off.ring_mask);
+      fCqes = reinterpret_cast<io_uring_cqe *>(cqRing + params.cq_off.cqes);
+   }
+   RIoUring(const RIoUring &) = delete;
+   RIoUring &operator=(const RIoUring &) = delete;
+   ~RIoUring() { Release(); }
+
+   bool IsValid() const { return fRingFd >= 0; }
+   unsigned int GetNEntries() const { return fNEntries; }
+
+   /// Submits the nReq reads (at most GetNEntries()) at once and waits for all of them to complete. For every
+   /// request i, result(i, res) is called with the number of bytes read or with the negated errno value.
+   /// Returns false if the ring cannot be used, before any read was completed.
+   template <typename ResultT>
+   bool Read(int fd, const iovec *iov, const std::uint64_t *offsets, unsigned int nReq, ResultT result)
+   {
+      auto sqes = reinterpret_cast<io_uring_sqe *>(fSqes);
+      unsigned tail = *fSqTail;
+      for (unsigned int i = 0; i < nReq; ++i, ++tail) {
+         const unsigned idx = tail & *fSqMask;
+         io_uring_sqe *sqe = &sqes[idx];
+         memset(sqe, 0, sizeof(*sqe));
+         sqe->opcode = IORING_OP_READV;
+         sqe->fd = fd;
+         sqe->addr = reinterpret_cast<std::uint64_t>(&iov[i]);
+         sqe->len = 1;
+         sqe->off = offsets[i];
+         sqe->user_data = i;
+         fSqArray[idx] = idx;
+      }
+      __atomic_store_n(fSqTail, tail, __ATOMIC_RELEASE);
+
+      unsigned int nSubmit = nReq;
+      unsigned int nCompleted = 0;
+      while (nCompleted < nReq) {
+         int res = syscall(__NR_io_uring_enter, fRingFd, nSubmit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+         if (res < 0) {
+            if (errno == EINTR)
+               continue;
+            // Nothing was submitted by the first call: the caller can still read the batch by other means
+            if (nSubmit == nReq && nCompleted == 0)
+               return false;
+            throw std::runtime_error("Cannot wait for io_uring reads, error: " + std::string(strerror(errno)));
+         }
+         nSubmit -= std::min(nSubmit, static_cast<unsigned int>(res));
+
+         unsigned head = *fCqHead;
+         const unsigned cqTail = __atomic_load_n(fCqTail, __ATOMIC_ACQUIRE);
+         for (; head != cqTail; ++head, ++nCompleted) {
+            const io_uring_cqe *cqe = &fCqes[head & *fCqMask];
+            result(static_cast<unsigned int>(cqe->user_data), cqe->res);
+         }
+         __atomic_store_n(fCqHead, head, __ATOMIC_RELEASE);
+      }
+      return true;
+   }
+};
+#endif
 } // anonymous namespace
 
 ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions options)
@@ -109,6 +248,67 @@ size_t ROOT::Internal::RRawFileUnix::ReadAtImpl(void *buffer, size_t nbytes, std
    return total_bytes;
 }
 
+void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   unsigned int nDone = 0;
+#ifdef R__HAS_IO_URING
+   if (nReq > 1) {
+      RIoUring ring(std::min(nReq, kMaxRingEntries));
+      if (ring.IsValid()) {
+         const unsigned int nBatch = std::min(nReq, ring.GetNEntries());
+         std::vector<iovec> iov(nBatch);
+         std::vector<std::uint64_t> offsets(nBatch);
+         // The first error is only reported once all the reads of the batch completed, because the kernel
+         // keeps writing into the buffers of the pending ones
+         int error = 0;
+         while (nDone < nReq) {
+            RIOVec *batch = ioVec + nDone;
+            const unsigned int n = std::min(nBatch, nReq - nDone);
+            for (unsigned int i = 0; i < n; ++i) {
+               iov[i].iov_base = batch[i].fBuffer;
+               iov[i].iov_len = batch[i].fSize;
+               offsets[i] = batch[i].fOffset;
+            }
+            auto fnResult = [&](unsigned int i, int res) {
+               if (res >= 0) {
+                  batch[i].fOutBytes = res;
+               } else if (res == -EINTR || res == -EAGAIN) {
+                  batch[i].fOutBytes = 0;
+               } else {
+                  if (error == 0)
+                     error = -res;
+                  return;
+               }
+               // As for pread, short reads are only expected at the end of the file; complete the others
+               if (batch[i].fOutBytes > 0 && batch[i].fOutBytes < batch[i].fSize) {
+                  batch[i].fOutBytes += ReadAtImpl(reinterpret_cast<unsigned char *>(batch[i].fBuffer) +
+                                                      batch[i].fOutBytes,
+                                                   batch[i].fSize - batch[i].fOutBytes,
+                                                   batch[i].fOffset + batch[i].fOutBytes);
+               } else if (res < 0) {
+                  batch[i].fOutBytes = ReadAtImpl(batch[i].fBuffer, batch[i].fSize, batch[i].fOffset);
+               }
+            };
+            if (!ring.Read(fFileDes, iov.data(), offsets.data(), n, fnResult))
+               break;
+            if (error != 0)
+               throw std::runtime_error("Cannot read from '" + fUrl + "', error: " + std::string(strerror(error)));
+            nDone += n;
+         }
+      }
+   }
+#endif
+   // Unbuffered reads, so that vector reads can run concurrently to the buffered ones of this file
+   for (unsigned int i = nDone; i < nReq; ++i)
+      ioVec[i].fOutBytes = ReadAtImpl(ioVec[i].fBuffer, ioVec[i].fSize, ioVec[i].fOffset);
+}
+
+std::future<void> ROOT::Internal::RRawFileUnix::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   // ReadVImpl only uses pread and a private io_uring instance on the shared file descriptor
+   return std::async(std::launch::async, [this, ioVec, nReq]() { ReadVImpl(ioVec, nReq); });
+}
+
 void ROOT::Internal::RRawFileUnix::UnmapImpl(void *region, size_t nbytes)
 {
    int rv = munmap(region, nbytes);
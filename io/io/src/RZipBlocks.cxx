@@ -0,0 +1,114 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RZipBlocks.hxx"
+
+#include "RZip.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+/// Size of the header of each compressed block, see R__unzip_header.
+const Int_t kBlockHeaderSize = 9;
+
+/// Run f(i) for i in [0, n), concurrently if there are several blocks and implicit multi-threading is enabled.
+template <typename F>
+void ForEachBlock(Int_t n, F &&f)
+{
+#ifdef R__USE_IMT
+   if (n > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&f](std::size_t i) { f(static_cast<Int_t>(i)); }, ROOT::TSeq<std::size_t>(n));
+      return;
+   }
+#endif
+   for (Int_t i = 0; i < n; ++i)
+      f(i);
+}
+
+} // anonymous namespace
+
+Int_t ROOT::Internal::ZipBlocks(Int_t cxlevel, ROOT::RCompressionSetting::EAlgorithm::EValues algorithm, char *src,
+                                Int_t srcsize, char *tgt, const char *dict, Int_t dictsize)
+{
+   if (srcsize <= 0)
+      return 0;
+   const Int_t nblocks = 1 + (srcsize - 1) / kMAXZIPBUF;
+
+   // Each block is compressed at the offset it would have if no block was compressed, which cannot overlap with
+   // the others. The blocks are then moved next to each other.
+   std::vector<Int_t> nouts(nblocks, 0);
+   ForEachBlock(nblocks, [&](Int_t i) {
+      Int_t bufmax = (i == nblocks - 1) ? srcsize - i * kMAXZIPBUF : kMAXZIPBUF;
+      char *block = tgt + static_cast<Long64_t>(i) * (kMAXZIPBUF + kBlockHeaderSize);
+      R__zipMultipleAlgorithmDict(cxlevel, &bufmax, src + static_cast<Long64_t>(i) * kMAXZIPBUF, &bufmax, block,
+                                  &nouts[i], algorithm, dict, dictsize);
+   });
+
+   Int_t noutot = 0;
+   for (Int_t i = 0; i < nblocks; ++i) {
+      // This happens when the buffer cannot be compressed
+      if (nouts[i] == 0 || nouts[i] >= srcsize)
+         return 0;
+      char *block = tgt + static_cast<Long64_t>(i) * (kMAXZIPBUF + kBlockHeaderSize);
+      if (block != tgt + noutot)
+         memmove(tgt + noutot, block, nouts[i]);
+      noutot += nouts[i];
+   }
+   return noutot;
+}
+
+Int_t ROOT::Internal::UnzipBlocks(UChar_t *src, Int_t srcsize, char *tgt, Int_t tgtsize, const char *dict,
+                                  Int_t dictsize)
+{
+   // Locate the blocks from their headers first: they give the compressed and decompressed size of each of them.
+   struct Block {
+      UChar_t *fSrc;
+      Int_t fNin;
+      Int_t fOffset;
+      Int_t fNbuf;
+   };
+   std::vector<Block> blocks;
+   Int_t nintot = 0;
+   Int_t expected = 0;
+   while (expected < tgtsize && nintot + kBlockHeaderSize <= srcsize) {
+      Int_t nin, nbuf;
+      if (R__unzip_header(&nin, src + nintot, &nbuf) != 0)
+         break;
+      if (nin > srcsize - nintot || nbuf > tgtsize - expected)
+         break;
+      blocks.push_back({src + nintot, nin, expected, nbuf});
+      nintot += nin;
+      expected += nbuf;
+   }
+
+   std::vector<Int_t> nouts(blocks.size(), 0);
+   ForEachBlock(blocks.size(), [&](Int_t i) {
+      Block &b = blocks[i];
+      R__unzipDict(&b.fNin, b.fSrc, &b.fNbuf, reinterpret_cast<UChar_t *>(tgt + b.fOffset), &nouts[i], dict,
+                   dictsize);
+   });
+
+   Int_t noutot = 0;
+   for (Int_t nout : nouts) {
+      if (!nout)
+         return 0;
+      noutot += nout;
+   }
+   return noutot;
+}
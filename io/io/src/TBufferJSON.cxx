@@ -92,6 +92,7 @@ class Container {
 
 #include "TBufferJSON.h"
 
+#include <algorithm>
 #include <typeinfo>
 #include <string>
 #include <string.h>
@@ -134,6 +135,51 @@ ClassImp(TBufferJSON);
 
 enum { json_TArray = 100, json_TCollection = -130, json_TString = 110, json_stdstring = 120 };
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append decimal representation of unsigned integer, avoiding snprintf for the long arrays of histograms
+
+void JsonAppendUnsigned(TString &out, ULong64_t value, Bool_t negative = kFALSE)
+{
+   char buf[24];
+   char *end = buf + sizeof(buf), *p = end;
+   do {
+      *--p = '0' + (char)(value % 10);
+      value /= 10;
+   } while (value);
+   if (negative)
+      *--p = '-';
+   out.Append(p, end - p);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append decimal representation of signed integer
+
+void JsonAppendSigned(TString &out, Long64_t value)
+{
+   if (value < 0)
+      JsonAppendUnsigned(out, 0ULL - (ULong64_t)value, kTRUE);
+   else
+      JsonAppendUnsigned(out, (ULong64_t)value);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns start of the object of its actual class, which is assigned to clActual
+
+const void *JsonActualObject(const void *obj, const TClass *cl, TClass *&clActual)
+{
+   clActual = obj ? cl->GetActualClass(obj) : nullptr;
+   if (clActual && (clActual != cl))
+      return (char *)obj - clActual->GetBaseClassOffset(cl);
+   // We could not determine the real type of this object,
+   // let's assume it is the one given by the caller.
+   clActual = const_cast<TClass *>(cl);
+   return obj;
+}
+
+} // anonymous namespace
+
 ///////////////////////////////////////////////////////////////
 // TArrayIndexProducer is used to correctly create
 /// JSON array separators for multi-dimensional JSON arrays
@@ -638,15 +684,8 @@ Bool_t TBufferJSON::IsSkipClassInfo(const TClass *cl) const
 
 TString TBufferJSON::ConvertToJSON(const void *obj, const TClass *cl, Int_t compact, const char *member_name)
 {
-   TClass *clActual = obj ? cl->GetActualClass(obj) : nullptr;
-   const void *actualStart = obj;
-   if (clActual && (clActual != cl)) {
-      actualStart = (char *)obj - clActual->GetBaseClassOffset(cl);
-   } else {
-      // We could not determine the real type of this object,
-      // let's assume it is the one given by the caller.
-      clActual = const_cast<TClass *>(cl);
-   }
+   TClass *clActual = nullptr;
+   const void *actualStart = JsonActualObject(obj, cl, clActual);
 
    if (member_name && actualStart) {
       TRealData *rdata = clActual->GetRealData(member_name);
@@ -716,6 +755,76 @@ TString TBufferJSON::StoreObject(const void *obj, const TClass *cl)
    return fOutBuffer.Length() ? fOutBuffer : fValue;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Store provided object as JSON structure, passing the JSON code to the sink while it is produced
+/// The code is handed over in pieces of about chunksize bytes, so that the complete JSON never has to be
+/// kept in memory, e.g. when sending it over a socket. Returns the total size of the JSON code.
+/// As for the other StoreObject() method, it can be called only once for a TBufferJSON instance
+///
+///   TBufferJSON buf;
+///   buf.SetCompact(TBufferJSON::kNoSpaces + TBufferJSON::kBase64);
+///   std::string json;
+///   buf.StoreObject(obj, TClass::GetClass<UserClass>(),
+///                   [&json](const char *data, Int_t len) { json.append(data, len); });
+///
+
+Long64_t TBufferJSON::StoreObject(const void *obj, const TClass *cl, const OutputSink_t &sink, Int_t chunksize)
+{
+   if (!IsWriting()) {
+      Error("StoreObject", "Can not store object into TBuffer for reading");
+      return 0;
+   }
+
+   fSink = sink;
+   fSinkChunk = chunksize;
+   fSinkBytes = 0;
+
+   InitMap();
+
+   PushStack(); // dummy stack entry to avoid extra checks in the beginning
+
+   JsonWriteObject(obj, cl);
+
+   PopStack();
+
+   // when nothing was written into the main output buffer, the complete json is the value
+   if ((fSinkBytes == 0) && (fOutBuffer.Length() == 0))
+      fOutBuffer = fValue;
+   FlushOutput();
+
+   fSink = nullptr;
+
+   return fSinkBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Converts object into JSON, storing the code directly into the json string
+/// Same as ConvertToJSON() returning TString, but avoids the intermediate copies of the complete JSON code
+/// Returns kTRUE if the produced JSON is not empty
+
+Bool_t TBufferJSON::ConvertToJSON(std::string &json, const void *obj, const TClass *cl, Int_t compact,
+                                  const char *member_name)
+{
+   json.clear();
+
+   if (member_name) {
+      TString res = ConvertToJSON(obj, cl, compact, member_name);
+      json.assign(res.Data(), res.Length());
+      return !json.empty();
+   }
+
+   TClass *clActual = nullptr;
+   const void *actualStart = JsonActualObject(obj, cl, clActual);
+
+   TBufferJSON buf;
+
+   buf.SetCompact(compact);
+
+   buf.StoreObject(actualStart, clActual, [&json](const char *data, Int_t len) { json.append(data, len); });
+
+   return !json.empty();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Converts selected data member into json
 /// Parameter ptr specifies address in memory, where data member is located
@@ -1171,6 +1280,22 @@ void TBufferJSON::AppendOutput(const char *line0, const char *line1)
          fOutput->Append(line1);
       }
    }
+
+   if (fSink && (fOutput == &fOutBuffer) && (fOutBuffer.Length() >= fSinkChunk))
+      FlushOutput();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Pass the content of the main output buffer to the sink, keeping buffer capacity for the following code
+
+void TBufferJSON::FlushOutput()
+{
+   if (!fSink || (fOutBuffer.Length() == 0))
+      return;
+
+   fSink(fOutBuffer.Data(), fOutBuffer.Length());
+   fSinkBytes += fOutBuffer.Length();
+   fOutBuffer.Clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2776,19 +2901,20 @@ R__ALWAYS_INLINE void TBufferJSON::JsonReadFastArray(T *arr, Int_t arrsize, bool
          arr[cnt] = 0;
 
       if (json->count("b") == 1) {
-         auto base64 = json->at("b").get<std::string>();
+         // reference to the string in the document, decoded directly into the target array
+         const auto &base64 = json->at("b").get_ref<const std::string &>();
 
-         int offset = (json->count("o") == 1) ? json->at("o").get<int>() : 0;
+         long offset = (json->count("o") == 1) ? json->at("o").get<int>() : 0;
+         long arrlen = arrsize * (long) sizeof(T);
 
-         // TODO: provide TBase64::Decode with direct write into target buffer
-         auto decode = TBase64::Decode(base64.c_str());
+         Int_t len = ((offset >= 0) && (offset <= arrlen))
+                        ? TBase64::Decode(base64.data(), base64.length(), (char *) arr + offset, arrlen - offset)
+                        : -1;
 
-         if (arrsize * (long) sizeof(T) < (offset + decode.Length())) {
-            Error("ReadFastArray", "Base64 data %ld larger than target array size %ld", (long) decode.Length() + offset, (long) (arrsize*sizeof(T)));
-         } else if ((sizeof(T) > 1) && (decode.Length() % sizeof(T) != 0)) {
-            Error("ReadFastArray", "Base64 data size %ld not matches with element size %ld", (long) decode.Length(), (long) sizeof(T));
-         } else {
-            memcpy((char *) arr + offset, decode.Data(), decode.Length());
+         if (len < 0) {
+            Error("ReadFastArray", "Base64 data %ld larger than target array size %ld", (long) base64.length() / 4 * 3 + offset, arrlen);
+         } else if ((sizeof(T) > 1) && (len % sizeof(T) != 0)) {
+            Error("ReadFastArray", "Base64 data size %ld not matches with element size %ld", (long) len, (long) sizeof(T));
          }
          return;
       }
@@ -2817,8 +2943,11 @@ R__ALWAYS_INLINE void TBufferJSON::JsonReadFastArray(T *arr, Int_t arrsize, bool
    } else {
       if ((int)json->size() != arrsize)
          Error("ReadFastArray", "Mismatch array sizes %d %d", arrsize, (int)json->size());
-      for (int cnt = 0; cnt < arrsize; ++cnt)
-         arr[cnt] = json->at(cnt).get<T>();
+      // iterate the array elements once, without bounds checks of every element
+      int len = std::min(arrsize, (int)json->size());
+      auto iter = json->begin();
+      for (int cnt = 0; cnt < len; ++cnt, ++iter)
+         arr[cnt] = iter->get<T>();
    }
 }
 
@@ -3034,7 +3163,7 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
       fValue.Append("[");
       for (Int_t indx = 0; indx < arrsize; indx++) {
          if (indx > 0)
-            fValue.Append(fArraySepar.Data());
+            fValue.Append(fArraySepar);
          JsonWriteBasic(vname[indx]);
       }
       fValue.Append("]");
@@ -3042,7 +3171,12 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
       fValue.Append("[]");
    } else {
       fValue.Append("{");
-      fValue.Append(TString::Format("\"$arr\":\"%s\"%s\"len\":%d", typname, fArraySepar.Data(), arrsize));
+      fValue.Append("\"$arr\":\"");
+      fValue.Append(typname);
+      fValue.Append("\"");
+      fValue.Append(fArraySepar);
+      fValue.Append("\"len\":");
+      JsonAppendSigned(fValue, arrsize);
       Int_t aindx(0), bindx(arrsize);
       while ((aindx < arrsize) && (vname[aindx] == 0))
          aindx++;
@@ -3054,8 +3188,11 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
          if ((aindx * sizeof(T) < 5) && (aindx < bindx))
             aindx = 0;
 
-         if ((aindx > 0) && (aindx < bindx))
-            fValue.Append(TString::Format("%s\"o\":%ld", fArraySepar.Data(), (long) (aindx * (int) sizeof(T))));
+         if ((aindx > 0) && (aindx < bindx)) {
+            fValue.Append(fArraySepar);
+            fValue.Append("\"o\":");
+            JsonAppendSigned(fValue, aindx * (Long64_t)sizeof(T));
+         }
 
          fValue.Append(fArraySepar);
          fValue.Append("\"b\":\"");
@@ -3103,19 +3240,32 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
                continue;
             if (++suffixcnt > 0)
                suffix.Form("%d", suffixcnt);
-            if (p0 != lastp)
-               fValue.Append(TString::Format("%s\"p%s\":%d", fArraySepar.Data(), suffix.Data(), p0));
+            if (p0 != lastp) {
+               fValue.Append(fArraySepar);
+               fValue.Append("\"p");
+               fValue.Append(suffix);
+               fValue.Append("\":");
+               JsonAppendSigned(fValue, p0);
+            }
             lastp = pp; /* remember cursor, it may be the same */
-            fValue.Append(TString::Format("%s\"v%s\":", fArraySepar.Data(), suffix.Data()));
+            fValue.Append(fArraySepar);
+            fValue.Append("\"v");
+            fValue.Append(suffix);
+            fValue.Append("\":");
             if ((nsame > 1) || (pp - p0 == 1)) {
                JsonWriteBasic(vname[p0]);
-               if (nsame > 1)
-                  fValue.Append(TString::Format("%s\"n%s\":%d", fArraySepar.Data(), suffix.Data(), nsame));
+               if (nsame > 1) {
+                  fValue.Append(fArraySepar);
+                  fValue.Append("\"n");
+                  fValue.Append(suffix);
+                  fValue.Append("\":");
+                  JsonAppendSigned(fValue, nsame);
+               }
             } else {
                fValue.Append("[");
                for (Int_t indx = p0; indx < pp; indx++) {
                   if (indx > p0)
-                     fValue.Append(fArraySepar.Data());
+                     fValue.Append(fArraySepar);
                   JsonWriteBasic(vname[indx]);
                }
                fValue.Append("]");
@@ -3857,9 +4007,7 @@ void TBufferJSON::WriteCharStar(char *s)
 
 void TBufferJSON::JsonWriteBasic(Char_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   JsonAppendSigned(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3867,9 +4015,7 @@ void TBufferJSON::JsonWriteBasic(Char_t value)
 
 void TBufferJSON::JsonWriteBasic(Short_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hd", value);
-   fValue.Append(buf);
+   JsonAppendSigned(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3877,9 +4023,7 @@ void TBufferJSON::JsonWriteBasic(Short_t value)
 
 void TBufferJSON::JsonWriteBasic(Int_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   JsonAppendSigned(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3887,9 +4031,7 @@ void TBufferJSON::JsonWriteBasic(Int_t value)
 
 void TBufferJSON::JsonWriteBasic(Long_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%ld", value);
-   fValue.Append(buf);
+   JsonAppendSigned(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3897,7 +4039,7 @@ void TBufferJSON::JsonWriteBasic(Long_t value)
 
 void TBufferJSON::JsonWriteBasic(Long64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   JsonAppendSigned(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3945,9 +4087,7 @@ void TBufferJSON::JsonWriteBasic(Bool_t value)
 
 void TBufferJSON::JsonWriteBasic(UChar_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   JsonAppendUnsigned(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3955,9 +4095,7 @@ void TBufferJSON::JsonWriteBasic(UChar_t value)
 
 void TBufferJSON::JsonWriteBasic(UShort_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hu", value);
-   fValue.Append(buf);
+   JsonAppendUnsigned(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3965,9 +4103,7 @@ void TBufferJSON::JsonWriteBasic(UShort_t value)
 
 void TBufferJSON::JsonWriteBasic(UInt_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   JsonAppendUnsigned(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3975,9 +4111,7 @@ void TBufferJSON::JsonWriteBasic(UInt_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%lu", value);
-   fValue.Append(buf);
+   JsonAppendUnsigned(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3985,7 +4119,7 @@ void TBufferJSON::JsonWriteBasic(ULong_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   JsonAppendUnsigned(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
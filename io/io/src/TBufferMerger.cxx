@@ -13,14 +13,24 @@
 
 #include "TBufferFile.h"
 #include "TError.h"
+#include "TMemoryAccounting.h"
 #include "TROOT.h"
 #include "TVirtualMutex.h"
 
+#include <algorithm>
+#include <chrono>
 #include <utility>
 
 namespace ROOT {
 namespace Experimental {
 
+namespace {
+double SecondsSince(std::chrono::steady_clock::time_point start)
+{
+   return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+} // anonymous namespace
+
 TBufferMerger::TBufferMerger(const char *name, Option_t *option, Int_t compress)
 {
    // We cannot chain constructors or use in-place initialization here because
@@ -47,6 +57,19 @@ TBufferMerger::~TBufferMerger()
    for (const auto &f : fAttachedFiles)
       if (!f.expired()) Fatal("TBufferMerger", " TBufferMergerFiles must be destroyed before the server");
 
+   if (fAsync) {
+      {
+         std::lock_guard<std::mutex> lock(fQueueMutex);
+         fTerminate = true;
+      }
+      fDataAvailable.notify_all();
+      // the pre-merging threads drain fQueue, then the merging thread drains fPreMergedQueue
+      for (auto &t : fPreMergingThreads)
+         t.join();
+      fPreMergedAvailable.notify_one();
+      fMergingThread.join();
+   }
+
    if (!fQueue.empty())
       Merge();
 }
@@ -65,15 +88,39 @@ size_t TBufferMerger::GetQueueSize() const
    return fQueue.size();
 }
 
+TBufferMerger::MergeStats TBufferMerger::GetMergeStats() const
+{
+   std::lock_guard<std::mutex> lock(fStatsMutex);
+   return fStats;
+}
+
 void TBufferMerger::Push(TBufferFile *buffer)
 {
+   double waitTime = 0;
+   size_t queueSize = 0;
    {
-      std::lock_guard<std::mutex> lock(fQueueMutex);
+      std::unique_lock<std::mutex> lock(fQueueMutex);
+      if (fAsync && fMaxQueueSize > 0 && fQueue.size() >= fMaxQueueSize) {
+         const auto start = std::chrono::steady_clock::now();
+         fSpaceAvailable.wait(lock, [this] { return fQueue.size() < fMaxQueueSize; });
+         waitTime = SecondsSince(start);
+      }
       fBuffered += buffer->BufferSize();
       fQueue.push(buffer);
+      TMemoryAccounting::Add(TMemoryAccounting::kFile, buffer->BufferSize());
+      queueSize = fQueue.size();
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(fStatsMutex);
+      ++fStats.fPushedBuffers;
+      fStats.fPeakQueueSize = std::max(fStats.fPeakQueueSize, queueSize);
+      fStats.fPushWaitTime += waitTime;
    }
 
-   if (fBuffered > fAutoSave)
+   if (fAsync)
+      fDataAvailable.notify_one();
+   else if (fBuffered > fAutoSave)
       Merge();
 }
 
@@ -98,6 +145,173 @@ void TBufferMerger::SetMergeOptions(const TString& options)
    fMerger.SetMergeOptions(options);
 }
 
+void TBufferMerger::StartMergingThread(size_t maxQueueSize, size_t nPreMergingThreads)
+{
+   if (fAsync) {
+      Error("TBufferMerger", "the merging thread was already started");
+      return;
+   }
+   fMaxQueueSize = maxQueueSize;
+   fAsync = true;
+   fActivePreMergers = nPreMergingThreads;
+   fMergingThread = std::thread([this] { MergingThreadLoop(); });
+
+   if (nPreMergingThreads > 0) {
+      TFile *output = fMerger.GetOutputFile();
+      const Int_t compress = output ? output->GetCompressionSettings() : ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose;
+      for (size_t i = 0; i < nPreMergingThreads; ++i)
+         fPreMergingThreads.emplace_back([this, compress] { PreMergingThreadLoop(compress); });
+   }
+}
+
+void TBufferMerger::MergingThreadLoop()
+{
+   if (fActivePreMergers > 0) {
+      // only merge the buffers of the pre-merging threads, as they come
+      std::unique_lock<std::mutex> lock(fQueueMutex);
+      while (true) {
+         fPreMergedAvailable.wait(lock, [this] { return !fPreMergedQueue.empty() || fActivePreMergers == 0; });
+         if (fPreMergedQueue.empty())
+            return; // all pre-merging threads are done, and nothing left to merge
+
+         std::queue<TBufferFile *> queue;
+         std::swap(queue, fPreMergedQueue);
+         lock.unlock();
+         fSpaceAvailable.notify_all();
+
+         {
+            std::lock_guard<std::mutex> m(fMergeMutex);
+            MergeBuffers(queue);
+         }
+         lock.lock();
+      }
+   }
+
+   std::unique_lock<std::mutex> lock(fQueueMutex);
+   while (true) {
+      // merge once fAutoSave bytes are buffered, or earlier if threads are waiting to push more
+      fDataAvailable.wait(lock, [this] {
+         return fTerminate || (!fQueue.empty() && (fBuffered > fAutoSave ||
+                                                   (fMaxQueueSize > 0 && fQueue.size() >= fMaxQueueSize)));
+      });
+      if (fQueue.empty())
+         return; // terminating, and nothing left to merge
+
+      std::queue<TBufferFile *> queue;
+      std::swap(queue, fQueue);
+      fBuffered = 0;
+      lock.unlock();
+      fSpaceAvailable.notify_all();
+
+      {
+         std::lock_guard<std::mutex> m(fMergeMutex);
+         MergeBuffers(queue);
+      }
+      lock.lock();
+   }
+}
+
+void TBufferMerger::PreMergingThreadLoop(Int_t compress)
+{
+   TFileMerger merger{false, false};
+   merger.SetMergeOptions(TString(fMerger.GetMergeOptions()));
+
+   std::unique_lock<std::mutex> lock(fQueueMutex);
+   while (true) {
+      fDataAvailable.wait(lock, [this] {
+         return fTerminate || (!fQueue.empty() && (fBuffered > fAutoSave ||
+                                                   (fMaxQueueSize > 0 && fQueue.size() >= fMaxQueueSize)));
+      });
+      if (fQueue.empty())
+         break; // terminating, and nothing left to pre-merge
+
+      // take a fair share of the queue, so that the other pre-merging threads are not left idle
+      const size_t nThreads = fPreMergingThreads.size();
+      const size_t n = std::max<size_t>(1, (fQueue.size() + nThreads - 1) / nThreads);
+      std::queue<TBufferFile *> queue;
+      size_t bytes = 0;
+      while (queue.size() < n) {
+         bytes += fQueue.front()->BufferSize();
+         queue.push(fQueue.front());
+         fQueue.pop();
+      }
+      fBuffered -= std::min(bytes, fBuffered);
+      lock.unlock();
+      fSpaceAvailable.notify_all();
+
+      TBufferFile *merged = PreMergeBuffers(merger, queue, compress);
+
+      lock.lock();
+      if (merged) {
+         fPreMergedQueue.push(merged);
+         TMemoryAccounting::Add(TMemoryAccounting::kFile, merged->BufferSize());
+         fPreMergedAvailable.notify_one();
+      }
+   }
+
+   if (--fActivePreMergers == 0)
+      fPreMergedAvailable.notify_one();
+}
+
+TBufferFile *TBufferMerger::PreMergeBuffers(TFileMerger &merger, std::queue<TBufferFile *> &queue, Int_t compress)
+{
+   if (queue.size() == 1) {
+      // nothing to coalesce, the buffer goes to the output as it is
+      TBufferFile *buffer = queue.front();
+      queue.pop();
+      TMemoryAccounting::Remove(TMemoryAccounting::kFile, buffer->BufferSize());
+      return buffer;
+   }
+
+   const auto start = std::chrono::steady_clock::now();
+   const char *name = fMerger.GetOutputFileName();
+   {
+      TDirectory::TContext ctxt;
+      merger.OutputFile(std::unique_ptr<TFile>(new TMemFile(name, "RECREATE", "", compress)));
+   }
+   while (!queue.empty()) {
+      std::unique_ptr<TBufferFile> buffer{queue.front()};
+      TMemoryAccounting::Remove(TMemoryAccounting::kFile, buffer->BufferSize());
+      merger.AddAdoptFile(new TMemFile(name, std::move(buffer)));
+      queue.pop();
+   }
+
+   TBufferFile *merged = nullptr;
+   if (merger.PartialMerge()) {
+      merged = static_cast<TMemFile *>(merger.GetOutputFile())->ReleaseBuffer().release();
+   } else {
+      Error("TBufferMerger", "cannot pre-merge the queued buffers");
+   }
+   merger.Reset();
+
+   std::lock_guard<std::mutex> lock(fStatsMutex);
+   ++fStats.fPreMerges;
+   fStats.fPreMergeTime += SecondsSince(start);
+   return merged;
+}
+
+void TBufferMerger::MergeBuffers(std::queue<TBufferFile *> &queue)
+{
+   const auto start = std::chrono::steady_clock::now();
+   const size_t nBuffers = queue.size();
+   while (!queue.empty()) {
+      std::unique_ptr<TBufferFile> buffer{queue.front()};
+      TMemoryAccounting::Remove(TMemoryAccounting::kFile, buffer->BufferSize());
+      fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::move(buffer)));
+      queue.pop();
+   }
+
+   fMerger.PartialMerge();
+   fMerger.Reset();
+
+   const double mergeTime = SecondsSince(start);
+   std::lock_guard<std::mutex> lock(fStatsMutex);
+   ++fStats.fMerges;
+   fStats.fMergedBuffers += nBuffers;
+   fStats.fMergeTime += mergeTime;
+   fStats.fMaxMergeTime = std::max(fStats.fMaxMergeTime, mergeTime);
+}
+
 void TBufferMerger::Merge()
 {
    if (fMergeMutex.try_lock()) {
@@ -108,14 +322,7 @@ void TBufferMerger::Merge()
          fBuffered = 0;
       }
 
-      while (!queue.empty()) {
-         std::unique_ptr<TBufferFile> buffer{queue.front()};
-         fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::move(buffer)));
-         queue.pop();
-      }
-
-      fMerger.PartialMerge();
-      fMerger.Reset();
+      MergeBuffers(queue);
       fMergeMutex.unlock();
    }
 }
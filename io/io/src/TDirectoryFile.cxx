@@ -47,6 +47,8 @@ End_Macro
 #include "TProcessUUID.h"
 #include "TVirtualMutex.h"
 #include "TEmulatedCollectionProxy.h"
+#include "TEnv.h"
+#include "RKeyIndex.hxx"
 
 const UInt_t kIsBigFile = BIT(16);
 const Int_t  kMaxLen = 2048;
@@ -176,6 +178,7 @@ void TDirectoryFile::InitDirectoryFile(TClass *cl)
 
 TDirectoryFile::~TDirectoryFile()
 {
+   SafeDelete(fKeyIndex);
    if (fKeys) {
       fKeys->Delete("slow");
       SafeDelete(fKeys);
@@ -231,6 +234,7 @@ Int_t TDirectoryFile::AppendKey(TKey *key)
 
    fModified = kTRUE;
 
+   LoadAllKeys();
    key->SetMotherDir(this);
 
    // This is a fast hash lookup in case the key does not already exist
@@ -265,7 +269,7 @@ void TDirectoryFile::Browse(TBrowser *b)
       TObject *obj = nullptr;
       TIter nextin(fList);
       TKey *key = nullptr, *keyo = nullptr;
-      TIter next(fKeys);
+      TIter next(GetListOfKeys());
 
       cd();
 
@@ -574,6 +578,7 @@ void TDirectoryFile::Close(Option_t *option)
    }
 
    // Delete keys from key list (but don't delete the list header)
+   SafeDelete(fKeyIndex);
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -946,6 +951,14 @@ TObject *TDirectoryFile::Get(const char *namecycle)
 //*-*---------------------Case of Key---------------------
 //                        ===========
    TKey *key;
+   if (fKeyIndex) {
+      key = GetIndexedKey(fKeyIndex->FindKey(namobj, cycle, kTRUE));
+      if (key) {
+         TDirectory::TContext ctxt(this);
+         idcur = key->ReadObj();
+      }
+      return idcur;
+   }
    TIter nextkey(GetListOfKeys());
    while ((key = (TKey *) nextkey())) {
       if (strcmp(namobj,key->GetName()) == 0) {
@@ -1066,6 +1079,14 @@ void *TDirectoryFile::GetObjectChecked(const char *namecycle, const TClass* expe
 //                        ===========
    void *idcur = nullptr;
    TKey *key;
+   if (fKeyIndex) {
+      key = GetIndexedKey(fKeyIndex->FindKey(namobj, cycle, kTRUE));
+      if (key) {
+         TDirectory::TContext ctxt(this);
+         idcur = key->ReadObjectAny(expectedClass);
+      }
+      return idcur;
+   }
    TIter nextkey(GetListOfKeys());
    while ((key = (TKey *) nextkey())) {
       if (strcmp(namobj,key->GetName()) == 0) {
@@ -1102,6 +1123,9 @@ TKey *TDirectoryFile::GetKey(const char *name, Short_t cycle) const
 {
    if (!fKeys) return nullptr;
 
+   if (fKeyIndex)
+      return GetIndexedKey(fKeyIndex->FindKey(name, cycle, kFALSE));
+
    // TIter::TIter() already checks for null pointers
    TIter next( ((THashList *)(GetListOfKeys()))->GetListForObject(name) );
 
@@ -1116,6 +1140,78 @@ TKey *TDirectoryFile::GetKey(const char *name, Short_t cycle) const
    return nullptr;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the i-th key of the keys record, creating its TKey if it was not
+/// read yet. Return nullptr if i is negative.
+
+TKey *TDirectoryFile::GetIndexedKey(Int_t i) const
+{
+   if (i < 0)
+      return nullptr;
+   TKey *key = fKeyIndex->GetKey(i);
+   if (!key) {
+      key = new TKey(const_cast<TDirectoryFile *>(this));
+      fKeyIndex->ReadKey(key, i);
+      fKeys->Add(key);
+   }
+   return key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the list of keys of the directory.
+///
+/// The keys of a large directory opened in read mode are read on demand (see
+/// the rootrc variable TFile.LazyKeys): all of them are read by this call.
+
+TList *TDirectoryFile::GetListOfKeys() const
+{
+   LoadAllKeys();
+   return fKeys;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of keys of the directory, without reading them.
+
+Int_t TDirectoryFile::GetNkeys() const
+{
+   return fKeyIndex ? fKeyIndex->GetN() : fKeys->GetSize();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the TKeys not read yet, if the keys are read on demand, and put all
+/// of them in the list of keys in the order of the keys record.
+
+void TDirectoryFile::LoadAllKeys() const
+{
+   if (!fKeyIndex)
+      return;
+   ROOT::Internal::RKeyIndex *index = fKeyIndex;
+   auto self = const_cast<TDirectoryFile *>(this);
+   self->fKeyIndex = nullptr;
+   fKeys->Clear("nodelete");
+   for (Int_t i = 0; i < index->GetN(); i++) {
+      TKey *key = index->GetKey(i);
+      if (!key) {
+         key = new TKey(self);
+         index->ReadKey(key, i);
+      }
+      fKeys->Add(key);
+   }
+   delete index;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove a key that is being deleted from the list of keys, without reading
+/// the keys not read yet.
+
+void TDirectoryFile::ForgetKey(TKey *key)
+{
+   if (fKeyIndex)
+      fKeyIndex->ForgetKey(key);
+   if (fKeys)
+      fKeys->Remove(key);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// List Directory contents
 ///
@@ -1335,6 +1431,7 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
    char *buffer;
    if (forceRead) {
+      SafeDelete(fKeyIndex);
       fKeys->Delete();
       //In case directory was updated by another process, read new
       //position for the keys
@@ -1367,6 +1464,9 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
       delete [] header;
    }
 
+   // The keys are added to the ones already read
+   LoadAllKeys();
+
    Int_t nkeys = 0;
    Long64_t fsize = fFile->GetSize();
    if ( fSeekKeys >  0) {
@@ -1377,6 +1477,17 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
       TKey *key;
       frombuf(buffer, &nkeys);
+
+      // The TKeys of a large directory that is only read are created on demand:
+      // only an index of the keys record is kept until then.
+      const Int_t lazyKeys = gEnv->GetValue("TFile.LazyKeys", 10000);
+      if (lazyKeys > 0 && nkeys >= lazyKeys && !fFile->IsWritable()) {
+         std::vector<char> record(buffer, headerkey->GetBuffer() + fNbytesKeys);
+         delete headerkey;
+         fKeyIndex = new ROOT::Internal::RKeyIndex(std::move(record), nkeys, fsize);
+         return fKeyIndex->GetN();
+      }
+
       for (Int_t i = 0; i < nkeys; i++) {
          key = new TKey(this);
          key->ReadKeyBuffer(buffer);
@@ -1454,6 +1565,7 @@ void TDirectoryFile::ResetAfterMerge(TFileMergeInfo *info)
    }
    // NOTE: We should check that the content is really mergeable and in
    // the in-mmeory list, before deleting the keys.
+   SafeDelete(fKeyIndex);
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -1624,6 +1736,8 @@ void TDirectoryFile::SetWritable(Bool_t writable)
    TDirectory::TContext ctxt(this);
 
    fWritable = writable;
+   if (writable)
+      LoadAllKeys();
 
    // recursively set all sub-directories
    if (fList) {
@@ -135,6 +135,8 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TGlobal.h"
 #include "ROOT/RMakeUnique.hxx"
 #include "ROOT/RConcurrentHashColl.hxx"
+#include "RFileWriteBehind.hxx"
+#include "RKeyIndex.hxx"
 
 using std::sqrt;
 
@@ -554,6 +556,10 @@ void TFile::Init(Bool_t create)
       return;
    fInitDone = kTRUE;
 
+   TStopwatch initTimer;
+   const Int_t readCallsStart = fReadCalls;
+   const Long64_t bytesReadStart = fBytesRead;
+
    if (!fIsRootFile) {
       gDirectory = gROOT;
       return;
@@ -763,7 +769,9 @@ void TFile::Init(Bool_t create)
       //*-* -------------Read keys of the top directory
       if (fSeekKeys > fBEGIN && fEND <= size) {
          //normal case. Recover only if file has no keys
+         TStopwatch keysTimer;
          TDirectoryFile::ReadKeys(kFALSE);
+         fOpenStats.fKeysTime = keysTimer.RealTime();
          gDirectory = this;
          if (!GetNkeys()) {
             if (tryrecover) {
@@ -819,7 +827,10 @@ void TFile::Init(Bool_t create)
       if (lenIndex < 5000) lenIndex = 5000;
       fClassIndex = new TArrayC(lenIndex);
       if (fgReadInfo) {
-         if (fSeekInfo > fBEGIN) {
+         if (fSeekInfo > fBEGIN && !fWritable && gEnv->GetValue("TFile.LazyStreamerInfo", 0) == 1) {
+            // Read the record only when the first object is read from the file, see ReadPendingStreamerInfo()
+            fStreamerInfoPending = kTRUE;
+         } else if (fSeekInfo > fBEGIN) {
             ReadStreamerInfo();                // NOLINT: silence clang-tidy warnings
             if (IsZombie()) {
                R__LOCKGUARD(gROOTMutex);
@@ -828,7 +839,7 @@ void TFile::Init(Bool_t create)
             }
          } else if (fVersion != gROOT->GetVersionInt() && fVersion > 30000) {
             // Don't complain about missing streamer info for empty files.
-            if (fKeys->GetSize()) {
+            if (GetNkeys()) {
                Warning("Init","no StreamerInfo found in %s therefore preventing schema evolution when reading this file."
                               " The file was produced with version %d.%02d/%02d of ROOT.",
                               GetName(),  fVersion / 10000, (fVersion / 100) % (100), fVersion  % 100);
@@ -837,8 +848,18 @@ void TFile::Init(Bool_t create)
       }
    }
 
+   // Write the buffers of a local file from a separate thread, if requested.
+   if (fWritable && IsA() == TFile::Class()) {
+      Long64_t writeBehind = gEnv->GetValue("TFile.WriteBehind", 0);
+      if (writeBehind > 0)
+         SetWriteBehind(writeBehind << 20);
+   }
+
    // Count number of TProcessIDs in this file
-   {
+   if (fKeyIndex) {
+      fNProcessIDs = fKeyIndex->CountKeys("TProcessID");
+      fProcessIDs = new TObjArray(fNProcessIDs+1);
+   } else {
       TIter next(fKeys);
       TKey *key;
       while ((key = (TKey*)next())) {
@@ -846,6 +867,10 @@ void TFile::Init(Bool_t create)
       }
       fProcessIDs = new TObjArray(fNProcessIDs+1);
    }
+
+   fOpenStats.fInitTime = initTimer.RealTime();
+   fOpenStats.fInitReadCalls = fReadCalls - readCallsStart;
+   fOpenStats.fInitBytesRead = fBytesRead - bytesReadStart;
    return;
 
 zombie:
@@ -881,6 +906,7 @@ void TFile::Close(Option_t *option)
 
    if (fIsArchive || !fIsRootFile) {
       FlushWriteCache();
+      StopWriteBehind();
       SysClose(fD);
       fD = -1;
 
@@ -936,6 +962,7 @@ void TFile::Close(Option_t *option)
    }
 
    if (IsOpen()) {
+      StopWriteBehind();
       SysClose(fD);
       fD = -1;
    }
@@ -1057,6 +1084,8 @@ void TFile::Flush()
 {
    if (IsOpen() && fWritable) {
       FlushWriteCache();
+      if (WaitWriteBehind())
+         return;
       if (SysSync(fD) < 0) {
          // Write the system error only once for this file
          SetBit(kWriteError); SetWritable(kFALSE);
@@ -1253,6 +1282,39 @@ Int_t TFile::GetRecordHeader(char *buf, Long64_t first, Int_t maxbytes, Int_t &n
    return nread;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until the buffers queued by WriteBuffer() are written, if write-behind
+/// is active. Returns kTRUE in case one of them could not be written.
+
+Bool_t TFile::WaitWriteBehind()
+{
+   if (!fWriteBehind)
+      return kFALSE;
+   if (int error = fWriteBehind->Wait()) {
+      if (!TestBit(kWriteError)) {
+         // Write the system error only once for this file
+         SetBit(kWriteError); SetWritable(kFALSE);
+         Error("WaitWriteBehind", "error writing to file %s (%s)", GetName(), strerror(error));
+      }
+      return kTRUE;
+   }
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the buffers still queued and end the write-behind thread, if any.
+/// Returns kTRUE in case one of the buffers could not be written.
+
+Bool_t TFile::StopWriteBehind()
+{
+   if (!fWriteBehind)
+      return kFALSE;
+   Bool_t failed = WaitWriteBehind();
+   delete fWriteBehind;
+   fWriteBehind = nullptr;
+   return failed;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the current file size. Returns -1 in case the file could not
 /// be stat'ed.
@@ -1265,6 +1327,7 @@ Long64_t TFile::GetSize() const
       size = fArchive->GetMember()->GetDecompressedSize();
    } else {
       Long_t id, flags, modtime;
+      const_cast<TFile*>(this)->WaitWriteBehind();  // NOLINT: silence clang-tidy warnings
       if (const_cast<TFile*>(this)->SysStat(fD, &id, &size, &flags, &modtime)) {  // NOLINT: silence clang-tidy warnings
          Error("GetSize", "cannot stat the file %s", GetName());
          return -1;
@@ -1587,7 +1650,8 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 
       Int_t st;
       Double_t start = 0;
-      if (gPerfStats) start = TTimeStamp();
+      TVirtualPerfStats *globalPerfStats = TVirtualPerfStats::GetGlobalPerfStats();
+      if (gPerfStats || globalPerfStats) start = TTimeStamp();
 
       if ((st = ReadBufferViaCache(buf, len))) {
          if (st == 2)
@@ -1596,6 +1660,8 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
       }
 
       Seek(pos);
+      if (WaitWriteBehind())
+         return kTRUE;
       ssize_t siz;
 
       while ((siz = SysRead(fD, buf, len)) < 0 && GetErrno() == EINTR)
@@ -1620,6 +1686,9 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
       if (gPerfStats) {
          gPerfStats->FileReadEvent(this, len, start);
       }
+      if (globalPerfStats && globalPerfStats != gPerfStats) {
+         globalPerfStats->FileReadEvent(this, len, start);
+      }
       return kFALSE;
    }
    return kTRUE;
@@ -1640,10 +1709,14 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
          return kFALSE;
       }
 
+      if (WaitWriteBehind())
+         return kTRUE;
+
       ssize_t siz;
       Double_t start = 0;
+      TVirtualPerfStats *globalPerfStats = TVirtualPerfStats::GetGlobalPerfStats();
 
-      if (gPerfStats) start = TTimeStamp();
+      if (gPerfStats || globalPerfStats) start = TTimeStamp();
 
       while ((siz = SysRead(fD, buf, len)) < 0 && GetErrno() == EINTR)
          ResetErrno();
@@ -1667,6 +1740,9 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
       if (gPerfStats) {
          gPerfStats->FileReadEvent(this, len, start);
       }
+      if (globalPerfStats && globalPerfStats != gPerfStats) {
+         globalPerfStats->FileReadEvent(this, len, start);
+      }
       return kFALSE;
    }
    return kTRUE;
@@ -2058,6 +2134,7 @@ Int_t TFile::ReOpen(Option_t *mode)
          fFree->Delete();
          SafeDelete(fFree);
 
+         StopWriteBehind();
          SysClose(fD);
          fD = -1;
 
@@ -2080,6 +2157,9 @@ Int_t TFile::ReOpen(Option_t *mode)
    } else {
       // switch to UPDATE mode
 
+      // the StreamerInfo of the classes already in the file are written again with the new ones
+      ReadPendingStreamerInfo();
+
       // close readonly file
       if (IsOpen()) {
          SysClose(fD);
@@ -2253,6 +2333,35 @@ void TFile::SetCacheWrite(TFileCacheWrite *cache)
    fCacheWrite = cache;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write the buffers of the file from a separate thread.
+///
+/// WriteBuffer() copies the buffers into a queue of at most maxqueued bytes
+/// and returns as soon as there is room in it; contiguous buffers are merged
+/// into large writes. The queue is drained before the file is read, synced,
+/// stat'ed or closed. An error of the I/O thread is reported by the next
+/// WriteBuffer() or Flush() and makes the file read-only.
+/// This is only supported by local files opened in write mode by TFile
+/// itself; maxqueued <= 0 writes the buffers directly again.
+/// It can also be set for all the files with the rootrc variable
+/// TFile.WriteBehind, in MB.
+
+void TFile::SetWriteBehind(Long64_t maxqueued)
+{
+   StopWriteBehind();
+   if (maxqueued <= 0)
+      return;
+#ifndef WIN32
+   if (IsA() != TFile::Class() || !IsOpen() || !fWritable || fArchive) {
+      Warning("SetWriteBehind", "write-behind is not supported by file %s", GetName());
+      return;
+   }
+   fWriteBehind = new ROOT::Internal::RFileWriteBehind(fD, maxqueued);
+#else
+   Warning("SetWriteBehind", "write-behind is not supported on this platform");
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the size in bytes of the file header.
 
@@ -2346,6 +2455,25 @@ Bool_t TFile::WriteBuffer(const char *buf, Int_t len)
          return kFALSE;
       }
 
+      if (fWriteBehind) {
+         Long64_t off = GetRelOffset();
+         if (int error = fWriteBehind->Write(buf, len, fOffset)) {
+            // Write the system error only once for this file
+            SetBit(kWriteError); SetWritable(kFALSE);
+            Error("WriteBuffer", "error writing to file %s (%s)", GetName(), strerror(error));
+            return kTRUE;
+         }
+         // The file position is not moved by the I/O thread
+         Seek(off + len);
+         fBytesWrite  += len;
+         fgBytesWrite += len;
+
+         if (gMonitoringWriter)
+            gMonitoringWriter->SendFileWriteProgress(this);
+
+         return kFALSE;
+      }
+
       ssize_t siz;
       gSystem->IgnoreInterrupt();
       while ((siz = SysWrite(fD, buf, len)) < 0 && GetErrno() == EINTR)  // NOLINT: silence clang-tidy warnings
@@ -3456,6 +3584,22 @@ Int_t TFile::MakeProjectParProofInf(const char *pack, const char *proofinf)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the StreamerInfo record if its reading was deferred when the file was
+/// opened, see ReadStreamerInfo().
+/// Returns kFALSE if the file is a zombie, e.g. because the record is corrupt:
+/// no object must then be read from it.
+
+Bool_t TFile::ReadPendingStreamerInfo()
+{
+   if (fStreamerInfoPending) {
+      ReadStreamerInfo();
+      if (IsZombie())
+         Error("ReadPendingStreamerInfo", "cannot read the StreamerInfo record of %s, objects cannot be read from it", GetName());
+   }
+   return !IsZombie();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read the list of StreamerInfo from this file.
 ///
@@ -3463,14 +3607,25 @@ Int_t TFile::MakeProjectParProofInf(const char *pack, const char *proofinf)
 /// The corresponding TClass objects are updated.
 /// Note that this function is not called if the static member fgReadInfo is false.
 /// (see TFile::SetReadStreamerInfo)
+///
+/// If the rootrc variable TFile.LazyStreamerInfo is set to 1, the record of a
+/// file opened in read mode is only read by ReadPendingStreamerInfo(), when the
+/// first object is read from the file. Opening a file to look at its keys does
+/// then not build the TStreamerInfo of all its classes.
+/// GetOpenStats() gives the time spent reading it.
 
 void TFile::ReadStreamerInfo()
 {
+   fStreamerInfoPending = kFALSE;
+   fOpenStats.fStreamerInfoRead = kTRUE;
+   TStopwatch timer;
+
    auto listRetcode = GetStreamerInfoListImpl(/*lookupSICache*/ true);  // NOLINT: silence clang-tidy warnings
    TList *list = listRetcode.fList;
    auto retcode = listRetcode.fReturnCode;
    if (!list) {
       if (retcode) MakeZombie();
+      fOpenStats.fStreamerInfoTime += timer.RealTime();
       return;
    }
 
@@ -3576,6 +3731,7 @@ void TFile::ReadStreamerInfo()
    // has been done.
    fgTsSIHashes.Insert(listRetcode.fHash);
 #endif
+   fOpenStats.fStreamerInfoTime += timer.RealTime();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3655,6 +3811,7 @@ void TFile::WriteStreamerInfo()
    if (!fWritable) return;
    if (!fClassIndex) return;
    if (fIsPcmFile) return; // No schema evolution for ROOT PCM files.
+   ReadPendingStreamerInfo();
    if (fClassIndex->fArray[0] == 0
        && fSeekInfo != 0) {
       // No need to update the index if no new classes added to the file
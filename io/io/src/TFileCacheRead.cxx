@@ -31,9 +31,36 @@
 #include "TFileCacheWrite.h"
 #include "TFilePrefetch.h"
 #include "TMathBase.h"
+#include "TMemoryAccounting.h"
+#include "TTimeStamp.h"
+#include "TVirtualPerfStats.h"
 
 ClassImp(TFileCacheRead);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Allocate a cache buffer of size bytes, accounted in TMemoryAccounting.
+
+char *NewCacheBuffer(Int_t size)
+{
+   TMemoryAccounting::Add(TMemoryAccounting::kFile, size);
+   return new char[size];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete a cache buffer of size bytes allocated by NewCacheBuffer().
+
+void DeleteCacheBuffer(char *buffer, Int_t size)
+{
+   if (!buffer)
+      return;
+   TMemoryAccounting::Remove(TMemoryAccounting::kFile, size);
+   delete [] buffer;
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
@@ -135,10 +162,12 @@ TFileCacheRead::TFileCacheRead(TFile *file, Int_t buffersize, TObject *tree)
    fPrefetchedBlocks = 0;
 
    //initialise the prefetch object and set the cache directory
-   // start the thread only if the file is not local
+   // start the thread only if the file is remote, or local and can be read
+   // from the prefetching thread without interfering with the main thread
    fEnablePrefetching = gEnv->GetValue("TFile.AsyncPrefetching", 0);
 
-   if (fEnablePrefetching && file && strcmp(file->GetEndpointUrl()->GetProtocol(), "file")){
+   if (fEnablePrefetching && file &&
+       (strcmp(file->GetEndpointUrl()->GetProtocol(), "file") || TFilePrefetch::CanReadLocal(file))) {
       SetEnablePrefetchingImpl(true);
    }
    else { //disable the async pref for local files
@@ -167,8 +196,7 @@ TFileCacheRead::~TFileCacheRead()
    delete [] fSeekSortLen;
    delete [] fSeekPos;
    delete [] fLen;
-   if (fBuffer)
-      delete [] fBuffer;
+   DeleteCacheBuffer(fBuffer, fBufferSize);
    delete [] fBSeek;
    delete [] fBSeekIndex;
    delete [] fBSeekSort;
@@ -458,11 +486,15 @@ Int_t TFileCacheRead::ReadBufferExtNormal(char *buf, Long64_t pos, Int_t len, In
 
       // If ReadBufferAsync is not supported by this implementation...
       if (!fAsyncReading) {
+         TVirtualPerfStats *globalPerfStats = TVirtualPerfStats::GetGlobalPerfStats();
+         Double_t start = 0;
+         if (globalPerfStats) start = TTimeStamp();
          // Then we use the vectored read to read everything now
          if (fFile->ReadBuffers(fBuffer,fPos,fLen,fNb)) {
             return -1;
          }
          fIsTransferred = kTRUE;
+         if (globalPerfStats) globalPerfStats->CacheFillEvent(fFile, fNb, fNtot, start);
       } else {
          // In any case, we'll start to request the chunks.
          // This implementation simply reads all the chunks in advance
@@ -550,7 +582,7 @@ void TFileCacheRead::SetFile(TFile *file, TFile::ECacheAction action)
       // we use sync primitives, hence we need the local buffer
       if (file && file->ReadBufferAsync(0, 0)) {
          fAsyncReading = kFALSE;
-         fBuffer       = new char[fBufferSize];
+         fBuffer       = NewCacheBuffer(fBufferSize);
       }
    }
 
@@ -591,13 +623,13 @@ void TFileCacheRead::Sort()
    }
    fNseek = effectiveNseek;
    if (fNtot > fBufferSizeMin) {
-      fBufferSize = fNtot + 100;
-      delete [] fBuffer;
+      DeleteCacheBuffer(fBuffer, fBufferSize);
       fBuffer = 0;
+      fBufferSize = fNtot + 100;
       // If ReadBufferAsync is not supported by this implementation
       // it means that we are using sync primitives, hence we need the local buffer
       if (!fAsyncReading)
-         fBuffer = new char[fBufferSize];
+         fBuffer = NewCacheBuffer(fBufferSize);
    }
    fPos[0]  = fSeekSort[0];
    fLen[0]  = fSeekSortLen[0];
@@ -649,13 +681,13 @@ void TFileCacheRead::SecondSort()
    }
    fBNseek = effectiveNseek;
    if (fBNtot > fBufferSizeMin) {
-      fBufferSize = fBNtot + 100;
-      delete [] fBuffer;
+      DeleteCacheBuffer(fBuffer, fBufferSize);
       fBuffer = 0;
+      fBufferSize = fBNtot + 100;
       // If ReadBufferAsync is not supported by this implementation
       // it means that we are using sync primitives, hence we need the local buffer
       if (!fAsyncReading)
-         fBuffer = new char[fBufferSize];
+         fBuffer = NewCacheBuffer(fBufferSize);
    }
    fBPos[0]  = fBSeekSort[0];
    fBLen[0]  = fBSeekSortLen[0];
@@ -736,16 +768,16 @@ Int_t TFileCacheRead::SetBufferSize(Int_t buffersize)
          pres = fBuffer;
          fBuffer = 0;
       }
-      delete [] fBuffer;
+      DeleteCacheBuffer(fBuffer, fBufferSize);
       fBuffer = 0;
-      np = new char[buffersize];
+      np = NewCacheBuffer(buffersize);
       if (pres) {
          memcpy(np, pres, fNtot);
       }
-      delete [] pres;
+      DeleteCacheBuffer(pres, fBufferSize);
    }
 
-   delete [] fBuffer;
+   DeleteCacheBuffer(fBuffer, fBufferSize);
    fBuffer = np;
    fBufferSizeMin = buffersize;
    fBufferSize = buffersize;
@@ -811,7 +843,7 @@ void TFileCacheRead::SetEnablePrefetchingImpl(Bool_t setPrefetching)
          }
       if (!fAsyncReading && fBuffer == 0) {
          // we use sync primitives, hence we need the local buffer
-         fBuffer = new char[fBufferSize];
+         fBuffer = NewCacheBuffer(fBufferSize);
       }
    }
 }
@@ -28,6 +28,7 @@ The write cache is automatically created when writing a remote file
 
 #include "TFile.h"
 #include "TFileCacheWrite.h"
+#include "TMemoryAccounting.h"
 
 ClassImp(TFileCacheWrite);
 
@@ -60,6 +61,7 @@ TFileCacheWrite::TFileCacheWrite(TFile *file, Int_t buffersize)
    fFile        = file;
    fRecursive   = kFALSE;
    fBuffer      = new char[fBufferSize];
+   TMemoryAccounting::Add(TMemoryAccounting::kFile, fBufferSize);
    if (file) file->SetCacheWrite(this);
    if (gDebug > 0) Info("TFileCacheWrite","Creating a write cache with buffersize=%d bytes",buffersize);
 }
@@ -69,6 +71,8 @@ TFileCacheWrite::TFileCacheWrite(TFile *file, Int_t buffersize)
 
 TFileCacheWrite::~TFileCacheWrite()
 {
+   if (fBuffer)
+      TMemoryAccounting::Remove(TMemoryAccounting::kFile, fBufferSize);
    delete [] fBuffer;
 }
 
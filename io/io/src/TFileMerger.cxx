@@ -20,6 +20,20 @@ any of its remote file access plugins. It is therefore useful in
 a Grid environment where the files might be accessible only remotely.
 The merging interface allows files containing histograms and trees
 to be merged, like the standalone hadd program.
+
+When implicit multi-threading is enabled and the histograms are merged in
+one go (see the constructor), the histograms of a directory are merged
+concurrently: their inputs are read from the sources in key order, their
+Merge calls run on the thread pool, and the results are written in key
+order again, so that the output does not depend on the scheduling.
+Trees and the other objects are still merged one after the other.
+
+SetMemoryBudget() bounds the memory used by the merge, for sources with very
+many keys. Half of the budget goes to the lists of keys of the open sources:
+once they reach it, the next sources are opened and merged into the output
+in a later round, as when SetMaxOpenedFiles() is reached. The other half goes
+to the objects read and not merged yet: once the inputs of an object reach
+it, they are merged into the object right away rather than in one go.
 */
 
 #include "TFileMerger.h"
@@ -39,6 +53,12 @@ to be merged, like the standalone hadd program.
 #include "TROOT.h"
 #include "TMemFile.h"
 #include "TVirtualMutex.h"
+#include "TError.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
 
 #ifdef WIN32
 // For _getmaxstdio
@@ -50,6 +70,8 @@ to be merged, like the standalone hadd program.
 #endif
 
 #include <cstring>
+#include <memory>
+#include <vector>
 
 ClassImp(TFileMerger);
 
@@ -58,6 +80,68 @@ TClassRef R__TTree_Class("TTree");
 
 static const Int_t kCpProgress = BIT(14);
 static const Int_t kCintFileNumber = 100;
+
+namespace {
+/// A histogram read from the first source, with the same-name objects of the
+/// other sources, waiting to be merged on the thread pool.
+struct R__PendingMerge {
+   TObject *fObj;
+   TClass *fClass;
+   TString fName;
+   std::unique_ptr<TList> fInputs;
+   std::unique_ptr<TFileMergeInfo> fInfo;
+   Long64_t fSize; ///< Uncompressed size of the inputs
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Merge the pending histograms concurrently, then write them to the target
+/// in the order they were read. Return kFALSE if one of them could not be written.
+
+Bool_t R__MergePending(TDirectory *target, std::vector<R__PendingMerge> &pending)
+{
+   if (pending.empty())
+      return kTRUE;
+
+#ifdef R__USE_IMT
+   auto mergeOne = [&pending](std::size_t i) {
+      // do not let the temporary clones of the histogram merger get attached to a directory
+      TDirectory::TContext ctxt(nullptr);
+      auto &p = pending[i];
+      Long64_t result = p.fClass->GetMerge()(p.fObj, p.fInputs.get(), p.fInfo.get());
+      if (result < 0)
+         Error("MergeRecursive", "calling Merge() on '%s' with the corresponding objects of the other sources",
+               p.fObj->GetName());
+   };
+   ROOT::TThreadExecutor pool;
+   pool.Foreach(mergeOne, ROOT::TSeq<std::size_t>(pending.size()));
+#endif
+
+   Bool_t status = kTRUE;
+   target->cd();
+   for (auto &p : pending) {
+      p.fInputs->Delete();
+      if (p.fObj->Write(p.fName, TObject::kOverwrite) <= 0)
+         status = kFALSE;
+      p.fObj->ResetBit(kMustCleanup);
+      p.fClass->Destructor(p.fObj);
+   }
+   pending.clear();
+   return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Estimate the memory used by the list of keys of a directory.
+
+Long64_t R__KeysMemory(TDirectory *dir)
+{
+   Long64_t size = 0;
+   TIter next(dir->GetListOfKeys());
+   while (TKey *key = (TKey *)next())
+      size += sizeof(TKey) + std::strlen(key->GetName()) + std::strlen(key->GetTitle()) +
+              std::strlen(key->GetClassName());
+   return size;
+}
+} // anonymous namespace
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the maximum number of allowed opened files minus some wiggle room
 /// for CINT or at least of the standard library (stdio).
@@ -117,6 +201,7 @@ TFileMerger::~TFileMerger()
 void TFileMerger::Reset()
 {
    fFileList.Clear();
+   fOpenedKeysSize = 0;
    fMergeList.Clear();
    fExcessFiles.Clear();
    fObjectNames.Clear();
@@ -134,7 +219,7 @@ Bool_t TFileMerger::AddFile(const char *url, Bool_t cpProgress)
    TFile *newfile = 0;
    TString localcopy;
 
-   if (fFileList.GetEntries() >= (fMaxOpenedFiles-1)) {
+   if (!CanOpenAnotherFile()) {
 
       TObjString *urlObj = new TObjString(url);
       fMergeList.Add(urlObj);
@@ -177,7 +262,7 @@ Bool_t TFileMerger::AddFile(const char *url, Bool_t cpProgress)
       if (fOutputFile && fOutputFile->GetCompressionLevel() != newfile->GetCompressionLevel()) fCompressionChange = kTRUE;
 
       newfile->SetBit(kCanDelete);
-      fFileList.Add(newfile);
+      AddToFileList(newfile);
 
       TObjString *urlObj = new TObjString(url);
       fMergeList.Add(urlObj);
@@ -261,7 +346,7 @@ Bool_t TFileMerger::AddFile(TFile *source, Bool_t own, Bool_t cpProgress)
       } else {
          newfile->ResetBit(kCanDelete);
       }
-      fFileList.Add(newfile);
+      AddToFileList(newfile);
 
       TObjString *urlObj = new TObjString(source->GetName());
       fMergeList.Add(urlObj);
@@ -411,6 +496,15 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
       info.fOptions.Append(" fast");
    }
 
+   // Histograms whose Merge call is deferred, to run several of them concurrently
+   std::vector<R__PendingMerge> pending;
+   Bool_t deferHistos = kFALSE;
+   std::size_t maxPending = 0;
+#ifdef R__USE_IMT
+   deferHistos = fHistoOneGo && ROOT::IsImplicitMTEnabled();
+   maxPending = 2 * ROOT::GetThreadPoolSize();
+#endif
+
    TFile      *current_file;
    TDirectory *current_sourcedir;
    if (type & kIncremental) {
@@ -519,6 +613,12 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
                     key->GetClassName(), obj->IsA()->GetName(), obj->IsA()->GetName());
                cl = obj->IsA();
             }
+            // Anything else than a histogram to defer might write to the target: write the
+            // pending histograms first, to keep the order of the keys
+            Bool_t defer = deferHistos && !alreadyseen && cl->GetMerge() && cl->InheritsFrom(R__TH1_Class) &&
+                           (current_file ? sourcelist->After(current_file) : sourcelist->First());
+            if (!defer && !R__MergePending(target, pending))
+               status = kFALSE;
             Bool_t canBeMerged = kTRUE;
 
             if ( cl->InheritsFrom( TDirectory::Class() ) ) {
@@ -554,6 +654,7 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
                if (alreadyseen) continue;
 
                TList inputs;
+               Long64_t inputsSize = 0;
                Bool_t oneGo = fHistoOneGo && cl->InheritsFrom(R__TH1_Class);
 
                // Loop over all source files and merge same-name object
@@ -587,7 +688,9 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
                            }
                            hobj->ResetBit(kMustCleanup);
                            inputs.Add(hobj);
-                           if (!oneGo) {
+                           inputsSize += key2->GetObjlen();
+                           // in one go, still merge the inputs read so far once they reach the memory budget
+                           if (!oneGo || (fMemoryBudget > 0 && inputsSize >= fMemoryBudget / 2)) {
                               ROOT::MergeFunc_t func = cl->GetMerge();
                               Long64_t result = func(obj, &inputs, &info);
                               info.fIsFirst = kFALSE;
@@ -596,11 +699,34 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
                                        obj->GetName(), nextsource->GetName());
                               }
                               inputs.Delete();
+                              inputsSize = 0;
                            }
                         }
                      }
                      nextsource = (TFile*)sourcelist->After( nextsource );
                   } while (nextsource);
+                  if (defer) {
+                     // the Merge call runs later, on the thread pool, with its own merge info
+                     std::unique_ptr<TList> pendingInputs(new TList);
+                     TIter nextinput(&inputs);
+                     while (TObject *input = nextinput())
+                        pendingInputs->Add(input);
+                     inputs.Clear("nodelete");
+                     std::unique_ptr<TFileMergeInfo> pendingInfo(new TFileMergeInfo(target));
+                     pendingInfo->fIOFeatures = info.fIOFeatures;
+                     pendingInfo->fOptions = info.fOptions;
+                     pendingInfo->fIsFirst = info.fIsFirst;
+                     pending.push_back(
+                        {obj, cl, key->GetName(), std::move(pendingInputs), std::move(pendingInfo), inputsSize});
+                     oldkeyname = key->GetName();
+                     Long64_t pendingSize = 0;
+                     for (const auto &p : pending)
+                        pendingSize += p.fSize;
+                     if ((pending.size() >= maxPending || (fMemoryBudget > 0 && pendingSize >= fMemoryBudget / 2)) &&
+                         !R__MergePending(target, pending))
+                        status = kFALSE;
+                     continue;
+                  }
                   // Merge the list, if still to be done
                   if (oneGo || info.fIsFirst) {
                      ROOT::MergeFunc_t func = cl->GetMerge();
@@ -815,6 +941,9 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
          current_sourcedir = 0;
       }
    }
+   if (!R__MergePending(target, pending))
+      status = kFALSE;
+
    // save modifications to the target directory.
    if (!(type&kIncremental)) {
       // In case of incremental build, we will call Write on the top directory/file, so we do not need
@@ -907,6 +1036,11 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
          }
       }
       fFileList.Clear();
+      fOpenedKeysSize = 0;
+      if (fPrintLevel > 0 && fExcessFiles.GetEntries() > 0) {
+         Printf("%s Merged %d of %d source files", fMsgPrefix.Data(),
+                fMergeList.GetEntries() - fExcessFiles.GetEntries(), fMergeList.GetEntries());
+      }
       if (result && fExcessFiles.GetEntries() > 0) {
          // We merge the first set of files in the output,
          // we now need to open the next set and make
@@ -939,20 +1073,40 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Open up to fMaxOpenedFiles of the excess files.
+/// Return kTRUE if another source can be opened: fewer than fMaxOpenedFiles are
+/// open and, if a memory budget is set, their lists of keys use less than half of it.
+
+Bool_t TFileMerger::CanOpenAnotherFile() const
+{
+   if (fFileList.GetEntries() >= (fMaxOpenedFiles-1))
+      return kFALSE;
+   return fMemoryBudget <= 0 || fFileList.IsEmpty() || fOpenedKeysSize < fMemoryBudget / 2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add an open source to the files to merge in the current round.
+
+void TFileMerger::AddToFileList(TFile *file)
+{
+   fFileList.Add(file);
+   if (fMemoryBudget > 0)
+      fOpenedKeysSize += R__KeysMemory(file);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Open up to fMaxOpenedFiles of the excess files, within the memory budget.
 
 Bool_t TFileMerger::OpenExcessFiles()
 {
    if (fPrintLevel > 0) {
       Printf("%s Opening the next %d files", fMsgPrefix.Data(), TMath::Min(fExcessFiles.GetEntries(), fMaxOpenedFiles - 1));
    }
-   Int_t nfiles = 0;
    TIter next(&fExcessFiles);
    TObjString *url = 0;
    TString localcopy;
    // We want gDirectory untouched by anything going on here
    TDirectory::TContext ctxt;
-   while( nfiles < (fMaxOpenedFiles-1) && ( url = (TObjString*)next() ) ) {
+   while( CanOpenAnotherFile() && ( url = (TObjString*)next() ) ) {
       TFile *newfile = 0;
       if (fLocal) {
          TUUID uuid;
@@ -977,8 +1131,7 @@ Bool_t TFileMerger::OpenExcessFiles()
          if (fOutputFile && fOutputFile->GetCompressionLevel() != newfile->GetCompressionLevel()) fCompressionChange = kTRUE;
 
          newfile->SetBit(kCanDelete);
-         fFileList.Add(newfile);
-         ++nfiles;
+         AddToFileList(newfile);
          fExcessFiles.Remove(url);
       }
    }
@@ -24,6 +24,11 @@
 #include <cctype>
 #include <cassert>
 
+#ifndef R__WIN32
+#include <cerrno>
+#include <unistd.h>
+#endif
+
 static const int kMAX_READ_SIZE    = 2;   //maximum size of the read list of blocks
 
 inline int xtod(char c) { return (c>='0' && c<='9') ? c-'0' : ((c>='A' && c<='F') ? c-'A'+10 : ((c>='a' && c<='f') ? c-'a'+10 : 0)); }
@@ -45,6 +50,12 @@ processing considerably decreases. Besides the prefetching
 mechanisms there is also a local caching option which can be
 enabled by the user. Both capabilities are disabled by default
 and must be explicitly enabled by the user.
+
+Remote files are read with their TFile::ReadBuffers, which their
+implementations (e.g. TNetXNGFile, TDavixFile) allow to call from the
+prefetching thread. Plain local files are read with positional reads
+on their file descriptor instead, which neither move the file offset
+nor touch the file cache used by the main thread.
 */
 
 
@@ -55,7 +66,8 @@ TFilePrefetch::TFilePrefetch(TFile* file) :
   fFile(file),
   fConsumer(0),
   fThreadJoined(kTRUE),
-  fPrefetchFinished(kFALSE)
+  fPrefetchFinished(kFALSE),
+  fReadLocal(CanReadLocal(file))
 {
    fPendingBlocks    = new TList();
    fReadBlocks       = new TList();
@@ -100,6 +112,65 @@ void TFilePrefetch::WaitFinishPrefetch()
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the blocks of the file can be read with positional reads
+/// from its file descriptor, i.e. if it is a plain local file.
+
+Bool_t TFilePrefetch::CanReadLocal(TFile *file)
+{
+#ifndef R__WIN32
+   return file && file->IsA() == TFile::Class() && file->GetFd() >= 0 &&
+          !strcmp(file->GetEndpointUrl()->GetProtocol(), "file");
+#else
+   (void)file;
+   return kFALSE;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read all the pieces of a block from a local file with positional reads.
+/// Return false in case of error.
+
+Bool_t TFilePrefetch::ReadLocal(TFPBlock *block)
+{
+#ifndef R__WIN32
+   Double_t start = 0;
+   if (gPerfStats) start = TTimeStamp();
+
+   const Int_t fd = fFile->GetFd();
+   for (Int_t i = 0; i < block->GetNoElem(); i++) {
+      char *dest = block->GetPtrToPiece(i);
+      Long64_t pos = block->GetPos(i) + fFile->GetArchiveOffset();
+      Long64_t remaining = block->GetLen(i);
+      while (remaining > 0) {
+         auto siz = ::pread(fd, dest, remaining, pos);
+         if (siz < 0 && errno == EINTR)
+            continue;
+         if (siz <= 0) {
+            Error("ReadLocal", "error reading %lld bytes at position %lld from file %s", remaining, pos,
+                  fFile->GetName());
+            return kFALSE;
+         }
+         dest += siz;
+         pos += siz;
+         remaining -= siz;
+      }
+   }
+
+   const auto length = block->GetDataSize();
+   fFile->fBytesRead  += length;
+   fFile->fgBytesRead += length;
+   fFile->SetReadCalls(fFile->GetReadCalls() + 1);
+   fFile->fgReadCalls++;
+   if (gPerfStats)
+      gPerfStats->FileReadEvent(fFile, length, start);
+   return kTRUE;
+#else
+   (void)block;
+   return kFALSE;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read one block and insert it in prefetchBuffers list.
 
@@ -111,6 +182,10 @@ void TFilePrefetch::ReadAsync(TFPBlock* block, Bool_t &inCache)
       block->SetBuffer(GetBlockFromCache(path, block->GetDataSize()));
       inCache = kTRUE;
    }
+   else if (fReadLocal) {
+      ReadLocal(block);
+      inCache = kFALSE;
+   }
    else{
       fFile->ReadBuffers(block->GetBuffer(), block->GetPos(), block->GetLen(), block->GetNoElem());
       if (fFile->GetArchive()) {
@@ -333,6 +408,7 @@ void TFilePrefetch::SetFile(TFile *file, TFile::ECacheAction action)
       }
 
       fFile = file;
+      fReadLocal = CanReadLocal(file);
       if (!fThreadJoined) {
         fSemChangeFile->Post();
       }
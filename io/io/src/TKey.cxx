@@ -66,6 +66,7 @@
 #include "ThreadLocalStorage.h"
 
 #include "RZip.h"
+#include "ROOT/RZipBlocks.hxx"
 
 const Int_t kTitleMax = 32000;
 #if 0
@@ -241,7 +242,7 @@ TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* moth
 
    Build(motherDir, obj->ClassName(), -1);
 
-   Int_t lbuf, nout, noutot, bufmax, nzip;
+   Int_t lbuf, noutot;
    fBufferRef = new TBufferFile(TBuffer::kWrite, bufsize);
    fBufferRef->SetParent(GetFile());
    fCycle     = fMotherDir->AppendKey(this);
@@ -261,23 +262,15 @@ TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* moth
       fBuffer = new char[buflen];
       char *objbuf = fBufferRef->Buffer() + fKeylen;
       char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else               bufmax = kMAXZIPBUF;
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-         if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen);
-            fBufferRef->SetBufferOffset(0);
-            Streamer(*fBufferRef);         //write key itself again
-            return;
-         }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
+      // The blocks of objects larger than kMAXZIPBUF are compressed concurrently with IMT.
+      noutot = ROOT::Internal::ZipBlocks(cxlevel, cxAlgorithm, objbuf, fObjlen, bufcur);
+      if (noutot == 0) { //this happens when the buffer cannot be compressed
+         delete [] fBuffer;
+         fBuffer = fBufferRef->Buffer();
+         Create(fObjlen);
+         fBufferRef->SetBufferOffset(0);
+         Streamer(*fBufferRef);         //write key itself again
+         return;
       }
       Create(noutot);
       fBufferRef->SetBufferOffset(0);
@@ -337,7 +330,7 @@ TKey::TKey(const void *obj, const TClass *cl, const char *name, Int_t bufsize, T
    Streamer(*fBufferRef);         //write key itself
    fKeylen    = fBufferRef->Length();
 
-   Int_t lbuf, nout, noutot, bufmax, nzip;
+   Int_t lbuf, noutot;
 
    fBufferRef->MapObject(actualStart,clActual);         //register obj in map in case of self reference
    clActual->Streamer((void*)actualStart, *fBufferRef); //write object
@@ -352,23 +345,15 @@ TKey::TKey(const void *obj, const TClass *cl, const char *name, Int_t bufsize, T
       fBuffer = new char[buflen];
       char *objbuf = fBufferRef->Buffer() + fKeylen;
       char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else               bufmax = kMAXZIPBUF;
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-         if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen);
-            fBufferRef->SetBufferOffset(0);
-            Streamer(*fBufferRef);         //write key itself again
-            return;
-         }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
+      // The blocks of objects larger than kMAXZIPBUF are compressed concurrently with IMT.
+      noutot = ROOT::Internal::ZipBlocks(cxlevel, cxAlgorithm, objbuf, fObjlen, bufcur);
+      if (noutot == 0) { //this happens when the buffer cannot be compressed
+         delete [] fBuffer;
+         fBuffer = fBufferRef->Buffer();
+         Create(fObjlen);
+         fBufferRef->SetBufferOffset(0);
+         Streamer(*fBufferRef);         //write key itself again
+         return;
       }
       Create(noutot);
       fBufferRef->SetBufferOffset(0);
@@ -527,7 +512,9 @@ void TKey::Create(Int_t nbytes, TFile* externFile)
 
 TKey::~TKey()
 {
-   if (fMotherDir && fMotherDir->GetListOfKeys())
+   if (auto dir = dynamic_cast<TDirectoryFile *>(fMotherDir))
+      dir->ForgetKey(this);
+   else if (fMotherDir && fMotherDir->GetListOfKeys())
       fMotherDir->GetListOfKeys()->Remove(this);
    TKey::DeleteBuffer();
 }
@@ -756,6 +743,9 @@ TObject *TKey::ReadObj()
       return 0;
    }
    if (GetFile()==0) return 0;
+   // Directories are read without StreamerInfo
+   if (!cl->InheritsFrom(TDirectoryFile::Class()) && !GetFile()->ReadPendingStreamerInfo())
+      return 0;
    bufferRef.SetParent(GetFile());
    bufferRef.SetPidOffset(fPidOffset);
 
@@ -808,18 +798,7 @@ TObject *TKey::ReadObj()
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
       UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = ROOT::Internal::UnzipBlocks(bufcur, fNbytes - fKeylen, objbuf, fObjlen);
       compressedBuffer.reset(nullptr);
       if (nout) {
          tobj->Streamer(bufferRef); //does not work with example 2 above
@@ -891,6 +870,8 @@ TObject *TKey::ReadObjWithBuffer(char *bufferRead)
       return 0;
    }
    if (GetFile()==0) return 0;
+   if (!cl->InheritsFrom(TDirectoryFile::Class()) && !GetFile()->ReadPendingStreamerInfo())
+      return 0;
    bufferRef.SetParent(GetFile());
    bufferRef.SetPidOffset(fPidOffset);
 
@@ -933,18 +914,7 @@ TObject *TKey::ReadObjWithBuffer(char *bufferRead)
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
       UChar_t *bufcur = (UChar_t *)&bufferRead[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = ROOT::Internal::UnzipBlocks(bufcur, fNbytes - fKeylen, objbuf, fObjlen);
       if (nout) {
          tobj->Streamer(bufferRef); //does not work with example 2 above
       } else {
@@ -1011,6 +981,7 @@ void *TKey::ReadObjectAny(const TClass* expectedClass)
       return 0;
    }
    if (GetFile()==0) return 0;
+   if (!GetFile()->ReadPendingStreamerInfo()) return 0;
    bufferRef.SetParent(GetFile());
    bufferRef.SetPidOffset(fPidOffset);
 
@@ -1077,18 +1048,7 @@ void *TKey::ReadObjectAny(const TClass* expectedClass)
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
       UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = ROOT::Internal::UnzipBlocks(bufcur, fNbytes - fKeylen, objbuf, fObjlen);
       if (nout) {
          cl->Streamer((void*)pobj, bufferRef, clOnfile);    //read object
       } else {
@@ -1140,6 +1100,7 @@ void *TKey::ReadObjectAny(const TClass* expectedClass)
 Int_t TKey::Read(TObject *obj)
 {
    if (!obj || (GetFile()==0)) return 0;
+   if (!GetFile()->ReadPendingStreamerInfo()) return 0;
 
    TBufferFile bufferRef(TBuffer::kRead, fObjlen+fKeylen);
    bufferRef.SetParent(GetFile());
@@ -1165,18 +1126,7 @@ Int_t TKey::Read(TObject *obj)
    if (fObjlen > fNbytes-fKeylen) {
       char *objbuf = bufferRef.Buffer() + fKeylen;
       UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = ROOT::Internal::UnzipBlocks(bufcur, fNbytes - fKeylen, objbuf, fObjlen);
       if (nout) obj->Streamer(bufferRef);
    } else {
       obj->Streamer(bufferRef);
@@ -27,6 +27,8 @@ only from memory.
 #include "TKey.h"
 #include "TClass.h"
 #include "TVirtualMutex.h"
+#include "ROOT/RMakeUnique.hxx"
+#include <algorithm>
 #include <errno.h>
 #include <stdio.h>
 #include <sys/stat.h>
@@ -171,6 +173,29 @@ TMemFile::TMemFile(const char *path, char *buffer, Long64_t size, Option_t *opti
                    Long64_t defBlockSize)
    : TFile(path, "WEB", ftitle, compress), fBlockList(size), fIsOwnedByROOT(kTRUE), fSize(size),
      fBlockSeek(&(fBlockList))
+{
+   InitMemFile(path, option, defBlockSize, buffer);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor adopting the file content in buffer, of length size, without
+/// copying it. The buffer must have been allocated with new[] and is deleted
+/// with the TMemFile; it holds the first block of memory of the file, which
+/// can thus be opened in any mode. See the TFile constructor for details.
+
+TMemFile::TMemFile(const char *path, std::unique_ptr<char[]> buffer, Long64_t size, Option_t *option,
+                   const char *ftitle, Int_t compress, Long64_t defBlockSize)
+   : TFile(path, "WEB", ftitle, compress), fBlockList(reinterpret_cast<UChar_t *>(buffer.release()), size),
+     fIsOwnedByROOT(kTRUE), fSize(size), fBlockSeek(&(fBlockList))
+{
+   InitMemFile(path, option, defBlockSize, nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Open the memory file in the mode given by option, after copying content
+/// into its first block if it is not null, and initialize it.
+
+void TMemFile::InitMemFile(const char *path, Option_t *option, Long64_t defBlockSize, const char *content)
 {
    fDefaultBlockSize = defBlockSize == 0LL ? fgDefaultBlockSize : defBlockSize;
 
@@ -196,8 +221,8 @@ TMemFile::TMemFile(const char *path, char *buffer, Long64_t size, Option_t *opti
       fWritable = kFALSE;
    }
 
-   if (buffer)
-      SysWriteImpl(fD,buffer,size);
+   if (content)
+      SysWriteImpl(fD,content,fSize);
 
    Init(!NeedsExistingFile(optmode));
    return;
@@ -284,6 +309,35 @@ void TMemFile::CopyTo(TBuffer &tobuf) const
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Move the binary representation of the TMemFile into a TBufferFile in read
+/// mode, e.g. to be sent or opened as another TMemFile.
+///
+/// If the file is held in a single block of memory that it owns, the block is
+/// handed over without copying it, and the file gets a new empty block, large
+/// enough for the same content. Otherwise its GetEND() bytes are copied.
+/// The file must then be reset with ResetAfterMerge(), or deleted.
+
+std::unique_ptr<TBufferFile> TMemFile::ReleaseBuffer()
+{
+   if (IsExternalData() || fBlockList.fNext || !fBlockList.fBuffer) {
+      auto buffer = std::make_unique<TBufferFile>(TBuffer::kWrite, GetEND());
+      CopyTo(buffer->Buffer(), GetEND());
+      buffer->SetReadMode();
+      return buffer;
+   }
+
+   auto buffer = std::make_unique<TBufferFile>(TBuffer::kRead, fBlockList.fSize, fBlockList.fBuffer);
+   const Long64_t size = std::max(fDefaultBlockSize, GetEND());
+   fBlockList.fBuffer = new UChar_t[size];
+   fBlockList.fSize = size;
+   fSize = size;
+   fSysOffset = 0;
+   fBlockSeek = &fBlockList;
+   fBlockOffset = 0;
+   return buffer;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the current size of the memory file
 
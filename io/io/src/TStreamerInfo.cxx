@@ -2565,14 +2565,14 @@ void TStreamerInfo::Clear(Option_t *option)
       ResetIsCompiled();
       ResetBit(kBuildOldUsed);
 
-      if (fReadObjectWise) fReadObjectWise->fActions.clear();
-      if (fReadMemberWise) fReadMemberWise->fActions.clear();
-      if (fReadMemberWiseVecPtr) fReadMemberWiseVecPtr->fActions.clear();
-      if (fReadText) fReadText->fActions.clear();
-      if (fWriteObjectWise) fWriteObjectWise->fActions.clear();
-      if (fWriteMemberWise) fWriteMemberWise->fActions.clear();
-      if (fWriteMemberWiseVecPtr) fWriteMemberWiseVecPtr->fActions.clear();
-      if (fWriteText) fWriteText->fActions.clear();
+      if (fReadObjectWise) fReadObjectWise->ClearActions();
+      if (fReadMemberWise) fReadMemberWise->ClearActions();
+      if (fReadMemberWiseVecPtr) fReadMemberWiseVecPtr->ClearActions();
+      if (fReadText) fReadText->ClearActions();
+      if (fWriteObjectWise) fWriteObjectWise->ClearActions();
+      if (fWriteMemberWise) fWriteMemberWise->ClearActions();
+      if (fWriteMemberWiseVecPtr) fWriteMemberWiseVecPtr->ClearActions();
+      if (fWriteText) fWriteText->ClearActions();
    }
 }
 
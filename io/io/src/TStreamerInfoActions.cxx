@@ -24,6 +24,10 @@
 #include "TVirtualCollectionIterators.h"
 #include "TProcessID.h"
 #include "TFile.h"
+#include "TEnv.h"
+
+#include <map>
+#include <string>
 
 static const Int_t kRegrouped = TStreamerInfo::kOffsetL;
 
@@ -2966,6 +2970,28 @@ static TConfiguredAction GetCollectionWriteAction(TVirtualStreamerInfo *info, TS
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the object wise actions of the class are to be fused by
+/// JitCompile, as configured by the rootrc key Root.StreamerInfo.Jit: a
+/// space or comma separated list of class names, or '*' for all classes.
+
+static Bool_t IsJitEnabled(const char *classname)
+{
+   TString classes = gEnv ? gEnv->GetValue("Root.StreamerInfo.Jit", "") : "";
+   if (classes.IsNull())
+      return kFALSE;
+   if (classes == "*")
+      return kTRUE;
+   classes.ReplaceAll(",", " ");
+   TString name;
+   Ssiz_t from = 0;
+   while (classes.Tokenize(name, from, " ")) {
+      if (name == classname)
+         return kTRUE;
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// loop on the TStreamerElement list
 /// regroup members with same type
@@ -3006,28 +3032,28 @@ void TStreamerInfo::Compile()
    Int_t ndata = fElements->GetEntries();
 
 
-   if (fReadObjectWise) fReadObjectWise->fActions.clear();
+   if (fReadObjectWise) fReadObjectWise->ClearActions();
    else fReadObjectWise = new TStreamerInfoActions::TActionSequence(this,ndata);
 
-   if (fWriteObjectWise) fWriteObjectWise->fActions.clear();
+   if (fWriteObjectWise) fWriteObjectWise->ClearActions();
    else fWriteObjectWise = new TStreamerInfoActions::TActionSequence(this,ndata);
 
-   if (fReadMemberWise) fReadMemberWise->fActions.clear();
+   if (fReadMemberWise) fReadMemberWise->ClearActions();
    else fReadMemberWise = new TStreamerInfoActions::TActionSequence(this,ndata);
 
-   if (fReadText) fReadText->fActions.clear();
+   if (fReadText) fReadText->ClearActions();
    else fReadText = new TStreamerInfoActions::TActionSequence(this,ndata);
 
-   if (fWriteMemberWise) fWriteMemberWise->fActions.clear();
+   if (fWriteMemberWise) fWriteMemberWise->ClearActions();
    else fWriteMemberWise = new TStreamerInfoActions::TActionSequence(this,ndata);
 
-   if (fReadMemberWiseVecPtr) fReadMemberWiseVecPtr->fActions.clear();
+   if (fReadMemberWiseVecPtr) fReadMemberWiseVecPtr->ClearActions();
    else fReadMemberWiseVecPtr = new TStreamerInfoActions::TActionSequence(this,ndata);
 
-   if (fWriteMemberWiseVecPtr) fWriteMemberWiseVecPtr->fActions.clear();
+   if (fWriteMemberWiseVecPtr) fWriteMemberWiseVecPtr->ClearActions();
    else fWriteMemberWiseVecPtr = new TStreamerInfoActions::TActionSequence(this,ndata);
 
-   if (fWriteText) fWriteText->fActions.clear();
+   if (fWriteText) fWriteText->ClearActions();
    else fWriteText = new TStreamerInfoActions::TActionSequence(this,ndata);
 
    if (!ndata) {
@@ -3205,6 +3231,11 @@ void TStreamerInfo::Compile()
    }
    ComputeSize();
 
+   if (IsJitEnabled(GetName())) {
+      fReadObjectWise->JitCompile(kTRUE);
+      fWriteObjectWise->JitCompile(kFALSE);
+   }
+
    fOptimized = isOptimized;
    SetIsCompiled();
 
@@ -4171,6 +4202,9 @@ void TStreamerInfoActions::TActionSequence::AddToOffset(Int_t delta)
    // Add the (potentially negative) delta to all the configuration's offset.  This is used by
    // TBranchElement in the case of split sub-object.
 
+   // The fused function has the offsets built in.
+   fJitAction = nullptr;
+
    TStreamerInfoActions::ActionContainer_t::iterator end = fActions.end();
    for(TStreamerInfoActions::ActionContainer_t::iterator iter = fActions.begin();
        iter != end;
@@ -4186,6 +4220,8 @@ void TStreamerInfoActions::TActionSequence::SetMissing()
    // Add the (potentially negative) delta to all the configuration's offset.  This is used by
    // TBranchElement in the case of split sub-object.
 
+   fJitAction = nullptr;
+
    TStreamerInfoActions::ActionContainer_t::iterator end = fActions.end();
    for(TStreamerInfoActions::ActionContainer_t::iterator iter = fActions.begin();
        iter != end;
@@ -4196,6 +4232,135 @@ void TStreamerInfoActions::TActionSequence::SetMissing()
    }
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of the basic type and the suffix of the TBufferFile
+/// methods streaming it, or nullptr if the type is not inlined by JitCompile.
+
+const char *GetJitBasicType(Int_t type, const char *&method)
+{
+   switch (type) {
+      case TStreamerInfo::kBool:    method = "Bool";    return "Bool_t";
+      case TStreamerInfo::kChar:    method = "Char";    return "Char_t";
+      case TStreamerInfo::kShort:   method = "Short";   return "Short_t";
+      case TStreamerInfo::kInt:     method = "Int";     return "Int_t";
+      case TStreamerInfo::kLong:    method = "Long";    return "Long_t";
+      case TStreamerInfo::kLong64:  method = "Long64";  return "Long64_t";
+      case TStreamerInfo::kFloat:   method = "Float";   return "Float_t";
+      case TStreamerInfo::kDouble:  method = "Double";  return "Double_t";
+      case TStreamerInfo::kUChar:   method = "UChar";   return "UChar_t";
+      case TStreamerInfo::kUShort:  method = "UShort";  return "UShort_t";
+      case TStreamerInfo::kUInt:    method = "UInt";    return "UInt_t";
+      case TStreamerInfo::kULong:   method = "ULong";   return "ULong_t";
+      case TStreamerInfo::kULong64: method = "ULong64"; return "ULong64_t";
+   }
+   return nullptr;
+}
+
+template <typename T>
+Bool_t IsBasicTypeAction(const TConfiguredAction &action, Bool_t read)
+{
+   return read ? action.fAction == &ReadBasicType<T> : action.fAction == &WriteBasicType<T>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the action is the one AddReadAction or AddWriteAction
+/// create for a member of the basic type.
+
+Bool_t IsBasicTypeAction(const TConfiguredAction &action, Int_t type, Bool_t read)
+{
+   switch (type) {
+      case TStreamerInfo::kBool:    return IsBasicTypeAction<Bool_t>(action, read);
+      case TStreamerInfo::kChar:    return IsBasicTypeAction<Char_t>(action, read);
+      case TStreamerInfo::kShort:   return IsBasicTypeAction<Short_t>(action, read);
+      case TStreamerInfo::kInt:     return IsBasicTypeAction<Int_t>(action, read);
+      case TStreamerInfo::kLong:    return IsBasicTypeAction<Long_t>(action, read);
+      case TStreamerInfo::kLong64:  return IsBasicTypeAction<Long64_t>(action, read);
+      case TStreamerInfo::kFloat:   return IsBasicTypeAction<Float_t>(action, read);
+      case TStreamerInfo::kDouble:  return IsBasicTypeAction<Double_t>(action, read);
+      case TStreamerInfo::kUChar:   return IsBasicTypeAction<UChar_t>(action, read);
+      case TStreamerInfo::kUShort:  return IsBasicTypeAction<UShort_t>(action, read);
+      case TStreamerInfo::kUInt:    return IsBasicTypeAction<UInt_t>(action, read);
+      case TStreamerInfo::kULong:   return IsBasicTypeAction<ULong_t>(action, read);
+      case TStreamerInfo::kULong64: return IsBasicTypeAction<ULong64_t>(action, read);
+   }
+   return kFALSE;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate and compile with the interpreter a single function streaming an
+/// object with all the actions of this object wise sequence, and store it in
+/// fJitAction. The members of basic types and the fixed size arrays of them
+/// are streamed inline by calling the non-virtual TBufferFile methods; the
+/// other actions are called one after the other from the generated function.
+/// Sequences with the same layout share the compiled function.
+/// Return false if nothing could be inlined or the compilation failed, in
+/// which case the actions keep being applied one by one.
+
+Bool_t TStreamerInfoActions::TActionSequence::JitCompile(Bool_t read)
+{
+   fJitAction = nullptr;
+   if (!gInterpreter || fLoopConfig || fActions.empty())
+      return kFALSE;
+
+   TString body;
+   Int_t ninlined = 0;
+   for (std::size_t i = 0; i < fActions.size(); ++i) {
+      const TConfiguredAction &action = fActions[i];
+      const TConfiguration *conf = action.fConfiguration;
+      const Int_t type = conf->fCompInfo ? conf->fCompInfo->fType : -1;
+      const char *method = nullptr;
+      const char *basic = GetJitBasicType(type, method);
+      if (basic && IsBasicTypeAction(action, type, read)) {
+         body += TString::Format("   b.TBufferFile::%s%s(*(%s *)(addr + %d));\n", read ? "Read" : "Write", method, basic,
+                                 conf->fOffset);
+         ++ninlined;
+         continue;
+      }
+      basic = type > TStreamerInfo::kOffsetL ? GetJitBasicType(type - TStreamerInfo::kOffsetL, method) : nullptr;
+      if (basic && action.fAction == (read ? &GenericReadAction : &GenericWriteAction) && conf->fCompInfo->fLength > 0) {
+         body += TString::Format("   b.TBufferFile::%sFastArray((%s *)(addr + %d), %d);\n", read ? "Read" : "Write",
+                                 basic, conf->fCompInfo->fOffset + conf->fOffset, conf->fCompInfo->fLength);
+         ++ninlined;
+         continue;
+      }
+      body += TString::Format("   actions[%d](buf, obj);\n", (Int_t)i);
+   }
+   if (ninlined == 0)
+      return kFALSE;
+
+   R__LOCKGUARD(gInterpreterMutex);
+   static std::map<std::string, JitAction_t> gJitActions;
+   auto &jitted = gJitActions[body.Data()];
+   if (!jitted) {
+      const TString name = TString::Format("JitAction%d", (Int_t)gJitActions.size());
+      TString code = "#include \"TBufferFile.h\"\n#include \"TStreamerInfoActions.h\"\n"
+                     "namespace ROOT { namespace Internal { namespace StreamerInfoJit {\n";
+      code += TString::Format("Int_t %s(TBuffer &buf, void *obj, const TStreamerInfoActions::TConfiguredAction *actions)\n"
+                              "{\n   (void)actions;\n   TBufferFile &b = static_cast<TBufferFile &>(buf);\n"
+                              "   char *addr = (char *)obj;\n",
+                              name.Data());
+      code += body;
+      code += "   return 0;\n}\n} } }\n";
+      if (!gInterpreter->Declare(code)) {
+         ::Warning("TActionSequence::JitCompile", "Could not compile the streaming function of %s",
+                   fStreamerInfo->GetName());
+         gJitActions.erase(body.Data());
+         return kFALSE;
+      }
+      jitted = (JitAction_t)gInterpreter->Calc(("(Long_t)&ROOT::Internal::StreamerInfoJit::" + name).Data());
+      if (!jitted) {
+         gJitActions.erase(body.Data());
+         return kFALSE;
+      }
+   }
+   fJitAction = jitted;
+   return kTRUE;
+}
+
 TStreamerInfoActions::TActionSequence *TStreamerInfoActions::TActionSequence::CreateCopy()
 {
    // Create a copy of this sequence.
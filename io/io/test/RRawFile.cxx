@@ -1,5 +1,7 @@
 #include "RConfigure.h"
+#include "TSystem.h"
 #include "ROOT/RRawFile.hxx"
+#include "ROOT/RRawFileDiskCache.hxx"
 #include "ROOT/RMakeUnique.hxx"
 
 #include <algorithm>
@@ -10,6 +12,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -168,6 +171,116 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, ReadVBatch)
+{
+   std::string content;
+   for (unsigned i = 0; i < 100000; ++i)
+      content.push_back('a' + i % 26);
+   FileRaii readvGuard("test_rawfile_readv_batch", content);
+   auto f = RRawFile::Create("test_rawfile_readv_batch");
+
+   // More requests than fit in a single submission, scattered in reverse order, the last one beyond the end
+   constexpr unsigned kNReq = 300;
+   constexpr unsigned kSize = 300;
+   std::vector<char> buffer(kNReq * kSize);
+   RRawFile::RIOVec iovec[kNReq];
+   for (unsigned i = 0; i < kNReq; ++i) {
+      iovec[i].fBuffer = &buffer[i * kSize];
+      iovec[i].fOffset = (kNReq - 1 - i) * kSize + 7;
+      iovec[i].fSize = kSize;
+   }
+   iovec[kNReq - 1].fOffset = content.size() - 10;
+
+   auto verify = [&]() {
+      for (unsigned i = 0; i < kNReq; ++i) {
+         const auto expected = std::min<size_t>(kSize, content.size() - iovec[i].fOffset);
+         ASSERT_EQ(expected, iovec[i].fOutBytes);
+         EXPECT_EQ(0, memcmp(&buffer[i * kSize], content.data() + iovec[i].fOffset, expected));
+      }
+   };
+   f->ReadV(iovec, kNReq);
+   verify();
+
+   std::fill(buffer.begin(), buffer.end(), 0);
+   auto future = f->ReadVAsync(iovec, kNReq);
+   // Buffered reads of the file can proceed in the meantime
+   char c = 0;
+   EXPECT_EQ(1U, f->ReadAt(&c, 1, 1));
+   EXPECT_EQ('b', c);
+   future.get();
+   verify();
+
+   RRawFile::ROptions options;
+   options.fBlockSize = 0;
+   RRawFileMock m("Hello, World", options);
+   char mbuf[5];
+   iovec[0].fBuffer = mbuf;
+   iovec[0].fOffset = 7;
+   iovec[0].fSize = 5;
+   m.ReadVAsync(iovec, 1).get();
+   EXPECT_EQ(5U, iovec[0].fOutBytes);
+   EXPECT_EQ(0, memcmp(mbuf, "World", 5));
+   // The asynchronous read went through a clone of the mock
+   EXPECT_EQ(0U, m.fNumReadAt);
+}
+
+
+TEST(RRawFile, DiskCache)
+{
+   using RRawFileDiskCache = ROOT::Internal::RRawFileDiskCache;
+   constexpr auto kBlockSize = RRawFileDiskCache::kCacheBlockSize;
+   std::string content;
+   for (unsigned i = 0; i < 2 * kBlockSize + 100; ++i)
+      content.push_back('a' + i % 26);
+   const std::string cacheDir = "test_rawfile_diskcache";
+   gSystem->mkdir(cacheDir.c_str());
+
+   RRawFile::ROptions options;
+   options.fBlockSize = 0;
+   char buffer[2][200];
+   RRawFile::RIOVec iovec[2];
+   // Across the first and the second block, and in the last, short block
+   iovec[0].fBuffer = buffer[0];
+   iovec[0].fOffset = kBlockSize - 100;
+   iovec[0].fSize = 200;
+   iovec[1].fBuffer = buffer[1];
+   iovec[1].fOffset = 2 * kBlockSize;
+   iovec[1].fSize = 200;
+   auto verify = [&]() {
+      EXPECT_EQ(200U, iovec[0].fOutBytes);
+      EXPECT_EQ(0, memcmp(buffer[0], content.data() + kBlockSize - 100, 200));
+      EXPECT_EQ(100U, iovec[1].fOutBytes);
+      EXPECT_EQ(0, memcmp(buffer[1], content.data() + 2 * kBlockSize, 100));
+   };
+
+   auto remote = new RRawFileMock(content, options);
+   RRawFileDiskCache first(std::unique_ptr<RRawFile>(remote), cacheDir, options);
+   first.ReadV(iovec, 2);
+   verify();
+   EXPECT_EQ(3U, remote->fNumReadAt);
+
+   // Another instance, as in another process, finds all the blocks in the cache
+   memset(buffer, 0, sizeof(buffer));
+   remote = new RRawFileMock(content, options);
+   RRawFileDiskCache second(std::unique_ptr<RRawFile>(remote), cacheDir, options);
+   second.ReadV(iovec, 2);
+   verify();
+   char c = 0;
+   EXPECT_EQ(1U, second.ReadAt(&c, 1, 3));
+   EXPECT_EQ('d', c);
+   EXPECT_EQ(0U, second.ReadAt(&c, 1, content.size()));
+   EXPECT_EQ(0U, remote->fNumReadAt);
+
+   // A file of another size does not use the same blocks
+   remote = new RRawFileMock(content.substr(0, 1000), options);
+   RRawFileDiskCache other(std::unique_ptr<RRawFile>(remote), cacheDir, options);
+   EXPECT_EQ(1U, other.ReadAt(&c, 1, 0));
+   EXPECT_EQ(1U, remote->fNumReadAt);
+
+   gSystem->Exec(("rm -rf " + cacheDir).c_str());
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
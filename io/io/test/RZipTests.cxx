@@ -0,0 +1,142 @@
+#include "RZip.h"
+#include "Compression.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int kHeaderSize = 9;
+
+/// Text-like data that compresses well, with some pseudo-random noise
+std::vector<char> MakeData(std::size_t size)
+{
+   std::vector<char> data(size);
+   unsigned int seed = 12345;
+   const std::string words = "the quick brown fox jumps over the lazy dog ";
+   for (std::size_t i = 0; i < size; ++i) {
+      seed = seed * 1103515245u + 12345u;
+      data[i] = (seed >> 28) == 0 ? char(seed >> 16) : words[i % words.size()];
+   }
+   return data;
+}
+
+std::vector<unsigned char>
+Compress(std::vector<char> &data, int level, ROOT::RCompressionSetting::EAlgorithm::EValues algorithm)
+{
+   int srcSize = data.size();
+   int tgtSize = data.size() + kHeaderSize + 1024;
+   std::vector<unsigned char> compressed(tgtSize);
+   int nout = 0;
+   R__zipMultipleAlgorithm(level, &srcSize, data.data(), &tgtSize, reinterpret_cast<char *>(compressed.data()),
+                           &nout, algorithm);
+   compressed.resize(nout);
+   return compressed;
+}
+
+/// Sets the compressed size recorded in the header of the buffer
+void SetCompressedSize(std::vector<unsigned char> &buffer, int size)
+{
+   buffer[3] = size & 0xff;
+   buffer[4] = (size >> 8) & 0xff;
+   buffer[5] = (size >> 16) & 0xff;
+}
+
+} // namespace
+
+TEST(RZip, OldCompressionAlgoRoundTrip)
+{
+   auto data = MakeData(200000);
+   for (int level : {1, 6, 9}) {
+      auto compressed = Compress(data, level, ROOT::RCompressionSetting::EAlgorithm::kOldCompressionAlgo);
+      ASSERT_GT(compressed.size(), std::size_t(kHeaderSize)) << "level " << level;
+      EXPECT_LT(compressed.size(), data.size()) << "level " << level;
+      EXPECT_EQ('C', compressed[0]);
+      EXPECT_EQ('S', compressed[1]);
+
+      int srcSize = compressed.size();
+      int tgtSize = data.size();
+      std::vector<char> uncompressed(tgtSize);
+      int nout = 0;
+      R__unzip(&srcSize, compressed.data(), &tgtSize, reinterpret_cast<unsigned char *>(uncompressed.data()), &nout);
+      EXPECT_EQ(int(data.size()), nout) << "level " << level;
+      EXPECT_EQ(data, uncompressed) << "level " << level;
+
+      // The same buffers decoded again, by the reused inflate stream of the thread
+      std::vector<char> again(tgtSize);
+      R__unzip(&srcSize, compressed.data(), &tgtSize, reinterpret_cast<unsigned char *>(again.data()), &nout);
+      EXPECT_EQ(data, again) << "level " << level;
+   }
+}
+
+TEST(RZip, OldCompressionAlgoFallback)
+{
+   auto data = MakeData(50000);
+   auto compressed = Compress(data, 6, ROOT::RCompressionSetting::EAlgorithm::kOldCompressionAlgo);
+   ASSERT_GT(compressed.size(), std::size_t(kHeaderSize));
+
+   // A header that records more bytes than the stream holds: zlib does not reach the recorded size, R__Inflate
+   // decodes the buffer as it always did
+   {
+      auto buffer = compressed;
+      const int isize = data.size() + 1;
+      buffer[6] = isize & 0xff;
+      buffer[7] = (isize >> 8) & 0xff;
+      buffer[8] = (isize >> 16) & 0xff;
+      int srcSize = buffer.size();
+      int tgtSize = isize;
+      std::vector<char> uncompressed(tgtSize);
+      int nout = 0;
+      R__unzip(&srcSize, buffer.data(), &tgtSize, reinterpret_cast<unsigned char *>(uncompressed.data()), &nout);
+      EXPECT_EQ(isize, nout);
+      EXPECT_TRUE(std::equal(data.begin(), data.end(), uncompressed.begin()));
+   }
+
+   // A truncated buffer
+   {
+      auto buffer = compressed;
+      const int truncatedSize = (buffer.size() - kHeaderSize) / 2;
+      buffer.resize(kHeaderSize + truncatedSize);
+      SetCompressedSize(buffer, truncatedSize);
+      int srcSize = buffer.size();
+      int tgtSize = data.size();
+      std::vector<char> uncompressed(tgtSize);
+      int nout = -1;
+      R__unzip(&srcSize, buffer.data(), &tgtSize, reinterpret_cast<unsigned char *>(uncompressed.data()), &nout);
+      EXPECT_EQ(0, nout);
+   }
+
+   // A corrupt buffer: the first deflate block has the reserved block type
+   {
+      auto buffer = compressed;
+      buffer[kHeaderSize] |= 0x06;
+      int srcSize = buffer.size();
+      int tgtSize = data.size();
+      std::vector<char> uncompressed(tgtSize);
+      int nout = -1;
+      R__unzip(&srcSize, buffer.data(), &tgtSize, reinterpret_cast<unsigned char *>(uncompressed.data()), &nout);
+      EXPECT_EQ(0, nout);
+   }
+}
+
+TEST(RZip, ZLIBRoundTrip)
+{
+   auto data = MakeData(200000);
+   for (int level : {1, 6, 9}) {
+      auto compressed = Compress(data, level, ROOT::RCompressionSetting::EAlgorithm::kZLIB);
+      ASSERT_GT(compressed.size(), std::size_t(kHeaderSize)) << "level " << level;
+      EXPECT_EQ('Z', compressed[0]);
+      EXPECT_EQ('L', compressed[1]);
+
+      int srcSize = compressed.size();
+      int tgtSize = data.size();
+      std::vector<char> uncompressed(tgtSize);
+      int nout = 0;
+      R__unzip(&srcSize, compressed.data(), &tgtSize, reinterpret_cast<unsigned char *>(uncompressed.data()), &nout);
+      EXPECT_EQ(int(data.size()), nout) << "level " << level;
+      EXPECT_EQ(data, uncompressed) << "level " << level;
+   }
+}
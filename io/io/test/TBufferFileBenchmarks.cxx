@@ -0,0 +1,63 @@
+#include "TBufferFile.h"
+#include "TNamed.h"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+static void BM_TBufferFile_WriteFastArrayDouble(benchmark::State &state)
+{
+   std::vector<Double_t> values(state.range(0), 1.5);
+   TBufferFile buf(TBuffer::kWrite, values.size() * sizeof(Double_t) + 64);
+   for (auto _ : state) {
+      buf.SetBufferOffset(0);
+      buf.WriteFastArray(values.data(), values.size());
+      benchmark::DoNotOptimize(buf.Buffer());
+   }
+   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(Double_t));
+}
+BENCHMARK(BM_TBufferFile_WriteFastArrayDouble)->Range(8, 1 << 16);
+
+static void BM_TBufferFile_ReadFastArrayDouble(benchmark::State &state)
+{
+   std::vector<Double_t> values(state.range(0), 1.5);
+   TBufferFile wbuf(TBuffer::kWrite);
+   wbuf.WriteFastArray(values.data(), values.size());
+   TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+   for (auto _ : state) {
+      rbuf.SetBufferOffset(0);
+      rbuf.ReadFastArray(values.data(), values.size());
+      benchmark::DoNotOptimize(values.data());
+   }
+   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(Double_t));
+}
+BENCHMARK(BM_TBufferFile_ReadFastArrayDouble)->Range(8, 1 << 16);
+
+static void BM_TBufferFile_WriteFastArrayInt(benchmark::State &state)
+{
+   std::vector<Int_t> values(state.range(0), 7);
+   TBufferFile buf(TBuffer::kWrite, values.size() * sizeof(Int_t) + 64);
+   for (auto _ : state) {
+      buf.SetBufferOffset(0);
+      buf.WriteFastArray(values.data(), values.size());
+      benchmark::DoNotOptimize(buf.Buffer());
+   }
+   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(Int_t));
+}
+BENCHMARK(BM_TBufferFile_WriteFastArrayInt)->Range(8, 1 << 16);
+
+// Streaming of a small object through its dictionary, dominated by the per-object overhead
+static void BM_TBufferFile_StreamTNamed(benchmark::State &state)
+{
+   TNamed named("name", "a title of a typical length");
+   TBufferFile wbuf(TBuffer::kWrite);
+   for (auto _ : state) {
+      wbuf.SetBufferOffset(0);
+      named.Streamer(wbuf);
+      TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+      TNamed read;
+      read.Streamer(rbuf);
+      benchmark::DoNotOptimize(read.GetTitle());
+   }
+}
+BENCHMARK(BM_TBufferFile_StreamTNamed);
@@ -0,0 +1,90 @@
+#include "TBufferFile.h"
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+// Sizes around the width of the SIMD registers used to swap the bytes
+static const std::vector<Int_t> kSizes{1, 3, 4, 7, 8, 15, 16, 17, 33, 1027};
+
+template <typename T>
+static void CheckRoundTrip()
+{
+   for (auto n : kSizes) {
+      std::vector<T> values(n);
+      for (Int_t i = 0; i < n; ++i)
+         values[i] = static_cast<T>((i * 977 + 13) % 251 - 100);
+      TBufferFile wbuf(TBuffer::kWrite);
+      wbuf.WriteFastArray(values.data(), n);
+      wbuf.WriteArray(values.data(), n);
+
+      TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+      std::vector<T> read(n);
+      rbuf.ReadFastArray(read.data(), n);
+      EXPECT_EQ(read, values);
+      std::vector<T> readStatic(n);
+      EXPECT_EQ(rbuf.ReadStaticArray(readStatic.data()), n);
+      EXPECT_EQ(readStatic, values);
+      EXPECT_EQ(rbuf.Length(), wbuf.Length());
+   }
+}
+
+TEST(TBufferFile, FastArrayRoundTrip)
+{
+   CheckRoundTrip<Short_t>();
+   CheckRoundTrip<UShort_t>();
+   CheckRoundTrip<Int_t>();
+   CheckRoundTrip<UInt_t>();
+   CheckRoundTrip<Long64_t>();
+   CheckRoundTrip<ULong64_t>();
+   CheckRoundTrip<Float_t>();
+   CheckRoundTrip<Double_t>();
+}
+
+TEST(TBufferFile, FastArrayByteOrder)
+{
+   // the values are stored in network byte order, i.e. big endian
+   const Int_t ints[] = {0x01020304, 0x05060708};
+   const Double_t doubles[] = {1.};
+   TBufferFile wbuf(TBuffer::kWrite);
+   wbuf.WriteFastArray(ints, 2);
+   wbuf.WriteFastArray(doubles, 1);
+   const unsigned char expected[] = {1, 2, 3, 4, 5, 6, 7, 8, 0x3f, 0xf0, 0, 0, 0, 0, 0, 0};
+   ASSERT_EQ(wbuf.Length(), (Int_t)sizeof(expected));
+   for (std::size_t i = 0; i < sizeof(expected); ++i)
+      EXPECT_EQ((unsigned char)wbuf.Buffer()[i], expected[i]);
+}
+
+TEST(TBufferFile, TruncatedArrayRoundTrip)
+{
+   for (auto n : kSizes) {
+      std::vector<Float_t> floats(n);
+      std::vector<Double_t> doubles(n);
+      for (Int_t i = 0; i < n; ++i) {
+         floats[i] = 0.25f * (i - n / 2);
+         doubles[i] = 0.125 * (i - n / 2);
+      }
+      TBufferFile wbuf(TBuffer::kWrite);
+      wbuf.WriteFastArrayFloat16(floats.data(), n);  // 12 bits of mantissa
+      wbuf.WriteFastArrayDouble32(doubles.data(), n); // written as floats
+
+      TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+      std::vector<Float_t> readFloats(n);
+      std::vector<Double_t> readDoubles(n);
+      rbuf.ReadFastArrayFloat16(readFloats.data(), n);
+      rbuf.ReadFastArrayDouble32(readDoubles.data(), n);
+      EXPECT_EQ(readFloats, floats);
+      EXPECT_EQ(readDoubles, doubles);
+
+      // the factor and nbits variants, as used by the streaming actions
+      rbuf.SetBufferOffset(0);
+      std::fill(readFloats.begin(), readFloats.end(), 0.f);
+      rbuf.ReadFastArrayWithNbits(readFloats.data(), n, 12);
+      EXPECT_EQ(readFloats, floats);
+      std::fill(readDoubles.begin(), readDoubles.end(), 0.);
+      rbuf.ReadFastArrayWithNbits(readDoubles.data(), n, 0);
+      EXPECT_EQ(readDoubles, doubles);
+      EXPECT_EQ(rbuf.Length(), wbuf.Length());
+   }
+}
@@ -0,0 +1,105 @@
+#include "TArrayD.h"
+#include "TArrayI.h"
+#include "TArrayL64.h"
+#include "TBase64.h"
+#include "TBufferJSON.h"
+#include "TNamed.h"
+#include "TObjArray.h"
+
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "gtest/gtest.h"
+
+TEST(TBufferJSON, Integers)
+{
+   TArrayL64 arr(4);
+   arr[0] = std::numeric_limits<Long64_t>::min();
+   arr[1] = 0;
+   arr[2] = -42;
+   arr[3] = std::numeric_limits<Long64_t>::max();
+   EXPECT_EQ(TBufferJSON::ToJSON(&arr, TBufferJSON::kNoSpaces),
+             "[-9223372036854775808,0,-42,9223372036854775807]");
+
+   // compressed arrays with positions and repetitions of values
+   TArrayI zeros(100);
+   for (int i = 20; i < 30; ++i)
+      zeros[i] = 7;
+   zeros[50] = -1;
+   TString json = TBufferJSON::ToJSON(&zeros, TBufferJSON::kNoSpaces + TBufferJSON::kSameSuppression);
+   EXPECT_EQ(json, "{\"$arr\":\"Int32\",\"len\":100,\"p\":20,\"v\":7,\"n\":10,\"p1\":50,\"v1\":-1}");
+   TArrayI *read = nullptr;
+   EXPECT_TRUE(TBufferJSON::FromJSON(read, json.Data()));
+   ASSERT_NE(read, nullptr);
+   EXPECT_EQ(read->GetSize(), 100);
+   for (int i = 0; i < 100; ++i)
+      EXPECT_EQ(read->At(i), zeros[i]);
+   delete read;
+}
+
+TEST(TBufferJSON, Sink)
+{
+   TObjArray arr;
+   arr.SetOwner(kTRUE);
+   for (int i = 0; i < 100; ++i)
+      arr.Add(new TNamed(TString::Format("name%d", i).Data(), "a title"));
+
+   for (Int_t compact : {0, 3, 23}) {
+      const TString expected = TBufferJSON::ConvertToJSON(&arr, compact);
+
+      TBufferJSON buf;
+      buf.SetCompact(compact);
+      std::string json;
+      int nchunks = 0;
+      auto size = buf.StoreObject(&arr, arr.IsA(), [&](const char *data, Int_t len) {
+         json.append(data, len);
+         ++nchunks;
+      }, 100);
+      EXPECT_EQ(json, expected.Data());
+      EXPECT_EQ(size, expected.Length());
+      EXPECT_GT(nchunks, 1);
+
+      std::string direct;
+      EXPECT_TRUE(TBufferJSON::ConvertToJSON(direct, &arr, arr.IsA(), compact));
+      EXPECT_EQ(direct, expected.Data());
+   }
+
+   // the complete json code is a single value
+   TArrayI small(3);
+   small[1] = 5;
+   std::string json;
+   EXPECT_TRUE(TBufferJSON::ConvertToJSON(json, &small, TArrayI::Class(), TBufferJSON::kNoSpaces));
+   EXPECT_EQ(json, "[0,5,0]");
+
+   // a single data member
+   TNamed named("name", "title");
+   EXPECT_TRUE(TBufferJSON::ConvertToJSON(json, &named, TNamed::Class(), 0, "fTitle"));
+   EXPECT_EQ(json, "\"title\"");
+}
+
+TEST(TBufferJSON, ReadArrays)
+{
+   TArrayD arr(1000);
+   for (int i = 100; i < 1000; ++i)
+      arr[i] = 0.5 * i;
+
+   for (Int_t compact : {0, (Int_t)TBufferJSON::kZeroSuppression, (Int_t)TBufferJSON::kSameSuppression,
+                         (Int_t)TBufferJSON::kBase64}) {
+      TString json = TBufferJSON::ToJSON(&arr, TBufferJSON::kNoSpaces + compact);
+      TArrayD *read = nullptr;
+      EXPECT_TRUE(TBufferJSON::FromJSON(read, json.Data()));
+      ASSERT_NE(read, nullptr);
+      ASSERT_EQ(read->GetSize(), arr.GetSize());
+      for (int i = 0; i < arr.GetSize(); ++i)
+         EXPECT_EQ(read->At(i), arr[i]);
+      delete read;
+   }
+
+   // the base64 data is decoded directly into the array, never beyond its end
+   char out[4] = {0, 0, 0, 0};
+   EXPECT_EQ(TBase64::Decode("AQAAAAIAAAA=", 12, out, 4), -1);
+   EXPECT_EQ(TBase64::Decode("AQIDBA==", 8, out, 4), 4);
+   EXPECT_EQ(0, memcmp(out, "\1\2\3\4", 4));
+   EXPECT_EQ(TBase64::Decode(TBase64::Encode("abcde").Data()), "abcde");
+}
@@ -7,6 +7,7 @@
 #include "TROOT.h"
 #include "TTree.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdio>
 #include <future>
@@ -130,6 +131,114 @@ TEST(TBufferMerger, ParallelTreeFill)
    EXPECT_TRUE(FileExists("tbuffermerger_parallel.root"));
 }
 
+TEST(TBufferMerger, MergingThread)
+{
+   int nthreads = 4;
+   int nevents = 256;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger("tbuffermerger_mergingthread.root");
+      // a queue of one buffer makes the threads wait for the merging thread
+      merger.StartMergingThread(1);
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i) {
+         threads.emplace_back([=, &merger]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+            mytree->ResetBit(kMustCleanup);
+
+            int n = 0;
+            mytree->Branch("n", &n, "n/I");
+            for (int j = 0; j < nevents; ++j) {
+               n = i * nevents + j;
+               mytree->Fill();
+               if (j % 32 == 31)
+                  myfile->Write();
+            }
+            mytree->ResetBranchAddresses();
+            myfile->Write();
+         });
+      }
+
+      for (auto &&t : threads)
+         t.join();
+   }
+
+   {
+      TFile f("tbuffermerger_mergingthread.root");
+      auto t = f.Get<TTree>("mytree");
+      ASSERT_NE(t, nullptr);
+      int n = 0;
+      t->SetBranchAddress("n", &n);
+      std::vector<int> seen(nthreads * nevents, 0);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+         t->GetEntry(i);
+         ++seen[n];
+      }
+      EXPECT_EQ(t->GetEntries(), nthreads * nevents);
+      EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), nthreads * nevents);
+   }
+
+   RemoveFile("tbuffermerger_mergingthread.root");
+}
+
+TEST(TBufferMerger, PreMergingThreads)
+{
+   int nthreads = 4;
+   int nevents = 256;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger("tbuffermerger_premerging.root");
+      merger.StartMergingThread(8, 2);
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i) {
+         threads.emplace_back([=, &merger]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+            mytree->ResetBit(kMustCleanup);
+
+            int n = 0;
+            mytree->Branch("n", &n, "n/I");
+            for (int j = 0; j < nevents; ++j) {
+               n = i * nevents + j;
+               mytree->Fill();
+               if (j % 16 == 15)
+                  myfile->Write();
+            }
+            mytree->ResetBranchAddresses();
+         });
+      }
+
+      for (auto &&t : threads)
+         t.join();
+
+      const auto stats = merger.GetMergeStats();
+      EXPECT_EQ(stats.fPushedBuffers, size_t(nthreads * nevents / 16));
+      EXPECT_LE(stats.fPeakQueueSize, 8u);
+   }
+
+   {
+      TFile f("tbuffermerger_premerging.root");
+      auto t = f.Get<TTree>("mytree");
+      ASSERT_NE(t, nullptr);
+      int n = 0;
+      t->SetBranchAddress("n", &n);
+      std::vector<int> seen(nthreads * nevents, 0);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+         t->GetEntry(i);
+         ++seen[n];
+      }
+      EXPECT_EQ(t->GetEntries(), nthreads * nevents);
+      EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), nthreads * nevents);
+   }
+
+   RemoveFile("tbuffermerger_premerging.root");
+}
+
 TEST(TBufferMerger, AutoSave)
 {
    int nevents = 16384;
@@ -1,8 +1,16 @@
+#include "RConfigure.h"
 #include "TFileMerger.h"
 
+#include "TH1F.h"
+#include "TKey.h"
 #include "TMemFile.h"
+#include "TROOT.h"
+#include "TSystem.h"
 #include "TTree.h"
 
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace {
@@ -96,3 +104,101 @@ TEST(TFileMerger, CreateWithUnwritableTFilePointer)
    output->SetWritable(false);
    EXPECT_ROOT_ERROR(merger.OutputFile(std::move(output)), "Error in .* output file output.root is not writable\n");
 }
+
+TEST(TFileMerger, MemoryBudget)
+{
+   std::vector<std::string> names;
+   for (int f = 0; f < 4; ++f) {
+      names.emplace_back("tfilemerger_budget" + std::to_string(f) + ".root");
+      TFile file(names.back().c_str(), "RECREATE");
+      for (int h = 0; h < 50; ++h) {
+         const auto name = "h" + std::to_string(h);
+         auto histo = new TH1F(name.c_str(), name.c_str(), 10, 0, 10);
+         histo->Fill(h % 10, f + 1);
+      }
+      file.Write();
+   }
+
+   {
+      TFileMerger merger(kFALSE, kTRUE);
+      // a budget smaller than the keys of a single source: one source per round
+      merger.SetMemoryBudget(1);
+      ASSERT_TRUE(merger.OutputFile("tfilemerger_budget_output.root", "RECREATE"));
+      for (const auto &name : names)
+         ASSERT_TRUE(merger.AddFile(name.c_str(), false));
+      EXPECT_EQ(merger.GetMergeList()->GetEntries(), 4);
+      EXPECT_TRUE(merger.Merge());
+   }
+
+   {
+      TFile output("tfilemerger_budget_output.root");
+      EXPECT_EQ(output.GetListOfKeys()->GetEntries(), 50);
+      for (int h = 0; h < 50; ++h) {
+         auto histo = output.Get<TH1F>(("h" + std::to_string(h)).c_str());
+         ASSERT_TRUE(histo != nullptr);
+         EXPECT_EQ(histo->GetSumOfWeights(), 10.);
+         EXPECT_EQ(histo->GetBinContent(h % 10 + 1), 10.);
+      }
+   }
+
+   for (const auto &name : names)
+      gSystem->Unlink(name.c_str());
+   gSystem->Unlink("tfilemerger_budget_output.root");
+}
+
+#ifdef R__USE_IMT
+static std::vector<std::string> MergeHistograms(bool imt)
+{
+   if (imt)
+      ROOT::EnableImplicitMT(4);
+   else
+      ROOT::DisableImplicitMT();
+
+   std::vector<std::unique_ptr<TMemFile>> inputs;
+   for (int f = 0; f < 3; ++f) {
+      inputs.emplace_back(new TMemFile(("histos" + std::to_string(f) + ".root").c_str(), "RECREATE"));
+      for (int h = 0; h < 20; ++h) {
+         const auto name = "h" + std::to_string(h);
+         auto histo = new TH1F(name.c_str(), name.c_str(), 10, 0, 10);
+         histo->SetDirectory(inputs.back().get());
+         histo->Fill(h % 10, f + 1);
+         // a tree in the middle of the histograms, merged sequentially
+         if (h == 10)
+            CreateATuple(*inputs.back(), "a_tree", f);
+      }
+      inputs.back()->Write(nullptr, TObject::kOverwrite);
+   }
+
+   TFileMerger merger(kFALSE, kTRUE);
+   merger.OutputFile(std::unique_ptr<TMemFile>(new TMemFile("histos_output.root", "CREATE")));
+   for (auto &input : inputs)
+      merger.AddFile(input.get(), false);
+   EXPECT_TRUE(merger.PartialMerge());
+
+   auto &result = *static_cast<TMemFile *>(merger.GetOutputFile());
+   std::vector<std::string> names;
+   TIter next(result.GetListOfKeys());
+   while (auto key = static_cast<TKey *>(next()))
+      names.emplace_back(key->GetName());
+   for (int h = 0; h < 20; ++h) {
+      auto histo = result.Get<TH1F>(("h" + std::to_string(h)).c_str());
+      EXPECT_TRUE(histo != nullptr);
+      if (histo) {
+         EXPECT_EQ(histo->GetSumOfWeights(), 6.);
+         EXPECT_EQ(histo->GetBinContent(h % 10 + 1), 6.);
+      }
+   }
+   CheckTree(result, "a_tree", 0);
+
+   ROOT::DisableImplicitMT();
+   return names;
+}
+
+TEST(TFileMerger, ParallelHistogramMerge)
+{
+   const auto sequential = MergeHistograms(false);
+   const auto parallel = MergeHistograms(true);
+   EXPECT_EQ(sequential.size(), 21u);
+   EXPECT_EQ(parallel, sequential);
+}
+#endif
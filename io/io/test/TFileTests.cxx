@@ -1,6 +1,18 @@
+#include "TBufferFile.h"
+#include "TEnv.h"
+#include "TError.h"
 #include "TFile.h"
+#include "TKey.h"
+#include "TMemFile.h"
+#include "TNamed.h"
+#include "TROOT.h"
 #include "TSystem.h"
 
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 // Tests ROOT-9857
@@ -22,4 +34,198 @@ TEST(TFile, ReadFromSameFile)
    auto o2 = f2.Get(objpath);
 
    EXPECT_TRUE(o1 != o2) << "Same objects read from two different files have the same pointer!";
-}
\ No newline at end of file
+}
+
+// Objects larger than kMAXZIPBUF are compressed in several blocks, concurrently with IMT
+TEST(TFile, LargeObjectBlocks)
+{
+   const auto filename = "LargeObjectBlocks.root";
+   // about 40 MB, i.e. three compression blocks
+   std::vector<int> values(10000000);
+   for (std::size_t i = 0; i < values.size(); ++i)
+      values[i] = static_cast<int>(i % 1000);
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   {
+      TFile f(filename, "RECREATE");
+      f.WriteObject(&values, "values");
+   }
+   {
+      TFile f(filename);
+      auto readValues = f.Get<std::vector<int>>("values");
+      ASSERT_NE(readValues, nullptr);
+      EXPECT_EQ(*readValues, values);
+      EXPECT_LT(f.GetSize(), static_cast<Long64_t>(values.size() * sizeof(int) / 2));
+      delete readValues;
+   }
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, WriteBehind)
+{
+   const auto filename = "WriteBehind.root";
+   std::vector<std::vector<int>> values(20);
+   for (std::size_t i = 0; i < values.size(); ++i)
+      values[i].assign(100000, static_cast<int>(i));
+   {
+      TFile f(filename, "RECREATE");
+      // a small queue, so that the writes wait for the I/O thread
+      f.SetWriteBehind(1024 * 1024);
+      for (std::size_t i = 0; i < values.size(); ++i)
+         f.WriteObject(&values[i], ("values" + std::to_string(i)).c_str());
+      // reading back from the file being written sees the queued buffers
+      auto readValues = f.Get<std::vector<int>>("values3");
+      ASSERT_NE(readValues, nullptr);
+      EXPECT_EQ(*readValues, values[3]);
+      delete readValues;
+   }
+   {
+      TFile f(filename);
+      ASSERT_FALSE(f.IsZombie());
+      for (std::size_t i = 0; i < values.size(); ++i) {
+         auto readValues = f.Get<std::vector<int>>(("values" + std::to_string(i)).c_str());
+         ASSERT_NE(readValues, nullptr);
+         EXPECT_EQ(*readValues, values[i]);
+         delete readValues;
+      }
+   }
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, LazyKeys)
+{
+   const auto filename = "LazyKeys.root";
+   {
+      TFile f(filename, "RECREATE");
+      for (int i = 0; i < 100; ++i) {
+         TNamed named(("obj" + std::to_string(i)).c_str(), std::to_string(i).c_str());
+         named.Write();
+      }
+      // a second cycle for one of the keys
+      TNamed named("obj7", "second");
+      named.Write();
+   }
+   const auto lazyKeys = gEnv->GetValue("TFile.LazyKeys", 10000);
+   gEnv->SetValue("TFile.LazyKeys", 10);
+   {
+      TFile f(filename);
+      EXPECT_EQ(f.GetNkeys(), 101);
+      auto obj = f.Get<TNamed>("obj42");
+      ASSERT_NE(obj, nullptr);
+      EXPECT_STREQ(obj->GetTitle(), "42");
+      delete obj;
+      EXPECT_EQ(f.Get<TNamed>("missing"), nullptr);
+      obj = f.Get<TNamed>("obj7");
+      ASSERT_NE(obj, nullptr);
+      EXPECT_STREQ(obj->GetTitle(), "second");
+      delete obj;
+      obj = f.Get<TNamed>("obj7;1");
+      ASSERT_NE(obj, nullptr);
+      EXPECT_STREQ(obj->GetTitle(), "7");
+      delete obj;
+      auto key = f.GetKey("obj7", 1);
+      ASSERT_NE(key, nullptr);
+      EXPECT_EQ(key->GetCycle(), 1);
+      EXPECT_EQ(f.GetKey("obj99"), f.FindKey("obj99"));
+
+      // the full list has the keys already read and the others, in the order of the file
+      auto keys = f.GetListOfKeys();
+      ASSERT_EQ(keys->GetSize(), 101);
+      EXPECT_STREQ(keys->At(0)->GetName(), "obj0");
+      EXPECT_EQ(keys->FindObject("obj99"), f.GetKey("obj99"));
+   }
+   gEnv->SetValue("TFile.LazyKeys", lazyKeys);
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, LazyStreamerInfo)
+{
+   const auto filename = "LazyStreamerInfo.root";
+   const auto lazyStreamerInfo = gEnv->GetValue("TFile.LazyStreamerInfo", 0);
+   gEnv->SetValue("TFile.LazyStreamerInfo", 1);
+   {
+      TFile f(filename, "RECREATE");
+      TNamed named("obj", "title");
+      named.Write();
+   }
+   {
+      TFile f(filename);
+      EXPECT_FALSE(f.GetOpenStats().fStreamerInfoRead);
+      EXPECT_GT(f.GetOpenStats().fInitReadCalls, 0);
+      EXPECT_EQ(f.GetNkeys(), 1);
+      EXPECT_FALSE(f.GetOpenStats().fStreamerInfoRead);
+
+      auto obj = f.Get<TNamed>("obj");
+      ASSERT_NE(obj, nullptr);
+      EXPECT_STREQ(obj->GetTitle(), "title");
+      delete obj;
+      EXPECT_TRUE(f.GetOpenStats().fStreamerInfoRead);
+   }
+   {
+      // the StreamerInfo already in the file are kept when it is updated
+      TFile f(filename);
+      EXPECT_EQ(f.ReOpen("UPDATE"), 0);
+      EXPECT_TRUE(f.GetOpenStats().fStreamerInfoRead);
+      TNamed named("other", "other title");
+      named.Write();
+   }
+   {
+      TFile f(filename);
+      auto infos = f.GetStreamerInfoList();
+      ASSERT_NE(infos, nullptr);
+      EXPECT_NE(infos->FindObject("TNamed"), nullptr);
+      delete infos;
+   }
+   gEnv->SetValue("TFile.LazyStreamerInfo", lazyStreamerInfo);
+   gSystem->Unlink(filename);
+}
+
+TEST(TMemFile, AdoptAndReleaseBuffer)
+{
+   TMemFile source("source.root", "RECREATE");
+   TNamed first("first", "first title");
+   source.WriteTObject(&first);
+   source.Write();
+
+   // the content is handed over, and the file can be written again
+   std::unique_ptr<TBufferFile> released = source.ReleaseBuffer();
+   ASSERT_NE(released, nullptr);
+   {
+      // the objects written are not attached to the file, which is fine here
+      auto oldIgnoreLevel = gErrorIgnoreLevel;
+      gErrorIgnoreLevel = kError;
+      source.ResetAfterMerge(nullptr);
+      gErrorIgnoreLevel = oldIgnoreLevel;
+   }
+   TNamed second("second", "second title");
+   source.WriteTObject(&second);
+   source.Write();
+   auto named = source.Get<TNamed>("second");
+   ASSERT_NE(named, nullptr);
+   EXPECT_STREQ(named->GetTitle(), "second title");
+   EXPECT_EQ(source.Get<TNamed>("first"), nullptr);
+
+   // a copy of the content is adopted by a TMemFile that can be updated
+   const Long64_t size = released->BufferSize();
+   std::unique_ptr<char[]> content(new char[size]);
+   memcpy(content.get(), released->Buffer(), size);
+   TMemFile update("update.root", std::move(content), size, "UPDATE");
+   ASSERT_FALSE(update.IsZombie());
+   named = update.Get<TNamed>("first");
+   ASSERT_NE(named, nullptr);
+   EXPECT_STREQ(named->GetTitle(), "first title");
+   TNamed third("third", "third title");
+   EXPECT_GT(update.WriteTObject(&third), 0);
+   EXPECT_NE(update.Get<TNamed>("third"), nullptr);
+
+   // and the released buffer itself by a read-only one
+   TMemFile read("read.root", std::move(released));
+   ASSERT_FALSE(read.IsZombie());
+   named = read.Get<TNamed>("first");
+   ASSERT_NE(named, nullptr);
+   EXPECT_STREQ(named->GetTitle(), "first title");
+}
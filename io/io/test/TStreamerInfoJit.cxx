@@ -0,0 +1,58 @@
+#include "TAttMarker.h"
+#include "TBufferFile.h"
+#include "TEnv.h"
+#include "TStreamerInfo.h"
+#include "TStreamerInfoActions.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+static std::string Serialize(TAttMarker &marker)
+{
+   TBufferFile buf(TBuffer::kWrite);
+   marker.Streamer(buf);
+   return std::string(buf.Buffer(), buf.Length());
+}
+
+TEST(TStreamerInfoJit, RoundTrip)
+{
+   gEnv->SetValue("Root.StreamerInfo.Jit", "TAttMarker");
+   auto info = static_cast<TStreamerInfo *>(TAttMarker::Class()->GetStreamerInfo());
+   ASSERT_NE(info, nullptr);
+   auto readActions = info->GetReadObjectWiseActions();
+   auto writeActions = info->GetWriteObjectWiseActions();
+   // the StreamerInfo might have been built before the configuration was changed
+   if (!readActions->fJitAction)
+      readActions->JitCompile(kTRUE);
+   if (!writeActions->fJitAction)
+      writeActions->JitCompile(kFALSE);
+   ASSERT_NE(readActions->fJitAction, nullptr);
+   ASSERT_NE(writeActions->fJitAction, nullptr);
+
+   TAttMarker marker(kRed, 21, 1.5);
+   const auto jitted = Serialize(marker);
+
+   // the fused function writes the same bytes as the actions
+   auto jitWrite = writeActions->fJitAction;
+   writeActions->fJitAction = nullptr;
+   EXPECT_EQ(Serialize(marker), jitted);
+   writeActions->fJitAction = jitWrite;
+
+   TBufferFile buf(TBuffer::kRead, jitted.size(), const_cast<char *>(jitted.data()), kFALSE);
+   TAttMarker read;
+   read.Streamer(buf);
+   EXPECT_EQ(read.GetMarkerColor(), kRed);
+   EXPECT_EQ(read.GetMarkerStyle(), 21);
+   EXPECT_FLOAT_EQ(read.GetMarkerSize(), 1.5);
+   EXPECT_EQ(buf.Length(), (Int_t)jitted.size());
+
+   // sequences with the same layout share the compiled function
+   auto copy = readActions->CreateCopy();
+   EXPECT_TRUE(copy->JitCompile(kTRUE));
+   EXPECT_EQ(copy->fJitAction, readActions->fJitAction);
+   copy->AddToOffset(8);
+   EXPECT_EQ(copy->fJitAction, nullptr);
+   delete copy;
+   gEnv->SetValue("Root.StreamerInfo.Jit", "");
+}
@@ -54,7 +54,8 @@ private:
 
    TString fMPIFilename; // output filename, only used by collector
 
-   char *fSendBuf = 0; // message buffer, only used by worker
+   TBufferFile *fSendBuf = 0; // message buffer, only used by worker
+   Bool_t fSingleOutput = kFALSE; // collectors forward their merged data to the first one, which writes one file
 
    struct ParallelFileMerger : public TObject {
    private:
@@ -70,11 +71,13 @@ private:
       static void DeleteObject(TDirectory *dir, Bool_t withReset);
       
    public:
-      ParallelFileMerger(const char *filename, Int_t compression_settings, Bool_t writeCache = kFALSE);
+      ParallelFileMerger(const char *filename, Int_t compression_settings, Bool_t writeCache = kFALSE,
+                         Bool_t inMemory = kFALSE);
       virtual ~ParallelFileMerger();
 
       ULong_t Hash() const { return fFilename.Hash(); };
       const char *GetName() const { return fFilename; };
+      TFile *GetOutputFile() const { return fMerger.GetOutputFile(); }
 
       static Bool_t NeedInitialMerge(TDirectory *dir);
 
@@ -89,6 +92,10 @@ private:
    void CheckSplitLevel();
    void SplitMPIComm();
    void UpdateEndProcess();
+   Bool_t IsTopCollector() const { return fSingleOutput && fSplitLevel > 1 && fMPIColor == 0; }
+   Bool_t IsIntermediateCollector() const { return fSingleOutput && fSplitLevel > 1 && fMPIColor != 0; }
+   MPI_Comm ProbeMessage(MPI_Status &status);
+   void ForwardMerged(TMemFile *merged, TBufferFile *&sendBuf, MPI_Request &request);
 
    Bool_t IsReceived();
 
@@ -109,6 +116,9 @@ public:
 
    TString GetMPIFilename() const { return fMPIFilename; };
 
+   void SetSingleOutput(Bool_t single = kTRUE) { fSingleOutput = single; }
+   Bool_t IsSingleOutput() const { return fSingleOutput; }
+
    // Collector Functions
    void RunCollector(Bool_t cache = kFALSE);
    Bool_t IsCollector();
@@ -10,9 +10,11 @@
  *************************************************************************/
 
 #include "TMPIFile.h"
+#include "TBufferFile.h"
 #include "TFileCacheWrite.h"
 #include "TKey.h"
 #include "TMath.h"
+#include "TSystem.h"
 
 ClassImp(TMPIFile);
 
@@ -115,44 +117,58 @@ void TMPIFile::UpdateEndProcess()
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the core of the Collector rank which listens for incoming
 /// messages from Worker ranks. The Collector
+///
+/// With SetSingleOutput() and more than one collector, the collectors other
+/// than the first one merge the data of their workers in memory and forward
+/// it to the first collector, which merges it with the data of its own
+/// workers: the merging is spread over the collectors, and a single file is
+/// written.
 
 void TMPIFile::RunCollector(Bool_t cache)
 {
    // update the user set filename with the current process ID and Rank ID
    // this ensures collectors do not overwrite one anothers files
    this->SetOutputName();
-   Info("RunCollector", "writing to filename: %s", fMPIFilename.Data());
+   const Bool_t intermediate = IsIntermediateCollector();
+   if (intermediate)
+      Info("RunCollector", "forwarding the merged data to the collector of color 0");
+   else
+      Info("RunCollector", "writing to filename: %s", fMPIFilename.Data());
    THashTable mergers;
 
    Int_t client_Id = 0;
-   std::vector<char> buffer(0);
+   // the first collector of a single output also waits for the other collectors
+   const Int_t nSenders = fMPILocalSize - 1 + (IsTopCollector() ? fSplitLevel - 1 : 0);
+   // merged data being sent by an intermediate collector
+   TBufferFile *forwardBuf = nullptr;
+   MPI_Request forwardRequest = 0;
 
    // loop until all other ranks in the subcommunicator have exited
-   while (fEndProcess != fMPILocalSize - 1) {
+   while (fEndProcess != nSenders) {
       // Info("RunCollector","process counter %i",fEndProcess);
       // check if message has been received
       MPI_Status status;
       // this call blocks until a message is received
-      MPI_Probe(MPI_ANY_SOURCE, MPI_ANY_TAG, fSubComm, &status);
+      MPI_Comm comm = ProbeMessage(status);
 
       // get bytes received
       Int_t number_bytes;
       MPI_Get_count(&status, MPI_CHAR, &number_bytes);
-      buffer.resize(number_bytes);
-      char *buf = buffer.data();
+      // the TMemFile created from the message adopts the buffer
+      std::unique_ptr<char[]> buf(number_bytes ? new char[number_bytes] : nullptr);
 
       Int_t source = status.MPI_SOURCE;
       Int_t tag = status.MPI_TAG;
 
       // retrieve the message
-      MPI_Recv(buf, number_bytes, MPI_CHAR, source, tag, fSubComm, MPI_STATUS_IGNORE);
+      MPI_Recv(buf.get(), number_bytes, MPI_CHAR, source, tag, comm, MPI_STATUS_IGNORE);
 
       // empty message signifies a Worker exited
       if (number_bytes == 0) {
          this->UpdateEndProcess();
       } else {
          // create a TMemFile from the buffer
-         TMemFile *transient = new TMemFile(fMPIFilename, buf, number_bytes, "UPDATE");
+         TMemFile *transient = new TMemFile(fMPIFilename, std::move(buf), number_bytes, "UPDATE");
          if (transient->IsZombie()) {
             Error("RunCollector", "Failed to create TMemFile from buffer");
          }
@@ -163,7 +179,8 @@ void TMPIFile::RunCollector(Bool_t cache)
          ParallelFileMerger *info = (ParallelFileMerger *)mergers.FindObject(fMPIFilename);
          // if exiting file does not exist, create a new one
          if (!info) {
-            info = new ParallelFileMerger(fMPIFilename, this->GetCompressionSettings(), cache);
+            info = new ParallelFileMerger(fMPIFilename, this->GetCompressionSettings(), cache && !intermediate,
+                                          intermediate);
             // add file to hash table
             mergers.Add(info);
          }
@@ -177,26 +194,82 @@ void TMPIFile::RunCollector(Bool_t cache)
          info->RegisterClient(client_Id, transient);
          info->Merge();
          transient = 0;
+         if (intermediate)
+            ForwardMerged(static_cast<TMemFile *>(info->GetOutputFile()), forwardBuf, forwardRequest);
 
          client_Id++;
       }
-      buffer.resize(0);
    }
 
-   if (fEndProcess == fMPILocalSize - 1) {
+   if (intermediate) {
+      // signal the first collector that this one has exited
+      if (forwardBuf) {
+         MPI_Wait(&forwardRequest, MPI_STATUS_IGNORE);
+         delete forwardBuf;
+      }
+      MPI_Send(nullptr, 0, MPI_CHAR, 0, fMPIColor, MPI_COMM_WORLD);
+   }
+
+   if (fEndProcess == nSenders) {
       mergers.Delete();
       return;
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the next message to this collector and return its communicator:
+/// the sub communicator for the messages of the workers, or MPI_COMM_WORLD
+/// for the messages that the other collectors send to the first one.
+
+MPI_Comm TMPIFile::ProbeMessage(MPI_Status &status)
+{
+   if (!IsTopCollector()) {
+      MPI_Probe(MPI_ANY_SOURCE, MPI_ANY_TAG, fSubComm, &status);
+      return fSubComm;
+   }
+   while (true) {
+      Int_t flag = 0;
+      MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, fSubComm, &flag, &status);
+      if (flag)
+         return fSubComm;
+      MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &flag, &status);
+      if (flag)
+         return MPI_COMM_WORLD;
+      gSystem->Sleep(1);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called by the intermediate collectors only: sends the data merged so far
+/// to the first collector without waiting for it to be received, once the
+/// previous message is, and resets the merged file so that the next message
+/// only holds the new entries, as the workers do in Sync().
+
+void TMPIFile::ForwardMerged(TMemFile *merged, TBufferFile *&sendBuf, MPI_Request &request)
+{
+   if (sendBuf) {
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+      delete sendBuf;
+   }
+   Int_t count = merged->GetEND();
+   sendBuf = merged->ReleaseBuffer().release();
+   MPI_Isend(sendBuf->Buffer(), count, MPI_CHAR, 0, fMPIColor, MPI_COMM_WORLD, &request);
+   merged->ResetAfterMerge(nullptr);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor for ParallelFileMerger class
+///
+/// If inMemory is true, the data is merged into a TMemFile instead of the file.
 
-TMPIFile::ParallelFileMerger::ParallelFileMerger(const char *filename, Int_t compression_settings, Bool_t writeCache)
+TMPIFile::ParallelFileMerger::ParallelFileMerger(const char *filename, Int_t compression_settings, Bool_t writeCache,
+                                                 Bool_t inMemory)
    : fFilename(filename), fClientsContact(0), fMerger(kFALSE, kTRUE)
 {
    fMerger.SetPrintLevel(0);
-   if (!fMerger.OutputFile(filename, "RECREATE")) {
+   if (inMemory) {
+      fMerger.OutputFile(std::unique_ptr<TFile>(new TMemFile(filename, "RECREATE", "", compression_settings)));
+   } else if (!fMerger.OutputFile(filename, "RECREATE")) {
       Error("ParallelFileMerger", "Cannot recreate the output file");
    }
    fMerger.GetOutputFile()->SetCompressionSettings(compression_settings);
@@ -400,9 +473,9 @@ void TMPIFile::CreateBufferAndSend()
    }
    this->Write();
    Int_t count = this->GetEND();
-   fSendBuf = new char[count];
-   this->CopyTo(fSendBuf, count);
-   MPI_Isend(fSendBuf, count, MPI_CHAR, 0, fMPIColor, fSubComm, &fMPIRequest);
+   // the content is handed over without copying it, the file is reset by Sync()
+   fSendBuf = ReleaseBuffer().release();
+   MPI_Isend(fSendBuf->Buffer(), count, MPI_CHAR, 0, fMPIColor, fSubComm, &fMPIRequest);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -418,9 +491,9 @@ void TMPIFile::CreateEmptyBufferAndSend()
    if (!IsReceived()) {
       MPI_Wait(&fMPIRequest, MPI_STATUS_IGNORE);
    }
-   delete[] fSendBuf; // empty the buffer once received by master
+   delete fSendBuf; // empty the buffer once received by master
    fSendBuf = nullptr;
-   MPI_Send(fSendBuf, 0, MPI_CHAR, 0, fMPIColor, fSubComm);
+   MPI_Send(nullptr, 0, MPI_CHAR, 0, fMPIColor, fSubComm);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -433,7 +506,7 @@ void TMPIFile::Sync()
    if (!IsReceived()) {
       MPI_Wait(&fMPIRequest, MPI_STATUS_IGNORE);
    }
-   delete[] fSendBuf; // empty the buffer once received by master
+   delete fSendBuf; // empty the buffer once received by master
    fSendBuf = nullptr;
    CreateBufferAndSend();
    this->ResetAfterMerge((TFileMergeInfo *)0);
@@ -74,6 +74,8 @@ protected:
    // generic sql functions
    TSQLResult *SQLQuery(const char *cmd, Int_t flag = 0, Bool_t *res = 0);
    Bool_t SQLCanStatement();
+   Bool_t SQLCanBulkStatement();
+   Bool_t SQLCanMultiRowInsert() const;
    TSQLStatement *SQLStatement(const char *cmd, Int_t bufsize = 1000);
    void SQLDeleteStatement(TSQLStatement *stmt);
    Bool_t SQLApplyCommands(TObjArray *cmds);
@@ -213,7 +213,8 @@ TSQLObjectData *TBufferSQL2::SqlObjectData(Long64_t objid, TSQLClassInfo *sqlinf
       if (fPoolsMap)
          pool = (TSQLObjectDataPool *)fPoolsMap->GetValue(sqlinfo);
 
-      if (pool && (fLastObjId >= fFirstObjId)) {
+      // rows of all objects of the key are read with a single query
+      if (!pool && (fLastObjId >= fFirstObjId)) {
          if (gDebug > 4)
             Info("SqlObjectData", "Before request to %s", sqlinfo->GetClassTableName());
          TSQLResult *alldata = fSQL->GetNormalClassDataAll(fFirstObjId, fLastObjId, sqlinfo);
@@ -65,7 +65,9 @@ All conversion to SQL statements are done with help of TSQLStructure class.
 This is special hierarchical structure wich internally is very similar
 to XML structures. TBufferSQL2 creates these structures, when object
 data is streamed by ROOT and only afterwards all SQL statements will be produced
-and applied all together.
+and applied all together. Rows are collected per table: with MySQL, PostgreSQL
+and SQLite one INSERT query contains many rows, with Oracle, ODBC and SQLite
+one prepared statement per table is bound for all rows.
 When data is reading, TBufferSQL2 will produce requests to database
 during unstreaming of object data.
 Optionally (default this options on) name of column includes
@@ -1434,6 +1436,30 @@ Bool_t TSQLFile::SQLCanStatement()
    return kTRUE; // !IsOracle() || (fStmtCounter<15);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Test if rows are better inserted through one prepared statement per table,
+/// reused for all rows of the table: Oracle and ODBC send the bound rows in
+/// bulk, SQLite executes them without parsing the query again
+
+Bool_t TSQLFile::SQLCanBulkStatement()
+{
+   if (!fSQL || (!IsOracle() && !IsODBC() && strcmp(fSQL->ClassName(), "TSQLiteServer")))
+      return kFALSE;
+
+   return SQLCanStatement();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Test if one INSERT query can contain several rows, VALUES (...), (...)
+
+Bool_t TSQLFile::SQLCanMultiRowInsert() const
+{
+   if (!fSQL)
+      return kFALSE;
+   return IsMySQL() || (strcmp(fSQL->ClassName(), "TPgSQLServer") == 0) ||
+          (strcmp(fSQL->ClassName(), "TSQLiteServer") == 0);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Produces SQL statement for currently conected DB server
 
@@ -2531,19 +2557,22 @@ Long64_t TSQLFile::StoreObjectInTables(Long64_t keyid, const void *obj, const TC
       objid = -1;
    } else {
       TObjArray cmds;
-      // here tables may be already created, therefore
-      // it should be protected by transactions operations
+      // here tables may be already created and the rows collected in statements
+      // are already sent, therefore the conversion is protected by the same
+      // transaction as the commands
+      Bool_t needcommit = kFALSE;
+
+      if (GetUseTransactions() == kTransactionsAuto) {
+         SQLStartTransaction();
+         needcommit = kTRUE;
+      }
+
       if (s && !s->ConvertToTables(this, keyid, &cmds)) {
          Error("StoreObjectInTables", "Cannot convert to SQL statements");
          objid = -1;
+         if (needcommit)
+            SQLRollback();
       } else {
-         Bool_t needcommit = kFALSE;
-
-         if (GetUseTransactions() == kTransactionsAuto) {
-            SQLStartTransaction();
-            needcommit = kTRUE;
-         }
-
          if (!SQLApplyCommands(&cmds)) {
             Error("StoreObject", "Cannot correctly store object data in database");
             objid = -1;
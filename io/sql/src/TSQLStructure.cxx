@@ -876,13 +876,13 @@ public:
    void ConvertSqlValues(TObjArray &values, const char *tablename)
    {
       // this function transforms array of values for one table
-      // to SQL command. For MySQL one INSERT query can
+      // to SQL command. For MySQL, PostgreSQL and SQLite one INSERT query can
       // contain data for more than one row
 
       if ((values.GetLast() < 0) || (tablename == 0))
          return;
 
-      Bool_t canbelong = fFile->IsMySQL();
+      Bool_t canbelong = fFile->SQLCanMultiRowInsert();
 
       Int_t maxsize = 50000;
       TString sqlcmd(maxsize), value, onecmd, cmdmask;
@@ -911,8 +911,10 @@ public:
          AddSqlCmd(sqlcmd.Data());
    }
 
-   void ConvertPoolValues()
+   Bool_t ConvertPoolValues()
    {
+      // send the rows collected in statements, returns kFALSE if one of them failed
+      Bool_t res = kTRUE;
       TSQLClassInfo *sqlinfo = 0;
       TIter iter(&fPool);
       while ((sqlinfo = (TSQLClassInfo *)iter()) != 0) {
@@ -924,16 +926,18 @@ public:
          if (buf->fBlobCmds.GetLast() >= 0)
             fFile->CreateRawTable(sqlinfo);
          ConvertSqlValues(buf->fBlobCmds, sqlinfo->GetRawTableName());
-         if (buf->fBlobStmt)
-            buf->fBlobStmt->Process();
-         if (buf->fNormStmt)
-            buf->fNormStmt->Process();
+         if (buf->fBlobStmt && !buf->fBlobStmt->Process())
+            res = kFALSE;
+         if (buf->fNormStmt && !buf->fNormStmt->Process())
+            res = kFALSE;
       }
 
       ConvertSqlValues(fLongStrValues, sqlio::StringsTable);
       ConvertSqlValues(fRegValues, sqlio::ObjectsTable);
-      if (fRegStmt)
-         fRegStmt->Process();
+      if (fRegStmt && !fRegStmt->Process())
+         res = kFALSE;
+
+      return res;
    }
 
    void AddRegCmd(Long64_t objid, TClass *cl)
@@ -944,8 +948,8 @@ public:
          return;
       }
 
-      if (fFile->IsOracle() || fFile->IsODBC()) {
-         if ((fRegStmt == 0) && fFile->SQLCanStatement()) {
+      if (fFile->SQLCanBulkStatement()) {
+         if (fRegStmt == 0) {
             const char *quote = fFile->SQLIdentifierQuote();
 
             TString sqlcmd;
@@ -1040,7 +1044,7 @@ public:
    {
       // produce SQL query to insert object data into normal table
 
-      if (fFile->IsOracle() || fFile->IsODBC())
+      if (fFile->SQLCanBulkStatement())
          if (InsertToNormalTableOracle(columns, sqlinfo))
             return;
 
@@ -1109,8 +1113,8 @@ public:
       // when first line is created, check all problems
       if (fRawId == 0) {
          Bool_t maketmt = kFALSE;
-         if (fFile->IsOracle() || fFile->IsODBC())
-            maketmt = (fCmdBuf->fBlobStmt == 0) && fFile->SQLCanStatement();
+         if (fFile->SQLCanBulkStatement())
+            maketmt = (fCmdBuf->fBlobStmt == 0);
 
          if (maketmt) {
             // ensure that raw table is exists
@@ -1202,7 +1206,8 @@ Bool_t TSQLStructure::ConvertToTables(TSQLFile *file, Long64_t keyid, TObjArray
    Bool_t res = StoreObject(&reg, reg.fFirstObjId, GetObjectClass());
 
    // convert values from pool to SQL commands
-   reg.ConvertPoolValues();
+   if (!reg.ConvertPoolValues())
+      res = kFALSE;
 
    return res;
 }
@@ -39,8 +39,8 @@ public:
    void DeleteBuffer() final {}
    void FillBuffer(char *&) final {}
    char *GetBuffer() const final { return nullptr; }
-   Long64_t GetSeekKey() const final { return fKeyNode ? 1024 : 0; }
-   Long64_t GetSeekPdir() const final { return fKeyNode ? 1024 : 0; }
+   Long64_t GetSeekKey() const final { return (fKeyNode || (fKeyOffset >= 0)) ? 1024 : 0; }
+   Long64_t GetSeekPdir() const final { return (fKeyNode || (fKeyOffset >= 0)) ? 1024 : 0; }
    // virtual ULong_t   Hash() const { return 0; }
    void Keep() final {}
    // virtual void      ls(Option_t* ="") const;
@@ -54,7 +54,7 @@ public:
    void ReadBuffer(char *&) final {}
    Bool_t ReadFile() final { return kTRUE; }
    void SetBuffer() final { fBuffer = nullptr; }
-   Int_t WriteFile(Int_t = 1, TFile * = nullptr) final { return 0; }
+   Int_t WriteFile(Int_t = 1, TFile * = nullptr) final;
 
    // TKeyXML specific methods
 
@@ -64,6 +64,7 @@ public:
    void SetSubir() { fSubdir = kTRUE; }
    void UpdateObject(TObject *obj);
    void UpdateAttributes();
+   void UnloadNode(Long64_t offset);
 
 protected:
    Int_t Read(const char *name) final { return TKey::Read(name); }
@@ -76,6 +77,7 @@ protected:
    XMLNodePointer_t fKeyNode{nullptr}; //! node with stored object
    Long64_t fKeyId{0};                 //! unique identifier of key for search methods
    Bool_t fSubdir{kFALSE};             //! indicates that key contains subdirectory
+   Long64_t fKeyOffset{-1};            //! position of the key node in the file, when the node is not kept in memory
 
    ClassDefOverride(TKeyXML, 1) // a special TKey for XML files
 };
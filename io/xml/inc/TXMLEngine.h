@@ -18,6 +18,7 @@ typedef void *XMLNodePointer_t;
 typedef void *XMLNsPointer_t;
 typedef void *XMLAttrPointer_t;
 typedef void *XMLDocPointer_t;
+typedef void *XMLStreamPointer_t;
 
 class TXMLInputStream;
 class TXMLOutputStream;
@@ -34,8 +35,10 @@ protected:
    void TruncateNsExtension(XMLNodePointer_t xmlnode);
    void UnpackSpecialCharacters(char *target, const char *source, int srclen);
    void OutputValue(char *value, TXMLOutputStream *out);
+   void SaveNodeStart(XMLNodePointer_t xmlnode, TXMLOutputStream *out);
+   void SaveNodeEnd(XMLNodePointer_t xmlnode, TXMLOutputStream *out);
    void SaveNode(XMLNodePointer_t xmlnode, TXMLOutputStream *out, Int_t layout, Int_t level);
-   XMLNodePointer_t ReadNode(XMLNodePointer_t xmlparent, TXMLInputStream *inp, Int_t &resvalue);
+   XMLNodePointer_t ReadNode(XMLNodePointer_t xmlparent, TXMLInputStream *inp, Int_t &resvalue, Bool_t openonly = kFALSE);
    void DisplayError(Int_t error, Int_t linenumber);
    XMLDocPointer_t ParseStream(TXMLInputStream *input);
 
@@ -100,6 +103,13 @@ public:
    XMLNodePointer_t DocGetRootElement(XMLDocPointer_t xmldoc);
    XMLDocPointer_t ParseFile(const char *filename, Int_t maxbuf = 100000);
    XMLDocPointer_t ParseString(const char *xmlstring);
+   XMLStreamPointer_t SaveDocStart(XMLDocPointer_t xmldoc, const char *filename, Int_t layout = 1);
+   Long64_t SaveDocNode(XMLStreamPointer_t stream, XMLNodePointer_t xmlnode);
+   void SaveDocFinish(XMLStreamPointer_t stream);
+   XMLStreamPointer_t ParseFileStart(const char *filename, XMLDocPointer_t &xmldoc, Int_t maxbuf = 100000);
+   XMLNodePointer_t ParseFileNode(XMLStreamPointer_t stream, Long64_t *offset = nullptr);
+   Bool_t ParseFileFinish(XMLStreamPointer_t stream);
+   XMLNodePointer_t ReadFileNode(const char *filename, Long64_t offset, Int_t maxbuf = 100000);
    Bool_t ValidateVersion(XMLDocPointer_t doc, const char *version = nullptr);
    Bool_t ValidateDocument(XMLDocPointer_t, Bool_t = kFALSE) { return kFALSE; } // obsolete
    void SaveSingleNode(XMLNodePointer_t xmlnode, TString *res, Int_t layout = 1);
@@ -24,6 +24,8 @@ class TStreamerInfo;
 
 class TXMLFile final : public TFile, public TXMLSetup {
 
+   friend class TKeyXML;
+
 protected:
    void InitXmlFile(Bool_t create);
    // Interface to basic system I/O routines
@@ -71,6 +73,7 @@ public:
    Long64_t GetSize() const final { return 0; }
 
    Int_t GetIOVersion() const { return fIOVersion; }
+   Bool_t IsStreaming() const { return fStreaming; }
 
    Bool_t IsOpen() const final;
 
@@ -124,6 +127,10 @@ protected:
    void CombineNodesTree(TDirectory *dir, XMLNodePointer_t topnode, Bool_t dolink);
 
    void SaveToFile();
+   void StoreRootAttributes(XMLNodePointer_t rootnode);
+   Bool_t StreamKey(TKeyXML *key);
+   Bool_t ReadKeysStream(XMLStreamPointer_t stream);
+   XMLNodePointer_t ReadKeyNode(Long64_t offset);
 
    static void ProduceFileNames(const char *filename, TString &fname, TString &dtdname);
 
@@ -137,6 +144,10 @@ protected:
 
    Long64_t fKeyCounter{0}; //! counter of created keys, used for keys id
 
+   Bool_t fStreaming{kFALSE}; //! keys are written or read one by one, without keeping their nodes in memory
+
+   XMLStreamPointer_t fStream{nullptr}; //! document written in streaming mode
+
    ClassDefOverride(TXMLFile, 3) // ROOT file in XML format
 };
 
@@ -131,11 +131,39 @@ void TKeyXML::Delete(Option_t * /*option*/)
    if (fKeyNode && xml) {
       xml->FreeNode(fKeyNode);
       fKeyNode = nullptr;
+   } else if ((fKeyOffset >= 0) && GetFile() && GetFile()->IsWritable()) {
+      Warning("Delete", "Key %s;%d is already written to the file, it remains there", GetName(), fCycle);
    }
 
    fMotherDir->GetListOfKeys()->Remove(this);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Called once the object is stored in the key node.
+/// When the file is written in streaming mode, the node is written immediately
+/// and released from memory
+
+Int_t TKeyXML::WriteFile(Int_t, TFile *)
+{
+   TXMLFile *f = (TXMLFile *)GetFile();
+   if (f)
+      f->StreamKey(this);
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release key node, which is stored in the file at given position.
+/// The node is read again from the file when the object is read.
+
+void TKeyXML::UnloadNode(Long64_t offset)
+{
+   TXMLEngine *xml = XMLEngine();
+   if (fKeyNode && xml)
+      xml->FreeNode(fKeyNode);
+   fKeyNode = nullptr;
+   fKeyOffset = offset;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Stores keys attributes in key node
 
@@ -333,8 +361,19 @@ void *TKeyXML::ReadObjectAny(const TClass *expectedClass)
 
 void *TKeyXML::XmlReadAny(void *obj, const TClass *expectedClass)
 {
-   if (!fKeyNode)
-      return obj;
+   if (!fKeyNode) {
+      // node was released in streaming mode, read it again only for this object
+      TXMLFile *f = (TXMLFile *)GetFile();
+      if (!f || (fKeyOffset < 0))
+         return obj;
+      fKeyNode = f->ReadKeyNode(fKeyOffset);
+      if (!fKeyNode)
+         return obj;
+      void *res = XmlReadAny(obj, expectedClass);
+      XMLEngine()->FreeNode(fKeyNode);
+      fKeyNode = nullptr;
+      return res;
+   }
 
    TXMLFile *f = (TXMLFile *)GetFile();
    TXMLEngine *xml = XMLEngine();
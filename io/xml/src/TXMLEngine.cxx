@@ -72,6 +72,7 @@ protected:
    char *fCurrent;
    char *fMaxAddr;
    char *fLimitAddr;
+   Long64_t fWritten; // number of bytes already passed to the file or string
 
 public:
    TXMLOutputStream(const char *filename, Int_t bufsize = 20000)
@@ -90,6 +91,7 @@ public:
 
    void Init(Int_t bufsize)
    {
+      fWritten = 0;
       fBuf = (char *)malloc(bufsize);
       fCurrent = fBuf;
       fMaxAddr = fBuf + bufsize;
@@ -111,6 +113,7 @@ public:
             fOut->write(fBuf, fCurrent - fBuf);
          else if (fOutStr != 0)
             fOutStr->Append(fBuf, fCurrent - fBuf);
+         fWritten += fCurrent - fBuf;
       }
       fCurrent = fBuf;
    }
@@ -121,14 +124,22 @@ public:
          fOut->put(symb);
       else if (fOutStr != 0)
          fOutStr->Append(symb);
+      fWritten++;
    }
 
+   /// position of the next written byte in the output
+   Long64_t Offset() const { return fWritten + (fCurrent - fBuf); }
+
    void Write(const char *str)
    {
       int len = strlen(str);
       if (fCurrent + len >= fMaxAddr) {
          OutputCurrent();
-         fOut->write(str, len);
+         if (fOut != 0)
+            fOut->write(str, len);
+         else if (fOutStr != 0)
+            fOutStr->Append(str, len);
+         fWritten += len;
       } else {
          while (*str)
             *fCurrent++ = *str++;
@@ -175,6 +186,7 @@ protected:
 
    Int_t fTotalPos;
    Int_t fCurrentLine;
+   Long64_t fReadBytes; // number of bytes read from the file or string into the buffer
 
    TObjArray fEntities; //! array of TXMLEntity
 
@@ -184,12 +196,16 @@ public:
    ////////////////////////////////////////////////////////////////////////////
    /// constructor
 
-   TXMLInputStream(Bool_t isfilename, const char *filename, Int_t ibufsize)
+   TXMLInputStream(Bool_t isfilename, const char *filename, Int_t ibufsize, Long64_t offset = 0)
       : fInp(0), fInpStr(0), fInpStrLen(0), fBuf(0), fBufSize(0), fMaxAddr(0), fLimitAddr(0), fTotalPos(0),
-        fCurrentLine(0), fEntities(), fCurrent(0)
+        fCurrentLine(0), fReadBytes(0), fEntities(), fCurrent(0)
    {
       if (isfilename) {
          fInp = new std::ifstream(filename);
+         if (offset > 0) {
+            fInp->seekg(offset);
+            fReadBytes = offset;
+         }
          fInpStr = 0;
          fInpStrLen = 0;
       } else {
@@ -282,6 +298,7 @@ public:
          fInpStr += resultsize;
          fInpStrLen -= resultsize;
       }
+      fReadBytes += resultsize;
       return resultsize;
    }
 
@@ -336,6 +353,11 @@ public:
 
    Int_t TotalPos() { return fTotalPos; }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// returns position of the current symbol in the file or string
+
+   Long64_t CurrentOffset() { return fReadBytes - (fMaxAddr - fCurrent); }
+
    ////////////////////////////////////////////////////////////////////////////
    /// returns current line number in the input stream
 
@@ -512,6 +534,15 @@ public:
    }
 };
 
+// state of a document which is written or parsed node by node
+struct SXmlStream_t {
+   TXMLOutputStream *fOut;  // output, when writing
+   TXMLInputStream *fInp;   // input, when parsing
+   XMLNodePointer_t fNode;  // opened root element of the document
+   Int_t fLayout;           // layout of the written nodes
+   Int_t fStatus;           // 0 - root element open, 1 - root element closed, < 0 - parsing error
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 /// default (normal) constructor of TXMLEngine class
 
@@ -1408,6 +1439,246 @@ XMLDocPointer_t TXMLEngine::ParseStream(TXMLInputStream *inp)
    return xmldoc;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Starts writing of the document node by node.
+/// All nodes of the document before its root element, the start tag of the
+/// root element and the children it already has are stored in the file.
+/// Further children of the root element are written with SaveDocNode() as
+/// soon as they are produced, so that they do not need to be kept in memory.
+/// SaveDocFinish() closes the root element and the file.
+
+XMLStreamPointer_t TXMLEngine::SaveDocStart(XMLDocPointer_t xmldoc, const char *filename, Int_t layout)
+{
+   XMLNodePointer_t rootnode = DocGetRootElement(xmldoc);
+   if (!rootnode)
+      return nullptr;
+
+   SXmlStream_t *stream = new SXmlStream_t;
+   stream->fOut = new TXMLOutputStream(filename, 100000);
+   stream->fInp = nullptr;
+   stream->fNode = rootnode;
+   stream->fLayout = layout;
+   stream->fStatus = 0;
+
+   XMLNodePointer_t child = GetChild((XMLNodePointer_t)((SXmlDoc_t *)xmldoc)->fRootNode, kFALSE);
+   while (child != rootnode) {
+      SaveNode(child, stream->fOut, layout, 0);
+      ShiftToNext(child, kFALSE);
+   }
+
+   SaveNodeStart(rootnode, stream->fOut);
+   stream->fOut->Put('>');
+   if (layout > 0)
+      stream->fOut->Put('\n');
+
+   child = GetChild(rootnode, kFALSE);
+   while (child != 0) {
+      SaveNode(child, stream->fOut, layout, 2);
+      ShiftToNext(child, kFALSE);
+   }
+
+   return stream;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Writes node as next child of the root element of the document, opened with
+/// SaveDocStart(). The node is not modified and can be freed afterwards.
+/// Returns the position of the node in the file, which can be used to read it
+/// again with ReadFileNode(), or -1 if the stream is not valid.
+
+Long64_t TXMLEngine::SaveDocNode(XMLStreamPointer_t xmlstream, XMLNodePointer_t xmlnode)
+{
+   SXmlStream_t *stream = (SXmlStream_t *)xmlstream;
+   if (!stream || !stream->fOut || !xmlnode)
+      return -1;
+
+   Long64_t offset = stream->fOut->Offset();
+   SaveNode(xmlnode, stream->fOut, stream->fLayout, 2);
+   return offset;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Closes the root element and writes all following nodes of the document,
+/// then closes the file. The stream is deleted.
+
+void TXMLEngine::SaveDocFinish(XMLStreamPointer_t xmlstream)
+{
+   SXmlStream_t *stream = (SXmlStream_t *)xmlstream;
+   if (!stream)
+      return;
+
+   if (stream->fOut) {
+      SaveNodeEnd(stream->fNode, stream->fOut);
+      if (stream->fLayout > 0)
+         stream->fOut->Put('\n');
+
+      XMLNodePointer_t child = GetNext(stream->fNode, kFALSE);
+      while (child != 0) {
+         SaveNode(child, stream->fOut, stream->fLayout, 0);
+         ShiftToNext(child, kFALSE);
+      }
+      delete stream->fOut;
+   }
+
+   delete stream;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Starts parsing of the file node by node.
+/// The nodes before the root element and the root element with its attributes
+/// are read into the document xmldoc, which should be released with FreeDoc().
+/// The children of the root element are then read one by one with ParseFileNode(),
+/// so that only one of them has to be kept in memory. ParseFileFinish() closes
+/// the file. The maxbuf argument has the same meaning as for ParseFile().
+
+XMLStreamPointer_t TXMLEngine::ParseFileStart(const char *filename, XMLDocPointer_t &xmldoc, Int_t maxbuf)
+{
+   xmldoc = nullptr;
+   if ((filename == 0) || (strlen(filename) == 0))
+      return nullptr;
+   if (maxbuf < 100000)
+      maxbuf = 100000;
+
+   TXMLInputStream *inp = new TXMLInputStream(true, filename, maxbuf);
+   XMLDocPointer_t doc = NewDoc(0);
+
+   SXmlStream_t *stream = new SXmlStream_t;
+   stream->fOut = nullptr;
+   stream->fInp = inp;
+   stream->fNode = nullptr;
+   stream->fLayout = 0;
+   stream->fStatus = 0;
+
+   Int_t resvalue = 0;
+
+   do {
+      SXmlNode_t *node = (SXmlNode_t *)ReadNode(((SXmlDoc_t *)doc)->fRootNode, inp, resvalue, kTRUE);
+
+      if (resvalue == 3) {
+         // start tag of the root element, its children are read later
+         stream->fNode = node;
+         break;
+      }
+
+      if (resvalue != 2)
+         break;
+
+      if (node && (node->fType == kXML_NODE)) {
+         // root element without children
+         stream->fNode = node;
+         stream->fStatus = 1;
+         break;
+      }
+
+      if (!inp->EndOfStream())
+         inp->SkipSpaces();
+
+      if (inp->EndOfStream())
+         resvalue = -1;
+   } while (resvalue == 2);
+
+   if (!stream->fNode) {
+      DisplayError(resvalue, inp->CurrentLine());
+      FreeDoc(doc);
+      delete inp;
+      delete stream;
+      return nullptr;
+   }
+
+   xmldoc = doc;
+   return stream;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns next child of the root element of the document, opened with
+/// ParseFileStart(). The node is not linked to the document and should be
+/// released with FreeNode(). If offset is specified, it is set to the position
+/// of the node in the file, so that it can be read again with ReadFileNode().
+/// Returns nullptr when the root element is closed or in case of error.
+
+XMLNodePointer_t TXMLEngine::ParseFileNode(XMLStreamPointer_t xmlstream, Long64_t *offset)
+{
+   SXmlStream_t *stream = (SXmlStream_t *)xmlstream;
+   if (!stream || !stream->fInp || (stream->fStatus != 0))
+      return nullptr;
+
+   TXMLInputStream *inp = stream->fInp;
+
+   Int_t resvalue = 0;
+
+   do {
+      if (!inp->SkipSpaces()) {
+         resvalue = -1;
+         break;
+      }
+
+      if (offset)
+         *offset = inp->CurrentOffset();
+
+      XMLNodePointer_t xmlnode = ReadNode(stream->fNode, inp, resvalue);
+
+      // content and DTD parts do not produce nodes
+      if ((resvalue == 2) && xmlnode) {
+         UnlinkNode(xmlnode);
+         return xmlnode;
+      }
+   } while (resvalue == 2);
+
+   if (resvalue == 1) {
+      stream->fStatus = 1;
+   } else {
+      DisplayError(resvalue, inp->CurrentLine());
+      stream->fStatus = resvalue < 0 ? resvalue : -100;
+   }
+
+   // drop content collected in the root element
+   CleanNode(stream->fNode);
+
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Closes the file parsed with ParseFileStart(). The stream is deleted.
+/// Returns kTRUE if the whole root element was parsed without errors.
+
+Bool_t TXMLEngine::ParseFileFinish(XMLStreamPointer_t xmlstream)
+{
+   SXmlStream_t *stream = (SXmlStream_t *)xmlstream;
+   if (!stream)
+      return kFALSE;
+
+   Bool_t res = (stream->fStatus == 1);
+   delete stream->fInp;
+   delete stream;
+   return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reads single node at the given position of the file, for instance
+/// a node returned before by SaveDocNode() or ParseFileNode()
+
+XMLNodePointer_t TXMLEngine::ReadFileNode(const char *filename, Long64_t offset, Int_t maxbuf)
+{
+   if ((filename == 0) || (strlen(filename) == 0) || (offset < 0))
+      return nullptr;
+   if (maxbuf < 100000)
+      maxbuf = 100000;
+
+   TXMLInputStream inp(true, filename, maxbuf, offset);
+
+   Int_t resvalue;
+
+   XMLNodePointer_t xmlnode = ReadNode(0, &inp, resvalue);
+
+   if (resvalue <= 0) {
+      DisplayError(resvalue, inp.CurrentLine());
+      FreeNode(xmlnode);
+      return nullptr;
+   }
+
+   return xmlnode;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// check that first node is xml processing instruction with correct xml version number
 
@@ -1661,6 +1932,54 @@ void TXMLEngine::OutputValue(char *value, TXMLOutputStream *out)
       out->Write(last);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// stream name and attributes of xmlnode to output, without the end of the start tag
+
+void TXMLEngine::SaveNodeStart(XMLNodePointer_t xmlnode, TXMLOutputStream *out)
+{
+   SXmlNode_t *node = (SXmlNode_t *)xmlnode;
+
+   out->Put('<');
+   if (node->fType == kXML_PI_NODE)
+      out->Put('?');
+
+   // we suppose that ns is always first attribute
+   if ((node->fNs != 0) && (node->fNs != node->fAttr)) {
+      out->Write(SXmlAttr_t::Name(node->fNs) + 6);
+      out->Put(':');
+   }
+   out->Write(SXmlNode_t::Name(node));
+
+   SXmlAttr_t *attr = node->fAttr;
+   while (attr != 0) {
+      out->Put(' ');
+      char *attrname = SXmlAttr_t::Name(attr);
+      out->Write(attrname);
+      out->Write("=\"");
+      attrname += strlen(attrname) + 1;
+      OutputValue(attrname, out);
+      out->Put('\"');
+      attr = attr->fNext;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// stream end tag of xmlnode to output
+
+void TXMLEngine::SaveNodeEnd(XMLNodePointer_t xmlnode, TXMLOutputStream *out)
+{
+   SXmlNode_t *node = (SXmlNode_t *)xmlnode;
+
+   out->Write("</");
+   // we suppose that ns is always first attribute
+   if ((node->fNs != 0) && (node->fNs != node->fAttr)) {
+      out->Write(SXmlAttr_t::Name(node->fNs) + 6);
+      out->Put(':');
+   }
+   out->Write(SXmlNode_t::Name(node));
+   out->Put('>');
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// stream data of xmlnode to output
 
@@ -1694,28 +2013,7 @@ void TXMLEngine::SaveNode(XMLNodePointer_t xmlnode, TXMLOutputStream *out, Int_t
       return;
    }
 
-   out->Put('<');
-   if (node->fType == kXML_PI_NODE)
-      out->Put('?');
-
-   // we suppose that ns is always first attribute
-   if ((node->fNs != 0) && (node->fNs != node->fAttr)) {
-      out->Write(SXmlAttr_t::Name(node->fNs) + 6);
-      out->Put(':');
-   }
-   out->Write(SXmlNode_t::Name(node));
-
-   SXmlAttr_t *attr = node->fAttr;
-   while (attr != 0) {
-      out->Put(' ');
-      char *attrname = SXmlAttr_t::Name(attr);
-      out->Write(attrname);
-      out->Write("=\"");
-      attrname += strlen(attrname) + 1;
-      OutputValue(attrname, out);
-      out->Put('\"');
-      attr = attr->fNext;
-   }
+   SaveNodeStart(xmlnode, out);
 
    // if single line, close node with "/>" and return
    if (issingleline) {
@@ -1747,14 +2045,7 @@ void TXMLEngine::SaveNode(XMLNodePointer_t xmlnode, TXMLOutputStream *out, Int_t
          out->Put(' ', level);
    }
 
-   out->Write("</");
-   // we suppose that ns is always first attribute
-   if ((node->fNs != 0) && (node->fNs != node->fAttr)) {
-      out->Write(SXmlAttr_t::Name(node->fNs) + 6);
-      out->Put(':');
-   }
-   out->Write(SXmlNode_t::Name(node));
-   out->Put('>');
+   SaveNodeEnd(xmlnode, out);
    if (layout > 0)
       out->Put('\n');
 }
@@ -1765,8 +2056,10 @@ void TXMLEngine::SaveNode(XMLNodePointer_t xmlnode, TXMLOutputStream *out, Int_t
 /// resvalue <= 0 if error
 /// resvalue == 1 if this is endnode of parent
 /// resvalue == 2 if this is child
+/// resvalue == 3 if openonly is specified and only the start tag of a node
+///               with children was read, the children are not read
 
-XMLNodePointer_t TXMLEngine::ReadNode(XMLNodePointer_t xmlparent, TXMLInputStream *inp, Int_t &resvalue)
+XMLNodePointer_t TXMLEngine::ReadNode(XMLNodePointer_t xmlparent, TXMLInputStream *inp, Int_t &resvalue, Bool_t openonly)
 {
    resvalue = 0;
 
@@ -2157,6 +2450,11 @@ XMLNodePointer_t TXMLEngine::ReadNode(XMLNodePointer_t xmlparent, TXMLInputStrea
          if (!inp->ShiftCurrent())
             return 0;
 
+         if (openonly) {
+            resvalue = 3;
+            return node;
+         }
+
          do {
             ReadNode(node, inp, resvalue);
          } while (resvalue == 2);
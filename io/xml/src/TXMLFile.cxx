@@ -22,6 +22,12 @@
 // The XML format should be used only for small data volumes,
 // typically histogram files, pictures, geometries, calibrations.
 // The XML file is built in memory before being dumped to disk.
+// With XMLFile.Streaming enabled in .rootrc, new files instead get each
+// object of the top directory written as soon as it is stored, and
+// files opened for reading are parsed key by key: only the key
+// attributes are kept in memory and the object node is read again from
+// the file when the object is read. Keys of subdirectories are still
+// kept in memory until the file is closed.
 //
 // Like for normal ROOT files, XML files use the same I/O mechanism
 // exploiting the ROOT/CINT dictionary. Any class having a dictionary
@@ -85,6 +91,7 @@
 #include "TError.h"
 #include "TClass.h"
 #include "TVirtualMutex.h"
+#include "TEnv.h"
 #include <ROOT/RMakeUnique.hxx>
 
 ClassImp(TXMLFile);
@@ -267,6 +274,9 @@ void TXMLFile::InitXmlFile(Bool_t create)
    fClassIndex = new TArrayC(len);
    fClassIndex->Reset(0);
 
+   // an updated file is rewritten completely when closed, all its nodes are needed
+   fStreaming = (create || !IsWritable()) && (gEnv->GetValue("XMLFile.Streaming", 0) != 0);
+
    if (create) {
       fDoc = fXML->NewDoc();
       XMLNodePointer_t fRootNode = fXML->NewChild(nullptr, nullptr, xmlio::Root);
@@ -384,6 +394,11 @@ Int_t TXMLFile::ReOpen(Option_t *mode)
    if (opt == fOption || (opt == "UPDATE" && fOption == "CREATE"))
       return 1;
 
+   if (fStreaming) {
+      Error("ReOpen", "Cannot change mode of file %s opened in streaming mode", GetName());
+      return 1;
+   }
+
    if (opt == "READ") {
       // switch to READ mode
 
@@ -461,43 +476,35 @@ void TXMLFile::SaveToFile()
 
    XMLNodePointer_t fRootNode = fXML->DocGetRootElement(fDoc);
 
-   fXML->FreeAttr(fRootNode, xmlio::Setup);
-   fXML->NewAttr(fRootNode, nullptr, xmlio::Setup, GetSetupAsString());
-
-   fXML->FreeAttr(fRootNode, xmlio::Ref);
-   fXML->NewAttr(fRootNode, nullptr, xmlio::Ref, xmlio::Null);
-
-   if (GetIOVersion() > 1) {
-
-      fXML->FreeAttr(fRootNode, xmlio::CreateTm);
-      if (TestBit(TFile::kReproducible))
-         fXML->NewAttr(fRootNode, nullptr, xmlio::CreateTm, TDatime((UInt_t) 1).AsSQLString());
-      else
-         fXML->NewAttr(fRootNode, nullptr, xmlio::CreateTm, fDatimeC.AsSQLString());
-
-      fXML->FreeAttr(fRootNode, xmlio::ModifyTm);
-      if (TestBit(TFile::kReproducible))
-         fXML->NewAttr(fRootNode, nullptr, xmlio::ModifyTm, TDatime((UInt_t) 1).AsSQLString());
-      else
-         fXML->NewAttr(fRootNode, nullptr, xmlio::ModifyTm, fDatimeM.AsSQLString());
+   if (fStreaming) {
+      // keys of the top directory which kept their nodes, like subdirectories, are written now
+      if (!fStream)
+         StreamKey(nullptr);
 
-      fXML->FreeAttr(fRootNode, xmlio::ObjectUUID);
-      if (TestBit(TFile::kReproducible))
-         fXML->NewAttr(fRootNode, nullptr, xmlio::ObjectUUID, TUUID("00000000-0000-0000-0000-000000000000").AsString());
-      else
-         fXML->NewAttr(fRootNode, nullptr, xmlio::ObjectUUID, fUUID.AsString());
+      TIter iter(GetListOfKeys());
+      TKeyXML *key = nullptr;
+      while ((key = (TKeyXML *)iter()) != nullptr) {
+         if (!key->KeyNode())
+            continue;
+         if (key->IsSubdir())
+            CombineNodesTree(FindKeyDir(this, key->GetKeyId()), key->KeyNode(), kTRUE);
+         fXML->SaveDocNode(fStream, key->KeyNode());
+         if (key->IsSubdir())
+            CombineNodesTree(FindKeyDir(this, key->GetKeyId()), key->KeyNode(), kFALSE);
+      }
 
-      fXML->FreeAttr(fRootNode, xmlio::Title);
-      if (strlen(GetTitle()) > 0)
-         fXML->NewAttr(fRootNode, nullptr, xmlio::Title, GetTitle());
+      WriteStreamerInfo();
 
-      fXML->FreeAttr(fRootNode, xmlio::IOVersion);
-      fXML->NewIntAttr(fRootNode, xmlio::IOVersion, GetIOVersion());
+      if (fStreamerInfoNode)
+         fXML->SaveDocNode(fStream, fStreamerInfoNode);
 
-      fXML->FreeAttr(fRootNode, "file_version");
-      fXML->NewIntAttr(fRootNode, "file_version", fVersion);
+      fXML->SaveDocFinish(fStream);
+      fStream = nullptr;
+      return;
    }
 
+   StoreRootAttributes(fRootNode);
+
    TString fname, dtdname;
    ProduceFileNames(fRealName, fname, dtdname);
 
@@ -529,6 +536,101 @@ void TXMLFile::SaveToFile()
       fXML->UnlinkNode(fStreamerInfoNode);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Store file attributes in the root node
+
+void TXMLFile::StoreRootAttributes(XMLNodePointer_t rootnode)
+{
+   fXML->FreeAttr(rootnode, xmlio::Setup);
+   fXML->NewAttr(rootnode, nullptr, xmlio::Setup, GetSetupAsString());
+
+   fXML->FreeAttr(rootnode, xmlio::Ref);
+   fXML->NewAttr(rootnode, nullptr, xmlio::Ref, xmlio::Null);
+
+   if (GetIOVersion() > 1) {
+
+      fXML->FreeAttr(rootnode, xmlio::CreateTm);
+      if (TestBit(TFile::kReproducible))
+         fXML->NewAttr(rootnode, nullptr, xmlio::CreateTm, TDatime((UInt_t) 1).AsSQLString());
+      else
+         fXML->NewAttr(rootnode, nullptr, xmlio::CreateTm, fDatimeC.AsSQLString());
+
+      fXML->FreeAttr(rootnode, xmlio::ModifyTm);
+      if (TestBit(TFile::kReproducible))
+         fXML->NewAttr(rootnode, nullptr, xmlio::ModifyTm, TDatime((UInt_t) 1).AsSQLString());
+      else
+         fXML->NewAttr(rootnode, nullptr, xmlio::ModifyTm, fDatimeM.AsSQLString());
+
+      fXML->FreeAttr(rootnode, xmlio::ObjectUUID);
+      if (TestBit(TFile::kReproducible))
+         fXML->NewAttr(rootnode, nullptr, xmlio::ObjectUUID, TUUID("00000000-0000-0000-0000-000000000000").AsString());
+      else
+         fXML->NewAttr(rootnode, nullptr, xmlio::ObjectUUID, fUUID.AsString());
+
+      fXML->FreeAttr(rootnode, xmlio::Title);
+      if (strlen(GetTitle()) > 0)
+         fXML->NewAttr(rootnode, nullptr, xmlio::Title, GetTitle());
+
+      fXML->FreeAttr(rootnode, xmlio::IOVersion);
+      fXML->NewIntAttr(rootnode, xmlio::IOVersion, GetIOVersion());
+
+      fXML->FreeAttr(rootnode, "file_version");
+      fXML->NewIntAttr(rootnode, "file_version", fVersion);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// In streaming mode, writes node of the key of the top directory to the file
+/// and releases it. When called first, the file is created and the root node
+/// is written with the file attributes, which are therefore those of the moment
+/// the first key is written.
+/// With key == nullptr, only creates the file if it was not done yet.
+
+Bool_t TXMLFile::StreamKey(TKeyXML *key)
+{
+   if (!fStreaming || !fDoc || !IsWritable())
+      return kFALSE;
+
+   if (key && (!key->KeyNode() || key->IsSubdir() || (key->GetMotherDir() != this)))
+      return kFALSE;
+
+   if (!fStream) {
+      StoreRootAttributes(fXML->DocGetRootElement(fDoc));
+
+      TString fname, dtdname;
+      ProduceFileNames(fRealName, fname, dtdname);
+
+      fStream = fXML->SaveDocStart(fDoc, fname, GetCompressionLevel() > 5 ? 0 : 1);
+      if (!fStream)
+         return kFALSE;
+   }
+
+   if (!key)
+      return kTRUE;
+
+   Long64_t offset = fXML->SaveDocNode(fStream, key->KeyNode());
+   if (offset < 0)
+      return kFALSE;
+
+   key->UnloadNode(offset);
+
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read node of a key, released in streaming mode, from the file
+
+XMLNodePointer_t TXMLFile::ReadKeyNode(Long64_t offset)
+{
+   if (IsWritable()) {
+      Error("ReadKeyNode", "Object already written to file %s in streaming mode, it can be read only after closing the file",
+            GetName());
+      return nullptr;
+   }
+
+   return fXML->ReadFileNode(fRealName, offset);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Connect/disconnect all file nodes to single tree before/after saving
 
@@ -558,13 +660,18 @@ void TXMLFile::CombineNodesTree(TDirectory *dir, XMLNodePointer_t topnode, Bool_
 
 Bool_t TXMLFile::ReadFromFile()
 {
-   fDoc = fXML->ParseFile(fRealName);
+   XMLStreamPointer_t stream = nullptr;
+   if (fStreaming)
+      stream = fXML->ParseFileStart(fRealName, fDoc);
+   else
+      fDoc = fXML->ParseFile(fRealName);
    if (!fDoc)
       return kFALSE;
 
    XMLNodePointer_t fRootNode = fXML->DocGetRootElement(fDoc);
 
    if (!fRootNode || !fXML->ValidateVersion(fDoc)) {
+      fXML->ParseFileFinish(stream);
       fXML->FreeDoc(fDoc);
       fDoc = nullptr;
       return kFALSE;
@@ -598,6 +705,9 @@ Bool_t TXMLFile::ReadFromFile()
    if (fXML->HasAttr(fRootNode, "file_version"))
       fVersion = fXML->GetIntAttr(fRootNode, "file_version");
 
+   if (stream)
+      return ReadKeysStream(stream);
+
    fStreamerInfoNode = fXML->GetChild(fRootNode);
    fXML->SkipEmpty(fStreamerInfoNode);
    while (fStreamerInfoNode) {
@@ -624,6 +734,55 @@ Bool_t TXMLFile::ReadFromFile()
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read keys of the top directory one by one from the document opened in streaming mode.
+/// Only the key attributes are kept, except for keys of subdirectories, which
+/// contain the keys of the subdirectory.
+
+Bool_t TXMLFile::ReadKeysStream(XMLStreamPointer_t stream)
+{
+   Long64_t offset = 0;
+   XMLNodePointer_t node = nullptr;
+
+   while ((node = fXML->ParseFileNode(stream, &offset)) != nullptr) {
+      if (!fStreamerInfoNode && (strcmp(xmlio::SInfos, fXML->GetNodeName(node)) == 0)) {
+         fStreamerInfoNode = node;
+         continue;
+      }
+
+      if (strcmp(xmlio::Xmlkey, fXML->GetNodeName(node)) != 0) {
+         fXML->FreeNode(node);
+         continue;
+      }
+
+      TKeyXML *key = new TKeyXML(this, ++fKeyCounter, node);
+      AppendKey(key);
+
+      Bool_t hassubkeys = kFALSE;
+      XMLNodePointer_t child = fXML->GetChild(node);
+      while (child && !hassubkeys) {
+         hassubkeys = (strcmp(xmlio::Xmlkey, fXML->GetNodeName(child)) == 0);
+         fXML->ShiftToNext(child);
+      }
+      if (!hassubkeys)
+         key->UnloadNode(offset);
+
+      if (gDebug > 2)
+         Info("ReadKeysStream", "Add key %s at offset %lld", key->GetName(), offset);
+   }
+
+   if (!fXML->ParseFileFinish(stream)) {
+      fXML->FreeDoc(fDoc);
+      fDoc = nullptr;
+      return kFALSE;
+   }
+
+   if (fStreamerInfoNode)
+      ReadStreamerInfo();
+
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read list of keys for directory
 
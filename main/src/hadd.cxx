@@ -111,6 +111,7 @@ int main( int argc, char **argv )
    Bool_t multiproc = kFALSE;
    Bool_t debug = kFALSE;
    Int_t maxopenedfiles = 0;
+   Long64_t memoryBudget = 0;
    Int_t verbosity = 99;
    TString cacheSize;
    SysInfo_t s;
@@ -257,6 +258,21 @@ int main( int argc, char **argv )
             }
          }
          ++ffirst;
+      } else if ( strcmp(argv[a],"-memlimit") == 0 ) {
+         if (a+1 >= argc) {
+            std::cerr << "Error: no memory limit was provided after -memlimit.\n";
+         } else {
+            Long64_t size;
+            auto parseResult = ROOT::FromHumanReadableSize(argv[a+1],size);
+            if (parseResult == ROOT::EFromHumanReadableSize::kSuccess && size >= 0) {
+               memoryBudget = size;
+               ++a;
+               ++ffirst;
+            } else {
+               std::cerr << "Error: could not parse the memory limit passed after -memlimit: " << argv[a+1] << ". The memory use will not be limited.\n";
+            }
+         }
+         ++ffirst;
       } else if ( strcmp(argv[a],"-v") == 0 ) {
          if (a+1 == argc || argv[a+1][0] == '-') {
             // Verbosity level was not specified use the default:
@@ -350,6 +366,7 @@ int main( int argc, char **argv )
    if (maxopenedfiles > 0) {
       fileMerger.SetMaxOpenedFiles(maxopenedfiles);
    }
+   fileMerger.SetMemoryBudget(memoryBudget);
    if (newcomp == -1) {
       if (useFirstInputCompression || keepCompressionAsIs) {
          // grab from the first file.
@@ -473,6 +490,7 @@ int main( int argc, char **argv )
       if (maxopenedfiles > 0) {
          mergerP.SetMaxOpenedFiles(maxopenedfiles / nProcesses);
       }
+      mergerP.SetMemoryBudget(memoryBudget / nProcesses);
       if (!mergerP.OutputFile(partialFiles[(start - ffirst) / step].c_str(), newcomp)) {
          std::cerr << "hadd error opening target partial file" << std::endl;
          exit(1);
@@ -0,0 +1,47 @@
+// @(#)root/fft:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TFFTWPlanCache
+#define ROOT_TFFTWPlanCache
+
+#include "Rtypes.h"
+
+class TFFTWPlanCache {
+public:
+   enum EPlanType {
+      kC2C,   // complex to complex, TFFTComplex
+      kR2C,   // real to complex, TFFTRealComplex
+      kC2R,   // complex to real, TFFTComplexReal
+      kR2R    // real to real, TFFTReal
+   };
+
+   // Used by the interface classes to the FFTW package
+   static void  *Acquire(EPlanType type, Int_t ndim, const Int_t *n, Int_t sign, const Int_t *kind,
+                         UInt_t flags, void *in, void *out);
+   static void   Release(void *plan);
+   static void   Execute(void *plan, EPlanType type, void *in, void *out);
+
+   static void   Clear();
+   static Int_t  GetNPlans();
+
+   static Bool_t ExportWisdom(const char *filename);
+   static Bool_t ImportWisdom(const char *filename);
+   static void   ForgetWisdom();
+
+   static Bool_t HasThreads();
+   static void   SetNThreads(Int_t nthreads);
+   static Int_t  GetNThreads();
+   static void   SetMinThreadedSize(Int_t size);
+   static Int_t  GetMinThreadedSize();
+
+   ClassDef(TFFTWPlanCache,0)  // Cache of the FFTW plans shared by the FFTW interface classes
+};
+
+#endif
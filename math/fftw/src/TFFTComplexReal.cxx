@@ -42,6 +42,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTComplexReal.h"
+#include "TFFTWPlanCache.h"
 #include "fftw3.h"
 #include "TComplex.h"
 
@@ -108,13 +109,12 @@ TFFTComplexReal::TFFTComplexReal(Int_t ndim, Int_t *n, Bool_t inPlace)
 
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays and gives back the plan, which stays in the TFFTWPlanCache
+///for the other transforms of the same size and type
 
 TFFTComplexReal::~TFFTComplexReal()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
+   TFFTWPlanCache::Release(fPlan);
    fPlan = 0;
    fftw_free((fftw_complex*)fIn);
    if (fOut)
@@ -143,20 +143,16 @@ TFFTComplexReal::~TFFTComplexReal()
 ///
 ///This option should be chosen depending on how many transforms of the same size and
 ///type are going to be done. Planning is only done once, for the first transform of this
-///size and type.
+///size and type: the plans are shared by all the objects through the TFFTWPlanCache.
 
 void TFFTComplexReal::Init( Option_t *flags, Int_t /*sign*/,const Int_t* /*kind*/)
 {
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
+   TFFTWPlanCache::Release(fPlan);
    fPlan = 0;
 
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft_c2r(fNdim, fN,(fftw_complex*)fIn,(Double_t*)fOut, MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft_c2r(fNdim, fN, (fftw_complex*)fIn, (Double_t*)fIn, MapFlag(flags));
+   fPlan = TFFTWPlanCache::Acquire(TFFTWPlanCache::kC2R, fNdim, fN, 0, 0, MapFlag(flags), fIn, fOut);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -165,7 +161,7 @@ void TFFTComplexReal::Init( Option_t *flags, Int_t /*sign*/,const Int_t* /*kind*
 void TFFTComplexReal::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      TFFTWPlanCache::Execute(fPlan, TFFTWPlanCache::kC2R, fIn, fOut);
    else {
       Error("Transform", "transform was not initialized");
       return;
@@ -59,8 +59,11 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTReal.h"
+#include "TFFTWPlanCache.h"
 #include "fftw3.h"
 
+#include <vector>
+
 ClassImp(TFFTReal);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -123,7 +126,7 @@ TFFTReal::TFFTReal(Int_t ndim, Int_t *n, Bool_t inPlace)
 
 TFFTReal::~TFFTReal()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
+   TFFTWPlanCache::Release(fPlan);
    fPlan = 0;
    fftw_free(fIn);
    fIn = 0;
@@ -156,7 +159,7 @@ TFFTReal::~TFFTReal()
 ///
 ///  This option should be chosen depending on how many transforms of the same size and
 ///  type are going to be done. Planning is only done once, for the first transform of this
-///  size and type.
+///  size and type: the plans are shared by all the objects through the TFFTWPlanCache.
 ///
 /// #### 2nd parameter:
 ///    is dummy and doesn't need to be specified
@@ -175,18 +178,17 @@ TFFTReal::~TFFTReal()
 
 void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 {
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
+   TFFTWPlanCache::Release(fPlan);
    fPlan = 0;
 
    if (!fKind)
       fKind = (fftw_r2r_kind*)fftw_malloc(sizeof(fftw_r2r_kind)*fNdim);
 
    if (MapOptions(kind)){
-      if (fOut)
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fOut, (fftw_r2r_kind*)fKind, MapFlag(flags));
-      else
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fIn, (fftw_r2r_kind*)fKind, MapFlag(flags));
+      std::vector<Int_t> kinds(fNdim);
+      for (Int_t i=0; i<fNdim; i++)
+         kinds[i] = ((fftw_r2r_kind*)fKind)[i];
+      fPlan = TFFTWPlanCache::Acquire(TFFTWPlanCache::kR2R, fNdim, fN, 0, kinds.data(), MapFlag(flags), fIn, fOut);
       fFlags = flags;
    }
 }
@@ -197,7 +199,7 @@ void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 void TFFTReal::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      TFFTWPlanCache::Execute(fPlan, TFFTWPlanCache::kR2R, fIn, fOut);
    else {
       Error("Transform", "transform hasn't been initialised");
       return;
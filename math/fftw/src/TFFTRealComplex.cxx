@@ -43,6 +43,7 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 #include "TFFTRealComplex.h"
+#include "TFFTWPlanCache.h"
 #include "fftw3.h"
 #include "TComplex.h"
 
@@ -112,13 +113,12 @@ TFFTRealComplex::TFFTRealComplex(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays and gives back the plan, which stays in the TFFTWPlanCache
+///for the other transforms of the same size and type
 
 TFFTRealComplex::~TFFTRealComplex()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
+   TFFTWPlanCache::Release(fPlan);
    fPlan = 0;
    fftw_free(fIn);
    fIn = 0;
@@ -147,20 +147,16 @@ TFFTRealComplex::~TFFTRealComplex()
 ///
 ///This option should be chosen depending on how many transforms of the same size and
 ///type are going to be done. Planning is only done once, for the first transform of this
-///size and type.
+///size and type: the plans are shared by all the objects through the TFFTWPlanCache.
 
 void TFFTRealComplex::Init(Option_t *flags,Int_t /*sign*/, const Int_t* /*kind*/)
 {
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
+   TFFTWPlanCache::Release(fPlan);
    fPlan = 0;
 
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fOut,MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fIn, MapFlag(flags));
+   fPlan = TFFTWPlanCache::Acquire(TFFTWPlanCache::kR2C, fNdim, fN, 0, 0, MapFlag(flags), fIn, fOut);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -170,7 +166,7 @@ void TFFTRealComplex::Transform()
 {
 
    if (fPlan){
-      fftw_execute((fftw_plan)fPlan);
+      TFFTWPlanCache::Execute(fPlan, TFFTWPlanCache::kR2C, fIn, fOut);
    }
    else {
       Error("Transform", "transform hasn't been initialised");
@@ -0,0 +1,322 @@
+// @(#)root/fft:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class TFFTWPlanCache
+///
+/// Cache of the FFTW plans, shared by TFFTComplex, TFFTRealComplex,
+/// TFFTComplexReal and TFFTReal.
+///
+/// A plan is created for the first transform of a given type, size, sign
+/// (or kinds), planning flags and placement (in-place or not), and reused
+/// by all the later transforms with the same parameters, whatever the
+/// object: each object executes the shared plan on its own arrays. The
+/// arrays allocated by the interface classes with fftw_malloc() all have
+/// the alignment required to do so. Creating the same transform again, as
+/// done for instance by RooFFTConvPdf, therefore no longer costs a planning,
+/// and Init() only overwrites the arrays when a new plan is made.
+///
+/// All the calls to the FFTW planner, which is not thread-safe, are
+/// serialised by the cache. The plans stay in the cache until Clear() is
+/// called, which destroys the ones that are not in use.
+///
+/// The knowledge accumulated by the planner (the "wisdom") can be saved in
+/// a file with ExportWisdom() and loaded in a later session with
+/// ImportWisdom(), so that the "M", "P" or "EX" plans are made without
+/// measuring again.
+///
+/// If the FFTW threads library is available (see HasThreads()), the
+/// transforms of at least GetMinThreadedSize() points are planned to run
+/// on several threads: SetNThreads() of them, or by default as many as the
+/// thread pool of the implicit multi-threading when it is enabled.
+///
+/// Example:
+/// ~~~{.cpp}
+///    TFFTWPlanCache::ImportWisdom("fftw.wisdom");
+///    ROOT::EnableImplicitMT();
+///    ... many transforms, e.g. fits with RooFFTConvPdf
+///    TFFTWPlanCache::ExportWisdom("fftw.wisdom");
+/// ~~~
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TFFTWPlanCache.h"
+#include "fftw3.h"
+#include "TError.h"
+#include "TROOT.h"
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+ClassImp(TFFTWPlanCache);
+
+namespace {
+
+struct TPlanEntry {
+   void *fPlan;  // The fftw_plan
+   Int_t fUsers; // Number of objects using the plan
+};
+
+struct TPlanCacheState {
+   std::mutex fMutex;                                   // Serialises the calls to the FFTW planner
+   std::map<std::vector<Long64_t>, TPlanEntry> fPlans;  // Plans by type, sizes, sign/kinds, flags, placement and threads
+   Int_t fNThreads = 0;                                 // Number of threads, 0 to follow the implicit multi-threading
+   Int_t fMinThreadedSize = 1 << 15;                    // Minimal size of the multi-threaded transforms
+   Bool_t fThreadsInitialised = kFALSE;                 // Whether fftw_init_threads() was called
+};
+
+// Never deleted, the plans may be released by objects destroyed at the end of the process
+TPlanCacheState &GetState()
+{
+   static TPlanCacheState *state = new TPlanCacheState;
+   return *state;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the plan of the transform, creating it on the arrays in and out
+/// (out is 0 for an in-place transform) if it is not in the cache yet.
+/// sign is only used by the kC2C transforms, kind (ndim fftw_r2r_kind) only
+/// by the kR2R ones. The plan must be given back with Release().
+
+void *TFFTWPlanCache::Acquire(EPlanType type, Int_t ndim, const Int_t *n, Int_t sign, const Int_t *kind,
+                              UInt_t flags, void *in, void *out)
+{
+   TPlanCacheState &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+
+   Long64_t size = 1;
+   for (Int_t i = 0; i < ndim; i++)
+      size *= n[i];
+   Int_t nthreads = 1;
+   if (HasThreads() && size >= state.fMinThreadedSize) {
+      if (state.fNThreads > 0)
+         nthreads = state.fNThreads;
+      else if (ROOT::IsImplicitMTEnabled())
+         nthreads = ROOT::GetThreadPoolSize();
+   }
+
+   std::vector<Long64_t> key{type, ndim, flags, out == 0, nthreads};
+   key.insert(key.end(), n, n + ndim);
+   if (type == kC2C)
+      key.push_back(sign);
+   if (type == kR2R)
+      key.insert(key.end(), kind, kind + ndim);
+
+   auto found = state.fPlans.find(key);
+   if (found != state.fPlans.end()) {
+      found->second.fUsers++;
+      return found->second.fPlan;
+   }
+
+#ifdef R__HAS_FFTW_THREADS
+   if (nthreads > 1 && !state.fThreadsInitialised)
+      state.fThreadsInitialised = fftw_init_threads() != 0;
+   if (state.fThreadsInitialised)
+      fftw_plan_with_nthreads(nthreads);
+#endif
+
+   if (!out)
+      out = in;
+   void *plan = 0;
+   switch (type) {
+   case kC2C:
+      plan = (void*)fftw_plan_dft(ndim, n, (fftw_complex*)in, (fftw_complex*)out, sign, flags);
+      break;
+   case kR2C:
+      plan = (void*)fftw_plan_dft_r2c(ndim, n, (Double_t*)in, (fftw_complex*)out, flags);
+      break;
+   case kC2R:
+      plan = (void*)fftw_plan_dft_c2r(ndim, n, (fftw_complex*)in, (Double_t*)out, flags);
+      break;
+   case kR2R: {
+      std::vector<fftw_r2r_kind> kinds(ndim);
+      for (Int_t i = 0; i < ndim; i++)
+         kinds[i] = (fftw_r2r_kind)kind[i];
+      plan = (void*)fftw_plan_r2r(ndim, n, (Double_t*)in, (Double_t*)out, kinds.data(), flags);
+      break;
+   }
+   }
+   if (!plan) {
+      ::Error("TFFTWPlanCache::Acquire", "FFTW could not create the plan");
+      return 0;
+   }
+   state.fPlans[key] = TPlanEntry{plan, 1};
+   return plan;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Gives back a plan returned by Acquire(). It stays in the cache for the
+/// next transforms with the same parameters.
+
+void TFFTWPlanCache::Release(void *plan)
+{
+   if (!plan)
+      return;
+   TPlanCacheState &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   for (auto &entry : state.fPlans) {
+      if (entry.second.fPlan == plan) {
+         entry.second.fUsers--;
+         return;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Executes the plan on the arrays in and out (0 for an in-place transform),
+/// which must have the alignment of the ones of fftw_malloc() and the same
+/// placement as the arrays of the planning.
+
+void TFFTWPlanCache::Execute(void *plan, EPlanType type, void *in, void *out)
+{
+   if (!out)
+      out = in;
+   switch (type) {
+   case kC2C:
+      fftw_execute_dft((fftw_plan)plan, (fftw_complex*)in, (fftw_complex*)out);
+      break;
+   case kR2C:
+      fftw_execute_dft_r2c((fftw_plan)plan, (Double_t*)in, (fftw_complex*)out);
+      break;
+   case kC2R:
+      fftw_execute_dft_c2r((fftw_plan)plan, (fftw_complex*)in, (Double_t*)out);
+      break;
+   case kR2R:
+      fftw_execute_r2r((fftw_plan)plan, (Double_t*)in, (Double_t*)out);
+      break;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destroys the plans of the cache that are not in use.
+
+void TFFTWPlanCache::Clear()
+{
+   TPlanCacheState &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   for (auto entry = state.fPlans.begin(); entry != state.fPlans.end();) {
+      if (entry->second.fUsers <= 0) {
+         fftw_destroy_plan((fftw_plan)entry->second.fPlan);
+         entry = state.fPlans.erase(entry);
+      } else {
+         ++entry;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the number of plans in the cache.
+
+Int_t TFFTWPlanCache::GetNPlans()
+{
+   TPlanCacheState &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   return state.fPlans.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Saves the wisdom accumulated by the FFTW planner in the file.
+/// Returns kFALSE if the file could not be written.
+
+Bool_t TFFTWPlanCache::ExportWisdom(const char *filename)
+{
+   TPlanCacheState &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   if (!fftw_export_wisdom_to_filename(filename)) {
+      ::Error("TFFTWPlanCache::ExportWisdom", "cannot write the wisdom to %s", filename);
+      return kFALSE;
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Adds the wisdom saved in the file by ExportWisdom() to the one of the
+/// FFTW planner. It is used by the plans created afterwards.
+/// Returns kFALSE if the file could not be read.
+
+Bool_t TFFTWPlanCache::ImportWisdom(const char *filename)
+{
+   TPlanCacheState &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   if (!fftw_import_wisdom_from_filename(filename)) {
+      ::Error("TFFTWPlanCache::ImportWisdom", "cannot read the wisdom from %s", filename);
+      return kFALSE;
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Forgets the wisdom of the FFTW planner. The existing plans stay valid.
+
+void TFFTWPlanCache::ForgetWisdom()
+{
+   TPlanCacheState &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   fftw_forget_wisdom();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns kTRUE if ROOT was built with the FFTW threads library, i.e. if
+/// the transforms can be multi-threaded.
+
+Bool_t TFFTWPlanCache::HasThreads()
+{
+#ifdef R__HAS_FFTW_THREADS
+   return kTRUE;
+#else
+   return kFALSE;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sets the number of threads of the transforms of at least
+/// GetMinThreadedSize() points planned afterwards. With 0, the default, it is
+/// the size of the thread pool of the implicit multi-threading if it is
+/// enabled, else 1.
+
+void TFFTWPlanCache::SetNThreads(Int_t nthreads)
+{
+   TPlanCacheState &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   state.fNThreads = nthreads < 0 ? 0 : nthreads;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the number of threads set with SetNThreads().
+
+Int_t TFFTWPlanCache::GetNThreads()
+{
+   TPlanCacheState &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   return state.fNThreads;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sets the minimal total size of the transforms run on several threads,
+/// 32768 by default: on smaller ones the threads cost more than they gain.
+
+void TFFTWPlanCache::SetMinThreadedSize(Int_t size)
+{
+   TPlanCacheState &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   state.fMinThreadedSize = size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the minimal total size of the transforms run on several threads.
+
+Int_t TFFTWPlanCache::GetMinThreadedSize()
+{
+   TPlanCacheState &state = GetState();
+   std::lock_guard<std::mutex> lock(state.fMutex);
+   return state.fMinThreadedSize;
+}
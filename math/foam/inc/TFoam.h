@@ -19,6 +19,19 @@ class TFoamVect;
 class TFoamCell;
 
 class TFoam : public TObject {
+public:
+   /// Statistics of the MC events generated with GenerateEvent() and Sample(),
+   /// which do not modify the foam, to be added to it with AddSampleStats()
+   struct SampleStats {
+      Long_t   fNCalls = 0;        ///< Number of the function calls
+      Double_t fSumWt = 0.;        ///< Sum of wt
+      Double_t fSumWt2 = 0.;       ///< Sum of wt^2
+      Double_t fSumOve = 0.;       ///< Sum of overweighted events
+      Double_t fNevGen = 0.;       ///< Number of generated MC events
+      Double_t fWtMax = -1.0e150;  ///< Maximum MC weight
+      Double_t fWtMin = 1.0e150;   ///< Minimum MC weight
+   };
+
 protected:
 
    TString fName;             ///< Name of a given instance of the FOAM class
@@ -73,6 +86,12 @@ protected:
 
    Double_t *fAlpha;          ///< [fDim] Internal parameters of the hyper-rectangle
 
+   std::vector<Double_t> fActPosi; ///<! Positions of the active cells, fDim per cell, for GenerateEvent()
+   std::vector<Double_t> fActSize; ///<! Sizes of the active cells, fDim per cell, for GenerateEvent()
+
+   Long_t   FindActiveCell(Double_t random) const;  // Index of the active cell chosen with the random number
+   Double_t EvalDensity(Double_t *xRand) const;      // Evaluates the distribution function
+
 public:
    TFoam();                          // Default constructor (used only by ROOT streamer)
    TFoam(const Char_t*);             // Principal user-defined constructor
@@ -99,6 +118,12 @@ public:
    virtual void     GetMCwt(Double_t &);     // Provides generated MC weight
    virtual Double_t GetMCwt();               // Provides generates MC weight
    virtual Double_t MCgenerate(Double_t *MCvect);// All three above function in one
+   // Thread-safe generation
+   virtual void     InitSampling();          // Tabulates the active cells for the thread-safe generation
+   virtual Double_t GenerateEvent(TRandom *rnd, Double_t *MCvect, SampleStats *stats = nullptr) const; // Generates one event with generator rnd, returns its weight
+   virtual void     Sample(Long64_t n, Double_t *MCvect, Double_t *MCwt, TRandom *rnd, SampleStats *stats = nullptr) const; // Generates n events with generator rnd
+   virtual void     SampleParallel(Long64_t n, Double_t *MCvect, Double_t *MCwt, UInt_t seed, Int_t nstreams = 16); // Generates n events on independent streams, in parallel
+   virtual void     AddSampleStats(const SampleStats &stats); // Adds statistics of GenerateEvent() to the MC series
    // Finalization
    virtual void GetIntegMC(Double_t&, Double_t&);// Provides Integrand and abs. error from MC run
    virtual void GetIntNorm(Double_t&, Double_t&);// Provides normalization Inegrand
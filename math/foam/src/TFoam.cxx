@@ -71,6 +71,29 @@ Increasing `nSampl` sometimes helps, but it may cost CPU time.
 Past versions of FOAM: August 2003, v.1.00; September 2003 v.1.01
 Adopted starting from FOAM-2.06 by P. Sawicki
 
+### Thread-safe generation
+
+MakeEvent() uses the generator set with SetPseRan() and accumulates the
+statistics of the MC series in the foam, so that it cannot be called from
+several threads. Once the foam is built by Initialize(), it is not modified
+by GenerateEvent() and Sample(), which take the random number generator as
+argument and return the statistics of their events in a SampleStats, to be
+added with AddSampleStats(). Each thread can therefore generate events with
+its own generator, e.g. in the tasks of a ROOT::TThreadExecutor:
+~~~{.cpp}
+   ROOT::TThreadExecutor pool;
+   pool.Foreach([&](UInt_t i) {
+      TRandomMixMax r(1000 + i);
+      foam->Sample(n, &x[i * n * dim], &w[i * n], &r);
+   }, ROOT::TSeqU(8));
+~~~
+SampleParallel() does exactly this, on a fixed number of streams so that
+the events do not depend on the number of threads. The distribution must
+then be a TFoamIntegrand whose Density() can be called concurrently; the
+interpreted ones of SetRhoInt() are evaluated sequentially. The events of
+GenerateEvent() are not filled in the weight histograms and in the monitor
+used by GetWtParams().
+
 Users of FOAM are kindly requested to cite the following work:
 S. Jadach, Computer Physics Communications 152 (2003) 55.
 
@@ -88,6 +111,12 @@ S. Jadach, Computer Physics Communications 152 (2003) 55.
 #include "TRandom.h"
 #include "TMath.h"
 #include "TInterpreter.h"
+#include "TRandomGen.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
 
 ClassImp(TFoam);
 
@@ -995,8 +1024,29 @@ void TFoam::MakeActiveList()
       fPrimAcu[iCell]=sum;
    }
 
+   InitSampling();
 } //MakeActiveList
 
+////////////////////////////////////////////////////////////////////////////////
+/// Tabulates the position and size of the active cells, so that
+/// GenerateEvent() does not have to walk up the tree of cells.
+/// It is done by Initialize(); a foam read from a file must call it before
+/// calling GenerateEvent() or Sample() from several threads.
+
+void TFoam::InitSampling()
+{
+   fActPosi.resize(fNoAct * fDim);
+   fActSize.resize(fNoAct * fDim);
+   TFoamVect cellPosi(fDim), cellSize(fDim);
+   for (Long_t iCell = 0; iCell < fNoAct; iCell++) {
+      fCells[fCellsAct[iCell]]->GetHcub(cellPosi, cellSize);
+      for (Int_t j = 0; j < fDim; j++) {
+         fActPosi[iCell * fDim + j] = cellPosi[j];
+         fActSize[iCell * fDim + j] = cellSize[j];
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// User may optionally reset random number generator using this method.
 ///
@@ -1061,6 +1111,15 @@ void TFoam::ResetRho(TFoamIntegrand *fun)
 /// Evaluates distribution to be generated.
 
 Double_t TFoam::Eval(Double_t *xRand)
+{
+   return EvalDensity(xRand);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method.
+/// Evaluates the distribution to be generated, for Eval() and GenerateEvent().
+
+Double_t TFoam::EvalDensity(Double_t *xRand) const
 {
    Double_t result;
 
@@ -1083,12 +1142,21 @@ Double_t TFoam::Eval(Double_t *xRand)
 /// contribution into total driver integral using interpolation search.
 
 void TFoam::GenerCel2(TFoamCell *&pCell)
+{
+   pCell = fCells[fCellsAct[FindActiveCell(fPseRan->Rndm())]];
+}       // TFoam::GenerCel2
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method.
+/// Returns the index in the list of active cells of the cell chosen with the
+/// uniform random number, with probability equal to its contribution into
+/// the total driver integral, using interpolation search.
+
+Long_t TFoam::FindActiveCell(Double_t random) const
 {
    Long_t  lo, hi, hit;
    Double_t fhit, flo, fhi;
-   Double_t random;
 
-   random=fPseRan->Rndm();
    lo  = 0;              hi =fNoAct-1;
    flo = fPrimAcu[lo];  fhi=fPrimAcu[hi];
    while(lo+1<hi) {
@@ -1107,10 +1175,11 @@ void TFoam::GenerCel2(TFoamCell *&pCell)
       }
    }
    if (fPrimAcu[lo]>random)
-      pCell = fCells[fCellsAct[lo]];
+      return lo;
    else
-      pCell = fCells[fCellsAct[hi]];
-}       // TFoam::GenerCel2
+      return hi;
+}       // TFoam::FindActiveCell
+
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1200,6 +1269,126 @@ Double_t TFoam::MCgenerate(Double_t *MCvect)
    return(fMCwt);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generates one MC event in MCvect with the random number generator rnd and
+/// returns its weight, as MakeEvent() would do with rnd set by SetPseRan().
+/// The foam is not modified: it can be called from several threads, each
+/// with its own generator. The statistics of the MC series are added to
+/// stats, if given, instead of the foam.
+
+Double_t TFoam::GenerateEvent(TRandom *rnd, Double_t *MCvect, SampleStats *stats) const
+{
+   for (;;) {
+      Long_t iAct = FindActiveCell(rnd->Rndm());
+      TFoamCell *rCell = fCells[fCellsAct[iAct]];
+
+      rnd->RndmArray(fDim, MCvect);
+      if (fActPosi.size() == (size_t)fNoAct * fDim) {
+         const Double_t *cellPosi = &fActPosi[iAct * fDim];
+         const Double_t *cellSize = &fActSize[iAct * fDim];
+         for (Int_t j = 0; j < fDim; j++)
+            MCvect[j] = cellPosi[j] + MCvect[j] * cellSize[j];
+      } else {
+         TFoamVect cellPosi(fDim), cellSize(fDim);
+         rCell->GetHcub(cellPosi, cellSize);
+         for (Int_t j = 0; j < fDim; j++)
+            MCvect[j] = cellPosi[j] + MCvect[j] * cellSize[j];
+      }
+
+      Double_t mcwt = rCell->GetVolume() * EvalDensity(MCvect) / rCell->GetPrim();
+      if (stats) {
+         stats->fNCalls++;
+         stats->fSumWt += mcwt;
+         stats->fSumWt2 += mcwt * mcwt;
+         stats->fNevGen++;
+         stats->fWtMax = TMath::Max(stats->fWtMax, mcwt);
+         stats->fWtMin = TMath::Min(stats->fWtMin, mcwt);
+      }
+      if (fOptRej != 1)
+         return mcwt;
+      if (fMaxWtRej * rnd->Rndm() > mcwt)
+         continue; // Wt=1 events, internal rejection
+      if (mcwt < fMaxWtRej)
+         return 1.0;
+      mcwt = mcwt / fMaxWtRej; // weight for overweighted events
+      if (stats)
+         stats->fSumOve += mcwt - fMaxWtRej;
+      return mcwt;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generates n MC events with GenerateEvent() and the generator rnd.
+/// MCvect receives the n vectors one after the other (n*kDim values), MCwt,
+/// if not null, their n weights.
+
+void TFoam::Sample(Long64_t n, Double_t *MCvect, Double_t *MCwt, TRandom *rnd, SampleStats *stats) const
+{
+   for (Long64_t i = 0; i < n; i++) {
+      Double_t mcwt = GenerateEvent(rnd, MCvect + i * fDim, stats);
+      if (MCwt)
+         MCwt[i] = mcwt;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generates n MC events as Sample(), on nstreams independent streams of
+/// random numbers processed in parallel if the implicit multi-threading is
+/// enabled. Stream i generates its consecutive share of the events with a
+/// TRandomMixMax seeded with seed+i, so that the events only depend on seed
+/// and nstreams, not on the number of threads. The statistics of the events
+/// are added to the MC series of the foam.
+
+void TFoam::SampleParallel(Long64_t n, Double_t *MCvect, Double_t *MCwt, UInt_t seed, Int_t nstreams)
+{
+   if (n <= 0)
+      return;
+   if (nstreams < 1)
+      nstreams = 1;
+   if (fActPosi.size() != (size_t)fNoAct * fDim)
+      InitSampling();
+
+   std::vector<SampleStats> stats(nstreams);
+   auto sampleStream = [&](UInt_t i) {
+      Long64_t first = n * i / nstreams;
+      Long64_t last = n * (i + 1) / nstreams;
+      TRandomMixMax rnd(seed + i);
+      Sample(last - first, MCvect + first * fDim, MCwt ? MCwt + first : nullptr, &rnd, &stats[i]);
+   };
+
+   Bool_t done = kFALSE;
+#ifdef R__USE_IMT
+   // the interpreted distributions can only be called from one thread
+   if (fRho && nstreams > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(sampleStream, ROOT::TSeqU(nstreams));
+      done = kTRUE;
+   }
+#endif
+   if (!done) {
+      for (Int_t i = 0; i < nstreams; i++)
+         sampleStream(i);
+   }
+
+   for (const SampleStats &streamStats : stats)
+      AddSampleStats(streamStats);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Adds the statistics of events generated with GenerateEvent() or Sample()
+/// to the MC series of the foam, used by GetIntegMC() and Finalize().
+
+void TFoam::AddSampleStats(const SampleStats &stats)
+{
+   fNCalls += stats.fNCalls;
+   fSumWt  += stats.fSumWt;
+   fSumWt2 += stats.fSumWt2;
+   fSumOve += stats.fSumOve;
+   fNevGen += stats.fNevGen;
+   fWtMax   = TMath::Max(fWtMax, stats.fWtMax);
+   fWtMin   = TMath::Min(fWtMin, stats.fWtMin);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// User method.
 /// It provides the value of the integral calculated from the averages of the MC run
@@ -0,0 +1,335 @@
+// @(#)root/mathcore:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2020 , LCG ROOT MathLib Team                         *
+ *                                                                    *
+ *                                                                    *
+ **********************************************************************/
+
+// Header file for class LorentzVectorSoA
+//
+#ifndef ROOT_Math_GenVector_LorentzVectorSoA
+#define ROOT_Math_GenVector_LorentzVectorSoA  1
+
+#include "Math/GenVector/LorentzVector.h"
+
+#include "Math/GenVector/PxPyPzE4D.h"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace ROOT {
+
+  namespace Math {
+
+//__________________________________________________________________________________________
+    /**
+        Class describing a collection of LorentzVector in the (px, py, pz, E)
+        cartesian coordinates, stored as a structure of arrays: one contiguous
+        array per component. Contrary to a std::vector of LorentzVector, the
+        loops computing a quantity for all the vectors of the collection read
+        each component with unit stride and can be vectorized by the compiler,
+        which makes them much faster for many objects (e.g. the particles of
+        the events of an RDataFrame analysis).
+
+        The collection can be built from any containers providing size() and
+        operator[], like ROOT::VecOps::RVec or std::vector, holding either the
+        cartesian components or the (pt, eta, phi, M) ones:
+
+        ~~~{.cpp}
+        auto p4 = ROOT::Math::LorentzVectorSoA<double>::FromPtEtaPhiM(pt, eta, phi, m);
+        std::vector<double> masses = p4.M();
+        ~~~
+
+        The quantities are returned for all the vectors at once as std::vector;
+        operator[] returns a ROOT::Math::LorentzVector of one of them.
+        Contrary to the methods of LorentzVector, the ones computing the
+        quantities of many vectors do not check their arguments: e.g. M()
+        returns -sqrt(-M2) for the spacelike vectors without any message.
+
+     @ingroup GenVector
+    */
+    template< class ScalarType = double >
+    class LorentzVectorSoA {
+
+    public:
+
+       typedef ScalarType Scalar;
+       typedef LorentzVector< PxPyPzE4D<Scalar> > Vector;
+
+       /**
+          Default constructor, building an empty collection
+       */
+       LorentzVectorSoA() {}
+
+       /**
+          Construct a collection of n vectors of null components
+       */
+       explicit LorentzVectorSoA(std::size_t n) : fPx(n), fPy(n), fPz(n), fE(n) {}
+
+       /**
+          Construct from the containers of the cartesian components (px, py, pz, E),
+          e.g. ROOT::VecOps::RVec, which must all have the same size
+       */
+       template< class Container >
+       LorentzVectorSoA(const Container & px, const Container & py, const Container & pz, const Container & e) :
+          fPx(px.size()), fPy(px.size()), fPz(px.size()), fE(px.size())
+       {
+          const std::size_t n = px.size();
+          for (std::size_t i = 0; i < n; ++i) {
+             fPx[i] = px[i];
+             fPy[i] = py[i];
+             fPz[i] = pz[i];
+             fE[i] = e[i];
+          }
+       }
+
+       /**
+          Construct from the containers of the (pt, eta, phi, M) components,
+          which must all have the same size
+       */
+       template< class Container >
+       static LorentzVectorSoA FromPtEtaPhiM(const Container & pt, const Container & eta, const Container & phi, const Container & m)
+       {
+          using std::cos;
+          using std::sin;
+          using std::sinh;
+          using std::sqrt;
+          const std::size_t n = pt.size();
+          LorentzVectorSoA v(n);
+          for (std::size_t i = 0; i < n; ++i) {
+             const Scalar px = pt[i] * cos(Scalar(phi[i]));
+             const Scalar py = pt[i] * sin(Scalar(phi[i]));
+             const Scalar pz = pt[i] * sinh(Scalar(eta[i]));
+             v.fPx[i] = px;
+             v.fPy[i] = py;
+             v.fPz[i] = pz;
+             v.fE[i] = sqrt(px * px + py * py + pz * pz + Scalar(m[i]) * Scalar(m[i]));
+          }
+          return v;
+       }
+
+       // ------ size and element access ------
+
+       std::size_t size() const { return fPx.size(); }
+       bool empty() const { return fPx.empty(); }
+
+       void reserve(std::size_t n) {
+          fPx.reserve(n);
+          fPy.reserve(n);
+          fPz.reserve(n);
+          fE.reserve(n);
+       }
+
+       void clear() {
+          fPx.clear();
+          fPy.clear();
+          fPz.clear();
+          fE.clear();
+       }
+
+       /**
+          Append a vector to the collection
+       */
+       template< class CoordSystem >
+       void push_back(const LorentzVector<CoordSystem> & v) {
+          fPx.push_back(v.Px());
+          fPy.push_back(v.Py());
+          fPz.push_back(v.Pz());
+          fE.push_back(v.E());
+       }
+
+       /**
+          Return the i-th vector of the collection
+       */
+       Vector operator[](std::size_t i) const { return Vector(fPx[i], fPy[i], fPz[i], fE[i]); }
+
+       /**
+          Set the i-th vector of the collection
+       */
+       template< class CoordSystem >
+       void Set(std::size_t i, const LorentzVector<CoordSystem> & v) {
+          fPx[i] = v.Px();
+          fPy[i] = v.Py();
+          fPz[i] = v.Pz();
+          fE[i] = v.E();
+       }
+
+       /**
+          Arrays of the components, of size() elements
+       */
+       const Scalar * Px() const { return fPx.data(); }
+       const Scalar * Py() const { return fPy.data(); }
+       const Scalar * Pz() const { return fPz.data(); }
+       const Scalar * E() const { return fE.data(); }
+       Scalar * Px() { return fPx.data(); }
+       Scalar * Py() { return fPy.data(); }
+       Scalar * Pz() { return fPz.data(); }
+       Scalar * E() { return fE.data(); }
+
+       // ------ quantities of all the vectors ------
+
+       /**
+          Invariant masses of the vectors, -sqrt(-M2) for the spacelike ones
+       */
+       std::vector<Scalar> M() const {
+          using std::sqrt;
+          const std::size_t n = size();
+          std::vector<Scalar> m(n);
+          for (std::size_t i = 0; i < n; ++i) {
+             const Scalar mm = fE[i] * fE[i] - fPx[i] * fPx[i] - fPy[i] * fPy[i] - fPz[i] * fPz[i];
+             m[i] = mm >= 0 ? sqrt(mm) : -sqrt(-mm);
+          }
+          return m;
+       }
+
+       /**
+          Transverse momenta of the vectors
+       */
+       std::vector<Scalar> Pt() const {
+          using std::sqrt;
+          const std::size_t n = size();
+          std::vector<Scalar> pt(n);
+          for (std::size_t i = 0; i < n; ++i)
+             pt[i] = sqrt(fPx[i] * fPx[i] + fPy[i] * fPy[i]);
+          return pt;
+       }
+
+       /**
+          Pseudorapidities of the vectors, computed as by PxPyPzE4D::Eta()
+       */
+       std::vector<Scalar> Eta() const {
+          const std::size_t n = size();
+          std::vector<Scalar> eta(n);
+          for (std::size_t i = 0; i < n; ++i)
+             eta[i] = Impl::Eta_FromRhoZ(std::sqrt(fPx[i] * fPx[i] + fPy[i] * fPy[i]), fPz[i]);
+          return eta;
+       }
+
+       /**
+          Azimuthal angles of the vectors, in [-pi, pi]
+       */
+       std::vector<Scalar> Phi() const {
+          using std::atan2;
+          const std::size_t n = size();
+          std::vector<Scalar> phi(n);
+          for (std::size_t i = 0; i < n; ++i)
+             phi[i] = (fPx[i] == Scalar(0) && fPy[i] == Scalar(0)) ? Scalar(0) : atan2(fPy[i], fPx[i]);
+          return phi;
+       }
+
+       // ------ transformations ------
+
+       /**
+          Boost all the vectors by the velocity (bx, by, bz), in units of c,
+          as ROOT::Math::Boost does for one vector. The velocity must satisfy
+          bx^2 + by^2 + bz^2 < 1, which is not checked.
+       */
+       void Boost(Scalar bx, Scalar by, Scalar bz) {
+          using std::sqrt;
+          const Scalar b2 = bx * bx + by * by + bz * bz;
+          if (b2 == Scalar(0))
+             return;
+          const Scalar gamma = Scalar(1) / sqrt(Scalar(1) - b2);
+          const Scalar gamma2 = (gamma - Scalar(1)) / b2;
+          const std::size_t n = size();
+          Scalar * px = fPx.data();
+          Scalar * py = fPy.data();
+          Scalar * pz = fPz.data();
+          Scalar * e = fE.data();
+          for (std::size_t i = 0; i < n; ++i) {
+             const Scalar bp = bx * px[i] + by * py[i] + bz * pz[i];
+             const Scalar f = gamma2 * bp + gamma * e[i];
+             px[i] += f * bx;
+             py[i] += f * by;
+             pz[i] += f * bz;
+             e[i] = gamma * (e[i] + bp);
+          }
+       }
+
+       /**
+          Add the vectors of other, of the same size, to those of the collection
+       */
+       LorentzVectorSoA & operator+= (const LorentzVectorSoA & other) {
+          const std::size_t n = size();
+          for (std::size_t i = 0; i < n; ++i) {
+             fPx[i] += other.fPx[i];
+             fPy[i] += other.fPy[i];
+             fPz[i] += other.fPz[i];
+             fE[i] += other.fE[i];
+          }
+          return *this;
+       }
+
+    private:
+
+       std::vector<Scalar> fPx;
+       std::vector<Scalar> fPy;
+       std::vector<Scalar> fPz;
+       std::vector<Scalar> fE;
+
+    };
+
+    /**
+       Sum of the vectors of a and b, of the same size, element by element
+       @ingroup GenVector
+    */
+    template< class ScalarType >
+    inline LorentzVectorSoA<ScalarType> operator+ (LorentzVectorSoA<ScalarType> a, const LorentzVectorSoA<ScalarType> & b) {
+       a += b;
+       return a;
+    }
+
+    /**
+       Invariant masses of the pairs made of the i-th vectors of a and b,
+       of the same size, without building the sum of the vectors
+       @ingroup GenVector
+    */
+    template< class ScalarType >
+    std::vector<ScalarType> InvariantMasses(const LorentzVectorSoA<ScalarType> & a, const LorentzVectorSoA<ScalarType> & b) {
+       using std::sqrt;
+       const std::size_t n = a.size();
+       const ScalarType * apx = a.Px(), * apy = a.Py(), * apz = a.Pz(), * ae = a.E();
+       const ScalarType * bpx = b.Px(), * bpy = b.Py(), * bpz = b.Pz(), * be = b.E();
+       std::vector<ScalarType> m(n);
+       for (std::size_t i = 0; i < n; ++i) {
+          const ScalarType px = apx[i] + bpx[i];
+          const ScalarType py = apy[i] + bpy[i];
+          const ScalarType pz = apz[i] + bpz[i];
+          const ScalarType e = ae[i] + be[i];
+          const ScalarType mm = e * e - px * px - py * py - pz * pz;
+          m[i] = mm >= 0 ? sqrt(mm) : -sqrt(-mm);
+       }
+       return m;
+    }
+
+    /**
+       Distances sqrt(deta^2 + dphi^2) in the (eta, phi) plane between the
+       i-th vectors of a and b, of the same size, as ROOT::Math::VectorUtil::DeltaR
+       @ingroup GenVector
+    */
+    template< class ScalarType >
+    std::vector<ScalarType> DeltaR(const LorentzVectorSoA<ScalarType> & a, const LorentzVectorSoA<ScalarType> & b) {
+       using std::sqrt;
+       const std::vector<ScalarType> aeta = a.Eta(), aphi = a.Phi();
+       const std::vector<ScalarType> beta = b.Eta(), bphi = b.Phi();
+       const ScalarType pi = ScalarType(M_PI);
+       const std::size_t n = a.size();
+       std::vector<ScalarType> dr(n);
+       for (std::size_t i = 0; i < n; ++i) {
+          ScalarType dphi = aphi[i] - bphi[i];
+          dphi = dphi > pi ? dphi - 2 * pi : (dphi <= -pi ? dphi + 2 * pi : dphi);
+          const ScalarType deta = aeta[i] - beta[i];
+          dr[i] = sqrt(deta * deta + dphi * dphi);
+       }
+       return dr;
+    }
+
+  } // end namespace Math
+
+} // end namespace ROOT
+
+
+#endif
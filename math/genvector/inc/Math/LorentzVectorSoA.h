@@ -0,0 +1,10 @@
+// @(#)root/mathcore:$Id$
+
+#ifndef ROOT_Math_LorentzVectorSoA
+#define ROOT_Math_LorentzVectorSoA
+
+
+#include "Math/GenVector/LorentzVectorSoA.h"
+
+
+#endif
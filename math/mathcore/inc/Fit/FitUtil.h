@@ -30,6 +30,9 @@
 
 #include "TError.h"
 
+#include <algorithm>
+#include <vector>
+
 // using parameter cache is not thread safe but needed for normalizing the functions
 #define USE_PARAMCACHE
 
@@ -368,6 +371,48 @@ namespace FitUtil {
 
    unsigned setAutomaticChunking(unsigned nEvents);
 
+   /**
+       Sum the contributions to a gradient of npar components of the points [begin, end), the vectors
+       returned by mapFunction(i). Only the sum is kept in memory, not the contributions of all the points.
+   */
+   template <class T, class F>
+   std::vector<T> SumGradientContributions(const F &mapFunction, unsigned begin, unsigned end, unsigned npar)
+   {
+      std::vector<T> sum(npar);
+      for (unsigned i = begin; i < end; ++i) {
+         const auto pointContribution = mapFunction(i);
+         for (unsigned ipar = 0; ipar < npar; ++ipar)
+            sum[ipar] += pointContribution[ipar];
+      }
+      return sum;
+   }
+
+#ifdef R__USE_IMT
+   /**
+       Sum the contributions to a gradient of the points [0, n), as SumGradientContributions(), with
+       the points split in nChunks ranges of consecutive points summed in parallel. The sums of the
+       ranges are added in their order, so that the result does not depend on the scheduling of the threads.
+   */
+   template <class T, class F>
+   std::vector<T> SumGradientContributionsMT(const F &mapFunction, unsigned n, unsigned npar, unsigned nChunks)
+   {
+      std::vector<T> sum(npar);
+      if (n == 0)
+         return sum;
+      const unsigned step = (n + std::max(nChunks, 1u) - 1) / std::max(nChunks, 1u);
+      auto sumRange = [&](unsigned irange) {
+         return SumGradientContributions<T>(mapFunction, irange * step, std::min(n, (irange + 1) * step), npar);
+      };
+      ROOT::TThreadExecutor pool;
+      const auto rangeSums = pool.Map(sumRange, ROOT::TSeq<unsigned>(0, (n + step - 1) / step));
+      for (auto const &rangeSum : rangeSums) {
+         for (unsigned ipar = 0; ipar < npar; ++ipar)
+            sum[ipar] += rangeSum[ipar];
+      }
+      return sum;
+   }
+#endif
+
    template<class T>
    struct Evaluate {
 #ifdef R__HAS_VECCORE
@@ -982,18 +1027,6 @@ namespace FitUtil {
             return pointContributionVec;
          };
 
-         // Reduce the set of vectors by summing its equally-indexed components
-         auto redFunction = [&](const std::vector<std::vector<T>> &partialResults) {
-            std::vector<T> result(npar);
-
-            for (auto const &pointContributionVec : partialResults) {
-               for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-                  result[parameterIndex] += pointContributionVec[parameterIndex];
-            }
-
-            return result;
-         };
-
          std::vector<T> gVec(npar);
          std::vector<double> g(npar);
 
@@ -1011,14 +1044,12 @@ namespace FitUtil {
 #endif
 
          if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-            ROOT::TSequentialExecutor pool;
-            gVec = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, numVectors), redFunction);
+            gVec = SumGradientContributions<T>(mapFunction, 0, numVectors, npar);
          }
 #ifdef R__USE_IMT
          else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
-            ROOT::TThreadExecutor pool;
             auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(numVectors);
-            gVec = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, numVectors), redFunction, chunks);
+            gVec = SumGradientContributionsMT<T>(mapFunction, numVectors, npar, chunks);
          }
 #endif
          else {
@@ -1166,18 +1197,6 @@ namespace FitUtil {
             return pointContributionVec;
          };
 
-         // Vertically reduce the set of vectors by summing its equally-indexed components
-         auto redFunction = [&](const std::vector<std::vector<T>> &partialResults) {
-            std::vector<T> result(npar);
-
-            for (auto const &pointContributionVec : partialResults) {
-               for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-                  result[parameterIndex] += pointContributionVec[parameterIndex];
-            }
-
-            return result;
-         };
-
          std::vector<T> gVec(npar);
 
 #ifndef R__USE_IMT
@@ -1194,14 +1213,12 @@ namespace FitUtil {
 #endif
 
          if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-            ROOT::TSequentialExecutor pool;
-            gVec = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, numVectors), redFunction);
+            gVec = SumGradientContributions<T>(mapFunction, 0, numVectors, npar);
          }
 #ifdef R__USE_IMT
          else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
-            ROOT::TThreadExecutor pool;
             auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(numVectors);
-            gVec = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, numVectors), redFunction, chunks);
+            gVec = SumGradientContributionsMT<T>(mapFunction, numVectors, npar, chunks);
          }
 #endif
          else {
@@ -1315,18 +1332,6 @@ namespace FitUtil {
             return pointContributionVec;
          };
 
-         // Vertically reduce the set of vectors by summing its equally-indexed components
-         auto redFunction = [&](const std::vector<std::vector<T>> &pointContributions) {
-            std::vector<T> result(npar);
-
-            for (auto const &pointContributionVec : pointContributions) {
-               for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-                  result[parameterIndex] += pointContributionVec[parameterIndex];
-            }
-
-            return result;
-         };
-
          std::vector<T> gVec(npar);
          std::vector<double> g(npar);
 
@@ -1344,14 +1349,12 @@ namespace FitUtil {
 #endif
 
          if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-            ROOT::TSequentialExecutor pool;
-            gVec = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, numVectors), redFunction);
+            gVec = SumGradientContributions<T>(mapFunction, 0, numVectors, npar);
          }
 #ifdef R__USE_IMT
          else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
-            ROOT::TThreadExecutor pool;
             auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(numVectors);
-            gVec = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, numVectors), redFunction, chunks);
+            gVec = SumGradientContributionsMT<T>(mapFunction, numVectors, npar, chunks);
          }
 #endif
          else {
@@ -127,6 +127,16 @@ namespace ROOT {
             return DoEval(x);
          }
 
+         /**
+         Evaluate function at the n points x, given one after the other with NDim() coordinates each,
+         for given parameters p, and store the values in result.
+         Use the virtual function DoEvalParN to implement it
+         */
+         void EvalParN(unsigned int n, const T *x, const double *p, T *result) const
+         {
+            DoEvalParN(n, x, p, result);
+         }
+
       private:
          /**
             Implementation of the evaluation function using the x values and the parameters.
@@ -134,6 +144,17 @@ namespace ROOT {
          */
          virtual T DoEvalPar(const T *x, const double *p) const = 0;
 
+         /**
+            Implementation of the evaluation function at several points. The default implementation
+            calls DoEvalPar for each point; derived classes can evaluate all the points at once.
+         */
+         virtual void DoEvalParN(unsigned int n, const T *x, const double *p, T *result) const
+         {
+            const unsigned int ndim = this->NDim();
+            for (unsigned int i = 0; i < n; ++i)
+               result[i] = DoEvalPar(x + i * ndim, p);
+         }
+
          /**
             Implement the ROOT::Math::IBaseFunctionMultiDim interface DoEval(x) using the cached parameter values
          */
@@ -132,13 +132,19 @@ http://dx.doi.org/10.1016/j.chaos.2016.05.003
          /// set the generator seed
          void  SetSeed(Result_t seed);
 
+         /// seed the generator with the guarantee that each set of four identifiers gives an
+         /// independent sequence, e.g. one per thread using different streamID.
+         /// SetSeed(seed) uses clusterID = machineID = 0, runID and streamID being the high and
+         /// low 32 bits of the seed
+         void  SeedUniqueStream(uint32_t clusterID, uint32_t machineID, uint32_t runID, uint32_t streamID);
+
          // generate a random number (virtual interface)
          virtual double Rndm() { return Rndm_impl(); }
 
          /// generate a double random number (faster interface)
          inline double operator() () { return Rndm_impl(); }
 
-         /// generate an array of random numbers
+         /// generate an array of random numbers, the same as from n calls to Rndm()
          void RndmArray (int n, double * array);
 
          /// generate a 64  bit integer number
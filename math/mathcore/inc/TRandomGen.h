@@ -42,6 +42,20 @@
 
 #include "TRandom.h"
 
+namespace ROOT {
+namespace Internal {
+/// Fill array with n numbers of engine, with its RndmArray if it has one.
+template<class Engine>
+auto FillRandomArray(Engine &engine, Int_t n, Double_t *array, int) -> decltype(engine.RndmArray(n, array)) {
+   return engine.RndmArray(n, array);
+}
+template<class Engine>
+void FillRandomArray(Engine &engine, Int_t n, Double_t *array, long) {
+   for (int i = 0; i < n; ++i) array[i] = engine();
+}
+} // namespace Internal
+} // namespace ROOT
+
 template<class Engine>
 class TRandomGen : public TRandom {
 
@@ -62,7 +76,7 @@ public:
       for (int i = 0; i < n; ++i) array[i] = fEngine(); 
    }
    virtual  void     RndmArray(Int_t n, Double_t *array) {
-            for (int i = 0; i < n; ++i) array[i] = fEngine(); 
+      ROOT::Internal::FillRandomArray(fEngine, n, array, 0);
    }
    virtual  void     SetSeed(ULong_t seed=0) {
       fEngine.SetSeed(seed);
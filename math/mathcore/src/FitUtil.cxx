@@ -275,61 +275,16 @@ namespace ROOT {
 
    (const_cast<IModelFunction &>(func)).SetParameters(p);
 
-   auto mapFunction = [&](const unsigned i){
+   // chi2 contribution of the point i, given the function value fval
+   auto chi2Point = [&](const unsigned i, double fval) {
 
       double chi2{};
-      double fval{};
 
-      const auto x1 = data.GetCoordComponent(i, 0);
       const auto y = data.Value(i);
       auto invError = data.InvError(i);
 
       //invError = (invError!= 0.0) ? 1.0/invError :1;
 
-      const double * x = nullptr;
-      std::vector<double> xc;
-      double binVolume = 1.0;
-      if (useBinVolume) {
-         unsigned int ndim = data.NDim();
-         xc.resize(data.NDim());
-         for (unsigned int j = 0; j < ndim; ++j) {
-            double xx = *data.GetCoordComponent(i, j);
-            double x2 = data.GetBinUpEdgeComponent(i, j);
-            binVolume *= std::abs(x2 - xx);
-            xc[j] = 0.5*(x2 + xx);
-         }
-         x = xc.data();
-         // normalize the bin volume using a reference value
-         binVolume *= wrefVolume;
-      } else if(data.NDim() > 1) {
-         // multi-dim case (no bin volume)
-         xc.resize(data.NDim());
-         xc[0] = *x1;
-         for (unsigned int j = 1; j < data.NDim(); ++j)
-            xc[j] = *data.GetCoordComponent(i, j);
-         x = xc.data();
-      } else {
-            x = x1;
-      }
-
-
-      if (!useBinIntegral) {
-#ifdef USE_PARAMCACHE
-         fval = func ( x );
-#else
-         fval = func ( x, p );
-#endif
-      }
-      else {
-         // calculate integral normalized by bin volume
-         // need to set function and parameters here in case loop is parallelized
-         std::vector<double> x2(data.NDim());
-         data.GetBinUpEdgeCoordinates(i, x2.data());
-         fval = igEval(x, x2.data());
-      }
-      // normalize result if requested according to bin volume
-      if (useBinVolume) fval *= binVolume;
-
       // expected errors
       if (useExpErrors) {
          double invWeight  = 1.0;
@@ -347,15 +302,15 @@ namespace ROOT {
          // compute expected error  as f(x) / weight
          double invError2 = (fval > 0) ? invWeight / fval : 0.0;
          invError = std::sqrt(invError2);
-         //std::cout << "using Pearson chi2 " << x[0] << "  " << 1./invError2 << "  " << fval << std::endl;
+         //std::cout << "using Pearson chi2 " << y << "  " << 1./invError2 << "  " << fval << std::endl;
       }
 
 //#define DEBUG
 #ifdef DEBUG
-      std::cout << x[0] << "  " << y << "  " << 1./invError << " params : ";
+      std::cout << *data.GetCoordComponent(i, 0) << "  " << y << "  " << 1./invError << " params : ";
       for (unsigned int ipar = 0; ipar < func.NPar(); ++ipar)
          std::cout << p[ipar] << "\t";
-      std::cout << "\tfval = " << fval << " bin volume " << binVolume << " ref " << wrefVolume << std::endl;
+      std::cout << "\tfval = " << fval << " ref " << wrefVolume << std::endl;
 #endif
 //#undef DEBUG
 
@@ -374,6 +329,64 @@ namespace ROOT {
          }
       }
       return chi2;
+   };
+
+   // The function is evaluated on batches of points, with a single
+   // IModelFunction::EvalParN() call per batch when not using the bin integrals
+   const unsigned int ndim = data.NDim();
+   const unsigned int batchSize = 256;
+   const unsigned int nBatches = (n + batchSize - 1) / batchSize;
+
+   auto mapFunction = [&](const unsigned ibatch){
+
+      const unsigned int begin = ibatch * batchSize;
+      const unsigned int nPoints = std::min(n - begin, batchSize);
+
+      std::vector<double> xc(nPoints * ndim);
+      std::vector<double> binVolumes(useBinVolume ? nPoints : 0);
+      for (unsigned int k = 0; k < nPoints; ++k) {
+         double *x = &xc[k * ndim];
+         if (useBinVolume) {
+            double binVolume = 1.0;
+            for (unsigned int j = 0; j < ndim; ++j) {
+               double xx = *data.GetCoordComponent(begin + k, j);
+               double x2 = data.GetBinUpEdgeComponent(begin + k, j);
+               binVolume *= std::abs(x2 - xx);
+               x[j] = 0.5*(x2 + xx);
+            }
+            // normalize the bin volume using a reference value
+            binVolumes[k] = binVolume * wrefVolume;
+         } else {
+            for (unsigned int j = 0; j < ndim; ++j)
+               x[j] = *data.GetCoordComponent(begin + k, j);
+         }
+      }
+
+      std::vector<double> fvals(nPoints);
+      if (!useBinIntegral) {
+#ifdef USE_PARAMCACHE
+         func.EvalParN(nPoints, xc.data(), func.Parameters(), fvals.data());
+#else
+         func.EvalParN(nPoints, xc.data(), p, fvals.data());
+#endif
+      }
+      else {
+         // calculate integral normalized by bin volume
+         // need to set function and parameters here in case loop is parallelized
+         std::vector<double> x2(ndim);
+         for (unsigned int k = 0; k < nPoints; ++k) {
+            data.GetBinUpEdgeCoordinates(begin + k, x2.data());
+            fvals[k] = igEval(&xc[k * ndim], x2.data());
+         }
+      }
+
+      double chi2{};
+      for (unsigned int k = 0; k < nPoints; ++k) {
+         // normalize result if requested according to bin volume
+         double fval = useBinVolume ? fvals[k] * binVolumes[k] : fvals[k];
+         chi2 += chi2Point(begin + k, fval);
+      }
+      return chi2;
   };
 
 #ifdef R__USE_IMT
@@ -393,14 +406,16 @@ namespace ROOT {
 
   double res{};
   if(executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial){
-    for (unsigned int i=0; i<n; ++i) {
-      res += mapFunction(i);
+    for (unsigned int ibatch=0; ibatch<nBatches; ++ibatch) {
+      res += mapFunction(ibatch);
     }
 #ifdef R__USE_IMT
   } else if(executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
     ROOT::TThreadExecutor pool;
     auto chunks = nChunks !=0? nChunks: setAutomaticChunking(data.Size());
-    res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
+    // the map runs over the batches of points
+    chunks = std::max(1u, std::min(chunks, nBatches));
+    res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, nBatches), redFunction, chunks);
 #endif
 //   } else if(executionPolicy == ROOT::Fit::kMultitProcess){
     // ROOT::TProcessExecutor pool;
@@ -687,7 +702,8 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    unsigned int npar = func.NPar();
    unsigned initialNPoints = data.Size();
 
-   std::vector<bool> isPointRejected(initialNPoints);
+   // not a std::vector<bool>, whose elements can not be set concurrently
+   std::vector<char> isPointRejected(initialNPoints);
 
    auto mapFunction = [&](const unsigned int i) {
       // set all vector values to zero
@@ -783,18 +799,6 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
       return pointContribution;
    };
 
-   // Vertically reduce the set of vectors by summing its equally-indexed components
-   auto redFunction = [&](const std::vector<std::vector<double>> &pointContributions) {
-      std::vector<double> result(npar);
-
-      for (auto const &pointContribution : pointContributions) {
-         for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-            result[parameterIndex] += pointContribution[parameterIndex];
-      }
-
-      return result;
-   };
-
    std::vector<double> g(npar);
 
 #ifndef R__USE_IMT
@@ -807,17 +811,12 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
 #endif
 
    if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-      std::vector<std::vector<double>> allGradients(initialNPoints);
-      for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
-      }
-      g = redFunction(allGradients);
+      g = SumGradientContributions<double>(mapFunction, 0, initialNPoints, npar);
    }
 #ifdef R__USE_IMT
    else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
-      ROOT::TThreadExecutor pool;
       auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
+      g = SumGradientContributionsMT<double>(mapFunction, initialNPoints, npar, chunks);
    }
 #endif
    // else if(executionPolicy == ROOT::Fit::kMultiprocess){
@@ -837,7 +836,7 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    // correct the number of points
    nPoints = initialNPoints;
 
-   if (std::any_of(isPointRejected.begin(), isPointRejected.end(), [](bool point) { return point; })) {
+   if (std::any_of(isPointRejected.begin(), isPointRejected.end(), [](char point) { return point != 0; })) {
       unsigned nRejected = std::accumulate(isPointRejected.begin(), isPointRejected.end(), 0);
       assert(nRejected <= initialNPoints);
       nPoints = initialNPoints - nRejected;
@@ -1200,18 +1199,6 @@ void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &dat
       return pointContribution;
    };
 
-   // Vertically reduce the set of vectors by summing its equally-indexed components
-   auto redFunction = [&](const std::vector<std::vector<double>> &pointContributions) {
-      std::vector<double> result(npar);
-
-      for (auto const &pointContribution : pointContributions) {
-         for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-            result[parameterIndex] += pointContribution[parameterIndex];
-      }
-
-      return result;
-   };
-
    std::vector<double> g(npar);
 
 #ifndef R__USE_IMT
@@ -1224,17 +1211,12 @@ void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &dat
 #endif
 
    if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-      std::vector<std::vector<double>> allGradients(initialNPoints);
-      for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
-      }
-      g = redFunction(allGradients);
+      g = SumGradientContributions<double>(mapFunction, 0, initialNPoints, npar);
    }
 #ifdef R__USE_IMT
    else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
-      ROOT::TThreadExecutor pool;
       auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
+      g = SumGradientContributionsMT<double>(mapFunction, initialNPoints, npar, chunks);
    }
 #endif
 
@@ -1716,18 +1698,6 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
       return pointContribution;
    };
 
-   // Vertically reduce the set of vectors by summing its equally-indexed components
-   auto redFunction = [&](const std::vector<std::vector<double>> &pointContributions) {
-      std::vector<double> result(npar);
-
-      for (auto const &pointContribution : pointContributions) {
-         for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-            result[parameterIndex] += pointContribution[parameterIndex];
-      }
-
-      return result;
-   };
-
    std::vector<double> g(npar);
 
 #ifndef R__USE_IMT
@@ -1741,17 +1711,12 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
 #endif
 
    if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-      std::vector<std::vector<double>> allGradients(initialNPoints);
-      for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
-      }
-      g = redFunction(allGradients);
+      g = SumGradientContributions<double>(mapFunction, 0, initialNPoints, npar);
    }
 #ifdef R__USE_IMT
    else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
-      ROOT::TThreadExecutor pool;
       auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
+      g = SumGradientContributionsMT<double>(mapFunction, initialNPoints, npar, chunks);
    }
 #endif
 
@@ -54,6 +54,7 @@ namespace ROOT {
       }
       ~MixMaxEngineImpl() {}
       void SetSeed(uint64_t) { }
+      void SeedUniqueStream(uint32_t, uint32_t, uint32_t, uint32_t) { }
       double Rndm() { return -1; }
       double IntRndm() { return 0; }
       void SetState(const std::vector<uint64_t> &) { }
@@ -61,6 +62,7 @@ namespace ROOT {
       int Counter() { return -1; }
       void SetCounter(int) {}
       void Iterate() {} 
+      void IterateAndFill(double *) {}
    };
 
 
@@ -86,6 +88,9 @@ public:
       //seed_spbox(fRngState, seed);
       seed_uniquestream(fRngState, 0, 0, (uint32_t)(seed>>32), (uint32_t)seed );
    }
+   void SeedUniqueStream(uint32_t clusterID, uint32_t machineID, uint32_t runID, uint32_t streamID) {
+      seed_uniquestream(fRngState, clusterID, machineID, runID, streamID);
+   }
    double Rndm() {
        return get_next_float(fRngState);
    }
@@ -106,6 +111,14 @@ public:
    void Iterate() {
       iterate(fRngState); 
    }
+   // fill array with the N-1 numbers of the next iteration, the same as
+   // from N-1 calls to Rndm once the current iteration is exhausted
+   void IterateAndFill(double * array) {
+      iterate(fRngState);
+      for (int i = 1; i < ROOT_MM_N; ++i)
+         array[i-1] = (double)(int64_t)fRngState->V[i] * INV_MERSBASE;
+      fRngState->counter = ROOT_MM_N;
+   }
    int Counter() const {
       return fRngState->counter; 
    }
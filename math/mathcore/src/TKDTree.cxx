@@ -14,10 +14,22 @@
 
 #include "TString.h"
 #include <string.h>
+#include <algorithm>
 #include <limits>
+#include <utility>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
 
 templateClassImp(TKDTree);
 
+namespace {
+/// Minimal number of points of a tree for Build() to divide its nodes in parallel
+const Int_t kMinPointsParallelBuild = 100000;
+}
+
 
 /**
 \class TKDTree
@@ -147,6 +159,11 @@ in the 2 subtrees as close as possible. The following section gives more details
     Most functions of the kd-tree don't require the original data to be present after the tree
     has been built. Check the functions documentation for more details.
 
+    If the implicit multi-threading is enabled (ROOT::EnableImplicitMT()), Build() divides the
+    nodes of large trees in parallel, giving the same tree as the sequential build. The nearest
+    neighbors of many points are found faster by a single call to
+    FindNearestNeighbors(npoints, points, k, ind, dist) than point by point, also in parallel.
+
 #### 3b. Navigating the kd-tree
 
     Nodes of the tree are indexed top to bottom, left to right. The root node has index 0. Functions
@@ -449,6 +466,47 @@ void TKDTree<Index, Value>::Build()
    //
    //
    //4.
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && fNPoints >= kMinPointsParallelBuild) {
+      // The nodes of a row are divided independently of each other: each one permutes
+      // its own range of fIndPoints and sets its own fAxis and fValue. The first rows are
+      // divided row by row, each node in a task, until there are enough subtrees to build
+      // them in parallel.
+      ROOT::TThreadExecutor pool;
+      const UInt_t nsubtrees = 4 * pool.GetPoolSize();
+      std::vector<Int_t> nodes = {0, 0, fNPoints, 0};
+      while (!nodes.empty() && nodes.size() / 4 < nsubtrees) {
+         const UInt_t nnodes = nodes.size() / 4;
+         std::vector<std::vector<Int_t>> children(nnodes);
+         auto divide = [&](UInt_t i) {
+            BuildNodes(nodes[4*i], nodes[4*i+1], nodes[4*i+2], nodes[4*i+3], nodes[4*i] + 1, &children[i]);
+         };
+         if (nnodes == 1)
+            divide(0);
+         else
+            pool.Foreach(divide, ROOT::TSeqU(nnodes));
+         nodes.clear();
+         for (auto &c : children)
+            nodes.insert(nodes.end(), c.begin(), c.end());
+      }
+      pool.Foreach([&](UInt_t i) { BuildNodes(nodes[4*i], nodes[4*i+1], nodes[4*i+2], nodes[4*i+3], -1, nullptr); },
+                   ROOT::TSeqU(nodes.size() / 4));
+      return;
+   }
+#endif
+   BuildNodes(0, 0, fNPoints, 0, -1, nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Divide the node of the given row, containing the npoints points starting at
+/// pos in fIndPoints, and all its descendants. If pending is not null, the
+/// nodes of row stopRow are not divided but their row, node, number of points
+/// and position are appended to pending, to be divided later.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::BuildNodes(Int_t row, Int_t node, Int_t npoints, Int_t pos, Int_t stopRow,
+                                       std::vector<Int_t> *pending)
+{
    //    stack for non recursive build - size 128 bytes enough
    Int_t rowStack[128];
    Int_t nodeStack[128];
@@ -456,16 +514,16 @@ void TKDTree<Index, Value>::Build()
    Int_t posStack[128];
    Int_t currentIndex = 0;
    Int_t iter =0;
-   rowStack[0]    = 0;
-   nodeStack[0]   = 0;
-   npointStack[0] = fNPoints;
-   posStack[0]   = 0;
+   rowStack[0]    = row;
+   nodeStack[0]   = node;
+   npointStack[0] = npoints;
+   posStack[0]   = pos;
    //
    Int_t nbucketsall =0;
    while (currentIndex>=0){
       iter++;
       //
-      Int_t npoints  = npointStack[currentIndex];
+      npoints  = npointStack[currentIndex];
       if (npoints<=fBucketSize) {
          //printf("terminal node : index %d iter %d\n", currentIndex, iter);
          currentIndex--;
@@ -475,6 +533,12 @@ void TKDTree<Index, Value>::Build()
       Int_t crow     = rowStack[currentIndex];
       Int_t cpos     = posStack[currentIndex];
       Int_t cnode    = nodeStack[currentIndex];
+      if (pending && crow == stopRow) {
+         // divided later, possibly by another thread
+         pending->insert(pending->end(), {crow, cnode, npoints, cpos});
+         currentIndex--;
+         continue;
+      }
       //printf("currentIndex %d npoints %d node %d\n", currentIndex, npoints, cnode);
       //
       // divide points
@@ -561,6 +625,53 @@ void TKDTree<Index, Value>::FindNearestNeighbors(const Value *point, const Int_t
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Find the kNN nearest neighbors of each of the npoints points of the array
+///points, where the coordinates of the point i are points[i*fNDim], ...,
+///points[i*fNDim+fNDim-1]. The indexes and distances of its neighbors are
+///stored in ind[i*kNN], ..., ind[i*kNN+kNN-1] and dist[i*kNN], ..., which must
+///be allocated by the user, as by FindNearestNeighbors() for one point.
+///
+///The points are processed in the order of the terminal nodes they fall in, so
+///that consecutive points examine the same nodes, which stay in the cache, and
+///in parallel if the implicit multi-threading is enabled.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::FindNearestNeighbors(Index npoints, const Value *points, Int_t kNN, Index *ind, Value *dist)
+{
+   if (!ind || !dist) {
+      Error("FindNearestNeighbors", "Working arrays must be allocated by the user!");
+      return;
+   }
+   // Make the boundaries before the parallel queries, which only read them
+   MakeBoundariesExact();
+   std::vector<std::pair<Index, Index>> order(npoints);
+   for (Index i=0; i<npoints; i++)
+      order[i] = std::make_pair(FindNode(points + i*fNDim), i);
+   std::sort(order.begin(), order.end());
+
+   auto findRange = [&](std::size_t first, std::size_t last) {
+      for (std::size_t j=first; j<last; j++){
+         const Index i = order[j].second;
+         Index *indi = ind + i*kNN;
+         Value *disti = dist + i*kNN;
+         for (Int_t k=0; k<kNN; k++){
+            disti[k]=std::numeric_limits<Value>::max();
+            indi[k]=-1;
+         }
+         UpdateNearestNeighbors(0, points + i*fNDim, kNN, indi, disti);
+      }
+   };
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && npoints > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.ForeachRange(findRange, 0, npoints);
+      return;
+   }
+#endif
+   findRange(0, npoints);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Update the nearest neighbors values by examining the node inode
 
@@ -78,6 +78,25 @@ The following methods are provided to generate random numbers disctributed accor
 - `::Poisson(mean)`
 - `::Binomial(ntot,prob)`
 
+When many numbers are needed, `::RndmArray(n,array)`, `::GausArray(n,array,mean,sigma)` and
+`::ExpArray(n,array,tau)` fill an array with n numbers at once, at the price of a single virtual call.
+They draw the uniform numbers with RndmArray, implemented by the generators without a call per
+number, and transform them in simple loops the compiler can vectorize.
+
+For the generation from several threads, e.g. the tasks of a ROOT::TThreadExecutor, each thread must
+use its own generator. The MIXMAX generators guarantee that different seeds give independent
+sequences, so that the generators of the threads can simply be seeded with their index:
+\code{.cpp}
+ROOT::TThreadExecutor pool;
+auto toys = pool.Map([](UInt_t i) {
+   TRandomMixMax r(1000 + i);
+   std::vector<double> x(1000000);
+   r.GausArray(x.size(), x.data());
+   return x;
+}, ROOT::TSeqU(8));
+\endcode
+For the full control of the streams see ROOT::Math::MixMaxEngine::SeedUniqueStream.
+
 Random numbers distributed according to 1-d, 2-d or 3-d distributions contained in TF1, TF2 or TF3 objects can also be generated. 
 For example, to get a random number distributed following abs(sin(x)/x)*sqrt(x)
 you can do :
@@ -244,6 +263,18 @@ Double_t TRandom::Exp(Double_t tau)
    return t;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill array with n random numbers following an exponential distribution
+/// of mean tau, with one call to RndmArray.
+/// The numbers are the same as from n calls to Exp(tau).
+
+void TRandom::ExpArray(Int_t n, Double_t *array, Double_t tau)
+{
+   RndmArray(n, array);                // uniform on ] 0, 1 ]
+   for (Int_t i = 0; i < n; ++i)
+      array[i] = -tau * TMath::Log(array[i]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Samples a random number from the standard Normal (Gaussian) Distribution
 /// with the given mean and sigma.
@@ -498,6 +529,35 @@ void TRandom::Rannor(Float_t &a, Float_t &b)
    b = (Float_t)(r * TMath::Cos(x));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill array with n random numbers following a gaussian of the given mean
+/// and sigma, with one call to RndmArray.
+/// The numbers are obtained with the Box-Muller method as in Rannor, which,
+/// unlike the method of Gaus, consumes a fixed number of uniform numbers and
+/// therefore transforms them in a loop without branches. The sequence is then
+/// different from n calls to Gaus.
+
+void TRandom::GausArray(Int_t n, Double_t *array, Double_t mean, Double_t sigma)
+{
+   const Double_t kTwoPi = 6.28318530717958623;
+   Int_t npairs = n / 2;
+   RndmArray(2 * npairs, array);
+   for (Int_t i = 0; i < npairs; ++i) {
+      // the pairs are transformed in place, the uniforms of the first half
+      // of the array being consumed before being overwritten
+      Double_t y = array[2 * i];
+      Double_t z = array[2 * i + 1];
+      Double_t r = sigma * TMath::Sqrt(-2 * TMath::Log(y));
+      array[2 * i] = mean + r * TMath::Sin(kTwoPi * z);
+      array[2 * i + 1] = mean + r * TMath::Cos(kTwoPi * z);
+   }
+   if (2 * npairs < n) {
+      Double_t u[2];
+      RndmArray(2, u);
+      array[n - 1] = mean + sigma * TMath::Sqrt(-2 * TMath::Log(u[0])) * TMath::Sin(kTwoPi * u[1]);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return 2 numbers distributed following a gaussian with mean=0 and sigma=1.
 
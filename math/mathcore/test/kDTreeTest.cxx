@@ -26,6 +26,7 @@ bool showGraphics = false;
 void TestBuild(const Int_t npoints = 1000000, const Int_t bsize = 100);
 void TestConstr(const Int_t npoints = 1000000, const Int_t bsize = 100);
 void TestSpeed(Int_t npower2 = 20, Int_t bsize = 10);
+Int_t TestNeighborsBatch(Int_t npoints = 1000000, Int_t nqueries = 100000, Int_t nn = 10, Int_t bsize = 10);
 
 //void TestkdtreeIF(Int_t npoints=1000, Int_t bsize=9, Int_t nloop=1000, Int_t mode = 2);
 //void TestSizeIF(Int_t nsec=36, Int_t nrows=159, Int_t npoints=1000,  Int_t bsize=10, Int_t mode=1);
@@ -45,12 +46,14 @@ Float_t Mem()
 ///
 ///
 
-void kDTreeTest()
+Int_t kDTreeTest()
 {
   printf("\n\tTesting kDTree memory usage ...\n");
   TestBuild();
   printf("\n\tTesting kDTree speed ...\n");
   TestSpeed();
+  printf("\n\tTesting kDTree batched nearest neighbors ...\n");
+  return TestNeighborsBatch();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -265,6 +268,62 @@ void TestSpeed(Int_t npower2, Int_t bsize)
   return;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Compare the nearest neighbors of many points found at once, and their CPU
+/// time, with those found one point at a time. Returns the number of differences.
+///
+
+Int_t TestNeighborsBatch(Int_t npoints, Int_t nqueries, Int_t nn, Int_t bsize)
+{
+  const Int_t ndim = 3;
+  Double_t *data0 = new Double_t[npoints*ndim];
+  Double_t *data[ndim];
+  for (Int_t idim=0; idim<ndim; idim++) {
+    data[idim] = &data0[idim*npoints];
+    for (Int_t i=0; i<npoints; i++)
+      data[idim][i] = gRandom->Rndm();
+  }
+  Double_t *points = new Double_t[nqueries*ndim];
+  for (Int_t i=0; i<nqueries*ndim; i++)
+    points[i] = gRandom->Rndm();
+
+  TStopwatch timer;
+  timer.Start(kTRUE);
+  TKDTreeID *kdtree = new TKDTreeID(npoints, ndim, bsize, data);
+  kdtree->Build();
+  timer.Stop();
+  printf("npoints [%d] build cpu time %f [s]\n", npoints, timer.CpuTime());
+
+  Int_t *ind1 = new Int_t[nqueries*nn];
+  Int_t *ind2 = new Int_t[nqueries*nn];
+  Double_t *dist1 = new Double_t[nqueries*nn];
+  Double_t *dist2 = new Double_t[nqueries*nn];
+  timer.Start(kTRUE);
+  for (Int_t i=0; i<nqueries; i++)
+    kdtree->FindNearestNeighbors(points + i*ndim, nn, ind1 + i*nn, dist1 + i*nn);
+  timer.Stop();
+  printf("nqueries [%d] one by one cpu time %f [s]\n", nqueries, timer.CpuTime());
+  timer.Start(kTRUE);
+  kdtree->FindNearestNeighbors(nqueries, points, nn, ind2, dist2);
+  timer.Stop();
+  printf("nqueries [%d] batched real time %f [s]\n", nqueries, timer.RealTime());
+
+  Int_t ndiff = 0;
+  for (Int_t i=0; i<nqueries*nn; i++)
+    if (ind1[i] != ind2[i] || dist1[i] != dist2[i]) ndiff++;
+  printf("%d neighbors differ between the batched and the one by one queries\n", ndiff);
+
+  delete kdtree;
+  delete[] data0;
+  delete[] points;
+  delete[] ind1;
+  delete[] ind2;
+  delete[] dist1;
+  delete[] dist2;
+  return ndiff;
+}
+
 /*
 ////////////////////////////////////////////////////////////////////////////////
 ///
@@ -579,7 +638,7 @@ int main(int argc, char **argv) {
    if ( showGraphics )
       theApp = new TApplication("App",&argc,argv);
 
-   kDTreeTest();
+   Int_t ndiff = kDTreeTest();
 
    if ( showGraphics )
    {
@@ -588,5 +647,5 @@ int main(int argc, char **argv) {
       theApp = 0;
    }
 
-   return 0;
+   return ndiff ? 1 : 0;
 }
@@ -12,6 +12,7 @@
 #include "TRandom1.h"
 #include "TRandom2.h"
 #include "TRandom3.h"
+#include "TRandomGen.h"
 //#include "TRandomNew3.h"
 
 #include "TStopwatch.h"
@@ -192,6 +193,47 @@ bool test4() {
    return ret; 
 }
 
+bool test5() {
+
+   bool ret = true;
+
+   std::cout << "\nTesting the arrays of MIXMAX240 vs single numbers of TRandom3" << std::endl;
+
+   // the array of uniform numbers must be the same sequence as from single calls
+   MixMaxEngine240 e1(1111), e2(1111);
+   std::vector<double> u(NR);
+   e1.Rndm();
+   e2.Rndm();
+   e1.RndmArray(NR, u.data());
+   for (int i = 0; i < NR; ++i) {
+      if (u[i] != e2.Rndm()) {
+         std::cout << "Error: RndmArray differs from Rndm for element " << i << std::endl;
+         ret = false;
+         break;
+      }
+   }
+
+   TRandomMixMax rmx(1111);
+   TRandom3 r3(2222);
+   std::vector<double> x(NR);
+   std::vector<double> y(NR);
+
+   rmx.GausArray(NR, x.data());
+   for (int i = 0; i < NR; ++i) {
+      x[i] = ROOT::Math::normal_cdf(x[i],1);
+      y[i] = ROOT::Math::normal_cdf(r3.Gaus(0,1),1);
+   }
+   ret &= testCompatibility(x,y);
+
+   rmx.ExpArray(NR, x.data(), 2.);
+   for (int i = 0; i < NR; ++i) {
+      x[i] = ROOT::Math::exponential_cdf(x[i],0.5);
+      y[i] = ROOT::Math::exponential_cdf(r3.Exp(2.),0.5);
+   }
+   ret &= testCompatibility(x,y);
+   return ret;
+}
+
 
 bool testMathRandom() {
 
@@ -203,6 +245,7 @@ bool testMathRandom() {
    ret &= test2(); 
    ret &= test3(); 
    ret &= test4(); 
+   ret &= test5();
 
    if (!ret) Error("testMathRandom","Test Failed");
    else
@@ -132,11 +132,13 @@ Bool_t TDecompChol::Decompose()
       pU[rowOff+icol] = ujj;
 
       if (icol < n-1) {
-         for (j = icol+1; j < n; j++) {
-            for (i = 0; i < icol; i++) {
-               const Int_t rowOff2 = i*n;
-               pU[rowOff+j] -= pU[rowOff2+j]*pU[rowOff2+icol];
-            }
+         // the rows of the previous columns are scanned contiguously, each
+         // element still being updated in the order of i
+         for (i = 0; i < icol; i++) {
+            const Int_t rowOff2 = i*n;
+            const Double_t uic = pU[rowOff2+icol];
+            for (j = icol+1; j < n; j++)
+               pU[rowOff+j] -= pU[rowOff2+j]*uic;
          }
          for (j = icol+1; j < n; j++)
             pU[rowOff+j] /= ujj;
@@ -32,6 +32,7 @@
 #include "TMatrixDEigen.h"
 #include "TClass.h"
 #include "TMath.h"
+#include "TMatrixTParallel.h"
 
 templateClassImp(TMatrixT);
 
@@ -3073,76 +3074,142 @@ TMatrixT<Element> &ElementDiv(TMatrixT<Element> &target,const TMatrixTSym<Elemen
    return target;
 }
 
+namespace {
+
+// Sizes of the blocks of the products, for the blocks of the second matrix
+// to stay in the cache while the rows of the result are computed.
+const Int_t kBlockInner = 128; // number of terms of the sums of a block
+const Int_t kBlockCols  = 256; // number of columns of the result of a block
+const Int_t kBlockSize  = 32768; // number of elements of a block of rows of B in A*B^T
+
 ////////////////////////////////////////////////////////////////////////////////
-/// Elementary routine to calculate matrix multiplication A*B
+/// Rows [first, last) of C = A*B, A being nrowsb columns wide and B ncolsb
+/// columns wide. The terms of each element are summed in the order of the
+/// straightforward loop, by blocks of B reused by all the rows.
 
 template<class Element>
-void AMultB(const Element * const ap,Int_t na,Int_t ncolsa,
-            const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
+void AMultBRows(const Element *ap,Int_t nrowsb,const Element *bp,Int_t ncolsb,Element *cp,Int_t first,Int_t last)
 {
-   const Element *arp0 = ap;                     // Pointer to  A[i,0];
-   while (arp0 < ap+na) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *arp = arp0;                       // Pointer to the i-th row of A, reset to A[i,0]
-         Element cij = 0;
-         while (bcp < bp+nb) {                     // Scan the i-th row of A and
-            cij += *arp++ * *bcp;                   // the j-th col of B
-            bcp += ncolsb;
+   for (Int_t i = first; i < last; i++)
+      for (Int_t j = 0; j < ncolsb; j++)
+         cp[i*ncolsb+j] = 0;
+   for (Int_t k0 = 0; k0 < nrowsb; k0 += kBlockInner) {
+      const Int_t k1 = TMath::Min(k0+kBlockInner,nrowsb);
+      for (Int_t j0 = 0; j0 < ncolsb; j0 += kBlockCols) {
+         const Int_t j1 = TMath::Min(j0+kBlockCols,ncolsb);
+         for (Int_t i = first; i < last; i++) {
+            const Element *arp = ap+i*nrowsb;
+                  Element *crp = cp+i*ncolsb;
+            for (Int_t k = k0; k < k1; k++) {
+               const Element aik = arp[k];
+               const Element *brp = bp+k*ncolsb;
+               for (Int_t j = j0; j < j1; j++)
+                  crp[j] += aik*brp[j];
+            }
          }
-         *cp++ = cij;
-         bcp -= nb-1;                              // Set bcp to the (j+1)-th col
       }
-      arp0 += ncolsa;                             // Set ap to the (i+1)-th row
    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Elementary routine to calculate matrix multiplication A^T*B
+/// Rows [first, last) of C = A^T*B, A being ncolsa columns and B ncolsb
+/// columns wide, both with nrowsb rows.
 
 template<class Element>
-void AtMultB(const Element * const ap,Int_t ncolsa,
-             const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
+void AtMultBRows(const Element *ap,Int_t ncolsa,const Element *bp,Int_t nrowsb,Int_t ncolsb,Element *cp,
+                 Int_t first,Int_t last)
 {
-   const Element *acp0 = ap;           // Pointer to  A[i,0];
-   while (acp0 < ap+ncolsa) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *acp = acp0;                       // Pointer to the i-th column of A, reset to A[0,i]
-         Element cij = 0;
-         while (bcp < bp+nb) {           // Scan the i-th column of A and
-            cij += *acp * *bcp;           // the j-th col of B
-            acp += ncolsa;
-            bcp += ncolsb;
+   for (Int_t i = first; i < last; i++)
+      for (Int_t j = 0; j < ncolsb; j++)
+         cp[i*ncolsb+j] = 0;
+   for (Int_t k0 = 0; k0 < nrowsb; k0 += kBlockInner) {
+      const Int_t k1 = TMath::Min(k0+kBlockInner,nrowsb);
+      for (Int_t j0 = 0; j0 < ncolsb; j0 += kBlockCols) {
+         const Int_t j1 = TMath::Min(j0+kBlockCols,ncolsb);
+         for (Int_t i = first; i < last; i++) {
+            Element *crp = cp+i*ncolsb;
+            for (Int_t k = k0; k < k1; k++) {
+               const Element aki = ap[k*ncolsa+i];
+               const Element *brp = bp+k*ncolsb;
+               for (Int_t j = j0; j < j1; j++)
+                  crp[j] += aki*brp[j];
+            }
          }
-         *cp++ = cij;
-         bcp -= nb-1;                    // Set bcp to the (j+1)-th col
       }
-      acp0++;                           // Set acp0 to the (i+1)-th col
    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Elementary routine to calculate matrix multiplication A*B^T
+/// Rows [first, last) of C = A*B^T, A and B being ncols columns wide and B
+/// having nrowsb rows. Each element is the dot product of a row of A and a
+/// row of B, the rows of B being taken by blocks reused by all the rows of A.
 
 template<class Element>
-void AMultBt(const Element * const ap,Int_t na,Int_t ncolsa,
-             const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
+void AMultBtRows(const Element *ap,Int_t ncols,const Element *bp,Int_t nrowsb,Element *cp,Int_t first,Int_t last)
 {
-   const Element *arp0 = ap;                    // Pointer to  A[i,0];
-   while (arp0 < ap+na) {
-      const Element *brp0 = bp;                  // Pointer to  B[j,0];
-      while (brp0 < bp+nb) {
-         const Element *arp = arp0;               // Pointer to the i-th row of A, reset to A[i,0]
-         const Element *brp = brp0;               // Pointer to the j-th row of B, reset to B[j,0]
-         Element cij = 0;
-         while (brp < brp0+ncolsb)                 // Scan the i-th row of A and
-            cij += *arp++ * *brp++;                 // the j-th row of B
-         *cp++ = cij;
-         brp0 += ncolsb;                           // Set brp0 to the (j+1)-th row
+   const Int_t blockRows = TMath::Max(1,kBlockSize/TMath::Max(1,ncols));
+   for (Int_t j0 = 0; j0 < nrowsb; j0 += blockRows) {
+      const Int_t j1 = TMath::Min(j0+blockRows,nrowsb);
+      for (Int_t i = first; i < last; i++) {
+         const Element *arp = ap+i*ncols;
+         for (Int_t j = j0; j < j1; j++) {
+            const Element *brp = bp+j*ncols;
+            Element cij = 0;
+            for (Int_t k = 0; k < ncols; k++)
+               cij += arp[k]*brp[k];
+            cp[i*nrowsb+j] = cij;
+         }
       }
-      arp0 += ncolsa;                             // Set arp0 to the (i+1)-th row
    }
 }
 
+} // unnamed namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Elementary routine to calculate matrix multiplication A*B.
+/// The rows of the product are computed by blocks, in parallel if the
+/// implicit multi-threading is enabled and the product large.
+
+template<class Element>
+void AMultB(const Element * const ap,Int_t na,Int_t ncolsa,
+            const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
+{
+   if (ncolsa == 0 || ncolsb == 0) return;
+   ROOT::Internal::ForEachMatrixRowRange(na/ncolsa, Double_t(na)*ncolsb, [&](Int_t first, Int_t last) {
+      AMultBRows(ap,nb/ncolsb,bp,ncolsb,cp,first,last);
+   });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Elementary routine to calculate matrix multiplication A^T*B.
+/// The rows of the product are computed by blocks, in parallel if the
+/// implicit multi-threading is enabled and the product large.
+
+template<class Element>
+void AtMultB(const Element * const ap,Int_t ncolsa,
+             const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
+{
+   if (ncolsa == 0 || ncolsb == 0) return;
+   ROOT::Internal::ForEachMatrixRowRange(ncolsa, Double_t(ncolsa)*nb, [&](Int_t first, Int_t last) {
+      AtMultBRows(ap,ncolsa,bp,nb/ncolsb,ncolsb,cp,first,last);
+   });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Elementary routine to calculate matrix multiplication A*B^T.
+/// The rows of the product are computed by blocks, in parallel if the
+/// implicit multi-threading is enabled and the product large.
+
+template<class Element>
+void AMultBt(const Element * const ap,Int_t na,Int_t ncolsa,
+             const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
+{
+   if (ncolsa == 0 || ncolsb == 0) return;
+   ROOT::Internal::ForEachMatrixRowRange(na/ncolsa, Double_t(na)*(nb/ncolsb), [&](Int_t first, Int_t last) {
+      AMultBtRows(ap,ncolsa,bp,nb/ncolsb,cp,first,last);
+   });
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Stream an object of class TMatrixT.
 
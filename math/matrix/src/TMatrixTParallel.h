@@ -0,0 +1,60 @@
+// @(#)root/matrix:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TMatrixTParallel
+#define ROOT_TMatrixTParallel
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// Distribution of the rows of the matrix operations among the threads  //
+// of the implicit multi-threading, private to the matrix package.     //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "RConfigure.h"
+#include "RtypesCore.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+namespace ROOT {
+namespace Internal {
+
+/// Minimal number of multiply-adds of an operation for its rows to be
+/// processed in parallel, below which the tasks would cost more than they gain.
+const Double_t kMatrixMinParallelWork = 1.e6;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(first, last) on consecutive ranges of rows covering [0, nrows),
+/// in parallel if the implicit multi-threading is enabled and the operation
+/// needs at least kMatrixMinParallelWork multiply-adds. The ranges must be
+/// computable independently, i.e. func must only write their rows.
+
+template <class F>
+void ForEachMatrixRowRange(Int_t nrows, Double_t work, F func)
+{
+#ifdef R__USE_IMT
+   if (nrows > 1 && work >= kMatrixMinParallelWork && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.ForeachRange([&](std::size_t first, std::size_t last) { func(Int_t(first), Int_t(last)); }, 0, nrows);
+      return;
+   }
+#else
+   (void)work;
+#endif
+   func(0, nrows);
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
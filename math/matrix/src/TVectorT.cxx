@@ -43,6 +43,7 @@
 #include "TMath.h"
 #include "TROOT.h"
 #include "Varargs.h"
+#include "TMatrixTParallel.h"
 
 templateClassImp(TVectorT);
 
@@ -1058,16 +1059,18 @@ TVectorT<Element> &TVectorT<Element>::operator*=(const TMatrixTSparse<Element> &
    const Element * const sp = elements_old;
          Element *       tp = this->GetMatrixArray(); // Target vector ptr
 
-   for (Int_t irow = 0; irow < fNrows; irow++) {
-      const Int_t sIndex = pRowIndex[irow];
-      const Int_t eIndex = pRowIndex[irow+1];
-      Element sum = 0.0;
-      for (Int_t index = sIndex; index < eIndex; index++) {
-         const Int_t icol = pColIndex[index];
-         sum += mp[index]*sp[icol];
+   ROOT::Internal::ForEachMatrixRowRange(fNrows, a.GetNoElements(), [&](Int_t first, Int_t last) {
+      for (Int_t irow = first; irow < last; irow++) {
+         const Int_t sIndex = pRowIndex[irow];
+         const Int_t eIndex = pRowIndex[irow+1];
+         Element sum = 0.0;
+         for (Int_t index = sIndex; index < eIndex; index++) {
+            const Int_t icol = pColIndex[index];
+            sum += mp[index]*sp[icol];
+         }
+         tp[irow] = sum;
       }
-      tp[irow] = sum;
-   }
+   });
 
    if (isAllocated)
       delete [] elements_old;
@@ -1789,8 +1792,8 @@ TVectorT<Element> &Add(TVectorT<Element> &target,Element scalar,
    const Element * const sp = source.GetMatrixArray(); // Source vector ptr
          Element *       tp = target.GetMatrixArray(); // Target vector ptr
 
-   if (scalar == 1.0) {
-      for (Int_t irow = 0; irow < a.GetNrows(); irow++) {
+   ROOT::Internal::ForEachMatrixRowRange(a.GetNrows(), a.GetNoElements(), [&](Int_t first, Int_t last) {
+      for (Int_t irow = first; irow < last; irow++) {
          const Int_t sIndex = pRowIndex[irow];
          const Int_t eIndex = pRowIndex[irow+1];
          Element sum = 0.0;
@@ -1798,42 +1801,16 @@ TVectorT<Element> &Add(TVectorT<Element> &target,Element scalar,
             const Int_t icol = pColIndex[index];
             sum += mp[index]*sp[icol];
          }
-         tp[irow] += sum;
+         if (scalar == 1.0)
+            tp[irow] += sum;
+         else if (scalar == 0.0)
+            tp[irow]  = sum;
+         else if (scalar == -1.0)
+            tp[irow] -= sum;
+         else
+            tp[irow] += scalar * sum;
       }
-   } else if (scalar == 0.0) {
-      for (Int_t irow = 0; irow < a.GetNrows(); irow++) {
-         const Int_t sIndex = pRowIndex[irow];
-         const Int_t eIndex = pRowIndex[irow+1];
-         Element sum = 0.0;
-         for (Int_t index = sIndex; index < eIndex; index++) {
-            const Int_t icol = pColIndex[index];
-            sum += mp[index]*sp[icol];
-         }
-         tp[irow]  = sum;
-      }
-   } else if (scalar == -1.0) {
-     for (Int_t irow = 0; irow < a.GetNrows(); irow++) {
-        const Int_t sIndex = pRowIndex[irow];
-        const Int_t eIndex = pRowIndex[irow+1];
-        Element sum = 0.0;
-        for (Int_t index = sIndex; index < eIndex; index++) {
-           const Int_t icol = pColIndex[index];
-           sum += mp[index]*sp[icol];
-        }
-        tp[irow] -= sum;
-      }
-   } else {
-      for (Int_t irow = 0; irow < a.GetNrows(); irow++) {
-        const Int_t sIndex = pRowIndex[irow];
-        const Int_t eIndex = pRowIndex[irow+1];
-        Element sum = 0.0;
-        for (Int_t index = sIndex; index < eIndex; index++) {
-           const Int_t icol = pColIndex[index];
-           sum += mp[index]*sp[icol];
-        }
-        tp[irow] += scalar * sum;
-      }
-   }
+   });
 
    return target;
 }
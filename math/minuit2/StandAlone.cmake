@@ -84,6 +84,15 @@ if(minuit2_mpi)
     target_link_libraries(Minuit2Common INTERFACE MPI::MPI_CXX)
 endif()
 
+# BLAS and LAPACK support
+if(minuit2_blas)
+    if(CMAKE_PROJECT_NAME STREQUAL PROJECT_NAME)
+        message(STATUS "Building Minuit2 with BLAS and LAPACK")
+    endif()
+    target_compile_definitions(Minuit2Common INTERFACE MINUIT2_BLAS)
+    target_link_libraries(Minuit2Common INTERFACE ${LAPACK_LIBRARIES} ${BLAS_LIBRARIES})
+endif()
+
 # Add the libraries
 add_subdirectory(src)
 
@@ -157,6 +166,7 @@ endif()
 # Setup package info
 add_feature_info(minuit2_openmp minuit2_openmp "OpenMP (Thread safe FCNs only)")
 add_feature_info(minuit2_mpi minuit2_mpi "MPI (Thread safe FCNs only)")
+add_feature_info(minuit2_blas minuit2_blas "Optimized BLAS and LAPACK")
 set_package_properties(OpenMP PROPERTIES
     URL "http://www.openmp.org"
     DESCRIPTION "Parallel compiler directives"
@@ -13,6 +13,7 @@
 #include "Minuit2/MnConfig.h"
 #include "Minuit2/MnMatrix.h"
 
+#include <atomic>
 #include <vector>
 
 namespace ROOT {
@@ -56,7 +57,7 @@ private:
 
 protected:
 
-  mutable int fNumCall;
+  mutable std::atomic<int> fNumCall; // atomic as the FCN can be called by several threads, see MnStrategy::ParallelDerivatives()
 };
 
   }  // namespace Minuit2
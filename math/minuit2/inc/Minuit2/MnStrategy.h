@@ -49,6 +49,11 @@ public:
 
    int StorageLevel() const { return fStoreLevel; }
 
+   /// Whether the numerical derivatives of the gradient and of MnHesse are computed in parallel, the
+   /// parameters (or rows of the Hessian) being distributed among threads, when Minuit2 is built with
+   /// support for implicit multi-threading. The FCN is then called concurrently and must be thread safe.
+   bool ParallelDerivatives() const { return fParallelDerivatives; }
+
    bool IsLow() const {return fStrategy == 0;}
    bool IsMedium() const {return fStrategy == 1;}
    bool IsHigh() const {return fStrategy >= 2;}
@@ -69,6 +74,8 @@ public:
    // set storage level of iteration quantities
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
+
+   void SetParallelDerivatives(bool on = true) { fParallelDerivatives = on; }
 private:
 
    unsigned int fStrategy;
@@ -81,6 +88,7 @@ private:
    double fHessTlrG2;
    unsigned int fHessGradNCyc;
    int fStoreLevel;
+   bool fParallelDerivatives;
 };
 
   }  // namespace Minuit2
@@ -10,6 +10,12 @@
 #include "Minuit2/LAVector.h"
 #include "Minuit2/LASymMatrix.h"
 
+#ifdef MINUIT2_BLAS
+// LAPACK eigen decomposition of symmetric matrices in packed storage
+extern "C" void dspev_(const char* jobz, const char* uplo, const int* n, double* ap, double* w, double* z,
+                       const int* ldz, double* work, int* info);
+#endif
+
 namespace ROOT {
 
    namespace Minuit2 {
@@ -21,6 +27,20 @@ LAVector eigenvalues(const LASymMatrix& mat) {
    // calculate eigenvalues of symmetric matrices using mneigen function (transalte from fortran Minuit)
    unsigned int nrow = mat.Nrow();
 
+#ifdef MINUIT2_BLAS
+   // the eigenvalues only, in ascending order as from mneigen; dspev overwrites the matrix
+   LASymMatrix tmp(mat);
+   LAVector result(nrow);
+   LAVector work(3*nrow);
+   const int n = nrow;
+   const int ldz = 1;
+   int info = 0;
+   dspev_("N", "U", &n, tmp.Data(), result.Data(), 0, &ldz, work.Data(), &info);
+   (void)info;
+   assert(info == 0);
+
+   return result;
+#else
    LAVector tmp(nrow*nrow);
    LAVector work(2*nrow);
 
@@ -38,6 +58,7 @@ LAVector eigenvalues(const LASymMatrix& mat) {
    for(unsigned int i = 0; i < nrow; i++) result(i) = work(i);
 
    return result;
+#endif
 }
 
    }  // namespace Minuit2
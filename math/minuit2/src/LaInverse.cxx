@@ -10,6 +10,14 @@
 #include "Minuit2/LaInverse.h"
 #include "Minuit2/LASymMatrix.h"
 
+#ifdef MINUIT2_BLAS
+#include <vector>
+
+// LAPACK factorization and inversion of symmetric matrices in packed storage
+extern "C" void dsptrf_(const char* uplo, const int* n, double* ap, int* ipiv, int* info);
+extern "C" void dsptri_(const char* uplo, const int* n, double* ap, const int* ipiv, double* work, int* info);
+#endif
+
 namespace ROOT {
 
    namespace Minuit2 {
@@ -30,7 +38,21 @@ int Invert(LASymMatrix& t) {
       if(!(tmp > 0.)) ifail = 1;
       else t.Data()[0] = 1./tmp;
    } else {
+#ifdef MINUIT2_BLAS
+      // the upper triangle of t is packed by columns, as expected by LAPACK;
+      // as mnvert, give up on negative diagonal elements
+      const int n = t.Nrow();
+      for (int i = 0; i < n; i++)
+         if (t(i,i) < 0.) return 1;
+      std::vector<int> ipiv(n);
+      std::vector<double> work(n);
+      int info = 0;
+      dsptrf_("U", &n, t.Data(), ipiv.data(), &info);
+      if (info == 0) dsptri_("U", &n, t.Data(), ipiv.data(), work.data(), &info);
+      ifail = (info != 0);
+#else
       ifail = mnvert(t);
+#endif
    }
 
    return ifail;
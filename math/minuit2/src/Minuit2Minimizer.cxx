@@ -462,6 +462,11 @@ bool Minuit2Minimizer::Minimize() {
       strategy.SetHessianStepTolerance(hessStepTol);
       strategy.SetHessianG2Tolerance(hessStepTol);
 
+      // the FCN must be thread safe to compute the derivatives in parallel
+      int parallelDerivatives = strategy.ParallelDerivatives();
+      minuit2Opt->GetValue("ParallelDerivatives",parallelDerivatives);
+      strategy.SetParallelDerivatives(parallelDerivatives != 0);
+
       int storageLevel = 1;
       bool ret = minuit2Opt->GetValue("StorageLevel",storageLevel);
       if (ret) SetStorageLevel(storageLevel);
@@ -1093,7 +1098,15 @@ bool Minuit2Minimizer::Hesse( ) {
    // set the precision if needed
    if (Precision() > 0) fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnHesse hesse( strategy );
+   ROOT::Minuit2::MnStrategy mnStrategy(strategy);
+   ROOT::Math::IOptions * minuit2Opt = ROOT::Math::MinimizerOptions::FindDefault("Minuit2");
+   if (minuit2Opt) {
+      int parallelDerivatives = mnStrategy.ParallelDerivatives();
+      minuit2Opt->GetValue("ParallelDerivatives",parallelDerivatives);
+      mnStrategy.SetParallelDerivatives(parallelDerivatives != 0);
+   }
+
+   ROOT::Minuit2::MnHesse hesse( mnStrategy );
 
    if (PrintLevel() >= 1)
       std::cout << "Minuit2Minimizer::Hesse using max-calls " << maxfcn << std::endl;
@@ -30,6 +30,11 @@
 
 #include "Minuit2/MPIProcess.h"
 
+#ifdef MINUIT2_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 namespace ROOT {
 
    namespace Minuit2 {
@@ -244,8 +249,27 @@ L30:
    }
 
    //off-diagonal Elements
+   bool parallel = false;
+#ifdef MINUIT2_IMT
+   parallel = fStrategy.ParallelDerivatives();
+   if (parallel && n > 1) {
+      // each row is handled by a task, with its own copy of the parameters;
+      // the tasks write different elements of vhmat
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](unsigned int i) {
+         MnAlgebraicVector xi = x;
+         xi(i) += dirin(i);
+         for (unsigned int j = i + 1; j < n; j++) {
+            xi(j) += dirin(j);
+            double fs1 = mfcn(xi);
+            vhmat(i,j) = (fs1 + amin - yy(i) - yy(j))/(dirin(i)*dirin(j));
+            xi(j) -= dirin(j);
+         }
+      }, ROOT::TSeq<unsigned int>(n - 1));
+   }
+#endif
    // initial starting values
-   if (n > 0) { 
+   if (n > 0 && !parallel) {
       MPIProcess mpiprocOffDiagonal(n*(n-1)/2,0);
       unsigned int startParIndexOffDiagonal = mpiprocOffDiagonal.StartElementIndex();
       unsigned int endParIndexOffDiagonal = mpiprocOffDiagonal.EndElementIndex();
@@ -33,6 +33,11 @@
 
 #include "Minuit2/MPIProcess.h"
 
+#ifdef MINUIT2_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 namespace ROOT {
 
    namespace Minuit2 {
@@ -111,37 +116,14 @@ FunctionGradient Numerical2PGradientCalculator::operator()(const MinimumParamete
    std::cout.precision(pr);
 #endif
 
-#ifndef _OPENMP
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for(unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
- // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-//#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for(int i = 0; i < int(n); i++) {
-
-#endif
+   // compute the derivatives along parameter i, x being par.Vec() on input and output
+   auto derivative = [&](unsigned int i, MnAlgebraicVector & x) {
 
 #ifdef DEBUG_MP
       int ith = omp_get_thread_num();
       //std::cout << "Thread number " << ith << "  " << i << std::endl;
 #endif
 
-#ifdef _OPENMP
-       // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
       double xtf = x(i);
       double epspri = eps2 + fabs(grd(i)*eps2);
       double stepb4 = 0.;
@@ -217,12 +199,48 @@ FunctionGradient Numerical2PGradientCalculator::operator()(const MinimumParamete
       std::cout << "Parameter " << Trafo().Name(iext) << " Gradient =   " << grd(i) << " g2 = " << g2(i) << " step " << gstep(i) << std::endl;
       std::cout.precision(pr);
 #endif
+   };
+
+#ifdef MINUIT2_IMT
+   if (Strategy().ParallelDerivatives()) {
+      // each parameter is handled by a task, with its own copy of the parameters;
+      // the tasks write different elements of grd, g2 and gstep
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](unsigned int i) {
+         MnAlgebraicVector x = par.Vec();
+         derivative(i, x);
+      }, ROOT::TSeq<unsigned int>(n));
+
+      return FunctionGradient(grd, g2, gstep);
    }
+#endif
 
 #ifndef _OPENMP
+   // for serial execution this can be outside the loop
+   MnAlgebraicVector x = par.Vec();
+
+   unsigned int startElementIndex = mpiproc.StartElementIndex();
+   unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+   for(unsigned int i = startElementIndex; i < endElementIndex; i++)
+      derivative(i, x);
+
    mpiproc.SyncVector(grd);
    mpiproc.SyncVector(g2);
    mpiproc.SyncVector(gstep);
+#else
+
+ // parallelize this loop using OpenMP
+//#define N_PARALLEL_PAR 5
+#pragma omp parallel
+#pragma omp for
+//#pragma omp for schedule (static, N_PARALLEL_PAR)
+
+   for(int i = 0; i < int(n); i++) {
+       // create in loop since each thread will use its own copy
+      MnAlgebraicVector x = par.Vec();
+      derivative(i, x);
+   }
 #endif
 
 #ifdef DEBUG
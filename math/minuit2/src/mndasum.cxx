@@ -14,12 +14,22 @@
 
 #include <math.h>
 
+#ifdef MINUIT2_BLAS
+// DASUM of the BLAS library Minuit2 is built with
+extern "C" double dasum_(const int* n, const double* dx, const int* incx);
+#endif
+
 namespace ROOT {
 
    namespace Minuit2 {
 
 
 double mndasum(unsigned int n, const double* dx, int incx) {
+#ifdef MINUIT2_BLAS
+   const int nn = n;
+   return dasum_(&nn, dx, &incx);
+#endif
+
    /* System generated locals */
    int i__1, i__2;
    double ret_val, d__1, d__2, d__3, d__4, d__5, d__6;
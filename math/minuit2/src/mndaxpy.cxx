@@ -12,6 +12,11 @@
       -lf2c -lm   (in that order)
 */
 
+#ifdef MINUIT2_BLAS
+// DAXPY of the BLAS library Minuit2 is built with
+extern "C" void daxpy_(const int* n, const double* da, const double* dx, const int* incx, double* dy, const int* incy);
+#endif
+
 namespace ROOT {
 
    namespace Minuit2 {
@@ -19,6 +24,12 @@ namespace ROOT {
 
 int Mndaxpy(unsigned int n, double da, const double* dx, int incx, double* dy,
             int incy) {
+#ifdef MINUIT2_BLAS
+   const int nn = n;
+   daxpy_(&nn, &da, dx, &incx, dy, &incy);
+   return 0;
+#endif
+
    /* System generated locals */
    int i__1;
 
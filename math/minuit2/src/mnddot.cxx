@@ -12,6 +12,11 @@
    -lf2c -lm   (in that order)
 */
 
+#ifdef MINUIT2_BLAS
+// DDOT of the BLAS library Minuit2 is built with
+extern "C" double ddot_(const int* n, const double* dx, const int* incx, const double* dy, const int* incy);
+#endif
+
 namespace ROOT {
 
    namespace Minuit2 {
@@ -19,6 +24,11 @@ namespace ROOT {
 
 double mnddot(unsigned int n, const double* dx, int incx, const double* dy,
               int incy) {
+#ifdef MINUIT2_BLAS
+   const int nn = n;
+   return ddot_(&nn, dx, &incx, dy, &incy);
+#endif
+
    /* System generated locals */
    int i__1;
    double ret_val;
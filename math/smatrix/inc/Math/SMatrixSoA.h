@@ -0,0 +1,231 @@
+// @(#)root/smatrix:$Id$
+
+#ifndef ROOT_Math_SMatrixSoA
+#define ROOT_Math_SMatrixSoA
+
+#include "Math/SMatrix.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace ROOT {
+
+namespace Math {
+
+//==============================================================================
+// SMatrixSoA
+//==============================================================================
+/**
+    Collection of n matrices of dimension D1 x D2, stored element by element:
+    the element (i,j) of all the matrices is contiguous in memory. A loop over
+    the matrices of the collection, such as Multiply() or Similarity(), is then
+    made of the same operations on contiguous arrays of n numbers, which the
+    compiler vectorizes, instead of small products of D1 x D2 elements. This is
+    how the propagation of the 5 x 5 covariance matrices of many tracks can be
+    computed efficiently:
+
+    ~~~{.cpp}
+    ROOT::Math::SMatrixSoA<double,5,5> jacobians(n), covariances(n);
+    for (std::size_t i = 0; i < n; ++i) {
+       jacobians.Set(i, jacobian[i]);
+       covariances.Set(i, covariance[i]);
+    }
+    auto propagated = ROOT::Math::Similarity(jacobians, covariances);
+    ROOT::Math::SMatrixSym5D c = propagated.GetSym(0);
+    ~~~
+
+    @ingroup SMatrixSVector
+*/
+template <class T, unsigned int D1, unsigned int D2 = D1>
+class SMatrixSoA {
+public:
+   typedef T value_type;
+
+   enum {
+      /// number of rows
+      kRows = D1,
+      /// number of columns
+      kCols = D2,
+      /// number of elements of each matrix
+      kSize = D1 * D2
+   };
+
+   /// collection of n null matrices
+   explicit SMatrixSoA(std::size_t n = 0) : fN(n), fData(kSize * n) {}
+
+   /// number of matrices of the collection
+   std::size_t size() const { return fN; }
+
+   /// change the number of matrices, keeping the first ones
+   void resize(std::size_t n)
+   {
+      std::vector<T> data(kSize * n);
+      const std::size_t m = n < fN ? n : fN;
+      for (unsigned int k = 0; k < kSize; ++k)
+         for (std::size_t i = 0; i < m; ++i)
+            data[k * n + i] = fData[k * fN + i];
+      fData.swap(data);
+      fN = n;
+   }
+
+   /// array of the n elements (i,j) of the matrices
+   const T *operator()(unsigned int i, unsigned int j) const { return fData.data() + (i * D2 + j) * fN; }
+   T *operator()(unsigned int i, unsigned int j) { return fData.data() + (i * D2 + j) * fN; }
+
+   /// set the matrix k of the collection
+   template <class R>
+   void Set(std::size_t k, const SMatrix<T, D1, D2, R> &m)
+   {
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            fData[(i * D2 + j) * fN + k] = m(i, j);
+   }
+
+   /// return the matrix k of the collection
+   SMatrix<T, D1, D2> Get(std::size_t k) const
+   {
+      SMatrix<T, D1, D2> m;
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            m(i, j) = fData[(i * D2 + j) * fN + k];
+      return m;
+   }
+
+   /// return the matrix k of the collection, which must be square and symmetric
+   SMatrix<T, D1, D1, MatRepSym<T, D1>> GetSym(std::size_t k) const
+   {
+      STATIC_CHECK(D1 == D2, SMatrixSoA_GetSym_requires_square_matrices);
+      SMatrix<T, D1, D1, MatRepSym<T, D1>> m;
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j <= i; ++j)
+            m(i, j) = fData[(i * D2 + j) * fN + k];
+      return m;
+   }
+
+private:
+   std::size_t fN;       ///< number of matrices
+   std::vector<T> fData; ///< elements (i,j) of matrix k at index (i * D2 + j) * fN + k
+};
+
+//==============================================================================
+// Multiply
+//==============================================================================
+/**
+   Products a[k] * b[k] of the matrices of two collections of the same size.
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D1, unsigned int D, unsigned int D2>
+SMatrixSoA<T, D1, D2> Multiply(const SMatrixSoA<T, D1, D> &a, const SMatrixSoA<T, D, D2> &b)
+{
+   const std::size_t n = a.size();
+   SMatrixSoA<T, D1, D2> c(n);
+   for (unsigned int i = 0; i < D1; ++i)
+      for (unsigned int j = 0; j < D2; ++j) {
+         T *cij = c(i, j);
+         for (unsigned int l = 0; l < D; ++l) {
+            const T *ail = a(i, l);
+            const T *blj = b(l, j);
+            for (std::size_t k = 0; k < n; ++k)
+               cij[k] += ail[k] * blj[k];
+         }
+      }
+   return c;
+}
+
+//==============================================================================
+// Similarity
+//==============================================================================
+/**
+   Similarity products f[k] * c[k] * f[k]^T of the matrices of two collections
+   of the same size, the matrices c[k] being symmetric. Only the lower triangle
+   of the c[k] is read, and both triangles of the result are set: use
+   SMatrixSoA::GetSym() to retrieve its matrices as symmetric ones.
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D1, unsigned int D2>
+SMatrixSoA<T, D1, D1> Similarity(const SMatrixSoA<T, D1, D2> &f, const SMatrixSoA<T, D2, D2> &c)
+{
+   const std::size_t n = f.size();
+   // fc = f * c, using the lower triangle of c
+   SMatrixSoA<T, D1, D2> fc(n);
+   for (unsigned int i = 0; i < D1; ++i)
+      for (unsigned int j = 0; j < D2; ++j) {
+         T *fcij = fc(i, j);
+         for (unsigned int l = 0; l < D2; ++l) {
+            const T *fil = f(i, l);
+            const T *clj = l >= j ? c(l, j) : c(j, l);
+            for (std::size_t k = 0; k < n; ++k)
+               fcij[k] += fil[k] * clj[k];
+         }
+      }
+   // result = fc * f^T, computing its lower triangle only
+   SMatrixSoA<T, D1, D1> r(n);
+   for (unsigned int i = 0; i < D1; ++i)
+      for (unsigned int j = 0; j <= i; ++j) {
+         T *rij = r(i, j);
+         for (unsigned int l = 0; l < D2; ++l) {
+            const T *fcil = fc(i, l);
+            const T *fjl = f(j, l);
+            for (std::size_t k = 0; k < n; ++k)
+               rij[k] += fcil[k] * fjl[k];
+         }
+         if (j != i) {
+            T *rji = r(j, i);
+            for (std::size_t k = 0; k < n; ++k)
+               rji[k] = rij[k];
+         }
+      }
+   return r;
+}
+
+/**
+   Similarity products f * c[k] * f^T of the matrices c[k] of a collection
+   with the same matrix f, e.g. a constant propagation jacobian.
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D1, unsigned int D2, class R>
+SMatrixSoA<T, D1, D1> Similarity(const SMatrix<T, D1, D2, R> &f, const SMatrixSoA<T, D2, D2> &c)
+{
+   const std::size_t n = c.size();
+   SMatrixSoA<T, D1, D2> fc(n);
+   for (unsigned int i = 0; i < D1; ++i)
+      for (unsigned int j = 0; j < D2; ++j) {
+         T *fcij = fc(i, j);
+         for (unsigned int l = 0; l < D2; ++l) {
+            const T fil = f(i, l);
+            if (fil == T(0))
+               continue;
+            const T *clj = l >= j ? c(l, j) : c(j, l);
+            for (std::size_t k = 0; k < n; ++k)
+               fcij[k] += fil * clj[k];
+         }
+      }
+   SMatrixSoA<T, D1, D1> r(n);
+   for (unsigned int i = 0; i < D1; ++i)
+      for (unsigned int j = 0; j <= i; ++j) {
+         T *rij = r(i, j);
+         for (unsigned int l = 0; l < D2; ++l) {
+            const T fjl = f(j, l);
+            if (fjl == T(0))
+               continue;
+            const T *fcil = fc(i, l);
+            for (std::size_t k = 0; k < n; ++k)
+               rij[k] += fcil[k] * fjl;
+         }
+         if (j != i) {
+            T *rji = r(j, i);
+            for (std::size_t k = 0; k < n; ++k)
+               rji[k] = rij[k];
+         }
+      }
+   return r;
+}
+
+} // namespace Math
+
+} // namespace ROOT
+
+#endif
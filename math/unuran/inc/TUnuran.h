@@ -55,6 +55,14 @@ class TUnuranEmpDist;
 
    In addition is possible to set the random number generator in the constructor of the class, its seed
    via the TUnuran::SetSeed() method.
+
+   Many numbers can be generated at once with TUnuran::Sample(n, x) and TUnuran::SampleDiscr(n, x).
+   The generator can only be used by one thread at a time. TUnuran::SampleParallel and
+   TUnuran::SampleDiscrParallel generate them on independent streams: each stream uses a copy
+   of the initialized UNU.RAN generator with its own TRandomMixMax, seeded with seed + stream index,
+   and the streams are run in parallel if the implicit multi-threading is enabled. The numbers
+   only depend on the seed and on the number of streams, not on the number of threads. The
+   functions of the distribution (pdf, cdf, ...) must then be callable from several threads.
 */
 
 
@@ -200,6 +208,34 @@ public:
    */
    int SampleDiscr();
 
+   /**
+      Sample n numbers of a one-dimensional continuous distribution, or n vectors of a
+      multi-dimensional distribution stored one after the other in x (n times the dimension
+      values), with the generator of this object.
+      Return false if the generator is not initialized or is for a discrete distribution.
+   */
+   bool Sample(unsigned int n, double * x);
+
+   /**
+      Sample n numbers of a discrete distribution in x, with the generator of this object.
+      Return false if the generator is not initialized or not for a discrete distribution.
+   */
+   bool SampleDiscr(unsigned int n, int * x);
+
+   /**
+      Sample as Sample(n, x), on nstreams independent streams of random numbers seeded from seed,
+      in parallel if the implicit multi-threading is enabled.
+      The random engine of this object is not used.
+   */
+   bool SampleParallel(unsigned int n, double * x, unsigned int seed, unsigned int nstreams = 16);
+
+   /**
+      Sample as SampleDiscr(n, x), on nstreams independent streams of random numbers seeded
+      from seed, in parallel if the implicit multi-threading is enabled.
+      The random engine of this object is not used.
+   */
+   bool SampleDiscrParallel(unsigned int n, int * x, unsigned int seed, unsigned int nstreams = 16);
+
    /**
       set the random engine.
       Must be called before init to have effect
@@ -21,17 +21,92 @@
 #include "UnuranDistrAdapter.h"
 
 #include "TRandom.h"
+#include "TRandomGen.h"
 #include "TSystem.h"
 
 #include "TH1.h"
 
 #include <cassert>
+#include <memory>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
 
 
 #include <unuran.h>
 
 #include "TError.h"
 
+namespace {
+
+// Whether the generator samples vectors with unur_sample_vec, and their dimension
+bool IsMultiGenerator(UNUR_GEN * gen, unsigned int & dim) {
+   const UNUR_DISTR * distr = unur_get_distr(gen);
+   if (unur_distr_is_cvec(distr) || unur_distr_is_cvemp(distr)) {
+      dim = unur_get_dimension(gen);
+      return true;
+   }
+   dim = 1;
+   return false;
+}
+
+// Sample n values (n*dim for vectors) in x on nstreams copies of the generator,
+// each one with its own TRandomMixMax seeded with seed + stream index, in
+// parallel if the implicit multi-threading is enabled.
+template <class T, class F>
+bool SampleStreams(UNUR_GEN * gen, unsigned int n, unsigned int dim, T * x, unsigned int seed,
+                   unsigned int nstreams, F sampleOne) {
+   if (nstreams == 0) nstreams = 1;
+
+   // the copies are made sequentially, UNU.RAN does not protect the generator
+   std::vector<std::unique_ptr<TRandomMixMax>> rngs(nstreams);
+   std::vector<UNUR_URNG *> urngs(nstreams, nullptr);
+   std::vector<UNUR_GEN *> gens(nstreams, nullptr);
+   bool ok = true;
+   for (unsigned int i = 0; i < nstreams && ok; ++i) {
+      rngs[i].reset(new TRandomMixMax(seed + i));
+      gens[i] = unur_gen_clone(gen);
+      ok = gens[i] != nullptr;
+      if (ok) {
+         urngs[i] = unur_urng_new(&UnuranRng<TRandom>::Rndm, static_cast<TRandom *>(rngs[i].get()));
+         unur_chg_urng(gens[i], urngs[i]);
+      }
+   }
+
+   if (ok) {
+      auto sampleStream = [&](unsigned int i) {
+         unsigned int first = (unsigned int)((unsigned long long)n * i / nstreams);
+         unsigned int last = (unsigned int)((unsigned long long)n * (i + 1) / nstreams);
+         for (unsigned int k = first; k < last; ++k)
+            sampleOne(gens[i], x + (size_t)k * dim);
+      };
+      bool done = false;
+#ifdef R__USE_IMT
+      if (nstreams > 1 && ROOT::IsImplicitMTEnabled()) {
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(sampleStream, ROOT::TSeqU(nstreams));
+         done = true;
+      }
+#endif
+      if (!done) {
+         for (unsigned int i = 0; i < nstreams; ++i) sampleStream(i);
+      }
+   } else {
+      Error("TUnuran::SampleParallel","the UNU.RAN generator cannot be copied");
+   }
+
+   for (unsigned int i = 0; i < nstreams; ++i) {
+      if (gens[i]) unur_free(gens[i]);
+      if (urngs[i]) unur_urng_free(urngs[i]);
+   }
+   return ok;
+}
+
+} // namespace
+
 
 TUnuran::TUnuran(TRandom * r, unsigned int debugLevel) :
    fGen(0),
@@ -401,6 +476,48 @@ bool TUnuran::SampleMulti(double * x)
    return true;
 }
 
+bool TUnuran::Sample(unsigned int n, double * x)
+{
+   // sample n numbers or vectors of a continuous distribution
+   if (fGen == 0) return false;
+   if (unur_distr_is_discr(unur_get_distr(fGen))) return false;
+   unsigned int dim = 1;
+   if (IsMultiGenerator(fGen, dim)) {
+      for (unsigned int i = 0; i < n; ++i) unur_sample_vec(fGen, x + (size_t)i * dim);
+   } else {
+      for (unsigned int i = 0; i < n; ++i) x[i] = unur_sample_cont(fGen);
+   }
+   return true;
+}
+
+bool TUnuran::SampleDiscr(unsigned int n, int * x)
+{
+   // sample n numbers of a discrete distribution
+   if (fGen == 0) return false;
+   if (!unur_distr_is_discr(unur_get_distr(fGen))) return false;
+   for (unsigned int i = 0; i < n; ++i) x[i] = unur_sample_discr(fGen);
+   return true;
+}
+
+bool TUnuran::SampleParallel(unsigned int n, double * x, unsigned int seed, unsigned int nstreams)
+{
+   // sample n numbers or vectors of a continuous distribution on independent streams
+   if (fGen == 0) return false;
+   if (unur_distr_is_discr(unur_get_distr(fGen))) return false;
+   unsigned int dim = 1;
+   if (IsMultiGenerator(fGen, dim))
+      return SampleStreams(fGen, n, dim, x, seed, nstreams, [](UNUR_GEN * gen, double * v) { unur_sample_vec(gen, v); });
+   return SampleStreams(fGen, n, 1, x, seed, nstreams, [](UNUR_GEN * gen, double * v) { *v = unur_sample_cont(gen); });
+}
+
+bool TUnuran::SampleDiscrParallel(unsigned int n, int * x, unsigned int seed, unsigned int nstreams)
+{
+   // sample n numbers of a discrete distribution on independent streams
+   if (fGen == 0) return false;
+   if (!unur_distr_is_discr(unur_get_distr(fGen))) return false;
+   return SampleStreams(fGen, n, 1, x, seed, nstreams, [](UNUR_GEN * gen, int * v) { *v = unur_sample_discr(gen); });
+}
+
 void TUnuran::SetSeed(unsigned int seed) {
    return fRng->SetSeed(seed);
 }
@@ -45,6 +45,13 @@ Upon a second allocation, the vector *v* ceases to be a proxy
 v.emplace_back(0.);
 ~~~
 now the vector *v* owns its memory as a regular vector.
+
+The RAdoptAllocator can also be given an inline buffer, e.g. the storage of the RVec
+owning the vector: the allocations of up to the capacity of the buffer then return it as
+long as it is not in use, instead of allocating memory on the heap. Whether it is in use
+is a flag stored with the buffer, shared by the copies the container makes of its
+allocator. The copies of the allocator made for other containers
+(select_on_container_copy_construction()) do not use the buffer.
 **/
 
 template <typename T>
@@ -72,11 +79,22 @@ private:
    using StdAllocTraits_t = std::allocator_traits<StdAlloc_t>;
    pointer fInitialAddress = nullptr;
    EAllocType fAllocType = EAllocType::kOwning;
+   pointer fInlineBuffer = nullptr;  ///< Memory for the allocations of up to fInlineCapacity elements, if any
+   std::size_t fInlineCapacity = 0;  ///< Number of elements the inline buffer can hold
+   bool *fInlineInUse = nullptr;     ///< Whether the inline buffer holds the elements of the container
    StdAlloc_t fStdAllocator;
 
 public:
    /// This is the constructor which allows the allocator to adopt a certain memory region.
    RAdoptAllocator(pointer p) : fInitialAddress(p), fAllocType(EAllocType::kAdoptingNoAllocYet){};
+   /// This constructor copies the state of other, but places the allocations of up to capacity elements in buffer
+   /// when *inUse is false.
+   RAdoptAllocator(const RAdoptAllocator &other, pointer buffer, std::size_t capacity, bool *inUse)
+      : fInitialAddress(other.fInitialAddress), fAllocType(other.fAllocType), fInlineBuffer(buffer),
+        fInlineCapacity(buffer ? capacity : 0), fInlineInUse(buffer ? inUse : nullptr),
+        fStdAllocator(other.fStdAllocator)
+   {
+   }
    RAdoptAllocator() = default;
    RAdoptAllocator(const RAdoptAllocator &) = default;
    RAdoptAllocator(RAdoptAllocator &&) = default;
@@ -84,6 +102,22 @@ public:
    RAdoptAllocator &operator=(RAdoptAllocator &&) = default;
    RAdoptAllocator(const RAdoptAllocator<bool> &);
 
+   /// The copy for a copy of the container, which must not share the inline buffer
+   RAdoptAllocator select_on_container_copy_construction() const
+   {
+      RAdoptAllocator copy(*this);
+      copy.fInlineBuffer = nullptr;
+      copy.fInlineCapacity = 0;
+      copy.fInlineInUse = nullptr;
+      return copy;
+   }
+
+   /// Whether the elements of the container are stored in the inline buffer
+   bool UsesInlineBuffer() const { return fInlineInUse && *fInlineInUse; }
+
+   /// Whether the elements of the container are in the adopted memory, which is not owned by the container
+   bool IsAdopting() const { return EAllocType::kAdopting == fAllocType; }
+
    /// Construct an object at a certain memory address
    /// \tparam U The type of the memory address at which the object needs to be constructed
    /// \tparam Args The arguments' types necessary for the construction of the object
@@ -101,7 +135,8 @@ public:
 
    /// \brief Allocate some memory
    /// If an address has been adopted, at the first call, that address is returned.
-   /// Subsequent calls will make "decay" the allocator to a regular stl allocator.
+   /// Subsequent calls will make "decay" the allocator to a regular stl allocator, which
+   /// returns the inline buffer, if any, when it is large enough and not in use.
    pointer allocate(std::size_t n)
    {
       if (n > std::size_t(-1) / sizeof(T))
@@ -111,12 +146,20 @@ public:
          return fInitialAddress;
       }
       fAllocType = EAllocType::kOwning;
+      if (fInlineBuffer && n <= fInlineCapacity && !*fInlineInUse) {
+         *fInlineInUse = true;
+         return fInlineBuffer;
+      }
       return StdAllocTraits_t::allocate(fStdAllocator, n);
    }
 
-   /// \brief Dellocate some memory if that had not been adopted.
+   /// \brief Dellocate some memory if that had not been adopted nor is the inline buffer.
    void deallocate(pointer p, std::size_t n)
    {
+      if (fInlineBuffer && p == fInlineBuffer) {
+         *fInlineInUse = false;
+         return;
+      }
       if (p != fInitialAddress)
          StdAllocTraits_t::deallocate(fStdAllocator, p, n);
    }
@@ -129,13 +172,15 @@ public:
       }
    }
 
-   bool operator==(const RAdoptAllocator<T> &other)
+   /// Allocators are equal if each can deallocate the memory of the other, which is never the case
+   /// of the memory in an inline buffer.
+   bool operator==(const RAdoptAllocator<T> &other) const
    {
       return fInitialAddress == other.fInitialAddress && fAllocType == other.fAllocType &&
-             fStdAllocator == other.fStdAllocator;
+             fStdAllocator == other.fStdAllocator && !UsesInlineBuffer() && !other.UsesInlineBuffer();
    }
 
-   bool operator!=(const RAdoptAllocator<T> &other) { return !(*this == other); }
+   bool operator!=(const RAdoptAllocator<T> &other) const { return !(*this == other); }
 
    size_type max_size() const { return fStdAllocator.max_size(); };
 };
@@ -119,10 +119,143 @@ void EmplaceBack(std::vector<bool> &v, Args &&... args)
    v.push_back(std::forward<Args>(args)...);
 }
 
+/// Uninitialized storage for N objects of type T, the inline buffer of a RVec, and whether it is in use
+template <typename T, std::size_t N>
+struct RVecInlineStorage {
+   alignas(T) char fBuffer[N > 0 ? N * sizeof(T) : 1];
+   bool fInUse = false;
+   T *Get() { return N > 0 ? reinterpret_cast<T *>(fBuffer) : nullptr; }
+};
+
+// The allocator of the storage of a RVec, which places up to N elements in its inline buffer.
+// The std::vector<bool> storage of RVec<bool> has a standard allocator and no inline buffer.
+template <typename T, std::size_t N>
+ROOT::Detail::VecOps::RAdoptAllocator<T>
+MakeInlineAllocator(const ROOT::Detail::VecOps::RAdoptAllocator<T> &model, RVecInlineStorage<T, N> &storage)
+{
+   return ROOT::Detail::VecOps::RAdoptAllocator<T>(model, storage.Get(), N, &storage.fInUse);
+}
+
+template <std::size_t N>
+std::allocator<bool> MakeInlineAllocator(const std::allocator<bool> &model, RVecInlineStorage<bool, N> &)
+{
+   return model;
+}
+
+template <typename T>
+bool UsesInlineBuffer(const ROOT::Detail::VecOps::RAdoptAllocator<T> &alloc)
+{
+   return alloc.UsesInlineBuffer();
+}
+
+inline bool UsesInlineBuffer(const std::allocator<bool> &)
+{
+   return false;
+}
+
+template <typename T>
+struct IsRVec : std::false_type {};
+
+template <typename T>
+struct IsRVec<ROOT::VecOps::RVec<T>> : std::true_type {};
+
+// Enabled if the results of an operation, of type R, can be stored in its temporary operand of type RVec<T> instead
+// of a new RVec, which saves an allocation per operation in chained expressions such as sqrt(x * x + y * y).
+template <typename T>
+using EnableIfNotRVec = typename std::enable_if<!IsRVec<T>::value>::type;
+
+template <typename R, typename T>
+using EnableIfReusable = typename std::enable_if<std::is_same<R, T>::value && !std::is_same<T, bool>::value>::type;
+
+// Whether the elements of the temporary v can be overwritten by the results of an operation: not if v adopted
+// memory, which belongs to the caller.
+template <typename T>
+bool CanOverwrite(const ROOT::VecOps::RVec<T> &v)
+{
+   return !v.AsVector().get_allocator().IsAdopting();
+}
+
+// The RVecs of numbers other than bool are reduced and filtered by the loops below, written on raw pointers and
+// without branches so that the compiler can vectorize them. The other RVecs go through the generic algorithms.
+template <typename T>
+using IsVectorizable = std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>;
+
+// Number of independent partial sums of SumImpl and DotImpl. A single accumulator makes every addition wait for
+// the previous one, and floating point additions may not be reordered by the compiler: with several partial sums
+// the additions of consecutive elements are independent and fill the lanes of a vector register.
+constexpr std::size_t kNPartialSums = 8;
+
+template <typename R, typename T>
+R SumImpl(const T *x, std::size_t n)
+{
+   R partial[kNPartialSums] = {};
+   std::size_t i = 0;
+   for (; i + kNPartialSums <= n; i += kNPartialSums)
+      for (std::size_t j = 0; j < kNPartialSums; ++j)
+         partial[j] += x[i + j];
+   R sum(0);
+   for (std::size_t j = 0; j < kNPartialSums; ++j)
+      sum += partial[j];
+   for (; i < n; ++i)
+      sum += x[i];
+   return sum;
+}
+
+template <typename R, typename T0, typename T1>
+R DotImpl(const T0 *x, const T1 *y, std::size_t n)
+{
+   R partial[kNPartialSums] = {};
+   std::size_t i = 0;
+   for (; i + kNPartialSums <= n; i += kNPartialSums)
+      for (std::size_t j = 0; j < kNPartialSums; ++j)
+         partial[j] += x[i + j] * y[i + j];
+   R sum(0);
+   for (std::size_t j = 0; j < kNPartialSums; ++j)
+      sum += partial[j];
+   for (; i < n; ++i)
+      sum += x[i] * y[i];
+   return sum;
+}
+
+// Copy to out the elements of in whose condition is non-zero and return their number. Every element is written
+// but only the selected ones advance the output position, so that the loop has no branch to mispredict whatever
+// the pattern of the conditions. out must have room for n elements.
+template <typename T, typename M>
+std::size_t CompactImpl(const T *in, const M &conds, std::size_t n, T *out)
+{
+   std::size_t k = 0;
+   for (std::size_t i = 0; i < n; ++i) {
+      out[k] = in[i];
+      k += (conds[i] != 0);
+   }
+   return k;
+}
+
+// The conditions of a filter, as a raw pointer unless they are packed bits.
+template <typename V>
+const V *GetConditions(const ROOT::VecOps::RVec<V> &conds)
+{
+   return conds.data();
+}
+
+inline const ROOT::VecOps::RVec<bool> &GetConditions(const ROOT::VecOps::RVec<bool> &conds)
+{
+   return conds;
+}
+
 } // End of VecOps NS
 } // End of Internal NS
 
 namespace VecOps {
+
+/// The number of elements a RVec<T> stores inline, without allocating memory on the heap: as many as fit in 64
+/// bytes. It can be changed by specializing the trait for T before any use of RVec<T>; zero disables the inline
+/// storage.
+template <typename T>
+struct RVecInlineCapacity {
+   static constexpr std::size_t value = 64 / sizeof(T);
+};
+
 // clang-format off
 /**
 \class ROOT::VecOps::RVec
@@ -142,6 +275,7 @@ the manipulation and analysis of the data in the RVec.
 ## Table of Contents
 - [Example](#example)
 - [Owning and adopting memory](#owningandadoptingmemory)
+- [Inline storage of short collections](#inlinestorage)
 - [Sorting and manipulation of indices](#sorting)
 - [Usage in combination with RDataFrame](#usagetdataframe)
 - [Reference for the RVec class](#RVecdoxyref)
@@ -190,6 +324,21 @@ If any method which implies a re-allocation is called, e.g. *emplace_back* or *r
 memory is released and new one is allocated. The previous content is copied in the new memory and
 preserved.
 
+## <a name="inlinestorage"></a>Inline storage of short collections
+Each RVec holds an inline buffer of `RVecInlineCapacity<T>::value` elements, as many as fit in 64 bytes,
+e.g. 8 doubles or 16 floats. As long as an owning RVec has no more elements it stores them in this
+buffer and no memory is allocated on the heap, which makes the short collections typically created for
+each event, e.g. the selected jets of a Define in RDataFrame, much cheaper:
+~~~{.cpp}
+RVec<float> pts {10.f, 20.f, 30.f}; // no heap allocation
+pts.resize(32);                     // now the elements are on the heap
+~~~
+Moving a RVec which uses its inline buffer copies its elements, so that a RVec never refers to the
+buffer of another one. The capacity can be changed for a given type by specializing the trait before
+any use of the RVec, e.g. `template <> struct ROOT::VecOps::RVecInlineCapacity<MyObject> { static constexpr std::size_t value = 4; };`,
+zero disabling the inline storage. The vector returned by AsVector() must not be moved or swapped from
+or into, as its allocator refers to the buffer of the RVec.
+
 ## <a name="#sorting"></a>Sorting and manipulation of indices
 
 ### Sorting
@@ -296,28 +445,108 @@ public:
    using const_reverse_iterator = typename Impl_t::const_reverse_iterator;
 
 private:
+   static constexpr std::size_t kInlineCapacity = IsVecBool ? 0 : RVecInlineCapacity<T>::value;
+   using Alloc_t = typename Impl_t::allocator_type;
+
+   /// Storage of the elements as long as they fit, declared first to outlive fData
+   ROOT::Internal::VecOps::RVecInlineStorage<T, kInlineCapacity> fInline; //!
    Impl_t fData;
 
+   /// The allocator of fData, with the state of model but using the inline storage of this RVec
+   Alloc_t MakeAllocator(const Alloc_t &model = Alloc_t())
+   {
+      return ROOT::Internal::VecOps::MakeInlineAllocator(model, fInline);
+   }
+
+   /// Make the empty fData use the whole inline storage, so that it is left only beyond kInlineCapacity elements
+   void ReserveInline()
+   {
+      if (kInlineCapacity > 0)
+         fData.reserve(kInlineCapacity);
+   }
+
+   /// Move the content of v into the empty fData
+   void MoveFrom(RVec<T> &v)
+   {
+      if (ROOT::Internal::VecOps::UsesInlineBuffer(v.fData.get_allocator())) {
+         // the elements are moved from the inline storage of v to the one of this RVec
+         ReserveInline();
+         fData.insert(fData.end(), std::make_move_iterator(v.fData.begin()), std::make_move_iterator(v.fData.end()));
+         v.fData.clear();
+      } else {
+         // the allocators are equal and the memory of v, owned or adopted, is taken over
+         fData = Impl_t(std::move(v.fData), MakeAllocator(v.fData.get_allocator()));
+      }
+   }
+
+   /// The elements whose condition is true, selected without branches for numbers
+   template <typename V>
+   RVec FilterByConditions(const RVec<V> &conds, std::true_type) const
+   {
+      RVec<T> ret(conds.size());
+      const auto n = ROOT::Internal::VecOps::CompactImpl(fData.data(), ROOT::Internal::VecOps::GetConditions(conds),
+                                                         conds.size(), ret.data());
+      ret.resize(n);
+      return ret;
+   }
+
+   /// The elements whose condition is true
+   template <typename V>
+   RVec FilterByConditions(const RVec<V> &conds, std::false_type) const
+   {
+      const size_type n = conds.size();
+      RVec<T> ret;
+      ret.reserve(n);
+      for (size_type i = 0; i < n; ++i)
+         if (conds[i])
+            ret.emplace_back(fData[i]);
+      return ret;
+   }
+
 public:
    // constructors
-   RVec() {}
+   RVec() : fData(MakeAllocator()) { ReserveInline(); }
 
-   explicit RVec(size_type count) : fData(count) {}
+   explicit RVec(size_type count) : fData(MakeAllocator())
+   {
+      ReserveInline();
+      fData.resize(count);
+   }
 
-   RVec(size_type count, const T &value) : fData(count, value) {}
+   RVec(size_type count, const T &value) : fData(MakeAllocator())
+   {
+      ReserveInline();
+      fData.assign(count, value);
+   }
 
-   RVec(const RVec<T> &v) : fData(v.fData) {}
+   RVec(const RVec<T> &v) : fData(MakeAllocator())
+   {
+      ReserveInline();
+      fData.assign(v.fData.begin(), v.fData.end());
+   }
 
-   RVec(RVec<T> &&v) : fData(std::move(v.fData)) {}
+   RVec(RVec<T> &&v) : fData(MakeAllocator()) { MoveFrom(v); }
 
-   RVec(const std::vector<T> &v) : fData(v.cbegin(), v.cend()) {}
+   RVec(const std::vector<T> &v) : fData(MakeAllocator())
+   {
+      ReserveInline();
+      fData.assign(v.cbegin(), v.cend());
+   }
 
-   RVec(pointer p, size_type n) : fData(n, T(), ROOT::Detail::VecOps::RAdoptAllocator<T>(p)) {}
+   RVec(pointer p, size_type n) : fData(n, T(), MakeAllocator(ROOT::Detail::VecOps::RAdoptAllocator<T>(p))) {}
 
    template <class InputIt>
-   RVec(InputIt first, InputIt last) : fData(first, last) {}
+   RVec(InputIt first, InputIt last) : fData(MakeAllocator())
+   {
+      ReserveInline();
+      fData.assign(first, last);
+   }
 
-   RVec(std::initializer_list<T> init) : fData(init) {}
+   RVec(std::initializer_list<T> init) : fData(MakeAllocator())
+   {
+      ReserveInline();
+      fData.assign(init);
+   }
 
    // assignment
    RVec<T> &operator=(const RVec<T> &v)
@@ -328,7 +557,11 @@ public:
 
    RVec<T> &operator=(RVec<T> &&v)
    {
-      std::swap(fData, v.fData);
+      if (this != &v) {
+         // release the inline storage and any adopted memory before moving the content of v
+         fData = Impl_t(MakeAllocator());
+         MoveFrom(v);
+      }
       return *this;
    }
 
@@ -368,12 +601,7 @@ public:
       if (n != size())
          throw std::runtime_error("Cannot index RVec with condition vector of different size");
 
-      RVec<T> ret;
-      ret.reserve(n);
-      for (size_type i = 0; i < n; ++i)
-         if (conds[i])
-            ret.emplace_back(fData[i]);
-      return ret;
+      return FilterByConditions(conds, ROOT::Internal::VecOps::IsVectorizable<T>());
    }
 
    reference front() { return fData.front(); }
@@ -401,7 +629,12 @@ public:
    size_type max_size() const noexcept { return fData.size(); }
    void reserve(size_type new_cap) { fData.reserve(new_cap); }
    size_type capacity() const noexcept { return fData.capacity(); }
-   void shrink_to_fit() { fData.shrink_to_fit(); };
+   void shrink_to_fit()
+   {
+      // the elements in the inline storage take no memory on the heap
+      if (!ROOT::Internal::VecOps::UsesInlineBuffer(fData.get_allocator()))
+         fData.shrink_to_fit();
+   };
    // modifiers
    void clear() noexcept { fData.clear(); }
    iterator erase(iterator pos) { return fData.erase(pos); }
@@ -424,7 +657,13 @@ public:
    void pop_back() { fData.pop_back(); }
    void resize(size_type count) { fData.resize(count); }
    void resize(size_type count, const value_type &value) { fData.resize(count, value); }
-   void swap(RVec<T> &other) { std::swap(fData, other.fData); }
+   void swap(RVec<T> &other)
+   {
+      // the storages cannot be swapped, as their allocators refer to the inline storage of their RVec
+      RVec<T> tmp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(tmp);
+   }
 };
 
 ///@name RVec Unary Arithmetic Operators
@@ -438,6 +677,17 @@ RVec<T> operator OP(const RVec<T> &v)                                          \
    for (auto &x : ret)                                                         \
       x = OP x;                                                                \
 return ret;                                                                    \
+}                                                                              \
+                                                                               \
+template <typename T,                                                          \
+          typename = ROOT::Internal::VecOps::EnableIfReusable<T, T>>           \
+RVec<T> operator OP(RVec<T> &&v)                                               \
+{                                                                              \
+   if (!ROOT::Internal::VecOps::CanOverwrite(v))                               \
+      return OP static_cast<const RVec<T> &>(v);                               \
+   for (auto &x : v)                                                           \
+      x = OP x;                                                                \
+   return std::move(v);                                                        \
 }                                                                              \
 
 RVEC_UNARY_OPERATOR(+)
@@ -486,6 +736,70 @@ auto operator OP(const RVec<T0> &v0, const RVec<T1> &v1)                       \
    std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), op);          \
    return ret;                                                                 \
 }                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename = ROOT::Internal::VecOps::EnableIfNotRVec<T1>,              \
+          typename = ROOT::Internal::VecOps::EnableIfReusable<                 \
+             decltype(std::declval<T0>() OP std::declval<T1>()), T0>>          \
+RVec<T0> operator OP(RVec<T0> &&v, const T1 &y)                                \
+{                                                                              \
+   if (!ROOT::Internal::VecOps::CanOverwrite(v))                               \
+      return static_cast<const RVec<T0> &>(v) OP y;                            \
+   auto op = [y](const T0 &x) { return x OP y; };                              \
+   std::transform(v.begin(), v.end(), v.begin(), op);                          \
+   return std::move(v);                                                        \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename = ROOT::Internal::VecOps::EnableIfNotRVec<T0>,              \
+          typename = ROOT::Internal::VecOps::EnableIfReusable<                 \
+             decltype(std::declval<T0>() OP std::declval<T1>()), T1>>          \
+RVec<T1> operator OP(const T0 &x, RVec<T1> &&v)                                \
+{                                                                              \
+   if (!ROOT::Internal::VecOps::CanOverwrite(v))                               \
+      return x OP static_cast<const RVec<T1> &>(v);                            \
+   auto op = [x](const T1 &y) { return x OP y; };                              \
+   std::transform(v.begin(), v.end(), v.begin(), op);                          \
+   return std::move(v);                                                        \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename = ROOT::Internal::VecOps::EnableIfReusable<                 \
+             decltype(std::declval<T0>() OP std::declval<T1>()), T0>>          \
+RVec<T0> operator OP(RVec<T0> &&v0, const RVec<T1> &v1)                        \
+{                                                                              \
+   if (!ROOT::Internal::VecOps::CanOverwrite(v0))                              \
+      return static_cast<const RVec<T0> &>(v0) OP v1;                          \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+                                                                               \
+   auto op = [](const T0 &x, const T1 &y) { return x OP y; };                  \
+   std::transform(v0.begin(), v0.end(), v1.begin(), v0.begin(), op);           \
+   return std::move(v0);                                                       \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename = ROOT::Internal::VecOps::EnableIfReusable<                 \
+             decltype(std::declval<T0>() OP std::declval<T1>()), T1>>          \
+RVec<T1> operator OP(const RVec<T0> &v0, RVec<T1> &&v1)                        \
+{                                                                              \
+   if (!ROOT::Internal::VecOps::CanOverwrite(v1))                              \
+      return v0 OP static_cast<const RVec<T1> &>(v1);                          \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+                                                                               \
+   auto op = [](const T0 &x, const T1 &y) { return x OP y; };                  \
+   std::transform(v0.begin(), v0.end(), v1.begin(), v1.begin(), op);           \
+   return std::move(v1);                                                       \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename = ROOT::Internal::VecOps::EnableIfReusable<                 \
+             decltype(std::declval<T0>() OP std::declval<T1>()), T0>>          \
+RVec<T0> operator OP(RVec<T0> &&v0, RVec<T1> &&v1)                             \
+{                                                                              \
+   return std::move(v0) OP static_cast<const RVec<T1> &>(v1);                  \
+}                                                                              \
 
 RVEC_BINARY_OPERATOR(+)
 RVEC_BINARY_OPERATOR(-)
@@ -570,6 +884,65 @@ auto operator OP(const RVec<T0> &v0, const RVec<T1> &v1)                       \
    std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), op);          \
    return ret;                                                                 \
 }                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename = ROOT::Internal::VecOps::EnableIfNotRVec<T1>,              \
+          typename = ROOT::Internal::VecOps::EnableIfReusable<int, T0>>        \
+RVec<T0> operator OP(RVec<T0> &&v, const T1 &y)                                \
+{                                                                              \
+   if (!ROOT::Internal::VecOps::CanOverwrite(v))                               \
+      return static_cast<const RVec<T0> &>(v) OP y;                            \
+   auto op = [y](const T0 &x) -> int { return x OP y; };                       \
+   std::transform(v.begin(), v.end(), v.begin(), op);                          \
+   return std::move(v);                                                        \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename = ROOT::Internal::VecOps::EnableIfNotRVec<T0>,              \
+          typename = ROOT::Internal::VecOps::EnableIfReusable<int, T1>>        \
+RVec<T1> operator OP(const T0 &x, RVec<T1> &&v)                                \
+{                                                                              \
+   if (!ROOT::Internal::VecOps::CanOverwrite(v))                               \
+      return x OP static_cast<const RVec<T1> &>(v);                            \
+   auto op = [x](const T1 &y) -> int { return x OP y; };                       \
+   std::transform(v.begin(), v.end(), v.begin(), op);                          \
+   return std::move(v);                                                        \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename = ROOT::Internal::VecOps::EnableIfReusable<int, T0>>        \
+RVec<T0> operator OP(RVec<T0> &&v0, const RVec<T1> &v1)                        \
+{                                                                              \
+   if (!ROOT::Internal::VecOps::CanOverwrite(v0))                              \
+      return static_cast<const RVec<T0> &>(v0) OP v1;                          \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+                                                                               \
+   auto op = [](const T0 &x, const T1 &y) -> int { return x OP y; };           \
+   std::transform(v0.begin(), v0.end(), v1.begin(), v0.begin(), op);           \
+   return std::move(v0);                                                       \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename = ROOT::Internal::VecOps::EnableIfReusable<int, T1>>        \
+RVec<T1> operator OP(const RVec<T0> &v0, RVec<T1> &&v1)                        \
+{                                                                              \
+   if (!ROOT::Internal::VecOps::CanOverwrite(v1))                              \
+      return v0 OP static_cast<const RVec<T1> &>(v1);                          \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+                                                                               \
+   auto op = [](const T0 &x, const T1 &y) -> int { return x OP y; };           \
+   std::transform(v0.begin(), v0.end(), v1.begin(), v1.begin(), op);           \
+   return std::move(v1);                                                       \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          typename = ROOT::Internal::VecOps::EnableIfReusable<int, T0>>        \
+RVec<T0> operator OP(RVec<T0> &&v0, RVec<T1> &&v1)                             \
+{                                                                              \
+   return std::move(v0) OP static_cast<const RVec<T1> &>(v1);                  \
+}                                                                              \
 
 RVEC_LOGICAL_OPERATOR(<)
 RVEC_LOGICAL_OPERATOR(>)
@@ -610,6 +983,18 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
       auto f = [](const T &x) { return FUNC(x); };                             \
       std::transform(v.begin(), v.end(), ret.begin(), f);                      \
       return ret;                                                              \
+   }                                                                           \
+                                                                               \
+   template <typename T,                                                       \
+             typename = ROOT::Internal::VecOps::EnableIfReusable<              \
+                PromoteType<T>, T>>                                            \
+   RVec<T> NAME(RVec<T> &&v)                                                   \
+   {                                                                           \
+      if (!ROOT::Internal::VecOps::CanOverwrite(v))                            \
+         return NAME(static_cast<const RVec<T> &>(v));                         \
+      for (auto &x : v)                                                        \
+         x = FUNC(x);                                                          \
+      return std::move(v);                                                     \
    }
 
 #define RVEC_BINARY_FUNCTION(NAME, FUNC)                                       \
@@ -631,6 +1016,19 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
       return ret;                                                              \
    }                                                                           \
                                                                                \
+   template <typename T0, typename T1,                                         \
+             typename = ROOT::Internal::VecOps::EnableIfNotRVec<T1>,           \
+             typename = ROOT::Internal::VecOps::EnableIfReusable<              \
+                PromoteTypes<T0, T1>, T0>>                                     \
+   RVec<T0> NAME(RVec<T0> &&v, const T1 &y)                                    \
+   {                                                                           \
+      if (!ROOT::Internal::VecOps::CanOverwrite(v))                            \
+         return NAME(static_cast<const RVec<T0> &>(v), y);                     \
+      auto f = [y](const T0 &x) { return FUNC(x, y); };                        \
+      std::transform(v.begin(), v.end(), v.begin(), f);                        \
+      return std::move(v);                                                     \
+   }                                                                           \
+                                                                               \
    template <typename T0, typename T1>                                         \
    RVec<PromoteTypes<T0, T1>> NAME(const RVec<T0> &v0, const RVec<T1> &v1)     \
    {                                                                           \
@@ -725,8 +1123,38 @@ RVEC_VDT_UNARY_FUNCTION(fast_atan)
 
 ///@}
 
+/// \cond
+template <typename T, typename V>
+auto DotDispatch(const RVec<T> &v0, const RVec<V> &v1, std::true_type) -> decltype(v0[0] * v1[0])
+{
+   return ROOT::Internal::VecOps::DotImpl<decltype(v0[0] * v1[0])>(v0.data(), v1.data(), v0.size());
+}
+
+template <typename T, typename V>
+auto DotDispatch(const RVec<T> &v0, const RVec<V> &v1, std::false_type) -> decltype(v0[0] * v1[0])
+{
+   return std::inner_product(v0.begin(), v0.end(), v1.begin(), decltype(v0[0] * v1[0])(0));
+}
+
+template <typename T>
+T SumDispatch(const RVec<T> &v, std::true_type)
+{
+   return ROOT::Internal::VecOps::SumImpl<T>(v.data(), v.size());
+}
+
+template <typename T>
+T SumDispatch(const RVec<T> &v, std::false_type)
+{
+   return std::accumulate(v.begin(), v.end(), T(0));
+}
+/// \endcond
+
 /// Inner product
 ///
+/// For numbers, the products are accumulated in several partial sums which are
+/// added at the end: the result may differ in the last digits from the one of
+/// a sequential accumulation.
+///
 /// Example code, at the ROOT prompt:
 /// ~~~{.cpp}
 /// using namespace ROOT::VecOps;
@@ -741,11 +1169,16 @@ auto Dot(const RVec<T> &v0, const RVec<V> &v1) -> decltype(v0[0] * v1[0])
 {
    if (v0.size() != v1.size())
       throw std::runtime_error("Cannot compute inner product of vectors of different sizes");
-   return std::inner_product(v0.begin(), v0.end(), v1.begin(), decltype(v0[0] * v1[0])(0));
+   return DotDispatch(v0, v1, std::integral_constant<bool, ROOT::Internal::VecOps::IsVectorizable<T>::value &&
+                                                             ROOT::Internal::VecOps::IsVectorizable<V>::value>());
 }
 
 /// Sum elements of an RVec
 ///
+/// For numbers, the elements are accumulated in several partial sums which are
+/// added at the end: the result may differ in the last digits from the one of
+/// a sequential accumulation.
+///
 /// Example code, at the ROOT prompt:
 /// ~~~{.cpp}
 /// using namespace ROOT::VecOps;
@@ -757,7 +1190,7 @@ auto Dot(const RVec<T> &v0, const RVec<V> &v1) -> decltype(v0[0] * v1[0])
 template <typename T>
 T Sum(const RVec<T> &v)
 {
-   return std::accumulate(v.begin(), v.end(), T(0));
+   return SumDispatch(v, ROOT::Internal::VecOps::IsVectorizable<T>());
 }
 
 /// Get the mean of the elements of an RVec
@@ -1252,14 +1685,15 @@ template <typename T>
 RVec<typename RVec<T>::size_type> Nonzero(const RVec<T> &v)
 {
    using size_type = typename RVec<T>::size_type;
-   RVec<size_type> r;
    const auto size = v.size();
-   r.reserve(size);
-   for(size_type i=0; i<size; i++) {
-      if(v[i] != 0) {
-         r.emplace_back(i);
-      }
+   RVec<size_type> r(size);
+   // branchless selection, see ROOT::Internal::VecOps::CompactImpl
+   size_type n = 0;
+   for (size_type i = 0; i < size; i++) {
+      r[n] = i;
+      n += (v[i] != 0);
    }
+   r.resize(n);
    return r;
 }
 
@@ -1298,6 +1732,29 @@ RVec<T> Intersect(const RVec<T>& v1, const RVec<T>& v2, bool v2_is_sorted = fals
    return r;
 }
 
+/// \cond
+template <typename T, typename F>
+RVec<T> WhereDispatch(typename RVec<T>::size_type size, F &select, std::true_type)
+{
+   // plain assignments to a preallocated RVec, vectorized to blends
+   RVec<T> r(size);
+   for (typename RVec<T>::size_type i = 0; i < size; i++)
+      r[i] = select(i);
+   return r;
+}
+
+template <typename T, typename F>
+RVec<T> WhereDispatch(typename RVec<T>::size_type size, F &select, std::false_type)
+{
+   // T may not be default constructible
+   RVec<T> r;
+   r.reserve(size);
+   for (typename RVec<T>::size_type i = 0; i < size; i++)
+      r.emplace_back(select(i));
+   return r;
+}
+/// \endcond
+
 /// Return the elements of v1 if the condition c is true and v2 if the
 /// condition c is false.
 ///
@@ -1317,13 +1774,8 @@ template <typename T>
 RVec<T> Where(const RVec<int>& c, const RVec<T>& v1, const RVec<T>& v2)
 {
    using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1[i] : v2[i]);
-   }
-   return r;
+   auto select = [&](size_type i) -> const T & { return c[i] != 0 ? v1[i] : v2[i]; };
+   return WhereDispatch<T>(c.size(), select, ROOT::Internal::VecOps::IsVectorizable<T>());
 }
 
 /// Return the elements of v1 if the condition c is true and sets the value v2
@@ -1345,13 +1797,8 @@ template <typename T>
 RVec<T> Where(const RVec<int>& c, const RVec<T>& v1, T v2)
 {
    using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1[i] : v2);
-   }
-   return r;
+   auto select = [&](size_type i) -> const T & { return c[i] != 0 ? v1[i] : v2; };
+   return WhereDispatch<T>(c.size(), select, ROOT::Internal::VecOps::IsVectorizable<T>());
 }
 
 /// Return the elements of v2 if the condition c is false and sets the value v1
@@ -1373,13 +1820,8 @@ template <typename T>
 RVec<T> Where(const RVec<int>& c, T v1, const RVec<T>& v2)
 {
    using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1 : v2[i]);
-   }
-   return r;
+   auto select = [&](size_type i) -> const T & { return c[i] != 0 ? v1 : v2[i]; };
+   return WhereDispatch<T>(c.size(), select, ROOT::Internal::VecOps::IsVectorizable<T>());
 }
 
 /// Return a vector with the value v2 if the condition c is false and sets the
@@ -1399,13 +1841,8 @@ template <typename T>
 RVec<T> Where(const RVec<int>& c, T v1, T v2)
 {
    using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1 : v2);
-   }
-   return r;
+   auto select = [&](size_type i) -> const T & { return c[i] != 0 ? v1 : v2; };
+   return WhereDispatch<T>(c.size(), select, ROOT::Internal::VecOps::IsVectorizable<T>());
 }
 
 /// Return the concatenation of two RVecs.
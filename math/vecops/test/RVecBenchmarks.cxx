@@ -0,0 +1,67 @@
+#include <ROOT/RVec.hxx>
+
+#include <benchmark/benchmark.h>
+
+using namespace ROOT::VecOps;
+
+static RVec<float> MakeVector(std::size_t n)
+{
+   RVec<float> v(n);
+   for (std::size_t i = 0; i < n; ++i)
+      v[i] = 0.5f * (i % 100) - 20.f;
+   return v;
+}
+
+static void BM_RVec_Arithmetic(benchmark::State &state)
+{
+   auto a = MakeVector(state.range(0));
+   auto b = MakeVector(state.range(0));
+   for (auto _ : state) {
+      auto c = a * b + 2.f * a;
+      benchmark::DoNotOptimize(c.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RVec_Arithmetic)->Range(8, 1 << 12);
+
+static void BM_RVec_Mask(benchmark::State &state)
+{
+   auto a = MakeVector(state.range(0));
+   for (auto _ : state) {
+      auto selected = a[a > 0.f && a < 10.f];
+      benchmark::DoNotOptimize(selected.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RVec_Mask)->Range(8, 1 << 12);
+
+static void BM_RVec_Sum(benchmark::State &state)
+{
+   auto a = MakeVector(state.range(0));
+   for (auto _ : state)
+      benchmark::DoNotOptimize(Sum(a));
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RVec_Sum)->Range(8, 1 << 12);
+
+static void BM_RVec_Math(benchmark::State &state)
+{
+   auto a = MakeVector(state.range(0));
+   for (auto _ : state) {
+      auto c = sqrt(abs(a)) + exp(-abs(a));
+      benchmark::DoNotOptimize(c.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RVec_Math)->Range(8, 1 << 12);
+
+static void BM_RVec_Sort(benchmark::State &state)
+{
+   auto a = MakeVector(state.range(0));
+   for (auto _ : state) {
+      auto sorted = Sort(a);
+      benchmark::DoNotOptimize(sorted.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RVec_Sort)->Range(8, 1 << 12);
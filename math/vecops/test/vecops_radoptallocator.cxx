@@ -98,3 +98,29 @@ TEST(RAdoptAllocator, Traits)
 
 }
 
+TEST(RAdoptAllocator, InlineBuffer)
+{
+   double buffer[4];
+   bool inUse = false;
+   RAdoptAllocator<double> alloc(RAdoptAllocator<double>(), buffer, 4, &inUse);
+   std::vector<double, RAdoptAllocator<double>> v(alloc);
+   v.reserve(4);
+   EXPECT_EQ(buffer, v.data());
+   EXPECT_TRUE(inUse);
+   EXPECT_FALSE(v.get_allocator() == RAdoptAllocator<double>());
+
+   // a copy of the vector does not share the buffer
+   v.assign({1., 2., 3.});
+   auto copy = v;
+   EXPECT_NE(buffer, copy.data());
+
+   v.resize(5);
+   EXPECT_NE(buffer, v.data());
+   EXPECT_FALSE(inUse);
+   EXPECT_EQ(3., v[2]);
+   v.resize(2);
+   v.shrink_to_fit();
+   EXPECT_EQ(buffer, v.data());
+   EXPECT_EQ(2., v[1]);
+}
+
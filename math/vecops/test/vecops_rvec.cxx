@@ -894,6 +894,96 @@ TEST(VecOps, Where)
    CheckEqual(v6, ref4);
 }
 
+// Where does not need default-constructible elements
+TEST(VecOps, WhereNonDefaultConstructible)
+{
+   struct Value {
+      Value(int v) : fV(v) {}
+      int fV;
+   };
+   RVec<int> c{1, 0, 1};
+   RVec<Value> v0{Value(1), Value(2), Value(3)};
+   RVec<Value> v1{Value(-1), Value(-2), Value(-3)};
+   auto check = [](const RVec<Value> &v, const RVec<int> &ref) {
+      ASSERT_EQ(v.size(), ref.size());
+      for (std::size_t i = 0; i < v.size(); ++i)
+         EXPECT_EQ(v[i].fV, ref[i]);
+   };
+   check(Where(c, v0, v1), RVec<int>{1, -2, 3});
+   check(Where(c, v0, Value(0)), RVec<int>{1, 0, 3});
+   check(Where(c, Value(0), v1), RVec<int>{0, -2, 0});
+   check(Where(c, Value(0), Value(5)), RVec<int>{0, 5, 0});
+}
+
+TEST(VecOps, ReuseTemporaries)
+{
+   const RVec<double> px{3., 6., 0., 1.};
+   const RVec<double> py{4., 8., 2., 0.};
+   CheckEqual(sqrt(px * px + py * py), RVec<double>{5., 10., 2., 1.});
+   CheckEqual(sqrt(px * px + py * py) > 1.5, RVec<int>{1, 1, 1, 0});
+   CheckEqual(2. * -(px - 1.) / 2., RVec<double>{-2., -5., 1., 0.});
+   CheckEqual(pow(px + 1., 2), RVec<double>{16., 49., 1., 4.});
+   CheckEqual((px > 0.) && (py > 0.), RVec<int>{1, 1, 0, 0});
+   CheckEqual(RVec<int>{1, 2, 3} * RVec<int>{2, 2, 2}, RVec<int>{2, 4, 6});
+   EXPECT_THROW(px + RVec<double>{1.}, std::runtime_error);
+
+   // the results are stored in the temporary operands, whose memory is taken over
+   RVec<double> big(100, 2.);
+   const auto bigData = big.data();
+   auto res = log(std::move(big) * 3. + px[0]);
+   EXPECT_EQ(res.data(), bigData);
+   EXPECT_DOUBLE_EQ(res[99], std::log(9.));
+
+   // but adopted memory, belonging to the caller, is left untouched
+   std::vector<double> buffer{1., 2., 3.};
+   RVec<double> adopting(buffer.data(), buffer.size());
+   CheckEqual(std::move(adopting) * 2., RVec<double>{2., 4., 6.});
+   CheckEqual(buffer, std::vector<double>{1., 2., 3.});
+}
+
+// Sizes around the number of partial sums of the reductions and masks of all patterns
+TEST(VecOps, LongReductionsAndMasks)
+{
+   for (int size = 0; size < 40; ++size) {
+      RVec<double> d(size);
+      RVec<int> i(size);
+      RVec<char> c(size);
+      for (int k = 0; k < size; ++k) {
+         d[k] = k + 0.5;
+         i[k] = k * (k % 3 - 1);
+         c[k] = k % 5;
+      }
+      double dsum = 0., ddot = 0.;
+      int isum = 0;
+      for (int k = 0; k < size; ++k) {
+         dsum += d[k];
+         ddot += d[k] * i[k];
+         isum += i[k];
+      }
+      EXPECT_DOUBLE_EQ(Sum(d), dsum);
+      EXPECT_DOUBLE_EQ(Dot(d, i), ddot);
+      EXPECT_EQ(Sum(i), isum);
+
+      RVec<int> ref;
+      RVec<std::string> strings, refStrings;
+      RVec<RVec<int>::size_type> refIdx;
+      for (int k = 0; k < size; ++k) {
+         strings.emplace_back(std::to_string(k));
+         if (c[k] != 0) {
+            ref.emplace_back(i[k]);
+            refStrings.emplace_back(strings[k]);
+            refIdx.emplace_back(k);
+         }
+      }
+      CheckEqual(i[c], ref);
+      CheckEqual(i[c != 0], ref);
+      CheckEqual(i[RVec<bool>(c.begin(), c.end())], ref);
+      CheckEqual(strings[c], refStrings);
+      CheckEqual(Nonzero(c), refIdx);
+      CheckEqual(Where(c != 0, i, RVec<int>(size, -1)), Map(i, c, [](int x, char m) { return m ? x : -1; }));
+   }
+}
+
 TEST(VecOps, AtWithFallback)
 {
    ROOT::VecOps::RVec<float> v({1.f, 2.f, 3.f});
@@ -1068,3 +1158,69 @@ TEST(VecOps, Construct)
    EXPECT_TRUE(fourVects[2] == ref2);
 }
 
+
+// Whether the elements of v are in its inline storage
+template <typename T>
+static bool IsInline(const RVec<T> &v)
+{
+   const auto data = reinterpret_cast<const char *>(v.data());
+   const auto begin = reinterpret_cast<const char *>(&v);
+   return data >= begin && data < begin + sizeof(v);
+}
+
+TEST(VecOps, InlineStorage)
+{
+   const auto capacity = RVecInlineCapacity<double>::value;
+   EXPECT_EQ(8u, capacity);
+
+   RVec<double> v{1., 2., 3.};
+   EXPECT_TRUE(IsInline(v));
+   v.resize(capacity);
+   EXPECT_TRUE(IsInline(v));
+   v.push_back(9.);
+   EXPECT_FALSE(IsInline(v));
+   EXPECT_EQ(1., v[0]);
+   EXPECT_EQ(9., v[capacity]);
+   v.resize(2);
+   v.shrink_to_fit();
+   EXPECT_TRUE(IsInline(v));
+   EXPECT_EQ(2., v[1]);
+
+   // moving copies the elements in the inline storage, and takes over any other memory
+   RVec<double> moved(std::move(v));
+   EXPECT_TRUE(IsInline(moved));
+   CheckEqual(moved, RVec<double>{1., 2.});
+   RVec<double> large(100, 3.);
+   const auto largeData = large.data();
+   RVec<double> movedLarge(std::move(large));
+   EXPECT_EQ(largeData, movedLarge.data());
+   movedLarge = std::move(moved);
+   EXPECT_TRUE(IsInline(movedLarge));
+   CheckEqual(movedLarge, RVec<double>{1., 2.});
+
+   RVec<double> a{1.}, b{2., 3.};
+   swap(a, b);
+   EXPECT_TRUE(IsInline(a) && IsInline(b));
+   CheckEqual(a, RVec<double>{2., 3.});
+   CheckEqual(b, RVec<double>{1.});
+
+   // adopted memory is kept by moves, and copies use the inline storage
+   std::vector<double> model{1., 2., 3.};
+   RVec<double> view(model.data(), model.size());
+   RVec<double> movedView(std::move(view));
+   EXPECT_EQ(model.data(), movedView.data());
+   RVec<double> copy(movedView);
+   EXPECT_TRUE(IsInline(copy));
+   std::swap(copy, movedView);
+   EXPECT_EQ(model.data(), copy.data());
+   EXPECT_TRUE(IsInline(movedView));
+
+   std::vector<RVec<int>> vectors;
+   for (int i = 0; i < 100; ++i)
+      vectors.emplace_back(i % 24, i);
+   for (int i = 0; i < 100; ++i) {
+      EXPECT_EQ(std::size_t(i % 24), vectors[i].size());
+      for (auto x : vectors[i])
+         EXPECT_EQ(i, x);
+   }
+}
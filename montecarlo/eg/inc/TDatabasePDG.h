@@ -15,20 +15,30 @@
 #include "TParticlePDG.h"
 #include "TParticleClassPDG.h"
 
+#include <atomic>
+
 class THashList;
 class TExMap;
 
+namespace ROOT {
+namespace Internal {
+class TPDGLookupTable;
+}
+}
+
 class TDatabasePDG: public TNamed {
 
 protected:
    THashList           *fParticleList;     // list of PDG particles
    TObjArray           *fListOfClasses;    // list of classes (leptons etc.)
    mutable TExMap      *fPdgMap;           //!hash-map from pdg-code to particle
+   mutable std::atomic<ROOT::Internal::TPDGLookupTable*> fLookupTable; //!immutable lookup table from pdg-code and name to particle
+   ROOT::Internal::TPDGLookupTable *fRetiredTables; //!lookup tables replaced since the last build
 
    // make copy-constructor and assigment protected since class cannot be copied
    TDatabasePDG(const TDatabasePDG& db)
      : TNamed(db), fParticleList(db.fParticleList),
-     fListOfClasses(db.fListOfClasses), fPdgMap(0) { }
+     fListOfClasses(db.fListOfClasses), fPdgMap(0), fLookupTable(nullptr), fRetiredTables(nullptr) { }
 
    TDatabasePDG& operator=(const TDatabasePDG& db)
    {if(this!=&db) {TNamed::operator=(db); fParticleList=db.fParticleList;
@@ -36,6 +46,9 @@ protected:
       return *this;}
 
    void BuildPdgMap() const;
+   ROOT::Internal::TPDGLookupTable *BuildLookupTable() const;
+   TParticlePDG *FindInPdgMap(Int_t pdgCode);
+   void          InvalidateLookupTable();
 
 public:
 
@@ -18,7 +18,9 @@
 #include "TDatabasePDG.h"
 #include "TDecayChannel.h"
 #include "TParticlePDG.h"
+#include "TPDGLookupTable.h"
 #include <stdlib.h>
+#include <mutex>
 
 
 /** \class TDatabasePDG
@@ -48,6 +50,13 @@ See TParticle    for the description of a dynamic particle particle.
 
 <br>The current default pdg_table file displays lifetime 0 for some unstable particles.</br>
 
+GetParticle() looks up the particles in an immutable table, built on its
+first call (ROOT::Internal::TPDGLookupTable): it can be called from several
+threads without locking once the table is read. AddParticle() and
+AddAntiParticle() can also be called from several threads; the table is then
+rebuilt on the next call of GetParticle(), while the old one stays valid for
+the threads still using it.
+
 */
 
 ClassImp(TDatabasePDG);
@@ -61,6 +70,16 @@ TDatabasePDG** GetInstancePtr()
    return &fgInstance;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Mutex serializing the modifications of the databases and the builds of
+/// their lookup tables.
+
+static std::recursive_mutex &GetPDGMutex()
+{
+   static std::recursive_mutex mutex;
+   return mutex;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create PDG database. Initialization of the DB has to be done via explicit
 /// call to ReadDataBasePDG (also done by GetParticle methods)
@@ -69,6 +88,8 @@ TDatabasePDG::TDatabasePDG(): TNamed("PDGDB","The PDG particle data base")
 {
    fParticleList  = 0;
    fPdgMap        = 0;
+   fLookupTable   = nullptr;
+   fRetiredTables = nullptr;
    fListOfClasses = 0;
    auto fgInstance = GetInstancePtr();
    if (*fgInstance != nullptr) {
@@ -89,6 +110,8 @@ TDatabasePDG::~TDatabasePDG()
       delete fParticleList;    // this deletes all objects in the list
       if (fPdgMap) delete fPdgMap;
    }
+   delete fLookupTable.load();
+   delete fRetiredTables;
                                 // classes do not own particles...
    if (fListOfClasses) {
       fListOfClasses->Delete();
@@ -130,6 +153,55 @@ void TDatabasePDG::BuildPdgMap() const
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Build the lookup table of GetParticle(), reading the default table of
+/// particles if none was read yet, and return it.
+
+ROOT::Internal::TPDGLookupTable *TDatabasePDG::BuildLookupTable() const
+{
+   std::lock_guard<std::recursive_mutex> lock(GetPDGMutex());
+   auto table = fLookupTable.load(std::memory_order_acquire);
+   if (table) return table;
+
+   if (fParticleList == 0) {
+      ((TDatabasePDG*)this)->ReadPDGTable();
+      // ReadPDGTable() looks up the antiparticles, which builds the table
+      table = fLookupTable.load(std::memory_order_acquire);
+      if (table) return table;
+   }
+   THashList empty;
+   table = new ROOT::Internal::TPDGLookupTable(fParticleList ? (TCollection*)fParticleList : &empty);
+   table->fRetired = fRetiredTables;
+   ((TDatabasePDG*)this)->fRetiredTables = nullptr;
+   fLookupTable.store(table, std::memory_order_release);
+   return table;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find the particle of the code in fPdgMap, which is kept up to date by
+/// AddParticle() without rebuilding the lookup table of GetParticle().
+
+TParticlePDG *TDatabasePDG::FindInPdgMap(Int_t pdgCode)
+{
+   if (fParticleList == 0)  ReadPDGTable();
+   if (fPdgMap       == 0)  BuildPdgMap();
+
+   return (TParticlePDG*) (Long_t)fPdgMap->GetValue((Long_t)pdgCode);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The lookup table is rebuilt on the next call of GetParticle(); the
+/// current one is kept for the threads which may still be using it.
+
+void TDatabasePDG::InvalidateLookupTable()
+{
+   auto table = fLookupTable.exchange(nullptr);
+   if (table) {
+      table->fRetired = fRetiredTables;
+      fRetiredTables = table;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///
 ///  Particle definition normal constructor. If the particle is set to be
@@ -148,7 +220,8 @@ TParticlePDG* TDatabasePDG::AddParticle(const char *name, const char *title,
                                         Int_t Anti,
                                         Int_t TrackingCode)
 {
-   TParticlePDG* old = GetParticle(PDGcode);
+   std::lock_guard<std::recursive_mutex> lock(GetPDGMutex());
+   TParticlePDG* old = FindInPdgMap(PDGcode);
 
    if (old) {
       printf(" *** TDatabasePDG::AddParticle: particle with PDGcode=%d already defined\n",PDGcode);
@@ -161,6 +234,7 @@ TParticlePDG* TDatabasePDG::AddParticle(const char *name, const char *title,
    fParticleList->Add(p);
    if (fPdgMap)
       fPdgMap->Add((Long_t)PDGcode, (Long_t)p);
+   InvalidateLookupTable();
 
    TParticleClassPDG* pclass = GetParticleClass(ParticleClass);
 
@@ -179,7 +253,8 @@ TParticlePDG* TDatabasePDG::AddParticle(const char *name, const char *title,
 
 TParticlePDG* TDatabasePDG::AddAntiParticle(const char* Name, Int_t PdgCode)
 {
-   TParticlePDG* old = GetParticle(PdgCode);
+   std::lock_guard<std::recursive_mutex> lock(GetPDGMutex());
+   TParticlePDG* old = FindInPdgMap(PdgCode);
 
    if (old) {
       printf(" *** TDatabasePDG::AddAntiParticle: can't redefine parameters\n");
@@ -187,7 +262,7 @@ TParticlePDG* TDatabasePDG::AddAntiParticle(const char* Name, Int_t PdgCode)
    }
 
    Int_t pdg_code  = abs(PdgCode);
-   TParticlePDG* p = GetParticle(pdg_code);
+   TParticlePDG* p = FindInPdgMap(pdg_code);
 
    if (!p) {
       printf(" *** TDatabasePDG::AddAntiParticle: particle with pdg code %d not known\n", pdg_code);
@@ -215,13 +290,10 @@ TParticlePDG* TDatabasePDG::AddAntiParticle(const char* Name, Int_t PdgCode)
 
 TParticlePDG *TDatabasePDG::GetParticle(const char *name) const
 {
-   if (fParticleList == 0)  ((TDatabasePDG*)this)->ReadPDGTable();
+   auto table = fLookupTable.load(std::memory_order_acquire);
+   if (!table) table = BuildLookupTable();
 
-   TParticlePDG *def = (TParticlePDG *)fParticleList->FindObject(name);
-//     if (!def) {
-//        Error("GetParticle","No match for %s exists!",name);
-//     }
-   return def;
+   return table->Find(name);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -231,10 +303,10 @@ TParticlePDG *TDatabasePDG::GetParticle(const char *name) const
 
 TParticlePDG *TDatabasePDG::GetParticle(Int_t PDGcode) const
 {
-   if (fParticleList == 0)  ((TDatabasePDG*)this)->ReadPDGTable();
-   if (fPdgMap       == 0)  BuildPdgMap();
+   auto table = fLookupTable.load(std::memory_order_acquire);
+   if (!table) table = BuildLookupTable();
 
-   return (TParticlePDG*) (Long_t)fPdgMap->GetValue((Long_t)PDGcode);
+   return table->Find(PDGcode);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,137 @@
+// @(#)root/eg:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class ROOT::Internal::TPDGLookupTable
+    \ingroup eg
+
+Immutable lookup table of the particles of TDatabasePDG.
+
+The codes of absolute value below kDenseMax are found with one access to a
+dense array of indices (48 kB), the other ones (excited states,
+nuclei, ...) with one access to a perfect hash: an open table of twice
+their number of slots, indexed by a multiplicative hash whose multiplier is
+chosen so that no two codes share a slot. The names are found with an
+open-addressing hash table of TString::Hash. If several particles have the
+same code or name, the first one of the list is found, as with the TExMap
+and the THashList.
+
+The table is never modified once built, so that it can be read from any
+number of threads without locking.
+*/
+
+#include "TPDGLookupTable.h"
+
+#include "TCollection.h"
+#include "TParticlePDG.h"
+#include "TString.h"
+
+#include <cstring>
+
+namespace ROOT {
+namespace Internal {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the table of the TParticlePDG of the collection.
+
+TPDGLookupTable::TPDGLookupTable(const TCollection *particles)
+   : fDense(2 * kDenseMax, 0), fSparseMult(0), fSparseShift(0), fNameMask(0)
+{
+   TIter next(particles);
+   while (auto p = (TParticlePDG *)next())
+      fParticles.push_back(p);
+   const Int_t n = fParticles.size();
+
+   // the dense codes, and the list of the other ones
+   std::vector<Int_t> sparse;
+   for (Int_t i = 0; i < n; ++i) {
+      Int_t code = fParticles[i]->PdgCode();
+      if (code > -kDenseMax && code < kDenseMax) {
+         if (!fDense[code + kDenseMax])
+            fDense[code + kDenseMax] = i + 1;
+      } else {
+         sparse.push_back(i);
+      }
+   }
+
+   // the perfect hash of the other codes: try multipliers until none collide,
+   // with a larger table if none is found
+   if (!sparse.empty()) {
+      Int_t bits = 4;
+      while ((1u << bits) < 2 * sparse.size())
+         ++bits;
+      UInt_t mult = 0x9e3779b1u;
+      Bool_t found = kFALSE;
+      while (!found) {
+         fSparseShift = 32 - bits;
+         for (Int_t attempt = 0; attempt < 64 && !found; ++attempt) {
+            fSparse.assign(1u << bits, SparseSlot{0, -1});
+            found = kTRUE;
+            for (Int_t i : sparse) {
+               Int_t code = fParticles[i]->PdgCode();
+               SparseSlot &slot = fSparse[((UInt_t)code * mult) >> fSparseShift];
+               if (slot.fIndex >= 0 && slot.fCode != code) {
+                  found = kFALSE;
+                  break;
+               }
+               if (slot.fIndex < 0)
+                  slot = SparseSlot{code, i};
+            }
+            if (!found)
+               mult = (mult * 1664525u + 1013904223u) | 1u;
+         }
+         if (!found)
+            ++bits;
+      }
+      fSparseMult = mult;
+   }
+
+   // the names
+   UInt_t size = 16;
+   while (size < 2u * n)
+      size *= 2;
+   fNameMask = size - 1;
+   fNames.assign(size, -1);
+   for (Int_t i = 0; i < n; ++i) {
+      const char *name = fParticles[i]->GetName();
+      UInt_t h = TString::Hash(name, strlen(name)) & fNameMask;
+      while (fNames[h] >= 0 && strcmp(fParticles[fNames[h]]->GetName(), name))
+         h = (h + 1) & fNameMask;
+      if (fNames[h] < 0)
+         fNames[h] = i;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the tables replaced by this one.
+
+TPDGLookupTable::~TPDGLookupTable()
+{
+   delete fRetired;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the particle of the given name, nullptr if there is none.
+
+TParticlePDG *TPDGLookupTable::Find(const char *name) const
+{
+   if (!name)
+      return nullptr;
+   UInt_t h = TString::Hash(name, strlen(name)) & fNameMask;
+   while (fNames[h] >= 0) {
+      TParticlePDG *p = fParticles[fNames[h]];
+      if (!strcmp(p->GetName(), name))
+         return p;
+      h = (h + 1) & fNameMask;
+   }
+   return nullptr;
+}
+
+} // namespace Internal
+} // namespace ROOT
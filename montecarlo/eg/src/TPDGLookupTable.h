@@ -0,0 +1,77 @@
+// @(#)root/eg:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TPDGLookupTable
+#define ROOT_TPDGLookupTable
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TPDGLookupTable                                                      //
+//                                                                      //
+// Immutable lookup table of the particles of TDatabasePDG, by PDG code //
+// and by name.                                                         //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "RtypesCore.h"
+
+#include <vector>
+
+class TCollection;
+class TParticlePDG;
+
+namespace ROOT {
+namespace Internal {
+
+class TPDGLookupTable {
+   /// Slot of the perfect hash of the PDG codes outside of the dense range.
+   struct SparseSlot {
+      Int_t fCode;   ///< PDG code, 0 for an empty slot
+      Int_t fIndex;  ///< Index of the particle in fParticles
+   };
+
+   std::vector<TParticlePDG *> fParticles;   ///< Particles, in the order of the list
+   std::vector<Int_t>          fDense;       ///< 1 + index of the particle of code c at c+kDenseMax, 0 if none
+   std::vector<SparseSlot>     fSparse;      ///< Perfect hash of the other codes
+   UInt_t                      fSparseMult;  ///< Multiplier of the hash of the codes
+   Int_t                       fSparseShift; ///< Shift of the hash of the codes
+   std::vector<Int_t>          fNames;       ///< Open-addressing hash of the names, index of the particle or -1
+   UInt_t                      fNameMask;    ///< Size of fNames minus 1
+
+public:
+   /// The codes of absolute value below kDenseMax, which include all the
+   /// quarks, leptons, gauge bosons, mesons and baryons of the PDG
+   /// numbering scheme, are looked up in a dense array.
+   static constexpr Int_t kDenseMax = 6000;
+
+   TPDGLookupTable *fRetired = nullptr; ///< Table replaced by this one, kept alive for the threads using it
+
+   explicit TPDGLookupTable(const TCollection *particles);
+   ~TPDGLookupTable();
+
+   TParticlePDG *Find(Int_t pdgCode) const
+   {
+      if (pdgCode > -kDenseMax && pdgCode < kDenseMax) {
+         Int_t i = fDense[pdgCode + kDenseMax];
+         return i ? fParticles[i - 1] : nullptr;
+      }
+      if (fSparse.empty())
+         return nullptr;
+      const SparseSlot &slot = fSparse[((UInt_t)pdgCode * fSparseMult) >> fSparseShift];
+      return slot.fCode == pdgCode ? fParticles[slot.fIndex] : nullptr;
+   }
+
+   TParticlePDG *Find(const char *name) const;
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,86 @@
+#include "TDatabasePDG.h"
+#include "THashList.h"
+#include "TParticlePDG.h"
+#include "TString.h"
+
+#include "gtest/gtest.h"
+
+// Gives access to the TExMap of the codes, the reference of the lookup table
+class TTestDatabasePDG : public TDatabasePDG {
+public:
+   TParticlePDG *FindInPdgMap(Int_t pdgCode) { return TDatabasePDG::FindInPdgMap(pdgCode); }
+   TParticlePDG *FindInParticleList(const char *name) { return (TParticlePDG *)fParticleList->FindObject(name); }
+};
+
+TEST(TDatabasePDG, DefaultTable)
+{
+   TTestDatabasePDG db;
+   db.ReadPDGTable();
+   ASSERT_NE(nullptr, db.ParticleList());
+   ASSERT_LT(0, db.ParticleList()->GetEntries());
+
+   TIter next(db.ParticleList());
+   while (auto p = (TParticlePDG *)next()) {
+      EXPECT_EQ(db.FindInPdgMap(p->PdgCode()), db.GetParticle(p->PdgCode())) << p->GetName();
+      EXPECT_EQ(db.FindInParticleList(p->GetName()), db.GetParticle(p->GetName())) << p->GetName();
+   }
+}
+
+TEST(TDatabasePDG, UnknownParticles)
+{
+   TTestDatabasePDG db;
+   for (Int_t code : {5999, -5999, 123456789, -123456789}) {
+      EXPECT_EQ(nullptr, db.FindInPdgMap(code));
+      EXPECT_EQ(nullptr, db.GetParticle(code));
+   }
+   EXPECT_EQ(nullptr, db.GetParticle("NoSuchParticle"));
+   EXPECT_EQ(nullptr, db.GetParticle(""));
+   EXPECT_EQ(nullptr, db.GetParticle((const char *)nullptr));
+}
+
+TEST(TDatabasePDG, AddParticleAfterLookup)
+{
+   TTestDatabasePDG db;
+   EXPECT_NE(nullptr, db.GetParticle(211));
+   EXPECT_EQ(nullptr, db.GetParticle(5999));
+   EXPECT_EQ(nullptr, db.GetParticle(123456789));
+
+   // The lookup table is rebuilt on the next lookup
+   auto dense = db.AddParticle("test_dense", "test_dense", 1., kTRUE, 0., 0., "Unknown", 5999);
+   auto sparse = db.AddParticle("test_sparse", "test_sparse", 1., kTRUE, 0., 0., "Unknown", 123456789);
+   ASSERT_NE(nullptr, dense);
+   ASSERT_NE(nullptr, sparse);
+   EXPECT_EQ(dense, db.GetParticle(5999));
+   EXPECT_EQ(dense, db.GetParticle("test_dense"));
+   EXPECT_EQ(sparse, db.GetParticle(123456789));
+   EXPECT_EQ(sparse, db.GetParticle("test_sparse"));
+   EXPECT_NE(nullptr, db.GetParticle(211));
+
+   auto anti = db.AddAntiParticle("anti_test_dense", -5999);
+   ASSERT_NE(nullptr, anti);
+   EXPECT_EQ(anti, db.GetParticle(-5999));
+   EXPECT_EQ(anti, db.GetParticle("anti_test_dense"));
+
+   // Duplicates are rejected, the first particle is kept
+   EXPECT_EQ(nullptr, db.AddParticle("test_dense2", "test_dense2", 2., kTRUE, 0., 0., "Unknown", 5999));
+   EXPECT_EQ(dense, db.GetParticle(5999));
+}
+
+TEST(TDatabasePDG, ManyParticles)
+{
+   // Particles beyond the first 65535 of the list are found as well
+   TTestDatabasePDG db;
+   db.ReadPDGTable();
+   const Int_t nParticles = db.ParticleList()->GetEntries();
+   for (Int_t i = 0; i < 70000 - nParticles; ++i) {
+      TString name = TString::Format("test_%d", i);
+      db.AddParticle(name, name, 1., kTRUE, 0., 0., "Unknown", 1000000000 + i);
+   }
+   auto dense = db.AddParticle("test_dense", "test_dense", 1., kTRUE, 0., 0., "Unknown", 5999);
+   ASSERT_NE(nullptr, dense);
+   ASSERT_LT(0xffff, db.ParticleList()->GetEntries());
+   EXPECT_EQ(dense, db.GetParticle(5999));
+   EXPECT_EQ(dense, db.GetParticle("test_dense"));
+   EXPECT_EQ(db.FindInPdgMap(1000000000), db.GetParticle(1000000000));
+   EXPECT_NE(nullptr, db.GetParticle("test_0"));
+}
@@ -24,5 +24,6 @@
 #pragma link C++ class TMCManagerStack + ;
 #pragma link C++ struct TMCParticleStatus + ;
 #pragma link C++ class TGeoMCBranchArrayContainer + ;
+#pragma link C++ class TMCEventRunner + ;
 
 #endif
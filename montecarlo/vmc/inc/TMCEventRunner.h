@@ -0,0 +1,120 @@
+// @(#)root/vmc:$Id$
+
+/*************************************************************************
+ * Copyright (C) 2020, Rene Brun and Fons Rademakers.                    *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TMCEventRunner
+#define ROOT_TMCEventRunner
+//
+// Class TMCEventRunner
+// ---------------------------
+// Runner processing the events of a run in parallel on worker threads,
+// each with its own clone of the user application, whatever the engines.
+//
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "Rtypes.h"
+#include "TMCtls.h"
+
+class TVirtualMCApplication;
+
+class TMCEventRunner {
+
+public:
+   /// Function creating the engine(s) of a worker, called on the worker thread
+   /// once the clone of the application is initialized. It is given the
+   /// number of the worker.
+   using EngineFactory_t = std::function<void(Int_t workerId)>;
+
+   /// Standard constructor, with nWorkers = 0 for one worker per core
+   TMCEventRunner(TVirtualMCApplication *application, EngineFactory_t engineFactory, Int_t nWorkers = 0);
+
+   /// Destructor
+   virtual ~TMCEventRunner();
+
+   //
+   // Steering
+   //
+
+   /// Process nEvents events on the workers
+   void Run(Int_t nEvents);
+
+   /// Set the seed of the random numbers of the engines, see Run()
+   void SetSeed(ULong64_t seed) { fSeed = seed; }
+
+   /// Return the seed of the random numbers of the engines
+   ULong64_t GetSeed() const { return fSeed; }
+
+   /// Return the number of workers
+   Int_t GetNWorkers() const { return fNWorkers; }
+
+   /// Return the number of events processed by each worker in the last run
+   const std::vector<Int_t> &GetNEventsPerWorker() const { return fNEventsPerWorker; }
+
+   //
+   // Static access methods, for the user code running on the workers
+   //
+
+   /// Return the number of the worker of the calling thread, -1 if it is not a worker
+   static Int_t GetWorkerId();
+
+   /// Return the number of the event processed by the calling thread, -1 if none
+   static Int_t GetEventId();
+
+   /// Return whether the calling thread is a worker of a TMCEventRunner
+   static Bool_t IsWorkerThread() { return GetWorkerId() >= 0; }
+
+private:
+   /// Not implemented
+   TMCEventRunner(const TMCEventRunner &) = delete;
+   /// Not implemented
+   TMCEventRunner &operator=(const TMCEventRunner &) = delete;
+
+   /// Build the shared geometry and prepare it for the workers
+   void PrepareGeometry();
+   /// Body of the worker threads
+   void RunWorker(Int_t workerId, Int_t nEvents);
+
+private:
+   // static data members
+#if !defined(__CINT__)
+   static TMCThreadLocal Int_t fgWorkerId; ///< Worker number of the thread
+   static TMCThreadLocal Int_t fgEventId;  ///< Event processed by the thread
+#else
+   static Int_t fgWorkerId; ///< Worker number of the thread
+   static Int_t fgEventId;  ///< Event processed by the thread
+#endif
+
+   /// Application of the master, which receives the merged data
+   TVirtualMCApplication *fApplication;
+   /// Function creating the engines of the workers
+   EngineFactory_t fEngineFactory;
+   /// Number of workers
+   Int_t fNWorkers;
+   /// Seed of the random numbers of the engines
+   ULong64_t fSeed;
+   /// Number of the next event to be processed
+   std::atomic<Int_t> fNextEvent;
+   /// Number of the next worker to be merged
+   Int_t fMergeTurn;
+   /// Protect fMergeTurn
+   std::mutex fMergeMutex;
+   /// Signal the change of fMergeTurn
+   std::condition_variable fMergeCondition;
+   /// Number of events processed by each worker
+   std::vector<Int_t> fNEventsPerWorker;
+
+   ClassDef(TMCEventRunner, 0)
+};
+
+#endif
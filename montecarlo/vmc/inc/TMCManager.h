@@ -148,6 +148,12 @@ public:
    /// Run the event loop
    void Run(Int_t nEvents);
 
+   /// Process one event, e.g. for a TMCEventRunner
+   void ProcessEvent(Int_t eventId);
+
+   /// Terminate a run in all engines
+   void TerminateRun();
+
 private:
    /// Do necessary steps before an event is triggered
    void PrepareNewEvent();
@@ -155,8 +161,6 @@ private:
    Bool_t GetNextEngine();
    /// Update all engine pointers connected to the TMCManager
    void UpdateEnginePointers(TVirtualMC *mc);
-   /// Terminate a run in all engines
-   void TerminateRun();
 
 private:
    // static data members
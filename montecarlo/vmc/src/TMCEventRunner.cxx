@@ -0,0 +1,256 @@
+// @(#)root/vmc:$Id$
+
+/*************************************************************************
+ * Copyright (C) 2020, Rene Brun and Fons Rademakers.                    *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <thread>
+
+#include "TError.h"
+#include "TGeoManager.h"
+#include "TGeoNavigator.h"
+#include "TRandomGen.h"
+
+#include "TVirtualMC.h"
+#include "TVirtualMCApplication.h"
+#include "TMCManager.h"
+
+#include "TMCEventRunner.h"
+
+/** \class TMCEventRunner
+    \ingroup vmc
+
+Runner processing the events of a run in parallel on worker threads, for any
+engine or combination of engines steered by a TMCManager.
+
+The geometry is built once, by the application of the master, and shared
+read-only by all the workers, each of which navigates it with its own
+TGeoNavigator. Each worker then
+1. clones the application with TVirtualMCApplication::CloneForWorker(); the
+   clone creates its own stack (TVirtualMCStack) and, if it requests a
+   TMCManager, gets its own manager and TMCManagerStacks,
+2. calls TVirtualMCApplication::InitOnWorker() on the clone,
+3. creates its engine(s) with the engine factory given to the runner, which
+   register to the clone of the calling thread,
+4. initializes the engines and calls TVirtualMCApplication::BeginRunOnWorker(),
+5. processes the events, taken one at a time from the events of the run not
+   processed yet so that the load is balanced between the workers,
+6. calls TVirtualMCApplication::FinishRunOnWorker() and merges its clone into
+   the application of the master with TVirtualMCApplication::Merge().
+
+The clones fill their own hits, histograms, ... without any lock. They are
+merged one at a time in the order of the workers, once each has finished.
+
+Before each event, the random generator of the engines (TVirtualMC::GetRandom())
+is seeded with GetSeed() plus the event number: an event is the same whatever
+the worker processing it, for the engines and applications using this
+generator. The engines with their own generators must be seeded by the
+application, e.g. in BeginEvent() with GetEventId().
+
+The application must not build the geometry again on the workers: its
+ConstructGeometry() should return when IsWorkerThread() is true.
+
+Example:
+~~~{.cpp}
+   auto app = new MyApplication("app", "My application");
+   TMCEventRunner runner(app, [](Int_t) { new TGeant3TGeo("C++ Interface to Geant3"); }, 8);
+   runner.Run(1000);
+~~~
+*/
+
+TMCThreadLocal Int_t TMCEventRunner::fgWorkerId = -1;
+TMCThreadLocal Int_t TMCEventRunner::fgEventId = -1;
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Standard constructor
+///
+
+TMCEventRunner::TMCEventRunner(TVirtualMCApplication *application, EngineFactory_t engineFactory, Int_t nWorkers)
+   : fApplication(application), fEngineFactory(engineFactory), fNWorkers(nWorkers), fSeed(1), fNextEvent(0),
+     fMergeTurn(0)
+{
+   if (!fApplication) {
+      ::Fatal("TMCEventRunner::TMCEventRunner", "No user MC application is defined.");
+   }
+   if (fNWorkers <= 0) {
+      fNWorkers = std::thread::hardware_concurrency();
+      if (fNWorkers <= 0) {
+         fNWorkers = 1;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Destructor
+///
+
+TMCEventRunner::~TMCEventRunner() {}
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Return the number of the worker of the calling thread, -1 if it is not a
+/// worker
+///
+
+Int_t TMCEventRunner::GetWorkerId()
+{
+   return fgWorkerId;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Return the number of the event processed by the calling thread, -1 if none
+///
+
+Int_t TMCEventRunner::GetEventId()
+{
+   return fgEventId;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Process nEvents events on the workers, and merge the data of the workers
+/// into the application of the master.
+///
+
+void TMCEventRunner::Run(Int_t nEvents)
+{
+   if (IsWorkerThread()) {
+      ::Fatal("TMCEventRunner::Run", "Cannot run from a worker thread.");
+   }
+   if (nEvents < 1) {
+      ::Fatal("TMCEventRunner::Run", "Need at least one event to process but %i events specified.", nEvents);
+   }
+
+   PrepareGeometry();
+
+   fNextEvent = 0;
+   fMergeTurn = 0;
+   fNEventsPerWorker.assign(fNWorkers, 0);
+
+   std::vector<std::thread> workers;
+   for (Int_t i = 0; i < fNWorkers; i++) {
+      workers.emplace_back(&TMCEventRunner::RunWorker, this, i, nEvents);
+   }
+   for (auto &worker : workers) {
+      worker.join();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Build the geometry with the application of the master if it was not done
+/// yet, e.g. by its TMCManager, and prepare it for the navigation by the
+/// workers
+///
+
+void TMCEventRunner::PrepareGeometry()
+{
+   if (!gGeoManager || !gGeoManager->IsClosed()) {
+      ::Info("TMCEventRunner::PrepareGeometry", "Construct the geometry shared by the workers");
+      fApplication->ConstructGeometry();
+      fApplication->MisalignGeometry();
+      fApplication->ConstructOpGeometry();
+   }
+   if (!gGeoManager || !gGeoManager->IsClosed()) {
+      ::Fatal("TMCEventRunner::PrepareGeometry", "The TGeo geometry is not closed. Please check whether you just have "
+                                                 "to close it or whether something was forgotten.");
+   }
+   // Thread data of the master and the workers, which also forgets the threads of the previous run
+   gGeoManager->SetMaxThreads(fNWorkers);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Body of the worker threads
+///
+
+void TMCEventRunner::RunWorker(Int_t workerId, Int_t nEvents)
+{
+   fgWorkerId = workerId;
+
+   // Navigator of this thread in the shared geometry
+   TGeoNavigator *navigator = gGeoManager->AddNavigator();
+
+   TVirtualMCApplication *application = fApplication->CloneForWorker();
+   if (!application) {
+      ::Fatal("TMCEventRunner::RunWorker", "The application does not implement CloneForWorker().");
+   }
+   application->InitOnWorker();
+
+   fEngineFactory(workerId);
+
+   // The engines registered to the clone of this thread
+   TMCManager *manager = TMCManager::Instance();
+   std::vector<TVirtualMC *> engines;
+   if (manager) {
+      manager->GetEngines(engines);
+   } else if (application->GetMC()) {
+      engines.push_back(application->GetMC());
+   } else {
+      ::Fatal("TMCEventRunner::RunWorker", "No engine was created for worker %i.", workerId);
+   }
+
+   TRandom *random = new TRandomMixMax(fSeed);
+   for (auto mc : engines) {
+      mc->SetRandom(random);
+   }
+
+   if (manager) {
+      manager->Init([](TVirtualMC *mc) {
+         mc->Init();
+         mc->BuildPhysics();
+      });
+   } else {
+      engines[0]->Init();
+      engines[0]->BuildPhysics();
+   }
+   application->BeginRunOnWorker();
+
+   Int_t eventId;
+   while ((eventId = fNextEvent.fetch_add(1, std::memory_order_relaxed)) < nEvents) {
+      fgEventId = eventId;
+      random->SetSeed(fSeed + eventId);
+      if (manager) {
+         manager->ProcessEvent(eventId);
+      } else {
+         engines[0]->ProcessEvent(eventId);
+      }
+      fNEventsPerWorker[workerId]++;
+   }
+   fgEventId = -1;
+
+   if (manager) {
+      manager->TerminateRun();
+   } else {
+      engines[0]->TerminateRun();
+   }
+   application->FinishRunOnWorker();
+
+   // Merge in the order of the workers
+   {
+      std::unique_lock<std::mutex> lock(fMergeMutex);
+      fMergeCondition.wait(lock, [this, workerId] { return fMergeTurn == workerId; });
+   }
+   fApplication->Merge(application);
+   {
+      std::lock_guard<std::mutex> lock(fMergeMutex);
+      fMergeTurn++;
+   }
+   fMergeCondition.notify_all();
+
+   // The TMCManager of the clone owns the engines, else the engine is deleted here
+   TVirtualMC *engine = manager ? nullptr : engines[0];
+   delete application;
+   delete engine;
+   delete random;
+   gGeoManager->RemoveNavigator(navigator);
+
+   fgWorkerId = -1;
+}
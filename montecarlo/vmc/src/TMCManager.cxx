@@ -23,6 +23,7 @@
 #include "TMCParticleStatus.h"
 
 #include "TMCManager.h"
+#include "TMCEventRunner.h"
 
 /** \class TMCManager
     \ingroup vmc
@@ -113,8 +114,12 @@ void TMCManager::Register(TVirtualMCApplication *application)
    if (fApplication) {
       ::Fatal("TMCManager::Register", "The application is already registered.");
    }
-   ::Info("TMCManager::Register", "Register user application and construct geometry");
    fApplication = application;
+   // The workers of a TMCEventRunner share the geometry built by the master
+   if (TMCEventRunner::IsWorkerThread()) {
+      return;
+   }
+   ::Info("TMCManager::Register", "Register user application and construct geometry");
    // TODO Can these 3 functions can be called directly here? Or could any of these depend on an implemented VMC?
    fApplication->ConstructGeometry();
    fApplication->MisalignGeometry();
@@ -421,17 +426,33 @@ void TMCManager::Run(Int_t nEvents)
    // Run 1 event nEvents times
    for (Int_t i = 0; i < nEvents; i++) {
       ::Info("TMCManager::Run", "Start event %i", i + 1);
-      PrepareNewEvent();
-      fApplication->BeginEvent();
-      // Loop as long as there are tracks in any engine stack
-      while (GetNextEngine()) {
-         fCurrentEngine->ProcessEvent(i, kTRUE);
-      }
-      fApplication->FinishEvent();
+      ProcessEvent(i);
    }
    TerminateRun();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Process one event. The run must be terminated with TerminateRun() after
+/// the last event.
+///
+
+void TMCManager::ProcessEvent(Int_t eventId)
+{
+   if (!fIsInitialized) {
+      ::Fatal("TMCManager::ProcessEvent", "Engines have not yet been initialized.");
+   }
+   fIsInitializedUser = kTRUE;
+
+   PrepareNewEvent();
+   fApplication->BeginEvent();
+   // Loop as long as there are tracks in any engine stack
+   while (GetNextEngine()) {
+      fCurrentEngine->ProcessEvent(eventId, kTRUE);
+   }
+   fApplication->FinishEvent();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///
 /// Choose next engines to be run in the loop
@@ -14,6 +14,7 @@
 #include "TError.h"
 #include "TVirtualMC.h"
 #include "TMCManager.h"
+#include "TMCEventRunner.h"
 
 /** \class TVirtualMCApplication
     \ingroup vmc
@@ -36,8 +37,9 @@ TVirtualMCApplication::TVirtualMCApplication(const char *name, const char *title
       ::Fatal("TVirtualMCApplication::TVirtualMCApplication", "Attempt to create two instances of singleton.");
    }
 
-   // This is set to true if a TMCManager was reuqested.
-   if (fLockMultiThreading) {
+   // This is set to true if a TMCManager was reuqested. The workers of a
+   // TMCEventRunner have their own TMCManager.
+   if (fLockMultiThreading && !TMCEventRunner::IsWorkerThread()) {
       ::Fatal("TVirtualMCApplication::TVirtualMCApplication", "In multi-engine run ==> multithreading is disabled.");
    }
 
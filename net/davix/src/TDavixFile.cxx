@@ -49,6 +49,9 @@
 #include <sstream>
 #include <string>
 #include <cstring>
+#include <atomic>
+#include <map>
+#include <thread>
 
 
 static const std::string VERSION = "0.2.0";
@@ -78,6 +81,10 @@ const char* open_mode_update = "UPDATE";
 static TMutex createLock;
 static Context* davix_context_s = NULL;
 
+// hosts that failed a multi-range request: their vector reads are done with parallel single range requests
+static TMutex singleRangeLock;
+static std::map<std::string, bool> singleRangeHosts;
+
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -439,6 +446,15 @@ void TDavixFileInternal::parseConfig()
    env_var = gEnv->GetValue("Davix.GSI.GridMode", (const char *)"y");
    if (!isno(env_var))
       enableGridMode();
+
+   // vector reads
+   readvMergeGap = std::max(0, gEnv->GetValue("Davix.ReadV.MergeGap", 32768));
+   readvParallel = std::max(1, gEnv->GetValue("Davix.ReadV.Parallel", 4));
+   env_var = gEnv->GetValue("Davix.ReadV.MultiRange", (const char *)"auto");
+   if (strcasecmp(env_var, "auto") == 0)
+      readvMode = 0;
+   else
+      readvMode = strToBool(env_var, true) ? 1 : 2;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -846,25 +862,136 @@ Long64_t TDavixFile::DavixReadBuffers(Davix_fd *fd, char *buf, Long64_t *pos, In
 {
    DavixError *davixErr = NULL;
    Double_t start_time = eventStart();
-   DavIOVecInput in[nbuf];
-   DavIOVecOuput out[nbuf];
 
-   int lastPos = 0;
+   // Coalesce the ranges separated by small gaps: the gaps are read too, in a scratch
+   // buffer, but far fewer ranges have to be requested
+   std::vector<Long64_t> rangePos;
+   std::vector<Int_t> rangeLen;
+   std::vector<char *> rangeBuf;
+   std::vector<std::vector<char>> scratch;
+   std::vector<std::pair<Int_t, Int_t>> rangeInputs; // first and last input of each range, if read in a scratch buffer
+   std::vector<char *> inputBuf(nbuf);
+   Long64_t total = 0;
    for (Int_t i = 0; i < nbuf; ++i) {
-      in[i].diov_buffer = &buf[lastPos];
-      in[i].diov_offset = pos[i];
-      in[i].diov_size = len[i];
-      lastPos += len[i];
+      inputBuf[i] = &buf[total];
+      total += len[i];
+   }
+   // do not coalesce everything in one range, so that parallel requests remain possible
+   const Long64_t maxRange = std::max<Long64_t>(total / d_ptr->readvParallel, 1 << 20);
+   for (Int_t i = 0; i < nbuf;) {
+      Int_t last = i;
+      Long64_t end = pos[i] + len[i];
+      Bool_t contiguous = kTRUE;
+      while (last + 1 < nbuf && pos[last + 1] >= end && pos[last + 1] - end <= d_ptr->readvMergeGap &&
+             pos[last + 1] + len[last + 1] - pos[i] <= maxRange) {
+         contiguous &= (pos[last + 1] == end);
+         ++last;
+         end = pos[last] + len[last];
+      }
+      rangePos.push_back(pos[i]);
+      rangeLen.push_back(end - pos[i]);
+      if (contiguous) {
+         // the buffers of consecutive inputs are consecutive too
+         rangeBuf.push_back(inputBuf[i]);
+         rangeInputs.emplace_back(-1, -1);
+      } else {
+         scratch.emplace_back(end - pos[i]);
+         rangeBuf.push_back(scratch.back().data());
+         rangeInputs.emplace_back(i, last);
+      }
+      i = last + 1;
    }
+   const Int_t nranges = rangePos.size();
 
-   Long64_t ret = d_ptr->davixPosix->preadVec(fd, in, out, nbuf, &davixErr);
-   if (ret < 0) {
-      Error("DavixReadBuffers", "can not read data with davix: %s (%d)",
-            davixErr->getErrMsg().c_str(), davixErr->getStatus());
-      DavixError::clearError(&davixErr);
-   } else {
+   const std::string host = fUrl.GetHost();
+   Bool_t multiRange = d_ptr->readvMode == 1;
+   if (d_ptr->readvMode == 0) {
+      TLockGuard guard(&singleRangeLock);
+      multiRange = singleRangeHosts.find(host) == singleRangeHosts.end();
+   }
+
+   Long64_t ret = -1;
+   if (multiRange && nranges > 1) {
+      std::vector<DavIOVecInput> in(nranges);
+      std::vector<DavIOVecOuput> out(nranges);
+      for (Int_t i = 0; i < nranges; ++i) {
+         in[i].diov_buffer = rangeBuf[i];
+         in[i].diov_offset = rangePos[i];
+         in[i].diov_size = rangeLen[i];
+      }
+      ret = d_ptr->davixPosix->preadVec(fd, in.data(), out.data(), nranges, &davixErr);
+      if (ret < 0) {
+         if (d_ptr->readvMode == 0) {
+            // remember that this host does not serve multi-range requests, and retry one range per request
+            if (gDebug > 0)
+               Info("DavixReadBuffers", "multi-range request to %s failed (%s), using parallel range requests",
+                    host.c_str(), davixErr->getErrMsg().c_str());
+            TLockGuard guard(&singleRangeLock);
+            singleRangeHosts[host] = true;
+         } else {
+            Error("DavixReadBuffers", "can not read data with davix: %s (%d)",
+                  davixErr->getErrMsg().c_str(), davixErr->getStatus());
+         }
+         DavixError::clearError(&davixErr);
+      }
+   }
+   if (ret < 0 && (!multiRange || nranges == 1 || d_ptr->readvMode == 0))
+      ret = DavixParallelReadBuffers(fd, rangeBuf.data(), rangePos.data(), rangeLen.data(), nranges);
+
+   if (ret >= 0) {
+      // copy the inputs from the scratch buffers
+      std::size_t s = 0;
+      for (Int_t r = 0; r < nranges; ++r) {
+         if (rangeInputs[r].first < 0)
+            continue;
+         for (Int_t i = rangeInputs[r].first; i <= rangeInputs[r].second; ++i)
+            memcpy(inputBuf[i], scratch[s].data() + (pos[i] - rangePos[r]), len[i]);
+         ++s;
+      }
+      ret = total;
       eventStop(start_time, ret);
    }
 
    return ret;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the ranges with single range requests, several at a time.
+/// Returns the number of bytes read, or -1 if one of the requests failed.
+
+Long64_t TDavixFile::DavixParallelReadBuffers(Davix_fd *fd, char **buf, Long64_t *pos, Int_t *len, Int_t nbuf)
+{
+   std::atomic<Int_t> next(0);
+   std::atomic<bool> failed(false);
+   auto readRanges = [&]() {
+      for (Int_t i = next++; i < nbuf && !failed; i = next++) {
+         DavixError *davixErr = NULL;
+         if (d_ptr->davixPosix->pread(fd, buf[i], len[i], pos[i], &davixErr) != len[i]) {
+            // report the first failure only
+            if (!failed.exchange(true)) {
+               if (davixErr)
+                  Error("DavixReadBuffers", "can not read data with davix: %s (%d)",
+                        davixErr->getErrMsg().c_str(), davixErr->getStatus());
+               else
+                  Error("DavixReadBuffers", "short read of %d bytes at offset %lld", len[i], pos[i]);
+            }
+            DavixError::clearError(&davixErr);
+         }
+      }
+   };
+
+   const Int_t nthreads = std::min(nbuf, d_ptr->readvParallel) - 1;
+   std::vector<std::thread> threads;
+   for (Int_t t = 0; t < nthreads; ++t)
+      threads.emplace_back(readRanges);
+   readRanges();
+   for (auto &t : threads)
+      t.join();
+
+   if (failed)
+      return -1;
+   Long64_t total = 0;
+   for (Int_t i = 0; i < nbuf; ++i)
+      total += len[i];
+   return total;
+}
@@ -138,6 +138,11 @@ private:
    int oflags;
    std::vector<void*> dirdVec;
 
+   // vector reads
+   Int_t readvMergeGap = 0;  // Largest gap between two ranges read as one
+   Int_t readvParallel = 1;  // Number of concurrent range requests
+   Int_t readvMode = 0;      // 0: multi-range requests, unless the host rejected them; 1: always; 2: never
+
 public:
    Int_t DavixStat(const char *url, struct stat *st);
 
@@ -36,6 +36,7 @@ protected:
    Bool_t fTerminated{kFALSE};          ///<! termination flag, disables all requests processing
    Long_t fMainThrdId{0};               ///<! id of the thread for processing requests
    Bool_t fOwnThread{kFALSE};           ///<! true when specialized thread allocated for processing requests
+   Bool_t fConcurrentRead{kFALSE};      ///<! true when read-only requests processed in the threads of the engines
    std::thread fThrd;                   ///<! own thread
    Bool_t fOldProcessSignature{kFALSE}; ///<! flag used to detect usage of old signature of Process() method
 
@@ -54,6 +55,22 @@ protected:
    std::mutex fMutex;                                        ///<! mutex to protect list with arguments
    std::queue<std::shared_ptr<THttpCallArg>> fArgs;          ///<! submitted arguments
 
+   std::mutex fSnifferMutex;                                 ///<! mutex to serialize requests processing with the sniffer
+
+   struct CachedResponse {
+      std::string fChecksum; ///<! MD5 checksum of the streamed object when response was produced
+      TString fHeader;       ///<! extra headers of the response
+      std::string fContent;  ///<! produced content
+      std::string fZipped;   ///<! gzip-compressed content, produced when first requested
+      Long64_t fLastUse{0};  ///<! value of fCacheUses when response was last delivered
+   };
+
+   Bool_t fResponseCache{kFALSE};                            ///<! true when object responses are cached
+   Int_t fMaxCachedResponses{100};                           ///<! maximal number of cached responses
+   Long64_t fCacheUses{0};                                   ///<! number of accesses to the cache, used to find least recently used responses
+   std::mutex fCacheMutex;                                   ///<! mutex to protect cached responses
+   std::map<std::string, CachedResponse> fCachedResponses;   ///<! cached responses by user, path, file name and query
+
    std::mutex fWSMutex;                                      ///<! mutex to protect WS handler lists
    std::vector<std::shared_ptr<THttpWSHandler>> fWSHandlers; ///<! list of WS handlers
 
@@ -65,6 +82,12 @@ protected:
 
    virtual void ProcessRequest(THttpCallArg *arg);
 
+   void ProcessSnifferRequest(std::shared_ptr<THttpCallArg> &arg);
+
+   Bool_t IsReadRequest(const THttpCallArg &arg) const;
+
+   Bool_t ProduceObject(THttpCallArg &arg, const TString &filename, Bool_t iszip);
+
    void StopServerThread();
 
    static Bool_t VerifyFilePath(const char *fname);
@@ -120,6 +143,19 @@ public:
 
    void CreateServerThread();
 
+   /** Enable processing of read-only requests in the threads of the http engines, see ExecuteHttp() */
+   void SetConcurrentRead(Bool_t on = kTRUE) { fConcurrentRead = on; }
+
+   /** Returns kTRUE if read-only requests are processed in the threads of the http engines */
+   Bool_t IsConcurrentRead() const { return fConcurrentRead; }
+
+   void SetResponseCache(Bool_t on = kTRUE, Int_t maxresponses = 100);
+
+   /** Returns kTRUE if responses of object requests are cached */
+   Bool_t IsResponseCache() const { return fResponseCache; }
+
+   void ClearResponseCache();
+
    /** Check if file is requested, thread safe */
    Bool_t IsFileRequested(const char *uri, TString &res) const;
 
@@ -197,7 +197,7 @@ public:
 
    TFolder *GetTopFolder(Bool_t force = kFALSE);
 
-   /** When enabled (default), sniffer scans gROOT for files, canvases, histograms */
+   /** When enabled (default), sniffer scans gROOT for files, canvases, histograms and the memory accounting */
    void SetScanGlobalDir(Bool_t on = kTRUE) { fScanGlobalDir = on; }
 
    void SetAutoLoad(const char *scripts = "");
@@ -19,6 +19,7 @@
 #include "TEnv.h"
 #include "TError.h"
 #include "TClass.h"
+#include "TMD5.h"
 #include "RConfigure.h"
 #include "TRegexp.h"
 #include "TObjArray.h"
@@ -238,6 +239,39 @@ void THttpServer::SetSniffer(TRootSniffer *sniff)
    if (fSniffer)
       delete fSniffer;
    fSniffer = sniff;
+   ClearResponseCache();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Enable caching of the responses of object requests
+///
+/// When enabled, the replies of "root.json" and "root.bin" requests are kept
+/// and delivered again as long as the object content does not change.
+/// To detect changes, the object is still streamed in binary form for each request
+/// and the MD5 checksum of the buffer is compared with the one of the cached reply.
+/// Any modification of the object, including the data it holds on the heap
+/// like the bins content of a histogram, therefore produces a new reply.
+/// What is saved is the conversion to JSON and the compression of replies
+/// requested with ".gz" suffix, which are cached as well.
+/// Only objects which can be streamed in binary form (see TRootSnifferFull) are cached.
+///
+/// At most maxresponses replies are kept, the least recently used ones are removed first.
+
+void THttpServer::SetResponseCache(Bool_t on, Int_t maxresponses)
+{
+   fResponseCache = on;
+   fMaxCachedResponses = maxresponses > 0 ? maxresponses : 1;
+   if (!on)
+      ClearResponseCache();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all cached responses
+
+void THttpServer::ClearResponseCache()
+{
+   std::lock_guard<std::mutex> grd(fCacheMutex);
+   fCachedResponses.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -553,6 +587,15 @@ Bool_t THttpServer::IsFileRequested(const char *uri, TString &res) const
 /// Executes http request, specified in THttpCallArg structure
 /// Method can be called from any thread
 /// Actual execution will be done in main ROOT thread, where analysis code is running.
+///
+/// When enabled with SetConcurrentRead(), read-only requests (see IsReadRequest())
+/// are executed directly in the calling thread of the http engine, so that
+/// the main thread is not blocked by the streaming of large objects and such
+/// requests are not delayed until the next ProcessRequests() call.
+/// Access to the sniffer is serialized with the processing in the main thread,
+/// but the requested objects are read while the analysis code may run:
+/// use it only for objects which are not modified at the same time or
+/// together with ROOT::EnableThreadSafety().
 
 Bool_t THttpServer::ExecuteHttp(std::shared_ptr<THttpCallArg> arg)
 {
@@ -567,6 +610,11 @@ Bool_t THttpServer::ExecuteHttp(std::shared_ptr<THttpCallArg> arg)
       return kTRUE;
    }
 
+   if (fConcurrentRead && IsReadRequest(*arg)) {
+      ProcessSnifferRequest(arg);
+      return kTRUE;
+   }
+
    // add call arg to the list
    std::unique_lock<std::mutex> lk(fMutex);
    fArgs.push(arg);
@@ -646,15 +694,8 @@ Int_t THttpServer::ProcessRequests()
          continue;
       }
 
-      fSniffer->SetCurrentCallArg(arg.get());
-
-      try {
-         cnt++;
-         ProcessRequest(arg);
-         fSniffer->SetCurrentCallArg(nullptr);
-      } catch (...) {
-         fSniffer->SetCurrentCallArg(nullptr);
-      }
+      cnt++;
+      ProcessSnifferRequest(arg);
 
       arg->NotifyCondition();
    }
@@ -671,6 +712,44 @@ Int_t THttpServer::ProcessRequests()
    return cnt;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Process request with the sniffer locked
+/// Sniffer keeps the arguments of the current request, therefore
+/// only one request at a time can be processed
+
+void THttpServer::ProcessSnifferRequest(std::shared_ptr<THttpCallArg> &arg)
+{
+   std::lock_guard<std::mutex> grd(fSnifferMutex);
+
+   fSniffer->SetCurrentCallArg(arg.get());
+
+   try {
+      ProcessRequest(arg);
+      fSniffer->SetCurrentCallArg(nullptr);
+   } catch (...) {
+      fSniffer->SetCurrentCallArg(nullptr);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns kTRUE if request only reads objects and can be processed outside the main thread
+/// These are the hierarchy and object requests in json, xml or binary format of a read-only sniffer.
+/// Images are excluded while they are produced by drawing the object on a canvas,
+/// as well as methods execution, commands and requests of websockets
+
+Bool_t THttpServer::IsReadRequest(const THttpCallArg &arg) const
+{
+   if (!fSniffer || !fSniffer->IsReadOnly())
+      return kFALSE;
+
+   TString filename = arg.fFileName;
+   if (filename.EndsWith(".gz"))
+      filename.Resize(filename.Length() - 3);
+
+   return (filename == "root.json") || (filename == "root.bin") || (filename == "root.xml") ||
+          (filename == "item.json") || (filename == "h.json") || (filename == "h.xml") || (filename == "get.xml");
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Method called when THttpServer cannot process request
 /// By default such requests replied with 404 code
@@ -935,7 +1014,7 @@ void THttpServer::ProcessRequest(std::shared_ptr<THttpCallArg> arg)
       fSniffer->ScanHierarchy(topname, arg->fPathName.Data(), &store);
       arg->SetContent(std::string(res.Data()));
       arg->SetJson();
-   } else if (fSniffer->Produce(arg->fPathName.Data(), filename.Data(), arg->fQuery.Data(), arg->fContent)) {
+   } else if (ProduceObject(*arg, filename, iszip)) {
       // define content type base on extension
       arg->SetContentType(GetMimeType(filename.Data()));
    } else {
@@ -946,7 +1025,8 @@ void THttpServer::ProcessRequest(std::shared_ptr<THttpCallArg> arg)
    if (arg->Is404())
       return;
 
-   if (iszip)
+   // cached responses may be compressed already
+   if (iszip && arg->GetHeader("Content-Encoding").IsNull())
       arg->SetZipping(THttpCallArg::kZipAlways);
 
    if (filename == "root.bin") {
@@ -964,6 +1044,92 @@ void THttpServer::ProcessRequest(std::shared_ptr<THttpCallArg> arg)
       arg->AddHeader("Access-Control-Allow-Origin", GetCors());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Produce object data for the request with the sniffer
+/// When response caching is enabled, "root.json" and "root.bin" replies are taken
+/// from the cache as long as the checksum of the streamed object is not changed,
+/// see SetResponseCache()
+
+Bool_t THttpServer::ProduceObject(THttpCallArg &arg, const TString &filename, Bool_t iszip)
+{
+   if (!fResponseCache || ((filename != "root.json") && (filename != "root.bin")))
+      return fSniffer->Produce(arg.fPathName.Data(), filename.Data(), arg.fQuery.Data(), arg.fContent);
+
+   Bool_t isbinary = (filename == "root.bin");
+
+   // stream object to detect any change of its content, the binary data is the reply for root.bin
+   TString header = arg.fHeader;
+   std::string binary;
+   if (!fSniffer->Produce(arg.fPathName.Data(), "root.bin", arg.fQuery.Data(), binary)) {
+      arg.fHeader = header;
+      return fSniffer->Produce(arg.fPathName.Data(), filename.Data(), arg.fQuery.Data(), arg.fContent);
+   }
+
+   TMD5 md5;
+   md5.Update((const UChar_t *)binary.data(), binary.length());
+   md5.Final();
+   std::string checksum = md5.AsString();
+
+   // restrictions may depend from the user, therefore user name is part of the key
+   std::string key = arg.fUserName.Data();
+   key.append(":");
+   key.append(arg.fPathName.Data());
+   key.append("/");
+   key.append(filename.Data());
+   key.append("?");
+   key.append(arg.fQuery.Data());
+
+   {
+      std::lock_guard<std::mutex> grd(fCacheMutex);
+      auto iter = fCachedResponses.find(key);
+      if ((iter != fCachedResponses.end()) && (iter->second.fChecksum == checksum)) {
+         auto &entry = iter->second;
+         entry.fLastUse = ++fCacheUses;
+         if (iszip && entry.fZipped.empty()) {
+            THttpCallArg zip;
+            zip.fContent = entry.fContent;
+            zip.CompressWithGzip();
+            entry.fZipped = std::move(zip.fContent);
+         }
+         arg.fHeader = entry.fHeader;
+         if (iszip) {
+            arg.fContent = entry.fZipped;
+            arg.SetEncoding("gzip");
+         } else {
+            arg.fContent = entry.fContent;
+         }
+         return kTRUE;
+      }
+   }
+
+   if (isbinary) {
+      arg.fContent = std::move(binary);
+   } else {
+      arg.fHeader = header;
+      if (!fSniffer->Produce(arg.fPathName.Data(), filename.Data(), arg.fQuery.Data(), arg.fContent))
+         return kFALSE;
+   }
+
+   std::lock_guard<std::mutex> grd(fCacheMutex);
+   if ((fCachedResponses.find(key) == fCachedResponses.end()) &&
+       ((Int_t)fCachedResponses.size() >= fMaxCachedResponses)) {
+      auto oldest = fCachedResponses.begin();
+      for (auto iter = fCachedResponses.begin(); iter != fCachedResponses.end(); ++iter)
+         if (iter->second.fLastUse < oldest->second.fLastUse)
+            oldest = iter;
+      fCachedResponses.erase(oldest);
+   }
+
+   auto &entry = fCachedResponses[key];
+   entry.fChecksum = checksum;
+   entry.fHeader = arg.fHeader;
+   entry.fContent = arg.fContent;
+   entry.fZipped.clear();
+   entry.fLastUse = ++fCacheUses;
+
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \deprecated  One should use signature with std::shared_ptr
 
@@ -989,6 +1155,7 @@ Bool_t THttpServer::Register(const char *subfolder, TObject *obj)
 
 Bool_t THttpServer::Unregister(TObject *obj)
 {
+   ClearResponseCache();
    return fSniffer->UnregisterObject(obj);
 }
 
@@ -16,6 +16,7 @@
 #include "TList.h"
 #include "TBufferJSON.h"
 #include "TROOT.h"
+#include "TMemoryAccounting.h"
 #include "TFolder.h"
 #include "TClass.h"
 #include "TRealData.h"
@@ -989,6 +990,10 @@ void TRootSniffer::ScanRoot(TRootSnifferScanRec &rec)
       ScanCollection(rec, gROOT->GetListOfCanvases(), "Canvases");
 
       ScanCollection(rec, gROOT->GetListOfFiles(), "Files");
+
+      TList memory;
+      memory.Add(gROOT->GetMemoryAccounting());
+      ScanCollection(rec, &memory, "Memory");
    }
 }
 
@@ -1148,11 +1153,8 @@ Bool_t TRootSniffer::ProduceJson(const std::string &path, const std::string &opt
    if (!obj_ptr || (!obj_cl && !member))
       return kFALSE;
 
-   // TODO: implement direct storage into std::string
-   TString buf = TBufferJSON::ConvertToJSON(obj_ptr, obj_cl, compact >= 0 ? compact : 0, member ? member->GetName() : nullptr);
-   res = buf.Data();
-
-   return !res.empty();
+   return TBufferJSON::ConvertToJSON(res, obj_ptr, obj_cl, compact >= 0 ? compact : 0,
+                                     member ? member->GetName() : nullptr);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -16,10 +16,27 @@
 #include "TString.h"
 #include "TDatime.h"
 #include "TTimeStamp.h"
+#include <string>
 #include <vector>
 
 class TSQLStatement : public TObject {
 
+public:
+   enum EColumnType { kColLong64, kColDouble, kColString };
+
+   // values of one field of the result set in consecutive rows, see FetchColumns()
+   struct TColumnBuffer {
+      Int_t                    fField{0};          // number of the field in the result set
+      EColumnType              fType{kColDouble};  // type of the values
+      std::vector<Long64_t>    fLong64;            // values of a kColLong64 column
+      std::vector<Double_t>    fDouble;            // values of a kColDouble column
+      std::vector<std::string> fString;            // values of a kColString column
+      std::vector<Char_t>      fNull;              // 1 for the NULL values, stored as 0 or ""
+
+      TColumnBuffer() = default;
+      TColumnBuffer(Int_t field, EColumnType type) : fField(field), fType(type) {}
+   };
+
 protected:
    TSQLStatement(Bool_t errout = kTRUE) { fErrorOut = errout; }
 
@@ -29,6 +46,7 @@ protected:
 
    void                ClearError();
    void                SetError(Int_t code, const char* msg, const char *method = nullptr);
+   Bool_t              PrepareColumns(std::vector<TColumnBuffer> &columns, Int_t maxrows, const char *method);
 
 public:
    virtual ~TSQLStatement() = default;
@@ -109,6 +127,8 @@ public:
    virtual Bool_t      GetVULong64(Int_t, std::vector<ULong64_t>&) { return kFALSE; }
    virtual Bool_t      GetVDouble(Int_t, std::vector<Double_t>&) { return kFALSE; }
 
+   virtual Int_t       FetchColumns(std::vector<TColumnBuffer> &columns, Int_t maxrows = 0);
+
    virtual Bool_t      IsError() const { return GetErrorCode()!=0; }
    virtual Int_t       GetErrorCode() const;
    virtual const char* GetErrorMsg() const;
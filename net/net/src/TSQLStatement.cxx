@@ -174,6 +174,21 @@
 //       }
 //    }
 //
+// The values of many rows can also be retrieved column by column, in one
+// call of FetchColumns() per block of rows. Each TColumnBuffer receives
+// the values of one field, as Long64_t, Double_t or std::string, together
+// with their NULL flags. The implementations for SQLite, MySQL and
+// PostgreSQL read the values directly from the result set, without one
+// call of a virtual getter per value:
+//
+//    std::vector<TSQLStatement::TColumnBuffer> cols;
+//    cols.emplace_back(0, TSQLStatement::kColDouble);
+//    cols.emplace_back(2, TSQLStatement::kColString);
+//    while (stmt->FetchColumns(cols, 1000) > 0) {
+//       for (size_t i = 0; i < cols[0].fDouble.size(); i++)
+//          std::cout << cols[0].fDouble[i] << "  " << cols[1].fString[i] << std::endl;
+//    }
+//
 // 4. Working with date/time parameters
 // ====================================
 // The current implementation supports date, time, date&time and timestamp
@@ -449,3 +464,71 @@ Bool_t TSQLStatement::GetTimestamp(Int_t, TTimeStamp&)
    return kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Clears the values of the columns for FetchColumns() and checks their fields
+/// if there is a result set. Returns kFALSE and sets the error if a field does
+/// not exist.
+
+Bool_t TSQLStatement::PrepareColumns(std::vector<TColumnBuffer> &columns, Int_t maxrows, const char *method)
+{
+   ClearError();
+   Int_t nfields = GetNumFields();
+   for (auto &col : columns) {
+      if ((nfields >= 0) && ((col.fField < 0) || (col.fField >= nfields))) {
+         SetError(-1, Form("Invalid field number %d", col.fField), method);
+         return kFALSE;
+      }
+      col.fLong64.clear();
+      col.fDouble.clear();
+      col.fString.clear();
+      col.fNull.clear();
+      if (maxrows > 0) {
+         col.fNull.reserve(maxrows);
+         if (col.fType == kColLong64) col.fLong64.reserve(maxrows);
+         else if (col.fType == kColDouble) col.fDouble.reserve(maxrows);
+         else col.fString.reserve(maxrows);
+      }
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fetches the next rows of the result set, at most maxrows of them if maxrows
+/// is positive, and fills the values of the requested fields in the columns,
+/// one vector per column. The NULL values are stored as 0 or as an empty string,
+/// and flagged in TColumnBuffer::fNull.
+/// Like NextResultRow(), it starts with the row after the current one, and
+/// leaves the statement on the last fetched row. Without result set, or after
+/// its last row, no row is fetched.
+/// Returns the number of fetched rows, 0 at the end of the result set and
+/// -1 in case of error.
+///
+/// This generic implementation uses NextResultRow() and the getters of each
+/// value; the implementations for SQLite, MySQL and PostgreSQL read the
+/// values directly from the result set.
+
+Int_t TSQLStatement::FetchColumns(std::vector<TColumnBuffer> &columns, Int_t maxrows)
+{
+   if (!PrepareColumns(columns, maxrows, "FetchColumns"))
+      return -1;
+
+   Int_t nrows = 0;
+   while (((maxrows <= 0) || (nrows < maxrows)) && NextResultRow()) {
+      for (auto &col : columns) {
+         Bool_t isnull = IsNull(col.fField);
+         col.fNull.push_back(isnull);
+         switch (col.fType) {
+            case kColLong64: col.fLong64.push_back(isnull ? 0 : GetLong64(col.fField)); break;
+            case kColDouble: col.fDouble.push_back(isnull ? 0. : GetDouble(col.fField)); break;
+            case kColString: {
+               const char *str = isnull ? nullptr : GetString(col.fField);
+               col.fString.emplace_back(str ? str : "");
+               break;
+            }
+         }
+      }
+      nrows++;
+   }
+
+   return IsError() ? -1 : nrows;
+}
@@ -7,5 +7,6 @@
 #pragma link C++ class TNetXNGFile;
 #pragma link C++ class TNetXNGFileStager;
 #pragma link C++ class TNetXNGSystem;
+#pragma link C++ class ROOT::Internal::RRawFileNetXNG+;
 
 #endif
@@ -0,0 +1,57 @@
+// @(#)root/netxng:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RRawFileNetXNG
+#define ROOT_RRawFileNetXNG
+
+#include <ROOT/RRawFile.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace XrdCl {
+class File;
+}
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RRawFileNetXNG RRawFileNetXNG.hxx
+ *
+ * The RRawFileNetXNG class provides read-only access to files served by XRootD (root:// urls), through the XrdCl
+ * client. Vector reads are sent as XRootD vector reads, split according to the default server limits on the number
+ * and the size of the chunks. As for other remote files, the RRawFile base class buffers in large blocks.
+ */
+class RRawFileNetXNG : public RRawFile {
+private:
+   std::unique_ptr<XrdCl::File> fFile;
+   /// Set on opening: chunks beyond the end of the file would fail the whole vector read
+   std::uint64_t fSize;
+
+protected:
+   void OpenImpl() final;
+   size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
+   void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::uint64_t GetSizeImpl() final;
+
+public:
+   RRawFileNetXNG(std::string_view url, RRawFile::ROptions options);
+   ~RRawFileNetXNG();
+   std::unique_ptr<RRawFile> Clone() const final;
+   int GetFeatures() const final { return kFeatureHasSize; }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
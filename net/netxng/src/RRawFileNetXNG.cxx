@@ -0,0 +1,115 @@
+// @(#)root/netxng:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RRawFileNetXNG.hxx"
+#include "ROOT/RMakeUnique.hxx"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include <XrdCl/XrdClFile.hh>
+#include <XrdCl/XrdClXRootDResponses.hh>
+
+namespace {
+constexpr int kDefaultBlockSize = 128 * 1024; // Read in relatively large 128k blocks for better network utilization
+// The default server limits of vector reads, see TNetXNGFile::GetVectorReadLimits()
+constexpr std::uint32_t kReadvIorMax = 2097136;
+constexpr std::size_t kReadvIovMax = 1024;
+// The size limit of a single read request
+constexpr std::uint32_t kReadMax = 1024 * 1024 * 1024;
+} // anonymous namespace
+
+ROOT::Internal::RRawFileNetXNG::RRawFileNetXNG(std::string_view url, ROptions options)
+   : RRawFile(url, options), fFile(new XrdCl::File()), fSize(kUnknownFileSize)
+{
+}
+
+ROOT::Internal::RRawFileNetXNG::~RRawFileNetXNG()
+{
+   if (fFile->IsOpen())
+      fFile->Close();
+}
+
+std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileNetXNG::Clone() const
+{
+   return std::make_unique<RRawFileNetXNG>(fUrl, fOptions);
+}
+
+std::uint64_t ROOT::Internal::RRawFileNetXNG::GetSizeImpl()
+{
+   return fSize;
+}
+
+void ROOT::Internal::RRawFileNetXNG::OpenImpl()
+{
+   auto status = fFile->Open(fUrl, XrdCl::OpenFlags::Read);
+   if (!status.IsOK())
+      throw std::runtime_error("Cannot open '" + fUrl + "', error: " + status.ToStr());
+
+   XrdCl::StatInfo *info = nullptr;
+   status = fFile->Stat(false, info);
+   if (!status.IsOK())
+      throw std::runtime_error("Cannot determine size of '" + fUrl + "', error: " + status.ToStr());
+   fSize = info->GetSize();
+   delete info;
+
+   if (fOptions.fBlockSize < 0)
+      fOptions.fBlockSize = kDefaultBlockSize;
+}
+
+size_t ROOT::Internal::RRawFileNetXNG::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
+{
+   size_t totalBytes = 0;
+   while (nbytes) {
+      const std::uint32_t request = std::min<size_t>(nbytes, kReadMax);
+      std::uint32_t bytesRead = 0;
+      auto status = fFile->Read(offset, request, buffer, bytesRead);
+      if (!status.IsOK())
+         throw std::runtime_error("Cannot read from '" + fUrl + "', error: " + status.ToStr());
+      totalBytes += bytesRead;
+      if (bytesRead < request)
+         break;
+      buffer = reinterpret_cast<unsigned char *>(buffer) + bytesRead;
+      nbytes -= bytesRead;
+      offset += bytesRead;
+   }
+   return totalBytes;
+}
+
+void ROOT::Internal::RRawFileNetXNG::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   XrdCl::ChunkList chunks;
+   auto fnSend = [&]() {
+      if (chunks.empty())
+         return;
+      XrdCl::VectorReadInfo *info = nullptr;
+      auto status = fFile->VectorRead(chunks, nullptr, info);
+      delete info;
+      if (!status.IsOK())
+         throw std::runtime_error("Cannot do vector read from '" + fUrl + "', error: " + status.ToStr());
+      chunks.clear();
+   };
+
+   for (unsigned int i = 0; i < nReq; ++i) {
+      // Requests are cut at the end of the file, which the server would treat as an error
+      ioVec[i].fOutBytes = 0;
+      if (ioVec[i].fOffset < fSize)
+         ioVec[i].fOutBytes = std::min<std::uint64_t>(ioVec[i].fSize, fSize - ioVec[i].fOffset);
+      auto buffer = reinterpret_cast<unsigned char *>(ioVec[i].fBuffer);
+      for (std::size_t pos = 0; pos < ioVec[i].fOutBytes; pos += kReadvIorMax) {
+         const std::uint32_t length = std::min<std::size_t>(kReadvIorMax, ioVec[i].fOutBytes - pos);
+         chunks.emplace_back(ioVec[i].fOffset + pos, length, buffer + pos);
+         if (chunks.size() == kReadvIovMax)
+            fnSend();
+      }
+   }
+   fnSend();
+}
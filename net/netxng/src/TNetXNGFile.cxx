@@ -25,6 +25,7 @@
 #include "TTimeStamp.h"
 #include "TVirtualPerfStats.h"
 #include "TVirtualMonitoring.h"
+#include "TMath.h"
 #include <XrdCl/XrdClURL.hh>
 #include <XrdCl/XrdClFile.hh>
 #include <XrdCl/XrdClXRootDResponses.hh>
@@ -86,9 +87,10 @@ class TAsyncReadvHandler: public XrdCl::ResponseHandler
       //////////////////////////////////////////////////////////////////////////
 
       TAsyncReadvHandler(std::vector<XrdCl::XRootDStatus*> *statuses,
+                         std::vector<Double_t>             *endTimes,
                          Int_t                              statusIndex,
                          TSemaphore                        *semaphore):
-         fStatuses(statuses), fStatusIndex(statusIndex), fSemaphore(semaphore) {}
+         fStatuses(statuses), fEndTimes(endTimes), fStatusIndex(statusIndex), fSemaphore(semaphore) {}
 
 
       //------------------------------------------------------------------------
@@ -99,6 +101,7 @@ class TAsyncReadvHandler: public XrdCl::ResponseHandler
                                   XrdCl::AnyObject    *response)
       {
          fStatuses->at(fStatusIndex) = status;
+         fEndTimes->at(fStatusIndex) = TTimeStamp().AsDouble();
          fSemaphore->Post();
          delete response;
          delete this;
@@ -106,6 +109,7 @@ class TAsyncReadvHandler: public XrdCl::ResponseHandler
 
    private:
       std::vector<XrdCl::XRootDStatus*> *fStatuses;    // Pointer to status vector
+      std::vector<Double_t>             *fEndTimes;    // Completion time of each request
       Int_t                              fStatusIndex; // Index into status vector
       TSemaphore                        *fSemaphore;   // Synchronize the responses
 };
@@ -162,6 +166,8 @@ TNetXNGFile::TNetXNGFile(const char *url,
    fQueryReadVParams = 1;
    fReadvIorMax = 2097136;
    fReadvIovMax = 1024;
+   fReadvParallel = 1;
+   fReadvMinRequest = 0;
 
    if (ParseOpenMode(mode, fOption, fMode, kTRUE)<0) {
       Error("Open", "could not parse open mode %s", mode);
@@ -477,8 +483,6 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
 
    std::vector<ChunkList>      chunkLists;
    ChunkList                   chunks;
-   std::vector<XRootDStatus*> *statuses;
-   TSemaphore                 *semaphore;
    Int_t                       totalBytes = 0;
    Long64_t                    offset     = 0;
    char                       *cursor     = buffer;
@@ -490,10 +494,30 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
       for (Int_t i = 0; i < nbuffs; i++)
          position[i] += fArchiveOffset;
 
-   // Build a list of chunks. Put the buffers in the ChunkInfo's
-   for (Int_t i = 0; i < nbuffs; ++i) {
+   for (Int_t i = 0; i < nbuffs; ++i)
       totalBytes += length[i];
 
+   // Split large reads in several requests of similar size, which are served
+   // concurrently, rather than waiting for a single huge request
+   Long64_t requestBytes = totalBytes;
+   if (fReadvParallel > 1)
+      requestBytes = TMath::Max((Long64_t) (totalBytes / fReadvParallel), (Long64_t) fReadvMinRequest);
+   Long64_t listBytes = 0;
+
+   // Add a chunk to the current list, and start another list if it is full
+   auto addChunk = [&](Long64_t chunkOffset, Int_t chunkLength) {
+      chunks.push_back(ChunkInfo(chunkOffset, chunkLength, cursor));
+      cursor += chunkLength;
+      listBytes += chunkLength;
+      if ((Int_t) chunks.size() >= fReadvIovMax || listBytes >= requestBytes) {
+         chunkLists.push_back(chunks);
+         chunks = ChunkList();
+         listBytes = 0;
+      }
+   };
+
+   // Build a list of chunks. Put the buffers in the ChunkInfo's
+   for (Int_t i = 0; i < nbuffs; ++i) {
       // If the length is bigger than max readv size, split into smaller chunks
       if (length[i] > fReadvIorMax) {
          Int_t nsplit = length[i] / fReadvIorMax;
@@ -503,27 +527,16 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
          // Add as many max-size chunks as are divisible
          for (j = 0; j < nsplit; ++j) {
             offset = position[i] + (j * fReadvIorMax);
-            chunks.push_back(ChunkInfo(offset, fReadvIorMax, cursor));
-            cursor += fReadvIorMax;
+            addChunk(offset, fReadvIorMax);
          }
 
          // Add the remainder
-         offset = position[i] + (j * fReadvIorMax);
-         chunks.push_back(ChunkInfo(offset, rem, cursor));
-         cursor += rem;
+         if (rem > 0) {
+            offset = position[i] + (j * fReadvIorMax);
+            addChunk(offset, rem);
+         }
       } else {
-         chunks.push_back(ChunkInfo(position[i], length[i], cursor));
-         cursor += length[i];
-      }
-
-      // If there are more than or equal to max chunks, make another chunk list
-      if ((Int_t) chunks.size() == fReadvIovMax) {
-         chunkLists.push_back(chunks);
-         chunks = ChunkList();
-      } else if ((Int_t) chunks.size() > fReadvIovMax) {
-         chunkLists.push_back(ChunkList(chunks.begin(),
-                                        chunks.begin() + fReadvIovMax));
-         chunks = ChunkList(chunks.begin() + fReadvIovMax, chunks.end());
+         addChunk(position[i], length[i]);
       }
    }
 
@@ -531,49 +544,51 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    if( !chunks.empty() )
       chunkLists.push_back(chunks);
 
-   TAsyncReadvHandler *handler;
-   XRootDStatus        status;
-   semaphore = new TSemaphore(0);
-   statuses  = new std::vector<XRootDStatus*>(chunkLists.size());
+   TAsyncReadvHandler          *handler;
+   XRootDStatus                 status;
+   TSemaphore                   semaphore(0);
+   std::vector<XRootDStatus*>   statuses(chunkLists.size(), nullptr);
+   std::vector<Double_t>        endTimes(chunkLists.size(), 0);
+   Double_t                     sent = TTimeStamp().AsDouble();
+   Bool_t                       failed = kFALSE;
 
    // Read asynchronously but wait for all responses
-   std::vector<ChunkList>::iterator it;
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it)
+   std::size_t nsent = 0;
+   for (; nsent < chunkLists.size(); ++nsent)
    {
-      handler = new TAsyncReadvHandler(statuses, it - chunkLists.begin(),
-                                       semaphore);
-      status = fFile->VectorRead(*it, 0, handler);
+      handler = new TAsyncReadvHandler(&statuses, &endTimes, nsent, &semaphore);
+      status = fFile->VectorRead(chunkLists[nsent], 0, handler);
 
       if (!status.IsOK()) {
          Error("ReadBuffers", "%s", status.ToStr().c_str());
-         return kTRUE;
+         delete handler;
+         failed = kTRUE;
+         break;
       }
    }
 
-   // Wait for all responses
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
-      semaphore->Wait();
+   // Wait for all responses, also after a failure: the handlers use the statuses
+   for (std::size_t i = 0; i < nsent; ++i) {
+      semaphore.Wait();
    }
 
    // Check for errors
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
-      XRootDStatus *st = statuses->at(it - chunkLists.begin());
+   for (std::size_t i = 0; i < nsent; ++i) {
+      XRootDStatus *st = statuses[i];
 
-      if (!st->IsOK()) {
+      if (!failed && !st->IsOK()) {
          Error("ReadBuffers", "%s", st->ToStr().c_str());
-         for( ; it != chunkLists.end(); ++it )
-         {
-            st = statuses->at( it - chunkLists.begin() );
-            delete st;
-         }
-         delete statuses;
-         delete semaphore;
-
-         return kTRUE;
+         failed = kTRUE;
       }
+      if (gDebug > 1)
+         Info("ReadBuffers", "request %d of %d: %d chunks, latency %.1f ms", (Int_t) i + 1,
+              (Int_t) chunkLists.size(), (Int_t) chunkLists[i].size(), 1000 * (endTimes[i] - sent));
       delete st;
    }
 
+   if (failed)
+      return kTRUE;
+
    // Bump the globals
    fBytesRead  += totalBytes;
    fgBytesRead += totalBytes;
@@ -588,8 +603,6 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    if (gMonitoringWriter)
       gMonitoringWriter->SendFileReadProgress(this);
 
-   delete statuses;
-   delete semaphore;
    return kFALSE;
 }
 
@@ -877,6 +890,8 @@ void TNetXNGFile::SetEnv()
       env->PutString("ClientMonitorParam", val.Data());
 
    fQueryReadVParams = gEnv->GetValue("NetXNG.QueryReadVParams", 1);
+   fReadvParallel = TMath::Max(1, gEnv->GetValue("NetXNG.ReadvParallelRequests", 4));
+   fReadvMinRequest = TMath::Max(0, gEnv->GetValue("NetXNG.ReadvMinRequestSize", 1048576));
    env->PutInt( "MultiProtocol", gEnv->GetValue("TFile.CrossProtocolRedirects", 1));
 
    // Old style netrc file
@@ -26,4 +26,8 @@
 
 #pragma link C++ class TProofPerfAnalysis+;
 
+#ifdef R__HAS_DATAFRAME
+#pragma link C++ class TExecutorBench+;
+#endif
+
 #endif
@@ -0,0 +1,119 @@
+// @(#)root/proof:$Id$
+
+/*************************************************************************
+ * Copyright (C) 2020, Rene Brun and Fons Rademakers.                    *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TExecutorBench
+#define ROOT_TExecutorBench
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TExecutorBench                                                       //
+//                                                                      //
+// Scaling benchmark of the local parallel execution engines            //
+// (TTreeProcessorMT, TProcessExecutor/TTreeProcessorMP and             //
+// RDataFrame), with the CPU and data read tests of TProofBench.        //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+#include "TString.h"
+#include "TProofBenchTypes.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+class TCanvas;
+class TList;
+class TProfile;
+
+class TExecutorBench : public TObject {
+
+public:
+   enum EEngine {
+      kThreads = 1,                                      // TThreadExecutor and TTreeProcessorMT
+      kProcesses = 2,                                    // TProcessExecutor and TTreeProcessorMP
+      kDataFrame = 4,                                    // RDataFrame with implicit multi-threading
+      kAllEngines = kThreads | kProcesses | kDataFrame
+   };
+
+private:
+   TString      fOutFileName;           //file where the performance plots are saved
+   TString      fDataDir;               //directory of the files of the data read test
+   Int_t        fEngines;               //engines to benchmark, combination of EEngine
+
+   Int_t        fNFiles;                //number of files of the data read test
+   Long64_t     fNEventsPerFile;        //number of events per file
+   Int_t        fNTracks;               //number of tracks per event
+   std::vector<std::string> fFiles;     //files of the data read test
+
+   Long64_t     fNEvents;               //number of events of the CPU test
+   Int_t        fNHists;                //number of histograms filled by the CPU test
+
+   Int_t        fStart;                 //start number of workers to scan
+   Int_t        fStop;                  //stop number of workers to scan, -1 for the number of cores
+   Int_t        fStep;                  //test to be performed every fStep workers
+   Int_t        fNTries;                //number of tries for each number of workers
+   Bool_t       fReleaseCache;          //release the memory cache of the files before each read
+
+   TList       *fListPerfPlots;         //list of performance plots
+   TCanvas     *fCanvas;                //canvas for performance plots
+
+   Long64_t GenerateFile(const char *filename, Long64_t nevents);
+   Double_t GetMBytes(TPBReadType::EReadType type) const;
+   void     ReleaseCache() const;
+   TProfile *GetProfile(const TString &name, const TString &title, Int_t start, Int_t stop, Int_t step);
+   Int_t    Scan(const TString &run, Long64_t nevents, Double_t mbytes, Int_t start, Int_t stop, Int_t step,
+                 std::function<void(EEngine, Int_t)> process);
+
+public:
+   TExecutorBench(const char *outfile = "executorbench.root", const char *datadir = 0);
+
+   virtual ~TExecutorBench();
+
+   Int_t MakeDataSet(Int_t nfiles = -1, Long64_t nevents = -1, Int_t ntracks = -1, Bool_t regenerate = kFALSE);
+
+   Int_t RunCPU(Long64_t nevents = -1, Int_t start = -1, Int_t stop = -1, Int_t step = -1);
+   Int_t RunDataRead(TPBReadType *readtype = 0, Int_t start = -1, Int_t stop = -1, Int_t step = -1);
+
+   void DrawPerfPlots(const char *run = "CPU");
+
+   void Print(Option_t *option = "") const;
+
+   void SetOutFileName(const char *outfile) { fOutFileName = outfile; }
+   void SetDataDir(const char *datadir) { fDataDir = datadir; }
+   void SetEngines(Int_t engines) { fEngines = engines; }
+   void SetNHists(Int_t nhists) { fNHists = nhists; }
+   void SetNEvents(Long64_t nevents) { fNEvents = nevents; }
+   void SetNTries(Int_t ntries) { fNTries = ntries; }
+   void SetStart(Int_t start) { fStart = start; }
+   void SetStop(Int_t stop) { fStop = stop; }
+   void SetStep(Int_t step) { fStep = step; }
+   void SetReleaseCache(Bool_t release = kTRUE) { fReleaseCache = release; }
+
+   const char *GetOutFileName() const { return fOutFileName; }
+   const char *GetDataDir() const { return fDataDir; }
+   Int_t GetEngines() const { return fEngines; }
+   Int_t GetNHists() const { return fNHists; }
+   Long64_t GetNEvents() const { return fNEvents; }
+   Int_t GetNTries() const { return fNTries; }
+   Int_t GetStart() const { return fStart; }
+   Int_t GetStop() const { return fStop; }
+   Int_t GetStep() const { return fStep; }
+   Bool_t GetReleaseCache() const { return fReleaseCache; }
+   const std::vector<std::string> &GetFiles() const { return fFiles; }
+   TList *GetListPerfPlots() const { return fListPerfPlots; }
+   TCanvas *GetCanvas() const { return fCanvas; }
+
+   static const char *GetEngineName(EEngine engine);
+
+   ClassDef(TExecutorBench,0)     //Scaling benchmark of the local parallel execution engines
+};
+
+#endif
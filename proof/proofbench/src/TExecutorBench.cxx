@@ -0,0 +1,671 @@
+// @(#)root/proof:$Id$
+
+/*************************************************************************
+ * Copyright (C) 2020, Rene Brun and Fons Rademakers.                    *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TExecutorBench
+\ingroup proofbench
+
+Scaling benchmark of the local parallel execution engines, replacing
+TProofBench for the nodes running without PROOF. The two tests of
+TProofBench are run with a scan of the number of workers:
+
+ - RunCPU(): CPU-intensive test, generating events and filling GetNHists()
+   histograms with them like TSelHist, without any I/O;
+ - RunDataRead(): data read test on a dataset generated by MakeDataSet(),
+   TSelEventGen-style, reading the full events (TPBReadType::kReadFull), the
+   number of tracks and the transverse momenta (TPBReadType::kReadOpt) or
+   nothing (TPBReadType::kReadNo) like TSelEvent.
+
+The engines (see SetEngines()) are
+ - kThreads: ROOT::TThreadExecutor for the CPU test and
+   ROOT::TTreeProcessorMT for the data read test,
+ - kProcesses: ROOT::TProcessExecutor and ROOT::TTreeProcessorMP,
+ - kDataFrame: ROOT::RDataFrame with the implicit multi-threading.
+
+For each engine and number of workers the test is run GetNTries() times and
+the profiles "<test>_<engine>_Rate" (events/s), "<test>_<engine>_IO"
+(MB/s of compressed data read, data read test only) and
+"<test>_<engine>_Eff" are filled. The efficiency is the rate divided by the
+number of workers times the rate per worker of the first point of the scan.
+The profiles are saved in the directory "ExecutorBench" of the output file
+and can be drawn with DrawPerfPlots().
+
+Example:
+~~~{.cpp}
+   TExecutorBench bench("bench.root", "/data/bench");
+   bench.RunCPU(1000000, 1, 16, 1);
+   bench.MakeDataSet(16, 100000);
+   bench.RunDataRead(new TPBReadType(TPBReadType::kReadFull), 1, 16, 1);
+   bench.DrawPerfPlots("DataReadFull");
+~~~
+*/
+
+#include "TExecutorBench.h"
+
+#include "TBranch.h"
+#include "TCanvas.h"
+#include "TError.h"
+#include "TFile.h"
+#include "TH2.h"
+#include "TLegend.h"
+#include "TList.h"
+#include "TProfile.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+#include "TStopwatch.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+#include "TTreeReaderArray.h"
+#include "TTreeReaderValue.h"
+
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TTreeProcessorMP.hxx"
+#include "PoolUtils.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadedObject.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TTreeProcessorMT.hxx"
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <memory>
+
+#if defined(R__LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+ClassImp(TExecutorBench);
+
+namespace {
+
+const char *const kTreeName = "EventTree";
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill nhists histograms, the rows of the returned TH2D, with n events
+/// of the CPU test. The random numbers are seeded with the first event.
+
+TH2D *FillHists(Long64_t first, Long64_t n, Int_t nhists)
+{
+   auto h = new TH2D("hcpu", "CPU test", 100, -4., 4., nhists, 0., nhists);
+   h->SetDirectory(nullptr);
+   TRandom3 rnd(first + 1);
+   for (Long64_t i = 0; i < n; i++) {
+      for (Int_t j = 0; j < nhists; j++)
+         h->Fill(rnd.Gaus(), j + 0.5);
+   }
+   return h;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// First events of the chunks of the CPU test.
+
+std::vector<Long64_t> GetChunks(Long64_t nevents, Long64_t chunksize)
+{
+   std::vector<Long64_t> firsts;
+   for (Long64_t first = 0; first < nevents; first += chunksize)
+      firsts.push_back(first);
+   return firsts;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the events of the reader like TSelEvent and fill the momenta of the
+/// tracks, weighted by their inverse, in h.
+
+void ReadEvents(TTreeReader &reader, TH1D *h, TPBReadType::EReadType type)
+{
+   if (type == TPBReadType::kReadNo) {
+      while (reader.Next()) {
+      }
+      return;
+   }
+   TTreeReaderValue<Int_t> ntrack(reader, "fNtrack");
+   TTreeReaderArray<Float_t> px(reader, "fPx");
+   TTreeReaderArray<Float_t> py(reader, "fPy");
+   std::unique_ptr<TTreeReaderValue<Float_t>> temperature;
+   std::unique_ptr<TTreeReaderArray<Float_t>> pz;
+   if (type == TPBReadType::kReadFull) {
+      temperature.reset(new TTreeReaderValue<Float_t>(reader, "fTemperature"));
+      pz.reset(new TTreeReaderArray<Float_t>(reader, "fPz"));
+   }
+   while (reader.Next()) {
+      if (*ntrack <= 0 || (temperature && **temperature < 0))
+         continue;
+      for (Int_t j = 0; j < *ntrack; j++) {
+         Double_t p2 = px[j] * px[j] + py[j] * py[j];
+         if (pz)
+            p2 += (*pz)[j] * (*pz)[j];
+         const Double_t p = std::sqrt(p2);
+         h->Fill(p, 1. / p);
+      }
+   }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor. The performance plots are saved in outfile (not saved if
+/// it is empty), the files of the data read test are generated in datadir,
+/// by default <tmp>/executorbench.
+
+TExecutorBench::TExecutorBench(const char *outfile, const char *datadir)
+   : fOutFileName(outfile), fDataDir(datadir), fEngines(kAllEngines), fNFiles(4), fNEventsPerFile(100000),
+     fNTracks(100), fNEvents(1000000), fNHists(16), fStart(1), fStop(-1), fStep(1), fNTries(2),
+     fReleaseCache(kTRUE), fListPerfPlots(new TList), fCanvas(0)
+{
+   if (fDataDir.IsNull())
+      fDataDir = TString::Format("%s/executorbench", gSystem->TempDirectory());
+   fListPerfPlots->SetOwner(kTRUE);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor
+
+TExecutorBench::~TExecutorBench()
+{
+   delete fListPerfPlots;
+   delete fCanvas;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of the engine, used in the names of the profiles.
+
+const char *TExecutorBench::GetEngineName(EEngine engine)
+{
+   switch (engine) {
+   case kThreads: return "MT";
+   case kProcesses: return "MP";
+   case kDataFrame: return "RDF";
+   default: return "";
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate, in the data directory, the nfiles files of nevents events of
+/// ntracks tracks each of the data read test (-1 to keep the current
+/// values). The existing files with these numbers of events and tracks are
+/// reused, unless regenerate is kTRUE.
+/// Return 0 on success, -1 in case of error.
+
+Int_t TExecutorBench::MakeDataSet(Int_t nfiles, Long64_t nevents, Int_t ntracks, Bool_t regenerate)
+{
+   if (nfiles > 0) fNFiles = nfiles;
+   if (nevents > 0) fNEventsPerFile = nevents;
+   if (ntracks > 0) fNTracks = ntracks;
+
+   fFiles.clear();
+   if (gSystem->AccessPathName(fDataDir) && gSystem->mkdir(fDataDir, kTRUE) != 0) {
+      Error("MakeDataSet", "cannot create the data directory %s", fDataDir.Data());
+      return -1;
+   }
+
+   const TString title = TString::Format("Event Tree (%d tracks)", fNTracks);
+   for (Int_t i = 0; i < fNFiles; i++) {
+      TString filename = TString::Format("%s/event_tree_%d.root", fDataDir.Data(), i);
+      Bool_t reuse = kFALSE;
+      if (!regenerate && !gSystem->AccessPathName(filename)) {
+         TDirectory::TContext ctx;
+         std::unique_ptr<TFile> f(TFile::Open(filename));
+         TTree *tree = (f && !f->IsZombie()) ? f->Get<TTree>(kTreeName) : nullptr;
+         reuse = tree && tree->GetEntries() == fNEventsPerFile && title == tree->GetTitle();
+      }
+      if (!reuse && GenerateFile(filename, fNEventsPerFile) != fNEventsPerFile) {
+         Error("MakeDataSet", "cannot generate the file %s", filename.Data());
+         fFiles.clear();
+         return -1;
+      }
+      fFiles.push_back(filename.Data());
+   }
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate a file of nevents events, with the flat layout of the events
+/// of TSelEventGen: number of tracks, temperature and momenta of the tracks.
+/// Return the number of entries of the tree, 0 in case of error.
+
+Long64_t TExecutorBench::GenerateFile(const char *filename, Long64_t nevents)
+{
+   TDirectory::TContext ctx;
+   std::unique_ptr<TFile> f(TFile::Open(filename, "RECREATE"));
+   if (!f || f->IsZombie())
+      return 0;
+
+   Int_t ntrack = fNTracks;
+   Float_t temperature;
+   std::vector<Float_t> px(fNTracks), py(fNTracks), pz(fNTracks);
+   auto tree = new TTree(kTreeName, TString::Format("Event Tree (%d tracks)", fNTracks));
+   tree->Branch("fNtrack", &ntrack, "fNtrack/I");
+   tree->Branch("fTemperature", &temperature, "fTemperature/F");
+   tree->Branch("fPx", px.data(), "fPx[fNtrack]/F");
+   tree->Branch("fPy", py.data(), "fPy[fNtrack]/F");
+   tree->Branch("fPz", pz.data(), "fPz[fNtrack]/F");
+
+   Info("GenerateFile", "Generating %s", filename);
+   TRandom3 rnd(TString(filename).Hash());
+   for (Long64_t i = 0; i < nevents; i++) {
+      temperature = 20 + rnd.Rndm();
+      for (Int_t j = 0; j < ntrack; j++) {
+         rnd.Rannor(px[j], py[j]);
+         pz[j] = rnd.Gaus(0, 10);
+      }
+      tree->Fill();
+   }
+   const Long64_t nentries = tree->GetEntries();
+   f->Write();
+   f->Close();
+   Info("GenerateFile", "%s generated with %lld entries", filename, nentries);
+   return nentries;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the compressed size, in MB, of the branches of the dataset read
+/// by the data read test of the given type.
+
+Double_t TExecutorBench::GetMBytes(TPBReadType::EReadType type) const
+{
+   std::vector<const char *> branches;
+   if (type == TPBReadType::kReadOpt)
+      branches = {"fNtrack", "fPx", "fPy"};
+   else if (type == TPBReadType::kReadFull)
+      branches = {"fNtrack", "fTemperature", "fPx", "fPy", "fPz"};
+
+   Long64_t bytes = 0;
+   for (const auto &filename : fFiles) {
+      TDirectory::TContext ctx;
+      std::unique_ptr<TFile> f(TFile::Open(filename.c_str()));
+      TTree *tree = (f && !f->IsZombie()) ? f->Get<TTree>(kTreeName) : nullptr;
+      if (!tree)
+         continue;
+      for (auto name : branches) {
+         if (TBranch *branch = tree->GetBranch(name))
+            bytes += branch->GetZipBytes("*");
+      }
+   }
+   return bytes / 1.e6;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the memory cache of the files of the dataset, like TSelHandleDataSet.
+
+void TExecutorBench::ReleaseCache() const
+{
+#if defined(R__LINUX)
+   for (const auto &filename : fFiles) {
+      Int_t fd = open(filename.c_str(), O_RDONLY);
+      if (fd > -1) {
+         fdatasync(fd);
+         posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+         close(fd);
+      } else {
+         Error("ReleaseCache", "cannot open file '%s' for cache clean up; errno=%d", filename.c_str(), errno);
+      }
+   }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the profile of the scan, replacing the one of the same name.
+
+TProfile *TExecutorBench::GetProfile(const TString &name, const TString &title, Int_t start, Int_t stop, Int_t step)
+{
+   if (TObject *old = fListPerfPlots->FindObject(name)) {
+      fListPerfPlots->Remove(old);
+      delete old;
+   }
+   const Int_t nbins = (stop - start) / step + 1;
+   auto profile = new TProfile(name, title, nbins, start - step / 2., start + (nbins - 0.5) * step);
+   profile->SetDirectory(nullptr);
+   fListPerfPlots->Add(profile);
+   return profile;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run process, processing nevents events (and reading mbytes MB) for the
+/// given engine and number of workers, for each engine and number of workers
+/// of the scan, fill the profiles of the test run and save them.
+/// Return 0 on success, -1 in case of error.
+
+Int_t TExecutorBench::Scan(const TString &run, Long64_t nevents, Double_t mbytes, Int_t start, Int_t stop,
+                           Int_t step, std::function<void(EEngine, Int_t)> process)
+{
+   if (start > 0) fStart = start;
+   if (stop > 0) fStop = stop;
+   if (step > 0) fStep = step;
+   start = fStart;
+   step = fStep;
+   stop = fStop;
+   if (stop <= 0) {
+      SysInfo_t si;
+      gSystem->GetSysInfo(&si);
+      stop = si.fCpus > 0 ? si.fCpus : 1;
+   }
+   if (start < 1 || step < 1 || stop < start) {
+      Error("Scan", "invalid scan of the number of workers: start=%d stop=%d step=%d", start, stop, step);
+      return -1;
+   }
+
+   // Each point of the scan sets its own thread pool
+#ifdef R__USE_IMT
+   const Bool_t wasMT = ROOT::IsImplicitMTEnabled();
+   const UInt_t wasPoolSize = wasMT ? ROOT::GetThreadPoolSize() : 0;
+   if (wasMT)
+      ROOT::DisableImplicitMT();
+#endif
+   const Bool_t addDirectory = TH1::AddDirectoryStatus();
+   TH1::AddDirectory(kFALSE);
+
+   TList profiles;
+   for (EEngine engine : {kThreads, kProcesses, kDataFrame}) {
+      if (!(fEngines & engine))
+         continue;
+#ifndef R__USE_IMT
+      if (engine != kProcesses) {
+         Warning("Scan", "ROOT was built without implicit multi-threading: engine %s skipped", GetEngineName(engine));
+         continue;
+      }
+#endif
+      const TString stem = TString::Format("%s_%s", run.Data(), GetEngineName(engine));
+      TProfile *rate = GetProfile(stem + "_Rate", stem + " event rate;Number of workers;Events/s", start, stop, step);
+      TProfile *io = mbytes > 0 ? GetProfile(stem + "_IO", stem + " I/O throughput;Number of workers;MB/s",
+                                             start, stop, step)
+                                : nullptr;
+      TProfile *eff = GetProfile(stem + "_Eff", stem + " efficiency;Number of workers;Efficiency", start, stop, step);
+      profiles.Add(rate);
+      if (io)
+         profiles.Add(io);
+      profiles.Add(eff);
+
+      Double_t refRate = 0; // rate per worker of the first point
+      for (Int_t nworkers = start; nworkers <= stop; nworkers += step) {
+#ifdef R__USE_IMT
+         if (engine != kProcesses)
+            ROOT::EnableImplicitMT(nworkers);
+#endif
+         std::vector<Double_t> rates;
+         for (Int_t i = 0; i < fNTries; i++) {
+            if (mbytes > 0 && fReleaseCache)
+               ReleaseCache();
+            TStopwatch timer;
+            process(engine, nworkers);
+            timer.Stop();
+            const Double_t realtime = std::max(timer.RealTime(), 1.e-6);
+            rates.push_back(nevents / realtime);
+            rate->Fill(nworkers, nevents / realtime);
+            if (io)
+               io->Fill(nworkers, mbytes / realtime);
+            Info("Scan", "%s with %d workers (try %d): %.1f s, %.0f events/s", stem.Data(), nworkers, i + 1,
+                 realtime, nevents / realtime);
+         }
+#ifdef R__USE_IMT
+         if (engine != kProcesses)
+            ROOT::DisableImplicitMT();
+#endif
+         if (refRate <= 0 && !rates.empty())
+            refRate = rate->GetBinContent(rate->FindBin(nworkers)) / nworkers;
+         for (auto r : rates)
+            eff->Fill(nworkers, refRate > 0 ? r / (nworkers * refRate) : 0.);
+      }
+   }
+
+   TH1::AddDirectory(addDirectory);
+#ifdef R__USE_IMT
+   if (wasMT)
+      ROOT::EnableImplicitMT(wasPoolSize);
+#endif
+
+   if (!fOutFileName.IsNull() && profiles.GetSize() > 0) {
+      TDirectory::TContext ctx;
+      std::unique_ptr<TFile> f(TFile::Open(fOutFileName, "UPDATE"));
+      if (!f || f->IsZombie()) {
+         Error("Scan", "cannot open the output file %s", fOutFileName.Data());
+         return -1;
+      }
+      TDirectory *dir = f->GetDirectory("ExecutorBench");
+      if (!dir)
+         dir = f->mkdir("ExecutorBench");
+      dir->cd();
+      TIter next(&profiles);
+      while (TObject *obj = next())
+         obj->Write(0, TObject::kOverwrite);
+   }
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run the CPU test, generating nevents events (-1 for GetNEvents()) with
+/// every engine and number of workers from start to stop every step
+/// workers (-1 to keep the current values, with a default stop of the
+/// number of cores). Return 0 on success, -1 in case of error.
+
+Int_t TExecutorBench::RunCPU(Long64_t nevents, Int_t start, Int_t stop, Int_t step)
+{
+   if (nevents > 0) fNEvents = nevents;
+   const Long64_t nev = fNEvents;
+   const Int_t nhists = fNHists;
+
+   auto process = [nev, nhists](EEngine engine, Int_t nworkers) {
+      // Several chunks per worker to balance the load
+      const Long64_t chunksize = std::max(nev / (4 * nworkers), 1LL);
+      auto firsts = GetChunks(nev, chunksize);
+      auto fill = [nev, nhists, chunksize](Long64_t first) {
+         return FillHists(first, std::min(chunksize, nev - first), nhists);
+      };
+      std::unique_ptr<TH2D> h;
+      switch (engine) {
+      case kThreads: {
+#ifdef R__USE_IMT
+         ROOT::TThreadExecutor pool(nworkers);
+         h.reset(pool.MapReduce(fill, firsts, ROOT::ExecutorUtils::ReduceObjects<TH2D *>()));
+#endif
+         break;
+      }
+      case kProcesses: {
+         ROOT::TProcessExecutor pool(nworkers);
+         h.reset(pool.MapReduce(fill, firsts, ROOT::ExecutorUtils::ReduceObjects<TH2D *>()));
+         break;
+      }
+      case kDataFrame: {
+         const UInt_t nslots = ROOT::IsImplicitMTEnabled() ? ROOT::GetThreadPoolSize() : 1;
+         std::vector<TRandom3> rnds(nslots);
+         for (UInt_t i = 0; i < nslots; i++)
+            rnds[i].SetSeed(i + 1);
+         ROOT::VecOps::RVec<Double_t> rows(nhists);
+         for (Int_t j = 0; j < nhists; j++)
+            rows[j] = j + 0.5;
+         ROOT::RDataFrame df(nev);
+         auto result = df.DefineSlot("x",
+                                     [&rnds, nhists](unsigned int slot) {
+                                        ROOT::VecOps::RVec<Double_t> x(nhists);
+                                        for (auto &v : x)
+                                           v = rnds[slot].Gaus();
+                                        return x;
+                                     })
+                          .Define("row", [&rows] { return rows; })
+                          .Histo2D<ROOT::VecOps::RVec<Double_t>, ROOT::VecOps::RVec<Double_t>>(
+                             {"hcpu", "CPU test", 100, -4., 4., nhists, 0., Double_t(nhists)}, "x", "row");
+         h.reset(static_cast<TH2D *>(result->Clone()));
+         break;
+      }
+      default: break;
+      }
+      if (!h || h->GetEntries() != Double_t(nev) * nhists)
+         ::Error("TExecutorBench::RunCPU", "%s did not process all the events", GetEngineName(engine));
+   };
+
+   return Scan("CPU", nev, 0, start, stop, step, process);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run the data read test of the given type (TPBReadType::kReadOpt by
+/// default) on the dataset, generated with the current parameters if
+/// MakeDataSet() was not called, with every engine and number of workers
+/// from start to stop every step workers (-1 to keep the current values).
+/// Return 0 on success, -1 in case of error.
+
+Int_t TExecutorBench::RunDataRead(TPBReadType *readtype, Int_t start, Int_t stop, Int_t step)
+{
+   if (fFiles.empty() && MakeDataSet() != 0)
+      return -1;
+
+   const TPBReadType::EReadType type = readtype ? readtype->GetType() : TPBReadType::kReadOpt;
+   TString run = "DataRead";
+   switch (type) {
+   case TPBReadType::kReadFull: run += "Full"; break;
+   case TPBReadType::kReadOpt: run += "Opt"; break;
+   case TPBReadType::kReadNo: run += "No"; break;
+   default:
+      Error("RunDataRead", "read type not supported; %d", type);
+      return -1;
+   }
+
+   const std::vector<std::string> files = fFiles;
+   auto process = [&files, type](EEngine engine, Int_t nworkers) {
+      switch (engine) {
+      case kThreads: {
+#ifdef R__USE_IMT
+         ROOT::TThreadedObject<TH1D> h("pt_dist", "p Distribution", 100, 0., 5.);
+         std::vector<std::string_view> names(files.begin(), files.end());
+         ROOT::TTreeProcessorMT processor(names, kTreeName, nworkers);
+         processor.Process([&h, type](TTreeReader &reader) { ReadEvents(reader, h.Get().get(), type); });
+         h.Merge();
+#endif
+         break;
+      }
+      case kProcesses: {
+         ROOT::TTreeProcessorMP processor(nworkers);
+         std::unique_ptr<TH1D> h(processor.Process(files,
+                                                   [type](TTreeReader &reader) {
+                                                      auto hw = new TH1D("pt_dist", "p Distribution", 100, 0., 5.);
+                                                      ReadEvents(reader, hw, type);
+                                                      return hw;
+                                                   },
+                                                   kTreeName));
+         break;
+      }
+      case kDataFrame: {
+         using ROOT::VecOps::RVec;
+         ROOT::RDataFrame df(kTreeName, files);
+         if (type == TPBReadType::kReadNo) {
+            *df.Count();
+            break;
+         }
+         auto momentum = [](const RVec<Float_t> &px, const RVec<Float_t> &py) { return sqrt(px * px + py * py); };
+         auto weight = [](const RVec<Float_t> &p) { return 1.f / p; };
+         ROOT::RDF::RResultPtr<TH1D> h;
+         if (type == TPBReadType::kReadFull) {
+            h = df.Filter([](Float_t t) { return t >= 0; }, {"fTemperature"})
+                   .Define("p",
+                           [](const RVec<Float_t> &px, const RVec<Float_t> &py, const RVec<Float_t> &pz) {
+                              return sqrt(px * px + py * py + pz * pz);
+                           },
+                           {"fPx", "fPy", "fPz"})
+                   .Define("w", weight, {"p"})
+                   .Histo1D<RVec<Float_t>, RVec<Float_t>>({"pt_dist", "p Distribution", 100, 0., 5.}, "p", "w");
+         } else {
+            h = df.Define("p", momentum, {"fPx", "fPy"})
+                   .Define("w", weight, {"p"})
+                   .Histo1D<RVec<Float_t>, RVec<Float_t>>({"pt_dist", "p Distribution", 100, 0., 5.}, "p", "w");
+         }
+         h->GetEntries();
+         break;
+      }
+      default: break;
+      }
+   };
+
+   const Long64_t nevents = fNEventsPerFile * (Long64_t)fFiles.size();
+   return Scan(run, nevents, GetMBytes(type), start, stop, step, process);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Draw the performance plots of the test run ("CPU", "DataReadFull",
+/// "DataReadOpt" or "DataReadNo"): event rate, I/O throughput and
+/// efficiency versus the number of workers, for each engine.
+
+void TExecutorBench::DrawPerfPlots(const char *run)
+{
+   const char *quantities[] = {"Rate", "IO", "Eff"};
+   std::vector<std::vector<TProfile *>> plots;
+   for (auto quantity : quantities) {
+      std::vector<TProfile *> profiles;
+      for (EEngine engine : {kThreads, kProcesses, kDataFrame}) {
+         TString name = TString::Format("%s_%s_%s", run, GetEngineName(engine), quantity);
+         if (auto profile = dynamic_cast<TProfile *>(fListPerfPlots->FindObject(name)))
+            profiles.push_back(profile);
+      }
+      if (!profiles.empty())
+         plots.push_back(profiles);
+   }
+   if (plots.empty()) {
+      Error("DrawPerfPlots", "no performance plots for the test %s", run);
+      return;
+   }
+
+   if (!fCanvas)
+      fCanvas = new TCanvas("ExecutorBench", "Executor benchmark", 1200, 400);
+   fCanvas->Clear();
+   fCanvas->SetTitle(TString::Format("Executor benchmark: %s", run));
+   fCanvas->Divide(plots.size(), 1);
+   const Color_t colors[] = {kRed, kBlue, kGreen + 2};
+   for (size_t i = 0; i < plots.size(); i++) {
+      fCanvas->cd(i + 1);
+      Double_t ymax = 0;
+      for (auto profile : plots[i])
+         ymax = std::max(ymax, profile->GetMaximum());
+      auto legend = new TLegend(0.15, 0.7, 0.4, 0.88);
+      for (size_t j = 0; j < plots[i].size(); j++) {
+         TProfile *profile = plots[i][j];
+         profile->SetMinimum(0);
+         profile->SetMaximum(1.2 * ymax);
+         profile->SetStats(kFALSE);
+         profile->SetMarkerStyle(21);
+         profile->SetMarkerColor(colors[j % 3]);
+         profile->SetLineColor(colors[j % 3]);
+         profile->DrawCopy(j == 0 ? "E1" : "E1 SAME");
+         TString engine = profile->GetName();
+         engine.Remove(0, strlen(run) + 1);
+         engine.Remove(engine.Last('_'));
+         legend->AddEntry(profile, engine, "lp");
+      }
+      legend->Draw();
+   }
+   fCanvas->Update();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the settings and, with option "a", the mean of the performance
+/// plots for each number of workers.
+
+void TExecutorBench::Print(Option_t *option) const
+{
+   Printf("+++ TExecutorBench +++++++++++++++++++++++++++++++++++++++++++++++++");
+   Printf(" Output file:   %s", fOutFileName.Data());
+   Printf(" Engines:       %s%s%s", (fEngines & kThreads) ? "MT " : "", (fEngines & kProcesses) ? "MP " : "",
+          (fEngines & kDataFrame) ? "RDF" : "");
+   Printf(" Scan:          start=%d stop=%d step=%d, %d tries", fStart, fStop, fStep, fNTries);
+   Printf(" CPU test:      %lld events, %d histograms", fNEvents, fNHists);
+   Printf(" Data read:     %d files of %lld events of %d tracks in %s", fNFiles, fNEventsPerFile, fNTracks,
+          fDataDir.Data());
+   if (TString(option).Contains("a", TString::kIgnoreCase)) {
+      TIter next(fListPerfPlots);
+      while (auto profile = (TProfile *)next()) {
+         Printf(" %s", profile->GetName());
+         for (Int_t i = 1; i <= profile->GetNbinsX(); i++) {
+            if (profile->GetBinEntries(i) > 0)
+               Printf("    %4.0f workers: %g", profile->GetBinCenter(i), profile->GetBinContent(i));
+         }
+      }
+   }
+   Printf("++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++");
+}
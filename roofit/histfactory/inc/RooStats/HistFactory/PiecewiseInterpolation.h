@@ -19,6 +19,7 @@
 #include "RooAbsReal.h"
 #include "RooRealProxy.h"
 #include "RooListProxy.h"
+#include "RooArgSet.h"
 
 #include "RooObjCacheManager.h"
 
@@ -88,7 +89,17 @@ protected:
 
   std::vector<int> _interpCode;
 
+  enum BinCacheState { kBinCacheUnchecked, kBinCacheValid, kBinCacheInvalid };
+  mutable BinCacheState _binCacheState{kBinCacheUnchecked}; //! Whether the functions are read from the bin cache
+  mutable RooArgSet _binObs; //! Observables of the templates of the bin cache
+  mutable std::vector<double> _binNominal; //! Nominal template, bin by bin
+  mutable std::vector<double> _binLow; //! Low-side templates of the parameters, one after the other
+  mutable std::vector<double> _binHigh; //! High-side templates of the parameters, one after the other
+
   Double_t evaluate() const;
+  void initBinCache() const;
+  Int_t currentBin() const;
+  virtual Bool_t redirectServersHook(const RooAbsCollection& newServerList, Bool_t mustReplaceAll, Bool_t nameChange, Bool_t isRecursive);
 
   ClassDef(PiecewiseInterpolation,3) // Sum of RooAbsReal objects
 };
@@ -24,6 +24,9 @@
 #include "RooMsgService.h"
 #include "RooNumIntConfig.h"
 #include "RooTrace.h"
+#include "RooHistFunc.h"
+#include "RooDataHist.h"
+#include "RooAbsBinning.h"
 
 #include <exception>
 #include <math.h>
@@ -151,112 +154,104 @@ PiecewiseInterpolation::~PiecewiseInterpolation()
 
 
 
+namespace {
+
 ////////////////////////////////////////////////////////////////////////////////
-/// Calculate and return current value of self
+/// Add to `sum` the variation of the interpolation parameter of value `x`
+/// between the values `low`, `nominal` and `high` of the function, with the
+/// interpolation code `icode`. Return false if the code is unknown.
 
-Double_t PiecewiseInterpolation::evaluate() const 
+inline bool interpolateVariation(Double_t& sum, Int_t icode, Double_t x, Double_t nominal, Double_t low, Double_t high)
 {
-  ///////////////////
-  Double_t nominal = _nominal;
-  Double_t sum(nominal) ;
-
-  for (unsigned int i=0; i < _paramSet.size(); ++i) {
-    auto param = static_cast<RooAbsReal*>(_paramSet.at(i));
-    auto low   = static_cast<RooAbsReal*>(_lowSet.at(i));
-    auto high  = static_cast<RooAbsReal*>(_highSet.at(i));
-    Int_t icode = _interpCode[i] ;
-
-    switch(icode) {
-    case 0: {
-      // piece-wise linear
-      if(param->getVal()>0)
-	sum +=  param->getVal()*(high->getVal() - nominal );
-      else
-	sum += param->getVal()*(nominal - low->getVal());
-      break ;
-    }
-    case 1: {
-      // pice-wise log
-      if(param->getVal()>=0)
-	sum *= pow(high->getVal()/nominal, +param->getVal());
-      else
-	sum *= pow(low->getVal()/nominal,  -param->getVal());
-      break ;
-    }
-    case 2: {
-      // parabolic with linear
-      double a = 0.5*(high->getVal()+low->getVal())-nominal;
-      double b = 0.5*(high->getVal()-low->getVal());
-      double c = 0;
-      if(param->getVal()>1 ){
-	sum += (2*a+b)*(param->getVal()-1)+high->getVal()-nominal;
-      } else if(param->getVal()<-1 ) {
-	sum += -1*(2*a-b)*(param->getVal()+1)+low->getVal()-nominal;
-      } else {
-	sum +=  a*pow(param->getVal(),2) + b*param->getVal()+c;
-      }
-      break ;
+  switch(icode) {
+  case 0: {
+    // piece-wise linear
+    if(x>0)
+	sum +=  x*(high - nominal );
+    else
+	sum += x*(nominal - low);
+    break ;
+  }
+  case 1: {
+    // pice-wise log
+    if(x>=0)
+	sum *= pow(high/nominal, +x);
+    else
+	sum *= pow(low/nominal,  -x);
+    break ;
+  }
+  case 2: {
+    // parabolic with linear
+    double a = 0.5*(high+low)-nominal;
+    double b = 0.5*(high-low);
+    double c = 0;
+    if(x>1 ){
+	sum += (2*a+b)*(x-1)+high-nominal;
+    } else if(x<-1 ) {
+	sum += -1*(2*a-b)*(x+1)+low-nominal;
+    } else {
+	sum +=  a*pow(x,2) + b*x+c;
     }
-    case 3: {
-      //parabolic version of log-normal
-      double a = 0.5*(high->getVal()+low->getVal())-nominal;
-      double b = 0.5*(high->getVal()-low->getVal());
-      double c = 0;
-      if(param->getVal()>1 ){
-	sum += (2*a+b)*(param->getVal()-1)+high->getVal()-nominal;
-      } else if(param->getVal()<-1 ) {
-	sum += -1*(2*a-b)*(param->getVal()+1)+low->getVal()-nominal;
-      } else {
-	sum +=  a*pow(param->getVal(),2) + b*param->getVal()+c;
-      }
-      break ;
+    break ;
+  }
+  case 3: {
+    //parabolic version of log-normal
+    double a = 0.5*(high+low)-nominal;
+    double b = 0.5*(high-low);
+    double c = 0;
+    if(x>1 ){
+	sum += (2*a+b)*(x-1)+high-nominal;
+    } else if(x<-1 ) {
+	sum += -1*(2*a-b)*(x+1)+low-nominal;
+    } else {
+	sum +=  a*pow(x,2) + b*x+c;
     }
-    case 4: {
-      
-      // WVE ****************************************************************
-      // WVE *** THIS CODE IS CRITICAL TO HISTFACTORY FIT CPU PERFORMANCE ***
-      // WVE *** Do not modify unless you know what you are doing...      ***
-      // WVE ****************************************************************
-
-      double x  = param->getVal();      
-      if (x>1) {
-	sum += x*(high->getVal() - nominal );
-      } else if (x<-1) {
-	sum += x*(nominal - low->getVal());
-      } else {
-	double eps_plus = high->getVal() - nominal;
-	double eps_minus = nominal - low->getVal();
+    break ;
+  }
+  case 4: {
+    
+    // WVE ****************************************************************
+    // WVE *** THIS CODE IS CRITICAL TO HISTFACTORY FIT CPU PERFORMANCE ***
+    // WVE *** Do not modify unless you know what you are doing...      ***
+    // WVE ****************************************************************
+
+    if (x>1) {
+	sum += x*(high - nominal );
+    } else if (x<-1) {
+	sum += x*(nominal - low);
+    } else {
+	double eps_plus = high - nominal;
+	double eps_minus = nominal - low;
 	double S = 0.5 * (eps_plus + eps_minus);
 	double A = 0.0625 * (eps_plus - eps_minus);
 	
 	//fcns+der+2nd_der are eq at bd
 
-        double val = nominal + x * (S + x * A * ( 15 + x * x * (-10 + x * x * 3  ) ) ); 
+      double val = nominal + x * (S + x * A * ( 15 + x * x * (-10 + x * x * 3  ) ) ); 
 
 
 	if (val < 0) val = 0;
 	sum += val-nominal;
-      }
-      break ;
-
-      // WVE ****************************************************************
     }
-    case 5: {
-      
-      double x0 = 1.0;//boundary;
-      double x  = param->getVal();
+    break ;
 
-      if (x > x0 || x < -x0)
-      {
+    // WVE ****************************************************************
+  }
+  case 5: {
+    
+    double x0 = 1.0;//boundary;
+
+    if (x > x0 || x < -x0)
+    {
 	if(x>0)
-	  sum += x*(high->getVal() - nominal );
+	  sum += x*(high - nominal );
 	else
-	  sum += x*(nominal - low->getVal());
-      }
-      else if (nominal != 0)
-      {
-	double eps_plus = high->getVal() - nominal;
-	double eps_minus = nominal - low->getVal();
+	  sum += x*(nominal - low);
+    }
+    else if (nominal != 0)
+    {
+	double eps_plus = high - nominal;
+	double eps_minus = nominal - low;
 	double S = (eps_plus + eps_minus)/2;
 	double A = (eps_plus - eps_minus)/2;
 
@@ -272,14 +267,51 @@ Double_t PiecewiseInterpolation::evaluate() const
 	//cout << "Using interp code 5, val = " << val << endl;
 
 	sum += val-nominal;
-      }
-      break ;
     }
-    default: {
-      coutE(InputArguments) << "PiecewiseInterpolation::evaluate ERROR:  " << param->GetName() 
-			    << " with unknown interpolation code" << icode << endl ;
-      break ;
+    break ;
+  }
+  default:
+    return false;
+  }
+  return true;
+}
+
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Calculate and return current value of self
+
+Double_t PiecewiseInterpolation::evaluate() const 
+{
+  if (_binCacheState == kBinCacheUnchecked) {
+    initBinCache();
+  }
+
+  const Int_t bin = _binCacheState == kBinCacheValid ? currentBin() : -1;
+  Double_t nominal;
+  if (bin >= 0) {
+    // per-bin contents of the templates, see initBinCache()
+    nominal = _binNominal[bin];
+  } else {
+    nominal = _nominal;
+  }
+  Double_t sum(nominal) ;
+
+  for (unsigned int i=0; i < _paramSet.size(); ++i) {
+    auto param = static_cast<RooAbsReal*>(_paramSet.at(i));
+    Double_t low, high;
+    if (bin >= 0) {
+      low = _binLow[i*_binNominal.size() + bin];
+      high = _binHigh[i*_binNominal.size() + bin];
+    } else {
+      low = static_cast<RooAbsReal*>(_lowSet.at(i))->getVal();
+      high = static_cast<RooAbsReal*>(_highSet.at(i))->getVal();
     }
+
+    if (!interpolateVariation(sum, _interpCode[i], param->getVal(), nominal, low, high)) {
+      coutE(InputArguments) << "PiecewiseInterpolation::evaluate ERROR:  " << param->GetName() 
+			    << " with unknown interpolation code" << _interpCode[i] << endl ;
     }
   }
   
@@ -297,6 +329,111 @@ Double_t PiecewiseInterpolation::evaluate() const
 
 }
 
+
+////////////////////////////////////////////////////////////////////////////////
+/// Check whether the nominal, low and high functions are all RooHistFunc of
+/// the same observables, without interpolation between the bins and with the
+/// same binning, as in the models of HistFactory. In this case copy the
+/// contents of their bins in flat arrays, which evaluate() can read without
+/// evaluating the functions: this saves one lookup of a RooDataHist per
+/// function and per evaluation. The contents of the histograms are read once:
+/// they must not be modified afterwards.
+
+void PiecewiseInterpolation::initBinCache() const
+{
+  _binCacheState = kBinCacheInvalid;
+  _binNominal.clear();
+  _binLow.clear();
+  _binHigh.clear();
+  _binObs.removeAll();
+
+  auto nominal = dynamic_cast<const RooHistFunc*>(&_nominal.arg());
+  if (!nominal || nominal->getInterpolationOrder() != 0) return;
+
+  // The observables of the functions must be the variables of the histogram, with the same names
+  const RooArgSet& histVars = *nominal->dataHist().get();
+  if (nominal->servers().size() != histVars.size()) return;
+  for (const auto server : nominal->servers()) {
+    if (!dynamic_cast<const RooAbsRealLValue*>(server) || !histVars.find(server->GetName())) return;
+    _binObs.add(*server);
+  }
+
+  auto sameBins = [&](const RooAbsArg* arg) {
+    auto func = dynamic_cast<const RooHistFunc*>(arg);
+    if (!func || func->getInterpolationOrder() != 0 || func->servers().size() != _binObs.size()) return false;
+    for (const auto server : func->servers()) {
+      if (!_binObs.containsInstance(*server)) return false;
+    }
+
+    const RooArgSet& vars = *func->dataHist().get();
+    if (func->dataHist().numEntries() != nominal->dataHist().numEntries() || vars.size() != histVars.size()) return false;
+    for (std::size_t i = 0; i < vars.size(); ++i) {
+      auto var = dynamic_cast<const RooRealVar*>(vars[i]);
+      auto nominalVar = dynamic_cast<const RooRealVar*>(histVars[i]);
+      if (!var || !nominalVar || strcmp(var->GetName(), nominalVar->GetName()) != 0) return false;
+
+      const RooAbsBinning& binning = var->getBinning();
+      const RooAbsBinning& nominalBinning = nominalVar->getBinning();
+      if (binning.numBins() != nominalBinning.numBins()) return false;
+      for (Int_t j = 0; j < binning.numBins(); ++j) {
+        if (binning.binLow(j) != nominalBinning.binLow(j) || binning.binHigh(j) != nominalBinning.binHigh(j)) return false;
+      }
+    }
+    return true;
+  };
+
+  for (unsigned int i = 0; i < _paramSet.size(); ++i) {
+    if (!sameBins(_lowSet.at(i)) || !sameBins(_highSet.at(i))) {
+      _binObs.removeAll();
+      return;
+    }
+  }
+
+  auto readBins = [](const RooAbsArg* arg, std::vector<double>& contents) {
+    const RooDataHist& hist = static_cast<const RooHistFunc*>(arg)->dataHist();
+    for (Int_t bin = 0; bin < hist.numEntries(); ++bin) {
+      hist.get(bin);
+      contents.push_back(hist.weight());
+    }
+  };
+
+  readBins(nominal, _binNominal);
+  for (unsigned int i = 0; i < _paramSet.size(); ++i) {
+    readBins(_lowSet.at(i), _binLow);
+    readBins(_highSet.at(i), _binHigh);
+  }
+  _binCacheState = kBinCacheValid;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the index of the bin of the templates at the current values of the
+/// observables, or -1 if they are out of range. In that case the functions
+/// are evaluated as usual.
+
+Int_t PiecewiseInterpolation::currentBin() const
+{
+  for (const auto obs : _binObs) {
+    if (!static_cast<const RooAbsRealLValue*>(obs)->inRange(nullptr)) return -1;
+  }
+
+  auto& hist = const_cast<RooDataHist&>(static_cast<const RooHistFunc&>(_nominal.arg()).dataHist());
+  return hist.getIndex(_binObs);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// The functions may no longer be the ones of the bin cache: rebuild it at
+/// the next evaluation.
+
+Bool_t PiecewiseInterpolation::redirectServersHook(const RooAbsCollection& /*newServerList*/, Bool_t /*mustReplaceAll*/,
+                                                   Bool_t /*nameChange*/, Bool_t /*isRecursive*/)
+{
+  _binCacheState = kBinCacheUnchecked;
+  _binObs.removeAll();
+  return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Bool_t PiecewiseInterpolation::setBinIntegrator(RooArgSet& allVars) 
@@ -2,12 +2,17 @@
 // Authors: Stephan Hageboeck, CERN  01/2019
 
 #include "RooStats/HistFactory/Sample.h"
+#include "RooStats/HistFactory/PiecewiseInterpolation.h"
 #include "RooStats/ModelConfig.h"
 #include "RooWorkspace.h"
 #include "RooArgSet.h"
+#include "RooRealVar.h"
+#include "RooDataHist.h"
+#include "RooHistFunc.h"
 
 #include "TROOT.h"
 #include "TFile.h"
+#include "TH1D.h"
 #include "gtest/gtest.h"
 
 using namespace RooStats;
@@ -29,6 +34,49 @@ TEST(Sample, CopyAssignment)
 }
 
 
+
+// The values of a PiecewiseInterpolation of templates, read from its bin cache
+TEST(PiecewiseInterpolation, BinnedTemplates)
+{
+  RooRealVar x("x", "x", 0, 3);
+  x.setBins(3);
+  RooRealVar alpha("alpha", "alpha", 0, -5, 5);
+
+  const double nominal[] = {10., 20., 30.};
+  const double low[] = {8., 19., 25.};
+  const double high[] = {13., 20., 36.};
+  TH1D hNominal("hNominal", "", 3, 0, 3), hLow("hLow", "", 3, 0, 3), hHigh("hHigh", "", 3, 0, 3);
+  for (int i = 0; i < 3; ++i) {
+    hNominal.SetBinContent(i+1, nominal[i]);
+    hLow.SetBinContent(i+1, low[i]);
+    hHigh.SetBinContent(i+1, high[i]);
+  }
+  RooDataHist dNominal("dNominal", "", x, &hNominal), dLow("dLow", "", x, &hLow), dHigh("dHigh", "", x, &hHigh);
+  RooHistFunc fNominal("fNominal", "", x, dNominal), fLow("fLow", "", x, dLow), fHigh("fHigh", "", x, dHigh);
+
+  PiecewiseInterpolation interp("interp", "", fNominal, RooArgList(fLow), RooArgList(fHigh), RooArgList(alpha));
+
+  for (int code : {0, 4}) {
+    interp.setAllInterpCodes(code);
+    for (double a : {-1.5, -0.5, 0., 0.3, 2.}) {
+      alpha.setVal(a);
+      for (int i = 0; i < 3; ++i) {
+        x.setVal(i + 0.5);
+
+        const double epsPlus = high[i] - nominal[i];
+        const double epsMinus = nominal[i] - low[i];
+        double expected = nominal[i] + a * (a > 0 ? epsPlus : epsMinus);
+        if (code == 4 && a >= -1 && a <= 1) {
+          const double S = 0.5 * (epsPlus + epsMinus);
+          const double A = 0.0625 * (epsPlus - epsMinus);
+          expected = nominal[i] + a * (S + a * A * (15 + a * a * (-10 + a * a * 3)));
+        }
+        EXPECT_NEAR(interp.getVal(), expected, 1.E-12) << "code " << code << " alpha " << a << " bin " << i;
+      }
+    }
+  }
+}
+
 TEST(HistFactory, Read_ROOT6_16_Model) {
   std::string filename = "./ref_6.16_example_UsingC_channel1_meas_model.root";
   std::unique_ptr<TFile> file(TFile::Open(filename.c_str()));
@@ -31,6 +31,7 @@ that models a non-relativistic Breit-Wigner shape
 #include "RooAbsReal.h"
 #include "RooRealVar.h"
 #include "BatchHelpers.h"
+#include "RooBatchCompute.h"
 // #include "RooFitTools/RooRandom.h"
 
 using namespace std;
@@ -67,57 +68,19 @@ Double_t RooBreitWigner::evaluate() const
 
 ////////////////////////////////////////////////////////////////////////////////
 
-namespace {
-//Author: Emmanouil Michalainas, CERN 21 August 2019
-
-template<class Tx, class Tmean, class Twidth>
-void compute(	size_t batchSize,
-              double * __restrict output,
-              Tx X, Tmean M, Twidth W)
-{
-  for (size_t i=0; i<batchSize; i++) {
-    const double arg = X[i]-M[i];
-    output[i] = 1 / (arg*arg + 0.25*W[i]*W[i]);
-  }
-}
-};
-
 RooSpan<double> RooBreitWigner::evaluateBatch(std::size_t begin, std::size_t batchSize) const {
   using namespace BatchHelpers;
   auto xData = x.getValBatch(begin, batchSize);
   auto meanData = mean.getValBatch(begin, batchSize);
   auto widthData = width.getValBatch(begin, batchSize);
-  const bool batchX = !xData.empty();
-  const bool batchMean = !meanData.empty();
-  const bool batchWidth = !widthData.empty();
 
-  if (!batchX && !batchMean && !batchWidth) {
+  if (xData.empty() && meanData.empty() && widthData.empty()) {
     return {};
   }
   batchSize = findSize({ xData, meanData, widthData });
   auto output = _batchData.makeWritableBatchUnInit(begin, batchSize);
 
-  if (batchX && !batchMean && !batchWidth ) {
-    compute(batchSize, output.data(), xData, BracketAdapter<double>(mean), BracketAdapter<double>(width));
-  }
-  else if (!batchX && batchMean && !batchWidth ) {
-    compute(batchSize, output.data(), BracketAdapter<double>(x), meanData, BracketAdapter<double>(width));
-  }
-  else if (batchX && batchMean && !batchWidth ) {
-    compute(batchSize, output.data(), xData, meanData, BracketAdapter<double>(width));
-  }
-  else if (!batchX && !batchMean && batchWidth ) {
-    compute(batchSize, output.data(), BracketAdapter<double>(x), BracketAdapter<double>(mean), widthData);
-  }
-  else if (batchX && !batchMean && batchWidth ) {
-    compute(batchSize, output.data(), xData, BracketAdapter<double>(mean), widthData);
-  }
-  else if (!batchX && batchMean && batchWidth ) {
-    compute(batchSize, output.data(), BracketAdapter<double>(x), meanData, widthData);
-  }
-  else if (batchX && batchMean && batchWidth ) {
-    compute(batchSize, output.data(), xData, meanData, widthData);
-  }
+  RooBatchCompute::computeBreitWigner(batchSize, output.data(), {xData, x}, {meanData, mean}, {widthData, width});
   return output;
 }
 
@@ -29,7 +29,7 @@ range and values of the arguments.
 
 #include "RooRealVar.h"
 #include "BatchHelpers.h"
-#include "RooVDTHeaders.h"
+#include "RooBatchCompute.h"
 
 #include <cmath>
 
@@ -88,18 +88,6 @@ Double_t RooExponential::analyticalIntegral(Int_t code, const char* rangeName) c
 }
 
 
-namespace {
-
-template<class Tx, class Tc>
-void compute(size_t n, double* __restrict output, Tx x, Tc c) {
-
-  for (size_t i = 0; i < n; ++i) { //CHECK_VECTORISE
-    output[i] = _rf_fast_exp(x[i]*c[i]);
-  }
-}
-
-}
-
 ////////////////////////////////////////////////////////////////////////////////
 /// Evaluate the exponential without normalising it on the given batch.
 /// \param[in] batchIndex Index of the batch to be computed.
@@ -110,23 +98,13 @@ RooSpan<double> RooExponential::evaluateBatch(std::size_t begin, std::size_t bat
   using namespace BatchHelpers;
   auto xData = x.getValBatch(begin, batchSize);
   auto cData = c.getValBatch(begin, batchSize);
-  const bool batchX = !xData.empty();
-  const bool batchC = !cData.empty();
 
-  if (!batchX && !batchC) {
+  if (xData.empty() && cData.empty()) {
     return {};
   }
   batchSize = findSize({ xData, cData });
   auto output = _batchData.makeWritableBatchUnInit(begin, batchSize);
 
-  if (batchX && !batchC ) {
-    compute(batchSize, output.data(), xData, BracketAdapter<double>(c));
-  }
-  else if (!batchX && batchC ) {
-    compute(batchSize, output.data(), BracketAdapter<double>(x), cData);
-  }
-  else if (batchX && batchC ) {
-    compute(batchSize, output.data(), xData, cData);
-  }
+  RooBatchCompute::computeExponential(batchSize, output.data(), {xData, x}, {cData, c});
   return output;
 }
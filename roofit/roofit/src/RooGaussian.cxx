@@ -24,13 +24,12 @@ Plain Gaussian p.d.f
 
 #include "RooFit.h"
 #include "BatchHelpers.h"
+#include "RooBatchCompute.h"
 #include "RooAbsReal.h"
 #include "RooRealVar.h"
 #include "RooRandom.h"
 #include "RooMath.h"
 
-#include "RooVDTHeaders.h"
-
 using namespace BatchHelpers;
 using namespace std;
 
@@ -66,26 +65,6 @@ Double_t RooGaussian::evaluate() const
 }
 
 
-namespace {
-
-///Actual computations for the batch evaluation of the Gaussian.
-///May vectorise over x, mean, sigma, depending on the types of the inputs.
-///\note The output and input spans are assumed to be non-overlapping. If they
-///overlap, results will likely be garbage.
-template<class Tx, class TMean, class TSig>
-void compute(RooSpan<double> output, Tx x, TMean mean, TSig sigma) {
-  const auto n = output.size();
-
-  for (std::size_t i = 0; i < n; ++i) {
-    const double arg = x[i] - mean[i];
-    const double halfBySigmaSq = -0.5 / (sigma[i] * sigma[i]);
-
-    output[i] = _rf_fast_exp(arg*arg * halfBySigmaSq);
-  }
-}
-
-}
-
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute \f$ \exp(-0.5 \cdot \frac{(x - \mu)^2}{\sigma^2} \f$ in batches.
 /// The local proxies {x, mean, sigma} will be searched for batch input data,
@@ -101,38 +80,12 @@ RooSpan<double> RooGaussian::evaluateBatch(std::size_t begin, std::size_t batchS
   auto meanData = mean.getValBatch(begin, batchSize);
   auto sigmaData = sigma.getValBatch(begin, batchSize);
 
-  //Now explicitly write down all possible template instantiations of compute() above:
-  const bool batchX = !xData.empty();
-  const bool batchMean = !meanData.empty();
-  const bool batchSigma = !sigmaData.empty();
-
-  if (!(batchX || batchMean || batchSigma)) {
+  if (xData.empty() && meanData.empty() && sigmaData.empty()) {
     return {};
   }
 
   auto output = _batchData.makeWritableBatchUnInit(begin, batchSize);
-
-  if (batchX && !batchMean && !batchSigma) {
-    compute(output, xData, BracketAdapter<double>(mean), BracketAdapter<double>(sigma));
-  }
-  else if (batchX && batchMean && !batchSigma) {
-    compute(output, xData, meanData, BracketAdapter<double>(sigma));
-  }
-  else if (batchX && !batchMean && batchSigma) {
-    compute(output, xData, BracketAdapter<double>(mean), sigmaData);
-  }
-  else if (batchX && batchMean && batchSigma) {
-    compute(output, xData, meanData, sigmaData);
-  }
-  else if (!batchX && batchMean && !batchSigma) {
-    compute(output, BracketAdapter<double>(x), meanData, BracketAdapter<double>(sigma));
-  }
-  else if (!batchX && !batchMean && batchSigma) {
-    compute(output, BracketAdapter<double>(x), BracketAdapter<double>(mean), sigmaData);
-  }
-  else if (!batchX && batchMean && batchSigma) {
-    compute(output, BracketAdapter<double>(x), meanData, sigmaData);
-  }
+  RooBatchCompute::computeGaussian(output.size(), output.data(), {xData, x}, {meanData, mean}, {sigmaData, sigma});
 
   return output;
 }
@@ -562,6 +562,7 @@ protected:
    void setValueDirty(const RooAbsArg* source);
    /// Notify that a shape-like property (*e.g.* binning) has changed.
    void setShapeDirty(const RooAbsArg* source);
+   static void clientGraphChanged();
 
    virtual void ioStreamerPass2() ;
    static void ioStreamerPass2Finalize() ;
@@ -659,6 +660,8 @@ private:
   mutable Bool_t _valueDirty ;  // Flag set if value needs recalculating because input values modified
   mutable Bool_t _shapeDirty ;  // Flag set if value needs recalculating because input shapes modified
   mutable bool _allBatchesDirty{true}; //! Mark batches as dirty (only meaningful for RooAbsReal).
+  mutable std::vector<RooAbsArg*> _valueClosure; //! All direct and indirect value clients, see setValueDirty()
+  mutable std::size_t _valueClosureVersion{0}; //! Version of the client graph _valueClosure was collected for
 
   mutable OperMode _operMode ; // Dirty state propagation mode
   mutable Bool_t _fast ; // Allow fast access mode in getVal() and proxies
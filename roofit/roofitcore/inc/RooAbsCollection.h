@@ -22,6 +22,8 @@
 #include "RooCmdArg.h"
 #include "RooLinkedListIter.h"
 #include <string>
+#include <memory>
+#include <unordered_map>
 
 class RooCmdArg;
 
@@ -258,6 +260,10 @@ protected:
   // Support for snapshot method 
   Bool_t addServerClonesToList(const RooAbsArg& var) ;
 
+  /// Elements by name pointer, only kept while a snapshot is being made, such that
+  /// find() does not have to scan the list for each server to be cloned or redirected.
+  std::unique_ptr<std::unordered_map<const TNamed*, RooAbsArg*>> _nameIndex; //!
+
   inline TNamed* structureTag() { if (_structureTag==0) makeStructureTag() ; return _structureTag ; }
   inline TNamed* typedStructureTag() { if (_typedStructureTag==0) makeTypedStructureTag() ; return _typedStructureTag ; }
 
@@ -454,6 +454,7 @@ protected:
 
   friend class RooAbsPdf ;
   friend class RooAbsAnaConvPdf ;
+  friend class RooFormula ;
 
   RooNumIntConfig* _specIntegratorConfig ; // Numeric integrator configuration specific for this object
 
@@ -0,0 +1,74 @@
+/*****************************************************************************
+ * RooFit
+ * Authors:                                                                  *
+ *   WV, Wouter Verkerke, UC Santa Barbara, verkerke@slac.stanford.edu       *
+ *   DK, David Kirkby,    UC Irvine,         dkirkby@uci.edu                 *
+ *                                                                           *
+ * Copyright (c) 2000-2020, Regents of the University of California          *
+ *                          and Stanford University. All rights reserved.    *
+ *                                                                           *
+ * Redistribution and use in source and binary forms,                        *
+ * with or without modification, are permitted according to the terms        *
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)             *
+ *****************************************************************************/
+
+#ifndef ROOFIT_ROOFITCORE_INC_ROOBATCHCOMPUTE_H_
+#define ROOFIT_ROOFITCORE_INC_ROOBATCHCOMPUTE_H_
+
+#include "BatchHelpers.h"
+#include "RooSpan.h"
+
+#include <cstddef>
+
+/**
+ * Compute kernels shared by the batch evaluations of the PDFs (see RooAbsReal::evaluateBatch()).
+ *
+ * Each kernel is compiled for several instruction sets (on x86-64: SSE4.2, AVX2 and AVX-512,
+ * besides the generic one), and the best one supported by the CPU is selected when the first
+ * kernel is called. The exponentials use the fast VDT implementation if ROOT is built with VDT.
+ * The inputs of a kernel are either batches of values, one per event, or a single value for
+ * all the events:
+ * ~~~{.cpp}
+ * auto xData = x.getValBatch(begin, batchSize);
+ * ...
+ * RooBatchCompute::computeGaussian(output.size(), output.data(), {xData, x}, {meanData, mean}, {sigmaData, sigma});
+ * ~~~
+ */
+namespace RooBatchCompute {
+
+/// Instruction sets the kernels are compiled for.
+enum class Architecture { kGeneric, kSSE4, kAVX2, kAVX512 };
+
+/// Input of a kernel: a batch of values if not empty, otherwise the same value for all the events.
+class Input {
+public:
+  Input(RooSpan<const double> batch, double value) : _batch(batch), _value(value) { }
+
+  bool isBatch() const { return !_batch.empty(); }
+  const double* data() const { return _batch.data(); }
+  double value() const { return _value; }
+  BatchHelpers::BracketAdapterWithMask adapter() const {
+    return BatchHelpers::BracketAdapterWithMask(_value, _batch);
+  }
+
+private:
+  RooSpan<const double> _batch;
+  double _value;
+};
+
+Architecture architecture();
+const char* architectureName(Architecture arch);
+bool setArchitecture(Architecture arch);
+
+/// \f$ \exp(-0.5 \cdot \frac{(x - \mu)^2}{\sigma^2}) \f$, see RooGaussian.
+void computeGaussian(std::size_t n, double* output, Input x, Input mean, Input sigma);
+/// \f$ \exp(c \cdot x) \f$, see RooExponential.
+void computeExponential(std::size_t n, double* output, Input x, Input c);
+/// \f$ 1 / ((x - m)^2 + w^2/4) \f$, see RooBreitWigner.
+void computeBreitWigner(std::size_t n, double* output, Input x, Input mean, Input width);
+/// Gaussian of width sigmaL below the mean and sigmaR above, see RooBifurGauss.
+void computeBifurGauss(std::size_t n, double* output, Input x, Input mean, Input sigmaL, Input sigmaR);
+
+}
+
+#endif /* ROOFIT_ROOFITCORE_INC_ROOBATCHCOMPUTE_H_ */
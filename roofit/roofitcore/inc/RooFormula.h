@@ -19,12 +19,15 @@
 #include "RooPrintable.h"
 #include "RooArgList.h"
 #include "RooArgSet.h"
+#include "RooSpan.h"
 #include "TFormula.h"
 
 #include <memory>
 #include <vector>
 #include <string>
 
+class RooAbsReal;
+
 class RooFormula : public TNamed, public RooPrintable {
 public:
   // Constructors etc.
@@ -53,6 +56,8 @@ public:
   Bool_t ok() { return _tFormula != nullptr; }
   /// Evalute all parameters/observables, and then evaluate formula.
   Double_t eval(const RooArgSet* nset=0) const;
+  /// Evaluate the formula for a batch of events, see RooFormulaVar::evaluateBatch().
+  RooSpan<double> evaluateBatch(const RooAbsReal* dataOwner, std::size_t begin, std::size_t batchSize, const RooArgSet* normSet = nullptr) const;
 
   /// DEBUG: Dump state information
   void dump() const;
@@ -66,6 +66,8 @@ public:
   virtual Double_t evaluate() const ;
 
   protected:
+  virtual RooSpan<double> evaluateBatch(std::size_t begin, std::size_t batchSize) const;
+
   // Post-processing of server redirection
   virtual Bool_t redirectServersHook(const RooAbsCollection& newServerList, Bool_t mustReplaceAll, Bool_t nameChange, Bool_t isRecursive) ;
 
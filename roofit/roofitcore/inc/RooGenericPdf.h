@@ -49,6 +49,7 @@ protected:
   // Function evaluation
   RooListProxy _actualVars ; 
   virtual Double_t evaluate() const ;
+  virtual RooSpan<double> evaluateBatch(std::size_t begin, std::size_t batchSize) const;
 
   Bool_t setFormula(const char* formula) ;
 
@@ -49,6 +49,7 @@ public:
   void optimizeConst(Int_t flag) ;
   void setEvalErrorWall(Bool_t flag) { fitterFcn()->SetEvalErrorWall(flag); }
   void setOffsetting(Bool_t flag) ;
+  void setParallelGradient(Int_t nWorkers) ;
   void setMaxIterations(Int_t n) ;
   void setMaxFunctionCalls(Int_t n) ; 
 
@@ -100,8 +101,10 @@ protected:
   inline std::ofstream* logfile() { return fitterFcn()->GetLogFile(); }
   inline Double_t& maxFCN() { return fitterFcn()->GetMaxFCN() ; }
   
-  const RooMinimizerFcn* fitterFcn() const {  return ( fitter()->GetFCN() ? ((RooMinimizerFcn*) fitter()->GetFCN()) : _fcn ) ; }
-  RooMinimizerFcn* fitterFcn() { return ( fitter()->GetFCN() ? ((RooMinimizerFcn*) fitter()->GetFCN()) : _fcn ) ; }
+  const RooMinimizerFcn* fitterFcn() const {  return ( fitter()->GetFCN() ? dynamic_cast<RooMinimizerFcn*>(fitter()->GetFCN()) : _fcn ) ; }
+  RooMinimizerFcn* fitterFcn() { return ( fitter()->GetFCN() ? dynamic_cast<RooMinimizerFcn*>(fitter()->GetFCN()) : _fcn ) ; }
+
+  bool fitFcn() const ;
 
 private:
 
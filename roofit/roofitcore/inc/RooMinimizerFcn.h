@@ -27,10 +27,13 @@
 
 #include <iostream>
 #include <fstream>
+#include <memory>
+#include <vector>
 
 class RooMinimizer;
+class RooRealVar;
 
-class RooMinimizerFcn : public ROOT::Math::IBaseFunctionMultiDim {
+class RooMinimizerFcn : public ROOT::Math::IMultiGradFunction {
 
  public:
 
@@ -64,6 +67,10 @@ class RooMinimizerFcn : public ROOT::Math::IBaseFunctionMultiDim {
   Int_t evalCounter() const { return _evalCounter ; }
   void zeroEvalCount() { _evalCounter = 0 ; }
 
+  void SetParallelGradient(Int_t nWorkers) ;
+  Int_t GetParallelGradient() const { return _nGradWorkers ; }
+  virtual void Gradient(const double * x, double * grad) const;
+
 
  private:
   
@@ -77,8 +84,24 @@ class RooMinimizerFcn : public ROOT::Math::IBaseFunctionMultiDim {
 
 
   virtual double DoEval(const double * x) const;  
+  virtual double DoDerivative(const double * x, unsigned int icoord) const;
   void updateFloatVec() ;
 
+  // Clone of the function, with its own parameters, used by one of the
+  // tasks of the parallel gradient calculation
+  struct GradientWorker {
+    std::unique_ptr<RooAbsReal> _funct;
+    std::vector<RooRealVar*> _floatParams;   // Parameters matching _floatParamVec
+    std::vector<std::pair<RooAbsArg*,RooAbsArg*> > _constParams; // Pairs (parameter of the worker, constant parameter)
+  };
+  struct GradientWorkers {
+    std::vector<RooAbsArg*> _floatParamVec; // Floating parameters the workers were created for
+    std::vector<GradientWorker> _workers;
+  };
+
+  void initGradientWorkers() const;
+  Double_t gradientStep(Int_t index, Double_t value) const;
+
 private:
 
   mutable Int_t _evalCounter ;
@@ -101,6 +124,10 @@ private:
   RooArgList* _initFloatParamList;
   RooArgList* _initConstParamList;
 
+  Int_t _nGradWorkers;
+  Bool_t _optConst;
+  mutable std::shared_ptr<GradientWorkers> _gradWorkers; //! Shared by the copies made by the fitter
+
 };
 
 #endif
@@ -138,6 +138,13 @@ protected:
   Bool_t _cacheNum ;           // Cache integral if numeric
   static Int_t _cacheAllNDim ; //! Cache all integrals with given numeric dimension
 
+  Bool_t numIntCacheLookup(Double_t& value) const ;
+  void numIntCacheStore(Double_t value) const ;
+
+  mutable std::vector<double> _numIntCacheKey ; //! Parameters and limits of the current numeric integration
+  mutable std::vector<std::pair<std::vector<double>,Double_t>> _numIntCache ; //! Last numeric integrals with their keys
+  mutable std::size_t _numIntCacheNext = 0 ; //! Entry of _numIntCache replaced by the next integral
+
 
   virtual void operModeHook() ; // cache operation mode
 
@@ -70,7 +70,9 @@ public:
   virtual void setCacheAndTrackHints(RooArgSet&) ;
 
 protected:
-  
+
+  virtual RooSpan<double> evaluateBatch(std::size_t begin, std::size_t batchSize) const;
+
   class CacheElem : public RooAbsCacheElement {
   public:
     CacheElem()  {} ;
@@ -87,6 +87,9 @@ public:
   
 protected:
 
+  virtual RooSpan<double> evaluateBatch(std::size_t begin, std::size_t batchSize) const;
+  Double_t currentCategoryFraction(RooRealProxy* proxy) const ;
+
   void initialize(RooAbsCategoryLValue& inIndexCat, std::map<std::string,RooAbsPdf*> pdfMap) ;
 
   virtual void selectNormalization(const RooArgSet* depSet=0, Bool_t force=kFALSE) ;
@@ -129,6 +129,7 @@ public:
   const RooVectorDataStore* cache() const { return _cache ; }
 
   void loadValues(const RooAbsDataStore *tds, const RooFormulaVar* select=0, const char* rangeName=0, std::size_t nStart=0, std::size_t nStop = std::numeric_limits<std::size_t>::max()) override;
+  void loadValues(const TTree *t, const RooFormulaVar* select=0) ;
   
   void dump() override;
 
@@ -67,6 +67,8 @@ setting/clearing/testing named attributes.
 #include <sstream>
 #include <string.h>
 #include <algorithm>
+#include <atomic>
+#include <unordered_set>
 
 using namespace std ;
 
@@ -380,6 +382,8 @@ void RooAbsArg::addServer(RooAbsArg& server, Bool_t valueProp, Bool_t shapeProp,
   server._clientList.Add(this, refCount);
   if (valueProp) server._clientListValue.Add(this, refCount);
   if (shapeProp) server._clientListShape.Add(this, refCount);
+
+  clientGraphChanged();
 }
 
 
@@ -422,6 +426,8 @@ void RooAbsArg::removeServer(RooAbsArg& server, Bool_t force)
   server._clientList.Remove(this, force) ;
   server._clientListValue.Remove(this, force) ;
   server._clientListShape.Remove(this, force) ;
+
+  clientGraphChanged();
 }
 
 
@@ -465,6 +471,8 @@ void RooAbsArg::changeServer(RooAbsArg& server, Bool_t valueProp, Bool_t shapePr
   if (shapeProp) {
     server._clientListShape.Add(this, scount) ;
   }
+
+  clientGraphChanged();
 }
 
 
@@ -817,10 +825,37 @@ Bool_t RooAbsArg::observableOverlaps(const RooArgSet* nset, const RooAbsArg& tes
 
 
 
+namespace {
+// Version of the graph of value clients of all the RooAbsArg objects, see RooAbsArg::clientGraphChanged()
+std::atomic<std::size_t> gClientGraphVersion{1};
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Invalidate the lists of value clients collected by setValueDirty(). This
+/// is called whenever a client-server link is added, removed or changed; code
+/// editing the client lists directly must call it as well.
+
+void RooAbsArg::clientGraphChanged()
+{
+  ++gClientGraphVersion;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Mark this object as having changed its value, and propagate this status
 /// change to all of our clients. If the object is not in automatic dirty
 /// state propagation mode, this call has no effect
+///
+/// Instead of recursing through the client lists, which visits a node once
+/// per path leading to it and is therefore very slow for the graphs of large
+/// models with many shared sub-expressions, the flags are raised on a flat
+/// list of all the direct and indirect value clients. This list is collected
+/// the first time and reused until the client graph changes. As in the
+/// recursion, clients that are not in the Auto mode of operation keep their
+/// dirty flag unchanged. Their own clients are in the list nonetheless, so
+/// that it does not depend on the modes of operation, which change often:
+/// they may get dirty flags they would not have had before, which is harmless.
 
 void RooAbsArg::setValueDirty(const RooAbsArg* source)
 {
@@ -834,18 +869,6 @@ void RooAbsArg::setValueDirty(const RooAbsArg* source)
     return ;
   }
 
-  // Cyclical dependency interception
-  if (source==0) {
-    source=this ;
-  } else if (source==this) {
-    // Cyclical dependency, abort
-    coutE(LinkStateMgmt) << "RooAbsArg::setValueDirty(" << GetName()
-			 << "): cyclical dependency detected, source = " << source->GetName() << endl ;
-    //assert(0) ;
-    return ;
-  }
-
-  // Propagate dirty flag to all clients if this is a down->up transition
   if (_verboseDirty) {
     cxcoutD(LinkStateMgmt) << "RooAbsArg::setValueDirty(" << (source?source->GetName():"self") << "->" << GetName() << "," << this
 			   << "): dirty flag " << (_valueDirty?"already ":"") << "raised" << endl ;
@@ -853,12 +876,42 @@ void RooAbsArg::setValueDirty(const RooAbsArg* source)
 
   _valueDirty = kTRUE ;
 
-
-  for (auto client : _clientListValue) {
-    client->setValueDirty(source) ;
+  const std::size_t version = gClientGraphVersion;
+  if (_valueClosureVersion != version) {
+    _valueClosure.clear();
+    std::unordered_set<const RooAbsArg*> seen{this};
+    std::vector<const RooAbsArg*> stack{this};
+    bool cyclic = false;
+    while (!stack.empty()) {
+      const RooAbsArg* arg = stack.back();
+      stack.pop_back();
+      for (auto client : arg->_clientListValue) {
+        if (client == this) {
+          cyclic = true;
+        } else if (seen.insert(client).second) {
+          _valueClosure.push_back(client);
+          stack.push_back(client);
+        }
+      }
+    }
+    // Keep the list of a cyclical graph invalid to report it at each call
+    _valueClosureVersion = cyclic ? 0 : version;
+    if (cyclic) {
+      coutE(LinkStateMgmt) << "RooAbsArg::setValueDirty(" << GetName()
+			   << "): cyclical dependency detected, source = " << GetName() << endl ;
+    }
   }
 
+  for (auto client : _valueClosure) {
+    client->_allBatchesDirty = true;
+    if (client->_operMode != Auto) continue;
 
+    if (_verboseDirty) {
+      cxcoutD(LinkStateMgmt) << "RooAbsArg::setValueDirty(" << GetName() << "->" << client->GetName() << "," << client
+			     << "): dirty flag " << (client->_valueDirty?"already ":"") << "raised" << endl ;
+    }
+    client->_valueDirty = kTRUE;
+  }
 }
 
 
@@ -2137,12 +2190,19 @@ RooAbsArg* RooAbsArg::cloneTree(const char* newname) const
   // To release it from the set ownership
   clonedNodes->remove(*head) ;
 
-  // Add the set as owned component of the head
-  head->addOwnedComponents(*clonedNodes) ;
+  // Add the set as owned component of the head. A fresh clone owns no
+  // components yet, so the set can be adopted without checking each of its
+  // elements for duplicates
+  if (!head->_ownedComponents) {
+    clonedNodes->setName("owned components") ;
+    head->_ownedComponents = clonedNodes ;
+  } else {
+    head->addOwnedComponents(*clonedNodes) ;
 
-  // Delete intermediate container
-  clonedNodes->releaseOwnership() ;
-  delete clonedNodes ;
+    // Delete intermediate container
+    clonedNodes->releaseOwnership() ;
+    delete clonedNodes ;
+  }
 
   // Adjust name of head node if requested
   if (newname) {
@@ -236,6 +236,14 @@ Bool_t RooAbsCollection::snapshot(RooAbsCollection& output, Bool_t deepCopy) con
     output.add(*copy);
   }
 
+  // Index the clones by name while the servers are cloned and redirected,
+  // which would otherwise take a time quadratic in the size of the graph
+  output._nameIndex = std::make_unique<std::unordered_map<const TNamed*, RooAbsArg*>>();
+  output._nameIndex->reserve(2 * output._list.size());
+  for (auto copy : output._list) {
+    output._nameIndex->emplace(copy->namePtr(), copy);
+  }
+
   // Add external dependents
   Bool_t error(kFALSE) ;
   if (deepCopy) {
@@ -250,6 +258,7 @@ Bool_t RooAbsCollection::snapshot(RooAbsCollection& output, Bool_t deepCopy) con
   // Handle eventual error conditions
   if (error) {
     coutE(ObjectHandling) << "RooAbsCollection::snapshot(): Errors occurred in deep clone process, snapshot not created" << endl ;
+    output._nameIndex.reset();
     output._ownCont = kTRUE ;
     return kTRUE ;
   }
@@ -260,6 +269,7 @@ Bool_t RooAbsCollection::snapshot(RooAbsCollection& output, Bool_t deepCopy) con
   for (auto var : output) {
     var->redirectServers(output,deepCopy);
   }
+  output._nameIndex.reset();
 
 
   // Transfer ownership of contents to list
@@ -283,6 +293,9 @@ Bool_t RooAbsCollection::addServerClonesToList(const RooAbsArg& var)
       RooAbsArg* serverClone = (RooAbsArg*)server->Clone() ;
       serverClone->setAttribute("SnapShot_ExtRefClone") ;
       _list.push_back(serverClone) ;
+      if (_nameIndex) {
+        _nameIndex->emplace(serverClone->namePtr(), serverClone);
+      }
       if (_allRRV && dynamic_cast<RooRealVar*>(serverClone)==0) {
         _allRRV=kFALSE ;
       }
@@ -792,6 +805,11 @@ RooAbsArg * RooAbsCollection::find(const char *name) const
 {
   if (!name)
     return nullptr;
+
+  if (_nameIndex) {
+    auto found = _nameIndex->find(RooNameReg::known(name));
+    return found != _nameIndex->end() ? found->second : nullptr;
+  }
   
   decltype(_list)::const_iterator item;
 
@@ -825,6 +843,11 @@ RooAbsArg * RooAbsCollection::find(const char *name) const
 RooAbsArg * RooAbsCollection::find(const RooAbsArg& arg) const
 {
   const auto nptr = arg.namePtr();
+  if (_nameIndex) {
+    auto found = _nameIndex->find(nptr);
+    return found != _nameIndex->end() ? found->second : nullptr;
+  }
+
   auto findByNamePtr = [nptr](const RooAbsArg * listItem) {
     return nptr == listItem->namePtr();
   };
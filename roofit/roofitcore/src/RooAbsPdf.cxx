@@ -868,6 +868,8 @@ Double_t RooAbsPdf::extendedTerm(Double_t observed, const RooArgSet* nset) const
 ///                     do not share many parameters
 ///   <tr><td> 3 = RooFit::Hybrid <td> Follow strategy 0 for all RooSimultaneous components, except those with less than
 ///                     30 dataset entries, for which strategy 2 is followed.
+///   <tr><td> + RooFit::Threads <td> Added to any of the above, e.g. `RooFit::Interleave|RooFit::Threads`, calculate
+///                     the partitions in parallel threads of this process instead of forked processes.
 ///   </table>
 /// <tr><td> `BatchMode(bool on)`              <td> Batch evaluation mode. See createNLL().
 /// <tr><td> `Optimize(Bool_t flag)`           <td> Activate constant term optimization (on by default)
@@ -1166,6 +1168,8 @@ RooAbsReal* RooAbsPdf::createNLL(RooAbsData& data, const RooLinkedList& cmdList)
 ///                     do not share many parameters
 ///   <tr><td> 3 = RooFit::Hybrid <td> Follow strategy 0 for all RooSimultaneous components, except those with less than
 ///                     30 dataset entries, for which strategy 2 is followed.
+///   <tr><td> + RooFit::Threads <td> Added to any of the above, e.g. `RooFit::Interleave|RooFit::Threads`, calculate
+///                     the partitions in parallel threads of this process instead of forked processes.
 ///   </table>
 /// <tr><td> `SplitRange(Bool_t flag)`          <td>  Use separate fit ranges in a simultaneous fit. Actual range name for each subsample is assumed
 ///                                                 to by `rangeName_indexState` where indexState is the state of the master index category of the simultaneous fit.
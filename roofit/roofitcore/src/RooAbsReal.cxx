@@ -104,6 +104,7 @@
 #include "TVector.h"
 #include "ROOT/RMakeUnique.hxx"
 
+#include <mutex>
 #include <sstream>
 
 using namespace std ;
@@ -120,6 +121,15 @@ RooAbsReal::ErrorLoggingMode RooAbsReal::_evalErrorMode = RooAbsReal::PrintError
 Int_t RooAbsReal::_evalErrorCount = 0 ;
 map<const RooAbsArg*,pair<string,list<RooAbsReal::EvalError> > > RooAbsReal::_evalErrorList ;
 
+namespace {
+/// Protects the error count and list, which are filled by the partitions of the
+/// test statistics calculated in parallel threads
+std::mutex& evalErrorMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// coverity[UNINIT_CTOR]
@@ -3676,16 +3686,18 @@ void RooAbsReal::logEvalError(const RooAbsReal* originator, const char* origName
   }
 
   if (_evalErrorMode==CountErrors) {
+    std::lock_guard<std::mutex> lock(evalErrorMutex()) ;
     _evalErrorCount++ ;
     return ;
   }
 
-  static Bool_t inLogEvalError = kFALSE ;
+  static thread_local Bool_t inLogEvalError = kFALSE ;
 
   if (inLogEvalError) {
     return ;
   }
   inLogEvalError = kTRUE ;
+  std::lock_guard<std::mutex> lock(evalErrorMutex()) ;
 
   EvalError ee ;
   ee.setMessage(message) ;
@@ -3731,16 +3743,18 @@ void RooAbsReal::logEvalError(const char* message, const char* serverValueString
   }
 
   if (_evalErrorMode==CountErrors) {
+    std::lock_guard<std::mutex> lock(evalErrorMutex()) ;
     _evalErrorCount++ ;
     return ;
   }
 
-  static Bool_t inLogEvalError = kFALSE ;
+  static thread_local Bool_t inLogEvalError = kFALSE ;
 
   if (inLogEvalError) {
     return ;
   }
   inLogEvalError = kTRUE ;
+  std::lock_guard<std::mutex> lock(evalErrorMutex()) ;
 
   EvalError ee ;
   ee.setMessage(message) ;
@@ -32,6 +32,15 @@ organizes multi-processor parallel calculation of test statistic
 values. For the latter, the test statistic value is calculated in
 partitions in parallel executing processes and a posteriori
 combined in the main thread.
+
+If the RooFit::Threads flag is added to the partitioning strategy, e.g.
+with NumCPU(4,RooFit::BulkPartition|RooFit::Threads), the partitions are
+instead calculated by parallel tasks of the same process. Each partition has its own copy of the function, the data and
+the parameters, whose values are copied from the parameters of the test
+statistic before each calculation, in memory rather than through pipes.
+The partitions are combined in a fixed order with a Kahan sum, so that
+the value of the test statistic does not depend on the scheduling of
+the tasks.
 **/
 
 #include "RooAbsTestStatistic.h"
@@ -54,6 +63,10 @@ combined in the main thread.
 #include "TClass.h"
 #include <string>
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 using namespace std;
 
 ClassImp(RooAbsTestStatistic);
@@ -65,7 +78,7 @@ RooAbsTestStatistic::RooAbsTestStatistic() :
   _func(0), _data(0), _projDeps(0), _splitRange(0), _simCount(0),
   _verbose(kFALSE), _init(kFALSE), _gofOpMode(Slave), _nEvents(0), _setNum(0),
   _numSets(0), _extSet(0), _nGof(0), _gofArray(0), _nCPU(1), _mpfeArray(0),
-  _mpinterl(RooFit::BulkPartition), _doOffset(kFALSE), _offset(0),
+  _mpinterl(RooFit::BulkPartition), _mpThreads(kFALSE), _mtCachesReady(kFALSE), _doOffset(kFALSE), _offset(0),
   _offsetCarry(0), _evalCarry(0)
 {
 }
@@ -81,12 +94,14 @@ RooAbsTestStatistic::RooAbsTestStatistic() :
 /// \param[in] projDeps A set of projected observables
 /// \param[in] rangeName Fit data only in range with given name
 /// \param[in] addCoefRangeName If not null, all RooAddPdf components of `real` will be instructed to fix their fraction definitions to the given named range.
-/// \param[in] nCPU If larger than one, the test statistic calculation will be parallelized over multiple processes.
+/// \param[in] nCPU If larger than one, the test statistic calculation will be parallelized over multiple processes,
+/// or over as many partitions calculated by parallel threads if `interleave` includes the RooFit::Threads flag.
 /// By default the data is split with 'bulk' partitioning (each process calculates a contigious block of fraction 1/nCPU
 /// of the data). For binned data this approach may be suboptimal as the number of bins with >0 entries
 /// in each processing block many vary greatly thereby distributing the workload rather unevenly.
 /// \param[in] interleave is set to true, the interleave partitioning strategy is used where each partition
 /// i takes all bins for which (ibin % ncpu == i) which is more likely to result in an even workload.
+/// With the RooFit::Threads flag added, the partitions are calculated in threads instead of processes.
 /// \param[in] verbose Be more verbose.
 /// \param[in] splitCutRange If true, a different rangeName constructed as rangeName_{catName} will be used
 /// as range definition for each index state of a RooSimultaneous. This means that a different range can be defined
@@ -114,7 +129,9 @@ RooAbsTestStatistic::RooAbsTestStatistic(const char *name, const char *title, Ro
   _gofArray(0),
   _nCPU(nCPU),
   _mpfeArray(0),
-  _mpinterl(interleave),
+  _mpinterl(RooFit::MPSplit(interleave & ~RooFit::Threads)),
+  _mpThreads((interleave & RooFit::Threads) != 0),
+  _mtCachesReady(kFALSE),
   _doOffset(kFALSE),
   _offset(0),
   _offsetCarry(0),
@@ -131,7 +148,7 @@ RooAbsTestStatistic::RooAbsTestStatistic(const char *name, const char *title, Ro
       _nCPU=1 ;
     }
 
-    _gofOpMode = MPMaster ;
+    _gofOpMode = (_nCPU>1 && _mpThreads) ? MTMaster : MPMaster ;
 
   } else {
 
@@ -174,6 +191,8 @@ RooAbsTestStatistic::RooAbsTestStatistic(const RooAbsTestStatistic& other, const
   _nCPU(other._nCPU),
   _mpfeArray(0),
   _mpinterl(other._mpinterl),
+  _mpThreads(other._mpThreads),
+  _mtCachesReady(kFALSE),
   _doOffset(other._doOffset),
   _offset(other._offset),
   _offsetCarry(other._offsetCarry),
@@ -188,7 +207,7 @@ RooAbsTestStatistic::RooAbsTestStatistic(const RooAbsTestStatistic& other, const
       _nCPU=1 ;
     }
       
-    _gofOpMode = MPMaster ;
+    _gofOpMode = (_nCPU>1 && _mpThreads) ? MTMaster : MPMaster ;
 
   } else {
 
@@ -228,6 +247,9 @@ RooAbsTestStatistic::~RooAbsTestStatistic()
     delete[] _gofArray ;
   }
 
+  for (auto gof : _mtGofArray) delete gof;
+  for (auto params : _mtParamSets) delete params;
+
   delete _projDeps ;
 
 }
@@ -299,6 +321,44 @@ Double_t RooAbsTestStatistic::evaluate() const
     _evalCarry = carry;
     return ret ;
 
+  } else if (MTMaster == _gofOpMode) {
+
+    syncMTParameters() ;
+
+    std::vector<Double_t> values(_nCPU), carries(_nCPU) ;
+    auto calculate = [&](UInt_t i) {
+      values[i] = _mtGofArray[i]->getValV() ;
+      carries[i] = _mtGofArray[i]->getCarry() ;
+    } ;
+
+    // The first calculation creates the caches of the partitions (normalization
+    // integrals, ...), which touches global state: do it in this thread
+#ifdef R__USE_IMT
+    if (_mtCachesReady) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(calculate, ROOT::TSeqU(_nCPU));
+    } else
+#endif
+    {
+      for (Int_t i = 0; i < _nCPU; ++i) calculate(i);
+      _mtCachesReady = kTRUE ;
+    }
+
+    // Sum the partitions in a fixed order for reproducible results
+    Double_t sum(0), carry = 0.;
+    for (Int_t i = 0; i < _nCPU; ++i) {
+      Double_t y = values[i];
+      carry += carries[i];
+      y -= carry;
+      const Double_t t = sum + y;
+      carry = (t - sum) - y;
+      sum = t;
+    }
+
+    Double_t ret = sum ;
+    _evalCarry = carry;
+    return ret ;
+
   } else {
 
     // Evaluate as straight FUNC
@@ -354,6 +414,8 @@ Bool_t RooAbsTestStatistic::initialize()
   
   if (MPMaster == _gofOpMode) {
     initMPMode(_func,_data,_projDeps,_rangeName.size()?_rangeName.c_str():0,_addCoefRangeName.size()?_addCoefRangeName.c_str():0) ;
+  } else if (MTMaster == _gofOpMode) {
+    initMTMode(_func,_data,_projDeps,_rangeName.size()?_rangeName.c_str():0,_addCoefRangeName.size()?_addCoefRangeName.c_str():0) ;
   } else if (SimMaster == _gofOpMode) {
     initSimMode((RooSimultaneous*)_func,_data,_projDeps,_rangeName.size()?_rangeName.c_str():0,_addCoefRangeName.size()?_addCoefRangeName.c_str():0) ;
   }
@@ -433,6 +495,12 @@ void RooAbsTestStatistic::constOptimizeTestStatistic(ConstOpCode opcode, Bool_t
     for (Int_t i = 0; i < _nCPU; ++i) {
       _mpfeArray[i]->constOptimizeTestStatistic(opcode,doAlsoTrackingOpt);
     }
+  } else if (MTMaster == _gofOpMode) {
+    syncMTParameters();
+    for (auto gof : _mtGofArray) {
+      gof->constOptimizeTestStatistic(opcode,doAlsoTrackingOpt);
+    }
+    _mtCachesReady = kFALSE;
   }
 }
 
@@ -490,6 +558,60 @@ void RooAbsTestStatistic::initMPMode(RooAbsReal* real, RooAbsData* data, const R
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Initialize multi-threaded calculation mode. Create the component test statistics
+/// of the partitions, each with its own copy of the parameters, which are
+/// calculated in parallel tasks by evaluate().
+
+void RooAbsTestStatistic::initMTMode(RooAbsReal* real, RooAbsData* data, const RooArgSet* projDeps, const char* rangeName, const char* addCoefRangeName)
+{
+  for (Int_t i = 0; i < _nCPU; ++i) {
+    RooAbsTestStatistic* gof = create(Form("%s_GOF%d",GetName(),i),Form("%s_GOF%d",GetTitle(),i),*real,*data,*projDeps,
+                                      rangeName,addCoefRangeName,1,_mpinterl,_verbose,_splitRange);
+    RooArgSet* params = (RooArgSet*) _paramSet.snapshot(kFALSE);
+    gof->recursiveRedirectServers(*params);
+    gof->setMPSet(i,_nCPU);
+
+    _mtGofArray.push_back(gof);
+    _mtParamSets.push_back(params);
+  }
+  _mtCachesReady = kFALSE;
+  coutI(Eval) << "RooAbsTestStatistic::initMTMode: created " << _nCPU << " partitions calculated in parallel threads." << endl;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the values and constant flags of the parameters of the test statistic
+/// to the copies used by the partitions of the multi-threaded calculation mode.
+/// Only the parameters that changed are set, to keep the caches of the others.
+
+void RooAbsTestStatistic::syncMTParameters() const
+{
+  for (RooArgSet* params : _mtParamSets) {
+    for (std::size_t i = 0; i < _paramSet.size(); ++i) {
+      const RooAbsArg* master = _paramSet[i];
+      RooAbsArg* copy = (*params)[i];
+
+      auto mvar = dynamic_cast<const RooRealVar*>(master);
+      auto cvar = dynamic_cast<RooRealVar*>(copy);
+      if (mvar && cvar) {
+        if (cvar->getVal() != mvar->getVal()) cvar->setVal(mvar->getVal());
+        if (cvar->isConstant() != mvar->isConstant()) cvar->setConstant(mvar->isConstant());
+        continue;
+      }
+
+      auto mcat = dynamic_cast<const RooAbsCategory*>(master);
+      auto ccat = dynamic_cast<RooAbsCategoryLValue*>(copy);
+      if (mcat && ccat && ccat->getCurrentIndex() != mcat->getCurrentIndex()) {
+        ccat->setIndex(mcat->getCurrentIndex());
+      }
+    }
+  }
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize simultaneous p.d.f processing mode. Strip simultaneous
 /// p.d.f into individual components, split dataset in subset
@@ -526,6 +648,8 @@ void RooAbsTestStatistic::initSimMode(RooSimultaneous* simpdf, RooAbsData* data,
 
   // Allocate arrays
   _gofArray = new pRooAbsTestStatistic[_nGof];
+  // Components are calculated in threads or processes like this test statistic
+  const RooFit::MPSplit mpSplit = RooFit::MPSplit(_mpinterl | (_mpThreads ? RooFit::Threads : 0)) ;
   _gofSplitMode.resize(_nGof);
 
   // Create array of regular fit contexts, containing subset of data and single fitCat PDF
@@ -568,10 +692,10 @@ void RooAbsTestStatistic::initSimMode(RooSimultaneous* simpdf, RooAbsData* data,
       // and omitting them reduces model complexity and associated handling/cloning times
       if (_splitRange && rangeName) {
 	_gofArray[n] = create(catName.c_str(), catName.c_str(),(binnedPdf?*binnedPdf:*pdf),*dset,*projDeps,
-			      Form("%s_%s",rangeName,catName.c_str()),addCoefRangeName,_nCPU*(_mpinterl?-1:1),_mpinterl,_verbose,_splitRange,binnedL);
+			      Form("%s_%s",rangeName,catName.c_str()),addCoefRangeName,_nCPU*(_mpinterl?-1:1),mpSplit,_verbose,_splitRange,binnedL);
       } else {
 	_gofArray[n] = create(catName.c_str(),catName.c_str(),(binnedPdf?*binnedPdf:*pdf),*dset,*projDeps,
-			      rangeName,addCoefRangeName,_nCPU,_mpinterl,_verbose,_splitRange,binnedL);
+			      rangeName,addCoefRangeName,_nCPU,mpSplit,_verbose,_splitRange,binnedL);
       }
       _gofArray[n]->setSimCount(_nGof);
       // *** END HERE
@@ -669,9 +793,10 @@ Bool_t RooAbsTestStatistic::setData(RooAbsData& indata, Bool_t cloneData)
     }
     break;
   case MPMaster:
+  case MTMaster:
     // Not supported
     coutF(DataHandling) << "RooAbsTestStatistic::setData(" << GetName() << ") FATAL: setData() is not supported in multi-processor mode" << endl;
-    throw std::runtime_error("RooAbsTestStatistic::setData is not supported in MPMaster mode");
+    throw std::runtime_error("RooAbsTestStatistic::setData is not supported in MPMaster or MTMaster mode");
     break;
   }
 
@@ -709,6 +834,13 @@ void RooAbsTestStatistic::enableOffsetting(Bool_t flag)
       _mpfeArray[i]->enableOffsetting(flag);
     }
     break;
+  case MTMaster:
+    _doOffset = flag;
+    for (auto gof : _mtGofArray) {
+      gof->enableOffsetting(flag);
+    }
+    setValueDirty() ;
+    break;
   }
 }
 
@@ -73,6 +73,17 @@ void RooArgSet::cleanup() { }
 
 #include "MemPoolForRooSets.h"
 
+#include <mutex>
+
+namespace {
+/// Protects the memory pool, as RooArgSets can be created by the partitions
+/// of the test statistics calculated in parallel threads
+std::mutex& memPoolMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+}
+
 RooArgSet::MemPool* RooArgSet::memPool() {
   RooSentinel::activate();
   static auto * memPool = new RooArgSet::MemPool();
@@ -105,6 +116,7 @@ void* RooArgSet::operator new (size_t bytes)
   //This will fail if a derived class uses this operator
   assert(sizeof(RooArgSet) == bytes);
 
+  std::lock_guard<std::mutex> lock(memPoolMutex());
   return memPool()->allocate(bytes);
 }
 
@@ -126,8 +138,11 @@ void* RooArgSet::operator new (size_t bytes, void* ptr) noexcept
 void RooArgSet::operator delete (void* ptr)
 {
   // Decrease use count in pool that ptr is on
-  if (memPool()->deallocate(ptr))
-    return;
+  {
+    std::lock_guard<std::mutex> lock(memPoolMutex());
+    if (memPool()->deallocate(ptr))
+      return;
+  }
 
   std::cerr << __func__ << " " << ptr << " is not in any of the pools." << std::endl;
 
@@ -0,0 +1,214 @@
+/*****************************************************************************
+ * RooFit
+ * Authors:                                                                  *
+ *   WV, Wouter Verkerke, UC Santa Barbara, verkerke@slac.stanford.edu       *
+ *   DK, David Kirkby,    UC Irvine,         dkirkby@uci.edu                 *
+ *                                                                           *
+ * Copyright (c) 2000-2020, Regents of the University of California          *
+ *                          and Stanford University. All rights reserved.    *
+ *                                                                           *
+ * Redistribution and use in source and binary forms,                        *
+ * with or without modification, are permitted according to the terms        *
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)             *
+ *****************************************************************************/
+
+/**
+\file RooBatchCompute.cxx
+\ingroup Roofitcore
+
+Dispatch of the batch compute kernels to the instruction set of the CPU.
+The kernels of RooBatchComputeKernels.h are compiled once per instruction
+set, using the target pragmas of GCC and clang on x86-64, and the variant
+used by the RooBatchCompute functions is selected the first time one of
+them is called.
+**/
+
+#include "RooBatchCompute.h"
+#include "RooVDTHeaders.h"
+
+#include <atomic>
+
+namespace RooBatchCompute {
+
+namespace {
+struct Kernels {
+  void (*gaussian)(std::size_t, double*, Input, Input, Input);
+  void (*exponential)(std::size_t, double*, Input, Input);
+  void (*breitWigner)(std::size_t, double*, Input, Input, Input);
+  void (*bifurGauss)(std::size_t, double*, Input, Input, Input, Input);
+};
+}
+
+namespace Generic {
+#include "RooBatchComputeKernels.h"
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ROOBATCHCOMPUTE_DISPATCH
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse4.2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("sse4.2")
+#endif
+namespace SSE4 {
+#include "RooBatchComputeKernels.h"
+}
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+namespace AVX2 {
+#include "RooBatchComputeKernels.h"
+}
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx512f,avx512dq,avx2,fma"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512dq,avx2,fma")
+#endif
+namespace AVX512 {
+#include "RooBatchComputeKernels.h"
+}
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif
+
+namespace {
+
+bool isSupported(Architecture arch) {
+  switch (arch) {
+  case Architecture::kGeneric:
+    return true;
+#ifdef ROOBATCHCOMPUTE_DISPATCH
+  case Architecture::kSSE4:
+    return __builtin_cpu_supports("sse4.2");
+  case Architecture::kAVX2:
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  case Architecture::kAVX512:
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")
+        && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+  default:
+    return false;
+  }
+}
+
+const Kernels& kernelsFor(Architecture arch) {
+  switch (arch) {
+#ifdef ROOBATCHCOMPUTE_DISPATCH
+  case Architecture::kSSE4:
+    return SSE4::kernels;
+  case Architecture::kAVX2:
+    return AVX2::kernels;
+  case Architecture::kAVX512:
+    return AVX512::kernels;
+#endif
+  default:
+    return Generic::kernels;
+  }
+}
+
+Architecture bestArchitecture() {
+  for (auto arch : {Architecture::kAVX512, Architecture::kAVX2, Architecture::kSSE4}) {
+    if (isSupported(arch))
+      return arch;
+  }
+  return Architecture::kGeneric;
+}
+
+Architecture& currentArchitecture() {
+  static Architecture arch = bestArchitecture();
+  return arch;
+}
+
+std::atomic<const Kernels*>& currentKernels() {
+  static std::atomic<const Kernels*> kernels{&kernelsFor(currentArchitecture())};
+  return kernels;
+}
+
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the instruction set of the kernels used by the compute functions.
+/// It is the most recent one supported by the CPU unless it was changed with
+/// setArchitecture().
+
+Architecture architecture() {
+  currentKernels();
+  return currentArchitecture();
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of the instruction set `arch`.
+
+const char* architectureName(Architecture arch) {
+  switch (arch) {
+  case Architecture::kSSE4:
+    return "SSE4";
+  case Architecture::kAVX2:
+    return "AVX2";
+  case Architecture::kAVX512:
+    return "AVX512";
+  default:
+    return "generic";
+  }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Use the kernels compiled for the instruction set `arch`, e.g. to compare
+/// their results or speed in tests. This must not be called while batches are
+/// being computed.
+/// \return False, without changing the kernels, if the CPU or the build do not
+/// support `arch`.
+
+bool setArchitecture(Architecture arch) {
+  if (!isSupported(arch))
+    return false;
+
+  currentKernels();
+  currentArchitecture() = arch;
+  currentKernels() = &kernelsFor(arch);
+  return true;
+}
+
+
+void computeGaussian(std::size_t n, double* output, Input x, Input mean, Input sigma) {
+  currentKernels().load(std::memory_order_relaxed)->gaussian(n, output, x, mean, sigma);
+}
+
+void computeExponential(std::size_t n, double* output, Input x, Input c) {
+  currentKernels().load(std::memory_order_relaxed)->exponential(n, output, x, c);
+}
+
+void computeBreitWigner(std::size_t n, double* output, Input x, Input mean, Input width) {
+  currentKernels().load(std::memory_order_relaxed)->breitWigner(n, output, x, mean, width);
+}
+
+void computeBifurGauss(std::size_t n, double* output, Input x, Input mean, Input sigmaL, Input sigmaR) {
+  currentKernels().load(std::memory_order_relaxed)->bifurGauss(n, output, x, mean, sigmaL, sigmaR);
+}
+
+}
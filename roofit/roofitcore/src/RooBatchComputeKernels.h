@@ -0,0 +1,94 @@
+/*****************************************************************************
+ * RooFit
+ * Authors:                                                                  *
+ *   WV, Wouter Verkerke, UC Santa Barbara, verkerke@slac.stanford.edu       *
+ *   DK, David Kirkby,    UC Irvine,         dkirkby@uci.edu                 *
+ *                                                                           *
+ * Copyright (c) 2000-2020, Regents of the University of California          *
+ *                          and Stanford University. All rights reserved.    *
+ *                                                                           *
+ * Redistribution and use in source and binary forms,                        *
+ * with or without modification, are permitted according to the terms        *
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)             *
+ *****************************************************************************/
+
+// Kernels of RooBatchCompute. This file has no include guard: RooBatchCompute.cxx
+// includes it once per instruction set, in a different namespace, after the
+// headers it needs.
+//
+// Each kernel loops over the events with the same code whether the inputs
+// are batches or constants. In the most common case, a batch of observables
+// and constant parameters, the parameters are passed as BracketAdapter so that
+// the loop vectorises without gathers.
+
+namespace {
+using BatchHelpers::BracketAdapter;
+
+template<class Tx, class TMean, class TSig>
+inline void gaussian(std::size_t n, double* __restrict output, Tx x, TMean mean, TSig sigma) {
+  for (std::size_t i = 0; i < n; ++i) { //CHECK_VECTORISE
+    const double arg = x[i] - mean[i];
+    const double halfBySigmaSq = -0.5 / (sigma[i] * sigma[i]);
+    output[i] = _rf_fast_exp(arg*arg * halfBySigmaSq);
+  }
+}
+
+template<class Tx, class Tc>
+inline void exponential(std::size_t n, double* __restrict output, Tx x, Tc c) {
+  for (std::size_t i = 0; i < n; ++i) { //CHECK_VECTORISE
+    output[i] = _rf_fast_exp(x[i]*c[i]);
+  }
+}
+
+template<class Tx, class TMean, class TWidth>
+inline void breitWigner(std::size_t n, double* __restrict output, Tx x, TMean mean, TWidth width) {
+  for (std::size_t i = 0; i < n; ++i) { //CHECK_VECTORISE
+    const double arg = x[i] - mean[i];
+    output[i] = 1 / (arg*arg + 0.25*width[i]*width[i]);
+  }
+}
+
+template<class Tx, class TMean, class TSigL, class TSigR>
+inline void bifurGauss(std::size_t n, double* __restrict output, Tx x, TMean mean, TSigL sigmaL, TSigR sigmaR) {
+  for (std::size_t i = 0; i < n; ++i) { //CHECK_VECTORISE
+    const double arg = x[i] - mean[i];
+    const double scaled = arg / ((arg < 0.0)*sigmaL[i] + (arg >= 0.0)*sigmaR[i]);
+    output[i] = (arg > 1e-30 || arg < -1e-30) ? _rf_fast_exp(-0.5*scaled*scaled) : 1.0;
+  }
+}
+}
+
+void computeGaussian(std::size_t n, double* output, Input x, Input mean, Input sigma) {
+  if (x.isBatch() && !mean.isBatch() && !sigma.isBatch()) {
+    gaussian(n, output, x.data(), BracketAdapter<double>(mean.value()), BracketAdapter<double>(sigma.value()));
+  } else {
+    gaussian(n, output, x.adapter(), mean.adapter(), sigma.adapter());
+  }
+}
+
+void computeExponential(std::size_t n, double* output, Input x, Input c) {
+  if (x.isBatch() && !c.isBatch()) {
+    exponential(n, output, x.data(), BracketAdapter<double>(c.value()));
+  } else {
+    exponential(n, output, x.adapter(), c.adapter());
+  }
+}
+
+void computeBreitWigner(std::size_t n, double* output, Input x, Input mean, Input width) {
+  if (x.isBatch() && !mean.isBatch() && !width.isBatch()) {
+    breitWigner(n, output, x.data(), BracketAdapter<double>(mean.value()), BracketAdapter<double>(width.value()));
+  } else {
+    breitWigner(n, output, x.adapter(), mean.adapter(), width.adapter());
+  }
+}
+
+void computeBifurGauss(std::size_t n, double* output, Input x, Input mean, Input sigmaL, Input sigmaR) {
+  if (x.isBatch() && !mean.isBatch() && !sigmaL.isBatch() && !sigmaR.isBatch()) {
+    bifurGauss(n, output, x.data(), BracketAdapter<double>(mean.value()),
+        BracketAdapter<double>(sigmaL.value()), BracketAdapter<double>(sigmaR.value()));
+  } else {
+    bifurGauss(n, output, x.adapter(), mean.adapter(), sigmaL.adapter(), sigmaR.adapter());
+  }
+}
+
+const Kernels kernels = { &computeGaussian, &computeExponential, &computeBreitWigner, &computeBifurGauss };
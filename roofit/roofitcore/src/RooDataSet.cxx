@@ -451,6 +451,8 @@ RooDataSet::RooDataSet(const char* name, const char* title, const RooArgSet& var
         RooFormulaVar cutVarTmp(cutSpec,cutSpec,_vars) ;
         if (tstore) {
           tstore->loadValues(impTree,&cutVarTmp,cutRange);
+        } else if (vstore) {
+          vstore->loadValues(impTree,&cutVarTmp);
         } else {
           RooTreeDataStore tmpstore(name,title,_vars,wgtVarName) ;
           tmpstore.loadValues(impTree,&cutVarTmp,cutRange) ;
@@ -472,6 +474,8 @@ RooDataSet::RooDataSet(const char* name, const char* title, const RooArgSet& var
         RooFormulaVar cutVarTmp(cutSpec,cutSpec,_vars) ;
         if (tstore) {
           tstore->loadValues(t,&cutVarTmp,cutRange);
+        } else if (vstore) {
+          vstore->loadValues(t,&cutVarTmp);
         } else {
           RooTreeDataStore tmpstore(name,title,_vars,wgtVarName) ;
           tmpstore.loadValues(t,&cutVarTmp,cutRange) ;
@@ -510,6 +514,8 @@ RooDataSet::RooDataSet(const char* name, const char* title, const RooArgSet& var
         // Case 4b --- Import TTree from memory with cutvar
         if (tstore) {
           tstore->loadValues(impTree,cutVar,cutRange);
+        } else if (vstore) {
+          vstore->loadValues(impTree,cutVar);
         } else {
           RooTreeDataStore tmpstore(name,title,_vars,wgtVarName) ;
           tmpstore.loadValues(impTree,cutVar,cutRange) ;
@@ -529,6 +535,8 @@ RooDataSet::RooDataSet(const char* name, const char* title, const RooArgSet& var
         }
         if (tstore) {
           tstore->loadValues(t,cutVar,cutRange);
+        } else if (vstore) {
+          vstore->loadValues(t,cutVar);
         } else {
           RooTreeDataStore tmpstore(name,title,_vars,wgtVarName) ;
           tmpstore.loadValues(t,cutVar,cutRange) ;
@@ -582,6 +590,8 @@ RooDataSet::RooDataSet(const char* name, const char* title, const RooArgSet& var
 
         if (tstore) {
           tstore->loadValues(impTree,0,cutRange);
+        } else if (vstore) {
+          vstore->loadValues(impTree,0);
         } else {
           RooTreeDataStore tmpstore(name,title,_vars,wgtVarName) ;
           tmpstore.loadValues(impTree,0,cutRange) ;
@@ -717,17 +727,13 @@ RooDataSet::RooDataSet(const char *name, const char *title, TTree *theTree,
     const RooArgSet& vars, const RooFormulaVar& cutVar, const char* wgtVarName) :
   RooAbsData(name,title,vars)
 {
-  // Create tree version of datastore 
-  RooTreeDataStore* tstore = new RooTreeDataStore(name,title,_vars,*theTree,cutVar,wgtVarName) ;
-
-  // Convert to vector datastore if needed
   if (defaultStorageType==Tree) {
-    _dstore = tstore ;
+    _dstore = new RooTreeDataStore(name,title,_vars,*theTree,cutVar,wgtVarName) ;
   } else if (defaultStorageType==Vector) {
+    // Load the columns of the vector datastore from the tree directly
     RooVectorDataStore* vstore = new RooVectorDataStore(name,title,_vars,wgtVarName) ;
     _dstore = vstore ;
-    _dstore->append(*tstore) ;
-    delete tstore ;
+    vstore->loadValues(theTree,&cutVar) ;
   } else {
     _dstore = 0 ;
   }
@@ -765,17 +771,18 @@ RooDataSet::RooDataSet(const char* name, const char* title, TTree* theTree,
     const RooArgSet& vars, const char* cuts, const char* wgtVarName) :
   RooAbsData(name,title,vars)
 {
-  // Create tree version of datastore 
-  RooTreeDataStore* tstore = new RooTreeDataStore(name,title,_vars,*theTree,cuts,wgtVarName);
-
-  // Convert to vector datastore if needed
   if (defaultStorageType==Tree) {
-    _dstore = tstore ;
+    _dstore = new RooTreeDataStore(name,title,_vars,*theTree,cuts,wgtVarName);
   } else if (defaultStorageType==Vector) {
+    // Load the columns of the vector datastore from the tree directly
     RooVectorDataStore* vstore = new RooVectorDataStore(name,title,_vars,wgtVarName) ;
     _dstore = vstore ;
-    _dstore->append(*tstore) ;
-    delete tstore ;
+    if (cuts && *cuts) {
+      RooFormulaVar select(cuts, cuts, _vars, /*checkVariables=*/false);
+      vstore->loadValues(theTree,&select) ;
+    } else {
+      vstore->loadValues(theTree) ;
+    }
   } else {
     _dstore = 0 ;
   }
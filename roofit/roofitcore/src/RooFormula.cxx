@@ -65,6 +65,7 @@ Check the tutorial rf506_msgservice.C for details.
 #include "TClass.h"
 
 #include <sstream>
+#include <algorithm>
 #include <regex>
 
 using namespace std;
@@ -363,6 +364,60 @@ Double_t RooFormula::eval(const RooArgSet* nset) const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula for a batch of events, using the batches of values of
+/// its parameters and observables. The results are stored in the batch memory
+/// of dataOwner, the RooFormulaVar or RooGenericPdf holding the formula.
+/// Categories are not computed in batches: their current index is used for all
+/// the events. Returns an empty span if none of the arguments has a batch.
+
+RooSpan<double> RooFormula::evaluateBatch(const RooAbsReal* dataOwner, std::size_t begin, std::size_t batchSize,
+    const RooArgSet* normSet) const
+{
+  if (!_tFormula) {
+    coutF(Eval) << __func__ << " (" << GetName() << "): Formula didn't compile: " << GetTitle() << endl;
+    std::string what = "Formula ";
+    what += GetTitle();
+    what += " didn't compile.";
+    throw std::runtime_error(what);
+  }
+
+  std::vector<RooSpan<const double>> inputs(_origList.size());
+  std::vector<double> pars(_origList.size());
+  bool haveBatch = false;
+  for (unsigned int i = 0; i < _origList.size(); ++i) {
+    if (_isCategory[i]) {
+      const auto& cat = static_cast<RooAbsCategory&>(_origList[i]);
+      pars[i] = cat.getCurrentIndex();
+      continue;
+    }
+
+    const auto& real = static_cast<RooAbsReal&>(_origList[i]);
+    inputs[i] = real.getValBatch(begin, batchSize, normSet);
+    if (inputs[i].empty()) {
+      pars[i] = real.getVal(normSet);
+    } else {
+      batchSize = std::min(batchSize, inputs[i].size());
+      haveBatch = true;
+    }
+  }
+
+  if (!haveBatch)
+    return {};
+
+  auto output = dataOwner->_batchData.makeWritableBatchUnInit(begin, batchSize);
+  for (std::size_t j = 0; j < output.size(); ++j) {
+    for (unsigned int i = 0; i < inputs.size(); ++i) {
+      if (!inputs[i].empty())
+        pars[i] = inputs[i][j];
+    }
+    output[j] = _tFormula->EvalPar(pars.data());
+  }
+
+  return output;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Printing interface
 
@@ -151,6 +151,16 @@ Double_t RooFormulaVar::evaluate() const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula for a batch of events, from the batches of values of
+/// the variables it depends on.
+
+RooSpan<double> RooFormulaVar::evaluateBatch(std::size_t begin, std::size_t batchSize) const
+{
+  return formula().evaluateBatch(this, begin, batchSize, _lastNSet);
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Propagate server change information to embedded RooFormula object
 
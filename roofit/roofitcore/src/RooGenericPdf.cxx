@@ -126,6 +126,16 @@ Double_t RooGenericPdf::evaluate() const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula for a batch of events, from the batches of values of
+/// the variables it depends on.
+
+RooSpan<double> RooGenericPdf::evaluateBatch(std::size_t begin, std::size_t batchSize) const
+{
+  return formula().evaluateBatch(this, begin, batchSize, _normSet);
+}
+
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Change formula expression to given expression
@@ -241,6 +241,37 @@ void RooMinimizer::setOffsetting(Bool_t flag)
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Provide the gradient of the function to the minimizer, computed numerically
+/// by nWorkers parallel tasks, instead of letting it compute the derivatives
+/// one after the other. Each task evaluates its own clone of the function,
+/// shifting one parameter at a time, so that only the part of the clone
+/// depending on this parameter is recomputed. This is beneficial for fits
+/// of many parameters, e.g. the nuisance parameters of a HistFactory model.
+/// The tasks are run in parallel if ROOT is built with multi-threading.
+/// The setting applies from the next minimization; nWorkers=0 disables it.
+
+void RooMinimizer::setParallelGradient(Int_t nWorkers)
+{
+  _fcn->SetParallelGradient(nWorkers) ;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Minimize the function with the current configuration of the fitter,
+/// providing it with the gradient if setParallelGradient() was used.
+
+bool RooMinimizer::fitFcn() const
+{
+  if (_fcn->GetParallelGradient() > 0) {
+    return _theFitter->FitFCN(static_cast<const ROOT::Math::IMultiGradFunction&>(*_fcn)) ;
+  }
+  return _theFitter->FitFCN(static_cast<const ROOT::Math::IMultiGenFunction&>(*_fcn)) ;
+}
+
+
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Choose the minimiser algorithm.
@@ -323,7 +354,7 @@ Int_t RooMinimizer::minimize(const char* type, const char* alg)
   RooAbsReal::setEvalErrorLoggingMode(RooAbsReal::CollectErrors) ;
   RooAbsReal::clearEvalErrorLog() ;
 
-  bool ret = _theFitter->FitFCN(*_fcn);
+  bool ret = fitFcn();
   _status = ((ret) ? _theFitter->Result().Status() : -1);
 
   RooAbsReal::setEvalErrorLoggingMode(RooAbsReal::PrintErrors) ;
@@ -352,7 +383,7 @@ Int_t RooMinimizer::migrad()
   RooAbsReal::clearEvalErrorLog() ;
 
   _theFitter->Config().SetMinimizer(_minimizerType.c_str(),"migrad");
-  bool ret = _theFitter->FitFCN(*_fcn);
+  bool ret = fitFcn();
   _status = ((ret) ? _theFitter->Result().Status() : -1);
 
   RooAbsReal::setEvalErrorLoggingMode(RooAbsReal::PrintErrors) ;
@@ -515,7 +546,7 @@ Int_t RooMinimizer::seek()
   RooAbsReal::clearEvalErrorLog() ;
 
   _theFitter->Config().SetMinimizer(_minimizerType.c_str(),"seek");
-  bool ret = _theFitter->FitFCN(*_fcn);
+  bool ret = fitFcn();
   _status = ((ret) ? _theFitter->Result().Status() : -1);
 
   RooAbsReal::setEvalErrorLoggingMode(RooAbsReal::PrintErrors) ;
@@ -544,7 +575,7 @@ Int_t RooMinimizer::simplex()
   RooAbsReal::clearEvalErrorLog() ;
 
   _theFitter->Config().SetMinimizer(_minimizerType.c_str(),"simplex");
-  bool ret = _theFitter->FitFCN(*_fcn);
+  bool ret = fitFcn();
   _status = ((ret) ? _theFitter->Result().Status() : -1);
 
   RooAbsReal::setEvalErrorLoggingMode(RooAbsReal::PrintErrors) ;
@@ -573,7 +604,7 @@ Int_t RooMinimizer::improve()
   RooAbsReal::clearEvalErrorLog() ;
 
   _theFitter->Config().SetMinimizer(_minimizerType.c_str(),"migradimproved");
-  bool ret = _theFitter->FitFCN(*_fcn);
+  bool ret = fitFcn();
   _status = ((ret) ? _theFitter->Result().Status() : -1);
 
   RooAbsReal::setEvalErrorLoggingMode(RooAbsReal::PrintErrors) ;
@@ -17,7 +17,14 @@
 //
 // RooMinimizerFcn is am interface class to the ROOT::Math function 
 // for minization.
-//                                                                                   
+//
+// It can also provide the gradient of the function, computed numerically
+// by central differences. With SetParallelGradient(n), the partial
+// derivatives are distributed among n tasks, each evaluating its own clone
+// of the function. A task shifts one parameter at a time, so only the part
+// of its clone that depends on this parameter is recomputed, e.g. a single
+// channel of a simultaneous likelihood.
+//
 
 #include <iostream>
 
@@ -34,10 +41,19 @@
 #include "RooArgSet.h"
 #include "RooRealVar.h"
 #include "RooAbsRealLValue.h"
+#include "RooAbsCategoryLValue.h"
 #include "RooMsgService.h"
 
 #include "RooMinimizer.h"
 
+#include "RConfigure.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <cmath>
+
 using namespace std;
 
 RooMinimizerFcn::RooMinimizerFcn(RooAbsReal *funct, RooMinimizer* context,
@@ -47,7 +63,8 @@ RooMinimizerFcn::RooMinimizerFcn(RooAbsReal *funct, RooMinimizer* context,
   _maxFCN(-1e30), _numBadNLL(0),  
   _printEvalErrors(10), _doEvalErrorWall(kTRUE),
   _nDim(0), _logfile(0),
-  _verbose(verbose)
+  _verbose(verbose),
+  _nGradWorkers(0), _optConst(kFALSE)
 { 
 
   _evalCounter = 0 ;
@@ -94,7 +111,7 @@ RooMinimizerFcn::RooMinimizerFcn(RooAbsReal *funct, RooMinimizer* context,
 
 
 
-RooMinimizerFcn::RooMinimizerFcn(const RooMinimizerFcn& other) : ROOT::Math::IBaseFunctionMultiDim(other), 
+RooMinimizerFcn::RooMinimizerFcn(const RooMinimizerFcn& other) : ROOT::Math::IMultiGradFunction(other), 
   _evalCounter(other._evalCounter),
   _funct(other._funct),
   _context(other._context),
@@ -105,7 +122,10 @@ RooMinimizerFcn::RooMinimizerFcn(const RooMinimizerFcn& other) : ROOT::Math::IBa
   _nDim(other._nDim),
   _logfile(other._logfile),
   _verbose(other._verbose),
-  _floatParamVec(other._floatParamVec)
+  _floatParamVec(other._floatParamVec),
+  _nGradWorkers(other._nGradWorkers),
+  _optConst(other._optConst),
+  _gradWorkers(other._gradWorkers)
 {  
   _floatParamList = new RooArgList(*other._floatParamList) ;
   _constParamList = new RooArgList(*other._constParamList) ;
@@ -372,6 +392,10 @@ Bool_t RooMinimizerFcn::Synchronize(std::vector<ROOT::Fit::ParameterSettings>& p
 
   updateFloatVec() ;
 
+  // The clones of the parallel gradient calculation are recreated for the new configuration
+  _optConst = optConst ;
+  _gradWorkers.reset() ;
+
   return 0 ;  
 
 }
@@ -579,5 +603,176 @@ double RooMinimizerFcn::DoEval(const double *x) const
   return fvalue;
 }
 
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the gradient in nWorkers parallel tasks when the function is
+/// minimized, each task computing the partial derivatives of a block of
+/// parameters with its own clone of the function. This requires that of the
+/// memory and of the setup of nWorkers clones, e.g. of the likelihood and its
+/// data. With nWorkers=0, the gradient is left to the minimizer.
+
+void RooMinimizerFcn::SetParallelGradient(Int_t nWorkers)
+{
+  _nGradWorkers = std::max(nWorkers, 0) ;
+  _gradWorkers.reset() ;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Step of the central difference of the parameter index at value. It is a
+/// hundredth of its error, i.e. the initial step size of MINUIT, if known.
+
+Double_t RooMinimizerFcn::gradientStep(Int_t index, Double_t value) const
+{
+  const Double_t error = static_cast<RooRealVar*>(_floatParamVec[index])->getError() ;
+  return error > 0 ? 1e-2 * error : 1e-4 * std::max(1., std::abs(value)) ;
+}
+
+
+
+namespace {
+
+/// Central difference of func in var around x, restricted to the range of var.
+/// Returns zero if the function cannot be evaluated on both sides.
+Double_t centralDifference(const RooAbsReal& func, RooRealVar& var, Double_t x, Double_t step)
+{
+  const Double_t up = std::min(x + step, var.getMax()) ;
+  const Double_t down = std::max(x - step, var.getMin()) ;
+  var.setVal(up) ;
+  const Double_t fUp = func.getVal() ;
+  var.setVal(down) ;
+  const Double_t fDown = func.getVal() ;
+  var.setVal(x) ;
+
+  const Double_t derivative = (fUp - fDown) / (up - down) ;
+  return std::isfinite(derivative) ? derivative : 0. ;
+}
+
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the clones of the function used by the tasks of Gradient(), with
+/// the same constant-term optimization as the function.
+
+void RooMinimizerFcn::initGradientWorkers() const
+{
+  _gradWorkers = std::make_shared<GradientWorkers>() ;
+  _gradWorkers->_floatParamVec = _floatParamVec ;
+  _gradWorkers->_workers.resize(_nGradWorkers) ;
+
+  for (auto& worker : _gradWorkers->_workers) {
+    worker._funct.reset(static_cast<RooAbsReal*>(_funct->cloneTree())) ;
+    std::unique_ptr<RooArgSet> params(worker._funct->getParameters(RooArgSet())) ;
+
+    for (auto par : _floatParamVec) {
+      worker._floatParams.push_back(static_cast<RooRealVar*>(params->find(par->GetName()))) ;
+    }
+    for (auto par : *_constParamList) {
+      if (RooAbsArg* workerPar = params->find(par->GetName())) {
+        worker._constParams.emplace_back(workerPar, par) ;
+      }
+    }
+
+    if (_optConst) {
+      worker._funct->constOptimizeTestStatistic(RooAbsArg::Activate) ;
+    }
+    if (_funct->isOffsetting()) {
+      worker._funct->enableOffsetting(kTRUE) ;
+    }
+    // Build the caches of the clone in this thread
+    worker._funct->getVal() ;
+  }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Partial derivative along the parameter icoord at x, by a central difference.
+
+double RooMinimizerFcn::DoDerivative(const double *x, unsigned int icoord) const
+{
+  for (int index = 0; index < _nDim; index++) {
+    SetPdfParamVal(index,x[index]);
+  }
+
+  RooAbsReal::setHideOffset(kFALSE) ;
+  const Double_t derivative = centralDifference(*_funct, *static_cast<RooRealVar*>(_floatParamVec[icoord]),
+                                                x[icoord], gradientStep(icoord, x[icoord])) ;
+  RooAbsReal::setHideOffset(kTRUE) ;
+  RooAbsReal::clearEvalErrorLog() ;
+
+  return derivative ;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Gradient at x. If SetParallelGradient() was set, the partial derivatives are
+/// computed by parallel tasks, otherwise one after the other by DoDerivative().
+
+void RooMinimizerFcn::Gradient(const double *x, double *grad) const
+{
+  if (_nGradWorkers == 0) {
+    for (int index = 0; index < _nDim; index++) {
+      grad[index] = DoDerivative(x, index) ;
+    }
+    return ;
+  }
+
+  if (!_gradWorkers || _gradWorkers->_floatParamVec != _floatParamVec) {
+    initGradientWorkers() ;
+  }
+
+  std::vector<Double_t> steps(_nDim) ;
+  for (int index = 0; index < _nDim; index++) {
+    steps[index] = gradientStep(index, x[index]) ;
+  }
+
+  auto& workers = _gradWorkers->_workers ;
+  auto computeBlock = [&](UInt_t iWorker) {
+    GradientWorker& worker = workers[iWorker] ;
+    // Synchronize the parameters of the clone, keeping the caches of the unchanged ones
+    for (auto& pars : worker._constParams) {
+      auto workerVar = dynamic_cast<RooRealVar*>(pars.first) ;
+      auto var = dynamic_cast<const RooRealVar*>(pars.second) ;
+      if (workerVar && var && workerVar->getVal() != var->getVal()) {
+        workerVar->setVal(var->getVal()) ;
+      }
+      auto workerCat = dynamic_cast<RooAbsCategoryLValue*>(pars.first) ;
+      auto cat = dynamic_cast<const RooAbsCategory*>(pars.second) ;
+      if (workerCat && cat && workerCat->getCurrentIndex() != cat->getCurrentIndex()) {
+        workerCat->setIndex(cat->getCurrentIndex()) ;
+      }
+    }
+    for (int index = 0; index < _nDim; index++) {
+      if (worker._floatParams[index]->getVal() != x[index]) {
+        worker._floatParams[index]->setVal(x[index]) ;
+      }
+    }
+
+    const Int_t first = _nDim * iWorker / workers.size() ;
+    const Int_t last = _nDim * (iWorker + 1) / workers.size() ;
+    for (Int_t index = first; index < last; ++index) {
+      grad[index] = centralDifference(*worker._funct, *worker._floatParams[index], x[index], steps[index]) ;
+    }
+  } ;
+
+  RooAbsReal::setHideOffset(kFALSE) ;
+#ifdef R__USE_IMT
+  ROOT::TThreadExecutor pool ;
+  pool.Foreach(computeBlock, ROOT::TSeqU(workers.size())) ;
+#else
+  for (UInt_t iWorker = 0; iWorker < workers.size(); ++iWorker) {
+    computeBlock(iWorker) ;
+  }
+#endif
+  RooAbsReal::setHideOffset(kTRUE) ;
+  RooAbsReal::clearEvalErrorLog() ;
+}
+
 #endif
 
@@ -235,6 +235,9 @@ void RooNLLVar::applyWeightSquared(Bool_t flag)
   } else if ( _gofOpMode==MPMaster) {
     for (Int_t i=0 ; i<_nCPU ; i++)
       _mpfeArray[i]->applyNLLWeightSquared(flag);
+  } else if ( _gofOpMode==MTMaster) {
+    for (auto gof : _mtGofArray)
+      ((RooNLLVar*)gof)->applyWeightSquared(flag);
   } else if ( _gofOpMode==SimMaster) {
     for (Int_t i=0 ; i<_nGof ; i++)
       ((RooNLLVar*)_gofArray[i])->applyWeightSquared(flag);
@@ -676,6 +676,7 @@ Bool_t RooRealIntegral::initNumIntegrator() const
   }
 
   _restartNumIntEngine = kFALSE ;
+  _numIntCache.clear() ;
   return kTRUE;
 }
 
@@ -827,6 +828,8 @@ Double_t RooRealIntegral::evaluate() const
       if (cacheVal) {
         retVal = *cacheVal ;
 	//	cout << "using cached value of integral" << GetName() << endl ;
+      } else if (_intList.getSize()>0 && numIntCacheLookup(retVal)) {
+        // Integrated numerically before with the same parameters and limits
       } else {
 
 
@@ -856,6 +859,8 @@ Double_t RooRealIntegral::evaluate() const
         // Restore integral dependent values
         _intList=_saveInt ;
         _sumList=_saveSum ;
+
+        numIntCacheStore(retVal) ;
         
         // Cache numeric integrals in >1d expensive object cache
         if ((_cacheNum && _intList.getSize()>0) || _intList.getSize()>=_cacheAllNDim) {
@@ -1006,11 +1011,79 @@ Bool_t RooRealIntegral::redirectServersHook(const RooAbsCollection& /*newServerL
     delete _params ;
     _params = 0 ;
   }
+  _numIntCache.clear() ;
+
+  return kFALSE ;
+}
+
+
+
+namespace {
+// Number of numeric integrals remembered by RooRealIntegral::numIntCacheLookup()
+constexpr std::size_t numIntCacheSize = 4 ;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Look for the value of the numeric integral at the current values of the
+/// parameters and integration limits among the last integrals computed.
+/// While minimising, the parameters keep coming back to the same values,
+/// e.g. between the steps of the numerical derivatives, which change one
+/// parameter after the other: integrals depending on several parameters
+/// are then computed again and again for the same values. The key of the
+/// integral is set for numIntCacheStore(). Return false if it is not present,
+/// or if the parameters do not allow caching (e.g. when one of them is a pdf,
+/// whose value depends on its normalisation set).
+
+Bool_t RooRealIntegral::numIntCacheLookup(Double_t& value) const
+{
+  _numIntCacheKey.clear() ;
+  for (const auto param : parameters()) {
+    if (auto cat = dynamic_cast<const RooAbsCategory*>(param)) {
+      _numIntCacheKey.push_back(cat->getIndex()) ;
+    } else if (dynamic_cast<const RooAbsReal*>(param) && !dynamic_cast<const RooAbsPdf*>(param)) {
+      _numIntCacheKey.push_back(static_cast<const RooAbsReal*>(param)->getVal()) ;
+    } else {
+      _numIntCacheKey.clear() ;
+      return kFALSE ;
+    }
+  }
+
+  const char* rangeName = RooNameReg::str(_rangeName) ;
+  for (const auto arg : _intList) {
+    auto var = static_cast<const RooAbsRealLValue*>(arg) ;
+    _numIntCacheKey.push_back(var->getMin(rangeName)) ;
+    _numIntCacheKey.push_back(var->getMax(rangeName)) ;
+  }
 
+  for (const auto& entry : _numIntCache) {
+    if (entry.first == _numIntCacheKey) {
+      value = entry.second ;
+      return kTRUE ;
+    }
+  }
   return kFALSE ;
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Remember the numeric integral just computed for the key of the last call to
+/// numIntCacheLookup(), replacing the oldest one if the cache is full.
+
+void RooRealIntegral::numIntCacheStore(Double_t value) const
+{
+  if (_numIntCacheKey.empty()) return ;
+
+  if (_numIntCache.size() < numIntCacheSize) {
+    _numIntCache.emplace_back(_numIntCacheKey, value) ;
+  } else {
+    _numIntCache[_numIntCacheNext] = {_numIntCacheKey, value} ;
+    _numIntCacheNext = (_numIntCacheNext + 1) % numIntCacheSize ;
+  }
+  _numIntCacheKey.clear() ;
+}
+
+
 
 ////////////////////////////////////////////////////////////////////////////////
 
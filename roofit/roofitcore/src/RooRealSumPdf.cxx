@@ -60,6 +60,7 @@ to the fractions of the various functions. **This requires setting the last argu
 #include "RooRealIntegral.h"
 #include "RooMsgService.h"
 #include "RooNameReg.h"
+#include "BatchHelpers.h"
 
 #include <algorithm>
 #include <memory>
@@ -285,6 +286,72 @@ Double_t RooRealSumPdf::evaluate() const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the sum of the functions in batches. The coefficients do not depend
+/// on the observables (see checkObservables()), so they are the same for all
+/// the events of a batch.
+
+RooSpan<double> RooRealSumPdf::evaluateBatch(std::size_t begin, std::size_t batchSize) const {
+  std::vector<RooSpan<const double>> funcBatches;
+  std::vector<double> funcValues;
+  std::vector<double> coefValues;
+  bool haveBatch = false;
+
+  double lastCoef = 1.;
+  for (unsigned int i = 0; i < _funcList.size(); ++i) {
+    const auto& func = static_cast<const RooAbsReal&>(_funcList[i]);
+    double coefVal = lastCoef;
+    if (i < _coefList.size()) {
+      coefVal = static_cast<const RooAbsReal&>(_coefList[i]).getVal();
+      lastCoef -= coefVal;
+    }
+    if (coefVal == 0. || !func.isSelectedComp())
+      continue;
+
+    funcBatches.push_back(func.getValBatch(begin, batchSize));
+    haveBatch |= !funcBatches.back().empty();
+    funcValues.push_back(funcBatches.back().empty() ? func.getVal() : 0.);
+    coefValues.push_back(coefVal);
+  }
+
+  if (!haveBatch)
+    return {};
+
+  if (!haveLastCoef() && (lastCoef < 0 || lastCoef > 1)) {
+    coutW(Eval) << "RooRealSumPdf::evaluateBatch(" << GetName()
+        << ") WARNING: sum of FUNC coefficients not in range [0-1], value="
+        << 1-lastCoef << ". This means that the PDF is not properly normalised. If the PDF was meant to be extended, provide as many coefficients as functions." << endl ;
+  }
+
+  batchSize = BatchHelpers::findSize(funcBatches);
+  auto output = _batchData.makeWritableBatchInit(begin, batchSize, 0.);
+  const std::size_t n = output.size();
+
+  for (std::size_t j = 0; j < funcBatches.size(); ++j) {
+    const double coef = coefValues[j];
+    if (funcBatches[j].empty()) {
+      const double value = funcValues[j] * coef;
+      for (std::size_t i = 0; i < n; ++i) { //CHECK_VECTORISE
+        output[i] += value;
+      }
+    } else {
+      const auto& batch = funcBatches[j];
+      for (std::size_t i = 0; i < n; ++i) { //CHECK_VECTORISE
+        output[i] += batch[i] * coef;
+      }
+    }
+  }
+
+  // Introduce floor if so requested
+  if (_doFloor || _doFloorGlobal) {
+    for (std::size_t i = 0; i < n; ++i) {
+      if (output[i] < 0.)
+        output[i] = 0.;
+    }
+  }
+
+  return output;
+}
 
 
 ////////////////////////////////////////////////////////////////////////////////
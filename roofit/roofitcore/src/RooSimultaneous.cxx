@@ -458,7 +458,19 @@ Double_t RooSimultaneous::evaluate() const
   //assert(proxy!=0) ;
   if (proxy==0) return 0 ;
 
-  // Calculate relative weighting factor for sim-pdfs of all extendable components
+  // Return the selected PDF value, normalized by the number of index states  
+  return ((RooAbsPdf*)(proxy->absArg()))->getVal(_normSet)*currentCategoryFraction(proxy) ; 
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the relative weighting factor of the PDF of proxy, the one of the
+/// current index category state: its fraction of the expected events if all
+/// the components are extendable, 1 otherwise.
+
+Double_t RooSimultaneous::currentCategoryFraction(RooRealProxy* proxy) const
+{
   Double_t catFrac(1) ;
   if (canBeExtended()) {
     Double_t nEvtCat = ((RooAbsPdf*)(proxy->absArg()))->expectedEvents(_normSet) ; 
@@ -472,9 +484,32 @@ Double_t RooSimultaneous::evaluate() const
     delete iter ;
     catFrac=nEvtCat/nEvtTot ;
   }
+  return catFrac ;
+}
 
-  // Return the selected PDF value, normalized by the number of index states  
-  return ((RooAbsPdf*)(proxy->absArg()))->getVal(_normSet)*catFrac ; 
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the values of the PDF of the current index category state in
+/// batches. As the categories are not stored in batches, the events of the
+/// batch must all belong to the current state, as is the case in a likelihood
+/// split by category (see RooAbsTestStatistic).
+
+RooSpan<double> RooSimultaneous::evaluateBatch(std::size_t begin, std::size_t batchSize) const
+{
+  RooRealProxy* proxy = (RooRealProxy*) _pdfProxyList.FindObject(_indexCat.label()) ;
+  if (proxy==0) return {} ;
+
+  auto pdfValues = ((RooAbsPdf*)(proxy->absArg()))->getValBatch(begin, batchSize, _normSet) ;
+  if (pdfValues.empty()) return {} ;
+
+  const Double_t catFrac = currentCategoryFraction(proxy) ;
+  auto output = _batchData.makeWritableBatchUnInit(begin, pdfValues.size()) ;
+  for (std::size_t i = 0; i < output.size(); ++i) { //CHECK_VECTORISE
+    output[i] = pdfValues[i] * catFrac ;
+  }
+
+  return output ;
 }
 
 
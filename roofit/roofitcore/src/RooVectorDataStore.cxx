@@ -761,6 +761,101 @@ void RooVectorDataStore::loadValues(const RooAbsDataStore *ads, const RooFormula
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Load the entries of the TTree 't' into this data collection, optionally
+/// selecting them with the 'select' RooFormulaVar. As for RooTreeDataStore,
+/// the tree must have a branch with the name of each variable, and entries
+/// with values out of range are skipped.
+///
+/// Only the branches of the variables are read, and their values are copied
+/// directly into the columns of the store, without the intermediate tree
+/// data store of the generic import. If implicit multithreading is enabled,
+/// the baskets of these branches are decompressed in parallel by TTree.
+
+void RooVectorDataStore::loadValues(const TTree *t, const RooFormulaVar* select)
+{
+  // Make our local copy of the tree, so we can safely loop through it.
+  std::unique_ptr<TTree> tClone( static_cast<TTree*>(t->Clone()) );
+  tClone->SetDirectory(t->GetDirectory());
+
+  // Clone list of variables
+  std::unique_ptr<RooArgSet> sourceArgSet( _varsww.snapshot(kFALSE) );
+
+  // Check that we have the branches:
+  for (const auto var : *sourceArgSet) {
+    if (!tClone->GetBranch(var->GetName())) {
+      coutE(InputArguments) << "Didn't find a branch in Tree '" << tClone->GetName()
+          << "' to read variable '" << var->GetName() << "' from."
+          << "\n\tNote: Name the RooFit variable the same as the branch." << std::endl;
+    }
+  }
+
+  // Attach args in cloned list to cloned source tree, and only read their branches
+  tClone->SetBranchStatus("*", false);
+  for (const auto sourceArg : *sourceArgSet) {
+    sourceArg->attachToTree(*tClone, RooTreeDataStore::_defTreeBufSize) ;
+
+    const TString branchName = sourceArg->cleanBranchName();
+    for (const auto& name : {branchName, branchName + "_idx"}) {
+      if (tClone->GetBranch(name)) {
+        tClone->SetBranchStatus(name, true);
+      }
+    }
+  }
+
+  // Redirect formula servers to sourceArgSet
+  std::unique_ptr<RooFormulaVar> selectClone;
+  if (select) {
+    selectClone.reset( static_cast<RooFormulaVar*>(select->cloneTree()) );
+    selectClone->recursiveRedirectServers(*sourceArgSet) ;
+    selectClone->setOperMode(RooAbsArg::ADirty,kTRUE) ;
+  }
+
+  // Loop over events in source tree
+  Int_t numInvalid(0) ;
+  const Long64_t nevent = tClone->GetEntries();
+  reserve(numEntries() + static_cast<Int_t>(nevent));
+  for(Long64_t i=0; i < nevent; ++i) {
+    const auto entryNumber = tClone->GetEntryNumber(i);
+    if (entryNumber<0) break;
+    tClone->GetEntry(entryNumber);
+
+    // Copy from source to destination
+    Bool_t allOK(kTRUE) ;
+    for (unsigned int j=0; j < sourceArgSet->size(); ++j) {
+      auto destArg = _varsww[j];
+      const auto sourceArg = (*sourceArgSet)[j];
+
+      destArg->copyCache(sourceArg) ;
+      sourceArg->copyCache(destArg) ;
+      if (!destArg->isValid()) {
+        numInvalid++ ;
+        allOK=kFALSE ;
+        if (numInvalid < 5) {
+          coutI(DataHandling) << "RooVectorDataStore::loadValues(" << GetName() << ") Skipping event #" << i << " because " << destArg->GetName()
+              << " cannot accommodate the value " << static_cast<RooAbsReal*>(sourceArg)->getVal() << std::endl;
+        } else if (numInvalid == 5) {
+          coutI(DataHandling) << "RooVectorDataStore::loadValues(" << GetName() << ") Skipping ..." << std::endl;
+        }
+        break ;
+      }
+    }
+
+    // Does this event pass the cuts?
+    if (!allOK || (selectClone && selectClone->getVal()==0)) {
+      continue ;
+    }
+
+    fill() ;
+  }
+
+  if (numInvalid>0) {
+    coutW(DataHandling) << "RooVectorDataStore::loadValues(" << GetName() << ") Ignored " << numInvalid << " out-of-range events" << endl ;
+  }
+}
+
+
+
 
 
 ////////////////////////////////////////////////////////////////////////////////
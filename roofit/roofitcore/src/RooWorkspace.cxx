@@ -2721,6 +2721,8 @@ void RooWorkspace::Streamer(TBuffer &R__b)
        }
      }
 
+     RooAbsArg::clientGraphChanged();
+
    }
 }
 
@@ -53,3 +53,27 @@ TEST(GenericPdf, CrashWhenRenamingArguments) {
   // Would crash:
   EXPECT_NEAR(impPdf->getVal(), 0.15, 1.E-6);
 }
+
+// Numeric normalisation integrals are remembered for recent parameters and limits
+TEST(GenericPdf, NumericIntegralsForRecentParameters) {
+  RooRealVar x("x", "x", 1., 0., 2.);
+  RooRealVar a("a", "a", 1., 0., 10.);
+  RooGenericPdf pdf("pdf", "x*x + a", RooArgSet(x, a));
+  RooArgSet normSet(x);
+
+  auto norm = [&](double lo, double hi) {
+    return (hi*hi*hi - lo*lo*lo) / 3. + a.getVal() * (hi - lo);
+  };
+
+  for (double aVal : {1., 2., 1., 3., 2., 1., 5.}) {
+    a.setVal(aVal);
+    EXPECT_NEAR(pdf.getVal(normSet), (1. + aVal) / norm(0., 2.), 1.E-6) << "a = " << aVal;
+  }
+
+  // Changing the limits of the integral must not reuse the integrals for the old ones
+  x.setRange(0., 3.);
+  a.setVal(1.);
+  EXPECT_NEAR(pdf.getVal(normSet), 2. / norm(0., 3.), 1.E-6);
+  x.setRange(0., 2.);
+  EXPECT_NEAR(pdf.getVal(normSet), 2. / norm(0., 2.), 1.E-6);
+}
@@ -4,8 +4,14 @@
 #include "RooRealVar.h"
 #include "RooGenericPdf.h"
 #include "RooFormulaVar.h"
+#include "RooRealSumPdf.h"
 #include "RooDataSet.h"
 #include "RooFitResult.h"
+#include "RooGlobalFunc.h"
+#include "RooMinimizer.h"
+
+#include "RConfigure.h"
+#include "TROOT.h"
 
 #include "gtest/gtest.h"
 
@@ -40,3 +46,98 @@ TEST(RooAbsPdf, AsymptoticallyCorrectErrors)
   EXPECT_GT(aError, a.getError()*2.) << "Asymptotically correct errors should be significantly larger.";
 }
 
+
+// The composite pdfs and the formulae evaluate their batches from
+// the batches of their servers.
+TEST(RooAbsPdf, BatchEvaluationOfComposites)
+{
+  RooRealVar x("x", "x", 1., 0., 10.);
+  RooRealVar a("a", "a", 0.5, 0., 10.);
+  RooRealVar c("c", "c", 0.3, 0., 1.);
+  RooGenericPdf generic("generic", "exp(-a*x)", RooArgSet(x, a));
+  RooFormulaVar f1("f1", "1. + a*x", RooArgSet(x, a));
+  RooFormulaVar f2("f2", "x*x", RooArgSet(x));
+  RooRealSumPdf sumPdf("sumPdf", "sumPdf", RooArgList(f1, f2), RooArgList(c));
+
+  RooDataSet data("data", "data", x);
+  for (unsigned int i = 0; i < 100; ++i) {
+    x.setVal(0.1 * i);
+    data.add(x);
+  }
+
+  for (RooAbsPdf* pdf : std::initializer_list<RooAbsPdf*>{&generic, &sumPdf}) {
+    const RooArgSet normSet(x);
+    std::unique_ptr<RooArgSet> observables(pdf->getObservables(data));
+    data.attachBuffers(*observables);
+    auto batch = pdf->getValBatch(0, data.numEntries(), &normSet);
+    ASSERT_EQ(batch.size(), static_cast<std::size_t>(data.numEntries())) << pdf->GetName();
+
+    std::vector<double> values(batch.begin(), batch.end());
+    data.resetBuffers();
+    for (unsigned int i = 0; i < values.size(); ++i) {
+      x.setVal(0.1 * i);
+      EXPECT_NEAR(values[i], pdf->getVal(normSet), 1.E-12 * pdf->getVal(normSet)) << pdf->GetName() << " " << i;
+    }
+  }
+}
+
+// The fit with the gradient computed by parallel tasks must find the same minimum.
+TEST(RooAbsPdf, ParallelGradientFit)
+{
+  RooRealVar x("x", "x", 0., -10., 10.);
+  RooRealVar m("m", "m", 0.5, -5., 5.);
+  RooRealVar s("s", "s", 2., 0.1, 10.);
+  RooGenericPdf gauss("gauss", "exp(-0.5*(x-m)*(x-m)/(s*s))", RooArgSet(x, m, s));
+  std::unique_ptr<RooDataSet> data(gauss.generate(x, 5000));
+  std::unique_ptr<RooAbsReal> nll(gauss.createNLL(*data));
+
+  m.setVal(0.);
+  s.setVal(1.5);
+  RooMinimizer minimizer(*nll);
+  minimizer.setPrintLevel(-1);
+  minimizer.migrad();
+  const double mean = m.getVal();
+  const double sigma = s.getVal();
+  const double meanError = m.getError();
+
+  m.setVal(0.);
+  s.setVal(1.5);
+  RooMinimizer gradMinimizer(*nll);
+  gradMinimizer.setPrintLevel(-1);
+  gradMinimizer.setParallelGradient(2);
+  EXPECT_EQ(gradMinimizer.migrad(), 0);
+  EXPECT_NEAR(m.getVal(), mean, 0.01 * meanError);
+  EXPECT_NEAR(s.getVal(), sigma, 0.01 * s.getError());
+}
+
+#ifdef R__USE_IMT
+// The likelihood calculated in parallel threads must not depend on the number of
+// partitions beyond rounding, and must be reproducible.
+TEST(RooAbsPdf, MultiThreadedNLL)
+{
+  RooRealVar x("x", "x", 0., -10., 10.);
+  RooRealVar m("m", "m", 0.5, -5., 5.);
+  RooRealVar s("s", "s", 2., 0.1, 10.);
+  RooGenericPdf gauss("gauss", "exp(-0.5*(x-m)*(x-m)/(s*s))", RooArgSet(x, m, s));
+  std::unique_ptr<RooDataSet> data(gauss.generate(x, 10000));
+
+  std::unique_ptr<RooAbsReal> serialNll(gauss.createNLL(*data));
+
+  ROOT::EnableImplicitMT(2);
+  std::unique_ptr<RooAbsReal> threadedNll(gauss.createNLL(*data, RooFit::NumCPU(3)));
+
+  for (double mean : {0.5, 0.3, 1.2}) {
+    m.setVal(mean);
+    const double serial = serialNll->getVal();
+    const double threaded = threadedNll->getVal();
+    EXPECT_NEAR(threaded, serial, 1.E-10 * std::abs(serial)) << "mean " << mean;
+    m.setVal(mean);
+    EXPECT_EQ(threadedNll->getVal(), threaded) << "mean " << mean;
+
+    s.setVal(s.getVal() * 1.01);
+    EXPECT_NEAR(threadedNll->getVal(), serialNll->getVal(), 1.E-10 * std::abs(serialNll->getVal())) << "mean " << mean;
+  }
+
+  ROOT::DisableImplicitMT();
+}
+#endif
@@ -2,6 +2,7 @@
 // Author: Stephan Hageboeck, CERN 05/2020
 
 #include "RooRealVar.h"
+#include "RooFormulaVar.h"
 #include "RooDataSet.h"
 #include "RooHelpers.h"
 #include "RooGlobalFunc.h"
@@ -48,3 +49,59 @@ TEST(RooAbsReal, ReadFromTree)
   EXPECT_EQ(msgs.find(std::string(a.GetName()) + targetMsg), std::string::npos) << "Expect not to see INFO messages for conversion of double branch to double.";
 }
 
+
+// Values of a graph where nodes have several paths to the same parameter,
+// which setValueDirty() reaches through a cached list of clients.
+TEST(RooAbsReal, DirtyPropagationInSharedGraph)
+{
+  RooRealVar a("a", "a", 1.);
+  RooFormulaVar b("b", "a+1", RooArgList(a));
+  RooFormulaVar c("c", "2*a", RooArgList(a));
+  RooFormulaVar d("d", "b*c", RooArgList(b, c));
+  RooFormulaVar e("e", "d+b", RooArgList(d, b));
+
+  EXPECT_DOUBLE_EQ(e.getVal(), 6.);
+  a.setVal(2.);
+  EXPECT_DOUBLE_EQ(e.getVal(), 15.);
+
+  // A client added after the first propagation must become dirty as well
+  RooFormulaVar f("f", "e-a", RooArgList(e, a));
+  EXPECT_DOUBLE_EQ(f.getVal(), 13.);
+  a.setVal(3.);
+  EXPECT_DOUBLE_EQ(f.getVal(), 25.);
+  EXPECT_DOUBLE_EQ(d.getVal(), 24.);
+
+  // Constant nodes keep their value, the others are recomputed
+  c.setOperMode(RooAbsArg::AClean);
+  a.setVal(4.);
+  EXPECT_DOUBLE_EQ(c.getVal(), 6.);
+  c.setOperMode(RooAbsArg::Auto);
+  c.setValueDirty();
+  EXPECT_DOUBLE_EQ(f.getVal(), 41.);
+}
+
+TEST(RooAbsReal, CloneTreeOfLargeGraph)
+{
+  RooRealVar x("x", "x", 1.);
+  RooArgList chain(x);
+  std::vector<std::unique_ptr<RooFormulaVar>> nodes;
+  for (int i = 0; i < 200; ++i) {
+    auto prev = static_cast<RooAbsReal*>(chain.at(chain.getSize() - 1));
+    nodes.emplace_back(new RooFormulaVar(Form("n%d", i), "@0+@1", RooArgList(*prev, x)));
+    chain.add(*nodes.back());
+  }
+
+  std::unique_ptr<RooAbsReal> clone(static_cast<RooAbsReal*>(nodes.back()->cloneTree()));
+  EXPECT_DOUBLE_EQ(clone->getVal(), 201.);
+
+  // The clone owns copies of all the servers, and does not depend on the original ones
+  std::unique_ptr<RooArgSet> vars(clone->getVariables());
+  auto xClone = static_cast<RooRealVar*>(vars->find("x"));
+  ASSERT_NE(xClone, nullptr);
+  EXPECT_NE(xClone, &x);
+  x.setVal(2.);
+  EXPECT_DOUBLE_EQ(clone->getVal(), 201.);
+  xClone->setVal(3.);
+  EXPECT_DOUBLE_EQ(clone->getVal(), 603.);
+  EXPECT_DOUBLE_EQ(nodes.back()->getVal(), 402.);
+}
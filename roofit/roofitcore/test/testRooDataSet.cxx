@@ -4,6 +4,7 @@
 #include "RooDataSet.h"
 #include "RooDataHist.h"
 #include "RooRealVar.h"
+#include "RooVectorDataStore.h"
 #include "RooHelpers.h"
 
 #include <TFile.h>
@@ -181,3 +182,47 @@ TEST(RooDataSet, ReducingData) {
   }
 }
 
+
+
+/// The columns of a vector data set are loaded directly from the branches of the tree,
+/// converting their types and skipping the entries out of range.
+TEST(RooDataSet, ImportTreeIntoColumns) {
+  TTree tree("tree", "tree");
+  float fx;
+  int in;
+  double unused, w;
+  tree.Branch("x", &fx);
+  tree.Branch("n", &in);
+  tree.Branch("unused", &unused);
+  tree.Branch("w", &w);
+  for (int i = 0; i < 100; ++i) {
+    fx = 0.1f * i;
+    in = i % 7;
+    unused = -i;
+    w = 0.5 * i;
+    tree.Fill();
+  }
+
+  RooRealVar x("x", "x", 0., 4.95);
+  RooRealVar n("n", "n", 0., 10.);
+  RooRealVar wVar("w", "w", 0., 100.);
+  RooDataSet data("data", "data", RooArgSet(x, n, wVar), RooFit::Import(tree), RooFit::WeightVar(wVar), RooFit::Cut("n < 3"));
+
+  ASSERT_EQ(data.store()->IsA(), RooVectorDataStore::Class());
+
+  double sumW = 0.;
+  int nEntries = 0;
+  for (int i = 0; i < 100; ++i) {
+    if (0.1f * i <= 4.95 && i % 7 < 3) {
+      ASSERT_LT(nEntries, data.numEntries());
+      auto row = data.get(nEntries);
+      EXPECT_FLOAT_EQ(static_cast<RooRealVar*>(row->find(x))->getVal(), 0.1f * i);
+      EXPECT_EQ(static_cast<RooRealVar*>(row->find(n))->getVal(), i % 7);
+      EXPECT_DOUBLE_EQ(data.weight(), 0.5 * i);
+      sumW += 0.5 * i;
+      ++nEntries;
+    }
+  }
+  EXPECT_EQ(data.numEntries(), nEntries);
+  EXPECT_DOUBLE_EQ(data.sumEntries(), sumW);
+}
@@ -232,10 +232,16 @@ class ToyMCSampler: public TestStatSampler {
       // calling with argument or NULL deactivates proof
       void SetProofConfig(ProofConfig *pc = NULL) { fProofConfig = pc; }
 
+      // number of forked processes generating the toys (0 or 1 for a serial run)
+      void SetParallelWorkers(Int_t nWorkers) { fNWorkers = nWorkers; }
+      Int_t GetParallelWorkers() const { return fNWorkers; }
+
       void SetProtoData(const RooDataSet* d) { fProtoData = d; }
 
    protected:
 
+      RooDataSet* GetSamplingDistributionsMultiProcess(RooArgSet& paramPoint);
+
       const RooArgList* EvaluateAllTestStatistics(RooAbsData& data, const RooArgSet& poi, DetailedOutputAggregator& detOutAgg);
 
       // helper for GenerateToyData
@@ -277,6 +283,7 @@ class ToyMCSampler: public TestStatSampler {
       const RooDataSet *fProtoData; // in dev
 
       ProofConfig *fProofConfig;   //!
+      Int_t fNWorkers;             //! number of forked processes generating the toys
 
       mutable NuisanceParametersSampler *fNuisanceParametersSampler; //!
 
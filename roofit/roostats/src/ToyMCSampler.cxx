@@ -27,6 +27,12 @@ TestStatistic.
 For parallel runs, ToyMCSampler can be given an instance of ProofConfig
 and then run in parallel using proof or proof-lite. Internally, it uses
 ToyMCStudy with the RooStudyManager.
+
+Without PROOF, the toys can also be generated by several processes of the
+local machine with SetParallelWorkers(). Each process is forked once with a
+copy of the models and test statistics, generates its share of the toys with
+its own random seed and returns its results, which are merged into one data
+set. This is not available on Windows.
 */
 
 #include "RooStats/ToyMCSampler.h"
@@ -50,6 +56,10 @@ ToyMCStudy with the RooStudyManager.
 
 #include "TMath.h"
 
+#ifndef _MSC_VER
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
 
 using namespace RooFit;
 using namespace std;
@@ -175,6 +185,7 @@ ToyMCSampler::ToyMCSampler() : fSamplingDistName("SD"), fNToys(1)
    fProtoData = NULL;
 
    fProofConfig = NULL;
+   fNWorkers = 0;
    fNuisanceParametersSampler = NULL;
 
    _allVars = NULL ;
@@ -215,6 +226,7 @@ ToyMCSampler::ToyMCSampler(TestStatistic &ts, Int_t ntoys) : fSamplingDistName(t
    fProtoData = NULL;
 
    fProofConfig = NULL;
+   fNWorkers = 0;
    fNuisanceParametersSampler = NULL;
 
    _allVars = NULL ;
@@ -326,8 +338,11 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 {
 
    // ======= S I N G L E   R U N ? =======
-   if(!fProofConfig)
+   if(!fProofConfig) {
+      if (fNWorkers > 1)
+         return GetSamplingDistributionsMultiProcess(paramPointIn);
       return GetSamplingDistributionsSingleWorker(paramPointIn);
+   }
 
    // ======= P A R A L L E L   R U N =======
    if (!CheckConfig()){
@@ -369,6 +384,70 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
    return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the toys in fNWorkers forked processes. Each of them runs
+/// GetSamplingDistributionsSingleWorker() once for its share of the toys, with
+/// its own copy of the models and its own random seed, and the data sets they
+/// return are merged. The seeds are drawn from RooRandom::randomGenerator(),
+/// such that the toys only depend on its seed and on the number of workers.
+
+RooDataSet* ToyMCSampler::GetSamplingDistributionsMultiProcess(RooArgSet& paramPointIn)
+{
+#ifdef _MSC_VER
+   oocoutW((TObject*)NULL, InputArguments)
+      << "Parallel workers are not supported on Windows, generating the toys serially."
+      << endl;
+   return GetSamplingDistributionsSingleWorker(paramPointIn);
+#else
+   if (!CheckConfig()){
+      oocoutE((TObject*)NULL, InputArguments)
+         << "Bad COnfiguration in ToyMCSampler "
+         << endl;
+      return nullptr;
+   }
+
+   // turn adaptive sampling off if given
+   if(fToysInTails) {
+      fToysInTails = 0;
+      oocoutW((TObject*)NULL, InputArguments)
+         << "Adaptive sampling in ToyMCSampler is not supported for parallel runs."
+         << endl;
+   }
+
+   // split the toys as evenly as possible between the workers
+   const Int_t totToys = fNToys;
+   const Int_t nWorkers = std::min(fNWorkers, std::max(totToys, 1));
+   std::vector<Int_t> nToys(nWorkers, totToys / nWorkers);
+   for (Int_t i = 0; i < totToys % nWorkers; ++i)
+      ++nToys[i];
+   std::vector<UInt_t> seeds(nWorkers);
+   for (auto& seed : seeds)
+      seed = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+
+   // runs in a forked copy of this process, so nothing needs to be cloned
+   auto worker = [&](UInt_t i) {
+      RooRandom::randomGenerator()->SetSeed(seeds[i]);
+      fNToys = nToys[i];
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   };
+
+   ROOT::TProcessExecutor executor(nWorkers);
+   std::vector<RooDataSet*> results = executor.Map(worker, ROOT::TSeqU(nWorkers));
+
+   RooDataSet* output = nullptr;
+   for (RooDataSet* r : results) {
+      if (!r) continue;
+      if (!output) {
+         output = r;
+      } else {
+         output->append(*r);
+         delete r;
+      }
+   }
+   return output;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the main function for serial runs. It is called automatically
 /// from inside GetSamplingDistribution when no ProofConfig is given.
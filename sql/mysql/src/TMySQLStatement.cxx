@@ -584,6 +584,51 @@ const char *TMySQLStatement::GetString(Int_t npar)
    return ConvertToString(npar);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fetch the next rows column by column, see TSQLStatement::FetchColumns().
+/// The values are read directly from the buffers bound to the result set.
+
+Int_t TMySQLStatement::FetchColumns(std::vector<TColumnBuffer> &columns, Int_t maxrows)
+{
+   if (!PrepareColumns(columns, maxrows, "FetchColumns"))
+      return -1;
+
+   Int_t nrows = 0;
+   while (((maxrows <= 0) || (nrows < maxrows)) && NextResultRow()) {
+      for (auto &col : columns) {
+         Int_t npar = col.fField;
+         Bool_t isnull = fBuffer[npar].fResNull;
+         col.fNull.push_back(isnull);
+         switch (col.fType) {
+            case kColLong64:
+               if (isnull)
+                  col.fLong64.push_back(0);
+               else if ((fBuffer[npar].fSqlType==MYSQL_TYPE_LONGLONG) && fBuffer[npar].fSign)
+                  col.fLong64.push_back(*((Long64_t*) fBuffer[npar].fMem));
+               else
+                  col.fLong64.push_back((Long64_t) ConvertToNumeric(npar));
+               break;
+            case kColDouble:
+               if (isnull)
+                  col.fDouble.push_back(0.);
+               else if (fBuffer[npar].fSqlType==MYSQL_TYPE_DOUBLE)
+                  col.fDouble.push_back(*((double*) fBuffer[npar].fMem));
+               else
+                  col.fDouble.push_back((Double_t) ConvertToNumeric(npar));
+               break;
+            case kColString: {
+               const char *str = isnull ? nullptr : GetString(npar);
+               col.fString.emplace_back(str ? str : "");
+               break;
+            }
+         }
+      }
+      nrows++;
+   }
+
+   return IsError() ? -1 : nrows;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return field value as binary array.
 
@@ -1130,6 +1175,14 @@ Bool_t TMySQLStatement::NextResultRow()
    return kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fetch the next rows column by column.
+
+Int_t TMySQLStatement::FetchColumns(std::vector<TColumnBuffer> &, Int_t)
+{
+   return -1;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment iteration counter for statement, where parameter can be set.
@@ -458,6 +458,44 @@ const char *TPgSQLStatement::GetString(Int_t npar)
    return PQgetvalue(fStmt->fRes,fIterationCount,npar);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fetch the next rows column by column, see TSQLStatement::FetchColumns().
+/// The result set is completely in memory: each column is converted in one
+/// loop over the rows.
+
+Int_t TPgSQLStatement::FetchColumns(std::vector<TColumnBuffer> &columns, Int_t maxrows)
+{
+   if (!PrepareColumns(columns, maxrows, "FetchColumns"))
+      return -1;
+   if ((fStmt==0) || !IsResultSetMode())
+      return 0;
+
+   Int_t first = fIterationCount + 1;
+   Int_t last = fNumResultRows;
+   if ((maxrows > 0) && (last - first > maxrows))
+      last = first + maxrows;
+   if (first >= last) {
+      fIterationCount = fNumResultRows;
+      return 0;
+   }
+
+   for (auto &col : columns) {
+      for (Int_t row = first; row < last; row++) {
+         Bool_t isnull = PQgetisnull(fStmt->fRes, row, col.fField);
+         const char *value = PQgetvalue(fStmt->fRes, row, col.fField);
+         col.fNull.push_back(isnull);
+         switch (col.fType) {
+            case kColLong64: col.fLong64.push_back(isnull ? 0 : (Long64_t) strtoll(value, nullptr, 10)); break;
+            case kColDouble: col.fDouble.push_back(isnull ? 0. : strtod(value, nullptr)); break;
+            case kColString: col.fString.emplace_back(value, PQgetlength(fStmt->fRes, row, col.fField)); break;
+         }
+      }
+   }
+
+   fIterationCount = last - 1;
+   return last - first;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return field value as binary array.
 /// Note PQgetvalue mallocs/frees and ROOT classes expect new/delete.
@@ -987,6 +1025,14 @@ Bool_t TPgSQLStatement::NextResultRow()
    return kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fetch the next rows column by column.
+
+Int_t TPgSQLStatement::FetchColumns(std::vector<TColumnBuffer> &, Int_t)
+{
+   return -1;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment iteration counter for statement, where parameter can be set.
@@ -81,6 +81,7 @@ public:
    ULong64_t   GetULong64(Int_t npar) final;
    Double_t    GetDouble(Int_t npar) final;
    const char *GetString(Int_t npar) final;
+   Int_t       FetchColumns(std::vector<TColumnBuffer> &columns, Int_t maxrows = 0) final;
    Bool_t      GetBinary(Int_t npar, void* &mem, Long_t& size) final;
    Bool_t      GetDate(Int_t npar, Int_t& year, Int_t& month, Int_t& day) final;
    Bool_t      GetTime(Int_t npar, Int_t& hour, Int_t& min, Int_t& sec) final;
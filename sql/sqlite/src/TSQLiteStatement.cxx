@@ -365,6 +365,36 @@ const char *TSQLiteStatement::GetString(Int_t npar)
    return reinterpret_cast<const char *>(sqlite3_column_text(fStmt->fRes, npar));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fetch the next rows column by column, see TSQLStatement::FetchColumns().
+/// The values are read directly from the sqlite3 statement.
+
+Int_t TSQLiteStatement::FetchColumns(std::vector<TColumnBuffer> &columns, Int_t maxrows)
+{
+   if (!PrepareColumns(columns, maxrows, "FetchColumns"))
+      return -1;
+
+   Int_t nrows = 0;
+   while (((maxrows <= 0) || (nrows < maxrows)) && NextResultRow()) {
+      for (auto &col : columns) {
+         Bool_t isnull = sqlite3_column_type(fStmt->fRes, col.fField) == SQLITE_NULL;
+         col.fNull.push_back(isnull);
+         switch (col.fType) {
+            case kColLong64: col.fLong64.push_back(sqlite3_column_int64(fStmt->fRes, col.fField)); break;
+            case kColDouble: col.fDouble.push_back(sqlite3_column_double(fStmt->fRes, col.fField)); break;
+            case kColString: {
+               const char *str = reinterpret_cast<const char *>(sqlite3_column_text(fStmt->fRes, col.fField));
+               col.fString.emplace_back(str ? str : "", str ? sqlite3_column_bytes(fStmt->fRes, col.fField) : 0);
+               break;
+            }
+         }
+      }
+      nrows++;
+   }
+
+   return IsError() ? -1 : nrows;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return field value as binary array.
 /// Memory at 'mem' will be reallocated and size updated
@@ -2,6 +2,7 @@
 // Author: Nikolay Root   05/07/98
 
 #include <stdlib.h>
+#include <vector>
 
 #include "Riostream.h"
 #include "TCollection.h"
@@ -12,6 +13,7 @@
 #include "THashList.h"
 #include "THashTable.h"
 #include "TBtree.h"
+#include "TString.h"
 
 #include "TStopwatch.h"
 #include "TRandom.h"
@@ -20,13 +22,17 @@
 // for TObjArray,TOrdCollection,TList,TSortedList,THashList,TBtree,
 // TClonesArray and THashTable collections.
 //
-// Usage: tcollbm -h                               - to print a usage info
-//        tcollbm [-n|-i|-m] [nobjects] [ntimes]   - to run tests
+// Usage: tcollbm -h                                   - to print a usage info
+//        tcollbm [-n|-i|-m|-d|-s] [nobjects] [ntimes]   - to run tests
 //
 // switches:
 //       -n            - benchmark access by name  (default)
 //       -i            - benchmark access by index
 //       -m            - benchmark of objects allocation
+//       -d            - benchmark a directory-like workload: lookups by name
+//                       of keys having several cycles, the last one added first
+//       -s            - benchmark a streamer-info-like workload: lookups of
+//                       long class names, a tenth of them not in the collection
 //
 // parameters:
 //       nobjects      - number of objects to be inserted into collections
@@ -95,6 +101,8 @@ public:
   Double_t TestAllocation(); // Memory allocation test
   Double_t TestByName();     // benchmark by name
   Double_t TestByIndex();    // benchmark by index
+  Double_t TestDirectory();  // benchmark of directory-like lookups
+  Double_t TestClassNames(); // benchmark of streamer-info-like lookups
   Double_t DoTest();         // Tests multiplexsor
 
   void        CleanUp()    { fColl->Delete(); }
@@ -184,10 +192,56 @@ Double_t Tester::TestByName() {           // benchmark access by name
   return timer.CpuTime();
 };
 
+Double_t Tester::TestDirectory() {        // keys with 3 cycles each
+  TList *list = dynamic_cast<TList*>(fColl);
+  for (Int_t cycle=1;cycle<=3;cycle++) {
+    for (Int_t i=0;i<fNobj;i++) {
+      TNamed *key = new TNamed(names[i],GetName());
+      if (list) list->AddFirst(key);   // as TDirectoryFile::AppendKey
+      else      fColl->Add(key);
+    }
+  }
+  TStopwatch timer;
+  Int_t i;
+  timer.Start();
+  for (Int_t j=0;j<fNtimes;j++) {
+    i=Int_t(fNobj*gRandom->Rndm());
+    if(!(fColl->FindObject(names[i]))) Printf("Key %5s not found !!!",names[i]);
+  }
+  timer.Stop();
+  CleanUp();
+  return timer.CpuTime();
+}
+
+Double_t Tester::TestClassNames() {       // lookups of class names
+  std::vector<TString> classNames;
+  for (Int_t i=0;i<fNobj;i++)
+    classNames.push_back(TString::Format("ROOT::Experimental::Detail::RField<std::vector<Event%s>,void>",names[i]));
+  for (Int_t i=0;i<fNobj-fNobj/10;i++)
+    fColl->Add(new TNamed(classNames[i].Data(),GetName()));
+  TStopwatch timer;
+  Int_t i, nfound = 0;
+  timer.Start();
+  for (Int_t j=0;j<fNtimes;j++) {
+    i=Int_t(fNobj*gRandom->Rndm());
+    if(fColl->FindObject(classNames[i].Data())) nfound++;
+  }
+  timer.Stop();
+  if (nfound == 0) Printf("No class found !!!");
+  CleanUp();
+  return timer.CpuTime();
+}
+
 Double_t Tester::DoTest() {
   // Return the average time in msec.
   Double_t v;
-  if(fModa==2) {
+  if(fModa==4) {
+    printf("Class name lookups for %-20s", GetName());
+    v=TestClassNames();
+  } else if(fModa==3) {
+    printf("Directory key lookups for %-20s", GetName());
+    v=TestDirectory();
+  } else if(fModa==2) {
     printf("Memory allocation test for %-20s", GetName());
     v=TestAllocation();
   } else if(fModa==1) {
@@ -209,10 +263,12 @@ int main(int argc,char **argv)
 {
   // Initialize the ROOT framework
   if(argc == 2 && !strcmp(argv[1],"-h")) {
-    Printf("Usage: tcollbm [-n|-i] [nobjects] [ntimes]");
+    Printf("Usage: tcollbm [-n|-i|-m|-d|-s] [nobjects] [ntimes]");
     Printf("  -n        - benchmark access by name");
     Printf("  -i        - benchmark access by index");
     Printf("  -m        - benchmark memory allocation");
+    Printf("  -d        - benchmark directory-like lookups (keys with cycles)");
+    Printf("  -s        - benchmark streamer-info-like lookups (class names)");
     Printf("  nobjects  - number of objects to be inserted into collections");
     Printf("  ntimes    - number of random lookups in the collection");
     return 1;
@@ -220,12 +276,15 @@ int main(int argc,char **argv)
   if(argc > 1 && !strcmp(argv[1],"-n")) { moda = 0; argc--; argv++; };
   if(argc > 1 && !strcmp(argv[1],"-i")) { moda = 1; argc--; argv++; };
   if(argc > 1 && !strcmp(argv[1],"-m")) { moda = 2; argc--; argv++; };
+  if(argc > 1 && !strcmp(argv[1],"-d")) { moda = 3; argc--; argv++; };
+  if(argc > 1 && !strcmp(argv[1],"-s")) { moda = 4; argc--; argv++; };
   //
   // Set defaults values for selected test
   //
   if(moda == 0) { nobjects = 100;  ntimes = 10000; }
   if(moda == 1) { nobjects = 100;  ntimes = 1000000; }
   if(moda == 2) { nobjects = 1000; ntimes = 100; }
+  if(moda >= 3) { nobjects = 1000; ntimes = 100000; }
 
   Int_t no = nobjects;
   Int_t nt = ntimes;
@@ -261,11 +320,13 @@ int main(int argc,char **argv)
   deltas[j] = ((Tester*)(array[j]))->DoTest();
   if(deltas[j] < smin) { idx=j; smin=deltas[j]; }
 
-  array.Add(new Tester(nobjects,ntimes,moda,
-                       new TClonesArray("TNamed",nobjects)));  // Add TClonesArray
-  j++;
-  deltas[j] = ((Tester*)(array[j]))->DoTest();
-  if(deltas[j] < smin) { idx=j; smin=deltas[j]; }
+  if(moda < 3) {    // TClonesArray does not support Add
+    array.Add(new Tester(nobjects,ntimes,moda,
+                         new TClonesArray("TNamed",nobjects)));  // Add TClonesArray
+    j++;
+    deltas[j] = ((Tester*)(array[j]))->DoTest();
+    if(deltas[j] < smin) { idx=j; smin=deltas[j]; }
+  }
 
   array.Add(new Tester(nobjects,ntimes,moda,
                        new TBtree()));                       // Add TBTree
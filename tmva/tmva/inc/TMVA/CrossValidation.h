@@ -56,6 +56,7 @@ public:
    {}
 
    UInt_t fFold;
+   UInt_t fMethod = 0; ///< Index of the booked method, when the folds of several methods are processed together
 
    Float_t fROCIntegral;
    TGraph fROC;
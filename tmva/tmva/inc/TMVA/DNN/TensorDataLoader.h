@@ -30,6 +30,7 @@
 #include "TMatrix.h"
 #include "TMVA/Event.h"
 #include <algorithm>
+#include <future>
 
 namespace TMVA {
    class DataSetInfo;
@@ -124,6 +125,10 @@ public:
  * the complete training set. Using the begin() and end() member functions allows
  * the user to iterate over the batches in one epoch.
  *
+ * With more than one buffer pair, the host buffer of the next batch is filled
+ * on a background thread while the current batch is used, so that the copy of
+ * the events into the buffers overlaps with the training.
+ *
  * \tparam Data_t The input data type.
  * \tparam Architecture_t The achitecture class of the underlying architecture.
  */
@@ -154,15 +159,28 @@ private:
 
    std::vector<size_t> fSampleIndices; ///< Ordering of the samples in the epoch.
 
+   std::vector<Float_t> fSampleValues; ///< Input values of the samples, stored contiguously sample by sample on
+                                       ///< first use when they are read through TMVA events.
+
+   std::future<void> fPrefetch; ///< Filling of the host buffer of the next batch, when it is running.
+   size_t fPrefetchIndex;       ///< Index of the batch being filled by fPrefetch.
+
+   /** Copy the inputs, outputs and weights of a batch into the host buffer
+    *  of its stream. */
+   void CopyTensorBatch(size_t batchIndex);
+   /** Wait for the filling of the host buffer of the next batch, if any. */
+   void WaitPrefetch();
+
 public:
    /*! Constructor. */
    TTensorDataLoader(const Data_t &data, size_t nSamples, size_t batchSize, const Shape_t & inputLayout,
        const Shape_t & batchLayout, size_t nOutputFeatures, size_t nStreams = 1);
 
-   TTensorDataLoader(const TTensorDataLoader &) = default;
+   TTensorDataLoader(const TTensorDataLoader &) = delete;
    TTensorDataLoader(TTensorDataLoader &&) = default;
-   TTensorDataLoader &operator=(const TTensorDataLoader &) = default;
+   TTensorDataLoader &operator=(const TTensorDataLoader &) = delete;
    TTensorDataLoader &operator=(TTensorDataLoader &&) = default;
+   ~TTensorDataLoader() { WaitPrefetch(); }
 
    /** Copy input tensor into the given host buffer. Function to be specialized by
     *  the architecture-specific backend. */
@@ -209,7 +227,7 @@ TTensorDataLoader<Data_t, Architecture_t>::TTensorDataLoader(const Data_t &data,
                                                              size_t nOutputFeatures, size_t nStreams)
    : fData(data), fNSamples(nSamples), fBatchSize(batchSize), fInputLayout(inputLayout), fBatchDepth(batchLayout[0]), fBatchHeight(batchLayout[1]),
      fBatchWidth(batchLayout[2]), fNOutputFeatures(nOutputFeatures), fBatchIndex(0), fNStreams(nStreams), fDeviceBuffers(),
-     fHostBuffers(), fSampleIndices()
+     fHostBuffers(), fSampleIndices(), fPrefetchIndex(0)
 {
    size_t inputTensorSize = fBatchDepth * fBatchHeight * fBatchWidth;
    size_t outputMatrixSize = fBatchSize * fNOutputFeatures;
@@ -228,39 +246,72 @@ TTensorDataLoader<Data_t, Architecture_t>::TTensorDataLoader(const Data_t &data,
 
 //______________________________________________________________________________
 template <typename Data_t, typename Architecture_t>
-TTensorBatch<Architecture_t> TTensorDataLoader<Data_t, Architecture_t>::GetTensorBatch()
+void TTensorDataLoader<Data_t, Architecture_t>::CopyTensorBatch(size_t batchIndex)
 {
-   fBatchIndex %= (fNSamples / fBatchSize); // Cycle through samples.
-
    size_t inputTensorSize =  fBatchDepth * fBatchHeight * fBatchWidth;
    size_t outputMatrixSize = fBatchSize * fNOutputFeatures;
    size_t weightMatrixSize = fBatchSize;
 
-   size_t streamIndex = fBatchIndex % fNStreams;
-   HostBuffer_t &hostBuffer = fHostBuffers[streamIndex];
-   DeviceBuffer_t &deviceBuffer = fDeviceBuffers[streamIndex];
+   HostBuffer_t &hostBuffer = fHostBuffers[batchIndex % fNStreams];
 
    HostBuffer_t inputHostBuffer = hostBuffer.GetSubBuffer(0, inputTensorSize);
    HostBuffer_t outputHostBuffer = hostBuffer.GetSubBuffer(inputTensorSize, outputMatrixSize);
    HostBuffer_t weightHostBuffer = hostBuffer.GetSubBuffer(inputTensorSize + outputMatrixSize, weightMatrixSize);
 
-   DeviceBuffer_t inputDeviceBuffer = deviceBuffer.GetSubBuffer(0, inputTensorSize);
-   DeviceBuffer_t outputDeviceBuffer = deviceBuffer.GetSubBuffer(inputTensorSize, outputMatrixSize);
-   DeviceBuffer_t weightDeviceBuffer = deviceBuffer.GetSubBuffer(inputTensorSize + outputMatrixSize, weightMatrixSize);
-
    // here sample index has batch size as offset , while in
    // copy tensor input has batch depth.
    // We support then now two cases: batchdepth = 1  batchHeight = batch size
    //   or batch depth = batch
-   size_t sampleIndex = fBatchIndex * fBatchSize;
+   size_t sampleIndex = batchIndex * fBatchSize;
    IndexIterator_t sampleIndexIterator = fSampleIndices.begin() + sampleIndex;
 
    CopyTensorInput(inputHostBuffer, sampleIndexIterator);
    CopyTensorOutput(outputHostBuffer, sampleIndexIterator);
    CopyTensorWeights(weightHostBuffer, sampleIndexIterator);
+}
+
+//______________________________________________________________________________
+template <typename Data_t, typename Architecture_t>
+void TTensorDataLoader<Data_t, Architecture_t>::WaitPrefetch()
+{
+   if (fPrefetch.valid())
+      fPrefetch.get();
+}
+
+//______________________________________________________________________________
+template <typename Data_t, typename Architecture_t>
+TTensorBatch<Architecture_t> TTensorDataLoader<Data_t, Architecture_t>::GetTensorBatch()
+{
+   size_t nBatches = fNSamples / fBatchSize;
+   fBatchIndex %= nBatches; // Cycle through samples.
+
+   size_t inputTensorSize =  fBatchDepth * fBatchHeight * fBatchWidth;
+   size_t outputMatrixSize = fBatchSize * fNOutputFeatures;
+   size_t weightMatrixSize = fBatchSize;
+
+   size_t streamIndex = fBatchIndex % fNStreams;
+   HostBuffer_t &hostBuffer = fHostBuffers[streamIndex];
+   DeviceBuffer_t &deviceBuffer = fDeviceBuffers[streamIndex];
+
+   // use the host buffer filled in the background if it holds this batch
+   bool prefetched = fPrefetch.valid() && fPrefetchIndex == fBatchIndex;
+   WaitPrefetch();
+   if (!prefetched)
+      CopyTensorBatch(fBatchIndex);
 
    deviceBuffer.CopyFrom(hostBuffer);
 
+   // fill the host buffer of the next batch, which belongs to another
+   // stream, while this one is used
+   if (fNStreams > 1 && nBatches > 1) {
+      fPrefetchIndex = (fBatchIndex + 1) % nBatches;
+      fPrefetch = std::async(std::launch::async, &TTensorDataLoader::CopyTensorBatch, this, fPrefetchIndex);
+   }
+
+   DeviceBuffer_t inputDeviceBuffer = deviceBuffer.GetSubBuffer(0, inputTensorSize);
+   DeviceBuffer_t outputDeviceBuffer = deviceBuffer.GetSubBuffer(inputTensorSize, outputMatrixSize);
+   DeviceBuffer_t weightDeviceBuffer = deviceBuffer.GetSubBuffer(inputTensorSize + outputMatrixSize, weightMatrixSize);
+
    assert(fInputLayout.size() == 3);
    Tensor_t inputTensor = Architecture_t::CreateTensor( inputDeviceBuffer, fBatchSize, fInputLayout[0], fInputLayout[1], fInputLayout[2] );
    // in case of dense layers
@@ -282,6 +333,8 @@ template <typename Data_t, typename Architecture_t>
 template <typename RNG>
 void TTensorDataLoader<Data_t, Architecture_t>::Shuffle(RNG & rng)
 {
+   // the batch filled in the background used the previous order of the samples
+   WaitPrefetch();
    std::shuffle(fSampleIndices.begin(), fSampleIndices.end(), rng);
 }
 
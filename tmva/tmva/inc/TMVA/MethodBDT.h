@@ -108,6 +108,9 @@ namespace TMVA {
 
       // get the actual forest size (might be less than fNTrees, the requested one, if boosting is stopped early
       UInt_t   GetNTrees() const {return fForest.size();}
+
+      // write the forest in the format of the fast inference with TMVA::Experimental::RBDT
+      void SaveBranchlessForest( const TString& key, const TString& filename ) const;
    private:
 
       Double_t GetMvaValue( Double_t* err, Double_t* errUpper, UInt_t useNTrees );
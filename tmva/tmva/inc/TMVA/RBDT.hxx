@@ -21,6 +21,7 @@
 
 #include "TMVA/RTensor.hxx"
 #include "TMVA/TreeInference/Forest.hxx"
+#include "TMVA/Config.h"
 #include "TFile.h"
 
 #include <vector>
@@ -42,6 +43,23 @@ private:
    bool fNormalizeOutputs;
    std::vector<Backend_t> fBackends;
 
+   /// Compute the predictions of the events [begin, end) of the row-major inputs x
+   void ComputeRows(const Value_t *x, std::size_t numInputs, std::size_t begin, std::size_t end, RTensor<Value_t> &y)
+   {
+      const int rows = static_cast<int>(end - begin);
+      for (int i = 0; i < fNumOutputs; i++)
+         fBackends[i].Inference(x + begin * numInputs, rows, true, &y(begin, i));
+      if (fNormalizeOutputs) {
+         for (std::size_t i = begin; i < end; i++) {
+            Value_t s = 0.0;
+            for (int j = 0; j < fNumOutputs; j++)
+               s += y(i, j);
+            for (int j = 0; j < fNumOutputs; j++)
+               y(i, j) /= s;
+         }
+      }
+   }
+
 public:
    /// Construct backends from model in ROOT file
    RBDT(const std::string &key, const std::string &filename)
@@ -92,11 +110,29 @@ public:
    std::vector<Value_t> Compute(const std::vector<Value_t> &x) { return this->Compute<std::vector<Value_t>>(x); }
 
    /// Compute model prediction on input RTensor
+   ///
+   /// If TMVA runs multi-threaded (see TMVA::Config::EnableMT), the events of a
+   /// row-major input are split in batches computed in parallel.
    RTensor<Value_t> Compute(const RTensor<Value_t> &x)
    {
       const auto rows = x.GetShape()[0];
       RTensor<Value_t> y({rows, static_cast<std::size_t>(fNumOutputs)}, MemoryLayout::ColumnMajor);
       const bool layout = x.GetMemoryLayout() == MemoryLayout::ColumnMajor ? false : true;
+
+      // The batches of a row-major input are contiguous, and the predictions of a
+      // batch are contiguous in each column of the output
+      auto &executor = TMVA::Config::Instance().GetThreadExecutor();
+      const std::size_t batchSize = 16 * kInferenceBlockSize;
+      if (layout && executor.GetPoolSize() > 1 && rows >= 2 * batchSize) {
+         const auto numInputs = x.GetShape()[1];
+         const unsigned int numBatches = (rows + batchSize - 1) / batchSize;
+         auto computeBatch = [&](unsigned int i) {
+            ComputeRows(x.GetData(), numInputs, i * batchSize, std::min(rows, (i + 1) * batchSize), y);
+         };
+         executor.Foreach(computeBatch, ROOT::TSeqU(numBatches));
+         return y;
+      }
+
       for (int i = 0; i < fNumOutputs; i++)
          fBackends[i].Inference(x.GetData(), rows, layout, &y(0, i));
       if (fNormalizeOutputs) {
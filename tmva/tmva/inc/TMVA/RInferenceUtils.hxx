@@ -3,6 +3,7 @@
 
 #include "ROOT/RIntegerSequence.hxx" // std::index_sequence
 #include <utility> // std::forward
+#include <vector>
 
 namespace TMVA {
 namespace Experimental {
@@ -24,6 +25,24 @@ public:
    auto operator()(AlwaysT<N>... args) -> decltype(fFunc.Compute({args...})) { return fFunc.Compute({args...}); }
 };
 
+/// Compute helper with one model per processing slot
+template <typename I, typename T, typename M>
+class SlotComputeHelper;
+
+template <std::size_t... N, typename T, typename M>
+class SlotComputeHelper<std::index_sequence<N...>, T, M> {
+   template <std::size_t Idx>
+   using AlwaysT = T;
+   std::vector<M> *fModels;
+
+public:
+   SlotComputeHelper(std::vector<M> &models) : fModels(&models) {}
+   auto operator()(unsigned int slot, AlwaysT<N>... args) -> decltype((*fModels)[slot].Compute({args...}))
+   {
+      return (*fModels)[slot].Compute({args...});
+   }
+};
+
 } // namespace Internal
 
 /// Helper to pass TMVA model to RDataFrame.Define nodes
@@ -33,6 +52,23 @@ auto Compute(F &&f) -> Internal::ComputeHelper<std::make_index_sequence<N>, T, F
    return Internal::ComputeHelper<std::make_index_sequence<N>, T, F>(std::forward<F>(f));
 }
 
+/// Helper to pass one TMVA model per processing slot to RDataFrame.DefineSlot nodes
+///
+/// The slots evaluate their own copy of the model, such that the events processed
+/// by different threads do not share the input buffers of a single model:
+/// ~~~{.cpp}
+/// std::vector<RReader> models;
+/// for (unsigned int i = 0; i < df.GetNSlots(); i++)
+///    models.emplace_back("weights.xml");
+/// auto df2 = df.DefineSlot("y", ComputeSlots<4, float>(models), variables);
+/// ~~~
+/// The models must outlive the event loop.
+template <std::size_t N, typename T, typename M>
+Internal::SlotComputeHelper<std::make_index_sequence<N>, T, M> ComputeSlots(std::vector<M> &models)
+{
+   return Internal::SlotComputeHelper<std::make_index_sequence<N>, T, M>(models);
+}
+
 } // namespace Experimental
 } // namespace TMVA
 
@@ -148,14 +148,14 @@ public:
       if (x.size() != fVariables.size())
          throw std::runtime_error("Size of input vector is not equal to number of variables.");
 
+      // Take lock to protect model evaluation, including the memory used by the TMVA reader
+      R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
       // Copy over inputs to memory used by TMVA reader
       for (std::size_t i = 0; i < x.size(); i++) {
          fValues[i] = x[i];
       }
 
-      // Take lock to protect model evaluation
-      R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
-
       // Evaluate TMVA model
       // Classification
       if (fAnalysisType == Internal::AnalysisType::Classification) {
@@ -197,12 +197,12 @@ public:
       if (fAnalysisType == Internal::AnalysisType::Multiclass)
          y = y.Reshape({numEntries, numClasses});
 
-      // Fill output tensor
+      // Fill output tensor, taking the lock once for all the entries
+      R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
       for (std::size_t i = 0; i < numEntries; i++) {
          for (std::size_t j = 0; j < numVars; j++) {
             fValues[j] = x(i, j);
          }
-         R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
          // Classification
          if (fAnalysisType == Internal::AnalysisType::Classification) {
             y(i) = fReader->EvaluateMVA(name);
@@ -48,6 +48,7 @@
 #include "TMVA/DataSetInfo.h"
 #include "TMVA/DataInputHandler.h"
 #include "TMVA/DataSetManager.h"
+#include "TMVA/Event.h"
 
 #include <vector>
 #include <map>
@@ -91,6 +92,9 @@ namespace TMVA {
       Double_t EvaluateMVA( const std::vector<Double_t>&, const TString& methodTag, Double_t aux = 0 );
       Double_t EvaluateMVA( MethodBase* method,           Double_t aux = 0 );
       Double_t EvaluateMVA( const TString& methodTag,     Double_t aux = 0 );
+      // returns the MVA responses of nEvents events, whose input variables are stored event after event
+      void     EvaluateMVA( const Float_t* inputs, UInt_t nEvents, const TString& methodTag, Double_t* mvaValues,
+                            Double_t aux = 0 );
 
       // returns error on MVA response for given event
       // NOTE: must be called AFTER "EvaluateMVA(...)" call !
@@ -160,6 +164,10 @@ namespace TMVA {
       std::map<TString, IMethod*> fMethodMap; // map of methods
 
       std::vector<Float_t> fTmpEvalVec; // temporary evaluation vector (if user input is v<double>)
+      Event fTmpEvalEvent;              //! event reused for the evaluation of input vectors and arrays
+
+      // evaluate the method on the input variables values[0..nValues-1]
+      Double_t EvaluateValues( MethodBase* method, const Float_t* values, UInt_t nValues );
 
       mutable MsgLogger* fLogger;   // message logger
       MsgLogger& Log() const { return *fLogger; }
@@ -22,6 +22,7 @@
 
 #include <vector>
 #include <algorithm>
+#include <cstdint>
 #include <string>
 #include <sstream>
 
@@ -65,6 +66,7 @@ struct BranchlessTree {
    std::vector<int> fInputs;   ///< Cut variables / inputs
 
    inline T Inference(const T *input, const int stride);
+   inline void Inference(const T *inputs, const int rows, const int strideTree, const int strideBatch, T *predictions);
    inline void FillSparse();
    inline std::string GetInferenceCode(const std::string& funcName, const std::string& typeName);
 };
@@ -83,6 +85,94 @@ inline T BranchlessTree<T>::Inference(const T *input, const int stride)
    return fThresholds[index];
 }
 
+/// Number of events traversed together by the batch inference of a branchless tree
+constexpr int kInferenceBlockSize = 64;
+
+/// Perform inference on a batch of input vectors and add the tree scores to the predictions
+///
+/// The events are processed in blocks, which traverse the tree one level at a time: the
+/// loop over the events of a block only gathers the input values at the current node of
+/// each event, such that it can be vectorized, and the tree stays in the cache for the
+/// whole block.
+/// \param[in] inputs Pointer to data containing the input values
+/// \param[in] rows Number of events in inputs
+/// \param[in] strideTree Stride to go from one input variable to the next one
+/// \param[in] strideBatch Stride to go from one event to the next one
+/// \param[in,out] predictions Pointer to the buffer the tree scores are added to
+template <typename T>
+inline void BranchlessTree<T>::Inference(const T *inputs, const int rows, const int strideTree,
+                                         const int strideBatch, T *predictions)
+{
+   const int *cutInputs = fInputs.data();
+   const T *thresholds = fThresholds.data();
+   int indices[kInferenceBlockSize];
+   for (int start = 0; start < rows; start += kInferenceBlockSize) {
+      const int n = std::min(kInferenceBlockSize, rows - start);
+      const T *block = inputs + start * strideBatch;
+      for (int k = 0; k < n; ++k)
+         indices[k] = 0;
+      for (int level = 0; level < fTreeDepth; ++level) {
+         for (int k = 0; k < n; ++k) {
+            const int index = indices[k];
+            indices[k] = 2 * index + 1 + (block[k * strideBatch + cutInputs[index] * strideTree] > thresholds[index]);
+         }
+      }
+      for (int k = 0; k < n; ++k)
+         predictions[start + k] += thresholds[indices[k]];
+   }
+}
+
+/// \class QuantizedBranchlessTree
+/// \brief Branchless tree cutting on 16-bit indices of the thresholds instead of their values
+///
+/// The cut thresholds of each input variable are numbered in increasing order, and the input
+/// values are replaced by the number of thresholds of their variable smaller than them: the
+/// input value is larger than a threshold if and only if its index is larger than the index
+/// of the threshold, so that the tree gives the same scores as the BranchlessTree it is built
+/// from, with nodes of half the size. The leaves keep the scores of the full precision type.
+///
+/// \tparam T Value type of the scores (usually floating point type)
+template <typename T>
+struct QuantizedBranchlessTree {
+   int fTreeDepth;                         ///< Depth of the tree
+   std::vector<std::uint16_t> fThresholds; ///< Indices of the cut thresholds among those of their variable
+   std::vector<std::uint16_t> fInputs;     ///< Cut variables / inputs
+   std::vector<T> fLeaves;                 ///< Scores of the leaves
+
+   inline void Inference(const std::uint16_t *inputs, const int rows, const int strideTree, const int strideBatch,
+                         T *predictions);
+};
+
+/// Perform inference on a batch of quantized input vectors and add the tree scores to the predictions
+/// \param[in] inputs Pointer to data containing the indices of the input values
+/// \param[in] rows Number of events in inputs
+/// \param[in] strideTree Stride to go from one input variable to the next one
+/// \param[in] strideBatch Stride to go from one event to the next one
+/// \param[in,out] predictions Pointer to the buffer the tree scores are added to
+template <typename T>
+inline void QuantizedBranchlessTree<T>::Inference(const std::uint16_t *inputs, const int rows, const int strideTree,
+                                                  const int strideBatch, T *predictions)
+{
+   const std::uint16_t *cutInputs = fInputs.data();
+   const std::uint16_t *thresholds = fThresholds.data();
+   const int firstLeaf = static_cast<int>(fThresholds.size());
+   int indices[kInferenceBlockSize];
+   for (int start = 0; start < rows; start += kInferenceBlockSize) {
+      const int n = std::min(kInferenceBlockSize, rows - start);
+      const std::uint16_t *block = inputs + start * strideBatch;
+      for (int k = 0; k < n; ++k)
+         indices[k] = 0;
+      for (int level = 0; level < fTreeDepth; ++level) {
+         for (int k = 0; k < n; ++k) {
+            const int index = indices[k];
+            indices[k] = 2 * index + 1 + (block[k * strideBatch + cutInputs[index] * strideTree] > thresholds[index]);
+         }
+      }
+      for (int k = 0; k < n; ++k)
+         predictions[start + k] += fLeaves[indices[k] - firstLeaf];
+   }
+}
+
 /// Fill nodes of a sparse tree forming a full tree
 ///
 /// Sparse parts of the tree are marked with -1 values in the feature vector. The
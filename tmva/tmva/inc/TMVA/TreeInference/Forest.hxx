@@ -25,6 +25,8 @@
 #include <vector>
 #include <stdexcept>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <algorithm>
 
 #include "TFile.h"
@@ -84,11 +86,11 @@ inline void ForestBase<T, ForestType>::Inference(const T *inputs, const int rows
 {
    const auto strideTree = layout ? 1 : rows;
    const auto strideBatch = layout ? fNumInputs : 1;
+   std::fill(predictions, predictions + rows, T(0.0));
+   for (auto &tree : fTrees) {
+      tree.Inference(inputs, rows, strideTree, strideBatch, predictions);
+   }
    for (int i = 0; i < rows; i++) {
-      predictions[i] = 0.0;
-      for (auto &tree : fTrees) {
-         predictions[i] += tree.Inference(inputs + i * strideBatch, strideTree);
-      }
       predictions[i] = fObjectiveFunc(predictions[i]);
    }
 }
@@ -180,6 +182,91 @@ BranchlessForest<T>::Load(const std::string &key, const std::string &filename, c
    file->Close();
 }
 
+/// Forest using branchless trees cutting on 16-bit indices of the thresholds
+///
+/// The forest is built from a loaded BranchlessForest and gives the same predictions. The
+/// inputs are converted to the indices of the thresholds of their variable by a binary
+/// search for each value, once for all the trees.
+///
+/// \tparam T Value type for the computation (usually floating point type)
+template <typename T>
+struct QuantizedBranchlessForest : public ForestBase<T, std::vector<QuantizedBranchlessTree<T>>> {
+   std::vector<std::vector<T>> fCuts; ///< Sorted cut thresholds of each input variable
+
+   void Quantize(const BranchlessForest<T> &forest);
+   void Inference(const T *inputs, const int rows, bool layout, T *predictions);
+};
+
+/// Build the quantized trees from the trees of a branchless forest
+///
+/// \param[in] forest Loaded branchless forest
+template <typename T>
+inline void QuantizedBranchlessForest<T>::Quantize(const BranchlessForest<T> &forest)
+{
+   this->fNumInputs = forest.fNumInputs;
+   this->fObjectiveFunc = forest.fObjectiveFunc;
+
+   // Collect the thresholds of each input variable
+   fCuts.assign(this->fNumInputs, {});
+   for (auto &tree : forest.fTrees) {
+      for (std::size_t j = 0; j < tree.fInputs.size(); j++)
+         fCuts.at(tree.fInputs[j]).push_back(tree.fThresholds[j]);
+   }
+   for (auto &cuts : fCuts) {
+      std::sort(cuts.begin(), cuts.end());
+      cuts.erase(std::unique(cuts.begin(), cuts.end()), cuts.end());
+      if (cuts.size() > std::numeric_limits<std::uint16_t>::max())
+         throw std::runtime_error("Too many different thresholds of an input variable to quantize the forest.");
+   }
+
+   // Replace the thresholds by their indices
+   this->fTrees.resize(forest.fTrees.size());
+   for (std::size_t i = 0; i < forest.fTrees.size(); i++) {
+      auto &tree = forest.fTrees[i];
+      auto &quantized = this->fTrees[i];
+      const auto numNodes = tree.fInputs.size();
+      quantized.fTreeDepth = tree.fTreeDepth;
+      quantized.fInputs.assign(tree.fInputs.begin(), tree.fInputs.end());
+      quantized.fThresholds.resize(numNodes);
+      for (std::size_t j = 0; j < numNodes; j++) {
+         const auto &cuts = fCuts[tree.fInputs[j]];
+         quantized.fThresholds[j] = std::lower_bound(cuts.begin(), cuts.end(), tree.fThresholds[j]) - cuts.begin();
+      }
+      quantized.fLeaves.assign(tree.fThresholds.begin() + numNodes, tree.fThresholds.end());
+   }
+}
+
+/// Perform inference of the quantized forest on a batch of inputs
+///
+/// \param[in] inputs Pointer to data containing the inputs
+/// \param[in] rows Number of events in inputs vector
+/// \param[in] layout Row major (true) or column major (false) memory layout
+/// \param[in] predictions Pointer to the buffer to be filled with the predictions
+template <typename T>
+inline void QuantizedBranchlessForest<T>::Inference(const T *inputs, const int rows, bool layout, T *predictions)
+{
+   const auto strideTree = layout ? 1 : rows;
+   const auto strideBatch = layout ? this->fNumInputs : 1;
+
+   // Number of thresholds smaller than each input value, for the variable of the value
+   std::vector<std::uint16_t> indices(static_cast<std::size_t>(rows) * this->fNumInputs);
+   for (int j = 0; j < this->fNumInputs; j++) {
+      const auto &cuts = fCuts[j];
+      for (int i = 0; i < rows; i++) {
+         const auto k = i * strideBatch + j * strideTree;
+         indices[k] = std::lower_bound(cuts.begin(), cuts.end(), inputs[k]) - cuts.begin();
+      }
+   }
+
+   std::fill(predictions, predictions + rows, T(0.0));
+   for (auto &tree : this->fTrees) {
+      tree.Inference(indices.data(), rows, strideTree, strideBatch, predictions);
+   }
+   for (int i = 0; i < rows; i++) {
+      predictions[i] = this->fObjectiveFunc(predictions[i]);
+   }
+}
+
 /// Forest using branchless jitted trees
 ///
 /// \tparam T Value type for the computation (usually floating point type)
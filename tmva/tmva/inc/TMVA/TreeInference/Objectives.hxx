@@ -43,6 +43,16 @@ inline T Identity(T value)
    return value;
 }
 
+/// Hyperbolic tangent f(x) = tanh(x)
+///
+/// This objective gives the response 2 / (1 + exp(-2x)) - 1 of the
+/// gradient boosted classifiers of TMVA.
+template <typename T>
+inline T Tanh(T value)
+{
+   return std::tanh(value);
+}
+
 /// Natural exponential function f(x) = exp(x)
 ///
 /// This objective is used for the softmax objective in the multiclass
@@ -63,6 +73,8 @@ std::function<T(T)> GetFunction(const std::string &name)
       return std::function<T(T)>(Logistic<T>);
    else if (name.compare("softmax") == 0)
       return std::function<T(T)>(Exponential<T>);
+   else if (name.compare("tanh") == 0)
+      return std::function<T(T)>(Tanh<T>);
    else
       throw std::runtime_error("Objective function with name \"" + name + "\" is not implemented.");
 }
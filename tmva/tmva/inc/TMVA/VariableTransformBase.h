@@ -138,6 +138,11 @@ namespace TMVA {
       mutable Event*           fTransformedEvent;     // holds the current transformed event
       mutable Event*           fBackTransformedEvent; // holds the current back-transformed event
 
+      // buffers of Transform, reused from one event to the next
+      mutable std::vector<Float_t> fTransformInput;  //! values selected from the event
+      mutable std::vector<Float_t> fTransformOutput; //! transformed values
+      mutable std::vector<Char_t>  fTransformMask;   //! masked entries of the values
+
       // variable selection
       VectorOfCharAndInt               fGet;           // get variables/targets/spectators
       VectorOfCharAndInt               fPut;           // put variables/targets/spectators
@@ -593,54 +593,76 @@ void TMVA::CrossValidation::Evaluate()
       fFoldStatus = kTRUE;
    }
 
-   fResults.reserve(fMethods.size());
    for (auto & methodInfo : fMethods) {
-      CrossValidationResult result{fNumFolds};
-
-      TString methodTypeName = methodInfo.GetValue<TString>("MethodName");
-      TString methodTitle = methodInfo.GetValue<TString>("MethodTitle");
-
-      if (methodTypeName == "") {
+      if (methodInfo.GetValue<TString>("MethodName") == "") {
          Log() << kFATAL << "No method booked for cross-validation" << Endl;
       }
+   }
+
+   std::vector<CrossValidationResult> results;
+   results.reserve(fMethods.size());
+   for (UInt_t iMethod = 0; iMethod < fMethods.size(); ++iMethod) {
+      results.emplace_back(fNumFolds);
+   }
+
+   // Process K folds
+   auto nWorkers = fNumWorkerProcs;
+   if (nWorkers == 1) {
+      // Fall back to global config
+      nWorkers = TMVA::gConfig().GetNumWorkers();
+   }
+   if (nWorkers == 1) {
+      for (UInt_t iMethod = 0; iMethod < fMethods.size(); ++iMethod) {
+         TMVA::MsgLogger::EnableOutput();
+         Log() << kINFO << Endl;
+         Log() << kINFO << Endl;
+         Log() << kINFO << "========================================" << Endl;
+         Log() << kINFO << "Processing folds for method " << fMethods[iMethod].GetValue<TString>("MethodTitle") << Endl;
+         Log() << kINFO << "========================================" << Endl;
+         Log() << kINFO << Endl;
 
+         for (UInt_t iFold = 0; iFold < fNumFolds; ++iFold) {
+            auto fold_result = ProcessFold(iFold, fMethods[iMethod]);
+            results[iMethod].Fill(fold_result);
+         }
+      }
+   } else {
+#ifndef _MSC_VER
       TMVA::MsgLogger::EnableOutput();
       Log() << kINFO << Endl;
       Log() << kINFO << Endl;
       Log() << kINFO << "========================================" << Endl;
-      Log() << kINFO << "Processing folds for method " << methodTitle << Endl;
+      Log() << kINFO << "Processing folds for all methods with " << nWorkers << " workers" << Endl;
       Log() << kINFO << "========================================" << Endl;
       Log() << kINFO << Endl;
 
-      // Process K folds
-      auto nWorkers = fNumWorkerProcs;
-      if (nWorkers == 1) {
-         // Fall back to global config
-         nWorkers = TMVA::gConfig().GetNumWorkers();
-      }
-      if (nWorkers == 1) {
-         for (UInt_t iFold = 0; iFold < fNumFolds; ++iFold) {
-            auto fold_result = ProcessFold(iFold, methodInfo);
-            result.Fill(fold_result);
-         }
-      } else {
-#ifndef _MSC_VER
-         ROOT::TProcessExecutor workers(nWorkers);
-         std::vector<CrossValidationFoldResult> result_vector;
+      // The folds of all the methods are distributed over the same workers, so
+      // that the methods are trained concurrently as well as their folds.
+      ROOT::TProcessExecutor workers(nWorkers);
+      std::vector<CrossValidationFoldResult> result_vector;
 
-         auto workItem = [this, methodInfo](UInt_t iFold) {
-            return ProcessFold(iFold, methodInfo);
-         };
+      auto workItem = [this](UInt_t iJob) {
+         const UInt_t iMethod = iJob / fNumFolds;
+         auto fold_result = ProcessFold(iJob % fNumFolds, fMethods[iMethod]);
+         fold_result.fMethod = iMethod;
+         return fold_result;
+      };
 
-         result_vector = workers.Map(workItem, ROOT::TSeqI(fNumFolds));
+      result_vector = workers.Map(workItem, ROOT::TSeqI(fMethods.size() * fNumFolds));
 
-         for (auto && fold_result : result_vector) {
-            result.Fill(fold_result);
-         }
-#endif
+      for (auto && fold_result : result_vector) {
+         results[fold_result.fMethod].Fill(fold_result);
       }
+#endif
+   }
+
+   fResults.reserve(fMethods.size());
+   for (UInt_t iMethod = 0; iMethod < fMethods.size(); ++iMethod) {
+      auto & methodInfo = fMethods[iMethod];
+      TString methodTypeName = methodInfo.GetValue<TString>("MethodName");
+      TString methodTitle = methodInfo.GetValue<TString>("MethodTitle");
 
-      fResults.push_back(result);
+      fResults.push_back(results[iMethod]);
 
       // Serialise the cross evaluated method
       TString options =
@@ -27,6 +27,49 @@ namespace TMVA
 namespace DNN
 {
 
+namespace {
+// Derivatives of the activation functions, shared by the evaluation of the
+// derivatives and by the backward propagation, which multiplies them with the
+// activation gradients in the same pass.
+template <typename AFloat>
+struct ReluDerivativeOp {
+   AFloat operator()(AFloat x) const { return (x < 0.0) ? 0.0 : 1.0; }
+};
+template <typename AFloat>
+struct SigmoidDerivativeOp {
+   AFloat operator()(AFloat x) const
+   {
+      AFloat sig = 1.0 / (1.0 + exp(-x));
+      return sig * (1.0 - sig);
+   }
+};
+template <typename AFloat>
+struct TanhDerivativeOp {
+   AFloat operator()(AFloat x) const
+   {
+      AFloat t = tanh(x);
+      return 1 - t * t;
+   }
+};
+template <typename AFloat>
+struct SymmetricReluDerivativeOp {
+   AFloat operator()(AFloat x) const { return (x < 0.0) ? -1.0 : 1.0; }
+};
+template <typename AFloat>
+struct SoftSignDerivativeOp {
+   AFloat operator()(AFloat x) const
+   {
+      x = 1.0 + fabs(x);
+      x = 1.0 / (x * x);
+      return x;
+   }
+};
+template <typename AFloat>
+struct GaussDerivativeOp {
+   AFloat operator()(AFloat x) const { return - 2.0 * x * exp(- x * x); }
+};
+} // namespace
+
 //______________________________________________________________________________
 template<typename AFloat>
 void TCpu<AFloat>::ActivationFunctionForward(Tensor_t & X, EActivationFunction activFunct,
@@ -46,10 +89,40 @@ void TCpu<AFloat>::ActivationFunctionBackward(Tensor_t & dX, const Tensor_t & /*
 {
    // scaling and translation not yet implemented
    // output tensor (Y) could also be used to speed up derivative calculation
-   // compute dx = f'(x)
-   TMVA::DNN::evaluateDerivative<TCpu<AFloat>>(dX, activFunct, X);
-    // Compute element-wise product.  dx = f'(x) * dY
-   Hadamard(dX, dY);
+   // compute dx = f'(x) * dY, in one pass over the elements when possible
+   switch (activFunct) {
+   case EActivationFunction::kIdentity: Copy(dX, dY);
+      break;
+   case EActivationFunction::kRelu: {
+      ReluDerivativeOp<AFloat> f;
+      dX.MapFromHadamard(f, X, dY);
+   } break;
+   case EActivationFunction::kSigmoid: {
+      SigmoidDerivativeOp<AFloat> f;
+      dX.MapFromHadamard(f, X, dY);
+   } break;
+   case EActivationFunction::kTanh: {
+      TanhDerivativeOp<AFloat> f;
+      dX.MapFromHadamard(f, X, dY);
+   } break;
+   case EActivationFunction::kSymmRelu: {
+      SymmetricReluDerivativeOp<AFloat> f;
+      dX.MapFromHadamard(f, X, dY);
+   } break;
+   case EActivationFunction::kSoftSign: {
+      SoftSignDerivativeOp<AFloat> f;
+      dX.MapFromHadamard(f, X, dY);
+   } break;
+   case EActivationFunction::kGauss: {
+      GaussDerivativeOp<AFloat> f;
+      dX.MapFromHadamard(f, X, dY);
+   } break;
+   default:
+      // compute dx = f'(x)
+      TMVA::DNN::evaluateDerivative<TCpu<AFloat>>(dX, activFunct, X);
+      // Compute element-wise product.  dx = f'(x) * dY
+      Hadamard(dX, dY);
+   }
 }
 //______________________________________________________________________________
 template<typename AFloat>
@@ -73,7 +146,7 @@ template<typename AFloat>
 void TCpu<AFloat>::ReluDerivative(TCpuTensor<AFloat> & B,
                                                const TCpuTensor<AFloat> &A)
 {
-   auto f = [](AFloat x) {return (x < 0.0) ? 0.0 : 1.0;};
+   ReluDerivativeOp<AFloat> f;
    B.MapFrom(f, A);
 }
 
@@ -90,10 +163,7 @@ template<typename AFloat>
 void TCpu<AFloat>::SigmoidDerivative(TCpuTensor<AFloat> & B,
                                      const TCpuTensor<AFloat> &A)
 {
-   auto f = [](AFloat x) {
-      AFloat sig = 1.0 / (1.0 + exp(-x));
-      return sig * (1.0 - sig);
-   };
+   SigmoidDerivativeOp<AFloat> f;
    B.MapFrom(f, A);
 }
 
@@ -110,10 +180,7 @@ template<typename AFloat>
 void TCpu<AFloat>::TanhDerivative(TCpuTensor<AFloat> & B,
                                   const TCpuTensor<AFloat> &A)
 {
-   auto f = [](AFloat x) {
-      AFloat t = tanh(x);
-      return 1 - t * t;
-   };
+   TanhDerivativeOp<AFloat> f;
    B.MapFrom(f, A);
 }
 
@@ -181,9 +248,7 @@ template<typename AFloat>
 void TCpu<AFloat>::SymmetricReluDerivative(TCpuTensor<AFloat> & B,
                                            const TCpuTensor<AFloat> &A)
 {
-   auto f = [](AFloat x) {
-      return (x < 0.0) ? -1.0 : 1.0;
-   };
+   SymmetricReluDerivativeOp<AFloat> f;
    B.MapFrom(f, A);
 }
 
@@ -200,11 +265,7 @@ template<typename AFloat>
 void TCpu<AFloat>::SoftSignDerivative(TCpuTensor<AFloat> & B,
                                       const TCpuTensor<AFloat> &A)
 {
-   auto f = [](AFloat x) {
-      x = 1.0 + fabs(x);
-      x = 1.0 / (x * x);
-      return x;
-   };
+   SoftSignDerivativeOp<AFloat> f;
    B.MapFrom(f, A);
 }
 
@@ -221,7 +282,7 @@ template<typename AFloat>
 void TCpu<AFloat>::GaussDerivative(TCpuTensor<AFloat> & B,
                                    const TCpuTensor<AFloat> &A)
 {
-   auto f = [](AFloat x) {return - 2.0 * x * exp(- x * x);};
+   GaussDerivativeOp<AFloat> f;
    B.MapFrom(f, A);
 }
 
@@ -466,6 +466,22 @@ TTensorBatch<TCpu<Double_t> > TTensorDataLoader<TensorInput, TCpu<Double_t> >::G
 }
 #endif
 
+namespace {
+/// Copy the nValues input values of all the events once into one contiguous array, event
+/// by event, such that the batches of all the epochs are filled from this array instead of
+/// reading the values of each event through its Event object.
+void FillSampleValues(std::vector<Float_t> &values, const std::vector<Event *> &events, size_t nValues)
+{
+   if (!values.empty() || events.empty()) return;
+   values.resize(events.size() * nValues);
+   for (size_t i = 0; i < events.size(); i++) {
+      const Event *event = events[i];
+      for (size_t j = 0; j < nValues; j++) {
+         values[i * nValues + j] = event->GetValue(j);
+      }
+   }
+}
+} // namespace
 
 ///- re-implement specialization for Double_t
 //______________________________________________________________________________
@@ -475,26 +491,29 @@ void TTensorDataLoader<TMVAInput_t, TCpu<Double_t>>::CopyTensorInput(TCpuBuffer<
 {
    // one event, one  example in the batch
 
+   const std::vector<Event *> &events = std::get<0>(fData);
    if (fBatchDepth == 1 && fBatchHeight == fBatchSize) {
+      FillSampleValues(fSampleValues, events, fBatchWidth);
+      const Float_t *values = fSampleValues.data();
       for (size_t i = 0; i < fBatchHeight; i++) {
-         size_t sampleIndex = *sampleIterator;
-         Event * event = std::get<0>(fData)[sampleIndex];
+         const Float_t *sample = values + *sampleIterator * fBatchWidth;
          for (size_t j = 0; j < fBatchWidth; j++) {
             size_t bufferIndex = j * fBatchHeight + i;
-            buffer[bufferIndex] = event->GetValue(j);
+            buffer[bufferIndex] = sample[j];
          }
          sampleIterator++;
       }
    } else if (fBatchDepth == fBatchSize) {
       // batchDepth is batch size
+      const size_t nValues = fBatchHeight * fBatchWidth;
+      FillSampleValues(fSampleValues, events, nValues);
       for (size_t i = 0; i < fBatchDepth; i++) {
-         size_t sampleIndex = *sampleIterator;
-         Event * event = std::get<0>(fData)[sampleIndex];
+         const Float_t *sample = fSampleValues.data() + *sampleIterator * nValues;
          for (size_t j = 0; j < fBatchHeight; j++) {
             for (size_t k = 0; k < fBatchWidth; k++) {
                // because of the ordering of tensor in memory is NHWC
                size_t bufferIndex = i * fBatchHeight * fBatchWidth + k * fBatchHeight + j;
-               buffer[bufferIndex] = event->GetValue(j * fBatchWidth + k);
+               buffer[bufferIndex] = sample[j * fBatchWidth + k];
             }
          }
          sampleIterator++;
@@ -585,26 +604,29 @@ void TTensorDataLoader<TMVAInput_t, TCpu<Float_t>>::CopyTensorInput(TCpuBuffer<F
 {
    // one event, one  example in the batch
 
+   const std::vector<Event *> &events = std::get<0>(fData);
    if (fBatchDepth == 1 && fBatchHeight == fBatchSize) {
+      FillSampleValues(fSampleValues, events, fBatchWidth);
+      const Float_t *values = fSampleValues.data();
       for (size_t i = 0; i < fBatchHeight; i++) {
-         size_t sampleIndex = *sampleIterator;
-         Event * event = std::get<0>(fData)[sampleIndex];
+         const Float_t *sample = values + *sampleIterator * fBatchWidth;
          for (size_t j = 0; j < fBatchWidth; j++) {
             size_t bufferIndex = j * fBatchHeight + i;
-            buffer[bufferIndex] = event->GetValue(j);
+            buffer[bufferIndex] = sample[j];
          }
          sampleIterator++;
       }
    } else if (fBatchDepth == fBatchSize) {
       // batchDepth is batch size
+      const size_t nValues = fBatchHeight * fBatchWidth;
+      FillSampleValues(fSampleValues, events, nValues);
       for (size_t i = 0; i < fBatchDepth; i++) {
-         size_t sampleIndex = *sampleIterator;
-         Event * event = std::get<0>(fData)[sampleIndex];
+         const Float_t *sample = fSampleValues.data() + *sampleIterator * nValues;
          for (size_t j = 0; j < fBatchHeight; j++) {
             for (size_t k = 0; k < fBatchWidth; k++) {
                // because of the column-major ordering
                size_t bufferIndex = i * fBatchHeight * fBatchWidth + k * fBatchHeight + j;
-               buffer[bufferIndex] = event->GetValue(j * fBatchWidth + k);
+               buffer[bufferIndex] = sample[j * fBatchWidth + k];
             }
          }
          sampleIterator++;
@@ -1476,6 +1476,9 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
    UInt_t cNvars = fNvars;
    if (fUseFisherCuts && fisherOK) cNvars++;  // use the Fisher output simple as additional variable
 
+   // #### values of the fisher variable, computed once per event
+   std::vector<Double_t> fisherValues;
+
    // #### set up the binning info arrays
    // #### each var has its own binning since some may be integers 
    UInt_t*   nBins = new UInt_t [cNvars];
@@ -1515,13 +1518,14 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
       } else { // the fisher variable
          xmin[ivar]=999;
          xmax[ivar]=-999;
-         // too bad, for the moment I don't know how to do this without looping
-         // once to get the "min max" and then AGAIN to fill the histogram
+         // the values are kept to fill the histogram without computing them again
+         fisherValues.resize(nevents);
          for (UInt_t iev=0; iev<nevents; iev++) {
             // returns the Fisher value (no fixed range)
             Double_t result = fisherCoeff[fNvars]; // the fisher constant offset
             for (UInt_t jvar=0; jvar<fNvars; jvar++)
                result += fisherCoeff[jvar]*(eventSample[iev])->GetValueFast(jvar);
+            fisherValues[iev] = result;
             if (result > xmax[ivar]) xmax[ivar]=result;
             if (result < xmin[ivar]) xmin[ivar]=result;
          }
@@ -1581,132 +1585,100 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
    // #### Then loop through the vars to get the counts in each bin in each var
    // #### So we have a loop through the events and a loop through the vars, but no loop through the cuts this is a calculation
 
-   TrainNodeInfo nodeInfo(cNvars, nBins);
-   UInt_t nPartitions = TMVA::Config::Instance().GetThreadExecutor().GetPoolSize();
-
-   // #### When nbins is low compared to ndata this version of parallelization is faster, so use it 
-   // #### Parallelize by chunking the data into the same number of sections as we have processors
-   if(eventSample.size() >= cNvars*fNCuts*nPartitions*2)
-   {
-      auto seeds = ROOT::TSeqU(nPartitions);
-
-      // need a lambda function to pass to TThreadExecutor::MapReduce
-      auto f = [this, &eventSample, &fisherCoeff, &useVariable, &invBinWidth,
-                &nBins, &xmin, &cNvars, &nPartitions](UInt_t partition = 0){
-
-         UInt_t start = 1.0*partition/nPartitions*eventSample.size();
-         UInt_t end   = (partition+1.0)/nPartitions*eventSample.size();
+   // #### Gather the weights, classes and targets of the events into columns once, such that
+   // #### filling the histograms only reads the variable values of the events
+   const Bool_t doRegression = DoRegression();
+   std::vector<Double_t> eventWeights(nevents);
+   std::vector<Char_t>   eventIsSignal(nevents);
+   std::vector<Double_t> eventTargets(doRegression ? nevents : 0);
 
-         TrainNodeInfo nodeInfof(cNvars, nBins);
-
-         for(UInt_t iev=start; iev<end; iev++) {
-
-            Double_t eventWeight =  eventSample[iev]->GetWeight();
-            if (eventSample[iev]->GetClass() == fSigClass) {
-               nodeInfof.nTotS+=eventWeight;
-               nodeInfof.nTotS_unWeighted++;    }
-            else {
-               nodeInfof.nTotB+=eventWeight;
-               nodeInfof.nTotB_unWeighted++;
-            }
-
-            // #### Count the number in each bin
-            Int_t iBin=-1;
-            for (UInt_t ivar=0; ivar < cNvars; ivar++) {
-               // now scan trough the cuts for each varable and find which one gives
-               // the best separationGain at the current stage.
-               if ( useVariable[ivar] ) {
-                  Double_t eventData;
-                  if (ivar < fNvars) eventData = eventSample[iev]->GetValueFast(ivar);
-                  else { // the fisher variable
-                     eventData = fisherCoeff[fNvars];
-                     for (UInt_t jvar=0; jvar<fNvars; jvar++)
-                        eventData += fisherCoeff[jvar]*(eventSample[iev])->GetValueFast(jvar);
-
-                  }
-                  // #### figure out which bin it belongs in ...
-                  // "maximum" is nbins-1 (the "-1" because we start counting from 0 !!
-                  iBin = TMath::Min(Int_t(nBins[ivar]-1),TMath::Max(0,int (invBinWidth[ivar]*(eventData-xmin[ivar]) ) ));
-                  if (eventSample[iev]->GetClass() == fSigClass) {
-                     nodeInfof.nSelS[ivar][iBin]+=eventWeight;
-                     nodeInfof.nSelS_unWeighted[ivar][iBin]++;
-                  }
-                  else {
-                     nodeInfof.nSelB[ivar][iBin]+=eventWeight;
-                     nodeInfof.nSelB_unWeighted[ivar][iBin]++;
-                  }
-                  if (DoRegression()) {
-                     nodeInfof.target[ivar][iBin] +=eventWeight*eventSample[iev]->GetTarget(0);
-                     nodeInfof.target2[ivar][iBin]+=eventWeight*eventSample[iev]->GetTarget(0)*eventSample[iev]->GetTarget(0);
-                  }
-               }
-            }
-         }
-         return nodeInfof;
-      };
-
-      // #### Need an intial struct to pass to std::accumulate
-      TrainNodeInfo nodeInfoInit(cNvars, nBins);
-
-      // #### Run the threads in parallel then merge the results
-      auto redfunc = [nodeInfoInit](std::vector<TrainNodeInfo> v) -> TrainNodeInfo { return std::accumulate(v.begin(), v.end(), nodeInfoInit); };
-      nodeInfo = TMVA::Config::Instance().GetThreadExecutor().MapReduce(f, seeds, redfunc);
+   TrainNodeInfo nodeInfo(cNvars, nBins);
+   for (UInt_t iev=0; iev<nevents; iev++) {
+      const Double_t eventWeight = eventSample[iev]->GetWeight();
+      eventWeights[iev] = eventWeight;
+      eventIsSignal[iev] = eventSample[iev]->GetClass() == fSigClass;
+      if (doRegression) eventTargets[iev] = eventSample[iev]->GetTarget(0);
+      if (eventIsSignal[iev]) {
+         nodeInfo.nTotS+=eventWeight;
+         nodeInfo.nTotS_unWeighted++;
+      }
+      else {
+         nodeInfo.nTotB+=eventWeight;
+         nodeInfo.nTotB_unWeighted++;
+      }
    }
- 
-
-   // #### When nbins is close to the order of the data this version of parallelization is faster
-   // #### Parallelize by vectorizing the variable loop
-   else {
 
-      auto fvarFillNodeInfo = [this, &nodeInfo, &eventSample, &fisherCoeff, &useVariable, &invBinWidth, &nBins, &xmin](UInt_t ivar = 0){
-
-         for(UInt_t iev=0; iev<eventSample.size(); iev++) {
-
-            Int_t iBin=-1;
-            Double_t eventWeight =  eventSample[iev]->GetWeight(); 
-
-            // Only count the net signal and background once
-            if(ivar==0){
-                if (eventSample[iev]->GetClass() == fSigClass) {
-                   nodeInfo.nTotS+=eventWeight;
-                   nodeInfo.nTotS_unWeighted++;    }
-                else {
-                   nodeInfo.nTotB+=eventWeight;
-                   nodeInfo.nTotB_unWeighted++;
-                }
-            }
-         
-            // Figure out which bin the event belongs in and increment the bin in each histogram vector appropriately
-            if ( useVariable[ivar] ) {
-               Double_t eventData;
-               if (ivar < fNvars) eventData = eventSample[iev]->GetValueFast(ivar); 
-               else { // the fisher variable
-                  eventData = fisherCoeff[fNvars];
-                  for (UInt_t jvar=0; jvar<fNvars; jvar++)
-                     eventData += fisherCoeff[jvar]*(eventSample[iev])->GetValueFast(jvar);
-                  
-               }
-               // #### figure out which bin it belongs in ...
-               // "maximum" is nbins-1 (the "-1" because we start counting from 0 !!
-               iBin = TMath::Min(Int_t(nBins[ivar]-1),TMath::Max(0,int (invBinWidth[ivar]*(eventData-xmin[ivar]) ) ));
-               if (eventSample[iev]->GetClass() == fSigClass) {
-                  nodeInfo.nSelS[ivar][iBin]+=eventWeight;
-                  nodeInfo.nSelS_unWeighted[ivar][iBin]++;
-               } 
-               else {
-                  nodeInfo.nSelB[ivar][iBin]+=eventWeight;
-                  nodeInfo.nSelB_unWeighted[ivar][iBin]++;
-               }
-               if (DoRegression()) {
-                  nodeInfo.target[ivar][iBin] +=eventWeight*eventSample[iev]->GetTarget(0);
-                  nodeInfo.target2[ivar][iBin]+=eventWeight*eventSample[iev]->GetTarget(0)*eventSample[iev]->GetTarget(0);
-               }
+   // #### Fill the histograms in parallel over the variables and over blocks of events at the
+   // #### same time: each task fills the histogram of one variable for one block of events, and
+   // #### the histograms of the blocks are added afterwards. The events are split in blocks only
+   // #### when there are many more of them than bins, as merging the blocks costs one pass over
+   // #### the bins per block.
+   UInt_t nPartitions = TMVA::Config::Instance().GetThreadExecutor().GetPoolSize();
+   UInt_t nBlocks = 1;
+   if (nPartitions > 1 && nevents >= 2*cNvars*fNCuts*nPartitions) nBlocks = nPartitions;
+   else if (nPartitions > 1 && nevents >= 2*fNCuts*nPartitions) nBlocks = std::max(1u, nPartitions/cNvars);
+
+   std::vector<TrainNodeInfo> blockInfo;
+   if (nBlocks > 1) blockInfo.assign(nBlocks, TrainNodeInfo(cNvars, nBins));
+
+   auto ffillBlock = [&](UInt_t itask = 0){
+      const UInt_t ivar  = itask % cNvars;
+      const UInt_t block = itask / cNvars;
+      if (!useVariable[ivar]) return;
+
+      TrainNodeInfo& info = nBlocks > 1 ? blockInfo[block] : nodeInfo;
+      Double_t* nSelS            = info.nSelS[ivar].data();
+      Double_t* nSelB            = info.nSelB[ivar].data();
+      Double_t* nSelS_unWeighted = info.nSelS_unWeighted[ivar].data();
+      Double_t* nSelB_unWeighted = info.nSelB_unWeighted[ivar].data();
+      Double_t* target           = info.target[ivar].data();
+      Double_t* target2          = info.target2[ivar].data();
+
+      const UInt_t start = UInt_t(1.0*block/nBlocks*nevents);
+      const UInt_t end   = UInt_t((block+1.0)/nBlocks*nevents);
+      const Int_t lastBin = Int_t(nBins[ivar]-1);
+      const Double_t x0 = xmin[ivar];
+      const Double_t invWidth = invBinWidth[ivar];
+
+      for (UInt_t iev=start; iev<end; iev++) {
+         const Double_t eventData = ivar < fNvars ? eventSample[iev]->GetValueFast(ivar) : fisherValues[iev];
+         // #### figure out which bin it belongs in ...
+         // "maximum" is nbins-1 (the "-1" because we start counting from 0 !!
+         const Int_t iBin = TMath::Min(lastBin, TMath::Max(0, int(invWidth*(eventData-x0))));
+         const Double_t eventWeight = eventWeights[iev];
+         if (eventIsSignal[iev]) {
+            nSelS[iBin]+=eventWeight;
+            nSelS_unWeighted[iBin]++;
+         }
+         else {
+            nSelB[iBin]+=eventWeight;
+            nSelB_unWeighted[iBin]++;
+         }
+         if (doRegression) {
+            target[iBin] +=eventWeight*eventTargets[iev];
+            target2[iBin]+=eventWeight*eventTargets[iev]*eventTargets[iev];
+         }
+      }
+   };
+   TMVA::Config::Instance().GetThreadExecutor().Foreach(ffillBlock, ROOT::TSeqU(cNvars*nBlocks));
+
+   // #### Add the histograms of the blocks, in parallel over the variables
+   if (nBlocks > 1) {
+      auto fvarMergeBlocks = [&](UInt_t ivar = 0){
+         if (!useVariable[ivar]) return;
+         for (UInt_t block=0; block<nBlocks; block++) {
+            const TrainNodeInfo& info = blockInfo[block];
+            for (UInt_t ibin=0; ibin<nBins[ivar]; ibin++) {
+               nodeInfo.nSelS[ivar][ibin] += info.nSelS[ivar][ibin];
+               nodeInfo.nSelB[ivar][ibin] += info.nSelB[ivar][ibin];
+               nodeInfo.nSelS_unWeighted[ivar][ibin] += info.nSelS_unWeighted[ivar][ibin];
+               nodeInfo.nSelB_unWeighted[ivar][ibin] += info.nSelB_unWeighted[ivar][ibin];
+               nodeInfo.target[ivar][ibin] += info.target[ivar][ibin];
+               nodeInfo.target2[ivar][ibin] += info.target2[ivar][ibin];
             }
          }
-         return 0;
       };
-
-      TMVA::Config::Instance().GetThreadExecutor().Map(fvarFillNodeInfo, varSeeds);
+      TMVA::Config::Instance().GetThreadExecutor().Foreach(fvarMergeBlocks, varSeeds);
    }
 
    // now turn each "histogram" into a cumulative distribution
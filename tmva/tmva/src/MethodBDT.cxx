@@ -138,6 +138,7 @@ the selection.
 
 #include "Riostream.h"
 #include "TDirectory.h"
+#include "TFile.h"
 #include "TRandom3.h"
 #include "TMath.h"
 #include "TMatrixTSym.h"
@@ -2752,6 +2753,141 @@ void TMVA::MethodBDT::GetHelpMessage() const
    Log() << "errors, in order to minimize statistical fluctuations in different samples." << Endl;
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Depth of the deepest leaf below node.
+
+Int_t MaxLeafDepth(const TMVA::DecisionTreeNode *node, Int_t depth)
+{
+   if (node->GetNodeType() != 0)
+      return depth;
+   return std::max(MaxLeafDepth(node->GetLeft(), depth + 1), MaxLeafDepth(node->GetRight(), depth + 1));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the cut variables and thresholds of node and of its children in the
+/// arrays of a branchless tree of depth maxDepth, see TMVA::Experimental::BranchlessTree,
+/// where node has the topological index `index`. The leaves are given the
+/// value returned by leafValue, and the nodes of a sparse tree below a leaf
+/// are left to be filled by BranchlessTree::FillSparse.
+
+template <typename LeafValue>
+void FillBranchlessNode(const TMVA::DecisionTreeNode *node, Int_t index, Int_t maxDepth, LeafValue &leafValue,
+                        Int_t *inputs, Float_t *thresholds)
+{
+   const Int_t lenInputs = (1 << maxDepth) - 1;
+   if (node->GetNodeType() != 0) {
+      thresholds[index] = leafValue(node);
+      if (index < lenInputs)
+         inputs[index] = -1;
+      return;
+   }
+
+   // The branchless tree goes right if value > threshold, the decision tree
+   // node if value >= cut: the cut is replaced by the next lower float, which
+   // gives the same decision for the float event values
+   inputs[index] = node->GetSelector();
+   thresholds[index] = std::nextafter(node->GetCutValue(), -std::numeric_limits<Float_t>::infinity());
+   const TMVA::DecisionTreeNode *left = node->GetLeft();
+   const TMVA::DecisionTreeNode *right = node->GetRight();
+   if (!node->GetCutType())
+      std::swap(left, right);
+   FillBranchlessNode(left, 2 * index + 1, maxDepth, leafValue, inputs, thresholds);
+   FillBranchlessNode(right, 2 * index + 2, maxDepth, leafValue, inputs, thresholds);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the forest to the directory `key` of the ROOT file `filename`, in the
+/// format read by TMVA::Experimental::RBDT, for the fast inference of the
+/// classifier on batches of events:
+/// ~~~{.cpp}
+/// bdt->SaveBranchlessForest("myBDT", "myBDT.root");
+/// TMVA::Experimental::RBDT<> rbdt("myBDT", "myBDT.root");
+/// auto y = rbdt.Compute(x);
+/// ~~~
+/// RBDT gives the response of the method for the binary and multiclass
+/// classifiers, which must use neither the transformation of the input
+/// variables nor the automatic preselection, nor the Fisher cuts.
+
+void TMVA::MethodBDT::SaveBranchlessForest( const TString& key, const TString& filename ) const
+{
+   if (DoRegression()) {
+      Log() << kFATAL << "<SaveBranchlessForest> Regression forests are not supported" << Endl;
+   }
+   if (GetTransformationHandler().GetTransformationList().GetSize() > 0) {
+      Log() << kFATAL << "<SaveBranchlessForest> The transformations of the input variables are not supported" << Endl;
+   }
+   if (fDoPreselection) {
+      Log() << kFATAL << "<SaveBranchlessForest> The automatic preselection is not supported" << Endl;
+   }
+   if (fUseFisherCuts) {
+      Log() << kFATAL << "<SaveBranchlessForest> Fisher cuts are not supported" << Endl;
+   }
+
+   Int_t maxDepth = 0;
+   for (auto tree : fForest) {
+      maxDepth = std::max(maxDepth, MaxLeafDepth(tree->GetRoot(), 0));
+   }
+   const Int_t nTrees = fForest.size();
+   const Int_t lenInputs = (1 << maxDepth) - 1;
+   const Int_t lenThresholds = (1 << (maxDepth + 1)) - 1;
+
+   // The gradient boosted trees are summed, the others averaged with their boost weights
+   const Bool_t gradBoost = (fBoostType == "Grad");
+   Double_t norm = 0;
+   for (Int_t itree = 0; itree < nTrees; itree++) {
+      norm += fBoostWeights[itree];
+   }
+
+   std::vector<Int_t> inputs(nTrees * lenInputs, -1);
+   std::vector<Float_t> thresholds(nTrees * lenThresholds, 0);
+   std::vector<Int_t> outputs(nTrees, 0);
+   for (Int_t itree = 0; itree < nTrees; itree++) {
+      const DecisionTreeNode *root = fForest[itree]->GetRoot();
+      if (root == nullptr) {
+         Log() << kFATAL << "<SaveBranchlessForest> Tree without root node" << Endl;
+      }
+      const Double_t weight = gradBoost ? 1. : fBoostWeights[itree] / norm;
+      auto leafValue = [this, gradBoost, weight](const DecisionTreeNode *node) {
+         if (gradBoost)
+            return Float_t(node->GetResponse());
+         return Float_t(weight * (fUseYesNoLeaf ? node->GetNodeType() : node->GetPurity()));
+      };
+      FillBranchlessNode(root, 0, maxDepth, leafValue, inputs.data() + itree * lenInputs,
+                         thresholds.data() + itree * lenThresholds);
+      // trees 0, nClasses, 2*nClasses, ... belong to class 0 and so forth
+      if (DoMulticlass()) {
+         outputs[itree] = itree % DataInfo().GetNClasses();
+      }
+   }
+
+   // 2/(1+exp(-2x))-1 is tanh(x) for the gradient boosted binary classifiers
+   std::string objective = DoMulticlass() ? "softmax" : (gradBoost ? "tanh" : "identity");
+   std::vector<Int_t> maxDepths{maxDepth};
+   std::vector<Int_t> numTrees{nTrees};
+   std::vector<Int_t> numInputs{Int_t(GetNvar())};
+   std::vector<Int_t> numOutputs{DoMulticlass() ? Int_t(DataInfo().GetNClasses()) : 1};
+
+   TFile *file = TFile::Open(filename, "RECREATE");
+   if (file == nullptr || file->IsZombie()) {
+      Log() << kFATAL << "<SaveBranchlessForest> Failed to create file " << filename << Endl;
+   }
+   TDirectory *dir = file->mkdir(key);
+   dir->WriteObjectAny(&inputs, "std::vector<int>", "inputs");
+   dir->WriteObjectAny(&outputs, "std::vector<int>", "outputs");
+   dir->WriteObjectAny(&thresholds, "std::vector<float>", "thresholds");
+   dir->WriteObjectAny(&objective, "std::string", "objective");
+   dir->WriteObjectAny(&maxDepths, "std::vector<int>", "max_depth");
+   dir->WriteObjectAny(&numTrees, "std::vector<int>", "num_trees");
+   dir->WriteObjectAny(&numInputs, "std::vector<int>", "num_inputs");
+   dir->WriteObjectAny(&numOutputs, "std::vector<int>", "num_outputs");
+   file->Close();
+   delete file;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Make ROOT-independent C++ class for classifier response (classifier-specific implementation).
 
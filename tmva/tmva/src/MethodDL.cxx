@@ -1310,18 +1310,20 @@ void MethodDL::TrainDeepNet()
       }
       Log() << "Using " << nTrainingSamples << " events for training and " <<  nValidationSamples << " for testing" << Endl;
 
-      // Loading the training and validation datasets
+      // Loading the training and validation datasets, using two buffer pairs
+      // so that the next batch is prepared while the current one is used
+      size_t nStreams = 2;
       TMVAInput_t trainingTuple = std::tie(eventCollectionTraining, DataInfo());
       TensorDataLoader_t trainingData(trainingTuple, nTrainingSamples, batchSize,
                                       {inputDepth, inputHeight, inputWidth},
                                      {deepNet.GetBatchDepth(), deepNet.GetBatchHeight(), deepNet.GetBatchWidth()} ,
-                                      deepNet.GetOutputWidth(), nThreads);
+                                      deepNet.GetOutputWidth(), nStreams);
 
       TMVAInput_t validationTuple = std::tie(eventCollectionValidation, DataInfo());
       TensorDataLoader_t validationData(validationTuple, nValidationSamples, batchSize,
                                        {inputDepth, inputHeight, inputWidth},
                                        { deepNet.GetBatchDepth(),deepNet.GetBatchHeight(), deepNet.GetBatchWidth()} ,
-                                        deepNet.GetOutputWidth(), nThreads);
+                                        deepNet.GetOutputWidth(), nStreams);
 
 
 
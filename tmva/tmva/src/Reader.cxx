@@ -472,19 +472,34 @@ TMVA::IMethod* TMVA::Reader::BookMVA( TMVA::Types::EMVA methodType, const char*
 
 Double_t TMVA::Reader::EvaluateMVA( const std::vector<Float_t>& inputVec, const TString& methodTag, Double_t aux )
 {
-   // create a temporary event from the vector.
    IMethod* imeth = FindMVA( methodTag );
    MethodBase* meth = dynamic_cast<TMVA::MethodBase*>(imeth);
    if(meth==0) return 0;
 
-   //   Event* tmpEvent=new Event(inputVec, 2); // ToDo resolve magic 2 issue
-   Event* tmpEvent=new Event(inputVec, DataInfo().GetNVariables()); // is this the solution?
-   for (UInt_t i=0; i<inputVec.size(); i++){
-      if (TMath::IsNaN(inputVec[i])) {
-         Log() << kERROR << i << "-th variable of the event is NaN --> return MVA value -999, \n that's all I can do, please fix or remove this event." << Endl;
-         delete tmpEvent;
-         return -999;
-      }
+   if (meth->GetMethodType() == TMVA::Types::kCuts) {
+      TMVA::MethodCuts* mc = dynamic_cast<TMVA::MethodCuts*>(meth);
+      if(mc)
+         mc->SetTestSignalEfficiency( aux );
+   }
+   return EvaluateValues( meth, inputVec.data(), inputVec.size() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the method for nEvents events, whose GetNVariables() input
+/// variables are stored one event after the other in inputs, and write the
+/// responses to mvaValues. The method is looked up once for all the events,
+/// and the same event is filled with the values of each of them, without
+/// allocations. The parameter aux is obligatory for the cuts method where it
+/// represents the efficiency cutoff
+
+void TMVA::Reader::EvaluateMVA( const Float_t* inputs, UInt_t nEvents, const TString& methodTag, Double_t* mvaValues,
+                                Double_t aux )
+{
+   IMethod* imeth = FindMVA( methodTag );
+   MethodBase* meth = dynamic_cast<TMVA::MethodBase*>(imeth);
+   if(meth==0) {
+      std::fill( mvaValues, mvaValues + nEvents, 0. );
+      return;
    }
 
    if (meth->GetMethodType() == TMVA::Types::kCuts) {
@@ -492,9 +507,31 @@ Double_t TMVA::Reader::EvaluateMVA( const std::vector<Float_t>& inputVec, const
       if(mc)
          mc->SetTestSignalEfficiency( aux );
    }
-   Double_t val = meth->GetMvaValue( tmpEvent, (fCalculateError?&fMvaEventError:0));
-   delete tmpEvent;
-   return val;
+   const UInt_t nVars = DataInfo().GetNVariables();
+   for (UInt_t ievt=0; ievt<nEvents; ievt++)
+      mvaValues[ievt] = EvaluateValues( meth, inputs + ievt*nVars, nVars );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the method on the input variables values[0..nValues-1], copied
+/// to the event reused from one call to the next.
+
+Double_t TMVA::Reader::EvaluateValues( MethodBase* method, const Float_t* values, UInt_t nValues )
+{
+   for (UInt_t i=0; i<nValues; i++){
+      if (TMath::IsNaN(values[i])) {
+         Log() << kERROR << i << "-th variable of the event is NaN --> return MVA value -999, \n that's all I can do, please fix or remove this event." << Endl;
+         return -999;
+      }
+   }
+
+   if (fTmpEvalEvent.GetNVariables() != nValues) {
+      //   Event* tmpEvent=new Event(inputVec, 2); // ToDo resolve magic 2 issue
+      fTmpEvalEvent = Event( std::vector<Float_t>(values, values + nValues), DataInfo().GetNVariables() ); // is this the solution?
+   } else {
+      for (UInt_t i=0; i<nValues; i++) fTmpEvalEvent.SetVal( i, values[i] );
+   }
+   return method->GetMvaValue( &fTmpEvalEvent, (fCalculateError?&fMvaEventError:0));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -198,8 +198,8 @@ const TMVA::Event* TMVA::VariableDecorrTransform::Transform( const TMVA::Event*
    // transformation to decorrelate the variables
    const Int_t nvar = fGet.size();
 
-   std::vector<Float_t> input;
-   std::vector<Char_t> mask; // entries with kTRUE must not be transformed
+   std::vector<Float_t>& input = fTransformInput;
+   std::vector<Char_t>& mask = fTransformMask; // entries with kTRUE must not be transformed
    Bool_t hasMaskedEntries = GetInput( ev, input, mask );
 
    if( hasMaskedEntries ){ // targets might be masked (for events where the targets have not been computed yet)
@@ -212,16 +212,17 @@ const TMVA::Event* TMVA::VariableDecorrTransform::Transform( const TMVA::Event*
       return fTransformedEvent;
    }
 
-   TVectorD vec( nvar );
-   for (Int_t ivar=0; ivar<nvar; ivar++) vec(ivar) = input.at(ivar);
-
-   // diagonalise variable vectors
-   vec *= *m;
-
-   input.clear();
-   for (Int_t ivar=0; ivar<nvar; ivar++) input.push_back( vec(ivar) );
+   // diagonalise variable vectors: output = m * input, without temporary vectors
+   std::vector<Float_t>& output = fTransformOutput;
+   output.assign( nvar, 0 );
+   const Double_t* mat = m->GetMatrixArray();
+   for (Int_t ivar=0; ivar<nvar; ivar++) {
+      Double_t v = 0;
+      for (Int_t jvar=0; jvar<nvar; jvar++) v += mat[ivar*nvar + jvar] * input[jvar];
+      output[ivar] = v;
+   }
 
-   SetOutput( fTransformedEvent, input, mask, ev );
+   SetOutput( fTransformedEvent, output, mask, ev );
 
    return fTransformedEvent;
 }
@@ -120,10 +120,11 @@ const TMVA::Event* TMVA::VariableNormalizeTransform::Transform( const TMVA::Even
    if (cls < 0 || cls >= (int) fMin.size()) cls = fMin.size()-1;
    // EVT workaround end
 
-   FloatVector input; // will be filled with the selected variables, targets, (spectators)
-   FloatVector output; // will be filled with the selected variables, targets, (spectators)
-   std::vector<Char_t> mask; // entries with kTRUE must not be transformed
+   FloatVector& input = fTransformInput; // will be filled with the selected variables, targets, (spectators)
+   FloatVector& output = fTransformOutput; // will be filled with the selected variables, targets, (spectators)
+   std::vector<Char_t>& mask = fTransformMask; // entries with kTRUE must not be transformed
    GetInput( ev, input, mask );
+   output.clear();
 
    if (fTransformedEvent==0) fTransformedEvent = new Event();
 
@@ -146,9 +146,9 @@ const TMVA::Event* TMVA::VariablePCATransform::Transform( const Event* const ev,
       fTransformedEvent = new Event();
    }
 
-   std::vector<Float_t> input;
-   std::vector<Char_t>  mask;
-   std::vector<Float_t> principalComponents;
+   std::vector<Float_t>& input = fTransformInput;
+   std::vector<Char_t>&  mask = fTransformMask;
+   std::vector<Float_t>& principalComponents = fTransformOutput;
 
    Bool_t hasMaskedEntries = GetInput( ev, input, mask );
 
@@ -0,0 +1,93 @@
+// ROOT
+#include "TRandom3.h"
+
+// TMVA
+#include "TMVA/Config.h"
+#include "TMVA/DataLoader.h"
+#include "TMVA/DecisionTree.h"
+#include "TMVA/DecisionTreeNode.h"
+#include "TMVA/Factory.h"
+#include "TMVA/MethodBDT.h"
+
+// Stdlib
+#include <memory>
+#include <vector>
+
+// External
+#include "gtest/gtest.h"
+
+// The cut-scan histograms of DecisionTree::TrainNodeFast are filled per block of events with IMT, and the blocks are
+// added afterwards: the trees trained with and without IMT must be the same, up to the rounding of the weight sums.
+
+namespace {
+
+// A fixed data set with non-integer weights, such that the order of the weight sums matters
+TMVA::DataLoader *MakeDataLoader(const char *name)
+{
+   TRandom3 rng(42);
+   auto dl = new TMVA::DataLoader(name);
+   dl->AddVariable("x");
+   dl->AddVariable("y");
+   dl->AddVariable("z");
+   for (Int_t n = 0; n < 5000; ++n) {
+      dl->AddSignalTrainingEvent({rng.Gaus(0.3), rng.Gaus(0.2, 1.5), rng.Uniform(-1, 2)}, rng.Uniform(0.5, 1.5));
+      dl->AddBackgroundTrainingEvent({rng.Gaus(-0.3), rng.Gaus(-0.2, 1.5), rng.Uniform(-2, 1)}, rng.Uniform(0.5, 1.5));
+      dl->AddSignalTestEvent({rng.Gaus(0.3), rng.Gaus(0.2, 1.5), rng.Uniform(-1, 2)});
+      dl->AddBackgroundTestEvent({rng.Gaus(-0.3), rng.Gaus(-0.2, 1.5), rng.Uniform(-2, 1)});
+   }
+   dl->PrepareTrainingAndTestTree("", "SplitMode=Block:NormMode=None:!V");
+   return dl;
+}
+
+// Train a BDT on the fixed data set, with the given number of threads (1 for no IMT)
+std::vector<TMVA::DecisionTree *> TrainForest(TMVA::Factory &factory, TMVA::DataLoader *dl, UInt_t nThreads)
+{
+   if (nThreads > 1)
+      TMVA::Config::Instance().EnableMT(nThreads);
+   else
+      TMVA::Config::Instance().DisableMT();
+   factory.BookMethod(dl, TMVA::Types::kBDT, "BDT",
+                      "!V:NTrees=10:MaxDepth=4:nCuts=40:BoostType=AdaBoost:MinNodeSize=2.5%:UseFisherCuts");
+   factory.TrainAllMethods();
+   TMVA::Config::Instance().DisableMT();
+   auto bdt = dynamic_cast<TMVA::MethodBDT *>(factory.GetMethod(dl->GetName(), "BDT"));
+   return bdt ? bdt->GetForest() : std::vector<TMVA::DecisionTree *>{};
+}
+
+void ExpectEqualNodes(const TMVA::DecisionTreeNode *a, const TMVA::DecisionTreeNode *b)
+{
+   ASSERT_EQ(a == nullptr, b == nullptr);
+   if (!a)
+      return;
+   EXPECT_EQ(a->GetNodeType(), b->GetNodeType());
+   EXPECT_EQ(a->GetSelector(), b->GetSelector());
+   EXPECT_EQ(a->GetCutType(), b->GetCutType());
+   EXPECT_FLOAT_EQ(a->GetCutValue(), b->GetCutValue());
+   EXPECT_NEAR(a->GetPurity(), b->GetPurity(), 1e-5);
+   EXPECT_NEAR(a->GetResponse(), b->GetResponse(), 1e-5);
+   ExpectEqualNodes(a->GetLeft(), b->GetLeft());
+   ExpectEqualNodes(a->GetRight(), b->GetRight());
+}
+
+} // namespace
+
+TEST(BDTImplicitMT, SameTreesWithAndWithoutIMT)
+{
+   TMVA::gConfig().SetSilent(true);
+   TMVA::MsgLogger::InhibitOutput();
+
+   TMVA::Factory serialFactory("BDTSerial", "!V:Silent:!DrawProgressBar:AnalysisType=Classification");
+   auto serialLoader = MakeDataLoader("BDTSerialLoader");
+   const auto serialForest = TrainForest(serialFactory, serialLoader, 1);
+
+   TMVA::Factory mtFactory("BDTMT", "!V:Silent:!DrawProgressBar:AnalysisType=Classification");
+   auto mtLoader = MakeDataLoader("BDTMTLoader");
+   const auto mtForest = TrainForest(mtFactory, mtLoader, 4);
+
+   ASSERT_EQ(10u, serialForest.size());
+   ASSERT_EQ(serialForest.size(), mtForest.size());
+   for (std::size_t i = 0; i < serialForest.size(); ++i) {
+      EXPECT_EQ(serialForest[i]->GetNNodes(), mtForest[i]->GetNNodes()) << "tree " << i;
+      ExpectEqualNodes(serialForest[i]->GetRoot(), mtForest[i]->GetRoot());
+   }
+}
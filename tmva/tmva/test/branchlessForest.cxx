@@ -82,6 +82,33 @@ TEST(BranchlessTree, InferenceSparseTreeDepth2)
    EXPECT_FLOAT_EQ(tree.Inference(input3, 1), 6.0);
 }
 
+TEST(BranchlessTree, BatchInferenceFullTreeDepth2)
+{
+   BranchlessTree<float> tree;
+   tree.fTreeDepth = 2;
+   tree.fThresholds = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+   tree.fInputs = {0, 1, 2};
+
+   // More events than in one block, in both memory layouts
+   const int rows = kInferenceBlockSize + 3;
+   std::vector<float> rowMajor(3 * rows), colMajor(3 * rows);
+   for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < 3; j++) {
+         const float value = (i * 7 + j * 3) % 5 - 2.0;
+         rowMajor[i * 3 + j] = value;
+         colMajor[j * rows + i] = value;
+      }
+   }
+   std::vector<float> predictionsRowMajor(rows, 1.0), predictionsColMajor(rows, 1.0);
+   tree.Inference(rowMajor.data(), rows, 1, 3, predictionsRowMajor.data());
+   tree.Inference(colMajor.data(), rows, rows, 1, predictionsColMajor.data());
+   for (int i = 0; i < rows; i++) {
+      const float expected = 1.0 + tree.Inference(&rowMajor[i * 3], 1);
+      EXPECT_FLOAT_EQ(predictionsRowMajor[i], expected);
+      EXPECT_FLOAT_EQ(predictionsColMajor[i], expected);
+   }
+}
+
 TEST(BranchlessJittedTree, InferenceFullTreeDepth0)
 {
    BranchlessTree<float> tree;
@@ -254,6 +281,42 @@ TEST(BranchlessForest, SortTrees)
    EXPECT_EQ(forest2.fTrees[2].fThresholds[0], 0.0);
 }
 
+TEST(QuantizedBranchlessForest, InferenceTwoTrees)
+{
+   const auto maxDepth = 2;
+   const auto numInputs = 3;
+   const auto numTrees = 2;
+   WriteModel("myModel", "TestQuantizedBranchlessForest.root", "logistic", {0, 1, 2, 2, -1, 0}, {0, 0},
+              {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 1.0, 0.5, 0.0, -1.0, -2.0, 0.0, 0.0},
+              {maxDepth}, {numTrees}, {numInputs}, {1});
+
+   BranchlessForest<float> forest;
+   forest.Load("myModel", "TestQuantizedBranchlessForest.root", 0);
+   QuantizedBranchlessForest<float> quantized;
+   quantized.Quantize(forest);
+   EXPECT_EQ(quantized.fCuts[0].size(), 2u);
+   EXPECT_EQ(quantized.fCuts[2].size(), 2u);
+
+   // Values below, on and above the thresholds, in both memory layouts
+   const int rows = 50;
+   std::vector<float> rowMajor(numInputs * rows), colMajor(numInputs * rows);
+   for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < numInputs; j++) {
+         const float value = 0.5 * ((i * 7 + j * 3) % 9) - 2.0;
+         rowMajor[i * numInputs + j] = value;
+         colMajor[j * rows + i] = value;
+      }
+   }
+   std::vector<float> expected(rows), predictions(rows);
+   forest.Inference(rowMajor.data(), rows, true, expected.data());
+   quantized.Inference(rowMajor.data(), rows, true, predictions.data());
+   for (int i = 0; i < rows; i++)
+      EXPECT_FLOAT_EQ(predictions[i], expected[i]);
+   quantized.Inference(colMajor.data(), rows, false, predictions.data());
+   for (int i = 0; i < rows; i++)
+      EXPECT_FLOAT_EQ(predictions[i], expected[i]);
+}
+
 TEST(BranchlessJittedForest, SortTrees)
 {
    const auto maxDepth = 1;
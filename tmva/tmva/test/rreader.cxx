@@ -5,11 +5,14 @@
 #include <TSystem.h>
 #include <TMVA/Factory.h>
 #include <TMVA/DataLoader.h>
+#include <TMVA/MethodBDT.h>
+#include <TMVA/Reader.h>
 
 #include <TMVA/RReader.hxx>
 #include <TMVA/RInferenceUtils.hxx>
 #include <TMVA/RTensor.hxx>
 #include <TMVA/RTensorUtils.hxx>
+#include <TMVA/RBDT.hxx>
 
 using namespace TMVA::Experimental;
 
@@ -187,6 +190,50 @@ TEST(RReader, ClassificationComputeDataFrame)
    EXPECT_EQ(y->size(), *c);
 }
 
+TEST(RReader, ClassificationSaveBranchlessForest)
+{
+   TrainClassificationModel();
+   TMVA::Reader reader("Silent");
+   float values[4];
+   for (std::size_t i = 0; i < variablesClassification.size(); i++)
+      reader.AddVariable(variablesClassification[i], &values[i]);
+   auto method = dynamic_cast<TMVA::MethodBDT *>(reader.BookMVA("BDT", modelClassification));
+   ASSERT_NE(method, nullptr);
+   method->SaveBranchlessForest("BDT", "RReaderClassificationBranchless.root");
+
+   RBDT<BranchlessForest<float>> bdt("BDT", "RReaderClassificationBranchless.root");
+   ROOT::RDataFrame df("TreeS", filenameClassification);
+   auto events = df.Range(100);
+   auto x = AsTensor<float>(events, variablesClassification);
+   auto y = bdt.Compute(x);
+   ASSERT_EQ(y.GetShape()[0], 100ul);
+   for (std::size_t i = 0; i < 100; i++) {
+      for (std::size_t j = 0; j < variablesClassification.size(); j++)
+         values[j] = x(i, j);
+      EXPECT_NEAR(y(i, 0), reader.EvaluateMVA("BDT"), 1e-5);
+   }
+}
+
+TEST(RReader, ClassificationReaderEvaluateBatch)
+{
+   TrainClassificationModel();
+   TMVA::Reader reader("Silent");
+   float values[4];
+   for (std::size_t i = 0; i < variablesClassification.size(); i++)
+      reader.AddVariable(variablesClassification[i], &values[i]);
+   reader.BookMVA("BDT", modelClassification);
+
+   ROOT::RDataFrame df("TreeS", filenameClassification);
+   auto events = df.Range(100);
+   auto x = AsTensor<float>(events, variablesClassification);
+   std::vector<double> y(100);
+   reader.EvaluateMVA(x.GetData(), 100, "BDT", y.data());
+   for (std::size_t i = 0; i < 100; i++) {
+      const std::vector<float> event(x.GetData() + i * 4, x.GetData() + (i + 1) * 4);
+      EXPECT_EQ(y[i], reader.EvaluateMVA(event, "BDT"));
+   }
+}
+
 TEST(RReader, RegressionGetVariables)
 {
    TrainRegressionModel();
@@ -281,3 +328,22 @@ TEST(RReader, MulticlassComputeDataFrame)
    auto y = df2.Take<std::vector<float>>("y");
    EXPECT_EQ(y->size(), *c);
 }
+
+TEST(RReader, ClassificationComputeDataFrameSlots)
+{
+   TrainClassificationModel();
+   ROOT::RDataFrame df("TreeS", filenameClassification);
+   std::vector<RReader> models;
+   for (unsigned int i = 0; i < df.GetNSlots(); i++)
+      models.emplace_back(modelClassification);
+   RReader model(modelClassification);
+   auto df2 = df.Define("y", Compute<4, float>(model), variablesClassification)
+                 .DefineSlot("ySlot", ComputeSlots<4, float>(models), variablesClassification);
+   auto y = df2.Take<std::vector<float>>("y");
+   auto ySlot = df2.Take<std::vector<float>>("ySlot");
+   ASSERT_EQ(y->size(), ySlot->size());
+   for (std::size_t i = 0; i < y->size(); i++) {
+      ASSERT_EQ(ySlot->at(i).size(), 1ul);
+      EXPECT_FLOAT_EQ(ySlot->at(i)[0], y->at(i)[0]);
+   }
+}
@@ -17,6 +17,8 @@
 #include <deque>
 #include <list>
 #include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <TRegexp.h>
@@ -32,6 +34,7 @@ private:
    using ColType_t = char;
    static const std::map<ColType_t, std::string> fgColTypeMap;
 
+   std::string fFileName;
    std::streampos fDataPos = 0;
    bool fReadHeaders = false;
    unsigned int fNSlots = 0U;
@@ -40,11 +43,16 @@ private:
    const Long64_t fLinesChunkSize;
    ULong64_t fEntryRangesRequested = 0ULL;
    ULong64_t fProcessedLines = 0ULL; // marks the progress of the consumption of the csv lines
+   ULong64_t fChunkFirstEntry = 0ULL; // the entry of the first line of the current chunk
    std::vector<std::string> fHeaders;
    std::map<std::string, ColType_t> fColTypes;
    std::list<ColType_t> fColTypesList;
+   std::vector<int> fColIsActive; // whether readers were requested for the column. vector<bool> is not MT-safe
    std::vector<std::vector<void *>> fColAddresses;         // fColAddresses[column][slot]
-   std::vector<Record_t> fRecords;                         // fRecords[entry][column]
+   std::string fBuffer;                                    // the text of the current chunk, and the start of the next
+   std::size_t fBufferConsumed = 0;                        // the position in fBuffer after the current chunk
+   std::vector<std::pair<std::size_t, std::size_t>> fLines; // begin and end in fBuffer of each line of the chunk
+   std::vector<std::vector<std::string>> fSlotFields;      // the fields of the current line, per slot
    std::vector<std::vector<double>> fDoubleEvtValues;      // one per column per slot
    std::vector<std::vector<Long64_t>> fLong64EvtValues;    // one per column per slot
    std::vector<std::vector<std::string>> fStringEvtValues; // one per column per slot
@@ -55,13 +63,14 @@ private:
    static TRegexp intRegex, doubleRegex1, doubleRegex2, doubleRegex3, trueRegex, falseRegex;
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
+   void ReadChunk();
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &);
    void InferColTypes(std::vector<std::string> &);
    void InferType(const std::string &, unsigned int);
    std::vector<std::string> ParseColumns(const std::string &);
    size_t ParseValue(const std::string &, std::vector<std::string> &, size_t);
+   size_t ParseField(const char *, size_t, size_t, std::string &) const;
    ColType_t GetType(std::string_view colName) const;
 
 protected:
@@ -79,6 +88,7 @@ public:
    bool SetEntry(unsigned int slot, ULong64_t entry);
    void SetNSlots(unsigned int nSlots);
    std::string GetLabel();
+   std::vector<std::string> GetInputFileNames();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
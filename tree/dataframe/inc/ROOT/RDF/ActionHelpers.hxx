@@ -22,21 +22,35 @@
 #include "ROOT/RSnapshotOptions.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "ROOT/RDF/RDisplay.hxx"
+#include "RConfigure.h" // for R__HAS_ROOT7
 #include "RtypesCore.h"
 #include "TBranch.h"
 #include "TClassEdit.h"
 #include "TDirectory.h"
 #include "TFile.h" // for SnapshotHelper
+#include "TEfficiency.h"
 #include "TH1.h"
 #include "TGraph.h"
 #include "TLeaf.h"
 #include "TObject.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
 #include "TTree.h"
 #include "TTreeReader.h" // for SnapshotHelper
 
+#ifdef R__HAS_ROOT7
+#include "ROOT/RNTuple.hxx" // for SnapshotHelperRNTuple
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#endif
+
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -156,6 +170,11 @@ public:
    std::string GetActionName() { return "Report"; }
 };
 
+/// Merge n partial results into the first one with a tree reduction: `merge(into, from)` must merge the result of
+/// index `from` into the one of index `into`. The merges of each level of the tree run in parallel on the implicit
+/// multi-threading pool, if enabled.
+void TreeReduce(unsigned int n, const std::function<void(unsigned int, unsigned int)> &merge);
+
 class FillHelper : public RActionImpl<FillHelper> {
    // this sets a total initial size of 16 MB for the buffers (can increase)
    static constexpr unsigned int fgTotalBufSize = 2097152;
@@ -175,6 +194,8 @@ class FillHelper : public RActionImpl<FillHelper> {
    void UpdateMinMax(unsigned int slot, double v);
 
 public:
+   static constexpr bool kIsBulkCapable = true;
+
    FillHelper(const std::shared_ptr<Hist_t> &h, const unsigned int nSlots);
    FillHelper(FillHelper &&) = default;
    FillHelper(const FillHelper &) = delete;
@@ -253,17 +274,95 @@ extern template void FillHelper::Exec(unsigned int, const std::vector<int> &, co
 extern template void
 FillHelper::Exec(unsigned int, const std::vector<unsigned int> &, const std::vector<unsigned int> &);
 
+/// Fill obj with all the entries of blocks of column values at once, if it has a FillN() equivalent to calling its
+/// Fill() with each entry. Return false if it has not, in which case the entries must be filled one by one.
+template <typename HIST, typename... Blocks>
+bool FillBlocks(HIST &, const Blocks &...)
+{
+   return false;
+}
+
+inline bool FillBlocks(::TProfile &p, const ROOT::VecOps::RVec<double> &xs, const ROOT::VecOps::RVec<double> &ys)
+{
+   p.FillN(xs.size(), xs.data(), ys.data(), nullptr);
+   return true;
+}
+
+inline bool FillBlocks(::TProfile &p, const ROOT::VecOps::RVec<double> &xs, const ROOT::VecOps::RVec<double> &ys,
+                       const ROOT::VecOps::RVec<double> &ws)
+{
+   p.FillN(xs.size(), xs.data(), ys.data(), ws.data());
+   return true;
+}
+
+inline bool FillBlocks(::TProfile2D &p, const ROOT::VecOps::RVec<double> &xs, const ROOT::VecOps::RVec<double> &ys,
+                       const ROOT::VecOps::RVec<double> &zs)
+{
+   p.FillN(xs.size(), xs.data(), ys.data(), zs.data(), nullptr);
+   return true;
+}
+
+inline bool FillBlocks(::TProfile2D &p, const ROOT::VecOps::RVec<double> &xs, const ROOT::VecOps::RVec<double> &ys,
+                       const ROOT::VecOps::RVec<double> &zs, const ROOT::VecOps::RVec<double> &ws)
+{
+   p.FillN(xs.size(), xs.data(), ys.data(), zs.data(), ws.data());
+   return true;
+}
+
+template <typename P>
+bool FillEfficiencyBlocks(::TEfficiency &e, const ROOT::VecOps::RVec<P> &passed, const double *xs, const double *ys,
+                          const double *zs)
+{
+   std::unique_ptr<Bool_t[]> flags(new Bool_t[passed.size()]);
+   std::transform(passed.begin(), passed.end(), flags.get(), [](const P &p) { return static_cast<Bool_t>(p); });
+   e.FillN(passed.size(), flags.get(), xs, ys, zs);
+   return true;
+}
+
+template <typename P>
+bool FillBlocks(::TEfficiency &e, const ROOT::VecOps::RVec<P> &passed, const ROOT::VecOps::RVec<double> &xs)
+{
+   return FillEfficiencyBlocks(e, passed, xs.data(), nullptr, nullptr);
+}
+
+template <typename P>
+bool FillBlocks(::TEfficiency &e, const ROOT::VecOps::RVec<P> &passed, const ROOT::VecOps::RVec<double> &xs,
+                const ROOT::VecOps::RVec<double> &ys)
+{
+   return FillEfficiencyBlocks(e, passed, xs.data(), ys.data(), nullptr);
+}
+
+template <typename P>
+bool FillBlocks(::TEfficiency &e, const ROOT::VecOps::RVec<P> &passed, const ROOT::VecOps::RVec<double> &xs,
+                const ROOT::VecOps::RVec<double> &ys, const ROOT::VecOps::RVec<double> &zs)
+{
+   return FillEfficiencyBlocks(e, passed, xs.data(), ys.data(), zs.data());
+}
+
 template <typename HIST = Hist_t>
 class FillParHelper : public RActionImpl<FillParHelper<HIST>> {
    std::vector<HIST *> fObjects;
+   /// Non-null if all slots fill the result object directly, see ROOT::RDF::EnableSharedFill()
+   std::unique_ptr<std::mutex> fSharedFillMutex;
+
+   /// Lock the result object if it is shared by all slots, no-op otherwise
+   std::unique_lock<std::mutex> LockIfShared()
+   {
+      return fSharedFillMutex ? std::unique_lock<std::mutex>(*fSharedFillMutex) : std::unique_lock<std::mutex>();
+   }
 
 public:
+   static constexpr bool kIsBulkCapable = true;
+
    FillParHelper(FillParHelper &&) = default;
    FillParHelper(const FillParHelper &) = delete;
 
-   FillParHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots) : fObjects(nSlots, nullptr)
+   FillParHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots) : fObjects(nSlots, h.get())
    {
-      fObjects[0] = h.get();
+      if (nSlots > 1 && GetSharedFillRef()) {
+         fSharedFillMutex = std::make_unique<std::mutex>();
+         return;
+      }
       // Initialise all other slots
       for (unsigned int i = 1; i < nSlots; ++i) {
          fObjects[i] = new HIST(*fObjects[0]);
@@ -277,27 +376,32 @@ public:
 
    void Exec(unsigned int slot, double x0) // 1D histos
    {
+      const auto lock = LockIfShared();
       fObjects[slot]->Fill(x0);
    }
 
    void Exec(unsigned int slot, double x0, double x1) // 1D weighted and 2D histos
    {
+      const auto lock = LockIfShared();
       fObjects[slot]->Fill(x0, x1);
    }
 
    void Exec(unsigned int slot, double x0, double x1, double x2) // 2D weighted and 3D histos
    {
+      const auto lock = LockIfShared();
       fObjects[slot]->Fill(x0, x1, x2);
    }
 
    void Exec(unsigned int slot, double x0, double x1, double x2, double x3) // 3D weighted histos
    {
+      const auto lock = LockIfShared();
       fObjects[slot]->Fill(x0, x1, x2, x3);
    }
 
    template <typename X0, typename std::enable_if<IsDataContainer<X0>::value || std::is_same<X0, std::string>::value, int>::type = 0>
    void Exec(unsigned int slot, const X0 &x0s)
    {
+      const auto lock = LockIfShared();
       auto thisSlotH = fObjects[slot];
       for (auto &x0 : x0s) {
          thisSlotH->Fill(x0); // TODO: Can be optimised in case T == vector<double>
@@ -317,10 +421,13 @@ public:
              typename std::enable_if<IsDataContainer<X0>::value && IsDataContainer<X1>::value, int>::type = 0>
    void Exec(unsigned int slot, const X0 &x0s, const X1 &x1s)
    {
+      const auto lock = LockIfShared();
       auto thisSlotH = fObjects[slot];
       if (x0s.size() != x1s.size()) {
          throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
       }
+      if (FillBlocks(*thisSlotH, x0s, x1s))
+         return;
       auto x0sIt = std::begin(x0s);
       const auto x0sEnd = std::end(x0s);
       auto x1sIt = std::begin(x1s);
@@ -333,6 +440,7 @@ public:
              typename std::enable_if<IsDataContainer<X0>::value && !IsDataContainer<W>::value, int>::type = 0>
    void Exec(unsigned int slot, const X0 &x0s, const W w)
    {
+      const auto lock = LockIfShared();
       auto thisSlotH = fObjects[slot];
       for (auto &&x : x0s) {
          thisSlotH->Fill(x, w);
@@ -344,10 +452,13 @@ public:
                                      int>::type = 0>
    void Exec(unsigned int slot, const X0 &x0s, const X1 &x1s, const X2 &x2s)
    {
+      const auto lock = LockIfShared();
       auto thisSlotH = fObjects[slot];
       if (!(x0s.size() == x1s.size() && x1s.size() == x2s.size())) {
          throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
       }
+      if (FillBlocks(*thisSlotH, x0s, x1s, x2s))
+         return;
       auto x0sIt = std::begin(x0s);
       const auto x0sEnd = std::end(x0s);
       auto x1sIt = std::begin(x1s);
@@ -362,6 +473,7 @@ public:
                                      int>::type = 0>
    void Exec(unsigned int slot, const X0 &x0s, const X1 &x1s, const W w)
    {
+      const auto lock = LockIfShared();
       auto thisSlotH = fObjects[slot];
       if (x0s.size() != x1s.size()) {
          throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
@@ -380,10 +492,13 @@ public:
                                      int>::type = 0>
    void Exec(unsigned int slot, const X0 &x0s, const X1 &x1s, const X2 &x2s, const X3 &x3s)
    {
+      const auto lock = LockIfShared();
       auto thisSlotH = fObjects[slot];
       if (!(x0s.size() == x1s.size() && x1s.size() == x2s.size() && x1s.size() == x3s.size())) {
          throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
       }
+      if (FillBlocks(*thisSlotH, x0s, x1s, x2s, x3s))
+         return;
       auto x0sIt = std::begin(x0s);
       const auto x0sEnd = std::end(x0s);
       auto x1sIt = std::begin(x1s);
@@ -400,6 +515,7 @@ public:
                                      int>::type = 0>
    void Exec(unsigned int slot, const X0 &x0s, const X1 &x1s, const X2 &x2s, const W w)
    {
+      const auto lock = LockIfShared();
       auto thisSlotH = fObjects[slot];
       if (!(x0s.size() == x1s.size() && x1s.size() == x2s.size())) {
          throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
@@ -417,17 +533,21 @@ public:
 
    void Finalize()
    {
-      auto resObj = fObjects[0];
-      const auto nSlots = fObjects.size();
-      TList l;
-      l.SetOwner(); // The list will free the memory associated to its elements upon destruction
-      for (unsigned int slot = 1; slot < nSlots; ++slot) {
-         l.Add(fObjects[slot]);
-      }
+      if (fSharedFillMutex)
+         return;
 
-      resObj->Merge(&l);
+      // Merge pairs of partial results in parallel, deleting the merged objects as soon as possible
+      auto &objects = fObjects;
+      TreeReduce(fObjects.size(), [&objects](unsigned int into, unsigned int from) {
+         TList l;
+         l.SetOwner(); // The list will free the memory associated to its elements upon destruction
+         l.Add(objects[from]);
+         objects[into]->Merge(&l);
+         objects[from] = nullptr;
+      });
    }
 
+   /// In shared-fill mode the partial result is the result object that all slots are filling
    HIST &PartialUpdate(unsigned int slot) { return *fObjects[slot]; }
 
    std::string GetActionName() { return "FillPar"; }
@@ -523,7 +643,7 @@ class TakeHelper : public RActionImpl<TakeHelper<RealT_t, T, COLL>> {
 
 public:
    using ColumnTypes_t = TypeList<T>;
-   TakeHelper(const std::shared_ptr<COLL> &resultColl, const unsigned int nSlots)
+   TakeHelper(const std::shared_ptr<COLL> &resultColl, const unsigned int nSlots, ULong64_t /*nValuesBound*/ = 0)
    {
       fColls.emplace_back(resultColl);
       for (unsigned int i = 1; i < nSlots; ++i)
@@ -559,13 +679,68 @@ public:
 
 // Case 2.: The column is not an RVec, the collection is a vector
 // Optimisations, no transformations: just copies.
+// If an upper bound on the number of values is known when the action is booked, the slots write directly into the
+// result vector, each into blocks of it that they claim, and the blocks are compacted at the end of the event loop.
+// Otherwise the values are collected per slot and concatenated at the end of the event loop.
 template <typename RealT_t, typename T>
 class TakeHelper<RealT_t, T, std::vector<T>> : public RActionImpl<TakeHelper<RealT_t, T, std::vector<T>>> {
+   /// A portion [fBegin, fEnd) of the result vector claimed by a slot, of which [fBegin, fFilled) is filled
+   struct RBlock {
+      ULong64_t fBegin;
+      ULong64_t fFilled;
+      ULong64_t fEnd;
+   };
+
    Results<std::shared_ptr<std::vector<T>>> fColls;
+   const ULong64_t fNValuesBound; ///< Upper bound on the number of values, zero if unknown
+   ULong64_t fBlockSize;
+   bool fPreallocated = false;
+   std::unique_ptr<std::atomic<ULong64_t>> fNextFree; ///< The first value of the result vector not claimed yet
+   std::vector<std::vector<RBlock>> fBlocks;          ///< The blocks claimed by each slot
+   std::vector<std::vector<T>> fOverflows;            ///< Per slot, the values exceeding the bound, if it was wrong
+   std::vector<std::vector<T>> fPartialResults;       ///< Per slot, if partial results are requested
+
+   /// Return the block the slot is filling, claiming a new one if needed, or a nullptr if the bound is exceeded
+   RBlock *GetFreeBlock(unsigned int slot)
+   {
+      auto &blocks = fBlocks[slot];
+      if (!blocks.empty() && blocks.back().fFilled < blocks.back().fEnd)
+         return &blocks.back();
+      const auto begin = fNextFree->fetch_add(fBlockSize);
+      if (begin >= fNValuesBound)
+         return nullptr;
+      const auto end = std::min(begin + fBlockSize, fNValuesBound);
+      blocks.push_back({begin, begin, end});
+      return &blocks.back();
+   }
+
+   /// Move the filled part of the blocks to the front of the result vector, keeping the order in which they were
+   /// claimed, and append the values that exceeded the bound
+   void CompactBlocks()
+   {
+      std::vector<RBlock> blocks;
+      for (const auto &slotBlocks : fBlocks)
+         blocks.insert(blocks.end(), slotBlocks.begin(), slotBlocks.end());
+      std::sort(blocks.begin(), blocks.end(), [](const RBlock &a, const RBlock &b) { return a.fBegin < b.fBegin; });
+
+      auto &result = *fColls[0];
+      ULong64_t size = 0;
+      for (const auto &block : blocks) {
+         if (block.fBegin != size)
+            std::move(result.begin() + block.fBegin, result.begin() + block.fFilled, result.begin() + size);
+         size += block.fFilled - block.fBegin;
+      }
+      result.resize(size);
+      for (const auto &overflow : fOverflows)
+         result.insert(result.end(), overflow.begin(), overflow.end());
+   }
 
 public:
    using ColumnTypes_t = TypeList<T>;
-   TakeHelper(const std::shared_ptr<std::vector<T>> &resultColl, const unsigned int nSlots)
+   TakeHelper(const std::shared_ptr<std::vector<T>> &resultColl, const unsigned int nSlots,
+              ULong64_t nValuesBound = 0)
+      : fNValuesBound(nValuesBound), fBlockSize(nSlots == 1 ? nValuesBound : 4096),
+        fNextFree(new std::atomic<ULong64_t>(0ull)), fBlocks(nSlots), fOverflows(nSlots)
    {
       fColls.emplace_back(resultColl);
       for (unsigned int i = 1; i < nSlots; ++i) {
@@ -579,13 +754,37 @@ public:
 
    void InitTask(TTreeReader *, unsigned int) {}
 
-   void Exec(unsigned int slot, T &v) { FillColl(v, *fColls[slot]); }
+   void Exec(unsigned int slot, T &v)
+   {
+      if (!fPreallocated) {
+         FillColl(v, *fColls[slot]);
+      } else if (auto block = GetFreeBlock(slot)) {
+         (*fColls[0])[block->fFilled++] = v;
+      } else {
+         fOverflows[slot].emplace_back(v);
+      }
+   }
 
-   void Initialize() { /* noop */}
+   void Initialize()
+   {
+      // vector<bool> packs its values in shared words, which the slots cannot write concurrently
+      fPreallocated = fNValuesBound > 0 && !std::is_same<T, bool>::value;
+      if (fPreallocated) {
+         fColls[0]->clear();
+         fColls[0]->resize(fNValuesBound);
+         // the per-slot vectors are not needed
+         for (unsigned int i = 1; i < fColls.size(); ++i)
+            fColls[i]->shrink_to_fit();
+      }
+   }
 
    // This is optimised to treat vectors
    void Finalize()
    {
+      if (fPreallocated) {
+         CompactBlocks();
+         return;
+      }
       ULong64_t totSize = 0;
       for (auto &coll : fColls)
          totSize += coll->size();
@@ -597,7 +796,19 @@ public:
       }
    }
 
-   std::vector<T> &PartialUpdate(unsigned int slot) { return *fColls[slot]; }
+   std::vector<T> &PartialUpdate(unsigned int slot)
+   {
+      if (!fPreallocated)
+         return *fColls[slot];
+      // the values of the slot are spread over the blocks it claimed
+      fPartialResults.resize(fBlocks.size());
+      auto &partial = fPartialResults[slot];
+      partial.clear();
+      for (const auto &block : fBlocks[slot])
+         partial.insert(partial.end(), fColls[0]->begin() + block.fBegin, fColls[0]->begin() + block.fFilled);
+      partial.insert(partial.end(), fOverflows[slot].begin(), fOverflows[slot].end());
+      return partial;
+   }
 
    std::string GetActionName() { return "Take"; }
 };
@@ -610,7 +821,7 @@ class TakeHelper<RealT_t, RVec<RealT_t>, COLL> : public RActionImpl<TakeHelper<R
 
 public:
    using ColumnTypes_t = TypeList<RVec<RealT_t>>;
-   TakeHelper(const std::shared_ptr<COLL> &resultColl, const unsigned int nSlots)
+   TakeHelper(const std::shared_ptr<COLL> &resultColl, const unsigned int nSlots, ULong64_t /*nValuesBound*/ = 0)
    {
       fColls.emplace_back(resultColl);
       for (unsigned int i = 1; i < nSlots; ++i)
@@ -649,7 +860,8 @@ class TakeHelper<RealT_t, RVec<RealT_t>, std::vector<RealT_t>>
 
 public:
    using ColumnTypes_t = TypeList<RVec<RealT_t>>;
-   TakeHelper(const std::shared_ptr<std::vector<std::vector<RealT_t>>> &resultColl, const unsigned int nSlots)
+   TakeHelper(const std::shared_ptr<std::vector<std::vector<RealT_t>>> &resultColl, const unsigned int nSlots,
+              ULong64_t /*nValuesBound*/ = 0)
    {
       fColls.emplace_back(resultColl);
       for (unsigned int i = 1; i < nSlots; ++i) {
@@ -716,6 +928,8 @@ class MinHelper : public RActionImpl<MinHelper<ResultType>> {
    Results<ResultType> fMins;
 
 public:
+   static constexpr bool kIsBulkCapable = true;
+
    MinHelper(MinHelper &&) = default;
    MinHelper(const std::shared_ptr<ResultType> &minVPtr, const unsigned int nSlots)
       : fResultMin(minVPtr), fMins(nSlots, std::numeric_limits<ResultType>::max())
@@ -729,8 +943,11 @@ public:
    template <typename T, typename std::enable_if<IsDataContainer<T>::value, int>::type = 0>
    void Exec(unsigned int slot, const T &vs)
    {
+      // Accumulate in a local variable, which the compiler can keep in a register
+      auto min = fMins[slot];
       for (auto &&v : vs)
-         fMins[slot] = std::min(v, fMins[slot]);
+         min = std::min((ResultType)v, min);
+      fMins[slot] = min;
    }
 
    void Initialize() { /* noop */}
@@ -760,6 +977,8 @@ class MaxHelper : public RActionImpl<MaxHelper<ResultType>> {
    Results<ResultType> fMaxs;
 
 public:
+   static constexpr bool kIsBulkCapable = true;
+
    MaxHelper(MaxHelper &&) = default;
    MaxHelper(const MaxHelper &) = delete;
    MaxHelper(const std::shared_ptr<ResultType> &maxVPtr, const unsigned int nSlots)
@@ -773,8 +992,10 @@ public:
    template <typename T, typename std::enable_if<IsDataContainer<T>::value, int>::type = 0>
    void Exec(unsigned int slot, const T &vs)
    {
+      auto max = fMaxs[slot];
       for (auto &&v : vs)
-         fMaxs[slot] = std::max((ResultType)v, fMaxs[slot]);
+         max = std::max((ResultType)v, max);
+      fMaxs[slot] = max;
    }
 
    void Initialize() { /* noop */}
@@ -820,6 +1041,8 @@ class SumHelper : public RActionImpl<SumHelper<ResultType>> {
    }
 
 public:
+   static constexpr bool kIsBulkCapable = true;
+
    SumHelper(SumHelper &&) = default;
    SumHelper(const SumHelper &) = delete;
    SumHelper(const std::shared_ptr<ResultType> &sumVPtr, const unsigned int nSlots)
@@ -833,8 +1056,10 @@ public:
    template <typename T, typename std::enable_if<IsDataContainer<T>::value, int>::type = 0>
    void Exec(unsigned int slot, const T &vs)
    {
+      auto sum = fSums[slot];
       for (auto &&v : vs)
-         fSums[slot] += static_cast<ResultType>(v);
+         sum += static_cast<ResultType>(v);
+      fSums[slot] = sum;
    }
 
    void Initialize() { /* noop */}
@@ -857,6 +1082,8 @@ class MeanHelper : public RActionImpl<MeanHelper> {
    std::vector<double> fPartialMeans;
 
 public:
+   static constexpr bool kIsBulkCapable = true;
+
    MeanHelper(const std::shared_ptr<double> &meanVPtr, const unsigned int nSlots);
    MeanHelper(MeanHelper &&) = default;
    MeanHelper(const MeanHelper &) = delete;
@@ -899,6 +1126,8 @@ class StdDevHelper : public RActionImpl<StdDevHelper> {
    std::vector<double> fDistancesfromMean;
 
 public:
+   static constexpr bool kIsBulkCapable = true;
+
    StdDevHelper(const std::shared_ptr<double> &meanVPtr, const unsigned int nSlots);
    StdDevHelper(StdDevHelper &&) = default;
    StdDevHelper(const StdDevHelper &) = delete;
@@ -1394,6 +1623,11 @@ public:
    {
       const auto cs = ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel);
       fMerger = std::make_unique<ROOT::Experimental::TBufferMerger>(fFileName.c_str(), fOptions.fMode.c_str(), cs);
+      if (fOptions.fOutputQueueDepth > 0) {
+         // the slots compress the baskets with the settings of the output file: the writing thread only copies them
+         fMerger->SetMergeOptions("fast");
+         fMerger->StartMergingThread(fOptions.fOutputQueueDepth);
+      }
    }
 
    void Finalize()
@@ -1419,6 +1653,97 @@ public:
    std::string GetActionName() { return "Snapshot"; }
 };
 
+#ifdef R__HAS_ROOT7
+/// Helper object for a Snapshot action that writes an RNTuple instead of a TTree. Both in single-thread and in
+/// multi-thread event loops, the ntuple is written through an RNTupleParallelWriter with one fill context per slot.
+/// The fill contexts compress their clusters independently, so no merge step like in TBufferMerger is needed.
+template <typename... BranchTypes>
+class SnapshotHelperRNTuple : public RActionImpl<SnapshotHelperRNTuple<BranchTypes...>> {
+   using ValueAddresses_t = std::array<void *, sizeof...(BranchTypes)>;
+
+   const unsigned int fNSlots;
+   const std::string fFileName;   // name of the output file name
+   const std::string fNTupleName; // name of the output ntuple
+   const RSnapshotOptions fOptions;
+   const ColumnNames_t fOutputFieldNames;
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   // Created at the first task of every slot; must be destructed before fWriter
+   std::vector<std::unique_ptr<ROOT::Experimental::RNTupleWriter>> fFillContexts;
+   // Per-slot entries whose values point directly to the column values, such that no copies are made
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
+   // The addresses of the column values captured by fEntries
+   std::vector<ValueAddresses_t> fValueAddresses;
+
+   template <std::size_t... S>
+   void MakeFields(ROOT::Experimental::RNTupleModel &model, std::index_sequence<S...> /*dummy*/)
+   {
+      int expander[] = {(model.MakeField<BranchTypes>(fOutputFieldNames[S]), 0)..., 0};
+      (void)expander; // avoid unused variable warnings for older compilers such as gcc 4.9
+   }
+
+public:
+   using ColumnTypes_t = TypeList<BranchTypes...>;
+   SnapshotHelperRNTuple(const unsigned int nSlots, std::string_view filename, std::string_view ntuplename,
+                         const ColumnNames_t &bnames, const RSnapshotOptions &options)
+      : fNSlots(nSlots), fFileName(filename), fNTupleName(ntuplename), fOptions(options),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames)), fFillContexts(fNSlots), fEntries(fNSlots),
+        fValueAddresses(fNSlots)
+   {
+      TString mode = fOptions.fMode;
+      mode.ToLower();
+      if (mode != "recreate")
+         throw std::invalid_argument("Snapshot: RNTuple output can only be written in RECREATE mode");
+   }
+   SnapshotHelperRNTuple(const SnapshotHelperRNTuple &) = delete;
+   SnapshotHelperRNTuple(SnapshotHelperRNTuple &&) = default;
+
+   void InitTask(TTreeReader * /* r */, unsigned int slot)
+   {
+      if (!fFillContexts[slot])
+         fFillContexts[slot] = fWriter->CreateFillContext();
+   }
+
+   void Exec(unsigned int slot, BranchTypes &... values)
+   {
+      ValueAddresses_t addresses{{&values...}};
+      if (!fEntries[slot] || (addresses != fValueAddresses[slot])) {
+         // The addresses of the column values can change, e.g. when the input file changes
+         auto entry = std::make_unique<ROOT::Experimental::REntry>();
+         std::size_t i = 0;
+         for (auto &value : *fFillContexts[slot]->GetModel()->GetDefaultEntry())
+            entry->CaptureValue(value.GetField()->CaptureValue(addresses[i++]));
+         fEntries[slot] = std::move(entry);
+         fValueAddresses[slot] = addresses;
+      }
+      fFillContexts[slot]->Fill(fEntries[slot].get());
+   }
+
+   void Initialize()
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      MakeFields(*model, std::index_sequence_for<BranchTypes...>());
+      ROOT::Experimental::RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel));
+      fWriter = ROOT::Experimental::RNTupleParallelWriter::Recreate(std::move(model), fNTupleName, fFileName,
+                                                                    writeOptions);
+   }
+
+   void Finalize()
+   {
+      if (!fWriter) {
+         Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+         return;
+      }
+      // destructing the fill contexts commits their last clusters
+      fEntries.clear();
+      fFillContexts.clear();
+      fWriter.reset();
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+#endif // R__HAS_ROOT7
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class AggregateHelper : public RActionImpl<AggregateHelper<Acc, Merge, R, T, U, MustCopyAssign>> {
@@ -82,6 +82,14 @@ public:
    /// \brief Gets the column defined up to the node
    std::vector<std::string> GetDefinedColumns() { return fDefinedColumns; }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Appends the profile of the node, if any, to its label
+   void AddProfile(const std::string &profile)
+   {
+      if (!profile.empty())
+         fName += "\n" + profile;
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Manually sets the counter to a node.
    /// It is used by the root node to set its counter to zero.
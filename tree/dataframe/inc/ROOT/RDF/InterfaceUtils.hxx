@@ -75,6 +75,37 @@ HeadNode_t CreateSnapshotRDF(const ColumnNames_t &validCols,
                             RLoopManager &loopManager,
                             std::unique_ptr<RDFInternal::RActionBase> actionPtr);
 
+/// Declare the queued lambdas of jitted Filters and Defines in a single interpreter transaction.
+/// Only has an effect if ROOT::RDF::EnableJitDeclarationBatching() is active.
+void JitPendingDeclarations();
+
+/// Name of the tree in the files written by PersistentCache()
+constexpr const char *kPersistentCacheTreeName = "rdfcache";
+/// Returns the path of the PersistentCache() file for the given columns of the data set processed by the loop manager.
+/// The expressions of the jitted Filters upstream of node and of the jitted Defines in customColumns are part of the
+/// hash that identifies the file.
+std::string GetPersistentCachePath(RLoopManager &loopManager, RNodeBase &node,
+                                   const RBookedCustomColumns &customColumns, const ColumnNames_t &columnNames,
+                                   const std::vector<std::string> &columnTypes, std::string_view key,
+                                   std::string_view cacheDir);
+bool IsPersistentCacheAvailable(const std::string &path);
+/// A file name next to the cache file that is unique for this process; the cache is written there first
+std::string GetPersistentCacheTmpPath(const std::string &path);
+/// Atomically moves the newly written cache file into place
+void CommitPersistentCache(const std::string &tmpPath, const std::string &path);
+RInterface<RLoopManager, void> OpenPersistentCache(const std::string &path);
+
+#ifdef R__HAS_ROOT7
+/// Like CreateSnapshotRDF() but the returned RDataFrame reads the ntuple written by an RNTuple Snapshot.  The ntuple
+/// is opened only when the returned RDataFrame is first used, i.e. after the Snapshot event loop.
+HeadNode_t CreateSnapshotRNTupleRDF(const ColumnNames_t &validCols,
+                                   std::string_view ntupleName,
+                                   std::string_view fileName,
+                                   bool isLazy,
+                                   RLoopManager &loopManager,
+                                   std::unique_ptr<RDFInternal::RActionBase> actionPtr);
+#endif
+
 std::string DemangleTypeIdName(const std::type_info &typeInfo);
 
 ColumnNames_t ConvertRegexToColumns(const RDFInternal::RBookedCustomColumns &customColumns, TTree *tree,
@@ -426,6 +457,19 @@ void JitDefineHelper(F &&f, const ColumnNames_t &cols, std::string_view name, RL
    delete wkJittedCustomCol;
 }
 
+/// Returns a factory of actions like the one built by BuildAction with the same arguments, but filling another result.
+/// Used to book the actions of the systematic variations, see ROOT::RDF::Experimental::VariationsFor().
+template <typename ActionTag, typename ActionResultType, typename... BranchTypes, typename PrevNodeType>
+RActionBase::VariedActionFactory_t
+MakeVariedActionFactory(const ColumnNames_t &bl, const unsigned int nSlots,
+                        const std::shared_ptr<PrevNodeType> &prevNode, const RBookedCustomColumns &customColumns)
+{
+   return [bl, nSlots, prevNode, customColumns](const std::shared_ptr<void> &result) {
+      return BuildAction<BranchTypes...>(bl, std::static_pointer_cast<ActionResultType>(result), nSlots, prevNode,
+                                         ActionTag{}, RBookedCustomColumns(customColumns));
+   };
+}
+
 /// Convenience function invoked by jitted code to build action nodes at runtime
 template <typename ActionTag, typename... BranchTypes, typename PrevNodeType, typename ActionResultType>
 void CallBuildAction(std::shared_ptr<PrevNodeType> *prevNodeOnHeap, const ColumnNames_t &bl, const unsigned int nSlots,
@@ -455,8 +499,11 @@ void CallBuildAction(std::shared_ptr<PrevNodeType> *prevNodeOnHeap, const Column
                                                     std::make_index_sequence<nColumns>(), ColTypes_t())
                         : *customColumns;
 
+   auto variedActionFactory =
+      MakeVariedActionFactory<ActionTag, ActionResultType, BranchTypes...>(bl, nSlots, prevNodePtr, newColumns);
    auto actionPtr = BuildAction<BranchTypes...>(bl, std::move(rOnHeap), nSlots, std::move(prevNodePtr), ActionTag{},
                                                 std::move(newColumns));
+   actionPtr->SetVariedActionFactory(std::move(variedActionFactory));
    jittedActionOnHeap->SetAction(std::move(actionPtr));
 
    // customColumns points to the columns structure in the heap, created before the jitted call so that the jitter can
@@ -17,10 +17,13 @@
 #include "ROOT/RDF/Utils.hxx"      // ColumnNames_t
 #include "ROOT/RDF/RColumnValue.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RVec.hxx"
 
 #include <cstddef> // std::size_t
 #include <memory>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace ROOT {
@@ -92,6 +95,40 @@ void ResetRDFValueTuple(std::vector<RTypeErasedColumnValue> &values, std::index_
    (void)expander{(values[S].Cast<ColTypes>()->Reset(), 0)...};
 }
 
+/// Helpers set a static `kIsBulkCapable` member to true if calling Exec with collections of values has the same effect
+/// as calling it once for each (tuple of) element(s). Their actions can then run in bulk mode, see
+/// ROOT::RDF::SetBulkSize().
+template <typename Helper, typename = void>
+struct IsBulkCapableHelper : std::false_type {
+};
+
+template <typename Helper>
+struct IsBulkCapableHelper<Helper, decltype(void(Helper::kIsBulkCapable))>
+   : std::integral_constant<bool, Helper::kIsBulkCapable> {
+};
+
+/// Values of arithmetic type (but not bool) can be collected in blocks
+template <typename... ColTypes>
+struct AreBulkColumnTypes : std::true_type {
+};
+
+template <typename ColType, typename... ColTypes>
+struct AreBulkColumnTypes<ColType, ColTypes...>
+   : std::integral_constant<bool, std::is_arithmetic<ColType>::value && !std::is_same<ColType, bool>::value &&
+                                     AreBulkColumnTypes<ColTypes...>::value> {
+};
+
+template <typename ColumnTypes_t>
+struct RBulkValues;
+
+/// The blocks of column values of an action running in bulk mode
+template <typename... ColTypes>
+struct RBulkValues<ROOT::TypeTraits::TypeList<ColTypes...>> {
+   static constexpr bool kIsBulkable = (sizeof...(ColTypes) > 0) && AreBulkColumnTypes<ColTypes...>::value;
+   using Tuple_t = typename std::conditional<kIsBulkable, std::tuple<ROOT::VecOps::RVec<ColTypes>...>,
+                                             std::tuple<>>::type;
+};
+
 // fwd decl for RActionCRTP
 template <typename Helper, typename PrevDataFrame, typename ColumnTypes_t>
 class RAction;
@@ -145,14 +182,27 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevData.CheckFilters(slot, entry))
+      if (fPrevData.CheckFilters(slot, entry)) {
+         RNodeProfile::RScope profile(fProfile, slot);
          static_cast<Action_t *>(this)->Exec(slot, entry, TypeInd_t());
+      }
    }
 
    void TriggerChildrenCount() final { fPrevData.IncrChildrenCount(); }
 
+   bool DependsOn(const std::string &variation) const final
+   {
+      return GetCustomColumns().DependsOn(GetColumnNames(), variation) || fPrevData.DependsOn(variation);
+   }
+
+   void AddVariedFilters(const std::string &variation, std::vector<RFilterBase *> &filters) final
+   {
+      fPrevData.AddVariedFilters(variation, filters);
+   }
+
    void FinalizeSlot(unsigned int slot) final
    {
+      static_cast<Action_t *>(this)->FlushBulk(slot);
       ClearValueReaders(slot);
       for (auto &column : GetCustomColumns().GetColumns()) {
          column.second->ClearValueReaders(slot);
@@ -168,6 +218,8 @@ public:
       SetHasRun();
    }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       auto prevNode = fPrevData.GetGraph();
@@ -191,13 +243,18 @@ public:
 
       thisNode->AddDefinedColumns(GetCustomColumns().GetNames());
       thisNode->SetAction(HasRun());
+      thisNode->AddProfile(fProfile.GetSummary());
       evaluatedNode->SetPrevNode(prevNode);
       return thisNode;
    }
 
    /// This method is invoked to update a partial result during the event loop, right before passing the result to a
    /// user-defined callback registered via RResultPtr::RegisterCallback
-   void *PartialUpdate(unsigned int slot) final { return PartialUpdateImpl(slot); }
+   void *PartialUpdate(unsigned int slot) final
+   {
+      static_cast<Action_t *>(this)->FlushBulk(slot);
+      return PartialUpdateImpl(slot);
+   }
 
 private:
    // this overload is SFINAE'd out if Helper does not implement `PartialUpdate`
@@ -215,14 +272,65 @@ private:
 /// An action node in a RDF computation graph.
 template <typename Helper, typename PrevDataFrame, typename ColumnTypes_t = typename Helper::ColumnTypes_t>
 class RAction final : public RActionCRTP<RAction<Helper, PrevDataFrame, ColumnTypes_t>> {
+   using BulkValues_t = RBulkValues<ColumnTypes_t>;
+   /// Whether the helper can process blocks of column values, see ROOT::RDF::SetBulkSize()
+   static constexpr bool kCanRunBulk = IsBulkCapableHelper<Helper>::value && BulkValues_t::kIsBulkable;
+   using CanRunBulk_t = std::integral_constant<bool, kCanRunBulk>;
+
    std::vector<RDFValueTuple_t<ColumnTypes_t>> fValues;
+   /// The number of entries whose values are collected before the helper processes them; 0 runs entry by entry
+   const unsigned int fBulkSize;
+   /// Per slot, the values of the entries that passed the filters but have not yet been passed to the helper
+   std::vector<typename BulkValues_t::Tuple_t> fBulkValues;
+
+   template <std::size_t... S>
+   void ExecImpl(unsigned int slot, Long64_t entry, std::index_sequence<S...>, std::false_type)
+   {
+      (void)entry; // avoid bogus 'unused parameter' warning in gcc4.9
+      ActionCRTP_t::GetHelper().Exec(slot, std::get<S>(fValues[slot]).Get(entry)...);
+   }
+
+   template <std::size_t... S>
+   void ExecImpl(unsigned int slot, Long64_t entry, std::index_sequence<S...> s, std::true_type)
+   {
+      if (fBulkSize == 0) {
+         ExecImpl(slot, entry, s, std::false_type());
+         return;
+      }
+      auto &bulkValues = fBulkValues[slot];
+      using expander = int[];
+      (void)expander{(std::get<S>(bulkValues).emplace_back(std::get<S>(fValues[slot]).Get(entry)), 0)...};
+      if (std::get<0>(bulkValues).size() >= fBulkSize)
+         FlushBulkImpl(slot, s, std::true_type());
+   }
+
+   template <std::size_t... S>
+   void FlushBulkImpl(unsigned int, std::index_sequence<S...>, std::false_type)
+   {
+   }
+
+   template <std::size_t... S>
+   void FlushBulkImpl(unsigned int slot, std::index_sequence<S...>, std::true_type)
+   {
+      if (fBulkValues.empty())
+         return;
+      auto &bulkValues = fBulkValues[slot];
+      if (std::get<0>(bulkValues).empty())
+         return;
+      ActionCRTP_t::GetHelper().Exec(slot, std::get<S>(bulkValues)...);
+      using expander = int[];
+      (void)expander{(std::get<S>(bulkValues).clear(), 0)...};
+   }
 
 public:
    using ActionCRTP_t = RActionCRTP<RAction<Helper, PrevDataFrame, ColumnTypes_t>>;
 
    RAction(Helper &&h, const ColumnNames_t &bl, std::shared_ptr<PrevDataFrame> pd,
            RBookedCustomColumns &&customColumns)
-      : ActionCRTP_t(std::forward<Helper>(h), bl, std::move(pd), std::move(customColumns)), fValues(GetNSlots()) { }
+      : ActionCRTP_t(std::forward<Helper>(h), bl, std::move(pd), std::move(customColumns)), fValues(GetNSlots()),
+        fBulkSize(kCanRunBulk ? GetBulkSizeRef() : 0), fBulkValues(fBulkSize > 0 ? GetNSlots() : 0)
+   {
+   }
 
    void InitColumnValues(TTreeReader *r, unsigned int slot)
    {
@@ -231,12 +339,14 @@ public:
    }
 
    template <std::size_t... S>
-   void Exec(unsigned int slot, Long64_t entry, std::index_sequence<S...>)
+   void Exec(unsigned int slot, Long64_t entry, std::index_sequence<S...> s)
    {
-      (void)entry; // avoid bogus 'unused parameter' warning in gcc4.9
-      ActionCRTP_t::GetHelper().Exec(slot, std::get<S>(fValues[slot]).Get(entry)...);
+      ExecImpl(slot, entry, s, CanRunBulk_t());
    }
 
+   /// Pass the collected values of the slot to the helper; no-op if the action does not run in bulk mode
+   void FlushBulk(unsigned int slot) { FlushBulkImpl(slot, typename ActionCRTP_t::TypeInd_t{}, CanRunBulk_t()); }
+
    template <std::size_t... S>
    void ResetColumnValues(unsigned int slot, std::index_sequence<S...> s)
    {
@@ -288,6 +398,8 @@ public:
       ActionCRTP_t::GetHelper().Exec(slot, fValues[slot][S].template Get<ColTypes>(entry)...);
    }
 
+   void FlushBulk(unsigned int) {}
+
    template <std::size_t... S>
    void ResetColumnValues(unsigned int slot, std::index_sequence<S...> s)
    {
@@ -328,6 +440,8 @@ public:
       ActionCRTP_t::GetHelper().Exec(slot, fValues[slot][S].template Get<ColTypes>(entry)...);
    }
 
+   void FlushBulk(unsigned int) {}
+
    template <std::size_t... S>
    void ResetColumnValues(unsigned int slot, std::index_sequence<S...> s)
    {
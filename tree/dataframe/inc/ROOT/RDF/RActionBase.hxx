@@ -12,11 +12,14 @@
 #define ROOT_RACTIONBASE
 
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -24,6 +27,7 @@ namespace Detail {
 namespace RDF {
 class RLoopManager;
 class RCustomColumnBase;
+class RFilterBase;
 }
 }
 
@@ -42,10 +46,16 @@ bool CheckIfDefaultOrDSColumn(const std::string &name,
 } // namespace GraphDrawing
 
 class RActionBase {
+public:
+   /// Creates an action of the same kind, on the same node and columns, that fills the given result instead.
+   /// Used to book the actions of the systematic variations, see ROOT::RDF::Experimental::VariationsFor().
+   using VariedActionFactory_t = std::function<std::unique_ptr<RActionBase>(const std::shared_ptr<void> &)>;
+
 protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
    RLoopManager *fLoopManager;
+   RNodeProfile fProfile; ///< Time spent in the action, if profiling is enabled
 
 private:
    const unsigned int fNSlots; ///< Number of thread slots used by this node.
@@ -54,6 +64,10 @@ private:
 
    RBookedCustomColumns fCustomColumns;
 
+   VariedActionFactory_t fVariedActionFactory;
+   /// The id of the systematic variation that this action processes, 0 for the nominal
+   unsigned int fVariation = 0;
+
 public:
    RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, RBookedCustomColumns &&customColumns);
    RActionBase(const RActionBase &) = delete;
@@ -62,6 +76,7 @@ public:
 
    const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
    RBookedCustomColumns &GetCustomColumns() { return fCustomColumns; }
+   const RBookedCustomColumns &GetCustomColumns() const { return fCustomColumns; }
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
@@ -80,6 +95,23 @@ public:
    virtual void SetHasRun() { fHasRun = true; }
 
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> GetGraph() = 0;
+
+   /// Whether the result of this action depends on the given systematic variation, see RInterface::Vary()
+   virtual bool DependsOn(const std::string &variation) const = 0;
+   /// Append to filters the upstream filters whose results depend on the given variation
+   virtual void AddVariedFilters(const std::string &variation, std::vector<RFilterBase *> &filters) = 0;
+
+   // overridden by RJittedAction
+   virtual void SetVariedActionFactory(VariedActionFactory_t factory) { fVariedActionFactory = std::move(factory); }
+   virtual const VariedActionFactory_t &GetVariedActionFactory() const { return fVariedActionFactory; }
+
+   unsigned int GetVariation() const { return fVariation; }
+   void SetVariation(unsigned int variation) { fVariation = variation; }
+
+   virtual std::string GetActionName() = 0;
+   // overridden by RJittedAction
+   virtual void SetProfiler(RProfiler *profiler) { fProfile.SetProfiler(profiler, fNSlots); }
+   virtual const RNodeProfile &GetProfile() const { return fProfile; }
 };
 
 } // ns RDF
@@ -95,6 +95,10 @@ public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Internally it recreates the map with the new column name, and swaps with the old one.
    void AddName(std::string_view name);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Check if any of the custom columns among the provided names depends on the given systematic variation
+   bool DependsOn(const ColumnNames_t &names, const std::string &variation) const;
 };
 
 } // Namespace RDF
@@ -123,8 +123,11 @@ public:
    {
       if (entry != fLastCheckedEntry[slot]) {
          // evaluate this filter, cache the result
+         RDFInternal::RNodeProfile::RScope profile(fProfile, slot);
          UpdateHelper(slot, entry, TypeInd_t(), ExtraArgsTag{});
          fLastCheckedEntry[slot] = entry;
+      } else {
+         fProfile.CountCacheHit(slot);
       }
    }
 
@@ -140,6 +143,8 @@ public:
          fIsInitialized[slot] = false;
       }
    }
+
+   bool DependsOn(const std::string &variation) const final { return fCustomColumns.DependsOn(fColumnNames, variation); }
 };
 
 } // ns RDF
@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 
 #include <memory>
 #include <string>
@@ -41,6 +42,7 @@ protected:
    const unsigned int fID = GetNextID();
    RDFInternal::RBookedCustomColumns fCustomColumns;
    std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
+   RDFInternal::RNodeProfile fProfile; ///< Time spent evaluating the column, if profiling is enabled
 
    static unsigned int GetNextID();
 
@@ -61,6 +63,13 @@ public:
    bool IsDataSourceColumn() const { return fIsDataSourceColumn; }
    /// Return the unique identifier of this RCustomColumnBase.
    unsigned int GetID() const { return fID; }
+   /// Whether the values of this column depend on the given systematic variation, see RInterface::Vary()
+   virtual bool DependsOn(const std::string & /*variation*/) const { return false; }
+   /// Forget the cached value of the slot, e.g. to re-evaluate the column for a systematic variation
+   virtual void ResetCache(unsigned int slot) { fLastCheckedEntry[slot] = -1; }
+   // overridden by RJittedCustomColumn
+   virtual void SetProfiler(RDFInternal::RProfiler *profiler) { fProfile.SetProfiler(profiler, fNSlots); }
+   virtual const RDFInternal::RNodeProfile &GetProfile() const { return fProfile; }
 };
 
 } // ns RDF
@@ -89,11 +89,14 @@ public:
             fLastResult[slot] = false;
          } else {
             // evaluate this filter, cache the result
+            RDFInternal::RNodeProfile::RScope profile(fProfile, slot);
             auto passed = CheckFilterHelper(slot, entry, TypeInd_t());
             passed ? ++fAccepted[slot] : ++fRejected[slot];
             fLastResult[slot] = passed;
          }
          fLastCheckedEntry[slot] = entry;
+      } else {
+         fProfile.CountCacheHit(slot);
       }
       return fLastResult[slot];
    }
@@ -149,6 +152,18 @@ public:
       RDFInternal::ResetRDFValueTuple(fValues[slot], TypeInd_t());
    }
 
+   bool DependsOn(const std::string &variation) const final
+   {
+      return fCustomColumns.DependsOn(fColumnNames, variation) || fPrevData.DependsOn(variation);
+   }
+
+   void AddVariedFilters(const std::string &variation, std::vector<RFilterBase *> &filters) final
+   {
+      if (DependsOn(variation))
+         filters.emplace_back(this);
+      fPrevData.AddVariedFilters(variation, filters);
+   }
+
    void AddFilterName(std::vector<std::string> &filters)
    {
       fPrevData.AddFilterName(filters);
@@ -156,6 +171,11 @@ public:
       filters.push_back(name);
    }
 
+   void AddFilterExpressions(std::vector<std::string> &expressions) final
+   {
+      fPrevData.AddFilterExpressions(expressions);
+   }
+
    virtual void ClearTask(unsigned int slot) final
    {
       for (auto &column : fCustomColumns.GetColumns()) {
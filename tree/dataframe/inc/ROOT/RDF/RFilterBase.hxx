@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "RtypesCore.h"
 #include "TError.h" // R_ASSERT
 
@@ -34,6 +35,16 @@ namespace RDFInternal = ROOT::Internal::RDF;
 class RLoopManager;
 
 class RFilterBase : public RNodeBase {
+   /// The state of a slot of the filter for the nominal values, saved while the filter is re-evaluated for the
+   /// systematic variations
+   struct RNominalState {
+      Long64_t fLastCheckedEntry = -1;
+      int fLastResult = true;
+      ULong64_t fAccepted = 0;
+      ULong64_t fRejected = 0;
+   };
+   std::vector<RNominalState> fNominalStates;
+
 protected:
    std::vector<Long64_t> fLastCheckedEntry;
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
@@ -43,6 +54,7 @@ protected:
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
 
    RDFInternal::RBookedCustomColumns fCustomColumns;
+   RDFInternal::RNodeProfile fProfile; ///< Time spent evaluating the filter, if profiling is enabled
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -54,6 +66,9 @@ public:
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    bool HasName() const;
    std::string GetName() const;
+   /// Whether the filter is evaluated during the event loop, i.e. it is named or it has active nodes downstream.
+   /// Only valid after RLoopManager::EvalChildrenCounts().
+   virtual bool IsActive() const { return fNChildren > 0 || HasName(); }
    virtual void FillReport(ROOT::RDF::RCutFlowReport &) const;
    virtual void TriggerChildrenCount() = 0;
    virtual void ResetReportCount()
@@ -67,6 +82,13 @@ public:
    virtual void ClearTask(unsigned int slot) = 0;
    virtual void InitNode();
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
+   /// Forget the cached result of the slot, e.g. to re-evaluate the filter for a systematic variation
+   virtual void ResetCache(unsigned int slot) { fLastCheckedEntry[slot] = -1; }
+   virtual void SaveNominalState(unsigned int slot);
+   virtual void RestoreNominalState(unsigned int slot);
+   // overridden by RJittedFilter
+   virtual void SetProfiler(RDFInternal::RProfiler *profiler) { fProfile.SetProfiler(profiler, fNSlots); }
+   virtual const RDFInternal::RNodeProfile &GetProfile() const { return fProfile; }
 };
 
 } // ns RDF
@@ -17,9 +17,11 @@
 #include "ROOT/RDF/HistoModels.hxx"
 #include "ROOT/RDF/InterfaceUtils.hxx"
 #include "ROOT/RDF/RRange.hxx"
+#include "ROOT/RDF/RVariedColumn.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/RDF/RLazyDSImpl.hxx"
+#include "ROOT/RResultMap.hxx"
 #include "ROOT/RResultPtr.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
 #include "ROOT/RStringView.hxx"
@@ -251,7 +253,7 @@ public:
       auto upcastNodeOnHeap = RDFInternal::MakeSharedOnHeap(RDFInternal::UpcastNode(fProxiedPtr));
       using BaseNodeType_t = typename std::remove_pointer<decltype(upcastNodeOnHeap)>::type::element_type;
       RInterface<BaseNodeType_t> upcastInterface(*upcastNodeOnHeap, *fLoopManager, fCustomColumns, fDataSource);
-      const auto jittedFilter = std::make_shared<RDFDetail::RJittedFilter>(fLoopManager, name);
+      const auto jittedFilter = std::make_shared<RDFDetail::RJittedFilter>(fLoopManager, name, expression);
 
       RDFInternal::BookFilterJit(jittedFilter, upcastNodeOnHeap, name, expression, fLoopManager->GetAliasMap(),
                                  fLoopManager->GetBranchNames(), fCustomColumns, fLoopManager->GetTree(), fDataSource);
@@ -387,6 +389,88 @@ public:
       return newInterface;
    }
 
+   // clang-format off
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations of an existing column
+   /// \param[in] colName Name of the column to vary.
+   /// \param[in] expression Function, lambda expression, functor class or any other callable object returning an RVec
+   /// with the values of the column for all the variations, in the order of variationTags.
+   /// \param[in] columns Names of the columns passed to the expression.
+   /// \param[in] variationTags Names of the variations, e.g. `{"down", "up"}`.
+   /// \param[in] variationName Name of the systematic variation. If empty, the name of the column is used.
+   /// \return the first node of the computation graph for which the variations are available.
+   ///
+   /// Downstream of this node, the column keeps its nominal value. The results of the actions booked downstream can
+   /// additionally be computed for each variation with ROOT::RDF::Experimental::VariationsFor(). All variations are
+   /// processed in the same event loop as the nominal: for each entry and variation, only the Defines and the Filters
+   /// that depend on the varied column are re-evaluated, all other nodes are evaluated once.
+   ///
+   /// Several columns can be varied, each with its own variation name; the variations are applied one at a time, not
+   /// combined. Range() is not supported downstream of a varied column.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto scale = [](double pt) { return ROOT::VecOps::RVec<double>{0.9 * pt, 1.1 * pt}; };
+   /// auto h = df.Vary("pt", scale, {"pt"}, {"down", "up"}).Filter("pt > 10").Histo1D<double>("pt");
+   /// auto hs = ROOT::RDF::Experimental::VariationsFor(h);
+   /// hs["nominal"].Draw();
+   /// hs["pt:up"].Draw("SAME");
+   /// ~~~
+   // clang-format on
+   template <typename F, typename std::enable_if<!std::is_convertible<F, std::string>::value, int>::type = 0>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F &&expression, const ColumnNames_t &columns,
+                                  const std::vector<std::string> &variationTags, std::string_view variationName = "")
+   {
+      using F_t = typename std::decay<F>::type;
+      using RetType_t = typename TTraits::CallableTraits<F_t>::ret_type;
+      static_assert(RDFInternal::IsRVec_t<RetType_t>::value,
+                    "Error in `Vary`: the expression must return an RVec with the values of all the variations");
+      using T = typename RetType_t::value_type;
+      using ColTypes_t = typename TTraits::CallableTraits<F_t>::arg_types;
+      constexpr auto nColumns = ColTypes_t::list_size;
+
+      if (variationTags.empty())
+         throw std::invalid_argument("Vary: at least one variation tag is required");
+
+      const auto validVariedName = GetValidatedColumnNames(1, {std::string(colName)});
+      const auto validColumnNames = GetValidatedColumnNames(nColumns, columns);
+      const auto nSlots = fLoopManager->GetNSlots();
+
+      // The nominal values and the inputs of the expression are read from the columns available so far
+      auto inputColumns =
+         CheckAndFillDSColumns(validVariedName, std::make_index_sequence<1>(), TTraits::TypeList<T>());
+      if (fDataSource) {
+         inputColumns = RDFInternal::AddDSColumns(validColumnNames, inputColumns, *fDataSource, nSlots,
+                                                  std::make_index_sequence<nColumns>(), ColTypes_t());
+      }
+
+      const auto &variedName = validVariedName[0];
+      const auto typeName = RDFInternal::TypeID2TypeName(typeid(T));
+      auto identity = [](T x) { return x; };
+      using Nominal_t = RDFDetail::RCustomColumn<decltype(identity)>;
+      auto nominal =
+         std::make_shared<Nominal_t>(variedName, typeName, std::move(identity), validVariedName, nSlots, inputColumns);
+      using Variations_t = RDFDetail::RCustomColumn<F_t>;
+      auto variations =
+         std::make_shared<Variations_t>(variedName, RDFInternal::TypeID2TypeName(typeid(RetType_t)),
+                                        std::forward<F>(expression), validColumnNames, nSlots, inputColumns);
+
+      const std::string name = variationName.empty() ? variedName : std::string(variationName);
+      const auto firstVariation = fLoopManager->RegisterVariation(name, variationTags);
+      auto variedColumn = std::make_shared<RDFDetail::RVariedColumn<T>>(
+         variedName, typeName, *fLoopManager, name, firstVariation, variationTags.size(), std::move(nominal),
+         std::move(variations), inputColumns);
+
+      RDFInternal::RBookedCustomColumns newCols(inputColumns);
+      if (!newCols.HasName(variedName))
+         newCols.AddName(variedName);
+      newCols.AddColumn(variedColumn, variedName);
+
+      RInterface<Proxied, DS_t> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols), fDataSource);
+
+      return newInterface;
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Allow to refer to a column with a different name
    /// \param[in] alias name of the column alias
@@ -670,6 +754,69 @@ public:
       return Cache(selectedColumns);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in a file that is reused by later runs of the same analysis
+   /// \tparam ColumnTypes variadic list of branch/column types.
+   /// \param[in] columnList columns to be cached on disk.
+   /// \param[in] key A string that identifies the computation of the cached columns, e.g. "selection-v2".
+   /// \param[in] cacheDir The directory of the cache file. By default, the directory of the (first) input file.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// Like `Cache`, this action returns a new `RDataFrame` object that is detached from the originating `RDataFrame`.
+   /// The cached columns are stored in a ROOT file, though, such that the (expensive) `Filter`s and `Define`s that
+   /// produce them need to run only once. The file name is derived from a hash of the key, of the names and types of
+   /// the cached columns, of the expressions of the jitted `Filter`s and `Define`s and of the identity of the input
+   /// data set (tree name or data source label, names, sizes and modification times of the input files). If the file
+   /// exists, no event loop is run and the returned `RDataFrame` reads from it. Otherwise, the columns are
+   /// snapshotted into the cache file first.
+   ///
+   /// Compiled callables cannot be hashed, so the key needs to change whenever the code of the `Filter`s and
+   /// `Define`s that are not jitted changes. The same holds for data sources that do not report their input files.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto cached_df = df.Filter(expensiveCut).Define("x", expensiveFn).PersistentCache<double>({"x"}, "cuts-v1");
+   /// ~~~
+   template <typename... ColumnTypes>
+   RInterface<RLoopManager>
+   PersistentCache(const ColumnNames_t &columnList, std::string_view key, std::string_view cacheDir = "")
+   {
+      const std::vector<std::string> columnTypes{RDFInternal::TypeID2TypeName(typeid(ColumnTypes))...};
+      const auto path = RDFInternal::GetPersistentCachePath(*fLoopManager, *fProxiedPtr, fCustomColumns, columnList,
+                                                            columnTypes, key, cacheDir);
+      if (!RDFInternal::IsPersistentCacheAvailable(path)) {
+         const auto tmpPath = RDFInternal::GetPersistentCacheTmpPath(path);
+         Snapshot<ColumnTypes...>(RDFInternal::kPersistentCacheTreeName, tmpPath, columnList);
+         RDFInternal::CommitPersistentCache(tmpPath, path);
+      }
+      return RDFInternal::OpenPersistentCache(path);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in a file that is reused by later runs of the same analysis
+   /// \param[in] columnList columns to be cached on disk.
+   /// \param[in] key A string that identifies the computation of the cached columns.
+   /// \param[in] cacheDir The directory of the cache file. By default, the directory of the (first) input file.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// The column types are inferred (this invocation relies on jitting). See the previous overload for more
+   /// information.
+   RInterface<RLoopManager>
+   PersistentCache(const ColumnNames_t &columnList, std::string_view key, std::string_view cacheDir = "")
+   {
+      const auto validColumnNames = GetValidatedColumnNames(columnList.size(), columnList);
+      const auto columnTypes = GetValidatedArgTypes(validColumnNames, fCustomColumns, fLoopManager->GetTree(),
+                                                    fDataSource, "PersistentCache", /*vector2rvec=*/false);
+      const auto path = RDFInternal::GetPersistentCachePath(*fLoopManager, *fProxiedPtr, fCustomColumns, columnList,
+                                                            columnTypes, key, cacheDir);
+      if (!RDFInternal::IsPersistentCacheAvailable(path)) {
+         const auto tmpPath = RDFInternal::GetPersistentCacheTmpPath(path);
+         Snapshot(RDFInternal::kPersistentCacheTreeName, tmpPath, columnList);
+         RDFInternal::CommitPersistentCache(tmpPath, path);
+      }
+      return RDFInternal::OpenPersistentCache(path);
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node that filters entries based on range: [begin, end)
@@ -859,6 +1006,13 @@ public:
       using Action_t = RDFInternal::RAction<Helper_t, Proxied>;
       auto action = std::make_unique<Action_t>(Helper_t(cSPtr, nSlots), ColumnNames_t({}), fProxiedPtr,
                                                RDFInternal::RBookedCustomColumns(fCustomColumns));
+      auto prevNode = fProxiedPtr;
+      auto customColumns = fCustomColumns;
+      action->SetVariedActionFactory([prevNode, customColumns, nSlots](const std::shared_ptr<void> &result) {
+         return std::unique_ptr<RDFInternal::RActionBase>(
+            new Action_t(Helper_t(std::static_pointer_cast<ULong64_t>(result), nSlots), ColumnNames_t({}), prevNode,
+                         RDFInternal::RBookedCustomColumns(customColumns)));
+      });
       fLoopManager->Book(action.get());
       return MakeResultPtr(cSPtr, *fLoopManager, std::move(action));
    }
@@ -896,9 +1050,12 @@ public:
       using Action_t = RDFInternal::RAction<Helper_t, Proxied>;
       auto valuesPtr = std::make_shared<COLL>();
       const auto nSlots = fLoopManager->GetNSlots();
+      // without filters or ranges upstream, each entry yields a value: the result can be allocated upfront
+      const auto nValuesBound =
+         std::is_same<Proxied, RLoopManager>::value ? fLoopManager->GetNEntriesUpperBound() : 0ull;
 
-      auto action =
-         std::make_unique<Action_t>(Helper_t(valuesPtr, nSlots), validColumnNames, fProxiedPtr, std::move(newColumns));
+      auto action = std::make_unique<Action_t>(Helper_t(valuesPtr, nSlots, nValuesBound), validColumnNames,
+                                               fProxiedPtr, std::move(newColumns));
       fLoopManager->Book(action.get());
       return MakeResultPtr(valuesPtr, *fLoopManager, std::move(action));
    }
@@ -1976,6 +2133,34 @@ public:
    /// ~~~
    unsigned int GetNRuns() const { return fLoopManager->GetNRuns(); }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Enable or disable the profiling of the nodes of the computation graph
+   /// \param[in] enable Whether the next event loops are profiled.
+   ///
+   /// When profiling is enabled, the event loops measure the number of evaluations, the number of cached values
+   /// served and the time spent in each Filter, Define and action of the computation graph, as well as the time spent
+   /// loading the entries in each slot. The time attributed to a node excludes the time spent in the nodes it triggers,
+   /// e.g. a Filter does not include the Defines it reads. The results are returned by GetProfileReport() and shown in
+   /// the graph produced by ROOT::RDF::SaveGraph().
+   /// Profiling affects the whole computation graph, whatever node it is enabled from.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("tree", "file.root");
+   /// df.EnableProfiling();
+   /// auto h = df.Define("y", "x * x").Filter("y > 4").Histo1D("y");
+   /// h->Draw(); // trigger the event loop
+   /// df.GetProfileReport().Print();
+   /// ~~~
+   void EnableProfiling(bool enable = true) { fLoopManager->SetProfiling(enable); }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return the time spent in each node of the computation graph, see EnableProfiling()
+   ///
+   /// The measurements are summed over all the event loops run with profiling enabled. Nodes that were never profiled
+   /// are not included.
+   ROOT::RDF::RProfileReport GetProfileReport() { return fLoopManager->GetProfileReport(); }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Execute a user-defined accumulation operation on the processed column values in each processing slot
@@ -2276,8 +2461,11 @@ private:
 
       const auto nSlots = fLoopManager->GetNSlots();
 
+      auto variedActionFactory = RDFInternal::MakeVariedActionFactory<ActionTag, ActionResultType, BranchTypes...>(
+         validColumnNames, nSlots, fProxiedPtr, newColumns);
       auto action = RDFInternal::BuildAction<BranchTypes...>(validColumnNames, r, nSlots, fProxiedPtr, ActionTag{},
                                                              std::move(newColumns));
+      action->SetVariedActionFactory(std::move(variedActionFactory));
       fLoopManager->Book(action.get());
       return MakeResultPtr(r, *fLoopManager, std::move(action));
    }
@@ -2390,6 +2578,24 @@ private:
       auto newColumns = CheckAndFillDSColumns(validCols, std::index_sequence_for<ColumnTypes...>(),
                                               TTraits::TypeList<ColumnTypes...>());
 
+      if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+#ifdef R__HAS_ROOT7
+         if (treename.find('/') != std::string_view::npos)
+            throw std::invalid_argument("Snapshot: RNTuple output cannot be written into a subdirectory");
+         // the same helper is used for single-thread and multi-thread event loops
+         using Helper_t = RDFInternal::SnapshotHelperRNTuple<ColumnTypes...>;
+         using Action_t = RDFInternal::RAction<Helper_t, Proxied>;
+         std::unique_ptr<RDFInternal::RActionBase> actionPtr(
+            new Action_t(Helper_t(fLoopManager->GetNSlots(), filename, treename, columnList, options), validCols,
+                         fProxiedPtr, std::move(newColumns)));
+         fLoopManager->Book(actionPtr.get());
+         return RDFInternal::CreateSnapshotRNTupleRDF(validCols, treename, filename, options.fLazy, *fLoopManager,
+                                                     std::move(actionPtr));
+#else
+         throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7");
+#endif
+      }
+
       const std::string fullTreename(treename);
       // split name into directory and treename if needed
       const auto lastSlash = treename.rfind('/');
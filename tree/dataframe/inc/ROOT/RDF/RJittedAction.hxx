@@ -48,6 +48,13 @@ public:
    bool HasRun() const final;
    void SetHasRun() final;
    void ClearValueReaders(unsigned int slot) final;
+   bool DependsOn(const std::string &variation) const final;
+   void AddVariedFilters(const std::string &variation, std::vector<RFilterBase *> &filters) final;
+   void SetVariedActionFactory(VariedActionFactory_t factory) final;
+   const VariedActionFactory_t &GetVariedActionFactory() const final;
+   std::string GetActionName() final;
+   void SetProfiler(RProfiler *profiler) final;
+   const RNodeProfile &GetProfile() const final;
 
    std::shared_ptr<GraphDrawing::GraphNode> GetGraph();
 };
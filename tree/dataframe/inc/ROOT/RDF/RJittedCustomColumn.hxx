@@ -16,6 +16,7 @@
 #include "RtypesCore.h"
 
 #include <memory>
+#include <string>
 #include <type_traits>
 
 class TTreeReader;
@@ -30,20 +31,27 @@ namespace RDF {
 /// before the event-loop starts.
 class RJittedCustomColumn : public RCustomColumnBase {
    std::unique_ptr<RCustomColumnBase> fConcreteCustomColumn = nullptr;
+   const std::string fExpression; ///< The expression of the column, as passed by the user
 
 public:
-   RJittedCustomColumn(std::string_view name, std::string_view type, unsigned int nSlots)
-      : RCustomColumnBase(name, type, nSlots, /*isDSColumn=*/false, RDFInternal::RBookedCustomColumns())
+   RJittedCustomColumn(std::string_view name, std::string_view type, unsigned int nSlots, std::string_view expression)
+      : RCustomColumnBase(name, type, nSlots, /*isDSColumn=*/false, RDFInternal::RBookedCustomColumns()),
+        fExpression(expression)
    {
    }
 
    void SetCustomColumn(std::unique_ptr<RCustomColumnBase> c) { fConcreteCustomColumn = std::move(c); }
+   const std::string &GetExpression() const { return fExpression; }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void *GetValuePtr(unsigned int slot) final;
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
    void ClearValueReaders(unsigned int slot) final;
+   bool DependsOn(const std::string &variation) const final;
+   void ResetCache(unsigned int slot) final;
+   void SetProfiler(RDFInternal::RProfiler *profiler) final;
+   const RDFInternal::RNodeProfile &GetProfile() const final;
 };
 
 } // ns RDF
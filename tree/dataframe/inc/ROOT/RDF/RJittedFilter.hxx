@@ -38,9 +38,10 @@ namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
 /// at a later time, from jitted code.
 class RJittedFilter final : public RFilterBase {
    std::unique_ptr<RFilterBase> fConcreteFilter = nullptr;
+   const std::string fExpression; ///< The expression of the filter, as passed by the user
 
 public:
-   RJittedFilter(RLoopManager *lm, std::string_view name);
+   RJittedFilter(RLoopManager *lm, std::string_view name, std::string_view expression);
    ~RJittedFilter() { fLoopManager->Deregister(this); }
 
    void SetFilter(std::unique_ptr<RFilterBase> f);
@@ -54,11 +55,20 @@ public:
    void StopProcessing() final;
    void ResetChildrenCount() final;
    void TriggerChildrenCount() final;
+   bool IsActive() const final;
    void ResetReportCount() final;
    void ClearValueReaders(unsigned int slot) final;
    void InitNode() final;
    void AddFilterName(std::vector<std::string> &filters) final;
+   void AddFilterExpressions(std::vector<std::string> &expressions) final;
    void ClearTask(unsigned int slot) final;
+   bool DependsOn(const std::string &variation) const final;
+   void AddVariedFilters(const std::string &variation, std::vector<RFilterBase *> &filters) final;
+   void ResetCache(unsigned int slot) final;
+   void SaveNominalState(unsigned int slot) final;
+   void RestoreNominalState(unsigned int slot) final;
+   void SetProfiler(RDFInternal::RProfiler *profiler) final;
+   const RDFInternal::RNodeProfile &GetProfile() const final;
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph();
 };
 
@@ -12,12 +12,16 @@
 #define ROOT_RLOOPMANAGER
 
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
 #include "ROOT/RDF/NodesUtils.hxx"
 
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 // forward declarations
@@ -47,6 +51,7 @@ namespace RDF {
 using namespace ROOT::TypeTraits;
 namespace RDFInternal = ROOT::Internal::RDF;
 
+class RCustomColumnBase;
 class RFilterBase;
 class RRangeBase;
 using ROOT::RDF::RDataSource;
@@ -94,6 +99,14 @@ class RLoopManager : public RNodeBase {
       }
    };
 
+   /// The nodes that are re-evaluated for one of the systematic variations, see RInterface::Vary()
+   struct RVariedPass {
+      unsigned int fVariation;                         ///< The id of the variation
+      std::vector<RDFInternal::RActionBase *> fActions; ///< The actions that process the variation
+      std::vector<RCustomColumnBase *> fColumns;       ///< The custom columns that depend on the variation
+      std::vector<RFilterBase *> fFilters;             ///< The filters that depend on the variation
+   };
+
    std::vector<RDFInternal::RActionBase *> fBookedActions; ///< Non-owning pointers to actions to be run
    std::vector<RDFInternal::RActionBase *> fRunActions;    ///< Non-owning pointers to actions already run
    std::vector<RFilterBase *> fBookedFilters;
@@ -113,18 +126,34 @@ class RLoopManager : public RNodeBase {
    std::vector<TCallback> fCallbacks;                      ///< Registered callbacks
    std::vector<TOneTimeCallback> fCallbacksOnce; ///< Registered callbacks to invoke just once before running the loop
    unsigned int fNRuns{0}; ///< Number of event loops run
+   mutable unsigned long fJitBatch{0}; ///< Batch of the jitted code last queued by ToJitExec(), see Jit()
+
+   /// Name and tag of the systematic variations, indexed by the id of the variation. The id 0 is the nominal.
+   std::vector<std::pair<std::string, std::string>> fVariations{{"nominal", ""}};
+   std::vector<unsigned int> fCurrentVariations; ///< The id of the variation being processed, per slot
+   std::vector<RDFInternal::RActionBase *> fNominalActions; ///< The booked actions of the nominal, set by InitNodes()
+   std::vector<RVariedPass> fVariedPasses; ///< One pass per variation processed by booked actions, set by InitNodes()
+   std::vector<RFilterBase *> fVariedFilters; ///< The filters of all the varied passes
+
+   bool fIsProfiling{false};          ///< Whether the nodes are profiled in the next event loops, see SetProfiling()
+   RDFInternal::RProfiler fProfiler; ///< Measures the time spent in the nodes, if profiling is enabled
 
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
    void CheckIndexedFriends();
    void RunEmptySourceMT();
-   void RunEmptySource();
+   void RunEmptySource(ULong64_t beginEntry = 0, ULong64_t endEntry = std::numeric_limits<ULong64_t>::max());
    void RunTreeProcessorMT();
-   void RunTreeReader();
+   void RunTreeReader(ULong64_t beginEntry = 0, ULong64_t endEntry = std::numeric_limits<ULong64_t>::max());
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunVariations(unsigned int slot, Long64_t entry);
+   void InitVariedPasses();
+   void InitProfiling();
+   bool ReadNextEntry(TTreeReader &r, unsigned int slot);
+   bool SetDataSourceEntry(unsigned int slot, ULong64_t entry);
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
@@ -142,10 +171,14 @@ public:
    void Jit();
    RLoopManager *GetLoopManagerUnchecked() final { return this; }
    void Run();
+   void RunEntryRange(ULong64_t beginEntry, ULong64_t endEntry);
+   void MarkActionsAsRun();
+   bool HasRanges() const { return !fBookedRanges.empty(); }
    const ColumnNames_t &GetDefaultColumnNames() const;
    TTree *GetTree() const;
    ::TDirectory *GetDirectory() const;
    ULong64_t GetNEmptyEntries() const { return fNEmptyEntries; }
+   ULong64_t GetNEntriesUpperBound() const;
    RDataSource *GetDataSource() const { return fDataSource.get(); }
    void Book(RDFInternal::RActionBase *actionPtr);
    void Deregister(RDFInternal::RActionBase *actionPtr);
@@ -166,6 +199,14 @@ public:
    const std::map<std::string, std::string> &GetAliasMap() const { return fAliasColumnNameMap; }
    void RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f);
    unsigned int GetNRuns() const { return fNRuns; }
+   unsigned int RegisterVariation(const std::string &name, const std::vector<std::string> &tags);
+   const std::vector<std::pair<std::string, std::string>> &GetVariations() const { return fVariations; }
+   /// The id of the systematic variation that the slot is processing, 0 for the nominal
+   unsigned int GetCurrentVariation(unsigned int slot) const { return fCurrentVariations[slot]; }
+   /// Enable or disable the profiling of the nodes in the next event loops
+   void SetProfiling(bool enable) { fIsProfiling = enable; }
+   bool IsProfiling() const { return fIsProfiling; }
+   ROOT::RDF::RProfileReport GetProfileReport();
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) {}
@@ -34,6 +34,7 @@ namespace Detail {
 namespace RDF {
 
 class RLoopManager;
+class RFilterBase;
 
 /// Base class for non-leaf nodes of the computational graph.
 /// It only exposes the bare minimum interface required to work as a generic part of the computation graph.
@@ -62,6 +63,13 @@ public:
    }
 
    virtual RLoopManager *GetLoopManagerUnchecked() { return fLoopManager; }
+
+   /// Whether the result of this node depends on the given systematic variation, see RInterface::Vary()
+   virtual bool DependsOn(const std::string & /*variation*/) const { return false; }
+   /// Append to filters the filters of this branch of the graph whose results depend on the given variation
+   virtual void AddVariedFilters(const std::string & /*variation*/, std::vector<RFilterBase *> & /*filters*/) {}
+   /// Append to expressions the expressions of the jitted filters of this branch of the graph, see PersistentCache()
+   virtual void AddFilterExpressions(std::vector<std::string> & /*expressions*/) {}
 };
 } // ns RDF
 } // ns Detail
@@ -0,0 +1,129 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNODEPROFILE
+#define ROOT_RDF_RNODEPROFILE
+
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Measures the time spent in the nodes of a computation graph, slot by slot.
+/// Nodes are evaluated lazily from within other nodes (e.g. a Filter triggers the evaluation of the Defines it
+/// reads), so the profiler keeps a stack of the nodes being evaluated in each slot and attributes to each node only
+/// the time spent in the node itself, excluding the nodes it triggered.
+class RProfiler {
+public:
+   using Clock_t = std::chrono::steady_clock;
+   using Duration_t = std::chrono::nanoseconds;
+
+private:
+   struct RFrame {
+      Clock_t::time_point fStart;
+      Duration_t fChildren; ///< Time spent in the nodes evaluated from within this one
+   };
+   std::vector<std::vector<RFrame>> fStacks; ///< The nodes being evaluated, per slot
+   std::vector<Duration_t> fIOTimes;         ///< Time spent loading entries, per slot
+
+public:
+   /// Prepare the profiler for an event loop. Times measured in previous event loops are kept.
+   void Init(unsigned int nSlots)
+   {
+      fStacks.assign(nSlots, {});
+      fIOTimes.resize(nSlots, Duration_t(0));
+   }
+
+   void Start(unsigned int slot) { fStacks[slot].push_back({Clock_t::now(), Duration_t(0)}); }
+
+   /// Stop the timer started last in the slot and return the time spent in that node only
+   Duration_t Stop(unsigned int slot)
+   {
+      auto &stack = fStacks[slot];
+      const auto elapsed = std::chrono::duration_cast<Duration_t>(Clock_t::now() - stack.back().fStart);
+      const auto self = elapsed - stack.back().fChildren;
+      stack.pop_back();
+      if (!stack.empty())
+         stack.back().fChildren += elapsed;
+      return self;
+   }
+
+   void AddIOTime(unsigned int slot, Clock_t::duration time)
+   {
+      fIOTimes[slot] += std::chrono::duration_cast<Duration_t>(time);
+   }
+   const std::vector<Duration_t> &GetIOTimes() const { return fIOTimes; }
+};
+
+/// The measurements of a node of the computation graph
+struct RNodeStats {
+   ULong64_t fCalls = 0;           ///< Number of evaluations
+   ULong64_t fCacheHits = 0;       ///< Number of requests served with the value cached for the current entry
+   RProfiler::Duration_t fTime{0}; ///< Time spent in the node itself
+};
+
+/// The per-slot measurements of a node. Profiling is enabled by setting a profiler, see RLoopManager::SetProfiling().
+class RNodeProfile {
+   RProfiler *fProfiler = nullptr; ///< Null if profiling is disabled
+   std::vector<RNodeStats> fStats; ///< Per slot. Empty if the node was never profiled
+
+public:
+   /// Measures the time spent in one evaluation of a node, from construction to destruction. No-op if profiling is
+   /// disabled.
+   class RScope {
+      RNodeProfile *fProfile;
+      const unsigned int fSlot;
+
+   public:
+      RScope(RNodeProfile &profile, unsigned int slot) : fProfile(profile.IsEnabled() ? &profile : nullptr), fSlot(slot)
+      {
+         if (fProfile)
+            fProfile->fProfiler->Start(slot);
+      }
+      RScope(const RScope &) = delete;
+      RScope &operator=(const RScope &) = delete;
+      ~RScope()
+      {
+         if (fProfile) {
+            auto &stats = fProfile->fStats[fSlot];
+            stats.fTime += fProfile->fProfiler->Stop(fSlot);
+            ++stats.fCalls;
+         }
+      }
+   };
+
+   /// Enable profiling with the given profiler, or disable it if null. Measurements of previous event loops are kept.
+   void SetProfiler(RProfiler *profiler, unsigned int nSlots)
+   {
+      fProfiler = profiler;
+      if (fProfiler)
+         fStats.resize(nSlots);
+   }
+   bool IsEnabled() const { return fProfiler != nullptr; }
+   void CountCacheHit(unsigned int slot)
+   {
+      if (fProfiler)
+         ++fStats[slot].fCacheHits;
+   }
+   bool HasStats() const { return !fStats.empty(); }
+   /// The measurements summed over all slots
+   RNodeStats GetStats() const;
+   /// A one-line summary of the measurements, e.g. to annotate the node in SaveGraph(). Empty if there are none.
+   std::string GetSummary() const;
+};
+
+} // ns RDF
+} // ns Internal
+} // ns ROOT
+
+#endif // ROOT_RDF_RNODEPROFILE
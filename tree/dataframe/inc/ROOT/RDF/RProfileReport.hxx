@@ -0,0 +1,75 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RPROFILEREPORT
+#define ROOT_RPROFILEREPORT
+
+#include "RtypesCore.h"
+
+#include <string>
+#include <vector>
+
+namespace ROOT {
+
+namespace Detail {
+namespace RDF {
+class RLoopManager;
+} // End NS RDF
+} // End NS Detail
+
+namespace RDF {
+
+/// The measurements of one node of the computation graph, see RProfileReport
+class RNodeProfileInfo {
+   friend class ROOT::Detail::RDF::RLoopManager;
+
+private:
+   const std::string fKind; ///< "Filter", "Define", "Column" (read from the data source) or "Action"
+   const std::string fName;
+   const ULong64_t fCalls;
+   const ULong64_t fCacheHits;
+   const double fTime;
+   RNodeProfileInfo(const std::string &kind, const std::string &name, ULong64_t calls, ULong64_t cacheHits,
+                    double time)
+      : fKind(kind), fName(name), fCalls(calls), fCacheHits(cacheHits), fTime(time)
+   {
+   }
+
+public:
+   const std::string &GetKind() const { return fKind; }
+   const std::string &GetName() const { return fName; }
+   /// Number of evaluations of the node
+   ULong64_t GetCalls() const { return fCalls; }
+   /// Number of requests served with the value cached for the current entry
+   ULong64_t GetCacheHits() const { return fCacheHits; }
+   /// Time, in seconds, spent in the node itself, excluding the time spent in the nodes that it triggered
+   double GetTime() const { return fTime; }
+};
+
+/// The time spent in each node of a computation graph, as returned by RInterface::GetProfileReport()
+class RProfileReport {
+   friend class ROOT::Detail::RDF::RLoopManager;
+
+private:
+   std::vector<RNodeProfileInfo> fNodes;
+   std::vector<double> fIOTimes;
+
+public:
+   using const_iterator = typename std::vector<RNodeProfileInfo>::const_iterator;
+   /// Print the measurements of the nodes, the most expensive first
+   void Print() const;
+   const_iterator begin() const { return fNodes.begin(); }
+   const_iterator end() const { return fNodes.end(); }
+   /// Time, in seconds, spent by each slot to load the entries, outside of the nodes
+   const std::vector<double> &GetIOTimes() const { return fIOTimes; }
+};
+
+} // End NS RDF
+} // End NS ROOT
+
+#endif
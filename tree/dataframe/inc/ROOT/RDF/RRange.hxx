@@ -16,6 +16,8 @@
 #include "RtypesCore.h"
 
 #include <memory>
+#include <stdexcept>
+#include <string>
 
 namespace ROOT {
 
@@ -96,8 +98,22 @@ public:
          fPrevData.IncrChildrenCount();
    }
 
+   bool DependsOn(const std::string &variation) const final { return fPrevData.DependsOn(variation); }
+
+   /// The entries counted by a range would change with the variations, which is not supported
+   void AddVariedFilters(const std::string &variation, std::vector<RFilterBase *> &) final
+   {
+      if (fPrevData.DependsOn(variation))
+         throw std::runtime_error("RDataFrame: Range() is not supported downstream of the variation \"" + variation +
+                                  "\"");
+   }
+
    /// This function must be defined by all nodes, but only the filters will add their name
    void AddFilterName(std::vector<std::string> &filters) { fPrevData.AddFilterName(filters); }
+   void AddFilterExpressions(std::vector<std::string> &expressions) final
+   {
+      fPrevData.AddFilterExpressions(expressions);
+   }
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       // TODO: Ranges node have no information about custom columns, hence it is not possible now
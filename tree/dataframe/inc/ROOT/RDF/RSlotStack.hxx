@@ -13,7 +13,8 @@
 
 #include <ROOT/TSpinMutex.hxx>
 
-#include <stack>
+#include <thread>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -23,10 +24,13 @@ namespace RDF {
 /// indexed by thread ids.
 /// WARNING: this class does not work as a regular stack. The size is
 /// fixed at construction time and no blocking is foreseen.
+/// A thread gets back the slot it used last if that slot is free, so that the
+/// objects of a slot stay in the memory local to the thread that allocated them.
 class RSlotStack {
 private:
    const unsigned int fSize;
-   std::stack<unsigned int> fStack;
+   std::vector<unsigned int> fStack;
+   std::vector<std::thread::id> fLastUsers; ///< The thread that took each slot last
    ROOT::TSpinMutex fMutex;
 
 public:
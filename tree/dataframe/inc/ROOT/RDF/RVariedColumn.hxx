@@ -0,0 +1,128 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVARIEDCOLUMN
+#define ROOT_RVARIEDCOLUMN
+
+#include "ROOT/RDF/RCustomColumnBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RStringView.hxx"
+#include "ROOT/RVec.hxx"
+#include "RtypesCore.h"
+
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+
+/// A column with systematic variations, booked by RInterface::Vary().
+/// It takes the nominal value of the column it replaces, unless the slot is processing one of its variations: then
+/// it takes the corresponding element of the values of all the variations, which are computed once per entry.
+template <typename T>
+class RVariedColumn final : public RCustomColumnBase {
+   // Avoid instantiating vector<bool> as `operator[]` returns temporaries in that case. Use std::deque instead.
+   using ValuesPerSlot_t = typename std::conditional<std::is_same<T, bool>::value, std::deque<T>, std::vector<T>>::type;
+
+   RLoopManager *fLoopManager;
+   const std::string fVariationName;
+   const unsigned int fFirstVariation; ///< Id of the variation of the first tag
+   const std::size_t fNVariations;
+   /// Column with the nominal values
+   std::shared_ptr<RCustomColumnBase> fNominal;
+   /// Column with the values of all the variations, of type RVec<T>
+   std::shared_ptr<RCustomColumnBase> fVariations;
+   ValuesPerSlot_t fLastResults;
+
+public:
+   RVariedColumn(std::string_view name, std::string_view type, RLoopManager &lm, std::string_view variationName,
+                 unsigned int firstVariation, std::size_t nVariations, std::shared_ptr<RCustomColumnBase> nominal,
+                 std::shared_ptr<RCustomColumnBase> variations, const RDFInternal::RBookedCustomColumns &customColumns)
+      : RCustomColumnBase(name, type, lm.GetNSlots(), /*isDSColumn=*/false, customColumns), fLoopManager(&lm),
+        fVariationName(variationName), fFirstVariation(firstVariation), fNVariations(nVariations),
+        fNominal(std::move(nominal)), fVariations(std::move(variations)), fLastResults(fNSlots)
+   {
+   }
+
+   RVariedColumn(const RVariedColumn &) = delete;
+   RVariedColumn &operator=(const RVariedColumn &) = delete;
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final
+   {
+      if (!fIsInitialized[slot]) {
+         fIsInitialized[slot] = true;
+         fNominal->InitSlot(r, slot);
+         fVariations->InitSlot(r, slot);
+         fLastCheckedEntry[slot] = -1;
+      }
+   }
+
+   void *GetValuePtr(unsigned int slot) final { return static_cast<void *>(&fLastResults[slot]); }
+
+   void Update(unsigned int slot, Long64_t entry) final
+   {
+      if (entry == fLastCheckedEntry[slot]) {
+         fProfile.CountCacheHit(slot);
+         return;
+      }
+
+      RDFInternal::RNodeProfile::RScope profile(fProfile, slot);
+      const auto variation = fLoopManager->GetCurrentVariation(slot);
+      if (variation >= fFirstVariation && variation < fFirstVariation + fNVariations) {
+         fVariations->Update(slot, entry);
+         const auto &values = *static_cast<ROOT::VecOps::RVec<T> *>(fVariations->GetValuePtr(slot));
+         if (values.size() != fNVariations) {
+            throw std::runtime_error("RDataFrame::Vary: the expression of the variation \"" + fVariationName +
+                                     "\" returned " + std::to_string(values.size()) + " values instead of " +
+                                     std::to_string(fNVariations));
+         }
+         fLastResults[slot] = values[variation - fFirstVariation];
+      } else {
+         fNominal->Update(slot, entry);
+         fLastResults[slot] = *static_cast<T *>(fNominal->GetValuePtr(slot));
+      }
+      fLastCheckedEntry[slot] = entry;
+   }
+
+   const std::type_info &GetTypeId() const final { return typeid(T); }
+
+   void ClearValueReaders(unsigned int slot) final
+   {
+      if (fIsInitialized[slot]) {
+         fNominal->ClearValueReaders(slot);
+         fVariations->ClearValueReaders(slot);
+         fIsInitialized[slot] = false;
+      }
+   }
+
+   bool DependsOn(const std::string &variation) const final
+   {
+      return variation == fVariationName || fNominal->DependsOn(variation) || fVariations->DependsOn(variation);
+   }
+
+   void ResetCache(unsigned int slot) final
+   {
+      RCustomColumnBase::ResetCache(slot);
+      fNominal->ResetCache(slot);
+      // The values of all the variations are only computed while processing one of them, with the nominal inputs:
+      // they stay valid for the whole entry and only the selected element is picked again.
+   }
+};
+
+} // ns RDF
+} // ns Detail
+} // ns ROOT
+
+#endif // ROOT_RVARIEDCOLUMN
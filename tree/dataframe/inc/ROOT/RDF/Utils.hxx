@@ -107,6 +107,14 @@ char TypeName2ROOTTypeName(const std::string &b);
 
 unsigned int GetNSlots();
 
+/// The number of entries that actions with bulk-capable helpers collect before processing them, 0 if disabled.
+/// Set by ROOT::RDF::SetBulkSize().
+unsigned int &GetBulkSizeRef();
+
+/// Whether the actions that fill one object per slot fill a single object shared by all slots instead.
+/// Set by ROOT::RDF::EnableSharedFill().
+bool &GetSharedFillRef();
+
 /// `type` is TypeList if MustRemove is false, otherwise it is a TypeList with the first type removed
 template <bool MustRemove, typename TypeList>
 struct RemoveFirstParameterIf {
@@ -14,6 +14,7 @@
 #define ROOT_RDF_HELPERS
 
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RResultHandle.hxx>
 #include <ROOT/RDF/GraphUtils.hxx>
 #include <ROOT/RIntegerSequence.hxx>
 #include <ROOT/TypeTraits.hxx>
@@ -146,6 +147,33 @@ RNode AsRNode(NodeType node)
    return node;
 }
 
+// clang-format off
+/// Trigger the event loops of multiple RDataFrames concurrently
+/// \param[in] handles A vector of RResultHandles
+///
+/// This function triggers the event loop of all computation graphs which relate to the
+/// given RResultHandles. The advantage compared to running the event loops one after the other
+/// is that the work of all graphs is interleaved in the same pool of worker threads, which keeps the
+/// cores busy also while a single graph is bound by I/O or has too few tasks to occupy all of them.
+/// The code of all the jitted nodes is compiled at once before any of the event loops starts.
+///
+/// The event loops run concurrently only if implicit multi-threading is enabled, otherwise they run sequentially.
+/// Results whose event loop already ran are skipped.
+///
+/// ~~~{.cpp}
+/// ROOT::EnableImplicitMT();
+/// ROOT::RDataFrame df1("tree1", "file1.root");
+/// auto r1 = df1.Histo1D("var1");
+///
+/// ROOT::RDataFrame df2("tree2", "file2.root");
+/// auto r2 = df2.Sum("var2");
+///
+/// // RResultPtr -> RResultHandle conversion is automatic
+/// ROOT::RDF::RunGraphs({r1, r2});
+/// ~~~
+// clang-format on
+void RunGraphs(std::vector<RResultHandle> handles);
+
 } // namespace RDF
 } // namespace ROOT
 #endif
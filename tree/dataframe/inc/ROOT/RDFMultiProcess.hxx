@@ -0,0 +1,134 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_MULTIPROCESS
+#define ROOT_RDF_MULTIPROCESS
+
+#include "ROOT/RResultPtr.hxx"
+#include "RtypesCore.h"
+#include "TList.h"
+#include "TObject.h"
+#include "TParameter.h"
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+// clang-format off
+/**
+\class ROOT::RDF::Experimental::RMultiProcessRun
+\ingroup dataframe
+\brief Runs the event loop of an RDataFrame computation graph in several worker processes and merges the results
+
+The data set is split into one contiguous entry range per worker. The ranges are aligned with the cluster
+boundaries of a TTree, respectively with the file boundaries of a TChain. Every worker is a forked copy of the
+current process that runs the entire computation graph on its range, in sequence. The results of the workers are
+sent back as TObjects and merged into the results of the current process, which are then marked as ready.
+
+If a worker process is lost (e.g. it crashed or it was killed), its entry range is reprocessed by a new worker, up to
+the given number of retries. Errors reported by the event loop itself are not retried but rethrown.
+
+All the results booked on the computation graph need to be added. Results of a TObject-derived type are merged with
+their `Merge()` method; arithmetic results are merged with the given binary function (by default, they are summed).
+Data sources, Range() nodes and TTrees with an entry list are not supported.
+
+~~~{.cpp}
+ROOT::RDataFrame df("tree", "file.root");
+auto h = df.Histo1D("x");
+auto n = df.Filter("x > 0").Count();
+auto m = df.Max<double>("x");
+ROOT::RDF::Experimental::RMultiProcessRun run(8);
+run.Add(h).Add(n).Add(m, [](double a, double b) { return std::max(a, b); });
+run.Run();
+~~~
+*/
+// clang-format on
+class RMultiProcessRun {
+public:
+   /// Returns a new TObject with the result of a worker process, which is sent to the parent process
+   using Serializer_t = std::function<TObject *()>;
+   /// Merges the results of all the workers into the result of the parent process
+   using Merger_t = std::function<void(TList &)>;
+
+private:
+   struct RResult {
+      RDFDetail::RLoopManager *fLoopManager;
+      RDFInternal::RActionBase *fAction;
+      Serializer_t fSerializer;
+      Merger_t fMerger;
+   };
+
+   unsigned int fNWorkers;
+   unsigned int fMaxRetries;
+   std::vector<RResult> fResults;
+
+   template <typename T>
+   void AddImpl(RResultPtr<T> &result, std::true_type /* isTObject */)
+   {
+      auto obj = result.fObjPtr;
+      fResults.push_back({result.fLoopManager, result.fActionPtr.get(), [obj]() { return obj->Clone(); },
+                          [obj](TList &partials) { obj->Merge(&partials); }});
+   }
+
+   template <typename T>
+   void AddImpl(RResultPtr<T> &result, std::false_type /* isTObject */)
+   {
+      Add(result, std::plus<T>());
+   }
+
+public:
+   /// With nWorkers == 0, the number of workers is equal to the number of cores
+   explicit RMultiProcessRun(unsigned int nWorkers = 0, unsigned int maxRetries = 2);
+
+   /// Adds a result of a TObject-derived type, which is merged with its `Merge()` method, or an arithmetic result,
+   /// which is summed
+   template <typename T>
+   RMultiProcessRun &Add(RResultPtr<T> &result)
+   {
+      static_assert(std::is_base_of<TObject, T>::value || std::is_arithmetic<T>::value,
+                    "only results of TObject-derived or arithmetic types can be merged");
+      AddImpl(result, std::is_base_of<TObject, T>());
+      return *this;
+   }
+
+   /// Adds an arithmetic result, whose partial values from the workers are combined with the binary function merge
+   template <typename T, typename F>
+   RMultiProcessRun &Add(RResultPtr<T> &result, F &&merge)
+   {
+      static_assert(std::is_arithmetic<T>::value, "only arithmetic results can be merged with a binary function");
+      using Param_t = typename std::conditional<std::is_integral<T>::value, Long64_t, Double_t>::type;
+      auto obj = result.fObjPtr;
+      auto serializer = [obj]() { return new TParameter<Param_t>("", static_cast<Param_t>(*obj)); };
+      auto merger = [obj, merge](TList &partials) {
+         bool isFirst = true;
+         for (auto partial : partials) {
+            const auto value = static_cast<T>(static_cast<TParameter<Param_t> *>(partial)->GetVal());
+            *obj = isFirst ? value : static_cast<T>(merge(*obj, value));
+            isFirst = false;
+         }
+      };
+      fResults.push_back({result.fLoopManager, result.fActionPtr.get(), serializer, merger});
+      return *this;
+   }
+
+   /// Runs the event loop in the worker processes and merges the results. Throws if the computation graph cannot
+   /// be run in several processes or if some of the entry ranges could not be processed.
+   void Run();
+};
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_MULTIPROCESS
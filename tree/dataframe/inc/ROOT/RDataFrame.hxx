@@ -33,7 +33,30 @@ class TTree;
 namespace ROOT {
 namespace RDF {
 class RDataSource;
-}
+
+/// Queue the declarations of the lambdas of jitted Filters and Defines instead of declaring each of them to the
+/// interpreter separately. The queued declarations reach the interpreter in a single transaction, at the latest when
+/// the event loop starts. Defines still need to know the return type of their expression, so booking one flushes the
+/// queue. Errors in the expressions of batched Filters are reported only when the queue is flushed.
+void EnableJitDeclarationBatching(bool enable = true);
+bool IsJitDeclarationBatchingEnabled();
+
+/// Let actions process the values of the entries that pass their filters in blocks of `bulkSize` entries; 0 (the
+/// default) disables the bulk mode. Applies to the actions booked afterwards whose input columns are all of
+/// arithmetic type and whose helper treats a collection of values like the sequence of its elements (Sum, Mean,
+/// StdDev, Min, Max, histograms and profiles). The block of each column is handed to the helper as an RVec, which amortizes the
+/// per-entry call overhead and lets the helper's loop vectorize. Filters and Defines are still evaluated per entry.
+void SetBulkSize(unsigned int bulkSize);
+unsigned int GetBulkSize();
+
+/// Let the histograms and profiles booked afterwards with a model be filled by all slots directly, under a lock,
+/// instead of filling one copy per slot and merging the copies at the end of the event loop. This saves the memory of
+/// the copies and the merge, which pays off for large histograms (e.g. TH3 or THn) when the filling rate is low
+/// compared to the rest of the processing, e.g. after selective filters or in bulk mode (see SetBulkSize()).
+/// Callbacks registered on these results see the object being filled by all slots.
+void EnableSharedFill(bool enable = true);
+bool IsSharedFillEnabled();
+} // namespace RDF
 
 namespace RDFDetail = ROOT::Detail::RDF;
 namespace RDFInternal = ROOT::Internal::RDF;
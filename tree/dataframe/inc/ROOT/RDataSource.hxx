@@ -210,6 +210,11 @@ public:
    /// Concrete datasources can override the default implementation.
    virtual std::string GetLabel() { return "Custom Datasource"; }
 
+   /// \brief Return the names of the files read by the datasource, if any.
+   /// Used to detect changes of the input data, e.g. by RInterface::PersistentCache().
+   /// Concrete datasources that read files should override the default implementation.
+   virtual std::vector<std::string> GetInputFileNames() { return {}; }
+
 protected:
    /// type-erased vector of pointers to pointers to column values - one per slot
    virtual Record_t GetColumnReadersImpl(std::string_view name, const std::type_info &) = 0;
@@ -33,18 +33,43 @@ class REntry;
 
 
 class RNTupleDS final : public ROOT::RDF::RDataSource {
-   /// Clones of the first reader, one for each slot
-   std::vector<std::unique_ptr<ROOT::Experimental::RNTupleReader>> fReaders;
+   /// If constructed from an ntuple name and a location, the ntuple is opened on first use
+   std::string fNTupleName;
+   std::string fLocation;
+   /// Clones of the first reader, one for each slot.  Mutable because the first reader may be opened lazily.
+   mutable std::vector<std::unique_ptr<ROOT::Experimental::RNTupleReader>> fReaders;
    std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
    /// The raw pointers wrapped by the RValue items of fEntries
    std::vector<std::vector<void*>> fValuePtrs;
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
-   std::vector<std::string> fColumnNames;
-   std::vector<std::string> fColumnTypes;
+   mutable std::vector<std::string> fColumnNames;
+   mutable std::vector<std::string> fColumnTypes;
+   /// Value ranges of columns pushed down by AddRangePredicate()
+   struct RRangePredicate {
+      std::string fColumnName;
+      double fMin;
+      double fMax;
+   };
+   std::vector<RRangePredicate> fRangePredicates;
+
+   /// Opens the ntuple if necessary and registers the top-level fields as columns
+   void Attach() const;
+   /// Creates the clones of the first reader and the entries, one for each slot, unless they already exist
+   void CreateSlots();
+   /// Entry ranges that can satisfy all the range predicates according to the ntuple statistics
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetCandidateRanges();
+   /// The entry ranges of the non-empty clusters, sorted by the first entry
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetClusterRanges();
+   /// Intersection of two sorted lists of disjoint entry ranges
+   static std::vector<std::pair<ULong64_t, ULong64_t>> IntersectRanges(
+      const std::vector<std::pair<ULong64_t, ULong64_t>> &a, const std::vector<std::pair<ULong64_t, ULong64_t>> &b);
 
 public:
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::RNTupleReader> ntuple);
+   /// The ntuple is opened only when the data source is first used.  Allows for setting up a data frame on an
+   /// ntuple that is yet to be written, e.g. by a Snapshot.
+   RNTupleDS(std::string_view ntupleName, std::string_view location);
    ~RNTupleDS() = default;
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final;
@@ -52,9 +77,16 @@ public:
    std::string GetTypeName(std::string_view colName) const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
 
+   /// Pushes down the predicate min <= colName <= max to the ntuple, such that clusters and pages whose statistics
+   /// rule out the predicate are not processed.  Processed entries are not tested, so the event loop still needs
+   /// an equivalent Filter.  Without statistics in the ntuple, there is no effect.  Must be called before the event
+   /// loop starts.
+   void AddRangePredicate(std::string_view colName, double min, double max);
+
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
    void Initialise() final;
+   std::vector<std::string> GetInputFileNames() final;
 
 protected:
    Record_t GetColumnReadersImpl(std::string_view name, const std::type_info &) final;
@@ -0,0 +1,101 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RPARQUETDS
+#define ROOT_RPARQUETDS
+
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDataSource.hxx"
+#include "ROOT/RStringView.hxx"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arrow {
+class Schema;
+}
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+// Defined in RParquetDS.cxx in order to not pollute this header file with the arrow and parquet headers
+struct RParquetSlot;
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+
+// clang-format off
+/**
+\class ROOT::RDF::RParquetDS
+\ingroup dataframe
+\brief RDataFrame data source class for reading Apache Parquet files.
+
+The RParquetDS streams the row groups of a Parquet file through RDataFrame: each entry range returned by
+GetEntryRanges() is a row group, so that row groups are read and processed in parallel when implicit
+multi-threading is enabled. Each slot reads its row group into Arrow arrays, only for the columns that
+the computation graph uses, and the column readers point directly into the Arrow buffers: numeric values and
+lists of numeric values (exposed as RVec) are not copied. Booleans are unpacked and strings are copied.
+
+A RDataFrame that reads a Parquet file can be constructed using the factory method
+ROOT::RDF::MakeParquetDataFrame:
+
+    auto rdf = ROOT::RDF::MakeParquetDataFrame("/path/to/file.parquet");
+
+The supported column types are the same as for RArrowDS. Nested columns other than lists are not supported.
+*/
+// clang-format on
+class RParquetDS final : public RDataSource {
+   std::string fFileName;
+   std::shared_ptr<arrow::Schema> fSchema;
+   std::vector<std::string> fColumnNames;
+   /// The indices in the file schema of the columns in fColumnNames
+   std::vector<int> fColumnIndices;
+   /// The positions in fColumnNames of the columns for which readers were requested, i.e. the ones to read
+   std::vector<std::size_t> fActiveColumns;
+   /// The first entry of each row group, followed by the total number of entries
+   std::vector<ULong64_t> fRowGroupStarts;
+   bool fRangesReturned = false;
+   unsigned int fNSlots = 0U;
+   /// Per column, per slot: the addresses of the current values, which the column readers point to
+   std::vector<std::vector<void *>> fValuePtrs;
+   /// The row group being processed by each slot
+   std::vector<std::unique_ptr<ROOT::Internal::RDF::RParquetSlot>> fSlots;
+
+   void LoadRowGroup(unsigned int slot, ULong64_t entry);
+
+protected:
+   Record_t GetColumnReadersImpl(std::string_view name, const std::type_info &) final;
+
+public:
+   RParquetDS(std::string_view fileName, const std::vector<std::string> &columns = {});
+   ~RParquetDS();
+   const std::vector<std::string> &GetColumnNames() const final;
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
+   std::string GetTypeName(std::string_view colName) const final;
+   bool HasColumn(std::string_view colName) const final;
+   bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
+   void FinaliseSlot(unsigned int slot) final;
+   void SetNSlots(unsigned int nSlots) final;
+   void Initialise() final;
+   std::string GetLabel() final;
+   std::vector<std::string> GetInputFileNames() final;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Factory method to create a RDataFrame that reads an Apache Parquet file.
+/// \param[in] fileName Path of the Parquet file.
+/// \param[in] columns The names of the columns to expose. If empty, all the columns of the file are exposed.
+RDataFrame MakeParquetDataFrame(std::string_view fileName, const std::vector<std::string> &columns = {});
+
+} // namespace RDF
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,104 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RRESULTHANDLE
+#define ROOT_RRESULTHANDLE
+
+#include "ROOT/RResultPtr.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // TypeID2TypeName
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+
+class RResultHandle;
+void RunGraphs(std::vector<RResultHandle> handles);
+
+/**
+\class ROOT::RDF::RResultHandle
+\ingroup dataframe
+\brief A type-erased version of RResultPtr, e.g. to pass the results of several computation graphs to RunGraphs().
+*/
+class RResultHandle {
+   RDFDetail::RLoopManager *fLoopManager = nullptr; ///< Non-owning pointer to the RLoopManager of the result
+   std::shared_ptr<void> fObjPtr;                    ///< Type-erased shared pointer to the result
+   std::shared_ptr<RDFInternal::RActionBase> fActionPtr; ///< Shared pointer to the action producing the result
+   const std::type_info *fType = nullptr;            ///< The type of the result, checked by GetValue()
+
+   friend void RunGraphs(std::vector<RResultHandle> handles);
+
+   /// Get the pointer to the encapsulated result, triggering the event loop if needed
+   void *Get()
+   {
+      if (!fActionPtr->HasRun())
+         fLoopManager->Run();
+      return fObjPtr.get();
+   }
+
+   /// Throws if the type T is not the type of the encapsulated result
+   template <typename T>
+   void CheckType() const
+   {
+      if (*fType != typeid(T)) {
+         std::stringstream ss;
+         ss << "Got the type " << RDFInternal::TypeID2TypeName(typeid(T)) << " but the RResultHandle refers to a result of type "
+            << RDFInternal::TypeID2TypeName(*fType) << ".";
+         throw std::runtime_error(ss.str());
+      }
+   }
+
+public:
+   template <typename T>
+   RResultHandle(const RResultPtr<T> &resultPtr)
+      : fLoopManager(resultPtr.fLoopManager), fObjPtr(resultPtr.fObjPtr), fActionPtr(resultPtr.fActionPtr),
+        fType(&typeid(T))
+   {
+   }
+
+   RResultHandle(const RResultHandle &) = default;
+   RResultHandle(RResultHandle &&) = default;
+   RResultHandle &operator=(const RResultHandle &) = default;
+   RResultHandle &operator=(RResultHandle &&) = default;
+
+   /// Get a const reference to the encapsulated object. Triggers the event loop if needed.
+   /// Throws if T is not the type of the result.
+   template <typename T>
+   const T &GetValue()
+   {
+      CheckType<T>();
+      return *static_cast<T *>(Get());
+   }
+
+   /// Get the pointer to the encapsulated object. Triggers the event loop if needed.
+   /// Throws if T is not the type of the result.
+   template <typename T>
+   T *GetPtr()
+   {
+      CheckType<T>();
+      return static_cast<T *>(Get());
+   }
+
+   /// Whether the event loop producing the result has already run
+   bool IsReady() const { return fActionPtr->HasRun(); }
+
+   bool operator==(const RResultHandle &rhs) const { return fObjPtr == rhs.fObjPtr; }
+   bool operator!=(const RResultHandle &rhs) const { return !(*this == rhs); }
+};
+
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RRESULTHANDLE
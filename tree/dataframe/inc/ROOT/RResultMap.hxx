@@ -0,0 +1,108 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RRESULTMAP
+#define ROOT_RRESULTMAP
+
+#include "ROOT/RResultPtr.hxx"
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RResultMap
+\ingroup dataframe
+\brief The nominal and varied results of an action, as returned by VariationsFor().
+
+The results are indexed by "nominal" and by "<variation name>:<variation tag>", e.g. "pt:up".
+Accessing any of them triggers the event loop if it has not run yet: all results are filled in the same event loop.
+*/
+template <typename T>
+class RResultMap {
+   std::vector<std::string> fKeys;
+   std::map<std::string, RResultPtr<T>> fResults;
+
+   template <typename T1>
+   friend RResultMap<T1> VariationsFor(RResultPtr<T1> resPtr);
+
+   RResultMap() = default;
+
+   void Add(const std::string &key, RResultPtr<T> result)
+   {
+      fKeys.emplace_back(key);
+      fResults.emplace(key, std::move(result));
+   }
+
+public:
+   /// Return the result of the given variation. Triggers the event loop if needed.
+   T &operator[](const std::string &key)
+   {
+      auto it = fResults.find(key);
+      if (it == fResults.end())
+         throw std::runtime_error("RResultMap: no result for the variation \"" + key + "\"");
+      return *it->second;
+   }
+
+   /// Return the names of the available variations, starting with "nominal".
+   const std::vector<std::string> &GetKeys() const { return fKeys; }
+};
+
+// clang-format off
+////////////////////////////////////////////////////////////////////////////
+/// \brief Book the varied results of an action.
+/// \param[in] resPtr the nominal result of the action, booked downstream of one or more calls to RInterface::Vary().
+/// \return the nominal result and one result per variation that the action depends on.
+///
+/// The varied results are computed in the same event loop as the nominal one, which must not have run yet.
+/// Variations that the action does not depend on are not included in the returned map.
+// clang-format on
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
+{
+   auto &actionPtr = resPtr.fActionPtr;
+   auto *lm = resPtr.fLoopManager;
+   if (actionPtr->HasRun())
+      throw std::runtime_error("VariationsFor: the event loop of the nominal result already ran");
+
+   // the nodes of jitted actions only exist after jitting
+   lm->Jit();
+
+   RResultMap<T> results;
+   results.Add("nominal", resPtr);
+   const auto &variations = lm->GetVariations();
+   for (auto v = 1u; v < variations.size(); ++v) {
+      const auto &name = variations[v].first;
+      if (!actionPtr->DependsOn(name))
+         continue;
+      const auto &factory = actionPtr->GetVariedActionFactory();
+      if (!factory)
+         throw std::runtime_error("VariationsFor: this action does not support systematic variations");
+      // the result is filled starting from a copy of the initial value of the nominal result, e.g. the histogram model
+      auto result = std::make_shared<T>(*resPtr.fObjPtr);
+      std::shared_ptr<RDFInternal::RActionBase> variedAction(factory(result));
+      variedAction->SetVariation(v);
+      lm->Book(variedAction.get());
+      results.Add(name + ":" + variations[v].second, RDFDetail::MakeResultPtr(result, *lm, std::move(variedAction)));
+   }
+   return results;
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RRESULTMAP
@@ -33,6 +33,14 @@ namespace RDF {
 template <typename T>
 class RResultPtr;
 
+class RResultHandle;
+namespace Experimental {
+class RMultiProcessRun;
+template <typename T>
+class RResultMap;
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr);
+} // ns Experimental
 } // ns RDF
 
 namespace Detail {
@@ -94,6 +102,10 @@ class RResultPtr {
    friend bool operator!=(std::nullptr_t lhs, const RResultPtr<T1> &rhs);
 
    friend class ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper;
+   friend class ROOT::RDF::Experimental::RMultiProcessRun;
+   friend class ROOT::RDF::RResultHandle;
+   template <typename T1>
+   friend ROOT::RDF::Experimental::RResultMap<T1> ROOT::RDF::Experimental::VariationsFor(RResultPtr<T1> resPtr);
 
    /// \cond HIDDEN_SYMBOLS
    template <typename V, bool hasBeginEnd = TTraits::HasBeginAndEnd<V>::value>
@@ -53,6 +53,7 @@ public:
    void SetNSlots(unsigned int nSlots);
    void Initialise();
    std::string GetLabel();
+   std::vector<std::string> GetInputFileNames();
 };
 
 RDataFrame MakeRootDataFrame(std::string_view treeName, std::string_view fileNameGlob);
@@ -18,6 +18,12 @@
 namespace ROOT {
 
 namespace RDF {
+/// The data format of the Snapshot output
+enum class ESnapshotOutputFormat {
+   kTTree,  ///< A TTree, written through TFile or, in multi-threaded event loops, through TBufferMerger
+   kRNTuple ///< An RNTuple, written in multi-threaded event loops with one fill context per slot (requires root7)
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -37,6 +43,10 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kTTree; ///< Write a TTree or an RNTuple
+   /// In multi-thread event loops writing a TTree, if non-zero, the output file is written by a dedicated thread, to
+   /// which the slots hand their compressed data: slots only wait for it if this many buffers are already queued
+   unsigned int fOutputQueueDepth = 0;
 };
 } // ns RDF
 } // ns ROOT
@@ -20,6 +20,8 @@
 #include <string>
 #include <vector>
 
+struct sqlite3_stmt;
+
 namespace ROOT {
 
 namespace RDF {
@@ -48,6 +50,12 @@ is used:
   - For expressions ("SELECT 1+1 FROM table"), the type of the first row of the result set determines the column type.
     That can result in a column to be of thought of type NULL where subsequent rows actually have meaningful values.
     The provided SELECT query can be used to avoid such ambiguities.
+
+With several slots, a query reading a single table, like "SELECT a, b+1 FROM table WHERE c > 0" (without aggregate
+functions, DISTINCT, GROUP BY, ORDER BY, LIMIT, joins or sub-queries), is split in ranges of rowids of the table.
+Before the first event loop, the rowids of its rows are read once to define ranges of kRangeSize rows; each slot
+then scans its ranges with its own connection to the file. The other queries, and the ones with at most kRangeSize
+rows, are processed one row at a time.
 */
 class RSqliteDS final : public ROOT::RDF::RDataSource {
 private:
@@ -77,14 +85,35 @@ private:
    };
 
    void SqliteError(int errcode);
+   void FillValues(sqlite3_stmt *stmt, std::vector<Value_t> &values);
+   bool ScanRanges();
 
    std::unique_ptr<Internal::RSqliteDSDataSet> fDataSet;
    unsigned int fNSlots;
    ULong64_t fNRow;
    std::vector<std::string> fColumnNames;
    std::vector<ETypes> fColumnTypes;
-   /// The data source is inherently single-threaded and returns only one row at a time. This vector holds the results.
+   /// Without range scans, the data source returns only one row at a time. This vector holds the results.
    std::vector<Value_t> fValues;
+   /// The values of each slot in the range scans
+   std::vector<std::vector<Value_t>> fSlotValues;
+   /// The cursors returned by GetColumnReadersImpl: for each slot and column, the fPtr of fValues or fSlotValues
+   std::vector<std::vector<void *>> fSlotPtrs;
+
+   /// The query restricted to a range of rowids, empty if the query cannot be split
+   std::string fRangeQuery;
+   /// The query of the rowids of the rows of the query, in increasing order
+   std::string fRowidQuery;
+   /// Whether the rowids were scanned by ScanRanges()
+   bool fRangesScanned;
+   /// The first rowid of each range
+   std::vector<Long64_t> fRangeRowids;
+   /// The number of rows of the query, counted by ScanRanges()
+   ULong64_t fNRangeRows;
+   /// Whether the current event loop uses the range scans
+   bool fUseRanges;
+   /// Whether GetEntryRanges() returned the ranges of the current event loop
+   bool fRangesDone;
 
    // clang-format off
    /// Corresponds to the types defined in ETypes.
@@ -98,6 +127,9 @@ private:
    // clang-format on
 
 public:
+   /// The number of rows of the ranges of the range scans
+   static constexpr ULong64_t kRangeSize = 10000;
+
    RSqliteDS(const std::string &fileName, const std::string &query);
    ~RSqliteDS();
    void SetNSlots(unsigned int nSlots) final;
@@ -107,7 +139,9 @@ public:
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
    void Initialise() final;
+   void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
    std::string GetLabel() final;
+   std::vector<std::string> GetInputFileNames() final;
 
 protected:
    Record_t GetColumnReadersImpl(std::string_view name, const std::type_info &) final;
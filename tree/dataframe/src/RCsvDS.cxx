@@ -65,9 +65,12 @@ double-quote characters must be represented by a pair of double-quote characters
     2000,Mercury,Cougar
 ~~~
 
-The current implementation of RCsvDS reads the entire CSV file content into memory before
-RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
-important to check both how much memory is available and the size of the CSV file.
+The CSV file is read in chunks of `linesChunkSize` lines (the whole file if `linesChunkSize` is -1, the
+default): only the text of the current chunk is kept in memory, and its lines are parsed by the
+processing slots during the event loop, in parallel if implicit multi-threading is enabled. Only the
+columns that the computation graph reads are converted to their type. When reading large files, a
+chunk size of a few times the number of slots times a few thousand lines bounds the memory use without
+slowing down the processing.
 */
 // clang-format on
 
@@ -78,8 +81,8 @@ important to check both how much memory is available and the size of the CSV fil
 #include <TError.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <iostream>
-#include <sstream>
 #include <string>
 
 namespace ROOT {
@@ -110,38 +113,34 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
+/// Read the lines of the next chunk into fBuffer, without parsing them. Empty lines are skipped.
+void RCsvDS::ReadChunk()
 {
-   std::istringstream lineStream(line);
-   auto i = 0U;
-
-   auto columns = ParseColumns(line);
-
-   for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
+   FreeRecords();
 
-      switch (colType) {
-      case 'd': {
-         record.emplace_back(new double(std::stod(col)));
-         break;
-      }
-      case 'l': {
-         record.emplace_back(new Long64_t(std::stoll(col)));
-         break;
-      }
-      case 'b': {
-         auto b = new bool();
-         record.emplace_back(b);
-         std::istringstream is(col);
-         is >> std::boolalpha >> *b;
-         break;
-      }
-      case 's': {
-         record.emplace_back(new std::string(col));
+   const std::size_t blockSize = 1 << 20;
+   auto scanPos = fBufferConsumed; // the position in fBuffer from where to look for the end of the current line
+   while (-1LL == fLinesChunkSize || static_cast<Long64_t>(fLines.size()) < fLinesChunkSize) {
+      const auto newline = fBuffer.find('\n', scanPos);
+      if (newline == std::string::npos) {
+         if (fStream) {
+            const auto oldSize = fBuffer.size();
+            fBuffer.resize(oldSize + blockSize);
+            fStream.read(&fBuffer[oldSize], blockSize);
+            fBuffer.resize(oldSize + fStream.gcount());
+            scanPos = oldSize;
+            continue;
+         }
+         // end of file: the last line might not end with a newline
+         if (fBufferConsumed < fBuffer.size())
+            fLines.emplace_back(fBufferConsumed, fBuffer.size());
+         fBufferConsumed = fBuffer.size();
          break;
       }
-      }
-      ++i;
+      if (newline > fBufferConsumed)
+         fLines.emplace_back(fBufferConsumed, newline);
+      fBufferConsumed = newline + 1;
+      scanPos = fBufferConsumed;
    }
 }
 
@@ -167,6 +166,7 @@ std::vector<void *> RCsvDS::GetColumnReadersImpl(std::string_view colName, const
 
    const auto &colNames = GetColumnNames();
    const auto index = std::distance(colNames.begin(), std::find(colNames.begin(), colNames.end(), colName));
+   fColIsActive[index] = 1;
    std::vector<void *> ret(fNSlots);
    for (auto slot : ROOT::TSeqU(fNSlots)) {
       auto &val = fColAddresses[index][slot];
@@ -228,26 +228,31 @@ std::vector<std::string> RCsvDS::ParseColumns(const std::string &line)
 
 size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &columns, size_t i)
 {
-   std::stringstream val;
+   columns.emplace_back();
+   return ParseField(line.data(), line.size(), i, columns.back());
+}
+
+/// Parse into field the value that starts at position i of the line, return the position of the delimiter after it
+size_t RCsvDS::ParseField(const char *line, size_t size, size_t i, std::string &field) const
+{
+   field.clear();
    bool quoted = false;
 
-   for (; i < line.size(); ++i) {
+   for (; i < size; ++i) {
       if (line[i] == fDelimiter && !quoted) {
          break;
       } else if (line[i] == '"') {
          // Keep just one quote for escaped quotes, none for the normal quotes
-         if (line[i + 1] != '"') {
+         if (i + 1 == size || line[i + 1] != '"') {
             quoted = !quoted;
          } else {
-            val << line[++i];
+            field += line[++i];
          }
       } else {
-         val << line[i];
+         field += line[i];
       }
    }
 
-   columns.emplace_back(val.str());
-
    return i;
 }
 
@@ -258,8 +263,9 @@ size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &col
 ///                        (default `true`).
 /// \param[in] delimiter Delimiter character (default ',').
 RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long64_t linesChunkSize) // TODO: Let users specify types?
-   : fReadHeaders(readHeaders),
-     fStream(std::string(fileName)),
+   : fFileName(fileName),
+     fReadHeaders(readHeaders),
+     fStream(fFileName),
      fDelimiter(delimiter),
      fLinesChunkSize(linesChunkSize)
 {
@@ -292,6 +298,8 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
       // Infer types of columns with first record
       InferColTypes(columns);
 
+      fColIsActive.assign(fHeaders.size(), 0);
+
       // rewind
       fStream.seekg(fDataPos);
    } else {
@@ -301,40 +309,18 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
    }
 }
 
+/// Release the lines of the current chunk. Text already read for the next chunk is kept.
 void RCsvDS::FreeRecords()
 {
-   for (auto &record : fRecords) {
-      for (size_t i = 0; i < record.size(); ++i) {
-         void *p = record[i];
-         const auto colType = fColTypes[fHeaders[i]];
-         switch (colType) {
-         case 'd': {
-            delete static_cast<double *>(p);
-            break;
-         }
-         case 'l': {
-            delete static_cast<Long64_t *>(p);
-            break;
-         }
-         case 'b': {
-            delete static_cast<bool *>(p);
-            break;
-         }
-         case 's': {
-            delete static_cast<std::string *>(p);
-            break;
-         }
-         }
-      }
-   }
-   fRecords.clear();
+   fBuffer.erase(0, fBufferConsumed);
+   fBufferConsumed = 0;
+   fLines.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
 RCsvDS::~RCsvDS()
 {
-   FreeRecords();
 }
 
 void RCsvDS::Finalise()
@@ -343,7 +329,9 @@ void RCsvDS::Finalise()
    fStream.seekg(fDataPos);
    fProcessedLines = 0ULL;
    fEntryRangesRequested = 0ULL;
-   FreeRecords();
+   fBuffer.clear();
+   fBufferConsumed = 0;
+   fLines.clear();
 }
 
 const std::vector<std::string> &RCsvDS::GetColumnNames() const
@@ -354,28 +342,19 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
 
-   // Read records and store them in memory
-   auto linesToRead = fLinesChunkSize;
-   FreeRecords();
-
-   std::string line;
-   while ((-1LL == fLinesChunkSize || 0 != linesToRead) && std::getline(fStream, line)) {
-      if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
-      --linesToRead;
-   }
+   // Read the lines of the next chunk, they are parsed by the slots in SetEntry
+   ReadChunk();
 
    if (gDebug > 0) {
       if (fLinesChunkSize == -1LL) {
-         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fRecords.size());
+         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fLines.size());
       } else {
-         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fRecords.size());
+         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fLines.size());
       }
    }
 
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   const auto nRecords = fRecords.size();
+   const auto nRecords = fLines.size();
    if (0 == nRecords)
       return entryRanges;
 
@@ -392,6 +371,7 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
    }
    entryRanges.back().second += remainder;
 
+   fChunkFirstEntry = fProcessedLines;
    fProcessedLines += nRecords;
    fEntryRangesRequested++;
 
@@ -419,32 +399,57 @@ bool RCsvDS::HasColumn(std::string_view colName) const
    return fHeaders.end() != std::find(fHeaders.begin(), fHeaders.end(), colName);
 }
 
+/// Parse the line of the entry and convert the values of the columns that are read. This is where the parsing of
+/// the file happens: each slot parses its own lines.
 bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   // Here we need to normalise the entry to the number of lines we already processed.
-   const auto offset = (fEntryRangesRequested - 1) * fLinesChunkSize;
-   const auto recordPos = entry - offset;
+   const auto &line = fLines[entry - fChunkFirstEntry];
+   const auto lineBegin = fBuffer.data() + line.first;
+   const auto lineSize = line.second - line.first;
+
+   // Split the line in fields, reusing the strings of the previous line
+   auto &fields = fSlotFields[slot];
+   size_t nFields = 0;
+   for (size_t i = 0; i < lineSize; ++i) {
+      if (nFields == fields.size())
+         fields.emplace_back();
+      i = ParseField(lineBegin, lineSize, i, fields[nFields++]);
+   }
+   if (nFields < fHeaders.size()) {
+      throw std::runtime_error("RCsvDS: the line of entry " + std::to_string(entry) + " has " +
+                               std::to_string(nFields) + " fields instead of " + std::to_string(fHeaders.size()));
+   }
+
    int colIndex = 0;
    for (auto &colType : fColTypesList) {
-      auto dataPtr = fRecords[recordPos][colIndex];
+      if (!fColIsActive[colIndex]) {
+         colIndex++;
+         continue;
+      }
+      auto &field = fields[colIndex];
+      char *end = nullptr;
       switch (colType) {
       case 'd': {
-         fDoubleEvtValues[colIndex][slot] = *static_cast<double *>(dataPtr);
+         fDoubleEvtValues[colIndex][slot] = std::strtod(field.c_str(), &end);
          break;
       }
       case 'l': {
-         fLong64EvtValues[colIndex][slot] = *static_cast<Long64_t *>(dataPtr);
+         fLong64EvtValues[colIndex][slot] = std::strtoll(field.c_str(), &end, 10);
          break;
       }
       case 'b': {
-         fBoolEvtValues[colIndex][slot] = *static_cast<bool *>(dataPtr);
+         fBoolEvtValues[colIndex][slot] = field == "true";
          break;
       }
       case 's': {
-         fStringEvtValues[colIndex][slot] = *static_cast<std::string *>(dataPtr);
+         std::swap(fStringEvtValues[colIndex][slot], field);
          break;
       }
       }
+      if (end == field.c_str()) {
+         throw std::runtime_error("RCsvDS: cannot convert the value \"" + field + "\" of column " +
+                                  fHeaders[colIndex] + " to " + fgColTypeMap.at(colType));
+      }
       colIndex++;
    }
    return true;
@@ -465,6 +470,8 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
    fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
    fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
+
+   fSlotFields.resize(fNSlots);
 }
 
 std::string RCsvDS::GetLabel()
@@ -472,6 +479,11 @@ std::string RCsvDS::GetLabel()
    return "RCsv";
 }
 
+std::vector<std::string> RCsvDS::GetInputFileNames()
+{
+   return {fFileName};
+}
+
 RDataFrame MakeCsvDataFrame(std::string_view fileName, bool readHeaders, char delimiter, Long64_t linesChunkSize)
 {
    ROOT::RDataFrame tdf(std::make_unique<RCsvDS>(fileName, readHeaders, delimiter, linesChunkSize));
@@ -8,7 +8,13 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RDF/ActionHelpers.hxx"
+#include "TROOT.h" // IsImplicitMTEnabled
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 namespace ROOT {
 namespace Internal {
@@ -37,6 +43,26 @@ ULong64_t &CountHelper::PartialUpdate(unsigned int slot)
    return fCounts[slot];
 }
 
+void TreeReduce(unsigned int n, const std::function<void(unsigned int, unsigned int)> &merge)
+{
+   // at each level, the result of index i merges the one of index i + stride: after the last level, the first result
+   // contains all the others
+   for (auto stride = 1u; stride < n; stride *= 2) {
+      std::vector<unsigned int> targets;
+      for (auto i = 0u; i + stride < n; i += 2 * stride)
+         targets.emplace_back(i);
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && targets.size() > 1) {
+         ROOT::TThreadExecutor pool;
+         pool.Foreach([&merge, stride](unsigned int i) { merge(i, i + stride); }, targets);
+         continue;
+      }
+#endif
+      for (auto i : targets)
+         merge(i, i + stride);
+   }
+}
+
 void FillHelper::UpdateMinMax(unsigned int slot, double v)
 {
    auto &thisMin = fMin[slot];
@@ -99,9 +125,13 @@ void FillHelper::Finalize()
       fResultHist->SetBins(fResultHist->GetNbinsX(), globalMin, globalMax);
    }
 
+   // The values of all slots must go through the axis of the result, which can still be extended while filling, so
+   // they are filled sequentially. Each buffer is released as soon as it is filled, to limit the peak memory usage.
    for (unsigned int i = 0; i < fNSlots; ++i) {
       auto weights = fWBuffers[i].empty() ? nullptr : fWBuffers[i].data();
       fResultHist->FillN(fBuffers[i].size(), fBuffers[i].data(), weights);
+      Buf_t().swap(fBuffers[i]);
+      Buf_t().swap(fWBuffers[i]);
    }
 }
 
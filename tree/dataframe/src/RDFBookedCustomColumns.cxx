@@ -1,4 +1,5 @@
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
+#include "ROOT/RDF/RCustomColumnBase.hxx"
 
 namespace ROOT {
 namespace Internal {
@@ -18,6 +19,16 @@ void RBookedCustomColumns::AddColumn(const std::shared_ptr<RDFDetail::RCustomCol
    fCustomColumns = newCols;
 }
 
+bool RBookedCustomColumns::DependsOn(const ColumnNames_t &names, const std::string &variation) const
+{
+   for (const auto &name : names) {
+      const auto it = fCustomColumns->find(name);
+      if (it != fCustomColumns->end() && it->second->DependsOn(variation))
+         return true;
+   }
+   return false;
+}
+
 void RBookedCustomColumns::AddName(std::string_view name)
 {
    auto newColsNames = std::make_shared<ColumnNames_t>(GetNames());
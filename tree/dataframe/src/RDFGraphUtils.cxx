@@ -90,6 +90,7 @@ CreateDefineNode(const std::string &columnName, const ROOT::Detail::RDF::RCustom
 
    auto node = std::make_shared<GraphNode>("Define\n" + columnName);
    node->SetDefine();
+   node->AddProfile(columnPtr->GetProfile().GetSummary());
 
    sColumnsMap[columnPtr] = node;
    return node;
@@ -110,6 +111,7 @@ std::shared_ptr<GraphNode> CreateFilterNode(const ROOT::Detail::RDF::RFilterBase
 
    sFiltersMap[filterPtr] = node;
    node->SetFilter();
+   node->AddProfile(filterPtr->GetProfile().GetSummary());
    return node;
 }
 
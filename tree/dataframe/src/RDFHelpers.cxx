@@ -0,0 +1,71 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RConfigure.h" // R__USE_IMT
+#include "ROOT/RDFHelpers.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "TError.h" // Warning
+#include "TROOT.h"  // IsImplicitMTEnabled
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
+
+#include <exception>
+#include <mutex>
+#include <set>
+#include <vector>
+
+void ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
+{
+   if (handles.empty()) {
+      Warning("RunGraphs", "Got an empty list of handles");
+      return;
+   }
+
+   // Collect the loop managers that still have to run, in the order of the handles
+   std::vector<RDFDetail::RLoopManager *> loopManagers;
+   std::set<RDFDetail::RLoopManager *> seen;
+   for (auto &h : handles) {
+      if (h.IsReady() || !seen.insert(h.fLoopManager).second)
+         continue;
+      loopManagers.emplace_back(h.fLoopManager);
+   }
+   if (loopManagers.empty())
+      return;
+
+   // The jitted code of all the computation graphs is queued in the same place: one call compiles all of it, before
+   // the event loops start concurrently
+   loopManagers[0]->Jit();
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && loopManagers.size() > 1) {
+      std::exception_ptr firstError;
+      std::mutex errorMutex;
+      ROOT::Experimental::TTaskGroup tg;
+      for (auto lm : loopManagers) {
+         tg.Run([lm, &firstError, &errorMutex] {
+            try {
+               lm->Run();
+            } catch (...) {
+               std::lock_guard<std::mutex> lock(errorMutex);
+               if (!firstError)
+                  firstError = std::current_exception();
+            }
+         });
+      }
+      tg.Wait();
+      if (firstError)
+         std::rethrow_exception(firstError);
+      return;
+   }
+#endif
+
+   for (auto lm : loopManagers)
+      lm->Run();
+}
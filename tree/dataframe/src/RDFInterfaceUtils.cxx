@@ -11,18 +11,24 @@
 #include <ROOT/RDF/InterfaceUtils.hxx>
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RDF/RInterface.hxx>
+#ifdef R__HAS_ROOT7
+#include <ROOT/RNTupleDS.hxx>
+#endif
 #include <ROOT/RStringView.hxx>
 #include <ROOT/TSeq.hxx>
 #include <RtypesCore.h>
 #include <TDirectory.h>
 #include <TChain.h>
+#include <TChainElement.h>
 #include <TClass.h>
 #include <TClassEdit.h>
 #include <TFriendElement.h>
 #include <TInterpreter.h>
+#include <TMD5.h>
 #include <TObject.h>
 #include <TPRegexp.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 
 // pragma to disable warnings on Rcpp which have
@@ -38,6 +44,7 @@
 #endif
 
 #include <algorithm>
+#include <mutex>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -190,6 +197,34 @@ static std::unordered_map<std::string, std::string> &GetJittedExprs() {
    return jittedExpressions;
 }
 
+static bool &IsJitDeclarationBatchingEnabledRef()
+{
+   static bool isEnabled = false;
+   return isEnabled;
+}
+
+/// Lambda declarations that are not yet known to the interpreter, used if declaration batching is enabled.
+/// The expressions are already registered in GetJittedExprs() so that duplicates are declared only once.
+struct RPendingDeclarations {
+   std::string fCode;
+   std::vector<std::string> fExprs; ///< The keys of the pending lambdas in GetJittedExprs()
+};
+
+static RPendingDeclarations &GetPendingDeclarations()
+{
+   static RPendingDeclarations pendingDeclarations;
+   return pendingDeclarations;
+}
+
+/// Protects GetJittedExprs() and GetPendingDeclarations(), used by computation graphs built by different threads.
+/// It is held while the lambdas are declared, so that a lambda found in GetJittedExprs() is either known to the
+/// interpreter or pending.
+static std::mutex &GetJittedExprsMutex()
+{
+   static std::mutex mutex;
+   return mutex;
+}
+
 static std::string
 BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
 {
@@ -219,9 +254,12 @@ BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const Colu
 
 /// Declare a lambda expression to the interpreter in namespace __rdf, return the name of the jitted lambda.
 /// If the lambda expression is already in GetJittedExprs, return the name for the lambda that has already been jitted.
+/// If declaration batching is enabled, the declaration is only queued; it reaches the interpreter together with the
+/// other queued declarations by JitPendingDeclarations().
 static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
 {
    const auto lambdaExpr = BuildLambdaString(expr, vars, varTypes);
+   std::lock_guard<std::mutex> lock(GetJittedExprsMutex());
    auto &exprMap = GetJittedExprs();
    const auto exprIt = exprMap.find(lambdaExpr);
    if (exprIt != exprMap.end()) {
@@ -236,7 +274,14 @@ static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &v
 
    const auto toDeclare = "namespace __rdf {\nauto " + lambdaBaseName + " = " + lambdaExpr + ";\nusing " +
                           lambdaBaseName + "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" +
-                          lambdaBaseName + ")>::ret_type;\n}";
+                          lambdaBaseName + ")>::ret_type;\n}\n";
+   if (IsJitDeclarationBatchingEnabledRef()) {
+      auto &pending = GetPendingDeclarations();
+      pending.fCode += toDeclare;
+      pending.fExprs.emplace_back(lambdaExpr);
+      exprMap.insert({lambdaExpr, lambdaFullName});
+      return lambdaFullName;
+   }
    ROOT::Internal::RDF::InterpreterDeclare(toDeclare.c_str());
 
    // InterpreterDeclare could throw. If it doesn't, mark the lambda as already jitted
@@ -249,6 +294,8 @@ static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &v
 /// Resolve that alias and return the true type as string.
 static std::string RetTypeOfLambda(const std::string &lambdaName)
 {
+   // The lambda must be known to the interpreter
+   ROOT::Internal::RDF::JitPendingDeclarations();
    auto *ti = gInterpreter->TypedefInfo_Factory((lambdaName + "_ret_t").c_str());
    const char *type = gInterpreter->TypedefInfo_TrueName(ti);
    return type;
@@ -327,6 +374,28 @@ namespace RDF {
 // the one in the vector
 class RActionBase;
 
+void JitPendingDeclarations()
+{
+   std::lock_guard<std::mutex> lock(GetJittedExprsMutex());
+   auto &pending = GetPendingDeclarations();
+   if (pending.fCode.empty())
+      return;
+
+   const auto code = std::move(pending.fCode);
+   const auto exprs = std::move(pending.fExprs);
+   pending.fCode.clear();
+   pending.fExprs.clear();
+   try {
+      InterpreterDeclare(code);
+   } catch (...) {
+      // None of the queued lambdas can be trusted to exist
+      auto &exprMap = GetJittedExprs();
+      for (const auto &expr : exprs)
+         exprMap.erase(expr);
+      throw;
+   }
+}
+
 HeadNode_t CreateSnapshotRDF(const ColumnNames_t &validCols,
                             std::string_view treeName,
                             std::string_view fileName,
@@ -345,6 +414,110 @@ HeadNode_t CreateSnapshotRDF(const ColumnNames_t &validCols,
    return snapshotRDFResPtr;
 }
 
+std::string GetPersistentCachePath(RLoopManager &loopManager, RNodeBase &node,
+                                   const RBookedCustomColumns &customColumns, const ColumnNames_t &columnNames,
+                                   const std::vector<std::string> &columnTypes, std::string_view key,
+                                   std::string_view cacheDir)
+{
+   // The identity of the input data set: the tree name and the input files with their sizes and modification times
+   std::string identity;
+   std::vector<std::string> fileNames;
+   if (auto tree = loopManager.GetTree()) {
+      identity = std::string("tree:") + tree->GetName();
+      if (auto chain = dynamic_cast<TChain *>(tree)) {
+         for (auto element : ROOT::Detail::TRangeStaticCast<TChainElement>(*chain->GetListOfFiles()))
+            fileNames.emplace_back(element->GetTitle());
+      } else if (auto file = tree->GetCurrentFile()) {
+         fileNames.emplace_back(file->GetName());
+      }
+   } else if (auto ds = loopManager.GetDataSource()) {
+      identity = "datasource:" + ds->GetLabel();
+      fileNames = ds->GetInputFileNames();
+   } else {
+      identity = "empty:" + std::to_string(loopManager.GetNEmptyEntries());
+   }
+   for (const auto &fileName : fileNames) {
+      identity += "\nfile:" + fileName;
+      FileStat_t fileStat;
+      if (gSystem->GetPathInfo(fileName.c_str(), fileStat) == 0)
+         identity += ":" + std::to_string(fileStat.fSize) + ":" + std::to_string(fileStat.fMtime);
+   }
+   identity += "\nkey:" + std::string(key);
+   for (std::size_t i = 0; i < columnNames.size(); ++i)
+      identity += "\ncolumn:" + columnNames[i] + ":" + columnTypes[i];
+
+   // The text of the jitted Filters and Defines: compiled callables cannot be hashed, but expressions can
+   std::vector<std::string> filterExpressions;
+   node.AddFilterExpressions(filterExpressions);
+   for (const auto &expression : filterExpressions)
+      identity += "\nfilter:" + expression;
+   for (const auto &column : customColumns.GetColumns()) {
+      if (auto jittedColumn = dynamic_cast<RJittedCustomColumn *>(column.second.get()))
+         identity += "\ndefine:" + column.first + ":" + jittedColumn->GetExpression();
+   }
+
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(identity.data()), identity.size());
+   md5.Final();
+
+   // By default, the cache is stored next to the (local) input files
+   std::string dir(cacheDir);
+   if (dir.empty()) {
+      if (!fileNames.empty() && (fileNames[0].find("://") == std::string::npos))
+         dir = gSystem->GetDirName(fileNames[0].c_str()).Data();
+      else
+         dir = ".";
+   }
+   return dir + "/rdfcache_" + md5.AsString() + ".root";
+}
+
+bool IsPersistentCacheAvailable(const std::string &path)
+{
+   // Note: AccessPathName returns false if the file exists
+   return !gSystem->AccessPathName(path.c_str());
+}
+
+std::string GetPersistentCacheTmpPath(const std::string &path)
+{
+   return path + "." + std::to_string(gSystem->GetPid()) + ".tmp.root";
+}
+
+void CommitPersistentCache(const std::string &tmpPath, const std::string &path)
+{
+   if (gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0) {
+      gSystem->Unlink(tmpPath.c_str());
+      if (!IsPersistentCacheAvailable(path))
+         throw std::runtime_error("PersistentCache: cannot store the cache file " + path);
+   }
+}
+
+RInterface<RLoopManager, void> OpenPersistentCache(const std::string &path)
+{
+   ::TDirectory::TContext ctxt;
+   ROOT::RDataFrame cachedRDF(kPersistentCacheTreeName, path);
+   return cachedRDF;
+}
+
+#ifdef R__HAS_ROOT7
+HeadNode_t CreateSnapshotRNTupleRDF(const ColumnNames_t &validCols,
+                                   std::string_view ntupleName,
+                                   std::string_view fileName,
+                                   bool isLazy,
+                                   RLoopManager &loopManager,
+                                   std::unique_ptr<RDFInternal::RActionBase> actionPtr)
+{
+   // create new RDF; the ntuple does not exist yet, the data source opens it on first use
+   auto ds = std::make_unique<ROOT::Experimental::RNTupleDS>(ntupleName, fileName);
+   auto snapshotRDF = std::make_shared<ROOT::RDataFrame>(std::move(ds), validCols);
+   auto snapshotRDFResPtr = MakeResultPtr(snapshotRDF, loopManager, std::move(actionPtr));
+
+   if (!isLazy) {
+      *snapshotRDFResPtr;
+   }
+   return snapshotRDFResPtr;
+}
+#endif
+
 std::string DemangleTypeIdName(const std::type_info &typeInfo)
 {
    int dummy(0);
@@ -545,10 +718,8 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
       ParseRDFExpression(std::string(expression), branches, customCols.GetNames(), dsColumns, aliasMap);
    const auto exprVarTypes =
       GetValidatedArgTypes(parsedExpr.fUsedCols, customCols, tree, ds, "Filter", /*vector2rvec=*/true);
+   // The return type is checked by JitFilterHelper; not resolving it here allows for batching the declarations
    const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
-   const auto type = RetTypeOfLambda(lambdaName);
-   if (type != "bool")
-      std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
    // columnsOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RBookedCustomColumns *columnsOnHeap = new ROOT::Internal::RDF::RBookedCustomColumns(customCols);
@@ -597,7 +768,7 @@ std::shared_ptr<RJittedCustomColumn> BookDefineJit(std::string_view name, std::s
 
    auto customColumnsCopy = new RDFInternal::RBookedCustomColumns(customCols);
    auto customColumnsAddr = PrettyPrintAddr(customColumnsCopy);
-   auto jittedCustomColumn = std::make_shared<RDFDetail::RJittedCustomColumn>(name, type, lm.GetNSlots());
+   auto jittedCustomColumn = std::make_shared<RDFDetail::RJittedCustomColumn>(name, type, lm.GetNSlots(), expression);
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper(" << lambdaName << ", {";
@@ -764,3 +935,15 @@ std::vector<bool> FindUndefinedDSColumns(const ColumnNames_t &requestedCols, con
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
+
+void ROOT::RDF::EnableJitDeclarationBatching(bool enable)
+{
+   if (!enable)
+      ROOT::Internal::RDF::JitPendingDeclarations();
+   IsJitDeclarationBatchingEnabledRef() = enable;
+}
+
+bool ROOT::RDF::IsJitDeclarationBatchingEnabled()
+{
+   return IsJitDeclarationBatchingEnabledRef();
+}
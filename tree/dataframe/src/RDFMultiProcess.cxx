@@ -0,0 +1,197 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDFMultiProcess.hxx"
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/TProcessExecutor.hxx"
+#include "TChain.h"
+#include "TObjString.h"
+#include "TTree.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+using EntryRange_t = std::pair<ULong64_t, ULong64_t>;
+
+/// The name of the list sent back by a worker whose event loop failed; the list contains the error message
+const char *const kErrorListName = "error";
+
+/// Add the cluster boundaries of the tree to boundaries, shifted by offset
+void AddClusterBoundaries(TTree &tree, Long64_t offset, std::set<ULong64_t> &boundaries)
+{
+   const auto nEntries = tree.GetEntries();
+   auto clusterIter = tree.GetClusterIterator(0);
+   Long64_t start;
+   while ((start = clusterIter.Next()) < nEntries) {
+      boundaries.insert(offset + start);
+      boundaries.insert(offset + clusterIter.GetNextEntry());
+   }
+}
+
+/// Returns the possible boundaries of the entry ranges of the workers, including 0 and the number of entries
+std::vector<ULong64_t> GetEntryBoundaries(ROOT::Detail::RDF::RLoopManager &loopManager)
+{
+   std::set<ULong64_t> boundaries{0};
+   if (loopManager.GetDataSource())
+      throw std::runtime_error("RMultiProcessRun: data sources are not supported");
+
+   if (auto tree = loopManager.GetTree()) {
+      if (tree->GetEntryList())
+         throw std::runtime_error("RMultiProcessRun: trees with an entry list are not supported");
+      const auto nEntries = tree->GetEntries();
+      if (auto chain = dynamic_cast<TChain *>(tree)) {
+         const auto offsets = chain->GetTreeOffset();
+         for (Int_t i = 0; i < chain->GetNtrees(); ++i) {
+            boundaries.insert(offsets[i]);
+            if (chain->LoadTree(offsets[i]) < 0 || !chain->GetTree())
+               continue;
+            AddClusterBoundaries(*chain->GetTree(), offsets[i], boundaries);
+         }
+      } else {
+         AddClusterBoundaries(*tree, 0, boundaries);
+      }
+      boundaries.insert(nEntries);
+      // Cluster boundaries might exceed the number of entries of the last tree
+      boundaries.erase(boundaries.upper_bound(nEntries), boundaries.end());
+   } else {
+      // Any entry of an empty source can start a new range
+      boundaries.insert(loopManager.GetNEmptyEntries());
+   }
+   return std::vector<ULong64_t>(boundaries.begin(), boundaries.end());
+}
+
+/// Splits the data set in (at most) nRanges entry ranges of similar size, aligned with the entry boundaries
+std::vector<EntryRange_t> GetEntryRanges(ROOT::Detail::RDF::RLoopManager &loopManager, unsigned int nRanges)
+{
+   const auto boundaries = GetEntryBoundaries(loopManager);
+   const auto nEntries = boundaries.back();
+   const bool isEmptySource = loopManager.GetTree() == nullptr;
+
+   std::vector<EntryRange_t> ranges;
+   ULong64_t begin = 0;
+   for (unsigned int i = 1; i <= nRanges && begin < nEntries; ++i) {
+      const ULong64_t target = nEntries * i / nRanges;
+      ULong64_t end = target;
+      if (!isEmptySource)
+         end = *std::lower_bound(boundaries.begin(), boundaries.end(), target);
+      if (end <= begin)
+         continue;
+      ranges.emplace_back(begin, end);
+      begin = end;
+   }
+   return ranges;
+}
+
+} // anonymous namespace
+
+ROOT::RDF::Experimental::RMultiProcessRun::RMultiProcessRun(unsigned int nWorkers, unsigned int maxRetries)
+   : fNWorkers(nWorkers), fMaxRetries(maxRetries)
+{
+   if (fNWorkers == 0)
+      fNWorkers = ROOT::TProcessExecutor().GetNWorkers();
+}
+
+void ROOT::RDF::Experimental::RMultiProcessRun::Run()
+{
+   if (fResults.empty())
+      return;
+
+   auto loopManager = fResults[0].fLoopManager;
+   std::set<RDFInternal::RActionBase *> actions;
+   for (const auto &result : fResults) {
+      if (result.fLoopManager != loopManager)
+         throw std::invalid_argument("RMultiProcessRun: all results must belong to the same computation graph");
+      if (result.fAction->HasRun())
+         throw std::invalid_argument("RMultiProcessRun: the event loop of the results has already run");
+      actions.insert(result.fAction);
+   }
+   for (auto action : loopManager->GetBookedActions()) {
+      if (actions.count(action) == 0)
+         throw std::invalid_argument("RMultiProcessRun: all the results booked on the computation graph must be added");
+   }
+   if (loopManager->HasRanges())
+      throw std::runtime_error("RMultiProcessRun: Range() is not supported");
+
+   // Create the jitted nodes once, before forking
+   loopManager->Jit();
+
+   const auto ranges = GetEntryRanges(*loopManager, fNWorkers);
+   const auto nResults = fResults.size();
+   auto worker = [&](unsigned int rangeIdx) {
+      auto partials = new TList();
+      try {
+         // The worker runs in sequence; implicit multi-threading is not safe in a forked process
+         if (auto tree = loopManager->GetTree())
+            tree->SetImplicitMT(false);
+         loopManager->RunEntryRange(ranges[rangeIdx].first, ranges[rangeIdx].second);
+         partials->SetName(std::to_string(rangeIdx).c_str());
+         for (const auto &result : fResults)
+            partials->Add(result.fSerializer());
+      } catch (const std::exception &e) {
+         partials->Delete();
+         partials->SetName(kErrorListName);
+         partials->Add(new TObjString(e.what()));
+      }
+      return partials;
+   };
+
+   // One list of partial results per entry range
+   std::vector<std::unique_ptr<TList>> partialsPerRange(ranges.size());
+   std::vector<unsigned int> pendingRanges;
+   for (unsigned int i = 0; i < ranges.size(); ++i)
+      pendingRanges.emplace_back(i);
+
+   for (unsigned int attempt = 0; attempt <= fMaxRetries && !pendingRanges.empty(); ++attempt) {
+      ROOT::TProcessExecutor pool(std::min<unsigned int>(fNWorkers, pendingRanges.size()));
+      auto received = pool.Map(worker, pendingRanges);
+
+      std::string errorMessage;
+      for (auto partials : received) {
+         if (!partials)
+            continue;
+         std::unique_ptr<TList> owner(partials);
+         owner->SetOwner(kTRUE);
+         if (std::string(owner->GetName()) == kErrorListName) {
+            errorMessage = static_cast<TObjString *>(owner->First())->GetString().Data();
+            continue;
+         }
+         const auto rangeIdx = std::strtoul(owner->GetName(), nullptr, 10);
+         if (rangeIdx < ranges.size() && static_cast<std::size_t>(owner->GetSize()) == nResults)
+            partialsPerRange[rangeIdx] = std::move(owner);
+      }
+      if (!errorMessage.empty())
+         throw std::runtime_error("RMultiProcessRun: a worker failed: " + errorMessage);
+
+      // Lost workers leave their range unprocessed
+      pendingRanges.clear();
+      for (unsigned int i = 0; i < ranges.size(); ++i) {
+         if (!partialsPerRange[i])
+            pendingRanges.emplace_back(i);
+      }
+   }
+   if (!pendingRanges.empty()) {
+      throw std::runtime_error("RMultiProcessRun: " + std::to_string(pendingRanges.size()) +
+                               " entry range(s) could not be processed after " + std::to_string(fMaxRetries) +
+                               " retries");
+   }
+
+   for (std::size_t i = 0; i < nResults; ++i) {
+      TList partials;
+      for (const auto &rangePartials : partialsPerRange)
+         partials.Add(rangePartials->At(i));
+      fResults[i].fMerger(partials);
+   }
+   loopManager->MarkActionsAsRun();
+}
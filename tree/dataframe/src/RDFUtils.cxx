@@ -264,6 +264,18 @@ unsigned int GetNSlots()
    return nSlots;
 }
 
+unsigned int &GetBulkSizeRef()
+{
+   static unsigned int bulkSize = 0;
+   return bulkSize;
+}
+
+bool &GetSharedFillRef()
+{
+   static bool sharedFill = false;
+   return sharedFill;
+}
+
 /// Replace occurrences of '.' with '_' in each string passed as argument.
 /// An Info message is printed when this happens. Dots at the end of the string are not replaced.
 /// An exception is thrown in case the resulting set of strings would contain duplicates.
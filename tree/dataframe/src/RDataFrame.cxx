@@ -971,6 +971,26 @@ RDataFrame::RDataFrame(std::unique_ptr<ROOT::RDF::RDataSource> ds, const ColumnN
 {
 }
 
+void RDF::SetBulkSize(unsigned int bulkSize)
+{
+   RDFInternal::GetBulkSizeRef() = bulkSize;
+}
+
+unsigned int RDF::GetBulkSize()
+{
+   return RDFInternal::GetBulkSizeRef();
+}
+
+void RDF::EnableSharedFill(bool enable)
+{
+   RDFInternal::GetSharedFillRef() = enable;
+}
+
+bool RDF::IsSharedFillEnabled()
+{
+   return RDFInternal::GetSharedFillRef();
+}
+
 } // namespace ROOT
 
 namespace cling {
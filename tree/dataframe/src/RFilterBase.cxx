@@ -16,7 +16,7 @@ using namespace ROOT::Detail::RDF;
 
 RFilterBase::RFilterBase(RLoopManager *implPtr, std::string_view name, const unsigned int nSlots,
                          const RDFInternal::RBookedCustomColumns &customColumns)
-   : RNodeBase(implPtr), fLastResult(nSlots), fAccepted(nSlots), fRejected(nSlots), fName(name), fNSlots(nSlots),
+   : RNodeBase(implPtr), fNominalStates(nSlots), fLastResult(nSlots), fAccepted(nSlots), fRejected(nSlots), fName(name), fNSlots(nSlots),
      fCustomColumns(customColumns) {}
 
 // outlined to pin virtual table
@@ -47,3 +47,23 @@ void RFilterBase::InitNode()
    if (!fName.empty()) // if this is a named filter we care about its report count
       ResetReportCount();
 }
+
+/// Save the cached result and the report counts of the slot before the filter is evaluated for the variations
+void RFilterBase::SaveNominalState(unsigned int slot)
+{
+   auto &state = fNominalStates[slot];
+   state.fLastCheckedEntry = fLastCheckedEntry[slot];
+   state.fLastResult = fLastResult[slot];
+   state.fAccepted = fAccepted[slot];
+   state.fRejected = fRejected[slot];
+}
+
+/// Restore the state saved by SaveNominalState(), so that the evaluations for the variations do not count in reports
+void RFilterBase::RestoreNominalState(unsigned int slot)
+{
+   const auto &state = fNominalStates[slot];
+   fLastCheckedEntry[slot] = state.fLastCheckedEntry;
+   fLastResult[slot] = state.fLastResult;
+   fAccepted[slot] = state.fAccepted;
+   fRejected[slot] = state.fRejected;
+}
@@ -82,6 +82,49 @@ void RJittedAction::ClearValueReaders(unsigned int slot)
    return fConcreteAction->ClearValueReaders(slot);
 }
 
+bool RJittedAction::DependsOn(const std::string &variation) const
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->DependsOn(variation);
+}
+
+void RJittedAction::AddVariedFilters(const std::string &variation,
+                                     std::vector<ROOT::Detail::RDF::RFilterBase *> &filters)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->AddVariedFilters(variation, filters);
+}
+
+void RJittedAction::SetVariedActionFactory(VariedActionFactory_t factory)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->SetVariedActionFactory(std::move(factory));
+}
+
+const RJittedAction::VariedActionFactory_t &RJittedAction::GetVariedActionFactory() const
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetVariedActionFactory();
+}
+
+std::string RJittedAction::GetActionName()
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetActionName();
+}
+
+void RJittedAction::SetProfiler(ROOT::Internal::RDF::RProfiler *profiler)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->SetProfiler(profiler);
+}
+
+const ROOT::Internal::RDF::RNodeProfile &RJittedAction::GetProfile() const
+{
+   // an action that was never jitted was never profiled either
+   return fConcreteAction ? fConcreteAction->GetProfile() : fProfile;
+}
+
 std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RJittedAction::GetGraph()
 {
    R__ASSERT(fConcreteAction != nullptr);
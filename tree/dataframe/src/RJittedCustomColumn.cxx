@@ -42,3 +42,27 @@ void RJittedCustomColumn::ClearValueReaders(unsigned int slot)
    R__ASSERT(fConcreteCustomColumn != nullptr);
    fConcreteCustomColumn->ClearValueReaders(slot);
 }
+
+bool RJittedCustomColumn::DependsOn(const std::string &variation) const
+{
+   // The branch of the computation graph that needed this column might have gone out of scope before jitting
+   return fConcreteCustomColumn != nullptr && fConcreteCustomColumn->DependsOn(variation);
+}
+
+void RJittedCustomColumn::ResetCache(unsigned int slot)
+{
+   R__ASSERT(fConcreteCustomColumn != nullptr);
+   fConcreteCustomColumn->ResetCache(slot);
+}
+
+void RJittedCustomColumn::SetProfiler(RDFInternal::RProfiler *profiler)
+{
+   R__ASSERT(fConcreteCustomColumn != nullptr);
+   fConcreteCustomColumn->SetProfiler(profiler);
+}
+
+const RDFInternal::RNodeProfile &RJittedCustomColumn::GetProfile() const
+{
+   // a column that was never jitted was never profiled either
+   return fConcreteCustomColumn ? fConcreteCustomColumn->GetProfile() : fProfile;
+}
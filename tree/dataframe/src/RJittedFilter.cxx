@@ -15,8 +15,8 @@
 
 using namespace ROOT::Detail::RDF;
 
-RJittedFilter::RJittedFilter(RLoopManager *lm, std::string_view name)
-   : RFilterBase(lm, name, lm->GetNSlots(), RDFInternal::RBookedCustomColumns()) { }
+RJittedFilter::RJittedFilter(RLoopManager *lm, std::string_view name, std::string_view expression)
+   : RFilterBase(lm, name, lm->GetNSlots(), RDFInternal::RBookedCustomColumns()), fExpression(expression) { }
 
 void RJittedFilter::SetFilter(std::unique_ptr<RFilterBase> f)
 {
@@ -77,6 +77,12 @@ void RJittedFilter::TriggerChildrenCount()
    fConcreteFilter->TriggerChildrenCount();
 }
 
+bool RJittedFilter::IsActive() const
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->IsActive();
+}
+
 void RJittedFilter::ResetReportCount()
 {
    R__ASSERT(fConcreteFilter != nullptr);
@@ -110,6 +116,58 @@ void RJittedFilter::AddFilterName(std::vector<std::string> &filters)
    fConcreteFilter->AddFilterName(filters);
 }
 
+void RJittedFilter::AddFilterExpressions(std::vector<std::string> &expressions)
+{
+   if (fConcreteFilter == nullptr) {
+      // No event loop performed yet, but the JITTING must be performed.
+      GetLoopManagerUnchecked()->Jit();
+   }
+   fConcreteFilter->AddFilterExpressions(expressions);
+   expressions.emplace_back(fExpression);
+}
+
+bool RJittedFilter::DependsOn(const std::string &variation) const
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->DependsOn(variation);
+}
+
+void RJittedFilter::AddVariedFilters(const std::string &variation, std::vector<RFilterBase *> &filters)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   fConcreteFilter->AddVariedFilters(variation, filters);
+}
+
+void RJittedFilter::ResetCache(unsigned int slot)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   fConcreteFilter->ResetCache(slot);
+}
+
+void RJittedFilter::SaveNominalState(unsigned int slot)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   fConcreteFilter->SaveNominalState(slot);
+}
+
+void RJittedFilter::RestoreNominalState(unsigned int slot)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   fConcreteFilter->RestoreNominalState(slot);
+}
+
+void RJittedFilter::SetProfiler(RDFInternal::RProfiler *profiler)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   fConcreteFilter->SetProfiler(profiler);
+}
+
+const RDFInternal::RNodeProfile &RJittedFilter::GetProfile() const
+{
+   // a filter that was never jitted was never profiled either
+   return fConcreteFilter ? fConcreteFilter->GetProfile() : fProfile;
+}
+
 std::shared_ptr<RDFGraphDrawing::GraphNode> RJittedFilter::GetGraph()
 {
    if (fConcreteFilter != nullptr) {
@@ -1,8 +1,11 @@
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RDF/GraphNode.hxx"
+#include "ROOT/RDF/InterfaceUtils.hxx" // JitPendingDeclarations
 #include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RCustomColumnBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RSlotStack.hxx"
 #include "RtypesCore.h" // Long64_t
@@ -19,11 +22,17 @@
 #include "ROOT/TTreeProcessorMT.hxx"
 #endif
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <exception>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -34,15 +43,27 @@ using namespace ROOT::Detail::RDF;
 using namespace ROOT::Internal::RDF;
 
 namespace {
-/// A helper function that returns all RDF code that is currently scheduled for just-in-time compilation.
-/// This allows different RLoopManager instances to share these data.
+/// All RDF code that is currently scheduled for just-in-time compilation, shared by all RLoopManager instances.
 /// We want RLoopManagers to be able to add their code to a global "code to execute via cling",
 /// so that, lazily, we can jit everything that's needed by all RDFs in one go, which is potentially
 /// much faster than jitting each RLoopManager's code separately.
-static std::string &GetCodeToJit()
+/// RLoopManagers used concurrently by different threads share it too: the code is compiled in batches, each batch
+/// holding everything queued so far. While a thread compiles a batch, the threads that need code queued in the
+/// meantime wait and then compile all of it in the next batch, instead of queueing one by one on the interpreter lock.
+struct RJitQueue {
+   std::mutex fMutex;                       ///< Protects the other data members
+   std::condition_variable fBatchCompiled;  ///< Notified when a batch is compiled
+   std::string fCode;                       ///< Code queued for batch fNextBatch
+   unsigned long fNextBatch = 1;            ///< Id of the batch fCode is queued for
+   unsigned long fLastCompiledBatch = 0;    ///< All the batches up to this id are compiled, or failed to compile
+   bool fIsCompiling = false;               ///< Whether batch fLastCompiledBatch+1 is being compiled
+   std::map<unsigned long, std::exception_ptr> fFailedBatches; ///< Error of the batches that failed to compile
+};
+
+static RJitQueue &GetJitQueue()
 {
-   static std::string code;
-   return code;
+   static RJitQueue queue;
+   return queue;
 }
 
 static bool ContainsLeaf(const std::set<TLeaf *> &leaves, TLeaf *leaf)
@@ -304,12 +325,13 @@ void RLoopManager::RunEmptySourceMT()
 #endif // not implemented otherwise
 }
 
-/// Run event loop with no source files, in sequence.
-void RLoopManager::RunEmptySource()
+/// Run event loop with no source files, in sequence, over the entries in [beginEntry, endEntry).
+void RLoopManager::RunEmptySource(ULong64_t beginEntry, ULong64_t endEntry)
 {
    InitNodeSlots(nullptr, 0);
+   endEntry = std::min(endEntry, fNEmptyEntries);
    try {
-      for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
+      for (ULong64_t currEntry = beginEntry; currEntry < endEntry && fNStopsReceived < fNChildren; ++currEntry) {
          RunAndCheckFilters(0, currEntry);
       }
    } catch (...) {
@@ -339,7 +361,7 @@ void RLoopManager::RunTreeProcessorMT()
       auto count = entryCount.fetch_add(nEntries);
       try {
          // recursive call to check filters and conditionally execute actions
-         while (r.Next()) {
+         while (ReadNextEntry(r, slot)) {
             RunAndCheckFilters(slot, count++);
          }
       } catch (...) {
@@ -354,18 +376,21 @@ void RLoopManager::RunTreeProcessorMT()
 }
 
 /// Run event loop over one or multiple ROOT files, in sequence.
-void RLoopManager::RunTreeReader()
+void RLoopManager::RunTreeReader(ULong64_t beginEntry, ULong64_t endEntry)
 {
    CheckIndexedFriends();
    TTreeReader r(fTree.get(), fTree->GetEntryList());
    if (0 == fTree->GetEntriesFast())
       return;
+   const bool hasEntryRange = (beginEntry > 0) || (endEntry != std::numeric_limits<ULong64_t>::max());
+   if (hasEntryRange)
+      r.SetEntriesRange(beginEntry, endEntry);
    InitNodeSlots(&r, 0);
 
    // recursive call to check filters and conditionally execute actions
    // in the non-MT case processing can be stopped early by ranges, hence the check on fNStopsReceived
    try {
-      while (r.Next() && fNStopsReceived < fNChildren) {
+      while (ReadNextEntry(r, 0) && fNStopsReceived < fNChildren) {
          RunAndCheckFilters(0, r.GetCurrentEntry());
       }
    } catch (...) {
@@ -373,7 +398,8 @@ void RLoopManager::RunTreeReader()
       std::cerr << "RDataFrame::Run: event was loop interrupted\n";
       throw;
    }
-   if (r.GetEntryStatus() != TTreeReader::kEntryNotFound && fNStopsReceived < fNChildren) {
+   const auto isEndOfRange = hasEntryRange && (r.GetEntryStatus() == TTreeReader::kEntryBeyondEnd);
+   if (r.GetEntryStatus() != TTreeReader::kEntryNotFound && !isEndOfRange && fNStopsReceived < fNChildren) {
       // something went wrong in the TTreeReader event loop
       throw std::runtime_error("An error was encountered while processing the data. TTreeReader status code is: " +
                                std::to_string(r.GetEntryStatus()));
@@ -394,7 +420,7 @@ void RLoopManager::RunDataSource()
          for (const auto &range : ranges) {
             auto end = range.second;
             for (auto entry = range.first; entry < end; ++entry) {
-               if (fDataSource->SetEntry(0u, entry)) {
+               if (SetDataSourceEntry(0u, entry)) {
                   RunAndCheckFilters(0u, entry);
                }
             }
@@ -427,7 +453,7 @@ void RLoopManager::RunDataSourceMT()
       const auto end = range.second;
       try {
          for (auto entry = range.first; entry < end; ++entry) {
-            if (fDataSource->SetEntry(slot, entry)) {
+            if (SetDataSourceEntry(slot, entry)) {
                RunAndCheckFilters(slot, entry);
             }
          }
@@ -455,25 +481,86 @@ void RLoopManager::RunDataSourceMT()
 /// Named filters must be called even if the analysis logic would not require it, lest they report confusing results.
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
-   for (auto &actionPtr : fBookedActions)
+   for (auto &actionPtr : fNominalActions)
       actionPtr->Run(slot, entry);
+   if (!fVariedPasses.empty())
+      RunVariations(slot, entry);
    for (auto &namedFilterPtr : fBookedNamedFilters)
       namedFilterPtr->CheckFilters(slot, entry);
    for (auto &callback : fCallbacks)
       callback(slot);
 }
 
+/// Run the actions of the systematic variations on the current entry, see RInterface::Vary().
+/// For each variation, only the custom columns and the filters that depend on it are re-evaluated; all the other
+/// nodes keep the values cached for the nominal. Afterwards, the filters get back their nominal state.
+void RLoopManager::RunVariations(unsigned int slot, Long64_t entry)
+{
+   for (auto filter : fVariedFilters)
+      filter->SaveNominalState(slot);
+
+   const RVariedPass *prevPass = nullptr;
+   auto resetNodes = [slot](const RVariedPass &pass) {
+      for (auto column : pass.fColumns)
+         column->ResetCache(slot);
+      for (auto filter : pass.fFilters)
+         filter->ResetCache(slot);
+   };
+   for (const auto &pass : fVariedPasses) {
+      fCurrentVariations[slot] = pass.fVariation;
+      // the values cached for the previous variation are stale as well
+      if (prevPass)
+         resetNodes(*prevPass);
+      resetNodes(pass);
+      for (auto action : pass.fActions)
+         action->Run(slot, entry);
+      prevPass = &pass;
+   }
+
+   fCurrentVariations[slot] = 0;
+   resetNodes(*prevPass);
+   for (auto filter : fVariedFilters)
+      filter->RestoreNominalState(slot);
+}
+
+/// Load the next entry of the TTreeReader, measuring the time it takes if profiling is enabled.
+/// TTreeReader reads the values lazily: the time spent reading the values of the columns is attributed to the nodes
+/// that read them first.
+bool RLoopManager::ReadNextEntry(TTreeReader &r, unsigned int slot)
+{
+   if (!fIsProfiling)
+      return r.Next();
+   const auto start = RDFInternal::RProfiler::Clock_t::now();
+   const auto hasEntry = r.Next();
+   fProfiler.AddIOTime(slot, RDFInternal::RProfiler::Clock_t::now() - start);
+   return hasEntry;
+}
+
+/// Load an entry of the data source, measuring the time it takes if profiling is enabled
+bool RLoopManager::SetDataSourceEntry(unsigned int slot, ULong64_t entry)
+{
+   if (!fIsProfiling)
+      return fDataSource->SetEntry(slot, entry);
+   const auto start = RDFInternal::RProfiler::Clock_t::now();
+   const auto hasEntry = fDataSource->SetEntry(slot, entry);
+   fProfiler.AddIOTime(slot, RDFInternal::RProfiler::Clock_t::now() - start);
+   return hasEntry;
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitRDFValues` methods. It is called once per node per slot, before
 /// running the event loop. It also informs each node of the TTreeReader that
 /// a particular slot will be using.
+/// Filters that are never evaluated, because no action or named filter hangs from them, are skipped: their columns
+/// are not read and their branches are not added to the TTreeCache of the TTreeReader.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
    for (auto &ptr : fBookedActions)
       ptr->InitSlot(r, slot);
    for (auto &ptr : fBookedFilters)
-      ptr->InitSlot(r, slot);
+      if (ptr->IsActive())
+         ptr->InitSlot(r, slot);
    for (auto &callback : fCallbacksOnce)
       callback(slot);
 }
@@ -491,6 +578,110 @@ void RLoopManager::InitNodes()
       range->InitNode();
    for (auto &ptr : fBookedActions)
       ptr->Initialize();
+   InitVariedPasses();
+   InitProfiling();
+}
+
+/// Enable or disable the profiling of the booked nodes, according to SetProfiling()
+void RLoopManager::InitProfiling()
+{
+   if (fIsProfiling)
+      fProfiler.Init(fNSlots);
+   auto profiler = fIsProfiling ? &fProfiler : nullptr;
+   for (auto filter : fBookedFilters)
+      filter->SetProfiler(profiler);
+   for (auto action : fBookedActions) {
+      action->SetProfiler(profiler);
+      for (auto &column : action->GetCustomColumns().GetColumns())
+         column.second->SetProfiler(profiler);
+   }
+}
+
+/// Return the time spent in each node during the event loops run with profiling enabled
+ROOT::RDF::RProfileReport RLoopManager::GetProfileReport()
+{
+   // the concrete nodes of jitted nodes only exist after jitting
+   Jit();
+
+   ROOT::RDF::RProfileReport report;
+   auto addNode = [&report](const std::string &kind, const std::string &name,
+                            const RDFInternal::RNodeProfile &profile) {
+      if (!profile.HasStats())
+         return;
+      const auto stats = profile.GetStats();
+      const auto time = std::chrono::duration<double>(stats.fTime).count();
+      report.fNodes.push_back(ROOT::RDF::RNodeProfileInfo(kind, name, stats.fCalls, stats.fCacheHits, time));
+   };
+
+   for (auto filter : fBookedFilters)
+      addNode("Filter", filter->HasName() ? filter->GetName() : "Filter", filter->GetProfile());
+   std::set<const RCustomColumnBase *> seenColumns;
+   for (auto action : GetAllActions()) {
+      for (auto &column : action->GetCustomColumns().GetColumns()) {
+         if (RDFInternal::IsInternalColumn(column.first) || !seenColumns.insert(column.second.get()).second)
+            continue;
+         addNode(column.second->IsDataSourceColumn() ? "Column" : "Define", column.first,
+                 column.second->GetProfile());
+      }
+      addNode("Action", action->GetActionName(), action->GetProfile());
+   }
+   for (auto time : fProfiler.GetIOTimes())
+      report.fIOTimes.emplace_back(std::chrono::duration<double>(time).count());
+
+   return report;
+}
+
+/// Sort the booked actions by systematic variation and collect, for each variation, the nodes that depend on it
+void RLoopManager::InitVariedPasses()
+{
+   fNominalActions.clear();
+   fVariedPasses.clear();
+   fVariedFilters.clear();
+   fCurrentVariations.assign(fNSlots, 0u);
+
+   std::map<unsigned int, RVariedPass> passes;
+   for (auto action : fBookedActions) {
+      const auto variation = action->GetVariation();
+      if (variation == 0) {
+         fNominalActions.emplace_back(action);
+         continue;
+      }
+      auto &pass = passes[variation];
+      pass.fVariation = variation;
+      pass.fActions.emplace_back(action);
+      const auto &variationName = fVariations[variation].first;
+      for (auto &column : action->GetCustomColumns().GetColumns()) {
+         if (column.second->DependsOn(variationName))
+            pass.fColumns.emplace_back(column.second.get());
+      }
+      action->AddVariedFilters(variationName, pass.fFilters);
+   }
+
+   for (auto &variationAndPass : passes) {
+      auto &pass = variationAndPass.second;
+      std::sort(pass.fColumns.begin(), pass.fColumns.end());
+      pass.fColumns.erase(std::unique(pass.fColumns.begin(), pass.fColumns.end()), pass.fColumns.end());
+      std::sort(pass.fFilters.begin(), pass.fFilters.end());
+      pass.fFilters.erase(std::unique(pass.fFilters.begin(), pass.fFilters.end()), pass.fFilters.end());
+      fVariedFilters.insert(fVariedFilters.end(), pass.fFilters.begin(), pass.fFilters.end());
+      fVariedPasses.emplace_back(std::move(pass));
+   }
+   std::sort(fVariedFilters.begin(), fVariedFilters.end());
+   fVariedFilters.erase(std::unique(fVariedFilters.begin(), fVariedFilters.end()), fVariedFilters.end());
+}
+
+/// Register a systematic variation with the given tags, see RInterface::Vary().
+/// Returns the id of the variation of the first tag; the ids of the other tags follow.
+unsigned int RLoopManager::RegisterVariation(const std::string &name, const std::vector<std::string> &tags)
+{
+   for (const auto &variation : fVariations) {
+      if (variation.first == name)
+         throw std::runtime_error("RDataFrame: a variation named \"" + name + "\" was already booked");
+   }
+   const auto firstId = static_cast<unsigned int>(fVariations.size());
+   for (const auto &tag : tags)
+      fVariations.emplace_back(name, tag);
+   return firstId;
 }
 
 /// Perform clean-up operations. To be called at the end of each event loop.
@@ -504,6 +695,9 @@ void RLoopManager::CleanUpNodes()
 
    fRunActions.insert(fRunActions.begin(), fBookedActions.begin(), fBookedActions.end());
    fBookedActions.clear();
+   fNominalActions.clear();
+   fVariedPasses.clear();
+   fVariedFilters.clear();
 
    // reset children counts
    fNChildren = 0;
@@ -523,18 +717,69 @@ void RLoopManager::CleanUpTask(unsigned int slot)
    for (auto &ptr : fBookedActions)
       ptr->FinalizeSlot(slot);
    for (auto &ptr : fBookedFilters)
-      ptr->ClearTask(slot);
+      if (ptr->IsActive())
+         ptr->ClearTask(slot);
+}
+
+/// Declare the queued lambdas of jitted Filters and Defines to the interpreter, see
+/// ROOT::RDF::EnableJitDeclarationBatching().
+void RLoopManager::JitDeclarations()
+{
+   RDFInternal::JitPendingDeclarations();
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
-/// This method also clears the contents of GetCodeToJit().
+/// All the code queued so far, including the one of other RLoopManagers, is compiled. If another thread is already
+/// compiling code queued by this RLoopManager, wait for it instead.
 void RLoopManager::Jit()
 {
-   const std::string code = std::move(GetCodeToJit());
-   if (code.empty())
-      return;
+   std::exception_ptr declarationError;
+   try {
+      JitDeclarations();
+   } catch (...) {
+      declarationError = std::current_exception();
+   }
+
+   auto &queue = GetJitQueue();
+   std::unique_lock<std::mutex> lock(queue.fMutex);
+   const auto lastBatch = queue.fCode.empty() ? fJitBatch : queue.fNextBatch;
+   while (queue.fLastCompiledBatch < lastBatch) {
+      if (queue.fIsCompiling) {
+         queue.fBatchCompiled.wait(lock);
+         continue;
+      }
+      const auto batch = queue.fNextBatch++;
+      const std::string code = std::move(queue.fCode);
+      queue.fCode.clear();
+      queue.fIsCompiling = true;
+      lock.unlock();
+
+      // The queued code refers to lambdas that might not exist if their declaration failed
+      std::exception_ptr error = declarationError;
+      if (!error) {
+         try {
+            RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+         } catch (...) {
+            error = std::current_exception();
+         }
+      }
 
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+      lock.lock();
+      if (error)
+         queue.fFailedBatches[batch] = error;
+      queue.fLastCompiledBatch = batch;
+      queue.fIsCompiling = false;
+      queue.fBatchCompiled.notify_all();
+   }
+
+   if (declarationError)
+      std::rethrow_exception(declarationError);
+   const auto failed = queue.fFailedBatches.find(fJitBatch);
+   if (failed != queue.fFailedBatches.end()) {
+      // Report the failure once, as when the code is compiled by this thread
+      fJitBatch = 0;
+      std::rethrow_exception(failed->second);
+   }
 }
 
 /// Trigger counting of number of children nodes for each node of the functional graph.
@@ -575,6 +820,45 @@ void RLoopManager::Run()
    fNRuns++;
 }
 
+/// Run the event loop in sequence over the entries in [beginEntry, endEntry) only, independently of the IMT settings.
+/// Used to process a part of the data set, e.g. in a worker process of ROOT::RDF::Experimental::RMultiProcessRun.
+void RLoopManager::RunEntryRange(ULong64_t beginEntry, ULong64_t endEntry)
+{
+   Jit();
+
+   InitNodes();
+
+   switch (fLoopType) {
+   case ELoopType::kNoFilesMT:
+   case ELoopType::kNoFiles: RunEmptySource(beginEntry, endEntry); break;
+   case ELoopType::kROOTFilesMT:
+   case ELoopType::kROOTFiles: RunTreeReader(beginEntry, endEntry); break;
+   case ELoopType::kDataSourceMT:
+   case ELoopType::kDataSource:
+      CleanUpNodes();
+      throw std::runtime_error("RDataFrame: running on an entry range is not supported for data sources");
+   }
+
+   CleanUpNodes();
+
+   fNRuns++;
+}
+
+/// Mark the booked actions as run without running the event loop. Used if the results of the actions are filled by
+/// other means, e.g. merged from the results of worker processes.
+void RLoopManager::MarkActionsAsRun()
+{
+   fMustRunNamedFilters = false;
+   for (auto &ptr : fBookedActions)
+      ptr->SetHasRun();
+   fRunActions.insert(fRunActions.begin(), fBookedActions.begin(), fBookedActions.end());
+   fBookedActions.clear();
+   fCallbacks.clear();
+   fCallbacksOnce.clear();
+
+   fNRuns++;
+}
+
 /// Return the list of default columns -- empty if none was provided when constructing the RDataFrame
 const ColumnNames_t &RLoopManager::GetDefaultColumnNames() const
 {
@@ -586,6 +870,20 @@ TTree *RLoopManager::GetTree() const
    return fTree.get();
 }
 
+/// Return an upper bound on the number of entries that an event loop processes, if it is known without opening files
+/// or reading data, or zero otherwise (e.g. for data sources, or chains of files that were not opened yet).
+ULong64_t RLoopManager::GetNEntriesUpperBound() const
+{
+   if (fDataSource)
+      return 0ull;
+   if (!fTree)
+      return fNEmptyEntries;
+   if (auto entryList = fTree->GetEntryList())
+      return entryList->GetN();
+   const auto nEntries = fTree->GetEntriesFast();
+   return nEntries == TTree::kMaxEntries ? 0ull : nEntries;
+}
+
 void RLoopManager::Book(RDFInternal::RActionBase *actionPtr)
 {
    fBookedActions.emplace_back(actionPtr);
@@ -637,7 +935,10 @@ void RLoopManager::Report(ROOT::RDF::RCutFlowReport &rep) const
 
 void RLoopManager::ToJitExec(const std::string &code) const
 {
-   GetCodeToJit().append(code);
+   auto &queue = GetJitQueue();
+   std::lock_guard<std::mutex> lock(queue.fMutex);
+   queue.fCode.append(code);
+   fJitBatch = queue.fNextBatch;
 }
 
 void RLoopManager::RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f)
@@ -19,6 +19,7 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -30,6 +31,20 @@ namespace Experimental {
 ROOT::Experimental::RNTupleDS::RNTupleDS(std::unique_ptr<ROOT::Experimental::RNTupleReader> ntuple)
 {
    fReaders.emplace_back(std::move(ntuple));
+   Attach();
+}
+
+ROOT::Experimental::RNTupleDS::RNTupleDS(std::string_view ntupleName, std::string_view location)
+   : fNTupleName(ntupleName), fLocation(location)
+{
+}
+
+void RNTupleDS::Attach() const
+{
+   if (!fColumnNames.empty())
+      return;
+   if (fReaders.empty())
+      fReaders.emplace_back(RNTupleReader::Open(fNTupleName, fLocation));
    auto rootField = fReaders[0]->GetModel()->GetRootField();
    for (auto &f : *rootField) {
       if (f.GetParent() != rootField)
@@ -39,14 +54,36 @@ ROOT::Experimental::RNTupleDS::RNTupleDS(std::unique_ptr<ROOT::Experimental::RNT
    }
 }
 
+void RNTupleDS::CreateSlots()
+{
+   if (!fEntries.empty())
+      return;
+   Attach();
+
+   for (unsigned int i = 1; i < fNSlots; ++i) {
+      fReaders.emplace_back(fReaders[0]->Clone());
+   }
+
+   for (unsigned int i = 0; i < fNSlots; ++i) {
+      auto entry = fReaders[i]->GetModel()->CreateEntry();
+      fValuePtrs.emplace_back(std::vector<void*>());
+      for (unsigned j = 0; j < fColumnNames.size(); ++j) {
+         fValuePtrs[i].emplace_back(entry->GetValue(fColumnNames[j]).GetRawPtr());
+      }
+      fEntries.emplace_back(std::move(entry));
+   }
+}
+
 const std::vector<std::string>& RNTupleDS::GetColumnNames() const
 {
+   Attach();
    return fColumnNames;
 }
 
 
 RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view name, const std::type_info& /* ti */)
 {
+   CreateSlots();
    const auto index = std::distance(
       fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), name));
    // TODO(jblomer): check expected type info like in, e.g., RRootDS.cxx
@@ -65,31 +102,77 @@ bool RNTupleDS::SetEntry(unsigned int slot, ULong64_t entryIndex)
    return true;
 }
 
+void RNTupleDS::AddRangePredicate(std::string_view colName, double min, double max)
+{
+   R__ASSERT(HasColumn(colName));
+   fRangePredicates.push_back(RRangePredicate{std::string(colName), min, max});
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetCandidateRanges()
+{
+   std::vector<std::pair<ULong64_t, ULong64_t>> result{{0, fReaders[0]->GetNEntries()}};
+   for (const auto &predicate : fRangePredicates) {
+      std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+      for (const auto &r : fReaders[0]->GetEntryRanges(predicate.fColumnName, predicate.fMin, predicate.fMax))
+         ranges.emplace_back(r.GetStart(), r.GetEnd());
+      result = IntersectRanges(result, ranges);
+   }
+   return result;
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetClusterRanges()
+{
+   const auto &desc = fReaders[0]->GetDescriptor();
+   std::vector<std::pair<ULong64_t, ULong64_t>> result;
+   for (DescriptorId_t clusterId = 0; clusterId < desc.GetNClusters(); ++clusterId) {
+      const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+      if (clusterDesc.GetNEntries() == 0)
+         continue;
+      result.emplace_back(clusterDesc.GetFirstEntryIndex(),
+                          clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries());
+   }
+   std::sort(result.begin(), result.end());
+   return result;
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::IntersectRanges(
+   const std::vector<std::pair<ULong64_t, ULong64_t>> &a, const std::vector<std::pair<ULong64_t, ULong64_t>> &b)
+{
+   // Both lists are sorted and disjoint
+   std::vector<std::pair<ULong64_t, ULong64_t>> result;
+   std::size_t i = 0;
+   std::size_t j = 0;
+   while ((i < a.size()) && (j < b.size())) {
+      const auto start = std::max(a[i].first, b[j].first);
+      const auto end = std::min(a[i].second, b[j].second);
+      if (start < end)
+         result.emplace_back(start, end);
+      if (a[i].second < b[j].second)
+         ++i;
+      else
+         ++j;
+   }
+   return result;
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
-   // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
    if (fHasSeenAllRanges) return ranges;
-
-   auto nEntries = fReaders[0]->GetNEntries();
-   const auto chunkSize = nEntries / fNSlots;
-   const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(fNSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
-   }
-   ranges.back().second += reminder;
    fHasSeenAllRanges = true;
+
+   // Every range is contained in a single cluster.  Since every slot reads through its own clone of the ntuple
+   // reader, the slots load and decompress disjoint sets of clusters.
+   ranges = GetClusterRanges();
+   if (!fRangePredicates.empty())
+      ranges = IntersectRanges(ranges, GetCandidateRanges());
    return ranges;
 }
 
 
 std::string RNTupleDS::GetTypeName(std::string_view colName) const
 {
+   Attach();
    const auto index = std::distance(
       fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), colName));
    return fColumnTypes[index];
@@ -98,6 +181,7 @@ std::string RNTupleDS::GetTypeName(std::string_view colName) const
 
 bool RNTupleDS::HasColumn(std::string_view colName) const
 {
+   Attach();
    return std::find(fColumnNames.begin(), fColumnNames.end(), colName) !=
           fColumnNames.end();
 }
@@ -105,28 +189,27 @@ bool RNTupleDS::HasColumn(std::string_view colName) const
 
 void RNTupleDS::Initialise()
 {
+   CreateSlots();
    fHasSeenAllRanges = false;
 }
 
 
+std::vector<std::string> RNTupleDS::GetInputFileNames()
+{
+   if (fLocation.empty())
+      return {};
+   return {fLocation};
+}
+
+
 void RNTupleDS::SetNSlots(unsigned int nSlots)
 {
    R__ASSERT(fNSlots == 0);
    R__ASSERT(nSlots > 0);
    fNSlots = nSlots;
-
-   for (unsigned int i = 1; i < fNSlots; ++i) {
-      fReaders.emplace_back(fReaders[0]->Clone());
-   }
-
-   for (unsigned int i = 0; i < fNSlots; ++i) {
-      auto entry = fReaders[i]->GetModel()->CreateEntry();
-      fValuePtrs.emplace_back(std::vector<void*>());
-      for (unsigned j = 0; j < fColumnNames.size(); ++j) {
-         fValuePtrs[i].emplace_back(entry->GetValue(fColumnNames[j]).GetRawPtr());
-      }
-      fEntries.emplace_back(std::move(entry));
-   }
+   // For lazily opened ntuples, the slots are created when the event loop is set up
+   if (!fReaders.empty())
+      CreateSlots();
 }
 
 
@@ -0,0 +1,44 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RNodeProfile.hxx"
+
+#include <sstream>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+RNodeStats RNodeProfile::GetStats() const
+{
+   RNodeStats total;
+   for (const auto &stats : fStats) {
+      total.fCalls += stats.fCalls;
+      total.fCacheHits += stats.fCacheHits;
+      total.fTime += stats.fTime;
+   }
+   return total;
+}
+
+std::string RNodeProfile::GetSummary() const
+{
+   if (!HasStats())
+      return "";
+   const auto stats = GetStats();
+   std::stringstream ss;
+   ss.precision(3);
+   ss << std::fixed << std::chrono::duration<double, std::milli>(stats.fTime).count() << " ms, " << stats.fCalls
+      << " calls";
+   if (stats.fCacheHits > 0)
+      ss << ", " << stats.fCacheHits << " cached";
+   return ss.str();
+}
+
+} // ns RDF
+} // ns Internal
+} // ns ROOT
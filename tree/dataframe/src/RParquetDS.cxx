@@ -0,0 +1,311 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RMakeUnique.hxx>
+#include <ROOT/RParquetDS.hxx>
+#include "RArrowUtils.hxx"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+#include <arrow/memory_pool.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/exception.h>
+#include <parquet/file_reader.h>
+#include <parquet/metadata.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// The values of a column in the row group loaded by a slot. The row group can be split in several Arrow arrays.
+class RParquetColumn {
+   arrow::ArrayVector fChunks;
+   std::vector<ULong64_t> fChunkEnds; ///< The entry after the last entry of each chunk
+   std::size_t fChunk = 0;            ///< The chunk of the current entry
+   ULong64_t fChunkBegin;             ///< The first entry of the current chunk
+   const ULong64_t fFirstEntry;       ///< The first entry of the row group
+   ArrayPtrVisitor fVisitor;          ///< Points the value pointer of the slot to the current entry
+
+public:
+   RParquetColumn(void **valuePtr, const arrow::ArrayVector &chunks, ULong64_t firstEntry)
+      : fChunks(chunks), fChunkBegin(firstEntry), fFirstEntry(firstEntry), fVisitor(valuePtr)
+   {
+      auto end = firstEntry;
+      for (const auto &chunk : fChunks) {
+         end += chunk->length();
+         fChunkEnds.push_back(end);
+      }
+   }
+
+   void SetEntry(ULong64_t entry)
+   {
+      if (entry < fChunkBegin) {
+         fChunk = 0;
+         fChunkBegin = fFirstEntry;
+      }
+      while (entry >= fChunkEnds[fChunk]) {
+         fChunkBegin = fChunkEnds[fChunk];
+         ++fChunk;
+      }
+      fVisitor.SetEntry(entry - fChunkBegin);
+      auto status = fChunks[fChunk]->Accept(&fVisitor);
+      if (!status.ok())
+         throw std::runtime_error("RParquetDS: could not read entry " + std::to_string(entry) + ": " +
+                                  status.ToString());
+   }
+};
+
+/// The row group that a slot is processing
+struct RParquetSlot {
+   /// Each slot reads through its own file reader, so that row groups can be read concurrently
+   std::unique_ptr<parquet::arrow::FileReader> fReader;
+   /// The row group, read only for the active columns. It owns the Arrow buffers that the value pointers point to.
+   std::shared_ptr<arrow::Table> fTable;
+   ULong64_t fBegin = 0; ///< The first entry of the row group
+   ULong64_t fEnd = 0;   ///< The entry after the last entry of the row group
+   std::vector<RParquetColumn> fColumns; ///< One per active column
+
+   void Clear()
+   {
+      fColumns.clear();
+      fTable.reset();
+      fBegin = fEnd = 0;
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+
+namespace {
+std::unique_ptr<parquet::arrow::FileReader> OpenParquetFile(const std::string &fileName)
+{
+   std::unique_ptr<parquet::arrow::FileReader> reader;
+   arrow::Status status;
+   try {
+      status = parquet::arrow::FileReader::Make(arrow::default_memory_pool(),
+                                                parquet::ParquetFileReader::OpenFile(fileName), &reader);
+   } catch (const parquet::ParquetException &e) {
+      throw std::runtime_error("RParquetDS: cannot open file " + fileName + ": " + e.what());
+   }
+   if (!status.ok())
+      throw std::runtime_error("RParquetDS: cannot open file " + fileName + ": " + status.ToString());
+   return reader;
+}
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////
+/// Constructor to create a Parquet RDataSource for RDataFrame.
+/// \param[in] fileName the path of the Parquet file to read.
+/// \param[in] columns the names of the columns to use. If empty, all the columns of the file are used.
+RParquetDS::RParquetDS(std::string_view fileName, const std::vector<std::string> &columns)
+   : fFileName(fileName), fColumnNames(columns)
+{
+   auto reader = OpenParquetFile(fFileName);
+   auto status = reader->GetSchema(&fSchema);
+   if (!status.ok())
+      throw std::runtime_error("RParquetDS: cannot read the schema of file " + fFileName + ": " + status.ToString());
+
+   const auto metadata = reader->parquet_reader()->metadata();
+   // The row groups are read by index of the columns in the Parquet schema, which are the leaves of the Arrow
+   // schema: the two only match if no column is nested (lists of values are a single leaf)
+   if (metadata->num_columns() != fSchema->num_fields())
+      throw std::runtime_error("RParquetDS: file " + fFileName + " contains nested columns, which are not supported");
+
+   if (fColumnNames.empty()) {
+      for (const auto &field : fSchema->fields())
+         fColumnNames.emplace_back(field->name());
+   }
+
+   VerifyValidColumnType verifyType;
+   for (const auto &name : fColumnNames) {
+      const auto index = fSchema->GetFieldIndex(name);
+      if (index < 0)
+         throw std::runtime_error("RParquetDS: file " + fFileName + " does not have column " + name);
+      if (!fSchema->field(index)->type()->Accept(&verifyType).ok())
+         throw std::runtime_error("RParquetDS: column " + name + " contains an unsupported type");
+      fColumnIndices.emplace_back(index);
+   }
+
+   fRowGroupStarts.emplace_back(0ull);
+   for (auto i = 0; i < metadata->num_row_groups(); ++i)
+      fRowGroupStarts.emplace_back(fRowGroupStarts.back() + metadata->RowGroup(i)->num_rows());
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Destructor.
+RParquetDS::~RParquetDS()
+{
+}
+
+const std::vector<std::string> &RParquetDS::GetColumnNames() const
+{
+   return fColumnNames;
+}
+
+/// Return one range per row group, all at once: each row group is processed by the first slot that becomes free
+std::vector<std::pair<ULong64_t, ULong64_t>> RParquetDS::GetEntryRanges()
+{
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   if (fRangesReturned)
+      return ranges;
+   fRangesReturned = true;
+   for (auto i = 1u; i < fRowGroupStarts.size(); ++i) {
+      if (fRowGroupStarts[i] > fRowGroupStarts[i - 1]) // skip empty row groups
+         ranges.emplace_back(fRowGroupStarts[i - 1], fRowGroupStarts[i]);
+   }
+   return ranges;
+}
+
+std::string RParquetDS::GetTypeName(std::string_view colName) const
+{
+   if (!HasColumn(colName)) {
+      std::string msg = "The dataset does not have column ";
+      msg += colName;
+      throw std::runtime_error(msg);
+   }
+   RDFTypeNameGetter typeGetter;
+   auto status = fSchema->GetFieldByName(std::string(colName))->type()->Accept(&typeGetter);
+   if (!status.ok()) {
+      std::string msg = "RParquetDS does not support a column of type ";
+      msg += fSchema->GetFieldByName(std::string(colName))->type()->name();
+      throw std::runtime_error(msg);
+   }
+   return typeGetter.result();
+}
+
+bool RParquetDS::HasColumn(std::string_view colName) const
+{
+   return std::find(fColumnNames.begin(), fColumnNames.end(), std::string(colName)) != fColumnNames.end();
+}
+
+/// Read the row group that contains the entry, for the active columns only, and point the column readers of the
+/// slot to its values
+void RParquetDS::LoadRowGroup(unsigned int slot, ULong64_t entry)
+{
+   auto &s = *fSlots[slot];
+   s.Clear();
+   if (!s.fReader)
+      s.fReader = OpenParquetFile(fFileName);
+
+   const auto rowGroup =
+      std::upper_bound(fRowGroupStarts.begin(), fRowGroupStarts.end(), entry) - fRowGroupStarts.begin() - 1;
+   assert(rowGroup >= 0 && rowGroup + 1 < static_cast<long>(fRowGroupStarts.size()));
+   s.fBegin = fRowGroupStarts[rowGroup];
+   s.fEnd = fRowGroupStarts[rowGroup + 1];
+   if (fActiveColumns.empty())
+      return;
+
+   std::vector<int> indices;
+   for (auto c : fActiveColumns)
+      indices.emplace_back(fColumnIndices[c]);
+   auto status = s.fReader->ReadRowGroup(static_cast<int>(rowGroup), indices, &s.fTable);
+   if (!status.ok())
+      throw std::runtime_error("RParquetDS: cannot read row group " + std::to_string(rowGroup) + " of file " +
+                               fFileName + ": " + status.ToString());
+
+   // the visitors of the columns hold the cached values of some types: they must not be moved once in use
+   s.fColumns.reserve(fActiveColumns.size());
+   for (auto c : fActiveColumns) {
+      const auto tableIdx = s.fTable->schema()->GetFieldIndex(fColumnNames[c]);
+      const auto data = ROOT::Internal::RDF::getData(s.fTable->column(tableIdx));
+      s.fColumns.emplace_back(&fValuePtrs[c][slot], data->chunks(), s.fBegin);
+   }
+}
+
+bool RParquetDS::SetEntry(unsigned int slot, ULong64_t entry)
+{
+   auto &s = *fSlots[slot];
+   // in single-thread event loops, InitSlot is only called once for all the ranges
+   if (entry < s.fBegin || entry >= s.fEnd)
+      LoadRowGroup(slot, entry);
+   for (auto &column : s.fColumns)
+      column.SetEntry(entry);
+   return true;
+}
+
+void RParquetDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
+{
+   LoadRowGroup(slot, firstEntry);
+}
+
+/// Release the Arrow buffers of the row group processed by the slot
+void RParquetDS::FinaliseSlot(unsigned int slot)
+{
+   fSlots[slot]->Clear();
+}
+
+void RParquetDS::SetNSlots(unsigned int nSlots)
+{
+   assert(0U == fNSlots && "Setting the number of slots even if the number of slots is different from zero.");
+   fNSlots = nSlots;
+   fValuePtrs.assign(fColumnNames.size(), std::vector<void *>(fNSlots, nullptr));
+   for (auto i = 0u; i < fNSlots; ++i)
+      fSlots.emplace_back(std::make_unique<ROOT::Internal::RDF::RParquetSlot>());
+}
+
+/// Return the addresses of the per-slot value pointers of the column, and mark the column as one to read
+std::vector<void *> RParquetDS::GetColumnReadersImpl(std::string_view colName, const std::type_info &)
+{
+   const auto it = std::find(fColumnNames.begin(), fColumnNames.end(), std::string(colName));
+   if (it == fColumnNames.end()) {
+      std::string msg = "The dataset does not have column ";
+      msg += colName;
+      throw std::runtime_error(msg);
+   }
+   const std::size_t c = it - fColumnNames.begin();
+   if (std::find(fActiveColumns.begin(), fActiveColumns.end(), c) == fActiveColumns.end())
+      fActiveColumns.emplace_back(c);
+
+   std::vector<void *> readers;
+   for (auto &ptr : fValuePtrs[c])
+      readers.emplace_back(&ptr);
+   return readers;
+}
+
+void RParquetDS::Initialise()
+{
+   fRangesReturned = false;
+   // the columns to read might have changed since the last event loop
+   for (auto &s : fSlots)
+      s->Clear();
+}
+
+std::string RParquetDS::GetLabel()
+{
+   return "ParquetDS";
+}
+
+std::vector<std::string> RParquetDS::GetInputFileNames()
+{
+   return {fFileName};
+}
+
+/// Creates a RDataFrame that reads an Apache Parquet file.
+/// \param[in] fileName the path of the Parquet file to read.
+/// \param[in] columns the names of the columns to use. If empty, all the columns of the file are used.
+RDataFrame MakeParquetDataFrame(std::string_view fileName, const std::vector<std::string> &columns)
+{
+   ROOT::RDataFrame rdf(std::make_unique<RParquetDS>(fileName, columns));
+   return rdf;
+}
+
+} // namespace RDF
+} // namespace ROOT
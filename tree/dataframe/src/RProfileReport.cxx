@@ -0,0 +1,45 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "TString.h" // Printf
+
+#include <algorithm>
+#include <numeric>
+
+namespace ROOT {
+
+namespace RDF {
+
+void RProfileReport::Print() const
+{
+   std::vector<const RNodeProfileInfo *> nodes;
+   for (const auto &node : fNodes)
+      nodes.emplace_back(&node);
+   std::stable_sort(nodes.begin(), nodes.end(),
+                    [](const RNodeProfileInfo *a, const RNodeProfileInfo *b) { return a->GetTime() > b->GetTime(); });
+   auto totalTime = std::accumulate(fIOTimes.begin(), fIOTimes.end(), 0.);
+   for (const auto node : nodes)
+      totalTime += node->GetTime();
+
+   Printf("%-8s %-30s %12s %12s %12s %8s", "Kind", "Name", "Calls", "Cached", "Time [ms]", "Fraction");
+   for (const auto node : nodes) {
+      const auto fraction = totalTime > 0. ? 100. * node->GetTime() / totalTime : 0.;
+      Printf("%-8s %-30s %12llu %12llu %12.3f %7.2f%%", node->GetKind().c_str(), node->GetName().c_str(),
+             node->GetCalls(), node->GetCacheHits(), 1000. * node->GetTime(), fraction);
+   }
+   for (auto slot = 0u; slot < fIOTimes.size(); ++slot) {
+      const auto name = "loading entries, slot " + std::to_string(slot);
+      const auto fraction = totalTime > 0. ? 100. * fIOTimes[slot] / totalTime : 0.;
+      Printf("%-8s %-30s %12s %12s %12.3f %7.2f%%", "I/O", name.c_str(), "", "", 1000. * fIOTimes[slot], fraction);
+   }
+}
+
+} // End NS RDF
+
+} // End NS ROOT
@@ -1,6 +1,7 @@
 #include <ROOT/RDF/Utils.hxx>
 #include <ROOT/RRootDS.hxx>
 #include <ROOT/TSeq.hxx>
+#include <TChainElement.h>
 #include <TClass.h>
 #include <TError.h>
 #include <TROOT.h>         // For the gROOTMutex
@@ -161,6 +162,14 @@ std::string RRootDS::GetLabel()
    return "Root";
 }
 
+std::vector<std::string> RRootDS::GetInputFileNames()
+{
+   std::vector<std::string> fileNames;
+   for (auto element : ROOT::Detail::TRangeStaticCast<TChainElement>(*fModelChain.GetListOfFiles()))
+      fileNames.emplace_back(element->GetTitle());
+   return fileNames;
+}
+
 RDataFrame MakeRootDataFrame(std::string_view treeName, std::string_view fileNameGlob)
 {
    return ROOT::RDataFrame(treeName, fileNameGlob);
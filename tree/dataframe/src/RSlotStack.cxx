@@ -14,24 +14,33 @@
 
 #include <mutex> // std::lock_guard
 
-ROOT::Internal::RDF::RSlotStack::RSlotStack(unsigned int size) : fSize(size)
+ROOT::Internal::RDF::RSlotStack::RSlotStack(unsigned int size) : fSize(size), fLastUsers(size)
 {
+   // slot 0 is on top of the stack
    for (auto i : ROOT::TSeqU(size))
-      fStack.push(i);
+      fStack.push_back(size - 1 - i);
 }
 
 void ROOT::Internal::RDF::RSlotStack::ReturnSlot(unsigned int slot)
 {
    std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
    R__ASSERT(fStack.size() < fSize && "Trying to put back a slot to a full stack!");
-   fStack.push(slot);
+   fStack.push_back(slot);
 }
 
 unsigned int ROOT::Internal::RDF::RSlotStack::GetSlot()
 {
    std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
    R__ASSERT(!fStack.empty() && "Trying to pop a slot from an empty stack!");
-   const auto slot = fStack.top();
-   fStack.pop();
+   const auto thisThread = std::this_thread::get_id();
+   for (auto it = fStack.rbegin(); it != fStack.rend(); ++it) {
+      if (fLastUsers[*it] == thisThread) {
+         std::swap(*it, fStack.back());
+         break;
+      }
+   }
+   const auto slot = fStack.back();
+   fStack.pop_back();
+   fLastUsers[slot] = thisThread;
    return slot;
 }
@@ -31,7 +31,9 @@
 #include <cerrno>
 #include <cstring> // for memcpy
 #include <ctime>
+#include <limits>
 #include <memory> // for placement new
+#include <regex>
 #include <stdexcept>
 #include <utility>
 
@@ -325,6 +327,36 @@ static bool RegisterSqliteVfs()
    return (retval == SQLITE_OK);
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// If the query reads a single table without aggregation, ordering or sub-query, so that it can be split in ranges
+/// of rowids, builds the query restricted to the rowids between the parameters 1 and 2, and the query of the rowids
+/// of its rows. The match is conservative: a query that it does not recognize is processed row by row.
+bool MakeRangeQueries(const std::string &query, std::string &rangeQuery, std::string &rowidQuery)
+{
+   static const std::regex reSelect("^\\s*SELECT\\s+([\\s\\S]+?)\\s+FROM\\s+([A-Za-z_][A-Za-z0-9_]*)"
+                                    "(?:\\s+WHERE\\s+([\\s\\S]+?))?\\s*;?\\s*$",
+                                    std::regex::icase);
+   static const std::regex reReject("\\b(SELECT|DISTINCT|GROUP|ORDER|LIMIT|OFFSET|JOIN|UNION|INTERSECT|EXCEPT|HAVING|"
+                                    "OVER|WINDOW|VALUES)\\b|"
+                                    "\\b(COUNT|SUM|AVG|MIN|MAX|TOTAL|GROUP_CONCAT|RANDOM|RANDOMBLOB)\\s*\\(",
+                                    std::regex::icase);
+
+   std::smatch match;
+   if (!std::regex_match(query, match, reSelect))
+      return false;
+   const std::string columns = match[1];
+   const std::string table = match[2];
+   const std::string where = match[3];
+   if (std::regex_search(columns, reReject) || std::regex_search(where, reReject))
+      return false;
+
+   const std::string condition = where.empty() ? "" : " AND (" + where + ")";
+   rangeQuery = "SELECT " + columns + " FROM " + table + " WHERE rowid BETWEEN ?1 AND ?2" + condition +
+                " ORDER BY rowid";
+   rowidQuery = "SELECT rowid FROM " + table + (where.empty() ? "" : " WHERE " + where) + " ORDER BY rowid";
+   return true;
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -335,8 +367,13 @@ namespace Internal {
 ////////////////////////////////////////////////////////////////////////////
 /// The state of an open dataset in terms of the sqlite3 C library.
 struct RSqliteDSDataSet {
+   std::string fFileName;
    sqlite3 *fDb = nullptr;
    sqlite3_stmt *fQuery = nullptr;
+   /// The connections of the slots in the range scans, opened in the first event loop using them
+   std::vector<sqlite3 *> fSlotDbs;
+   /// The range query of each slot
+   std::vector<sqlite3_stmt *> fSlotQueries;
 };
 }
 
@@ -362,7 +399,8 @@ constexpr char const *RSqliteDS::fgTypeNames[];
 ///
 /// The constructor opens the sqlite file, prepares the query engine and determines the column names and types.
 RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
-   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(0), fNRow(0)
+   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(0), fNRow(0), fRangesScanned(false),
+     fNRangeRows(0), fUseRanges(false), fRangesDone(false)
 {
    static bool hasSqliteVfs = RegisterSqliteVfs();
    if (!hasSqliteVfs)
@@ -370,6 +408,7 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
 
    int retval;
 
+   fDataSet->fFileName = fileName;
    retval = sqlite3_open_v2(fileName.c_str(), &fDataSet->fDb, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX,
                             gSQliteVfsName);
    if (retval != SQLITE_OK)
@@ -434,12 +473,30 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
       default: throw std::runtime_error("Unhandled data type");
       }
    }
+
+   // The range queries must be valid SQL with the same columns, e.g. they are not for WITHOUT ROWID tables
+   if (MakeRangeQueries(query, fRangeQuery, fRowidQuery)) {
+      sqlite3_stmt *rangeStmt = nullptr;
+      sqlite3_stmt *rowidStmt = nullptr;
+      if ((sqlite3_prepare_v2(fDataSet->fDb, fRangeQuery.c_str(), -1, &rangeStmt, nullptr) != SQLITE_OK) ||
+          (sqlite3_prepare_v2(fDataSet->fDb, fRowidQuery.c_str(), -1, &rowidStmt, nullptr) != SQLITE_OK) ||
+          (sqlite3_column_count(rangeStmt) != colCount)) {
+         fRangeQuery.clear();
+         fRowidQuery.clear();
+      }
+      sqlite3_finalize(rangeStmt);
+      sqlite3_finalize(rowidStmt);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////
 /// Frees the sqlite resources and closes the file.
 RSqliteDS::~RSqliteDS()
 {
+   for (auto stmt : fDataSet->fSlotQueries)
+      sqlite3_finalize(stmt);
+   for (auto db : fDataSet->fSlotDbs)
+      sqlite3_close_v2(db);
    // sqlite3_finalize returns the error code of the most recent operation on fQuery.
    sqlite3_finalize(fDataSet->fQuery);
    // Closing can possibly fail with SQLITE_BUSY, in which case resources are leaked. This should not happen
@@ -475,15 +532,28 @@ RDataSource::Record_t RSqliteDS::GetColumnReadersImpl(std::string_view name, con
    }
 
    fValues[index].fIsActive = true;
-   return std::vector<void *>{fNSlots, &fValues[index].fPtr};
+   std::vector<void *> readers;
+   for (auto &ptrs : fSlotPtrs)
+      readers.push_back(&ptrs[index]);
+   return readers;
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Returns a range of size 1 as long as more rows are available in the SQL result set.
-/// This inherently serialized the RDF independent of the number of slots.
+/// With the range scans, returns all the ranges of kRangeSize rows at once. Otherwise returns a range of size 1 as
+/// long as more rows are available in the SQL result set, which inherently serializes the RDF independent of the
+/// number of slots.
 std::vector<std::pair<ULong64_t, ULong64_t>> RSqliteDS::GetEntryRanges()
 {
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
+   if (fUseRanges) {
+      if (!fRangesDone) {
+         for (ULong64_t first = 0; first < fNRangeRows; first += kRangeSize)
+            entryRanges.emplace_back(first, std::min(first + kRangeSize, fNRangeRows));
+         fRangesDone = true;
+      }
+      return entryRanges;
+   }
+
    int retval = sqlite3_step(fDataSet->fQuery);
    switch (retval) {
    case SQLITE_DONE: return entryRanges;
@@ -527,6 +597,72 @@ void RSqliteDS::Initialise()
    int retval = sqlite3_reset(fDataSet->fQuery);
    if (retval != SQLITE_OK)
       throw std::runtime_error("SQlite error, reset");
+
+   fUseRanges = (fNSlots > 1) && !fRangeQuery.empty() && ScanRanges();
+   fRangesDone = false;
+   if (fUseRanges && fDataSet->fSlotQueries.empty()) {
+      for (unsigned int slot = 0; slot < fNSlots; ++slot) {
+         sqlite3 *db = nullptr;
+         retval = sqlite3_open_v2(fDataSet->fFileName.c_str(), &db, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX,
+                                  gSQliteVfsName);
+         fDataSet->fSlotDbs.push_back(db);
+         if (retval != SQLITE_OK)
+            SqliteError(retval);
+         sqlite3_stmt *stmt = nullptr;
+         retval = sqlite3_prepare_v2(db, fRangeQuery.c_str(), -1, &stmt, nullptr);
+         if (retval != SQLITE_OK)
+            SqliteError(retval);
+         fDataSet->fSlotQueries.push_back(stmt);
+      }
+   }
+
+   for (unsigned int slot = 0; slot < fNSlots; ++slot) {
+      for (unsigned int i = 0; i < fValues.size(); ++i)
+         fSlotPtrs[slot][i] = fUseRanges ? fSlotValues[slot][i].fPtr : fValues[i].fPtr;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Reads the rowids of the rows of the query once, and keeps the first one of each range of kRangeSize rows.
+/// Returns whether the query has more than one range, i.e. whether the range scans are worth it.
+bool RSqliteDS::ScanRanges()
+{
+   if (!fRangesScanned) {
+      sqlite3_stmt *stmt = nullptr;
+      int retval = sqlite3_prepare_v2(fDataSet->fDb, fRowidQuery.c_str(), -1, &stmt, nullptr);
+      if (retval != SQLITE_OK)
+         SqliteError(retval);
+      while ((retval = sqlite3_step(stmt)) == SQLITE_ROW) {
+         if (fNRangeRows % kRangeSize == 0)
+            fRangeRowids.push_back(sqlite3_column_int64(stmt, 0));
+         fNRangeRows++;
+      }
+      sqlite3_finalize(stmt);
+      if (retval != SQLITE_DONE)
+         SqliteError(retval);
+      fRangesScanned = true;
+   }
+   return fRangeRowids.size() > 1;
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// With the range scans, positions the query of the slot at the beginning of the range starting at firstEntry.
+void RSqliteDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
+{
+   if (!fUseRanges)
+      return;
+
+   const auto range = firstEntry / kRangeSize;
+   const Long64_t firstRowid = fRangeRowids[range];
+   const Long64_t lastRowid = (range + 1 < fRangeRowids.size()) ? fRangeRowids[range + 1] - 1
+                                                                 : std::numeric_limits<Long64_t>::max();
+   sqlite3_stmt *stmt = fDataSet->fSlotQueries[slot];
+   sqlite3_reset(stmt);
+   int retval = sqlite3_bind_int64(stmt, 1, firstRowid);
+   if (retval == SQLITE_OK)
+      retval = sqlite3_bind_int64(stmt, 2, lastRowid);
+   if (retval != SQLITE_OK)
+      SqliteError(retval);
 }
 
 std::string RSqliteDS::GetLabel()
@@ -534,6 +670,11 @@ std::string RSqliteDS::GetLabel()
    return "RSqliteDS";
 }
 
+std::vector<std::string> RSqliteDS::GetInputFileNames()
+{
+   return {fDataSet->fFileName};
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////
 /// \brief Factory method to create a SQlite RDataFrame.
 /// \param[in] fileName Path of the sqlite file.
@@ -546,49 +687,84 @@ RDataFrame MakeSqliteDataFrame(std::string_view fileName, std::string_view query
 
 ////////////////////////////////////////////////////////////////////////////
 /// Stores the result of the current active sqlite query row as a C++ value.
-bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
-{
+/// With the range scans, steps the query of the slot, which processes the entries of its range in order.
+bool RSqliteDS::SetEntry(unsigned int slot, ULong64_t entry)
+{
+   if (fUseRanges) {
+      int retval = sqlite3_step(fDataSet->fSlotQueries[slot]);
+      if (retval != SQLITE_ROW) {
+         if (retval == SQLITE_DONE)
+            throw std::runtime_error("SQlite error: fewer rows than counted in entry " + std::to_string(entry));
+         SqliteError(retval);
+      }
+      FillValues(fDataSet->fSlotQueries[slot], fSlotValues[slot]);
+      return true;
+   }
+
    R__ASSERT(entry + 1 == fNRow);
-   unsigned N = fValues.size();
+   FillValues(fDataSet->fQuery, fValues);
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Copies the active columns of the current row of the statement to the values.
+void RSqliteDS::FillValues(sqlite3_stmt *stmt, std::vector<Value_t> &values)
+{
+   unsigned N = values.size();
    for (unsigned i = 0; i < N; ++i) {
       if (!fValues[i].fIsActive)
          continue;
 
       int nbytes;
-      switch (fValues[i].fType) {
-      case ETypes::kInteger: fValues[i].fInteger = sqlite3_column_int64(fDataSet->fQuery, i); break;
-      case ETypes::kReal: fValues[i].fReal = sqlite3_column_double(fDataSet->fQuery, i); break;
+      switch (values[i].fType) {
+      case ETypes::kInteger: values[i].fInteger = sqlite3_column_int64(stmt, i); break;
+      case ETypes::kReal: values[i].fReal = sqlite3_column_double(stmt, i); break;
       case ETypes::kText:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
+         nbytes = sqlite3_column_bytes(stmt, i);
          if (nbytes == 0) {
-            fValues[i].fText = "";
+            values[i].fText = "";
          } else {
-            fValues[i].fText = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
+            values[i].fText = reinterpret_cast<const char *>(sqlite3_column_text(stmt, i));
          }
          break;
       case ETypes::kBlob:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         fValues[i].fBlob.resize(nbytes);
+         nbytes = sqlite3_column_bytes(stmt, i);
+         values[i].fBlob.resize(nbytes);
          if (nbytes > 0) {
-            std::memcpy(fValues[i].fBlob.data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
+            std::memcpy(values[i].fBlob.data(), sqlite3_column_blob(stmt, i), nbytes);
          }
          break;
       case ETypes::kNull: break;
       default: throw std::runtime_error("Unhandled column type");
       }
    }
-   return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
-/// Almost a no-op, many slots can in fact reduce the performance due to thread synchronization.
+/// Allocates the values of the slots for the range scans. If the query cannot be split in ranges, many slots can in
+/// fact reduce the performance due to thread synchronization.
 void RSqliteDS::SetNSlots(unsigned int nSlots)
 {
-   if (nSlots > 1) {
-      ::Warning("SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
-                             "Consider turning off IMT.");
+   if (nSlots > 1 && fRangeQuery.empty()) {
+      ::Warning("SetNSlots", "The SQlite query cannot be split in ranges of rows and faces performance degradation in "
+                             "multi-threaded mode. Consider turning off IMT.");
    }
    fNSlots = nSlots;
+
+   fSlotValues.clear();
+   fSlotPtrs.clear();
+   for (unsigned int slot = 0; slot < fNSlots; ++slot) {
+      // Reserved so that the fPtr of the values are not invalidated
+      std::vector<Value_t> values;
+      values.reserve(fColumnTypes.size());
+      for (auto type : fColumnTypes)
+         values.emplace_back(type);
+      fSlotValues.emplace_back(std::move(values));
+      std::vector<void *> ptrs;
+      for (auto &value : fValues)
+         ptrs.push_back(value.fPtr);
+      fSlotPtrs.emplace_back(std::move(ptrs));
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
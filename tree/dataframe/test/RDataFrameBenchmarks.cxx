@@ -0,0 +1,53 @@
+#include <ROOT/RDataFrame.hxx>
+
+#include <benchmark/benchmark.h>
+
+// Overhead of the computation graph: an empty data source, so that the time is spent in
+// the event loop and by the nodes (defines, filters, actions) rather than in reading data
+
+static void BM_RDataFrame_Count(benchmark::State &state)
+{
+   for (auto _ : state) {
+      ROOT::RDataFrame df(state.range(0));
+      benchmark::DoNotOptimize(*df.Count());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RDataFrame_Count)->Arg(1000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+static void BM_RDataFrame_DefineFilterSum(benchmark::State &state)
+{
+   for (auto _ : state) {
+      ROOT::RDataFrame df(state.range(0));
+      auto sum = df.Define("x", [](ULong64_t e) { return double(e % 100); }, {"rdfentry_"})
+                    .Filter([](double x) { return x > 10; }, {"x"})
+                    .Sum<double>("x");
+      benchmark::DoNotOptimize(*sum);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RDataFrame_DefineFilterSum)->Arg(1000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+static void BM_RDataFrame_ManyFilters(benchmark::State &state)
+{
+   for (auto _ : state) {
+      ROOT::RDataFrame df(1000000);
+      ROOT::RDF::RNode node = df.Define("x", [](ULong64_t e) { return int(e % 1000); }, {"rdfentry_"});
+      for (int i = 0; i < state.range(0); ++i)
+         node = node.Filter([i](int x) { return x != i; }, {"x"});
+      benchmark::DoNotOptimize(*node.Count());
+   }
+}
+BENCHMARK(BM_RDataFrame_ManyFilters)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+
+static void BM_RDataFrame_Histo1D(benchmark::State &state)
+{
+   for (auto _ : state) {
+      ROOT::RDataFrame df(state.range(0));
+      auto h = df.Define("x", [](ULong64_t e) { return double(e % 100); }, {"rdfentry_"})
+                  .Histo1D<double>({"h", "h", 100, 0., 100.}, "x");
+      benchmark::DoNotOptimize(h->GetEntries());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RDataFrame_Histo1D)->Arg(1000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
@@ -346,3 +346,75 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+TEST(Cache, PersistentCache)
+{
+   const auto inFileName = "dataframe_cache_persistent.root";
+   const auto cacheDir = "dataframe_cache_persistent";
+   gSystem->mkdir(cacheDir);
+   ROOT::RDataFrame(10)
+      .Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+      .Snapshot<double>("t", inFileName, {"x"});
+
+   ROOT::RDataFrame df("t", inFileName);
+   unsigned int nCalls = 0;
+   auto d = df.Define("y", [&nCalls](double x) {
+      ++nCalls;
+      return 2 * x;
+   }, {"x"});
+   auto cached1 = d.PersistentCache<double>({"y"}, "v1", cacheDir);
+   EXPECT_EQ(10u, nCalls);
+   EXPECT_DOUBLE_EQ(90., *cached1.Sum<double>("y"));
+
+   auto cached2 = d.PersistentCache<double>({"y"}, "v1", cacheDir);
+   EXPECT_EQ(10u, nCalls);
+   EXPECT_DOUBLE_EQ(90., *cached2.Sum<double>("y"));
+
+   // A different key invalidates the cache
+   auto cached3 = d.PersistentCache({"y"}, "v2", cacheDir);
+   EXPECT_EQ(20u, nCalls);
+   EXPECT_EQ(10u, *cached3.Count());
+
+   auto dir = gSystem->OpenDirectory(cacheDir);
+   while (auto entry = gSystem->GetDirEntry(dir)) {
+      if (TString(entry).BeginsWith("rdfcache_"))
+         gSystem->Unlink((std::string(cacheDir) + "/" + entry).c_str());
+   }
+   gSystem->FreeDirectory(dir);
+   gSystem->Unlink(cacheDir);
+   gSystem->Unlink(inFileName);
+}
+
+TEST(Cache, PersistentCacheJittedExpressions)
+{
+   const auto cacheDir = "dataframe_cache_persistent_jitted";
+   gSystem->mkdir(cacheDir);
+   ROOT::RDataFrame df(10);
+
+   // Same key, different expressions: the cached results must differ
+   auto cached1 = df.Define("y", "2. * rdfentry_").PersistentCache<double>({"y"}, "v1", cacheDir);
+   EXPECT_DOUBLE_EQ(90., *cached1.Sum<double>("y"));
+   auto cached2 = df.Define("y", "3. * rdfentry_").PersistentCache<double>({"y"}, "v1", cacheDir);
+   EXPECT_DOUBLE_EQ(135., *cached2.Sum<double>("y"));
+
+   auto cached3 = df.Define("y", "2. * rdfentry_").Filter("y > 10").PersistentCache<double>({"y"}, "v1", cacheDir);
+   EXPECT_EQ(4u, *cached3.Count());
+   auto cached4 = df.Define("y", "2. * rdfentry_").Filter("y > 14").PersistentCache<double>({"y"}, "v1", cacheDir);
+   EXPECT_EQ(2u, *cached4.Count());
+
+   // Same expressions: the cache is reused
+   auto cached5 = df.Define("y", "3. * rdfentry_").PersistentCache<double>({"y"}, "v1", cacheDir);
+   EXPECT_DOUBLE_EQ(135., *cached5.Sum<double>("y"));
+
+   auto dir = gSystem->OpenDirectory(cacheDir);
+   unsigned int nCacheFiles = 0;
+   while (auto entry = gSystem->GetDirEntry(dir)) {
+      if (TString(entry).BeginsWith("rdfcache_")) {
+         ++nCacheFiles;
+         gSystem->Unlink((std::string(cacheDir) + "/" + entry).c_str());
+      }
+   }
+   gSystem->FreeDirectory(dir);
+   gSystem->Unlink(cacheDir);
+   EXPECT_EQ(4u, nCacheFiles);
+}
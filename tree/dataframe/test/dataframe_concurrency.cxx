@@ -1,8 +1,11 @@
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/TThreadExecutor.hxx>
+#include <TROOT.h>
 #include <atomic>
 #include <chrono>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -76,4 +79,31 @@ TEST(RDFSimpleTests, ThrowOnPoolSizeMismatch)
       }
    }
 }
+
+TEST(RDFConcurrency, JitFromSeveralThreads)
+{
+   ROOT::EnableThreadSafety();
+
+   // each thread builds and runs its own computation graph with jitted nodes, some of them shared by all threads
+   const auto nThreads = 8u;
+   std::vector<ULong64_t> counts(nThreads);
+   std::vector<double> sums(nThreads);
+   std::vector<std::thread> threads;
+   for (auto t = 0u; t < nThreads; ++t) {
+      threads.emplace_back([t, &counts, &sums] {
+         auto df = ROOT::RDataFrame(100).Define("x", "rdfentry_ * 1.").Define("y", "x + " + std::to_string(t));
+         auto count = df.Filter("x < " + std::to_string(10 * t)).Count();
+         auto sum = df.Filter("rdfentry_ % 2 == 0").Sum<double>("y");
+         counts[t] = *count;
+         sums[t] = *sum;
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+
+   for (auto t = 0u; t < nThreads; ++t) {
+      EXPECT_EQ(counts[t], 10 * t);
+      EXPECT_DOUBLE_EQ(sums[t], 2450. + 50. * t);
+   }
+}
 #endif
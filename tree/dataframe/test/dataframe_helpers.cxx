@@ -275,3 +275,26 @@ TEST(RDFHelpers, SaveGraphToFile)
 
    gSystem->Unlink(outFileName);
 }
+
+TEST(RDFHelpers, RunGraphs)
+{
+   ROOT::RDataFrame df1(10);
+   auto c1 = df1.Count();
+   auto s1 = df1.Define("x", [] { return 1; }).Sum<int>("x");
+   ROOT::RDataFrame df2(20);
+   auto c2 = df2.Count();
+   ROOT::RDataFrame df3(30);
+   auto c3 = df3.Count();
+   EXPECT_EQ(30ull, *c3);
+
+   std::vector<RResultHandle> handles{c1, s1, c2, c3};
+   RunGraphs(handles);
+   for (auto &h : handles)
+      EXPECT_TRUE(h.IsReady());
+   EXPECT_EQ(10ull, handles[0].GetValue<ULong64_t>());
+   EXPECT_EQ(10, handles[1].GetValue<int>());
+   EXPECT_THROW(handles[2].GetValue<int>(), std::runtime_error);
+   EXPECT_EQ(20ull, *c2);
+   EXPECT_EQ(1u, df1.GetNRuns());
+   EXPECT_EQ(1u, df3.GetNRuns());
+}
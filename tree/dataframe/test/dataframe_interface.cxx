@@ -1,11 +1,15 @@
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
 #include "ROOT/RTrivialDS.hxx"
 #include "TMemFile.h"
 #include "TSystem.h"
 #include "TTree.h"
+#include "TTreeCache.h"
 
 #include "gtest/gtest.h"
 
+#include <map>
+
 using namespace ROOT;
 using namespace ROOT::RDF;
 
@@ -423,3 +427,223 @@ TEST(RDataFrameInterface, TypeUnknownToInterpreter)
       df.Filter("res; return true;"),
       ss.str().c_str());
 }
+
+TEST(RDataFrameInterface, JitDeclarationBatching)
+{
+   ROOT::RDF::EnableJitDeclarationBatching();
+   EXPECT_TRUE(ROOT::RDF::IsJitDeclarationBatchingEnabled());
+
+   ROOT::RDataFrame df(10);
+   auto d = df.Define("x", "int(rdfentry_)");
+   auto f1 = d.Filter("x > 1 && x < 1000 + 1");
+   auto f2 = f1.Filter("x % 2 == 0 && x < 1000 + 2");
+   auto y = f2.Define("y", "x * 3 + 1000 * 0");
+   EXPECT_EQ("int", y.GetColumnType("y"));
+   EXPECT_EQ(4ull, *y.Count());
+   EXPECT_EQ(60, *y.Sum<int>("y"));
+
+   // An invalid expression in a batched Filter is reported when the declarations are flushed
+   auto bad = df.Filter("rdfentry_ > undeclaredVariableForBatching");
+   EXPECT_ANY_THROW(bad.Count().GetValue());
+
+   ROOT::RDF::EnableJitDeclarationBatching(false);
+   EXPECT_FALSE(ROOT::RDF::IsJitDeclarationBatchingEnabled());
+}
+
+TEST(RDataFrameInterface, BulkActions)
+{
+   auto book = [] {
+      ROOT::RDataFrame df(100);
+      return df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+         .Define("i", [](ULong64_t e) { return int(e % 17); }, {"rdfentry_"})
+         .Filter([](double x) { return int(x) % 3 != 0; }, {"x"});
+   };
+
+   auto f = book();
+   auto sum = f.Sum<double>("x");
+   auto mean = f.Mean<int>("i");
+   auto min = f.Min<int>("i");
+   auto max = f.Max<double>("x");
+   auto stdDev = f.StdDev<double>("x");
+   auto h = f.Histo1D<double, int>({"h", "h", 10, 0, 100}, "x", "i");
+   auto p = f.Profile1D<double, int>({"p", "p", 10, 0, 100}, "x", "i");
+   auto count = f.Count();
+
+   EXPECT_EQ(0u, ROOT::RDF::GetBulkSize());
+   ROOT::RDF::SetBulkSize(7);
+   auto fBulk = book();
+   auto sumBulk = fBulk.Sum<double>("x");
+   auto meanBulk = fBulk.Mean<int>("i");
+   auto minBulk = fBulk.Min<int>("i");
+   auto maxBulk = fBulk.Max<double>("x");
+   auto stdDevBulk = fBulk.StdDev<double>("x");
+   auto hBulk = fBulk.Histo1D<double, int>({"h", "h", 10, 0, 100}, "x", "i");
+   auto pBulk = fBulk.Define("di", [](int i) { return double(i); }, {"i"})
+                   .Profile1D<double, double>({"p", "p", 10, 0, 100}, "x", "di");
+   auto countBulk = fBulk.Count();
+   ROOT::RDF::SetBulkSize(0);
+
+   EXPECT_EQ(66ull, *countBulk);
+   EXPECT_EQ(*count, *countBulk);
+   EXPECT_DOUBLE_EQ(*sum, *sumBulk);
+   EXPECT_DOUBLE_EQ(*mean, *meanBulk);
+   EXPECT_EQ(*min, *minBulk);
+   EXPECT_DOUBLE_EQ(*max, *maxBulk);
+   EXPECT_DOUBLE_EQ(*stdDev, *stdDevBulk);
+   EXPECT_DOUBLE_EQ(h->GetEntries(), hBulk->GetEntries());
+   for (int i = 0; i <= h->GetNbinsX() + 1; ++i)
+      EXPECT_DOUBLE_EQ(h->GetBinContent(i), hBulk->GetBinContent(i));
+   // the profile is filled by blocks of RVec<double> through TProfile::FillN
+   EXPECT_DOUBLE_EQ(p->GetEntries(), pBulk->GetEntries());
+   for (int i = 0; i <= p->GetNbinsX() + 1; ++i) {
+      EXPECT_DOUBLE_EQ(p->GetBinContent(i), pBulk->GetBinContent(i));
+      EXPECT_DOUBLE_EQ(p->GetBinEntries(i), pBulk->GetBinEntries(i));
+   }
+}
+
+TEST(RDataFrameInterface, Vary)
+{
+   RDataFrame df(10);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+               .Vary("x", [](double x) { return ROOT::VecOps::RVec<double>{x - 5., x + 5.}; }, {"x"}, {"down", "up"})
+               .Define("y", [](double x) { return 2. * x; }, {"x"});
+   auto f = d.Filter([](double y) { return y < 10.; }, {"y"}, "f");
+   auto sum = f.Sum<double>("x");
+   auto count = f.Count();
+   auto h = f.Histo1D<double>({"h", "h", 30, -10, 20}, "y");
+   auto unrelated = df.Sum<ULong64_t>("rdfentry_");
+   auto report = d.Report();
+
+   auto sums = ROOT::RDF::Experimental::VariationsFor(sum);
+   auto counts = ROOT::RDF::Experimental::VariationsFor(count);
+   auto hs = ROOT::RDF::Experimental::VariationsFor(h);
+   EXPECT_EQ(1u, ROOT::RDF::Experimental::VariationsFor(unrelated).GetKeys().size());
+   EXPECT_THROW(sums["x:sideways"], std::runtime_error);
+
+   const std::vector<std::string> keys{"nominal", "x:down", "x:up"};
+   EXPECT_EQ(keys, sums.GetKeys());
+   // nominal x in [0, 5), down x in [-5, 5), up x in [5, 5)
+   EXPECT_DOUBLE_EQ(10., sums["nominal"]);
+   EXPECT_DOUBLE_EQ(10., *sum);
+   EXPECT_DOUBLE_EQ(-5., sums["x:down"]);
+   EXPECT_DOUBLE_EQ(0., sums["x:up"]);
+   EXPECT_EQ(5ull, counts["nominal"]);
+   EXPECT_EQ(10ull, counts["x:down"]);
+   EXPECT_EQ(0ull, counts["x:up"]);
+   EXPECT_EQ(10, hs["x:down"].GetEntries());
+   EXPECT_DOUBLE_EQ(-1., hs["x:down"].GetMean());
+   EXPECT_EQ(45ull, *unrelated);
+
+   // the cut-flow report only counts the nominal values
+   EXPECT_EQ(5ull, (*report)["f"].GetPass());
+   EXPECT_EQ(10ull, (*report)["f"].GetAll());
+
+   EXPECT_THROW(df.Vary("rdfentry_", [](ULong64_t e) { return ROOT::VecOps::RVec<ULong64_t>{e}; }, {"rdfentry_"}, {}),
+                std::invalid_argument);
+}
+
+// The expression of the variations is evaluated once per entry, not once per variation
+TEST(RDataFrameInterface, VaryEvaluatedOncePerEntry)
+{
+   unsigned int nCalls = 0;
+   RDataFrame df(10);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+               .Vary("x",
+                     [&nCalls](double x) {
+                        ++nCalls;
+                        return ROOT::VecOps::RVec<double>{x - 1., x + 1., x + 2.};
+                     },
+                     {"x"}, {"a", "b", "c"})
+               .Define("w", [](ULong64_t e) { return double(e % 2); }, {"rdfentry_"})
+               .Vary("w", [](double) { return ROOT::VecOps::RVec<double>{0., 1.}; }, {"w"}, {"off", "on"})
+               .Define("y", [](double x, double w) { return w * x; }, {"x", "w"});
+   auto sums = ROOT::RDF::Experimental::VariationsFor(d.Sum<double>("y"));
+
+   // nominal and w variations: sum of the odd entries or all entries, x variations: shifted odd entries
+   EXPECT_DOUBLE_EQ(25., sums["nominal"]);
+   EXPECT_DOUBLE_EQ(20., sums["x:a"]);
+   EXPECT_DOUBLE_EQ(30., sums["x:b"]);
+   EXPECT_DOUBLE_EQ(35., sums["x:c"]);
+   EXPECT_DOUBLE_EQ(0., sums["w:off"]);
+   EXPECT_DOUBLE_EQ(45., sums["w:on"]);
+   EXPECT_EQ(10u, nCalls);
+}
+
+TEST(RDataFrameInterface, Profiling)
+{
+   RDataFrame df(10);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto f = d.Filter([](double x) { return x < 5.; }, {"x"}, "cut");
+   auto sum = f.Sum<double>("x");
+   auto max = d.Max<double>("x");
+
+   // nothing is measured unless profiling is enabled
+   *sum;
+   auto emptyReport = f.GetProfileReport();
+   EXPECT_TRUE(emptyReport.begin() == emptyReport.end());
+
+   auto sum2 = f.Sum<double>("x");
+   auto max2 = d.Max<double>("x");
+   df.EnableProfiling();
+   *sum2;
+   df.EnableProfiling(false);
+
+   std::map<std::string, const ROOT::RDF::RNodeProfileInfo *> nodes;
+   auto report = df.GetProfileReport();
+   for (const auto &node : report)
+      nodes[node.GetKind() + ":" + node.GetName()] = &node;
+   ASSERT_EQ(4u, nodes.size());
+   // x is evaluated once per entry by the filter, then served from its cache to the Sum and to the Max
+   EXPECT_EQ(10ull, nodes["Define:x"]->GetCalls());
+   EXPECT_EQ(15ull, nodes["Define:x"]->GetCacheHits());
+   EXPECT_EQ(10ull, nodes["Filter:cut"]->GetCalls());
+   EXPECT_EQ(5ull, nodes["Action:Sum"]->GetCalls());
+   EXPECT_EQ(10ull, nodes["Action:Max"]->GetCalls());
+   for (const auto &node : nodes)
+      EXPECT_GE(node.second->GetTime(), 0.);
+   EXPECT_EQ(df.GetNSlots(), report.GetIOTimes().size());
+
+   // the graph is annotated with the measurements
+   const auto graph = ROOT::RDF::SaveGraph(df);
+   EXPECT_NE(graph.find("10 calls"), std::string::npos);
+
+   // the measurements of later event loops are only added if profiling is enabled
+   auto sum3 = f.Sum<double>("x");
+   *sum3;
+   for (const auto &node : df.GetProfileReport()) {
+      if (node.GetKind() == "Filter")
+         EXPECT_EQ(10ull, node.GetCalls());
+   }
+}
+
+TEST(RDataFrameInterface, InactiveFiltersAreNotRead)
+{
+   const auto fname = "dataframe_interface_inactivefilters.root";
+   {
+      TFile f(fname, "recreate");
+      TTree t("t", "t");
+      int x = 0, y = 0;
+      t.Branch("x", &x);
+      t.Branch("y", &y);
+      for (x = 0; x < 10; ++x) {
+         y = -x;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(fname);
+   auto t = f.Get<TTree>("t");
+   ROOT::RDataFrame df(*t);
+   // no action hangs from this filter, so it is never evaluated and its column is never read
+   df.Filter([](int y) { return y > 0; }, {"y"});
+   auto sum = df.Sum<int>("x");
+   EXPECT_EQ(*sum, 45);
+
+   auto cache = t->GetReadCache(&f);
+   ASSERT_NE(cache, nullptr);
+   EXPECT_NE(cache->GetCachedBranches()->FindObject(t->GetBranch("x")), nullptr);
+   EXPECT_EQ(cache->GetCachedBranches()->FindObject(t->GetBranch("y")), nullptr);
+
+   gSystem->Unlink(fname);
+}
@@ -0,0 +1,72 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFMultiProcess.hxx"
+#include "TFile.h"
+#include "TH1D.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using ROOT::RDF::Experimental::RMultiProcessRun;
+
+TEST(RDFMultiProcess, EmptySource)
+{
+   ROOT::RDataFrame df(1000);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto h = d.Histo1D<double>({"h", "h", 100, 0, 1000}, "x");
+   auto n = d.Filter([](double x) { return x >= 500; }, {"x"}).Count();
+   auto m = d.Max<double>("x");
+
+   RMultiProcessRun run(4);
+   run.Add(h).Add(n).Add(m, [](double a, double b) { return std::max(a, b); });
+   run.Run();
+
+   EXPECT_EQ(1000, h->GetEntries());
+   EXPECT_DOUBLE_EQ(499.5, h->GetMean());
+   EXPECT_EQ(500ull, *n);
+   EXPECT_DOUBLE_EQ(999., *m);
+}
+
+TEST(RDFMultiProcess, Tree)
+{
+   const auto fileName = "dataframe_multiprocess_tree.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int x = 0;
+      t.Branch("x", &x);
+      t.SetAutoFlush(100);
+      for (x = 0; x < 1000; ++x)
+         t.Fill();
+      t.Write();
+   }
+
+   ROOT::RDataFrame df("t", fileName);
+   auto sum = df.Sum<int>("x");
+   auto h = df.Histo1D<int>("x");
+   RMultiProcessRun run(3);
+   run.Add(sum).Add(h);
+   run.Run();
+   EXPECT_EQ(499500, *sum);
+   EXPECT_EQ(1000, h->GetEntries());
+
+   gSystem->Unlink(fileName);
+}
+
+TEST(RDFMultiProcess, Errors)
+{
+   ROOT::RDataFrame df(10);
+   auto c1 = df.Count();
+   auto c2 = df.Count();
+   RMultiProcessRun missing(2);
+   missing.Add(c1);
+   EXPECT_THROW(missing.Run(), std::invalid_argument);
+
+   auto r = df.Range(5).Count();
+   RMultiProcessRun withRange(2);
+   withRange.Add(c1).Add(c2).Add(r);
+   EXPECT_THROW(withRange.Run(), std::runtime_error);
+}
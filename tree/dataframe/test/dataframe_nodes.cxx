@@ -42,6 +42,21 @@ TEST(RDataFrameNodes, RSlotStackPutBackTooMany)
 
 #endif
 
+TEST(RDataFrameNodes, RSlotStackThreadAffinity)
+{
+   ROOT::Internal::RDF::RSlotStack s(3);
+   unsigned int other = 0;
+   std::thread t([&s, &other]() { other = s.GetSlot(); });
+   t.join();
+   const auto mine = s.GetSlot();
+   EXPECT_NE(mine, other);
+   s.ReturnSlot(other);
+   s.ReturnSlot(mine);
+   // the slot returned last is on top of the stack, but this thread gets back its own slot
+   EXPECT_EQ(s.GetSlot(), mine);
+   EXPECT_EQ(s.GetSlot(), other);
+}
+
 TEST(RDataFrameNodes, RLoopManagerGetLoopManagerUnchecked)
 {
    ROOT::Detail::RDF::RLoopManager lm(nullptr, {});
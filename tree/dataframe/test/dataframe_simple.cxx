@@ -949,6 +949,29 @@ TEST_P(RDFSimpleTests, ChainWithDifferentTreeNames)
    gSystem->Unlink(fname2);
 }
 
+TEST_P(RDFSimpleTests, SharedFill)
+{
+   ROOT::RDataFrame df(1000);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e % 10); }, {"rdfentry_"});
+   const ROOT::RDF::TH3DModel model{"h", "h", 10, 0, 10, 10, 0, 10, 10, 0, 10};
+   auto merged = d.Histo3D<double, double, double>(model, "x", "x", "x");
+
+   EXPECT_FALSE(ROOT::RDF::IsSharedFillEnabled());
+   ROOT::RDF::EnableSharedFill();
+   auto shared = d.Histo3D<double, double, double>(model, "x", "x", "x");
+   auto sharedWeighted = d.Histo1D<double, double>({"w", "w", 10, 0, 10}, "x", "x");
+   ROOT::RDF::EnableSharedFill(false);
+
+   EXPECT_EQ(1000, merged->GetEntries());
+   EXPECT_EQ(1000, shared->GetEntries());
+   for (int i = 1; i <= 10; ++i) {
+      EXPECT_DOUBLE_EQ(100., merged->GetBinContent(i, i, i));
+      EXPECT_DOUBLE_EQ(100., shared->GetBinContent(i, i, i));
+      EXPECT_DOUBLE_EQ(100. * (i - 1), sharedWeighted->GetBinContent(i));
+   }
+   EXPECT_DOUBLE_EQ(merged->GetMean(), shared->GetMean());
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFSimpleTests, ::testing::Values(false));
 
@@ -892,6 +892,24 @@ TEST(RDFSnapshotMore, EmptyBuffersMT)
    gSystem->Unlink(fname);
 }
 
+TEST(RDFSnapshotMore, OutputQueueMT)
+{
+   const auto fname = "outputqueuemt.root";
+   ROOT::EnableImplicitMT(4);
+   {
+      ROOT::RDataFrame d(10000);
+      ROOT::RDF::RSnapshotOptions opts;
+      opts.fAutoFlush = 100; // many buffers for a small queue
+      opts.fOutputQueueDepth = 2;
+      auto out =
+         d.Define("x", [](ULong64_t e) { return e; }, {"rdfentry_"}).Snapshot<ULong64_t>("t", fname, {"x"}, opts);
+      EXPECT_EQ(*out->Count(), 10000u);
+      EXPECT_EQ(*out->Sum<ULong64_t>("x"), 10000ull * 9999ull / 2ull);
+   }
+   ROOT::DisableImplicitMT();
+   gSystem->Unlink(fname);
+}
+
 TEST(RDFSnapshotMore, ReadWriteCarrayMT)
 {
    ROOT::EnableImplicitMT(4);
@@ -1,7 +1,10 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/RVec.hxx"
+#include "TROOT.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
+
 TEST(RDataFrameTake, Bool)
 {
    ROOT::RDataFrame df(1);
@@ -43,3 +46,35 @@ TEST(RDataFrameTake, Float)
    EXPECT_EQ(vec2.size(), 1u);
    EXPECT_EQ(vec2[0], 42.0);
 }
+
+// Without filters upstream, the values are written directly into the result vector
+TEST(RDataFrameTake, Unfiltered)
+{
+   ROOT::RDataFrame df(10000);
+   auto df2 = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto values = df2.Take<double>("x");
+   auto filtered = df2.Filter([](double x) { return x < 10; }, {"x"}).Take<double>("x");
+   std::size_t nPartial = 0;
+   values.OnPartialResult(5000, [&nPartial](const std::vector<double> &partial) { nPartial = partial.size(); });
+
+   ASSERT_EQ(values->size(), 10000u);
+   for (auto i = 0u; i < 10000u; ++i)
+      EXPECT_EQ((*values)[i], i);
+   EXPECT_EQ(nPartial, 5000u);
+   EXPECT_EQ(*filtered, std::vector<double>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+#ifdef R__USE_IMT
+TEST(RDataFrameTake, UnfilteredMT)
+{
+   ROOT::EnableImplicitMT(4);
+   ROOT::RDataFrame df(100000);
+   auto values = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"}).Take<int>("x");
+   auto sorted = *values;
+   std::sort(sorted.begin(), sorted.end());
+   ASSERT_EQ(sorted.size(), 100000u);
+   for (auto i = 0; i < 100000; ++i)
+      EXPECT_EQ(sorted[i], i);
+   ROOT::DisableImplicitMT();
+}
+#endif
@@ -2,9 +2,11 @@
 #include <ROOT/RCsvDS.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TROOT.h>
+#include <TSystem.h>
 
 #include <gtest/gtest.h>
 
+#include <fstream>
 #include <iostream>
 
 using namespace ROOT::RDF;
@@ -230,6 +232,20 @@ TEST(RCsvDS, MultipleEventLoops)
    EXPECT_EQ(6U, *tdf.Count());
 }
 
+TEST(RCsvDS, OnlyReadColumnsAreConverted)
+{
+   const auto fileName = "RCsvDS_test_onlyreadcolumns.csv";
+   {
+      std::ofstream f(fileName);
+      // the last line does not end with a newline
+      f << "x,y\n1,2\n\n3,notanumber\n5,6";
+   }
+   auto tdf = ROOT::RDF::MakeCsvDataFrame(fileName, true, ',', 2LL);
+   EXPECT_EQ(9, *tdf.Sum<Long64_t>("x"));
+   EXPECT_THROW(*tdf.Sum<Long64_t>("y"), std::runtime_error);
+   gSystem->Unlink(fileName);
+}
+
 // NOW MT!-------------
 #ifdef R__USE_IMT
 
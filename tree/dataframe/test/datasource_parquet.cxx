@@ -0,0 +1,144 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RParquetDS.hxx>
+#include <ROOT/RVec.hxx>
+#include <TROOT.h>
+#include <TSystem.h>
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+#include <arrow/builder.h>
+#include <arrow/io/file.h>
+#include <arrow/memory_pool.h>
+#include <arrow/table.h>
+#include <parquet/arrow/writer.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ROOT::RDF;
+
+// Write a file with 10 entries in row groups of 3 entries: x = 0..9, y = x / 2., v = {x, x}
+void WriteParquetFile(const std::string &fileName)
+{
+   auto pool = arrow::default_memory_pool();
+   arrow::Int64Builder xBuilder(pool);
+   arrow::DoubleBuilder yBuilder(pool);
+   auto vValuesBuilder = std::make_shared<arrow::DoubleBuilder>(pool);
+   arrow::ListBuilder vBuilder(pool, vValuesBuilder);
+   for (auto i = 0; i < 10; ++i) {
+      ASSERT_TRUE(xBuilder.Append(i).ok());
+      ASSERT_TRUE(yBuilder.Append(i / 2.).ok());
+      ASSERT_TRUE(vBuilder.Append().ok());
+      ASSERT_TRUE(vValuesBuilder->Append(i).ok());
+      ASSERT_TRUE(vValuesBuilder->Append(i).ok());
+   }
+   std::shared_ptr<arrow::Array> x, y, v;
+   ASSERT_TRUE(xBuilder.Finish(&x).ok());
+   ASSERT_TRUE(yBuilder.Finish(&y).ok());
+   ASSERT_TRUE(vBuilder.Finish(&v).ok());
+   auto schema = arrow::schema({arrow::field("x", arrow::int64()), arrow::field("y", arrow::float64()),
+                                arrow::field("v", arrow::list(arrow::float64()))});
+   auto table = arrow::Table::Make(schema, {x, y, v});
+
+   auto sink = arrow::io::FileOutputStream::Open(fileName).ValueOrDie();
+   ASSERT_TRUE(parquet::arrow::WriteTable(*table, pool, sink, /*chunk_size=*/3).ok());
+   ASSERT_TRUE(sink->Close().ok());
+}
+
+class RParquetDSTest : public ::testing::Test {
+protected:
+   const std::string fFileName = "RParquetDS_test.parquet";
+   void SetUp() override { WriteParquetFile(fFileName); }
+   void TearDown() override { gSystem->Unlink(fFileName.c_str()); }
+};
+
+TEST_F(RParquetDSTest, ColTypeNames)
+{
+   RParquetDS ds(fFileName);
+   ds.SetNSlots(1);
+
+   const auto &colNames = ds.GetColumnNames();
+   ASSERT_EQ(colNames.size(), 3U);
+   EXPECT_EQ(colNames[1], "y");
+   EXPECT_TRUE(ds.HasColumn("v"));
+   EXPECT_FALSE(ds.HasColumn("z"));
+   EXPECT_EQ(ds.GetTypeName("x"), "Long64_t");
+   EXPECT_EQ(ds.GetTypeName("y"), "double");
+   EXPECT_EQ(ds.GetTypeName("v"), "ROOT::VecOps::RVec<double>");
+}
+
+TEST_F(RParquetDSTest, EntryRangesAreRowGroups)
+{
+   RParquetDS ds(fFileName, {"x"});
+   ds.SetNSlots(2);
+   ds.Initialise();
+
+   const auto ranges = ds.GetEntryRanges();
+   ASSERT_EQ(ranges.size(), 4U);
+   EXPECT_EQ(ranges[0].first, 0U);
+   EXPECT_EQ(ranges[0].second, 3U);
+   EXPECT_EQ(ranges[3].first, 9U);
+   EXPECT_EQ(ranges[3].second, 10U);
+   EXPECT_TRUE(ds.GetEntryRanges().empty());
+}
+
+TEST_F(RParquetDSTest, ColumnReaders)
+{
+   RParquetDS ds(fFileName);
+   ds.SetNSlots(1);
+   auto xs = ds.GetColumnReaders<Long64_t>("x");
+   auto vs = ds.GetColumnReaders<ROOT::VecOps::RVec<double>>("v");
+   ds.Initialise();
+   ds.GetEntryRanges();
+   ds.InitSlot(0, 0);
+   // entries of all row groups can be read from the same slot
+   for (auto entry = 0U; entry < 10U; ++entry) {
+      ds.SetEntry(0, entry);
+      EXPECT_EQ(**xs[0], static_cast<Long64_t>(entry));
+      ASSERT_EQ((*vs[0])->size(), 2U);
+      EXPECT_DOUBLE_EQ((**vs[0])[1], entry);
+   }
+   ds.FinaliseSlot(0);
+}
+
+TEST_F(RParquetDSTest, FromARDF)
+{
+   auto rdf = MakeParquetDataFrame(fFileName);
+   auto sum = rdf.Sum<Long64_t>("x");
+   auto max = rdf.Max<double>("y");
+   auto sumV = rdf.Define("s", [](const ROOT::VecOps::RVec<double> &v) { return ROOT::VecOps::Sum(v); }, {"v"})
+                  .Sum<double>("s");
+   auto c = rdf.Count();
+
+   EXPECT_EQ(*c, 10U);
+   EXPECT_EQ(*sum, 45);
+   EXPECT_DOUBLE_EQ(*max, 4.5);
+   EXPECT_DOUBLE_EQ(*sumV, 90.);
+   // a second event loop reads the row groups again
+   EXPECT_EQ(*rdf.Filter([](Long64_t x) { return x > 4; }, {"x"}).Count(), 5U);
+}
+
+#ifdef R__USE_IMT
+TEST_F(RParquetDSTest, FromARDFMT)
+{
+   ROOT::EnableImplicitMT(4);
+   auto rdf = MakeParquetDataFrame(fFileName);
+   auto sum = rdf.Sum<Long64_t>("x");
+   auto max = rdf.Max<double>("y");
+   auto c = rdf.Count();
+
+   EXPECT_EQ(*c, 10U);
+   EXPECT_EQ(*sum, 45);
+   EXPECT_DOUBLE_EQ(*max, 4.5);
+   ROOT::DisableImplicitMT();
+}
+#endif // R__USE_IMT
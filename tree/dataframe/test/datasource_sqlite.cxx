@@ -9,6 +9,8 @@
 
 #include <gtest/gtest.h>
 
+#include <sqlite3.h>
+
 #include <algorithm>
 #include <memory>
 
@@ -22,6 +24,29 @@ constexpr auto query1 = "SELECT fint + 1, freal/1.0 as fmyreal, NULL, 'X', fblob
 constexpr auto query2 = "SELECT fint, freal, fint FROM test";
 constexpr auto query3 = "SELECT fint, freal, ftext, fblob FROM test";
 constexpr auto epsilon = 0.001;
+constexpr auto fileNameRanges = "datasource_sqlite_ranges.sqlite";
+constexpr auto queryRanges = "SELECT fint, freal FROM ranges WHERE fint % 3 != 0";
+
+// Creates a table of nRows rows with fint = 1..nRows and freal = fint / 2
+static void CreateRangesFile(const char *fname, int nRows)
+{
+   gSystem->Unlink(fname);
+   sqlite3 *db = nullptr;
+   ASSERT_EQ(SQLITE_OK, sqlite3_open(fname, &db));
+   ASSERT_EQ(SQLITE_OK, sqlite3_exec(db, "CREATE TABLE ranges (fint INTEGER, freal FLOAT); BEGIN;", nullptr,
+                                     nullptr, nullptr));
+   sqlite3_stmt *stmt = nullptr;
+   ASSERT_EQ(SQLITE_OK, sqlite3_prepare_v2(db, "INSERT INTO ranges VALUES (?1, ?2)", -1, &stmt, nullptr));
+   for (int i = 1; i <= nRows; ++i) {
+      sqlite3_bind_int64(stmt, 1, i);
+      sqlite3_bind_double(stmt, 2, i / 2.);
+      ASSERT_EQ(SQLITE_DONE, sqlite3_step(stmt));
+      sqlite3_reset(stmt);
+   }
+   sqlite3_finalize(stmt);
+   ASSERT_EQ(SQLITE_OK, sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr));
+   sqlite3_close(db);
+}
 
 TEST(RSqliteDS, Basics)
 {
@@ -193,8 +218,83 @@ TEST(RSqliteDS, SetEntry)
    EXPECT_EQ(nullptr, **vnull[0]);
 }
 
+TEST(RSqliteDS, RangeScans)
+{
+   const int nRows = 3 * RSqliteDS::kRangeSize + 17;
+   CreateRangesFile(fileNameRanges, nRows);
+   Long64_t expectedCount = 0;
+   Long64_t expectedSum = 0;
+   for (int i = 1; i <= nRows; ++i) {
+      if (i % 3 != 0) {
+         expectedCount++;
+         expectedSum += i;
+      }
+   }
+
+   RSqliteDS rds(fileNameRanges, queryRanges);
+   const auto nSlots = 2U;
+   rds.SetNSlots(nSlots);
+   auto vint = rds.GetColumnReaders<Long64_t>("fint");
+   auto vreal = rds.GetColumnReaders<double>("freal");
+   rds.Initialise();
+   auto ranges = rds.GetEntryRanges();
+   ASSERT_EQ(3U, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(ULong64_t(expectedCount), ranges.back().second);
+   EXPECT_EQ(0U, rds.GetEntryRanges().size());
+
+   // Process the ranges backwards, alternating the slots
+   Long64_t count = 0;
+   Long64_t sum = 0;
+   for (int r = ranges.size() - 1; r >= 0; --r) {
+      const auto slot = r % nSlots;
+      rds.InitSlot(slot, ranges[r].first);
+      for (auto entry = ranges[r].first; entry < ranges[r].second; ++entry) {
+         EXPECT_TRUE(rds.SetEntry(slot, entry));
+         EXPECT_NEAR(**vint[slot] / 2., **vreal[slot], epsilon);
+         count++;
+         sum += **vint[slot];
+      }
+   }
+   EXPECT_EQ(expectedCount, count);
+   EXPECT_EQ(expectedSum, sum);
+
+   // Queries which cannot be split are processed row by row
+   RSqliteDS rdsOrdered(fileNameRanges, "SELECT fint FROM ranges ORDER BY fint DESC");
+   rdsOrdered.SetNSlots(nSlots);
+   rdsOrdered.Initialise();
+   ranges = rdsOrdered.GetEntryRanges();
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(1U, ranges[0].second);
+
+   gSystem->Unlink(fileNameRanges);
+}
+
 #ifdef R__USE_IMT
 
+TEST(RSqliteDS, IMTRangeScans)
+{
+   const int nRows = 5 * RSqliteDS::kRangeSize + 3;
+   CreateRangesFile(fileNameRanges, nRows);
+   Long64_t expectedSum = 0;
+   for (int i = 1; i <= nRows; ++i) {
+      if (i % 3 != 0)
+         expectedSum += i;
+   }
+
+   ROOT::EnableImplicitMT(4);
+   auto rdf = MakeSqliteDataFrame(fileNameRanges, queryRanges);
+   auto sum = rdf.Sum<Long64_t>("fint");
+   auto count = rdf.Count();
+   EXPECT_EQ(expectedSum, *sum);
+   EXPECT_EQ(ULong64_t(nRows - nRows / 3), *count);
+   // A second event loop reuses the ranges
+   EXPECT_EQ(expectedSum, *rdf.Sum<Long64_t>("fint"));
+   ROOT::DisableImplicitMT();
+
+   gSystem->Unlink(fileNameRanges);
+}
+
 TEST(RSqliteDS, IMT)
 {
    using Blob_t = std::vector<unsigned char>;
@@ -24,6 +24,7 @@
 #pragma link C++ class ROOT::Experimental::RNTupleReader-;
 #pragma link C++ class ROOT::Experimental::RNTupleWriter-;
 #pragma link C++ class ROOT::Experimental::RNTupleModel-;
+#pragma link C++ class ROOT::Experimental::RNTupleMerger-;
 
 #pragma link C++ class ROOT::Experimental::RNTuple+;
 
@@ -0,0 +1,139 @@
+/// \file ROOT/RClusterPool.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2020-07-01
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RClusterPool
+#define ROOT7_RClusterPool
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+class RPageSource;
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RClusterPool
+\ingroup NTuple
+\brief Managed a set of clusters containing compressed and packed pages
+
+The cluster pool steers the preloading of (partial) clusters. There is a two-step pipeline: in a first step,
+compressed pages are read from clusters into a memory buffer. The first pipeline step is performed by the I/O thread.
+In a second step, the consumer (usually the page source, on behalf of the reading thread) decompresses the pages it
+needs.  The cluster pool keeps a window of clusters in memory: the currently requested cluster, one cluster before
+("pre") and up to N clusters ahead ("read-ahead").  The read-ahead is limited by a budget on the total memory of
+the clusters in the pool and in flight.  Clusters outside the window are evicted.
+
+The cluster pool is used by page sources that run the I/O in a background thread.  It calls back into the page
+source by means of RPageSource::LoadCluster().  The page source must make sure that LoadCluster() can be safely
+called from the I/O thread, i.e. that no other thread uses the underlying storage resource concurrently.
+*/
+// clang-format on
+class RClusterPool {
+private:
+   /// Request to load a subset of the columns of a particular cluster.
+   /// Work items come in groups and are executed by the page source.
+   struct RReadItem {
+      std::promise<std::unique_ptr<RCluster>> fPromise;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      RCluster::ColumnSet_t fColumns;
+   };
+
+   /// Clusters that are currently being processed by the pipeline.  Every in-flight cluster has a corresponding
+   /// work item: the future is fulfilled by the I/O thread.
+   struct RInFlightCluster {
+      std::future<std::unique_ptr<RCluster>> fFuture;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      RCluster::ColumnSet_t fColumns;
+      /// The estimated number of bytes that the cluster will take in memory
+      std::size_t fMemSize = 0;
+   };
+
+   /// Every cluster pool is responsible for exactly one page source that triggers loading of the clusters
+   /// (GetCluster()) and is used for implementing the I/O (LoadCluster())
+   RPageSource &fPageSource;
+   /// The number of clusters after the currently active cluster that should be loaded in the background
+   unsigned int fReadAhead;
+   /// Upper limit of the memory taken by the clusters in the pool and in flight; zero means no limit.
+   /// The currently requested cluster is always loaded, even if it exceeds the memory budget.
+   std::size_t fMemoryBudget;
+   /// The cache of clusters around the currently active cluster
+   std::vector<std::unique_ptr<RCluster>> fPool;
+   /// The clusters that were handed off to the I/O thread; only used by the thread calling GetCluster()
+   std::vector<RInFlightCluster> fInFlightClusters;
+
+   /// Protects the shared state between the main thread and the I/O thread
+   std::mutex fLockWorkQueue;
+   /// Signals a non-empty I/O work queue
+   std::condition_variable fCvHasReadWork;
+   /// The communication channel to the I/O thread
+   std::deque<RReadItem> fReadQueue;
+   /// The I/O thread calls RPageSource::LoadCluster() asynchronously.  The thread is mostly waiting for the work
+   /// queue to be populated.
+   std::thread fThreadIo;
+
+   /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool
+   void ExecReadClusters();
+   /// Returns the given cluster from the pool, which needs to contain at least the columns `columns`.
+   /// Executed at the end of GetCluster when all the missing columns are in flight.
+   RCluster *WaitFor(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns);
+   /// Moves finished in-flight clusters into the pool; if waitId is a valid cluster id, blocks until all the
+   /// in-flight requests of the given cluster are finished
+   void CollectInFlight(DescriptorId_t waitId);
+   /// Returns the cluster with the given id from the pool or nullptr
+   RCluster *FindInPool(DescriptorId_t clusterId) const;
+   /// Upper bound of the memory needed to keep the given columns of the given cluster
+   std::size_t EstimateMemSize(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns) const;
+   /// The memory taken by the pool plus the estimated memory of the in-flight clusters
+   std::size_t GetMemSize() const;
+
+public:
+   static constexpr unsigned int kDefaultReadAhead = 2;
+
+   RClusterPool(RPageSource &pageSource, unsigned int readAhead, std::size_t memoryBudget);
+   explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultReadAhead, 0) {}
+   RClusterPool(const RClusterPool &other) = delete;
+   RClusterPool &operator =(const RClusterPool &other) = delete;
+   ~RClusterPool();
+
+   /// Returns the requested cluster either from the pool or, in case of a cache miss, lets the I/O thread load
+   /// the cluster in the pool and blocks until done.  If clusterId is in the pool but some columns are missing,
+   /// the missing columns are fetched and merged into the pool cluster.  On successful return, the clusters
+   /// following clusterId are scheduled for reading in the background, within the limits of the read-ahead depth
+   /// and the memory budget.  The returned pointer remains valid until the next call to GetCluster().
+   RCluster *GetCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns);
+
+   unsigned int GetReadAhead() const { return fReadAhead; }
+   std::size_t GetMemoryBudget() const { return fMemoryBudget; }
+   /// The number of clusters that are currently loaded and ready to be used
+   std::size_t GetNClustersInPool() const { return fPool.size(); }
+};
+
+} // namespace Detail
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -62,15 +62,26 @@ private:
    ColumnId_t fColumnIdSource;
    /// Used to pack and unpack pages on writing/reading
    std::unique_ptr<RColumnElementBase> fElement;
+   /// The column type that corresponds to fElement
+   EColumnType fElementType = EColumnType::kUnknown;
+   /// Computes the value range of in-memory pages; nullptr if the C++ type of the column has no value range
+   ValueRangeFunc_t fValueRangeFunc = nullptr;
 
    RColumn(const RColumnModel &model, std::uint32_t index);
+   /// Replaces fElement by the element of the given on-disk column model if the on-disk type differs from the
+   /// in-memory column type, e.g. for split encodings or reduced-precision floating point columns
+   void SetOnDiskModel(const RColumnModel &model);
 
 public:
+   /// The column model can request an on-disk representation other than ColumnT, e.g. a reduced-precision
+   /// floating point column.  The in-memory page layout is always the one of ColumnT.
    template <typename CppT, EColumnType ColumnT>
    static RColumn *Create(const RColumnModel &model, std::uint32_t index) {
-      R__ASSERT(model.GetType() == ColumnT);
       auto column = new RColumn(model, index);
       column->fElement = std::unique_ptr<RColumnElementBase>(new RColumnElement<CppT, ColumnT>(nullptr));
+      column->fElementType = ColumnT;
+      column->fValueRangeFunc = GetValueRangeFunc<CppT>();
+      column->SetOnDiskModel(model);
       return column;
    }
 
@@ -177,6 +188,30 @@ public:
          (clusterIndex.GetIndex() - fCurrentPage.GetClusterRangeFirst()) * RColumnElement<CppT, ColumnT>::kSize);
    }
 
+   /// Maps the contiguous range of elements from globalIndex to the end of the page that contains globalIndex.
+   /// The number of mapped elements is returned in nItems.  The pointer is valid until the next page is mapped.
+   template <typename CppT, EColumnType ColumnT>
+   CppT *MapV(const NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      if (!fCurrentPage.Contains(globalIndex)) {
+         MapPage(globalIndex);
+      }
+      nItems = fCurrentPage.GetGlobalRangeLast() - globalIndex + 1;
+      return reinterpret_cast<CppT*>(
+         static_cast<unsigned char *>(fCurrentPage.GetBuffer()) +
+         (globalIndex - fCurrentPage.GetGlobalRangeFirst()) * RColumnElement<CppT, ColumnT>::kSize);
+   }
+
+   template <typename CppT, EColumnType ColumnT>
+   CppT *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      if (!fCurrentPage.Contains(clusterIndex)) {
+         MapPage(clusterIndex);
+      }
+      nItems = fCurrentPage.GetClusterRangeLast() - clusterIndex.GetIndex() + 1;
+      return reinterpret_cast<CppT*>(
+         static_cast<unsigned char *>(fCurrentPage.GetBuffer()) +
+         (clusterIndex.GetIndex() - fCurrentPage.GetClusterRangeFirst()) * RColumnElement<CppT, ColumnT>::kSize);
+   }
+
    NTupleSize_t GetGlobalIndex(const RClusterIndex &clusterIndex) {
       if (!fCurrentPage.Contains(clusterIndex)) {
          MapPage(clusterIndex);
@@ -229,6 +264,11 @@ public:
    NTupleSize_t GetNElements() const { return fNElements; }
    RColumnElementBase *GetElement() const { return fElement.get(); }
    const RColumnModel &GetModel() const { return fModel; }
+   /// Computes the smallest and largest element of an in-memory page of the column, ignoring NaNs.  Returns false
+   /// for columns whose C++ type has no value range and for pages without non-NaN elements.
+   bool GetValueRange(const RPage &page, double &min, double &max) const {
+      return (fValueRangeFunc != nullptr) && fValueRangeFunc(page.GetBuffer(), page.GetNElements(), min, max);
+   }
    std::uint32_t GetIndex() const { return fIndex; }
    ColumnId_t GetColumnIdSource() const { return fColumnIdSource; }
    RPageSource *GetPageSource() const { return fPageSource; }
@@ -21,8 +21,11 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstring> // for memcpy
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 
 namespace ROOT {
@@ -68,7 +71,8 @@ public:
    RColumnElementBase& operator =(RColumnElementBase&& other) = default;
    virtual ~RColumnElementBase() = default;
 
-   static RColumnElementBase Generate(EColumnType type);
+   /// Creates a typed, empty element (without raw content) that matches the given column model
+   static std::unique_ptr<RColumnElementBase> Generate(const RColumnModel &model);
 
    /// Write one or multiple column elements into destination
    void WriteTo(void *destination, std::size_t count) const {
@@ -239,6 +243,211 @@ public:
    void Unpack(void *dst, void *src, std::size_t count) const final;
 };
 
+template <>
+class RColumnElement<double, EColumnType::kSplitReal64> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(double);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(double *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<float, EColumnType::kSplitReal32> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(float);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(float *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<std::int64_t, EColumnType::kSplitInt64> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(std::int64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int64_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<std::int32_t, EColumnType::kSplitInt32> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(std::int32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int32_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<ClusterSize_t, EColumnType::kSplitIndex> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(ROOT::Experimental::ClusterSize_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(ClusterSize_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<float, EColumnType::kReal32Trunc> : public RColumnElementBase {
+private:
+   std::size_t fBitsOnStorage;
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(float);
+   /// Keeps the sign, the exponent and bitsOnStorage - 9 bits of the mantissa, bitsOnStorage in [10, 31]
+   RColumnElement(float *value, std::size_t bitsOnStorage)
+      : RColumnElementBase(value, kSize), fBitsOnStorage(bitsOnStorage)
+   {
+      R__ASSERT(bitsOnStorage >= 10 && bitsOnStorage <= 31);
+   }
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<double, EColumnType::kReal64Trunc> : public RColumnElementBase {
+private:
+   std::size_t fBitsOnStorage;
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(double);
+   /// Keeps the sign, the exponent and bitsOnStorage - 12 bits of the mantissa, bitsOnStorage in [13, 63]
+   RColumnElement(double *value, std::size_t bitsOnStorage)
+      : RColumnElementBase(value, kSize), fBitsOnStorage(bitsOnStorage)
+   {
+      R__ASSERT(bitsOnStorage >= 13 && bitsOnStorage <= 63);
+   }
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<float, EColumnType::kReal32Quant> : public RColumnElementBase {
+private:
+   std::size_t fBitsOnStorage;
+   double fMin;
+   double fMax;
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(float);
+   /// Maps [min, max] linearly to integers of bitsOnStorage bits, bitsOnStorage in [1, 32].  Values outside the range
+   /// are clamped.
+   RColumnElement(float *value, std::size_t bitsOnStorage, double min, double max)
+      : RColumnElementBase(value, kSize), fBitsOnStorage(bitsOnStorage), fMin(min), fMax(max)
+   {
+      R__ASSERT(bitsOnStorage >= 1 && bitsOnStorage <= 32);
+      R__ASSERT(min < max);
+   }
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<double, EColumnType::kReal64Quant> : public RColumnElementBase {
+private:
+   std::size_t fBitsOnStorage;
+   double fMin;
+   double fMax;
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(double);
+   /// Maps [min, max] linearly to integers of bitsOnStorage bits, bitsOnStorage in [1, 32].  Values outside the range
+   /// are clamped.
+   RColumnElement(double *value, std::size_t bitsOnStorage, double min, double max)
+      : RColumnElementBase(value, kSize), fBitsOnStorage(bitsOnStorage), fMin(min), fMax(max)
+   {
+      R__ASSERT(bitsOnStorage >= 1 && bitsOnStorage <= 32);
+      R__ASSERT(min < max);
+   }
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+
+/// Type-erased computation of the smallest and largest value of an array of in-memory elements.  Returns false if
+/// there is no element other than NaN.
+using ValueRangeFunc_t = bool (*)(const void *values, std::size_t count, double &min, double &max);
+
+template <typename CppT>
+bool GetValueRange(const void *values, std::size_t count, double &min, double &max)
+{
+   auto typedValues = reinterpret_cast<const CppT *>(values);
+   bool hasRange = false;
+   for (std::size_t i = 0; i < count; ++i) {
+      const double value = typedValues[i];
+      if (std::isnan(value))
+         continue;
+      if (!hasRange) {
+         min = max = value;
+         hasRange = true;
+         continue;
+      }
+      min = std::min(min, value);
+      max = std::max(max, value);
+   }
+   return hasRange;
+}
+
+/// Value ranges are provided for arithmetic C++ types except for bool and char (e.g., the characters of strings)
+template <typename CppT>
+struct RHasValueRange : std::integral_constant<bool, std::is_arithmetic<CppT>::value &&
+                                                        !std::is_same<CppT, bool>::value &&
+                                                        !std::is_same<CppT, char>::value> {};
+
+template <typename CppT, typename std::enable_if<RHasValueRange<CppT>::value, int>::type = 0>
+ValueRangeFunc_t GetValueRangeFunc()
+{
+   return &GetValueRange<CppT>;
+}
+
+template <typename CppT, typename std::enable_if<!RHasValueRange<CppT>::value, int>::type = 0>
+ValueRangeFunc_t GetValueRangeFunc()
+{
+   return nullptr;
+}
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
@@ -18,6 +18,7 @@
 
 #include <ROOT/RStringView.hxx>
 
+#include <cstdint>
 #include <string>
 
 namespace ROOT {
@@ -48,6 +49,21 @@ enum class EColumnType {
    kInt64,
    kInt32,
    kInt16,
+   // Byte-split representations: on storage, the first bytes of all the elements of a page are stored
+   // consecutively, followed by the second bytes and so on.  Such pages compress much better than the plain ones.
+   kSplitReal64,
+   kSplitReal32,
+   kSplitInt64,
+   kSplitInt32,
+   // Byte-split representation of kIndex; the elements are stored as the difference to the preceding element
+   kSplitIndex,
+   // Reduced-precision floating point representations of float and double values. The truncated types keep the
+   // sign, the exponent and the most significant bits of the mantissa; the quantized types store integers that map
+   // a fixed value range linearly.  The number of bits on storage (and the range) are part of the column model.
+   kReal32Trunc,
+   kReal64Trunc,
+   kReal32Quant,
+   kReal64Quant,
 };
 
 // clang-format off
@@ -61,16 +77,27 @@ class RColumnModel {
 private:
    EColumnType fType;
    bool fIsSorted;
+   /// Only used by the reduced-precision column types, zero otherwise
+   std::uint32_t fBitsOnStorage = 0;
+   /// Only used by the quantized column types
+   double fMin = 0.0;
+   double fMax = 0.0;
 
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
    RColumnModel(EColumnType type, bool isSorted) : fType(type), fIsSorted(isSorted) {}
+   RColumnModel(EColumnType type, bool isSorted, std::uint32_t bitsOnStorage, double min = 0.0, double max = 0.0)
+      : fType(type), fIsSorted(isSorted), fBitsOnStorage(bitsOnStorage), fMin(min), fMax(max) {}
 
    EColumnType GetType() const { return fType; }
    bool GetIsSorted() const { return fIsSorted; }
+   std::uint32_t GetBitsOnStorage() const { return fBitsOnStorage; }
+   double GetMin() const { return fMin; }
+   double GetMax() const { return fMax; }
 
    bool operator ==(const RColumnModel &other) const {
-      return (fType == other.fType) && (fIsSorted == other.fIsSorted);
+      return (fType == other.fType) && (fIsSorted == other.fIsSorted) && (fBitsOnStorage == other.fBitsOnStorage) &&
+             (fMin == other.fMin) && (fMax == other.fMax);
    }
 };
 
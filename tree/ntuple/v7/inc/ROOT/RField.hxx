@@ -473,6 +473,12 @@ public:
    ClusterSize_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<ClusterSize_t, EColumnType::kIndex>(clusterIndex);
    }
+   ClusterSize_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<ClusterSize_t, EColumnType::kIndex>(globalIndex, nItems);
+   }
+   ClusterSize_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<ClusterSize_t, EColumnType::kIndex>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -519,6 +525,12 @@ public:
    bool *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<bool, EColumnType::kBit>(clusterIndex);
    }
+   bool *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<bool, EColumnType::kBit>(globalIndex, nItems);
+   }
+   bool *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<bool, EColumnType::kBit>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -539,6 +551,10 @@ public:
 
 template <>
 class RField<float> : public Detail::RFieldBase {
+private:
+   /// The on-disk representation of the values, plain 32bit floating point numbers unless set otherwise
+   RColumnModel fColumnModel{EColumnType::kReal32, false /* isSorted*/};
+
 public:
    static std::string TypeName() { return "float"; }
    explicit RField(std::string_view name)
@@ -546,16 +562,34 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   RFieldBase* Clone(std::string_view newName) final { return new RField(newName); }
+   RFieldBase* Clone(std::string_view newName) final {
+      auto clone = new RField(newName);
+      clone->fColumnModel = fColumnModel;
+      return clone;
+   }
 
    void GenerateColumnsImpl() final;
 
+   /// Stores the values with reduced precision: the sign, the exponent, and the nBits - 9 most significant bits of
+   /// the mantissa, nBits in [10, 31].  In memory, the values remain floats.  Needs to be set before the field is
+   /// connected to a page sink.
+   void SetTruncated(std::size_t nBits);
+   /// Stores the values as nBits wide integers, nBits in [1, 32], that map the range [min, max] linearly.  Values
+   /// outside the range are clamped.  Needs to be set before the field is connected to a page sink.
+   void SetQuantized(double min, double max, std::size_t nBits);
+
    float *Map(NTupleSize_t globalIndex) {
       return fPrincipalColumn->Map<float, EColumnType::kReal32>(globalIndex);
    }
    float *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<float, EColumnType::kReal32>(clusterIndex);
    }
+   float *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<float, EColumnType::kReal32>(globalIndex, nItems);
+   }
+   float *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<float, EColumnType::kReal32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -577,6 +611,10 @@ public:
 
 template <>
 class RField<double> : public Detail::RFieldBase {
+private:
+   /// The on-disk representation of the values, plain 64bit floating point numbers unless set otherwise
+   RColumnModel fColumnModel{EColumnType::kReal64, false /* isSorted*/};
+
 public:
    static std::string TypeName() { return "double"; }
    explicit RField(std::string_view name)
@@ -584,16 +622,34 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   RFieldBase* Clone(std::string_view newName) final { return new RField(newName); }
+   RFieldBase* Clone(std::string_view newName) final {
+      auto clone = new RField(newName);
+      clone->fColumnModel = fColumnModel;
+      return clone;
+   }
 
    void GenerateColumnsImpl() final;
 
+   /// Stores the values with reduced precision: the sign, the exponent, and the nBits - 12 most significant bits of
+   /// the mantissa, nBits in [13, 63].  In memory, the values remain doubles.  Needs to be set before the field is
+   /// connected to a page sink.
+   void SetTruncated(std::size_t nBits);
+   /// Stores the values as nBits wide integers, nBits in [1, 32], that map the range [min, max] linearly.  Values
+   /// outside the range are clamped.  Needs to be set before the field is connected to a page sink.
+   void SetQuantized(double min, double max, std::size_t nBits);
+
    double *Map(NTupleSize_t globalIndex) {
       return fPrincipalColumn->Map<double, EColumnType::kReal64>(globalIndex);
    }
    double *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<double, EColumnType::kReal64>(clusterIndex);
    }
+   double *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<double, EColumnType::kReal64>(globalIndex, nItems);
+   }
+   double *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<double, EColumnType::kReal64>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -631,6 +687,12 @@ public:
    std::uint8_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::uint8_t, EColumnType::kByte>(clusterIndex);
    }
+   std::uint8_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint8_t, EColumnType::kByte>(globalIndex, nItems);
+   }
+   std::uint8_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint8_t, EColumnType::kByte>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -668,6 +730,12 @@ public:
    std::int32_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::int32_t, EColumnType::kInt32>(clusterIndex);
    }
+   std::int32_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::int32_t, EColumnType::kInt32>(globalIndex, nItems);
+   }
+   std::int32_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::int32_t, EColumnType::kInt32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -705,6 +773,12 @@ public:
    std::uint32_t *Map(const RClusterIndex clusterIndex) {
       return fPrincipalColumn->Map<std::uint32_t, EColumnType::kInt32>(clusterIndex);
    }
+   std::uint32_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint32_t, EColumnType::kInt32>(globalIndex, nItems);
+   }
+   std::uint32_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint32_t, EColumnType::kInt32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -742,6 +816,12 @@ public:
    std::uint64_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::uint64_t, EColumnType::kInt64>(clusterIndex);
    }
+   std::uint64_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint64_t, EColumnType::kInt64>(globalIndex, nItems);
+   }
+   std::uint64_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint64_t, EColumnType::kInt64>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
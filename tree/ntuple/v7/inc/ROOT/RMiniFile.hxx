@@ -138,7 +138,8 @@ private:
       TFile *fFile = nullptr;
       /// Low-level writing using a TFile
       void Write(const void *buffer, size_t nbytes, std::int64_t offset);
-      /// Writes an RBlob opaque key with the provided buffer as data record and returns the offset of the record
+      /// Writes an RBlob opaque key with the provided buffer as data record and returns the offset of the record.
+      /// If buffer is nullptr, only the key is written and the space for the data record is reserved.
       std::uint64_t WriteKey(const void *buffer, size_t nbytes, size_t len);
       operator bool() const { return fFile; }
    };
@@ -216,6 +217,12 @@ public:
    std::uint64_t WriteNTupleFooter(const void *data, size_t nbytes, size_t lenFooter);
    /// Writes a new record as an RBlob key into the file
    std::uint64_t WriteBlob(const void *data, size_t nbytes, size_t len);
+   /// Reserves a new record as an RBlob key in the file and returns the offset of the record.  The record needs
+   /// to be filled by WriteIntoReservedBlob() before any other record is written.
+   std::uint64_t ReserveBlob(size_t nbytes, size_t len);
+   /// Write into a reserved record; the caller is responsible for making sure that the written byte range is in the
+   /// previously reserved blob.
+   void WriteIntoReservedBlob(const void *buffer, size_t nbytes, std::int64_t offset);
    /// Writes the RNTuple key to the file so that the header and footer keys can be found
    void Commit();
 };
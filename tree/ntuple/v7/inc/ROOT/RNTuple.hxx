@@ -26,8 +26,10 @@
 
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -48,6 +50,7 @@ enum class ENTupleInfo {
    kSummary,  // The ntuple name, description, number of entries
    kStorageDetails, // size on storage, page sizes, compression factor, etc.
    kMetrics, // internals performance counters, requires that EnableMetrics() was called
+   kTiming, // time spent per column and phase of reading, requires that EnableMetrics() was called
 };
 
 /**
@@ -101,8 +104,11 @@ public:
 
    static std::unique_ptr<RNTupleReader> Open(std::unique_ptr<RNTupleModel> model,
                                               std::string_view ntupleName,
-                                              std::string_view storage);
-   static std::unique_ptr<RNTupleReader> Open(std::string_view ntupleName, std::string_view storage);
+                                              std::string_view storage,
+                                              const RNTupleReadOptions &options = RNTupleReadOptions());
+   static std::unique_ptr<RNTupleReader> Open(std::string_view ntupleName,
+                                              std::string_view storage,
+                                              const RNTupleReadOptions &options = RNTupleReadOptions());
 
    /// The user imposes an ntuple model, which must be compatible with the model found in the data on storage
    RNTupleReader(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSource> source);
@@ -134,6 +140,13 @@ public:
    }
 
    RNTupleGlobalRange GetEntryRange() { return RNTupleGlobalRange(0, GetNEntries()); }
+   /// Returns the sorted, disjoint entry ranges that can contain entries for which (some of) the values of the
+   /// given field are within [min, max].  The ranges are determined from the cluster and page statistics, if the
+   /// ntuple was written with statistics (see RNTupleWriteOptions::SetUseStatistics()).  Entries outside the
+   /// returned ranges certainly do not match, so that their clusters and pages need not be read at all; entries
+   /// inside the ranges still need to be tested.  Fields without statistics, such as strings or collections, yield
+   /// the full entry range.
+   std::vector<RNTupleGlobalRange> GetEntryRanges(std::string_view fieldName, double min, double max);
 
    /// Provides access to an individual field that can contain either a scalar value or a collection, e.g.
    /// GetView<double>("particles.pt") or GetView<std::vector<double>>("particle").  It can as well be the index
@@ -152,6 +165,7 @@ public:
    RIterator end() { return RIterator(GetNEntries()); }
 
    void EnableMetrics() { fMetrics.Enable(); }
+   void DisableMetrics() { fMetrics.Disable(); }
 };
 
 // clang-format off
@@ -200,6 +214,57 @@ public:
    }
    /// Ensure that the data from the so far seen Fill calls has been written to storage
    void CommitCluster();
+
+   RNTupleModel *GetModel() { return fModel.get(); }
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief Writes a single ntuple from several threads concurrently
+
+The parallel writer hands out fill contexts, one per thread.  A fill context is an RNTupleWriter of its own with a
+clone of the ntuple model; its columns and page buffers are private to the thread.  The fill context's pages are
+compressed and sealed on cluster commit.  Only the hand-over of the sealed cluster to the shared page sink, which
+results in a single vector write, is serialized.  Thus, a fill context produces complete clusters and there is no
+need for a further serialization and merge step like in TBufferMerger.
+
+The entries of different fill contexts are interleaved cluster by cluster; their order in the resulting ntuple is
+not deterministic.  All the fill contexts must be destructed before the parallel writer.
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The prototype model for the fill contexts' models.  Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   /// Protects the shared sink and the members below
+   std::mutex fMutex;
+   /// The number of entries committed by all the fill contexts so far
+   NTupleSize_t fNEntries = 0;
+   /// The number of fill contexts that are currently alive
+   std::size_t fNFillContexts = 0;
+
+public:
+   /// The page sink of a fill context.  Passes the sealed clusters on to the parallel writer's shared sink.
+   class RFillContextSink;
+
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName,
+                                                          std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter&) = delete;
+   RNTupleParallelWriter& operator=(const RNTupleParallelWriter&) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Thread-safe.  The fill context must be used by one thread at a time only.  Entries for the fill context have
+   /// to be created from the fill context's model, not from the parallel writer's model.
+   std::unique_ptr<RNTupleWriter> CreateFillContext();
+   /// Number of entries of the committed clusters of all fill contexts
+   NTupleSize_t GetNEntries();
 };
 
 // clang-format off
@@ -160,6 +160,25 @@ public:
       }
    };
 
+   /// Optional summary of the values of the elements of a page or of a column range.  The statistics are only
+   /// available for columns of arithmetic C++ types and if the ntuple was written with statistics enabled.
+   struct RStatistics {
+      /// Whether fMin and fMax are set; false if unknown or if there is no non-NaN element
+      bool fHasRange = false;
+      /// Smallest and largest element value, ignoring NaNs
+      double fMin = 0.0;
+      double fMax = 0.0;
+
+      bool operator==(const RStatistics &other) const {
+         return fHasRange == other.fHasRange && fMin == other.fMin && fMax == other.fMax;
+      }
+
+      /// Widens the range such that it covers the range of other, too
+      void Merge(const RStatistics &other);
+      /// Returns false only if certainly none of the summarized elements is within [min, max]
+      bool MayOverlap(double min, double max) const { return !fHasRange || ((fMin <= max) && (fMax >= min)); }
+   };
+
    /// The window of element indexes of a particular column in a particular cluster
    struct RColumnRange {
       DescriptorId_t fColumnId = kInvalidDescriptorId;
@@ -170,13 +189,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The union of the statistics of the pages of the column in the cluster
+      RStatistics fStatistics;
 
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fStatistics == other.fStatistics;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -193,9 +212,10 @@ public:
          ClusterSize_t fNElements = kInvalidClusterIndex;
          /// The meaning of fLocator depends on the storage backend.
          RLocator fLocator;
+         RStatistics fStatistics;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fStatistics == other.fStatistics;
          }
       };
 
@@ -307,6 +327,8 @@ public:
    static constexpr unsigned int kNBytesPreamble = 8;
    /// The last few bytes after the footer store the length of footer and header
    static constexpr unsigned int kNBytesPostscript = 16;
+   /// Set in the flags of the footer if the cluster summaries are followed by the page and column range statistics
+   static constexpr std::uint64_t kFooterFlagStatistics = 0x01;
 
    RNTupleDescriptor() = default;
    RNTupleDescriptor(const RNTupleDescriptor &other) = delete;
@@ -357,6 +379,10 @@ public:
    DescriptorId_t FindFieldId(std::string_view fieldName) const;
    DescriptorId_t FindColumnId(DescriptorId_t fieldId, std::uint32_t columnIndex) const;
    DescriptorId_t FindClusterId(DescriptorId_t columnId, NTupleSize_t index) const;
+   /// Returns the cluster that follows the given cluster in the entry range or kInvalidDescriptorId
+   DescriptorId_t FindNextClusterId(DescriptorId_t clusterId) const;
+   /// Returns the cluster that precedes the given cluster in the entry range or kInvalidDescriptorId
+   DescriptorId_t FindPrevClusterId(DescriptorId_t clusterId) const;
 
    /// Re-create the C++ model from the stored meta-data
    std::unique_ptr<RNTupleModel> GenerateModel() const;
@@ -0,0 +1,71 @@
+/// \file ROOT/RNTupleMerger.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2020-07-27
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleMerger
+#define ROOT7_RNTupleMerger
+
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+namespace Detail {
+class RPageSink;
+class RPageSource;
+} // namespace Detail
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates ntuples with the same schema without decompressing their pages
+
+The merger appends the clusters of the sources to the destination one after another.  The on-disk pages are read
+cluster by cluster and handed to the destination as sealed pages.  If the on-disk column type and the compression
+settings of a source column match the destination, the pages are copied byte by byte.  Otherwise, the pages are
+unpacked and sealed again according to the destination.  In both cases, only the meta-data (the descriptor) is
+rebuilt by the destination.
+
+All the sources need to have the same fields and columns as the first source, from which the schema of the
+destination is derived.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   std::uint64_t fNPagesCopied = 0;
+   std::uint64_t fNPagesResealed = 0;
+
+public:
+   /// Creates the destination from the schema of the first source and appends the entries of all the sources.  The
+   /// sources need to be attached; the destination must not be created yet.  Throws if the schemas do not match.
+   void Merge(const std::vector<Detail::RPageSource *> &sources, Detail::RPageSink &destination);
+   /// Merges the ntuples of the given name in the input files into a new ntuple in the output file
+   void Merge(std::string_view ntupleName, const std::vector<std::string> &inputPaths, std::string_view outputPath,
+              const RNTupleWriteOptions &options = RNTupleWriteOptions());
+
+   /// The number of pages that have been copied without decompression
+   std::uint64_t GetNPagesCopied() const { return fNPagesCopied; }
+   /// The number of pages that had to be unpacked and sealed again
+   std::uint64_t GetNPagesResealed() const { return fNPagesResealed; }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -24,7 +24,9 @@
 #include <chrono>
 #include <cstdint>
 #include <ctime> // for CPU time measurement with clock()
+#include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -58,6 +60,7 @@ public:
       : fName(name), fUnit(unit), fDescription(desc) {}
    virtual ~RNTuplePerfCounter();
    void Enable() { fIsEnabled = true; }
+   void Disable() { fIsEnabled = false; }
    bool IsEnabled() const { return fIsEnabled; }
    std::string GetName() const { return fName; }
    std::string GetDescription() const { return fDescription; }
@@ -183,7 +186,8 @@ public:
 \ingroup NTuple
 \brief Record wall time and CPU time between construction and destruction
 
-Uses RAII as a stop watch. Only the wall time counter is used to determine whether the timer is active.
+Uses RAII as a stop watch. Only the wall time counter is used to determine whether the timer is active.  A timer that
+is started while the counters are disabled does not record anything, even if the counters get enabled before it stops.
 */
 // clang-format on
 template <typename WallTimeT, typename CpuTimeT>
@@ -196,20 +200,21 @@ private:
    /// Wall clock time
    Clock_t::time_point fStartTime;
    /// CPU time
-   clock_t fStartTicks;
+   clock_t fStartTicks = 0;
+   bool fIsActive;
 
 public:
    RNTupleTimer(WallTimeT &ctrWallTime, CpuTimeT &ctrCpuTicks)
-      : fCtrWallTime(ctrWallTime), fCtrCpuTicks(ctrCpuTicks)
+      : fCtrWallTime(ctrWallTime), fCtrCpuTicks(ctrCpuTicks), fIsActive(ctrWallTime.IsEnabled())
    {
-      if (!fCtrWallTime.IsEnabled())
+      if (!fIsActive)
          return;
       fStartTime = Clock_t::now();
       fStartTicks = clock();
    }
 
    ~RNTupleTimer() {
-      if (!fCtrWallTime.IsEnabled())
+      if (!fIsActive)
          return;
       auto wallTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock_t::now() - fStartTime);
       fCtrWallTime.Add(wallTimeNs.count());
@@ -256,6 +261,8 @@ public:
    {
       R__ASSERT(!Contains(name));
       auto counter = std::make_unique<std::remove_pointer_t<CounterPtrT>>(name, unit, desc);
+      if (fIsEnabled)
+         counter->Enable();
       auto ptrCounter = counter.get();
       fCounters.emplace_back(std::move(counter));
       return ptrCounter;
@@ -265,9 +272,75 @@ public:
 
    void Print(std::ostream &output, const std::string &prefix = "") const;
    void Enable();
+   void Disable();
    bool IsEnabled() const { return fIsEnabled; }
 };
 
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleTimingCollector
+\ingroup NTuple
+\brief Thread-safe collection of wall time and CPU time counters for the phases of reading, per column
+
+The counters for a given name, usually a column, and phase are created on first use and stay valid for the lifetime
+of the collector.  Lookups take a lock, so callers on the hot path should keep the returned counters.  A collector
+can be shared by several page sources, e.g. a page source and its clones, in order to aggregate the times of all the
+reading threads.  The counters are registered in the collector's metrics and can thus be enabled and disabled at
+runtime together with the metrics that observe the collector.
+*/
+// clang-format on
+class RNTupleTimingCollector {
+public:
+   /// The counters of a phase, either for a particular column or for the entire data set
+   struct RPhaseCounters {
+      RNTupleAtomicCounter &fNCalls;
+      RNTupleAtomicCounter &fTimeWall;
+      RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpu;
+   };
+
+   /// Records a call and the time spent between construction and destruction in the given phase counters
+   class RPhaseTimer {
+   private:
+      RNTupleAtomicTimer fTimer;
+   public:
+      explicit RPhaseTimer(RPhaseCounters &counters) : fTimer(counters.fTimeWall, counters.fTimeCpu) {
+         counters.fNCalls.Inc();
+      }
+   };
+
+   /// A line of the flat timing table
+   struct RTableRow {
+      /// Column name or empty for phases that are not attributed to a single column
+      std::string fName;
+      std::string fPhase;
+      std::int64_t fNCalls = 0;
+      std::int64_t fTimeWallNs = 0;
+      std::int64_t fTimeCpuNs = 0;
+   };
+
+private:
+   using Key_t = std::pair<std::string, std::string>;
+
+   RNTupleMetrics fMetrics;
+   std::map<Key_t, std::unique_ptr<RPhaseCounters>> fCounters;
+   mutable std::mutex fLock;
+
+public:
+   explicit RNTupleTimingCollector(const std::string &name) : fMetrics(name) {}
+   RNTupleTimingCollector(const RNTupleTimingCollector &other) = delete;
+   RNTupleTimingCollector &operator =(const RNTupleTimingCollector &other) = delete;
+
+   /// Returns the counters of the given phase for the given name, which is empty for data set wide phases
+   RPhaseCounters &GetCounters(const std::string &name, const std::string &phase);
+   /// One row per name and phase that has been recorded at least once, ordered by name and phase
+   std::vector<RTableRow> GetTable() const;
+   /// Prints the table with one line per name and phase
+   void PrintTable(std::ostream &output) const;
+
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
+};
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
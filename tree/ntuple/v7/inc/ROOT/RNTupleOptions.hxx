@@ -18,6 +18,8 @@
 
 #include <Compression.h>
 
+#include <cstddef>
+
 namespace ROOT {
 namespace Experimental {
 
@@ -46,6 +48,15 @@ All page sink classes need to support the common options.
 class RNTupleWriteOptions {
   int fCompression{RCompressionSetting::EDefaults::kUseAnalysis};
   ENTupleContainerFormat fContainerFormat{ENTupleContainerFormat::kTFile};
+  /// Buffer the pages of a cluster in memory, compress them in parallel (with implicit multi-threading) and write
+  /// the entire cluster at once when it is committed
+  bool fUseBufferedWrite{false};
+  /// Store floating point, integer and index columns in their byte-split (and for index columns delta) encoding,
+  /// which trades some CPU time on writing and reading for better compression
+  bool fUseSplitEncoding{false};
+  /// Compute the value range of the elements of every page and column range of arithmetic columns and store it
+  /// in the footer, which allows readers to skip clusters and pages that cannot satisfy a range predicate
+  bool fUseStatistics{false};
 
 public:
   RNTupleWriteOptions() = default;
@@ -58,6 +69,15 @@ public:
 
   ENTupleContainerFormat GetContainerFormat() const { return fContainerFormat; }
   void SetContainerFormat(ENTupleContainerFormat val) { fContainerFormat = val; }
+
+  bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
+  void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
+
+  bool GetUseSplitEncoding() const { return fUseSplitEncoding; }
+  void SetUseSplitEncoding(bool val) { fUseSplitEncoding = val; }
+
+  bool GetUseStatistics() const { return fUseStatistics; }
+  void SetUseStatistics(bool val) { fUseStatistics = val; }
 };
 
 
@@ -71,6 +91,40 @@ All page source classes need to support the common options.
 */
 // clang-format on
 class RNTupleReadOptions {
+public:
+  enum EClusterCache {
+    kOff,
+    kOn,
+    kDefault = kOn,
+  };
+
+  /// The number of clusters after the current one that are loaded in the background
+  static constexpr unsigned int kDefaultClusterReadAhead = 2;
+
+private:
+  EClusterCache fClusterCache = EClusterCache::kDefault;
+  unsigned int fClusterReadAhead = kDefaultClusterReadAhead;
+  /// Upper limit in bytes for the compressed pages kept by the cluster cache; zero means no limit
+  std::size_t fClusterCacheMemory = 0;
+  /// Memory-map the on-disk pages of the clusters instead of reading them into a buffer.  Uncompressed pages whose
+  /// on-disk layout equals the in-memory layout are then used in place, without copy.  Only effective with the
+  /// cluster cache and for storage that supports memory mapping, e.g. local files.
+  bool fUseMmap = false;
+  /// Upper limit in bytes for the decompressed pages kept by the page pool, which is shared by a page source and
+  /// its clones.  Unused pages are cached until the limit is reached; zero means that unused pages are freed.
+  std::size_t fPagePoolMemory = 0;
+
+public:
+  EClusterCache GetClusterCache() const { return fClusterCache; }
+  void SetClusterCache(EClusterCache val) { fClusterCache = val; }
+  unsigned int GetClusterReadAhead() const { return fClusterReadAhead; }
+  void SetClusterReadAhead(unsigned int val) { fClusterReadAhead = val; }
+  std::size_t GetClusterCacheMemory() const { return fClusterCacheMemory; }
+  void SetClusterCacheMemory(std::size_t val) { fClusterCacheMemory = val; }
+  bool GetUseMmap() const { return fUseMmap; }
+  void SetUseMmap(bool val) { fUseMmap = val; }
+  std::size_t GetPagePoolMemory() const { return fPagePoolMemory; }
+  void SetPagePoolMemory(std::size_t val) { fPagePoolMemory = val; }
 };
 
 } // namespace Experimental
@@ -18,13 +18,17 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
+#include <ROOT/RVec.hxx>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <unordered_map>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -62,6 +66,8 @@ public:
    RNTupleGlobalRange(NTupleSize_t start, NTupleSize_t end) : fStart(start), fEnd(end) {}
    RIterator begin() { return RIterator(fStart); }
    RIterator end() { return RIterator(fEnd); }
+   NTupleSize_t GetStart() const { return fStart; }
+   NTupleSize_t GetEnd() const { return fEnd; }
 };
 
 
@@ -133,13 +139,28 @@ The view owns a field and its underlying columns in order to fill an ntuple valu
 accessed by index. For top level fields, the index refers to the entry number. Fields that are part of
 nested collections have global index numbers that are derived from their parent indexes.
 
-Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+Fields of simple types with a Map() method will use that and thus expose zero-copy access.  For such fields, MapV()
+provides bulk access to a range of elements: it returns spans that point directly into the page buffers, so that
+tight loops, e.g. vectorized kernels, can run over whole pages without a per-element call into the field.
+
+~~~ {.cpp}
+for (NTupleSize_t i = 0; i < n; ) {
+   auto span = view.MapV(i, n - i);
+   // ... process span.data()[0 .. span.size()) ...
+   i += span.size();
+}
+~~~
 */
 // clang-format on
+template <typename T>
+class RNTupleViewSoA;
+
 template <typename T>
 class RNTupleView {
    friend class RNTupleReader;
    friend class RNTupleViewCollection;
+   template <typename U>
+   friend class RNTupleViewSoA;
 
    using FieldT = RField<T>;
 
@@ -192,6 +213,114 @@ public:
       fField.Read(clusterIndex, &fValue);
       return *fValue.Get<T>();
    }
+
+   /// Returns the contiguous elements from globalIndex up to the end of the page containing globalIndex, but not more
+   /// than maxItems elements.  The span is valid until the next access through the view.
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, std::span<const C>>
+   MapV(NTupleSize_t globalIndex, NTupleSize_t maxItems) {
+      NTupleSize_t nItems;
+      const C *data = fField.MapV(globalIndex, nItems);
+      return std::span<const C>(data, std::min(nItems, maxItems));
+   }
+
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, std::span<const C>>
+   MapV(const RClusterIndex &clusterIndex, NTupleSize_t maxItems) {
+      NTupleSize_t nItems;
+      const C *data = fField.MapV(clusterIndex, nItems);
+      return std::span<const C>(data, std::min(nItems, maxItems));
+   }
+};
+
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleViewSoA
+\ingroup NTuple
+\brief Struct-of-arrays access to a data member of the items of a collection
+
+For a collection of objects, e.g. std::vector<Hit>, the view provides the values of a single, mappable data member
+of all the items of a collection, e.g. all the hit.x of an event, as an RVec.  The RVec points directly into the page
+of the member column, so that no objects are constructed and no per-item field call is needed.  Only if the items
+of the collection are spread over several pages, they are copied into a buffer owned by the view.  The RVec is valid
+until the next access through the view and must not be modified.
+
+~~~ {.cpp}
+auto viewHits = ntuple->GetViewCollection("hits");
+auto viewX = viewHits.GetViewSoA<float>("x");
+auto viewY = viewHits.GetViewSoA<float>("y");
+for (auto i : ntuple->GetEntryRange()) {
+   const auto &x = viewX(i);
+   const auto &y = viewY(i);
+   auto r = ROOT::VecOps::sqrt(x * x + y * y);
+}
+~~~
+*/
+// clang-format on
+template <typename T>
+class RNTupleViewSoA {
+   friend class RNTupleViewCollection;
+
+   static_assert(Internal::IsMappable<RField<T>>::value && !std::is_same<T, bool>::value,
+                 "SoA views require a mappable member type");
+
+private:
+   RNTupleView<ClusterSize_t> fCollectionView;
+   RNTupleView<T> fMemberView;
+   /// The values of the current collection, pointing either into a page or into fBuffer
+   ROOT::VecOps::RVec<T> fValues;
+   /// Holds a copy of the values of collections whose items span several pages
+   std::vector<T> fBuffer;
+
+   RNTupleViewSoA(DescriptorId_t collectionFieldId, DescriptorId_t memberFieldId, Detail::RPageSource *source)
+      : fCollectionView(collectionFieldId, source), fMemberView(memberFieldId, source)
+   {}
+
+   const ROOT::VecOps::RVec<T> &Adopt(const RClusterIndex &collectionStart, ClusterSize_t::ValueType size)
+   {
+      if (size == 0) {
+         fValues.clear();
+         return fValues;
+      }
+      auto span = fMemberView.MapV(collectionStart, size);
+      T *data = const_cast<T *>(span.data());
+      if (span.size() < size) {
+         fBuffer.resize(size);
+         auto nCopied = span.size();
+         std::copy(span.begin(), span.end(), fBuffer.begin());
+         while (nCopied < size) {
+            auto chunk = fMemberView.MapV(
+               RClusterIndex(collectionStart.GetClusterId(), collectionStart.GetIndex() + nCopied), size - nCopied);
+            std::copy(chunk.begin(), chunk.end(), fBuffer.begin() + nCopied);
+            nCopied += chunk.size();
+         }
+         data = fBuffer.data();
+      }
+      ROOT::VecOps::RVec<T> values(data, size);
+      std::swap(fValues, values);
+      return fValues;
+   }
+
+public:
+   RNTupleViewSoA(const RNTupleViewSoA &other) = delete;
+   RNTupleViewSoA(RNTupleViewSoA &&other) = default;
+   RNTupleViewSoA &operator=(const RNTupleViewSoA &other) = delete;
+   RNTupleViewSoA &operator=(RNTupleViewSoA &&other) = default;
+   ~RNTupleViewSoA() = default;
+
+   const ROOT::VecOps::RVec<T> &operator()(NTupleSize_t globalIndex) {
+      ClusterSize_t size;
+      RClusterIndex collectionStart;
+      fCollectionView.fField.GetCollectionInfo(globalIndex, &collectionStart, &size);
+      return Adopt(collectionStart, size);
+   }
+   const ROOT::VecOps::RVec<T> &operator()(const RClusterIndex &clusterIndex) {
+      ClusterSize_t size;
+      RClusterIndex collectionStart;
+      fCollectionView.fField.GetCollectionInfo(clusterIndex, &collectionStart, &size);
+      return Adopt(collectionStart, size);
+   }
 };
 
 
@@ -246,6 +375,20 @@ public:
       auto fieldId = fSource->GetDescriptor().FindFieldId(fieldName, fCollectionFieldId);
       return RNTupleViewCollection(fieldId, fSource);
    }
+   /// Provides the values of the given member of all the items of a collection as an RVec.  The member is either a
+   /// direct sub field of the collection, as for collections created by RNTupleModel::MakeCollection(), or a member
+   /// of the collection's class item field, as for std::vector<Hit>.
+   template <typename T>
+   RNTupleViewSoA<T> GetViewSoA(std::string_view memberName) {
+      const auto &desc = fSource->GetDescriptor();
+      auto fieldId = desc.FindFieldId(memberName, fCollectionFieldId);
+      if (fieldId == kInvalidDescriptorId) {
+         const auto &itemIds = desc.GetFieldDescriptor(fCollectionFieldId).GetLinkIds();
+         if ((itemIds.size() == 1) && (desc.GetFieldDescriptor(itemIds[0]).GetStructure() == ENTupleStructure::kRecord))
+            fieldId = desc.FindFieldId(memberName, itemIds[0]);
+      }
+      return RNTupleViewSoA<T>(fCollectionFieldId, fieldId, fSource);
+   }
 
    ClusterSize_t operator()(NTupleSize_t globalIndex) {
       ClusterSize_t size;
@@ -0,0 +1,112 @@
+/// \file ROOT/RObjectStore.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2020-08-03
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RObjectStore
+#define ROOT7_RObjectStore
+
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RObjectStore
+\ingroup NTuple
+\brief Abstract interface to a flat key-value store of immutable blobs, such as DAOS or an S3 bucket
+
+Objects are written and read as a whole; there are no partial updates.  The vector operations issue the requests
+concurrently, so that the throughput can scale with the number of storage nodes rather than being limited by a
+single stream.  Implementations must allow for concurrent calls of Put() and Get().
+
+The object store is selected by the scheme of the location URI.  Currently, the "objstore://" scheme maps objects
+to the files of a local or network mounted directory, e.g. "objstore:///data/ntuples".
+*/
+// clang-format on
+class RObjectStore {
+public:
+   /// A request to store or to retrieve a single object.  For Put requests, fBuffer points to the object's data; for
+   /// Get requests, fBuffer needs to provide fSize bytes of space.
+   struct RRequest {
+      RRequest() = default;
+      RRequest(const std::string &key, void *buffer, std::size_t size) : fKey(key), fBuffer(buffer), fSize(size) {}
+
+      std::string fKey;
+      void *fBuffer = nullptr;
+      std::size_t fSize = 0;
+      /// Set by GetV() to the number of bytes actually read
+      std::size_t fOutBytes = 0;
+   };
+
+   static constexpr const char *kURIScheme = "objstore://";
+
+   virtual ~RObjectStore() = default;
+   /// Creates the object store for the given location URI.  Throws if the scheme is not supported.
+   static std::unique_ptr<RObjectStore> Create(std::string_view uri);
+   /// Whether the location refers to an object store rather than to a file
+   static bool IsObjectStoreURI(std::string_view location);
+
+   /// Creates a new connection to the same object store, e.g. for reading in multiple threads
+   virtual std::unique_ptr<RObjectStore> Clone() const = 0;
+   /// Stores the blob under the given key; an existing object with the same key is replaced
+   virtual void Put(const std::string &key, const void *buffer, std::size_t nbytes) = 0;
+   /// Retrieves up to nbytes of the object with the given key and returns the number of bytes read.  Throws if the
+   /// object does not exist.
+   virtual std::size_t Get(const std::string &key, void *buffer, std::size_t nbytes) = 0;
+
+   /// Stores all the given objects.  The default implementation issues the requests in parallel using the
+   /// implicit multi-threading task pool, if enabled.
+   virtual void PutV(const std::vector<RRequest> &requests);
+   /// Retrieves all the given objects.  The default implementation issues the requests in parallel using the
+   /// implicit multi-threading task pool, if enabled.
+   virtual void GetV(std::vector<RRequest> &requests);
+};
+
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RObjectStorePosix
+\ingroup NTuple
+\brief An object store that keeps every object in a separate file of a directory
+
+Useful for testing and for object stores that are exposed through a (distributed) file system.  The directory is
+created if it does not exist.
+*/
+// clang-format on
+class RObjectStorePosix : public RObjectStore {
+private:
+   std::string fDirectory;
+
+   /// Maps the key to a file name in fDirectory; slashes are escaped
+   std::string GetPath(const std::string &key) const;
+
+public:
+   explicit RObjectStorePosix(std::string_view directory);
+
+   std::unique_ptr<RObjectStore> Clone() const final;
+   void Put(const std::string &key, const void *buffer, std::size_t nbytes) final;
+   std::size_t Get(const std::string &key, void *buffer, std::size_t nbytes) final;
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -53,7 +53,7 @@ public:
    RPageDeleter &operator =(const RPageDeleter &other) = default;
    ~RPageDeleter() = default;
 
-   void operator()(const RPage &page) { fFnDelete(page, fUserData); }
+   void operator()(const RPage &page) const { fFnDelete(page, fUserData); }
 };
 
 
@@ -18,10 +18,16 @@
 
 #include <ROOT/RPage.hxx>
 #include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
 #include <cstddef>
-#include <vector>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
 
 namespace ROOT {
 namespace Experimental {
@@ -37,40 +43,113 @@ namespace Detail {
 The page pool provides memory tracking for data written into an ntuple or read from an ntuple. Adding and removing
 pages is thread-safe. The page pool does not allocate the memory -- allocation and deallocation is performed by the
 page storage, which might do it in a way optimized to the backing store (e.g., mmap()).
-Multiple page caches can coexist.
+Multiple page caches can coexist, and a page pool can be shared by several page sources, e.g. the clones of a page
+source that read the same ntuple in different threads.  Pages are identified by their column, cluster, and first
+element in the cluster.
 
-TODO(jblomer): it should be possible to register pages and to find them by column and index; this would
-facilitate pre-filling a cache, e.g. by read-ahead.
+Pages can be preloaded into the pool, e.g. by decompression tasks that run ahead of the reading thread. Preloaded
+pages have a reference counter of zero until they are requested by GetPage(). Unused preloaded pages are freed by
+EvictPreloadedPages() or when the page pool is destructed.
+
+If the page pool has a memory budget, pages whose reference counter drops to zero are not freed right away but kept
+for later GetPage() calls.  Once the pool's pages take more memory than the budget, the least recently used pages that
+are not referenced are freed.  Without a budget, returned pages are freed as soon as they are not referenced anymore.
+
+The pages of the pool are accounted in the TMemoryAccounting::kNTuple category.
 */
 // clang-format on
 class RPagePool {
+public:
+   /// Identifies a page in the pool
+   struct RKey {
+      ColumnId_t fColumnId = kInvalidColumnId;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      /// The index of the first element of the page within the cluster
+      NTupleSize_t fFirstInCluster = 0;
+
+      RKey() = default;
+      RKey(ColumnId_t columnId, DescriptorId_t clusterId, NTupleSize_t firstInCluster)
+         : fColumnId(columnId), fClusterId(clusterId), fFirstInCluster(firstInCluster) {}
+      bool operator <(const RKey &other) const {
+         return std::tie(fColumnId, fClusterId, fFirstInCluster) <
+                std::tie(other.fColumnId, other.fClusterId, other.fFirstInCluster);
+      }
+   };
+
 private:
-   /// TODO(jblomer): should be an efficient index structure that allows
-   ///   - random insert
-   ///   - random delete
-   ///   - searching by page
-   ///   - searching by tree index
-   std::vector<RPage> fPages;
-   std::vector<std::uint32_t> fReferences;
-   std::vector<RPageDeleter> fDeleters;
+   using LruList_t = std::list<RKey>;
+
+   struct REntry {
+      RPage fPage;
+      RPageDeleter fDeleter;
+      std::uint32_t fRefCount = 0;
+      /// Set for preloaded pages until they are requested by GetPage()
+      bool fIsPreloaded = false;
+      /// Position in fUnusedPages; valid if and only if the reference counter is zero
+      LruList_t::iterator fLruPosition;
+   };
+   using EntryMap_t = std::map<RKey, REntry>;
+
+   /// Page pool performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fNHit;
+      RNTupleAtomicCounter &fNMiss;
+      RNTupleAtomicCounter &fNEvict;
+   };
+
+   EntryMap_t fEntries;
+   /// The pages with a reference counter of zero, the most recently used first
+   LruList_t fUnusedPages;
+   /// The memory budget; zero means that returned pages are not cached
+   std::size_t fMaxMemory;
+   /// The sum of the sizes of all the pages in the pool
+   std::size_t fMemSize = 0;
+   RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+   /// Protects the page map; pages may be registered concurrently, e.g. by parallel decompression tasks
+   std::mutex fLock;
+
+   static RKey MakeKey(const RPage &page);
+   /// Returns the entry of the page that contains the given element or fEntries.end(); the caller must hold fLock
+   EntryMap_t::iterator FindEntry(ColumnId_t columnId, const RClusterIndex &clusterIndex);
+   /// Increases the reference counter of the entry and returns its page; the caller must hold fLock
+   RPage AcquireEntry(EntryMap_t::iterator itr);
+   /// Frees the page of the entry and removes the entry; the caller must hold fLock
+   void EraseEntry(EntryMap_t::iterator itr);
+   /// Frees the least recently used pages until the pool is within the budget; the caller must hold fLock
+   void EnforceMemoryLimit();
 
 public:
-   RPagePool() = default;
+   /// If maxMemory is larger than zero, unreferenced pages are cached within the given number of bytes
+   explicit RPagePool(std::size_t maxMemory = 0);
    RPagePool(const RPagePool&) = delete;
    RPagePool& operator =(const RPagePool&) = delete;
-   ~RPagePool() = default;
+   ~RPagePool();
 
    /// Adds a new page to the pool together with the function to free its space. Upon registration,
    /// the page pool takes ownership of the page's memory. The new page has its reference counter set to 1.
-   void RegisterPage(const RPage &page, const RPageDeleter &deleter);
+   /// If the pool already contains the same page, e.g. because it has been populated concurrently by another
+   /// page source sharing the pool, the given page is freed and the page from the pool is returned instead.
+   RPage RegisterPage(const RPage &page, const RPageDeleter &deleter);
+   /// Like RegisterPage() but the reference counter is initialized to 0.  The page is handed out by a later
+   /// GetPage() call or freed by EvictPreloadedPages().  Pages that are already in the pool are freed right away.
+   void PreloadPage(const RPage &page, const RPageDeleter &deleter);
+   /// Frees all the preloaded pages that have not been requested by GetPage()
+   void EvictPreloadedPages();
    /// Tries to find the page corresponding to column and index in the cache. If the page is found, its reference
    /// counter is increased
    RPage GetPage(ColumnId_t columnId, NTupleSize_t globalIndex);
    RPage GetPage(ColumnId_t columnId, const RClusterIndex &clusterIndex);
+   /// Whether the pool contains the page with the given element; neither the reference counter nor the cache
+   /// order of the page are changed
+   bool HasPage(ColumnId_t columnId, const RClusterIndex &clusterIndex);
    /// Give back a page to the pool and decrease the reference counter. There must not be any pointers anymore into
    /// this page. If the reference counter drops to zero, the page pool might decide to call the deleter given in
    /// during registration.
    void ReturnPage(const RPage &page);
+
+   std::size_t GetMaxMemory() const { return fMaxMemory; }
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
 };
 
 } // namespace Detail
@@ -0,0 +1,127 @@
+/// \file ROOT/RPageSinkBuf.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2020-07-15
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageSinkBuf
+#define ROOT7_RPageSinkBuf
+
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleModel;
+class TTaskGroup;
+
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSinkBuf
+\ingroup NTuple
+\brief Wrapper sink that coalesces cluster column page writes
+
+The buffered sink keeps a copy of the pages of the currently open cluster.  If implicit multi-threading is enabled,
+the pages are packed and compressed by tasks in the IMT pool as soon as they are committed.  Otherwise, the pages are
+sealed on cluster commit.  On cluster commit, the sealed pages of all the columns are handed over to the inner sink
+in a single vector commit, which allows the inner sink to write the cluster in one go.
+
+The inner sink builds the ntuple descriptor that is eventually written to storage.  It is created from a clone of
+the model passed to Create(), so that the columns of the original model remain connected to the buffered sink.
+
+Derived classes can be constructed without an inner sink and instead override CommitSealedCluster() in order to
+hand over the sealed pages of every cluster to some other destination, e.g. a page sink shared by several writers.
+*/
+// clang-format on
+class RPageSinkBuf : public RPageSink {
+private:
+   /// A buffered page together with the memory necessary to seal it
+   struct RPageZipItem {
+      RPage fPage;
+      /// Compression scratch buffer for fSealedPage
+      std::unique_ptr<unsigned char[]> fBuf;
+      RSealedPage fSealedPage;
+
+      explicit RPageZipItem(RPage page) : fPage(page) {}
+   };
+
+   /// The pages of a single column of the currently open cluster.  Items are kept in a deque so that references
+   /// to them remain valid for the compression tasks while new pages are buffered.
+   struct RColumnBuf {
+      ColumnHandle_t fColumnHandle;
+      std::deque<RPageZipItem> fBufferedPages;
+   };
+
+   /// I/O performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fNPageCommitted;
+      RNTupleAtomicCounter &fSzBuffered;
+      RNTupleAtomicCounter &fNTaskZip;
+   };
+
+   RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+   /// The inner sink, responsible for actually performing I/O; may be null for derived classes
+   std::unique_ptr<RPageSink> fInnerSink;
+   /// The buffered page sink maintains a copy of the RNTupleModel for the inner sink.  For the unbuffered case,
+   /// the RNTupleModel is instead managed by an RNTupleWriter.  Needs to be destructed before fInnerSink.
+   std::unique_ptr<RNTupleModel> fInnerModel;
+   /// Vector of buffered column pages, indexed by column id
+   std::vector<RColumnBuf> fBufferedColumns;
+   /// Compression tasks of the currently open cluster; only used with implicit multi-threading
+   std::unique_ptr<TTaskGroup> fTaskGroup;
+
+   /// Seals all the buffered pages that have not been sealed by compression tasks
+   void SealBufferedPages();
+   /// Releases the buffered pages of the committed cluster
+   void ReleaseBufferedPages();
+
+protected:
+   /// For derived classes that do not wrap an inner sink.  The pages are allocated on the heap.
+   RPageSinkBuf(std::string_view ntupleName, const RNTupleWriteOptions &options);
+
+   /// Called on cluster commit with the sealed pages of all the columns of the cluster.  The default implementation
+   /// vector-commits the pages to the inner sink and closes the cluster there.  The sealed page buffers are released
+   /// after the call.
+   virtual void CommitSealedCluster(const std::vector<RSealedPageGroup> &ranges, NTupleSize_t nEntries);
+
+   void CreateImpl(const RNTupleModel &model) final;
+   RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
+   RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
+   void CommitDatasetImpl() final;
+
+public:
+   explicit RPageSinkBuf(std::unique_ptr<RPageSink> inner);
+   RPageSinkBuf(const RPageSinkBuf&) = delete;
+   RPageSinkBuf& operator=(const RPageSinkBuf&) = delete;
+   virtual ~RPageSinkBuf();
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) final;
+   void ReleasePage(RPage &page) final;
+
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -16,6 +16,7 @@
 #ifndef ROOT7_RPageStorage
 #define ROOT7_RPageStorage
 
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
@@ -26,6 +27,7 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -36,9 +38,11 @@ class RNTupleModel;
 namespace Detail {
 
 class RColumn;
+class RColumnElementBase;
 class RPagePool;
 class RFieldBase;
 class RNTupleMetrics;
+class RNTupleTimingCollector;
 
 enum class EPageStorageType {
    kSink,
@@ -74,6 +78,32 @@ public:
    /// The column handle identifies a column with the current open page storage
    using ColumnHandle_t = RColumnHandle;
 
+   /// A sealed page contains the bytes of a page as written to storage (packed & compressed).  It is used
+   /// as an input to the page sinks.  The memory of the buffer is not owned by the sealed page.
+   struct RSealedPage {
+      const void *fBuffer = nullptr;
+      std::uint32_t fSize = 0;
+      std::uint32_t fNElements = 0;
+      /// Set by the sink that sealed the page if statistics are enabled
+      RClusterDescriptor::RStatistics fStatistics;
+
+      RSealedPage() = default;
+      RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
+   };
+
+   using SealedPageSequence_t = std::vector<RSealedPage>;
+   /// A range of sealed pages referring to the same column that can be used for vector commit
+   struct RSealedPageGroup {
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      SealedPageSequence_t::const_iterator fFirst;
+      SealedPageSequence_t::const_iterator fLast;
+
+      RSealedPageGroup() = default;
+      RSealedPageGroup(DescriptorId_t d, SealedPageSequence_t::const_iterator b,
+                       SealedPageSequence_t::const_iterator e)
+         : fColumnId(d), fFirst(b), fLast(e) {}
+   };
+
    /// Register a new column.  When reading, the column must exist in the ntuple on disk corresponding to the meta-data.
    /// When writing, every column can only be attached once.
    virtual ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) = 0;
@@ -86,6 +116,8 @@ public:
 
    /// Page storage implementations usually have their own metrics
    virtual RNTupleMetrics &GetMetrics() = 0;
+
+   const std::string &GetNTupleName() const { return fNTupleName; }
 };
 
 // clang-format off
@@ -117,9 +149,24 @@ protected:
 
    virtual void CreateImpl(const RNTupleModel &model) = 0;
    virtual RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) = 0;
+   virtual RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId,
+                                                             const RSealedPage &sealedPage) = 0;
+   /// Returns the locators of the committed pages in the order of the sealed page groups.  The default
+   /// implementation commits the sealed pages one by one; storage backends can override it in order to write all
+   /// the pages with a single request.
+   virtual std::vector<RClusterDescriptor::RLocator> CommitSealedPageVImpl(
+      const std::vector<RSealedPageGroup> &ranges);
    virtual RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) = 0;
    virtual void CommitDatasetImpl() = 0;
 
+   /// Packs and compresses the page into buf, which needs to provide space for at least the packed page size.
+   /// The packed page size is the number of bytes required for the page elements in their on-disk representation.
+   /// Uses neither a shared zip buffer nor any other state and can thus be called concurrently.
+   static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element, int compressionSetting,
+                               void *buf);
+   /// Upper bound of the memory necessary to seal the given page
+   static std::size_t GetPackedSize(const RPage &page, const RColumnElementBase &element);
+
 public:
    RPageSink(std::string_view ntupleName, const RNTupleWriteOptions &options);
    virtual ~RPageSink();
@@ -127,8 +174,15 @@ public:
    static std::unique_ptr<RPageSink> Create(std::string_view ntupleName, std::string_view location,
                                             const RNTupleWriteOptions &options = RNTupleWriteOptions());
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
+   const RNTupleWriteOptions &GetWriteOptions() const { return fOptions; }
+   /// The descriptor of the ntuple being written, which includes the clusters committed so far
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
+   /// Adds the column to the ntuple descriptor.  Depending on the write options, the on-disk column type can differ
+   /// from the type of the column model, e.g. for split encodings.
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
+   /// The on-disk model of a column that has been added before
+   RColumnModel GetColumnModel(ColumnHandle_t columnHandle) const;
 
    /// Physically creates the storage container to hold the ntuple (e.g., a keys a TFile or an S3 bucket)
    /// To do so, Create() calls CreateImpl() after updating the descriptor.
@@ -136,6 +190,10 @@ public:
    void Create(RNTupleModel &model);
    /// Write a page to the storage. The column must have been added before.
    void CommitPage(ColumnHandle_t columnHandle, const RPage &page);
+   /// Write a preprocessed page to storage. The column must have been added before.
+   void CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage);
+   /// Write a vector of preprocessed pages to storage. The corresponding columns must have been added before.
+   void CommitSealedPageV(const std::vector<RSealedPageGroup> &ranges);
    /// Finalize the current cluster and create a new one for the following data.
    void CommitCluster(NTupleSize_t nEntries);
    /// Finalize the current cluster and the entrire data set.
@@ -157,9 +215,14 @@ mapped into memory. The page source also gives access to the ntuple's meta-data.
 */
 // clang-format on
 class RPageSource : public RPageStorage {
+public:
+   using ColumnSet_t = RCluster::ColumnSet_t;
+
 protected:
    const RNTupleReadOptions fOptions;
    RNTupleDescriptor fDescriptor;
+   /// The columns that have been connected to this page source; used to determine the pages to prefetch
+   ColumnSet_t fActiveColumns;
 
    virtual RNTupleDescriptor AttachImpl() = 0;
 
@@ -175,6 +238,8 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSource; }
    const RNTupleDescriptor &GetDescriptor() const { return fDescriptor; }
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
+   /// The on-disk model of a column that has been added before
+   RColumnModel GetColumnModel(ColumnHandle_t columnHandle) const;
 
    /// Open the physical storage container for the tree
    void Attach() { fDescriptor = AttachImpl(); }
@@ -186,6 +251,15 @@ public:
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) = 0;
    /// Another version of PopulatePage that allows to specify cluster-relative indexes
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) = 0;
+
+   /// Populates all the pages of the given cluster id and columns; it is possible that some columns do not
+   /// contain any pages.  The pages are in their on-disk (packed and compressed) representation.  Used by the
+   /// cluster pool from its I/O thread; implementations must not use shared state with the reading thread.
+   virtual std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) = 0;
+
+   /// The per-column and per-phase timers of the page source, if it collects them.  The timers are part of the
+   /// metrics and thus only count if the metrics are enabled.
+   virtual RNTupleTimingCollector *GetTimingCollector() { return nullptr; }
 };
 
 } // namespace Detail
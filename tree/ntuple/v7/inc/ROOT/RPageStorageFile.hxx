@@ -16,6 +16,7 @@
 #ifndef ROOT7_RPageStorageFile
 #define ROOT7_RPageStorageFile
 
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
@@ -23,9 +24,12 @@
 #include <ROOT/RStringView.hxx>
 
 #include <array>
+#include <cstdint>
 #include <cstdio>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 class TFile;
 
@@ -38,6 +42,8 @@ class RRawFile;
 namespace Experimental {
 namespace Detail {
 
+class RClusterPool;
+class RColumnElementBase;
 class RPageAllocatorHeap;
 class RPagePool;
 
@@ -67,9 +73,15 @@ private:
    /// Helper for zipping keys and header / footer; comprises a 16MB zip buffer
    RNTupleCompressor fCompressor;
 
+   /// Writes a packed and compressed page as a blob; bytesPacked is the size of the uncompressed blob
+   RClusterDescriptor::RLocator WriteSealedPage(const RSealedPage &sealedPage, std::size_t bytesPacked);
+
 protected:
    void CreateImpl(const RNTupleModel &model) final;
    RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
+   /// Writes all the sealed pages back-to-back into a single blob
+   std::vector<RClusterDescriptor::RLocator> CommitSealedPageVImpl(const std::vector<RSealedPageGroup> &ranges) final;
    RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
    void CommitDatasetImpl() final;
 
@@ -112,23 +124,119 @@ class RPageSourceFile : public RPageSource {
 public:
    /// Cannot process pages larger than 1MB
    static constexpr std::size_t kMaxPageSize = 1024 * 1024;
+   /// When loading a cluster, pages that are separated by no more than kMaxGapSize bytes on storage are
+   /// read in a single request; the bytes in between are read and discarded
+   static constexpr std::size_t kMaxGapSize = 32 * 1024;
 
 private:
+   /// I/O performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fNReadV;
+      RNTupleAtomicCounter &fNRead;
+      RNTupleAtomicCounter &fSzReadPayload;
+      RNTupleAtomicCounter &fSzReadOverhead;
+      RNTupleAtomicCounter &fNClusterLoaded;
+      RNTupleAtomicCounter &fNPageLoaded;
+      RNTupleAtomicCounter &fNClusterUnzipped;
+      RNTupleAtomicCounter &fNClusterMapped;
+      RNTupleAtomicCounter &fNPageMapped;
+      RNTupleTimingCollector::RPhaseCounters &fTimeRead;
+      RNTupleTimingCollector::RPhaseCounters &fTimeDeserialize;
+   };
+
+   /// The timers of the phases of populating a page of a particular column
+   struct RColumnTimers {
+      /// Total time of populating a page that is not in the page pool
+      RNTupleTimingCollector::RPhaseCounters &fPopulate;
+      RNTupleTimingCollector::RPhaseCounters &fUnzip;
+      RNTupleTimingCollector::RPhaseCounters &fUnpack;
+   };
+
+   /// A memory-mapped byte range of the file that contains the on-disk pages of a cluster.  Pages that point
+   /// directly into the mapping share its ownership, so that the mapping can outlive the cluster in the cluster pool.
+   /// The region shares the ownership of the file, whose clones may outlive the page source in a shared page pool.
+   class RMmapRegion {
+   private:
+      std::shared_ptr<ROOT::Internal::RRawFile> fFile;
+      /// The start of the mapping, at or before the requested file offset due to the page alignment of mappings
+      unsigned char *fAddress = nullptr;
+      /// The file offset that corresponds to fAddress
+      std::uint64_t fMapdOffset = 0;
+      /// The full length of the mapping
+      std::size_t fSize = 0;
+
+   public:
+      RMmapRegion(std::shared_ptr<ROOT::Internal::RRawFile> file, std::size_t nbytes, std::uint64_t offset);
+      RMmapRegion(const RMmapRegion &other) = delete;
+      RMmapRegion &operator =(const RMmapRegion &other) = delete;
+      ~RMmapRegion();
+
+      /// Returns the memory location of the given file offset, which must be part of the mapped byte range
+      unsigned char *GetAddress(std::uint64_t offset) const { return fAddress + (offset - fMapdOffset); }
+      bool Contains(const void *address) const {
+         auto ptr = static_cast<const unsigned char *>(address);
+         return (ptr >= fAddress) && (ptr < fAddress + fSize);
+      }
+   };
+
+   /// An ROnDiskPageMap whose pages are located in a memory-mapped region of the file
+   class ROnDiskPageMapMmap : public ROnDiskPageMap {
+   private:
+      std::shared_ptr<RMmapRegion> fRegion;
+   public:
+      explicit ROnDiskPageMapMmap(std::shared_ptr<RMmapRegion> region) : fRegion(std::move(region)) {}
+   };
+
    RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+   /// The timing collector is shared by the page source and its clones and observed by fMetrics
+   std::shared_ptr<RNTupleTimingCollector> fTimingCollector;
+   /// Indexed by column id; set up when the page source is attached and read-only afterwards, so that the
+   /// decompression tasks can use the timers concurrently
+   std::vector<RColumnTimers> fColumnTimers;
    /// Populated pages might be shared; there memory buffer is managed by the RPageAllocatorFile
    std::unique_ptr<RPageAllocatorFile> fPageAllocator;
-   /// The page pool migh, at some point, be used by multiple page sources
+   /// The page pool is shared by the page source and its clones
    std::shared_ptr<RPagePool> fPagePool;
    /// Helper to unzip pages and header/footer; comprises a 16MB unzip buffer
    RNTupleDecompressor fDecompressor;
    /// An RRawFile is used to request the necessary byte ranges from a local or a remote file
-   std::unique_ptr<ROOT::Internal::RRawFile> fFile;
+   std::shared_ptr<ROOT::Internal::RRawFile> fFile;
    /// Takes the fFile to read ntuple blobs from it
    Internal::RMiniFileReader fReader;
-
-   RPageSourceFile(std::string_view ntupleName, const RNTupleReadOptions &options);
+   /// If the cluster cache is enabled, pages are read through the cluster pool, which loads entire clusters
+   /// in a background thread.  Needs to be destructed before fFile.
+   std::unique_ptr<RClusterPool> fClusterPool;
+   /// The cluster whose pages have been preloaded into the page pool by UnzipCluster()
+   DescriptorId_t fUnzipClusterId = kInvalidDescriptorId;
+   /// The columns of fUnzipClusterId whose pages are in the page pool
+   ColumnSet_t fUnzipColumns;
+   /// The memory-mapped regions of the loaded clusters, used to find the owner of an on-disk page.  Clusters are
+   /// loaded by the I/O thread of the cluster pool, so access is protected by fMmapLock.
+   std::vector<std::weak_ptr<RMmapRegion>> fMmapRegions;
+   std::mutex fMmapLock;
+
+   RPageSourceFile(std::string_view ntupleName, const RNTupleReadOptions &options,
+                   std::shared_ptr<RPagePool> pagePool, std::shared_ptr<RNTupleTimingCollector> timingCollector);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor,
                                  ClusterSize_t::ValueType clusterIndex);
+   /// Decompresses and unpacks an on-disk page of a loaded cluster into a new page.  Can be called concurrently
+   /// because it uses neither the unzip buffer of fDecompressor nor the page pool.
+   RPage UnzipPage(DescriptorId_t columnId, const RColumnElementBase &element,
+                   const RClusterDescriptor &clusterDescriptor, const RClusterDescriptor::RPageRange::RPageInfo &pageInfo,
+                   ClusterSize_t::ValueType firstInPage, const ROnDiskPage &onDiskPage);
+   /// If the on-disk page is memory-mapped, uncompressed, and suitably aligned for a mappable column element,
+   /// returns a page that points directly into the mapping and sets deleter such that the page keeps the mapping
+   /// alive.  Otherwise returns a null page and leaves deleter untouched.
+   RPage MapPage(DescriptorId_t columnId, const RColumnElementBase &element,
+                 const RClusterDescriptor &clusterDescriptor, const RClusterDescriptor::RPageRange::RPageInfo &pageInfo,
+                 ClusterSize_t::ValueType firstInPage, const ROnDiskPage &onDiskPage, RPageDeleter &deleter);
+   /// Returns the loaded mapping that contains the given address or nullptr
+   std::shared_ptr<RMmapRegion> FindMmapRegion(const void *address);
+   /// Using the implicit multi-threading task pool, decompresses the pages of all the active columns of the cluster
+   /// in parallel and preloads them into the page pool.  Pages that are already in the page pool are skipped.  Without
+   /// a page pool memory budget, pages of previously unzipped clusters that have not been used are evicted.
+   void UnzipCluster(const RCluster &cluster);
 
 protected:
    RNTupleDescriptor AttachImpl() final;
@@ -136,7 +244,8 @@ protected:
 public:
    RPageSourceFile(std::string_view ntupleName, std::string_view path, const RNTupleReadOptions &options);
    /// The cloned page source creates a new raw file and reader and opens its own file descriptor to the data.
-   /// The meta-data (header and footer) is reread and parsed by the clone.
+   /// The meta-data (header and footer) is reread and parsed by the clone.  The clone shares the page pool
+   /// and the timing collector.
    std::unique_ptr<RPageSource> Clone() const final;
    virtual ~RPageSourceFile();
 
@@ -144,7 +253,10 @@ public:
    RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) final;
    void ReleasePage(RPage &page) final;
 
+   std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
+
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
+   RNTupleTimingCollector *GetTimingCollector() final { return fTimingCollector.get(); }
 };
 
 
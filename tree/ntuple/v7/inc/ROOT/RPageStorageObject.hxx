@@ -0,0 +1,171 @@
+/// \file ROOT/RPageStorageObject.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2020-08-03
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageStorageObject
+#define ROOT7_RPageStorageObject
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RObjectStore.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+class RClusterPool;
+class RPageAllocatorFile;
+class RPageAllocatorHeap;
+class RPagePool;
+
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSinkObject
+\ingroup NTuple
+\brief Storage provider that writes every ntuple page as a separate object into an object store
+
+The header and the footer are stored as separate objects, too.  A small anchor object that records their sizes is
+written last, when the data set is committed; a reader can thus only open completely written ntuples.  The locator
+of a page stores the page's object id and its size.
+
+The sealed pages of the open cluster are kept in memory and stored by a single, parallel vector request when the
+cluster is committed.
+*/
+// clang-format on
+class RPageSinkObject : public RPageSink {
+public:
+   static constexpr std::size_t kDefaultElementsPerPage = 10000;
+
+private:
+   /// I/O performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fNPutV;
+      RNTupleAtomicCounter &fNPut;
+      RNTupleAtomicCounter &fSzWritePayload;
+   };
+
+   RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+   std::unique_ptr<RPageAllocatorHeap> fPageAllocator;
+   std::unique_ptr<RObjectStore> fStore;
+   /// Helper for zipping header / footer; comprises a 16MB zip buffer
+   RNTupleCompressor fCompressor;
+   /// The object id of the next committed page
+   std::uint64_t fNPages = 0;
+   /// The object id of the first page of the open cluster
+   std::uint64_t fClusterFirstPage = 0;
+   /// The sum of the sizes of the pages of the open cluster
+   std::uint64_t fClusterBytes = 0;
+   /// Sealed pages of the open cluster that are not yet stored, together with the memory that holds them
+   std::vector<RObjectStore::RRequest> fPendingPages;
+   std::vector<std::unique_ptr<unsigned char[]>> fPendingBuffers;
+   /// Compressed and uncompressed size of the header, recorded in the anchor
+   std::uint32_t fNBytesHeader = 0;
+   std::uint32_t fLenHeader = 0;
+
+   /// Returns the locator of the next page object and accounts for its size in the open cluster
+   RClusterDescriptor::RLocator MakePageLocator(std::size_t nbytes);
+   /// Stores and clears the pending pages
+   void StorePendingPages();
+
+protected:
+   void CreateImpl(const RNTupleModel &model) final;
+   RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
+   /// Stores all the sealed pages with a single, parallel vector request
+   std::vector<RClusterDescriptor::RLocator> CommitSealedPageVImpl(const std::vector<RSealedPageGroup> &ranges) final;
+   RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
+   void CommitDatasetImpl() final;
+
+public:
+   RPageSinkObject(std::string_view ntupleName, std::string_view location, const RNTupleWriteOptions &options);
+   virtual ~RPageSinkObject();
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) final;
+   void ReleasePage(RPage &page) final;
+
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+};
+
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSourceObject
+\ingroup NTuple
+\brief Storage provider that reads ntuple pages from an object store
+
+Clusters are loaded by fetching all the page objects of the requested columns with a single, parallel vector
+request.  Like for the file source, the page pool is shared by the page source and its clones.
+*/
+// clang-format on
+class RPageSourceObject : public RPageSource {
+private:
+   /// I/O performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fNReadV;
+      RNTupleAtomicCounter &fNRead;
+      RNTupleAtomicCounter &fSzReadPayload;
+      RNTupleAtomicCounter &fNClusterLoaded;
+      RNTupleAtomicCounter &fNPageLoaded;
+   };
+
+   RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+   /// Populated pages might be shared; there memory buffer is managed by the RPageAllocatorFile
+   std::unique_ptr<RPageAllocatorFile> fPageAllocator;
+   /// The page pool is shared by the page source and its clones
+   std::shared_ptr<RPagePool> fPagePool;
+   /// Helper to unzip pages and header/footer; comprises a 16MB unzip buffer
+   RNTupleDecompressor fDecompressor;
+   std::unique_ptr<RObjectStore> fStore;
+   /// If the cluster cache is enabled, pages are read through the cluster pool, which loads entire clusters
+   /// in a background thread.  Needs to be destructed before fStore.
+   std::unique_ptr<RClusterPool> fClusterPool;
+
+   RPageSourceObject(std::string_view ntupleName, const RNTupleReadOptions &options,
+                     std::shared_ptr<RPagePool> pagePool);
+   RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor,
+                                 ClusterSize_t::ValueType clusterIndex);
+
+protected:
+   RNTupleDescriptor AttachImpl() final;
+
+public:
+   RPageSourceObject(std::string_view ntupleName, std::string_view location, const RNTupleReadOptions &options);
+   /// The clone opens a new connection to the object store and rereads the meta-data.  It shares the page pool.
+   std::unique_ptr<RPageSource> Clone() const final;
+   virtual ~RPageSourceObject();
+
+   RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) final;
+   RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) final;
+   void ReleasePage(RPage &page) final;
+
+   std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
+
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
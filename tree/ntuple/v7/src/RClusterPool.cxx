@@ -0,0 +1,234 @@
+/// \file RClusterPool.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2020-07-01
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RClusterPool.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <TError.h>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iterator>
+#include <utility>
+
+
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int readAhead,
+                                                       std::size_t memoryBudget)
+   : fPageSource(pageSource)
+   , fReadAhead(readAhead)
+   , fMemoryBudget(memoryBudget)
+   , fThreadIo(&RClusterPool::ExecReadClusters, this)
+{
+}
+
+
+ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
+{
+   {
+      // Controlled shutdown of the I/O thread: the termination item jumps the queue, pending requests are dropped
+      std::unique_lock<std::mutex> lock(fLockWorkQueue);
+      fReadQueue.emplace_front(RReadItem());
+      fCvHasReadWork.notify_one();
+   }
+   fThreadIo.join();
+}
+
+
+void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
+{
+   while (true) {
+      RReadItem readItem;
+      {
+         std::unique_lock<std::mutex> lock(fLockWorkQueue);
+         fCvHasReadWork.wait(lock, [&]{ return !fReadQueue.empty(); });
+         readItem = std::move(fReadQueue.front());
+         fReadQueue.pop_front();
+      }
+
+      // An empty work item (without cluster id) terminates the thread
+      if (readItem.fClusterId == kInvalidDescriptorId)
+         return;
+
+      try {
+         readItem.fPromise.set_value(fPageSource.LoadCluster(readItem.fClusterId, readItem.fColumns));
+      } catch (...) {
+         // Rethrown in the reading thread when it accesses the future
+         readItem.fPromise.set_exception(std::current_exception());
+      }
+   }
+}
+
+
+ROOT::Experimental::Detail::RCluster *
+ROOT::Experimental::Detail::RClusterPool::FindInPool(DescriptorId_t clusterId) const
+{
+   for (const auto &cluster : fPool) {
+      if (cluster->GetId() == clusterId)
+         return cluster.get();
+   }
+   return nullptr;
+}
+
+
+std::size_t ROOT::Experimental::Detail::RClusterPool::EstimateMemSize(
+   DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns) const
+{
+   const auto &clusterDesc = fPageSource.GetDescriptor().GetClusterDescriptor(clusterId);
+   std::size_t result = 0;
+   for (auto columnId : columns) {
+      for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos)
+         result += pageInfo.fLocator.fBytesOnStorage;
+   }
+   return result;
+}
+
+
+std::size_t ROOT::Experimental::Detail::RClusterPool::GetMemSize() const
+{
+   std::size_t result = 0;
+   for (const auto &cluster : fPool)
+      result += cluster->GetMemSize();
+   for (const auto &inFlight : fInFlightClusters)
+      result += inFlight.fMemSize;
+   return result;
+}
+
+
+void ROOT::Experimental::Detail::RClusterPool::CollectInFlight(DescriptorId_t waitId)
+{
+   for (auto itr = fInFlightClusters.begin(); itr != fInFlightClusters.end(); ) {
+      if ((itr->fClusterId != waitId) &&
+          (itr->fFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready))
+      {
+         ++itr;
+         continue;
+      }
+
+      auto future = std::move(itr->fFuture);
+      itr = fInFlightClusters.erase(itr);
+      auto cluster = future.get();
+      // Work items that have been discarded before they were processed by the I/O thread give an empty cluster
+      if (!cluster)
+         continue;
+
+      auto poolCluster = FindInPool(cluster->GetId());
+      if (poolCluster) {
+         poolCluster->Adopt(std::move(*cluster));
+      } else {
+         fPool.emplace_back(std::move(cluster));
+      }
+   }
+}
+
+
+ROOT::Experimental::Detail::RCluster *
+ROOT::Experimental::Detail::RClusterPool::WaitFor(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns)
+{
+   CollectInFlight(clusterId);
+   auto result = FindInPool(clusterId);
+   R__ASSERT(result != nullptr);
+   for (auto columnId : columns) {
+      R__ASSERT(result->ContainsColumn(columnId));
+   }
+   return result;
+}
+
+
+ROOT::Experimental::Detail::RCluster *
+ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns)
+{
+   const auto &desc = fPageSource.GetDescriptor();
+
+   // The window of clusters that should be in memory after this call: the requested cluster, followed by up to
+   // fReadAhead clusters, plus the cluster before the requested one in order to support some back-and-forth in
+   // the entry range.
+   std::vector<DescriptorId_t> window{clusterId};
+   auto nextId = clusterId;
+   for (unsigned int i = 0; i < fReadAhead; ++i) {
+      nextId = desc.FindNextClusterId(nextId);
+      if (nextId == kInvalidDescriptorId)
+         break;
+      window.emplace_back(nextId);
+   }
+   const auto prevId = desc.FindPrevClusterId(clusterId);
+   auto fnIsInWindow = [&window, prevId](DescriptorId_t id) {
+      return (id == prevId) || (std::find(window.begin(), window.end(), id) != window.end());
+   };
+
+   CollectInFlight(kInvalidDescriptorId);
+
+   // Evict clusters that are outside the window
+   fPool.erase(std::remove_if(fPool.begin(), fPool.end(),
+                              [&fnIsInWindow](const std::unique_ptr<RCluster> &c) { return !fnIsInWindow(c->GetId()); }),
+               fPool.end());
+
+   {
+      // Drop pending read-ahead requests that are not needed anymore, e.g. after a jump in the entry range
+      std::unique_lock<std::mutex> lock(fLockWorkQueue);
+      for (auto itr = fReadQueue.begin(); itr != fReadQueue.end(); ) {
+         if ((itr->fClusterId != kInvalidDescriptorId) && !fnIsInWindow(itr->fClusterId)) {
+            itr->fPromise.set_value(nullptr);
+            itr = fReadQueue.erase(itr);
+         } else {
+            ++itr;
+         }
+      }
+   }
+
+   // Schedule the columns that are neither in the pool nor in flight, starting with the requested cluster
+   std::deque<RReadItem> readItems;
+   auto memSize = GetMemSize();
+   for (auto id : window) {
+      const auto poolCluster = FindInPool(id);
+      RCluster::ColumnSet_t missingColumns;
+      for (auto columnId : columns) {
+         if (poolCluster && poolCluster->ContainsColumn(columnId))
+            continue;
+         const auto isInFlight = std::any_of(fInFlightClusters.begin(), fInFlightClusters.end(),
+            [id, columnId](const RInFlightCluster &c) { return c.fClusterId == id && c.fColumns.count(columnId) > 0; });
+         if (!isInFlight)
+            missingColumns.insert(columnId);
+      }
+      if (missingColumns.empty())
+         continue;
+
+      const auto estimatedMemSize = EstimateMemSize(id, missingColumns);
+      if ((id != clusterId) && (fMemoryBudget > 0) && (memSize + estimatedMemSize > fMemoryBudget))
+         break;
+      memSize += estimatedMemSize;
+
+      RReadItem readItem;
+      readItem.fClusterId = id;
+      readItem.fColumns = missingColumns;
+
+      RInFlightCluster inFlightCluster;
+      inFlightCluster.fClusterId = id;
+      inFlightCluster.fColumns = missingColumns;
+      inFlightCluster.fMemSize = estimatedMemSize;
+      inFlightCluster.fFuture = readItem.fPromise.get_future();
+      fInFlightClusters.emplace_back(std::move(inFlightCluster));
+
+      readItems.emplace_back(std::move(readItem));
+   }
+
+   if (!readItems.empty()) {
+      std::unique_lock<std::mutex> lock(fLockWorkQueue);
+      std::move(readItems.begin(), readItems.end(), std::back_inserter(fReadQueue));
+      fCvHasReadWork.notify_one();
+   }
+
+   return WaitFor(clusterId, columns);
+}
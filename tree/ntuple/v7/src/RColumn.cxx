@@ -20,6 +20,7 @@
 #include <TError.h>
 
 #include <iostream>
+#include <utility>
 
 ROOT::Experimental::Detail::RColumn::RColumn(const RColumnModel& model, std::uint32_t index)
    : fModel(model), fIndex(index), fPageSink(nullptr), fPageSource(nullptr), fHeadPage(), fNElements(0),
@@ -42,11 +43,13 @@ void ROOT::Experimental::Detail::RColumn::Connect(DescriptorId_t fieldId, RPageS
    case EPageStorageType::kSink:
       fPageSink = static_cast<RPageSink*>(pageStorage); // the page sink initializes fHeadPage on AddColumn
       fHandleSink = fPageSink->AddColumn(fieldId, *this);
+      SetOnDiskModel(fPageSink->GetColumnModel(fHandleSink));
       fHeadPage = fPageSink->ReservePage(fHandleSink);
       break;
    case EPageStorageType::kSource:
       fPageSource = static_cast<RPageSource*>(pageStorage);
       fHandleSource = fPageSource->AddColumn(fieldId, *this);
+      SetOnDiskModel(fPageSource->GetColumnModel(fHandleSource));
       fNElements = fPageSource->GetNElements(fHandleSource);
       fColumnIdSource = fPageSource->GetColumnId(fHandleSource);
       break;
@@ -55,6 +58,17 @@ void ROOT::Experimental::Detail::RColumn::Connect(DescriptorId_t fieldId, RPageS
    }
 }
 
+void ROOT::Experimental::Detail::RColumn::SetOnDiskModel(const RColumnModel &model)
+{
+   if (model.GetType() == fElementType)
+      return;
+   // Pages are packed and unpacked according to the on-disk type; the in-memory layout must stay the same
+   auto element = RColumnElementBase::Generate(model);
+   R__ASSERT(element->GetSize() == fElement->GetSize());
+   fElement = std::move(element);
+   fElementType = model.GetType();
+}
+
 void ROOT::Experimental::Detail::RColumn::Flush()
 {
    if (fHeadPage.GetSize() == 0) return;
@@ -20,31 +20,145 @@
 #include <algorithm>
 #include <bitset>
 #include <cstdint>
+#include <memory>
 
-ROOT::Experimental::Detail::RColumnElementBase
-ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
-   switch (type) {
+namespace {
+
+/// Scatters the bytes of the count elements of size N in src into N byte planes of count bytes each.  The inner
+/// loop has a fixed stride and no dependencies between iterations, so that the compiler can vectorize it.
+template <std::size_t N>
+void SplitBytes(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   for (std::size_t b = 0; b < N; ++b) {
+      unsigned char *plane = dst + b * count;
+      for (std::size_t i = 0; i < count; ++i)
+         plane[i] = src[i * N + b];
+   }
+}
+
+/// Inverse of SplitBytes()
+template <std::size_t N>
+void UnsplitBytes(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   for (std::size_t b = 0; b < N; ++b) {
+      const unsigned char *plane = src + b * count;
+      for (std::size_t i = 0; i < count; ++i)
+         dst[i * N + b] = plane[i];
+   }
+}
+
+/// Writes the lower nBits bits of fnGetWord(i) for i in [0, count) as a little-endian bit stream of exactly
+/// (count * nBits + 7) / 8 bytes.  The bits are collected in a 64bit word that is written out when it is full.
+template <typename FnGetWordT>
+void PackBits(unsigned char *dst, std::size_t count, std::size_t nBits, FnGetWordT fnGetWord)
+{
+   std::uint64_t acc = 0;
+   std::size_t nAcc = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      const std::uint64_t word = fnGetWord(i);
+      acc |= word << nAcc;
+      if (nAcc + nBits < 64) {
+         nAcc += nBits;
+         continue;
+      }
+      for (std::size_t b = 0; b < 8; ++b)
+         *dst++ = static_cast<unsigned char>(acc >> (8 * b));
+      // nAcc > 0 because nBits < 64
+      acc = (nAcc + nBits == 64) ? 0 : (word >> (64 - nAcc));
+      nAcc = nAcc + nBits - 64;
+   }
+   for (std::size_t b = 0; b < (nAcc + 7) / 8; ++b)
+      *dst++ = static_cast<unsigned char>(acc >> (8 * b));
+}
+
+/// Inverse of PackBits(): calls fnSetWord(i, word) for the count words of nBits bits in the bit stream src
+template <typename FnSetWordT>
+void UnpackBits(const unsigned char *src, std::size_t count, std::size_t nBits, FnSetWordT fnSetWord)
+{
+   const std::uint64_t mask = (std::uint64_t(1) << nBits) - 1;
+   const unsigned char *srcEnd = src + (count * nBits + 7) / 8;
+   std::uint64_t acc = 0;
+   std::size_t nAcc = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      if (nAcc >= nBits) {
+         fnSetWord(i, acc & mask);
+         acc >>= nBits;
+         nAcc -= nBits;
+         continue;
+      }
+      std::uint64_t next = 0;
+      for (std::size_t b = 0; (b < 8) && (src < srcEnd); ++b)
+         next |= std::uint64_t(*src++) << (8 * b);
+      fnSetWord(i, (acc | (next << nAcc)) & mask);
+      const auto nUsed = nBits - nAcc;
+      acc = next >> nUsed;
+      nAcc = 64 - nUsed;
+   }
+}
+
+/// Rounds the IEEE 754 representation of a float or double value to its nBits most significant bits; infinity and
+/// NaN are not rounded in order to keep them intact
+template <typename UIntT, std::size_t NExponentBits>
+UIntT TruncateMantissa(UIntT bits, std::size_t nBits)
+{
+   constexpr std::size_t kWidth = sizeof(UIntT) * 8;
+   constexpr UIntT kExponentMask = ((UIntT(1) << NExponentBits) - 1) << (kWidth - 1 - NExponentBits);
+   const std::size_t nDrop = kWidth - nBits;
+   if ((bits & kExponentMask) != kExponentMask) {
+      const UIntT rounded = bits + (UIntT(1) << (nDrop - 1));
+      // Do not round into infinity or across the sign bit
+      if (((rounded & kExponentMask) != kExponentMask) && ((rounded >> (kWidth - 1)) == (bits >> (kWidth - 1))))
+         bits = rounded;
+   }
+   return bits >> nDrop;
+}
+
+} // anonymous namespace
+
+std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
+ROOT::Experimental::Detail::RColumnElementBase::Generate(const RColumnModel &model) {
+   switch (model.GetType()) {
    case EColumnType::kReal32:
-      return RColumnElement<float, EColumnType::kReal32>(nullptr);
+      return std::make_unique<RColumnElement<float, EColumnType::kReal32>>(nullptr);
    case EColumnType::kReal64:
-      return RColumnElement<double, EColumnType::kReal64>(nullptr);
+      return std::make_unique<RColumnElement<double, EColumnType::kReal64>>(nullptr);
    case EColumnType::kByte:
-      return RColumnElement<std::uint8_t, EColumnType::kByte>(nullptr);
+      return std::make_unique<RColumnElement<std::uint8_t, EColumnType::kByte>>(nullptr);
    case EColumnType::kInt32:
-      return RColumnElement<std::int32_t, EColumnType::kInt32>(nullptr);
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kInt32>>(nullptr);
    case EColumnType::kInt64:
-      return RColumnElement<std::int64_t, EColumnType::kInt64>(nullptr);
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kInt64>>(nullptr);
    case EColumnType::kBit:
-      return RColumnElement<bool, EColumnType::kBit>(nullptr);
+      return std::make_unique<RColumnElement<bool, EColumnType::kBit>>(nullptr);
    case EColumnType::kIndex:
-      return RColumnElement<ClusterSize_t, EColumnType::kIndex>(nullptr);
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
-      return RColumnElement<RColumnSwitch, EColumnType::kSwitch>(nullptr);
+      return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kSplitReal64:
+      return std::make_unique<RColumnElement<double, EColumnType::kSplitReal64>>(nullptr);
+   case EColumnType::kSplitReal32:
+      return std::make_unique<RColumnElement<float, EColumnType::kSplitReal32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
+   case EColumnType::kSplitIndex:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex>>(nullptr);
+   case EColumnType::kReal32Trunc:
+      return std::make_unique<RColumnElement<float, EColumnType::kReal32Trunc>>(nullptr, model.GetBitsOnStorage());
+   case EColumnType::kReal64Trunc:
+      return std::make_unique<RColumnElement<double, EColumnType::kReal64Trunc>>(nullptr, model.GetBitsOnStorage());
+   case EColumnType::kReal32Quant:
+      return std::make_unique<RColumnElement<float, EColumnType::kReal32Quant>>(
+         nullptr, model.GetBitsOnStorage(), model.GetMin(), model.GetMax());
+   case EColumnType::kReal64Quant:
+      return std::make_unique<RColumnElement<double, EColumnType::kReal64Quant>>(
+         nullptr, model.GetBitsOnStorage(), model.GetMin(), model.GetMax());
    default:
       R__ASSERT(false);
    }
    // never here
-   return RColumnElementBase();
+   return nullptr;
 }
 
 void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit>::Pack(
@@ -80,3 +194,172 @@ void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColum
       }
    }
 }
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitBytes<kSize>(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<unsigned char *>(src), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnsplitBytes<kSize>(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<unsigned char *>(src), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitBytes<kSize>(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<unsigned char *>(src), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnsplitBytes<kSize>(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<unsigned char *>(src), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitBytes<kSize>(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<unsigned char *>(src), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnsplitBytes<kSize>(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<unsigned char *>(src), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   SplitBytes<kSize>(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<unsigned char *>(src), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnsplitBytes<kSize>(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<unsigned char *>(src), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                                ROOT::Experimental::EColumnType::kSplitIndex>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   // Offsets grow monotonically within a cluster; their differences are small numbers with mostly zero high bytes.
+   // The first element of the page is stored as is, which keeps pages self-contained.
+   using Value_t = ClusterSize_t::ValueType;
+   auto offsets = reinterpret_cast<const Value_t *>(src);
+   auto planes = reinterpret_cast<unsigned char *>(dst);
+   Value_t prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      const Value_t delta = offsets[i] - prev;
+      prev = offsets[i];
+      for (std::size_t b = 0; b < kSize; ++b)
+         planes[b * count + i] = static_cast<unsigned char>(delta >> (8 * b));
+   }
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                                ROOT::Experimental::EColumnType::kSplitIndex>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   using Value_t = ClusterSize_t::ValueType;
+   auto offsets = reinterpret_cast<Value_t *>(dst);
+   auto planes = reinterpret_cast<const unsigned char *>(src);
+   Value_t prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      Value_t delta = 0;
+      for (std::size_t b = 0; b < kSize; ++b)
+         delta |= static_cast<Value_t>(planes[b * count + i]) << (8 * b);
+      prev += delta;
+      offsets[i] = prev;
+   }
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal32Trunc>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto values = reinterpret_cast<const std::uint32_t *>(src);
+   const auto nBits = fBitsOnStorage;
+   PackBits(reinterpret_cast<unsigned char *>(dst), count, nBits,
+            [values, nBits](std::size_t i) { return TruncateMantissa<std::uint32_t, 8>(values[i], nBits); });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal32Trunc>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto values = reinterpret_cast<std::uint32_t *>(dst);
+   const auto nDrop = 32 - fBitsOnStorage;
+   UnpackBits(reinterpret_cast<const unsigned char *>(src), count, fBitsOnStorage,
+              [values, nDrop](std::size_t i, std::uint64_t word) { values[i] = std::uint32_t(word) << nDrop; });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal64Trunc>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto values = reinterpret_cast<const std::uint64_t *>(src);
+   const auto nBits = fBitsOnStorage;
+   PackBits(reinterpret_cast<unsigned char *>(dst), count, nBits,
+            [values, nBits](std::size_t i) { return TruncateMantissa<std::uint64_t, 11>(values[i], nBits); });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal64Trunc>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto values = reinterpret_cast<std::uint64_t *>(dst);
+   const auto nDrop = 64 - fBitsOnStorage;
+   UnpackBits(reinterpret_cast<const unsigned char *>(src), count, fBitsOnStorage,
+              [values, nDrop](std::size_t i, std::uint64_t word) { values[i] = word << nDrop; });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal32Quant>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto values = reinterpret_cast<const float *>(src);
+   const double min = fMin;
+   const double max = fMax;
+   const double nSteps = double((std::uint64_t(1) << fBitsOnStorage) - 1);
+   const double scale = nSteps / (max - min);
+   PackBits(reinterpret_cast<unsigned char *>(dst), count, fBitsOnStorage, [=](std::size_t i) {
+      // The negated comparisons map NaN to min
+      const double v = !(values[i] > min) ? min : (!(values[i] < max) ? max : values[i]);
+      return static_cast<std::uint64_t>((v - min) * scale + 0.5);
+   });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal32Quant>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto values = reinterpret_cast<float *>(dst);
+   const double min = fMin;
+   const double step = (fMax - fMin) / double((std::uint64_t(1) << fBitsOnStorage) - 1);
+   UnpackBits(reinterpret_cast<const unsigned char *>(src), count, fBitsOnStorage,
+              [=](std::size_t i, std::uint64_t word) { values[i] = static_cast<float>(min + word * step); });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal64Quant>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto values = reinterpret_cast<const double *>(src);
+   const double min = fMin;
+   const double max = fMax;
+   const double nSteps = double((std::uint64_t(1) << fBitsOnStorage) - 1);
+   const double scale = nSteps / (max - min);
+   PackBits(reinterpret_cast<unsigned char *>(dst), count, fBitsOnStorage, [=](std::size_t i) {
+      // The negated comparisons map NaN to min
+      const double v = !(values[i] > min) ? min : (!(values[i] < max) ? max : values[i]);
+      return static_cast<std::uint64_t>((v - min) * scale + 0.5);
+   });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal64Quant>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto values = reinterpret_cast<double *>(dst);
+   const double min = fMin;
+   const double step = (fMax - fMin) / double((std::uint64_t(1) << fBitsOnStorage) - 1);
+   UnpackBits(reinterpret_cast<const unsigned char *>(src), count, fBitsOnStorage,
+              [=](std::size_t i, std::uint64_t word) { values[i] = min + word * step; });
+}
@@ -373,12 +373,26 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal32, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<float, EColumnType::kReal32>(model, 0)));
+      Detail::RColumn::Create<float, EColumnType::kReal32>(fColumnModel, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
+void ROOT::Experimental::RField<float>::SetTruncated(std::size_t nBits)
+{
+   R__ASSERT(fColumns.empty());
+   R__ASSERT(nBits >= 10 && nBits <= 31);
+   fColumnModel = RColumnModel(EColumnType::kReal32Trunc, false /* isSorted*/, nBits);
+}
+
+void ROOT::Experimental::RField<float>::SetQuantized(double min, double max, std::size_t nBits)
+{
+   R__ASSERT(fColumns.empty());
+   R__ASSERT(nBits >= 1 && nBits <= 32);
+   R__ASSERT(min < max);
+   fColumnModel = RColumnModel(EColumnType::kReal32Quant, false /* isSorted*/, nBits, min, max);
+}
+
 void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitFloatField(*this);
@@ -389,12 +403,26 @@ void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &vis
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal64, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<double, EColumnType::kReal64>(model, 0)));
+      Detail::RColumn::Create<double, EColumnType::kReal64>(fColumnModel, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
+void ROOT::Experimental::RField<double>::SetTruncated(std::size_t nBits)
+{
+   R__ASSERT(fColumns.empty());
+   R__ASSERT(nBits >= 13 && nBits <= 63);
+   fColumnModel = RColumnModel(EColumnType::kReal64Trunc, false /* isSorted*/, nBits);
+}
+
+void ROOT::Experimental::RField<double>::SetQuantized(double min, double max, std::size_t nBits)
+{
+   R__ASSERT(fColumns.empty());
+   R__ASSERT(nBits >= 1 && nBits <= 32);
+   R__ASSERT(min < max);
+   fColumnModel = RColumnModel(EColumnType::kReal64Quant, false /* isSorted*/, nBits, min, max);
+}
+
 void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitDoubleField(*this);
@@ -1070,7 +1070,8 @@ std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::RFileProper::Writ
    Write(&strTitle, strTitle.GetSize(), offset);
    offset += strTitle.GetSize();
    auto offsetData = offset;
-   Write(buffer, nbytes, offset);
+   if (buffer)
+      Write(buffer, nbytes, offset);
 
    return offsetData;
 }
@@ -1202,6 +1203,33 @@ std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::WriteBlob(const v
 }
 
 
+std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::ReserveBlob(size_t nbytes, size_t len)
+{
+   std::uint64_t offset;
+   if (fFileSimple) {
+      if (fIsBare) {
+         offset = fFileSimple.fFilePos;
+      } else {
+         offset = fFileSimple.WriteKey(nullptr, nbytes, len, -1, 100, kBlobClassName);
+      }
+   } else {
+      offset = fFileProper.WriteKey(nullptr, nbytes, len);
+   }
+   return offset;
+}
+
+
+void ROOT::Experimental::Internal::RNTupleFileWriter::WriteIntoReservedBlob(
+   const void *buffer, size_t nbytes, std::int64_t offset)
+{
+   if (fFileSimple) {
+      fFileSimple.Write(buffer, nbytes, offset);
+   } else {
+      fFileProper.Write(buffer, nbytes, offset);
+   }
+}
+
+
 std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::WriteNTupleHeader(
    const void *data, size_t nbytes, size_t lenHeader)
 {
@@ -17,16 +17,19 @@
 
 #include "ROOT/RFieldVisitor.hxx"
 #include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RPageSinkBuf.hxx"
 #include "ROOT/RPageStorage.hxx"
 
 #include <algorithm>
 #include <exception>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <TError.h>
 
@@ -73,16 +76,19 @@ ROOT::Experimental::RNTupleReader::~RNTupleReader()
 std::unique_ptr<ROOT::Experimental::RNTupleReader> ROOT::Experimental::RNTupleReader::Open(
    std::unique_ptr<RNTupleModel> model,
    std::string_view ntupleName,
-   std::string_view storage)
+   std::string_view storage,
+   const RNTupleReadOptions &options)
 {
-   return std::make_unique<RNTupleReader>(std::move(model), Detail::RPageSource::Create(ntupleName, storage));
+   return std::make_unique<RNTupleReader>(
+      std::move(model), Detail::RPageSource::Create(ntupleName, storage, options));
 }
 
 std::unique_ptr<ROOT::Experimental::RNTupleReader> ROOT::Experimental::RNTupleReader::Open(
    std::string_view ntupleName,
-   std::string_view storage)
+   std::string_view storage,
+   const RNTupleReadOptions &options)
 {
-   return std::make_unique<RNTupleReader>(Detail::RPageSource::Create(ntupleName, storage));
+   return std::make_unique<RNTupleReader>(Detail::RPageSource::Create(ntupleName, storage, options));
 }
 
 void ROOT::Experimental::RNTupleReader::PrintInfo(const ENTupleInfo what, std::ostream &output)
@@ -133,6 +139,10 @@ void ROOT::Experimental::RNTupleReader::PrintInfo(const ENTupleInfo what, std::o
    case ENTupleInfo::kMetrics:
       fMetrics.Print(output);
       break;
+   case ENTupleInfo::kTiming:
+      if (auto timingCollector = fSource->GetTimingCollector())
+         timingCollector->PrintTable(output);
+      break;
    default:
       // Unhandled case, internal error
       R__ASSERT(false);
@@ -170,6 +180,53 @@ void ROOT::Experimental::RNTupleReader::Show(NTupleSize_t index, const ENTupleFo
 }
 
 
+std::vector<ROOT::Experimental::RNTupleGlobalRange>
+ROOT::Experimental::RNTupleReader::GetEntryRanges(std::string_view fieldName, double min, double max)
+{
+   const auto &desc = fSource->GetDescriptor();
+   const auto fieldId = desc.FindFieldId(fieldName);
+   R__ASSERT(fieldId != kInvalidDescriptorId);
+   const auto columnId = desc.FindColumnId(fieldId, 0);
+   if (columnId == kInvalidDescriptorId)
+      return std::vector<RNTupleGlobalRange>{GetEntryRange()};
+
+   // Page boundaries translate into entry boundaries only if there is one element per entry
+   const auto &fieldDesc = desc.GetFieldDescriptor(fieldId);
+   const bool isEntryAligned =
+      (fieldDesc.GetStructure() == ENTupleStructure::kLeaf) && (fieldDesc.GetNRepetitions() == 0);
+
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> candidates;
+   for (DescriptorId_t clusterId = 0; clusterId < desc.GetNClusters(); ++clusterId) {
+      const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+      const auto &columnRange = clusterDesc.GetColumnRange(columnId);
+      if (!columnRange.fStatistics.MayOverlap(min, max))
+         continue;
+      if (!isEntryAligned) {
+         candidates.emplace_back(clusterDesc.GetFirstEntryIndex(),
+                                 clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries());
+         continue;
+      }
+      auto firstInPage = columnRange.fFirstElementIndex;
+      for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos) {
+         if (pageInfo.fStatistics.MayOverlap(min, max))
+            candidates.emplace_back(firstInPage, firstInPage + pageInfo.fNElements);
+         firstInPage += pageInfo.fNElements;
+      }
+   }
+   std::sort(candidates.begin(), candidates.end());
+
+   std::vector<RNTupleGlobalRange> result;
+   for (std::size_t i = 0; i < candidates.size(); ) {
+      auto start = candidates[i].first;
+      auto end = candidates[i].second;
+      for (++i; (i < candidates.size()) && (candidates[i].first <= end); ++i)
+         end = std::max(end, candidates[i].second);
+      result.emplace_back(start, end);
+   }
+   return result;
+}
+
+
 //------------------------------------------------------------------------------
 
 
@@ -216,6 +273,83 @@ void ROOT::Experimental::RNTupleWriter::CommitCluster()
 //------------------------------------------------------------------------------
 
 
+class ROOT::Experimental::RNTupleParallelWriter::RFillContextSink : public Detail::RPageSinkBuf {
+private:
+   RNTupleParallelWriter &fWriter;
+   /// The number of entries of this fill context committed to the shared sink so far
+   NTupleSize_t fNEntriesCommitted = 0;
+
+protected:
+   void CommitSealedCluster(const std::vector<RSealedPageGroup> &ranges, NTupleSize_t nEntries) final
+   {
+      std::lock_guard<std::mutex> guard(fWriter.fMutex);
+      fWriter.fSink->CommitSealedPageV(ranges);
+      fWriter.fNEntries += nEntries - fNEntriesCommitted;
+      fWriter.fSink->CommitCluster(fWriter.fNEntries);
+      fNEntriesCommitted = nEntries;
+   }
+
+public:
+   explicit RFillContextSink(RNTupleParallelWriter &writer)
+      : RPageSinkBuf(writer.fSink->GetNTupleName(), writer.fSink->GetWriteOptions()), fWriter(writer)
+   {
+      std::lock_guard<std::mutex> guard(fWriter.fMutex);
+      fWriter.fNFillContexts++;
+   }
+   RFillContextSink(const RFillContextSink&) = delete;
+   RFillContextSink& operator=(const RFillContextSink&) = delete;
+   ~RFillContextSink() final
+   {
+      std::lock_guard<std::mutex> guard(fWriter.fMutex);
+      fWriter.fNFillContexts--;
+   }
+};
+
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(
+   std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
+   std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
+   : fSink(std::move(sink))
+   , fModel(std::move(model))
+{
+   fSink->Create(*fModel.get());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   R__ASSERT(fNFillContexts == 0);
+   fSink->CommitDataset();
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> ROOT::Experimental::RNTupleParallelWriter::Recreate(
+   std::unique_ptr<RNTupleModel> model,
+   std::string_view ntupleName,
+   std::string_view storage,
+   const RNTupleWriteOptions &options)
+{
+   return std::make_unique<RNTupleParallelWriter>(
+      std::move(model), Detail::RPageSink::Create(ntupleName, storage, options));
+}
+
+
+std::unique_ptr<ROOT::Experimental::RNTupleWriter> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   // The model clone yields the same column ids as the prototype model connected to the shared sink
+   auto model = std::unique_ptr<RNTupleModel>(fModel->Clone());
+   return std::make_unique<RNTupleWriter>(std::move(model), std::make_unique<RFillContextSink>(*this));
+}
+
+
+ROOT::Experimental::NTupleSize_t ROOT::Experimental::RNTupleParallelWriter::GetNEntries()
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+   return fNEntries;
+}
+
+
+//------------------------------------------------------------------------------
+
+
 ROOT::Experimental::RCollectionNTuple::RCollectionNTuple(std::unique_ptr<REntry> defaultEntry)
    : fOffset(0), fDefaultEntry(std::move(defaultEntry))
 {
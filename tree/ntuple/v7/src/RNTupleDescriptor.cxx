@@ -26,6 +26,7 @@
 #include <cstring>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -295,6 +296,15 @@ std::uint32_t SerializeColumnModel(const ROOT::Experimental::RColumnModel &val,
 
    pos += SerializeInt32(static_cast<int>(val.GetType()), *where);
    pos += SerializeInt32(static_cast<int>(val.GetIsSorted()), *where);
+   // Parameters of the reduced-precision column types; the doubles are stored bitwise
+   std::uint64_t min, max;
+   const double valMin = val.GetMin();
+   const double valMax = val.GetMax();
+   memcpy(&min, &valMin, sizeof(min));
+   memcpy(&max, &valMax, sizeof(max));
+   pos += SerializeUInt32(val.GetBitsOnStorage(), *where);
+   pos += SerializeUInt64(min, *where);
+   pos += SerializeUInt64(max, *where);
 
    auto size = pos - base;
    SerializeUInt32(size, ptrSize);
@@ -311,7 +321,20 @@ std::uint32_t DeserializeColumnModel(const void *buffer, ROOT::Experimental::RCo
    std::int32_t isSorted;
    bytes += DeserializeInt32(bytes, &type);
    bytes += DeserializeInt32(bytes, &isSorted);
-   *columnModel = ROOT::Experimental::RColumnModel(static_cast<ROOT::Experimental::EColumnType>(type), isSorted);
+   // Column models written before the reduced-precision column types have a shorter frame
+   std::uint32_t bitsOnStorage = 0;
+   double min = 0.0;
+   double max = 0.0;
+   if (static_cast<std::uint32_t>(bytes - reinterpret_cast<const unsigned char *>(buffer)) < frameSize) {
+      std::uint64_t minBits, maxBits;
+      bytes += DeserializeUInt32(bytes, &bitsOnStorage);
+      bytes += DeserializeUInt64(bytes, &minBits);
+      bytes += DeserializeUInt64(bytes, &maxBits);
+      memcpy(&min, &minBits, sizeof(min));
+      memcpy(&max, &maxBits, sizeof(max));
+   }
+   *columnModel = ROOT::Experimental::RColumnModel(static_cast<ROOT::Experimental::EColumnType>(type), isSorted,
+                                                   bitsOnStorage, min, max);
 
    return frameSize;
 }
@@ -376,6 +399,47 @@ std::uint32_t DeserializePageInfo(const void *buffer,
    return bytes - base;
 }
 
+std::uint32_t SerializeStatistics(const ROOT::Experimental::RClusterDescriptor::RStatistics &val, void *buffer)
+{
+   // Like page infos, statistics are stored without a frame
+   std::uint32_t size = 2;
+   if (val.fHasRange)
+      size += 16;
+   if (buffer != nullptr) {
+      auto pos = reinterpret_cast<unsigned char *>(buffer);
+      pos += SerializeUInt16(val.fHasRange ? 1 : 0, pos);
+      if (val.fHasRange) {
+         std::uint64_t minBits;
+         std::uint64_t maxBits;
+         memcpy(&minBits, &val.fMin, sizeof(minBits));
+         memcpy(&maxBits, &val.fMax, sizeof(maxBits));
+         pos += SerializeUInt64(minBits, pos);
+         pos += SerializeUInt64(maxBits, pos);
+      }
+   }
+   return size;
+}
+
+std::uint32_t DeserializeStatistics(const void *buffer,
+   ROOT::Experimental::RClusterDescriptor::RStatistics *statistics)
+{
+   auto base = reinterpret_cast<const unsigned char *>(buffer);
+   auto bytes = base;
+   std::uint16_t hasRange;
+   bytes += DeserializeUInt16(bytes, &hasRange);
+   *statistics = ROOT::Experimental::RClusterDescriptor::RStatistics();
+   if (hasRange) {
+      std::uint64_t minBits;
+      std::uint64_t maxBits;
+      bytes += DeserializeUInt64(bytes, &minBits);
+      bytes += DeserializeUInt64(bytes, &maxBits);
+      statistics->fHasRange = true;
+      memcpy(&statistics->fMin, &minBits, sizeof(minBits));
+      memcpy(&statistics->fMax, &maxBits, sizeof(maxBits));
+   }
+   return bytes - base;
+}
+
 std::uint32_t SerializeCrc32(const unsigned char *data, std::uint32_t length, void *buffer)
 {
    auto checksum = R__crc32(0, nullptr, 0);
@@ -500,6 +564,19 @@ bool ROOT::Experimental::RColumnDescriptor::operator==(const RColumnDescriptor &
 ////////////////////////////////////////////////////////////////////////////////
 
 
+void ROOT::Experimental::RClusterDescriptor::RStatistics::Merge(const RStatistics &other)
+{
+   if (!other.fHasRange)
+      return;
+   if (!fHasRange) {
+      *this = other;
+      return;
+   }
+   fMin = std::min(fMin, other.fMin);
+   fMax = std::max(fMax, other.fMax);
+}
+
+
 bool ROOT::Experimental::RClusterDescriptor::operator==(const RClusterDescriptor &other) const {
    return fClusterId == other.fClusterId &&
           fVersion == other.fVersion &&
@@ -575,7 +652,13 @@ std::uint32_t ROOT::Experimental::RNTupleDescriptor::SerializeFooter(void* buffe
    void *ptrSize = nullptr;
    pos += SerializeFrame(
       RNTupleDescriptor::kFrameVersionCurrent, RNTupleDescriptor::kFrameVersionMin, *where, &ptrSize);
-   pos += SerializeUInt64(0, *where); // reserved; can be at some point used, e.g., for compression flags
+   bool hasStatistics = false;
+   for (const auto &cluster : fClusterDescriptors) {
+      for (const auto &column : fColumnDescriptors)
+         hasStatistics = hasStatistics || cluster.second.GetColumnRange(column.first).fStatistics.fHasRange;
+   }
+   // Flags; readers that do not know about a flag ignore the corresponding trailing information
+   pos += SerializeUInt64(hasStatistics ? kFooterFlagStatistics : 0, *where);
 
    pos += SerializeUInt64(fClusterDescriptors.size(), *where);
    for (const auto& cluster : fClusterDescriptors) {
@@ -601,6 +684,17 @@ std::uint32_t ROOT::Experimental::RNTupleDescriptor::SerializeFooter(void* buffe
       }
    }
 
+   if (hasStatistics) {
+      // Same order of clusters, columns, and pages as above
+      for (const auto &cluster : fClusterDescriptors) {
+         for (const auto &column : fColumnDescriptors) {
+            pos += SerializeStatistics(cluster.second.GetColumnRange(column.first).fStatistics, *where);
+            for (const auto &pageInfo : cluster.second.GetPageRange(column.first).fPageInfos)
+               pos += SerializeStatistics(pageInfo.fStatistics, *where);
+         }
+      }
+   }
+
    // The next 16 bytes make the ntuple's postscript
    pos += SerializeUInt16(kFrameVersionCurrent, *where);
    pos += SerializeUInt16(kFrameVersionMin, *where);
@@ -694,6 +788,33 @@ ROOT::Experimental::RNTupleDescriptor::FindClusterId(DescriptorId_t columnId, NT
 }
 
 
+ROOT::Experimental::DescriptorId_t
+ROOT::Experimental::RNTupleDescriptor::FindNextClusterId(DescriptorId_t clusterId) const
+{
+   const auto &clusterDesc = GetClusterDescriptor(clusterId);
+   auto firstEntryInNextCluster = clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries();
+   // TODO(jblomer): binary search?
+   for (const auto &cd : fClusterDescriptors) {
+      if (cd.second.GetFirstEntryIndex() == firstEntryInNextCluster)
+         return cd.second.GetId();
+   }
+   return kInvalidDescriptorId;
+}
+
+
+ROOT::Experimental::DescriptorId_t
+ROOT::Experimental::RNTupleDescriptor::FindPrevClusterId(DescriptorId_t clusterId) const
+{
+   const auto &clusterDesc = GetClusterDescriptor(clusterId);
+   // TODO(jblomer): binary search?
+   for (const auto &cd : fClusterDescriptors) {
+      if (cd.second.GetFirstEntryIndex() + cd.second.GetNEntries() == clusterDesc.GetFirstEntryIndex())
+         return cd.second.GetId();
+   }
+   return kInvalidDescriptorId;
+}
+
+
 std::unique_ptr<ROOT::Experimental::RNTupleModel> ROOT::Experimental::RNTupleDescriptor::GenerateModel() const
 {
    auto model = std::make_unique<RNTupleModel>();
@@ -794,11 +915,13 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
    std::uint32_t frameSize;
    pos += DeserializeFrame(RNTupleDescriptor::kFrameVersionCurrent, pos, &frameSize);
    VerifyCrc32(base, frameSize);
-   std::uint64_t reserved;
-   pos += DeserializeUInt64(pos, &reserved);
+   std::uint64_t flags;
+   pos += DeserializeUInt64(pos, &flags);
 
    std::uint64_t nClusters;
    pos += DeserializeUInt64(pos, &nClusters);
+   std::vector<DescriptorId_t> clusterIds;
+   std::vector<DescriptorId_t> columnIds;
    for (std::uint64_t i = 0; i < nClusters; ++i) {
       RNTupleUuid uuid;
       pos += DeserializeUuid(pos, &uuid);
@@ -811,6 +934,7 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
       std::uint64_t firstEntry;
       std::uint64_t nEntries;
       pos += DeserializeUInt64(pos, &clusterId);
+      clusterIds.emplace_back(clusterId);
       pos += DeserializeVersion(pos, &version);
       pos += DeserializeUInt64(pos, &firstEntry);
       pos += DeserializeUInt64(pos, &nEntries);
@@ -823,9 +947,11 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
 
       std::uint32_t nColumns;
       pos += DeserializeUInt32(pos, &nColumns);
+      columnIds.clear();
       for (std::uint32_t j = 0; j < nColumns; ++j) {
          uint64_t columnId;
          pos += DeserializeUInt64(pos, &columnId);
+         columnIds.emplace_back(columnId);
 
          RClusterDescriptor::RColumnRange columnRange;
          columnRange.fColumnId = columnId;
@@ -844,6 +970,18 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
          AddClusterPageRange(clusterId, std::move(pageRange));
       }
    }
+
+   if (!(flags & RNTupleDescriptor::kFooterFlagStatistics))
+      return;
+   for (auto clusterId : clusterIds) {
+      auto &clusterDesc = fDescriptor.fClusterDescriptors[clusterId];
+      // All the clusters of a footer have the same set of columns
+      for (auto columnId : columnIds) {
+         pos += DeserializeStatistics(pos, &clusterDesc.fColumnRanges[columnId].fStatistics);
+         for (auto &pageInfo : clusterDesc.fPageRanges[columnId].fPageInfos)
+            pos += DeserializeStatistics(pos, &pageInfo.fStatistics);
+      }
+   }
 }
 
 void ROOT::Experimental::RNTupleDescriptorBuilder::SetNTuple(
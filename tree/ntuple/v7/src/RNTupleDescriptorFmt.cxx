@@ -87,6 +87,24 @@ static std::string GetColumnTypeName(ROOT::Experimental::EColumnType type)
       return "Index";
    case ROOT::Experimental::EColumnType::kSwitch:
       return "Switch";
+   case ROOT::Experimental::EColumnType::kSplitReal64:
+      return "SplitReal64";
+   case ROOT::Experimental::EColumnType::kSplitReal32:
+      return "SplitReal32";
+   case ROOT::Experimental::EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case ROOT::Experimental::EColumnType::kSplitInt32:
+      return "SplitInt32";
+   case ROOT::Experimental::EColumnType::kSplitIndex:
+      return "SplitIndex";
+   case ROOT::Experimental::EColumnType::kReal32Trunc:
+      return "Real32Trunc";
+   case ROOT::Experimental::EColumnType::kReal64Trunc:
+      return "Real64Trunc";
+   case ROOT::Experimental::EColumnType::kReal32Quant:
+      return "Real32Quant";
+   case ROOT::Experimental::EColumnType::kReal64Quant:
+      return "Real64Quant";
    default:
       return "UNKNOWN";
    }
@@ -112,8 +130,8 @@ void ROOT::Experimental::RNTupleDescriptor::PrintInfo(std::ostream &output) cons
    std::uint64_t nPages = 0;
    int compression = -1;
    for (const auto &column : fColumnDescriptors) {
-      auto element = Detail::RColumnElementBase::Generate(column.second.GetModel().GetType());
-      auto elementSize = element.GetSize();
+      auto element = Detail::RColumnElementBase::Generate(column.second.GetModel());
+      auto elementSize = element->GetSize();
 
       ColumnInfo info;
       info.fFieldId = column.second.GetFieldId();
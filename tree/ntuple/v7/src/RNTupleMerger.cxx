@@ -0,0 +1,194 @@
+/// \file RNTupleMerger.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2020-07-27
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <TError.h>
+
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+using RSealedPage = ROOT::Experimental::Detail::RPageStorage::RSealedPage;
+
+/// Identifies a column independent of its id by the names and types of the fields on the path to the column
+/// and by the column index within its field
+std::string GetColumnKey(const ROOT::Experimental::RNTupleDescriptor &desc,
+                         ROOT::Experimental::DescriptorId_t columnId)
+{
+   const auto &columnDesc = desc.GetColumnDescriptor(columnId);
+   std::string key = "#" + std::to_string(columnDesc.GetIndex());
+   for (auto fieldId = columnDesc.GetFieldId(); fieldId != ROOT::Experimental::kInvalidDescriptorId; ) {
+      const auto &fieldDesc = desc.GetFieldDescriptor(fieldId);
+      key = "/" + fieldDesc.GetFieldName() + ":" + fieldDesc.GetTypeName() + key;
+      fieldId = fieldDesc.GetParentId();
+   }
+   return key;
+}
+
+/// Unpacks an on-disk page of the source column and packs and compresses it according to the destination column.
+/// The memory of the resulting sealed page is owned by buffer.
+RSealedPage ResealPage(const RSealedPage &sealedPage,
+                       const ROOT::Experimental::Detail::RColumnElementBase &srcElement,
+                       const ROOT::Experimental::Detail::RColumnElementBase &dstElement,
+                       int compression,
+                       ROOT::Experimental::Detail::RNTupleDecompressor &decompressor,
+                       std::unique_ptr<unsigned char[]> &buffer)
+{
+   const auto nElements = sealedPage.fNElements;
+   const auto srcPackedSize = (srcElement.GetBitsOnStorage() * nElements + 7) / 8;
+   std::unique_ptr<unsigned char[]> packed(new unsigned char[srcPackedSize]);
+   decompressor(sealedPage.fBuffer, sealedPage.fSize, srcPackedSize, packed.get());
+
+   std::unique_ptr<unsigned char[]> unpacked;
+   if (srcElement.IsMappable()) {
+      unpacked = std::move(packed);
+   } else {
+      unpacked = std::unique_ptr<unsigned char[]>(new unsigned char[srcElement.GetSize() * nElements]);
+      srcElement.Unpack(unpacked.get(), packed.get(), nElements);
+   }
+
+   const auto dstPackedSize = (dstElement.GetBitsOnStorage() * nElements + 7) / 8;
+   if (dstElement.IsMappable()) {
+      packed = std::move(unpacked);
+   } else {
+      packed = std::unique_ptr<unsigned char[]>(new unsigned char[dstPackedSize]);
+      dstElement.Pack(packed.get(), unpacked.get(), nElements);
+   }
+
+   buffer = std::unique_ptr<unsigned char[]>(new unsigned char[dstPackedSize]);
+   auto zippedBytes =
+      ROOT::Experimental::Detail::RNTupleCompressor::Zip(packed.get(), dstPackedSize, compression, buffer.get());
+   return RSealedPage(buffer.get(), zippedBytes, nElements);
+}
+
+} // anonymous namespace
+
+
+void ROOT::Experimental::RNTupleMerger::Merge(const std::vector<Detail::RPageSource *> &sources,
+                                              Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw std::runtime_error("RNTupleMerger: no input ntuples");
+
+   // The model needs to outlive the destination's columns connected to it
+   auto model = sources[0]->GetDescriptor().GenerateModel();
+   destination.Create(*model);
+   const auto &dstDesc = destination.GetDescriptor();
+   const auto nColumns = dstDesc.GetNColumns();
+   std::unordered_map<std::string, DescriptorId_t> columnKey2Id;
+   for (DescriptorId_t i = 0; i < nColumns; ++i)
+      columnKey2Id[GetColumnKey(dstDesc, i)] = i;
+   const auto compression = destination.GetWriteOptions().GetCompression();
+
+   Detail::RNTupleDecompressor decompressor;
+   NTupleSize_t nEntries = 0;
+   for (auto source : sources) {
+      const auto &srcDesc = source->GetDescriptor();
+      if ((srcDesc.GetNFields() != dstDesc.GetNFields()) || (srcDesc.GetNColumns() != nColumns))
+         throw std::runtime_error("RNTupleMerger: schema mismatch of ntuple " + srcDesc.GetName());
+
+      // Indexed by the destination column id
+      std::vector<DescriptorId_t> srcColumnIds(nColumns);
+      std::vector<std::unique_ptr<Detail::RColumnElementBase>> srcElements(nColumns);
+      std::vector<std::unique_ptr<Detail::RColumnElementBase>> dstElements(nColumns);
+      std::vector<bool> isSameColumnType(nColumns);
+      Detail::RCluster::ColumnSet_t srcColumns;
+      for (DescriptorId_t i = 0; i < nColumns; ++i) {
+         auto itr = columnKey2Id.find(GetColumnKey(srcDesc, i));
+         if (itr == columnKey2Id.end())
+            throw std::runtime_error("RNTupleMerger: schema mismatch of ntuple " + srcDesc.GetName());
+         const auto dstId = itr->second;
+         const auto srcModel = srcDesc.GetColumnDescriptor(i).GetModel();
+         const auto dstModel = dstDesc.GetColumnDescriptor(dstId).GetModel();
+         srcColumnIds[dstId] = i;
+         srcElements[dstId] = Detail::RColumnElementBase::Generate(srcModel);
+         dstElements[dstId] = Detail::RColumnElementBase::Generate(dstModel);
+         // A different on-disk encoding of the same in-memory type, e.g. a split encoding, can be converted
+         if (srcElements[dstId]->GetSize() != dstElements[dstId]->GetSize())
+            throw std::runtime_error("RNTupleMerger: column type mismatch of ntuple " + srcDesc.GetName());
+         isSameColumnType[dstId] = (srcModel == dstModel);
+         srcColumns.insert(i);
+      }
+
+      for (DescriptorId_t clusterId = 0; clusterId < srcDesc.GetNClusters(); ++clusterId) {
+         const auto &clusterDesc = srcDesc.GetClusterDescriptor(clusterId);
+         auto cluster = source->LoadCluster(clusterId, srcColumns);
+
+         // The page groups point into the sequences, which must not change anymore once the groups are built
+         std::vector<Detail::RPageStorage::SealedPageSequence_t> sealedPages(nColumns);
+         std::vector<std::unique_ptr<unsigned char[]>> resealedBuffers;
+         for (DescriptorId_t i = 0; i < nColumns; ++i) {
+            const auto srcId = srcColumnIds[i];
+            const bool isVerbatim = isSameColumnType[i] &&
+                                    (clusterDesc.GetColumnRange(srcId).fCompressionSettings == compression);
+            NTupleSize_t pageNo = 0;
+            for (const auto &pageInfo : clusterDesc.GetPageRange(srcId).fPageInfos) {
+               const auto onDiskPage = cluster->GetOnDiskPage(Detail::ROnDiskPage::Key(srcId, pageNo++));
+               R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pageInfo.fLocator.fBytesOnStorage));
+               RSealedPage sealedPage(onDiskPage->GetAddress(), onDiskPage->GetSize(), pageInfo.fNElements);
+               if (isVerbatim) {
+                  fNPagesCopied++;
+               } else {
+                  resealedBuffers.emplace_back();
+                  sealedPage = ResealPage(sealedPage, *srcElements[i], *dstElements[i], compression, decompressor,
+                                          resealedBuffers.back());
+                  fNPagesResealed++;
+               }
+               sealedPage.fStatistics = pageInfo.fStatistics;
+               sealedPages[i].emplace_back(sealedPage);
+            }
+         }
+
+         std::vector<Detail::RPageStorage::RSealedPageGroup> sealedPageGroups;
+         for (DescriptorId_t i = 0; i < nColumns; ++i) {
+            if (sealedPages[i].empty())
+               continue;
+            sealedPageGroups.emplace_back(i, sealedPages[i].cbegin(), sealedPages[i].cend());
+         }
+         destination.CommitSealedPageV(sealedPageGroups);
+         nEntries += clusterDesc.GetNEntries();
+         destination.CommitCluster(nEntries);
+      }
+   }
+   destination.CommitDataset();
+}
+
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::string_view ntupleName, const std::vector<std::string> &inputPaths,
+                                              std::string_view outputPath, const RNTupleWriteOptions &options)
+{
+   // The clusters are read one by one by the merger, there is no use for the background read-ahead
+   RNTupleReadOptions readOptions;
+   readOptions.SetClusterCache(RNTupleReadOptions::kOff);
+
+   std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+   std::vector<Detail::RPageSource *> sourcePtrs;
+   for (const auto &path : inputPaths) {
+      sources.emplace_back(Detail::RPageSource::Create(ntupleName, path, readOptions));
+      sources.back()->Attach();
+      sourcePtrs.emplace_back(sources.back().get());
+   }
+   auto destination = Detail::RPageSink::Create(ntupleName, outputPath, options);
+   Merge(sourcePtrs, *destination);
+}
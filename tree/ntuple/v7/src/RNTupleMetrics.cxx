@@ -15,6 +15,7 @@
 
 #include <ROOT/RNTupleMetrics.hxx>
 
+#include <iomanip>
 #include <ostream>
 
 ROOT::Experimental::Detail::RNTuplePerfCounter::~RNTuplePerfCounter()
@@ -59,7 +60,67 @@ void ROOT::Experimental::Detail::RNTupleMetrics::Enable()
       m->Enable();
 }
 
+void ROOT::Experimental::Detail::RNTupleMetrics::Disable()
+{
+   for (auto &c: fCounters)
+      c->Disable();
+   fIsEnabled = false;
+   for (auto m: fObservedMetrics)
+      m->Disable();
+}
+
 void ROOT::Experimental::Detail::RNTupleMetrics::ObserveMetrics(RNTupleMetrics &observee)
 {
    fObservedMetrics.push_back(&observee);
+   if (fIsEnabled)
+      observee.Enable();
+}
+
+
+ROOT::Experimental::Detail::RNTupleTimingCollector::RPhaseCounters &
+ROOT::Experimental::Detail::RNTupleTimingCollector::GetCounters(const std::string &name, const std::string &phase)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   auto &counters = fCounters[Key_t(name, phase)];
+   if (!counters) {
+      const auto prefix = name.empty() ? phase : (name + "." + phase);
+      counters = std::unique_ptr<RPhaseCounters>(new RPhaseCounters{
+         *fMetrics.MakeCounter<RNTupleAtomicCounter*>(prefix + ".nCall", "", "number of calls"),
+         *fMetrics.MakeCounter<RNTupleAtomicCounter*>(prefix + ".timeWall", "ns", "wall clock time spent"),
+         *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>(prefix + ".timeCpu", "ns", "CPU time spent")
+      });
+   }
+   return *counters;
+}
+
+std::vector<ROOT::Experimental::Detail::RNTupleTimingCollector::RTableRow>
+ROOT::Experimental::Detail::RNTupleTimingCollector::GetTable() const
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   std::vector<RTableRow> table;
+   for (const auto &entry : fCounters) {
+      if (entry.second->fNCalls.GetValue() == 0)
+         continue;
+      RTableRow row;
+      row.fName = entry.first.first;
+      row.fPhase = entry.first.second;
+      row.fNCalls = entry.second->fNCalls.GetValue();
+      row.fTimeWallNs = entry.second->fTimeWall.GetValue();
+      row.fTimeCpuNs = static_cast<std::int64_t>(
+         (double(entry.second->fTimeCpu.GetValue()) / double(CLOCKS_PER_SEC)) * (1000. * 1000. * 1000.));
+      table.emplace_back(row);
+   }
+   return table;
+}
+
+void ROOT::Experimental::Detail::RNTupleTimingCollector::PrintTable(std::ostream &output) const
+{
+   output << std::left << std::setw(32) << "NAME" << std::setw(16) << "PHASE" << std::right << std::setw(12)
+          << "CALLS" << std::setw(16) << "WALL TIME [ms]" << std::setw(16) << "CPU TIME [ms]" << std::endl;
+   for (const auto &row : GetTable()) {
+      output << std::left << std::setw(32) << (row.fName.empty() ? "*" : row.fName) << std::setw(16) << row.fPhase
+             << std::right << std::setw(12) << row.fNCalls << std::fixed << std::setprecision(3)
+             << std::setw(16) << double(row.fTimeWallNs) / 1e6 << std::setw(16) << double(row.fTimeCpuNs) / 1e6
+             << std::endl;
+   }
 }
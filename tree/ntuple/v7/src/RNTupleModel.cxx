@@ -29,7 +29,7 @@ ROOT::Experimental::RNTupleModel::RNTupleModel()
   , fDefaultEntry(std::make_unique<REntry>())
 {}
 
-ROOT::Experimental::RNTupleModel* ROOT::Experimental::RNTupleModel::Clone()
+ROOT::Experimental::RNTupleModel* ROOT::Experimental::RNTupleModel::Clone() const
 {
    auto cloneModel = new RNTupleModel();
    auto cloneRootField = static_cast<RFieldRoot*>(fRootField->Clone(""));
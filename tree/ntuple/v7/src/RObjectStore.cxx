@@ -0,0 +1,157 @@
+/// \file RObjectStore.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2020-08-03
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RObjectStore.hxx>
+
+#ifdef R__USE_IMT
+#include <ROOT/TTaskGroup.hxx>
+#endif
+
+#include <TROOT.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+
+std::unique_ptr<ROOT::Experimental::Detail::RObjectStore>
+ROOT::Experimental::Detail::RObjectStore::Create(std::string_view uri)
+{
+   if (!IsObjectStoreURI(uri))
+      throw std::runtime_error("RObjectStore: unsupported location " + std::string(uri));
+   return std::make_unique<RObjectStorePosix>(uri.substr(std::strlen(kURIScheme)));
+}
+
+
+bool ROOT::Experimental::Detail::RObjectStore::IsObjectStoreURI(std::string_view location)
+{
+   return location.compare(0, std::strlen(kURIScheme), kURIScheme) == 0;
+}
+
+
+void ROOT::Experimental::Detail::RObjectStore::PutV(const std::vector<RRequest> &requests)
+{
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled() && (requests.size() > 1)) {
+      TTaskGroup taskGroup;
+      for (const auto &req : requests)
+         taskGroup.Run([this, &req]() { Put(req.fKey, req.fBuffer, req.fSize); });
+      taskGroup.Wait();
+      return;
+   }
+#endif
+   for (const auto &req : requests)
+      Put(req.fKey, req.fBuffer, req.fSize);
+}
+
+
+void ROOT::Experimental::Detail::RObjectStore::GetV(std::vector<RRequest> &requests)
+{
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled() && (requests.size() > 1)) {
+      TTaskGroup taskGroup;
+      for (auto &req : requests)
+         taskGroup.Run([this, &req]() { req.fOutBytes = Get(req.fKey, req.fBuffer, req.fSize); });
+      taskGroup.Wait();
+      return;
+   }
+#endif
+   for (auto &req : requests)
+      req.fOutBytes = Get(req.fKey, req.fBuffer, req.fSize);
+}
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::Detail::RObjectStorePosix::RObjectStorePosix(std::string_view directory)
+   : fDirectory(directory)
+{
+   if (fDirectory.empty())
+      throw std::runtime_error("RObjectStore: empty directory name");
+#ifdef _WIN32
+   auto retval = _mkdir(fDirectory.c_str());
+#else
+   auto retval = mkdir(fDirectory.c_str(), 0755);
+#endif
+   if ((retval != 0) && (errno != EEXIST))
+      throw std::runtime_error("RObjectStore: cannot create directory " + fDirectory + ": " + strerror(errno));
+}
+
+
+std::string ROOT::Experimental::Detail::RObjectStorePosix::GetPath(const std::string &key) const
+{
+   std::string path = fDirectory + "/";
+   for (auto c : key) {
+      switch (c) {
+      case '/': path += "%2F"; break;
+      case '%': path += "%25"; break;
+      default: path += c;
+      }
+   }
+   return path;
+}
+
+
+std::unique_ptr<ROOT::Experimental::Detail::RObjectStore>
+ROOT::Experimental::Detail::RObjectStorePosix::Clone() const
+{
+   return std::make_unique<RObjectStorePosix>(fDirectory);
+}
+
+
+void ROOT::Experimental::Detail::RObjectStorePosix::Put(const std::string &key, const void *buffer,
+                                                        std::size_t nbytes)
+{
+   // Objects become visible only once they are complete
+   const auto path = GetPath(key);
+   const auto tmpPath = path + ".tmp";
+   auto f = fopen(tmpPath.c_str(), "wb");
+   if (!f)
+      throw std::runtime_error("RObjectStore: cannot write " + tmpPath + ": " + strerror(errno));
+   auto written = fwrite(buffer, 1, nbytes, f);
+   auto retval = fclose(f);
+   if ((written != nbytes) || (retval != 0))
+      throw std::runtime_error("RObjectStore: cannot write " + tmpPath);
+#ifdef _WIN32
+   std::remove(path.c_str());
+#endif
+   if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+      throw std::runtime_error("RObjectStore: cannot store " + path + ": " + strerror(errno));
+}
+
+
+std::size_t ROOT::Experimental::Detail::RObjectStorePosix::Get(const std::string &key, void *buffer,
+                                                               std::size_t nbytes)
+{
+   const auto path = GetPath(key);
+   auto f = fopen(path.c_str(), "rb");
+   if (!f)
+      throw std::runtime_error("RObjectStore: cannot read " + path + ": " + strerror(errno));
+   auto nread = fread(buffer, 1, nbytes, f);
+   auto isError = ferror(f);
+   fclose(f);
+   if (isError)
+      throw std::runtime_error("RObjectStore: cannot read " + path);
+   return nread;
+}
@@ -17,6 +17,7 @@
 #include <ROOT/RPageAllocator.hxx>
 
 #include <TError.h>
+#include <TMemoryAccounting.h>
 
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageAllocatorHeap::NewPage(
    ColumnId_t columnId, std::size_t elementSize, std::size_t nElements)
@@ -24,10 +25,13 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageAllocatorHeap
    R__ASSERT((elementSize > 0) && (nElements > 0));
    auto nbytes = elementSize * nElements;
    auto buffer = new unsigned char[nbytes];
+   TMemoryAccounting::Add(TMemoryAccounting::kNTuple, nbytes);
    return RPage(columnId, buffer, nbytes, elementSize);
 }
 
 void ROOT::Experimental::Detail::RPageAllocatorHeap::DeletePage(const RPage& page)
 {
+   if (page.GetBuffer())
+      TMemoryAccounting::Remove(TMemoryAccounting::kNTuple, page.GetCapacity());
    delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
 }
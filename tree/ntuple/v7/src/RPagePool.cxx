@@ -17,62 +17,183 @@
 #include <ROOT/RColumn.hxx>
 
 #include <TError.h>
+#include <TMemoryAccounting.h>
 
 #include <cstdlib>
+#include <iterator>
 
-void ROOT::Experimental::Detail::RPagePool::RegisterPage(const RPage &page, const RPageDeleter &deleter)
+ROOT::Experimental::Detail::RPagePool::RPagePool(std::size_t maxMemory)
+   : fMaxMemory(maxMemory)
+   , fMetrics("RPagePool")
 {
-   fPages.emplace_back(page);
-   fReferences.emplace_back(1);
-   fDeleters.emplace_back(deleter);
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nHit", "", "number of pages found in the page pool"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nMiss", "", "number of pages not found in the page pool"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nEvict", "", "number of cached pages freed due to the budget")
+   });
+}
+
+ROOT::Experimental::Detail::RPagePool::~RPagePool()
+{
+   // Pages that are still in use at this point leak; the owners of the page pool make sure that all pages
+   // have been returned
+   for (auto &entry : fEntries) {
+      if (entry.second.fRefCount == 0)
+         entry.second.fDeleter(entry.second.fPage);
+   }
+   TMemoryAccounting::Remove(TMemoryAccounting::kNTuple, fMemSize);
+}
+
+ROOT::Experimental::Detail::RPagePool::RKey ROOT::Experimental::Detail::RPagePool::MakeKey(const RPage &page)
+{
+   return RKey(page.GetColumnId(), page.GetClusterInfo().GetId(), page.GetClusterRangeFirst());
+}
+
+ROOT::Experimental::Detail::RPagePool::EntryMap_t::iterator ROOT::Experimental::Detail::RPagePool::FindEntry(
+   ColumnId_t columnId, const RClusterIndex &clusterIndex)
+{
+   // The candidate is the last page of the column and cluster that starts at or before the element
+   auto itr = fEntries.upper_bound(RKey(columnId, clusterIndex.GetClusterId(), clusterIndex.GetIndex()));
+   if (itr == fEntries.begin())
+      return fEntries.end();
+   --itr;
+   if ((itr->first.fColumnId != columnId) || !itr->second.fPage.Contains(clusterIndex))
+      return fEntries.end();
+   return itr;
+}
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::AcquireEntry(EntryMap_t::iterator itr)
+{
+   auto &entry = itr->second;
+   if (entry.fRefCount++ == 0)
+      fUnusedPages.erase(entry.fLruPosition);
+   entry.fIsPreloaded = false;
+   return entry.fPage;
+}
+
+void ROOT::Experimental::Detail::RPagePool::EraseEntry(EntryMap_t::iterator itr)
+{
+   auto &entry = itr->second;
+   if (entry.fRefCount == 0)
+      fUnusedPages.erase(entry.fLruPosition);
+   fMemSize -= entry.fPage.GetSize();
+   TMemoryAccounting::Remove(TMemoryAccounting::kNTuple, entry.fPage.GetSize());
+   entry.fDeleter(entry.fPage);
+   fEntries.erase(itr);
+}
+
+void ROOT::Experimental::Detail::RPagePool::EnforceMemoryLimit()
+{
+   if (fMaxMemory == 0)
+      return;
+   while ((fMemSize > fMaxMemory) && !fUnusedPages.empty()) {
+      EraseEntry(fEntries.find(fUnusedPages.back()));
+      fCounters->fNEvict.Inc();
+   }
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPagePool::RegisterPage(const RPage &page, const RPageDeleter &deleter)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   auto key = MakeKey(page);
+   auto itr = fEntries.find(key);
+   if (itr != fEntries.end()) {
+      deleter(page);
+      return AcquireEntry(itr);
+   }
+
+   auto &entry = fEntries[key];
+   entry.fPage = page;
+   entry.fDeleter = deleter;
+   entry.fRefCount = 1;
+   fMemSize += page.GetSize();
+   TMemoryAccounting::Add(TMemoryAccounting::kNTuple, page.GetSize());
+   EnforceMemoryLimit();
+   return page;
+}
+
+void ROOT::Experimental::Detail::RPagePool::PreloadPage(const RPage &page, const RPageDeleter &deleter)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   auto key = MakeKey(page);
+   if (fEntries.count(key) > 0) {
+      deleter(page);
+      return;
+   }
+
+   auto &entry = fEntries[key];
+   entry.fPage = page;
+   entry.fDeleter = deleter;
+   entry.fIsPreloaded = true;
+   entry.fLruPosition = fUnusedPages.insert(fUnusedPages.begin(), key);
+   fMemSize += page.GetSize();
+   TMemoryAccounting::Add(TMemoryAccounting::kNTuple, page.GetSize());
+   EnforceMemoryLimit();
+}
+
+void ROOT::Experimental::Detail::RPagePool::EvictPreloadedPages()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   for (auto itr = fEntries.begin(); itr != fEntries.end(); ) {
+      auto itrNext = std::next(itr);
+      if ((itr->second.fRefCount == 0) && itr->second.fIsPreloaded)
+         EraseEntry(itr);
+      itr = itrNext;
+   }
 }
 
 void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
 {
    if (page.IsNull()) return;
 
-   unsigned int N = fPages.size();
-   for (unsigned i = 0; i < N; ++i) {
-      if (fPages[i] != page) continue;
-
-      if (--fReferences[i] == 0) {
-         fDeleters[i](fPages[i]);
-         fPages[i] = fPages[N-1];
-         fReferences[i] = fReferences[N-1];
-         fDeleters[i] = fDeleters[N-1];
-         fPages.resize(N-1);
-         fReferences.resize(N-1);
-         fDeleters.resize(N-1);
-      }
+   std::lock_guard<std::mutex> guard(fLock);
+   auto itr = fEntries.find(MakeKey(page));
+   R__ASSERT((itr != fEntries.end()) && (itr->second.fPage == page));
+
+   auto &entry = itr->second;
+   R__ASSERT(entry.fRefCount > 0);
+   if (--entry.fRefCount > 0)
       return;
-   }
-   R__ASSERT(false);
+
+   entry.fLruPosition = fUnusedPages.insert(fUnusedPages.begin(), itr->first);
+   // Without a memory budget, unused pages are not cached
+   if (fMaxMemory == 0)
+      EraseEntry(itr);
+   else
+      EnforceMemoryLimit();
 }
 
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage(
    ColumnId_t columnId, NTupleSize_t globalIndex)
 {
-   unsigned int N = fPages.size();
-   for (unsigned int i = 0; i < N; ++i) {
-      if (fReferences[i] == 0) continue;
-      if (fPages[i].GetColumnId() != columnId) continue;
-      if (!fPages[i].Contains(globalIndex)) continue;
-      fReferences[i]++;
-      return fPages[i];
+   std::lock_guard<std::mutex> guard(fLock);
+   for (auto itr = fEntries.lower_bound(RKey(columnId, 0, 0));
+        (itr != fEntries.end()) && (itr->first.fColumnId == columnId); ++itr)
+   {
+      if (!itr->second.fPage.Contains(globalIndex)) continue;
+      fCounters->fNHit.Inc();
+      return AcquireEntry(itr);
    }
+   fCounters->fNMiss.Inc();
    return RPage();
 }
 
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage(
    ColumnId_t columnId, const RClusterIndex &clusterIndex)
 {
-   unsigned int N = fPages.size();
-   for (unsigned int i = 0; i < N; ++i) {
-      if (fReferences[i] == 0) continue;
-      if (fPages[i].GetColumnId() != columnId) continue;
-      if (!fPages[i].Contains(clusterIndex)) continue;
-      fReferences[i]++;
-      return fPages[i];
+   std::lock_guard<std::mutex> guard(fLock);
+   auto itr = FindEntry(columnId, clusterIndex);
+   if (itr == fEntries.end()) {
+      fCounters->fNMiss.Inc();
+      return RPage();
    }
-   return RPage();
+   fCounters->fNHit.Inc();
+   return AcquireEntry(itr);
+}
+
+bool ROOT::Experimental::Detail::RPagePool::HasPage(ColumnId_t columnId, const RClusterIndex &clusterIndex)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return FindEntry(columnId, clusterIndex) != fEntries.end();
 }
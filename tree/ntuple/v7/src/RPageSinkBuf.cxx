@@ -0,0 +1,218 @@
+/// \file RPageSinkBuf.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2020-07-15
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageSinkBuf.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+#ifdef R__USE_IMT
+#include <ROOT/TTaskGroup.hxx>
+#endif
+
+#include <TError.h>
+#include <TROOT.h>
+
+#include <cstring>
+#include <utility>
+
+
+ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink> inner)
+   : RPageSink(inner->GetNTupleName(), inner->GetWriteOptions())
+   , fMetrics("RPageSinkBuf")
+   , fInnerSink(std::move(inner))
+{
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageCommitted", "", "number of pages buffered"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szBuffered", "B", "volume of buffered pages (uncompressed)"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nTaskZip", "", "number of parallel page compression tasks")
+   });
+   fMetrics.ObserveMetrics(fInnerSink->GetMetrics());
+}
+
+
+ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::string_view ntupleName, const RNTupleWriteOptions &options)
+   : RPageSink(ntupleName, options)
+   , fMetrics("RPageSinkBuf")
+{
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageCommitted", "", "number of pages buffered"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szBuffered", "B", "volume of buffered pages (uncompressed)"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nTaskZip", "", "number of parallel page compression tasks")
+   });
+}
+
+
+ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
+{
+   // Pending compression tasks access the buffered pages
+   if (fTaskGroup)
+      fTaskGroup->Wait();
+   ReleaseBufferedPages();
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CreateImpl(const RNTupleModel &model)
+{
+   // RColumnBuf is not copyable; the vector of buffered columns is created in place and never resized
+   fBufferedColumns = std::vector<RColumnBuf>(fLastColumnId);
+   if (!fInnerSink)
+      return;
+   fInnerModel = std::unique_ptr<RNTupleModel>(model.Clone());
+   fInnerSink->Create(*fInnerModel);
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
+{
+   // The column reuses the page buffer after the commit, so we need a copy of the page
+   auto bufPage = ReservePage(columnHandle, page.GetNElements());
+   auto dst = bufPage.TryGrow(page.GetNElements());
+   R__ASSERT(dst != nullptr);
+   memcpy(dst, page.GetBuffer(), page.GetSize());
+   fCounters->fNPageCommitted.Inc();
+   fCounters->fSzBuffered.Add(page.GetSize());
+
+   auto &columnBuf = fBufferedColumns.at(columnHandle.fId);
+   columnBuf.fColumnHandle = columnHandle;
+   columnBuf.fBufferedPages.emplace_back(RPageZipItem(bufPage));
+
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled()) {
+      if (!fTaskGroup)
+         fTaskGroup = std::make_unique<TTaskGroup>();
+      auto &zipItem = columnBuf.fBufferedPages.back();
+      const auto element = columnHandle.fColumn->GetElement();
+      const auto compression = fOptions.GetCompression();
+      fCounters->fNTaskZip.Inc();
+      fTaskGroup->Run([&zipItem, element, compression]() {
+         zipItem.fBuf = std::unique_ptr<unsigned char[]>(new unsigned char[GetPackedSize(zipItem.fPage, *element)]);
+         zipItem.fSealedPage = SealPage(zipItem.fPage, *element, compression, zipItem.fBuf.get());
+      });
+   }
+#endif
+
+   // The locator is issued by the inner sink on cluster commit
+   return RClusterDescriptor::RLocator();
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageImpl(
+   DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   // Sealed pages are buffered as well in order to keep the order of the pages of the column
+   RPageZipItem zipItem{RPage()};
+   zipItem.fBuf = std::unique_ptr<unsigned char[]>(new unsigned char[sealedPage.fSize]);
+   memcpy(zipItem.fBuf.get(), sealedPage.fBuffer, sealedPage.fSize);
+   zipItem.fSealedPage = RSealedPage(zipItem.fBuf.get(), sealedPage.fSize, sealedPage.fNElements);
+   fBufferedColumns.at(columnId).fBufferedPages.emplace_back(std::move(zipItem));
+   return RClusterDescriptor::RLocator();
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::SealBufferedPages()
+{
+   for (auto &columnBuf : fBufferedColumns) {
+      for (auto &zipItem : columnBuf.fBufferedPages) {
+         if (zipItem.fSealedPage.fBuffer != nullptr)
+            continue;
+         const auto element = columnBuf.fColumnHandle.fColumn->GetElement();
+         zipItem.fBuf = std::unique_ptr<unsigned char[]>(new unsigned char[GetPackedSize(zipItem.fPage, *element)]);
+         zipItem.fSealedPage = SealPage(zipItem.fPage, *element, fOptions.GetCompression(), zipItem.fBuf.get());
+      }
+   }
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::ReleaseBufferedPages()
+{
+   for (auto &columnBuf : fBufferedColumns) {
+      for (auto &zipItem : columnBuf.fBufferedPages) {
+         if (!zipItem.fPage.IsNull())
+            ReleasePage(zipItem.fPage);
+      }
+      columnBuf.fBufferedPages.clear();
+   }
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(NTupleSize_t nEntries)
+{
+   if (fTaskGroup)
+      fTaskGroup->Wait();
+   SealBufferedPages();
+
+   // The page statistics, if enabled, have been recorded by RPageSink::CommitPage() in the open page ranges,
+   // whose page infos correspond one-to-one to the buffered pages
+   std::vector<SealedPageSequence_t> sealedPages(fBufferedColumns.size());
+   for (std::size_t i = 0; i < fBufferedColumns.size(); ++i) {
+      const auto &pageInfos = fOpenPageRanges[i].fPageInfos;
+      R__ASSERT(pageInfos.size() == fBufferedColumns[i].fBufferedPages.size());
+      for (std::size_t j = 0; j < pageInfos.size(); ++j) {
+         sealedPages[i].emplace_back(fBufferedColumns[i].fBufferedPages[j].fSealedPage);
+         sealedPages[i].back().fStatistics = pageInfos[j].fStatistics;
+      }
+   }
+   std::vector<RSealedPageGroup> sealedPageGroups;
+   for (std::size_t i = 0; i < sealedPages.size(); ++i) {
+      if (!sealedPages[i].empty())
+         sealedPageGroups.emplace_back(i, sealedPages[i].cbegin(), sealedPages[i].cend());
+   }
+
+   CommitSealedCluster(sealedPageGroups, nEntries);
+   ReleaseBufferedPages();
+
+   // The cluster locator is maintained by the inner sink
+   return RClusterDescriptor::RLocator();
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedCluster(
+   const std::vector<RSealedPageGroup> &ranges, NTupleSize_t nEntries)
+{
+   fInnerSink->CommitSealedPageV(ranges);
+   fInnerSink->CommitCluster(nEntries);
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitDatasetImpl()
+{
+   if (fInnerSink)
+      fInnerSink->CommitDataset();
+}
+
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSinkBuf::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
+{
+   if (fInnerSink)
+      return fInnerSink->ReservePage(columnHandle, nElements);
+   if (nElements == 0)
+      nElements = RPageSinkFile::kDefaultElementsPerPage;
+   const auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return RPageAllocatorHeap::NewPage(columnHandle.fId, elementSize, nElements);
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::ReleasePage(RPage &page)
+{
+   if (fInnerSink) {
+      fInnerSink->ReleasePage(page);
+      return;
+   }
+   RPageAllocatorHeap::DeletePage(page);
+}
@@ -16,18 +16,42 @@
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RColumn.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RObjectStore.hxx>
+#include <ROOT/RPageSinkBuf.hxx>
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RPageStorageObject.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <Compression.h>
 #include <TError.h>
 
+#include <cstring>
 #include <unordered_map>
 #include <utility>
 
+namespace {
+
+/// Returns the split encoding for the given column type or the type itself if there is no such encoding
+ROOT::Experimental::EColumnType GetSplitColumnType(ROOT::Experimental::EColumnType type)
+{
+   using EColumnType = ROOT::Experimental::EColumnType;
+   switch (type) {
+   case EColumnType::kReal64: return EColumnType::kSplitReal64;
+   case EColumnType::kReal32: return EColumnType::kSplitReal32;
+   case EColumnType::kInt64: return EColumnType::kSplitInt64;
+   case EColumnType::kInt32: return EColumnType::kSplitInt32;
+   case EColumnType::kIndex: return EColumnType::kSplitIndex;
+   default: return type;
+   }
+}
+
+} // anonymous namespace
+
 
 ROOT::Experimental::Detail::RPageStorage::RPageStorage(std::string_view name) : fNTupleName(name)
 {
@@ -53,6 +77,8 @@ ROOT::Experimental::Detail::RPageSource::~RPageSource()
 std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Detail::RPageSource::Create(
    std::string_view ntupleName, std::string_view location, const RNTupleReadOptions &options)
 {
+   if (RObjectStore::IsObjectStoreURI(location))
+      return std::make_unique<RPageSourceObject>(ntupleName, location, options);
    return std::make_unique<RPageSourceFile>(ntupleName, location, options);
 }
 
@@ -62,9 +88,16 @@ ROOT::Experimental::Detail::RPageSource::AddColumn(DescriptorId_t fieldId, const
    R__ASSERT(fieldId != kInvalidDescriptorId);
    auto columnId = fDescriptor.FindColumnId(fieldId, column.GetIndex());
    R__ASSERT(columnId != kInvalidDescriptorId);
+   fActiveColumns.emplace(columnId);
    return ColumnHandle_t(columnId, &column);
 }
 
+ROOT::Experimental::RColumnModel
+ROOT::Experimental::Detail::RPageSource::GetColumnModel(ColumnHandle_t columnHandle) const
+{
+   return fDescriptor.GetColumnDescriptor(columnHandle.fId).GetModel();
+}
+
 ROOT::Experimental::NTupleSize_t ROOT::Experimental::Detail::RPageSource::GetNEntries()
 {
    return fDescriptor.GetNEntries();
@@ -97,17 +130,33 @@ ROOT::Experimental::Detail::RPageSink::~RPageSink()
 std::unique_ptr<ROOT::Experimental::Detail::RPageSink> ROOT::Experimental::Detail::RPageSink::Create(
    std::string_view ntupleName, std::string_view location, const RNTupleWriteOptions &options)
 {
-   return std::make_unique<RPageSinkFile>(ntupleName, location, options);
+   std::unique_ptr<RPageSink> sink;
+   if (RObjectStore::IsObjectStoreURI(location))
+      sink = std::make_unique<RPageSinkObject>(ntupleName, location, options);
+   else
+      sink = std::make_unique<RPageSinkFile>(ntupleName, location, options);
+   if (options.GetUseBufferedWrite())
+      return std::make_unique<RPageSinkBuf>(std::move(sink));
+   return sink;
 }
 
 ROOT::Experimental::Detail::RPageStorage::ColumnHandle_t
 ROOT::Experimental::Detail::RPageSink::AddColumn(DescriptorId_t fieldId, const RColumn &column)
 {
    auto columnId = fLastColumnId++;
-   fDescriptorBuilder.AddColumn(columnId, fieldId, column.GetVersion(), column.GetModel(), column.GetIndex());
+   auto model = column.GetModel();
+   if (fOptions.GetUseSplitEncoding() && (GetSplitColumnType(model.GetType()) != model.GetType()))
+      model = RColumnModel(GetSplitColumnType(model.GetType()), model.GetIsSorted());
+   fDescriptorBuilder.AddColumn(columnId, fieldId, column.GetVersion(), model, column.GetIndex());
    return ColumnHandle_t(columnId, &column);
 }
 
+ROOT::Experimental::RColumnModel
+ROOT::Experimental::Detail::RPageSink::GetColumnModel(ColumnHandle_t columnHandle) const
+{
+   return fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(columnHandle.fId).GetModel();
+}
+
 
 void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
 {
@@ -154,10 +203,92 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
    pageInfo.fLocator = locator;
+   if (fOptions.GetUseStatistics()) {
+      auto &statistics = pageInfo.fStatistics;
+      statistics.fHasRange = columnHandle.fColumn->GetValueRange(page, statistics.fMin, statistics.fMax);
+      fOpenColumnRanges[columnId].fStatistics.Merge(statistics);
+   }
+   fOpenPageRanges[columnId].fPageInfos.emplace_back(pageInfo);
+}
+
+
+void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   auto locator = CommitSealedPageImpl(columnId, sealedPage);
+
+   fOpenColumnRanges[columnId].fNElements += sealedPage.fNElements;
+   fOpenColumnRanges[columnId].fStatistics.Merge(sealedPage.fStatistics);
+   RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   pageInfo.fNElements = sealedPage.fNElements;
+   pageInfo.fLocator = locator;
+   pageInfo.fStatistics = sealedPage.fStatistics;
    fOpenPageRanges[columnId].fPageInfos.emplace_back(pageInfo);
 }
 
 
+std::vector<ROOT::Experimental::RClusterDescriptor::RLocator>
+ROOT::Experimental::Detail::RPageSink::CommitSealedPageVImpl(const std::vector<RSealedPageGroup> &ranges)
+{
+   std::vector<RClusterDescriptor::RLocator> locators;
+   for (auto &range : ranges) {
+      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt)
+         locators.emplace_back(CommitSealedPageImpl(range.fColumnId, *sealedPageIt));
+   }
+   return locators;
+}
+
+
+void ROOT::Experimental::Detail::RPageSink::CommitSealedPageV(const std::vector<RSealedPageGroup> &ranges)
+{
+   auto locators = CommitSealedPageVImpl(ranges);
+   unsigned i = 0;
+   for (auto &range : ranges) {
+      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
+         fOpenColumnRanges[range.fColumnId].fNElements += sealedPageIt->fNElements;
+         fOpenColumnRanges[range.fColumnId].fStatistics.Merge(sealedPageIt->fStatistics);
+         RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+         pageInfo.fNElements = sealedPageIt->fNElements;
+         pageInfo.fLocator = locators[i++];
+         pageInfo.fStatistics = sealedPageIt->fStatistics;
+         fOpenPageRanges[range.fColumnId].fPageInfos.emplace_back(pageInfo);
+      }
+   }
+   R__ASSERT(i == locators.size());
+}
+
+
+std::size_t
+ROOT::Experimental::Detail::RPageSink::GetPackedSize(const RPage &page, const RColumnElementBase &element)
+{
+   if (element.IsMappable())
+      return page.GetSize();
+   return (page.GetNElements() * element.GetBitsOnStorage() + 7) / 8;
+}
+
+
+ROOT::Experimental::Detail::RPageSink::RSealedPage
+ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page, const RColumnElementBase &element,
+                                                int compressionSetting, void *buf)
+{
+   unsigned char *pageBuf = reinterpret_cast<unsigned char *>(page.GetBuffer());
+   const auto packedBytes = GetPackedSize(page, element);
+   std::unique_ptr<unsigned char[]> packedBuffer;
+   if (!element.IsMappable()) {
+      packedBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[packedBytes]);
+      element.Pack(packedBuffer.get(), page.GetBuffer(), page.GetNElements());
+      pageBuf = packedBuffer.get();
+   }
+
+   auto zippedBytes = packedBytes;
+   if (compressionSetting != 0) {
+      zippedBytes = RNTupleCompressor::Zip(pageBuf, packedBytes, compressionSetting, buf);
+   } else {
+      memcpy(buf, pageBuf, packedBytes);
+   }
+   return RSealedPage{buf, static_cast<std::uint32_t>(zippedBytes), static_cast<std::uint32_t>(page.GetNElements())};
+}
+
+
 void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NTupleSize_t nEntries)
 {
    auto locator = CommitClusterImpl(nEntries);
@@ -170,6 +301,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NT
       fDescriptorBuilder.AddClusterColumnRange(fLastClusterId, range);
       range.fFirstElementIndex += range.fNElements;
       range.fNElements = 0;
+      range.fStatistics = RClusterDescriptor::RStatistics();
    }
    for (auto &range : fOpenPageRanges) {
       RClusterDescriptor::RPageRange fullRange;
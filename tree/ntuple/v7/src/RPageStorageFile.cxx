@@ -13,6 +13,9 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RClusterPool.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RLogger.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
@@ -23,16 +26,44 @@
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RRawFile.hxx>
+#ifdef R__USE_IMT
+#include <ROOT/TTaskGroup.hxx>
+#endif
 
 #include <RVersion.h>
 #include <TError.h>
+#include <TROOT.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
+namespace {
+
+/// The name of a column in the timing table: the qualified name of its field followed by the column index,
+/// e.g. "jets.pt#0"
+std::string GetColumnTimingName(const ROOT::Experimental::RNTupleDescriptor &desc,
+                                ROOT::Experimental::DescriptorId_t columnId)
+{
+   const auto &columnDesc = desc.GetColumnDescriptor(columnId);
+   std::string fieldName;
+   for (auto fieldId = columnDesc.GetFieldId(); fieldId != ROOT::Experimental::kInvalidDescriptorId; ) {
+      const auto &fieldDesc = desc.GetFieldDescriptor(fieldId);
+      // The root field has an empty name
+      if (!fieldDesc.GetFieldName().empty())
+         fieldName = fieldName.empty() ? fieldDesc.GetFieldName() : (fieldDesc.GetFieldName() + "." + fieldName);
+      fieldId = fieldDesc.GetParentId();
+   }
+   return fieldName + "#" + std::to_string(columnDesc.GetIndex());
+}
+
+} // anonymous namespace
 
 ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntupleName, std::string_view path,
    const RNTupleWriteOptions &options)
@@ -118,20 +149,70 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitPageImpl(ColumnHandle_t columnH
       isAdoptedBuffer = true;
    }
 
-   auto offsetData = fWriter->WriteBlob(buffer, zippedBytes, packedBytes);
-   fClusterMinOffset = std::min(offsetData, fClusterMinOffset);
-   fClusterMaxOffset = std::max(offsetData, fClusterMaxOffset);
+   auto result = WriteSealedPage(RSealedPage(buffer, zippedBytes, page.GetNElements()), packedBytes);
 
    if (!isAdoptedBuffer)
       delete[] buffer;
 
+   return result;
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkFile::WriteSealedPage(const RSealedPage &sealedPage, std::size_t bytesPacked)
+{
+   auto offsetData = fWriter->WriteBlob(sealedPage.fBuffer, sealedPage.fSize, bytesPacked);
+   fClusterMinOffset = std::min(offsetData, fClusterMinOffset);
+   fClusterMaxOffset = std::max(offsetData + sealedPage.fSize, fClusterMaxOffset);
+
    RClusterDescriptor::RLocator result;
    result.fPosition = offsetData;
-   result.fBytesOnStorage = zippedBytes;
+   result.fBytesOnStorage = sealedPage.fSize;
    return result;
 }
 
 
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(
+   DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   const auto &columnDesc = fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(columnId);
+   const auto bitsOnStorage = RColumnElementBase::Generate(columnDesc.GetModel())->GetBitsOnStorage();
+   const auto bytesPacked = (bitsOnStorage * sealedPage.fNElements + 7) / 8;
+   return WriteSealedPage(sealedPage, bytesPacked);
+}
+
+
+std::vector<ROOT::Experimental::RClusterDescriptor::RLocator>
+ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageVImpl(const std::vector<RSealedPageGroup> &ranges)
+{
+   std::size_t szBlob = 0;
+   for (auto &range : ranges) {
+      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt)
+         szBlob += sealedPageIt->fSize;
+   }
+   std::vector<RClusterDescriptor::RLocator> locators;
+   if (szBlob == 0)
+      return locators;
+
+   // The pages are contiguous on disk: they are written into a single blob that is reserved upfront
+   auto offset = fWriter->ReserveBlob(szBlob, szBlob);
+   fClusterMinOffset = std::min(offset, fClusterMinOffset);
+   for (auto &range : ranges) {
+      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
+         fWriter->WriteIntoReservedBlob(sealedPageIt->fBuffer, sealedPageIt->fSize, offset);
+         RClusterDescriptor::RLocator locator;
+         locator.fPosition = offset;
+         locator.fBytesOnStorage = sealedPageIt->fSize;
+         locators.emplace_back(locator);
+         offset += sealedPageIt->fSize;
+      }
+   }
+   fClusterMaxOffset = std::max(offset, fClusterMaxOffset);
+   return locators;
+}
+
+
 ROOT::Experimental::RClusterDescriptor::RLocator
 ROOT::Experimental::Detail::RPageSinkFile::CommitClusterImpl(ROOT::Experimental::NTupleSize_t /* nEntries */)
 {
@@ -197,18 +278,45 @@ void ROOT::Experimental::Detail::RPageAllocatorFile::DeletePage(const RPage& pag
 
 
 ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view ntupleName,
-   const RNTupleReadOptions &options)
+   const RNTupleReadOptions &options, std::shared_ptr<RPagePool> pagePool,
+   std::shared_ptr<RNTupleTimingCollector> timingCollector)
    : RPageSource(ntupleName, options)
    , fMetrics("RPageSourceFile")
+   , fTimingCollector(std::move(timingCollector))
    , fPageAllocator(std::make_unique<RPageAllocatorFile>())
-   , fPagePool(std::make_shared<RPagePool>())
+   , fPagePool(std::move(pagePool))
 {
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nReadV", "", "number of vector read requests"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nRead", "", "number of byte ranges read"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szReadPayload", "B", "volume read from file (required)"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szReadOverhead", "B", "volume read from file (overhead)"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nClusterLoaded", "",
+                                                   "number of partial clusters preloaded from storage"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageLoaded", "", "number of pages loaded from storage"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nClusterUnzipped", "",
+                                                   "number of partial clusters decompressed in parallel"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nClusterMapped", "",
+                                                   "number of partial clusters memory-mapped from storage"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageMapped", "", "number of pages used in place (zero-copy)"),
+      fTimingCollector->GetCounters("", "read"),
+      fTimingCollector->GetCounters("", "deserialize")
+   });
+   // With clones, the page pool counters sum up the page requests of all the page sources sharing the pool
+   fMetrics.ObserveMetrics(fPagePool->GetMetrics());
+   fMetrics.ObserveMetrics(fTimingCollector->GetMetrics());
+
+   if (options.GetClusterCache() != RNTupleReadOptions::kOff) {
+      fClusterPool = std::make_unique<RClusterPool>(*this, options.GetClusterReadAhead(),
+                                                    options.GetClusterCacheMemory());
+   }
 }
 
 
 ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view ntupleName, std::string_view path,
    const RNTupleReadOptions &options)
-   : RPageSourceFile(ntupleName, options)
+   : RPageSourceFile(ntupleName, options, std::make_shared<RPagePool>(options.GetPagePoolMemory()),
+                     std::make_shared<RNTupleTimingCollector>("RNTupleTiming"))
 {
    fFile = ROOT::Internal::RRawFile::Create(path);
    R__ASSERT(fFile);
@@ -221,6 +329,21 @@ ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile()
 }
 
 
+ROOT::Experimental::Detail::RPageSourceFile::RMmapRegion::RMmapRegion(
+   std::shared_ptr<ROOT::Internal::RRawFile> file, std::size_t nbytes, std::uint64_t offset)
+   : fFile(std::move(file))
+{
+   fAddress = static_cast<unsigned char *>(fFile->Map(nbytes, offset, fMapdOffset));
+   fSize = nbytes + (offset - fMapdOffset);
+}
+
+
+ROOT::Experimental::Detail::RPageSourceFile::RMmapRegion::~RMmapRegion()
+{
+   fFile->Unmap(fAddress, fSize);
+}
+
+
 ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFile::AttachImpl()
 {
    RNTupleDescriptorBuilder descBuilder;
@@ -228,17 +351,40 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
 
    auto buffer = std::unique_ptr<unsigned char[]>(new unsigned char[fNTuple.fLenHeader]);
    auto zipBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[fNTuple.fNBytesHeader]);
-   fReader.ReadBuffer(zipBuffer.get(), fNTuple.fNBytesHeader, fNTuple.fSeekHeader);
-   fDecompressor(zipBuffer.get(), fNTuple.fNBytesHeader, fNTuple.fLenHeader, buffer.get());
-   descBuilder.SetFromHeader(buffer.get());
+   {
+      RNTupleTimingCollector::RPhaseTimer timer(fCounters->fTimeRead);
+      fReader.ReadBuffer(zipBuffer.get(), fNTuple.fNBytesHeader, fNTuple.fSeekHeader);
+   }
+   {
+      RNTupleTimingCollector::RPhaseTimer timer(fCounters->fTimeDeserialize);
+      fDecompressor(zipBuffer.get(), fNTuple.fNBytesHeader, fNTuple.fLenHeader, buffer.get());
+      descBuilder.SetFromHeader(buffer.get());
+   }
 
    buffer = std::unique_ptr<unsigned char[]>(new unsigned char[fNTuple.fLenFooter]);
    zipBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[fNTuple.fNBytesFooter]);
-   fReader.ReadBuffer(zipBuffer.get(), fNTuple.fNBytesFooter, fNTuple.fSeekFooter);
-   fDecompressor(zipBuffer.get(), fNTuple.fNBytesFooter, fNTuple.fLenFooter, buffer.get());
-   descBuilder.AddClustersFromFooter(buffer.get());
+   {
+      RNTupleTimingCollector::RPhaseTimer timer(fCounters->fTimeRead);
+      fReader.ReadBuffer(zipBuffer.get(), fNTuple.fNBytesFooter, fNTuple.fSeekFooter);
+   }
+   {
+      RNTupleTimingCollector::RPhaseTimer timer(fCounters->fTimeDeserialize);
+      fDecompressor(zipBuffer.get(), fNTuple.fNBytesFooter, fNTuple.fLenFooter, buffer.get());
+      descBuilder.AddClustersFromFooter(buffer.get());
+   }
 
-   return descBuilder.MoveDescriptor();
+   auto descriptor = descBuilder.MoveDescriptor();
+   // The clones of a page source have the same descriptor and thus arrive at the same column timers
+   const auto nColumns = descriptor.GetNColumns();
+   fColumnTimers.clear();
+   fColumnTimers.reserve(nColumns);
+   for (DescriptorId_t i = 0; i < nColumns; ++i) {
+      const auto name = GetColumnTimingName(descriptor, i);
+      fColumnTimers.emplace_back(RColumnTimers{fTimingCollector->GetCounters(name, "populate"),
+                                               fTimingCollector->GetCounters(name, "unzip"),
+                                               fTimingCollector->GetCounters(name, "unpack")});
+   }
+   return descriptor;
 }
 
 
@@ -248,37 +394,71 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    const auto columnId = columnHandle.fId;
    const auto clusterId = clusterDescriptor.GetId();
    const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
+   auto &columnTimers = fColumnTimers[columnId];
+   RNTupleTimingCollector::RPhaseTimer timer(columnTimers.fPopulate);
 
    // TODO(jblomer): binary search
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    decltype(clusterIndex) firstInPage = 0;
+   NTupleSize_t pageNo = 0;
    for (const auto &pi : pageRange.fPageInfos) {
       if (firstInPage + pi.fNElements > clusterIndex) {
          pageInfo = pi;
          break;
       }
       firstInPage += pi.fNElements;
+      ++pageNo;
    }
    R__ASSERT(firstInPage <= clusterIndex);
    R__ASSERT((firstInPage + pageInfo.fNElements) > clusterIndex);
 
    const auto element = columnHandle.fColumn->GetElement();
+   const auto deleter = RPageDeleter([](const RPage &page, void * /*userData*/)
+   {
+      RPageAllocatorFile::DeletePage(page);
+   }, nullptr);
+
+   if (fClusterPool) {
+      auto cluster = fClusterPool->GetCluster(clusterId, fActiveColumns);
+#ifdef R__USE_IMT
+      if (IsImplicitMTEnabled()) {
+         UnzipCluster(*cluster);
+         auto cachedPage = fPagePool->GetPage(columnId, RClusterIndex(clusterId, clusterIndex));
+         if (!cachedPage.IsNull())
+            return cachedPage;
+      }
+#endif
+      auto onDiskPage = cluster->GetOnDiskPage(ROnDiskPage::Key(columnId, pageNo));
+      R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pageInfo.fLocator.fBytesOnStorage));
+      auto pageDeleter = deleter;
+      auto newPage = MapPage(columnId, *element, clusterDescriptor, pageInfo, firstInPage, *onDiskPage, pageDeleter);
+      if (newPage.IsNull())
+         newPage = UnzipPage(columnId, *element, clusterDescriptor, pageInfo, firstInPage, *onDiskPage);
+      return fPagePool->RegisterPage(newPage, pageDeleter);
+   }
+
    const auto elementSize = element->GetSize();
 
    auto pageSize = pageInfo.fLocator.fBytesOnStorage;
    auto pageBuffer = new unsigned char[
       std::max(pageSize, static_cast<std::uint32_t>(elementSize * pageInfo.fNElements))];
-   fReader.ReadBuffer(pageBuffer, pageInfo.fLocator.fBytesOnStorage, pageInfo.fLocator.fPosition);
-
    const auto bytesOnStorage = (element->GetBitsOnStorage() * pageInfo.fNElements + 7) / 8;
+
+   {
+      RNTupleTimingCollector::RPhaseTimer timerRead(fCounters->fTimeRead);
+      fReader.ReadBuffer(pageBuffer, pageInfo.fLocator.fBytesOnStorage, pageInfo.fLocator.fPosition);
+   }
+   fCounters->fNPageLoaded.Inc();
    if (pageSize != bytesOnStorage) {
+      RNTupleTimingCollector::RPhaseTimer timerUnzip(columnTimers.fUnzip);
       fDecompressor(pageBuffer, pageSize, bytesOnStorage);
-      pageSize = bytesOnStorage;
    }
+   pageSize = bytesOnStorage;
 
    if (!element->IsMappable()) {
       pageSize = elementSize * pageInfo.fNElements;
       auto unpackedBuffer = new unsigned char[pageSize];
+      RNTupleTimingCollector::RPhaseTimer timerUnpack(columnTimers.fUnpack);
       element->Unpack(unpackedBuffer, pageBuffer, pageInfo.fNElements);
       delete[] pageBuffer;
       pageBuffer = unpackedBuffer;
@@ -287,15 +467,149 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
    auto newPage = fPageAllocator->NewPage(columnId, pageBuffer, elementSize, pageInfo.fNElements);
    newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
-   fPagePool->RegisterPage(newPage,
-      RPageDeleter([](const RPage &page, void * /*userData*/)
-      {
-         RPageAllocatorFile::DeletePage(page);
-      }, nullptr));
+   return fPagePool->RegisterPage(newPage, deleter);
+}
+
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::UnzipPage(
+   DescriptorId_t columnId, const RColumnElementBase &element, const RClusterDescriptor &clusterDescriptor,
+   const RClusterDescriptor::RPageRange::RPageInfo &pageInfo, ClusterSize_t::ValueType firstInPage,
+   const ROnDiskPage &onDiskPage)
+{
+   const auto elementSize = element.GetSize();
+   const auto bytesOnStorage = (element.GetBitsOnStorage() * pageInfo.fNElements + 7) / 8;
+
+   auto &columnTimers = fColumnTimers[columnId];
+
+   auto pageBuffer = new unsigned char[bytesOnStorage];
+   {
+      RNTupleTimingCollector::RPhaseTimer timerUnzip(columnTimers.fUnzip);
+      // Decompresses or copies from the cluster on-disk page into the page buffer
+      fDecompressor(onDiskPage.GetAddress(), onDiskPage.GetSize(), bytesOnStorage, pageBuffer);
+   }
+
+   if (!element.IsMappable()) {
+      auto unpackedBuffer = new unsigned char[elementSize * pageInfo.fNElements];
+      RNTupleTimingCollector::RPhaseTimer timerUnpack(columnTimers.fUnpack);
+      element.Unpack(unpackedBuffer, pageBuffer, pageInfo.fNElements);
+      delete[] pageBuffer;
+      pageBuffer = unpackedBuffer;
+   }
+
+   const auto clusterId = clusterDescriptor.GetId();
+   const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+   auto newPage = fPageAllocator->NewPage(columnId, pageBuffer, elementSize, pageInfo.fNElements);
+   newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
    return newPage;
 }
 
 
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::MapPage(
+   DescriptorId_t columnId, const RColumnElementBase &element, const RClusterDescriptor &clusterDescriptor,
+   const RClusterDescriptor::RPageRange::RPageInfo &pageInfo, ClusterSize_t::ValueType firstInPage,
+   const ROnDiskPage &onDiskPage, RPageDeleter &deleter)
+{
+   const auto elementSize = element.GetSize();
+   // Uncompressed pages are stored with their original size.  Compressed pages and pages packed into a different
+   // on-disk representation need to be copied.
+   if (!element.IsMappable() || (pageInfo.fNElements == 0) ||
+       (onDiskPage.GetSize() != elementSize * pageInfo.fNElements))
+   {
+      return RPage();
+   }
+   // Pages are not aligned in the file; misaligned pages cannot be accessed as an array of elements
+   if ((reinterpret_cast<std::uintptr_t>(onDiskPage.GetAddress()) % elementSize) != 0)
+      return RPage();
+   auto region = FindMmapRegion(onDiskPage.GetAddress());
+   if (!region)
+      return RPage();
+
+   const auto clusterId = clusterDescriptor.GetId();
+   const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+   // Mappings are read-only; pages of a page source are never written to
+   auto newPage = fPageAllocator->NewPage(columnId, const_cast<void *>(onDiskPage.GetAddress()), elementSize,
+                                          pageInfo.fNElements);
+   newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+   deleter = RPageDeleter([](const RPage & /*page*/, void *userData)
+   {
+      delete static_cast<std::shared_ptr<RMmapRegion> *>(userData);
+   }, new std::shared_ptr<RMmapRegion>(std::move(region)));
+   fCounters->fNPageMapped.Inc();
+   return newPage;
+}
+
+
+std::shared_ptr<ROOT::Experimental::Detail::RPageSourceFile::RMmapRegion>
+ROOT::Experimental::Detail::RPageSourceFile::FindMmapRegion(const void *address)
+{
+   std::lock_guard<std::mutex> guard(fMmapLock);
+   for (const auto &weakRegion : fMmapRegions) {
+      auto region = weakRegion.lock();
+      if (region && region->Contains(address))
+         return region;
+   }
+   return nullptr;
+}
+
+
+void ROOT::Experimental::Detail::RPageSourceFile::UnzipCluster(const RCluster &cluster)
+{
+#ifdef R__USE_IMT
+   const auto clusterId = cluster.GetId();
+   if (clusterId != fUnzipClusterId) {
+      // With a memory budget, the page pool itself frees unused pages; other page sources sharing the pool might
+      // still use the preloaded pages
+      if (fPagePool->GetMaxMemory() == 0)
+         fPagePool->EvictPreloadedPages();
+      fUnzipClusterId = clusterId;
+      fUnzipColumns.clear();
+   }
+
+   const auto &clusterDescriptor = fDescriptor.GetClusterDescriptor(clusterId);
+   // The elements need to outlive the decompression tasks
+   std::vector<std::unique_ptr<RColumnElementBase>> elements;
+   TTaskGroup taskGroup;
+   for (auto columnId : fActiveColumns) {
+      if (!cluster.ContainsColumn(columnId) || (fUnzipColumns.count(columnId) > 0))
+         continue;
+      fUnzipColumns.insert(columnId);
+
+      elements.emplace_back(
+         RColumnElementBase::Generate(fDescriptor.GetColumnDescriptor(columnId).GetModel()));
+      const auto element = elements.back().get();
+      const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
+      ClusterSize_t::ValueType firstInPage = 0;
+      NTupleSize_t pageNo = 0;
+      for (const auto &pageInfo : pageRange.fPageInfos) {
+         const auto onDiskPage = cluster.GetOnDiskPage(ROnDiskPage::Key(columnId, pageNo));
+         R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pageInfo.fLocator.fBytesOnStorage));
+         if (fPagePool->HasPage(columnId, RClusterIndex(clusterId, firstInPage))) {
+            firstInPage += pageInfo.fNElements;
+            ++pageNo;
+            continue;
+         }
+         taskGroup.Run([this, columnId, element, &clusterDescriptor, &pageInfo, firstInPage, onDiskPage]() {
+            RPageDeleter deleter([](const RPage &page, void * /*userData*/)
+            {
+               RPageAllocatorFile::DeletePage(page);
+            }, nullptr);
+            auto newPage = MapPage(columnId, *element, clusterDescriptor, pageInfo, firstInPage, *onDiskPage, deleter);
+            if (newPage.IsNull())
+               newPage = UnzipPage(columnId, *element, clusterDescriptor, pageInfo, firstInPage, *onDiskPage);
+            fPagePool->PreloadPage(newPage, deleter);
+         });
+         firstInPage += pageInfo.fNElements;
+         ++pageNo;
+      }
+   }
+   taskGroup.Wait();
+   fCounters->fNClusterUnzipped.Inc();
+#else
+   (void)cluster;
+#endif
+}
+
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::PopulatePage(
    ColumnHandle_t columnHandle, NTupleSize_t globalIndex)
 {
@@ -333,9 +647,139 @@ void ROOT::Experimental::Detail::RPageSourceFile::ReleasePage(RPage &page)
    fPagePool->ReturnPage(page);
 }
 
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   fCounters->fNClusterLoaded.Inc();
+
+   const auto &clusterDesc = GetDescriptor().GetClusterDescriptor(clusterId);
+
+   struct ROnDiskPageLocator {
+      ROnDiskPageLocator() = default;
+      ROnDiskPageLocator(DescriptorId_t c, NTupleSize_t p, std::uint64_t o, std::uint64_t s)
+         : fColumnId(c), fPageNo(p), fOffset(o), fSize(s) {}
+      DescriptorId_t fColumnId = 0;
+      NTupleSize_t fPageNo = 0;
+      std::uint64_t fOffset = 0;
+      std::uint64_t fSize = 0;
+      /// The position of the page in the cluster buffer
+      std::size_t fBufPos = 0;
+   };
+
+   // Collect the page necessary page meta-data
+   std::vector<ROnDiskPageLocator> onDiskPages;
+   for (auto columnId : columns) {
+      const auto &pageRange = clusterDesc.GetPageRange(columnId);
+      NTupleSize_t pageNo = 0;
+      for (const auto &pageInfo : pageRange.fPageInfos) {
+         const auto &pageLocator = pageInfo.fLocator;
+         onDiskPages.emplace_back(ROnDiskPageLocator(
+            columnId, pageNo, pageLocator.fPosition, pageLocator.fBytesOnStorage));
+         ++pageNo;
+      }
+   }
+   // Linearize the page requests by file offset
+   std::sort(onDiskPages.begin(), onDiskPages.end(),
+      [](const ROnDiskPageLocator &a, const ROnDiskPageLocator &b) {return a.fOffset < b.fOffset;});
+
+   auto cluster = std::make_unique<RCluster>(clusterId);
+   for (auto columnId : columns)
+      cluster->SetColumnAvailable(columnId);
+
+   if (fOptions.GetUseMmap() && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap) &&
+       !onDiskPages.empty())
+   {
+      // A single mapping from the first to the last byte of the requested pages, including the bytes in between
+      // that belong to other columns; they are not paged in unless touched
+      std::uint64_t szPayload = 0;
+      std::uint64_t mapUpTo = 0;
+      for (const auto &pageLocator : onDiskPages) {
+         szPayload += pageLocator.fSize;
+         mapUpTo = std::max(mapUpTo, pageLocator.fOffset + pageLocator.fSize);
+      }
+      const auto mapFrom = onDiskPages[0].fOffset;
+      RNTupleTimingCollector::RPhaseTimer timer(fCounters->fTimeRead);
+      auto region = std::make_shared<RMmapRegion>(fFile, mapUpTo - mapFrom, mapFrom);
+      auto pageMap = std::make_unique<ROnDiskPageMapMmap>(region);
+      for (const auto &pageLocator : onDiskPages) {
+         ROnDiskPage page(region->GetAddress(pageLocator.fOffset), pageLocator.fSize);
+         pageMap->Register(ROnDiskPage::Key(pageLocator.fColumnId, pageLocator.fPageNo), page);
+      }
+      {
+         std::lock_guard<std::mutex> guard(fMmapLock);
+         fMmapRegions.erase(std::remove_if(fMmapRegions.begin(), fMmapRegions.end(),
+            [](const std::weak_ptr<RMmapRegion> &r) { return r.expired(); }), fMmapRegions.end());
+         fMmapRegions.emplace_back(region);
+      }
+      fCounters->fNClusterMapped.Inc();
+      fCounters->fSzReadPayload.Add(szPayload);
+      fCounters->fNPageLoaded.Add(onDiskPages.size());
+
+      cluster->Adopt(std::move(pageMap));
+      return cluster;
+   }
+
+   // Coalesce the pages into as few byte ranges as possible: pages that are separated by kMaxGapSize bytes or less
+   // are read by a single request.  The byte ranges are arranged back-to-back in a single cluster buffer.
+   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   std::vector<std::size_t> readRequestBufPos;
+   std::uint64_t szPayload = 0;
+   std::uint64_t szOverhead = 0;
+   std::size_t szBuffer = 0;
+   for (auto &pageLocator : onDiskPages) {
+      szPayload += pageLocator.fSize;
+      if (!readRequests.empty()) {
+         auto &req = readRequests.back();
+         const auto readUpTo = req.fOffset + req.fSize;
+         R__ASSERT(pageLocator.fOffset >= readUpTo);
+         const auto gap = pageLocator.fOffset - readUpTo;
+         if (gap <= kMaxGapSize) {
+            szOverhead += gap;
+            pageLocator.fBufPos = szBuffer + gap;
+            req.fSize += gap + pageLocator.fSize;
+            szBuffer += gap + pageLocator.fSize;
+            continue;
+         }
+      }
+
+      ROOT::Internal::RRawFile::RIOVec req;
+      req.fOffset = pageLocator.fOffset;
+      req.fSize = pageLocator.fSize;
+      readRequests.emplace_back(req);
+      readRequestBufPos.emplace_back(szBuffer);
+      pageLocator.fBufPos = szBuffer;
+      szBuffer += pageLocator.fSize;
+   }
+
+   auto buffer = new unsigned char[szBuffer];
+   for (unsigned int i = 0; i < readRequests.size(); ++i)
+      readRequests[i].fBuffer = buffer + readRequestBufPos[i];
+   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer));
+   if (!readRequests.empty()) {
+      RNTupleTimingCollector::RPhaseTimer timer(fCounters->fTimeRead);
+      fFile->ReadV(&readRequests[0], readRequests.size());
+      for (const auto &req : readRequests)
+         R__ASSERT(req.fOutBytes == req.fSize);
+   }
+   fCounters->fNReadV.Inc();
+   fCounters->fNRead.Add(readRequests.size());
+   fCounters->fSzReadPayload.Add(szPayload);
+   fCounters->fSzReadOverhead.Add(szOverhead);
+   fCounters->fNPageLoaded.Add(onDiskPages.size());
+
+   for (const auto &pageLocator : onDiskPages) {
+      ROnDiskPage page(buffer + pageLocator.fBufPos, pageLocator.fSize);
+      pageMap->Register(ROnDiskPage::Key(pageLocator.fColumnId, pageLocator.fPageNo), page);
+   }
+
+   cluster->Adopt(std::move(pageMap));
+   return cluster;
+}
+
+
 std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Detail::RPageSourceFile::Clone() const
 {
-   auto clone = new RPageSourceFile(fNTupleName, fOptions);
+   auto clone = new RPageSourceFile(fNTupleName, fOptions, fPagePool, fTimingCollector);
    clone->fFile = fFile->Clone();
    clone->fReader = Internal::RMiniFileReader(clone->fFile.get());
    return std::unique_ptr<RPageSourceFile>(clone);
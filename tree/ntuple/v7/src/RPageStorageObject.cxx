@@ -0,0 +1,502 @@
+/// \file RPageStorageObject.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2020-08-03
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RClusterPool.hxx>
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RLogger.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RObjectStore.hxx>
+#include <ROOT/RPage.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPagePool.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RPageStorageObject.hxx>
+
+#include <TError.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+/// The anchor object records the sizes of the header and footer objects
+struct RAnchor {
+   static constexpr std::size_t kSize = 5 * sizeof(std::uint32_t);
+
+   std::uint32_t fVersion = 0;
+   std::uint32_t fNBytesHeader = 0;
+   std::uint32_t fLenHeader = 0;
+   std::uint32_t fNBytesFooter = 0;
+   std::uint32_t fLenFooter = 0;
+
+   /// Little-endian encoding of the fields in declaration order into kSize bytes
+   void Serialize(unsigned char *buffer) const
+   {
+      const std::uint32_t fields[] = {fVersion, fNBytesHeader, fLenHeader, fNBytesFooter, fLenFooter};
+      for (auto f : fields) {
+         for (unsigned int i = 0; i < sizeof(std::uint32_t); ++i)
+            *buffer++ = (f >> (8 * i)) & 0xFF;
+      }
+   }
+
+   void Deserialize(const unsigned char *buffer)
+   {
+      std::uint32_t *fields[] = {&fVersion, &fNBytesHeader, &fLenHeader, &fNBytesFooter, &fLenFooter};
+      for (auto f : fields) {
+         *f = 0;
+         for (unsigned int i = 0; i < sizeof(std::uint32_t); ++i)
+            *f |= std::uint32_t(*buffer++) << (8 * i);
+      }
+   }
+};
+
+std::string GetAnchorKey(const std::string &ntupleName)
+{
+   return ntupleName + "/anchor";
+}
+
+std::string GetHeaderKey(const std::string &ntupleName)
+{
+   return ntupleName + "/header";
+}
+
+std::string GetFooterKey(const std::string &ntupleName)
+{
+   return ntupleName + "/footer";
+}
+
+std::string GetPageKey(const std::string &ntupleName, std::uint64_t pageId)
+{
+   return ntupleName + "/page/" + std::to_string(pageId);
+}
+
+} // anonymous namespace
+
+
+ROOT::Experimental::Detail::RPageSinkObject::RPageSinkObject(std::string_view ntupleName, std::string_view location,
+   const RNTupleWriteOptions &options)
+   : RPageSink(ntupleName, options)
+   , fMetrics("RPageSinkObject")
+   , fPageAllocator(std::make_unique<RPageAllocatorHeap>())
+   , fStore(RObjectStore::Create(location))
+{
+   R__WARNING_HERE("NTuple") << "The RNTuple object store format will change. " <<
+      "Do not store real data with this version of RNTuple!";
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPutV", "", "number of vector write requests"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPut", "", "number of objects written"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szWritePayload", "B", "volume written to the object store")
+   });
+}
+
+
+ROOT::Experimental::Detail::RPageSinkObject::~RPageSinkObject()
+{
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkObject::CreateImpl(const RNTupleModel & /* model */)
+{
+   const auto &descriptor = fDescriptorBuilder.GetDescriptor();
+   auto szHeader = descriptor.SerializeHeader(nullptr);
+   auto buffer = std::unique_ptr<unsigned char[]>(new unsigned char[szHeader]);
+   descriptor.SerializeHeader(buffer.get());
+
+   auto zipBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[szHeader]);
+   auto szZipHeader = fCompressor(buffer.get(), szHeader, fOptions.GetCompression(),
+      [&zipBuffer](const void *b, size_t n, size_t o){ memcpy(zipBuffer.get() + o, b, n); } );
+   fStore->Put(GetHeaderKey(fNTupleName), zipBuffer.get(), szZipHeader);
+   fCounters->fNPut.Inc();
+   fCounters->fSzWritePayload.Add(szZipHeader);
+   fNBytesHeader = szZipHeader;
+   fLenHeader = szHeader;
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkObject::MakePageLocator(std::size_t nbytes)
+{
+   RClusterDescriptor::RLocator result;
+   result.fPosition = fNPages++;
+   result.fBytesOnStorage = nbytes;
+   fClusterBytes += nbytes;
+   return result;
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkObject::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
+{
+   auto element = columnHandle.fColumn->GetElement();
+   auto buffer = std::unique_ptr<unsigned char[]>(new unsigned char[GetPackedSize(page, *element)]);
+   auto sealedPage = SealPage(page, *element, fOptions.GetCompression(), buffer.get());
+
+   auto result = MakePageLocator(sealedPage.fSize);
+   fPendingPages.emplace_back(GetPageKey(fNTupleName, result.fPosition), buffer.get(), sealedPage.fSize);
+   fPendingBuffers.emplace_back(std::move(buffer));
+   return result;
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkObject::CommitSealedPageImpl(
+   DescriptorId_t /* columnId */, const RSealedPage &sealedPage)
+{
+   // The sealed page memory is owned by the caller and only valid during the call
+   auto buffer = std::unique_ptr<unsigned char[]>(new unsigned char[sealedPage.fSize]);
+   memcpy(buffer.get(), sealedPage.fBuffer, sealedPage.fSize);
+
+   auto result = MakePageLocator(sealedPage.fSize);
+   fPendingPages.emplace_back(GetPageKey(fNTupleName, result.fPosition), buffer.get(), sealedPage.fSize);
+   fPendingBuffers.emplace_back(std::move(buffer));
+   return result;
+}
+
+
+std::vector<ROOT::Experimental::RClusterDescriptor::RLocator>
+ROOT::Experimental::Detail::RPageSinkObject::CommitSealedPageVImpl(const std::vector<RSealedPageGroup> &ranges)
+{
+   std::vector<RClusterDescriptor::RLocator> locators;
+   std::vector<RObjectStore::RRequest> requests;
+   std::uint64_t szPayload = 0;
+   for (auto &range : ranges) {
+      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
+         locators.emplace_back(MakePageLocator(sealedPageIt->fSize));
+         // Put requests do not modify the buffer
+         requests.emplace_back(GetPageKey(fNTupleName, locators.back().fPosition),
+                               const_cast<void *>(sealedPageIt->fBuffer), sealedPageIt->fSize);
+         szPayload += sealedPageIt->fSize;
+      }
+   }
+   if (requests.empty())
+      return locators;
+
+   fStore->PutV(requests);
+   fCounters->fNPutV.Inc();
+   fCounters->fNPut.Add(requests.size());
+   fCounters->fSzWritePayload.Add(szPayload);
+   return locators;
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkObject::StorePendingPages()
+{
+   if (fPendingPages.empty())
+      return;
+
+   std::uint64_t szPayload = 0;
+   for (const auto &req : fPendingPages)
+      szPayload += req.fSize;
+   fStore->PutV(fPendingPages);
+   fCounters->fNPutV.Inc();
+   fCounters->fNPut.Add(fPendingPages.size());
+   fCounters->fSzWritePayload.Add(szPayload);
+   fPendingPages.clear();
+   fPendingBuffers.clear();
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkObject::CommitClusterImpl(ROOT::Experimental::NTupleSize_t /* nEntries */)
+{
+   StorePendingPages();
+
+   // The cluster locator refers to the object id of the first page of the cluster
+   RClusterDescriptor::RLocator result;
+   result.fPosition = fClusterFirstPage;
+   result.fBytesOnStorage = fClusterBytes;
+   fClusterFirstPage = fNPages;
+   fClusterBytes = 0;
+   return result;
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkObject::CommitDatasetImpl()
+{
+   StorePendingPages();
+
+   const auto &descriptor = fDescriptorBuilder.GetDescriptor();
+   auto szFooter = descriptor.SerializeFooter(nullptr);
+   auto buffer = std::unique_ptr<unsigned char []>(new unsigned char[szFooter]);
+   descriptor.SerializeFooter(buffer.get());
+
+   auto zipBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[szFooter]);
+   auto szZipFooter = fCompressor(buffer.get(), szFooter, fOptions.GetCompression(),
+      [&zipBuffer](const void *b, size_t n, size_t o){ memcpy(zipBuffer.get() + o, b, n); } );
+   fStore->Put(GetFooterKey(fNTupleName), zipBuffer.get(), szZipFooter);
+
+   RAnchor anchor;
+   anchor.fNBytesHeader = fNBytesHeader;
+   anchor.fLenHeader = fLenHeader;
+   anchor.fNBytesFooter = szZipFooter;
+   anchor.fLenFooter = szFooter;
+   unsigned char anchorBuffer[RAnchor::kSize];
+   anchor.Serialize(anchorBuffer);
+   fStore->Put(GetAnchorKey(fNTupleName), anchorBuffer, RAnchor::kSize);
+
+   fCounters->fNPut.Add(2);
+   fCounters->fSzWritePayload.Add(szZipFooter + RAnchor::kSize);
+}
+
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSinkObject::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
+{
+   if (nElements == 0)
+      nElements = kDefaultElementsPerPage;
+   auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return fPageAllocator->NewPage(columnHandle.fId, elementSize, nElements);
+}
+
+void ROOT::Experimental::Detail::RPageSinkObject::ReleasePage(RPage &page)
+{
+   fPageAllocator->DeletePage(page);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+ROOT::Experimental::Detail::RPageSourceObject::RPageSourceObject(std::string_view ntupleName,
+   const RNTupleReadOptions &options, std::shared_ptr<RPagePool> pagePool)
+   : RPageSource(ntupleName, options)
+   , fMetrics("RPageSourceObject")
+   , fPageAllocator(std::make_unique<RPageAllocatorFile>())
+   , fPagePool(std::move(pagePool))
+{
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nReadV", "", "number of vector read requests"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nRead", "", "number of objects read"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szReadPayload", "B", "volume read from the object store"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nClusterLoaded", "",
+                                                   "number of partial clusters preloaded from storage"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageLoaded", "", "number of pages loaded from storage")
+   });
+   fMetrics.ObserveMetrics(fPagePool->GetMetrics());
+
+   if (options.GetClusterCache() != RNTupleReadOptions::kOff) {
+      fClusterPool = std::make_unique<RClusterPool>(*this, options.GetClusterReadAhead(),
+                                                    options.GetClusterCacheMemory());
+   }
+}
+
+
+ROOT::Experimental::Detail::RPageSourceObject::RPageSourceObject(std::string_view ntupleName,
+   std::string_view location, const RNTupleReadOptions &options)
+   : RPageSourceObject(ntupleName, options, std::make_shared<RPagePool>(options.GetPagePoolMemory()))
+{
+   fStore = RObjectStore::Create(location);
+}
+
+
+ROOT::Experimental::Detail::RPageSourceObject::~RPageSourceObject()
+{
+}
+
+
+ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceObject::AttachImpl()
+{
+   unsigned char anchorBuffer[RAnchor::kSize];
+   if (fStore->Get(GetAnchorKey(fNTupleName), anchorBuffer, RAnchor::kSize) != RAnchor::kSize)
+      throw std::runtime_error("RPageSourceObject: invalid anchor of ntuple " + fNTupleName);
+   RAnchor anchor;
+   anchor.Deserialize(anchorBuffer);
+
+   RNTupleDescriptorBuilder descBuilder;
+   auto buffer = std::unique_ptr<unsigned char[]>(new unsigned char[anchor.fLenHeader]);
+   auto zipBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[anchor.fNBytesHeader]);
+   fStore->Get(GetHeaderKey(fNTupleName), zipBuffer.get(), anchor.fNBytesHeader);
+   fDecompressor(zipBuffer.get(), anchor.fNBytesHeader, anchor.fLenHeader, buffer.get());
+   descBuilder.SetFromHeader(buffer.get());
+
+   buffer = std::unique_ptr<unsigned char[]>(new unsigned char[anchor.fLenFooter]);
+   zipBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[anchor.fNBytesFooter]);
+   fStore->Get(GetFooterKey(fNTupleName), zipBuffer.get(), anchor.fNBytesFooter);
+   fDecompressor(zipBuffer.get(), anchor.fNBytesFooter, anchor.fLenFooter, buffer.get());
+   descBuilder.AddClustersFromFooter(buffer.get());
+
+   return descBuilder.MoveDescriptor();
+}
+
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceObject::PopulatePageFromCluster(
+   ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor, ClusterSize_t::ValueType clusterIndex)
+{
+   const auto columnId = columnHandle.fId;
+   const auto clusterId = clusterDescriptor.GetId();
+   const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
+
+   // TODO(jblomer): binary search
+   RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   decltype(clusterIndex) firstInPage = 0;
+   NTupleSize_t pageNo = 0;
+   for (const auto &pi : pageRange.fPageInfos) {
+      if (firstInPage + pi.fNElements > clusterIndex) {
+         pageInfo = pi;
+         break;
+      }
+      firstInPage += pi.fNElements;
+      ++pageNo;
+   }
+   R__ASSERT(firstInPage <= clusterIndex);
+   R__ASSERT((firstInPage + pageInfo.fNElements) > clusterIndex);
+
+   const auto element = columnHandle.fColumn->GetElement();
+   const auto elementSize = element->GetSize();
+   const auto bytesOnStorage = (element->GetBitsOnStorage() * pageInfo.fNElements + 7) / 8;
+
+   // Either points into the cluster or to the object read directly from the store
+   const unsigned char *sealedBuffer = nullptr;
+   std::unique_ptr<unsigned char[]> objectBuffer;
+   if (fClusterPool) {
+      auto cluster = fClusterPool->GetCluster(clusterId, fActiveColumns);
+      auto onDiskPage = cluster->GetOnDiskPage(ROnDiskPage::Key(columnId, pageNo));
+      R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pageInfo.fLocator.fBytesOnStorage));
+      sealedBuffer = static_cast<const unsigned char *>(onDiskPage->GetAddress());
+   } else {
+      objectBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[pageInfo.fLocator.fBytesOnStorage]);
+      auto nread = fStore->Get(GetPageKey(fNTupleName, pageInfo.fLocator.fPosition), objectBuffer.get(),
+                               pageInfo.fLocator.fBytesOnStorage);
+      R__ASSERT(nread == pageInfo.fLocator.fBytesOnStorage);
+      fCounters->fNRead.Inc();
+      fCounters->fSzReadPayload.Add(nread);
+      fCounters->fNPageLoaded.Inc();
+      sealedBuffer = objectBuffer.get();
+   }
+
+   auto pageBuffer = new unsigned char[bytesOnStorage];
+   // Decompresses or copies from the sealed page into the page buffer
+   fDecompressor(sealedBuffer, pageInfo.fLocator.fBytesOnStorage, bytesOnStorage, pageBuffer);
+   if (!element->IsMappable()) {
+      auto unpackedBuffer = new unsigned char[elementSize * pageInfo.fNElements];
+      element->Unpack(unpackedBuffer, pageBuffer, pageInfo.fNElements);
+      delete[] pageBuffer;
+      pageBuffer = unpackedBuffer;
+   }
+
+   const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+   auto newPage = fPageAllocator->NewPage(columnId, pageBuffer, elementSize, pageInfo.fNElements);
+   newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+   return fPagePool->RegisterPage(newPage, RPageDeleter([](const RPage &page, void * /*userData*/)
+   {
+      RPageAllocatorFile::DeletePage(page);
+   }, nullptr));
+}
+
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceObject::PopulatePage(
+   ColumnHandle_t columnHandle, NTupleSize_t globalIndex)
+{
+   const auto columnId = columnHandle.fId;
+   auto cachedPage = fPagePool->GetPage(columnId, globalIndex);
+   if (!cachedPage.IsNull())
+      return cachedPage;
+
+   const auto clusterId = fDescriptor.FindClusterId(columnId, globalIndex);
+   R__ASSERT(clusterId != kInvalidDescriptorId);
+   const auto &clusterDescriptor = fDescriptor.GetClusterDescriptor(clusterId);
+   const auto selfOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+   R__ASSERT(selfOffset <= globalIndex);
+   return PopulatePageFromCluster(columnHandle, clusterDescriptor, globalIndex - selfOffset);
+}
+
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceObject::PopulatePage(
+   ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex)
+{
+   const auto clusterId = clusterIndex.GetClusterId();
+   const auto index = clusterIndex.GetIndex();
+   const auto columnId = columnHandle.fId;
+   auto cachedPage = fPagePool->GetPage(columnId, clusterIndex);
+   if (!cachedPage.IsNull())
+      return cachedPage;
+
+   R__ASSERT(clusterId != kInvalidDescriptorId);
+   const auto &clusterDescriptor = fDescriptor.GetClusterDescriptor(clusterId);
+   return PopulatePageFromCluster(columnHandle, clusterDescriptor, index);
+}
+
+void ROOT::Experimental::Detail::RPageSourceObject::ReleasePage(RPage &page)
+{
+   fPagePool->ReturnPage(page);
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceObject::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   fCounters->fNClusterLoaded.Inc();
+
+   const auto &clusterDesc = GetDescriptor().GetClusterDescriptor(clusterId);
+
+   // Every page is a separate object; the objects are read back-to-back into a single cluster buffer
+   struct ROnDiskPageLocator {
+      DescriptorId_t fColumnId;
+      NTupleSize_t fPageNo;
+      std::size_t fBufPos;
+   };
+   std::vector<ROnDiskPageLocator> onDiskPages;
+   std::vector<RObjectStore::RRequest> readRequests;
+   std::size_t szBuffer = 0;
+   for (auto columnId : columns) {
+      const auto &pageRange = clusterDesc.GetPageRange(columnId);
+      NTupleSize_t pageNo = 0;
+      for (const auto &pageInfo : pageRange.fPageInfos) {
+         const auto &pageLocator = pageInfo.fLocator;
+         onDiskPages.emplace_back(ROnDiskPageLocator{columnId, pageNo, szBuffer});
+         readRequests.emplace_back(GetPageKey(fNTupleName, pageLocator.fPosition), nullptr,
+                                   pageLocator.fBytesOnStorage);
+         szBuffer += pageLocator.fBytesOnStorage;
+         ++pageNo;
+      }
+   }
+
+   auto buffer = new unsigned char[szBuffer];
+   for (unsigned int i = 0; i < readRequests.size(); ++i)
+      readRequests[i].fBuffer = buffer + onDiskPages[i].fBufPos;
+   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer));
+   if (!readRequests.empty()) {
+      fStore->GetV(readRequests);
+      for (const auto &req : readRequests)
+         R__ASSERT(req.fOutBytes == req.fSize);
+   }
+   fCounters->fNReadV.Inc();
+   fCounters->fNRead.Add(readRequests.size());
+   fCounters->fSzReadPayload.Add(szBuffer);
+   fCounters->fNPageLoaded.Add(onDiskPages.size());
+
+   for (unsigned int i = 0; i < onDiskPages.size(); ++i) {
+      ROnDiskPage page(readRequests[i].fBuffer, readRequests[i].fSize);
+      pageMap->Register(ROnDiskPage::Key(onDiskPages[i].fColumnId, onDiskPages[i].fPageNo), page);
+   }
+
+   auto cluster = std::make_unique<RCluster>(clusterId);
+   cluster->Adopt(std::move(pageMap));
+   for (auto columnId : columns)
+      cluster->SetColumnAvailable(columnId);
+   return cluster;
+}
+
+
+std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Detail::RPageSourceObject::Clone() const
+{
+   auto clone = new RPageSourceObject(fNTupleName, fOptions, fPagePool);
+   clone->fStore = fStore->Clone();
+   return std::unique_ptr<RPageSourceObject>(clone);
+}
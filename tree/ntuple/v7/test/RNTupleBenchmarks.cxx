@@ -0,0 +1,76 @@
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+
+#include <Compression.h>
+#include <TSystem.h>
+
+#include <string>
+#include <utility>
+
+#include "benchmark/benchmark.h"
+
+using RNTupleModel = ROOT::Experimental::RNTupleModel;
+using RNTupleReader = ROOT::Experimental::RNTupleReader;
+using RNTupleWriteOptions = ROOT::Experimental::RNTupleWriteOptions;
+using RNTupleWriter = ROOT::Experimental::RNTupleWriter;
+
+namespace {
+
+constexpr int kNEntries = 100000;
+
+std::string FileName(int algorithm)
+{
+   return "RNTupleBenchmarks_" + std::to_string(algorithm) + ".root";
+}
+
+// Write kNEntries floats to a file with the given compression algorithm, 0 for no compression
+void WriteNTuple(int algorithm)
+{
+   auto model = RNTupleModel::Create();
+   auto pt = model->MakeField<float>("pt");
+   RNTupleWriteOptions options;
+   options.SetCompression(algorithm ? 100 * algorithm + 4 : 0);
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", FileName(algorithm), options);
+   for (int i = 0; i < kNEntries; ++i) {
+      *pt = 0.5f * i;
+      writer->Fill();
+   }
+}
+
+void CompressionArguments(benchmark::internal::Benchmark *b)
+{
+   b->Arg(0);
+   for (auto algorithm : {ROOT::RCompressionSetting::EAlgorithm::kZLIB, ROOT::RCompressionSetting::EAlgorithm::kLZMA,
+                          ROOT::RCompressionSetting::EAlgorithm::kLZ4, ROOT::RCompressionSetting::EAlgorithm::kZSTD})
+      b->Arg(algorithm);
+}
+
+} // anonymous namespace
+
+static void BM_RNTuple_Write(benchmark::State &state)
+{
+   const int algorithm = state.range(0);
+   for (auto _ : state)
+      WriteNTuple(algorithm);
+   gSystem->Unlink(FileName(algorithm).c_str());
+   state.SetItemsProcessed(state.iterations() * kNEntries);
+}
+BENCHMARK(BM_RNTuple_Write)->Apply(CompressionArguments)->Unit(benchmark::kMillisecond);
+
+static void BM_RNTuple_ReadView(benchmark::State &state)
+{
+   const int algorithm = state.range(0);
+   WriteNTuple(algorithm);
+   for (auto _ : state) {
+      auto reader = RNTupleReader::Open("ntuple", FileName(algorithm));
+      auto viewPt = reader->GetView<float>("pt");
+      float sum = 0;
+      for (auto i : reader->GetEntryRange())
+         sum += viewPt(i);
+      benchmark::DoNotOptimize(sum);
+   }
+   gSystem->Unlink(FileName(algorithm).c_str());
+   state.SetItemsProcessed(state.iterations() * kNEntries);
+}
+BENCHMARK(BM_RNTuple_ReadView)->Apply(CompressionArguments)->Unit(benchmark::kMillisecond);
@@ -1,3 +1,4 @@
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RColumnModel.hxx>
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RNTuple.hxx>
@@ -12,16 +13,21 @@
 #include <TClass.h>
 #include <TFile.h>
 #include <TRandom3.h>
+#include <TROOT.h>
 
 #include "gtest/gtest.h"
 
 #include "CustomStruct.hxx"
 
 #include <array>
+#include <cstdint>
 #include <cstdio>
 #include <exception>
+#include <limits>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #if __cplusplus >= 201703L
 #include <variant>
@@ -34,6 +40,7 @@ using NTupleSize_t = ROOT::Experimental::NTupleSize_t;
 using RColumnModel = ROOT::Experimental::RColumnModel;
 using RNTupleDescriptor = ROOT::Experimental::RNTupleDescriptor;
 using RNTupleDescriptorBuilder = ROOT::Experimental::RNTupleDescriptorBuilder;
+using RNTupleParallelWriter = ROOT::Experimental::RNTupleParallelWriter;
 using RNTupleReader = ROOT::Experimental::RNTupleReader;
 using RNTupleReadOptions = ROOT::Experimental::RNTupleReadOptions;
 using RNTupleWriter = ROOT::Experimental::RNTupleWriter;
@@ -254,11 +261,13 @@ TEST(RNTuple, ClassVector)
    auto viewKlassVec = ntuple.GetViewCollection("klassVec");
    auto viewKlass = viewKlassVec.GetView<CustomStruct>("CustomStruct");
    auto viewKlassA = viewKlassVec.GetView<float>("CustomStruct.a");
+   auto viewSoAA = viewKlassVec.GetViewSoA<float>("a");
 
    for (auto entryId : ntuple.GetEntryRange()) {
       EXPECT_EQ(42.0, viewKlass(entryId).a);
       EXPECT_EQ(2.0, viewKlass(entryId).v1[0]);
       EXPECT_EQ(42.0, viewKlassA(entryId));
+      EXPECT_EQ(ROOT::VecOps::RVec<float>({42.0}), viewSoAA(entryId));
    }
 }
 
@@ -434,6 +443,570 @@ TEST(RNTuple, Clusters)
 }
 
 
+TEST(RNTuple, ClusterCache)
+{
+   FileRaii fileGuard("test_ntuple_cluster_cache.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrJets = model->MakeField<std::vector<float>>("jets");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 100; ++i) {
+         *wrPt = i;
+         wrJets->assign(i % 4, float(i));
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::kOff, RNTupleReadOptions::kOn}) {
+      for (unsigned int readAhead : {0, 1, 4}) {
+         RNTupleReadOptions options;
+         options.SetClusterCache(clusterCache);
+         options.SetClusterReadAhead(readAhead);
+         auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath(), options);
+         EXPECT_EQ(10U, ntuple->GetDescriptor().GetNClusters());
+         auto viewPt = ntuple->GetView<float>("pt");
+         auto viewJets = ntuple->GetView<std::vector<float>>("jets");
+         for (auto i : ntuple->GetEntryRange()) {
+            EXPECT_EQ(float(i), viewPt(i));
+            EXPECT_EQ(i % 4, viewJets(i).size());
+         }
+         // Jump backwards, which discards the read-ahead window
+         EXPECT_EQ(3.0, viewPt(3));
+         EXPECT_EQ(std::vector<float>(3, 3.0), viewJets(3));
+      }
+   }
+
+   // The cluster cache may grow beyond its memory budget only for the currently requested cluster
+   RNTupleReadOptions options;
+   options.SetClusterCacheMemory(1);
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath(), options);
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_EQ(float(i), viewPt(i));
+}
+
+
+#ifdef R__USE_IMT
+TEST(RNTuple, ClusterCacheImt)
+{
+   FileRaii fileGuard("test_ntuple_cluster_cache_imt.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<std::string>("tag");
+      auto wrFlags = model->MakeField<std::vector<bool>>("flags");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 1000; ++i) {
+         *wrPt = i;
+         *wrTag = std::to_string(i);
+         wrFlags->assign(i % 3, (i % 2) == 0);
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   // With implicit multi-threading, the pages of a cluster are decompressed in parallel into the page pool
+   ROOT::EnableImplicitMT();
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewTag = ntuple->GetView<std::string>("tag");
+   auto viewFlags = ntuple->GetView<std::vector<bool>>("flags");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(float(i), viewPt(i));
+      EXPECT_EQ(std::to_string(i), viewTag(i));
+      EXPECT_EQ(std::vector<bool>(i % 3, (i % 2) == 0), viewFlags(i));
+   }
+   EXPECT_EQ(std::string("5"), viewTag(5));
+   ROOT::DisableImplicitMT();
+}
+#endif
+
+TEST(RNTuple, BufferedWrite)
+{
+   FileRaii fileGuard("test_ntuple_buffered_write.root");
+
+   for (bool useImt : {false, true}) {
+#ifdef R__USE_IMT
+      if (useImt)
+         ROOT::EnableImplicitMT();
+#else
+      if (useImt)
+         continue;
+#endif
+      {
+         auto model = RNTupleModel::Create();
+         auto wrPt = model->MakeField<float>("pt");
+         auto wrFlags = model->MakeField<std::vector<bool>>("flags");
+         RNTupleWriteOptions options;
+         options.SetUseBufferedWrite(true);
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), options);
+         for (unsigned int i = 0; i < 50000; ++i) {
+            *wrPt = i;
+            wrFlags->assign(i % 3, (i % 2) == 0);
+            ntuple->Fill();
+            if (i % 20000 == 19999)
+               ntuple->CommitCluster();
+         }
+      }
+#ifdef R__USE_IMT
+      if (useImt)
+         ROOT::DisableImplicitMT();
+#endif
+
+      auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+      const auto &desc = ntuple->GetDescriptor();
+      EXPECT_EQ(3U, desc.GetNClusters());
+      EXPECT_EQ(50000U, ntuple->GetNEntries());
+
+      // The pages of a cluster are written back-to-back in column order
+      for (DescriptorId_t clusterId = 0; clusterId < desc.GetNClusters(); ++clusterId) {
+         const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+         std::uint64_t nextPosition = 0;
+         for (DescriptorId_t columnId = 0; columnId < desc.GetNColumns(); ++columnId) {
+            for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos) {
+               if (nextPosition > 0)
+                  EXPECT_EQ(nextPosition, pageInfo.fLocator.fPosition);
+               nextPosition = pageInfo.fLocator.fPosition + pageInfo.fLocator.fBytesOnStorage;
+            }
+         }
+      }
+
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewFlags = ntuple->GetView<std::vector<bool>>("flags");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(float(i), viewPt(i));
+         EXPECT_EQ(std::vector<bool>(i % 3, (i % 2) == 0), viewFlags(i));
+      }
+   }
+}
+
+TEST(RNTuple, SplitEncoding)
+{
+   FileRaii fileGuard("test_ntuple_split_encoding.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrE = model->MakeField<double>("E");
+      auto wrCharge = model->MakeField<std::int32_t>("charge");
+      auto wrId = model->MakeField<std::uint64_t>("id");
+      auto wrJets = model->MakeField<std::vector<float>>("jets");
+      RNTupleWriteOptions options;
+      options.SetUseSplitEncoding(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 30000; ++i) {
+         *wrPt = i / 2.0;
+         *wrE = -(i / 4.0);
+         *wrCharge = static_cast<std::int32_t>(i % 3) - 1;
+         *wrId = 0x100000000ULL + i;
+         wrJets->assign(i % 4, i);
+         ntuple->Fill();
+         if (i == 14999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   auto fnColumnType = [&desc](const std::string &fieldName) {
+      return desc.GetColumnDescriptor(desc.FindColumnId(desc.FindFieldId(fieldName), 0)).GetModel().GetType();
+   };
+   EXPECT_EQ(EColumnType::kSplitReal32, fnColumnType("pt"));
+   EXPECT_EQ(EColumnType::kSplitReal64, fnColumnType("E"));
+   EXPECT_EQ(EColumnType::kSplitInt32, fnColumnType("charge"));
+   EXPECT_EQ(EColumnType::kSplitInt64, fnColumnType("id"));
+   EXPECT_EQ(EColumnType::kSplitIndex, fnColumnType("jets"));
+
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewE = ntuple->GetView<double>("E");
+   auto viewCharge = ntuple->GetView<std::int32_t>("charge");
+   auto viewId = ntuple->GetView<std::uint64_t>("id");
+   auto viewJets = ntuple->GetView<std::vector<float>>("jets");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(i / 2.0, viewPt(i));
+      EXPECT_EQ(-(i / 4.0), viewE(i));
+      EXPECT_EQ(static_cast<std::int32_t>(i % 3) - 1, viewCharge(i));
+      EXPECT_EQ(0x100000000ULL + i, viewId(i));
+      EXPECT_EQ(std::vector<float>(i % 4, i), viewJets(i));
+   }
+}
+
+TEST(RNTuple, ReducedPrecision)
+{
+   FileRaii fileGuard("test_ntuple_reduced_precision.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = std::make_unique<ROOT::Experimental::RField<float>>("pt");
+      fieldPt->SetTruncated(20);
+      model->AddField(std::move(fieldPt));
+      auto fieldE = std::make_unique<ROOT::Experimental::RField<double>>("E");
+      fieldE->SetQuantized(0.0, 1000.0, 16);
+      model->AddField(std::move(fieldE));
+      auto wrPt = model->Get<float>("pt");
+      auto wrE = model->Get<double>("E");
+      // The buffered sink works on a clone of the model, which needs to keep the column representation
+      RNTupleWriteOptions options;
+      options.SetUseBufferedWrite(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 20000; ++i) {
+         *wrPt = i / 3.0;
+         *wrE = i / 20.0;
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   auto modelPt = desc.GetColumnDescriptor(desc.FindColumnId(desc.FindFieldId("pt"), 0)).GetModel();
+   EXPECT_EQ(EColumnType::kReal32Trunc, modelPt.GetType());
+   EXPECT_EQ(20U, modelPt.GetBitsOnStorage());
+   auto modelE = desc.GetColumnDescriptor(desc.FindColumnId(desc.FindFieldId("E"), 0)).GetModel();
+   EXPECT_EQ(EColumnType::kReal64Quant, modelE.GetType());
+   EXPECT_EQ(16U, modelE.GetBitsOnStorage());
+   EXPECT_EQ(0.0, modelE.GetMin());
+   EXPECT_EQ(1000.0, modelE.GetMax());
+
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewE = ntuple->GetView<double>("E");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_NEAR(i / 3.0, viewPt(i), (i / 3.0) / 4096.);
+      EXPECT_NEAR(i / 20.0, viewE(i), 1000.0 / 65535.);
+   }
+}
+
+TEST(RNTuple, Statistics)
+{
+   FileRaii fileGuard("test_ntuple_statistics.root");
+
+   for (bool useBufferedWrite : {false, true}) {
+      {
+         auto model = RNTupleModel::Create();
+         auto wrPt = model->MakeField<float>("pt");
+         auto wrN = model->MakeField<std::uint32_t>("n");
+         auto wrTag = model->MakeField<std::string>("tag");
+         RNTupleWriteOptions options;
+         options.SetUseStatistics(true);
+         options.SetUseBufferedWrite(useBufferedWrite);
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), options);
+         // Two clusters with 15000 entries each, i.e. with pages of 10000 and 5000 elements
+         for (unsigned int i = 0; i < 30000; ++i) {
+            *wrPt = (i < 25000) ? i : std::numeric_limits<float>::quiet_NaN();
+            *wrN = 30000 - i;
+            *wrTag = std::to_string(i);
+            ntuple->Fill();
+            if (i == 14999)
+               ntuple->CommitCluster();
+         }
+      }
+
+      auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+      const auto &desc = ntuple->GetDescriptor();
+      EXPECT_EQ(2U, desc.GetNClusters());
+      const auto columnIdPt = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+      const auto &clusterStatistics = desc.GetClusterDescriptor(1).GetColumnRange(columnIdPt).fStatistics;
+      EXPECT_TRUE(clusterStatistics.fHasRange);
+      EXPECT_EQ(15000.0, clusterStatistics.fMin);
+      EXPECT_EQ(24999.0, clusterStatistics.fMax);
+      // The last page contains only NaNs
+      const auto &pageInfos = desc.GetClusterDescriptor(1).GetPageRange(columnIdPt).fPageInfos;
+      ASSERT_EQ(2U, pageInfos.size());
+      EXPECT_TRUE(pageInfos[0].fStatistics.fHasRange);
+      EXPECT_FALSE(pageInfos[1].fStatistics.fHasRange);
+
+      auto ranges = ntuple->GetEntryRanges("pt", 12000.0, 13000.0);
+      ASSERT_EQ(1U, ranges.size());
+      EXPECT_EQ(10000U, ranges[0].GetStart());
+      EXPECT_EQ(15000U, ranges[0].GetEnd());
+      // Pages that contain only NaNs have no value range; they can only be ruled out by the cluster statistics
+      ranges = ntuple->GetEntryRanges("pt", 20000.0, 1e6);
+      ASSERT_EQ(1U, ranges.size());
+      EXPECT_EQ(15000U, ranges[0].GetStart());
+      EXPECT_EQ(30000U, ranges[0].GetEnd());
+      EXPECT_TRUE(ntuple->GetEntryRanges("pt", 1e6, 2e6).empty());
+      ranges = ntuple->GetEntryRanges("n", 0.0, 15000.0);
+      ASSERT_EQ(1U, ranges.size());
+      EXPECT_EQ(15000U, ranges[0].GetStart());
+      EXPECT_EQ(30000U, ranges[0].GetEnd());
+      EXPECT_TRUE(ntuple->GetEntryRanges("n", 40000.0, 50000.0).empty());
+      ranges = ntuple->GetEntryRanges("tag", 0.0, 1.0);
+      ASSERT_EQ(1U, ranges.size());
+      EXPECT_EQ(0U, ranges[0].GetStart());
+      EXPECT_EQ(30000U, ranges[0].GetEnd());
+   }
+}
+
+TEST(RNTuple, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_mmap.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<std::string>("tag");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 50000; ++i) {
+         *wrPt = i;
+         *wrTag = std::to_string(i % 7);
+         ntuple->Fill();
+         if (i % 20000 == 19999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (bool useImt : {false, true}) {
+#ifdef R__USE_IMT
+      if (useImt)
+         ROOT::EnableImplicitMT();
+#else
+      if (useImt)
+         continue;
+#endif
+      RNTupleReadOptions options;
+      options.SetUseMmap(true);
+      auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      // Mappings start at a memory page boundary, so pages are used in place if their file offset is aligned
+      const auto &desc = ntuple->GetDescriptor();
+      unsigned long nAlignedPages = 0;
+      for (DescriptorId_t columnId = 0; columnId < desc.GetNColumns(); ++columnId) {
+         const auto elementSize =
+            ROOT::Experimental::Detail::RColumnElementBase::Generate(desc.GetColumnDescriptor(columnId).GetModel())
+               ->GetSize();
+         for (DescriptorId_t clusterId = 0; clusterId < desc.GetNClusters(); ++clusterId) {
+            for (const auto &pageInfo : desc.GetClusterDescriptor(clusterId).GetPageRange(columnId).fPageInfos) {
+               if (pageInfo.fLocator.fPosition % elementSize == 0)
+                  nAlignedPages++;
+            }
+         }
+      }
+
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewTag = ntuple->GetView<std::string>("tag");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(float(i), viewPt(i));
+         EXPECT_EQ(std::to_string(i % 7), viewTag(i));
+      }
+
+      std::ostringstream osMetrics;
+      ntuple->PrintInfo(ROOT::Experimental::ENTupleInfo::kMetrics, osMetrics);
+      std::istringstream isMetrics(osMetrics.str());
+      std::string line;
+      std::string nPageMapped;
+      while (std::getline(isMetrics, line)) {
+         if (line.find("RPageSourceFile.nPageMapped|") != std::string::npos)
+            nPageMapped = line.substr(line.rfind('|') + 1);
+      }
+      EXPECT_LT(0U, nAlignedPages);
+      EXPECT_EQ(nAlignedPages, std::stoul(nPageMapped));
+#ifdef R__USE_IMT
+      if (useImt)
+         ROOT::DisableImplicitMT();
+#endif
+   }
+}
+
+TEST(RNTuple, SharedPagePool)
+{
+   FileRaii fileGuard("test_ntuple_shared_page_pool.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<std::string>("tag");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 50000; ++i) {
+         *wrPt = i;
+         *wrTag = std::to_string(i % 7);
+         ntuple->Fill();
+         if (i % 20000 == 19999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetClusterCache(RNTupleReadOptions::kOff);
+   options.SetPagePoolMemory(64 * 1024 * 1024);
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath(), options);
+   {
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewTag = ntuple->GetView<std::string>("tag");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(float(i), viewPt(i));
+         EXPECT_EQ(std::to_string(i % 7), viewTag(i));
+      }
+   }
+
+   // The clone finds all the pages decompressed by the original reader in the shared page pool,
+   // which stays alive with the clone
+   auto clone = ntuple->Clone();
+   ntuple.reset();
+   clone->EnableMetrics();
+   {
+      auto viewPt = clone->GetView<float>("pt");
+      auto viewTag = clone->GetView<std::string>("tag");
+      for (auto i : clone->GetEntryRange()) {
+         EXPECT_EQ(float(i), viewPt(i));
+         EXPECT_EQ(std::to_string(i % 7), viewTag(i));
+      }
+   }
+
+   std::ostringstream osMetrics;
+   clone->PrintInfo(ROOT::Experimental::ENTupleInfo::kMetrics, osMetrics);
+   std::istringstream isMetrics(osMetrics.str());
+   std::string line;
+   std::string nPageLoaded;
+   std::string nHit;
+   std::string nMiss;
+   while (std::getline(isMetrics, line)) {
+      if (line.find("RPageSourceFile.nPageLoaded|") != std::string::npos)
+         nPageLoaded = line.substr(line.rfind('|') + 1);
+      if (line.find("RPagePool.nHit|") != std::string::npos)
+         nHit = line.substr(line.rfind('|') + 1);
+      if (line.find("RPagePool.nMiss|") != std::string::npos)
+         nMiss = line.substr(line.rfind('|') + 1);
+   }
+   EXPECT_EQ(0U, std::stoul(nPageLoaded));
+   EXPECT_EQ(0U, std::stoul(nMiss));
+   EXPECT_LT(0U, std::stoul(nHit));
+}
+
+TEST(RNTuple, Timing)
+{
+   FileRaii fileGuard("test_ntuple_timing.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 1000; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   // Returns the number of calls of the given column and phase from the timing table
+   auto fnGetNCalls = [](RNTupleReader &reader, const std::string &column, const std::string &phase) {
+      std::ostringstream osTiming;
+      reader.PrintInfo(ROOT::Experimental::ENTupleInfo::kTiming, osTiming);
+      std::istringstream isTiming(osTiming.str());
+      std::string line;
+      while (std::getline(isTiming, line)) {
+         std::istringstream isLine(line);
+         std::string name;
+         std::string phaseName;
+         std::uint64_t nCalls = 0;
+         isLine >> name >> phaseName >> nCalls;
+         if ((name == column) && (phaseName == phase))
+            return nCalls;
+      }
+      return std::uint64_t(0);
+   };
+
+   RNTupleReadOptions options;
+   options.SetClusterCache(RNTupleReadOptions::kOff);
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath(), options);
+   auto clone = ntuple->Clone();
+   {
+      auto viewPt = ntuple->GetView<float>("pt");
+      for (auto i : ntuple->GetEntryRange())
+         EXPECT_EQ(float(i), viewPt(i));
+   }
+   // Metrics are disabled by default
+   EXPECT_EQ(0U, fnGetNCalls(*ntuple, "pt#0", "populate"));
+
+   ntuple->EnableMetrics();
+   {
+      auto viewPt = ntuple->GetView<float>("pt");
+      for (auto i : ntuple->GetEntryRange())
+         EXPECT_EQ(float(i), viewPt(i));
+   }
+   const auto nPopulate = fnGetNCalls(*ntuple, "pt#0", "populate");
+   EXPECT_LE(10U, nPopulate);
+   EXPECT_LE(nPopulate, fnGetNCalls(*ntuple, "*", "read"));
+   EXPECT_LT(0U, fnGetNCalls(*ntuple, "pt#0", "unzip"));
+
+   // The clone shares the timing collector, so it adds to the same counters
+   clone->EnableMetrics();
+   {
+      auto viewPt = clone->GetView<float>("pt");
+      for (auto i : clone->GetEntryRange())
+         EXPECT_EQ(float(i), viewPt(i));
+   }
+   EXPECT_EQ(2 * nPopulate, fnGetNCalls(*ntuple, "pt#0", "populate"));
+
+   ntuple->DisableMetrics();
+   clone->DisableMetrics();
+   {
+      auto viewPt = clone->GetView<float>("pt");
+      for (auto i : clone->GetEntryRange())
+         EXPECT_EQ(float(i), viewPt(i));
+   }
+   // Disabled counters read as zero but keep their values
+   EXPECT_EQ(0U, fnGetNCalls(*ntuple, "pt#0", "populate"));
+   ntuple->EnableMetrics();
+   EXPECT_EQ(2 * nPopulate, fnGetNCalls(*ntuple, "pt#0", "populate"));
+}
+
+TEST(RNTuple, ParallelWriter)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer.root");
+
+   constexpr unsigned int kNThreads = 4;
+   constexpr unsigned int kNEntriesPerThread = 10000;
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      model->MakeField<std::vector<bool>>("flags");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+
+      std::vector<std::thread> threads;
+      for (unsigned int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t]() {
+            auto fillContext = writer->CreateFillContext();
+            auto wrPt = fillContext->GetModel()->Get<float>("pt");
+            auto wrFlags = fillContext->GetModel()->Get<std::vector<bool>>("flags");
+            for (unsigned int i = 0; i < kNEntriesPerThread; ++i) {
+               const auto value = t * kNEntriesPerThread + i;
+               *wrPt = value;
+               wrFlags->assign(value % 3, (value % 2) == 0);
+               fillContext->Fill();
+               if (i % 2500 == 2499)
+                  fillContext->CommitCluster();
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+      EXPECT_EQ(kNThreads * kNEntriesPerThread, writer->GetNEntries());
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   EXPECT_EQ(kNThreads * 4, ntuple->GetDescriptor().GetNClusters());
+   ASSERT_EQ(kNThreads * kNEntriesPerThread, ntuple->GetNEntries());
+
+   // The order of the clusters is not deterministic but every entry must be present once and intact
+   std::vector<bool> seen(kNThreads * kNEntriesPerThread, false);
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewFlags = ntuple->GetView<std::vector<bool>>("flags");
+   for (auto i : ntuple->GetEntryRange()) {
+      const auto value = static_cast<unsigned int>(viewPt(i));
+      ASSERT_LT(value, seen.size());
+      EXPECT_FALSE(seen[value]);
+      seen[value] = true;
+      EXPECT_EQ(std::vector<bool>(value % 3, (value % 2) == 0), viewFlags(i));
+   }
+}
+
 #if __cplusplus >= 201703L
 TEST(RNTuple, Variant)
 {
@@ -525,6 +1098,99 @@ TEST(RNTuple, View)
    EXPECT_EQ(3, n);
 }
 
+TEST(RNTuple, BulkView)
+{
+   FileRaii fileGuard("test_ntuple_bulk_view.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   {
+      RNTupleWriter ntuple(std::move(model),
+         std::make_unique<RPageSinkFile>("myNTuple", fileGuard.GetPath(), RNTupleWriteOptions()));
+      for (unsigned int i = 0; i < 25000; ++i) {
+         *fieldPt = i;
+         ntuple.Fill();
+         if (i == 14999)
+            ntuple.CommitCluster();
+      }
+   }
+
+   RNTupleReader ntuple(std::make_unique<RPageSourceFile>("myNTuple", fileGuard.GetPath(), RNTupleReadOptions()));
+   auto viewPt = ntuple.GetView<float>("pt");
+   const auto nEntries = ntuple.GetNEntries();
+   EXPECT_EQ(25000U, nEntries);
+
+   // Spans end at page boundaries: pages have 10000 elements and do not cross the cluster boundary at 15000
+   std::vector<std::size_t> spanSizes;
+   for (NTupleSize_t i = 0; i < nEntries; ) {
+      auto span = viewPt.MapV(i, nEntries - i);
+      ASSERT_GT(span.size(), 0U);
+      for (std::size_t j = 0; j < span.size(); ++j)
+         EXPECT_EQ(float(i + j), span[j]);
+      spanSizes.emplace_back(span.size());
+      i += span.size();
+   }
+   EXPECT_EQ(std::vector<std::size_t>({10000, 5000, 10000}), spanSizes);
+
+   auto spanMid = viewPt.MapV(12000, 100);
+   EXPECT_EQ(100U, spanMid.size());
+   EXPECT_EQ(12000.0, spanMid[0]);
+   auto spanTail = viewPt.MapV(ROOT::Experimental::RClusterIndex(1, 9990), 100);
+   EXPECT_EQ(10U, spanTail.size());
+   EXPECT_EQ(24990.0, spanTail[0]);
+}
+
+TEST(RNTuple, SoAView)
+{
+   FileRaii fileGuard("test_ntuple_soa_view.root");
+
+   auto hitModel = RNTupleModel::Create();
+   auto fldHitX = hitModel->MakeField<float>("x", 0.0);
+   auto fldHitY = hitModel->MakeField<float>("y", 0.0);
+   auto eventModel = RNTupleModel::Create();
+   auto fldHits = eventModel->MakeCollection("hits", std::move(hitModel));
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(eventModel), "myNTuple", fileGuard.GetPath());
+      unsigned int nHits = 0;
+      for (unsigned int i = 0; i < 10000; ++i) {
+         for (unsigned int h = 0; h < i % 7; ++h) {
+            *fldHitX = nHits;
+            *fldHitY = -float(nHits);
+            fldHits->Fill();
+            nHits++;
+         }
+         ntuple->Fill();
+         if (i == 4999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewHits = ntuple->GetViewCollection("hits");
+   auto viewX = viewHits.GetViewSoA<float>("x");
+   auto viewY = viewHits.GetViewSoA<float>("y");
+   auto viewBulkX = viewHits.GetView<float>("x");
+   unsigned int nHits = 0;
+   unsigned int nCopied = 0;
+   for (auto i : ntuple->GetEntryRange()) {
+      const auto &x = viewX(i);
+      const auto &y = viewY(i);
+      ASSERT_EQ(i % 7, x.size());
+      ASSERT_EQ(i % 7, y.size());
+      // Collections that span a page boundary of the member column are the only ones not pointing into a page
+      if (!x.empty() && (viewBulkX.MapV(NTupleSize_t(nHits), x.size()).size() < x.size()))
+         nCopied++;
+      for (std::size_t h = 0; h < x.size(); ++h) {
+         EXPECT_EQ(float(nHits), x[h]);
+         EXPECT_EQ(-float(nHits), y[h]);
+         nHits++;
+      }
+      EXPECT_EQ(ROOT::VecOps::Sum(x), -ROOT::VecOps::Sum(y));
+   }
+   EXPECT_EQ(29994U, nHits);
+   EXPECT_LT(0U, nCopied);
+}
+
 TEST(RNTuple, Capture) {
    auto model = RNTupleModel::Create();
    float pt;
@@ -718,6 +1384,116 @@ TEST(RNTuple, RDF)
 }
 
 
+TEST(RNTuple, RDFRangePredicate)
+{
+   FileRaii fileGuard("test_ntuple_rdf_range_predicate.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetUseStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 50000; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+      }
+   }
+
+   auto ds = std::make_unique<ROOT::Experimental::RNTupleDS>(RNTupleReader::Open("myNTuple", fileGuard.GetPath()));
+   ds->AddRangePredicate("pt", 10000.0, 25000.0);
+   ROOT::RDataFrame rdf(std::move(ds));
+   // Only the pages of entries 10000 to 29999 are processed
+   EXPECT_EQ(20000U, *rdf.Count());
+   EXPECT_EQ(15001U, *rdf.Filter("pt >= 10000 && pt <= 25000").Count());
+}
+
+
+TEST(RNTuple, RDFClusterRanges)
+{
+   FileRaii fileGuard("test_ntuple_rdf_cluster_ranges.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetUseStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 5000; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         if (i % 1000 == 999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   ROOT::Experimental::RNTupleDS ds(RNTupleReader::Open("myNTuple", fileGuard.GetPath()));
+   ds.SetNSlots(2);
+   ds.Initialise();
+   auto ranges = ds.GetEntryRanges();
+   ASSERT_EQ(5U, ranges.size());
+   for (unsigned int i = 0; i < 5; ++i) {
+      EXPECT_EQ(i * 1000U, ranges[i].first);
+      EXPECT_EQ((i + 1) * 1000U, ranges[i].second);
+   }
+   EXPECT_TRUE(ds.GetEntryRanges().empty());
+
+   ds.AddRangePredicate("pt", 1500.0, 2500.0);
+   ds.Initialise();
+   ranges = ds.GetEntryRanges();
+   ASSERT_EQ(2U, ranges.size());
+   EXPECT_EQ(1000U, ranges[0].first);
+   EXPECT_EQ(2000U, ranges[0].second);
+   EXPECT_EQ(2000U, ranges[1].first);
+   EXPECT_EQ(3000U, ranges[1].second);
+
+   ROOT::EnableImplicitMT(4);
+   auto rdf = ROOT::Experimental::MakeNTupleDataFrame("myNTuple", fileGuard.GetPath());
+   EXPECT_EQ(5000U, *rdf.Count());
+   EXPECT_DOUBLE_EQ(4999.0 * 5000.0 / 2.0, *rdf.Sum<float>("pt"));
+   ROOT::DisableImplicitMT();
+}
+
+
+TEST(RNTuple, RDFSnapshot)
+{
+   FileRaii fileGuard("test_ntuple_rdf_snapshot.root");
+
+   ROOT::RDF::RSnapshotOptions options;
+   options.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   for (unsigned int nThreads : {0, 4}) {
+      if (nThreads > 0)
+         ROOT::EnableImplicitMT(nThreads);
+      ROOT::RDataFrame df(10000);
+      auto snapshot = df.Define("pt", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+                         .Define("jets", [](ULong64_t e) { return ROOT::VecOps::RVec<float>(e % 3, e); }, {"rdfentry_"})
+                         .Define("tag", [](ULong64_t e) { return std::to_string(e); }, {"rdfentry_"})
+                         .Snapshot<float, ROOT::VecOps::RVec<float>, std::string>(
+                            "myNTuple", fileGuard.GetPath(), {"pt", "jets", "tag"}, options);
+      EXPECT_EQ(10000U, *snapshot->Count());
+      EXPECT_DOUBLE_EQ(9999.0 * 10000.0 / 2.0, *snapshot->Sum<float>("pt"));
+      if (nThreads > 0)
+         ROOT::DisableImplicitMT();
+
+      auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+      EXPECT_EQ(10000U, ntuple->GetNEntries());
+      // The order of the entries is not deterministic in multi-threaded event loops
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewJets = ntuple->GetView<std::vector<float>>("jets");
+      auto viewTag = ntuple->GetView<std::string>("tag");
+      for (auto i : ntuple->GetEntryRange()) {
+         const auto pt = viewPt(i);
+         EXPECT_EQ(std::vector<float>(static_cast<std::size_t>(pt) % 3, pt), viewJets(i));
+         EXPECT_EQ(std::to_string(static_cast<std::size_t>(pt)), viewTag(i));
+      }
+   }
+
+   options.fMode = "UPDATE";
+   ROOT::RDataFrame df(1);
+   EXPECT_THROW(df.Define("x", []() { return 1.0f; }).Snapshot<float>("myNTuple", fileGuard.GetPath(), {"x"}, options),
+                std::invalid_argument);
+}
+
 TEST(RNTuple, Descriptor)
 {
    RNTupleDescriptorBuilder descBuilder;
@@ -0,0 +1,238 @@
+#include "gtest/gtest.h"
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RClusterPool.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using ClusterSize_t = ROOT::Experimental::ClusterSize_t;
+using DescriptorId_t = ROOT::Experimental::DescriptorId_t;
+using NTupleSize_t = ROOT::Experimental::NTupleSize_t;
+using RClusterDescriptor = ROOT::Experimental::RClusterDescriptor;
+using RClusterIndex = ROOT::Experimental::RClusterIndex;
+using RNTupleDescriptor = ROOT::Experimental::RNTupleDescriptor;
+using RNTupleDescriptorBuilder = ROOT::Experimental::RNTupleDescriptorBuilder;
+using RNTupleReadOptions = ROOT::Experimental::RNTupleReadOptions;
+using RNTupleVersion = ROOT::Experimental::RNTupleVersion;
+using RCluster = ROOT::Experimental::Detail::RCluster;
+using RClusterPool = ROOT::Experimental::Detail::RClusterPool;
+using RNTupleMetrics = ROOT::Experimental::Detail::RNTupleMetrics;
+using ROnDiskPage = ROOT::Experimental::Detail::ROnDiskPage;
+using ROnDiskPageMapHeap = ROOT::Experimental::Detail::ROnDiskPageMapHeap;
+using RPage = ROOT::Experimental::Detail::RPage;
+using RPageSource = ROOT::Experimental::Detail::RPageSource;
+
+namespace {
+
+/**
+ * Used to track LoadCluster calls triggered by ClusterPool::GetCluster. The descriptor describes kNClusters
+ * clusters with one entry each and two columns; every column has a single page of kPageSize bytes per cluster.
+ */
+class RPageSourceMock : public RPageSource {
+protected:
+   RNTupleDescriptor AttachImpl() final { return RNTupleDescriptor(); }
+
+public:
+   static constexpr unsigned int kNClusters = 5;
+   static constexpr std::uint32_t kPageSize = 100;
+
+   /// Records the cluster ids requested by LoadCluster() calls
+   std::vector<DescriptorId_t> fReqsClusterIds;
+   /// Records the columns requested by LoadCluster() calls
+   std::vector<ColumnSet_t> fReqsColumns;
+   /// LoadCluster() is called from the cluster pool's I/O thread
+   std::mutex fLock;
+   RNTupleMetrics fMetrics;
+
+   RPageSourceMock() : RPageSource("test", RNTupleReadOptions()), fMetrics("test")
+   {
+      RNTupleDescriptorBuilder descBuilder;
+      for (unsigned int i = 0; i < kNClusters; ++i) {
+         descBuilder.AddCluster(i, RNTupleVersion(), i, ClusterSize_t(1));
+         for (DescriptorId_t columnId = 0; columnId < 2; ++columnId) {
+            RClusterDescriptor::RColumnRange columnRange;
+            columnRange.fColumnId = columnId;
+            columnRange.fFirstElementIndex = i;
+            columnRange.fNElements = 1;
+            descBuilder.AddClusterColumnRange(i, columnRange);
+            RClusterDescriptor::RPageRange pageRange;
+            pageRange.fColumnId = columnId;
+            RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+            pageInfo.fNElements = 1;
+            pageInfo.fLocator.fPosition = (2 * i + columnId) * kPageSize;
+            pageInfo.fLocator.fBytesOnStorage = kPageSize;
+            pageRange.fPageInfos.emplace_back(pageInfo);
+            descBuilder.AddClusterPageRange(i, std::move(pageRange));
+         }
+      }
+      fDescriptor = descBuilder.MoveDescriptor();
+   }
+   std::unique_ptr<RPageSource> Clone() const final { return nullptr; }
+   RPage PopulatePage(ColumnHandle_t, NTupleSize_t) final { return RPage(); }
+   RPage PopulatePage(ColumnHandle_t, const RClusterIndex &) final { return RPage(); }
+   void ReleasePage(RPage &) final {}
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+
+   std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final
+   {
+      {
+         std::lock_guard<std::mutex> guard(fLock);
+         fReqsClusterIds.emplace_back(clusterId);
+         fReqsColumns.emplace_back(columns);
+      }
+      auto memory = std::unique_ptr<unsigned char[]>(new unsigned char[columns.size() * kPageSize]);
+      auto buffer = memory.get();
+      auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::move(memory));
+      unsigned int i = 0;
+      for (auto columnId : columns) {
+         memset(buffer + i * kPageSize, static_cast<unsigned char>(columnId), kPageSize);
+         pageMap->Register(ROnDiskPage::Key(columnId, 0), ROnDiskPage(buffer + i * kPageSize, kPageSize));
+         ++i;
+      }
+      auto cluster = std::make_unique<RCluster>(clusterId);
+      cluster->Adopt(std::move(pageMap));
+      for (auto columnId : columns)
+         cluster->SetColumnAvailable(columnId);
+      return cluster;
+   }
+};
+
+constexpr unsigned int RPageSourceMock::kNClusters;
+constexpr std::uint32_t RPageSourceMock::kPageSize;
+
+} // anonymous namespace
+
+
+TEST(Cluster, Allocate)
+{
+   auto cluster = std::make_unique<RCluster>(0);
+   EXPECT_EQ(0U, cluster->GetNOnDiskPages());
+   EXPECT_EQ(0U, cluster->GetMemSize());
+
+   auto memory = std::unique_ptr<unsigned char[]>(new unsigned char[3]);
+   auto buffer = memory.get();
+   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::move(memory));
+   pageMap->Register(ROnDiskPage::Key(5, 0), ROnDiskPage(buffer, 1));
+   pageMap->Register(ROnDiskPage::Key(5, 1), ROnDiskPage(buffer + 1, 2));
+   cluster->Adopt(std::move(pageMap));
+   cluster->SetColumnAvailable(5);
+   EXPECT_EQ(2U, cluster->GetNOnDiskPages());
+   EXPECT_EQ(3U, cluster->GetMemSize());
+   EXPECT_TRUE(cluster->ContainsColumn(5));
+   EXPECT_FALSE(cluster->ContainsColumn(4));
+   EXPECT_EQ(nullptr, cluster->GetOnDiskPage(ROnDiskPage::Key(5, 2)));
+   auto onDiskPage = cluster->GetOnDiskPage(ROnDiskPage::Key(5, 1));
+   ASSERT_NE(nullptr, onDiskPage);
+   EXPECT_EQ(buffer + 1, onDiskPage->GetAddress());
+   EXPECT_EQ(2U, onDiskPage->GetSize());
+}
+
+
+TEST(Cluster, Adopt)
+{
+   auto cluster = std::make_unique<RCluster>(0);
+   auto memory = std::unique_ptr<unsigned char[]>(new unsigned char[4]);
+   auto buffer = memory.get();
+   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::move(memory));
+   pageMap->Register(ROnDiskPage::Key(0, 0), ROnDiskPage(buffer, 4));
+   cluster->Adopt(std::move(pageMap));
+   cluster->SetColumnAvailable(0);
+
+   RCluster other(0);
+   memory = std::unique_ptr<unsigned char[]>(new unsigned char[8]);
+   buffer = memory.get();
+   pageMap = std::make_unique<ROnDiskPageMapHeap>(std::move(memory));
+   // The page (0, 0) is already present in cluster and is thus ignored
+   pageMap->Register(ROnDiskPage::Key(0, 0), ROnDiskPage(buffer, 4));
+   pageMap->Register(ROnDiskPage::Key(1, 0), ROnDiskPage(buffer + 4, 4));
+   other.Adopt(std::move(pageMap));
+   other.SetColumnAvailable(0);
+   other.SetColumnAvailable(1);
+
+   cluster->Adopt(std::move(other));
+   EXPECT_EQ(0U, other.GetNOnDiskPages());
+   EXPECT_EQ(2U, cluster->GetNOnDiskPages());
+   EXPECT_EQ(8U, cluster->GetMemSize());
+   EXPECT_TRUE(cluster->ContainsColumn(0));
+   EXPECT_TRUE(cluster->ContainsColumn(1));
+   EXPECT_NE(buffer, cluster->GetOnDiskPage(ROnDiskPage::Key(0, 0))->GetAddress());
+   EXPECT_EQ(buffer + 4, cluster->GetOnDiskPage(ROnDiskPage::Key(1, 0))->GetAddress());
+}
+
+
+TEST(ClusterPool, Windows)
+{
+   RPageSourceMock p1;
+   EXPECT_EQ(1U, p1.GetDescriptor().FindNextClusterId(0));
+   EXPECT_EQ(ROOT::Experimental::kInvalidDescriptorId, p1.GetDescriptor().FindPrevClusterId(0));
+   EXPECT_EQ(3U, p1.GetDescriptor().FindPrevClusterId(4));
+   EXPECT_EQ(ROOT::Experimental::kInvalidDescriptorId, p1.GetDescriptor().FindNextClusterId(4));
+
+   {
+      RClusterPool c1(p1, 1, 0);
+      auto cluster = c1.GetCluster(3, {0});
+      ASSERT_NE(nullptr, cluster);
+      EXPECT_EQ(3U, cluster->GetId());
+      EXPECT_EQ(1U, cluster->GetNOnDiskPages());
+      auto onDiskPage = cluster->GetOnDiskPage(ROnDiskPage::Key(0, 0));
+      ASSERT_NE(nullptr, onDiskPage);
+      EXPECT_EQ(RPageSourceMock::kPageSize, onDiskPage->GetSize());
+
+      // Cluster 4 is either in the pool or in flight, it must not be requested a second time
+      cluster = c1.GetCluster(4, {0});
+      ASSERT_NE(nullptr, cluster);
+      EXPECT_EQ(4U, cluster->GetId());
+      // Cluster 3 is kept as the cluster before the current one
+      EXPECT_EQ(2U, c1.GetNClustersInPool());
+   }
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(3U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(4U, p1.fReqsClusterIds[1]);
+   EXPECT_EQ(RCluster::ColumnSet_t({0}), p1.fReqsColumns[0]);
+   EXPECT_EQ(RCluster::ColumnSet_t({0}), p1.fReqsColumns[1]);
+}
+
+
+TEST(ClusterPool, MissingColumns)
+{
+   RPageSourceMock p1;
+   {
+      RClusterPool c1(p1, 0, 0);
+      c1.GetCluster(0, {0});
+      auto cluster = c1.GetCluster(0, {0, 1});
+      ASSERT_NE(nullptr, cluster);
+      EXPECT_EQ(2U, cluster->GetNOnDiskPages());
+      EXPECT_TRUE(cluster->ContainsColumn(0));
+      EXPECT_TRUE(cluster->ContainsColumn(1));
+      EXPECT_EQ(1U, c1.GetNClustersInPool());
+   }
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(0U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(0U, p1.fReqsClusterIds[1]);
+   EXPECT_EQ(RCluster::ColumnSet_t({0}), p1.fReqsColumns[0]);
+   EXPECT_EQ(RCluster::ColumnSet_t({1}), p1.fReqsColumns[1]);
+}
+
+
+TEST(ClusterPool, MemoryBudget)
+{
+   RPageSourceMock p1;
+   {
+      // The budget is sufficient for one cluster, so there is no read-ahead
+      RClusterPool c1(p1, 2, RPageSourceMock::kPageSize + RPageSourceMock::kPageSize / 2);
+      c1.GetCluster(0, {0});
+      c1.GetCluster(1, {0});
+      EXPECT_EQ(2U, c1.GetNClustersInPool());
+   }
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(0U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(1U, p1.fReqsClusterIds[1]);
+}
@@ -0,0 +1,134 @@
+#include "gtest/gtest.h"
+
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using RNTupleMerger = ROOT::Experimental::RNTupleMerger;
+using RNTupleModel = ROOT::Experimental::RNTupleModel;
+using RNTupleReader = ROOT::Experimental::RNTupleReader;
+using RNTupleWriter = ROOT::Experimental::RNTupleWriter;
+using RNTupleWriteOptions = ROOT::Experimental::RNTupleWriteOptions;
+
+namespace {
+
+/**
+ * An RAII wrapper around an open temporary file on disk. It cleans up the guarded file when the wrapper object
+ * goes out of scope.
+ */
+class FileRaii {
+private:
+   std::string fPath;
+public:
+   explicit FileRaii(const std::string &path) : fPath(path) { }
+   FileRaii(const FileRaii&) = delete;
+   FileRaii& operator=(const FileRaii&) = delete;
+   ~FileRaii() { std::remove(fPath.c_str()); }
+   std::string GetPath() const { return fPath; }
+};
+
+/// Writes nEntries entries starting with firstValue in clusters of 1000 entries
+void WriteInput(const std::string &path, unsigned int firstValue, unsigned int nEntries,
+                const RNTupleWriteOptions &options = RNTupleWriteOptions())
+{
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrJets = model->MakeField<std::vector<float>>("jets");
+   auto wrTag = model->MakeField<std::string>("tag");
+   auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", path, options);
+   for (unsigned int i = firstValue; i < firstValue + nEntries; ++i) {
+      *wrPt = i;
+      *wrJets = std::vector<float>(i % 3, i);
+      *wrTag = std::to_string(i);
+      ntuple->Fill();
+      if (i % 1000 == 999)
+         ntuple->CommitCluster();
+   }
+}
+
+void CheckMerged(const std::string &path, unsigned int nEntries)
+{
+   auto ntuple = RNTupleReader::Open("ntpl", path);
+   EXPECT_EQ(nEntries, ntuple->GetNEntries());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewJets = ntuple->GetView<std::vector<float>>("jets");
+   auto viewTag = ntuple->GetView<std::string>("tag");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(float(i), viewPt(i));
+      EXPECT_EQ(std::vector<float>(i % 3, i), viewJets(i));
+      EXPECT_EQ(std::to_string(i), viewTag(i));
+   }
+}
+
+} // anonymous namespace
+
+
+TEST(RNTupleMerger, FastMerge)
+{
+   FileRaii fileGuard1("test_ntuple_merger_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_in2.root");
+   FileRaii fileGuardOut("test_ntuple_merger_out.root");
+   WriteInput(fileGuard1.GetPath(), 0, 2500);
+   WriteInput(fileGuard2.GetPath(), 2500, 1500);
+
+   RNTupleMerger merger;
+   merger.Merge("ntpl", {fileGuard1.GetPath(), fileGuard2.GetPath()}, fileGuardOut.GetPath());
+   EXPECT_LT(0U, merger.GetNPagesCopied());
+   EXPECT_EQ(0U, merger.GetNPagesResealed());
+
+   CheckMerged(fileGuardOut.GetPath(), 4000);
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuardOut.GetPath());
+   // The clusters of the inputs are taken over as they are
+   EXPECT_EQ(5U, ntuple->GetDescriptor().GetNClusters());
+}
+
+
+TEST(RNTupleMerger, Reseal)
+{
+   FileRaii fileGuard1("test_ntuple_merger_reseal_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_reseal_in2.root");
+   FileRaii fileGuardOut("test_ntuple_merger_reseal_out.root");
+   RNTupleWriteOptions options;
+   options.SetUseSplitEncoding(true);
+   WriteInput(fileGuard1.GetPath(), 0, 2000, options);
+   WriteInput(fileGuard2.GetPath(), 2000, 1000);
+
+   // The pages of the first input are converted to the non-split encoding, the pages of both inputs are recompressed
+   RNTupleWriteOptions outputOptions;
+   outputOptions.SetCompression(0);
+   RNTupleMerger merger;
+   merger.Merge("ntpl", {fileGuard1.GetPath(), fileGuard2.GetPath()}, fileGuardOut.GetPath(), outputOptions);
+   EXPECT_EQ(0U, merger.GetNPagesCopied());
+   EXPECT_LT(0U, merger.GetNPagesResealed());
+
+   CheckMerged(fileGuardOut.GetPath(), 3000);
+}
+
+
+TEST(RNTupleMerger, SchemaMismatch)
+{
+   FileRaii fileGuard1("test_ntuple_merger_mismatch_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_mismatch_in2.root");
+   FileRaii fileGuardOut("test_ntuple_merger_mismatch_out.root");
+   WriteInput(fileGuard1.GetPath(), 0, 100);
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<double>("pt");
+      auto wrJets = model->MakeField<std::vector<float>>("jets");
+      auto wrTag = model->MakeField<std::string>("tag");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard2.GetPath());
+      ntuple->Fill();
+   }
+
+   RNTupleMerger merger;
+   EXPECT_THROW(merger.Merge("ntpl", {fileGuard1.GetPath(), fileGuard2.GetPath()}, fileGuardOut.GetPath()),
+                std::runtime_error);
+}
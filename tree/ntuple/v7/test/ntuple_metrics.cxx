@@ -3,6 +3,7 @@
 #include <ROOT/RNTupleMetrics.hxx>
 
 #include <chrono>
+#include <sstream>
 #include <thread>
 
 using RNTuplePlainCounter = ROOT::Experimental::Detail::RNTuplePlainCounter;
@@ -10,6 +11,7 @@ using RNTupleAtomicCounter = ROOT::Experimental::Detail::RNTupleAtomicCounter;
 using RNTuplePlainTimer = ROOT::Experimental::Detail::RNTuplePlainTimer;
 using RNTupleAtomicTimer = ROOT::Experimental::Detail::RNTupleAtomicTimer;
 using RNTupleMetrics = ROOT::Experimental::Detail::RNTupleMetrics;
+using RNTupleTimingCollector = ROOT::Experimental::Detail::RNTupleTimingCollector;
 
 TEST(Metrics, Counters)
 {
@@ -56,3 +58,78 @@ TEST(Metrics, Timer)
    }
    EXPECT_GT(ctrWallTime.GetValue(), 0U);
 }
+
+TEST(Metrics, Disable)
+{
+   RNTupleMetrics inner("inner");
+   RNTupleMetrics outer("outer");
+   auto ctrInner = inner.MakeCounter<RNTupleAtomicCounter *>("atomic", "", "");
+   outer.Enable();
+   // Metrics observed or created after enabling are enabled, too
+   outer.ObserveMetrics(inner);
+   auto ctrOuter = outer.MakeCounter<RNTupleAtomicCounter *>("atomic", "", "");
+   EXPECT_TRUE(inner.IsEnabled());
+   EXPECT_TRUE(ctrInner->IsEnabled());
+   EXPECT_TRUE(ctrOuter->IsEnabled());
+
+   RNTupleAtomicCounter ctrWallTime("wall time", "ns", "");
+   ROOT::Experimental::Detail::RNTupleTickCounter<RNTupleAtomicCounter> ctrCpuTicks("cpu time", "ns", "");
+   {
+      // A timer started while disabled does not record anything even if the counter gets enabled in the meantime
+      RNTupleAtomicTimer timer(ctrWallTime, ctrCpuTicks);
+      ctrWallTime.Enable();
+      ctrCpuTicks.Enable();
+   }
+   EXPECT_EQ(0U, ctrWallTime.GetValue());
+   EXPECT_EQ(0U, ctrCpuTicks.GetValue());
+
+   outer.Disable();
+   EXPECT_FALSE(inner.IsEnabled());
+   EXPECT_FALSE(ctrInner->IsEnabled());
+   ctrInner->Inc();
+   ctrOuter->Inc();
+   EXPECT_EQ(0, ctrInner->GetValue());
+   EXPECT_EQ(0, ctrOuter->GetValue());
+}
+
+TEST(Metrics, TimingCollector)
+{
+   RNTupleTimingCollector collector("timing");
+   auto &ctrsUnzip = collector.GetCounters("pt#0", "unzip");
+   EXPECT_EQ(&ctrsUnzip, &collector.GetCounters("pt#0", "unzip"));
+   {
+      RNTupleTimingCollector::RPhaseTimer timer(ctrsUnzip);
+   }
+   EXPECT_TRUE(collector.GetTable().empty());
+
+   collector.GetMetrics().Enable();
+   auto &ctrsRead = collector.GetCounters("", "read");
+   EXPECT_TRUE(ctrsRead.fNCalls.IsEnabled());
+   for (int i = 0; i < 2; ++i) {
+      RNTupleTimingCollector::RPhaseTimer timer(ctrsUnzip);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+   }
+   {
+      RNTupleTimingCollector::RPhaseTimer timer(ctrsRead);
+   }
+   // Phases without calls, such as the unpack phase, are not part of the table
+   collector.GetCounters("pt#0", "unpack");
+
+   auto table = collector.GetTable();
+   ASSERT_EQ(2U, table.size());
+   EXPECT_EQ("", table[0].fName);
+   EXPECT_EQ("read", table[0].fPhase);
+   EXPECT_EQ(1, table[0].fNCalls);
+   EXPECT_EQ("pt#0", table[1].fName);
+   EXPECT_EQ("unzip", table[1].fPhase);
+   EXPECT_EQ(2, table[1].fNCalls);
+   EXPECT_GE(table[1].fTimeWallNs, 2 * 1000 * 1000);
+
+   std::ostringstream osTable;
+   collector.PrintTable(osTable);
+   EXPECT_NE(std::string::npos, osTable.str().find("pt#0"));
+
+   std::ostringstream osMetrics;
+   collector.GetMetrics().Print(osMetrics);
+   EXPECT_NE(std::string::npos, osMetrics.str().find("timing.pt#0.unzip.nCall||number of calls|2"));
+}
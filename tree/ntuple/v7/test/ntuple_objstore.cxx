@@ -0,0 +1,143 @@
+#include "gtest/gtest.h"
+
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RObjectStore.hxx>
+
+#include <TSystem.h>
+
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using RNTupleModel = ROOT::Experimental::RNTupleModel;
+using RNTupleReader = ROOT::Experimental::RNTupleReader;
+using RNTupleReadOptions = ROOT::Experimental::RNTupleReadOptions;
+using RNTupleWriter = ROOT::Experimental::RNTupleWriter;
+using RObjectStore = ROOT::Experimental::Detail::RObjectStore;
+
+namespace {
+
+/**
+ * An RAII wrapper around a directory that is used as an object store.  It removes the directory and the objects
+ * in it when the wrapper object goes out of scope.
+ */
+class DirectoryRaii {
+private:
+   std::string fPath;
+public:
+   explicit DirectoryRaii(const std::string &path) : fPath(path) { }
+   DirectoryRaii(const DirectoryRaii&) = delete;
+   DirectoryRaii& operator=(const DirectoryRaii&) = delete;
+   ~DirectoryRaii() {
+      auto dir = gSystem->OpenDirectory(fPath.c_str());
+      if (!dir)
+         return;
+      while (auto entry = gSystem->GetDirEntry(dir)) {
+         if ((strcmp(entry, ".") != 0) && (strcmp(entry, "..") != 0))
+            gSystem->Unlink((fPath + "/" + entry).c_str());
+      }
+      gSystem->FreeDirectory(dir);
+      gSystem->Unlink(fPath.c_str());
+   }
+   std::string GetPath() const { return fPath; }
+   std::string GetURI() const { return std::string(RObjectStore::kURIScheme) + fPath; }
+};
+
+} // anonymous namespace
+
+
+TEST(RObjectStore, PutGet)
+{
+   DirectoryRaii dirGuard("test_ntuple_objstore_putget");
+   auto store = RObjectStore::Create(dirGuard.GetURI());
+   EXPECT_THROW(RObjectStore::Create("test_ntuple_objstore_putget"), std::runtime_error);
+
+   store->Put("a/b", "xyz", 3);
+   std::vector<RObjectStore::RRequest> requests;
+   std::vector<std::string> values;
+   for (unsigned int i = 0; i < 10; ++i)
+      values.emplace_back(std::to_string(i * 1000));
+   for (unsigned int i = 0; i < 10; ++i)
+      requests.emplace_back("obj/" + std::to_string(i), &values[i][0], values[i].size());
+   store->PutV(requests);
+
+   char buffer[8];
+   EXPECT_EQ(3U, store->Get("a/b", buffer, sizeof(buffer)));
+   EXPECT_EQ(0, memcmp("xyz", buffer, 3));
+   EXPECT_THROW(store->Get("a", buffer, sizeof(buffer)), std::runtime_error);
+
+   auto clone = store->Clone();
+   std::vector<std::string> readValues(10, std::string(8, ' '));
+   for (unsigned int i = 0; i < 10; ++i) {
+      requests[i].fBuffer = &readValues[i][0];
+      requests[i].fSize = readValues[i].size();
+   }
+   clone->GetV(requests);
+   for (unsigned int i = 0; i < 10; ++i) {
+      EXPECT_EQ(values[i].size(), requests[i].fOutBytes);
+      EXPECT_EQ(values[i], readValues[i].substr(0, requests[i].fOutBytes));
+   }
+}
+
+
+TEST(RPageStorageObject, WriteRead)
+{
+   DirectoryRaii dirGuard("test_ntuple_objstore_writeread");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrJets = model->MakeField<std::vector<float>>("jets");
+      auto wrTag = model->MakeField<std::string>("tag");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", dirGuard.GetURI());
+      for (unsigned int i = 0; i < 5000; ++i) {
+         *wrPt = i;
+         *wrJets = std::vector<float>(i % 3, i);
+         *wrTag = std::to_string(i);
+         ntuple->Fill();
+         if (i % 1000 == 999)
+            ntuple->CommitCluster();
+      }
+   }
+   EXPECT_THROW(RNTupleReader::Open("other", dirGuard.GetURI()), std::runtime_error);
+
+   for (auto clusterCache : {RNTupleReadOptions::kOff, RNTupleReadOptions::kOn}) {
+      RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open("ntpl", dirGuard.GetURI(), options);
+      EXPECT_EQ(5000U, ntuple->GetNEntries());
+      EXPECT_EQ(5U, ntuple->GetDescriptor().GetNClusters());
+      ntuple->EnableMetrics();
+
+      auto clone = ntuple->Clone();
+      for (auto reader : {ntuple.get(), clone.get()}) {
+         auto viewPt = reader->GetView<float>("pt");
+         auto viewJets = reader->GetView<std::vector<float>>("jets");
+         auto viewTag = reader->GetView<std::string>("tag");
+         for (auto i : reader->GetEntryRange()) {
+            EXPECT_EQ(float(i), viewPt(i));
+            EXPECT_EQ(std::vector<float>(i % 3, i), viewJets(i));
+            EXPECT_EQ(std::to_string(i), viewTag(i));
+         }
+      }
+
+      std::ostringstream osMetrics;
+      ntuple->PrintInfo(ROOT::Experimental::ENTupleInfo::kMetrics, osMetrics);
+      std::istringstream isMetrics(osMetrics.str());
+      std::string line;
+      std::string nClusterLoaded;
+      while (std::getline(isMetrics, line)) {
+         if (line.find("RPageSourceObject.nClusterLoaded|") != std::string::npos)
+            nClusterLoaded = line.substr(line.rfind('|') + 1);
+      }
+      if (clusterCache == RNTupleReadOptions::kOn)
+         EXPECT_EQ("5", nClusterLoaded);
+      else
+         EXPECT_EQ("0", nClusterLoaded);
+   }
+}
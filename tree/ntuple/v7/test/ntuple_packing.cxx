@@ -2,6 +2,10 @@
 
 #include <ROOT/RColumnElement.hxx>
 
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
@@ -34,3 +38,133 @@ TEST(Packing, Bitfield)
       EXPECT_EQ(b9[i], e9[i]);
    }
 }
+
+TEST(Packing, Split)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32> element(nullptr);
+   EXPECT_FALSE(element.IsMappable());
+   EXPECT_EQ(32U, element.GetBitsOnStorage());
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   float f[] = {1.0, 2.0, -3.5};
+   unsigned char packed[sizeof(f)];
+   element.Pack(packed, f, 3);
+   // The lowest bytes of the three floats come first
+   const auto raw = reinterpret_cast<const unsigned char *>(f);
+   EXPECT_EQ(raw[0], packed[0]);
+   EXPECT_EQ(raw[4], packed[1]);
+   EXPECT_EQ(raw[8], packed[2]);
+   EXPECT_EQ(raw[1], packed[3]);
+   EXPECT_EQ(raw[11], packed[11]);
+   float e[] = {0.0, 0.0, 0.0};
+   element.Unpack(e, packed, 3);
+   for (unsigned i = 0; i < 3; ++i) {
+      EXPECT_EQ(f[i], e[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>
+      element64(nullptr);
+   std::int64_t i64[] = {1, -1, 0x0102030405060708};
+   unsigned char packed64[sizeof(i64)];
+   element64.Pack(packed64, i64, 3);
+   std::int64_t e64[] = {0, 0, 0};
+   element64.Unpack(e64, packed64, 3);
+   for (unsigned i = 0; i < 3; ++i) {
+      EXPECT_EQ(i64[i], e64[i]);
+   }
+}
+
+TEST(Packing, SplitIndex)
+{
+   using ClusterSize_t = ROOT::Experimental::ClusterSize_t;
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex>
+      element(nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   ClusterSize_t offsets[] = {ClusterSize_t(300), ClusterSize_t(301), ClusterSize_t(301), ClusterSize_t(600)};
+   unsigned char packed[sizeof(offsets)];
+   element.Pack(packed, offsets, 4);
+   // Differences: 300, 1, 0, 299; the first byte plane holds the low bytes, the second one the next bytes
+   EXPECT_EQ(300 % 256, packed[0]);
+   EXPECT_EQ(1, packed[1]);
+   EXPECT_EQ(0, packed[2]);
+   EXPECT_EQ(299 % 256, packed[3]);
+   EXPECT_EQ(1, packed[4]);
+   EXPECT_EQ(0, packed[5]);
+   EXPECT_EQ(0, packed[6]);
+   EXPECT_EQ(1, packed[7]);
+   ClusterSize_t e[] = {ClusterSize_t(0), ClusterSize_t(0), ClusterSize_t(0), ClusterSize_t(0)};
+   element.Unpack(e, packed, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(offsets[i], e[i]);
+   }
+}
+
+TEST(Packing, Truncated)
+{
+   using EColumnType = ROOT::Experimental::EColumnType;
+   ROOT::Experimental::Detail::RColumnElement<float, EColumnType::kReal32Trunc> element(nullptr, 20);
+   EXPECT_FALSE(element.IsMappable());
+   EXPECT_EQ(20U, element.GetBitsOnStorage());
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   // 20 bits leave 11 bits of mantissa, i.e. a relative precision of 2^-12 after rounding
+   float f[] = {1.0, -2.5, 3.14159265f, 1e-20f, 1e30f, 0.0};
+   unsigned char packed[(6 * 20 + 7) / 8];
+   element.Pack(packed, f, 6);
+   float e[6];
+   element.Unpack(e, packed, 6);
+   EXPECT_EQ(1.0, e[0]);
+   EXPECT_EQ(-2.5, e[1]);
+   for (unsigned i = 2; i < 5; ++i) {
+      EXPECT_NEAR(f[i], e[i], std::abs(f[i]) / 4096.);
+   }
+   EXPECT_EQ(0.0, e[5]);
+
+   ROOT::Experimental::Detail::RColumnElement<double, EColumnType::kReal64Trunc> element64(nullptr, 63);
+   double d[] = {1.0 / 3.0, -1e300, 42.0};
+   unsigned char packed64[(3 * 63 + 7) / 8];
+   element64.Pack(packed64, d, 3);
+   double e64[3];
+   element64.Unpack(e64, packed64, 3);
+   for (unsigned i = 0; i < 3; ++i) {
+      EXPECT_NEAR(d[i], e64[i], std::abs(d[i]) * 1e-15);
+   }
+}
+
+TEST(Packing, Quantized)
+{
+   using EColumnType = ROOT::Experimental::EColumnType;
+   ROOT::Experimental::Detail::RColumnElement<float, EColumnType::kReal32Quant> element(nullptr, 10, -1.0, 1.0);
+   EXPECT_EQ(10U, element.GetBitsOnStorage());
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   // Values outside the range are clamped to the range borders
+   float f[] = {-1.0, 1.0, 0.25, -0.7, 5.0, -5.0};
+   unsigned char packed[(6 * 10 + 7) / 8];
+   element.Pack(packed, f, 6);
+   float e[6];
+   element.Unpack(e, packed, 6);
+   EXPECT_EQ(-1.0, e[0]);
+   EXPECT_EQ(1.0, e[1]);
+   EXPECT_NEAR(0.25, e[2], 1.0 / 1023);
+   EXPECT_NEAR(-0.7, e[3], 1.0 / 1023);
+   EXPECT_EQ(1.0, e[4]);
+   EXPECT_EQ(-1.0, e[5]);
+
+   ROOT::Experimental::Detail::RColumnElement<double, EColumnType::kReal64Quant> element32(nullptr, 32, 0.0, 100.0);
+   std::vector<double> d;
+   for (unsigned i = 0; i < 100; ++i)
+      d.emplace_back(i + 0.123);
+   std::vector<unsigned char> packed32(4 * d.size());
+   element32.Pack(packed32.data(), d.data(), d.size());
+   std::vector<double> e32(d.size());
+   element32.Unpack(e32.data(), packed32.data(), d.size());
+   for (unsigned i = 0; i < d.size(); ++i) {
+      EXPECT_NEAR(d[i], e32[i], 100.0 / 4294967295.0);
+   }
+}
@@ -63,3 +63,110 @@ TEST(Pages, Pool)
    page = pool.GetPage(1, 55);
    EXPECT_TRUE(page.IsNull());
 }
+
+TEST(Pages, PoolPreload)
+{
+   unsigned int nCallDeleter = 0;
+   RPageDeleter deleter([&nCallDeleter](const RPage & /*page*/, void * /*userData*/) { nCallDeleter++; });
+   unsigned char buffer[20];
+
+   {
+      RPagePool pool;
+      RPage::RClusterInfo clusterInfo(0, 0);
+      RPage page1(1, buffer, 10, 1);
+      EXPECT_NE(nullptr, page1.TryGrow(10));
+      page1.SetWindow(0, clusterInfo);
+      RPage page2(1, buffer + 10, 10, 1);
+      EXPECT_NE(nullptr, page2.TryGrow(10));
+      page2.SetWindow(10, clusterInfo);
+      pool.PreloadPage(page1, deleter);
+      pool.PreloadPage(page2, deleter);
+
+      // Preloaded pages are handed out like registered pages; they are freed once they have been returned
+      auto page = pool.GetPage(1, 5);
+      ASSERT_FALSE(page.IsNull());
+      EXPECT_EQ(0U, page.GetGlobalRangeFirst());
+      pool.ReturnPage(page);
+      EXPECT_EQ(1U, nCallDeleter);
+      EXPECT_TRUE(pool.GetPage(1, 5).IsNull());
+
+      page = pool.GetPage(1, 15);
+      ASSERT_FALSE(page.IsNull());
+      pool.EvictPreloadedPages();
+      EXPECT_EQ(1U, nCallDeleter);
+      pool.ReturnPage(page);
+      EXPECT_EQ(2U, nCallDeleter);
+
+      // Unused preloaded pages are freed on eviction
+      pool.PreloadPage(page1, deleter);
+      pool.EvictPreloadedPages();
+      EXPECT_EQ(3U, nCallDeleter);
+      EXPECT_TRUE(pool.GetPage(1, 5).IsNull());
+
+      // ...or on destruction of the pool
+      pool.PreloadPage(page1, deleter);
+   }
+   EXPECT_EQ(4U, nCallDeleter);
+}
+
+TEST(Pages, PoolCache)
+{
+   unsigned int nCallDeleter = 0;
+   RPageDeleter deleter([&nCallDeleter](const RPage & /*page*/, void * /*userData*/) { nCallDeleter++; });
+   unsigned char buffer[50];
+
+   RPage pages[5];
+   RPage::RClusterInfo clusterInfo(0, 0);
+   for (unsigned int i = 0; i < 5; ++i) {
+      pages[i] = RPage(1, buffer + 10 * i, 10, 1);
+      EXPECT_NE(nullptr, pages[i].TryGrow(10));
+      pages[i].SetWindow(10 * i, clusterInfo);
+   }
+
+   {
+      // Budget for three pages
+      RPagePool pool(30);
+      for (unsigned int i = 0; i < 3; ++i)
+         pool.ReturnPage(pool.RegisterPage(pages[i], deleter));
+      EXPECT_EQ(0U, nCallDeleter);
+
+      // Returned pages are cached; a hit makes the page the most recently used one
+      auto page = pool.GetPage(1, 5);
+      ASSERT_FALSE(page.IsNull());
+      EXPECT_EQ(buffer, page.GetBuffer());
+      pool.ReturnPage(page);
+
+      // Exceeding the budget evicts the least recently used unreferenced page, i.e. the second page
+      page = pool.RegisterPage(pages[3], deleter);
+      EXPECT_EQ(1U, nCallDeleter);
+      EXPECT_TRUE(pool.GetPage(1, 15).IsNull());
+      EXPECT_TRUE(pool.HasPage(1, ROOT::Experimental::RClusterIndex(0, 5)));
+      EXPECT_TRUE(pool.HasPage(1, ROOT::Experimental::RClusterIndex(0, 25)));
+      EXPECT_FALSE(pool.HasPage(1, ROOT::Experimental::RClusterIndex(1, 25)));
+
+      // Referenced pages are not evicted, even if the pool exceeds its budget
+      auto page2 = pool.RegisterPage(pages[4], deleter);
+      EXPECT_EQ(2U, nCallDeleter);
+      EXPECT_TRUE(pool.GetPage(1, 25).IsNull());
+      EXPECT_TRUE(pool.HasPage(1, ROOT::Experimental::RClusterIndex(0, 5)));
+
+      // Registering a page that is already in the pool frees the new page and hands out the pooled one
+      RPage duplicate(1, buffer, 10, 1);
+      EXPECT_NE(nullptr, duplicate.TryGrow(10));
+      duplicate.SetWindow(40, clusterInfo);
+      auto page3 = pool.RegisterPage(duplicate, deleter);
+      EXPECT_EQ(3U, nCallDeleter);
+      EXPECT_EQ(buffer + 40, page3.GetBuffer());
+
+      pool.ReturnPage(page);
+      pool.ReturnPage(page2);
+      pool.ReturnPage(page3);
+      EXPECT_EQ(3U, nCallDeleter);
+
+      // Preloaded pages are subject to the budget, too
+      pool.PreloadPage(pages[1], deleter);
+      EXPECT_EQ(4U, nCallDeleter);
+      EXPECT_TRUE(pool.GetPage(1, 5).IsNull());
+   }
+   EXPECT_EQ(7U, nCallDeleter);
+}
@@ -51,7 +51,9 @@ namespace Experimental {
 // usage of this mechanism somehow involves baskets currently.
 enum class EIOFeatures {
    kGenerateOffsetMap = BIT(0),
-   kSupported = kGenerateOffsetMap  // Union of all features in this enum.
+   kDeltaOffsetMap = BIT(2),        // Store the entry offsets of variable-size entries as variable-length differences.
+   kLittleEndianPayload = BIT(3),   // Store the values of fixed-size numerical branches in little-endian byte order.
+   kSupported = kGenerateOffsetMap | kDeltaOffsetMap | kLittleEndianPayload  // Union of all features in this enum.
 };
 
 
@@ -59,7 +61,8 @@ enum class EIOFeatures {
 // NOTE: the intent is that there is never an IO feature that goes into the ROOT:: namespace
 // but is unsupported.
 enum class EIOUnsupportedFeatures {
-   kUnsupported = 0  // Union of all features in this enum.
+   kBasketClassMap = BIT(1),         // Reserved for the class map of the baskets.
+   kUnsupported = kBasketClassMap    // Union of all features in this enum.
 };
 
 
@@ -86,7 +89,7 @@ public:
    void Print() const;
 
    // The number of known, defined IO features (supported / unsupported / experimental).
-   static constexpr int kIOFeatureCount = 1;
+   static constexpr int kIOFeatureCount = 3;
 
 private:
    // These methods allow access to the raw bitset underlying
@@ -53,6 +53,7 @@ private:
 
    // Returns true if the underlying TLeaf can regenerate the entry offsets for us.
    Bool_t CanGenerateOffsetArray();
+   void   SwapPayload();
 
    // Manage buffer ownership.
    void   DisownBuffer();
@@ -67,6 +68,7 @@ protected:
    UChar_t     fIOBits{0};                        ///<!IO feature flags.  Serialized in custom portion of streamer to avoid forward compat issues unless needed.
    Bool_t      fOwnsCompressedBuffer{kFALSE};     ///<! Whether or not we own the compressed buffer.
    Bool_t      fReadEntryOffset{kFALSE};          ///<!Set to true if offset array was read from a file.
+   Bool_t      fLittleEndianPayload{kFALSE};      ///<!True if the values in fBufferRef are still in the little-endian order they were stored in.
    Int_t      *fDisplacement{nullptr};            ///<![fNevBuf] Displacement of entries in fBuffer(TKey)
    Int_t      *fEntryOffset{nullptr};             ///<[fNevBuf] Offset of entries in fBuffer(TKey); generated at runtime.  Special value
                                                   /// of `-1` indicates that the offset generation MUST be performed on first read.
@@ -93,20 +95,24 @@ public:
    // in the fIOBits -- then the zombie flag will be set for this object.
    //
    enum class EIOBits : Char_t {
-      // The following to bits are reserved for now; when supported, set
-      // kSupported = kGenerateOffsetMap | kBasketClassMap
+      // BIT(1) is reserved for kBasketClassMap (see EUnsupportedIOBits); when supported, move it here
+      // and add it to kSupported.
       kGenerateOffsetMap = BIT(0),
-      // kBasketClassMap = BIT(1),
-      kSupported = kGenerateOffsetMap
+      kDeltaOffsetMap = BIT(2),
+      kLittleEndianPayload = BIT(3),
+      kSupported = kGenerateOffsetMap | kDeltaOffsetMap | kLittleEndianPayload
    };
    // This enum covers IOBits that are known to this ROOT release but
    // not supported; provides a mechanism for us to have experimental
    // changes that are not going go into a supported release.
    //
    // (kUnsupported | kSupported) should result in the '|' of all IOBits.
-   enum class EUnsupportedIOBits : Char_t { kUnsupported = 0 };
+   enum class EUnsupportedIOBits : Char_t {
+      kBasketClassMap = BIT(1),
+      kUnsupported = kBasketClassMap
+   };
    // The number of known, defined IOBits.
-   static constexpr int kIOBitCount = 1;
+   static constexpr int kIOBitCount = 4;
 
    TBasket();
    TBasket(TDirectory *motherDir);
@@ -115,6 +121,7 @@ public:
 
    virtual void    AdjustSize(Int_t newsize);
    virtual void    DeleteEntryOffset();
+           void    EnsureBigEndianPayload() { if (R__unlikely(fLittleEndianPayload)) SwapPayload(); }
    virtual Int_t   DropBuffers();
    TBranch        *GetBranch() const {return fBranch;}
            Int_t   GetBufferSize() const {return fBufferSize;}
@@ -127,6 +134,7 @@ public:
            Int_t   GetNevBuf() const {return fNevBuf;}
            Int_t   GetNevBufSize() const {return fNevBufSize;}
            Int_t   GetLast() const {return fLast;}
+           Bool_t  HasLittleEndianPayload() const { return fLittleEndianPayload; }
    virtual void    MoveEntries(Int_t dentries);
    virtual void    PrepareBasket(Long64_t /* entry */) {};
            Int_t   ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file);
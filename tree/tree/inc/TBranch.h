@@ -24,6 +24,8 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "Compression.h"
 #include "TAttFill.h"
@@ -74,6 +76,7 @@ public:
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
+   Int_t GetBulkEntriesJagged(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
    Bool_t SupportsBulkRead() const;
 
 private:
@@ -137,6 +140,9 @@ protected:
    Int_t      *fBasketBytes;      ///<[fMaxBaskets] Length of baskets on file
    Long64_t   *fBasketEntry;      ///<[fMaxBaskets] Table of first entry in each basket
    Long64_t   *fBasketSeek;       ///<[fMaxBaskets] Addresses of baskets on file
+   Double_t   *fBasketMin;        ///<[fMaxBaskets] Minimum value in each basket, see SetBasketStatistics()
+   Double_t   *fBasketMax;        ///<[fMaxBaskets] Maximum value in each basket
+   Double_t   *fBasketSum;        ///<[fMaxBaskets] Sum of the values in each basket, NaN if unknown
    TTree      *fTree;             ///<! Pointer to Tree header
    TBranch    *fMother;           ///<! Pointer to top-level parent branch in the tree.
    TBranch    *fParent;           ///<! Pointer to parent branch.
@@ -150,6 +156,9 @@ protected:
 
    Bool_t      fSkipZip;          ///<! After being read, the buffer will not be unzipped.
 
+   std::vector<char> fCompressionDict; ///<  Dictionary shared by the compressed baskets (ZSTD only), empty if none
+   Int_t       fCompressionDictSize;   ///<! Maximum size of the dictionary to train from the first basket, 0 if none
+
    using CacheInfo_t = ROOT::Internal::TBranchCacheInfo;
    CacheInfo_t fCacheInfo;        ///<! Hold info about which basket are in the cache and if they have been retrieved from the cache.
 
@@ -162,6 +171,8 @@ protected:
    void     ReadLeaves1Impl(TBuffer &b);
    void     ReadLeaves2Impl(TBuffer &b);
    void     FillLeavesImpl(TBuffer &b);
+   void     FillBasketStatistics(Bool_t firstEntry);
+   void     ResetBasketStatistics(Int_t first);
 
    void     SetSkipZip(Bool_t skip = kTRUE) { fSkipZip = skip; }
    void     Init(const char *name, const char *leaflist, Int_t compress);
@@ -178,6 +189,7 @@ private:
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
+   Int_t    GetBulkEntriesJagged(Long64_t, TBuffer&, std::vector<Int_t>&);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
    TBranch(const TBranch&) = delete;             // not implemented
@@ -208,6 +220,7 @@ public:
            Int_t    *GetBasketBytes() const {return fBasketBytes;}
            Long64_t *GetBasketEntry() const {return fBasketEntry;}
    virtual Long64_t  GetBasketSeek(Int_t basket) const;
+           Bool_t    GetBasketStatistics(Int_t basket, Double_t &min, Double_t &max, Double_t &sum) const;
    virtual Int_t     GetBasketSize() const {return fBasketSize;}
            ROOT::Experimental::Internal::TBulkBranchRead &GetBulkRead() { return fBulk; }
    virtual TList    *GetBrowsables();
@@ -215,6 +228,8 @@ public:
            Int_t     GetCompressionAlgorithm() const;
            Int_t     GetCompressionLevel() const;
            Int_t     GetCompressionSettings() const;
+   const std::vector<char> &GetCompressionDictionary() const { return fCompressionDict; }
+           Int_t     GetCompressionDictionarySize() const { return fCompressionDictSize; }
    TDirectory       *GetDirectory() const {return fDirectory;}
    virtual Int_t     GetEntry(Long64_t entry=0, Int_t getall = 0);
    virtual Int_t     GetEntryExport(Long64_t entry, Int_t getall, TClonesArray *list, Int_t n);
@@ -233,6 +248,7 @@ public:
            Long64_t  GetTotBytes(Option_t *option="")    const;
            Long64_t  GetZipBytes(Option_t *option="")    const;
            Long64_t  GetEntryNumber() const {return fEntryNumber;}
+   std::vector<std::pair<Long64_t, Long64_t>> GetEntryRanges(Double_t min, Double_t max) const;
            Long64_t  GetFirstEntry()  const {return fFirstEntry; }
          TIOFeatures GetIOFeatures() const;
          TObjArray  *GetListOfBaskets()  {return &fBaskets;}
@@ -242,12 +258,14 @@ public:
            Int_t     GetNleaves()     const {return fNleaves;}
            Int_t     GetSplitLevel()  const {return fSplitLevel;}
            Long64_t  GetEntries()     const {return fEntries;}
+           Bool_t    GetStatistics(Double_t &min, Double_t &max, Double_t &sum) const;
            TTree    *GetTree()        const {return fTree;}
    virtual Int_t     GetRow(Int_t row);
    virtual Bool_t    GetMakeClass() const;
    TBranch          *GetMother() const;
    TBranch          *GetSubBranch(const TBranch *br) const;
    TBuffer          *GetTransientBuffer(Int_t size);
+   Bool_t            HasBasketStatistics() const { return fBasketSum != nullptr; }
    Bool_t            IsAutoDelete() const;
    Bool_t            IsFolder() const;
    virtual void      KeepCircular(Long64_t maxEntries);
@@ -264,10 +282,12 @@ public:
    virtual void      SetObject(void *objadd);
    virtual void      SetAutoDelete(Bool_t autodel=kTRUE);
    virtual void      SetBasketSize(Int_t buffsize);
+           Bool_t    SetBasketStatistics(Bool_t on = kTRUE);
    virtual void      SetBufferAddress(TBuffer *entryBuffer);
    void              SetCompressionAlgorithm(Int_t algorithm = ROOT::RCompressionSetting::EAlgorithm::kUseGlobal);
    void              SetCompressionLevel(Int_t level = ROOT::RCompressionSetting::ELevel::kUseMin);
    void              SetCompressionSettings(Int_t settings = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault);
+   void              SetCompressionDictionarySize(Int_t maxsize = 16384);
    virtual void      SetEntries(Long64_t entries);
    virtual void      SetEntryOffsetLen(Int_t len, Bool_t updateSubBranches = kFALSE);
    virtual void      SetFirstEntry( Long64_t entry );
@@ -280,12 +300,13 @@ public:
    virtual void      SetTree(TTree *tree) { fTree = tree;}
    virtual void      SetupAddresses();
            Bool_t    SupportsBulkRead() const;
+           void      TrainCompressionDictionary(const char *buffer, Int_t len);
    virtual void      UpdateAddress() {;}
    virtual void      UpdateFile();
 
    static  void      ResetCount();
 
-   ClassDef(TBranch, 13); // Branch descriptor
+   ClassDef(TBranch, 15); // Branch descriptor
 };
 
 //______________________________________________________________________________
@@ -313,6 +334,7 @@ namespace Internal {
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
+inline Int_t  TBulkBranchRead::GetBulkEntriesJagged(Long64_t evt, TBuffer& user_buf, std::vector<Int_t>& offsets) { return fParent.GetBulkEntriesJagged(evt, user_buf, offsets); }
 inline Bool_t TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
 
 }  // Internal
@@ -44,6 +44,7 @@ protected:
    TObjArray   *fFiles;            ///< -> List of file names containing the trees (TChainElement, owned)
    TList       *fStatus;           ///< -> List of active/inactive branches (TChainElement, owned)
    TChain      *fProofChain;       ///<! chain proxy when going to be processed by PROOF
+   TString      fEntryCountCache;  ///<! File caching the number of entries of the trees, see SetEntryCountCache()
 
 private:
    TChain(const TChain&);            // not implemented
@@ -51,6 +52,7 @@ private:
    void ParseTreeFilename(const char *name, TString &filename, TString &treename, TString &query, TString &suffix, Bool_t wildcards) const;
 
 protected:
+   void FillTreeOffsets();
    void InvalidateCurrentTree();
    void ReleaseChainProof();
 
@@ -156,6 +158,7 @@ public:
    virtual void      SetBranchStatus(const char *bname, Bool_t status=1, UInt_t *found=0);
    virtual Int_t     SetCacheSize(Long64_t cacheSize = -1);
    virtual void      SetDirectory(TDirectory *dir);
+   virtual void      SetEntryCountCache(const char *filename = "");
    virtual void      SetEntryList(TEntryList *elist, Option_t *opt="");
    virtual void      SetEntryListFile(const char *filename="", Option_t *opt="");
    virtual void      SetEventList(TEventList *evlist);
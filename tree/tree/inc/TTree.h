@@ -50,6 +50,7 @@ class TList;
 
 #include <array>
 #include <atomic>
+#include <memory>
 
 
 class TBuffer;
@@ -75,6 +76,12 @@ class TTreeCloner;
 class TFileMergeInfo;
 class TVirtualPerfStats;
 
+namespace ROOT {
+namespace Internal {
+class TBasketBufferPool; ///< Recycles the buffers of the baskets of a TTree.
+}
+}
+
 class TTree : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
    using TIOFeatures = ROOT::TIOFeatures;
@@ -138,10 +145,17 @@ protected:
    Bool_t         fIMTEnabled;            ///<! true if implicit multi-threading is enabled for this tree
    UInt_t         fNEntriesSinceSorting;  ///<! Number of entries processed since the last re-sorting of branches
    std::vector<std::pair<Long64_t,TBranch*>> fSortedBranches; ///<! Branches to be processed in parallel when IMT is on, sorted by average task time
+   std::vector<size_t> fBranchTaskEnds;  ///<! When IMT is on, end in fSortedBranches of the branches read by each task of GetEntry
    std::vector<TBranch*> fSeqBranches;    ///<! Branches to be processed sequentially when IMT is on
    Float_t fTargetMemoryRatio{1.1f};      ///<! Ratio for memory usage in uncompressed buffers versus actual occupancy.  1.0
                                            /// indicates basket should be resized to exact memory usage, but causes significant
 /// memory churn.
+   Int_t fTargetBasketSize{0};            ///<! If positive, compressed size of the baskets aimed at when resizing them at each cluster, see SetTargetBasketSize()
+   std::shared_ptr<ROOT::Internal::TBasketBufferPool> fBasketBufferPool; ///<! Recycles the buffers of the dropped baskets, shared by the trees of a TChain
+   std::vector<Long64_t> fFriendEntries;  ///<! Our entries resolved through fTreeIndex for the entries [fFriendEntriesStart, fFriendEntriesEnd) of fFriendEntriesMaster
+   Long64_t fFriendEntriesStart{-1};      ///<! First entry of the master tree covered by fFriendEntries
+   Long64_t fFriendEntriesEnd{-1};        ///<! Entry after the last one of the master tree covered by fFriendEntries
+   const TTree *fFriendEntriesMaster{nullptr}; ///<! Master tree for which fFriendEntries were resolved
 #ifdef R__TRACK_BASKET_ALLOC_TIME
    mutable std::atomic<ULong64_t> fAllocationTime{0}; ///<! Time spent reallocating basket memory buffers, in microseconds.
 #endif
@@ -158,8 +172,12 @@ private:
 
    void             InitializeBranchLists(bool checkLeafCount);
    void             SortBranchesByTime();
+   void             GroupSortedBranches();
+   void             AdaptBasketSizes();
    Int_t            FlushBasketsImpl() const;
    void             MarkEventCluster();
+   Bool_t           ResolveFriendEntry(Long64_t entry, TTree *masterTree, Long64_t &friendEntry);
+   void             PrefetchFriendCluster();
 
 protected:
    virtual void     KeepCircular();
@@ -199,6 +217,7 @@ protected:
    // So that the index class can use TFriendLock:
    friend class TTreeIndex;
    friend class TChainIndex;
+   friend class TTreeCompactIndex;
    // So that the TTreeCloner can access the protected interfaces
    friend class TTreeCloner;
 
@@ -437,6 +456,9 @@ public:
 #endif
    virtual Long64_t        GetAutoFlush() const {return fAutoFlush;}
    virtual Long64_t        GetAutoSave()  const {return fAutoSave;}
+   ROOT::Internal::TBasketBufferPool *GetBasketBufferPool() const { return fBasketBufferPool.get(); }
+   Long64_t                GetBasketBufferPoolSize() const;
+   void                    GetBasketBufferPoolStats(ULong64_t &requests, ULong64_t &hits, Long64_t &bytes) const;
    virtual TBranch        *GetBranch(const char* name);
    virtual TBranchRef     *GetBranchRef() const { return fBranchRef; };
    virtual Bool_t          GetBranchStatus(const char* branchname) const;
@@ -509,6 +531,7 @@ public:
    virtual TVirtualIndex  *GetTreeIndex() const { return fTreeIndex; }
    virtual Int_t           GetTreeNumber() const { return 0; }
    Float_t GetTargetMemoryRatio() const { return fTargetMemoryRatio; }
+   Int_t                   GetTargetBasketSize() const { return fTargetBasketSize; }
    virtual Int_t           GetUpdate() const { return fUpdate; }
    virtual TList          *GetUserInfo();
    // See TSelectorDraw::GetVar
@@ -534,7 +557,7 @@ public:
    virtual Double_t       *GetW()    { return GetPlayer()->GetW(); }
    virtual Double_t        GetWeight() const   { return fWeight; }
    virtual Long64_t        GetZipBytes() const { return fZipBytes; }
-   virtual void            IncrementTotalBuffers(Int_t nbytes) { fTotalBuffers += nbytes; }
+   virtual void            IncrementTotalBuffers(Int_t nbytes);
    Bool_t                  IsFolder() const { return kTRUE; }
    virtual Int_t           LoadBaskets(Long64_t maxmemory = 2000000000);
    virtual Long64_t        LoadTree(Long64_t entry);
@@ -572,6 +595,7 @@ public:
    virtual void            SetAutoSave(Long64_t autos = -300000000);
    virtual void            SetAutoFlush(Long64_t autof = -30000000);
    virtual void            SetBasketSize(const char* bname, Int_t buffsize = 16000);
+   virtual Int_t           SetBasketStatistics(const char* bname = "*", Bool_t on = kTRUE);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TBranch **ptr = 0);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TClass *realClass, EDataType datatype, Bool_t isptr);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TBranch **ptr, TClass *realClass, EDataType datatype, Bool_t isptr);
@@ -591,6 +615,7 @@ public:
       return SetBranchAddress(bname,add,ptr,cl,type,false);
    }
 #endif
+   void                    SetBasketBufferPoolSize(Long64_t maxbytes);
    virtual void            SetBranchStatus(const char* bname, Bool_t status = 1, UInt_t* found = 0);
    static  void            SetBranchStyle(Int_t style = 1);  //style=0 for old branch, =1 for new branch style
    virtual Int_t           SetCacheSize(Long64_t cachesize = -1);
@@ -632,6 +657,8 @@ public:
    virtual void            SetPerfStats(TVirtualPerfStats* perf);
    virtual void            SetScanField(Int_t n = 50) { fScanField = n; } // *MENU*
    void SetTargetMemoryRatio(Float_t ratio) { fTargetMemoryRatio = ratio; }
+   void                    SetTargetBasketSize(Int_t zipBytes = 32000);
+   void                    ShareBasketBufferPool(const TTree *tree);
    virtual void            SetTimerInterval(Int_t msec = 333) { fTimerInterval=msec; }
    virtual void            SetTreeIndex(TVirtualIndex* index);
    virtual void            SetWeight(Double_t w = 1, Option_t* option = "");
@@ -69,6 +69,7 @@ protected:
    Bool_t       fAutoCreated{kFALSE}; ///<! true if cache was automatically created
 
    Bool_t       fLearnPrefilling{kFALSE}; ///<! true if we are in the process of executing LearnPrefill
+   Bool_t       fFromProfile{kFALSE}; ///<! true if the branches were taken from a branch profile
 
    // These members hold cached data for missed branches when miss optimization
    // is enabled.  Pointers are only initialized if the miss cache is enabled.
@@ -122,6 +123,8 @@ private:
                          int len); ///< Check the miss cache for a particular buffer, fetching if deemed necessary.
    Bool_t FillMissCache();         ///< Fill the miss cache from the current set of active branches.
    Bool_t CalculateMissCache();    ///< Calculate the appropriate miss cache to fetch; helper function for FillMissCache
+   void   SaveConfiguredBranchProfile() const; ///< Save the learned branches if TTreeCache.BranchProfile is set
+
    IOPos  FindBranchBasketPos(TBranch &, Long64_t entry); ///< Given a branch and an entry, determine the file location
                                                           ///< (offset / size) of the corresponding basket.
    TBranch *CalculateMissEntries(Long64_t, int, bool);    ///< Given an file read, try to determine the corresponding branch.
@@ -151,12 +154,14 @@ public:
    Double_t             GetMissEfficiencyRel() const;
    TTree               *GetTree() const {return fTree;}
    Bool_t               IsAutoCreated() const {return fAutoCreated;}
+   Bool_t               IsFromProfile() const {return fFromProfile;}
    virtual Bool_t       IsEnabled() const {return fEnabled;}
    virtual Bool_t       IsLearning() const {return fIsLearning;}
 
    virtual Bool_t       FillBuffer();
    virtual Int_t        LearnBranch(TBranch *b, Bool_t subgbranches = kFALSE);
    virtual void         LearnPrefill();
+   Int_t                LoadBranchProfile(const char *filename, const char *tag = "");
 
    virtual void         Print(Option_t *option="") const;
    virtual Int_t        ReadBuffer(char *buf, Long64_t pos, Int_t len);
@@ -164,6 +169,7 @@ public:
    virtual Int_t        ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len);
    virtual void         ResetCache();
    void                 ResetMissCache(); // Reset the miss cache.
+   Int_t                SaveBranchProfile(const char *filename, const char *tag = "") const;
    void                 SetAutoCreated(Bool_t val) {fAutoCreated = val;}
    virtual Int_t        SetBufferSize(Int_t buffersize);
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
@@ -37,6 +37,8 @@ class TTreeCloner {
    Option_t  *fMethod;
    TObjArray  fFromBranches;
    TObjArray  fToBranches;
+   TObjArray  fFromSlowBranches; ///< Top level branches of 'from' whose baskets can not be copied as is.
+   TObjArray  fToSlowBranches;   ///< Top level branches of 'to' re-filled entry by entry from fFromSlowBranches.
 
    UInt_t     fMaxBaskets;
    UInt_t    *fBasketBranchNum;  ///<[fMaxBaskets] Index of the branch(es) of the basket.
@@ -93,7 +95,8 @@ public:
       kNone       = 0,
       kNoWarnings = BIT(1),
       kIgnoreMissingTopLevel = BIT(2),
-      kNoFileCache = BIT(3)
+      kNoFileCache = BIT(3),
+      kAllowSlowBranches = BIT(4)
    };
 
    TTreeCloner(TTree *from, TTree *to, Option_t *method, UInt_t options = kNone);
@@ -107,10 +110,12 @@ public:
    void   CopyMemoryBaskets();
    void   CopyStreamerInfos();
    void   CopyProcessIds();
+   void   CopySlowBranches();
    const char *GetWarning() const { return fWarningMsg; }
    Bool_t Exec();
    Bool_t IsValid() { return fIsValid; }
    Bool_t NeedConversion() { return fNeedConversion; }
+   Int_t  GetNSlowBranches() const { return fToSlowBranches.GetEntriesFast(); }
    void   SetCacheSize(Int_t size);
    void   SortBaskets();
    void   WriteBaskets();
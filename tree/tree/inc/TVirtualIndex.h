@@ -39,6 +39,7 @@ public:
    virtual Long64_t       GetEntryNumberFriend(const TTree * /*parent*/) = 0;
    virtual Long64_t       GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const = 0;
    virtual Long64_t       GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor) const = 0;
+   virtual Bool_t         GetEntryNumbersFriend(const TTree *parent, Long64_t first, Long64_t last, Long64_t *entries);
    virtual const char    *GetMajorName()    const = 0;
    virtual const char    *GetMinorName()    const = 0;
    virtual Bool_t         IsValidFor(const TTree *parent) = 0;
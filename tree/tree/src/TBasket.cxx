@@ -17,6 +17,11 @@
 #include "TBranch.h"
 #include "TFile.h"
 #include "TLeaf.h"
+#include "TLeafD.h"
+#include "TLeafF.h"
+#include "TLeafI.h"
+#include "TLeafL.h"
+#include "TLeafS.h"
 #include "TMath.h"
 #include "TROOT.h"
 #include "TTreeCache.h"
@@ -25,14 +30,121 @@
 #include "TTimeStamp.h"
 #include "ROOT/TIOFeatures.hxx"
 #include "RZip.h"
+#include "ROOT/RZipBlocks.hxx"
+#include "Byteswap.h"
+#include "TBasketBufferPool.h"
 
 #include <bitset>
+#include <vector>
 
 const UInt_t kDisplacementMask = 0xFF000000;  // In the streamer the two highest bytes of
                                               // the fEntryOffset are used to stored displacement.
 
 ClassImp(TBasket);
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the type to byte-swap the payload of the baskets of the branch with,
+/// if they can be stored with the kLittleEndianPayload feature: the branch must
+/// hold a single, fixed-size numerical leaf whose values are stored as they are
+/// in memory, so that the payload is nothing but an array of values.
+/// Return kOther_t otherwise.
+
+static EDataType R__GetLittleEndianSwapType(TBranch *branch)
+{
+   if (!branch || branch->IsA() != TBranch::Class() || branch->GetNleaves() != 1)
+      return kOther_t;
+   TLeaf *leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+   if (leaf->GetLeafCount())
+      return kOther_t;
+   TClass *cl = leaf->IsA();
+   if (cl == TLeafS::Class())
+      return kShort_t;
+   if (cl == TLeafI::Class() || cl == TLeafF::Class())
+      return kInt_t;
+   if (cl == TLeafL::Class() || cl == TLeafD::Class())
+      return kLong64_t;
+   return kOther_t;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the entry offsets in the kDeltaOffsetMap format: the differences between
+/// consecutive offsets (starting from `first`), zigzag and variable-length encoded
+/// so that most entry sizes take a single byte instead of four, and compress well.
+
+static void R__WriteDeltaOffsets(TBuffer &b, const Int_t *offsets, Int_t n, Int_t first)
+{
+   std::vector<char> bytes;
+   bytes.reserve(n + 8);
+   Long64_t previous = first;
+   for (Int_t i = 0; i < n; ++i) {
+      const Long64_t diff = offsets[i] - previous;
+      ULong64_t zigzag = (static_cast<ULong64_t>(diff) << 1) ^ static_cast<ULong64_t>(diff >> 63);
+      while (zigzag >= 0x80) {
+         bytes.push_back(static_cast<char>(zigzag | 0x80));
+         zigzag >>= 7;
+      }
+      bytes.push_back(static_cast<char>(zigzag));
+      previous = offsets[i];
+   }
+   b << n;
+   b << static_cast<Int_t>(bytes.size());
+   b.WriteFastArray(bytes.data(), bytes.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read entry offsets written by R__WriteDeltaOffsets. Returns a new array, or
+/// nullptr if the encoded data is inconsistent with the buffer.
+
+static Int_t *R__ReadDeltaOffsets(TBuffer &b, Int_t first)
+{
+   Int_t n = 0, nbytes = 0;
+   b >> n;
+   b >> nbytes;
+   if (n < 0 || nbytes < 0 || nbytes > b.BufferSize() - b.Length())
+      return nullptr;
+   const UChar_t *cursor = reinterpret_cast<const UChar_t *>(b.Buffer() + b.Length());
+   const UChar_t *end = cursor + nbytes;
+   Int_t *offsets = new Int_t[n + 1];
+   Long64_t previous = first;
+   for (Int_t i = 0; i < n; ++i) {
+      ULong64_t zigzag = 0;
+      for (int shift = 0; cursor < end && shift < 64; shift += 7) {
+         const UChar_t c = *cursor++;
+         zigzag |= static_cast<ULong64_t>(c & 0x7f) << shift;
+         if (!(c & 0x80))
+            break;
+      }
+      previous += static_cast<Long64_t>(zigzag >> 1) ^ -static_cast<Long64_t>(zigzag & 1);
+      offsets[i] = static_cast<Int_t>(previous);
+   }
+   b.SetBufferOffset(b.Length() + nbytes);
+   return offsets;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Allocate a buffer for a basket of the branch, recycling one of the buffers
+/// of the baskets dropped earlier by the tree if possible.
+
+static inline TBuffer *R__AcquireBasketBuffer(TBranch *branch, TBuffer::EMode mode, Int_t size)
+{
+   TTree *tree = branch ? branch->GetTree() : nullptr;
+   if (tree)
+      return tree->GetBasketBufferPool()->Acquire(mode, size);
+   return new TBufferFile(mode, size);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Give back a buffer of a basket of the branch, for the tree to recycle it.
+
+static inline void R__ReleaseBasketBuffer(TBranch *branch, TBuffer *buffer)
+{
+   TTree *tree = branch ? branch->GetTree() : nullptr;
+   if (tree)
+      tree->GetBasketBufferPool()->Release(buffer);
+   else
+      delete buffer;
+}
+
 /** \class TBasket
 \ingroup tree
 
@@ -62,11 +174,14 @@ TBasket::TBasket(const char *name, const char *title, TBranch *branch)
    : TKey(branch->GetDirectory()), fBufferSize(branch->GetBasketSize()), fNevBufSize(branch->GetEntryOffsetLen()),
      fHeaderOnly(kTRUE), fIOBits(branch->GetIOFeatures().GetFeatures())
 {
+   if (R__GetLittleEndianSwapType(branch) == kOther_t) {
+      fIOBits &= ~static_cast<UChar_t>(EIOBits::kLittleEndianPayload);
+   }
    SetName(name);
    SetTitle(title);
    fClassName   = "TBasket";
    fBuffer = nullptr;
-   fBufferRef   = new TBufferFile(TBuffer::kWrite, fBufferSize);
+   fBufferRef   = R__AcquireBasketBuffer(branch, TBuffer::kWrite, fBufferSize);
    fVersion    += 1000;
    if (branch->GetDirectory()) {
       TFile *file = branch->GetFile();
@@ -176,8 +291,8 @@ Int_t TBasket::DropBuffers()
 
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
-   if (fBufferRef)    delete fBufferRef;
-   if (fCompressedBufferRef && fOwnsCompressedBuffer) delete fCompressedBufferRef;
+   R__ReleaseBasketBuffer(fBranch, fBufferRef);
+   if (fCompressedBufferRef && fOwnsCompressedBuffer) R__ReleaseBasketBuffer(fBranch, fCompressedBufferRef);
    fBufferRef   = 0;
    fCompressedBufferRef = 0;
    fBuffer      = 0;
@@ -211,6 +326,54 @@ Int_t *TBasket::GetCalculatedEntryOffset()
    return fEntryOffset;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Reverse the bytes of each of the `n` values of type T stored at `buf`, which
+/// need not be aligned.
+
+template <typename T, typename Swap>
+static void R__SwapValues(char *buf, Int_t n, Swap swap)
+{
+   for (Int_t idx = 0; idx < n; ++idx, buf += sizeof(T)) {
+      T value;
+      memcpy(&value, buf, sizeof(T));
+      value = swap(value);
+      memcpy(buf, &value, sizeof(T));
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Byte-swap the values of the basket, switching them between the big-endian
+/// order in which the leaves stream them and the little-endian order in which
+/// they are stored with the kLittleEndianPayload feature.
+///
+/// Only baskets of branches holding a single fixed-size numerical leaf are
+/// stored in little-endian order: their payload, from fKeylen to fLast, is
+/// nothing but an array of values.
+
+void TBasket::SwapPayload()
+{
+   char *payload = fBufferRef->Buffer() + fKeylen;
+   const Int_t nbytes = fLast - fKeylen;
+   switch (R__GetLittleEndianSwapType(fBranch)) {
+   case kShort_t:
+      R__SwapValues<UShort_t>(payload, nbytes / sizeof(UShort_t), [](UShort_t x) { return UShort_t(Rbswap_16(x)); });
+      break;
+   case kInt_t:
+      R__SwapValues<UInt_t>(payload, nbytes / sizeof(UInt_t), [](UInt_t x) { return UInt_t(Rbswap_32(x)); });
+      break;
+   case kLong64_t:
+      R__SwapValues<ULong64_t>(payload, nbytes / sizeof(ULong64_t), [](ULong64_t x) {
+         return (ULong64_t(Rbswap_32(UInt_t(x))) << 32) | Rbswap_32(UInt_t(x >> 32));
+      });
+      break;
+   default:
+      Error("SwapPayload", "The basket of branch %s is not made of fixed-size numerical values.",
+            fBranch ? fBranch->GetName() : "");
+      return;
+   }
+   fLittleEndianPayload = !fLittleEndianPayload;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Determine whether we can generate the offset array when this branch is read.
 ///
@@ -407,7 +570,7 @@ Int_t TBasket::ReadBasketBuffersUnzip(char* buffer, Int_t size, Bool_t mustFree,
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize a buffer for reading if it is not already initialized
 
-static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t len, TFile* file)
+static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t len, TFile* file, TBranch *branch)
 {
    TBuffer* result;
    if (R__likely(bufferRef)) {
@@ -420,7 +583,7 @@ static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t l
       bufferRef->Reset();
       result = bufferRef;
    } else {
-      result = new TBufferFile(TBuffer::kRead, len);
+      result = R__AcquireBasketBuffer(branch, TBuffer::kRead, len);
    }
    result->SetParent(file);
    return result;
@@ -432,7 +595,7 @@ static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t l
 void inline TBasket::InitializeCompressedBuffer(Int_t len, TFile* file)
 {
    Bool_t compressedBufferExists = fCompressedBufferRef != NULL;
-   fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file);
+   fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file, fBranch);
    if (R__unlikely(!compressedBufferExists)) {
       fOwnsCompressedBuffer = kTRUE;
    }
@@ -466,11 +629,19 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    if(!fBranch->GetDirectory()) {
       return -1;
    }
+   fLittleEndianPayload = kFALSE;
 
    Bool_t oldCase;
    char *rawUncompressedBuffer, *rawCompressedBuffer;
    Int_t uncompressedBufferLen;
 
+   // Optional monitor of the I/O steps of all threads.
+   TVirtualPerfStats *globalPerfStats = TVirtualPerfStats::GetGlobalPerfStats();
+   Double_t readStart = 0;
+   if (R__unlikely(globalPerfStats)) {
+      readStart = TTimeStamp();
+   }
+
    // See if the cache has already unzipped the buffer for us.
    TFileCacheRead *pf = nullptr;
    {
@@ -496,11 +667,11 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    TBuffer* readBufferRef;
    if (R__unlikely(fBranch->GetCompressionLevel()==0)) {
       // Initialize the buffer to hold the uncompressed data.
-      fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, len, file);
+      fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, len, file, fBranch);
       readBufferRef = fBufferRef;
    } else {
       // Initialize the buffer to hold the compressed data.
-      fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file);
+      fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file, fBranch);
       readBufferRef = fCompressedBufferRef;
    }
 
@@ -550,6 +721,9 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       }
       else gPerfStats = temp;
    }
+   if (R__unlikely(globalPerfStats)) {
+      globalPerfStats->BasketReadEvent(fBranch, len, readStart);
+   }
    Streamer(*readBufferRef);
    if (IsZombie()) {
       return 1;
@@ -582,7 +756,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    // the zip headers; this is no longer beforehand as the buffer lifetime is scoped
    // to the TBranch.
    uncompressedBufferLen = len > fObjlen+fKeylen ? len : fObjlen+fKeylen;
-   fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, uncompressedBufferLen, file);
+   fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, uncompressedBufferLen, file, fBranch);
    rawUncompressedBuffer = fBufferRef->Buffer();
    fBuffer = rawUncompressedBuffer;
 
@@ -595,7 +769,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
 
       // Optional monitor for zip time profiling.
       Double_t start = 0;
-      if (R__unlikely(gPerfStats)) {
+      if (R__unlikely(gPerfStats || globalPerfStats)) {
          start = TTimeStamp();
       }
 
@@ -605,26 +779,23 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       Int_t nin, nbuf;
       Int_t nout = 0, noutot = 0, nintot = 0;
 
-      // Unzip all the compressed objects in the compressed object buffer.
-      while (1) {
-         // Check the header for errors.
-         if (R__unlikely(R__unzip_header(&nin, rawCompressedObjectBuffer, &nbuf) != 0)) {
-            Error("ReadBasketBuffers", "Inconsistency found in header (nin=%d, nbuf=%d)", nin, nbuf);
-            break;
-         }
+      // Check the header for errors.
+      if (R__unlikely(R__unzip_header(&nin, rawCompressedObjectBuffer, &nbuf) != 0)) {
+         Error("ReadBasketBuffers", "Inconsistency found in header (nin=%d, nbuf=%d)", nin, nbuf);
+      } else {
          if (R__unlikely(oldCase && (nin > fObjlen || nbuf > fObjlen))) {
             //buffer was very likely not compressed in an old version
             memcpy(rawUncompressedBuffer+fKeylen, rawCompressedObjectBuffer+fKeylen, fObjlen);
             goto AfterBuffer;
          }
 
-         R__unzip(&nin, rawCompressedObjectBuffer, &nbuf, (unsigned char*) rawUncompressedObjectBuffer, &nout);
-         if (!nout) break;
-         noutot += nout;
-         nintot += nin;
-         if (noutot >= fObjlen) break;
-         rawCompressedObjectBuffer += nin;
-         rawUncompressedObjectBuffer += nout;
+         // Unzip all the compressed objects in the compressed object buffer; those of baskets larger than
+         // kMAXZIPBUF are unzipped concurrently with IMT.
+         const std::vector<char> &dict = fBranch->GetCompressionDictionary();
+         nintot = fNbytes - fKeylen;
+         noutot = ROOT::Internal::UnzipBlocks(rawCompressedObjectBuffer, nintot, rawUncompressedObjectBuffer, fObjlen,
+                                              dict.data(), dict.size());
+         nout = noutot;
       }
 
       // Make sure the uncompressed numbers are consistent with header.
@@ -640,6 +811,9 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
          gPerfStats->UnzipEvent(fBranch->GetTree(),pos,start,nintot,fObjlen);
       }
       gPerfStats = temp;
+      if (R__unlikely(globalPerfStats)) {
+         globalPerfStats->BasketUnzipEvent(fBranch, nintot, fObjlen, start);
+      }
    } else {
       // Nothing is compressed - copy over wholesale.
       memcpy(rawUncompressedBuffer, rawCompressedBuffer, len);
@@ -648,6 +822,8 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
 AfterBuffer:
 
    fBranch->GetTree()->IncrementTotalBuffers(fBufferSize);
+   // The values are left in the order they were stored in until they are read, see EnsureBigEndianPayload().
+   fLittleEndianPayload = fIOBits & static_cast<UChar_t>(TBasket::EIOBits::kLittleEndianPayload);
 
    // Read offsets table if needed.
    // If there's no EntryOffsetLen in the branch -- or the fEntryOffset is marked to be calculated-on-demand --
@@ -659,14 +835,19 @@ AfterBuffer:
    ResetEntryOffset(); // TODO: every basket, we reset the offset array.  Is this necessary?
                        // Could we instead switch to std::vector?
    fBufferRef->SetBufferOffset(fLast);
-   fBufferRef->ReadArray(fEntryOffset);
+   const Bool_t deltaOffsets = fIOBits & static_cast<UChar_t>(TBasket::EIOBits::kDeltaOffsetMap);
+   if (deltaOffsets) {
+      fEntryOffset = R__ReadDeltaOffsets(*fBufferRef, fKeylen);
+   } else {
+      fBufferRef->ReadArray(fEntryOffset);
+   }
    if (R__unlikely(!fEntryOffset)) {
       fEntryOffset = new Int_t[fNevBuf+1];
       fEntryOffset[0] = fKeylen;
       Warning("ReadBasketBuffers","basket:%s has fNevBuf=%d but fEntryOffset=0, pos=%lld, len=%d, fNbytes=%d, fObjlen=%d, trying to repair",GetName(),fNevBuf,pos,len,fNbytes,fObjlen);
       return 0;
    }
-   if (fIOBits & static_cast<UChar_t>(TBasket::EIOBits::kGenerateOffsetMap)) {
+   if (!deltaOffsets && (fIOBits & static_cast<UChar_t>(TBasket::EIOBits::kGenerateOffsetMap))) {
       // In this case, we cannot regenerate the offset array at runtime -- but we wrote out an array of
       // sizes instead of offsets (as sizes compress much better).
       fEntryOffset[0] = fKeylen;
@@ -1102,7 +1283,12 @@ Int_t TBasket::WriteBuffer()
    Int_t *entryOffset = GetEntryOffset();
    if (entryOffset) {
       Bool_t hasOffsetBit = fIOBits & static_cast<UChar_t>(TBasket::EIOBits::kGenerateOffsetMap);
-      if (!CanGenerateOffsetArray()) {
+      Bool_t hasDeltaBit = fIOBits & static_cast<UChar_t>(TBasket::EIOBits::kDeltaOffsetMap);
+      if (hasDeltaBit && !(hasOffsetBit && CanGenerateOffsetArray())) {
+         // Unless the offsets can be regenerated at read time, write them as
+         // the variable-length encoded sizes of the entries.
+         R__WriteDeltaOffsets(*fBufferRef, entryOffset, fNevBuf + 1, fKeylen);
+      } else if (!CanGenerateOffsetArray()) {
          // If we have set the offset map flag, but cannot dynamically generate the map, then
          // we should at least convert the offset array to a size array.  Note that we always
          // write out (fNevBuf+1) entries to match the original case.
@@ -1131,7 +1317,14 @@ Int_t TBasket::WriteBuffer()
       }
    }
 
-   Int_t lbuf, nout, noutot, bufmax, nzip;
+   // The leaves stream the values in big-endian order: store them in little-endian order instead,
+   // and swap them back once written so that the basket can still be read from memory.
+   const Bool_t littleEndian = fIOBits & static_cast<UChar_t>(TBasket::EIOBits::kLittleEndianPayload);
+   if (littleEndian) {
+      SwapPayload();
+   }
+
+   Int_t lbuf, nout, noutot;
    lbuf       = fBufferRef->Length();
    fObjlen    = lbuf - fKeylen;
 
@@ -1145,53 +1338,50 @@ Int_t TBasket::WriteBuffer()
       InitializeCompressedBuffer(buflen, file);
       if (!fCompressedBufferRef) {
          Warning("WriteBuffer", "Unable to allocate the compressed buffer");
+         if (littleEndian) {
+            SwapPayload();
+         }
          return -1;
       }
       fCompressedBufferRef->SetWriteMode();
       fBuffer = fCompressedBufferRef->Buffer();
       char *objbuf = fBufferRef->Buffer() + fKeylen;
       char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else bufmax = kMAXZIPBUF;
-         // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
-         // for a given TFile: that's because the compression buffer when we use IMT is no longer
-         // shared amongst several threads.
+      if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTD)
+         fBranch->TrainCompressionDictionary(objbuf, fObjlen);
+      const std::vector<char> &dict = fBranch->GetCompressionDictionary();
+      // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
+      // for a given TFile: that's because the compression buffer when we use IMT is no longer
+      // shared amongst several threads.
 #ifdef R__USE_IMT
-         sentry.unlock();
+      sentry.unlock();
 #endif  // R__USE_IMT
-         // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
-         // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
-         // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+      // NOTE the compression routines are declared with C linkage, so they shouldn't except.  Also, when
+      // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
+      // (see fCompressedBufferRef in constructor).
+      // The blocks of baskets larger than kMAXZIPBUF are compressed concurrently with IMT.
+      noutot = ROOT::Internal::ZipBlocks(cxlevel, cxAlgorithm, objbuf, fObjlen, bufcur, dict.data(), dict.size());
 #ifdef R__USE_IMT
-         sentry.lock();
+      sentry.lock();
 #endif  // R__USE_IMT
 
-         // test if buffer has really been compressed. In case of small buffers
-         // when the buffer contains random data, it may happen that the compressed
-         // buffer is larger than the input. In this case, we write the original uncompressed buffer
-         if (nout == 0 || nout >= fObjlen) {
-            nout = fObjlen;
-            // We used to delete fBuffer here, we no longer want to since
-            // the buffer (held by fCompressedBufferRef) might be re-used later.
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen,file);
-            fBufferRef->SetBufferOffset(0);
-
-            Streamer(*fBufferRef);         //write key itself again
-            if ((nout+fKeylen)>buflen) {
-               Warning("WriteBuffer","Possible memory corruption due to compression algorithm, wrote %d bytes past the end of a block of %d bytes. fNbytes=%d, fObjLen=%d, fKeylen=%d",
-                  (nout+fKeylen-buflen),buflen,fNbytes,fObjlen,fKeylen);
-            }
-            goto WriteFile;
+      // test if buffer has really been compressed. In case of small buffers
+      // when the buffer contains random data, it may happen that the compressed
+      // buffer is larger than the input. In this case, we write the original uncompressed buffer
+      if (noutot == 0) {
+         nout = fObjlen;
+         // We used to delete fBuffer here, we no longer want to since
+         // the buffer (held by fCompressedBufferRef) might be re-used later.
+         fBuffer = fBufferRef->Buffer();
+         Create(fObjlen,file);
+         fBufferRef->SetBufferOffset(0);
+
+         Streamer(*fBufferRef);         //write key itself again
+         if ((nout+fKeylen)>buflen) {
+            Warning("WriteBuffer","Possible memory corruption due to compression algorithm, wrote %d bytes past the end of a block of %d bytes. fNbytes=%d, fObjLen=%d, fKeylen=%d",
+               (nout+fKeylen-buflen),buflen,fNbytes,fObjlen,fKeylen);
          }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
+         goto WriteFile;
       }
       nout = noutot;
       Create(noutot,file);
@@ -1210,6 +1400,9 @@ Int_t TBasket::WriteBuffer()
 
 WriteFile:
    Int_t nBytes = WriteFileKeepBuffer();
+   if (littleEndian) {
+      SwapPayload();
+   }
    fHeaderOnly = kFALSE;
    return nBytes>0 ? fKeylen+nout : -1;
 }
@@ -0,0 +1,146 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TBasketBufferPool.h"
+#include "TBufferFile.h"
+
+#include <algorithm>
+#include <array>
+
+namespace {
+
+constexpr int kMinLog2Size = 9;  // 512 bytes
+constexpr int kMaxLog2Size = 30; // 1 GByte
+constexpr int kNSizeClasses = 4 * (kMaxLog2Size - kMinLog2Size);
+
+/// The sizes of the buffers of each size class: 4, 5, 6 and 7 quarters of each power of two.
+std::array<Int_t, kNSizeClasses> MakeSizeClasses()
+{
+   std::array<Int_t, kNSizeClasses> sizes;
+   for (int i = 0; i < kNSizeClasses; ++i)
+      sizes[i] = (4 + i % 4) << (kMinLog2Size + i / 4 - 2);
+   return sizes;
+}
+
+const std::array<Int_t, kNSizeClasses> &GetSizeClasses()
+{
+   static const auto sizes = MakeSizeClasses();
+   return sizes;
+}
+
+} // anonymous namespace
+
+ROOT::Internal::TBasketBufferPool::TBasketBufferPool() : fFree(kNSizeClasses) {}
+
+ROOT::Internal::TBasketBufferPool::~TBasketBufferPool()
+{
+   ShrinkTo(0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a buffer of at least `size` bytes in the given mode, recycled if possible.
+/// The caller owns the buffer, and should give it back with Release().
+
+TBuffer *ROOT::Internal::TBasketBufferPool::Acquire(TBuffer::EMode mode, Int_t size)
+{
+   const auto &sizes = GetSizeClasses();
+   const auto sizeClass = std::lower_bound(sizes.begin(), sizes.end(), size) - sizes.begin();
+   TBuffer *buffer = nullptr;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      ++fRequests;
+      if (sizeClass < kNSizeClasses && !fFree[sizeClass].empty()) {
+         buffer = fFree[sizeClass].back();
+         fFree[sizeClass].pop_back();
+         fBytes -= buffer->BufferSize();
+         ++fHits;
+      }
+   }
+   if (!buffer) {
+      // Allocate the full size class, so that the buffer is recycled for requests of the same size.
+      return new TBufferFile(mode, sizeClass < kNSizeClasses ? sizes[sizeClass] : size);
+   }
+   if (mode == TBuffer::kRead)
+      buffer->SetReadMode();
+   else
+      buffer->SetWriteMode();
+   buffer->Reset();
+   return buffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Take ownership of a buffer given by a basket, and keep it for later use if
+/// the pool has room for it; otherwise delete it.
+
+void ROOT::Internal::TBasketBufferPool::Release(TBuffer *buffer)
+{
+   if (!buffer)
+      return;
+   // Buffers that do not own their memory, e.g. the ones pointing to the
+   // memory of the TTreeCacheUnzip or of the user, can not be recycled.
+   const auto &sizes = GetSizeClasses();
+   const Int_t size = buffer->BufferSize();
+   if (buffer->TestBit(TBuffer::kIsOwner) && size >= sizes.front()) {
+      const auto sizeClass = std::upper_bound(sizes.begin(), sizes.end(), size) - sizes.begin() - 1;
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (fBytes + size <= fMaxBytes) {
+         buffer->SetParent(nullptr);
+         fFree[sizeClass].push_back(buffer);
+         fBytes += size;
+         return;
+      }
+   }
+   delete buffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete recycled buffers, largest first, until they amount to at most `maxbytes`.
+
+void ROOT::Internal::TBasketBufferPool::ShrinkTo(Long64_t maxbytes)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   for (auto sizeClass = fFree.rbegin(); sizeClass != fFree.rend() && fBytes > maxbytes; ++sizeClass) {
+      while (!sizeClass->empty() && fBytes > maxbytes) {
+         fBytes -= sizeClass->back()->BufferSize();
+         delete sizeClass->back();
+         sizeClass->pop_back();
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the maximum memory held by the recycled buffers. Zero disables the recycling.
+
+void ROOT::Internal::TBasketBufferPool::SetMaxBytes(Long64_t maxbytes)
+{
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fMaxBytes = maxbytes;
+   }
+   ShrinkTo(maxbytes);
+}
+
+Long64_t ROOT::Internal::TBasketBufferPool::GetMaxBytes() const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   return fMaxBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the number of buffers requested, the number of requests served with a
+/// recycled buffer and the memory currently held by the recycled buffers.
+
+void ROOT::Internal::TBasketBufferPool::GetStats(ULong64_t &requests, ULong64_t &hits, Long64_t &bytes) const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   requests = fRequests;
+   hits = fHits;
+   bytes = fBytes;
+}
@@ -0,0 +1,61 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TBasketBufferPool
+#define ROOT_TBasketBufferPool
+
+#include "TBuffer.h"
+
+#include <mutex>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+/// A pool of the TBufferFile used by the baskets of a TTree to hold their
+/// compressed and uncompressed data, so that the buffers of the baskets that
+/// are dropped are recycled for the next baskets to be read instead of going
+/// back to the heap.
+///
+/// The buffers are sorted by size classes, spaced by a quarter of a power of two,
+/// so that a recycled buffer is at most 25% larger than the one requested.
+/// The pool is shared by the trees of a TChain and is thread safe, as baskets
+/// of different branches are read in parallel when IMT is enabled.
+class TBasketBufferPool {
+public:
+   static constexpr Long64_t kDefaultMaxBytes = 32 * 1024 * 1024;
+
+private:
+   mutable std::mutex fMutex;
+   std::vector<std::vector<TBuffer *>> fFree; ///< Recycled buffers, per size class
+   Long64_t fMaxBytes = kDefaultMaxBytes;     ///< Maximum memory held by the recycled buffers
+   Long64_t fBytes = 0;                       ///< Memory currently held by the recycled buffers
+   ULong64_t fRequests = 0;                   ///< Number of calls to Acquire
+   ULong64_t fHits = 0;                       ///< Number of calls to Acquire served with a recycled buffer
+
+   void ShrinkTo(Long64_t maxbytes);
+
+public:
+   TBasketBufferPool();
+   TBasketBufferPool(const TBasketBufferPool &) = delete;
+   TBasketBufferPool &operator=(const TBasketBufferPool &) = delete;
+   ~TBasketBufferPool();
+
+   TBuffer *Acquire(TBuffer::EMode mode, Int_t size);
+   void Release(TBuffer *buffer);
+   void SetMaxBytes(Long64_t maxbytes);
+   Long64_t GetMaxBytes() const;
+   void GetStats(ULong64_t &requests, ULong64_t &hits, Long64_t &bytes) const;
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_TBasketBufferPool
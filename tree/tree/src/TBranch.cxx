@@ -39,19 +39,25 @@
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TMath.h"
+#include "TTimeStamp.h"
 #include "TTree.h"
 #include "TTreeCache.h"
 #include "TTreeCacheUnzip.h"
 #include "TVirtualMutex.h"
 #include "TVirtualPad.h"
 #include "TVirtualPerfStats.h"
+#include "TVirtualCollectionProxy.h"
 
 #include "TBranchIMTHelper.h"
 
 #include "ROOT/TIOFeatures.hxx"
+#include "RZip.h"
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <cstddef>
+#include <limits>
 #include <string.h>
 #include <stdio.h>
 
@@ -110,6 +116,9 @@ TBranch::TBranch()
 , fBasketBytes(0)
 , fBasketEntry(0)
 , fBasketSeek(0)
+, fBasketMin(0)
+, fBasketMax(0)
+, fBasketSum(0)
 , fTree(0)
 , fMother(0)
 , fParent(0)
@@ -121,6 +130,7 @@ TBranch::TBranch()
 , fBrowsables(0)
 , fBulk(*this)
 , fSkipZip(kFALSE)
+, fCompressionDictSize(0)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
 {
@@ -221,6 +231,9 @@ TBranch::TBranch(TTree *tree, const char *name, void *address, const char *leafl
 , fBasketBytes(0)
 , fBasketEntry(0)
 , fBasketSeek(0)
+, fBasketMin(0)
+, fBasketMax(0)
+, fBasketSum(0)
 , fTree(tree)
 , fMother(0)
 , fParent(0)
@@ -232,6 +245,7 @@ TBranch::TBranch(TTree *tree, const char *name, void *address, const char *leafl
 , fBrowsables(0)
 , fBulk(*this)
 , fSkipZip(kFALSE)
+, fCompressionDictSize(0)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
 {
@@ -275,6 +289,9 @@ TBranch::TBranch(TBranch *parent, const char *name, void *address, const char *l
 , fBasketBytes(0)
 , fBasketEntry(0)
 , fBasketSeek(0)
+, fBasketMin(0)
+, fBasketMax(0)
+, fBasketSum(0)
 , fTree(parent ? parent->GetTree() : 0)
 , fMother(parent ? parent->GetMother() : 0)
 , fParent(parent)
@@ -286,6 +303,7 @@ TBranch::TBranch(TBranch *parent, const char *name, void *address, const char *l
 , fBrowsables(0)
 , fBulk(*this)
 , fSkipZip(kFALSE)
+, fCompressionDictSize(0)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
 {
@@ -448,6 +466,11 @@ TBranch::~TBranch()
    delete [] fBasketSeek;
    fBasketSeek  = 0;
 
+   delete [] fBasketMin;
+   delete [] fBasketMax;
+   delete [] fBasketSum;
+   fBasketMin = fBasketMax = fBasketSum = 0;
+
    delete [] fBasketEntry;
    fBasketEntry = 0;
 
@@ -567,10 +590,21 @@ void TBranch::AddBasket(TBasket& b, Bool_t ondisk, Long64_t startEntry)
             fBasketEntry[j] = fBasketEntry[j-1];
             fBasketBytes[j] = fBasketBytes[j-1];
             fBasketSeek[j]  = fBasketSeek[j-1];
+            if (fBasketSum) {
+               fBasketMin[j] = fBasketMin[j-1];
+               fBasketMax[j] = fBasketMax[j-1];
+               fBasketSum[j] = fBasketSum[j-1];
+            }
          }
       }
    }
    fBasketEntry[where] = startEntry;
+   if (fBasketSum) {
+      // The values of the added basket are not known
+      fBasketMin[where] = -std::numeric_limits<Double_t>::infinity();
+      fBasketMax[where] = std::numeric_limits<Double_t>::infinity();
+      fBasketSum[where] = std::numeric_limits<Double_t>::quiet_NaN();
+   }
 
    if (ondisk) {
       fBasketBytes[where] = basket->GetNbytes();  // not for in mem
@@ -807,6 +841,11 @@ void TBranch::ExpandBasketArrays()
                                                 newsize*sizeof(Long64_t),fMaxBaskets*sizeof(Long64_t));
    fBasketSeek   = (Long64_t*)TStorage::ReAlloc(fBasketSeek,
                                                 newsize*sizeof(Long64_t),fMaxBaskets*sizeof(Long64_t));
+   if (fBasketSum) {
+      fBasketMin = (Double_t*)TStorage::ReAlloc(fBasketMin, newsize*sizeof(Double_t), fMaxBaskets*sizeof(Double_t));
+      fBasketMax = (Double_t*)TStorage::ReAlloc(fBasketMax, newsize*sizeof(Double_t), fMaxBaskets*sizeof(Double_t));
+      fBasketSum = (Double_t*)TStorage::ReAlloc(fBasketSum, newsize*sizeof(Double_t), fMaxBaskets*sizeof(Double_t));
+   }
 
    fMaxBaskets   = newsize;
 
@@ -817,6 +856,7 @@ void TBranch::ExpandBasketArrays()
       fBasketEntry[i] = 0;
       fBasketSeek[i]  = 0;
    }
+   ResetBasketStatistics(fWriteBasket);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -862,12 +902,20 @@ Int_t TBranch::FillImpl(ROOT::Internal::TBranchIMTHelper *imtHelper)
 
    if (fEntryBuffer) {
       nbytes = FillEntryBuffer(basket,buf,lnew);
+      if (fBasketSum) {
+         // The values are not decoded from the entry buffer
+         ResetBasketStatistics(fWriteBasket);
+      }
    } else {
       Int_t lold = buf->Length();
+      const Bool_t firstEntry = basket->GetNevBuf() == 0;
       basket->Update(lold);
       ++fEntries;
       ++fEntryNumber;
       (this->*fFillLeaves)(*buf);
+      if (fBasketSum) {
+         FillBasketStatistics(firstEntry);
+      }
       if (buf->GetMapCount()) {
          // The map is used.
          ResetBit(TBranch::kDoNotUseBufferMap);
@@ -906,6 +954,47 @@ Int_t TBranch::FillImpl(ROOT::Internal::TBranchIMTHelper *imtHelper)
    return nbytes;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add the values of the leaf just filled to the statistics of the current
+/// basket, starting them if it is the first entry of the basket. The NaNs
+/// are ignored.
+
+void TBranch::FillBasketStatistics(Bool_t firstEntry)
+{
+   Double_t &min = fBasketMin[fWriteBasket];
+   Double_t &max = fBasketMax[fWriteBasket];
+   Double_t &sum = fBasketSum[fWriteBasket];
+   if (firstEntry) {
+      min = std::numeric_limits<Double_t>::infinity();
+      max = -std::numeric_limits<Double_t>::infinity();
+      sum = 0;
+   } else if (std::isnan(sum)) {
+      return;
+   }
+   TLeaf *leaf = (TLeaf*)fLeaves.UncheckedAt(0);
+   const Int_t len = leaf->GetLen();
+   for (Int_t i = 0; i < len; ++i) {
+      const Double_t value = leaf->GetValue(i);
+      if (std::isnan(value)) continue;
+      if (value < min) min = value;
+      if (value > max) max = value;
+      sum += value;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Mark the statistics of the baskets from first on as unknown.
+
+void TBranch::ResetBasketStatistics(Int_t first)
+{
+   if (!fBasketSum) return;
+   for (Int_t i = first; i < fMaxBaskets; ++i) {
+      fBasketMin[i] = -std::numeric_limits<Double_t>::infinity();
+      fBasketMax[i] = std::numeric_limits<Double_t>::infinity();
+      fBasketSum[i] = std::numeric_limits<Double_t>::quiet_NaN();
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy the data from fEntryBuffer into the current basket.
 
@@ -1282,6 +1371,75 @@ Long64_t TBranch::GetBasketSeek(Int_t basketnumber) const
    return fBasketSeek[basketnumber];
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Get the minimum, maximum and sum of the values of a basket, recorded when
+/// it was filled (see SetBasketStatistics()), without reading it.
+/// Returns kFALSE if they are not known: the statistics are not stored, the
+/// basket was copied from another tree (e.g. by the fast cloning) or it was
+/// filled before the statistics were enabled. The minimum is larger than the
+/// maximum if the basket has no values.
+
+Bool_t TBranch::GetBasketStatistics(Int_t basketnumber, Double_t &min, Double_t &max, Double_t &sum) const
+{
+   if (!fBasketSum || basketnumber < 0 || basketnumber > fWriteBasket) return kFALSE;
+   if (std::isnan(fBasketSum[basketnumber])) return kFALSE;
+   min = fBasketMin[basketnumber];
+   max = fBasketMax[basketnumber];
+   sum = fBasketSum[basketnumber];
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the ranges [first, last) of the entries of the baskets which may
+/// have values in [min, max], from the statistics of the baskets only: the
+/// entries out of these ranges have no value in [min, max] and need not be
+/// read. The baskets without statistics are always included.
+
+std::vector<std::pair<Long64_t, Long64_t>> TBranch::GetEntryRanges(Double_t min, Double_t max) const
+{
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   for (Int_t i = 0; i <= fWriteBasket && i < fMaxBaskets; ++i) {
+      const Long64_t first = fBasketEntry[i];
+      const Long64_t last = (i < fWriteBasket) ? fBasketEntry[i+1] : fEntryNumber;
+      if (last <= first) continue;
+      Double_t bmin, bmax, bsum;
+      if (GetBasketStatistics(i, bmin, bmax, bsum) && (bmax < min || bmin > max)) continue;
+      if (!ranges.empty() && ranges.back().second == first) {
+         ranges.back().second = last;
+      } else {
+         ranges.emplace_back(first, last);
+      }
+   }
+   return ranges;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the minimum, maximum and sum of all the values of the branch from the
+/// statistics of its baskets, without reading them (see SetBasketStatistics()).
+/// Returns kFALSE if the statistics of a basket are not known. The minimum is
+/// larger than the maximum if the branch has no values.
+
+Bool_t TBranch::GetStatistics(Double_t &min, Double_t &max, Double_t &sum) const
+{
+   if (!fBasketSum) return kFALSE;
+   Double_t tmin = std::numeric_limits<Double_t>::infinity();
+   Double_t tmax = -std::numeric_limits<Double_t>::infinity();
+   Double_t tsum = 0;
+   for (Int_t i = 0; i <= fWriteBasket && i < fMaxBaskets; ++i) {
+      const Long64_t last = (i < fWriteBasket) ? fBasketEntry[i+1] : fEntryNumber;
+      if (last <= fBasketEntry[i]) continue;
+      Double_t bmin, bmax, bsum;
+      if (!GetBasketStatistics(i, bmin, bmax, bsum)) return kFALSE;
+      tmin = std::min(tmin, bmin);
+      tmax = std::max(tmax, bmax);
+      tsum += bsum;
+   }
+   min = tmin;
+   max = tmax;
+   sum = tsum;
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns (and, if 0, creates) browsable objects for this branch
 /// See TVirtualBranchBrowsable::FillListOfBrowsables.
@@ -1331,6 +1489,10 @@ Int_t TBranch::GetBasketAndFirst(TBasket *&basket, Long64_t &first,
    if (R__likely(fCurrentBasket && fFirstBasketEntry <= entry && entry < fNextBasketEntry)) {
       // We have found the basket containing this entry.
       // make sure basket buffers are in memory.
+      if (user_buffer) {
+         // The values of this basket are not in the user buffer, see below.
+         return -1;
+      }
       basket = fCurrentBasket;
       first = fFirstBasketEntry;
    } else {
@@ -1358,6 +1520,11 @@ Int_t TBranch::GetBasketAndFirst(TBasket *&basket, Long64_t &first,
       // We have found the basket containing this entry.
       // make sure basket buffers are in memory.
       basket = (TBasket*) fBaskets.UncheckedAt(fReadBasket);
+      if (basket && user_buffer) {
+         // For bulk IO the basket must be read into the user buffer: one that is
+         // already in memory, e.g. because of a previous GetEntry(), cannot be used.
+         return -1;
+      }
       if (!basket) {
          basket = GetBasketImpl(fReadBasket, user_buffer);
          if (!basket) {
@@ -1366,7 +1533,7 @@ Int_t TBranch::GetBasketAndFirst(TBasket *&basket, Long64_t &first,
             fNextBasketEntry = -1;
             return -1;
          }
-         if (fTree->GetClusterPrefetch()) {
+         if (fTree->GetClusterPrefetch() && !user_buffer) {
             TTree::TClusterIterator clusterIterator = fTree->GetClusterIterator(entry);
             clusterIterator.Next();
             Int_t nextClusterEntry = clusterIterator.GetNextEntry();
@@ -1464,7 +1631,15 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
 
    Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
    //printf("Requesting %d events; fNextBasketEntry=%lld; first=%lld.\n", N, fNextBasketEntry, first);
-   if (R__unlikely(!leaf->ReadBasketFast(*buf, N))) {
+   // Baskets stored with the kLittleEndianPayload feature already hold the values in memory order
+   // on little-endian machines: they are used in place, without being byte-swapped.
+#ifdef R__BYTESWAP
+   const Bool_t inMemoryOrder = basket->HasLittleEndianPayload();
+#else
+   basket->EnsureBigEndianPayload();
+   const Bool_t inMemoryOrder = kFALSE;
+#endif
+   if (R__unlikely(!inMemoryOrder && !leaf->ReadBasketFast(*buf, N))) {
       Error("GetBulkEntries", "Leaf failed to read.\n");
       return -1;
    }
@@ -1479,6 +1654,174 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
    return N;
 }
 
+namespace {
+
+/// The layout of the entries of a branch holding a variable number of primitive values per entry
+struct JaggedLayout {
+   Int_t fValueSize = 0;   ///< Size of one value on disk and in memory
+   Int_t fHeaderSize = 0;  ///< Bytes before the first value of an entry: byte count, version and size of a std::vector
+   EDataType fSwapType = kOther_t; ///< The type whose byte swapping applies to the values, kChar_t if none is needed
+};
+
+/// Find the layout of the entries of the branch, which must have a single leaf. Returns false if the branch does not
+/// hold either a variable-length array with a counter leaf, or an unsplit std::vector of numerical values.
+bool GetJaggedLayout(TBranch &branch, TLeaf &leaf, JaggedLayout &layout)
+{
+   TClass *cl = nullptr;
+   EDataType type = kOther_t;
+   if (branch.GetExpectedType(cl, type))
+      return false;
+   if (cl) {
+      auto proxy = cl->GetCollectionProxy();
+      if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->GetValueClass() ||
+          branch.GetListOfBranches()->GetEntriesFast() > 0)
+         return false;
+      type = proxy->GetType();
+      layout.fHeaderSize = sizeof(UInt_t) + sizeof(Version_t) + sizeof(Int_t);
+   } else if (!leaf.GetLeafCount() || leaf.GetDeserializeType() == TLeaf::DeserializeType::kDestructive) {
+      return false;
+   }
+
+   switch (type) {
+   // these are stored with a different size or encoding than in memory
+   case kBool_t:
+   case kLong_t:
+   case kULong_t:
+   case kFloat16_t:
+   case kDouble32_t: return false;
+   default: break;
+   }
+   auto dataType = TDataType::GetDataType(type);
+   if (!dataType)
+      return false;
+   layout.fValueSize = dataType->Size();
+   switch (layout.fValueSize) {
+   case 1: layout.fSwapType = kChar_t; break;
+   case 2: layout.fSwapType = kShort_t; break;
+   case 4: layout.fSwapType = kInt_t; break;
+   case 8: layout.fSwapType = kLong64_t; break;
+   default: return false;
+   }
+   return true;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read as many events as possible of a branch holding a variable number of
+/// primitive values per entry, i.e. a variable-length array with a counter
+/// leaf (e.g. "x[n]/F") or an unsplit std::vector of numerical values.
+///
+/// Returns -1 in case of a failure, in which case the caller should fall back
+/// to GetEntry.  On success, returns the number of events N read from the
+/// basket starting at entry, which must be the first entry of a basket.
+///
+/// The values of all N events are placed contiguously in the buffer, in
+/// memory byte order, and can be accessed as
+///
+/// static_cast<T*>(buf.GetCurrent())
+///
+/// The values of event i are the ones in [offsets[i], offsets[i+1]): offsets
+/// is resized to N+1 elements, offsets[N] being the total number of values.
+/// Multi-dimensional arrays with a variable first dimension (e.g. "x[n][3]/F")
+/// are returned flattened.
+///
+/// NOTES:
+/// - This interface is meant to be used by higher-level, type-safe wrappers, not
+///   by end-users.
+/// - The values are compacted and byte-swapped in place, in the memory of the
+///   basket: no per-entry streaming takes place.
+
+Int_t TBranch::GetBulkEntriesJagged(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets)
+{
+   if (R__unlikely(fNleaves != 1)) return -1;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   JaggedLayout layout;
+   if (R__unlikely(!GetJaggedLayout(*this, *leaf, layout))) return -1;
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   Bool_t enabled = !TestBit(kDoNotProcess);
+   if (R__unlikely(!enabled)) return -1;
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result <= 0)) return -1;
+   // Only support reading from full clusters.
+   if (R__unlikely(entry != first)) return -1;
+
+   basket->PrepareBasket(entry);
+   TBuffer* buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetBulkEntriesJagged", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetBulkEntriesJagged", "Basket has displacement.\n");
+      return -1;
+   }
+   Int_t *entryOffsets = basket->GetEntryOffset();
+   if (R__unlikely(!entryOffsets)) {
+      Error("GetBulkEntriesJagged", "Basket has no entry offsets.\n");
+      return -1;
+   }
+
+   Int_t bufbegin = basket->GetKeylen();
+   Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+
+   // Move the values of each entry right after the ones of the previous entry, dropping the headers if any
+   const UInt_t byteCountMask = 0x40000000; // as in TBufferFile
+   char *data = buf->Buffer();
+   char *out = data + bufbegin;
+   offsets.resize(N + 1);
+   offsets[0] = 0;
+   for (Int_t i = 0; i < N; ++i) {
+      const Int_t begin = entryOffsets[i];
+      const Int_t end = (i + 1 < N) ? entryOffsets[i + 1] : basket->GetLast();
+      char *in = data + begin;
+      Int_t nBytes = end - begin;
+      if (layout.fHeaderSize) {
+         UInt_t byteCount;
+         Version_t version;
+         Int_t nValues;
+         frombuf(in, &byteCount);
+         frombuf(in, &version);
+         frombuf(in, &nValues);
+         nBytes -= layout.fHeaderSize;
+         const Bool_t validByteCount =
+            (byteCount & byteCountMask) && (byteCount & ~byteCountMask) + sizeof(UInt_t) == UInt_t(end - begin);
+         if (R__unlikely(!validByteCount || nValues < 0 || nValues * layout.fValueSize != nBytes)) {
+            Error("GetBulkEntriesJagged", "Unexpected layout of entry %lld.\n", first + i);
+            return -1;
+         }
+      } else if (R__unlikely(nBytes < 0 || nBytes % layout.fValueSize)) {
+         Error("GetBulkEntriesJagged", "Unexpected layout of entry %lld.\n", first + i);
+         return -1;
+      }
+      if (out != in)
+         memmove(out, in, nBytes);
+      out += nBytes;
+      offsets[i + 1] = offsets[i] + nBytes / layout.fValueSize;
+   }
+
+   buf->SetBufferOffset(bufbegin);
+   if (layout.fSwapType != kChar_t)
+      buf->ByteSwapBuffer(offsets[N], layout.fSwapType);
+   user_buf.SetBufferOffset(bufbegin);
+
+   fCurrentBasket = nullptr;
+   fBaskets[fReadBasket] = nullptr;
+   R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+   fExtraBasket = basket;
+   basket->DisownBuffer();
+
+   return N;
+}
+
 // TODO: Template this and the call above; only difference is the TLeaf function (ReadBasketFast vs
 // ReadBasketSerialized
 Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *count_buf)
@@ -1520,6 +1863,7 @@ Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *
       return -1;
    }
 
+   basket->EnsureBigEndianPayload();
    Int_t bufbegin = basket->GetKeylen();
    buf->SetBufferOffset(bufbegin);
 
@@ -1600,6 +1944,7 @@ Int_t TBranch::GetEntry(Long64_t entry, Int_t getall)
       basket->ReadBasketBuffers(fBasketSeek[fReadBasket], fBasketBytes[fReadBasket], file);
       buf = basket->GetBufferRef();
    }
+   basket->EnsureBigEndianPayload();
 
    // Set entry offset in buffer.
    if (!TestBit(kDoNotUseBufferMap)) {
@@ -1624,7 +1969,14 @@ Int_t TBranch::GetEntry(Long64_t entry, Int_t getall)
    }
 
    // Int_t bufbegin = buf->Length();
-   (this->*fReadLeaves)(*buf);
+   TVirtualPerfStats *globalPerfStats = TVirtualPerfStats::GetGlobalPerfStats();
+   if (R__unlikely(globalPerfStats)) {
+      Double_t start = TTimeStamp();
+      (this->*fReadLeaves)(*buf);
+      globalPerfStats->BranchReadEvent(this, buf->Length() - bufbegin, start);
+   } else {
+      (this->*fReadLeaves)(*buf);
+   }
    return buf->Length() - bufbegin;
 }
 
@@ -1673,6 +2025,7 @@ Int_t TBranch::GetEntryExport(Long64_t entry, Int_t /*getall*/, TClonesArray* li
       return 0;
    }
    TBuffer* buf = basket->GetBufferRef();
+   basket->EnsureBigEndianPayload();
    // Set entry offset in buffer and read data from all leaves.
    if (!TestBit(kDoNotUseBufferMap)) {
       buf->ResetMap();
@@ -2099,6 +2452,8 @@ void TBranch::KeepCircular(Long64_t maxEntries)
    Int_t dentries = (Int_t) (fEntries - maxEntries);
    TBasket* basket = (TBasket*) fBaskets.UncheckedAt(0);
    if (basket) basket->MoveEntries(dentries);
+   // The values removed from the basket cannot be removed from its statistics
+   ResetBasketStatistics(0);
    fEntries = maxEntries;
    fEntryNumber = maxEntries;
    //loop on sub branches
@@ -2239,6 +2594,13 @@ void TBranch::Print(Option_t *option) const
    }
    Printf("*Baskets :%9d : Basket Size=%11d bytes  Compression= %6.2f     *",fWriteBasket,fBasketSize,cx);
 
+   Double_t vmin, vmax, vsum;
+   if (GetStatistics(vmin, vmax, vsum) && vmin <= vmax) {
+      TString sline = TString::Format("*Values  : Min=%12g  Max=%12g  Sum=%14g", vmin, vmax, vsum);
+      while (sline.Length() < kLINEND) sline += ' ';
+      Printf("%s*", sline.Data());
+   }
+
    if (strncmp(option,"basketsInfo",strlen("basketsInfo"))==0) {
       Int_t nbaskets = fWriteBasket;
       for (Int_t i=0;i<nbaskets;i++) {
@@ -2347,6 +2709,18 @@ void TBranch::Refresh(TBranch* b)
       fBasketEntry[i] = b->fBasketEntry[i];
       fBasketSeek[i]  = b->fBasketSeek[i];
    }
+   delete [] fBasketMin;
+   delete [] fBasketMax;
+   delete [] fBasketSum;
+   fBasketMin = fBasketMax = fBasketSum = 0;
+   if (b->fBasketSum) {
+      fBasketMin = new Double_t[fMaxBaskets];
+      fBasketMax = new Double_t[fMaxBaskets];
+      fBasketSum = new Double_t[fMaxBaskets];
+      std::copy(b->fBasketMin, b->fBasketMin + fMaxBaskets, fBasketMin);
+      std::copy(b->fBasketMax, b->fBasketMax + fMaxBaskets, fBasketMax);
+      std::copy(b->fBasketSum, b->fBasketSum + fMaxBaskets, fBasketSum);
+   }
    fBaskets.Delete();
    Int_t nbaskets = b->fBaskets.GetSize();
    fBaskets.Expand(nbaskets);
@@ -2399,6 +2773,8 @@ void TBranch::Reset(Option_t*)
       }
    }
 
+   ResetBasketStatistics(0);
+
    fBaskets.Delete();
    fNBaskets = 0;
 }
@@ -2440,6 +2816,8 @@ void TBranch::ResetAfterMerge(TFileMergeInfo *)
       }
    }
 
+   ResetBasketStatistics(0);
+
    TBasket *reusebasket = (TBasket*)fBaskets[fWriteBasket];
    if (reusebasket) {
       fBaskets[fWriteBasket] = 0;
@@ -2536,6 +2914,37 @@ void TBranch::SetAutoDelete(Bool_t autodel)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Store (or, with on = kFALSE, no longer store) the minimum, maximum and sum
+/// of the values of each basket when it is filled. They are saved with the
+/// branch and allow GetStatistics(), TTree::GetMinimum(), TTree::GetMaximum()
+/// and TTree::Print() to answer without reading the baskets, and
+/// GetEntryRanges() to skip the baskets which cannot satisfy a selection.
+///
+/// Only the branches of a single numerical leaf (e.g. "x/D" or "v[n]/F"),
+/// not the branches of objects, support the statistics: kFALSE is returned
+/// for the others. The statistics of the baskets already filled are unknown.
+
+Bool_t TBranch::SetBasketStatistics(Bool_t on)
+{
+   if (!on) {
+      delete [] fBasketMin;
+      delete [] fBasketMax;
+      delete [] fBasketSum;
+      fBasketMin = fBasketMax = fBasketSum = 0;
+      return kTRUE;
+   }
+   if (fBasketSum) return kTRUE;
+   if (IsA() != TBranch::Class() || fNleaves != 1 || fLeaves.UncheckedAt(0)->IsA() == TLeafC::Class()) {
+      return kFALSE;
+   }
+   fBasketMin = new Double_t[fMaxBaskets];
+   fBasketMax = new Double_t[fMaxBaskets];
+   fBasketSum = new Double_t[fMaxBaskets];
+   ResetBasketStatistics(0);
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the basket size
 /// The function makes sure that the basket size is greater than fEntryOffsetlen
@@ -2627,6 +3036,61 @@ void TBranch::SetCompressionSettings(Int_t settings)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the baskets of this branch and of its sub-branches with a dictionary
+/// of at most `maxsize` bytes, trained on the content of the first basket written.
+///
+/// A dictionary improves the compression of small baskets whose content is similar
+/// from one basket to the next, from which the compression algorithm has otherwise
+/// too little data to learn. It is stored with the branch and only used with the
+/// ZSTD algorithm; baskets compressed with it cannot be read by versions of ROOT
+/// that do not support dictionaries. A `maxsize` of 0 disables the training; it has
+/// no effect on a dictionary that was already trained.
+
+void TBranch::SetCompressionDictionarySize(Int_t maxsize)
+{
+   fCompressionDictSize = maxsize > 0 ? maxsize : 0;
+
+   Int_t nb = fBranches.GetEntriesFast();
+   for (Int_t i=0;i<nb;i++) {
+      TBranch *branch = (TBranch*)fBranches.UncheckedAt(i);
+      branch->SetCompressionDictionarySize(maxsize);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Train the compression dictionary of this branch on the `len` bytes of `buffer`,
+/// the uncompressed content of its first basket, if it was requested with
+/// SetCompressionDictionarySize() and not trained yet. Called by TBasket::WriteBuffer.
+///
+/// If the basket is too small to train a dictionary, its beginning is used as
+/// the dictionary instead (a "raw content" dictionary).
+
+void TBranch::TrainCompressionDictionary(const char *buffer, Int_t len)
+{
+   if (!fCompressionDictSize || !fCompressionDict.empty() || len <= 0)
+      return;
+
+   // Split the basket in samples of a few entries worth of data.
+   const Int_t kSampleSize = 1024;
+   const Int_t nsamples = 1 + (len - 1) / kSampleSize;
+   std::vector<size_t> sizes(nsamples, kSampleSize);
+   sizes.back() = len - (nsamples - 1) * kSampleSize;
+
+   fCompressionDict.resize(fCompressionDictSize);
+   Int_t size = R__trainZSTDDictionary(buffer, sizes.data(), nsamples, fCompressionDict.data(), fCompressionDictSize);
+   const Bool_t trained = size > 0;
+   if (!trained) {
+      size = std::min(len, fCompressionDictSize);
+      std::copy(buffer, buffer + size, fCompressionDict.begin());
+   }
+   fCompressionDict.resize(size);
+   fCompressionDict.shrink_to_fit();
+   if (gDebug > 0)
+      Info("TrainCompressionDictionary", "Branch %s: %s dictionary of %d bytes from a basket of %d bytes", GetName(),
+           trained ? "trained" : "raw content", size, len);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Update the default value for the branch's fEntryOffsetLen if and only if
 /// it was already non zero (and the new value is not zero)
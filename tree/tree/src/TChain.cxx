@@ -27,6 +27,11 @@ the trees in the chain.
 #include "TChain.h"
 
 #include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
 
 #include "TBranch.h"
 #include "TBrowser.h"
@@ -58,6 +63,10 @@ the trees in the chain.
 #include "TFileStager.h"
 #include "TFilePrefetch.h"
 #include "TVirtualMutex.h"
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 ClassImp(TChain);
 
@@ -927,6 +936,177 @@ TTree::TClusterIterator TChain::GetClusterIterator(Long64_t /* firstentry */)
    return TTree::GetClusterIterator(-1);
 }
 
+namespace {
+
+/// Identifies the tree of a chain element in the entry count cache: file URL, tree name and modification time
+using EntryCountKey_t = std::tuple<std::string, std::string, Long64_t>;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the entry count cache, return an empty one if the file does not exist.
+
+std::map<EntryCountKey_t, Long64_t> ReadEntryCountCache(const char *filename)
+{
+   std::map<EntryCountKey_t, Long64_t> cache;
+   if (gSystem->AccessPathName(filename))
+      return cache;
+   TDirectory::TContext ctxt;
+   std::unique_ptr<TFile> file(TFile::Open(filename));
+   TTree *tree = nullptr;
+   if (file && !file->IsZombie())
+      file->GetObject("EntryCountCache", tree);
+   if (!tree) {
+      ::Error("TChain::ReadEntryCountCache", "File %s does not contain an entry count cache", filename);
+      return cache;
+   }
+   std::string *url = nullptr, *treeName = nullptr;
+   Long64_t mtime = 0, entries = 0;
+   tree->SetBranchAddress("url", &url);
+   tree->SetBranchAddress("treeName", &treeName);
+   tree->SetBranchAddress("mtime", &mtime);
+   tree->SetBranchAddress("entries", &entries);
+   for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+      tree->GetEntry(i);
+      cache[EntryCountKey_t(*url, *treeName, mtime)] = entries;
+   }
+   tree->ResetBranchAddresses();
+   delete url;
+   delete treeName;
+   return cache;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the entry count cache, replacing the previous contents of the file.
+
+void WriteEntryCountCache(const char *filename, const std::map<EntryCountKey_t, Long64_t> &cache)
+{
+   TDirectory::TContext ctxt;
+   std::unique_ptr<TFile> file(TFile::Open(filename, "RECREATE"));
+   if (!file || file->IsZombie()) {
+      ::Error("TChain::WriteEntryCountCache", "Cannot write the entry count cache to %s", filename);
+      return;
+   }
+   std::string url, treeName;
+   Long64_t mtime = 0, entries = 0;
+   TTree tree("EntryCountCache", "Number of entries of the trees of TChains");
+   tree.Branch("url", &url);
+   tree.Branch("treeName", &treeName);
+   tree.Branch("mtime", &mtime);
+   tree.Branch("entries", &entries);
+   for (const auto &count : cache) {
+      std::tie(url, treeName, mtime) = count.first;
+      entries = count.second;
+      tree.Fill();
+   }
+   tree.Write();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Open the file of a chain element and return the number of entries of its
+/// tree, or TTree::kMaxEntries if it cannot be read.
+
+Long64_t ReadEntryCount(const TChainElement &element)
+{
+   TDirectory::TContext ctxt;
+   std::unique_ptr<TFile> file(TFile::Open(element.GetTitle()));
+   if (!file || file->IsZombie())
+      return TTree::kMaxEntries;
+   auto tree = dynamic_cast<TTree *>(file->Get(element.GetName()));
+   return tree ? tree->GetEntries() : TTree::kMaxEntries;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the offsets of the trees whose number of entries is not yet known,
+/// without loading them.
+///
+/// The numbers of entries are taken from the entry count cache if one is set
+/// (see SetEntryCountCache()), the files are opened otherwise: concurrently,
+/// by the tasks of the implicit multi-threading pool, if it is enabled. The
+/// offsets that could not be filled, e.g. because a file is missing, are left
+/// to LoadTree(), with its usual diagnostics.
+
+void TChain::FillTreeOffsets()
+{
+   std::vector<Int_t> unknown;
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      if (static_cast<TChainElement *>(fFiles->UncheckedAt(i))->GetEntries() == TTree::kMaxEntries)
+         unknown.push_back(i);
+   }
+   Bool_t useIMT = kFALSE;
+#ifdef R__USE_IMT
+   useIMT = ROOT::IsImplicitMTEnabled() && unknown.size() > 1;
+#endif
+   const Bool_t useCache = !fEntryCountCache.IsNull();
+   // Without cache nor threads, LoadTree() opens the files the same way
+   if (unknown.empty() || (!useIMT && !useCache))
+      return;
+
+   std::map<EntryCountKey_t, Long64_t> cache;
+   std::vector<Long64_t> mtimes(unknown.size(), -1);
+   if (useCache) {
+      cache = ReadEntryCountCache(fEntryCountCache);
+      for (std::size_t i = 0; i < unknown.size(); ++i) {
+         FileStat_t stat;
+         if (gSystem->GetPathInfo(fFiles->UncheckedAt(unknown[i])->GetTitle(), stat) == 0)
+            mtimes[i] = stat.fMtime;
+      }
+   }
+
+   std::vector<Long64_t> entries(unknown.size(), TTree::kMaxEntries);
+   std::vector<std::size_t> toOpen;
+   for (std::size_t i = 0; i < unknown.size(); ++i) {
+      auto element = static_cast<TChainElement *>(fFiles->UncheckedAt(unknown[i]));
+      auto cached = mtimes[i] < 0 ? cache.end()
+                                  : cache.find(EntryCountKey_t(element->GetTitle(), element->GetName(), mtimes[i]));
+      if (cached != cache.end())
+         entries[i] = cached->second;
+      else
+         toOpen.push_back(i);
+   }
+
+   auto readEntries = [&](std::size_t i) {
+      entries[toOpen[i]] = ReadEntryCount(*static_cast<TChainElement *>(fFiles->UncheckedAt(unknown[toOpen[i]])));
+   };
+#ifdef R__USE_IMT
+   if (useIMT && toOpen.size() > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(readEntries, ROOT::TSeq<std::size_t>(toOpen.size()));
+   } else
+#endif
+   {
+      for (std::size_t i = 0; i < toOpen.size(); ++i)
+         readEntries(i);
+   }
+
+   Bool_t cacheUpdated = kFALSE;
+   for (std::size_t i = 0; i < unknown.size(); ++i) {
+      if (entries[i] == TTree::kMaxEntries)
+         continue;
+      auto element = static_cast<TChainElement *>(fFiles->UncheckedAt(unknown[i]));
+      element->SetNumberEntries(entries[i]);
+      if (mtimes[i] >= 0) {
+         const EntryCountKey_t key(element->GetTitle(), element->GetName(), mtimes[i]);
+         auto cached = cache.find(key);
+         if (cached == cache.end() || cached->second != entries[i]) {
+            cache[key] = entries[i];
+            cacheUpdated = kTRUE;
+         }
+      }
+   }
+   if (cacheUpdated)
+      WriteEntryCountCache(fEntryCountCache, cache);
+
+   // Fill the offsets up to the first tree whose number of entries is still unknown
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      const auto n = static_cast<TChainElement *>(fFiles->UncheckedAt(i))->GetEntries();
+      if (n == TTree::kMaxEntries)
+         return;
+      fTreeOffset[i + 1] = fTreeOffset[i] + n;
+   }
+   fEntries = fTreeOffset[fNtrees];
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return absolute entry number in the chain.
 /// The input parameter entry is the entry number in
@@ -951,6 +1131,9 @@ Long64_t TChain::GetEntries() const
                                " run TChain::SetProof(kTRUE, kTRUE) first");
       return fProofChain->GetEntries();
    }
+   if (fEntries == TTree::kMaxEntries) {
+      const_cast<TChain*>(this)->FillTreeOffsets();
+   }
    if (fEntries == TTree::kMaxEntries) {
       const_cast<TChain*>(this)->LoadTree(TTree::kMaxEntries-1);
    }
@@ -1620,6 +1803,7 @@ Long64_t TChain::LoadTree(Long64_t entry)
 
    fTree->SetMakeClass(fMakeClass);
    fTree->SetMaxVirtualSize(fMaxVirtualSize);
+   fTree->ShareBasketBufferPool(this);
 
    SetChainOffset(fTreeOffset[fTreeNumber]);
 
@@ -2597,6 +2781,22 @@ void TChain::SetDirectory(TDirectory* dir)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the file caching the number of entries of the trees of the chain.
+///
+/// When the total number of entries of the chain is needed (see GetEntries()),
+/// the number of entries of the trees whose file is listed in the cache, with
+/// the same modification time, is taken from the cache instead of opening the
+/// file. The cache is then updated with the trees whose files were opened.
+/// The cache is a ROOT file, which can be shared by several chains and
+/// jobs; it is created if it does not exist. An empty filename disables the
+/// cache.
+
+void TChain::SetEntryCountCache(const char *filename)
+{
+   fEntryCountCache = filename ? filename : "";
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the input entry list (processing the entries of the chain will then be
 /// limited to the entries in the list).
@@ -46,6 +46,9 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <bitset>
+#include <vector>
+
 ClassImp(TEntryListBlock);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -242,7 +245,7 @@ Int_t TEntryListBlock::Contains(Int_t entry)
 
 Int_t TEntryListBlock::Merge(TEntryListBlock *block)
 {
-   Int_t i, j;
+   Int_t i;
    if (block->GetNPassed() == 0) return GetNPassed();
    if (GetNPassed() == 0){
       //this block is empty
@@ -260,34 +263,18 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
    }
    if (fType==0){
       //stored as bits
-      if (block->fType == 0){
-         for (i=0; i<kBlockSize*16; i++){
-            if (block->Contains(i))
-               Enter(i);
+      if (block->fType == 1 && block->fPassing){
+         //the other block stores the few entries that pass
+         for (i=0; i<block->fNPassed; i++){
+            Enter(block->fIndices[i]);
          }
       } else {
-         if (block->fPassing){
-            //the other block stores entries that pass
-            for (i=0; i<block->fNPassed; i++){
-               Enter(block->fIndices[i]);
-            }
-         } else {
-            //the other block stores entries that don't pass
-            if (block->fNPassed==0){
-               for (i=0; i<kBlockSize*16; i++){
-                  Enter(i);
-               }
-            }
-            for (j=0; j<block->fIndices[0]; j++)
-               Enter(j);
-            for (i=0; i<block->fNPassed-1; i++){
-               for (j=block->fIndices[i]+1; j<block->fIndices[i+1]; j++){
-                  Enter(j);
-               }
-            }
-            for (j=block->fIndices[block->fNPassed-1]+1; j<kBlockSize*16; j++)
-               Enter(j);
-         }
+         //combine the bits word by word
+         std::vector<UShort_t> bits(kBlockSize);
+         block->FillBits(bits.data());
+         for (i=0; i<kBlockSize; i++)
+            fIndices[i] |= bits[i];
+         CountBits();
       }
    } else {
       //stored as a list
@@ -363,6 +350,59 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
    return GetNPassed();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the entries of the other block from this block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Subtract(TEntryListBlock *block)
+{
+   if (GetNPassed() == 0 || block->GetNPassed() == 0) return GetNPassed();
+   if (fType==1){
+      //change to bits
+      UShort_t *bits = new UShort_t[kBlockSize];
+      Transform(1, bits);
+   }
+   std::vector<UShort_t> bits(kBlockSize);
+   block->FillBits(bits.data());
+   for (Int_t i=0; i<kBlockSize; i++)
+      fIndices[i] &= ~bits[i];
+   CountBits();
+   fLastIndexQueried = -1;
+   fLastIndexReturned = -1;
+   OptimizeStorage();
+   return GetNPassed();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the bits representation of the entries of this block, whatever its
+/// storage, to the kBlockSize words of `bits`
+
+void TEntryListBlock::FillBits(UShort_t *bits) const
+{
+   Int_t i;
+   if (fType==0 && fIndices){
+      for (i=0; i<kBlockSize; i++)
+         bits[i] = fIndices[i];
+      return;
+   }
+   const UShort_t init = fPassing ? 0 : 65535;
+   for (i=0; i<kBlockSize; i++)
+      bits[i] = init;
+   if (!fIndices) return;
+   for (i=0; i<fNPassed; i++)
+      bits[fIndices[i]>>4] ^= 1<<(fIndices[i] & 15);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Recompute the number of passing entries of the bits representation
+
+void TEntryListBlock::CountBits()
+{
+   fNPassed = 0;
+   for (Int_t i=0; i<kBlockSize; i++)
+      fNPassed += std::bitset<16>(fIndices[i]).count();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the number of entries, passing the selection.
 /// In case, when the block stores entries that pass (fPassing=1) returns fNPassed
@@ -360,6 +360,7 @@ End_Macro
 #include "TBufferFile.h"
 #include "TBaseClass.h"
 #include "TBasket.h"
+#include "TBasketBufferPool.h"
 #include "TBranchClones.h"
 #include "TBranchElement.h"
 #include "TBranchObject.h"
@@ -392,6 +393,7 @@ End_Macro
 #include "TLeafS.h"
 #include "TList.h"
 #include "TMath.h"
+#include "TMemoryAccounting.h"
 #include "TROOT.h"
 #include "TRealData.h"
 #include "TRegexp.h"
@@ -425,6 +427,7 @@ End_Macro
 #include <stdio.h>
 #include <limits.h>
 #include <algorithm>
+#include <cmath>
 
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
@@ -433,6 +436,7 @@ End_Macro
 
 constexpr Int_t   kNEntriesResort    = 100;
 constexpr Float_t kNEntriesResortInv = 1.f/kNEntriesResort;
+constexpr UInt_t  kNBranchTasksPerThread = 4;
 
 Int_t    TTree::fgBranchStyle = 1;  // Use new TBranch style with TBranchElement.
 Long64_t TTree::fgMaxTreeSize = 100000000000LL;
@@ -776,6 +780,7 @@ TTree::TTree()
 , fCacheUserSet(kFALSE)
 , fIMTEnabled(ROOT::IsImplicitMTEnabled())
 , fNEntriesSinceSorting(0)
+, fBasketBufferPool(std::make_shared<ROOT::Internal::TBasketBufferPool>())
 {
    fMaxEntries = 1000000000;
    fMaxEntries *= 1000;
@@ -857,6 +862,7 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
 , fCacheUserSet(kFALSE)
 , fIMTEnabled(ROOT::IsImplicitMTEnabled())
 , fNEntriesSinceSorting(0)
+, fBasketBufferPool(std::make_shared<ROOT::Internal::TBasketBufferPool>())
 {
    // TAttLine state.
    SetLineColor(gStyle->GetHistLineColor());
@@ -943,6 +949,7 @@ TTree::~TTree()
    // Get rid of our branches, note that this will also release
    // any memory allocated by TBranchElement::SetAddress().
    fBranches.Delete();
+   TMemoryAccounting::Remove(TMemoryAccounting::kTree, fTotalBuffers.exchange(0));
    // FIXME: We must consider what to do with the reset of these if we are a clone.
    delete fPlayer;
    fPlayer = 0;
@@ -1005,6 +1012,27 @@ TTree::~TTree()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the maximum memory kept by this TTree to recycle the buffers of the
+/// baskets it drops, see SetBasketBufferPoolSize().
+
+Long64_t TTree::GetBasketBufferPoolSize() const
+{
+   return fBasketBufferPool->GetMaxBytes();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the statistics of the recycling of the basket buffers of this TTree:
+/// the number of buffers requested by the baskets read or created, the number
+/// of those requests that were served with the buffer of a dropped basket, and
+/// the memory currently held by the buffers waiting to be recycled.
+/// They are reported by TTreePerfStats::Print().
+
+void TTree::GetBasketBufferPoolStats(ULong64_t &requests, ULong64_t &hits, Long64_t &bytes) const
+{
+   fBasketBufferPool->GetStats(requests, hits, bytes);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the transient buffer currently used by this TTree for reading/writing baskets.
 
@@ -3430,7 +3458,10 @@ namespace {
 ///
 /// If 'option' contains the word 'fast' and nentries is -1, the cloning will be
 /// done without unzipping or unstreaming the baskets (i.e., a direct copy of the
-/// raw bytes on disk).
+/// raw bytes on disk).  The top level branches of an input tree whose baskets
+/// can not be copied as is (for example because their split level or leaf types
+/// differ from the ones of this tree) are read and filled entry by entry, while
+/// the baskets of all the other branches are still copied.
 ///
 /// When 'fast' is specified, 'option' can also contains a sorting order for the
 /// baskets in the output file.
@@ -3519,7 +3550,7 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
                }
             }
          }
-         TTreeCloner cloner(tree->GetTree(), this, option, TTreeCloner::kNoWarnings);
+         TTreeCloner cloner(tree->GetTree(), this, option, TTreeCloner::kNoWarnings | TTreeCloner::kAllowSlowBranches);
          if (cloner.IsValid()) {
             this->SetEntries(this->GetEntries() + tree->GetTree()->GetEntries());
             if (cacheSize != -1) cloner.SetCacheSize(cacheSize);
@@ -4612,7 +4643,7 @@ Int_t TTree::Fill()
             // When we are in one-basket-per-cluster mode, there is no need to optimize basket:
             // they will automatically grow to the size needed for an event cluster (with the basket
             // shrinking preventing them from growing too much larger than the actually-used space).
-            if (!TestBit(TTree::kOnlyFlushAtCluster)) {
+            if (!TestBit(TTree::kOnlyFlushAtCluster) && fTargetBasketSize <= 0) {
                OptimizeBaskets(GetTotBytes(), 1, "");
                if (gDebug > 0)
                   Info("TTree::Fill", "OptimizeBaskets called at entry %lld, fZipBytes=%lld, fFlushedBytes=%lld\n",
@@ -4620,6 +4651,8 @@ Int_t TTree::Fill()
             }
             fFlushedBytes = GetZipBytes();
             fAutoFlush = fEntries; // Use test on entries rather than bytes
+            if (fTargetBasketSize > 0)
+               AdaptBasketSizes();
 
             // subsequently in run
             if (fAutoSave < 0) {
@@ -4667,6 +4700,8 @@ Int_t TTree::Fill()
          Info("TTree::Fill", "FlushBaskets() called at entry %lld, fZipBytes=%lld, fFlushedBytes=%lld\n", fEntries,
               GetZipBytes(), fFlushedBytes);
       fFlushedBytes = GetZipBytes();
+      if (fTargetBasketSize > 0)
+         AdaptBasketSizes();
    }
 
    if (autoSave) {
@@ -5557,38 +5592,45 @@ Int_t TTree::GetEntry(Long64_t entry, Int_t getall)
       std::atomic<Int_t> nbpar(0);
 
       auto mapFunction = [&]() {
-            // The branch to process is obtained when the task starts to run.
-            // This way, since branches are sorted, we make sure that branches
-            // leading to big tasks are processed first. If we assigned the
-            // branch at task creation time, the scheduler would not necessarily
+            // The group of branches to process is obtained when the task starts
+            // to run. This way, since branches are sorted, we make sure that
+            // groups leading to big tasks are processed first. If we assigned the
+            // group at task creation time, the scheduler would not necessarily
             // respect our sorting.
-            Int_t j = pos.fetch_add(1);
-
-            Int_t nbtask = 0;
-            auto branch = fSortedBranches[j].second;
+            Int_t t = pos.fetch_add(1);
+            const size_t begin = t > 0 ? fBranchTaskEnds[t - 1] : 0;
+            const size_t end = fBranchTaskEnds[t];
 
             if (gDebug > 0) {
                std::stringstream ss;
                ss << std::this_thread::get_id();
                Info("GetEntry", "[IMT] Thread %s", ss.str().c_str());
-               Info("GetEntry", "[IMT] Running task for branch #%d: %s", j, branch->GetName());
+               Info("GetEntry", "[IMT] Running task #%d for %zu branches, starting with #%zu: %s", t, end - begin,
+                    begin, fSortedBranches[begin].second->GetName());
             }
 
-            std::chrono::time_point<std::chrono::system_clock> start, end;
-
-            start = std::chrono::system_clock::now();
-            nbtask = branch->GetEntry(entry, getall);
-            end = std::chrono::system_clock::now();
-
-            Long64_t tasktime = (Long64_t)std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
-            fSortedBranches[j].first += tasktime;
+            Int_t nbtask = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t j = begin; j < end; ++j) {
+               const Int_t nbbranch = fSortedBranches[j].second->GetEntry(entry, getall);
+               const auto stop = std::chrono::steady_clock::now();
+               // Branches are grouped by their cost, which can be well below a microsecond
+               fSortedBranches[j].first +=
+                  (Long64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+               start = stop;
+               if (nbbranch < 0) {
+                  nbtask = nbbranch;
+                  break;
+               }
+               nbtask += nbbranch;
+            }
 
             if (nbtask < 0) errnb = nbtask;
             else            nbpar += nbtask;
          };
 
       ROOT::TThreadExecutor pool;
-      pool.Foreach(mapFunction, fSortedBranches.size());
+      pool.Foreach(mapFunction, fBranchTaskEnds.size());
 
       if (errnb < 0) {
          nb = errnb;
@@ -5689,12 +5731,13 @@ void TTree::InitializeBranchLists(bool checkLeafCount)
       }
    }
 
-   // Initially sort parallel branches by size
+   // Initially sort parallel branches by size, and group them by size too
    std::sort(fSortedBranches.begin(),
              fSortedBranches.end(),
              [](std::pair<Long64_t,TBranch*> a, std::pair<Long64_t,TBranch*> b) {
                 return a.first > b.first;
              });
+   GroupSortedBranches();
 
    for (size_t i = 0; i < fSortedBranches.size(); i++)  {
       fSortedBranches[i].first = 0LL;
@@ -5702,7 +5745,8 @@ void TTree::InitializeBranchLists(bool checkLeafCount)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Sorts top-level branches by the last average task time recorded per branch.
+/// Sorts top-level branches by the last average task time recorded per branch,
+/// and groups them in tasks accordingly.
 
 void TTree::SortBranchesByTime()
 {
@@ -5715,12 +5759,55 @@ void TTree::SortBranchesByTime()
              [](std::pair<Long64_t,TBranch*> a, std::pair<Long64_t,TBranch*> b) {
                 return a.first > b.first;
              });
+   GroupSortedBranches();
 
    for (size_t i = 0; i < fSortedBranches.size(); i++)  {
       fSortedBranches[i].first = 0LL;
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Groups the branches of fSortedBranches, sorted by decreasing cost, in the
+/// tasks that read them in parallel in GetEntry.
+/// The cost of a branch is its first element: its size or its average read time.
+/// The branches are packed, in order, in tasks of about the same cost, so that
+/// there are about kNBranchTasksPerThread tasks per thread: expensive branches
+/// get a task of their own, while many cheap branches share a task, which
+/// would otherwise cost more to schedule than to run.
+
+void TTree::GroupSortedBranches()
+{
+   fBranchTaskEnds.clear();
+   const size_t nbranches = fSortedBranches.size();
+   if (nbranches == 0)
+      return;
+
+   const size_t nthreads = std::max(ROOT::GetThreadPoolSize(), 1u);
+   const size_t ntasks = std::min(nbranches, size_t(kNBranchTasksPerThread) * nthreads);
+   Long64_t totalcost = 0;
+   for (const auto &b : fSortedBranches)
+      totalcost += b.first;
+
+   if (totalcost <= 0) {
+      // Nothing measured yet: same number of branches per task
+      for (size_t t = 1; t <= ntasks; ++t)
+         fBranchTaskEnds.push_back(t * nbranches / ntasks);
+      return;
+   }
+
+   const Double_t taskcost = Double_t(totalcost) / ntasks;
+   Double_t cost = 0.;
+   for (size_t i = 0; i < nbranches; ++i) {
+      cost += fSortedBranches[i].first;
+      if (cost >= taskcost) {
+         fBranchTaskEnds.push_back(i + 1);
+         cost = 0.;
+      }
+   }
+   if (fBranchTaskEnds.empty() || fBranchTaskEnds.back() != nbranches)
+      fBranchTaskEnds.push_back(nbranches);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Returns the entry list assigned to this tree
 
@@ -6097,6 +6184,9 @@ TLeaf* TTree::GetLeaf(const char *name)
 /// Return maximum of column with name columname.
 /// if the Tree has an associated TEventList or TEntryList, the maximum
 /// is computed for the entries in this list.
+/// Without such a list, it is taken from the statistics of the baskets of
+/// the branch, without reading them, if they are stored (see
+/// SetBasketStatistics()).
 
 Double_t TTree::GetMaximum(const char* columname)
 {
@@ -6105,6 +6195,11 @@ Double_t TTree::GetMaximum(const char* columname)
       return 0;
    }
 
+   Double_t vmin, vmax, vsum;
+   if (!fEventList && !fEntryList && leaf->GetBranch()->GetStatistics(vmin, vmax, vsum)) {
+      return TMath::Max(vmax, -DBL_MAX);
+   }
+
    // create cache if wanted
    if (fCacheDoAutoInit)
       SetCacheSizeAux();
@@ -6137,6 +6232,9 @@ Long64_t TTree::GetMaxTreeSize()
 /// Return minimum of column with name columname.
 /// if the Tree has an associated TEventList or TEntryList, the minimum
 /// is computed for the entries in this list.
+/// Without such a list, it is taken from the statistics of the baskets of
+/// the branch, without reading them, if they are stored (see
+/// SetBasketStatistics()).
 
 Double_t TTree::GetMinimum(const char* columname)
 {
@@ -6145,6 +6243,11 @@ Double_t TTree::GetMinimum(const char* columname)
       return 0;
    }
 
+   Double_t vmin, vmax, vsum;
+   if (!fEventList && !fEntryList && leaf->GetBranch()->GetStatistics(vmin, vmax, vsum)) {
+      return TMath::Min(vmin, DBL_MAX);
+   }
+
    // create cache if wanted
    if (fCacheDoAutoInit)
       SetCacheSizeAux();
@@ -6302,6 +6405,16 @@ void TTree::KeepCircular()
    fReadEntry = -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add nbytes to the number of bytes in the branch buffers, which are
+/// accounted in the TMemoryAccounting::kTree category.
+
+void TTree::IncrementTotalBuffers(Int_t nbytes)
+{
+   fTotalBuffers += nbytes;
+   TMemoryAccounting::Add(TMemoryAccounting::kTree, nbytes);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read in memory all baskets from all branches up to the limit of maxmemory bytes.
 ///
@@ -6417,15 +6530,75 @@ Long64_t TTree::LoadTree(Long64_t entry)
 /// number are the same.
 ///
 /// If we *do* have an index, we must find the (major, minor) value pair
-/// in masterTree to locate our corresponding entry.
+/// in masterTree to locate our corresponding entry. When the index supports
+/// it (see TVirtualIndex::GetEntryNumbersFriend), our entries for a whole
+/// cluster of masterTree are resolved in one batched lookup the first time
+/// masterTree enters that cluster.
 ///
+/// In both cases, our read cache is filled as soon as we move outside of the
+/// entries it holds, rather than at the first read of one of our branches:
+/// the baskets of the friend are requested along with the ones of masterTree.
 
 Long64_t TTree::LoadTreeFriend(Long64_t entry, TTree* masterTree)
 {
+   Long64_t result;
    if (!fTreeIndex) {
-      return LoadTree(entry);
+      result = LoadTree(entry);
+   } else {
+      Long64_t friendEntry = -1;
+      if (!ResolveFriendEntry(entry, masterTree, friendEntry))
+         friendEntry = fTreeIndex->GetEntryNumberFriend(masterTree);
+      result = LoadTree(friendEntry);
    }
-   return LoadTree(fTreeIndex->GetEntryNumberFriend(masterTree));
+   if (result >= 0)
+      PrefetchFriendCluster();
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find our entry corresponding to the entry of masterTree, resolving first
+/// through the index our entries for the whole cluster of masterTree holding
+/// it, if not done yet. Return kFALSE if the index cannot resolve entries in
+/// bulk for masterTree.
+
+Bool_t TTree::ResolveFriendEntry(Long64_t entry, TTree *masterTree, Long64_t &friendEntry)
+{
+   // The entries of a TChain are global while the values are read from its current tree.
+   if (entry < 0 || !masterTree || masterTree->GetTree() != masterTree || entry >= masterTree->GetEntries())
+      return kFALSE;
+   if (masterTree != fFriendEntriesMaster || entry < fFriendEntriesStart || entry >= fFriendEntriesEnd) {
+      // Do not hold the entry numbers of a huge cluster, e.g. in a tree without any auto flush.
+      constexpr Long64_t kMaxFriendEntries = 1 << 20;
+      TClusterIterator clusterIter = masterTree->GetClusterIterator(entry);
+      fFriendEntriesStart = clusterIter();
+      fFriendEntriesEnd = std::min(clusterIter.GetNextEntry(), masterTree->GetEntries());
+      if (fFriendEntriesEnd - fFriendEntriesStart > kMaxFriendEntries) {
+         fFriendEntriesStart = entry;
+         fFriendEntriesEnd = std::min(entry + kMaxFriendEntries, fFriendEntriesEnd);
+      }
+      fFriendEntriesMaster = masterTree;
+      fFriendEntries.resize(fFriendEntriesEnd - fFriendEntriesStart);
+      if (!fTreeIndex->GetEntryNumbersFriend(masterTree, fFriendEntriesStart, fFriendEntriesEnd, fFriendEntries.data()))
+         fFriendEntries.clear();
+   }
+   if (fFriendEntries.empty())
+      return kFALSE;
+   friendEntry = fFriendEntries[entry - fFriendEntriesStart];
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill our read cache with the cluster holding our current entry, if it
+/// does not hold it yet. The caches of the trees of a TChain are managed by
+/// the chain.
+
+void TTree::PrefetchFriendCluster()
+{
+   if (GetTree() != this || !GetCurrentFile())
+      return;
+   TTreeCache *cache = GetReadCache(GetCurrentFile());
+   if (cache && !cache->IsLearning())
+      cache->FillBuffer();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -7014,6 +7187,78 @@ void TTree::OptimizeBaskets(ULong64_t maxMemory, Float_t minComp, Option_t *opti
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Resize the baskets of the branches holding data to aim at baskets of
+/// fTargetBasketSize compressed bytes, see SetTargetBasketSize().
+/// Called at each cluster boundary, i.e. right after the baskets were flushed.
+/// The basket size of a branch is computed from its average entry size and
+/// compression factor measured since the beginning of the tree:
+///  - if a whole cluster fits in a basket of about the target size, the basket
+///    is sized to hold exactly one cluster;
+///  - otherwise the cluster is split into the number of baskets of about the
+///    target size, all holding the same number of entries so that there is no
+///    small trailing basket at the end of each cluster.
+/// In both cases basket boundaries coincide with cluster boundaries, which
+/// keeps the reads of TTreeCache, that are done cluster by cluster, compact.
+
+void TTree::AdaptBasketSizes()
+{
+   if (fAutoFlush <= 0 || TestBit(TTree::kOnlyFlushAtCluster))
+      return;
+
+   const Double_t clusterEntries = fAutoFlush;
+   constexpr Int_t kMinBasketSize = 512;
+   constexpr Int_t kMaxBasketSize = 64 * 1024 * 1024;
+
+   TObjArray *leaves = GetListOfLeaves();
+   const Int_t nleaves = leaves->GetEntriesFast();
+   TBranch *previous = nullptr;
+   for (Int_t i = 0; i < nleaves; ++i) {
+      TBranch *branch = static_cast<TLeaf *>(leaves->UncheckedAt(i))->GetBranch();
+      // Leaf lists have several leaves for the same branch; branches with sub-branches hold no data
+      if (branch == previous || branch->GetListOfBranches()->GetEntriesFast() > 0)
+         continue;
+      previous = branch;
+
+      const Long64_t entries = branch->GetEntries();
+      const Double_t totBytes = branch->GetTotBytes();
+      const Double_t zipBytes = branch->GetZipBytes();
+      if (entries <= 0 || totBytes <= 0 || zipBytes <= 0)
+         continue;
+
+      const Double_t compression = totBytes / zipBytes;
+      // The bytes of one cluster of the branch in memory, with room for the entry offsets, if any (see TBranch::FillImpl)
+      Double_t clusterBytes = clusterEntries * totBytes / entries;
+      if (branch->GetEntryOffsetLen())
+         clusterBytes += clusterEntries * sizeof(Int_t) * 2;
+      const Double_t targetBytes = fTargetBasketSize * compression;
+
+      Double_t bsize;
+      if (clusterBytes <= 1.25 * targetBytes) {
+         // One basket per cluster, with some slack for the fluctuations of the entry sizes: the basket is flushed at
+         // the end of the cluster anyway
+         bsize = clusterBytes * fTargetMemoryRatio;
+      } else {
+         // The entries of the cluster split evenly among the baskets, leaving room for one more entry per basket:
+         // a basket is written as soon as the next entry might not fit
+         const Double_t entriesPerBasket = std::ceil(clusterEntries / std::ceil(clusterBytes / targetBytes));
+         bsize = (entriesPerBasket + 1) * clusterBytes / clusterEntries;
+      }
+      bsize += 100 + strlen(branch->GetName()); // the key of the basket, that is part of its buffer
+      bsize = std::min(std::max(bsize, (Double_t)kMinBasketSize), (Double_t)kMaxBasketSize);
+      const Int_t newBsize = Int_t(bsize) - Int_t(bsize) % 512 + 512;
+
+      const Int_t oldBsize = branch->GetBasketSize();
+      // Avoid reallocating the baskets for small fluctuations
+      if (std::abs(newBsize - oldBsize) <= oldBsize / 10)
+         continue;
+      if (gDebug > 0)
+         Info("AdaptBasketSizes", "Changing buffer size from %d to %d bytes for %s (compression %.2f)", oldBsize,
+              newBsize, branch->GetName(), compression);
+      branch->SetBasketSize(newBsize);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interface to the Principal Components Analysis class.
 ///
@@ -7769,7 +8014,8 @@ void TTree::Refresh()
    fTotBytes = tree->GetTotBytes();
    fZipBytes = tree->GetZipBytes();
    fSavedBytes = tree->fSavedBytes;
-   fTotalBuffers = tree->fTotalBuffers.load();
+   const Long64_t totalBuffers = tree->fTotalBuffers.load();
+   TMemoryAccounting::Add(TMemoryAccounting::kTree, totalBuffers - fTotalBuffers.exchange(totalBuffers));
 
    //loop on all branches and update them
    Int_t nleaves = fLeaves.GetEntriesFast();
@@ -7844,7 +8090,7 @@ void TTree::Reset(Option_t* option)
    fZipBytes      = 0;
    fFlushedBytes  = 0;
    fSavedBytes    = 0;
-   fTotalBuffers  = 0;
+   TMemoryAccounting::Remove(TMemoryAccounting::kTree, fTotalBuffers.exchange(0));
    fChainOffset   = 0;
    fReadEntry     = -1;
 
@@ -7874,7 +8120,7 @@ void TTree::ResetAfterMerge(TFileMergeInfo *info)
    fZipBytes      = 0;
    fSavedBytes    = 0;
    fFlushedBytes  = 0;
-   fTotalBuffers  = 0;
+   TMemoryAccounting::Remove(TMemoryAccounting::kTree, fTotalBuffers.exchange(0));
    fChainOffset   = 0;
    fReadEntry     = -1;
 
@@ -8137,6 +8383,48 @@ void TTree::SetAutoSave(Long64_t autos)
    fAutoSave = autos;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the maximum memory kept by this TTree to recycle the buffers of the
+/// baskets it drops (see DropBaskets()).  The buffers are given to the next
+/// baskets read, instead of being freed and allocated again; this reduces the
+/// heap traffic when reading trees with many branches.  The default is
+/// 32 MBytes, 0 disables the recycling.
+///
+/// The trees of a TChain use the pool of the chain, so the setting of the
+/// chain applies to all of them.
+
+void TTree::SetBasketBufferPoolSize(Long64_t maxbytes)
+{
+   fBasketBufferPool->SetMaxBytes(maxbytes < 0 ? 0 : maxbytes);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Let the baskets of the branches be resized at each cluster boundary while
+/// the tree is filled, aiming at the given compressed size per basket, rather
+/// than once with OptimizeBaskets() at the first auto-flush. The baskets are
+/// sized from the measured entry sizes and compression factors of the branches
+/// so that they hold either exactly one cluster or an equal share of it: see
+/// AdaptBasketSizes() for the details. A value of 0 restores the default
+/// behavior. This has no effect if auto-flush is disabled or if the tree is in
+/// one-basket-per-cluster mode (kOnlyFlushAtCluster).
+///
+/// \param[in] zipBytes Target compressed size of the baskets.
+
+void TTree::SetTargetBasketSize(Int_t zipBytes)
+{
+   fTargetBasketSize = zipBytes > 0 ? zipBytes : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Recycle the basket buffers with the pool of the given tree, for example
+/// the one of the TChain this tree is part of.
+
+void TTree::ShareBasketBufferPool(const TTree *tree)
+{
+   if (tree && tree != this)
+      fBasketBufferPool = tree->fBasketBufferPool;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set a branch's basket size.
 ///
@@ -8168,6 +8456,40 @@ void TTree::SetBasketSize(const char* bname, Int_t buffsize)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Store (or, with on = kFALSE, no longer store) the minimum, maximum and
+/// sum of the values of each basket of the branches when they are filled,
+/// see TBranch::SetBasketStatistics().
+///
+/// bname is the name of a branch.
+///
+/// - if bname="*", apply to all branches.
+/// - if bname="xxx*", apply to all branches with name starting with xxx
+///
+/// see TRegexp for wildcarding options.
+/// Returns the number of branches supporting the statistics, which only
+/// exist for the branches of a single numerical leaf. It should be called
+/// before the first Fill().
+
+Int_t TTree::SetBasketStatistics(const char* bname, Bool_t on)
+{
+   Int_t nleaves = fLeaves.GetEntriesFast();
+   TRegexp re(bname, kTRUE);
+   Int_t nb = 0;
+   for (Int_t i = 0; i < nleaves; i++)  {
+      TLeaf* leaf = (TLeaf*) fLeaves.UncheckedAt(i);
+      TBranch* branch = (TBranch*) leaf->GetBranch();
+      TString s = branch->GetName();
+      if (strcmp(bname, branch->GetName()) && (s.Index(re) == kNPOS)) {
+         continue;
+      }
+      if (branch->SetBasketStatistics(on)) {
+         nb++;
+      }
+   }
+   return nb;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Change branch address, dealing with clone trees properly.
 /// See TTree::CheckBranchAddressType for the semantic of the return value.
@@ -9108,6 +9430,9 @@ void TTree::SetTreeIndex(TVirtualIndex* index)
       fTreeIndex->SetTree(0);
    }
    fTreeIndex = index;
+   fFriendEntries.clear();
+   fFriendEntriesStart = fFriendEntriesEnd = -1;
+   fFriendEntriesMaster = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
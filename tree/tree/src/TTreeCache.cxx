@@ -261,6 +261,27 @@ rely on the system to cache the right branches.
     }
 ~~~
 
+## <a name="profile"></a>Reusing the learned branches in the next jobs
+
+The branches found in the learning phase can be saved to a branch profile,
+a text file that can hold the branches of several trees, each under a user
+tag (e.g. the name of the analysis):
+~~~ {.cpp}
+    T->GetReadCache(file)->SaveBranchProfile("branches.txt", "myanalysis");
+~~~
+A cache that loads the profile skips the learning phase and caches these
+branches from the first entry on, also for all the files of a TChain:
+~~~ {.cpp}
+    T->GetReadCache(file)->LoadBranchProfile("branches.txt", "myanalysis");
+~~~
+When the resource TTreeCache.BranchProfile (or the environment variable
+`ROOT_TTREECACHE_PROFILE`) is set to the name of a profile file, with the
+optional tag TTreeCache.BranchProfileTag (or `ROOT_TTREECACHE_PROFILE_TAG`),
+each new cache loads its profile from that file and, if the file does not
+have one yet, saves the branches it learned at the end of its learning
+phase. Remove the profile whenever the analysis starts using different
+branches.
+
 ##  <a name="checkPerf"></a>How can the usage and performance of TTreeCache be verified?
 
 Once the event loop terminated, the number of effective system reads for a
@@ -295,10 +316,49 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TVirtualPerfStats.h"
 #include <limits.h>
 
+#include <fstream>
+#include <string>
+#include <vector>
+
 Int_t TTreeCache::fgLearnEntries = 100;
 
 ClassImp(TTreeCache);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the branch profile file and tag configured with the environment or
+/// resource variables. Return false if there is none.
+
+Bool_t GetConfiguredBranchProfile(TString &filename, TString &tag)
+{
+   const char *env = gSystem->Getenv("ROOT_TTREECACHE_PROFILE");
+   filename = (env && *env) ? env : gEnv->GetValue("TTreeCache.BranchProfile", "");
+   env = gSystem->Getenv("ROOT_TTREECACHE_PROFILE_TAG");
+   tag = (env && *env) ? env : gEnv->GetValue("TTreeCache.BranchProfileTag", "");
+   return !filename.IsNull();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// A line of a branch profile holds the tree name, the tag and one branch name,
+/// separated by tabs: split it, returning false for comments and malformed lines.
+
+Bool_t ParseProfileLine(const std::string &line, std::string &tree, std::string &tag, std::string &branch)
+{
+   if (line.empty() || line[0] == '#')
+      return kFALSE;
+   const auto tab1 = line.find('\t');
+   const auto tab2 = tab1 == std::string::npos ? tab1 : line.find('\t', tab1 + 1);
+   if (tab2 == std::string::npos || tab2 + 1 == line.size())
+      return kFALSE;
+   tree = line.substr(0, tab1);
+   tag = line.substr(tab1 + 1, tab2 - tab1 - 1);
+   branch = line.substr(tab2 + 1);
+   return kTRUE;
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
@@ -316,6 +376,10 @@ TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
    fEntryNext = fEntryMin + fgLearnEntries;
    Int_t nleaves = tree->GetListOfLeaves()->GetEntries();
    fBranches = new TObjArray(nleaves);
+
+   TString profile, tag;
+   if (GetConfiguredBranchProfile(profile, tag))
+      LoadBranchProfile(profile, tag);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1110,6 +1174,8 @@ Bool_t TTreeCache::FillBuffer()
    TTree *tree = ((TBranch*)fBranches->UncheckedAt(0))->GetTree();
    Long64_t entry = tree->GetReadEntry();
    Long64_t fEntryCurrentMax = 0;
+   // True if this call ends a learning phase that was not cut short by the user
+   const Bool_t endsLearning = fIsLearning && !fIsManual && !fLearnPrefilling;
 
    if (entry != -1 && (entry < fEntryMin || fEntryMax < entry))
       return kFALSE;
@@ -1771,6 +1837,8 @@ Bool_t TTreeCache::FillBuffer()
          fFirstTime = kFALSE;
       }
    }
+   if (endsLearning)
+      SaveConfiguredBranchProfile();
    fIsLearning = kFALSE;
    return kTRUE;
 }
@@ -1857,6 +1925,126 @@ Int_t TTreeCache::GetLearnEntries()
    return fgLearnEntries;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Take the branches to cache from the profile saved for this tree and the tag
+/// in the given file, see SaveBranchProfile(), and stop the learning phase:
+/// the branches are cached from the next entry on, and for all the files of a
+/// TChain. Branches of the profile that the tree does not have are ignored.
+/// Returns the number of branches of the profile, or -1 if the file cannot be
+/// read or has no profile for this tree and tag.
+
+Int_t TTreeCache::LoadBranchProfile(const char *filename, const char *tag)
+{
+   std::ifstream in(filename);
+   if (!in || !fTree)
+      return -1;
+
+   std::vector<std::string> names;
+   std::string line, ltree, ltag, lbranch;
+   while (std::getline(in, line)) {
+      if (ParseProfileLine(line, ltree, ltag, lbranch) && ltree == fTree->GetName() && ltag == tag)
+         names.emplace_back(lbranch);
+   }
+   if (names.empty())
+      return -1;
+
+   fBrNames->Delete();
+   for (const auto &name : names)
+      fBrNames->Add(new TObjString(name.c_str()));
+
+   // As when a TChain switches to a new file with the branches learned on the previous one: the
+   // branch pointers are resolved here if a tree is loaded, in UpdateBranches() otherwise.
+   fNbranches = 0;
+   fBranches->Clear();
+   if (TTree *tree = fTree->GetTree()) {
+      for (const auto &name : names) {
+         if (TBranch *b = tree->GetBranch(name.c_str()))
+            fBranches->AddAtAndExpand(b, fNbranches++);
+      }
+   }
+   fIsLearning = kFALSE;
+   fFromProfile = kTRUE;
+   fEntryNext = -1; // force FillBuffer to read the buffers
+   fEntryCurrent = -1;
+
+   auto perfStats = fTree->GetPerfStats();
+   if (perfStats)
+      perfStats->UpdateBranchIndices(fBranches);
+
+   if (gDebug > 0)
+      Info("LoadBranchProfile", "Caching %d branches of tree %s from profile %s", (Int_t)names.size(),
+           fTree->GetName(), filename);
+   return (Int_t)names.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Save the branches of the cache, normally the ones found in the learning
+/// phase, as the profile of this tree for the given tag in the given file, to
+/// be read by LoadBranchProfile(). The profiles of other trees and tags already
+/// in the file are kept.
+/// Returns the number of branches saved, or -1 on error.
+
+Int_t TTreeCache::SaveBranchProfile(const char *filename, const char *tag) const
+{
+   if (!fTree || !fBrNames)
+      return -1;
+
+   // Keep the other profiles already in the file
+   std::vector<std::string> lines;
+   {
+      std::ifstream in(filename);
+      std::string line, ltree, ltag, lbranch;
+      while (std::getline(in, line)) {
+         if (!ParseProfileLine(line, ltree, ltag, lbranch) || ltree != fTree->GetName() || ltag != tag)
+            lines.emplace_back(line);
+      }
+   }
+
+   // Write to a temporary file first, so that jobs reading the profile concurrently see either version
+   TString tmpname = TString::Format("%s.%d.tmp", filename, gSystem->GetPid());
+   {
+      std::ofstream out(tmpname.Data());
+      if (lines.empty())
+         out << "# TTreeCache branch profile: tree name, tag, branch name\n";
+      for (const auto &line : lines)
+         out << line << '\n';
+      TIter next(fBrNames);
+      while (auto os = static_cast<TObjString *>(next()))
+         out << fTree->GetName() << '\t' << tag << '\t' << os->GetName() << '\n';
+      if (!out) {
+         Error("SaveBranchProfile", "Cannot write the branch profile to %s", tmpname.Data());
+         gSystem->Unlink(tmpname);
+         return -1;
+      }
+   }
+   if (gSystem->Rename(tmpname, filename) != 0) {
+      Error("SaveBranchProfile", "Cannot write the branch profile to %s", filename);
+      gSystem->Unlink(tmpname);
+      return -1;
+   }
+   return fBrNames->GetEntries();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// At the end of the learning phase, save the learned branches in the branch
+/// profile configured with TTreeCache.BranchProfile, if it does not have the
+/// branches of this tree and tag yet.
+
+void TTreeCache::SaveConfiguredBranchProfile() const
+{
+   TString profile, tag;
+   if (fFromProfile || !GetConfiguredBranchProfile(profile, tag))
+      return;
+   std::ifstream in(profile.Data());
+   std::string line, ltree, ltag, lbranch;
+   while (std::getline(in, line)) {
+      if (ParseProfileLine(line, ltree, ltag, lbranch) && ltree == fTree->GetName() && ltag == tag.Data())
+         return;
+   }
+   in.close();
+   SaveBranchProfile(profile, tag);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print cache statistics. Like:
 ///
@@ -2151,6 +2339,7 @@ void TTreeCache::StartLearningPhase()
 {
    fIsLearning = kTRUE;
    fIsManual = kFALSE;
+   fFromProfile = kFALSE;
    fNbranches  = 0;
    if (fBrNames) fBrNames->Delete();
    fIsTransferred = kFALSE;
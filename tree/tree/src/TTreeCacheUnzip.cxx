@@ -34,6 +34,7 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #endif
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
+extern "C" int R__unzip_needs_dict(UChar_t *bufin);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
 
 TTreeCacheUnzip::EParUnzipMode TTreeCacheUnzip::fgParallel = TTreeCacheUnzip::kDisable;
@@ -605,6 +606,8 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
 /// We create a TTaskGroup and asynchronously maps each group of baskets(> 100 kB in total)
 /// to a task. In TTaskGroup, we use TThreadExecutor to do the actually work of unzipping 
 /// a group of basket. The purpose of creating TTaskGroup is to avoid competing with main thread.
+/// The unzipping tasks have a high priority: the baskets are about to be read, so idle threads
+/// take them before the other work of the pool, e.g. the tasks of an analysis.
 
 Int_t TTreeCacheUnzip::CreateTasks()
 {
@@ -641,10 +644,11 @@ Int_t TTreeCacheUnzip::CreateTasks()
          accusz = 0;
       }
       ROOT::TThreadExecutor pool;
+      pool.SetTaskPriority(ROOT::Experimental::ETaskPriority::kHigh);
       pool.Foreach(unzipFunction, basketIndices);
    };
 
-   fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
+   fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup(ROOT::Experimental::ETaskPriority::kHigh));
    fUnzipTaskGroup->Run(mapFunction);
 
    return 0;
@@ -906,6 +910,12 @@ Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src)
             uzlen += objlen;
             return uzlen;
          }
+         if (R__unzip_needs_dict(bufcur)) {
+            // The dictionary is held by the branch: leave the basket to TBasket::ReadBasketBuffers.
+            if (alloc) delete [] *dest;
+            *dest = 0;
+            return -1;
+         }
 
          R__unzip(&nin, bufcur, &nbuf, objbuf, &nout);
 
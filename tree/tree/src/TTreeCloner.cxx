@@ -100,6 +100,13 @@ Bool_t TTreeCloner::CompareEntry::operator()(UInt_t i1, UInt_t i2)
 /// This means that on the file the baskets will be in the order
 /// in which they will be needed when reading the whole tree
 /// sequentially.
+///
+/// With the option kAllowSlowBranches, a top level branch whose baskets
+/// can not be copied as is (for example because its split level or the type
+/// of one of its leaves differs, or because one of its sub-branches is
+/// missing in the input) does not prevent the fast cloning of the other
+/// branches: its entries are read and filled one by one instead, see
+/// CopySlowBranches.
 
 TTreeCloner::TTreeCloner(TTree *from, TTree *to, Option_t *method, UInt_t options) :
    fWarningMsg(),
@@ -111,6 +118,8 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, Option_t *method, UInt_t option
    fMethod(method),
    fFromBranches( from ? from->GetListOfLeaves()->GetEntries()+1 : 0),
    fToBranches( to ? to->GetListOfLeaves()->GetEntries()+1 : 0),
+   fFromSlowBranches(),
+   fToSlowBranches(),
    fMaxBaskets(CollectBranches()),
    fBasketBranchNum(new UInt_t[fMaxBaskets]),
    fBasketNum(new UInt_t[fMaxBaskets]),
@@ -207,6 +216,7 @@ Bool_t TTreeCloner::Exec()
    WriteBaskets();
    CopyMemoryBaskets();
    RestoreCache();
+   CopySlowBranches();
 
    return kTRUE;
 }
@@ -226,6 +236,40 @@ TTreeCloner::~TTreeCloner()
    delete [] fBasketIndex;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the top level branches whose baskets could not be copied, entry by
+/// entry, from the corresponding branches of the input tree.  Those two
+/// branches are expected to share the same address (see TTree::CopyAddresses).
+/// The baskets of the re-filled branches are flushed at the end of each
+/// cluster of the input so that they respect the cluster boundaries imported
+/// by ImportClusterRanges, which may differ from one input to the other.
+
+void TTreeCloner::CopySlowBranches()
+{
+   const Int_t nslow = fToSlowBranches.GetEntriesFast();
+   if (!nslow) {
+      return;
+   }
+   const Long64_t nentries = fFromTree->GetEntries();
+   TTree::TClusterIterator clusterIter = fFromTree->GetClusterIterator(0);
+   Long64_t start = 0;
+   while ((start = clusterIter.Next()) < nentries) {
+      const Long64_t end = std::min(clusterIter.GetNextEntry(), nentries);
+      for (Long64_t entry = start; entry < end; ++entry) {
+         fFromTree->LoadTree(entry);
+         for (Int_t i = 0; i < nslow; ++i) {
+            TBranch *from = (TBranch*)fFromSlowBranches.UncheckedAt(i);
+            TBranch *to = (TBranch*)fToSlowBranches.UncheckedAt(i);
+            from->GetEntry(entry);
+            to->Fill();
+         }
+      }
+      for (Int_t i = 0; i < nslow; ++i) {
+         ((TBranch*)fToSlowBranches.UncheckedAt(i))->FlushBaskets();
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Before we can start adding new basket, we need to flush to
 /// disk the partially filled baskets (the WriteBasket)
@@ -313,6 +357,21 @@ UInt_t TTreeCloner::CollectBranches(TBranch *from, TBranch *to) {
 
    }
 
+   if (from->fCompressionDict != to->fCompressionDict) {
+      // The baskets are copied as they are: they must be decompressed with the same dictionary.
+      if (to->fCompressionDict.empty() && to->GetEntries() == 0) {
+         to->fCompressionDict = from->fCompressionDict;
+      } else {
+         fWarningMsg.Form("The export branch and the import branch (%s) do not have the same compression dictionary.",
+                          from->GetName());
+         if (!(fOptions & kNoWarnings)) {
+            Warning("TTreeCloner::CollectBranches", "%s", fWarningMsg.Data());
+         }
+         fIsValid = kFALSE;
+         return 0;
+      }
+   }
+
    fFromBranches.AddLast(from);
    if (!from->TestBit(TBranch::kDoNotUseBufferMap)) {
       // Make sure that we reset the Buffer's map if needed.
@@ -361,7 +420,27 @@ UInt_t TTreeCloner::CollectBranches(TObjArray *from, TObjArray *to)
          fb = (TBranch*) from->UncheckedAt(fi);
       }
       if (fb) {
-         numBasket += CollectBranches(fb, tb);
+         Int_t nFromBranches = fFromBranches.GetEntriesFast();
+         Int_t nToBranches = fToBranches.GetEntriesFast();
+         Bool_t wasValid = fIsValid;
+         Bool_t needConversion = fNeedConversion;
+         UInt_t nb = CollectBranches(fb, tb);
+         if (fIsValid || !wasValid || fNeedConversion == needConversion || tb->GetMother() != tb
+             || !(fOptions & kAllowSlowBranches)) {
+            numBasket += nb;
+         } else {
+            // The baskets of this top level branch can not be copied, but the
+            // data can still be converted: forget about its sub-branches and
+            // re-fill it entry by entry instead.
+            while (fFromBranches.GetEntriesFast() > nFromBranches)
+               fFromBranches.RemoveLast();
+            while (fToBranches.GetEntriesFast() > nToBranches)
+               fToBranches.RemoveLast();
+            fFromSlowBranches.AddLast(fb);
+            fToSlowBranches.AddLast(tb);
+            fIsValid = kTRUE;
+            fNeedConversion = needConversion;
+         }
          ++fi;
          if (fi >= fnb) {
             fi = 0;
@@ -383,6 +462,11 @@ UInt_t TTreeCloner::CollectBranches(TObjArray *from, TObjArray *to)
             if (!(fOptions & kNoWarnings)) {
                Error("TTreeCloner::CollectBranches", "%s", fWarningMsg.Data());
             }
+            if (tb->GetMother()->InheritsFrom(TBranchElement::Class())) {
+               // The object is streamed member-wise, the missing data member
+               // will keep the value set by the constructor when reading.
+               fNeedConversion = kTRUE;
+            }
             fIsValid = kFALSE;
          }
       }
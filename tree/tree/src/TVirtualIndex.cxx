@@ -33,3 +33,16 @@ TVirtualIndex::TVirtualIndex(): TNamed()
 TVirtualIndex::~TVirtualIndex()
 {
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store in entries[0, last-first) the entry numbers in this (friend) Tree
+/// corresponding to the entries [first, last) of the master Tree 'parent',
+/// as GetEntryNumberFriend() would for each of them.
+/// Return kFALSE if the index cannot resolve a range of entries at once,
+/// which is the default.
+
+Bool_t TVirtualIndex::GetEntryNumbersFriend(const TTree * /*parent*/, Long64_t /*first*/, Long64_t /*last*/,
+                                            Long64_t * /*entries*/)
+{
+   return kFALSE;
+}
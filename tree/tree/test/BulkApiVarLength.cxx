@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <vector>
 
 #include "Bytes.h"
 #include "TBranch.h"
@@ -235,3 +236,87 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, jaggedRead)
+{
+   auto hfile = TFile::Open(fFileName.c_str());
+   auto tree = dynamic_cast<TTree*>(hfile->Get("T"));
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchDouble = tree->GetBranch("d");
+   ASSERT_TRUE(branchDouble);
+
+   float idx_f = 0;
+   double idx_d = 2;
+   Long64_t evt_idx = 0;
+   TBufferFile floatBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32*1024);
+   std::vector<Int_t> floatOffsets, doubleOffsets;
+
+   while (evt_idx < fEventCount) {
+      auto count = branchFloat->GetBulkRead().GetBulkEntriesJagged(evt_idx, floatBuf, floatOffsets);
+      ASSERT_GT(count, 0);
+      ASSERT_EQ(branchDouble->GetBulkRead().GetBulkEntriesJagged(evt_idx, doubleBuf, doubleOffsets), count);
+      ASSERT_EQ(floatOffsets, doubleOffsets);
+
+      auto floatValues = reinterpret_cast<float*>(floatBuf.GetCurrent());
+      auto doubleValues = reinterpret_cast<double*>(doubleBuf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         ASSERT_EQ(floatOffsets[idx + 1] - floatOffsets[idx], (evt_idx + idx + 1) % 10);
+         for (auto v = floatOffsets[idx]; v < floatOffsets[idx + 1]; v++) {
+            if (R__unlikely((evt_idx < 1600000) && (floatValues[v] != idx_f || doubleValues[v] != idx_d))) {
+               printf("Incorrect value: %f, %f, expected %f, %f (event %lld)\n", floatValues[v], doubleValues[v], idx_f,
+                      idx_d, evt_idx + idx);
+               ASSERT_TRUE(false);
+            }
+            idx_f++;
+            idx_d++;
+         }
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, fEventCount);
+}
+
+TEST(BulkApiJagged, StdVector)
+{
+   const auto fileName = "BulkApiTestStdVector.root";
+   const Long64_t nEvents = 10000;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree tree("T", "A ROOT tree with a std::vector branch.");
+      std::vector<float> v;
+      tree.Branch("v", &v);
+      for (Long64_t ev = 0; ev < nEvents; ev++) {
+         v.clear();
+         for (Long64_t idx = 0; idx < ev % 7; idx++)
+            v.push_back(ev + idx);
+         tree.Fill();
+      }
+      tree.Write();
+   }
+
+   TFile f(fileName);
+   auto tree = f.Get<TTree>("T");
+   ASSERT_TRUE(tree);
+   auto branch = tree->GetBranch("v");
+   ASSERT_TRUE(branch);
+   TBufferFile buf(TBuffer::kWrite, 32*1024);
+   std::vector<Int_t> offsets;
+   Long64_t evt_idx = 0;
+   while (evt_idx < nEvents) {
+      auto count = branch->GetBulkRead().GetBulkEntriesJagged(evt_idx, buf, offsets);
+      ASSERT_GT(count, 0);
+      auto values = reinterpret_cast<float*>(buf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         const auto ev = evt_idx + idx;
+         ASSERT_EQ(offsets[idx + 1] - offsets[idx], ev % 7);
+         for (auto v = offsets[idx]; v < offsets[idx + 1]; v++)
+            ASSERT_EQ(values[v], ev + (v - offsets[idx]));
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, nEvents);
+   remove(fileName);
+}
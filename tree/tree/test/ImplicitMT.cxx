@@ -5,6 +5,9 @@
 
 #include "gtest/gtest.h"
 
+#include <string>
+#include <vector>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -28,4 +31,46 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+// Many small branches are read in groups, re-formed when the branches are re-sorted by read time
+TEST(TTreeImplicitMT, getEntryBranchGroups)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "getEntryBranchGroupsMT.root";
+   const int nSmall = 500;
+   const int nEntries = 250;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      std::vector<int> small(nSmall);
+      for (int i = 0; i < nSmall; ++i)
+         t.Branch(("small" + std::to_string(i)).c_str(), &small[i]);
+      double big[1000];
+      t.Branch("big", big, "big[1000]/D");
+      for (int e = 0; e < nEntries; ++e) {
+         for (int i = 0; i < nSmall; ++i)
+            small[i] = e + i;
+         for (int i = 0; i < 1000; ++i)
+            big[i] = e * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   std::vector<int> small(nSmall);
+   for (int i = 0; i < nSmall; ++i)
+      t->SetBranchAddress(("small" + std::to_string(i)).c_str(), &small[i]);
+   double big[1000];
+   t->SetBranchAddress("big", big);
+   for (int e = 0; e < nEntries; ++e) {
+      EXPECT_GT(t->GetEntry(e), 0);
+      for (int i = 0; i < nSmall; ++i)
+         EXPECT_EQ(e + i, small[i]);
+      EXPECT_DOUBLE_EQ(e * 999., big[999]);
+   }
+   f.Close();
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
@@ -1,14 +1,20 @@
 
 #include "ROOT/TIOFeatures.hxx"
+#include "RZip.h"
 #include "TBasket.h"
 #include "TBranch.h"
+#include "TBufferFile.h"
 #include "TEnum.h"
 #include "TEnumConstant.h"
 #include "TMemFile.h"
+#include "TSystem.h"
 #include "TTree.h"
 
 #include "gtest/gtest.h"
 
+#include <cstring>
+#include <memory>
+#include <string>
 #include <vector>
 
 static const Int_t gSampleEvents = 100;
@@ -403,3 +409,247 @@ TEST(TBasket, TestSettingIOBits)
    readEntryOffset = reinterpret_cast<Bool_t *>(reinterpret_cast<char *>(basket2) + offset);
    EXPECT_EQ(*readEntryOffset, kTRUE);
 }
+
+TEST(TBasket, DeltaOffsetMap)
+{
+   TMemFile f("tbasket_delta_test.root", "CREATE");
+   TTree t1("t1", "Tree with delta-encoded entry offsets.");
+   TTree t2("t2", "Tree with serialized entry offsets.");
+   ROOT::TIOFeatures settings;
+   EXPECT_TRUE(settings.Set(ROOT::Experimental::EIOFeatures::kDeltaOffsetMap));
+   EXPECT_EQ(GetFeatures(settings), static_cast<UChar_t>(ROOT::Experimental::EIOFeatures::kDeltaOffsetMap));
+   t1.SetIOFeatures(settings);
+
+   std::vector<int> v;
+   t1.Branch("v", &v);
+   t2.Branch("v", &v);
+   for (Int_t idx = 0; idx < gSampleEvents; idx++) {
+      v.assign(idx % 9, idx);
+      t1.Fill();
+      t2.Fill();
+   }
+   TBranch *br1 = t1.GetBranch("v");
+   TBranch *br2 = t2.GetBranch("v");
+   t1.FlushBaskets();
+   t2.FlushBaskets();
+   // One byte per entry size instead of four.
+   EXPECT_LT(br1->GetTotBytes(), br2->GetTotBytes());
+
+   t1.DropBaskets();
+   t2.DropBaskets();
+   TBasket *basket1 = br1->GetBasket(0);
+   TBasket *basket2 = br2->GetBasket(0);
+   ASSERT_NE(basket1, nullptr);
+   ASSERT_NE(basket2, nullptr);
+   ASSERT_EQ(basket1->GetNevBuf(), basket2->GetNevBuf());
+   Int_t *offsets1 = basket1->GetEntryOffset();
+   Int_t *offsets2 = basket2->GetEntryOffset();
+   ASSERT_NE(offsets1, nullptr);
+   ASSERT_NE(offsets2, nullptr);
+   for (Int_t idx = 0; idx < basket1->GetNevBuf(); idx++) {
+      EXPECT_EQ(offsets1[idx], offsets2[idx]);
+   }
+
+   std::vector<int> *saved = nullptr;
+   t1.SetBranchAddress("v", &saved);
+   for (Int_t idx = 0; idx < gSampleEvents; idx++) {
+      t1.GetEntry(idx);
+      ASSERT_NE(saved, nullptr);
+      EXPECT_EQ(*saved, std::vector<int>(idx % 9, idx));
+   }
+   t1.ResetBranchAddresses();
+   delete saved;
+}
+
+TEST(TBasket, LittleEndianPayload)
+{
+   TMemFile f("tbasket_endian_test.root", "CREATE");
+   TTree t("t", "Tree with little-endian baskets.");
+   ROOT::TIOFeatures settings;
+   EXPECT_TRUE(settings.Set(ROOT::Experimental::EIOFeatures::kLittleEndianPayload));
+   t.SetIOFeatures(settings);
+
+   Float_t x;
+   Double_t d[2];
+   Short_t s;
+   Long64_t l;
+   Int_t n;
+   Float_t v[10];
+   t.Branch("x", &x, "x/F");
+   t.Branch("d", d, "d[2]/D");
+   t.Branch("s", &s, "s/S");
+   t.Branch("l", &l, "l/L");
+   t.Branch("n", &n, "n/I");
+   t.Branch("v", v, "v[n]/F");
+   for (Int_t idx = 0; idx < gSampleEvents; idx++) {
+      x = idx + 0.5f;
+      d[0] = -idx;
+      d[1] = idx * 1e10;
+      s = -idx;
+      l = idx * 1000000000000ll;
+      n = idx % 10;
+      for (Int_t i = 0; i < n; i++)
+         v[i] = idx + i;
+      t.Fill();
+   }
+   t.FlushBaskets();
+   t.DropBaskets();
+
+   // Only the baskets of fixed-size numerical branches are stored in little-endian order.
+   for (auto name : {"x", "d", "s", "l", "v"}) {
+      TBasket *basket = t.GetBranch(name)->GetBasket(0);
+      ASSERT_NE(basket, nullptr);
+      EXPECT_EQ(basket->HasLittleEndianPayload(), std::string(name) != "v") << name;
+   }
+
+   for (Int_t idx = 0; idx < gSampleEvents; idx++) {
+      t.GetEntry(idx);
+      EXPECT_EQ(x, idx + 0.5f);
+      EXPECT_EQ(d[0], -idx);
+      EXPECT_EQ(d[1], idx * 1e10);
+      EXPECT_EQ(s, -idx);
+      EXPECT_EQ(l, idx * 1000000000000ll);
+      ASSERT_EQ(n, idx % 10);
+      for (Int_t i = 0; i < n; i++)
+         EXPECT_EQ(v[i], idx + i);
+   }
+   EXPECT_FALSE(t.GetBranch("x")->GetBasket(0)->HasLittleEndianPayload());
+
+   // The bulk API hands out the values of the basket in memory order.
+   t.DropBaskets();
+   TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+   Int_t count = t.GetBranch("d")->GetBulkRead().GetBulkEntries(0, buf);
+   ASSERT_GT(count, 0);
+   const Double_t *values = reinterpret_cast<Double_t *>(buf.GetCurrent());
+   for (Int_t idx = 0; idx < count; idx++) {
+      EXPECT_EQ(values[2 * idx], -idx);
+      EXPECT_EQ(values[2 * idx + 1], idx * 1e10);
+   }
+}
+
+TEST(TBasket, BufferPool)
+{
+   TMemFile *f;
+   CreateSampleFile(f);
+   std::unique_ptr<TMemFile> file(f);
+   TTree *tree = nullptr;
+   file->GetObject("t1", tree);
+   ASSERT_TRUE(tree != nullptr);
+   Int_t idx = -1;
+   tree->SetBranchAddress("idx", &idx);
+
+   ULong64_t requests = 0, hits = 0;
+   Long64_t bytes = 0;
+   tree->GetEntry(0);
+   tree->GetBasketBufferPoolStats(requests, hits, bytes);
+   EXPECT_GT(requests, 0u);
+   EXPECT_EQ(bytes, 0);
+
+   // The buffers of the dropped basket are kept and given to the next basket read.
+   tree->DropBaskets();
+   tree->GetBasketBufferPoolStats(requests, hits, bytes);
+   EXPECT_GT(bytes, 0);
+   const auto hitsBefore = hits;
+   tree->GetEntry(1);
+   EXPECT_EQ(idx, 1);
+   tree->GetBasketBufferPoolStats(requests, hits, bytes);
+   EXPECT_GT(hits, hitsBefore);
+
+   // Without room in the pool, the buffers are freed.
+   tree->SetBasketBufferPoolSize(0);
+   EXPECT_EQ(tree->GetBasketBufferPoolSize(), 0);
+   tree->DropBaskets();
+   tree->GetBasketBufferPoolStats(requests, hits, bytes);
+   EXPECT_EQ(bytes, 0);
+   const auto hitsWithoutPool = hits;
+   tree->GetEntry(2);
+   EXPECT_EQ(idx, 2);
+   tree->GetBasketBufferPoolStats(requests, hits, bytes);
+   EXPECT_EQ(hits, hitsWithoutPool);
+   tree->ResetBranchAddresses();
+}
+
+TEST(TBasket, CompressionDictionary)
+{
+   const char *fname = "tbasket_dictionary.root";
+   // Small baskets of words drawn from a small vocabulary: each basket holds too little data to learn it from.
+   std::vector<std::string> vocabulary;
+   UInt_t seed = 42;
+   for (int i = 0; i < 64; ++i) {
+      std::string word;
+      for (int j = 0; j < 32; ++j) {
+         seed = seed * 1103515245 + 12345;
+         word += static_cast<char>('a' + (seed >> 16) % 26);
+      }
+      vocabulary.emplace_back(word);
+   }
+   const Int_t nEntries = 5000;
+   {
+      TFile f(fname, "RECREATE");
+      f.SetCompressionSettings(ROOT::CompressionSettings(ROOT::kZSTD, 5));
+      TTree t("t", "t");
+      char word[33];
+      auto plain = t.Branch("plain", word, "plain/C", 1000);
+      auto dict = t.Branch("dict", word, "dict/C", 1000);
+      dict->SetCompressionDictionarySize(4096);
+      for (Int_t i = 0; i < nEntries; ++i) {
+         strcpy(word, vocabulary[(i * 7 + i / 13) % vocabulary.size()].c_str());
+         t.Fill();
+      }
+      t.FlushBaskets();
+      EXPECT_TRUE(plain->GetCompressionDictionary().empty());
+      EXPECT_FALSE(dict->GetCompressionDictionary().empty());
+      EXPECT_LT(dict->GetZipBytes(), plain->GetZipBytes());
+      t.Write();
+   }
+   {
+      TFile f(fname);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      EXPECT_FALSE(t->GetBranch("dict")->GetCompressionDictionary().empty());
+      char plain[33], dict[33];
+      t->SetBranchAddress("plain", plain);
+      t->SetBranchAddress("dict", dict);
+      for (Int_t i = 0; i < nEntries; ++i) {
+         ASSERT_GT(t->GetEntry(i), 0);
+         EXPECT_STREQ(dict, plain);
+         EXPECT_EQ(vocabulary[(i * 7 + i / 13) % vocabulary.size()], dict);
+      }
+   }
+   gSystem->Unlink(fname);
+}
+
+TEST(TBasket, AdaptiveCompression)
+{
+   // Store the baskets that zlib would only compress by a few percent as they are
+   R__SetZipAdaptive(1.3, 0);
+   TMemFile f("tbasket_adaptive.root", "CREATE");
+   f.SetCompressionSettings(ROOT::CompressionSettings(ROOT::kZLIB, 6));
+   TTree t("t", "t");
+   Float_t noise = 0;
+   Int_t counter = 0;
+   auto noiseBranch = t.Branch("noise", &noise);
+   auto counterBranch = t.Branch("counter", &counter);
+   UInt_t seed = 1;
+   std::vector<Float_t> values;
+   for (counter = 0; counter < 20000; ++counter) {
+      seed = seed * 1664525 + 1013904223;
+      noise = seed / 4294967296.f;
+      values.push_back(noise);
+      t.Fill();
+   }
+   t.FlushBaskets();
+   R__SetZipAdaptive(0, 0);
+
+   EXPECT_GE(noiseBranch->GetZipBytes(), noiseBranch->GetTotBytes());
+   EXPECT_LT(counterBranch->GetZipBytes(), counterBranch->GetTotBytes() / 2);
+
+   // Reading is unchanged
+   noiseBranch->DropBaskets("all");
+   counterBranch->DropBaskets("all");
+   for (Long64_t i = 0; i < t.GetEntries(); ++i) {
+      ASSERT_GT(t.GetEntry(i), 0);
+      EXPECT_EQ(counter, i);
+      EXPECT_EQ(noise, values[i]);
+   }
+}
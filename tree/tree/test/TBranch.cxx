@@ -2,9 +2,12 @@
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TSystem.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+
 class TBranchTest : public ::testing::Test {
 protected:
    virtual void SetUp()
@@ -178,3 +181,67 @@ TEST_F(TBranchTest, twoPreviousTest)
    ASSERT_TRUE(branch->GetListOfBaskets()->At(7));
    delete file;
 }
+
+TEST(TBranch, BasketStatistics)
+{
+   const char *fileName = "TBranchBasketStatistics.root";
+   Double_t expectedMin = 1e300, expectedMax = -1e300, expectedSum = 0;
+   {
+      TFile file(fileName, "RECREATE");
+      TTree tree("tree", "tree");
+      Int_t n = 0;
+      Float_t v[3];
+      Double_t x = 0;
+      tree.Branch("n", &n, "n/I");
+      tree.Branch("v", v, "v[n]/F");
+      tree.Branch("x", &x, "x/D");
+      tree.Branch("nostats", &x, "nostats/D");
+      EXPECT_EQ(3, tree.SetBasketStatistics("*"));
+      EXPECT_TRUE(tree.GetBranch("nostats")->SetBasketStatistics(kFALSE));
+      for (Int_t i = 0; i < 1000; ++i) {
+         x = i;
+         n = i % 4;
+         for (Int_t j = 0; j < n; ++j)
+            v[j] = i + j;
+         tree.Fill();
+         expectedMin = std::min(expectedMin, x);
+         expectedMax = std::max(expectedMax, x);
+         expectedSum += x;
+         if (i % 100 == 99)
+            tree.FlushBaskets();
+      }
+      tree.Write();
+   }
+
+   TFile file(fileName);
+   auto tree = file.Get<TTree>("tree");
+   ASSERT_NE(nullptr, tree);
+   TBranch *bx = tree->GetBranch("x");
+   EXPECT_TRUE(bx->HasBasketStatistics());
+   EXPECT_FALSE(tree->GetBranch("nostats")->HasBasketStatistics());
+
+   Double_t min, max, sum;
+   ASSERT_TRUE(bx->GetStatistics(min, max, sum));
+   EXPECT_EQ(expectedMin, min);
+   EXPECT_EQ(expectedMax, max);
+   EXPECT_DOUBLE_EQ(expectedSum, sum);
+   EXPECT_EQ(999., tree->GetMaximum("x"));
+   EXPECT_EQ(0., tree->GetMinimum("x"));
+   // The values of an array branch, as read entry by entry
+   EXPECT_EQ(1001., tree->GetMaximum("v"));
+   EXPECT_EQ(1., tree->GetMinimum("v"));
+   EXPECT_FALSE(tree->GetBranch("nostats")->GetStatistics(min, max, sum));
+
+   // Basket i holds the entries [100 * i, 100 * (i + 1))
+   ASSERT_TRUE(bx->GetBasketStatistics(3, min, max, sum));
+   EXPECT_EQ(300., min);
+   EXPECT_EQ(399., max);
+   auto ranges = bx->GetEntryRanges(350., 420.);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(300, ranges[0].first);
+   EXPECT_EQ(500, ranges[0].second);
+   EXPECT_TRUE(bx->GetEntryRanges(2000., 3000.).empty());
+   EXPECT_EQ(1u, bx->GetEntryRanges(-1., 1e6).size());
+
+   gSystem->Unlink(fileName);
+}
@@ -0,0 +1,119 @@
+#include <TChain.h>
+#include <TFile.h>
+#include <TROOT.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+const char *gTreeName = "tree";
+
+std::vector<std::string> WriteFiles(const std::string &prefix, const std::vector<int> &entries)
+{
+   std::vector<std::string> fileNames;
+   for (auto i = 0u; i < entries.size(); ++i) {
+      fileNames.emplace_back(prefix + std::to_string(i) + ".root");
+      TFile f(fileNames.back().c_str(), "RECREATE");
+      TTree t(gTreeName, gTreeName);
+      int x = 0;
+      t.Branch("x", &x);
+      for (x = 0; x < entries[i]; ++x)
+         t.Fill();
+      t.Write();
+   }
+   return fileNames;
+}
+
+void DeleteFiles(const std::vector<std::string> &fileNames)
+{
+   for (const auto &f : fileNames)
+      gSystem->Unlink(f.c_str());
+}
+
+} // anonymous namespace
+
+TEST(TChain, EntriesWithParallelOpening)
+{
+   const auto fileNames = WriteFiles("tchain_entries_mt", {5, 7, 0, 3});
+   ROOT::EnableImplicitMT(2);
+   TChain chain(gTreeName);
+   for (const auto &f : fileNames)
+      chain.Add(f.c_str());
+   EXPECT_EQ(chain.GetEntries(), 15);
+   // The entries of each tree in the chain are known without loading them
+   EXPECT_EQ(chain.GetTree(), nullptr);
+   EXPECT_EQ(chain.LoadTree(12), 0);
+   EXPECT_EQ(chain.GetTreeNumber(), 3);
+   ROOT::DisableImplicitMT();
+   DeleteFiles(fileNames);
+}
+
+TEST(TChain, EntryCountCache)
+{
+   const auto fileNames = WriteFiles("tchain_entries_cache", {5, 7});
+   const char *cacheName = "tchain_entries_cache.root";
+   gSystem->Unlink(cacheName);
+
+   {
+      TChain chain(gTreeName);
+      chain.SetEntryCountCache(cacheName);
+      for (const auto &f : fileNames)
+         chain.Add(f.c_str());
+      EXPECT_EQ(chain.GetEntries(), 12);
+   }
+
+   // Tamper with the cache to check that it is used instead of the files
+   {
+      TFile f(cacheName, "UPDATE");
+      auto cache = f.Get<TTree>("EntryCountCache");
+      ASSERT_NE(cache, nullptr);
+      EXPECT_EQ(cache->GetEntries(), 2);
+      std::string *url = nullptr;
+      Long64_t mtime = 0, entries = 0;
+      cache->SetBranchAddress("url", &url);
+      cache->SetBranchAddress("mtime", &mtime);
+      cache->SetBranchAddress("entries", &entries);
+      TTree tampered("EntryCountCache", "");
+      std::string treeName = gTreeName;
+      tampered.Branch("url", &url);
+      tampered.Branch("treeName", &treeName);
+      tampered.Branch("mtime", &mtime);
+      tampered.Branch("entries", &entries);
+      for (Long64_t i = 0; i < cache->GetEntries(); ++i) {
+         cache->GetEntry(i);
+         if (*url == fileNames[0])
+            entries = 100;
+         tampered.Fill();
+      }
+      tampered.Write("", TObject::kOverwrite);
+      cache->ResetBranchAddresses();
+      delete url;
+   }
+
+   {
+      TChain chain(gTreeName);
+      chain.SetEntryCountCache(cacheName);
+      for (const auto &f : fileNames)
+         chain.Add(f.c_str());
+      EXPECT_EQ(chain.GetEntries(), 107);
+   }
+
+   // Rewriting a file invalidates its entry in the cache
+   gSystem->Sleep(1100);
+   WriteFiles("tchain_entries_cache", {5});
+   {
+      TChain chain(gTreeName);
+      chain.SetEntryCountCache(cacheName);
+      for (const auto &f : fileNames)
+         chain.Add(f.c_str());
+      EXPECT_EQ(chain.GetEntries(), 12);
+   }
+
+   DeleteFiles(fileNames);
+   gSystem->Unlink(cacheName);
+}
@@ -0,0 +1,72 @@
+#include "TEntryList.h"
+
+#include "gtest/gtest.h"
+
+// Fill a list with the entries of [0, n) for which `pass` is true
+template <typename F>
+static void Fill(TEntryList &elist, Long64_t n, F pass)
+{
+   elist.SetTree("t", "f.root");
+   for (Long64_t i = 0; i < n; ++i)
+      if (pass(i))
+         elist.Enter(i);
+   elist.OptimizeStorage();
+}
+
+static const Long64_t kN = 300000; // several blocks, with list and bits storage
+
+static TEntryList Dense()
+{
+   TEntryList elist;
+   Fill(elist, kN, [](Long64_t i) { return i % 3 != 0; });
+   return elist;
+}
+
+static TEntryList Sparse()
+{
+   TEntryList elist;
+   Fill(elist, kN, [](Long64_t i) { return i % 97 == 0 || i > 250000; });
+   return elist;
+}
+
+TEST(TEntryList, Add)
+{
+   for (auto first : {Dense(), Sparse()}) {
+      for (auto second : {Dense(), Sparse()}) {
+         TEntryList elist(first);
+         elist.Add(&second);
+         Long64_t n = 0;
+         for (Long64_t i = 0; i < kN; ++i) {
+            const bool expected = first.Contains(i) || second.Contains(i);
+            EXPECT_EQ(expected, (bool)elist.Contains(i)) << "entry " << i;
+            n += expected;
+         }
+         EXPECT_EQ(n, elist.GetN());
+      }
+   }
+}
+
+TEST(TEntryList, Subtract)
+{
+   for (auto first : {Dense(), Sparse()}) {
+      for (auto second : {Dense(), Sparse()}) {
+         TEntryList elist(first);
+         elist.Subtract(&second);
+         Long64_t n = 0;
+         for (Long64_t i = 0; i < kN; ++i) {
+            const bool expected = first.Contains(i) && !second.Contains(i);
+            EXPECT_EQ(expected, (bool)elist.Contains(i)) << "entry " << i;
+            n += expected;
+         }
+         EXPECT_EQ(n, elist.GetN());
+
+         // the entries are returned in order
+         Long64_t previous = -1;
+         for (Long64_t i = 0; i < elist.GetN(); ++i) {
+            const Long64_t entry = elist.GetEntry(i);
+            EXPECT_GT(entry, previous);
+            previous = entry;
+         }
+      }
+   }
+}
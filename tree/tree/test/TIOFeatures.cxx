@@ -26,10 +26,14 @@ TEST(TIOFeatures, IOBits)
                 static_cast<Int_t>(ROOT::Experimental::EIOUnsupportedFeatures::kUnsupported),
              0);
 
-   // These are currently defined but empty.
-   EXPECT_EQ(static_cast<Int_t>(ROOT::Experimental::EIOUnsupportedFeatures::kUnsupported), 0);
+   // This is currently defined but empty.
    EXPECT_EQ(static_cast<Int_t>(ROOT::EIOFeatures::kSupported), 0);
 
+   // The reserved bits are known but unsupported, both here and in TBasket::EUnsupportedIOBits
+   EXPECT_EQ(static_cast<Int_t>(ROOT::Experimental::EIOUnsupportedFeatures::kUnsupported),
+             static_cast<Int_t>(TBasket::EUnsupportedIOBits::kUnsupported));
+   EXPECT_EQ(static_cast<Int_t>(ROOT::Experimental::EIOUnsupportedFeatures::kBasketClassMap), BIT(1));
+
    // Currently, the experimental features are identical to TBasket::EIOBits
    EXPECT_EQ(static_cast<Int_t>(ROOT::Experimental::EIOFeatures::kSupported),
              static_cast<Int_t>(TBasket::EIOBits::kSupported));
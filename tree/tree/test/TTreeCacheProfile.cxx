@@ -0,0 +1,92 @@
+#include "TBranch.h"
+#include "TFile.h"
+#include "TObjArray.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+#include <string>
+
+class TTreeCacheProfileTest : public ::testing::Test {
+protected:
+   const char *fFileName = "TTreeCacheProfileTest.root";
+   const char *fProfileName = "TTreeCacheProfileTest.txt";
+
+   void SetUp() override
+   {
+      TFile file(fFileName, "RECREATE");
+      TTree tree("tree", "tree");
+      int a = 0, b = 0, c = 0;
+      tree.Branch("a", &a);
+      tree.Branch("b", &b);
+      tree.Branch("c", &c);
+      for (int i = 0; i < 1000; ++i) {
+         a = b = c = i;
+         tree.Fill();
+      }
+      tree.Write();
+   }
+
+   void TearDown() override
+   {
+      gSystem->Unlink(fFileName);
+      gSystem->Unlink(fProfileName);
+   }
+
+   static std::set<std::string> CachedBranches(const TTreeCache &cache)
+   {
+      std::set<std::string> names;
+      for (auto b : *cache.GetCachedBranches())
+         names.insert(b->GetName());
+      return names;
+   }
+};
+
+TEST_F(TTreeCacheProfileTest, SaveAndLoad)
+{
+   const std::set<std::string> expected{"a", "b"};
+   {
+      TFile file(fFileName);
+      auto tree = file.Get<TTree>("tree");
+      tree->SetCacheSize(10000000);
+      tree->SetCacheLearnEntries(10);
+      auto a = tree->GetBranch("a");
+      auto b = tree->GetBranch("b");
+      for (Long64_t i = 0; i < 100; ++i) {
+         tree->LoadTree(i);
+         a->GetEntry(i);
+         b->GetEntry(i);
+      }
+      auto cache = tree->GetReadCache(&file);
+      ASSERT_NE(nullptr, cache);
+      EXPECT_FALSE(cache->IsLearning());
+      EXPECT_EQ(2, cache->SaveBranchProfile(fProfileName, "test"));
+   }
+
+   TFile file(fFileName);
+   auto tree = file.Get<TTree>("tree");
+   tree->SetCacheSize(10000000);
+   auto cache = tree->GetReadCache(&file);
+   ASSERT_NE(nullptr, cache);
+   EXPECT_TRUE(cache->IsLearning());
+   EXPECT_EQ(-1, cache->LoadBranchProfile(fProfileName, "othertag"));
+   EXPECT_EQ(2, cache->LoadBranchProfile(fProfileName, "test"));
+   EXPECT_FALSE(cache->IsLearning());
+   EXPECT_TRUE(cache->IsFromProfile());
+   EXPECT_EQ(expected, CachedBranches(*cache));
+
+   // The baskets of the profile branches are read in one go from the first entry on
+   int a = -1;
+   tree->SetBranchAddress("a", &a);
+   tree->GetBranch("a")->GetEntry(tree->LoadTree(0));
+   EXPECT_EQ(0, a);
+   const auto readCalls = file.GetReadCalls();
+   for (Long64_t i = 1; i < 1000; ++i) {
+      tree->GetBranch("a")->GetEntry(tree->LoadTree(i));
+      EXPECT_EQ(i, a);
+   }
+   EXPECT_EQ(readCalls, file.GetReadCalls());
+}
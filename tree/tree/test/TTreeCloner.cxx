@@ -0,0 +1,108 @@
+#include "TBranch.h"
+#include "TChain.h"
+#include "TFile.h"
+#include "TNamed.h"
+#include "TString.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCloner.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+class TTreeClonerTest : public ::testing::Test {
+protected:
+   static constexpr int kEntries = 500;
+   const char *fFileNames[2] = {"TTreeClonerTest_split.root", "TTreeClonerTest_unsplit.root"};
+   const char *fOutFileName = "TTreeClonerTest_out.root";
+
+   // The two inputs differ by the split level of 'obj' and by their clusters.
+   void SetUp() override
+   {
+      for (int f = 0; f < 2; ++f) {
+         TFile file(fFileNames[f], "RECREATE");
+         TTree tree("t", "t");
+         tree.SetAutoFlush(f == 0 ? 100 : 70);
+         int x = 0;
+         auto obj = new TNamed("obj", "");
+         tree.Branch("x", &x);
+         tree.Branch("obj", &obj, 32000, f == 0 ? 99 : 0);
+         for (int i = 0; i < kEntries; ++i) {
+            x = f * kEntries + i;
+            obj->SetTitle(TString::Format("%d", x));
+            tree.Fill();
+         }
+         tree.Write();
+         delete obj;
+      }
+   }
+
+   void TearDown() override
+   {
+      for (auto name : fFileNames)
+         gSystem->Unlink(name);
+      gSystem->Unlink(fOutFileName);
+   }
+};
+
+TEST_F(TTreeClonerTest, slowBranches)
+{
+   TFile file1(fFileNames[0]);
+   TFile file2(fFileNames[1]);
+   auto tree1 = file1.Get<TTree>("t");
+   auto tree2 = file2.Get<TTree>("t");
+
+   TFile out(fOutFileName, "RECREATE");
+   std::unique_ptr<TTree> clone(tree1->CloneTree(0));
+   tree1->CopyAddresses(clone.get());
+   tree2->CopyAddresses(clone.get());
+
+   TTreeCloner strict(tree2, clone.get(), "", TTreeCloner::kNoWarnings);
+   EXPECT_FALSE(strict.IsValid());
+   EXPECT_TRUE(strict.NeedConversion());
+
+   TTreeCloner cloner(tree2, clone.get(), "", TTreeCloner::kNoWarnings | TTreeCloner::kAllowSlowBranches);
+   EXPECT_TRUE(cloner.IsValid());
+   EXPECT_EQ(cloner.GetNSlowBranches(), 1);
+   clone->ResetBranchAddresses();
+}
+
+TEST_F(TTreeClonerTest, fastMergeWithSlowBranches)
+{
+   {
+      TChain chain("t");
+      for (auto name : fFileNames)
+         chain.Add(name);
+      TFile out(fOutFileName, "RECREATE");
+      std::unique_ptr<TTree> clone(chain.CloneTree(-1, "fast"));
+      ASSERT_NE(clone, nullptr);
+      clone->Write();
+   }
+
+   Int_t inBaskets = 0;
+   for (auto name : fFileNames) {
+      TFile file(name);
+      inBaskets += file.Get<TTree>("t")->GetBranch("x")->GetWriteBasket();
+   }
+
+   TFile out(fOutFileName);
+   auto tree = out.Get<TTree>("t");
+   ASSERT_NE(tree, nullptr);
+   EXPECT_EQ(tree->GetEntries(), 2 * kEntries);
+   // The baskets of 'x' are copied as is, 'obj' is converted entry by entry.
+   EXPECT_EQ(tree->GetBranch("x")->GetWriteBasket(), inBaskets);
+
+   int x = -1;
+   TNamed *obj = nullptr;
+   tree->SetBranchAddress("x", &x);
+   tree->SetBranchAddress("obj", &obj);
+   for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+      tree->GetEntry(i);
+      EXPECT_EQ(x, i);
+      ASSERT_NE(obj, nullptr);
+      EXPECT_STREQ(obj->GetTitle(), TString::Format("%lld", i).Data());
+   }
+   tree->ResetBranchAddresses();
+   delete obj;
+}
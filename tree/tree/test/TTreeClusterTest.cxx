@@ -1,7 +1,13 @@
+#include "TEnv.h"
 #include "TFile.h"
 #include "TTree.h"
+#include "TTreeCache.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -53,3 +59,75 @@ TEST_F(TTreeClusterTest, countBaskets)
 
    delete file;
 }
+
+// The clusters are read ahead by the prefetching thread, also for local files
+TEST_F(TTreeClusterTest, asyncPrefetching)
+{
+   std::vector<Double_t> expected;
+   {
+      TFile file("TTreeClusterTest.root");
+      auto tree = file.Get<TTree>("tree");
+      Double_t data = 0;
+      tree->SetBranchAddress("branch", &data);
+      for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+         tree->GetEntry(i);
+         expected.push_back(data);
+      }
+   }
+
+   const auto prefetching = gEnv->GetValue("TFile.AsyncPrefetching", 0);
+   gEnv->SetValue("TFile.AsyncPrefetching", 1);
+   {
+      TFile file("TTreeClusterTest.root");
+      auto tree = file.Get<TTree>("tree");
+      tree->SetCacheSize(10000);
+      tree->AddBranchToCache("*");
+      auto cache = tree->GetReadCache(&file);
+      ASSERT_NE(nullptr, cache);
+      EXPECT_TRUE(cache->IsEnablePrefetching());
+      Double_t data = 0;
+      tree->SetBranchAddress("branch", &data);
+      ASSERT_EQ(expected.size(), (size_t)tree->GetEntries());
+      for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+         tree->GetEntry(i);
+         EXPECT_EQ(expected[i], data);
+      }
+   }
+   gEnv->SetValue("TFile.AsyncPrefetching", prefetching);
+}
+
+// With a target basket size, the baskets are resized at each cluster to split the clusters evenly
+TEST(TTreeTargetBasketSize, splitClusters)
+{
+   TFile file("TTreeTargetBasketSize.root", "RECREATE");
+   TTree tree("tree", "tree");
+   tree.SetAutoFlush(1000);
+   tree.SetTargetBasketSize(4000);
+   TRandom random(836);
+   Double_t data = 0;
+   auto branch = tree.Branch("branch", &data);
+   for (Int_t ev = 0; ev < 10000; ev++) {
+      data = random.Gaus(100, 7);
+      tree.Fill();
+   }
+   tree.Write();
+
+   // The 8000 bytes of each cluster compress to between 4000 and 8000 bytes: two baskets per cluster from the second
+   // cluster on, which starts with a basket
+   Int_t nbaskets = 0;
+   for (Int_t i = 0; i < branch->GetWriteBasket(); ++i) {
+      const auto first = branch->GetBasketEntry()[i];
+      if (first < 1000)
+         continue;
+      ++nbaskets;
+      EXPECT_LT(branch->GetBasketBytes()[i], 8000);
+   }
+   EXPECT_EQ(18, nbaskets);
+   for (Long64_t cluster = 1000; cluster < 10000; cluster += 1000) {
+      auto entries = branch->GetBasketEntry();
+      EXPECT_NE(entries + branch->GetWriteBasket(), std::find(entries, entries + branch->GetWriteBasket(), cluster));
+   }
+
+   file.Close();
+   gSystem->Unlink("TTreeTargetBasketSize.root");
+}
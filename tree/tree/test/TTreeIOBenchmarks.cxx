@@ -0,0 +1,118 @@
+#include "Compression.h"
+#include "TBranch.h"
+#include "TBufferFile.h"
+#include "TMemFile.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+#include "TTreeReaderValue.h"
+
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+static const Long64_t kEntries = 200000;
+
+static const int kAlgorithms[] = {ROOT::RCompressionSetting::EAlgorithm::kZLIB,
+                                  ROOT::RCompressionSetting::EAlgorithm::kLZMA,
+                                  ROOT::RCompressionSetting::EAlgorithm::kLZ4,
+                                  ROOT::RCompressionSetting::EAlgorithm::kZSTD};
+
+// Write kEntries floats and ints in memory with the given compression algorithm, 0 for no compression
+static std::unique_ptr<TMemFile> WriteTree(int algorithm)
+{
+   auto file = std::make_unique<TMemFile>("TTreeIOBenchmarks.root", "RECREATE");
+   // compression settings are 100 * algorithm + level
+   file->SetCompressionSettings(algorithm ? 100 * algorithm + 4 : 0);
+   auto tree = new TTree("T", "float and int branches");
+   float f = 0;
+   Int_t i = 0;
+   tree->Branch("f", &f);
+   tree->Branch("i", &i);
+   for (Long64_t ev = 0; ev < kEntries; ++ev) {
+      f = 0.25f * (ev % 1000);
+      i = ev % 77;
+      tree->Fill();
+   }
+   file->Write();
+   return file;
+}
+
+static void CompressionArguments(benchmark::internal::Benchmark *b)
+{
+   b->Arg(0);
+   for (auto algorithm : kAlgorithms)
+      b->Arg(algorithm);
+}
+
+static void BM_TTree_Write(benchmark::State &state)
+{
+   for (auto _ : state) {
+      auto file = WriteTree(state.range(0));
+      benchmark::DoNotOptimize(file.get());
+   }
+   state.SetItemsProcessed(state.iterations() * kEntries);
+}
+BENCHMARK(BM_TTree_Write)->Apply(CompressionArguments)->Unit(benchmark::kMillisecond);
+
+static void BM_TTree_GetEntry(benchmark::State &state)
+{
+   auto file = WriteTree(state.range(0));
+   auto tree = file->Get<TTree>("T");
+   float f = 0;
+   Int_t i = 0;
+   tree->SetBranchAddress("f", &f);
+   tree->SetBranchAddress("i", &i);
+   for (auto _ : state) {
+      double sum = 0;
+      for (Long64_t ev = 0; ev < kEntries; ++ev) {
+         tree->GetEntry(ev);
+         sum += f + i;
+      }
+      benchmark::DoNotOptimize(sum);
+   }
+   state.SetItemsProcessed(state.iterations() * kEntries);
+}
+BENCHMARK(BM_TTree_GetEntry)->Apply(CompressionArguments)->Unit(benchmark::kMillisecond);
+
+static void BM_TTreeReader(benchmark::State &state)
+{
+   auto file = WriteTree(state.range(0));
+   for (auto _ : state) {
+      TTreeReader reader("T", file.get());
+      TTreeReaderValue<float> f(reader, "f");
+      TTreeReaderValue<Int_t> i(reader, "i");
+      double sum = 0;
+      while (reader.Next())
+         sum += *f + *i;
+      benchmark::DoNotOptimize(sum);
+   }
+   state.SetItemsProcessed(state.iterations() * kEntries);
+}
+BENCHMARK(BM_TTreeReader)->Apply(CompressionArguments)->Unit(benchmark::kMillisecond);
+
+static void BM_TTree_BulkRead(benchmark::State &state)
+{
+   auto file = WriteTree(state.range(0));
+   auto tree = file->Get<TTree>("T");
+   auto branch = tree->GetBranch("f");
+   TBufferFile branchbuf(TBuffer::kWrite, 32 * 1024);
+   for (auto _ : state) {
+      double sum = 0;
+      Long64_t ev = 0;
+      while (ev < kEntries) {
+         auto count = branch->GetBulkRead().GetEntriesSerialized(ev, branchbuf);
+         if (count <= 0)
+            break;
+         char *buf = branchbuf.GetCurrent();
+         for (Int_t idx = 0; idx < count; ++idx) {
+            float value;
+            frombuf(buf, &value);
+            sum += value;
+         }
+         ev += count;
+      }
+      benchmark::DoNotOptimize(sum);
+   }
+   state.SetItemsProcessed(state.iterations() * kEntries);
+}
+BENCHMARK(BM_TTree_BulkRead)->Apply(CompressionArguments)->Unit(benchmark::kMillisecond);
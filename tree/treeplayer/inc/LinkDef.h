@@ -21,9 +21,11 @@
 #pragma link C++ class TTreeIndex-;
 #pragma link C++ class TChainIndex+;
 #pragma link C++ class TChainIndex::TChainIndexEntry+;
+#pragma link C++ class TTreeCompactIndex+;
 #pragma link C++ class TTreeFormulaManager;
 #pragma link C++ class TTreeDrawArgsParser+;
 #pragma link C++ class TTreePerfStats+;
+#pragma link C++ class TTreeIOProfiler+;
 #pragma link C++ class TTreeReader+;
 #pragma link C++ class ROOT::Experimental::TTreeReaderFast+;
 #pragma link C++ class TTreeTableInterface;
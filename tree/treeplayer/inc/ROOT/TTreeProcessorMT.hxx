@@ -25,6 +25,7 @@
 #include "ROOT/TThreadExecutor.hxx"
 
 #include <functional>
+#include <string>
 #include <vector>
 
 /** \class TTreeView
@@ -89,6 +90,8 @@ private:
    /// User-defined selection of entry numbers to be processed, empty if none was provided
    const TEntryList fEntryList; // const to be sure to avoid race conditions among TTreeViews
    const Internal::FriendInfo fFriendInfo;
+   /// File storing the entries and clusters of the trees, empty if none is used. See SetClusterIndexFile().
+   std::string fClusterIndexFile;
    ROOT::TThreadExecutor fPool; ///<! Thread pool for processing.
 
    /// Thread-local TreeViews
@@ -98,6 +101,7 @@ private:
    Internal::FriendInfo GetFriendInfo(TTree &tree);
    std::vector<std::string> FindTreeNames();
    static unsigned int fgMaxTasksPerFilePerWorker;
+   static Long64_t fgMinEntriesPerTask;
 
 public:
    TTreeProcessorMT(std::string_view filename, std::string_view treename = "", UInt_t nThreads = 0u);
@@ -107,8 +111,11 @@ public:
    TTreeProcessorMT(TTree &tree, UInt_t nThreads = 0u);
 
    void Process(std::function<void(TTreeReader &)> func);
+   void SetClusterIndexFile(std::string_view fileName);
    static void SetMaxTasksPerFilePerWorker(unsigned int m);
    static unsigned int GetMaxTasksPerFilePerWorker();
+   static void SetMinEntriesPerTask(Long64_t minEntries);
+   static Long64_t GetMinEntriesPerTask();
 };
 
 } // End of namespace ROOT
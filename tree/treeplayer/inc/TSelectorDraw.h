@@ -23,6 +23,9 @@
 
 #include "TSelector.h"
 
+#include <vector>
+
+class TLeaf;
 class TTreeFormula;
 class TTreeFormulaManager;
 class TH1;
@@ -61,10 +64,22 @@ protected:
    Bool_t         fObjEval;        //  true if fVar1 returns an object (or pointer to).
    Long64_t       fCurrentSubEntry; // Current subentry when fSelectMultiple is true. Used to fill TEntryListArray
 
+   /// The values of a variable, or of the selection, which is a direct read of a numerical leaf,
+   /// for the entries of the basket of the current tree read last
+   struct TBatchColumn {
+      TLeaf                *fLeaf = nullptr; ///< Leaf read in bulk, null if the formula must be evaluated
+      Long64_t              fFirst = 0;      ///< First entry held in fValues
+      Long64_t              fLast = 0;       ///< Entry after the last one held in fValues
+      std::vector<Double_t> fValues;
+   };
+   std::vector<TBatchColumn> fBatchColumns; //! One per variable and one for the selection, empty if none is read in bulk
+
 protected:
    virtual void      ClearFormula();
    virtual Bool_t    CompileVariables(const char *varexp="", const char *selection="");
    virtual void      InitArrays(Int_t newsize);
+   Bool_t            GetBatchValue(Int_t column, Long64_t entry, Double_t &value);
+   void              InitBatchColumns();
 
 private:
    TSelectorDraw(const TSelectorDraw&);             // not implemented
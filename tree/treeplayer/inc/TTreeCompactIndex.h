@@ -0,0 +1,83 @@
+// @(#)root/treeplayer:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeCompactIndex
+#define ROOT_TTreeCompactIndex
+
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TTreeCompactIndex                                                    //
+//                                                                      //
+// A Tree Index built from integer branches, storing packed sorted keys.//
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+
+#include "TVirtualIndex.h"
+
+#include <vector>
+
+class TTreeFormula;
+
+class TTreeCompactIndex : public TVirtualIndex {
+
+protected:
+   TString                fMajorName;          // Index major name
+   TString                fMinorName;          // Index minor name
+   Long64_t               fN;                  // Number of entries
+   Long64_t               fMajorMin;           // Smallest major value
+   Long64_t               fMajorMax;           // Largest major value
+   Long64_t               fMinorMin;           // Smallest minor value
+   Long64_t               fMinorMax;           // Largest minor value
+   UChar_t                fMinorBits;          // Number of bits of the minor value in a key
+   std::vector<ULong64_t> fKeys;               // Sorted keys, (major-fMajorMin)<<fMinorBits | (minor-fMinorMin)
+   std::vector<UInt_t>    fEntries32;          // Entry number of each key, if all entry numbers fit in 32 bits
+   std::vector<Long64_t>  fEntries64;          // Entry number of each key, otherwise
+   std::vector<Long64_t>  fPending;            //! Triplets major, minor, entry appended with delaySort, not yet sorted
+   TTreeFormula          *fMajorFormulaParent; //! Pointer to major TreeFormula in Parent tree (if any)
+   TTreeFormula          *fMinorFormulaParent; //! Pointer to minor TreeFormula in Parent tree (if any)
+
+   Long64_t       FindValues(Long64_t major, Long64_t minor, Long64_t first, Bool_t &found) const;
+   Long64_t       GetEntry(Long64_t pos) const { return fEntries64.empty() ? (Long64_t)fEntries32[pos] : fEntries64[pos]; }
+   void           GetValues(Long64_t pos, Long64_t &major, Long64_t &minor) const;
+   TTreeFormula  *GetMajorFormulaParent(const TTree *parent);
+   TTreeFormula  *GetMinorFormulaParent(const TTree *parent);
+   Bool_t         Pack(std::vector<Long64_t> &triplets);
+   void           Unpack(std::vector<Long64_t> &triplets, Long64_t offset) const;
+
+private:
+   TTreeCompactIndex(const TTreeCompactIndex&) = delete;            // Not implemented.
+   TTreeCompactIndex &operator=(const TTreeCompactIndex&) = delete; // Not implemented.
+
+public:
+   TTreeCompactIndex();
+   TTreeCompactIndex(const TTree *T, const char *majorname, const char *minorname = "0");
+   virtual               ~TTreeCompactIndex();
+   virtual void           Append(const TVirtualIndex *,Bool_t delaySort = kFALSE);
+   virtual Long64_t       GetEntryNumberFriend(const TTree *parent);
+   virtual Bool_t         GetEntryNumbersFriend(const TTree *parent, Long64_t first, Long64_t last, Long64_t *entries);
+   virtual Long64_t       GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const;
+   virtual Long64_t       GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor) const;
+   void                   GetEntryNumbersWithIndex(Long64_t n, const Long64_t *major, const Long64_t *minor,
+                                                   Long64_t *entries) const;
+   const char            *GetMajorName()    const {return fMajorName.Data();}
+   const char            *GetMinorName()    const {return fMinorName.Data();}
+   virtual Long64_t       GetN()            const {return fN;}
+   virtual Bool_t         IsValidFor(const TTree *parent);
+   virtual void           Print(Option_t *option="") const;
+   virtual void           UpdateFormulaLeaves(const TTree *parent);
+   virtual void           SetTree(const TTree *T);
+
+   ClassDef(TTreeCompactIndex,1);  //A Tree Index with packed keys built from integer branches.
+};
+
+#endif
+
@@ -188,6 +188,7 @@ public:
    TFormLeafInfo      *GetLeafInfo(Int_t code) const;
    TTreeFormulaManager*GetManager() const { return fManager; }
    TMethodCall        *GetMethodCall(Int_t code) const;
+   TLeaf              *GetDirectLeaf() const;
    virtual Int_t       GetMultiplicity() const {return fMultiplicity;}
    virtual TLeaf      *GetLeaf(Int_t n) const;
    virtual Int_t       GetNcodes() const {return fNcodes;}
@@ -0,0 +1,136 @@
+// @(#)root/treeplayer:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeIOProfiler
+#define ROOT_TTreeIOProfiler
+
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TTreeIOProfiler                                                      //
+//                                                                      //
+// Thread-aware profiler of the TTree I/O, per branch and per thread,   //
+// with a summary table and a Chrome trace timeline.                    //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+
+#include "TVirtualPerfStats.h"
+#include "TString.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class TTreeIOProfiler : public TVirtualPerfStats {
+
+public:
+   enum EIOStep {
+      kFileRead,     // read from a file
+      kCacheFill,    // transfer of the blocks of a read cache
+      kBasketRead,   // read of a basket, from the file or the cache
+      kBasketUnzip,  // decompression of a basket
+      kDeserialize,  // deserialization of an entry of a branch
+      kNumIOSteps    // number of steps, must be last
+   };
+
+   struct StepStats {
+      Long64_t fCalls = 0;  // Number of times the step was done
+      Long64_t fBytes = 0;  // Number of bytes read, uncompressed or deserialized
+      Double_t fTime = 0.;  // Real time spent in the step, in seconds
+   };
+
+protected:
+   struct TimelineEvent {
+      Int_t    fStep;     // EIOStep
+      Int_t    fSource;   // Index of the branch or file in the thread record
+      Double_t fStart;    // Start, in seconds since the start of the profiling
+      Double_t fDuration; // Duration, in seconds
+      Long64_t fBytes;    // Number of bytes
+   };
+
+   struct SourceRecord {
+      const void *fAddress;            // The TBranch or TFile
+      std::string fName;               // Its name, in case the address is reused
+      StepStats   fStats[kNumIOSteps]; // Statistics of the steps of this source
+   };
+
+   struct ThreadRecord {
+      std::thread::id                     fThreadId;
+      std::vector<SourceRecord>           fSources;
+      std::unordered_map<const void *, Int_t> fSourceIndex;
+      std::vector<TimelineEvent>          fEvents;
+   };
+
+   TString   fName;                                   // Name of this profiler
+   ULong64_t fId;                                     //! Unique identifier of the current recording
+   Double_t  fStartTime;                              //! Time stamp of the start of the profiling
+   Bool_t    fTimeline;                               //! Whether the timeline events are recorded
+   mutable std::mutex fMutex;                         //! Protects fThreads
+   std::vector<std::unique_ptr<ThreadRecord>> fThreads; //! Records of the threads, in order of first event
+
+   ThreadRecord &GetThreadRecord();
+   void          Record(EIOStep step, const void *address, const char *name, Long64_t bytes, Double_t start);
+
+private:
+   TTreeIOProfiler(const TTreeIOProfiler&) = delete;            // Not implemented.
+   TTreeIOProfiler &operator=(const TTreeIOProfiler&) = delete; // Not implemented.
+
+public:
+   TTreeIOProfiler(const char *name = "TTreeIOProfiler", Bool_t timeline = kTRUE);
+   virtual ~TTreeIOProfiler();
+
+   void             Start();
+   void             Stop();
+   void             Reset();
+   Bool_t           IsActive() const { return GetGlobalPerfStats() == this; }
+
+   virtual const char *GetName() const { return fName.Data(); }
+   Int_t            GetNThreads() const;
+   StepStats        GetStats(EIOStep step, const char *source = nullptr, Int_t thread = -1) const;
+   static const char *GetStepName(EIOStep step);
+   virtual void     Print(Option_t *option = "") const;
+   Bool_t           SaveTimeline(const char *filename) const;
+
+   virtual void     BasketReadEvent(TBranch *branch, Int_t len, Double_t start);
+   virtual void     BasketUnzipEvent(TBranch *branch, Int_t complen, Int_t objlen, Double_t start);
+   virtual void     BranchReadEvent(TBranch *branch, Int_t nbytes, Double_t start);
+   virtual void     CacheFillEvent(TFile *file, Int_t nblocks, Long64_t len, Double_t start);
+   virtual void     FileReadEvent(TFile *file, Int_t len, Double_t start);
+
+   // The PROOF and TTreePerfStats events are not used
+   virtual void     SimpleEvent(EEventType) {}
+   virtual void     PacketEvent(const char *, const char *, const char *, Long64_t, Double_t, Double_t, Double_t, Long64_t) {}
+   virtual void     FileEvent(const char *, const char *, const char *, const char *, Bool_t) {}
+   virtual void     FileOpenEvent(TFile *, const char *, Double_t) {}
+   virtual void     UnzipEvent(TObject *, Long64_t, Double_t, Int_t, Int_t) {}
+   virtual void     RateEvent(Double_t, Double_t, Long64_t, Long64_t) {}
+   virtual void     SetBytesRead(Long64_t) {}
+   virtual Long64_t GetBytesRead() const;
+   virtual void     SetNumEvents(Long64_t) {}
+   virtual Long64_t GetNumEvents() const { return 0; }
+   virtual void     PrintBasketInfo(Option_t * = "") const {}
+   virtual void     SetLoaded(TBranch *, size_t) {}
+   virtual void     SetLoaded(size_t, size_t) {}
+   virtual void     SetLoadedMiss(TBranch *, size_t) {}
+   virtual void     SetLoadedMiss(size_t, size_t) {}
+   virtual void     SetMissed(TBranch *, size_t) {}
+   virtual void     SetMissed(size_t, size_t) {}
+   virtual void     SetUsed(TBranch *, size_t) {}
+   virtual void     SetUsed(size_t, size_t) {}
+   virtual void     UpdateBranchIndices(TObjArray *) {}
+
+   ClassDef(TTreeIOProfiler,0)  // Thread-aware profiler of the TTree I/O
+};
+
+#endif
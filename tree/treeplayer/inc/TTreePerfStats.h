@@ -60,6 +60,10 @@ protected:
    Double_t      fDiskTime;      //Time spent in pure raw disk IO
    Double_t      fUnzipTime;     //Time spent uncompressing the data.
    Double_t      fCompress;      //Tree compression factor
+   Long64_t      fBufferRequests;//Number of basket buffers requested
+   Long64_t      fBufferHits;    //Number of basket buffer requests served with a recycled buffer
+   ULong64_t     fStartBufferRequests; //!Basket buffers requested from the tree before the monitoring started
+   ULong64_t     fStartBufferHits;     //!Recycled basket buffers given by the tree before the monitoring started
    TString       fName;          //name of this TTreePerfStats
    TString       fHostInfo;      //name of the host system, ROOT version and date
    TFile        *fFile;          //!pointer to the file containing the Tree
@@ -88,6 +92,8 @@ public:
    virtual void     Finish();
    virtual Long64_t GetBytesRead() const {return fBytesRead;}
    virtual Long64_t GetBytesReadExtra() const {return fBytesReadExtra;}
+   virtual Long64_t GetBufferHits() const {return fBufferHits;}
+   virtual Long64_t GetBufferRequests() const {return fBufferRequests;}
    virtual Double_t GetCpuTime()   const {return fCpuTime;}
    virtual Double_t GetDiskTime()  const {return fDiskTime;}
    TGraphErrors    *GetGraphIO()     {return fGraphIO;}
@@ -119,6 +125,8 @@ public:
    virtual void     SavePrimitive(std::ostream &out, Option_t *option = "");
    virtual void     SetBytesRead(Long64_t nbytes) {fBytesRead = nbytes;}
    virtual void     SetBytesReadExtra(Long64_t nbytes) {fBytesReadExtra = nbytes;}
+   virtual void     SetBufferHits(Long64_t nhits) {fBufferHits = nhits;}
+   virtual void     SetBufferRequests(Long64_t nrequests) {fBufferRequests = nrequests;}
    virtual void     SetCompress(Double_t cx) {fCompress = cx;}
    virtual void     SetDiskTime(Double_t t) {fDiskTime = t;}
    virtual void     SetNumEvents(Long64_t) {}
@@ -148,7 +156,7 @@ public:
 
    BasketList_t     GetDuplicateBasketCache() const;
 
-   ClassDef(TTreePerfStats, 7) // TTree I/O performance measurement
+   ClassDef(TTreePerfStats, 8) // TTree I/O performance measurement
 };
 
 #endif
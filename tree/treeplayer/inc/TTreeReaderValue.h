@@ -25,9 +25,11 @@
 #include "TDictionary.h"
 #include "TBranchProxy.h"
 
+#include <memory>
 #include <type_traits>
 
 class TBranch;
+class TBufferFile;
 class TBranchElement;
 class TLeaf;
 class TTreeReader;
@@ -101,6 +103,10 @@ Base class of TTreeReaderValue.
       void RegisterWithTreeReader();
       void NotifyNewTree(TTree* newTree);
 
+      void SetupBulkRead();
+      Bool_t LoadBulkBasket(Long64_t entry);
+      void *GetAddressBulk();
+
       TBranch* SearchBranchWithCompositeName(TLeaf *&myleaf, TDictionary *&branchActualType, std::string &err);
       virtual void CreateProxy();
       static const char* GetBranchDataType(TBranch* branch,
@@ -130,6 +136,16 @@ Base class of TTreeReaderValue.
       typedef EReadStatus (TTreeReaderValueBase::*Read_t)();
       Read_t fProxyReadFunc = &TTreeReaderValueBase::ProxyReadDefaultImpl;      ///<! Pointer to the Read implementation to use.
 
+      /// Whether the values are read basket by basket, see SetupBulkRead()
+      enum class EBulkStatus { kUnknown, kEnabled, kDisabled };
+      EBulkStatus  fBulkStatus = EBulkStatus::kUnknown; ///<! Reset when the tree changes
+      TBranch*     fBulkBranch = nullptr;            ///<! The branch read in bulk
+      std::unique_ptr<TBufferFile> fBulkBuffer;      ///<! The values of the basket read last, in memory byte order
+      Long64_t     fBulkFirst = -1;                  ///<! First entry of the basket in fBulkBuffer
+      Long64_t     fBulkEnd = -1;                    ///<! Entry after the last entry of the basket in fBulkBuffer
+      Int_t        fBulkValueSize = 0;               ///<! Size of one value
+      alignas(8) char fBulkValue[8];                 ///<! Value of the current entry, at an address that does not change
+
       // FIXME: re-introduce once we have ClassDefInline!
       //ClassDef(TTreeReaderValueBase, 0);//Base class for accessors to data via TTreeReader
 
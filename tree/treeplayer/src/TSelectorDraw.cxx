@@ -35,6 +35,15 @@ A specialized TSelector for TTree::Draw.
 #include "TStyle.h"
 #include "TClass.h"
 #include "TColor.h"
+#include "TBranch.h"
+#include "TBufferFile.h"
+#include "TLeafB.h"
+#include "TLeafD.h"
+#include "TLeafF.h"
+#include "TLeafI.h"
+#include "TLeafL.h"
+#include "TLeafS.h"
+#include "TMath.h"
 
 ClassImp(TSelectorDraw);
 
@@ -932,6 +941,7 @@ void TSelectorDraw::Begin(TTree *tree)
       fVmin[i] = DBL_MAX;
       fVmax[i] = -DBL_MAX;
    }
+   InitBatchColumns();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -947,6 +957,7 @@ void TSelectorDraw::ClearFormula()
    delete fSelect; fSelect = 0;
    fManager = 0;
    fMultiplicity = 0;
+   fBatchColumns.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1159,6 +1170,99 @@ Bool_t TSelectorDraw::Notify()
       }
    }
    if (fSelect) fSelect->UpdateFormulaLeaves();
+   InitBatchColumns();
+   return kTRUE;
+}
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Convert n values of type T to Double_t.
+
+template <typename T>
+void R__ConvertValues(const char *data, Int_t n, Double_t *values)
+{
+   const T *typed = reinterpret_cast<const T *>(data);
+   for (Int_t i = 0; i < n; ++i)
+      values[i] = typed[i];
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find the variables, and the selection, whose formula is a direct read of
+/// a numerical leaf of the current tree (see TTreeFormula::GetDirectLeaf).
+/// Their values are read in bulk, one basket at a time, rather than by
+/// evaluating the formula for each entry. Only the simple case without
+/// multiplicity is handled.
+
+void TSelectorDraw::InitBatchColumns()
+{
+   fBatchColumns.clear();
+   if (fObjEval || fMultiplicity || fDimension <= 0 || !fVal || !fTree || !fTree->GetTree())
+      return;
+   Bool_t any = kFALSE;
+   fBatchColumns.resize(fDimension + 1);
+   for (Int_t i = 0; i <= fDimension; ++i) {
+      TTreeFormula *formula = i < fDimension ? fVar[i] : fSelect;
+      TLeaf *leaf = formula ? formula->GetDirectLeaf() : 0;
+      // Leaves of friend trees are read at the entry matching ours, not at the local entry.
+      if (leaf && leaf->GetBranch()->GetTree() == fTree->GetTree()) {
+         fBatchColumns[i].fLeaf = leaf;
+         any = kTRUE;
+      }
+   }
+   if (!any) fBatchColumns.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set value to the value of the variable (or of the selection, for
+/// column == fDimension) for the entry of the current tree, reading in bulk
+/// the basket starting at entry if needed. Return kFALSE if the formula must
+/// be evaluated instead: it is not a direct read of a leaf, or the entry is
+/// not held by the basket read last nor is the first one of a basket.
+
+Bool_t TSelectorDraw::GetBatchValue(Int_t column, Long64_t entry, Double_t &value)
+{
+   TBatchColumn &batch = fBatchColumns[column];
+   if (!batch.fLeaf)
+      return kFALSE;
+   if (entry < batch.fFirst || entry >= batch.fLast) {
+      TBranch *branch = batch.fLeaf->GetBranch();
+      // Check the basket boundary first: GetBulkEntries would read the basket before failing.
+      const Long64_t *basketEntry = branch->GetBasketEntry();
+      const Int_t basket = TMath::BinarySearch(branch->GetWriteBasket() + 1, basketEntry, entry);
+      if (basket < 0 || basketEntry[basket] != entry)
+         return kFALSE;
+      TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+      const Int_t n = branch->GetBulkRead().GetBulkEntries(entry, buf);
+      if (n <= 0)
+         return kFALSE;
+      batch.fValues.resize(n);
+      const char *data = buf.GetCurrent();
+      const Bool_t isUnsigned = batch.fLeaf->IsUnsigned();
+      TClass *cl = batch.fLeaf->IsA();
+      if (cl == TLeafB::Class()) {
+         if (isUnsigned) R__ConvertValues<UChar_t>(data, n, batch.fValues.data());
+         else            R__ConvertValues<Char_t>(data, n, batch.fValues.data());
+      } else if (cl == TLeafS::Class()) {
+         if (isUnsigned) R__ConvertValues<UShort_t>(data, n, batch.fValues.data());
+         else            R__ConvertValues<Short_t>(data, n, batch.fValues.data());
+      } else if (cl == TLeafI::Class()) {
+         if (isUnsigned) R__ConvertValues<UInt_t>(data, n, batch.fValues.data());
+         else            R__ConvertValues<Int_t>(data, n, batch.fValues.data());
+      } else if (cl == TLeafL::Class()) {
+         if (isUnsigned) R__ConvertValues<ULong64_t>(data, n, batch.fValues.data());
+         else            R__ConvertValues<Long64_t>(data, n, batch.fValues.data());
+      } else if (cl == TLeafF::Class()) {
+         R__ConvertValues<Float_t>(data, n, batch.fValues.data());
+      } else {
+         R__ConvertValues<Double_t>(data, n, batch.fValues.data());
+      }
+      batch.fFirst = entry;
+      batch.fLast = entry + n;
+   }
+   value = batch.fValues[entry - batch.fFirst];
    return kTRUE;
 }
 
@@ -1180,13 +1284,19 @@ void TSelectorDraw::ProcessFill(Long64_t entry)
    // simple case with no multiplicity
    if (fForceRead && fManager->GetNdata() <= 0) return;
 
+   // The variables and the selection that are direct reads of a leaf are taken from the baskets read in bulk.
+   const Bool_t batch = !fBatchColumns.empty();
+   Double_t value;
    if (fSelect) {
-      fW[fNfill] = fWeight * fSelect->EvalInstance(0);
+      if (batch && GetBatchValue(fDimension, entry, value)) fW[fNfill] = fWeight * value;
+      else                                                  fW[fNfill] = fWeight * fSelect->EvalInstance(0);
       if (!fW[fNfill]) return;
    } else fW[fNfill] = fWeight;
    if (fVal) {
       for (Int_t i = 0; i < fDimension; ++i) {
-         if (fVar[i]) fVal[i][fNfill] = fVar[i]->EvalInstance(0);
+         if (!fVar[i]) continue;
+         if (batch && GetBatchValue(i, entry, value)) fVal[i][fNfill] = value;
+         else                                         fVal[i][fNfill] = fVar[i]->EvalInstance(0);
       }
    }
    fNfill++;
@@ -1361,7 +1471,7 @@ void TSelectorDraw::TakeAction()
    //__________________________2-D histogram_______________________
    else if (fAction ==  2) {
       TH2 *h2 = (TH2*)fObject;
-      for (i = 0; i < fNfill; i++) h2->Fill(fVal[1][i], fVal[0][i], fW[i]);
+      h2->FillN(fNfill, fVal[1], fVal[0], fW);
    }
    //__________________________Profile histogram_______________________
    else if (fAction ==  4)((TProfile*)fObject)->FillN(fNfill, fVal[1], fVal[0], fW);
@@ -1417,7 +1527,7 @@ void TSelectorDraw::TakeAction()
    else if (fAction ==  3) {
       TH3 *h3 = (TH3*)fObject;
       if (!h3->TestBit(kCanDelete)) {
-         for (i = 0; i < fNfill; i++) h3->Fill(fVal[2][i], fVal[1][i], fVal[0][i], fW[i]);
+         h3->FillN(fNfill, fVal[2], fVal[1], fVal[0], fW);
       }
    } else if (fAction == 13) {
       TPolyMarker3D *pm3d = new TPolyMarker3D(fNfill);
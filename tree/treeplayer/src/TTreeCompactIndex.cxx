@@ -0,0 +1,646 @@
+// @(#)root/treeplayer:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TTreeCompactIndex
+A Tree Index with majorname and minorname, built from integer branches.
+
+Contrary to TTreeIndex, which evaluates arbitrary expressions with a
+TTreeFormula for each entry, TTreeCompactIndex only accepts the names of
+branches holding a single integer value per entry (`B`, `b`, `S`, `s`, `I`,
+`i`, `L` or `l` leaves). The columns are read with the bulk I/O interface
+and each pair major,minor is packed in a single 64 bit key:
+~~~{.cpp}
+    key = (major - majorMin) << minorBits | (minor - minorMin)
+~~~
+where minorBits is the number of bits needed by the range of the minor
+values. The keys are sorted, in parallel if the implicit multi-threading
+is enabled, and the entry numbers are stored as 32 bit integers when
+possible: the index takes 12 bytes per entry instead of the 24 bytes of
+a TTreeIndex. An index can not be built if the ranges of the major and
+minor values do not fit together in 64 bits.
+
+The index is used like any other TVirtualIndex:
+~~~{.cpp}
+    tree->SetTreeIndex(new TTreeCompactIndex(tree, "run", "event"));
+    tree->GetEntryWithIndex(1234, 56789);
+~~~
+GetEntryNumbersWithIndex() looks up many pairs at once, e.g. to join a
+friend tree: when the pairs are sorted, each search starts from the
+position of the previous one.
+*/
+
+#include "TTreeCompactIndex.h"
+
+#include "TBranch.h"
+#include "TBufferFile.h"
+#include "TLeaf.h"
+#include "TLeafB.h"
+#include "TLeafI.h"
+#include "TLeafL.h"
+#include "TLeafS.h"
+#include "TROOT.h"
+#include "TTree.h"
+#include "TTreeFormula.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+ClassImp(TTreeCompactIndex);
+
+namespace {
+
+/// Below this number of entries, the keys are sorted sequentially.
+constexpr std::size_t kMinParallelSort = 1 << 20;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the values of the branch for the entries [first, last) of its tree
+/// into values[0], values[stride], ..., one basket at a time when the
+/// bulk I/O interface supports the branch and entry by entry otherwise.
+/// If bulkOnly is true, return false instead of reading entry by entry: the
+/// branch, for instance of a master tree, must not overwrite the values at
+/// the addresses set by the user.
+
+template <typename T>
+Bool_t R__ReadIntegerColumn(TBranch &branch, TLeaf &leaf, Long64_t first, Long64_t last, Long64_t *values,
+                            Int_t stride, Bool_t bulkOnly)
+{
+   TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+   Long64_t entry = first;
+   while (entry < last) {
+      const Int_t count = branch.GetBulkRead().GetBulkEntries(entry, buf);
+      if (count > 0) {
+         const T *data = reinterpret_cast<const T *>(buf.GetCurrent());
+         const Long64_t n = std::min<Long64_t>(count, last - entry);
+         for (Long64_t i = 0; i < n; ++i)
+            values[(entry - first + i) * stride] = (Long64_t)data[i];
+         entry += n;
+      } else if (bulkOnly) {
+         return kFALSE;
+      } else {
+         // The entry is not the first one of a basket or the basket can not be read in bulk.
+         branch.GetEntry(entry);
+         values[(entry - first) * stride] = leaf.GetValueLong64();
+         ++entry;
+      }
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the values of the integer branch `name` of the tree for the entries
+/// [first, last) into values[0], values[stride], ... Return false if the
+/// tree has no such branch, if it does not hold a single integer per entry
+/// or if bulkOnly is true and the values cannot be read in bulk.
+
+Bool_t R__ReadIndexColumn(TTree *tree, const char *name, Long64_t first, Long64_t last, Long64_t *values,
+                          Int_t stride, Bool_t bulkOnly = kFALSE)
+{
+   TBranch *branch = tree->GetBranch(name);
+   if (!branch || branch->GetListOfLeaves()->GetEntriesFast() != 1)
+      return kFALSE;
+   TLeaf *leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+   if (leaf->GetLeafCount() || leaf->GetLen() != 1)
+      return kFALSE;
+   const Bool_t isUnsigned = leaf->IsUnsigned();
+   if (leaf->IsA() == TLeafB::Class()) {
+      if (isUnsigned) return R__ReadIntegerColumn<UChar_t>(*branch, *leaf, first, last, values, stride, bulkOnly);
+      else            return R__ReadIntegerColumn<Char_t>(*branch, *leaf, first, last, values, stride, bulkOnly);
+   } else if (leaf->IsA() == TLeafS::Class()) {
+      if (isUnsigned) return R__ReadIntegerColumn<UShort_t>(*branch, *leaf, first, last, values, stride, bulkOnly);
+      else            return R__ReadIntegerColumn<Short_t>(*branch, *leaf, first, last, values, stride, bulkOnly);
+   } else if (leaf->IsA() == TLeafI::Class()) {
+      if (isUnsigned) return R__ReadIntegerColumn<UInt_t>(*branch, *leaf, first, last, values, stride, bulkOnly);
+      else            return R__ReadIntegerColumn<Int_t>(*branch, *leaf, first, last, values, stride, bulkOnly);
+   } else if (leaf->IsA() == TLeafL::Class()) {
+      if (isUnsigned) return R__ReadIntegerColumn<ULong64_t>(*branch, *leaf, first, last, values, stride, bulkOnly);
+      else            return R__ReadIntegerColumn<Long64_t>(*branch, *leaf, first, last, values, stride, bulkOnly);
+   }
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of bits needed to store any value in [0, range].
+
+UChar_t R__BitsFor(ULong64_t range)
+{
+   UChar_t bits = 0;
+   while (range) {
+      ++bits;
+      range >>= 1;
+   }
+   return bits;
+}
+
+using KeyEntry_t = std::pair<ULong64_t, Long64_t>;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sort the pairs key,entry. With the implicit multi-threading enabled,
+/// large vectors are sorted in parallel by the thread pool.
+
+void R__SortKeys(std::vector<KeyEntry_t> &pairs)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && pairs.size() >= kMinParallelSort) {
+      ROOT::TThreadExecutor pool;
+      pool.Sort(pairs.begin(), pairs.end());
+      return;
+   }
+#endif
+   std::sort(pairs.begin(), pairs.end());
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Default constructor for TTreeCompactIndex
+
+TTreeCompactIndex::TTreeCompactIndex(): TVirtualIndex()
+{
+   fTree               = 0;
+   fN                  = 0;
+   fMajorMin           = 0;
+   fMajorMax           = 0;
+   fMinorMin           = 0;
+   fMinorMax           = 0;
+   fMinorBits          = 0;
+   fMajorFormulaParent = 0;
+   fMinorFormulaParent = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Normal constructor for TTreeCompactIndex
+///
+/// Build an index table using the branches of Tree T named majorname and
+/// minorname. Both branches must hold a single integer value per entry.
+/// To build an index with only majorname, specify minorname="0" (default).
+///
+/// The index is zombie if the branches cannot be used or if the ranges of
+/// their values do not fit together in a 64 bit key.
+
+TTreeCompactIndex::TTreeCompactIndex(const TTree *T, const char *majorname, const char *minorname)
+           : TVirtualIndex()
+{
+   fTree               = (TTree*)T;
+   fN                  = 0;
+   fMajorMin           = 0;
+   fMajorMax           = 0;
+   fMinorMin           = 0;
+   fMinorMax           = 0;
+   fMinorBits          = 0;
+   fMajorFormulaParent = 0;
+   fMinorFormulaParent = 0;
+   fMajorName          = majorname;
+   fMinorName          = minorname;
+   if (!T) return;
+   fN = T->GetEntries();
+   if (fN <= 0) {
+      MakeZombie();
+      Error("TTreeCompactIndex","Cannot build a TTreeCompactIndex with a Tree having no entries");
+      return;
+   }
+
+   const Bool_t constantMinor = (fMinorName == "0");
+   std::vector<Long64_t> triplets(3 * fN, 0);
+   Long64_t oldEntry = fTree->GetReadEntry();
+   Long64_t first = 0;
+   while (first < fN) {
+      // For a TChain, read the trees one after the other.
+      if (fTree->LoadTree(first) < 0) break;
+      TTree *tree = fTree->GetTree();
+      const Long64_t nEntries = std::min(tree->GetEntries(), fN - first);
+      if (nEntries <= 0) break;
+      if (!R__ReadIndexColumn(tree, fMajorName, 0, nEntries, &triplets[3 * first], 3) ||
+          (!constantMinor && !R__ReadIndexColumn(tree, fMinorName, 0, nEntries, &triplets[3 * first + 1], 3))) {
+         fTree->LoadTree(oldEntry);
+         MakeZombie();
+         Error("TTreeCompactIndex","Cannot build the index with major=%s, minor=%s: both must be branches holding one integer per entry",
+               fMajorName.Data(), fMinorName.Data());
+         fN = 0;
+         return;
+      }
+      for (Long64_t i = first; i < first + nEntries; ++i)
+         triplets[3 * i + 2] = i;
+      first += nEntries;
+   }
+   fTree->LoadTree(oldEntry);
+   // A TChain may report more entries than it actually has.
+   triplets.resize(3 * first);
+
+   if (!Pack(triplets)) {
+      MakeZombie();
+      return;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor.
+
+TTreeCompactIndex::~TTreeCompactIndex()
+{
+   if (fTree && fTree->GetTreeIndex() == this) fTree->SetTreeIndex(0);
+   delete fMajorFormulaParent;  fMajorFormulaParent = 0;
+   delete fMinorFormulaParent;  fMinorFormulaParent = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the sorted keys from the triplets major, minor, entry, which are
+/// consumed. Return kFALSE, leaving the index empty, if the ranges of the
+/// major and minor values do not fit together in 64 bits.
+
+Bool_t TTreeCompactIndex::Pack(std::vector<Long64_t> &triplets)
+{
+   const Long64_t n = triplets.size() / 3;
+   fN = 0;
+   fKeys.clear();
+   fEntries32.clear();
+   fEntries64.clear();
+   if (n == 0) return kTRUE;
+
+   Long64_t maxEntry = 0;
+   fMajorMin = fMajorMax = triplets[0];
+   fMinorMin = fMinorMax = triplets[1];
+   for (Long64_t i = 0; i < n; ++i) {
+      fMajorMin = std::min(fMajorMin, triplets[3 * i]);
+      fMajorMax = std::max(fMajorMax, triplets[3 * i]);
+      fMinorMin = std::min(fMinorMin, triplets[3 * i + 1]);
+      fMinorMax = std::max(fMinorMax, triplets[3 * i + 1]);
+      maxEntry = std::max(maxEntry, triplets[3 * i + 2]);
+   }
+   const UChar_t majorBits = R__BitsFor((ULong64_t)fMajorMax - (ULong64_t)fMajorMin);
+   fMinorBits = R__BitsFor((ULong64_t)fMinorMax - (ULong64_t)fMinorMin);
+   if (majorBits + fMinorBits > 64) {
+      Error("Pack","The ranges of %s [%lld, %lld] and %s [%lld, %lld] need %d bits, more than the 64 bits of a key",
+            fMajorName.Data(), fMajorMin, fMajorMax, fMinorName.Data(), fMinorMin, fMinorMax, majorBits + fMinorBits);
+      triplets.clear();
+      return kFALSE;
+   }
+
+   std::vector<KeyEntry_t> pairs(n);
+   for (Long64_t i = 0; i < n; ++i) {
+      const ULong64_t major = (ULong64_t)triplets[3 * i] - (ULong64_t)fMajorMin;
+      const ULong64_t minor = (ULong64_t)triplets[3 * i + 1] - (ULong64_t)fMinorMin;
+      pairs[i].first = (fMinorBits < 64 ? major << fMinorBits : 0) | minor;
+      pairs[i].second = triplets[3 * i + 2];
+   }
+   std::vector<Long64_t>().swap(triplets);
+   R__SortKeys(pairs);
+
+   fN = n;
+   fKeys.resize(n);
+   const Bool_t narrow = maxEntry <= (Long64_t)std::numeric_limits<UInt_t>::max();
+   if (narrow) fEntries32.resize(n);
+   else        fEntries64.resize(n);
+   for (Long64_t i = 0; i < n; ++i) {
+      fKeys[i] = pairs[i].first;
+      if (narrow) fEntries32[i] = (UInt_t)pairs[i].second;
+      else        fEntries64[i] = pairs[i].second;
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append the triplets major, minor, entry+offset of this index to triplets,
+/// including the ones appended with delaySort.
+
+void TTreeCompactIndex::Unpack(std::vector<Long64_t> &triplets, Long64_t offset) const
+{
+   triplets.reserve(triplets.size() + 3 * fN);
+   for (Long64_t pos = 0; pos < (Long64_t)fKeys.size(); ++pos) {
+      Long64_t major, minor;
+      GetValues(pos, major, minor);
+      triplets.push_back(major);
+      triplets.push_back(minor);
+      triplets.push_back(GetEntry(pos) + offset);
+   }
+   for (std::size_t i = 0; i < fPending.size(); i += 3) {
+      triplets.push_back(fPending[i]);
+      triplets.push_back(fPending[i + 1]);
+      triplets.push_back(fPending[i + 2] + offset);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append 'add' to this index.  Entry 0 in add will become entry n+1 in this.
+/// If delaySort is true, do not sort the value, then you must call
+/// Append(0,kFALSE); the index cannot be used in between.
+
+void TTreeCompactIndex::Append(const TVirtualIndex *add, Bool_t delaySort )
+{
+   if (add && add->GetN()) {
+      const TTreeCompactIndex *ci_add = dynamic_cast<const TTreeCompactIndex*>(add);
+      if (ci_add == 0) {
+         Error("Append","Can only Append a TTreeCompactIndex to a TTreeCompactIndex but got a %s",
+               add->IsA()->GetName());
+         return;
+      }
+      if (fPending.empty()) {
+         Unpack(fPending, 0);
+         fKeys.clear();
+         fEntries32.clear();
+         fEntries64.clear();
+      }
+      ci_add->Unpack(fPending, fN);
+      fN += add->GetN();
+   }
+
+   if (!delaySort && !fPending.empty()) {
+      if (!Pack(fPending))
+         MakeZombie();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the pair major,minor of the key at position pos.
+
+void TTreeCompactIndex::GetValues(Long64_t pos, Long64_t &major, Long64_t &minor) const
+{
+   const ULong64_t key = fKeys[pos];
+   const ULong64_t mask = fMinorBits < 64 ? (1ull << fMinorBits) - 1 : ~0ull;
+   minor = (Long64_t)((ULong64_t)fMinorMin + (key & mask));
+   major = (Long64_t)((ULong64_t)fMajorMin + (fMinorBits < 64 ? key >> fMinorBits : 0));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the position of the first key not lower than the pair major|minor,
+/// searching from position first onward: the keys before first must be lower
+/// than the pair. found is set to kTRUE if the key at the returned position
+/// is the one of the pair.
+
+Long64_t TTreeCompactIndex::FindValues(Long64_t major, Long64_t minor, Long64_t first, Bool_t &found) const
+{
+   found = kFALSE;
+   const Long64_t n = fKeys.size();
+   if (major < fMajorMin) return first;
+   if (major > fMajorMax || (major == fMajorMax && minor > fMinorMax)) return n;
+
+   // Find the smallest key not lower than the pair, even if the pair itself cannot be packed.
+   Bool_t exact = kFALSE;
+   if (minor < fMinorMin) {
+      minor = fMinorMin;
+   } else if (minor > fMinorMax) {
+      ++major;
+      minor = fMinorMin;
+   } else {
+      exact = kTRUE;
+   }
+   const ULong64_t majorv = (ULong64_t)major - (ULong64_t)fMajorMin;
+   const ULong64_t key = (fMinorBits < 64 ? majorv << fMinorBits : 0) | ((ULong64_t)minor - (ULong64_t)fMinorMin);
+
+   Long64_t lo = first, hi = n;
+   if (first > 0) {
+      // Gallop from the previous position: sorted lookups are close to each other.
+      Long64_t step = 1;
+      hi = first;
+      while (hi < n && fKeys[hi] < key) {
+         lo = hi + 1;
+         hi = first + step;
+         step *= 2;
+      }
+      hi = std::min(hi, n);
+   }
+   const Long64_t pos = std::lower_bound(fKeys.begin() + lo, fKeys.begin() + hi, key) - fKeys.begin();
+   found = exact && pos < n && fKeys[pos] == key;
+   return pos;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return entry number corresponding to major and minor number.
+/// If an entry corresponding to major and minor is not found, the function
+/// returns the entry of the major,minor pair immediately lower than the
+/// requested value, ie it will return -1 if the pair is lower than
+/// the first entry in the index.
+///
+/// See also GetEntryNumberWithIndex
+
+Long64_t TTreeCompactIndex::GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor) const
+{
+   if (fKeys.empty()) return -1;
+
+   Bool_t found;
+   Long64_t pos = FindValues(major, minor, 0, found);
+   if (found)
+      return GetEntry(pos);
+   if (--pos < 0)
+      return -1;
+   return GetEntry(pos);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return entry number corresponding to major and minor number, -1 if the
+/// pair is not in the index.
+///
+/// See also GetEntryNumberWithBestIndex
+
+Long64_t TTreeCompactIndex::GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const
+{
+   if (fKeys.empty()) return -1;
+
+   Bool_t found;
+   Long64_t pos = FindValues(major, minor, 0, found);
+   return found ? GetEntry(pos) : -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Look up n pairs major[i],minor[i] at once and store in entries[i] the
+/// corresponding entry number, -1 if the pair is not in the index.
+/// minor may be null, in which case all the minor values are 0.
+///
+/// When a pair is not lower than the previous one, the search starts from
+/// the position of the previous pair: looking up sorted pairs, e.g. to join
+/// the entries of a friend tree sorted by run and event, does not go
+/// through a full binary search for each pair.
+
+void TTreeCompactIndex::GetEntryNumbersWithIndex(Long64_t n, const Long64_t *major, const Long64_t *minor,
+                                                 Long64_t *entries) const
+{
+   Long64_t pos = 0;
+   Long64_t prevMajor = 0, prevMinor = 0;
+   for (Long64_t i = 0; i < n; ++i) {
+      const Long64_t majorv = major[i];
+      const Long64_t minorv = minor ? minor[i] : 0;
+      if (fKeys.empty()) {
+         entries[i] = -1;
+         continue;
+      }
+      const Bool_t sorted = i > 0 && (majorv > prevMajor || (majorv == prevMajor && minorv >= prevMinor));
+      Bool_t found;
+      pos = FindValues(majorv, minorv, sorted ? pos : 0, found);
+      entries[i] = found ? GetEntry(pos) : -1;
+      prevMajor = majorv;
+      prevMinor = minorv;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store in entries[0, last-first) the entry numbers in this (friend) Tree
+/// corresponding to the entries [first, last) of the master Tree 'parent',
+/// -1 for the ones that are not in the index.
+///
+/// The major and minor branches of the parent are read in bulk, without
+/// going through the addresses set by the user, and all the pairs are looked
+/// up at once with GetEntryNumbersWithIndex(). Return kFALSE if the parent
+/// does not have such integer branches or if they cannot be read in bulk
+/// from first onward: GetEntryNumberFriend() must then be used.
+
+Bool_t TTreeCompactIndex::GetEntryNumbersFriend(const TTree *parent, Long64_t first, Long64_t last, Long64_t *entries)
+{
+   if (!parent || !fTree || last <= first || fKeys.empty()) return kFALSE;
+
+   // Prevent the parent from finding the branches of our TTree, which is one of its friends.
+   TTree::TFriendLock friendlock(fTree, TTree::kFindLeaf | TTree::kFindBranch | TTree::kGetBranch | TTree::kGetLeaf);
+   TTree *master = const_cast<TTree*>(parent);
+   const Long64_t n = last - first;
+   std::vector<Long64_t> majors(n), minors(n, 0);
+   if (!R__ReadIndexColumn(master, fMajorName, first, last, majors.data(), 1, kTRUE) ||
+       (fMinorName != "0" && !R__ReadIndexColumn(master, fMinorName, first, last, minors.data(), 1, kTRUE)))
+      return kFALSE;
+   GetEntryNumbersWithIndex(n, majors.data(), minors.data(), entries);
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the entry number in this (friend) Tree corresponding to entry in
+/// the master Tree 'parent'.
+/// In case this (friend) Tree and 'master' do not share an index with the same
+/// major and minor name, the entry serial number in the (friend) tree
+/// and in the master Tree are assumed to be the same
+
+Long64_t TTreeCompactIndex::GetEntryNumberFriend(const TTree *parent)
+{
+   if (!parent) return -3;
+   GetMajorFormulaParent(parent);
+   GetMinorFormulaParent(parent);
+   if (!fMajorFormulaParent || !fMinorFormulaParent) return -1;
+   if (!fMajorFormulaParent->GetNdim() || !fMinorFormulaParent->GetNdim()) {
+      // The Tree Index in the friend has a pair majorname,minorname
+      // not available in the parent Tree T.
+      // if the friend Tree has less entries than the parent, this is an error
+      Long64_t pentry = parent->GetReadEntry();
+      if (pentry >= fTree->GetEntries()) return -2;
+      // otherwise we ignore the Tree Index and return the entry number
+      // in the parent Tree.
+      return pentry;
+   }
+
+   // majorname, minorname exist in the parent Tree
+   // we find the current values pair majorv,minorv in the parent Tree
+   Long64_t majorv = (Long64_t)fMajorFormulaParent->EvalInstance<LongDouble_t>();
+   Long64_t minorv = (Long64_t)fMinorFormulaParent->EvalInstance<LongDouble_t>();
+   return fTree->GetEntryNumberWithIndex(majorv,minorv);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a pointer to the TreeFormula corresponding to the majorname in parent tree.
+
+TTreeFormula *TTreeCompactIndex::GetMajorFormulaParent(const TTree *parent)
+{
+   if (!fMajorFormulaParent) {
+      // Prevent TTreeFormula from finding any of the branches in our TTree even if it
+      // is a friend of the parent TTree.
+      TTree::TFriendLock friendlock(fTree, TTree::kFindLeaf | TTree::kFindBranch | TTree::kGetBranch | TTree::kGetLeaf);
+      fMajorFormulaParent = new TTreeFormula("MajorP",fMajorName.Data(),const_cast<TTree*>(parent));
+      fMajorFormulaParent->SetQuickLoad(kTRUE);
+   }
+   if (fMajorFormulaParent->GetTree() != parent) {
+      fMajorFormulaParent->SetTree(const_cast<TTree*>(parent));
+      fMajorFormulaParent->UpdateFormulaLeaves();
+   }
+   return fMajorFormulaParent;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a pointer to the TreeFormula corresponding to the minorname in parent tree.
+
+TTreeFormula *TTreeCompactIndex::GetMinorFormulaParent(const TTree *parent)
+{
+   if (!fMinorFormulaParent) {
+      // Prevent TTreeFormula from finding any of the branches in our TTree even if it
+      // is a friend of the parent TTree.
+      TTree::TFriendLock friendlock(fTree, TTree::kFindLeaf | TTree::kFindBranch | TTree::kGetBranch | TTree::kGetLeaf);
+      fMinorFormulaParent = new TTreeFormula("MinorP",fMinorName.Data(),const_cast<TTree*>(parent));
+      fMinorFormulaParent->SetQuickLoad(kTRUE);
+   }
+   if (fMinorFormulaParent->GetTree() != parent) {
+      fMinorFormulaParent->SetTree(const_cast<TTree*>(parent));
+      fMinorFormulaParent->UpdateFormulaLeaves();
+   }
+   return fMinorFormulaParent;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if index can be applied to the TTree
+
+Bool_t TTreeCompactIndex::IsValidFor(const TTree *parent)
+{
+   auto *majorFormula = GetMajorFormulaParent(parent);
+   auto *minorFormula = GetMinorFormulaParent(parent);
+   if ((majorFormula == nullptr || majorFormula->GetNdim() == 0) ||
+       (minorFormula == nullptr || minorFormula->GetNdim() == 0))
+         return kFALSE;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the table with : serial number, majorname, minorname, entry number.
+/// -  if option = "10" print only the first 10 entries
+/// -  if option = "100" print only the first 100 entries
+/// -  if option = "1000" print only the first 1000 entries
+
+void TTreeCompactIndex::Print(Option_t * option) const
+{
+   TString opt = option;
+   Long64_t n = fKeys.size();
+   if (opt.Contains("10"))   n = std::min<Long64_t>(n, 10);
+   if (opt.Contains("100"))  n = std::min<Long64_t>(fKeys.size(), 100);
+   if (opt.Contains("1000")) n = std::min<Long64_t>(fKeys.size(), 1000);
+
+   Printf("\n*****************************************************************");
+   Printf("*    Compact index of Tree: %s/%s",fTree ? fTree->GetName() : "",fTree ? fTree->GetTitle() : "");
+   Printf("*    %lld entries, %d bits for %s, %d bytes per entry",fN,fMinorBits,fMinorName.Data(),
+          fEntries64.empty() ? (Int_t)(sizeof(ULong64_t) + sizeof(UInt_t)) : (Int_t)(2 * sizeof(Long64_t)));
+   Printf("*****************************************************************");
+   Printf("%8s : %16s : %16s : %16s","serial",fMajorName.Data(),fMinorName.Data(),"entry number");
+   Printf("*****************************************************************");
+   for (Long64_t i=0;i<n;i++) {
+      Long64_t major, minor;
+      GetValues(i, major, minor);
+      Printf("%8lld :         %8lld :         %8lld :         %8lld",
+             i, major, minor, GetEntry(i));
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called by TChain::LoadTree when the parent chain changes it's tree.
+
+void TTreeCompactIndex::UpdateFormulaLeaves(const TTree *parent)
+{
+   if (fMajorFormulaParent) {
+      if (parent) fMajorFormulaParent->SetTree(const_cast<TTree*>(parent));
+      fMajorFormulaParent->UpdateFormulaLeaves();
+   }
+   if (fMinorFormulaParent) {
+      if (parent) fMinorFormulaParent->SetTree(const_cast<TTree*>(parent));
+      fMinorFormulaParent->UpdateFormulaLeaves();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// this function is called by TChain::LoadTree and TTreePlayer::UpdateFormulaLeaves
+/// when a new Tree is loaded.
+
+void TTreeCompactIndex::SetTree(const TTree *T)
+{
+   fTree = (TTree*)T;
+}
@@ -19,6 +19,11 @@
 #include "TClonesArray.h"
 #include "TLeafB.h"
 #include "TLeafC.h"
+#include "TLeafD.h"
+#include "TLeafF.h"
+#include "TLeafI.h"
+#include "TLeafL.h"
+#include "TLeafS.h"
 #include "TLeafElement.h"
 #include "TLeafObject.h"
 #include "TMethodCall.h"
@@ -4417,6 +4422,35 @@ TFormLeafInfo *TTreeFormula::GetLeafInfo(Int_t code) const
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the leaf read by the formula if the formula is nothing but the
+/// value of a numerical leaf (`B`, `b`, `S`, `s`, `I`, `i`, `L`, `l`, `F` or
+/// `D`) holding a single value per entry in a TBranch with no other leaf,
+/// without cast, index, data member or method. Return 0 otherwise.
+///
+/// The value of such a formula for an entry is the value of the leaf, which
+/// can be read in bulk (see TBranch::GetBulkRead) instead of evaluating the
+/// formula.
+
+TLeaf *TTreeFormula::GetDirectLeaf() const
+{
+   if (fNoper != 1 || fNcodes != 1 || fHasCast || fMultiplicity != 0 || GetAction(0) != kDefinedVariable)
+      return 0;
+   if (!fLookupType || fLookupType[0] != kDirect || fDataMembers.At(0) || fMethods.At(0))
+      return 0;
+   TLeaf *leaf = (TLeaf*)fLeaves.At(0);
+   if (!leaf || leaf->GetLeafCount() || leaf->GetLen() != 1)
+      return 0;
+   TBranch *branch = leaf->GetBranch();
+   if (!branch || branch->IsA() != TBranch::Class() || branch->GetNleaves() != 1)
+      return 0;
+   TClass *cl = leaf->IsA();
+   if (cl != TLeafB::Class() && cl != TLeafS::Class() && cl != TLeafI::Class() && cl != TLeafL::Class() &&
+       cl != TLeafF::Class() && cl != TLeafD::Class())
+      return 0;
+   return leaf;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return leaf corresponding to serial number n.
 
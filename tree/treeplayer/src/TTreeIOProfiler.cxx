@@ -0,0 +1,344 @@
+// @(#)root/treeplayer:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TTreeIOProfiler
+Thread-aware profiler of the TTree I/O.
+
+TTreePerfStats monitors a single TTree, from the thread reading it. A
+TTreeIOProfiler instead receives the I/O events of all the threads of the
+process, including the tasks of the implicit multi-threading,
+TTreeProcessorMT and RDataFrame, and attributes them to the branch or the
+file they concern and to the thread which did them:
+
+  - kFileRead: the reads from a local TFile,
+  - kCacheFill: the transfer of the blocks of a TTreeCache,
+  - kBasketRead: the read of a basket, from the file or the cache,
+  - kBasketUnzip: the decompression of a basket,
+  - kDeserialize: the deserialization of the entries of a branch.
+
+~~~{.cpp}
+    TTreeIOProfiler profiler;
+    profiler.Start();
+    ROOT::RDataFrame df("events", "data.root");
+    df.Histo1D("px")->Draw();
+    profiler.Stop();
+    profiler.Print();                        // summary table per step and branch
+    profiler.SaveTimeline("io.trace.json");  // load in chrome://tracing or Perfetto
+~~~
+The events of each thread are recorded in a buffer of their own, without
+synchronization. The deserialization of the entries, done once per entry
+and branch, is only accumulated in the summary; the other steps also go
+to the timeline, unless the profiler is created with timeline = kFALSE.
+Only one profiler can be active at a time.
+*/
+
+#include "TTreeIOProfiler.h"
+#include "TBranch.h"
+#include "TFile.h"
+#include "TTimeStamp.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <map>
+
+ClassImp(TTreeIOProfiler);
+
+namespace {
+
+std::atomic<ULong64_t> gNextProfilerId{1};
+
+/// The record of the current thread in the last profiler it reported to.
+struct RThreadSlot {
+   ULong64_t fProfilerId = 0;
+   void *fRecord = nullptr;
+};
+thread_local RThreadSlot gThreadSlot;
+
+const char *gIOStepNames[] = {"FileRead", "CacheFill", "BasketRead", "BasketUnzip", "Deserialize"};
+
+/// Escape the quotes and backslashes of a name for a JSON string.
+std::string EscapeJSON(const std::string &name)
+{
+   std::string escaped;
+   for (char c : name) {
+      if (c == '"' || c == '\\')
+         escaped += '\\';
+      if (static_cast<unsigned char>(c) >= 0x20)
+         escaped += c;
+   }
+   return escaped;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a profiler; it starts recording with Start(). If timeline is kFALSE
+/// only the summary statistics are recorded.
+
+TTreeIOProfiler::TTreeIOProfiler(const char *name, Bool_t timeline)
+   : fName(name), fId(gNextProfilerId++), fStartTime(TTimeStamp()), fTimeline(timeline)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor, stops the profiling.
+
+TTreeIOProfiler::~TTreeIOProfiler()
+{
+   Stop();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start receiving the I/O events of all the threads. The times of the
+/// timeline are counted from the first start after a Reset().
+
+void TTreeIOProfiler::Start()
+{
+   SetGlobalPerfStats(this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop receiving the I/O events. The events in flight in other threads
+/// may still be recorded: stop the profiler once their work is finished.
+
+void TTreeIOProfiler::Stop()
+{
+   if (IsActive())
+      SetGlobalPerfStats(nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Drop all the recorded events. Must not be called while the profiler is
+/// active.
+
+void TTreeIOProfiler::Reset()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   fThreads.clear();
+   fId = gNextProfilerId++;
+   fStartTime = TTimeStamp();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the record of the calling thread, creating it for its first event.
+
+TTreeIOProfiler::ThreadRecord &TTreeIOProfiler::GetThreadRecord()
+{
+   if (gThreadSlot.fProfilerId != fId) {
+      std::lock_guard<std::mutex> lock(fMutex);
+      const auto id = std::this_thread::get_id();
+      auto it = std::find_if(fThreads.begin(), fThreads.end(),
+                             [id](const std::unique_ptr<ThreadRecord> &t) { return t->fThreadId == id; });
+      if (it == fThreads.end()) {
+         fThreads.emplace_back(new ThreadRecord);
+         fThreads.back()->fThreadId = id;
+         it = fThreads.end() - 1;
+      }
+      gThreadSlot.fProfilerId = fId;
+      gThreadSlot.fRecord = it->get();
+   }
+   return *static_cast<ThreadRecord *>(gThreadSlot.fRecord);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Record a step of the branch or file at address, which started at time
+/// start and ends now.
+
+void TTreeIOProfiler::Record(EIOStep step, const void *address, const char *name, Long64_t bytes, Double_t start)
+{
+   const Double_t end = TTimeStamp();
+   ThreadRecord &thread = GetThreadRecord();
+
+   Int_t source;
+   auto found = thread.fSourceIndex.find(address);
+   if (found != thread.fSourceIndex.end() && thread.fSources[found->second].fName == name) {
+      source = found->second;
+   } else {
+      // first event of this source, or another one reusing the address
+      source = thread.fSources.size();
+      thread.fSources.push_back(SourceRecord{address, name, {}});
+      thread.fSourceIndex[address] = source;
+   }
+   StepStats &stats = thread.fSources[source].fStats[step];
+   ++stats.fCalls;
+   stats.fBytes += bytes;
+   stats.fTime += end - start;
+
+   if (fTimeline && step != kDeserialize)
+      thread.fEvents.push_back(TimelineEvent{step, source, start - fStartTime, end - start, bytes});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// A basket of branch was read.
+
+void TTreeIOProfiler::BasketReadEvent(TBranch *branch, Int_t len, Double_t start)
+{
+   Record(kBasketRead, branch, branch->GetName(), len, start);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// A basket of branch was uncompressed, the uncompressed size is counted.
+
+void TTreeIOProfiler::BasketUnzipEvent(TBranch *branch, Int_t /* complen */, Int_t objlen, Double_t start)
+{
+   Record(kBasketUnzip, branch, branch->GetName(), objlen, start);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// An entry of branch was deserialized.
+
+void TTreeIOProfiler::BranchReadEvent(TBranch *branch, Int_t nbytes, Double_t start)
+{
+   Record(kDeserialize, branch, branch->GetName(), nbytes, start);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The read cache of file was filled.
+
+void TTreeIOProfiler::CacheFillEvent(TFile *file, Int_t /* nblocks */, Long64_t len, Double_t start)
+{
+   Record(kCacheFill, file, file->GetName(), len, start);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// A buffer was read from file.
+
+void TTreeIOProfiler::FileReadEvent(TFile *file, Int_t len, Double_t start)
+{
+   Record(kFileRead, file, file->GetName(), len, start);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of bytes read from the files.
+
+Long64_t TTreeIOProfiler::GetBytesRead() const
+{
+   return GetStats(kFileRead).fBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of threads which reported events.
+
+Int_t TTreeIOProfiler::GetNThreads() const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   return fThreads.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the statistics of a step, for the branch or file named source
+/// (all of them if nullptr) in the thread of index thread (all of them if -1).
+
+TTreeIOProfiler::StepStats TTreeIOProfiler::GetStats(EIOStep step, const char *source, Int_t thread) const
+{
+   StepStats sum;
+   if (step < 0 || step >= kNumIOSteps)
+      return sum;
+   std::lock_guard<std::mutex> lock(fMutex);
+   for (Int_t t = 0; t < (Int_t)fThreads.size(); ++t) {
+      if (thread >= 0 && t != thread)
+         continue;
+      for (const auto &s : fThreads[t]->fSources) {
+         if (source && s.fName != source)
+            continue;
+         sum.fCalls += s.fStats[step].fCalls;
+         sum.fBytes += s.fStats[step].fBytes;
+         sum.fTime += s.fStats[step].fTime;
+      }
+   }
+   return sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of a step.
+
+const char *TTreeIOProfiler::GetStepName(EIOStep step)
+{
+   if (step < 0 || step >= kNumIOSteps)
+      return "Illegal EIOStep";
+   return gIOStepNames[step];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the summary table: calls, bytes and time of each step, per branch
+/// or file summed over the threads, then per thread summed over the sources.
+
+void TTreeIOProfiler::Print(Option_t * /* option */) const
+{
+   std::map<std::string, std::array<StepStats, kNumIOSteps>> perSource;
+   std::vector<std::array<StepStats, kNumIOSteps>> perThread;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      for (const auto &t : fThreads) {
+         perThread.emplace_back();
+         for (const auto &s : t->fSources) {
+            auto &sum = perSource[s.fName];
+            for (Int_t step = 0; step < kNumIOSteps; ++step) {
+               for (StepStats *stats : {&sum[step], &perThread.back()[step]}) {
+                  stats->fCalls += s.fStats[step].fCalls;
+                  stats->fBytes += s.fStats[step].fBytes;
+                  stats->fTime += s.fStats[step].fTime;
+               }
+            }
+         }
+      }
+   }
+
+   Printf("TTreeIOProfiler %s: %d threads", fName.Data(), (Int_t)perThread.size());
+   Printf("%-32s %-12s %12s %14s %12s", "Branch/File", "Step", "Calls", "Bytes", "Time [s]");
+   for (const auto &s : perSource) {
+      for (Int_t step = 0; step < kNumIOSteps; ++step) {
+         if (s.second[step].fCalls)
+            Printf("%-32s %-12s %12lld %14lld %12.6f", s.first.c_str(), gIOStepNames[step], s.second[step].fCalls,
+                   s.second[step].fBytes, s.second[step].fTime);
+      }
+   }
+   Printf("%-32s %-12s %12s %14s %12s", "Thread", "Step", "Calls", "Bytes", "Time [s]");
+   for (Int_t t = 0; t < (Int_t)perThread.size(); ++t) {
+      for (Int_t step = 0; step < kNumIOSteps; ++step) {
+         if (perThread[t][step].fCalls)
+            Printf("%-32d %-12s %12lld %14lld %12.6f", t, gIOStepNames[step], perThread[t][step].fCalls,
+                   perThread[t][step].fBytes, perThread[t][step].fTime);
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Save the timeline in the Chrome trace event format, which can be loaded in
+/// chrome://tracing or in the Perfetto UI: one track per thread, one complete
+/// event per step with the branch or file as name. Returns kFALSE if the file
+/// can not be written.
+
+Bool_t TTreeIOProfiler::SaveTimeline(const char *filename) const
+{
+   std::ofstream out(filename);
+   if (!out) {
+      Error("SaveTimeline", "Can not open %s", filename);
+      return kFALSE;
+   }
+   out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+   const char *sep = "\n";
+   std::lock_guard<std::mutex> lock(fMutex);
+   for (Int_t t = 0; t < (Int_t)fThreads.size(); ++t) {
+      out << sep << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+          << ",\"args\":{\"name\":\"I/O thread " << t << "\"}}";
+      sep = ",\n";
+      const ThreadRecord &thread = *fThreads[t];
+      for (const auto &e : thread.fEvents) {
+         out << sep << "{\"name\":\"" << EscapeJSON(thread.fSources[e.fSource].fName) << "\",\"cat\":\""
+             << gIOStepNames[e.fStep] << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << t << ",\"ts\":" << e.fStart * 1.e6
+             << ",\"dur\":" << e.fDuration * 1.e6 << ",\"args\":{\"bytes\":" << e.fBytes << "}}";
+      }
+   }
+   out << "\n]}\n";
+   return out.good();
+}
@@ -61,6 +61,8 @@ The Draw or Print functions print the following information:
  -  Real Time = Real Time in seconds
  -  CPU  Time = CPU Time in seconds
  -  Disk Time = Real Time spent in pure raw disk IO
+ -  BufReuse  = Number of basket buffers recycled (see TTree::SetBasketBufferPoolSize)
+                 out of the number of basket buffers requested
  -  Disk IO   = Raw disk IO speed in MBytes/second
  -  ReadUZRT  = Unzipped MBytes per RT second
  -  ReadUZCP  = Unipped MBytes per CP second
@@ -125,6 +127,10 @@ TTreePerfStats::TTreePerfStats() : TVirtualPerfStats()
    fDiskTime      = 0;
    fUnzipTime     = 0;
    fCompress      = 0;
+   fBufferRequests= 0;
+   fBufferHits    = 0;
+   fStartBufferRequests = 0;
+   fStartBufferHits     = 0;
    fRealTimeAxis  = 0;
    fHostInfoText  = 0;
 }
@@ -162,6 +168,10 @@ TTreePerfStats::TTreePerfStats(const char *name, TTree *T) : TVirtualPerfStats()
    fUnzipTime     = 0;
    fRealTimeAxis  = 0;
    fCompress      = (T->GetTotBytes()+0.00001)/T->GetZipBytes();
+   fBufferRequests= 0;
+   fBufferHits    = 0;
+   Long64_t pooledBytes = 0;
+   T->GetBasketBufferPoolStats(fStartBufferRequests, fStartBufferHits, pooledBytes);
 
    Bool_t isUNIX = strcmp(gSystem->GetName(), "Unix") == 0;
    if (isUNIX)
@@ -328,6 +338,11 @@ void TTreePerfStats::Finish()
    fBytesReadExtra= fFile->GetBytesReadExtra();
    fRealTime      = fWatch->RealTime();
    fCpuTime       = fWatch->CpuTime();
+   ULong64_t requests = 0, hits = 0;
+   Long64_t pooledBytes = 0;
+   fTree->GetBasketBufferPoolStats(requests, hits, pooledBytes);
+   fBufferRequests = requests - fStartBufferRequests;
+   fBufferHits    = hits - fStartBufferHits;
    Int_t npoints  = fGraphIO->GetN();
    if (!npoints) return;
    Double_t iomax = TMath::MaxElement(npoints,fGraphIO->GetY());
@@ -545,6 +560,7 @@ void TTreePerfStats::Print(Option_t * option) const
    printf("Real Time = %7.3f seconds\n",fRealTime);
    printf("CPU  Time = %7.3f seconds\n",fCpuTime);
    printf("Disk Time = %7.3f seconds\n",fDiskTime);
+   printf("BufReuse  = %lld/%lld basket buffers recycled\n",fBufferHits,fBufferRequests);
    if (unzip) {
       printf("Strm Time = %7.3f seconds\n",fCpuTime-fUnzipTime);
       printf("UnzipTime = %7.3f seconds\n",fUnzipTime);
@@ -665,6 +681,8 @@ void TTreePerfStats::SavePrimitive(std::ostream &out, Option_t *option /*= ""*/)
    out<<"   ps->SetDiskTime("<<fDiskTime<<");"<<std::endl;
    out<<"   ps->SetUnzipTime("<<fUnzipTime<<");"<<std::endl;
    out<<"   ps->SetCompress("<<fCompress<<");"<<std::endl;
+   out<<"   ps->SetBufferRequests("<<fBufferRequests<<");"<<std::endl;
+   out<<"   ps->SetBufferHits("<<fBufferHits<<");"<<std::endl;
 
    Int_t i, npoints = fGraphIO->GetN();
    out<<"   TGraphErrors *psGraphIO = new TGraphErrors("<<npoints<<");"<<std::endl;
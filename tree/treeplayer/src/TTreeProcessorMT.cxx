@@ -22,11 +22,28 @@ The implementation of ROOT::TTreeProcessorMT parallelizes the processing of the
 each corresponding to a cluster in the TTree. This is possible thanks to the use
 of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTree
 objects.
+
+The files are opened and their clusters discovered concurrently, by the tasks of the thread pool. The entries and
+clusters of the trees can also be stored in an index file that is reused by later runs, without opening the input
+files (see TTreeProcessorMT::SetClusterIndexFile).
+
+The subranges of each file are pulled from a shared queue by the workers, largest first.
+Clusters that are large compared to the entries left to process are split, so that the
+subranges get smaller towards the end of the processing and the workers complete at
+about the same time (see TTreeProcessorMT::SetMinEntriesPerTask).
 */
 
 #include "TROOT.h"
+#include "TSystem.h"
+#include "ROOT/TSeq.hxx"
 #include "ROOT/TTreeProcessorMT.hxx"
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <tuple>
+
 using namespace ROOT;
 
 namespace {
@@ -40,45 +57,98 @@ struct EntryCluster {
 // EntryClusters and number of entries per file
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryCluster>>, std::vector<Long64_t>>;
 
+/// The number of entries of a tree and the first entry of each of its clusters, in the numbering of the tree
+struct TreeClusters {
+   Long64_t entries = 0ll;
+   std::vector<Long64_t> clusterStarts;
+};
+
+/// Entries and clusters of trees, by file name and tree name
+using ClusterIndex = std::map<std::pair<std::string, std::string>, TreeClusters>;
+
 ////////////////////////////////////////////////////////////////////////
-/// Return a vector of cluster boundaries for the given tree and files.
-static ClustersAndEntries
-MakeClusters(const std::vector<std::string> &treeNames, const std::vector<std::string> &fileNames)
+/// Open the file and read the number of entries and the cluster boundaries of the tree.
+static TreeClusters GetTreeClusters(const std::string &treeName, const std::string &fileName)
 {
    // Note that as a side-effect of opening all files that are going to be used in the
    // analysis once, all necessary streamers will be loaded into memory.
    TDirectory::TContext c;
+   std::unique_ptr<TFile> f(TFile::Open(fileName.c_str())); // need TFile::Open to load plugins if need be
+   if (!f || f->IsZombie()) {
+      const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
+      throw std::runtime_error(msg);
+   }
+   auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
+
+   if (!t) {
+      const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
+                       "\" from file \"" + fileName + "\"";
+      throw std::runtime_error(msg);
+   }
+
+   TreeClusters clusters;
+   clusters.entries = t->GetEntries();
+   auto clusterIter = t->GetClusterIterator(0);
+   Long64_t start = 0ll;
+   while ((start = clusterIter()) < clusters.entries)
+      clusters.clusterStarts.emplace_back(start);
+   return clusters;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Return the entries and clusters of the given trees and files. The ones found in the index are taken from there,
+/// the others are read from the files, which are opened concurrently by the tasks of the pool if one is given.
+/// The index is completed with the trees that were not in it.
+static std::vector<TreeClusters> GetAllTreeClusters(const std::vector<std::string> &treeNames,
+                                                    const std::vector<std::string> &fileNames, ClusterIndex &index,
+                                                    ROOT::TThreadExecutor *pool)
+{
+   const auto nFiles = fileNames.size();
+   std::vector<TreeClusters> clusters(nFiles);
+   std::vector<std::size_t> toRead;
+   for (auto i = 0u; i < nFiles; ++i) {
+      const auto it = index.find({fileNames[i], treeNames[i]});
+      if (it != index.end())
+         clusters[i] = it->second;
+      else
+         toRead.emplace_back(i);
+   }
+
+   auto readClusters = [&](std::size_t i) { return GetTreeClusters(treeNames[toRead[i]], fileNames[toRead[i]]); };
+   std::vector<TreeClusters> read;
+   if (pool && toRead.size() > 1) {
+      read = pool->Map(readClusters, ROOT::TSeq<std::size_t>(toRead.size()));
+   } else {
+      for (auto i = 0u; i < toRead.size(); ++i)
+         read.emplace_back(readClusters(i));
+   }
+   for (auto i = 0u; i < toRead.size(); ++i) {
+      clusters[toRead[i]] = read[i];
+      index[{fileNames[toRead[i]], treeNames[toRead[i]]}] = std::move(read[i]);
+   }
+   return clusters;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Return a vector of cluster boundaries for the given tree and files.
+static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
+                                       const std::vector<std::string> &fileNames, ClusterIndex &index,
+                                       ROOT::TThreadExecutor *pool)
+{
+   const auto treeClusters = GetAllTreeClusters(treeNames, fileNames, index, pool);
    const auto nFileNames = fileNames.size();
    std::vector<std::vector<EntryCluster>> clustersPerFile;
    std::vector<Long64_t> entriesPerFile;
    entriesPerFile.reserve(nFileNames);
    Long64_t offset = 0ll;
-   for (auto i = 0u; i < nFileNames; ++i) {
-      const auto &fileName = fileNames[i];
-      const auto &treeName = treeNames[i];
-
-      std::unique_ptr<TFile> f(TFile::Open(fileName.c_str())); // need TFile::Open to load plugins if need be
-      if (!f || f->IsZombie()) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
-      }
-      auto *t = f->Get<TTree>(treeName.c_str());  // t will be deleted by f
-
-      if (!t) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
-                          "\" from file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
-      }
-
-      auto clusterIter = t->GetClusterIterator(0);
-      Long64_t start = 0ll, end = 0ll;
-      const Long64_t entries = t->GetEntries();
-      // Iterate over the clusters in the current file
+   for (const auto &thisTree : treeClusters) {
+      const auto &starts = thisTree.clusterStarts;
+      const auto entries = thisTree.entries;
       std::vector<EntryCluster> clusters;
-      while ((start = clusterIter()) < entries) {
-         end = clusterIter.GetNextEntry();
+      for (auto i = 0u; i < starts.size(); ++i) {
+         const auto end = i + 1 < starts.size() ? starts[i + 1] : entries;
          // Add the current file's offset to start and end to make them (chain) global
-         clusters.emplace_back(EntryCluster{start + offset, end + offset});
+         clusters.emplace_back(EntryCluster{starts[i] + offset, end + offset});
       }
       offset += entries;
       clustersPerFile.emplace_back(std::move(clusters));
@@ -133,30 +203,127 @@ MakeClusters(const std::vector<std::string> &treeNames, const std::vector<std::s
    return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Split the entry ranges of a file so that all workers complete at about the same time.
+/// The ranges are processed in order, each by the first worker that becomes free, so a range only needs to be small
+/// compared to the work left after it: a range is split if it is larger than 1/(2*nWorkers) of the entries that remain
+/// to be processed, but never into ranges smaller than minEntries. Large ranges are thus processed first, and the
+/// ranges shrink towards the end of the processing, filling the gaps between the workers that complete earlier.
+static std::vector<EntryCluster>
+SplitForDynamicScheduling(const std::vector<EntryCluster> &clusters, unsigned int nWorkers, Long64_t minEntries)
+{
+   Long64_t remaining = 0;
+   for (const auto &c : clusters)
+      remaining += c.end - c.start;
+
+   std::vector<EntryCluster> ranges;
+   ranges.reserve(clusters.size());
+   for (const auto &c : clusters) {
+      auto start = c.start;
+      while (start < c.end) {
+         const auto target = std::max(minEntries, remaining / (2 * nWorkers));
+         // do not leave behind a range smaller than minEntries
+         const auto end = c.end - start - target >= minEntries ? start + target : c.end;
+         ranges.emplace_back(EntryCluster{start, end});
+         remaining -= end - start;
+         start = end;
+      }
+   }
+   return ranges;
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector containing the number of entries of each file of each friend TChain
 static std::vector<std::vector<Long64_t>>
 GetFriendEntries(const std::vector<std::pair<std::string, std::string>> &friendNames,
-                 const std::vector<std::vector<std::string>> &friendFileNames)
+                 const std::vector<std::vector<std::string>> &friendFileNames, ClusterIndex &index,
+                 ROOT::TThreadExecutor *pool)
 {
-   std::vector<std::vector<Long64_t>> friendEntries;
+   // The files of all friends are opened at once
+   std::vector<std::string> treeNames;
+   std::vector<std::string> fileNames;
    const auto nFriends = friendNames.size();
    for (auto i = 0u; i < nFriends; ++i) {
-      std::vector<Long64_t> nEntries;
-      const auto &thisFriendName = friendNames[i].first;
-      const auto &thisFriendFiles = friendFileNames[i];
-      for (const auto &fname : thisFriendFiles) {
-         std::unique_ptr<TFile> f(TFile::Open(fname.c_str()));
-         TTree *t = nullptr; // owned by TFile
-         f->GetObject(thisFriendName.c_str(), t);
-         nEntries.emplace_back(t->GetEntries());
+      for (const auto &fname : friendFileNames[i]) {
+         treeNames.emplace_back(friendNames[i].first);
+         fileNames.emplace_back(fname);
       }
+   }
+   const auto treeClusters = GetAllTreeClusters(treeNames, fileNames, index, pool);
+
+   std::vector<std::vector<Long64_t>> friendEntries;
+   auto thisTree = treeClusters.begin();
+   for (auto i = 0u; i < nFriends; ++i) {
+      std::vector<Long64_t> nEntries;
+      for (auto j = 0u; j < friendFileNames[i].size(); ++j, ++thisTree)
+         nEntries.emplace_back(thisTree->entries);
       friendEntries.emplace_back(std::move(nEntries));
    }
 
    return friendEntries;
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Read the entries and clusters of the trees stored in the index file. Return an empty index if the file does not
+/// exist.
+static ClusterIndex ReadClusterIndex(const std::string &indexFileName)
+{
+   ClusterIndex index;
+   if (gSystem->AccessPathName(indexFileName.c_str()))
+      return index;
+
+   TDirectory::TContext c;
+   std::unique_ptr<TFile> f(TFile::Open(indexFileName.c_str()));
+   TTree *t = nullptr;
+   if (f && !f->IsZombie())
+      f->GetObject("ClusterIndex", t);
+   if (!t)
+      throw std::runtime_error("TTreeProcessorMT: file \"" + indexFileName + "\" does not contain a cluster index");
+
+   std::string *fileName = nullptr, *treeName = nullptr;
+   std::vector<Long64_t> *clusterStarts = nullptr;
+   Long64_t entries = 0ll;
+   t->SetBranchAddress("fileName", &fileName);
+   t->SetBranchAddress("treeName", &treeName);
+   t->SetBranchAddress("entries", &entries);
+   t->SetBranchAddress("clusterStarts", &clusterStarts);
+   for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+      t->GetEntry(e);
+      index[{*fileName, *treeName}] = TreeClusters{entries, *clusterStarts};
+   }
+   t->ResetBranchAddresses();
+   delete fileName;
+   delete treeName;
+   delete clusterStarts;
+   return index;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Store the entries and clusters of the trees in the index file, replacing its previous contents.
+static void WriteClusterIndex(const std::string &indexFileName, const ClusterIndex &index)
+{
+   TDirectory::TContext c;
+   std::unique_ptr<TFile> f(TFile::Open(indexFileName.c_str(), "RECREATE"));
+   if (!f || f->IsZombie())
+      throw std::runtime_error("TTreeProcessorMT: cannot write the cluster index to file \"" + indexFileName + "\"");
+
+   std::string fileName, treeName;
+   std::vector<Long64_t> clusterStarts;
+   Long64_t entries = 0ll;
+   TTree t("ClusterIndex", "Entries and clusters of the trees processed by TTreeProcessorMT");
+   t.Branch("fileName", &fileName);
+   t.Branch("treeName", &treeName);
+   t.Branch("entries", &entries);
+   t.Branch("clusterStarts", &clusterStarts);
+   for (const auto &tree : index) {
+      std::tie(fileName, treeName) = tree.first;
+      entries = tree.second.entries;
+      clusterStarts = tree.second.clusterStarts;
+      t.Fill();
+   }
+   t.Write();
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Return the full path of the TTree or the trees in the TChain
 static std::vector<std::string> GetTreeFullPaths(const TTree &tree)
@@ -200,6 +367,7 @@ static std::vector<std::string> GetTreeFullPaths(const TTree &tree)
 namespace ROOT {
 
 unsigned int TTreeProcessorMT::fgMaxTasksPerFilePerWorker = 24U;
+Long64_t TTreeProcessorMT::fgMinEntriesPerTask = 1000;
 
 namespace Internal {
 
@@ -534,14 +702,21 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    const bool hasFriends = !friendNames.empty();
    const bool hasEntryList = fEntryList.GetN() > 0;
    const bool shouldRetrieveAllClusters = hasFriends || hasEntryList;
+   // Entries and clusters of the trees read in previous runs, if any. It is completed with the trees opened here.
+   auto index = fClusterIndexFile.empty() ? ClusterIndex{} : ReadClusterIndex(fClusterIndexFile);
+   const auto indexSize = index.size();
+   std::mutex indexMutex; // the tasks processing the files complete the index concurrently
+   // The files are opened concurrently by the tasks of the pool
    const auto clustersAndEntries =
-      shouldRetrieveAllClusters ? MakeClusters(fTreeNames, fFileNames) : ClustersAndEntries{};
+      shouldRetrieveAllClusters ? MakeClusters(fTreeNames, fFileNames, index, &fPool) : ClustersAndEntries{};
    const auto &clusters = clustersAndEntries.first;
    const auto &entries = clustersAndEntries.second;
 
    // Retrieve number of entries for each file for each friend tree
-   const auto friendEntries =
-      hasFriends ? GetFriendEntries(friendNames, friendFileNames) : std::vector<std::vector<Long64_t>>{};
+   const auto friendEntries = hasFriends ? GetFriendEntries(friendNames, friendFileNames, index, &fPool)
+                                         : std::vector<std::vector<Long64_t>>{};
+
+   const auto nWorkers = fPool.GetPoolSize();
 
    // Parent task, spawns tasks that process each of the entry clusters for each input file
    auto processFile = [&](std::size_t fileIdx) {
@@ -549,9 +724,23 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
       const auto &theseFiles = shouldRetrieveAllClusters ? fFileNames : std::vector<std::string>({fFileNames[fileIdx]});
       // either all tree names or just the single tree to process
       const auto &theseTrees = shouldRetrieveAllClusters ? fTreeNames : std::vector<std::string>({fTreeNames[fileIdx]});
-      // Evaluate clusters (with local entry numbers) and number of entries for this file, if needed
-      const auto theseClustersAndEntries =
-         shouldRetrieveAllClusters ? ClustersAndEntries{} : MakeClusters(theseTrees, theseFiles);
+      // Evaluate clusters (with local entry numbers) and number of entries for this file, if needed.
+      // The files are opened by their own tasks, so the processing of the first files starts while the next ones
+      // are still being opened.
+      auto makeFileClusters = [&]() {
+         ClusterIndex fileIndex;
+         {
+            std::lock_guard<std::mutex> lock(indexMutex);
+            const auto it = index.find({theseFiles[0], theseTrees[0]});
+            if (it != index.end())
+               fileIndex.insert(*it);
+         }
+         auto fileClustersAndEntries = MakeClusters(theseTrees, theseFiles, fileIndex, nullptr);
+         std::lock_guard<std::mutex> lock(indexMutex);
+         index.insert(fileIndex.begin(), fileIndex.end());
+         return fileClustersAndEntries;
+      };
+      const auto theseClustersAndEntries = shouldRetrieveAllClusters ? ClustersAndEntries{} : makeFileClusters();
 
       // All clusters for the file to process, either with global or local entry numbers
       const auto &thisFileClusters = shouldRetrieveAllClusters ? clusters[fileIdx] : theseClustersAndEntries.first[0];
@@ -568,13 +757,52 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
          func(*reader);
       };
 
-      fPool.Foreach(processCluster, thisFileClusters);
+      // Ranges are pulled from a shared queue by one task per worker: whichever worker is free takes the next range
+      const auto ranges = SplitForDynamicScheduling(thisFileClusters, nWorkers, fgMinEntriesPerTask);
+      std::atomic<std::size_t> nextRange(0u);
+      auto processRanges = [&]() {
+         for (auto i = nextRange++; i < ranges.size(); i = nextRange++)
+            processCluster(ranges[i]);
+      };
+      const auto nTasks = static_cast<unsigned>(std::min<std::size_t>(nWorkers, ranges.size()));
+      // If the threads are pinned to NUMA domains, all the clusters of a file are processed by the threads of one
+      // domain, which share its caches and its memory
+      const auto numaArena = ROOT::Internal::GetPoolManager()->GetNUMAArena(fileIdx);
+      if (numaArena.empty()) {
+         fPool.Foreach(processRanges, nTasks);
+      } else {
+         ROOT::TThreadExecutor domainPool;
+         domainPool.SetTaskArena(numaArena);
+         domainPool.Foreach(processRanges, nTasks);
+      }
    };
 
    std::vector<std::size_t> fileIdxs(fFileNames.size());
    std::iota(fileIdxs.begin(), fileIdxs.end(), 0u);
 
    fPool.Foreach(processFile, fileIdxs);
+
+   if (!fClusterIndexFile.empty() && index.size() != indexSize)
+      WriteClusterIndex(fClusterIndexFile, index);
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Sets the file storing the entries and clusters of the input trees.
+/// \param[in] fileName Name of the index file, or an empty string to not use one.
+///
+/// Before processing, the entries and the cluster boundaries of the trees
+/// listed in the index are read from it, instead of opening their files.
+/// The index is completed with the trees that were not in it, and written
+/// back at the end of Process. With many (remote) files, this saves the
+/// opening of all the files before the processing can start, if an entry
+/// list or friends are used, and the opening of each file before its clusters
+/// can be processed otherwise.
+///
+/// The trees are identified by file name and tree name: the index file must
+/// be removed if the contents of the input files change.
+void TTreeProcessorMT::SetClusterIndexFile(std::string_view fileName)
+{
+   fClusterIndexFile = std::string(fileName);
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -596,3 +824,24 @@ void TTreeProcessorMT::SetMaxTasksPerFilePerWorker(unsigned int maxTasksPerFile)
 {
    fgMaxTasksPerFilePerWorker = maxTasksPerFile;
 }
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Returns the minimum number of entries of the tasks created by splitting entry ranges.
+/// \return The minimum number of entries per task
+Long64_t TTreeProcessorMT::GetMinEntriesPerTask()
+{
+   return fgMinEntriesPerTask;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Sets the minimum number of entries of the tasks created by splitting entry ranges.
+/// \param[in] minEntries The minimum number of entries per task
+///
+/// Entry ranges that are large compared to the entries left to process are
+/// split, so that the workers complete at about the same time even if some
+/// clusters are much larger than others. Ranges are never split into tasks
+/// smaller than this, for which the overhead would exceed the benefit.
+void TTreeProcessorMT::SetMinEntriesPerTask(Long64_t minEntries)
+{
+   fgMinEntriesPerTask = minEntries > 0 ? minEntries : 1;
+}
@@ -18,16 +18,20 @@
 #include "TBranchSTL.h"
 #include "TBranchObject.h"
 #include "TBranchProxyDirector.h"
+#include "TBufferFile.h"
 #include "TClassEdit.h"
 #include "TFriendElement.h"
 #include "TFriendProxy.h"
 #include "TLeaf.h"
+#include "TMath.h"
 #include "TTreeProxyGenerator.h"
 #include "TRegexp.h"
 #include "TStreamerInfo.h"
 #include "TStreamerElement.h"
 #include "TNtuple.h"
 #include "TROOT.h"
+
+#include <cstring>
 #include <vector>
 
 // clang-format off
@@ -105,6 +109,9 @@ ROOT::Internal::TTreeReaderValueBase::operator=(const TTreeReaderValueBase& rhs)
       fSetupStatus = rhs.fSetupStatus;
       fReadStatus = rhs.fReadStatus;
       fStaticClassOffsets = rhs.fStaticClassOffsets;
+      fBulkStatus = EBulkStatus::kUnknown;
+      fBulkBranch = nullptr;
+      fBulkFirst = fBulkEnd = -1;
    }
    return *this;
 }
@@ -226,6 +233,9 @@ void ROOT::Internal::TTreeReaderValueBase::NotifyNewTree(TTree* newTree) {
    // Since the TTree structure might have change, let's make sure we
    // use the right reading function.
    fProxyReadFunc = &TTreeReaderValueBase::ProxyReadDefaultImpl;
+   fBulkStatus = EBulkStatus::kUnknown;
+   fBulkBranch = nullptr;
+   fBulkFirst = fBulkEnd = -1;
 
    if (!fHaveLeaf || !newTree) {
       fLeaf = nullptr;
@@ -250,6 +260,15 @@ void ROOT::Internal::TTreeReaderValueBase::NotifyNewTree(TTree* newTree) {
 /// Returns the memory address of the object being read.
 
 void* ROOT::Internal::TTreeReaderValueBase::GetAddress() {
+   if (fBulkStatus != EBulkStatus::kDisabled) {
+      if (fBulkStatus == EBulkStatus::kUnknown)
+         SetupBulkRead();
+      if (fBulkStatus == EBulkStatus::kEnabled) {
+         if (void *address = GetAddressBulk())
+            return address;
+      }
+   }
+
    if (ProxyRead() != kReadSuccess) return 0;
 
    if (fHaveLeaf){
@@ -274,6 +293,85 @@ void* ROOT::Internal::TTreeReaderValueBase::GetAddress() {
    return (Byte_t*)fProxy->GetWhere();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Decide whether the values of the branch can be served from whole baskets
+/// read with TBulkBranchRead instead of entry by entry: the branch must be a
+/// plain TBranch with a single leaf holding one value per entry, of exactly
+/// the fundamental type of this reader.
+
+void ROOT::Internal::TTreeReaderValueBase::SetupBulkRead()
+{
+   fBulkStatus = EBulkStatus::kDisabled;
+   fBulkBranch = nullptr;
+   fBulkFirst = fBulkEnd = -1;
+   if (!fProxy || fHaveLeaf || fHaveStaticClassOffsets || !fDict || fDict->IsA() != TDataType::Class())
+      return;
+   if (!fProxy->IsInitialized() && !fProxy->Setup())
+      return;
+   if (fProxy->fParent || fProxy->fIsMember || fProxy->fIsClone || fProxy->fIsaPointer || fProxy->fHasLeafCount)
+      return;
+
+   TBranch *branch = fProxy->fBranch;
+   if (!branch || branch->IsA() != TBranch::Class() || !branch->SupportsBulkRead())
+      return;
+   auto leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->At(0));
+   if (leaf->GetLeafCount() || leaf->GetLen() != 1 || leaf->GetLenType() > (Int_t)sizeof(fBulkValue))
+      return;
+   TClass *cl = nullptr;
+   EDataType type = kOther_t;
+   if (branch->GetExpectedType(cl, type) || cl || type != static_cast<TDataType *>(fDict)->GetType())
+      return;
+
+   if (!fBulkBuffer)
+      fBulkBuffer.reset(new TBufferFile(TBuffer::kWrite, 32 * 1024));
+   fBulkBranch = branch;
+   fBulkValueSize = leaf->GetLenType();
+   fBulkStatus = EBulkStatus::kEnabled;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the basket of fBulkBranch that contains the entry into fBulkBuffer.
+/// Disable bulk reading and return false if that is not possible, e.g. because
+/// the basket is already in memory or has a displacement array.
+
+Bool_t ROOT::Internal::TTreeReaderValueBase::LoadBulkBasket(Long64_t entry)
+{
+   fBulkFirst = fBulkEnd = -1;
+   const Long64_t *basketEntries = fBulkBranch->GetBasketEntry();
+   const Int_t basket = TMath::BinarySearch(fBulkBranch->GetWriteBasket() + 1, basketEntries, entry);
+   if (basket < 0 || basket >= fBulkBranch->GetWriteBasket()) {
+      // the entry is in the basket being written, which is not on file
+      fBulkStatus = EBulkStatus::kDisabled;
+      return kFALSE;
+   }
+   const Long64_t first = basketEntries[basket];
+   const Int_t n = fBulkBranch->GetBulkRead().GetBulkEntries(first, *fBulkBuffer);
+   if (n <= 0 || entry >= first + n) {
+      fBulkStatus = EBulkStatus::kDisabled;
+      return kFALSE;
+   }
+   fBulkFirst = first;
+   fBulkEnd = first + n;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the address of the value of the current entry, read in bulk, or a
+/// nullptr if it must be read through the branch proxy.
+
+void *ROOT::Internal::TTreeReaderValueBase::GetAddressBulk()
+{
+   // the tree of the branch, which might be a friend, has been loaded at the current entry by the TTreeReader
+   const Long64_t entry = fBulkBranch->GetTree()->GetReadEntry();
+   if (entry < 0)
+      return nullptr;
+   if ((entry < fBulkFirst || entry >= fBulkEnd) && !LoadBulkBasket(entry))
+      return nullptr;
+   std::memcpy(fBulkValue, fBulkBuffer->GetCurrent() + (entry - fBulkFirst) * fBulkValueSize, fBulkValueSize);
+   fReadStatus = kReadSuccess;
+   return fBulkValue;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Search a branch the name of which contains a "."
 /// \param[out] myLeaf The leaf identified by the name if found (can be untouched).
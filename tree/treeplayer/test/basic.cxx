@@ -381,3 +381,47 @@ TEST(TTreeReaderBasic, DisappearingBranch)
    gSystem->Unlink("DisappearingBranch0.root");
    gSystem->Unlink("DisappearingBranch1.root");
 }
+
+// Values of fundamental type are read basket by basket, also across the trees of a chain and when jumping back
+TEST(TTreeReaderBasic, BulkRead)
+{
+   auto createFile = [](const char *fileName, int first) {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int i = 0;
+      double d = 0.;
+      t.Branch("i", &i)->SetBasketSize(1024);
+      t.Branch("d", &d)->SetBasketSize(1024);
+      for (i = first; i < first + 1000; ++i) {
+         d = 0.5 * i;
+         t.Fill();
+      }
+      t.Write();
+      f.Close();
+   };
+   createFile("BulkRead0.root", 0);
+   createFile("BulkRead1.root", 1000);
+
+   TChain c("t");
+   c.Add("BulkRead0.root");
+   c.Add("BulkRead1.root");
+   TTreeReader r(&c);
+   TTreeReaderValue<int> i(r, "i");
+   TTreeReaderValue<double> d(r, "d");
+   int expected = 0;
+   while (r.Next()) {
+      EXPECT_EQ(expected, *i);
+      EXPECT_DOUBLE_EQ(0.5 * expected, *d);
+      ++expected;
+   }
+   EXPECT_EQ(2000, expected);
+
+   for (auto entry : {1500, 10, 999, 1000}) {
+      EXPECT_EQ(TTreeReader::kEntryValid, r.SetEntry(entry));
+      EXPECT_EQ(entry, *i);
+      EXPECT_DOUBLE_EQ(0.5 * entry, *d);
+   }
+
+   gSystem->Unlink("BulkRead0.root");
+   gSystem->Unlink("BulkRead1.root");
+}
@@ -0,0 +1,90 @@
+#include "TChain.h"
+#include "TFile.h"
+#include "TH1D.h"
+#include "TH2D.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeFormula.h"
+
+#include "gtest/gtest.h"
+
+static void WriteDrawFile(const char *filename, int seed)
+{
+   TFile file(filename, "recreate");
+   TTree t("t", "t");
+   float x = 0;
+   int n = 0;
+   UShort_t sel = 0;
+   double w = 0;
+   t.Branch("x", &x);
+   t.Branch("n", &n);
+   t.Branch("sel", &sel);
+   t.Branch("w", &w);
+   t.SetAutoFlush(1000);
+   for (int i = 0; i < 10000; ++i) {
+      x = ((i * 7919 + seed) % 1000) / 10.f;
+      n = (i + seed) % 37 - 18;
+      sel = i % 3;
+      w = 0.5 * (i % 5);
+      t.Fill();
+   }
+   t.Write();
+}
+
+static void ExpectSameHistograms(const TH1 &bulk, const TH1 &formula)
+{
+   ASSERT_EQ(bulk.GetNcells(), formula.GetNcells());
+   EXPECT_EQ(bulk.GetEntries(), formula.GetEntries());
+   for (int i = 0; i < bulk.GetNcells(); ++i)
+      EXPECT_DOUBLE_EQ(bulk.GetBinContent(i), formula.GetBinContent(i)) << "bin " << i;
+}
+
+TEST(TTreeFormula, DirectLeaf)
+{
+   TTree t("t", "t");
+   float x = 0;
+   int arr[2] = {};
+   t.Branch("x", &x);
+   t.Branch("arr", arr, "arr[2]/I");
+   t.Fill();
+
+   TTreeFormula leaf("leaf", "x", &t);
+   EXPECT_NE(leaf.GetDirectLeaf(), nullptr);
+   TTreeFormula expression("expression", "x+1", &t);
+   EXPECT_EQ(expression.GetDirectLeaf(), nullptr);
+   TTreeFormula array("array", "arr", &t);
+   EXPECT_EQ(array.GetDirectLeaf(), nullptr);
+}
+
+// "x+0" and "sel*1" are not direct reads of a leaf: they are evaluated with the formula, entry by entry
+TEST(TSelectorDraw, BulkReadMatchesFormula)
+{
+   const auto fname1 = "drawbatch1.root";
+   const auto fname2 = "drawbatch2.root";
+   WriteDrawFile(fname1, 1);
+   WriteDrawFile(fname2, 2);
+   {
+      TChain c("t");
+      c.Add(fname1);
+      c.Add(fname2);
+
+      c.Draw("x>>hbulk(100,0,100)", "", "goff");
+      c.Draw("x+0>>hformula(100,0,100)", "", "goff");
+      ExpectSameHistograms(*static_cast<TH1 *>(gDirectory->Get("hbulk")),
+                           *static_cast<TH1 *>(gDirectory->Get("hformula")));
+
+      c.Draw("n:x>>h2bulk(100,0,100,40,-20,20)", "sel", "goff");
+      c.Draw("n:x+0>>h2formula(100,0,100,40,-20,20)", "sel*1", "goff");
+      ExpectSameHistograms(*static_cast<TH1 *>(gDirectory->Get("h2bulk")),
+                           *static_cast<TH1 *>(gDirectory->Get("h2formula")));
+
+      // weights, and a first entry which is not the first of a basket
+      c.Draw("x>>hwbulk(100,0,100)", "w", "goff", 12345, 2500);
+      c.Draw("x+0>>hwformula(100,0,100)", "w*1", "goff", 12345, 2500);
+      ExpectSameHistograms(*static_cast<TH1 *>(gDirectory->Get("hwbulk")),
+                           *static_cast<TH1 *>(gDirectory->Get("hwformula")));
+   }
+   gSystem->Unlink(fname1);
+   gSystem->Unlink(fname2);
+}
@@ -0,0 +1,69 @@
+#include <TFile.h>
+#include <TSystem.h>
+#include <TTree.h>
+#include <TTreeIOProfiler.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+TEST(TTreeIOProfiler, PerBranchSteps)
+{
+   const auto fname = "ioprofiler.root";
+   {
+      TFile file(fname, "recreate");
+      TTree t("t", "t");
+      int i = 0;
+      double x = 0.;
+      t.Branch("i", &i);
+      t.Branch("x", &x);
+      t.SetAutoFlush(1000);
+      for (i = 0; i < 10000; ++i) {
+         x = i * 0.5;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TTreeIOProfiler profiler;
+   EXPECT_FALSE(profiler.IsActive());
+   profiler.Start();
+   EXPECT_TRUE(profiler.IsActive());
+   {
+      TFile file(fname);
+      auto t = file.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      for (Long64_t entry = 0; entry < t->GetEntries(); ++entry)
+         t->GetEntry(entry);
+   }
+   profiler.Stop();
+   EXPECT_FALSE(profiler.IsActive());
+
+   EXPECT_EQ(profiler.GetNThreads(), 1);
+   for (const char *branch : {"i", "x"}) {
+      const auto deserialized = profiler.GetStats(TTreeIOProfiler::kDeserialize, branch);
+      EXPECT_EQ(deserialized.fCalls, 10000);
+      EXPECT_GT(profiler.GetStats(TTreeIOProfiler::kBasketRead, branch).fCalls, 0);
+      EXPECT_GT(profiler.GetStats(TTreeIOProfiler::kBasketUnzip, branch).fBytes, 0);
+   }
+   EXPECT_EQ(profiler.GetStats(TTreeIOProfiler::kDeserialize, "i").fBytes, 10000 * (Long64_t)sizeof(int));
+   EXPECT_GT(profiler.GetStats(TTreeIOProfiler::kFileRead).fBytes, 0);
+   EXPECT_EQ(profiler.GetStats(TTreeIOProfiler::kDeserialize, "missing").fCalls, 0);
+
+   const auto trace = "ioprofiler.trace.json";
+   ASSERT_TRUE(profiler.SaveTimeline(trace));
+   std::ifstream in(trace);
+   std::stringstream content;
+   content << in.rdbuf();
+   EXPECT_NE(content.str().find("\"traceEvents\""), std::string::npos);
+   EXPECT_NE(content.str().find("\"cat\":\"BasketUnzip\""), std::string::npos);
+   EXPECT_EQ(content.str().find("\"cat\":\"Deserialize\""), std::string::npos);
+
+   profiler.Reset();
+   EXPECT_EQ(profiler.GetNThreads(), 0);
+
+   gSystem->Unlink(trace);
+   gSystem->Unlink(fname);
+}
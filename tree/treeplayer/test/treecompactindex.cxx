@@ -0,0 +1,212 @@
+#include <TChain.h>
+#include <TFile.h>
+#include <TSystem.h>
+#include <TTree.h>
+#include <TTreeCompactIndex.h>
+#include <TTreeIndex.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+static void WriteRunEventFile(const char *filename, int firstRun, int nRuns, int nEvents)
+{
+   TFile file(filename, "recreate");
+   TTree t("t", "t");
+   int run = 0;
+   Long64_t event = 0;
+   t.Branch("run", &run);
+   t.Branch("event", &event);
+   t.SetAutoFlush(100);
+   // runs in decreasing order, odd events only, so that the index has to sort and has holes
+   for (int r = firstRun + nRuns - 1; r >= firstRun; --r) {
+      for (int e = 0; e < nEvents; ++e) {
+         run = r;
+         event = 2 * e + 1;
+         t.Fill();
+      }
+   }
+   t.Write();
+}
+
+TEST(TTreeCompactIndex, MatchesTTreeIndex)
+{
+   const auto fname = "treecompactindex_matches.root";
+   WriteRunEventFile(fname, 1000, 10, 250);
+   {
+      TFile f(fname);
+      auto t = f.Get<TTree>("t");
+      TTreeIndex reference(t, "run", "event");
+      TTreeCompactIndex index(t, "run", "event");
+      ASSERT_FALSE(index.IsZombie());
+      EXPECT_EQ(index.GetN(), reference.GetN());
+
+      std::vector<Long64_t> majors, minors;
+      for (Long64_t run = 998; run < 1012; ++run) {
+         for (Long64_t event = -1; event < 503; ++event) {
+            EXPECT_EQ(index.GetEntryNumberWithIndex(run, event), reference.GetEntryNumberWithIndex(run, event));
+            EXPECT_EQ(index.GetEntryNumberWithBestIndex(run, event),
+                      reference.GetEntryNumberWithBestIndex(run, event));
+            majors.push_back(run);
+            minors.push_back(event);
+         }
+      }
+
+      // batched lookups, sorted and then in reverse order
+      std::vector<Long64_t> entries(majors.size());
+      index.GetEntryNumbersWithIndex(majors.size(), majors.data(), minors.data(), entries.data());
+      for (std::size_t i = 0; i < majors.size(); ++i)
+         EXPECT_EQ(entries[i], reference.GetEntryNumberWithIndex(majors[i], minors[i]));
+      std::reverse(majors.begin(), majors.end());
+      std::reverse(minors.begin(), minors.end());
+      index.GetEntryNumbersWithIndex(majors.size(), majors.data(), minors.data(), entries.data());
+      for (std::size_t i = 0; i < majors.size(); ++i)
+         EXPECT_EQ(entries[i], reference.GetEntryNumberWithIndex(majors[i], minors[i]));
+   }
+   gSystem->Unlink(fname);
+}
+
+TEST(TTreeCompactIndex, UsedByTree)
+{
+   const auto fname = "treecompactindex_tree.root";
+   WriteRunEventFile(fname, 1, 3, 10);
+   {
+      TFile f(fname);
+      auto t = f.Get<TTree>("t");
+      t->SetTreeIndex(new TTreeCompactIndex(t, "run", "event"));
+      int run = 0;
+      Long64_t event = 0;
+      t->SetBranchAddress("run", &run);
+      t->SetBranchAddress("event", &event);
+      EXPECT_GT(t->GetEntryWithIndex(2, 7), 0);
+      EXPECT_EQ(run, 2);
+      EXPECT_EQ(event, 7);
+      EXPECT_EQ(t->GetEntryNumberWithIndex(2, 8), -1);
+   }
+   gSystem->Unlink(fname);
+}
+
+TEST(TTreeCompactIndex, Chain)
+{
+   const auto fname1 = "treecompactindex_chain1.root";
+   const auto fname2 = "treecompactindex_chain2.root";
+   WriteRunEventFile(fname1, 10, 2, 50);
+   WriteRunEventFile(fname2, 1, 2, 50);
+   {
+      TChain c("t");
+      c.Add(fname1);
+      c.Add(fname2);
+      TTreeCompactIndex index(&c, "run", "event");
+      ASSERT_FALSE(index.IsZombie());
+      EXPECT_EQ(index.GetN(), 200);
+      // the second file starts with run 2 and holds run 1 after it
+      EXPECT_EQ(index.GetEntryNumberWithIndex(2, 1), 100);
+      EXPECT_EQ(index.GetEntryNumberWithIndex(1, 99), 199);
+      EXPECT_EQ(index.GetEntryNumberWithIndex(11, 1), 0);
+   }
+   gSystem->Unlink(fname1);
+   gSystem->Unlink(fname2);
+}
+
+TEST(TTreeCompactIndex, Append)
+{
+   TTree t1("t1", "t1");
+   TTree t2("t2", "t2");
+   int run = 0;
+   t1.Branch("run", &run);
+   t2.Branch("run", &run);
+   for (run = 0; run < 5; ++run)
+      t1.Fill();
+   for (run = 10; run > 5; --run)
+      t2.Fill();
+
+   TTreeCompactIndex index(&t1, "run");
+   TTreeCompactIndex add(&t2, "run");
+   index.Append(&add, kTRUE);
+   index.Append(nullptr, kFALSE);
+   EXPECT_EQ(index.GetN(), 10);
+   EXPECT_EQ(index.GetEntryNumberWithIndex(3, 0), 3);
+   EXPECT_EQ(index.GetEntryNumberWithIndex(10, 0), 5);
+   EXPECT_EQ(index.GetEntryNumberWithIndex(6, 0), 9);
+   EXPECT_EQ(index.GetEntryNumberWithIndex(5, 0), -1);
+   EXPECT_EQ(index.GetEntryNumberWithBestIndex(5, 0), 4);
+}
+
+TEST(TTreeCompactIndex, Invalid)
+{
+   TTree t("t", "t");
+   Long64_t major = 0, minor = 0;
+   double x = 0;
+   t.Branch("major", &major);
+   t.Branch("minor", &minor);
+   t.Branch("x", &x);
+   major = std::numeric_limits<Long64_t>::min();
+   t.Fill();
+   major = std::numeric_limits<Long64_t>::max();
+   minor = 1;
+   t.Fill();
+
+   // not an integer branch
+   TTreeCompactIndex notInteger(&t, "x");
+   EXPECT_TRUE(notInteger.IsZombie());
+   // 64 bits for the major values, one for the minor ones
+   TTreeCompactIndex tooWide(&t, "major", "minor");
+   EXPECT_TRUE(tooWide.IsZombie());
+   TTreeCompactIndex majorOnly(&t, "major");
+   EXPECT_FALSE(majorOnly.IsZombie());
+   EXPECT_EQ(majorOnly.GetEntryNumberWithIndex(std::numeric_limits<Long64_t>::max(), 0), 1);
+}
+
+TEST(TTreeCompactIndex, IndexedFriend)
+{
+   const auto masterName = "treecompactindex_master.root";
+   const auto friendName = "treecompactindex_friend.root";
+   WriteRunEventFile(masterName, 1, 4, 300);
+   {
+      // the friend holds the same pairs, in another order, with a value derived from them
+      TFile file(friendName, "recreate");
+      TTree t("f", "f");
+      int run = 0;
+      Long64_t event = 0, value = 0;
+      t.Branch("run", &run);
+      t.Branch("event", &event);
+      t.Branch("value", &value);
+      t.SetAutoFlush(70);
+      for (int e = 299; e >= 0; --e) {
+         for (run = 1; run <= 4; ++run) {
+            event = 2 * e + 1;
+            value = 1000 * run + event;
+            t.Fill();
+         }
+      }
+      t.Write();
+   }
+   {
+      TFile fm(masterName);
+      auto master = fm.Get<TTree>("t");
+      TFile ff(friendName);
+      auto friendTree = ff.Get<TTree>("f");
+      friendTree->SetTreeIndex(new TTreeCompactIndex(friendTree, "run", "event"));
+      master->AddFriend(friendTree);
+
+      int run = 0;
+      Long64_t event = 0, value = 0;
+      master->SetBranchAddress("run", &run);
+      master->SetBranchAddress("event", &event);
+      master->SetBranchAddress("f.value", &value);
+      for (Long64_t entry = 0; entry < master->GetEntries(); ++entry) {
+         master->GetEntry(entry);
+         EXPECT_EQ(value, 1000 * run + event);
+      }
+      // random access, across clusters of the master tree
+      for (Long64_t entry : {1100LL, 5LL, 650LL, 651LL, 0LL}) {
+         master->GetEntry(entry);
+         EXPECT_EQ(value, 1000 * run + event);
+      }
+   }
+   gSystem->Unlink(masterName);
+   gSystem->Unlink(friendName);
+}
@@ -6,6 +6,8 @@
 #include <thread>
 #include <utility>
 
+#include <TChain.h>
+#include <TEntryList.h>
 #include <TFile.h>
 #include <TTree.h>
 #include <TSystem.h>
@@ -106,6 +108,71 @@ TEST(TreeProcessorMT, ManyFiles)
    DeleteFiles(filenames);
 }
 
+TEST(TreeProcessorMT, ClusterIndex)
+{
+   const auto nFiles = 4u;
+   const std::string treename = "t";
+   const std::string indexname = "treeprocmt_clusterindex.root";
+   std::vector<std::string> filenames;
+   for (auto i = 0u; i < nFiles; ++i)
+      filenames.emplace_back("treeprocmt_clusterindex" + std::to_string(i) + ".root");
+   WriteFiles(std::vector<std::string>(nFiles, treename), filenames);
+   gSystem->Unlink(indexname.c_str());
+
+   std::atomic_int sum(0);
+   std::atomic_int count(0);
+   auto sumValues = [&sum, &count](TTreeReader &r) {
+      TTreeReaderValue<int> v(r, "v");
+      while (r.Next()) {
+         sum += *v;
+         ++count;
+      }
+   };
+
+   std::vector<std::string_view> fnames(filenames.begin(), filenames.end());
+   ROOT::TTreeProcessorMT proc(fnames, treename);
+   proc.SetClusterIndexFile(indexname);
+   proc.Process(sumValues);
+   EXPECT_EQ(count.load(), int(nFiles * 10));
+   EXPECT_EQ(sum.load(), 820);
+
+   // The index lists the entries and clusters of all trees
+   {
+      TFile f(indexname.c_str());
+      auto t = f.Get<TTree>("ClusterIndex");
+      ASSERT_NE(t, nullptr);
+      EXPECT_EQ(t->GetEntries(), nFiles);
+      TTreeReader r(t);
+      TTreeReaderValue<std::string> treeName(r, "treeName");
+      TTreeReaderValue<Long64_t> entries(r, "entries");
+      TTreeReaderValue<std::vector<Long64_t>> clusterStarts(r, "clusterStarts");
+      while (r.Next()) {
+         EXPECT_EQ(*treeName, treename);
+         EXPECT_EQ(*entries, 10);
+         ASSERT_FALSE(clusterStarts->empty());
+         EXPECT_EQ(clusterStarts->front(), 0);
+      }
+   }
+
+   // A chain with an entry list takes the global entry numbers of all files from the index
+   TChain chain(treename.c_str());
+   for (const auto &f : filenames)
+      chain.Add(f.c_str());
+   TEntryList elist;
+   elist.Enter(12);
+   elist.Enter(15);
+   ROOT::TTreeProcessorMT procWithList(chain, elist);
+   procWithList.SetClusterIndexFile(indexname);
+   sum = 0;
+   count = 0;
+   procWithList.Process(sumValues);
+   EXPECT_EQ(count.load(), 2);
+   EXPECT_EQ(sum.load(), 13 + 16);
+
+   DeleteFiles(filenames);
+   gSystem->Unlink(indexname.c_str());
+}
+
 TEST(TreeProcessorMT, TreesWithDifferentNamesChainCtor)
 {
    const std::vector<std::string> treenames{"t0","t1","t2"};
@@ -288,6 +355,45 @@ TEST(TreeProcessorMT, LimitNTasks_CheckClusters)
    gSystem->Unlink(filename);
 }
 
+TEST(TreeProcessorMT, SplitLargeClusters)
+{
+   const auto nEvents = 100000;
+   const auto filename = "TreeProcessorMT_SplitLargeClusters.root";
+   const auto treename = "t";
+   {
+      int v = 0;
+      TFile file(filename, "recreate");
+      TTree t(treename, treename);
+      t.SetAutoFlush(0); // a single cluster
+      t.Branch("v", &v);
+      for (auto i = 0; i < nEvents; ++i)
+         t.Fill();
+      t.Write();
+   }
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> clusters;
+   auto get_clusters = [&m, &clusters](TTreeReader &t) {
+      std::lock_guard<std::mutex> l(m);
+      clusters.emplace_back(t.GetEntriesRange());
+   };
+
+   ROOT::EnableImplicitMT(4);
+
+   ROOT::TTreeProcessorMT p(filename, treename);
+   p.Process(get_clusters);
+
+   EXPECT_GT(clusters.size(), 4u) << "The cluster was not split!\n";
+   CheckClusters(clusters, nEvents);
+   // ranges shrink towards the end of the processing, but are never smaller than the minimum
+   EXPECT_GE(clusters.front().second - clusters.front().first, clusters.back().second - clusters.back().first);
+   for (const auto &c : clusters)
+      EXPECT_GE(c.second - c.first, ROOT::TTreeProcessorMT::GetMinEntriesPerTask());
+
+   gSystem->Unlink(filename);
+   ROOT::DisableImplicitMT();
+}
+
 TEST(TreeProcessorMT, TreeWithFriendTree)
 {
    std::vector<std::string> fileNames = {"TreeWithFriendTree_Tree.root", "TreeWithFriendTree_Friend.root"};